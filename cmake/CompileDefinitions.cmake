@@ -2,6 +2,11 @@
 target_compile_definitions("raylib" PUBLIC "${PLATFORM_CPP}")
 target_compile_definitions("raylib" PUBLIC "${GRAPHICS}")
 
+# Headless mode: GLFW built for null platform (OSMesa), rcore skips presentation and frame pacing
+if (USE_HEADLESS)
+    target_compile_definitions("raylib" PRIVATE _GLFW_OSMESA)
+endif ()
+
 function(define_if target variable)
     if (${${variable}})
         message(STATUS "${variable}=${${variable}}")
@@ -9,6 +14,9 @@ function(define_if target variable)
     endif ()
 endfunction()
 
+# Events automation is a testing tool (disabled in config.h), only enabled for benchmark builds
+define_if("raylib" SUPPORT_EVENTS_AUTOMATION)
+
 if (${CUSTOMIZE_BUILD})
     target_compile_definitions("raylib" PUBLIC EXTERNAL_CONFIG_FLAGS)
     define_if("raylib" USE_AUDIO)
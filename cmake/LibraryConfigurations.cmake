@@ -83,6 +83,15 @@ elseif (${PLATFORM} MATCHES "DRM")
     endif ()
     set(LIBS_PRIVATE ${GLESV2} ${EGL} ${DRM} ${GBM} pthread m dl)
 
+elseif (${PLATFORM} MATCHES "NX")
+    # NOTE: Requires devkitPro Switch toolchain file: -DCMAKE_TOOLCHAIN_FILE=$DEVKITPRO/cmake/Switch.cmake
+    set(PLATFORM_CPP "PLATFORM_NX")
+    set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
+
+    add_definitions(-D__SWITCH__)
+
+    set(LIBS_PRIVATE glfw3 EGL GLESv2 glad glapi drm_nouveau nx m)
+
 endif ()
 
 if (${OPENGL_VERSION})
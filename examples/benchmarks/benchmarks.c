@@ -0,0 +1,829 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] - benchmarks suite
+*
+*   Scripted scenarios covering every module: sprites batching, text drawing with a large font,
+*   shapes tessellation, meshes drawing and instancing, skinning, image processing, audio mixing
+*   with N voices and physac with N bodies. Every scenario draws some warmup frames and then the
+*   measured frames, frame time mean/p99 and throughput are reported as JSON (stdout and file)
+*
+*   Usage: benchmarks [--frames N] [--warmup N] [--output file.json] [--font file.ttf] [scenario[=count] ...]
+*       i.e: benchmarks --frames 1200 sprites=50000 physics=1000
+*
+*   NOTE: Scenarios content is generated (no resources required), all scenarios are run if none is selected,
+*   frames are not limited (no target FPS, no VSync) so frame times measure the work done
+*
+*   This example has been created using raylib 4.0 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2022 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#define PHYSAC_IMPLEMENTATION
+#define PHYSAC_AVOID_TIMMING_SYSTEM // One physics step by UpdatePhysics() call
+#include "extras/physac.h"
+
+#include "rlgl.h"                   // Required for: rlGetFrameStats()
+
+#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>                 // Required for: atoi(), qsort()
+#include <string.h>                 // Required for: strcmp(), strchr(), strlen()
+#include <math.h>                   // Required for: sinf(), cosf()
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_NX, PLATFORM_RPI, PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+#if defined(PLATFORM_NX)
+    #define BENCHMARK_PLATFORM      "PLATFORM_NX"
+#elif defined(PLATFORM_DESKTOP)
+    #define BENCHMARK_PLATFORM      "PLATFORM_DESKTOP"
+#elif defined(PLATFORM_ANDROID)
+    #define BENCHMARK_PLATFORM      "PLATFORM_ANDROID"
+#elif defined(PLATFORM_WEB)
+    #define BENCHMARK_PLATFORM      "PLATFORM_WEB"
+#else
+    #define BENCHMARK_PLATFORM      "PLATFORM_DRM"
+#endif
+
+#define SKIN_BONES              16      // Skinned model bones (chain along Z axis)
+#define SKIN_FRAMES             60      // Skinned model animation frames
+#define SKIN_LENGTH             8.0f    // Skinned model length
+#define IMAGE_SIZE              512     // Image processing source image size
+#define AUDIO_VOICE_FRAMES      11025   // Audio voices sound length (frames at 44100 Hz)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    BENCHMARK_SPRITES = 0,
+    BENCHMARK_TEXT,
+    BENCHMARK_SHAPES,
+    BENCHMARK_MESHES,
+    BENCHMARK_INSTANCING,
+    BENCHMARK_SKINNING,
+    BENCHMARK_IMAGE,
+    BENCHMARK_AUDIO,
+    BENCHMARK_PHYSICS,
+    BENCHMARK_COUNT
+} BenchmarkType;
+
+// Benchmark scenario info
+typedef struct BenchmarkInfo {
+    const char *name;           // Scenario name (command line and report)
+    const char *unit;           // Throughput unit (items per second)
+    int count;                  // Default count (sprites, glyphs, shapes, meshes, instances, models, images, voices, bodies)
+} BenchmarkInfo;
+
+// Benchmark scenario results
+typedef struct BenchmarkResult {
+    int type;                   // Scenario type (BenchmarkType)
+    int count;                  // Scenario count
+    bool skipped;               // Scenario could not run (i.e. no audio device)
+    int frames;                 // Measured frames
+    double mean;                // Frame time mean (seconds)
+    double p99;                 // Frame time 99th percentile (seconds)
+    double min;                 // Frame time minimum (seconds)
+    double max;                 // Frame time maximum (seconds)
+    double throughput;          // Items processed per second
+    double drawCalls;           // Draw calls by frame (mean)
+    double gpuTime;             // GPU time by frame (mean, seconds), -1.0 if not supported
+    double mixMean;             // Audio: mixing time by device period (mean, seconds)
+    double mixP99;              // Audio: mixing time by device period (99th percentile, seconds)
+    double mixLoad;             // Audio: mixer thread load (mixing time by measured time)
+} BenchmarkResult;
+
+// Benchmark scenario loaded data
+typedef struct BenchmarkState {
+    int count;                  // Scenario count
+    double items;               // Items processed by frame (throughput)
+
+    Texture2D texture;          // Sprites texture
+    Vector4 *sprites;           // Sprites position (xy), rotation (z) and speed (w)
+    Font font;                  // Text font
+    bool fontLoaded;            // Text font loaded from file (unloaded on scenario end)
+    Camera camera;              // Meshes, instancing and skinning camera
+    Mesh mesh;                  // Meshes and instancing mesh
+    Material material;          // Meshes and instancing material
+    Matrix *transforms;         // Meshes and instancing transforms
+    Model model;                // Skinned model
+    ModelAnimation animation;   // Skinned model animation
+    Image image;                // Image processing source image
+    Sound *sounds;              // Audio voices sounds
+    AudioMixerStats mixStats;   // Audio mixer stats at measure start
+} BenchmarkState;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const BenchmarkInfo benchmarks[BENCHMARK_COUNT] = {
+    { "sprites", "sprites/s", 20000 },
+    { "text", "glyphs/s", 10000 },
+    { "shapes", "shapes/s", 5000 },
+    { "meshes", "meshes/s", 1000 },
+    { "instancing", "instances/s", 50000 },
+    { "skinning", "vertices/s", 16 },
+    { "image", "pixels/s", 4 },
+    { "audio", "voice frames/s", 64 },
+    { "physics", "body steps/s", 500 },
+};
+
+static const char *benchmarkText = "The quick brown fox jumps over the lazy dog 0123456789 #$%&/()=?!";
+
+// Instancing shader, instances transforms on attribute location SHADER_LOC_MATRIX_MODEL
+#if (GLSL_VERSION == 330)
+static const char *instancingVsCode =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec3 vertexNormal;\n"
+    "in mat4 instanceTransform;\n"
+    "uniform mat4 mvp;\n"
+    "out vec3 fragNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    fragNormal = normalize((instanceTransform*vec4(vertexNormal, 0.0)).xyz);\n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+static const char *instancingFsCode =
+    "#version 330\n"
+    "in vec3 fragNormal;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    float light = 0.4 + 0.6*max(dot(fragNormal, normalize(vec3(0.4, 1.0, 0.3))), 0.0);\n"
+    "    finalColor = vec4(colDiffuse.rgb*light, colDiffuse.a);\n"
+    "}\n";
+#else
+static const char *instancingVsCode =
+    "#version 100\n"
+    "attribute vec3 vertexPosition;\n"
+    "attribute vec3 vertexNormal;\n"
+    "attribute mat4 instanceTransform;\n"
+    "uniform mat4 mvp;\n"
+    "varying vec3 fragNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    fragNormal = normalize((instanceTransform*vec4(vertexNormal, 0.0)).xyz);\n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+static const char *instancingFsCode =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec3 fragNormal;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main()\n"
+    "{\n"
+    "    float light = 0.4 + 0.6*max(dot(fragNormal, normalize(vec3(0.4, 1.0, 0.3))), 0.0);\n"
+    "    gl_FragColor = vec4(colDiffuse.rgb*light, colDiffuse.a);\n"
+    "}\n";
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static BenchmarkResult RunBenchmark(int type, int count, int warmupFrames, int frames, const char *fontFile);  // Run scenario: warmup and measured frames
+static bool LoadBenchmark(BenchmarkState *state, int type, const char *fontFile);   // Load scenario data, returns false if it can not run
+static void UpdateBenchmark(BenchmarkState *state, int type);                        // Scenario CPU work (before drawing), skinning is done on drawing
+static void DrawBenchmark(BenchmarkState *state, int type, int frame);               // Scenario drawing
+static void UnloadBenchmark(BenchmarkState *state, int type);                        // Unload scenario data
+static Model GenSkinnedModel(ModelAnimation *animation);    // Generate skinned strip model (bones chain) and its bending animation
+static int CompareValues(const void *a, const void *b);      // Compare values for sorting (ascending)
+static double GetPercentile(double *values, int count, float percentile);  // Get values percentile (values are sorted)
+static void ExportBenchmarkResults(FILE *file, const BenchmarkResult *results, int count, int warmupFrames, int frames);  // Export results as JSON
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 1280;
+    const int screenHeight = 720;
+
+    int warmupFrames = 60;
+    int frames = 600;
+    const char *outputFile = "benchmarks.json";
+    const char *fontFile = NULL;
+
+    int counts[BENCHMARK_COUNT] = { 0 };    // Selected scenarios count, 0 if not selected
+    bool selected = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--warmup") == 0) && (i + 1 < argc)) warmupFrames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else if ((strcmp(argv[i], "--font") == 0) && (i + 1 < argc)) fontFile = argv[++i];
+        else
+        {
+            const char *separator = strchr(argv[i], '=');
+            int nameLength = (separator != NULL)? (int)(separator - argv[i]) : (int)strlen(argv[i]);
+            int type = 0;
+
+            for (; type < BENCHMARK_COUNT; type++)
+            {
+                if (((int)strlen(benchmarks[type].name) == nameLength) && (strncmp(argv[i], benchmarks[type].name, nameLength) == 0)) break;
+            }
+
+            if (type == BENCHMARK_COUNT)
+            {
+                printf("Unknown benchmark scenario: %s\nScenarios:", argv[i]);
+                for (int j = 0; j < BENCHMARK_COUNT; j++) printf(" %s", benchmarks[j].name);
+                printf("\n");
+                return 1;
+            }
+
+            counts[type] = (separator != NULL)? atoi(separator + 1) : benchmarks[type].count;
+            if (counts[type] <= 0) counts[type] = benchmarks[type].count;
+            selected = true;
+        }
+    }
+
+    if (frames < 1) frames = 1;
+    if (warmupFrames < 0) warmupFrames = 0;
+
+    for (int i = 0; (i < BENCHMARK_COUNT) && !selected; i++) counts[i] = benchmarks[i].count;
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(screenWidth, screenHeight, "raylib [benchmarks] - benchmarks suite");
+    SetTargetFPS(0);                    // Frames are not limited, frame time measures work done
+
+    if (counts[BENCHMARK_AUDIO] > 0) InitAudioDevice();
+
+    BenchmarkResult results[BENCHMARK_COUNT] = { 0 };
+    int resultsCount = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Run selected scenarios
+    //--------------------------------------------------------------------------------------
+    for (int type = 0; (type < BENCHMARK_COUNT) && !WindowShouldClose(); type++)
+    {
+        if (counts[type] == 0) continue;
+
+        results[resultsCount] = RunBenchmark(type, counts[type], warmupFrames, frames, fontFile);
+        resultsCount++;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Export results
+    //--------------------------------------------------------------------------------------
+    ExportBenchmarkResults(stdout, results, resultsCount, warmupFrames, frames);
+
+    FILE *file = fopen(outputFile, "wt");
+
+    if (file != NULL)
+    {
+        ExportBenchmarkResults(file, results, resultsCount, warmupFrames, frames);
+        fclose(file);
+    }
+    else printf("Failed to write benchmarks results file: %s\n", outputFile);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    if (IsAudioDeviceReady()) CloseAudioDevice();
+
+    CloseWindow();              // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Run benchmark scenario: warmup frames and measured frames
+static BenchmarkResult RunBenchmark(int type, int count, int warmupFrames, int frames, const char *fontFile)
+{
+    BenchmarkResult result = { 0 };
+    result.type = type;
+    result.count = count;
+    result.gpuTime = -1.0;
+
+    BenchmarkState state = { 0 };
+    state.count = count;
+
+    SetRandomSeed(1);               // Same scenario content on every run
+
+    if (!LoadBenchmark(&state, type, fontFile))
+    {
+        result.skipped = true;
+        return result;
+    }
+
+    double *times = (double *)MemAlloc(frames*sizeof(double));
+    double *mixTimes = (double *)MemAlloc(frames*sizeof(double));
+    double totalTime = 0.0;
+    double gpuTime = 0.0;
+    int gpuFrames = 0;
+    double drawCalls = 0.0;
+
+    double previousTime = GetTime();
+
+    for (int frame = 0; frame < (warmupFrames + frames); frame++)
+    {
+        if (WindowShouldClose()) break;
+
+        // Audio mixer counters are taken on measure start
+        if ((type == BENCHMARK_AUDIO) && (frame == warmupFrames)) state.mixStats = GetAudioMixerStats();
+
+        UpdateBenchmark(&state, type);
+
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawBenchmark(&state, type, frame);
+
+            DrawRectangle(0, 0, 420, 30, Fade(BLACK, 0.6f));
+            DrawText(TextFormat("%s [%i]: frame %i/%i", benchmarks[type].name, count, frame + 1, warmupFrames + frames), 10, 8, 10, WHITE);
+
+        EndDrawing();
+
+        double currentTime = GetTime();
+
+        if (frame >= warmupFrames)
+        {
+            int measured = frame - warmupFrames;
+            times[measured] = currentTime - previousTime;
+            totalTime += times[measured];
+
+            rlFrameStats stats = rlGetFrameStats();
+            drawCalls += stats.drawCalls;
+            if (stats.gpuTime >= 0.0)
+            {
+                gpuTime += stats.gpuTime;
+                gpuFrames++;
+            }
+
+            if (type == BENCHMARK_AUDIO) mixTimes[measured] = GetAudioMixerStats().lastMixTime/1000000.0;
+
+            result.frames++;
+        }
+
+        previousTime = currentTime;
+    }
+
+    if (result.frames > 0)
+    {
+        result.mean = totalTime/result.frames;
+        result.p99 = GetPercentile(times, result.frames, 0.99f);    // Frame times are sorted
+        result.min = times[0];
+        result.max = times[result.frames - 1];
+        result.throughput = state.items*result.frames/totalTime;
+        result.drawCalls = drawCalls/result.frames;
+        if (gpuFrames > 0) result.gpuTime = gpuTime/gpuFrames;
+
+        if (type == BENCHMARK_AUDIO)
+        {
+            // Audio throughput measures mixer thread: voices frames mixed per second of mixing time
+            AudioMixerStats stats = GetAudioMixerStats();
+            unsigned int periods = stats.periods - state.mixStats.periods;
+            unsigned int mixedFrames = stats.frames - state.mixStats.frames;
+            double mixTime = (stats.mixTime - state.mixStats.mixTime)/1000000.0;
+
+            if (periods > 0) result.mixMean = mixTime/periods;
+            result.mixP99 = GetPercentile(mixTimes, result.frames, 0.99f);
+            result.mixLoad = mixTime/totalTime;
+            result.throughput = (mixTime > 0.0)? (double)count*mixedFrames/mixTime : 0.0;
+        }
+    }
+
+    MemFree(mixTimes);
+    MemFree(times);
+
+    UnloadBenchmark(&state, type);
+
+    return result;
+}
+
+// Load scenario data, returns false if it can not run
+static bool LoadBenchmark(BenchmarkState *state, int type, const char *fontFile)
+{
+    int count = state->count;
+
+    state->camera.position = (Vector3){ 0.0f, 30.0f, 60.0f };
+    state->camera.target = (Vector3){ 0.0f, 0.0f, 0.0f };
+    state->camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    state->camera.fovy = 45.0f;
+    state->camera.projection = CAMERA_PERSPECTIVE;
+
+    switch (type)
+    {
+        case BENCHMARK_SPRITES:
+        {
+            Image image = GenImageChecked(32, 32, 8, 8, MAROON, ORANGE);
+            state->texture = LoadTextureFromImage(image);
+            UnloadImage(image);
+
+            state->sprites = (Vector4 *)MemAlloc(count*sizeof(Vector4));
+
+            for (int i = 0; i < count; i++)
+            {
+                state->sprites[i] = (Vector4){ (float)GetRandomValue(0, GetScreenWidth()), (float)GetRandomValue(0, GetScreenHeight()),
+                    (float)GetRandomValue(0, 359), (float)GetRandomValue(-100, 100)/50.0f };
+            }
+
+            state->items = count;
+        } break;
+        case BENCHMARK_TEXT:
+        {
+            // Large font: loaded from file if provided, default font scaled otherwise
+            if (fontFile != NULL)
+            {
+                state->font = LoadFontEx(fontFile, 64, NULL, 0);
+                state->fontLoaded = true;
+            }
+            else state->font = GetFontDefault();
+
+            int lineLength = (int)strlen(benchmarkText);
+            state->items = ((count + lineLength - 1)/lineLength)*lineLength;
+        } break;
+        case BENCHMARK_SHAPES:
+        {
+            state->sprites = (Vector4 *)MemAlloc(count*sizeof(Vector4));
+
+            for (int i = 0; i < count; i++)
+            {
+                state->sprites[i] = (Vector4){ (float)GetRandomValue(0, GetScreenWidth()), (float)GetRandomValue(0, GetScreenHeight()),
+                    (float)GetRandomValue(0, 359), (float)GetRandomValue(8, 32) };
+            }
+
+            state->items = count;
+        } break;
+        case BENCHMARK_MESHES:
+        case BENCHMARK_INSTANCING:
+        {
+            state->material = LoadMaterialDefault();
+            state->transforms = (Matrix *)MemAlloc(count*sizeof(Matrix));
+
+            if (type == BENCHMARK_MESHES) state->mesh = GenMeshSphere(0.5f, 16, 16);
+            else
+            {
+                state->mesh = GenMeshCube(0.5f, 0.5f, 0.5f);
+
+                Shader shader = LoadShaderFromMemory(instancingVsCode, instancingFsCode);
+                shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+                state->material.shader = shader;
+                state->material.maps[MATERIAL_MAP_DIFFUSE].color = SKYBLUE;
+            }
+
+            // Objects placed in a square grid centered on origin
+            int side = (int)ceilf(sqrtf((float)count));
+            float spacing = 80.0f/side;
+
+            for (int i = 0; i < count; i++)
+            {
+                Vector3 position = { (i%side - side/2)*spacing, (float)GetRandomValue(-100, 100)/50.0f, (i/side - side/2)*spacing };
+                state->transforms[i] = MatrixMultiply(MatrixRotateY(GetRandomValue(0, 359)*DEG2RAD), MatrixTranslate(position.x, position.y, position.z));
+            }
+
+            state->items = count;
+        } break;
+        case BENCHMARK_SKINNING:
+        {
+            state->model = GenSkinnedModel(&state->animation);
+            state->camera.position = (Vector3){ 0.0f, 25.0f, 30.0f };
+            state->items = (double)count*state->model.meshes[0].vertexCount;
+        } break;
+        case BENCHMARK_IMAGE:
+        {
+            Image noise = GenImageWhiteNoise(IMAGE_SIZE, IMAGE_SIZE, 0.5f);
+            state->image = GenImageGradientRadial(IMAGE_SIZE, IMAGE_SIZE, 0.0f, GOLD, DARKBLUE);
+            ImageDraw(&state->image, noise, (Rectangle){ 0, 0, IMAGE_SIZE, IMAGE_SIZE }, (Rectangle){ 0, 0, IMAGE_SIZE, IMAGE_SIZE }, Fade(WHITE, 0.25f));
+            UnloadImage(noise);
+
+            state->items = (double)count*IMAGE_SIZE*IMAGE_SIZE;
+        } break;
+        case BENCHMARK_AUDIO:
+        {
+            if (!IsAudioDeviceReady()) return false;
+
+            // Every voice plays its own sound (a short tone), sounds are played again once they end
+            state->sounds = (Sound *)MemAlloc(count*sizeof(Sound));
+
+            Wave wave = { 0 };
+            wave.frameCount = AUDIO_VOICE_FRAMES;
+            wave.sampleRate = 44100;
+            wave.sampleSize = 32;
+            wave.channels = 1;
+            wave.data = MemAlloc(AUDIO_VOICE_FRAMES*sizeof(float));
+
+            for (int i = 0; i < count; i++)
+            {
+                float frequency = 110.0f + 20.0f*i;
+                for (int j = 0; j < AUDIO_VOICE_FRAMES; j++) ((float *)wave.data)[j] = 0.5f*sinf(2.0f*PI*frequency*j/44100.0f);
+
+                state->sounds[i] = LoadSoundFromWave(wave);
+                SetSoundVolume(state->sounds[i], 1.0f/count);
+            }
+
+            UnloadWave(wave);
+
+            state->items = count;
+        } break;
+        case BENCHMARK_PHYSICS:
+        {
+            InitPhysics();
+
+            PhysicsBody floor = CreatePhysicsBodyRectangle((Vector2){ GetScreenWidth()/2.0f, (float)GetScreenHeight() }, (float)GetScreenWidth(), 100, 10);
+            PhysicsBody left = CreatePhysicsBodyRectangle((Vector2){ 0.0f, GetScreenHeight()/2.0f }, 20, (float)GetScreenHeight()*4, 10);
+            PhysicsBody right = CreatePhysicsBodyRectangle((Vector2){ (float)GetScreenWidth(), GetScreenHeight()/2.0f }, 20, (float)GetScreenHeight()*4, 10);
+            floor->enabled = false;
+            left->enabled = false;
+            right->enabled = false;
+
+            // Bodies dropped from a grid above the floor, alternating circles, boxes and polygons
+            int columns = (GetScreenWidth() - 60)/16;
+
+            for (int i = 0; i < count; i++)
+            {
+                Vector2 position = { 30.0f + (i%columns)*16.0f + (i/columns)%2*4.0f, GetScreenHeight() - 80.0f - (i/columns)*16.0f };
+
+                if ((i%3) == 0) CreatePhysicsBodyCircle(position, 6, 10);
+                else if ((i%3) == 1) CreatePhysicsBodyRectangle(position, 12, 12, 10);
+                else CreatePhysicsBodyPolygon(position, 7, 5, 10);
+            }
+
+            state->items = count;
+        } break;
+        default: break;
+    }
+
+    return true;
+}
+
+// Scenario CPU work (before drawing)
+static void UpdateBenchmark(BenchmarkState *state, int type)
+{
+    switch (type)
+    {
+        case BENCHMARK_IMAGE:
+        {
+            for (int i = 0; i < state->count; i++)
+            {
+                Image image = ImageCopy(state->image);
+                ImageColorContrast(&image, 30.0f);
+                ImageResize(&image, IMAGE_SIZE*3/4, IMAGE_SIZE*3/4);
+                ImageRotateCW(&image);
+                ImageColorGrayscale(&image);
+                UnloadImage(image);
+            }
+        } break;
+        case BENCHMARK_AUDIO:
+        {
+            for (int i = 0; i < state->count; i++)
+            {
+                if (!IsSoundPlaying(state->sounds[i])) PlaySound(state->sounds[i]);
+            }
+        } break;
+        case BENCHMARK_PHYSICS: UpdatePhysics(); break;
+        default: break;
+    }
+}
+
+// Scenario drawing
+static void DrawBenchmark(BenchmarkState *state, int type, int frame)
+{
+    int count = state->count;
+
+    switch (type)
+    {
+        case BENCHMARK_SPRITES:
+        {
+            Rectangle source = { 0.0f, 0.0f, (float)state->texture.width, (float)state->texture.height };
+
+            for (int i = 0; i < count; i++)
+            {
+                Vector4 sprite = state->sprites[i];
+                Rectangle dest = { sprite.x, sprite.y, 32.0f, 32.0f };
+                DrawTexturePro(state->texture, source, dest, (Vector2){ 16.0f, 16.0f }, sprite.z + sprite.w*frame, WHITE);
+            }
+        } break;
+        case BENCHMARK_TEXT:
+        {
+            int lineLength = (int)strlen(benchmarkText);
+            int lines = (count + lineLength - 1)/lineLength;
+
+            for (int i = 0; i < lines; i++)
+            {
+                Vector2 position = { (float)((i*37 + frame)%200) - 100.0f, (float)((i*44)%(GetScreenHeight() + 40)) - 20.0f };
+                DrawTextEx(state->font, benchmarkText, position, 40.0f, 2.0f, ColorFromHSV((float)(i*7%360), 0.8f, 0.6f));
+            }
+        } break;
+        case BENCHMARK_SHAPES:
+        {
+            for (int i = 0; i < count; i++)
+            {
+                Vector4 shape = state->sprites[i];
+                Vector2 center = { shape.x, shape.y };
+                float rotation = shape.z + frame;
+                Color color = ColorFromHSV((float)(i%360), 0.7f, 0.8f);
+
+                switch (i%5)
+                {
+                    case 0: DrawCircleV(center, shape.w, color); break;
+                    case 1: DrawCircleSector(center, shape.w, rotation, rotation + 270.0f, 0, color); break;
+                    case 2: DrawRectangleRounded((Rectangle){ shape.x, shape.y, shape.w*2.0f, shape.w }, 0.5f, 0, color); break;
+                    case 3: DrawRing(center, shape.w*0.5f, shape.w, rotation, rotation + 300.0f, 0, color); break;
+                    case 4: DrawPoly(center, 6, shape.w, rotation, color); break;
+                    default: break;
+                }
+            }
+        } break;
+        case BENCHMARK_MESHES:
+        case BENCHMARK_INSTANCING:
+        {
+            BeginMode3D(state->camera);
+
+                if (type == BENCHMARK_MESHES)
+                {
+                    for (int i = 0; i < count; i++) DrawMesh(state->mesh, state->material, state->transforms[i]);
+                }
+                else DrawMeshInstanced(state->mesh, state->material, state->transforms, count);
+
+            EndMode3D();
+        } break;
+        case BENCHMARK_SKINNING:
+        {
+            // Same model skinned for every instance with a different animation frame (CPU skinning)
+            int side = (int)ceilf(sqrtf((float)count));
+
+            BeginMode3D(state->camera);
+
+                for (int i = 0; i < count; i++)
+                {
+                    UpdateModelAnimation(state->model, state->animation, frame + i*7);
+                    DrawModel(state->model, (Vector3){ (i%side - side/2)*3.0f, 0.0f, (i/side - side/2)*3.0f }, 1.0f, ColorFromHSV((float)(i*23%360), 0.6f, 0.8f));
+                }
+
+            EndMode3D();
+        } break;
+        case BENCHMARK_PHYSICS:
+        {
+            // Only bodies positions are drawn, bodies shapes drawing would hide physics cost
+            for (int i = 0; i < GetPhysicsBodiesCount(); i++)
+            {
+                PhysicsBody body = GetPhysicsBody(i);
+                if (body->enabled) DrawPixelV(body->position, body->isGrounded? MAROON : DARKGRAY);
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Unload scenario data
+static void UnloadBenchmark(BenchmarkState *state, int type)
+{
+    switch (type)
+    {
+        case BENCHMARK_SPRITES:
+        {
+            UnloadTexture(state->texture);
+            MemFree(state->sprites);
+        } break;
+        case BENCHMARK_TEXT: if (state->fontLoaded) UnloadFont(state->font); break;
+        case BENCHMARK_SHAPES: MemFree(state->sprites); break;
+        case BENCHMARK_MESHES:
+        case BENCHMARK_INSTANCING:
+        {
+            UnloadMesh(state->mesh);
+            UnloadMaterial(state->material);    // Instancing shader is also unloaded
+            MemFree(state->transforms);
+        } break;
+        case BENCHMARK_SKINNING:
+        {
+            UnloadModelAnimation(state->animation);
+            UnloadModel(state->model);
+        } break;
+        case BENCHMARK_IMAGE: UnloadImage(state->image); break;
+        case BENCHMARK_AUDIO:
+        {
+            for (int i = 0; i < state->count; i++) UnloadSound(state->sounds[i]);
+            MemFree(state->sounds);
+        } break;
+        case BENCHMARK_PHYSICS: ClosePhysics(); break;
+        default: break;
+    }
+}
+
+// Generate skinned strip model (bones chain along Z axis) and its bending animation
+static Model GenSkinnedModel(ModelAnimation *animation)
+{
+    Mesh mesh = GenMeshPlane(1.0f, SKIN_LENGTH, 8, 512);
+    float segment = SKIN_LENGTH/(SKIN_BONES - 1);
+
+    // Every vertex is weighted between the two closest bones
+    mesh.boneIds = (unsigned char *)MemAlloc(mesh.vertexCount*4*sizeof(unsigned char));
+    mesh.boneWeights = (float *)MemAlloc(mesh.vertexCount*4*sizeof(float));
+    mesh.animVertices = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    mesh.animNormals = (float *)MemAlloc(mesh.vertexCount*3*sizeof(float));
+    memcpy(mesh.animVertices, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+    memcpy(mesh.animNormals, mesh.normals, mesh.vertexCount*3*sizeof(float));
+
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        float bone = (mesh.vertices[i*3 + 2] + SKIN_LENGTH/2.0f)/segment;
+        int first = (int)bone;
+        if (first > (SKIN_BONES - 2)) first = SKIN_BONES - 2;
+
+        mesh.boneIds[i*4] = (unsigned char)first;
+        mesh.boneIds[i*4 + 1] = (unsigned char)(first + 1);
+        mesh.boneWeights[i*4] = 1.0f - (bone - first);
+        mesh.boneWeights[i*4 + 1] = bone - first;
+    }
+
+    Model model = LoadModelFromMesh(mesh);
+    model.boneCount = SKIN_BONES;
+    model.bones = (BoneInfo *)MemAlloc(SKIN_BONES*sizeof(BoneInfo));
+    model.bindPose = (Transform *)MemAlloc(SKIN_BONES*sizeof(Transform));
+
+    for (int i = 0; i < SKIN_BONES; i++)
+    {
+        model.bones[i].parent = i - 1;
+        TextCopy(model.bones[i].name, TextFormat("bone%02i", i));
+        model.bindPose[i] = (Transform){ (Vector3){ 0.0f, 0.0f, -SKIN_LENGTH/2.0f + i*segment }, QuaternionIdentity(), Vector3One() };
+    }
+
+    // Bending animation, bones poses are model space transforms
+    animation->boneCount = SKIN_BONES;
+    animation->frameCount = SKIN_FRAMES;
+    animation->bones = (BoneInfo *)MemAlloc(SKIN_BONES*sizeof(BoneInfo));
+    animation->framePoses = (Transform **)MemAlloc(SKIN_FRAMES*sizeof(Transform *));
+    memcpy(animation->bones, model.bones, SKIN_BONES*sizeof(BoneInfo));
+
+    for (int frame = 0; frame < SKIN_FRAMES; frame++)
+    {
+        Quaternion bend = QuaternionFromAxisAngle((Vector3){ 1.0f, 0.0f, 0.0f }, 0.2f*sinf(2.0f*PI*frame/SKIN_FRAMES));
+        Quaternion rotation = QuaternionIdentity();
+        Vector3 position = model.bindPose[0].translation;
+
+        animation->framePoses[frame] = (Transform *)MemAlloc(SKIN_BONES*sizeof(Transform));
+
+        for (int i = 0; i < SKIN_BONES; i++)
+        {
+            animation->framePoses[frame][i] = (Transform){ position, rotation, Vector3One() };
+
+            position = Vector3Add(position, Vector3RotateByQuaternion((Vector3){ 0.0f, 0.0f, segment }, rotation));
+            rotation = QuaternionMultiply(rotation, bend);
+        }
+    }
+
+    return model;
+}
+
+// Compare values for sorting (ascending)
+static int CompareValues(const void *a, const void *b)
+{
+    double diff = *(const double *)a - *(const double *)b;
+    return (diff > 0.0) - (diff < 0.0);
+}
+
+// Get values percentile (values are sorted)
+static double GetPercentile(double *values, int count, float percentile)
+{
+    qsort(values, count, sizeof(double), CompareValues);
+
+    int index = (int)ceilf(percentile*count) - 1;
+    if (index < 0) index = 0;
+
+    return values[index];
+}
+
+// Export benchmark results as JSON, times in milliseconds
+static void ExportBenchmarkResults(FILE *file, const BenchmarkResult *results, int count, int warmupFrames, int frames)
+{
+    fprintf(file, "{\n    \"raylib\": \"%s\",\n    \"platform\": \"%s\",\n    \"screen\": [%i, %i],\n    \"warmupFrames\": %i,\n    \"frames\": %i,\n    \"results\": [\n",
+        RAYLIB_VERSION, BENCHMARK_PLATFORM, GetScreenWidth(), GetScreenHeight(), warmupFrames, frames);
+
+    for (int i = 0; i < count; i++)
+    {
+        const BenchmarkResult *result = &results[i];
+        const char *separator = (i < (count - 1))? "," : "";
+
+        if (result->skipped)
+        {
+            fprintf(file, "        { \"scenario\": \"%s\", \"count\": %i, \"skipped\": true }%s\n", benchmarks[result->type].name, result->count, separator);
+            continue;
+        }
+
+        fprintf(file, "        { \"scenario\": \"%s\", \"count\": %i, \"frames\": %i, \"frameTime\": { \"mean\": %.4f, \"p99\": %.4f, \"min\": %.4f, \"max\": %.4f }, "
+            "\"throughput\": %.1f, \"unit\": \"%s\", \"drawCalls\": %.1f, \"gpuTime\": %.4f",
+            benchmarks[result->type].name, result->count, result->frames, result->mean*1000.0, result->p99*1000.0, result->min*1000.0, result->max*1000.0,
+            result->throughput, benchmarks[result->type].unit, result->drawCalls, (result->gpuTime >= 0.0)? result->gpuTime*1000.0 : -1.0);
+
+        if (result->type == BENCHMARK_AUDIO) fprintf(file, ", \"mixTime\": { \"mean\": %.4f, \"p99\": %.4f }, \"mixLoad\": %.4f", result->mixMean*1000.0, result->mixP99*1000.0, result->mixLoad);
+
+        fprintf(file, " }%s\n", separator);
+    }
+
+    fprintf(file, "    ]\n}\n");
+}
@@ -0,0 +1,539 @@
+/*******************************************************************************************
+*
+*   raylib [benchmarks] - microbenchmarks
+*
+*   Function level timings for raymath, rtextures, rtext and rmodels hot functions:
+*   MatrixMultiply(), Vector3Transform(), ImageFormat(), ImageResize(), GetGlyphIndex(),
+*   MeasureTextEx(), GetCodepoint(), GetRayCollisionMesh() and CompressData(). Every benchmark
+*   runs some warmup samples and then the measured samples, a sample times a batch of calls,
+*   time by call mean/p50/p99 and throughput are reported as JSON (stdout and file)
+*
+*   Usage: microbenchmarks [--samples N] [--warmup N] [--output file.json] [--resources path] [benchmark ...]
+*       i.e: microbenchmarks --samples 500 MatrixMultiply GetGlyphIndex
+*
+*   NOTE: No window is required (timing by GetTime(), fonts and models are loaded in RAM only),
+*   inputs are fixed resources from examples resources directories (default path: "..", examples directory)
+*
+*   This example has been created using raylib 4.0 (www.raylib.com)
+*   raylib is licensed under an unmodified zlib/libpng license (View raylib.h for details)
+*
+*   Copyright (c) 2022 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>                 // Required for: atoi(), qsort()
+#include <string.h>                 // Required for: strcmp()
+#include <math.h>                   // Required for: ceilf(), sinf(), cosf()
+
+#if defined(PLATFORM_NX)
+    #define BENCHMARK_PLATFORM      "PLATFORM_NX"
+#elif defined(PLATFORM_DESKTOP)
+    #define BENCHMARK_PLATFORM      "PLATFORM_DESKTOP"
+#elif defined(PLATFORM_ANDROID)
+    #define BENCHMARK_PLATFORM      "PLATFORM_ANDROID"
+#elif defined(PLATFORM_WEB)
+    #define BENCHMARK_PLATFORM      "PLATFORM_WEB"
+#else
+    #define BENCHMARK_PLATFORM      "PLATFORM_DRM"
+#endif
+
+#define INPUT_COUNT             256     // Matrices, vectors and rays inputs (generated from fixed seed)
+#define INPUT_SEED              0x5eed  // Inputs generation seed
+#define FONT_SIZE               32      // Font glyphs size
+#define FONT_FIRST_CHAR         32      // Font first codepoint (glyphs 32..255 loaded)
+#define FONT_GLYPHS             224     // Font glyphs count
+#define MAX_SAMPLES             100000  // Maximum measured samples
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    MICRO_MATRIX_MULTIPLY = 0,
+    MICRO_VECTOR3_TRANSFORM,
+    MICRO_IMAGE_FORMAT,
+    MICRO_IMAGE_RESIZE,
+    MICRO_GET_GLYPH_INDEX,
+    MICRO_MEASURE_TEXT,
+    MICRO_GET_CODEPOINT,
+    MICRO_RAY_COLLISION_MESH,
+    MICRO_COMPRESS_DATA,
+    MICRO_COUNT
+} MicroBenchmarkType;
+
+// Inputs shared by benchmarks
+typedef struct MicroInputs {
+    Matrix matrices[INPUT_COUNT];   // Transform matrices
+    Vector3 vectors[INPUT_COUNT];   // Points
+    Ray rays[INPUT_COUNT];          // Rays towards model center
+    int codepoints[INPUT_COUNT];    // Text codepoints (decoded)
+    int codepointCount;             // Text codepoints count
+    Image image;                    // Source image: textures/resources/parrots.png
+    Font font;                      // Font: text/resources/pixantiqua.ttf (RAM only)
+    Model model;                    // Model: models/resources/models/obj/castle.obj (RAM only)
+    Matrix modelTransform;          // Model transform for collisions
+} MicroInputs;
+
+// Benchmark info
+typedef struct MicroBenchmarkInfo {
+    const char *name;           // Benchmark name (command line and report), function measured
+    const char *unit;           // Throughput unit (items per second)
+    int batch;                  // Calls by sample
+    const char *resource;       // Resource file required (NULL if inputs are generated)
+} MicroBenchmarkInfo;
+
+// Benchmark results
+typedef struct MicroBenchmarkResult {
+    int type;                   // Benchmark type (MicroBenchmarkType)
+    bool skipped;               // Benchmark could not run (resource not found)
+    int samples;                // Measured samples
+    double mean;                // Call time mean (seconds)
+    double p50;                 // Call time median (seconds)
+    double p99;                 // Call time 99th percentile (seconds)
+    double min;                 // Call time minimum (seconds)
+    double max;                 // Call time maximum (seconds)
+    double throughput;          // Items processed per second
+} MicroBenchmarkResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const MicroBenchmarkInfo benchmarks[MICRO_COUNT] = {
+    { "MatrixMultiply", "calls/s", 1024, NULL },
+    { "Vector3Transform", "calls/s", 1024, NULL },
+    { "ImageFormat", "pixels/s", 1, "textures/resources/parrots.png" },
+    { "ImageResize", "pixels/s", 1, "textures/resources/parrots.png" },
+    { "GetGlyphIndex", "calls/s", 1024, "text/resources/pixantiqua.ttf" },
+    { "MeasureTextEx", "glyphs/s", 64, "text/resources/pixantiqua.ttf" },
+    { "GetCodepoint", "codepoints/s", 64, NULL },
+    { "GetRayCollisionMesh", "triangles/s", 4, "models/resources/models/obj/castle.obj" },
+    { "CompressData", "bytes/s", 1, "textures/resources/parrots.png" },
+};
+
+// Text for codepoints decoding and measuring: ASCII, Latin-1 (2 bytes) and symbols (3 bytes, not in font)
+static const char *benchmarkText = "The quick brown fox jumps over the lazy dog 0123456789\n"
+    "Árvíztűrő tükörfúrógép, Ça me plaît, Müßiggang, ¿Qué pasó? ¡Olé!\n"
+    "Price: 12,50 € “quoted” — dash • bullet … ellipsis";
+
+static volatile float sink = 0.0f;  // Results sink, avoids calls being optimized out
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static MicroBenchmarkResult RunMicroBenchmark(MicroInputs *inputs, int type, int warmupSamples, int samples);  // Run benchmark: warmup and measured samples
+static double RunMicroBenchmarkSample(MicroInputs *inputs, int type, int sample);    // Run benchmark batch of calls, returns measured time (seconds)
+static void LoadMicroInputs(MicroInputs *inputs, const char *resourcesPath, const bool *selected);  // Load fixed inputs (resources required by selected benchmarks)
+static void UnloadMicroInputs(MicroInputs *inputs);  // Unload inputs
+static double GetMicroItems(MicroInputs *inputs, int type);  // Get items processed by call (throughput)
+static int CompareValues(const void *a, const void *b);      // Compare values for sorting (ascending)
+static double GetPercentile(const double *values, int count, float percentile);  // Get values percentile (values must be sorted)
+static void ExportMicroBenchmarkResults(FILE *file, const MicroBenchmarkResult *results, int count, int warmupSamples, int samples);  // Export results as JSON
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    int warmupSamples = 20;
+    int samples = 200;
+    const char *outputFile = "microbenchmarks.json";
+    const char *resourcesPath = "..";
+
+    bool selected[MICRO_COUNT] = { 0 };
+    bool anySelected = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc)) samples = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--warmup") == 0) && (i + 1 < argc)) warmupSamples = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc)) outputFile = argv[++i];
+        else if ((strcmp(argv[i], "--resources") == 0) && (i + 1 < argc)) resourcesPath = argv[++i];
+        else
+        {
+            int type = 0;
+            for (; type < MICRO_COUNT; type++) if (strcmp(argv[i], benchmarks[type].name) == 0) break;
+
+            if (type == MICRO_COUNT)
+            {
+                printf("Unknown microbenchmark: %s\nMicrobenchmarks:", argv[i]);
+                for (int j = 0; j < MICRO_COUNT; j++) printf(" %s", benchmarks[j].name);
+                printf("\n");
+                return 1;
+            }
+
+            selected[type] = true;
+            anySelected = true;
+        }
+    }
+
+    if (samples < 1) samples = 1;
+    if (samples > MAX_SAMPLES) samples = MAX_SAMPLES;
+    if (warmupSamples < 0) warmupSamples = 0;
+
+    for (int i = 0; (i < MICRO_COUNT) && !anySelected; i++) selected[i] = true;
+
+    SetTraceLogLevel(LOG_ERROR);        // No window: textures and meshes GPU upload warnings are expected
+
+    MicroInputs inputs = { 0 };
+    LoadMicroInputs(&inputs, resourcesPath, selected);
+
+    MicroBenchmarkResult results[MICRO_COUNT] = { 0 };
+    int resultsCount = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Run selected benchmarks
+    //--------------------------------------------------------------------------------------
+    for (int type = 0; type < MICRO_COUNT; type++)
+    {
+        if (!selected[type]) continue;
+
+        results[resultsCount] = RunMicroBenchmark(&inputs, type, warmupSamples, samples);
+        resultsCount++;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Export results
+    //--------------------------------------------------------------------------------------
+    ExportMicroBenchmarkResults(stdout, results, resultsCount, warmupSamples, samples);
+
+    FILE *file = fopen(outputFile, "wt");
+
+    if (file != NULL)
+    {
+        ExportMicroBenchmarkResults(file, results, resultsCount, warmupSamples, samples);
+        fclose(file);
+    }
+    else printf("Failed to write microbenchmarks results file: %s\n", outputFile);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadMicroInputs(&inputs);
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Run benchmark: warmup samples and measured samples
+static MicroBenchmarkResult RunMicroBenchmark(MicroInputs *inputs, int type, int warmupSamples, int samples)
+{
+    MicroBenchmarkResult result = { 0 };
+    result.type = type;
+
+    bool available = true;
+
+    switch (type)
+    {
+        case MICRO_IMAGE_FORMAT:
+        case MICRO_IMAGE_RESIZE:
+        case MICRO_COMPRESS_DATA: available = (inputs->image.data != NULL); break;
+        case MICRO_GET_GLYPH_INDEX:
+        case MICRO_MEASURE_TEXT: available = (inputs->font.glyphs != NULL); break;
+        case MICRO_RAY_COLLISION_MESH: available = (inputs->model.meshCount > 0) && (inputs->model.meshes[0].vertices != NULL); break;
+        default: break;
+    }
+
+    if (!available)
+    {
+        printf("Microbenchmark %s skipped: resource not found (%s)\n", benchmarks[type].name, benchmarks[type].resource);
+        result.skipped = true;
+        return result;
+    }
+
+    for (int i = 0; i < warmupSamples; i++) RunMicroBenchmarkSample(inputs, type, i);
+
+    double *times = (double *)MemAlloc(samples*sizeof(double));
+    double total = 0.0;
+
+    for (int i = 0; i < samples; i++)
+    {
+        times[i] = RunMicroBenchmarkSample(inputs, type, warmupSamples + i)/benchmarks[type].batch;
+        total += times[i];
+    }
+
+    qsort(times, samples, sizeof(double), CompareValues);
+
+    result.samples = samples;
+    result.mean = total/samples;
+    result.p50 = GetPercentile(times, samples, 0.50f);
+    result.p99 = GetPercentile(times, samples, 0.99f);
+    result.min = times[0];
+    result.max = times[samples - 1];
+    result.throughput = (total > 0.0)? GetMicroItems(inputs, type)*samples/total : 0.0;
+
+    MemFree(times);
+
+    return result;
+}
+
+// Run benchmark batch of calls, returns measured time (seconds)
+// NOTE: Inputs preparation (i.e. image copies) is not measured
+static double RunMicroBenchmarkSample(MicroInputs *inputs, int type, int sample)
+{
+    const int batch = benchmarks[type].batch;
+    double time = 0.0;
+    float value = 0.0f;
+
+    switch (type)
+    {
+        case MICRO_MATRIX_MULTIPLY:
+        {
+            Matrix result = inputs->matrices[sample%INPUT_COUNT];
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++) result = MatrixMultiply(result, inputs->matrices[i%INPUT_COUNT]);
+            time = GetTime() - time;
+
+            value = result.m0 + result.m15;
+        } break;
+        case MICRO_VECTOR3_TRANSFORM:
+        {
+            const Matrix transform = inputs->matrices[sample%INPUT_COUNT];
+            Vector3 result = { 0 };
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++) result = Vector3Add(result, Vector3Transform(inputs->vectors[i%INPUT_COUNT], transform));
+            time = GetTime() - time;
+
+            value = result.x + result.y + result.z;
+        } break;
+        case MICRO_IMAGE_FORMAT:
+        {
+            Image image = ImageCopy(inputs->image);
+
+            time = GetTime();
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            time = GetTime() - time;
+
+            value = (float)((unsigned char *)image.data)[sample%(image.width*image.height)];
+            UnloadImage(image);
+        } break;
+        case MICRO_IMAGE_RESIZE:
+        {
+            Image image = ImageCopy(inputs->image);
+
+            time = GetTime();
+            ImageResize(&image, image.width*3/4, image.height*3/4);
+            time = GetTime() - time;
+
+            value = (float)((unsigned char *)image.data)[sample%(image.width*image.height)];
+            UnloadImage(image);
+        } break;
+        case MICRO_GET_GLYPH_INDEX:
+        {
+            int result = 0;
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++) result += GetGlyphIndex(inputs->font, inputs->codepoints[(sample + i)%inputs->codepointCount]);
+            time = GetTime() - time;
+
+            value = (float)result;
+        } break;
+        case MICRO_MEASURE_TEXT:
+        {
+            Vector2 result = { 0 };
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++) result = Vector2Add(result, MeasureTextEx(inputs->font, benchmarkText, (float)FONT_SIZE, 1.0f));
+            time = GetTime() - time;
+
+            value = result.x + result.y;
+        } break;
+        case MICRO_GET_CODEPOINT:
+        {
+            int result = 0;
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++)
+            {
+                for (const char *text = benchmarkText; *text != '\0';)
+                {
+                    int bytes = 0;
+                    result += GetCodepoint(text, &bytes);
+                    text += bytes;
+                }
+            }
+            time = GetTime() - time;
+
+            value = (float)result;
+        } break;
+        case MICRO_RAY_COLLISION_MESH:
+        {
+            RayCollision result = { 0 };
+
+            time = GetTime();
+            for (int i = 0; i < batch; i++) result = GetRayCollisionMesh(inputs->rays[(sample*batch + i)%INPUT_COUNT], inputs->model.meshes[0], inputs->modelTransform);
+            time = GetTime() - time;
+
+            value = result.hit? result.distance : 0.0f;
+        } break;
+        case MICRO_COMPRESS_DATA:
+        {
+            int dataSize = GetPixelDataSize(inputs->image.width, inputs->image.height, inputs->image.format);
+            int compSize = 0;
+
+            time = GetTime();
+            unsigned char *compData = CompressData((const unsigned char *)inputs->image.data, dataSize, &compSize);
+            time = GetTime() - time;
+
+            value = (float)compSize;
+            MemFree(compData);
+        } break;
+        default: break;
+    }
+
+    sink += value;
+
+    return time;
+}
+
+// Load fixed inputs (resources required by selected benchmarks)
+// NOTE: Font and model are loaded without window, GPU upload is skipped (RAM data only)
+static void LoadMicroInputs(MicroInputs *inputs, const char *resourcesPath, const bool *selected)
+{
+    // Generated inputs, fixed seed
+    SetRandomSeed(INPUT_SEED);
+
+    for (int i = 0; i < INPUT_COUNT; i++)
+    {
+        Vector3 axis = Vector3Normalize((Vector3){ (float)GetRandomValue(-100, 100), (float)GetRandomValue(-100, 100), (float)GetRandomValue(1, 100) });
+        Matrix rotation = MatrixRotate(axis, (float)GetRandomValue(0, 360)*DEG2RAD);
+        Matrix translation = MatrixTranslate((float)GetRandomValue(-10, 10), (float)GetRandomValue(-10, 10), (float)GetRandomValue(-10, 10));
+
+        inputs->matrices[i] = MatrixMultiply(rotation, translation);
+        inputs->vectors[i] = (Vector3){ (float)GetRandomValue(-1000, 1000)/100.0f, (float)GetRandomValue(-1000, 1000)/100.0f, (float)GetRandomValue(-1000, 1000)/100.0f };
+    }
+
+    inputs->codepointCount = 0;
+
+    for (const char *text = benchmarkText; (*text != '\0') && (inputs->codepointCount < INPUT_COUNT);)
+    {
+        int bytes = 0;
+        inputs->codepoints[inputs->codepointCount] = GetCodepoint(text, &bytes);
+        inputs->codepointCount++;
+        text += bytes;
+    }
+
+    // Resources inputs
+    if (selected[MICRO_IMAGE_FORMAT] || selected[MICRO_IMAGE_RESIZE] || selected[MICRO_COMPRESS_DATA])
+    {
+        inputs->image = LoadImage(TextFormat("%s/%s", resourcesPath, benchmarks[MICRO_IMAGE_FORMAT].resource));
+    }
+
+    if (selected[MICRO_GET_GLYPH_INDEX] || selected[MICRO_MEASURE_TEXT])
+    {
+        int codepoints[FONT_GLYPHS] = { 0 };
+        for (int i = 0; i < FONT_GLYPHS; i++) codepoints[i] = FONT_FIRST_CHAR + i;
+
+        const char *fileName = TextFormat("%s/%s", resourcesPath, benchmarks[MICRO_GET_GLYPH_INDEX].resource);
+
+        if (FileExists(fileName)) inputs->font = LoadFontEx(fileName, FONT_SIZE, codepoints, FONT_GLYPHS);
+    }
+
+    if (selected[MICRO_RAY_COLLISION_MESH])
+    {
+        const char *fileName = TextFormat("%s/%s", resourcesPath, benchmarks[MICRO_RAY_COLLISION_MESH].resource);
+
+        if (FileExists(fileName))
+        {
+            inputs->model = LoadModel(fileName);
+            inputs->modelTransform = MatrixScale(0.2f, 0.2f, 0.2f);
+
+            // Rays from a ring around the model towards its center, a quarter of them miss
+            BoundingBox bounds = GetMeshBoundingBox(inputs->model.meshes[0]);
+            bounds.min = Vector3Transform(bounds.min, inputs->modelTransform);
+            bounds.max = Vector3Transform(bounds.max, inputs->modelTransform);
+
+            Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+            float radius = Vector3Length(Vector3Subtract(bounds.max, bounds.min));
+
+            for (int i = 0; i < INPUT_COUNT; i++)
+            {
+                float angle = (float)i/INPUT_COUNT*2.0f*PI;
+                Vector3 position = { center.x + cosf(angle)*radius, center.y + (float)GetRandomValue(-50, 50)/100.0f*radius, center.z + sinf(angle)*radius };
+                Vector3 target = center;
+
+                if ((i%4) == 3) target.y += 2.0f*radius;
+
+                inputs->rays[i] = (Ray){ position, Vector3Normalize(Vector3Subtract(target, position)) };
+            }
+        }
+    }
+}
+
+// Unload inputs
+static void UnloadMicroInputs(MicroInputs *inputs)
+{
+    UnloadImage(inputs->image);
+    if (inputs->font.glyphs != NULL) UnloadFont(inputs->font);
+    if (inputs->model.meshCount > 0) UnloadModel(inputs->model);
+}
+
+// Get items processed by call (throughput)
+static double GetMicroItems(MicroInputs *inputs, int type)
+{
+    double items = 1.0;
+
+    switch (type)
+    {
+        case MICRO_IMAGE_FORMAT: items = (double)inputs->image.width*inputs->image.height; break;
+        case MICRO_IMAGE_RESIZE: items = (double)(inputs->image.width*3/4)*(inputs->image.height*3/4); break;
+        case MICRO_MEASURE_TEXT: items = (double)inputs->codepointCount; break;
+        case MICRO_GET_CODEPOINT: items = (double)inputs->codepointCount; break;
+        case MICRO_RAY_COLLISION_MESH: items = (double)inputs->model.meshes[0].triangleCount; break;
+        case MICRO_COMPRESS_DATA: items = (double)GetPixelDataSize(inputs->image.width, inputs->image.height, inputs->image.format); break;
+        default: break;
+    }
+
+    return items;
+}
+
+// Compare values for sorting (ascending)
+static int CompareValues(const void *a, const void *b)
+{
+    double diff = *(const double *)a - *(const double *)b;
+    return (diff > 0.0) - (diff < 0.0);
+}
+
+// Get values percentile (values must be sorted)
+static double GetPercentile(const double *values, int count, float percentile)
+{
+    int index = (int)ceilf(percentile*count) - 1;
+    if (index < 0) index = 0;
+
+    return values[index];
+}
+
+// Export microbenchmark results as JSON, times in nanoseconds by call
+static void ExportMicroBenchmarkResults(FILE *file, const MicroBenchmarkResult *results, int count, int warmupSamples, int samples)
+{
+    fprintf(file, "{\n    \"raylib\": \"%s\",\n    \"platform\": \"%s\",\n    \"warmupSamples\": %i,\n    \"samples\": %i,\n    \"results\": [\n",
+        RAYLIB_VERSION, BENCHMARK_PLATFORM, warmupSamples, samples);
+
+    for (int i = 0; i < count; i++)
+    {
+        const MicroBenchmarkResult *result = &results[i];
+        const char *separator = (i < (count - 1))? "," : "";
+
+        if (result->skipped)
+        {
+            fprintf(file, "        { \"function\": \"%s\", \"skipped\": true }%s\n", benchmarks[result->type].name, separator);
+            continue;
+        }
+
+        fprintf(file, "        { \"function\": \"%s\", \"batch\": %i, \"samples\": %i, \"callTime\": { \"mean\": %.1f, \"p50\": %.1f, \"p99\": %.1f, \"min\": %.1f, \"max\": %.1f }, "
+            "\"throughput\": %.1f, \"unit\": \"%s\" }%s\n",
+            benchmarks[result->type].name, benchmarks[result->type].batch, result->samples, result->mean*1e9, result->p50*1e9, result->p99*1e9,
+            result->min*1e9, result->max*1e9, result->throughput, benchmarks[result->type].unit, separator);
+    }
+
+    fprintf(file, "    ]\n}\n");
+}
@@ -61,16 +61,58 @@
 #define SUPPORT_SCREEN_CAPTURE      1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING       1
+// Screen capture and gif recording pixels read into pixel buffers (collected next frame), flipped and encoded on async load worker threads
+// NOTE: Requires SUPPORT_ASYNC_LOADING, screen is read synchronously if pixel buffers not supported (OpenGL ES 2.0, OpenGL 1.1)
+#define SUPPORT_ASYNC_SCREEN_CAPTURE    1
 // Support CompressData() and DecompressData() functions
 #define SUPPORT_COMPRESSION_API     1
+// Support allocations tracking: modules allocations tagged by subsystem, live/peak bytes and allocations per frame (GetMemoryStats())
+// NOTE: Every allocation is registered on a locked table, intended for development builds
+//#define SUPPORT_MEMORY_TRACKING       1
+// Support custom allocators by subsystem (SetAllocator()), modules allocations routed by memory tag
+// NOTE: Allocations are registered to be released with their allocator, it enables SUPPORT_MEMORY_TRACKING
+//#define SUPPORT_CUSTOM_ALLOCATORS     1
 // Support saving binary data automatically to a generated storage.data file. This file is managed internally.
 #define SUPPORT_DATA_STORAGE        1
-// Support automatic generated events, loading and recording of those events when required
+// Support input events recording and deterministic replay (fixed frame time), replay runs uncapped and exports frames stats
+// NOTE: F11 toggles recording (eventsrec.rep), F9 toggles replay (frames stats exported to eventsrec.csv),
+// testing tool, enabled by benchmark builds only (CMake SUPPORT_EVENTS_AUTOMATION=ON, make RAYLIB_EVENTS_AUTOMATION=TRUE)
 //#define SUPPORT_EVENTS_AUTOMATION     1
 // Support custom frame control, only for advance users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timming + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
 //#define SUPPORT_CUSTOM_FRAME_CONTROL   1
+// Support dynamic resolution mode: scene drawn into a render target scaled by measured GPU frame time, then upscaled
+// WARNING: It requires SUPPORT_MODULE_RTEXTURES (transient render textures) and GPU timer queries
+#define SUPPORT_DYNAMIC_RESOLUTION    1
+// Support partial redraw mode: frame drawing is recorded and compared by screen tiles with previous frame,
+// only damaged area is redrawn into a persistent render target, screen buffers are not swapped if nothing changed
+// WARNING: It requires RLGL_ENABLE_COMMAND_LISTS and SUPPORT_MODULE_RTEXTURES, enabled with EnablePartialRedraw()
+//#define SUPPORT_PARTIAL_REDRAW        1
+// Support render thread (pipelined rendering): frame drawing is recorded on main thread and submitted by a render thread
+// owning GL context, next frame is built while previous one is drawn and presented, enabled with EnableRenderThread()
+// WARNING: It requires SUPPORT_PARTIAL_REDRAW (recorded core calls) and SUPPORT_JOB_SYSTEM threads (desktop or PLATFORM_NX)
+//#define SUPPORT_RENDER_THREAD         1
+// Native libnx input (PLATFORM_NX): pads, touch screen and six-axis sensors sampled on a high-rate thread,
+// gamepad buttons edges are queued with timestamps, so presses and releases between frames are not missed
+#define SUPPORT_NX_HID_INPUT          1
+// Native libnx platform layer (PLATFORM_NX): EGL context on default nwindow, applet messages handled directly,
+// GLFW port is not used (native input is required, SUPPORT_NX_HID_INPUT is enabled)
+#define SUPPORT_NX_NATIVE_PLATFORM    1
+// Clocks profiles control (PLATFORM_NX): CPU boost mode while loading models, textures and shaders (BeginLoadingBoost()),
+// power saving performance configurations (SetClockProfile())
+#define SUPPORT_NX_CLOCK_PROFILES     1
+// System screen capture (PLATFORM_NX): screenshots saved to the console album, video recorded and hardware encoded
+// by the system (Capture button hold), GIF recording frames are not read back
+// NOTE: System video recording reserves 96 MB of transfer memory on init (applications with video capture enabled only)
+#define SUPPORT_NX_SYSTEM_CAPTURE     1
+// Support job system: one worker thread per available core, work-stealing jobs deques, parallel-for,
+// jobs dependency counters and main thread only jobs (GL work), jobs run on submit if threads not supported
+#define SUPPORT_JOB_SYSTEM            1
+// Support frames history: frame/CPU/GPU times, batch flushes and allocations of last frames (GetFrameTiming()), frame times
+// histogram (GetFrameTimeHistogram()), frames over hitch threshold export last frames profiling zones to a trace file
+// NOTE: Hitch traces require SUPPORT_PROFILING_ZONES, zones are kept on a rolling capture while threshold is set
+#define SUPPORT_FRAME_HISTORY         1
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
@@ -88,10 +130,41 @@
 #define MAX_TOUCH_POINTS               8        // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE         16        // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
+#define MAX_INPUT_EVENTS             512        // Maximum number of input events queued between frames (power of two)
 
 #define STORAGE_DATA_FILE  "storage.data"       // Automatic storage filename
+#define STORAGE_COMMIT_DELAY         1.0        // Storage changes committed once idle for this time (seconds)
 
 #define MAX_DECOMPRESSION_SIZE        64        // Max size allocated for decompression in MB
+#define COMPRESSION_STREAM_BLOCK_SIZE 65536   // Compression streams block size, memory used is bounded by it (in bytes)
+
+#define MAX_SCREEN_CAPTURE_JOBS        4        // Maximum screen capture encoding jobs in flight (async screen capture)
+
+#define DYNAMIC_RESOLUTION_MIN_SCALE    0.5f    // Default minimum dynamic resolution scale (relative to framebuffer size)
+#define DYNAMIC_RESOLUTION_MAX_SCALE    1.0f    // Default maximum dynamic resolution scale (relative to framebuffer size)
+#define DYNAMIC_RESOLUTION_GPU_BUDGET   0.85f   // Fraction of target frame time available for GPU work
+#define DYNAMIC_RESOLUTION_MAX_STEP     0.05f   // Maximum scale change per frame
+
+#define PARTIAL_REDRAW_TILE_SIZE          32    // Partial redraw damage tracking tile size (in pixels)
+
+#define MAX_SHADER_VARIANT_FEATURES        8    // Maximum features by shader variants template (2^features variants table)
+
+#define FRAME_PACING_LATENCY_MARGIN     0.002   // Low latency frame pacing margin kept before present deadline (seconds)
+#define FIXED_UPDATE_MAX_STEPS             8    // Maximum fixed update steps per frame, remaining time is dropped
+#define FRAME_HISTORY_SIZE               256    // Frames kept on frames history (timings and histogram)
+#define FRAME_HITCH_TRACE_EVENTS       65536    // Profiling zones rolling capture events buffer, while hitch threshold is set
+
+#define JOB_WORKER_THREADS             0        // Job system worker threads, 0: one per available core (main thread core excluded)
+#define MAX_JOB_WORKERS               16        // Maximum job system worker threads
+#define MAX_JOBS_QUEUED              256        // Maximum jobs queued per worker deque (power of two), jobs run on submit if full
+#define MAX_JOBS_DEFERRED            256        // Maximum jobs waiting for a dependency counter
+#define OBJECT_POOL_CACHE_SIZE        32        // Object pools thread cache size (objects), half is moved from/to shared free list at once
+
+#define NX_HID_SAMPLE_RATE           1000       // Native input sampling rate (Hz), PLATFORM_NX only
+#define MAX_NX_INPUT_EVENTS           256       // Maximum gamepad button events queued between frames (power of two)
+#define NX_BACKGROUND_FPS              10       // Frame rate while application is out of focus (PLATFORM_NX), frames are not presented
+#define NX_CLOCK_POWER_SAVING_HANDHELD  0x00020005  // Power saving performance configuration, handheld (CPU 1020, GPU 307.2, EMC 1065.6 MHz)
+#define NX_CLOCK_POWER_SAVING_DOCKED    0x00010000  // Power saving performance configuration, docked (CPU 1020, GPU 384, EMC 1600 MHz)
 
 
 //------------------------------------------------------------------------------------
@@ -104,14 +177,60 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Use interleaved vertex layout for render batch (position + texcoord + color, 24 bytes) in a single vertex buffer
+//#define RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX   1
+
+// Let render batch draw calls use up to 4 textures, selected per vertex on default shader
+// NOTE: It enables RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+//#define RLGL_ENABLE_BATCH_MULTI_TEXTURE        1
+
+// Let default shader evaluate analytic shapes per vertex, rshapes draws rounded rectangles, circles and rings as one quad
+// NOTE: It enables RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX, shapes texture is not sampled by these shapes
+//#define RLGL_ENABLE_BATCH_SDF_SHAPES           1
+
+// Build render batch triangle list indices on rlEnd(), quads, triangles, strips and fans share draw calls
+// NOTE: rshapes draws triangles, fans and polylines with their native primitive (no degenerate quads)
+//#define RLGL_ENABLE_BATCH_TRIANGLE_LIST        1
+
+// Record blend mode and scissor rect per render batch draw call, applied on batch drawing: BeginScissorMode(),
+// EndScissorMode(), BeginBlendMode() and EndBlendMode() do not flush the batch (clipped UI panels)
+#define RLGL_ENABLE_BATCH_DRAW_STATE           1
+
+// Use render batch vertex buffers as a fenced ring, persistently mapped if supported (GL_ARB_buffer_storage)
+// NOTE: Avoids CPU-GPU implicit syncs when batch is flushed multiple times per frame
+//#define RLGL_ENABLE_BATCH_BUFFER_RING          1
+
+// Grow render batch buffers (vertex and draw calls) instead of drawing the batch in the middle of the frame when full
+// NOTE: Batch is only flushed when RL_MAX_BATCH_BUFFER_ELEMENTS or RL_MAX_BATCH_DRAWCALLS are reached
+//#define RLGL_ENABLE_BATCH_GROWTH               1
+//#define RL_MAX_BATCH_BUFFER_ELEMENTS       65536    // Maximum render batch elements grown to (16384 on ES2, 16-bit indices)
+//#define RL_MAX_BATCH_DRAWCALLS              4096    // Maximum render batch draw calls grown to
+
+// Cache linked shader programs binaries on disk, keyed by shaders code and driver version (rlSetShaderCachePath())
+//#define RLGL_ENABLE_SHADER_CACHE               1
+//#define RL_DEFAULT_SHADER_CACHE_PATH          ""      // Default shader program binaries cache path prefix (i.e. "sdmc:/config/game/")
+
+// Let worker threads record immediate mode drawing and DrawMesh() into command lists, submitted on rendering thread
+//#define RLGL_ENABLE_COMMAND_LISTS              1
+
+// Defer GPU objects deletion (UnloadTexture(), UnloadMesh(), UnloadRenderTexture(), UnloadShader()) until GPU is done with them,
+// unloads can be requested from any thread and objects are deleted on EndDrawing() once a fence is signaled
+#define RLGL_ENABLE_DEFERRED_UNLOAD            1
+//#define RL_DEFERRED_UNLOAD_FRAMES              2      // Frames deferred unloads wait if GPU fences are not supported
+
+// NOTE: Default batch size can also be set at runtime, before InitWindow(): rlSetDefaultBatchSize()
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
-#define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING)
+    #define RL_DEFAULT_BATCH_BUFFERS           3      // Default number of batch buffers (ring segments, fenced)
+#else
+    #define RL_DEFAULT_BATCH_BUFFERS           1      // Default number of batch buffers (multi-buffering)
+#endif
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
-#define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_SHADER_LOCATIONS               40      // Maximum number of shader locations supported
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
@@ -136,12 +255,27 @@
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 
 
+//------------------------------------------------------------------------------------
+// Module: raymath - Configuration Flags
+//------------------------------------------------------------------------------------
+// Use SSE (x86) or NEON (ARM, AArch64) implementations of matrix, quaternion and vector transform functions
+//#define RAYMATH_SIMD                1
+
 //------------------------------------------------------------------------------------
 // Module: rshapes - Configuration Flags
 //------------------------------------------------------------------------------------
 // Use QUADS instead of TRIANGLES for drawing when possible
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE     1
+// Support collision world broadphase: rectangles, circles, boxes and spheres bodies on a uniform grid spatial hash
+// NOTE: Bodies are updated incrementally, colliding pairs and region queries only check nearby bodies
+#define SUPPORT_COLLISION_WORLD     1
+
+// rshapes: Configuration values
+//------------------------------------------------------------------------------------
+#define SHAPES_TRIG_TABLE_SIZE       256        // Unit circle sin/cos table entries (power of two), max segments per full circle
+#define SHAPES_ARC_CACHE_SIZE          4        // Tessellated arcs cached per thread, reused by fill and lines variants
+#define COLLISION_BODY_MAX_CELLS      64        // Max grid cells covered by a collision body, bigger bodies are checked against all bodies
 
 
 //------------------------------------------------------------------------------------
@@ -161,14 +295,69 @@
 //#define SUPPORT_FILEFORMAT_ASTC     1
 //#define SUPPORT_FILEFORMAT_PKM      1
 //#define SUPPORT_FILEFORMAT_PVR      1
+#define SUPPORT_FILEFORMAT_UTEX     1
 
-// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi)
+// Support image export functionality (.png, .bmp, .tga, .jpg, .qoi, .utex)
 #define SUPPORT_IMAGE_EXPORT        1
 // Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 #define SUPPORT_IMAGE_GENERATION    1
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION  1
+// Image conversion and manipulation kernels split large images in row bands processed on worker threads
+// NOTE: Threads are created per call, only used for images over IMAGE_KERNEL_BAND_PIXELS*2 pixels
+#define SUPPORT_IMAGE_THREADED_KERNELS  1
+// ImageMipmaps() averages color channels in linear space (sRGB decoded), alpha is averaged as is
+#define SUPPORT_IMAGE_MIPMAPS_SRGB  1
+// Support textures mipmaps streaming: LoadTextureStreamed() keeps only smallest mipmaps resident,
+// higher mipmaps are loaded on demand and evicted to fit a VRAM budget (requires OpenGL 3.3)
+#define SUPPORT_TEXTURE_STREAMING   1
+// Async loaded textures pixels are written by async load workers into a persistently mapped upload buffer (PBO),
+// GPU transfer is issued within a bytes budget per frame and textures are ready once transfer fence is signaled
+// NOTE: Requires SUPPORT_ASYNC_LOADING and OpenGL 3.3 persistent mapped buffers, textures loaded from client memory otherwise
+#define SUPPORT_TEXTURE_UPLOAD_QUEUE    1
+// Support runtime sprite atlas packing (skyline packing, stb_rect_pack), see LoadSpriteAtlas()
+// NOTE: Sprites drawn from the same atlas page share texture and keep batching
+#define SUPPORT_SPRITE_ATLAS        1
+// Support animated textures playback: GIF frames decoded on playback by a job into a small frames ring,
+// only current frame is uploaded to GPU, see LoadTextureAnim() (requires SUPPORT_FILEFORMAT_GIF)
+#define SUPPORT_TEXTURE_ANIM        1
+// Support video playback to textures: frames decoded ahead of playback by a job, YUV planes converted to RGB
+// by a built-in shader on drawing, audio routed to an AudioStream, see LoadVideoStream() (Y4M or custom decoder)
+#define SUPPORT_VIDEO_PLAYBACK      1
+// Support post-processing chains drawn through pooled transient render textures, see LoadPostProcess()
+// NOTE: Adjacent per-pixel color effects are fused into one generated shader (one pass)
+#define SUPPORT_POST_PROCESSING     1
+// Support image-based lighting maps generation on GPU: cubemap from panorama, irradiance, prefiltered specular and BRDF lookup
+// NOTE: Requires OpenGL 3.3, generated cubemaps can be cached with ExportTextureCubemap() (KTX)
+#define SUPPORT_IBL_GENERATION      1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define TEXTURE_STREAMING_BUDGET        64*1024*1024    // Default VRAM budget for streamed textures mipmaps (in bytes)
+#define TEXTURE_STREAMING_RESIDENT_SIZE           64    // Mipmaps up to this size (in pixels) are always resident
+#define TEXTURE_STREAMING_MAX_REQUESTS             4    // Maximum mipmap levels requested per frame
+#define MAX_STREAMED_TEXTURES                    256    // Maximum number of streamed textures
+#define MAX_RENDER_TEXTURE_POOL                   32    // Maximum number of pooled transient render textures
+#define RENDER_TEXTURE_POOL_IDLE_FRAMES            8    // Frames a pooled render texture is kept unused before unloading
+#define TEXTURE_UPLOAD_BUFFER_SIZE      16*1024*1024    // Texture upload buffer size (in bytes), split in TEXTURE_UPLOAD_SLOTS
+#define TEXTURE_UPLOAD_SLOTS                       4    // Texture upload buffer slots, bigger textures are loaded from client memory
+#define IMAGE_KERNEL_THREADS                       4    // Maximum threads processing an image kernel (including calling thread)
+#define IMAGE_KERNEL_BAND_PIXELS               65536    // Minimum pixels processed per image kernel thread
+#define LOAD_IMAGES_PARALLEL_JOBS                 16    // Maximum images decoding at once on LoadImagesParallel()
+#define SPRITE_ATLAS_PAGE_SIZE                  2048    // Default sprite atlas page maximum size (in pixels)
+#define SPRITE_ATLAS_ALIGNMENT                     4    // Sprite atlas rectangles alignment (in pixels), keeps sprites separated on first mipmaps
+#define TEXTURE_ANIM_FRAMES                        4    // Animated texture decoded frames ring size (frames decoded ahead of playback)
+#define VIDEO_STREAM_FRAMES                        4    // Video stream decoded frames ring size (frames decoded ahead of playback)
+#define VIDEO_STREAM_AUDIO_BUFFER               4096    // Video stream audio buffer size (in frames), audio is pushed to AudioStream in this size
+#define TEXTURE_TILED_SHADER_MIN_TILES            16    // Minimum tiles drawn by DrawTextureTiled() to use one quad wrapped by shader (breaks batching)
+#define SPRITE_INSTANCING_MIN_COUNT              128    // Minimum sprites count drawn as instanced quads (DrawSpriteInstances()), smaller batches use rlgl batch
+#define MAX_TEXTURE_WRAP_OVERRIDES                64    // Maximum textures tracked with non-repeat wrap mode (DrawTextureTiled() single quad)
+#define MAX_POST_EFFECTS                          16    // Maximum effects per post-processing chain
+#define LOWRES_EFFECTS_SOFT_DISTANCE            0.5f    // Depth distance (world units) particles fade over in front of scene geometry, see BeginLowResEffects()
+#define IBL_IRRADIANCE_SAMPLES                   512    // Samples per texel on irradiance cubemap generation
+#define IBL_PREFILTER_SAMPLES                    256    // Samples per texel on prefiltered specular cubemap generation
+#define IBL_BRDF_SAMPLES                         512    // Samples per texel on BRDF lookup texture generation
 
 
 //------------------------------------------------------------------------------------
@@ -177,9 +366,14 @@
 // Default font is loaded on window initialization to be available for the user to render simple text
 // NOTE: If enabled, uses external module functions to load default raylib font
 #define SUPPORT_DEFAULT_FONT        1
+// Default font is loaded on first use (GetFontDefault()) instead of window initialization, programs not drawing
+// text skip atlas decoding and upload, shapes are drawn with rlgl default texture until default font is loaded
+#define SUPPORT_LAZY_DEFAULT_FONT   1
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT      1
 #define SUPPORT_FILEFORMAT_TTF      1
+// Support cooked fonts loading and export (.rfnt), see ExportFont()
+#define SUPPORT_FILEFORMAT_RFNT     1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -201,14 +395,125 @@
 #define SUPPORT_FILEFORMAT_IQM      1
 #define SUPPORT_FILEFORMAT_GLTF     1
 #define SUPPORT_FILEFORMAT_VOX      1
-// Support procedural mesh generation functions, uses external par_shapes.h library
-// NOTE: Some generated meshes DO NOT include generated texture coordinates
+// Support cooked models loading and export (.rmdl), see ExportModel()
+#define SUPPORT_FILEFORMAT_RMDL     1
+// Support procedural mesh generation functions, parametric shapes are generated directly as indexed meshes
 #define SUPPORT_MESH_GENERATION     1
+// Generated parametric shapes weld texture coordinates seams and poles into shared vertices
+// NOTE: Texture coordinates are not continuous on welded seams, intended for untextured meshes
+//#define SUPPORT_MESH_GEN_WELDING    1
+// Support chunked voxel maps, chunks meshed with greedy faces merging and uploaded separately, see LoadVoxelMap()
+// NOTE: VOX models are also meshed by the voxel map mesher
+#define SUPPORT_VOXEL_MESHING       1
+// Support chunked 2D tilemaps, chunks layers are meshed once into static vertex buffers and rebuilt on edits, see LoadTilemap()
+#define SUPPORT_TILEMAP             1
+// Support GPU particle systems, particles are simulated by a compute shader (OpenGL 4.3) and drawn as instanced quads, see LoadParticleSystem()
+// NOTE: Particles are simulated on CPU (SIMD when available) if compute shaders are not supported
+#define SUPPORT_PARTICLES           1
+// Support clustered forward lighting, point lights are binned on CPU into view frustum clusters every frame and
+// meshes drawn with default material shader are lit by the lights of their fragments cluster, see AddPointLight()
+// NOTE: Requires OpenGL 3.3 (texelFetch), meshes are drawn unlit otherwise
+#define SUPPORT_CLUSTERED_LIGHTING  1
+// Support shadow maps for clustered lighting, directional light cascades and point lights cube faces are rendered
+// into a shadow atlas from render queue draws and cached static casters, see SetDirectionalShadows()
+#define SUPPORT_SHADOW_MAPS         1
+// Support baked lightmaps, model meshes are unwrapped into a lightmap atlas (texcoords2) and current lights are baked
+// on CPU worker threads, default material meshes with a lightmap are drawn with a single lightmap fetch, see BakeModelLightmap()
+// NOTE: Requires SUPPORT_CLUSTERED_LIGHTING (lights are set with AddPointLight(), SetDirectionalLight(), SetAmbientLight())
+#define SUPPORT_LIGHTMAPS           1
+// Support GPU skinning for animated models, bones matrices are uploaded and vertices transformed on vertex shader
+// NOTE: Only supported on OpenGL 3.3 and OpenGL ES 2.0, OpenGL 1.1 falls back to CPU skinning
+#define SUPPORT_GPU_SKINNING        1
+// Support animation textures, model animations bones matrices are baked into a float texture and skinned mesh instances
+// sample their own animation and time offset on vertex shader, see LoadAnimationTexture(), DrawMeshInstancedAnimated()
+// NOTE: Requires GPU skinning and OpenGL 3.3 (texelFetch), instances are drawn in bind pose otherwise
+#define SUPPORT_ANIMATION_TEXTURES  1
+// Support animation scheduler, registered animated models bones are updated every 2nd, 4th or 8th frame by projected size
+// with interpolated bones matrices in between, models outside camera view only update their root motion, see UpdateAnimationScheduler()
+#define SUPPORT_ANIMATION_SCHEDULER 1
+// Support instance buffers culling on GPU, visible instances are compacted by a compute shader and drawn with indirect draws, see DrawMeshInstancedBufferCulled()
+// NOTE: Requires compute shaders (OpenGL 4.3), instances are culled on CPU otherwise
+#define SUPPORT_GPU_CULLING         1
+// Support skinning cache, GPU skinned meshes are skinned by a compute shader once per frame and bones pose into a cached
+// vertex buffer, every pass drawing them (shadow maps, picking, main pass) reads skinned vertices instead of skinning again
+// NOTE: Requires GPU skinning and compute shaders (OpenGL 4.3), meshes are skinned on vertex shader on every draw otherwise
+#define SUPPORT_SKINNING_CACHE      1
+// Support render queue automatic instancing, repeated opaque draws of same mesh and material are drawn as instances, see SetRenderQueueInstancing()
+// NOTE: Only default shader draws are instanced (not lit or skinned), draws tint is sent as instance color
+#define SUPPORT_RENDER_QUEUE_INSTANCING 1
+// Support occlusion culling for large meshes, draws bounding boxes are tested with GPU occlusion queries read one frame later, see SetOcclusionCulling()
+// NOTE: Draws found occluded are drawn with conditional rendering (OpenGL 3.0) or skipped, not supported on OpenGL 1.1
+#define SUPPORT_OCCLUSION_CULLING   1
+// Support GPU picking for render queue draws, draws ids are rendered under requested position and read back one frame later, see RequestRenderQueuePick()
+// NOTE: Requires OpenGL 3.3 (integer render targets and pixel buffers), no draw is picked otherwise
+#define SUPPORT_GPU_PICKING         1
+// Support retained debug draw, debug lines and shapes are kept for a duration and drawn by DrawDebugPrimitives() in one batch
+// NOTE: Disable it for release builds, debug draw functions compile to empty functions
+#define SUPPORT_DEBUG_DRAW          1
+// Support multithreaded CPU skinning, big meshes vertices are split between worker threads (POSIX threads)
+#define SUPPORT_THREADED_SKINNING   1
+// Support model levels of detail, simplified meshes are generated on model load and selected on draw by projected size
+#define SUPPORT_MODEL_LOD           1
+// Support mesh optimization on model load: vertex welding, vertex cache/overdraw triangles order and vertex fetch order, see OptimizeMesh()
+#define SUPPORT_MESH_OPTIMIZATION   1
+// Support quantized vertex attributes for static meshes (16 bit positions and texcoords, 8 bit normals), see SetMeshQuantization()
+#define SUPPORT_MESH_QUANTIZATION   1
+// Support interleaved vertex attributes for static meshes (single vertex buffer per mesh), see SetMeshInterleaving()
+#define SUPPORT_MESH_INTERLEAVING   1
+// Support world streaming by sectors, sectors manifests are loaded and unloaded around a position with hysteresis
+// and loaded sectors out of range are evicted to keep memory budgets, see LoadWorld(), UpdateWorld()
+// NOTE: Requires SUPPORT_ASYNC_LOADING, models and textures shared by sectors are loaded once with SUPPORT_RESOURCE_CACHE
+#define SUPPORT_WORLD_STREAMING     1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS               12      // Maximum number of shader maps supported
-#define MAX_MESH_VERTEX_BUFFERS          7      // Maximum vertex buffers (VBO) per mesh
+#if defined(SUPPORT_GPU_SKINNING)
+    #define MAX_MESH_VERTEX_BUFFERS      9      // Maximum vertex buffers (VBO) per mesh (including bone ids and weights)
+#else
+    #define MAX_MESH_VERTEX_BUFFERS      7      // Maximum vertex buffers (VBO) per mesh
+#endif
+#define MAX_BONE_MATRICES               64      // Maximum number of bones matrices supported by GPU skinning shader
+#define MAX_MORPH_WEIGHTS                8      // Maximum morph targets blended by GPU morphing shader (highest weights)
+#define MAX_SKINNING_THREADS             3      // Maximum threads used by CPU skinning (including calling thread)
+#define MODEL_LOD_LEVELS                 2      // Levels of detail generated on model load (static models only)
+#define MODEL_LOD_REDUCTION           0.5f      // Triangles ratio kept on every level of detail
+#define MODEL_LOD_MIN_TRIANGLES        512      // Minimum mesh triangles to generate levels of detail
+#define MODEL_LOD_SCREEN_SIZE        0.25f      // Projected model height (fraction of screen) to switch to first level of detail
+#define ANIMATION_SCHEDULER_SCREEN_SIZE 0.2f    // Projected animated model height (fraction of screen) to update every 2nd frame (halved for 4th and 8th)
+#define MESH_QUANTIZATION_DEFAULT        0      // Default vertex attributes quantization for static meshes (MeshQuantizeFlags)
+#define MESH_INTERLEAVING_DEFAULT        0      // Default vertex attributes interleaving for static meshes (single vertex buffer), opt-in with SetMeshInterleaving()
+#define MESH_OPTIMIZE_CACHE_SIZE        32      // Vertex cache size simulated by mesh triangles reordering (OptimizeMesh())
+#define MESH_BVH_LEAF_TRIANGLES          4      // Mesh BVH triangles per leaf, bigger leaves are split by surface area heuristic
+#define VOXEL_CHUNK_SIZE                16      // Voxel map chunk size (voxels per axis), chunk meshes use 16 bit indices
+#define TERRAIN_CHUNK_SIZE              32      // Terrain chunk size (heightmap cells per axis, power of two, up to 128)
+#define TERRAIN_LOD_LEVELS               4      // Terrain chunks levels of detail (including full resolution level)
+#define MAX_POINT_LIGHTS              1024      // Maximum point lights (clustered lighting)
+#define LIGHT_CLUSTERS_X                16      // Light clusters grid horizontal tiles
+#define LIGHT_CLUSTERS_Y                 9      // Light clusters grid vertical tiles
+#define LIGHT_CLUSTERS_Z                24      // Light clusters grid depth slices (exponential)
+#define MAX_LIGHT_CLUSTER_INDICES    32768      // Maximum lights references stored by all clusters
+#define SHADOW_CASCADES                  4      // Directional light shadow cascades (1 to 4)
+#define SHADOW_CASCADE_SIZE           1024      // Shadow cascade size (pixels), shadow atlas is 4x2 cascades
+#define SHADOW_DISTANCE              100.0f     // Directional light shadows distance from camera
+#define SHADOW_POINT_SIZE              256      // Point light shadow cube face size (pixels)
+#define MAX_SHADOWED_POINT_LIGHTS        8      // Maximum point lights casting shadows
+#define LIGHTMAP_CHART_ANGLE          45.0      // Maximum angle between lightmap chart faces normals (degrees)
+#define LIGHTMAP_RANGE                 2.0      // Lightmap light range, texels store light/range to keep overbright light
+#define TILEMAP_CHUNK_SIZE              32      // Tilemap chunk size (tiles per axis, up to 128), chunk meshes use 16 bit indices
+#define TILEMAP_MAX_ANIMATIONS          16      // Tilemap animated tiles, frames offsets are uploaded to tilemap shader
+#define BILLBOARDS_INSTANCING_MIN_COUNT 64      // Minimum billboards count drawn as instanced quads (DrawBillboards()), smaller batches use rlgl batch
+#define RENDER_QUEUE_INSTANCING_MIN_COUNT 2     // Minimum repeated queued draws drawn as instances (SetRenderQueueInstancing()), smaller runs are drawn one by one
+#define OCCLUSION_MIN_TRIANGLES       1024      // Minimum mesh triangles to be occlusion tested (SetOcclusionCulling()), smaller meshes are always drawn
+#define MAX_DEBUG_LINES              65536      // Maximum debug draw lines kept (AddDebugLine()), lines over it are skipped
+#define MAX_DEBUG_SHAPES              8192      // Maximum debug draw boxes and spheres kept (each), shapes over it are skipped
+#define DEBUG_SPHERE_SEGMENTS           32      // Debug draw spheres circles segments (unit sphere computed once)
+#define PARTICLES_WORKGROUP_SIZE       256      // Particles compute shader workgroup size (particles simulated per workgroup)
+#define GPU_CULLING_WORKGROUP_SIZE     256      // Instances culling compute shader workgroup size (instances culled per workgroup)
+#define SKINNING_CACHE_WORKGROUP_SIZE   64      // Skinning cache compute shader workgroup size (vertices skinned per workgroup)
+#define SKINNING_CACHE_FRAMES            4      // Frames a skinning cache buffer is kept without being drawn
+#define WORLD_MAX_SECTOR_LOADS           4      // Maximum world sectors loading at the same time
+#define WORLD_MAX_LOAD_JOBS             16      // Maximum world async loads in flight (async load jobs are shared with other loads)
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -220,14 +525,39 @@
 #define SUPPORT_FILEFORMAT_MOD      1
 #define SUPPORT_FILEFORMAT_MP3      1
 //#define SUPPORT_FILEFORMAT_FLAC     1
+// Build MP3 music streams seek table on load, SeekMusicStream() decodes from closest seek point instead of scanning from start
+// NOTE: OGG streams are seeked by pages bisection (stb_vorbis), FLAC streams use their own seek table
+#define SUPPORT_MUSIC_SEEK_TABLE    1
+// Cache MP3 seek tables to disk, next to music file (.seek), they are loaded instead of scanning the stream on load
+//#define SUPPORT_MUSIC_SEEK_TABLE_CACHE 1
+// Account audio mixer time per audio stream and per processor, see GetAudioStreamMixTime()
+// NOTE: Mixer DSP load and voices stats are always available, profiling adds two timer reads per stream and processor run
+#define SUPPORT_AUDIO_MIXER_PROFILING 1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
-
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define AUDIO_DEVICE_PERIOD_FRAMES         0    // Device period size in frames (backend default), see SetAudioDeviceConfig()
+#define AUDIO_DEVICE_PERIODS               0    // Device periods count (backend default), see SetAudioDeviceConfig()
+#define AUDIO_LATE_CALLBACK_FACTOR      1.5f    // Device callback interval over period duration counted as late callback (mixer stats)
+#define AUDIO_MIXER_LOAD_WINDOW         0.5f    // Mixer DSP load average and peak window (in seconds)
+
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels (mixed multichannel voices)
+#define AUDIO_VOICE_MIN_VOLUME        0.001f    // Minimum volume for a multichannel voice to be mixed, quieter voices are virtual
+#define AUDIO_COMMAND_QUEUE_SIZE         256    // Mixer commands queue size, game thread to audio thread (power of two)
+#define MAX_AUDIO_BUSES                    8    // Maximum number of audio mixer buses (including master bus)
+#define AUDIO_BUS_BUFFER_FRAMES         1024    // Audio mixer buses block size, frames mixed per bus on every processing step
+#define AUDIO_SOUND_HEAD_FRAMES         4096    // Compressed sound frames decoded ahead on play (cached head)
+#define AUDIO_SOUND_HEAD_CACHE_SIZE  1048576    // Compressed sounds decoded heads cache size (in bytes)
+#define AUDIO_STREAM_RING_PERIODS          3    // Ring audio streams default size (in device periods), see LoadAudioStreamRing()
+#define WAVE_CONVERSION_CHUNK_SAMPLES   1024    // Wave format conversion intermediate float buffer size (in samples), see WaveFormat()
+#define MUSIC_STREAM_DEFAULT_LOOKAHEAD  0.5f    // Music stream thread default decoded data ahead of the stream (in seconds)
+#define MUSIC_SEEK_TABLE_POINTS          256    // Maximum seek points for MP3 music streams (24 bytes per point)
+#define MUSIC_MODULE_DEFAULT_QUALITY       1    // Music modules (XM/MOD) default resampling quality: 0=nearest, 1=linear, 2=cubic
+#define AUDIO_SPEED_OF_SOUND          343.0f    // Speed of sound for spatial voices doppler effect (world units per second)
+#define AUDIO_DOPPLER_MAX_PITCH         2.0f    // Spatial voices doppler pitch factor limit (and its inverse)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -238,7 +568,54 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG            1
 //#define SUPPORT_TRACELOG_DEBUG      1
+// Async trace-log: TraceLog() messages are formatted into a lock-free ring and printed by a background thread,
+// messages are dropped (and counted) if ring is full, custom callbacks and LOG_WARNING or higher messages are not deferred
+//#define SUPPORT_TRACELOG_ASYNC      1
+// Async assets loading: LoadTextureAsync(), LoadModelAsync(), LoadFontAsync(), LoadSoundAsync()
+// NOTE: Files are read and decoded on worker threads, GPU uploads run on EndDrawing() within a time budget
+#define SUPPORT_ASYNC_LOADING       1
+// File packs: pack archives mounted as a virtual file system, checked first by LoadFileData()
+// NOTE: Packs are memory-mapped on Linux/macOS (zero-copy views), read directly from pack file otherwise
+#define SUPPORT_FILE_PACKS          1
+// Native file io: LoadFileData() uses large unbuffered reads (libnx fs on NX, romfs without stdio buffering),
+// sequential streams (music, video) are read ahead by jobs in blocks (file streams)
+#define SUPPORT_NATIVE_FILEIO       1
+// Profiling zones on hot paths: rlDrawRenderBatch(), DrawMesh(), UpdateModelAnimation(), UpdateMusicStream(), PollInputEvents(),
+// SwapScreenBuffer()... zones are sent to custom sink (SetProfileZoneCallbacks()) or captured as Chrome trace JSON (StartProfileCapture())
+// NOTE: If not defined, zones compile out (no cost)
+//#define SUPPORT_PROFILING_ZONES     1
+// Profiling zones sent to Tracy profiler instead (Tracy client built with TRACY_ENABLE, "tracy/TracyC.h" on include path)
+//#define SUPPORT_TRACY_PROFILER      1
+// Assets hot-reload: files loaded by LoadTexture(), LoadShader(), LoadModel() and LoadFont() (TTF/OTF) are watched,
+// changed files are reloaded on async load workers and GPU objects replaced in place (same ids) on EndDrawing()
+// NOTE: Requires SUPPORT_ASYNC_LOADING, intended for development builds
+//#define SUPPORT_ASSET_HOT_RELOAD    1
+// Resource cache: LoadTexture(), LoadShader(), LoadFont(), LoadFontEx(), LoadModel() and LoadSound() return the already
+// loaded resource for same file and load parameters, resources are reference counted and unloaded with last reference
+// NOTE: Cached resources are shared (i.e. SetTextureFilter() applies to all references), async loads are not cached
+// WARNING: Loads are not independent copies: models share materials and meshes, shaders share locations and sounds
+// share one audio buffer (only one can play at a time, volume and pitch shared), opt-in for apps loading resources once
+//#define SUPPORT_RESOURCE_CACHE      1
+// Shader reflection: shaders active uniforms and attributes are reflected on load into hashed tables, GetShaderLocation()
+// does not query the driver, handle setters (SetShaderUniformFloat()...) skip uploads of unchanged values
+#define SUPPORT_SHADER_REFLECTION   1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH          128    // Max length of one trace-log message
+#define TRACELOG_ASYNC_RING_SIZE         256    // Async trace-log ring messages (power of two)
+#define TRACELOG_ASYNC_MSG_LENGTH        256    // Async trace-log formatted message max length
+#define TRACELOG_ASYNC_FLUSH_INTERVAL      4    // Async trace-log background thread flush interval (in milliseconds)
+#define MAX_ASYNC_LOAD_JOBS               64    // Maximum async load jobs not yet retrieved
+#define ASYNC_LOAD_THREADS                 2    // Async load worker threads (file read and decode)
+#define ASYNC_LOAD_FRAME_BUDGET         2.0f    // Async load upload stage time budget per frame (in milliseconds)
+#define ASYNC_LOAD_FRAME_TRANSFER    8388608    // Async load GPU transfers bytes budget per frame (pixel buffers uploads)
+#define MAX_FILE_PACKS                     8    // Maximum file packs mounted at the same time
+#define FILE_PACK_ALIGNMENT               16    // File pack entries data alignment on export (in bytes)
+#define FILE_PACK_COMPRESSION_CODEC        0    // File pack entries compression codec on export: 0-DEFLATE (smaller), 1-LZ4 (faster loading)
+#define FILE_IO_READ_CHUNK           1048576    // Native file io reads size (aligned offsets), larger reads are split
+#define FILE_STREAM_BLOCK_SIZE        262144    // File streams read-ahead block size (in bytes)
+#define FILE_STREAM_BLOCKS                 4    // File streams read-ahead blocks, blocks ahead of read position are read by jobs
+#define PROFILE_CAPTURE_DEFAULT_EVENTS  262144    // Profiling capture events buffer size, if not provided to StartProfileCapture()
+#define ASSET_HOT_RELOAD_INTERVAL       0.5f    // Assets hot-reload watched files check interval (in seconds)
+#define SCRATCH_MEMORY_SIZE          1048576    // Scratch memory arena size per thread (in bytes), larger temporaries use the heap
@@ -97,6 +97,9 @@ typedef short mint;
 typedef unsigned long mulong;
 
 #define NUMMAXCHANNELS 32
+#define JAR_MOD_INTERPOLATION_NEAREST 0
+#define JAR_MOD_INTERPOLATION_LINEAR 1
+#define JAR_MOD_INTERPOLATION_CUBIC 2
 #define MAXNOTES 12*12
 #define DEFAULT_SAMPLE_RATE 48000
 //
@@ -191,6 +194,7 @@ typedef struct {
     mint    stereo_separation;
     mint    bits;
     mint    filter;
+    mint    interpolation; // JAR_MOD_INTERPOLATION_NEAREST (default), _LINEAR or _CUBIC
     
     muchar *modfile; // the raw mod file
     mulong  modfilesize;
@@ -244,6 +248,7 @@ extern "C" {
 
 bool   jar_mod_init(jar_mod_context_t * modctx);
 bool   jar_mod_setcfg(jar_mod_context_t * modctx, int samplerate, int bits, int stereo, int stereo_separation, int filter);
+void   jar_mod_setinterpolation(jar_mod_context_t * modctx, int interpolation);
 void   jar_mod_fillbuffer(jar_mod_context_t * modctx, short * outbuffer, unsigned long nbsample, jar_mod_tracker_buffer_state * trkbuf);
 void   jar_mod_unload(jar_mod_context_t * modctx);
 mulong jar_mod_load_file(jar_mod_context_t * modctx, const char* filename);
@@ -401,6 +406,48 @@ static int memcompare( unsigned char * buf1, unsigned char * buf2, unsigned int
     return 1;
 }
 
+// Sample point at index i (could be outside of sample) following the sample loop
+static int getsamplepoint( channel * cptr, long i )
+{
+    if( cptr->replen > 2 )
+    {
+        if( i >= (long)cptr->reppnt + cptr->replen )
+            i = cptr->reppnt + ( (i - cptr->reppnt) % cptr->replen );
+    }
+    else if( i >= (long)cptr->length )
+    {
+        return 0;
+    }
+
+    if( i < 0 ) i = 0;
+
+    return cptr->sampdata[i];
+}
+
+// Resample channel at its current position with the selected interpolation
+static int getchannelsample( jar_mod_context_t * mod, channel * cptr, unsigned long k )
+{
+    int s0, s1, sp, s2;
+    float t;
+    long frac = cptr->samppos & 1023;
+
+    if( mod->interpolation == JAR_MOD_INTERPOLATION_NEAREST || !frac )
+        return cptr->sampdata[k];
+
+    s0 = cptr->sampdata[k];
+    s1 = getsamplepoint( cptr, (long)k + 1 );
+
+    if( mod->interpolation == JAR_MOD_INTERPOLATION_LINEAR )
+        return s0 + ( ( (s1 - s0) * frac ) >> 10 );
+
+    // Catmull-Rom spline between s0 and s1
+    sp = getsamplepoint( cptr, (long)k - 1 );
+    s2 = getsamplepoint( cptr, (long)k + 2 );
+    t = (float)frac / 1024.0f;
+
+    return s0 + (int)( 0.5f * t * ( (s1 - sp) + t * ( (2*sp - 5*s0 + 4*s1 - s2) + t * ( 3*(s0 - s1) + s2 - sp ) ) ) );
+}
+
 static int getnote( jar_mod_context_t * mod, unsigned short period, int finetune )
 {
     int i;
@@ -1054,6 +1101,17 @@ static void workeffect( note * nptr, channel * cptr )
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
+void jar_mod_setinterpolation(jar_mod_context_t * modctx, int interpolation)
+{
+    if( modctx )
+    {
+        if( interpolation < JAR_MOD_INTERPOLATION_NEAREST ) interpolation = JAR_MOD_INTERPOLATION_NEAREST;
+        if( interpolation > JAR_MOD_INTERPOLATION_CUBIC ) interpolation = JAR_MOD_INTERPOLATION_CUBIC;
+
+        modctx->interpolation = (mint)interpolation;
+    }
+}
+
 bool jar_mod_init(jar_mod_context_t * modctx)
 {
     muint i,j;
@@ -1372,14 +1430,13 @@ void jar_mod_fillbuffer( jar_mod_context_t * modctx, short * outbuffer, unsigned
 
                         k = cptr->samppos >> 10;
 
-                        if( cptr->sampdata!=0 && ( ((j&3)==1) || ((j&3)==2) ) )
+                        // Silent channels only need to advance, skip resampling
+                        if( cptr->sampdata!=0 && cptr->volume )
                         {
-                            r += ( cptr->sampdata[k] *  cptr->volume );
-                        }
-
-                        if( cptr->sampdata!=0 && ( ((j&3)==0) || ((j&3)==3) ) )
-                        {
-                            l += ( cptr->sampdata[k] *  cptr->volume );
+                            if( ((j&3)==1) || ((j&3)==2) )
+                                r += ( getchannelsample(modctx, cptr, k) *  cptr->volume );
+                            else
+                                l += ( getchannelsample(modctx, cptr, k) *  cptr->volume );
                         }
 
                         if( trkbuf && !state_remaining_steps )
@@ -152,6 +152,15 @@ void jar_xm_set_max_loop_count(jar_xm_context_t* ctx, uint8_t loopcnt);
 //** Get the loop count of the currently playing module. This value is 0 when the module is still playing, 1 when the module has looped once, etc.
 uint8_t jar_xm_get_loop_count(jar_xm_context_t* ctx);
 
+#define jar_xm_INTERPOLATION_NEAREST 0
+#define jar_xm_INTERPOLATION_LINEAR 1
+#define jar_xm_INTERPOLATION_CUBIC 2
+
+//** Set the samples interpolation quality (linear by default).
+// * @param interpolation jar_xm_INTERPOLATION_NEAREST, jar_xm_INTERPOLATION_LINEAR or jar_xm_INTERPOLATION_CUBIC.
+// * @note Silent channels (muted or zero volume) are always resampled with nearest interpolation.
+void jar_xm_set_interpolation(jar_xm_context_t* ctx, uint16_t interpolation);
+
 //** Mute or unmute a channel.
 // * @note Channel numbers go from 1 to jar_xm_get_number_of_channels(...).
 // * @return whether the channel was muted.
@@ -362,7 +371,7 @@ struct jar_xm_sample_s {
      uint16_t num_channels;
      uint16_t num_patterns;
      uint16_t num_instruments;
-     uint16_t linear_interpolation;
+     uint16_t linear_interpolation; /* jar_xm_INTERPOLATION_NEAREST, _LINEAR or _CUBIC */
      uint16_t ramping;
      jar_xm_frequency_type_t frequency_type;
      uint8_t pattern_table[PATTERN_ORDER_TABLE_LENGTH];
@@ -602,6 +611,10 @@ uint8_t jar_xm_get_loop_count(jar_xm_context_t *ctx) {
     return ctx->loop_count;
 }
 
+void jar_xm_set_interpolation(jar_xm_context_t *ctx, uint16_t interpolation) {
+    ctx->module.linear_interpolation = (interpolation > jar_xm_INTERPOLATION_CUBIC) ? jar_xm_INTERPOLATION_CUBIC : interpolation;
+}
+
 bool jar_xm_mute_channel(jar_xm_context_t *ctx, uint16_t channel, bool mute) {
     bool old = ctx->channels[channel - 1].muted;
     ctx->channels[channel - 1].muted = mute;
@@ -1121,6 +1134,8 @@ static const float multi_retrig_multiply[] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, .66
     } while(0)
 
 #define jar_xm_LERP(u, v, t) ((u) + (t) * ((v) - (u)))
+/* Catmull-Rom spline between p1 and p2 */
+#define jar_xm_CUBIC(p0, p1, p2, p3, t) ((p1) + 0.5f * (t) * ((p2) - (p0) + (t) * (2.f * (p0) - 5.f * (p1) + 4.f * (p2) - (p3) + (t) * (3.f * ((p1) - (p2)) + (p3) - (p0)))))
 #define jar_xm_INVERSE_LERP(u, v, lerp) (((lerp) - (u)) / ((v) - (u)))
 
 #define HAS_TONE_PORTAMENTO(s) ((s)->effect_type == 3 \
@@ -1959,6 +1974,25 @@ static void jar_xm_tick(jar_xm_context_t* ctx) {
     ctx->remaining_samples_in_tick += (float)ctx->rate / ((float)ctx->bpm * 0.4f);
 };
 
+/* Sample point at index i (could be outside of sample) following the sample loop, offset selects right channel data */
+static float jar_xm_sample_point(jar_xm_sample_t* s, int64_t i, uint32_t offset) {
+    switch(s->loop_type) {
+    case jar_xm_FORWARD_LOOP:
+        if(i >= s->loop_end && s->loop_length > 0) { i = s->loop_start + (i - s->loop_end) % s->loop_length; };
+        break;
+    case jar_xm_PING_PONG_LOOP:
+        if(i >= s->loop_end) { i = ((int64_t)s->loop_end << 1) - 1 - i; };
+        if(i < s->loop_start) { i = s->loop_start; };
+        break;
+    default:
+        if(i >= s->length) { return .0f; };
+        break;
+    };
+    if(i < 0) { i = 0; };
+    if(i >= s->length) { i = s->length - 1; };
+    return s->data[i + offset];
+}
+
 static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_t* ch, int previous) {
     jar_xm_module_t* mod = &(ctx->module);
 
@@ -1984,13 +2018,32 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
         return;
     };
 
+    /* Silent channels only need to advance, skip interpolation */
+    uint16_t interpolation = mod->linear_interpolation;
+    if(ch->muted || ch->instrument->muted || (ch->actual_volume == 0.f && ch->target_volume == 0.f)) {
+        interpolation = jar_xm_INTERPOLATION_NEAREST;
+    };
+    bool linear = (interpolation == jar_xm_INTERPOLATION_LINEAR);
+
     float t = 0.f;
     uint32_t b = 0;
-    if(mod->linear_interpolation) {
+    if(interpolation != jar_xm_INTERPOLATION_NEAREST) {
         b = ch->sample_position + 1;
         t = ch->sample_position - (uint32_t)ch->sample_position; /* Cheaper than fmodf(., 1.f) */
     };
 
+    float c_left = .0f, c_right = .0f;
+    if(interpolation == jar_xm_INTERPOLATION_CUBIC) {
+        int64_t i = (int64_t)ch->sample_position;
+        jar_xm_sample_t* s = ch->sample;
+        c_left = jar_xm_CUBIC(jar_xm_sample_point(s, i - 1, 0), jar_xm_sample_point(s, i, 0), jar_xm_sample_point(s, i + 1, 0), jar_xm_sample_point(s, i + 2, 0), t);
+        if (s->stereo) {
+            c_right = jar_xm_CUBIC(jar_xm_sample_point(s, i - 1, s->length), jar_xm_sample_point(s, i, s->length), jar_xm_sample_point(s, i + 1, s->length), jar_xm_sample_point(s, i + 2, s->length), t);
+        } else {
+            c_right = c_left;
+        };
+    };
+
     float u_left, u_right;
     u_left = ch->sample->data[(uint32_t)ch->sample_position];
     if (ch->sample->stereo) {
@@ -2001,7 +2054,7 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
     float v_left = 0.f, v_right = 0.f;
     switch(ch->sample->loop_type) {
     case jar_xm_NO_LOOP:
-        if(mod->linear_interpolation) {
+        if(linear) {
             v_left = (b < ch->sample->length) ? ch->sample->data[b] : .0f;
             if (ch->sample->stereo) {
                 v_right = (b < ch->sample->length) ? ch->sample->data[b + ch->sample->length] : .0f;
@@ -2013,7 +2066,7 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
         if(ch->sample_position >= ch->sample->length) { ch->sample_position = -1; } // stop playing this sample
         break;
     case jar_xm_FORWARD_LOOP:
-        if(mod->linear_interpolation) {
+        if(linear) {
             v_left = ch->sample->data[ (b == ch->sample->loop_end) ? ch->sample->loop_start : b ];
             if (ch->sample->stereo) {
                 v_right = ch->sample->data[ (b == ch->sample->loop_end) ? ch->sample->loop_start + ch->sample->length : b + ch->sample->length];
@@ -2031,7 +2084,7 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
         break;
     case jar_xm_PING_PONG_LOOP:
         if(ch->ping) {
-            if(mod->linear_interpolation) {
+            if(linear) {
                 v_left = (b >= ch->sample->loop_end) ? ch->sample->data[(uint32_t)ch->sample_position] : ch->sample->data[b];
                 if (ch->sample->stereo) {
                     v_right = (b >= ch->sample->loop_end) ? ch->sample->data[(uint32_t)ch->sample_position + ch->sample->length] : ch->sample->data[b + ch->sample->length];
@@ -2049,7 +2102,7 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
                 ch->sample_position -= ch->sample->length - 1;
             };
         } else {
-            if(mod->linear_interpolation) {
+            if(linear) {
                 v_left = u_left;
                 v_right = u_right;
                 u_left = (b == 1 || b - 2 <= ch->sample->loop_start) ? ch->sample->data[(uint32_t)ch->sample_position] : ch->sample->data[b - 2];
@@ -2077,8 +2130,12 @@ static void jar_xm_next_of_sample(jar_xm_context_t* ctx, jar_xm_channel_context_
         break;
     };
 
-    float endval_left = mod->linear_interpolation ? jar_xm_LERP(u_left, v_left, t) : u_left;
-    float endval_right = mod->linear_interpolation ? jar_xm_LERP(u_right, v_right, t) : u_right;
+    float endval_left = linear ? jar_xm_LERP(u_left, v_left, t) : u_left;
+    float endval_right = linear ? jar_xm_LERP(u_right, v_right, t) : u_right;
+    if(interpolation == jar_xm_INTERPOLATION_CUBIC) {
+        endval_left = c_left;
+        endval_right = c_right;
+    };
 
     if (mod->ramping) {
         if(ch->frame_count < jar_xm_SAMPLE_RAMPING_POINTS) {
@@ -411,6 +411,8 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if (len > (e-in) || !len)
         return (int)(out-o);
+      if (len > (oe-out))
+        return -1; /* @raylib: output capacity exceeded */
       memcpy(out, in, (size_t)len);
       in += len, out += len;
       state = hdr;
@@ -461,6 +463,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       int sym = sinfl_decode(&s, s.lits, 10);
       if (sym < 256) {
         /* literal */
+        if (sinfl_unlikely(out >= oe)) return -1;
         *out++ = (unsigned char)sym;
       } else if (sym > 256) {sym -= 257; /* match symbol */
         sinfl_refill(&s);
@@ -471,6 +474,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         if (sinfl_unlikely(offs > (int)(out-o))) {
           return (int)(out-o);
         }
+        if (sinfl_unlikely(len > (int)(oe-out))) {
+          return -1; /* @raylib: output capacity exceeded */
+        }
         out = out + len;
 
 #ifndef SINFL_NO_SIMD
@@ -573,6 +579,7 @@ zsinflate(void *out, int cap, const void *mem, int size) {
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
     int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
+    if (n < 0) return -1;
     unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
@@ -44,6 +44,7 @@ revision history:
     1.02  (2021-09-10)  @raysan5: Reviewed some formating
     1.03  (2021-10-02)  @catmanl: Reduce warnings on gcc
     1.04  (2021-10-17)  @warzes: Fixing the error of loading VOX models
+    1.05  (2026-10-15)  Define VOX_LOADER_NO_MESH to skip per-voxel mesh arrays build (voxels only)
 
 */
 
@@ -162,6 +163,7 @@ void Vox_FreeArrays(VoxArray3D* voxarray);
 // ArrayUShort helper
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(VOX_LOADER_NO_MESH)
 static void initArrayUShort(ArrayUShort* a, int initialSize)
 {
 	a->array = VOX_MALLOC(initialSize * sizeof(unsigned short));
@@ -178,6 +180,7 @@ static void insertArrayUShort(ArrayUShort* a, unsigned short element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayUShort(ArrayUShort* a)
 {
@@ -191,6 +194,7 @@ static void freeArrayUShort(ArrayUShort* a)
 // ArrayVector3 helper
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(VOX_LOADER_NO_MESH)
 static void initArrayVector3(ArrayVector3* a, int initialSize)
 {
 	a->array = VOX_MALLOC(initialSize * sizeof(VoxVector3));
@@ -207,6 +211,7 @@ static void insertArrayVector3(ArrayVector3* a, VoxVector3 element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayVector3(ArrayVector3* a)
 {
@@ -219,6 +224,7 @@ static void freeArrayVector3(ArrayVector3* a)
 // ArrayColor helper
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(VOX_LOADER_NO_MESH)
 static void initArrayColor(ArrayColor* a, int initialSize)
 {
 	a->array = VOX_MALLOC(initialSize * sizeof(VoxColor));
@@ -235,6 +241,7 @@ static void insertArrayColor(ArrayColor* a, VoxColor element)
 	}
 	a->array[a->used++] = element;
 }
+#endif
 
 static void freeArrayColor(ArrayColor* a)
 {
@@ -412,6 +419,7 @@ static unsigned char Vox_GetVoxel(VoxArray3D* pvoxarray, int x, int y, int z)
 
 }
 
+#if !defined(VOX_LOADER_NO_MESH)
 // Calc visibles faces from a voxel position
 static unsigned char Vox_CalcFacesVisible(VoxArray3D* pvoxArray, int cx, int cy, int cz)
 {
@@ -526,6 +534,7 @@ static void Vox_Build_Voxel(VoxArray3D* pvoxArray, int x, int y, int z, int matI
 		insertArrayUShort(&pvoxArray->indices, idx + 2);
 	}
 }
+#endif
 
 // MagicaVoxel *.vox file format Loader
 int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArray3D* pvoxarray)
@@ -652,6 +661,7 @@ int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArr
 		}
 	}
 
+#if !defined(VOX_LOADER_NO_MESH)
 	//////////////////////////////////////////////////////////
 	// Building Mesh
 	//   TODO compute globals indices array
@@ -676,6 +686,7 @@ int Vox_LoadFromMemory(unsigned char* pvoxData, unsigned int voxDataSize, VoxArr
 			}
 		}
 	}
+#endif
 
 	return VOX_SUCCESS;
 }
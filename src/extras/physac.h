@@ -20,6 +20,10 @@
 *       Show debug traces log messages about physic bodies creation/destruction, physic system errors,
 *       some calculations results and NULL reference exceptions.
 *
+*   #define PHYSAC_JOB_SYSTEM
+*       Solves independent physics islands in parallel using raylib job system (ParallelFor()),
+*       physac must be linked with raylib, islands are solved on the calling thread while no worker threads available.
+*
 *   #define PHYSAC_AVOID_TIMMING_SYSTEM
 *       Disables internal timming system, used by UpdatePhysics() to launch timmed physic steps,
 *       it allows just running UpdatePhysics() automatically on a separate thread at a desired time step.
@@ -29,6 +33,7 @@
 *
 *   #define PHYSAC_MALLOC()
 *   #define PHYSAC_CALLOC()
+*   #define PHYSAC_REALLOC()
 *   #define PHYSAC_FREE()
 *       You can define your own malloc/free implementation replacing stdlib.h malloc()/free() functions.
 *       Otherwise it will include stdlib.h and use the C standard library malloc()/free() function.
@@ -39,6 +44,14 @@
 *       gcc -o $(NAME_PART).exe $(FILE_NAME) -s -static -lraylib -lopengl32 -lgdi32 -lwinmm -std=c99
 *
 *   VERSIONS HISTORY:
+*       1.2 (15-Oct-2026) Bodies and manifolds storage grows as required (no bodies limit)
+*               Dynamic AABB tree broadphase with fat AABBs, only overlapping pairs are solved
+*               Manifolds stored by value, only pairs in contact keep a manifold
+*               Contact islands solved independently (in parallel with PHYSAC_JOB_SYSTEM), resting islands fall asleep
+*               Accumulated contact impulses, warm started from previous step manifolds
+*               Bodies allocated from storage chunks (handles never moved), dynamics solved on SoA arrays
+*               Bodies integration and polygon shapes bounds vectorized (SSE/NEON)
+*               Raycast, point, AABB and circle queries walking the broadphase tree, bodies collision layers and masks
 *       1.1 (20-Jan-2021) @raysan5: Library general revision 
 *               Removed threading system (up to the user)
 *               Support MSVC C++ compilation using CLITERAL()
@@ -93,6 +106,9 @@
 #ifndef PHYSAC_CALLOC
     #define PHYSAC_CALLOC(size, n)      calloc(size, n)
 #endif
+#ifndef PHYSAC_REALLOC
+    #define PHYSAC_REALLOC(ptr, size)   realloc(ptr, size)
+#endif
 #ifndef PHYSAC_FREE
     #define PHYSAC_FREE(ptr)            free(ptr)
 #endif
@@ -100,12 +116,21 @@
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define PHYSAC_MAX_BODIES               64          // Maximum number of physic bodies supported
-#define PHYSAC_MAX_MANIFOLDS            4096        // Maximum number of physic bodies interactions (64x64)
+#define PHYSAC_INITIAL_BODIES           64          // Initial physic bodies storage capacity (grows as required)
+#define PHYSAC_INITIAL_MANIFOLDS        256         // Initial physic bodies interactions storage capacity (grows as required)
+#define PHYSAC_BODIES_CHUNK_SIZE        64          // Physic bodies allocated per storage chunk (chunks are never moved)
+#define PHYSAC_AABB_MARGIN              4.0f        // Broadphase fat AABB margin, bodies moving inside it are not reinserted in the tree
+#define PHYSAC_TREE_STACK_SIZE          256         // Broadphase tree query stack size
+#define PHYSAC_LAYER_DEFAULT            0x00000001  // Default physics body collision layer
+#define PHYSAC_LAYER_ALL                0xffffffff  // All collision layers mask (default physics body mask)
 #define PHYSAC_MAX_VERTICES             24          // Maximum number of vertex for polygons shapes
 #define PHYSAC_DEFAULT_CIRCLE_VERTICES  24          // Default number of vertices for circle shapes
 
-#define PHYSAC_COLLISION_ITERATIONS     100
+#define PHYSAC_COLLISION_ITERATIONS     20          // Contact impulses solver iterations (impulses are warm started)
+#define PHYSAC_CONTACT_MATCH_DISTANCE   2.0f        // Maximum distance to previous step contact point to reuse its impulses (warm starting)
+#define PHYSAC_SLEEP_TIME               500.0f      // Time an island must be resting to fall asleep (milliseconds)
+#define PHYSAC_SLEEP_LINEAR_VELOCITY    0.01f       // Linear velocity below a body is resting (units per millisecond)
+#define PHYSAC_SLEEP_ANGULAR_VELOCITY   0.0002f     // Angular velocity below a body is resting (radians per millisecond)
 #define PHYSAC_PENETRATION_ALLOWANCE    0.05f
 #define PHYSAC_PENETRATION_CORRECTION   0.4f
 
@@ -173,7 +198,13 @@ typedef struct PhysicsBodyData {
     bool useGravity;                            // Apply gravity force to dynamics
     bool isGrounded;                            // Physics grounded on other body state
     bool freezeOrient;                          // Physics rotation constraint
+    bool isSleeping;                            // Physics body sleeping state (resting island, dynamics not solved)
+    float sleepTime;                            // Time resting below sleep velocities (milliseconds)
     PhysicsShape shape;                         // Physics body shape information (type, radius, vertices, transform)
+    int treeNode;                               // Broadphase tree leaf node index (-1 if not inserted yet)
+    unsigned int layer;                         // Collision layers bits the body belongs to
+    unsigned int mask;                          // Collision layers bits the body collides with
+    int index;                                  // Physics step solver bodies index (bodies ordered by island)
 } PhysicsBodyData;
 
 typedef struct PhysicsManifoldData {
@@ -187,8 +218,18 @@ typedef struct PhysicsManifoldData {
     float restitution;                          // Mixed restitution during collision
     float dynamicFriction;                      // Mixed dynamic friction during collision
     float staticFriction;                       // Mixed static friction during collision
+    float normalImpulse[2];                     // Accumulated normal impulse per contact (warm starting)
+    float tangentImpulse[2];                    // Accumulated friction impulse per contact (warm starting)
+    float velocityBias[2];                      // Restitution target velocity per contact
 } PhysicsManifoldData, *PhysicsManifold;
 
+typedef struct PhysicsRaycastHit {
+    PhysicsBody body;                           // Physics body hit
+    Vector2 point;                              // Hit point (world space)
+    Vector2 normal;                             // Hit shape surface normal
+    float distance;                             // Distance from ray origin to hit point
+} PhysicsRaycastHit;
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -215,6 +256,8 @@ PHYSACDEF void PhysicsAddForce(PhysicsBody body, Vector2 force);
 PHYSACDEF void PhysicsAddTorque(PhysicsBody body, float amount);                                            // Adds an angular force to a physics body
 PHYSACDEF void PhysicsShatter(PhysicsBody body, Vector2 position, float force);                             // Shatters a polygon shape physics body to little physics bodies with explosion force
 PHYSACDEF void SetPhysicsBodyRotation(PhysicsBody body, float radians);                                     // Sets physics body shape transform based on radians parameter
+PHYSACDEF void SetPhysicsBodyAwake(PhysicsBody body, bool awake);                                           // Sets physics body sleeping state, its island is woken up on next step
+PHYSACDEF void SetPhysicsBodyLayer(PhysicsBody body, unsigned int layer, unsigned int mask);                 // Sets physics body collision layers and mask, bodies collide when both layers are in the other mask
 
 // Query physics info
 PHYSACDEF PhysicsBody GetPhysicsBody(int index);                                                            // Returns a physics body of the bodies pool at a specific index
@@ -222,6 +265,12 @@ PHYSACDEF int GetPhysicsBodiesCount(void);
 PHYSACDEF int GetPhysicsShapeType(int index);                                                               // Returns the physics body shape type (PHYSICS_CIRCLE or PHYSICS_POLYGON)
 PHYSACDEF int GetPhysicsShapeVerticesCount(int index);                                                      // Returns the amount of vertices of a physics body shape
 PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex);                                      // Returns transformed position of a body shape (body position + vertex transformed position)
+
+// Spatial queries (broadphase tree, only bodies with a layer in mask are tested)
+PHYSACDEF int PhysicsRaycast(Vector2 origin, Vector2 direction, float maxDistance, unsigned int mask, PhysicsRaycastHit *hits, int maxHits);  // Casts a ray, returns closest hits count (sorted by distance)
+PHYSACDEF int PhysicsQueryPoint(Vector2 point, unsigned int mask, PhysicsBody *results, int maxResults);     // Returns bodies containing a point, returns bodies count
+PHYSACDEF int PhysicsQueryAABB(Vector2 min, Vector2 max, unsigned int mask, PhysicsBody *results, int maxResults);  // Returns bodies overlapping an axis aligned box, returns bodies count
+PHYSACDEF int PhysicsQueryCircle(Vector2 center, float radius, unsigned int mask, PhysicsBody *results, int maxResults);  // Returns bodies overlapping a circle, returns bodies count
 #if defined(__cplusplus)
 }
 #endif
@@ -244,9 +293,29 @@ PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex);
     #define TRACELOG(...) (void)0;
 #endif
 
-#include <stdlib.h>                 // Required for: malloc(), calloc(), free()
+#include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>                 // Required for: memset()
 #include <math.h>                   // Required for: cosf(), sinf(), fabs(), sqrtf()
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>           // Required for: NEON intrinsics [Used in IntegratePhysicsForces(), GetPhysicsBodyAABB()]
+    #define PHYSAC_SIMD_NEON
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in IntegratePhysicsForces(), GetPhysicsBodyAABB()]
+    #define PHYSAC_SIMD_SSE
+#endif
+
+#if defined(PHYSAC_JOB_SYSTEM) && !defined(RAYLIB_H)
+    // Job system function required from raylib
+    #if defined(__cplusplus)
+    extern "C" {            // Prevents name mangling of functions
+    #endif
+    void ParallelFor(void (*callback)(void *data, int start, int end), void *data, int count, int grainSize);
+    #if defined(__cplusplus)
+    }
+    #endif
+#endif
+
 #if !defined(PHYSAC_AVOID_TIMMING_SYSTEM)
     // Time management functionality
     #include <time.h>               // Required for: time(), clock_gettime()
@@ -290,6 +359,59 @@ PHYSACDEF Vector2 GetPhysicsShapeVertex(PhysicsBody body, int vertex);
 #define PHYSAC_EPSILON          0.000001f
 #define PHYSAC_K                1.0f/3.0f
 #define PHYSAC_VECTOR_ZERO      CLITERAL(Vector2){ 0.0f, 0.0f }
+#define PHYSAC_SOLVER_ARRAYS    12          // Solver bodies arrays count (PhysicsSolverBodies floats arrays)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition (internal)
+//----------------------------------------------------------------------------------
+// Axis aligned bounding box (used by broadphase)
+typedef struct PhysicsAABB {
+    Vector2 min;                                // Minimum corner
+    Vector2 max;                                // Maximum corner
+} PhysicsAABB;
+
+// Broadphase dynamic AABB tree node, leaves hold a physics body fat AABB
+typedef struct PhysicsTreeNode {
+    PhysicsAABB aabb;                           // Node bounds (leaves: body fat AABB, internal nodes: children union)
+    PhysicsBody body;                           // Leaf physics body (NULL for internal nodes)
+    int parent;                                 // Parent node index (next free node index for free nodes)
+    int child1;                                 // First child node index (-1 for leaves)
+    int child2;                                 // Second child node index (-1 for leaves)
+    int height;                                 // Node height (leaves 0, free nodes -1)
+} PhysicsTreeNode;
+
+// Physics bodies storage chunk, physics bodies handles point into chunks
+typedef struct PhysicsBodiesChunk {
+    struct PhysicsBodiesChunk *next;            // Next allocated chunk
+    PhysicsBodyData bodies[PHYSAC_BODIES_CHUNK_SIZE];   // Chunk bodies, free bodies are linked by shape body
+} PhysicsBodiesChunk;
+
+// Physics solver bodies state (SoA), loaded from bodies every step, ordered by island
+// NOTE: Disabled bodies are loaded with 0 velocities, inverse mass and inverse inertia (solved as infinite mass)
+typedef struct PhysicsSolverBodies {
+    float *positionX;                           // Position X
+    float *positionY;                           // Position Y
+    float *velocityX;                           // Linear velocity X
+    float *velocityY;                           // Linear velocity Y
+    float *angularVelocity;                     // Angular velocity (0 for frozen orientation)
+    float *orient;                              // Rotation in radians
+    float *forceX;                              // Linear force X
+    float *forceY;                              // Linear force Y
+    float *torque;                              // Angular force
+    float *inverseMass;                         // Solved inverse mass
+    float *inverseInertia;                      // Solved inverse inertia (0 for frozen orientation)
+    float *gravityScale;                        // Gravity applied (1) or not (0)
+    unsigned int capacity;                      // Arrays capacity (bodies), all arrays share one allocation
+} PhysicsSolverBodies;
+
+// Physics island, bodies connected by contacts, solved independently
+typedef struct PhysicsIsland {
+    unsigned int bodiesStart;                   // First body in islands bodies indices
+    unsigned int bodiesCount;                   // Island bodies count
+    unsigned int manifoldsStart;                // First manifold in islands manifolds indices
+    unsigned int manifoldsCount;                // Island manifolds count
+    bool sleeping;                              // Island sleeping state (all bodies sleeping or disabled)
+} PhysicsIsland;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -305,10 +427,36 @@ static double currentTime = 0.0;                            // Current time in m
 #endif
 
 // Physics system configuration
-static PhysicsBody bodies[PHYSAC_MAX_BODIES];               // Physics bodies pointers array
+static PhysicsBody *bodies = NULL;                          // Physics bodies pointers array
+static PhysicsBodiesChunk *bodiesChunks = NULL;             // Physics bodies storage chunks list
+static PhysicsBody freeBodies = NULL;                       // Physics bodies free list (linked by shape body)
 static unsigned int physicsBodiesCount = 0;                 // Physics world current bodies counter
-static PhysicsManifold contacts[PHYSAC_MAX_MANIFOLDS];      // Physics bodies pointers array
+static unsigned int physicsBodiesCapacity = 0;              // Physics bodies pointers array capacity
+static unsigned int physicsBodiesNextId = 0;                // Physics bodies next unique identifier
+static PhysicsManifoldData *contacts = NULL;                // Physics manifolds array (bodies pairs in contact)
 static unsigned int physicsManifoldsCount = 0;              // Physics world current manifolds counter
+static unsigned int physicsManifoldsCapacity = 0;           // Physics manifolds array capacity
+static PhysicsManifoldData *previousContacts = NULL;        // Physics previous step manifolds array (warm starting)
+static unsigned int previousManifoldsCount = 0;             // Physics previous step manifolds counter
+static unsigned int previousManifoldsCapacity = 0;          // Physics previous step manifolds array capacity
+static int *previousContactsTable = NULL;                   // Physics previous step manifolds hash table by bodies pair (-1: empty)
+static unsigned int previousContactsTableSize = 0;          // Physics previous step manifolds hash table size (power of 2)
+
+// Physics islands
+static PhysicsIsland *islands = NULL;                       // Physics step islands array
+static unsigned int islandsCount = 0;                       // Physics step islands counter
+static unsigned int islandsCapacity = 0;                    // Physics step islands array capacity
+static int *islandIndices = NULL;                           // Islands indices: bodies union-find parents, bodies and manifolds indices by island
+static unsigned int islandIndicesCapacity = 0;              // Islands indices array capacity
+static PhysicsSolverBodies solverBodies = { 0 };            // Solver bodies state arrays (SoA), bodies ordered by island
+
+// Broadphase dynamic AABB tree
+static PhysicsTreeNode *treeNodes = NULL;                   // Tree nodes array, free nodes are linked by parent
+static unsigned int treeNodesCount = 0;                     // Tree nodes used from array (free nodes included)
+static unsigned int treeNodesCapacity = 0;                  // Tree nodes array capacity
+static int treeRoot = -1;                                   // Tree root node index
+static int treeFreeNode = -1;                               // Tree first free node index
+static bool treeLeavesPending = false;                      // Bodies created since last tree update (inserted before queries)
 
 static Vector2 gravityForce = { 0.0f, 9.81f };              // Physics world gravity force
 
@@ -327,24 +475,52 @@ static double GetCurrentTime(void);
 
 static void UpdatePhysicsStep(void);                                                                        // Update physics step (dynamics, collisions and position corrections)
 
-static int FindAvailableBodyIndex();                                                                        // Finds a valid index for a new physics body initialization
-static int FindAvailableManifoldIndex();                                                                    // Finds a valid index for a new manifold initialization
+static void *GrowPhysicsStorage(void *data, unsigned int *capacity, unsigned int required, unsigned int initial, unsigned int size);  // Grows physics storage array to fit required elements
+static bool AddPhysicsBody(PhysicsBody body);                                                               // Adds a physics body to bodies pointers array
+static PhysicsBody AllocatePhysicsBody(void);                                                               // Allocates a physics body from bodies storage chunks (initialized to 0)
+static void FreePhysicsBody(PhysicsBody body);                                                              // Returns a physics body to bodies storage chunks
 static PhysicsVertexData CreateDefaultPolygon(float radius, int sides);                                     // Creates a random polygon shape with max vertex distance from polygon pivot
 static PhysicsVertexData CreateRectanglePolygon(Vector2 pos, Vector2 size);                                 // Creates a rectangle polygon shape based on a min and max positions
 
+static PhysicsAABB GetPhysicsBodyAABB(PhysicsBody body);                                                    // Returns physics body shape bounding box
+static void UpdatePhysicsBroadphase(void);                                                                  // Updates broadphase tree and creates manifolds for bodies pairs in contact
+static bool UpdatePhysicsTree(void);                                                                        // Updates broadphase tree leaves of moved and new bodies, false if tree storage could not be grown
+static int QueryPhysicsTree(PhysicsAABB aabb, unsigned int mask, bool (*check)(PhysicsBody, const void *), const void *data, PhysicsBody *results, int maxResults);  // Returns tree bodies overlapping bounds and passing check
+static bool CheckPhysicsBodyPoint(PhysicsBody body, const void *data);                                      // Checks if a physics body shape contains a point (Vector2)
+static bool CheckPhysicsBodyAABB(PhysicsBody body, const void *data);                                       // Checks if a physics body shape overlaps a bounding box (PhysicsAABB)
+static bool CheckPhysicsBodyCircle(PhysicsBody body, const void *data);                                     // Checks if a physics body shape overlaps a circle (Vector2 center, float radius)
+static bool RaycastPhysicsBody(PhysicsBody body, Vector2 origin, Vector2 direction, float maxDistance, PhysicsRaycastHit *hit);  // Casts a ray against a physics body shape
+static int AllocateTreeNode(void);                                                                          // Allocates a broadphase tree node (tree nodes storage must fit it)
+static void FreeTreeNode(int node);                                                                         // Frees a broadphase tree node
+static void InsertTreeLeaf(int leaf);                                                                       // Inserts a leaf into broadphase tree
+static void RemoveTreeLeaf(int leaf);                                                                       // Removes a leaf from broadphase tree (node is not freed)
+static int BalanceTreeNode(int node);                                                                       // Balances a broadphase tree node by rotation, returns new subtree root
+static PhysicsAABB CombineAABB(PhysicsAABB a, PhysicsAABB b);                                              // Returns union of two bounding boxes
+static float GetAABBPerimeter(PhysicsAABB aabb);                                                            // Returns bounding box perimeter (used as tree insertion cost)
+
+static void StorePhysicsManifolds(void);                                                                    // Stores step manifolds as previous step manifolds, hashed by bodies pair
+static PhysicsManifold FindPreviousManifold(PhysicsBody a, PhysicsBody b);                                  // Finds previous step manifold of a bodies pair
+static void WarmStartPhysicsManifold(PhysicsManifold manifold);                                             // Copies previous step accumulated impulses to matching contacts
+static void UpdatePhysicsIslands(void);                                                                     // Groups bodies connected by contacts into islands, wakes up touched islands
+static int FindIslandRoot(int *parents, int index);                                                         // Finds body island root in union-find parents array
+static void SolvePhysicsIslands(void *data, int start, int end);                                            // Solves a range of islands (dynamics, collisions, position corrections and sleeping)
+static void LoadPhysicsSolverBody(PhysicsBody body, int index);                                             // Loads physics body state into solver bodies arrays
+static void StorePhysicsSolverBody(PhysicsBody body, int index);                                            // Stores solver bodies arrays state into physics body
+
 static void InitializePhysicsManifolds(PhysicsManifold manifold);                                           // Initializes physics manifolds to solve collisions
 static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b);                                 // Creates a new physics manifold to solve collision
-static void DestroyPhysicsManifold(PhysicsManifold manifold);                                               // Unitializes and destroys a physics manifold
 
 static void SolvePhysicsManifold(PhysicsManifold manifold);                                                 // Solves a created physics manifold between two physics bodies
 static void SolveCircleToCircle(PhysicsManifold manifold);                                                  // Solves collision between two circle shape physics bodies
 static void SolveCircleToPolygon(PhysicsManifold manifold);                                                 // Solves collision between a circle to a polygon shape physics bodies
 static void SolvePolygonToCircle(PhysicsManifold manifold);                                                 // Solves collision between a polygon to a circle shape physics bodies
 static void SolvePolygonToPolygon(PhysicsManifold manifold);                                                // Solves collision between two polygons shape physics bodies
-static void IntegratePhysicsForces(PhysicsBody body);                                                       // Integrates physics forces into velocity
-static void IntegratePhysicsVelocity(PhysicsBody body);                                                     // Integrates physics velocity into position and forces
+static void IntegratePhysicsForces(unsigned int start, unsigned int count);                                 // Integrates solver bodies forces into velocities
+static void IntegratePhysicsVelocity(unsigned int start, unsigned int count);                               // Integrates solver bodies velocities into positions and forces
 static void IntegratePhysicsImpulses(PhysicsManifold manifold);                                             // Integrates physics collisions impulses to solve collisions
 static void CorrectPhysicsPositions(PhysicsManifold manifold);                                              // Corrects physics bodies positions based on manifolds collision information
+static void ApplyPhysicsImpulse(int index, Vector2 impulse, Vector2 radius);                                 // Applies an impulse to a solver body at a contact radius
+static Vector2 GetPhysicsRelativeVelocity(int a, int b, Vector2 radiusA, Vector2 radiusB);                  // Returns solver bodies relative velocity at contact radius
 static void FindIncidentFace(Vector2 *v0, Vector2 *v1, PhysicsShape ref, PhysicsShape inc, int index);      // Finds two polygon shapes incident face
 static float FindAxisLeastPenetration(int *faceIndex, PhysicsShape shapeA, PhysicsShape shapeB);            // Finds polygon shapes axis least penetration
 
@@ -395,15 +571,16 @@ PhysicsBody CreatePhysicsBodyCircle(Vector2 pos, float radius, float density)
 // Creates a new rectangle physics body with generic parameters
 PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, float density)
 {
-    // NOTE: Make sure body data is initialized to 0
-    PhysicsBody body = (PhysicsBody)PHYSAC_CALLOC(sizeof(PhysicsBodyData), 1);
-    usedMemory += sizeof(PhysicsBodyData);
+    // NOTE: Body data is initialized to 0
+    PhysicsBody body = AllocatePhysicsBody();
 
-    int id = FindAvailableBodyIndex();
-    if (id != -1)
+    if (body != NULL)
     {
         // Initialize new body with generic values
-        body->id = id;
+        body->id = physicsBodiesNextId++;
+        body->treeNode = -1;
+        body->layer = PHYSAC_LAYER_DEFAULT;
+        body->mask = PHYSAC_LAYER_ALL;
         body->enabled = true;
         body->position = pos;
         body->shape.type = PHYSICS_POLYGON;
@@ -458,14 +635,18 @@ PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, f
         body->useGravity = true;
         body->isGrounded = false;
         body->freezeOrient = false;
+        body->isSleeping = false;
+        body->sleepTime = 0.0f;
+        body->index = 0;
 
         // Add new body to bodies pointers array and update bodies count
-        bodies[physicsBodiesCount] = body;
-        physicsBodiesCount++;
-
-        TRACELOG("[PHYSAC] Physic body created successfully (id: %i)\n", body->id);
+        if (!AddPhysicsBody(body))
+        {
+            FreePhysicsBody(body);
+            body = NULL;
+        }
     }
-    else TRACELOG("[PHYSAC] Physic body could not be created, PHYSAC_MAX_BODIES reached\n");
+    else TRACELOG("[PHYSAC] Physic body could not be created, memory could not be allocated\n");
 
     return body;
 }
@@ -473,14 +654,15 @@ PhysicsBody CreatePhysicsBodyRectangle(Vector2 pos, float width, float height, f
 // Creates a new polygon physics body with generic parameters
 PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float density)
 {
-    PhysicsBody body = (PhysicsBody)PHYSAC_MALLOC(sizeof(PhysicsBodyData));
-    usedMemory += sizeof(PhysicsBodyData);
+    PhysicsBody body = AllocatePhysicsBody();
 
-    int id = FindAvailableBodyIndex();
-    if (id != -1)
+    if (body != NULL)
     {
         // Initialize new body with generic values
-        body->id = id;
+        body->id = physicsBodiesNextId++;
+        body->treeNode = -1;
+        body->layer = PHYSAC_LAYER_DEFAULT;
+        body->mask = PHYSAC_LAYER_ALL;
         body->enabled = true;
         body->position = pos;
         body->velocity = PHYSAC_VECTOR_ZERO;
@@ -540,14 +722,18 @@ PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float
         body->useGravity = true;
         body->isGrounded = false;
         body->freezeOrient = false;
+        body->isSleeping = false;
+        body->sleepTime = 0.0f;
+        body->index = 0;
 
         // Add new body to bodies pointers array and update bodies count
-        bodies[physicsBodiesCount] = body;
-        physicsBodiesCount++;
-
-        TRACELOG("[PHYSAC] Physic body created successfully (id: %i)\n", body->id);
+        if (!AddPhysicsBody(body))
+        {
+            FreePhysicsBody(body);
+            body = NULL;
+        }
     }
-    else TRACELOG("[PHYSAC] Physics body could not be created, PHYSAC_MAX_BODIES reached\n");
+    else TRACELOG("[PHYSAC] Physics body could not be created, memory could not be allocated\n");
 
     return body;
 }
@@ -555,13 +741,21 @@ PhysicsBody CreatePhysicsBodyPolygon(Vector2 pos, float radius, int sides, float
 // Adds a force to a physics body
 void PhysicsAddForce(PhysicsBody body, Vector2 force)
 {
-    if (body != NULL) body->force = MathVector2Add(body->force, force);
+    if (body != NULL)
+    {
+        body->force = MathVector2Add(body->force, force);
+        SetPhysicsBodyAwake(body, true);
+    }
 }
 
 // Adds an angular force to a physics body
 void PhysicsAddTorque(PhysicsBody body, float amount)
 {
-    if (body != NULL) body->torque += amount;
+    if (body != NULL)
+    {
+        body->torque += amount;
+        SetPhysicsBodyAwake(body, true);
+    }
 }
 
 // Shatters a polygon shape physics body to little physics bodies with explosion force
@@ -616,6 +810,7 @@ void PhysicsShatter(PhysicsBody body, Vector2 position, float force)
                     Vector2 offset = MathVector2Subtract(center, bodyPos);
 
                     PhysicsBody body = CreatePhysicsBodyPolygon(center, 10, 3, 10);     // Create polygon physics body with relevant values
+                    if (body == NULL) continue;
 
                     PhysicsVertexData vertexData = { 0 };
                     vertexData.vertexCount = 3;
@@ -800,6 +995,38 @@ void SetPhysicsBodyRotation(PhysicsBody body, float radians)
         body->orient = radians;
 
         if (body->shape.type == PHYSICS_POLYGON) body->shape.transform = MathMatFromRadians(radians);
+
+        SetPhysicsBodyAwake(body, true);
+    }
+}
+
+// Sets physics body sleeping state, its island is woken up on next step
+// NOTE: Sleeping bodies are not moved, bodies modified by user (position, velocity) should be woken up
+void SetPhysicsBodyAwake(PhysicsBody body, bool awake)
+{
+    if (body != NULL)
+    {
+        body->isSleeping = !awake;
+        body->sleepTime = awake? 0.0f : PHYSAC_SLEEP_TIME;
+
+        if (!awake)
+        {
+            body->velocity = PHYSAC_VECTOR_ZERO;
+            body->angularVelocity = 0.0f;
+        }
+    }
+}
+
+// Sets physics body collision layers and mask
+// NOTE: Bodies pair collides when each body layer is in the other body mask
+void SetPhysicsBodyLayer(PhysicsBody body, unsigned int layer, unsigned int mask)
+{
+    if (body != NULL)
+    {
+        body->layer = layer;
+        body->mask = mask;
+
+        SetPhysicsBodyAwake(body, true);
     }
 }
 
@@ -826,9 +1053,29 @@ void DestroyPhysicsBody(PhysicsBody body)
             return;     // Prevent access to index -1
         }
 
-        // Free body allocated memory
-        PHYSAC_FREE(body);
-        usedMemory -= sizeof(PhysicsBodyData);
+        // Wake up bodies in contact, body manifolds are invalidated
+        for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+        {
+            PhysicsManifold manifold = &contacts[i];
+
+            if ((manifold->bodyA == body) || (manifold->bodyB == body))
+            {
+                SetPhysicsBodyAwake((manifold->bodyA == body)? manifold->bodyB : manifold->bodyA, true);
+                manifold->bodyA = NULL;
+                manifold->bodyB = NULL;
+                manifold->contactsCount = 0;
+            }
+        }
+
+        // Remove body from broadphase tree
+        if (body->treeNode != -1)
+        {
+            RemoveTreeLeaf(body->treeNode);
+            FreeTreeNode(body->treeNode);
+        }
+
+        // Return body to bodies storage
+        FreePhysicsBody(body);
         bodies[index] = NULL;
 
         // Reorder physics bodies pointers array and its catched index
@@ -857,32 +1104,24 @@ void ResetPhysics(void)
 
             if (body != NULL)
             {
-                PHYSAC_FREE(body);
+                FreePhysicsBody(body);
                 bodies[i] = NULL;
-                usedMemory -= sizeof(PhysicsBodyData);
             }
         }
 
         physicsBodiesCount = 0;
     }
 
-    if (physicsManifoldsCount > 0)
-    {
-        // Unitialize physics manifolds dynamic memory allocations
-        for (int i = physicsManifoldsCount - 1; i >= 0; i--)
-        {
-            PhysicsManifold manifold = contacts[i];
-
-            if (manifold != NULL)
-            {
-                PHYSAC_FREE(manifold);
-                contacts[i] = NULL;
-                usedMemory -= sizeof(PhysicsManifoldData);
-            }
-        }
+    physicsBodiesNextId = 0;
+    physicsManifoldsCount = 0;
+    previousManifoldsCount = 0;
+    islandsCount = 0;
 
-        physicsManifoldsCount = 0;
-    }
+    // Reset broadphase tree, nodes and bodies storage is kept
+    treeNodesCount = 0;
+    treeRoot = -1;
+    treeFreeNode = -1;
+    treeLeavesPending = false;
 
     TRACELOG("[PHYSAC] Physics module reseted successfully\n");
 }
@@ -890,18 +1129,63 @@ void ResetPhysics(void)
 // Unitializes physics pointers and exits physics loop thread
 void ClosePhysics(void)
 {
-    // Unitialize physics manifolds dynamic memory allocations
-    if (physicsManifoldsCount > 0)
-    {
-        for (int i = physicsManifoldsCount - 1; i >= 0; i--) DestroyPhysicsManifold(contacts[i]);
-    }
-    
+    // Unitialize physics manifolds
+    physicsManifoldsCount = 0;
+    previousManifoldsCount = 0;
+    islandsCount = 0;
+
     // Unitialize physics bodies dynamic memory allocations
     if (physicsBodiesCount > 0)
     {
         for (int i = physicsBodiesCount - 1; i >= 0; i--) DestroyPhysicsBody(bodies[i]);
     }
 
+    // Unitialize physics bodies storage chunks
+    while (bodiesChunks != NULL)
+    {
+        PhysicsBodiesChunk *next = bodiesChunks->next;
+        PHYSAC_FREE(bodiesChunks);
+        usedMemory -= sizeof(PhysicsBodiesChunk);
+        bodiesChunks = next;
+    }
+
+    freeBodies = NULL;
+
+    // Unitialize physics storage arrays
+    PHYSAC_FREE(bodies);
+    PHYSAC_FREE(contacts);
+    PHYSAC_FREE(treeNodes);
+    PHYSAC_FREE(previousContacts);
+    PHYSAC_FREE(previousContactsTable);
+    PHYSAC_FREE(islands);
+    PHYSAC_FREE(islandIndices);
+    PHYSAC_FREE(solverBodies.positionX);
+    usedMemory -= physicsBodiesCapacity*sizeof(PhysicsBody) + physicsManifoldsCapacity*sizeof(PhysicsManifoldData) + treeNodesCapacity*sizeof(PhysicsTreeNode);
+    usedMemory -= previousManifoldsCapacity*sizeof(PhysicsManifoldData) + previousContactsTableSize*sizeof(int);
+    usedMemory -= islandsCapacity*sizeof(PhysicsIsland) + islandIndicesCapacity*sizeof(int);
+    usedMemory -= solverBodies.capacity*PHYSAC_SOLVER_ARRAYS*sizeof(float);
+
+    bodies = NULL;
+    contacts = NULL;
+    treeNodes = NULL;
+    previousContacts = NULL;
+    previousContactsTable = NULL;
+    islands = NULL;
+    islandIndices = NULL;
+    memset(&solverBodies, 0, sizeof(PhysicsSolverBodies));
+    physicsBodiesCapacity = 0;
+    physicsManifoldsCapacity = 0;
+    previousManifoldsCapacity = 0;
+    previousContactsTableSize = 0;
+    islandsCapacity = 0;
+    islandIndicesCapacity = 0;
+    treeNodesCapacity = 0;
+    treeNodesCount = 0;
+    treeRoot = -1;
+    treeFreeNode = -1;
+    treeLeavesPending = false;
+    physicsBodiesNextId = 0;
+
     // Trace log info
     if ((physicsBodiesCount > 0) || (usedMemory != 0)) 
     {
@@ -949,6 +1233,106 @@ void SetPhysicsTimeStep(double delta)
     deltaTime = delta;
 }
 
+// Casts a ray (direction normalized internally) up to max distance, hits are sorted by distance
+// NOTE: Only closest maxHits hits are returned, bodies containing ray origin are not hit
+int PhysicsRaycast(Vector2 origin, Vector2 direction, float maxDistance, unsigned int mask, PhysicsRaycastHit *hits, int maxHits)
+{
+    int hitsCount = 0;
+
+    MathVector2Normalize(&direction);
+    if ((hits == NULL) || (maxHits <= 0) || (maxDistance <= 0.0f) || (MathVector2SqrLen(direction) == 0.0f)) return 0;
+    if (treeLeavesPending && !UpdatePhysicsTree()) return 0;
+    if (treeRoot == -1) return 0;
+
+    int stack[PHYSAC_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    stack[stackCount++] = treeRoot;
+
+    while (stackCount > 0)
+    {
+        PhysicsTreeNode *node = &treeNodes[stack[--stackCount]];
+
+        // Ray against node bounds (slabs), ray is shortened to farthest kept hit once hits array is full
+        float distance = (hitsCount == maxHits)? hits[maxHits - 1].distance : maxDistance;
+        float tmin = 0.0f;
+        float tmax = distance;
+        const float originAxis[2] = { origin.x, origin.y };
+        const float directionAxis[2] = { direction.x, direction.y };
+        const float minAxis[2] = { node->aabb.min.x, node->aabb.min.y };
+        const float maxAxis[2] = { node->aabb.max.x, node->aabb.max.y };
+        bool overlap = true;
+
+        for (int axis = 0; (axis < 2) && overlap; axis++)
+        {
+            if (fabsf(directionAxis[axis]) < PHYSAC_EPSILON)
+            {
+                if ((originAxis[axis] < minAxis[axis]) || (originAxis[axis] > maxAxis[axis])) overlap = false;
+            }
+            else
+            {
+                float t1 = (minAxis[axis] - originAxis[axis])/directionAxis[axis];
+                float t2 = (maxAxis[axis] - originAxis[axis])/directionAxis[axis];
+
+                tmin = PHYSAC_MAX(tmin, PHYSAC_MIN(t1, t2));
+                tmax = PHYSAC_MIN(tmax, PHYSAC_MAX(t1, t2));
+                if (tmin > tmax) overlap = false;
+            }
+        }
+
+        if (!overlap) continue;
+
+        if (node->child1 == -1)
+        {
+            PhysicsRaycastHit hit = { 0 };
+
+            if (!(node->body->layer & mask) || !RaycastPhysicsBody(node->body, origin, direction, distance, &hit)) continue;
+
+            // Insert hit sorted by distance, farthest hit is dropped if hits array is full
+            int index = (hitsCount < maxHits)? hitsCount++ : maxHits - 1;
+            while ((index > 0) && (hits[index - 1].distance > hit.distance))
+            {
+                hits[index] = hits[index - 1];
+                index--;
+            }
+
+            hits[index] = hit;
+        }
+        else if ((stackCount + 2) <= PHYSAC_TREE_STACK_SIZE)
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return hitsCount;
+}
+
+// Returns bodies containing a point
+int PhysicsQueryPoint(Vector2 point, unsigned int mask, PhysicsBody *results, int maxResults)
+{
+    PhysicsAABB aabb = { point, point };
+
+    return QueryPhysicsTree(aabb, mask, CheckPhysicsBodyPoint, &point, results, maxResults);
+}
+
+// Returns bodies overlapping an axis aligned box
+int PhysicsQueryAABB(Vector2 min, Vector2 max, unsigned int mask, PhysicsBody *results, int maxResults)
+{
+    PhysicsAABB aabb = { min, max };
+
+    return QueryPhysicsTree(aabb, mask, CheckPhysicsBodyAABB, &aabb, results, maxResults);
+}
+
+// Returns bodies overlapping a circle
+int PhysicsQueryCircle(Vector2 center, float radius, unsigned int mask, PhysicsBody *results, int maxResults)
+{
+    PhysicsAABB aabb = { CLITERAL(Vector2){ center.x - radius, center.y - radius }, CLITERAL(Vector2){ center.x + radius, center.y + radius } };
+    float circle[3] = { center.x, center.y, radius };
+
+    return QueryPhysicsTree(aabb, mask, CheckPhysicsBodyCircle, circle, results, maxResults);
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -1007,133 +1391,105 @@ static double GetCurrentTime(void)
 // Update physics step (dynamics, collisions and position corrections)
 static void UpdatePhysicsStep(void)
 {
-    // Clear previous generated collisions information
-    for (int i = (int)physicsManifoldsCount - 1; i >= 0; i--)
-    {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) DestroyPhysicsManifold(manifold);
-    }
+    // Keep previous generated collisions information (warm starting)
+    StorePhysicsManifolds();
 
-    // Reset physics bodies grounded state
+    // Reset physics bodies grounded state, sleeping bodies keep it
     for (unsigned int i = 0; i < physicsBodiesCount; i++)
     {
         PhysicsBody body = bodies[i];
-        body->isGrounded = false;
+        if (!body->isSleeping) body->isGrounded = false;
     }
- 
-    // Generate new collision information
-    for (unsigned int i = 0; i < physicsBodiesCount; i++)
-    {
-        PhysicsBody bodyA = bodies[i];
 
-        if (bodyA != NULL)
-        {
-            for (unsigned int j = i + 1; j < physicsBodiesCount; j++)
-            {
-                PhysicsBody bodyB = bodies[j];
+    // Generate new collision information, only bodies pairs with overlapping bounds are solved
+    UpdatePhysicsBroadphase();
 
-                if (bodyB != NULL)
-                {
-                    if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0)) continue;
+    // Group bodies in contact into islands, islands are solved independently
+    UpdatePhysicsIslands();
 
-                    PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
-                    SolvePhysicsManifold(manifold);
+#if defined(PHYSAC_JOB_SYSTEM)
+    ParallelFor(SolvePhysicsIslands, NULL, (int)islandsCount, 0);
+#else
+    SolvePhysicsIslands(NULL, 0, (int)islandsCount);
+#endif
+}
 
-                    if (manifold->contactsCount > 0)
-                    {
-                        // Create a new manifold with same information as previously solved manifold and add it to the manifolds pool last slot
-                        PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
-                        manifold->penetration = manifold->penetration;
-                        manifold->normal = manifold->normal;
-                        manifold->contacts[0] = manifold->contacts[0];
-                        manifold->contacts[1] = manifold->contacts[1];
-                        manifold->contactsCount = manifold->contactsCount;
-                        manifold->restitution = manifold->restitution;
-                        manifold->dynamicFriction = manifold->dynamicFriction;
-                        manifold->staticFriction = manifold->staticFriction;
-                    }
-                }
-            }
-        }
-    }
 
-    // Integrate forces to physics bodies
-    for (unsigned int i = 0; i < physicsBodiesCount; i++)
-    {
-        PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsForces(body);
-    }
+// Grows a physics storage array (capacity doubled) to fit required elements count
+// NOTE: Returns NULL on failure, current array is kept
+static void *GrowPhysicsStorage(void *data, unsigned int *capacity, unsigned int required, unsigned int initial, unsigned int size)
+{
+    if (required <= *capacity) return data;
 
-    // Initialize physics manifolds to solve collisions
-    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
-    {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) InitializePhysicsManifolds(manifold);
-    }
+    unsigned int newCapacity = (*capacity > 0)? *capacity*2 : initial;
+    while (newCapacity < required) newCapacity *= 2;
 
-    // Integrate physics collisions impulses to solve collisions
-    for (unsigned int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
-    {
-        for (unsigned int j = 0; j < physicsManifoldsCount; j++)
-        {
-            PhysicsManifold manifold = contacts[i];
-            if (manifold != NULL) IntegratePhysicsImpulses(manifold);
-        }
-    }
+    void *newData = PHYSAC_REALLOC(data, newCapacity*size);
 
-    // Integrate velocity to physics bodies
-    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    if (newData != NULL)
     {
-        PhysicsBody body = bodies[i];
-        if (body != NULL) IntegratePhysicsVelocity(body);
+        usedMemory += (newCapacity - *capacity)*size;
+        *capacity = newCapacity;
     }
 
-    // Correct physics bodies positions based on manifolds collision information
-    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
-    {
-        PhysicsManifold manifold = contacts[i];
-        if (manifold != NULL) CorrectPhysicsPositions(manifold);
-    }
+    return newData;
+}
 
-    // Clear physics bodies forces
-    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+// Adds a physics body to bodies pointers array, grown if required
+static bool AddPhysicsBody(PhysicsBody body)
+{
+    PhysicsBody *newBodies = (PhysicsBody *)GrowPhysicsStorage(bodies, &physicsBodiesCapacity, physicsBodiesCount + 1, PHYSAC_INITIAL_BODIES, sizeof(PhysicsBody));
+
+    if (newBodies == NULL)
     {
-        PhysicsBody body = bodies[i];
-        if (body != NULL)
-        {
-            body->force = PHYSAC_VECTOR_ZERO;
-            body->torque = 0.0f;
-        }
+        TRACELOG("[PHYSAC] Physic body could not be created, bodies storage could not be grown\n");
+        return false;
     }
+
+    bodies = newBodies;
+    bodies[physicsBodiesCount] = body;
+    physicsBodiesCount++;
+    treeLeavesPending = true;
+
+    TRACELOG("[PHYSAC] Physic body created successfully (id: %i)\n", body->id);
+
+    return true;
 }
 
-// Finds a valid index for a new physics body initialization
-static int FindAvailableBodyIndex()
+// Allocates a physics body from bodies storage chunks, a new chunk is allocated if no free bodies
+// NOTE: Chunks are only freed on ClosePhysics(), physics bodies handles are never moved
+static PhysicsBody AllocatePhysicsBody(void)
 {
-    int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_BODIES; i++)
+    if (freeBodies == NULL)
     {
-        int currentId = i;
+        PhysicsBodiesChunk *chunk = (PhysicsBodiesChunk *)PHYSAC_MALLOC(sizeof(PhysicsBodiesChunk));
 
-        // Check if current id already exist in other physics body
-        for (unsigned int k = 0; k < physicsBodiesCount; k++)
-        {
-            if (bodies[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
+        if (chunk == NULL) return NULL;
+
+        usedMemory += sizeof(PhysicsBodiesChunk);
+        chunk->next = bodiesChunks;
+        bodiesChunks = chunk;
 
-        // If it is not used, use it as new physics body id
-        if (currentId == (int)i)
+        // Link chunk bodies to free list, lower addresses are allocated first
+        for (int i = PHYSAC_BODIES_CHUNK_SIZE - 1; i >= 0; i--)
         {
-            index = (int)i;
-            break;
+            chunk->bodies[i].shape.body = freeBodies;
+            freeBodies = &chunk->bodies[i];
         }
     }
 
-    return index;
+    PhysicsBody body = freeBodies;
+    freeBodies = body->shape.body;
+    memset(body, 0, sizeof(PhysicsBodyData));
+
+    return body;
+}
+
+// Returns a physics body to bodies storage chunks free list
+static void FreePhysicsBody(PhysicsBody body)
+{
+    body->shape.body = freeBodies;
+    freeBodies = body;
 }
 
 // Creates a default polygon shape with max vertex distance from polygon pivot
@@ -1187,151 +1543,1123 @@ static PhysicsVertexData CreateRectanglePolygon(Vector2 pos, Vector2 size)
     return data;
 }
 
-// Finds a valid index for a new manifold initialization
-static int FindAvailableManifoldIndex()
+// Creates a new physics manifold to solve collision, added to manifolds array last slot
+// NOTE: Returned pointer is only valid until next manifold creation (array can be grown)
+static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
 {
-    int index = -1;
-    for (int i = 0; i < PHYSAC_MAX_MANIFOLDS; i++)
+    PhysicsManifoldData *newContacts = (PhysicsManifoldData *)GrowPhysicsStorage(contacts, &physicsManifoldsCapacity, physicsManifoldsCount + 1, PHYSAC_INITIAL_MANIFOLDS, sizeof(PhysicsManifoldData));
+
+    if (newContacts == NULL)
     {
-        int currentId = i;
+        TRACELOG("[PHYSAC] Physic manifold could not be created, manifolds storage could not be grown\n");
+        return NULL;
+    }
 
-        // Check if current id already exist in other physics body
-        for (unsigned int k = 0; k < physicsManifoldsCount; k++)
-        {
-            if (contacts[k]->id == currentId)
-            {
-                currentId++;
-                break;
-            }
-        }
+    contacts = newContacts;
+    PhysicsManifold manifold = &contacts[physicsManifoldsCount];
+
+    // Initialize new manifold with generic values
+    manifold->id = physicsManifoldsCount;
+    manifold->bodyA = a;
+    manifold->bodyB = b;
+    manifold->penetration = 0;
+    manifold->normal = PHYSAC_VECTOR_ZERO;
+    manifold->contacts[0] = PHYSAC_VECTOR_ZERO;
+    manifold->contacts[1] = PHYSAC_VECTOR_ZERO;
+    manifold->contactsCount = 0;
+    manifold->restitution = 0.0f;
+    manifold->dynamicFriction = 0.0f;
+    manifold->staticFriction = 0.0f;
 
-        // If it is not used, use it as new physics body id
-        if (currentId == i)
-        {
-            index = i;
-            break;
-        }
+    for (int i = 0; i < 2; i++)
+    {
+        manifold->normalImpulse[i] = 0.0f;
+        manifold->tangentImpulse[i] = 0.0f;
+        manifold->velocityBias[i] = 0.0f;
     }
 
-    return index;
+    physicsManifoldsCount++;
+
+    return manifold;
 }
 
-// Creates a new physics manifold to solve collision
-static PhysicsManifold CreatePhysicsManifold(PhysicsBody a, PhysicsBody b)
+// Stores step manifolds as previous step manifolds, hashed by bodies pair (warm starting)
+// NOTE: Manifolds arrays are swapped, step manifolds array is cleared
+static void StorePhysicsManifolds(void)
 {
-    PhysicsManifold manifold = (PhysicsManifold)PHYSAC_MALLOC(sizeof(PhysicsManifoldData));
-    usedMemory += sizeof(PhysicsManifoldData);
+    PhysicsManifoldData *manifolds = previousContacts;
+    unsigned int capacity = previousManifoldsCapacity;
 
-    int id = FindAvailableManifoldIndex();
-    if (id != -1)
-    {
-        // Initialize new manifold with generic values
-        manifold->id = id;
-        manifold->bodyA = a;
-        manifold->bodyB = b;
-        manifold->penetration = 0;
-        manifold->normal = PHYSAC_VECTOR_ZERO;
-        manifold->contacts[0] = PHYSAC_VECTOR_ZERO;
-        manifold->contacts[1] = PHYSAC_VECTOR_ZERO;
-        manifold->contactsCount = 0;
-        manifold->restitution = 0.0f;
-        manifold->dynamicFriction = 0.0f;
-        manifold->staticFriction = 0.0f;
+    previousContacts = contacts;
+    previousManifoldsCount = physicsManifoldsCount;
+    previousManifoldsCapacity = physicsManifoldsCapacity;
+    contacts = manifolds;
+    physicsManifoldsCount = 0;
+    physicsManifoldsCapacity = capacity;
 
-        // Add new body to bodies pointers array and update bodies count
-        contacts[physicsManifoldsCount] = manifold;
-        physicsManifoldsCount++;
+    // Hash table keeps at least half of the slots empty
+    int *table = (int *)GrowPhysicsStorage(previousContactsTable, &previousContactsTableSize, 2*previousManifoldsCount, 2*PHYSAC_INITIAL_MANIFOLDS, sizeof(int));
+
+    if (table == NULL)
+    {
+        previousManifoldsCount = 0;     // Warm starting not available this step
+        return;
     }
-    else TRACELOG("[PHYSAC] Physic manifold could not be created, PHYSAC_MAX_MANIFOLDS reached\n");
 
-    return manifold;
-}
+    previousContactsTable = table;
+    for (unsigned int i = 0; i < previousContactsTableSize; i++) previousContactsTable[i] = -1;
 
-// Unitializes and destroys a physics manifold
-static void DestroyPhysicsManifold(PhysicsManifold manifold)
-{
-    if (manifold != NULL)
+    unsigned int mask = previousContactsTableSize - 1;
+
+    for (unsigned int i = 0; i < previousManifoldsCount; i++)
     {
-        int id = manifold->id;
-        int index = -1;
+        PhysicsManifold manifold = &previousContacts[i];
 
-        for (unsigned int i = 0; i < physicsManifoldsCount; i++)
-        {
-            if (contacts[i]->id == id)
-            {
-                index = i;
-                break;
-            }
-        }
+        // Manifolds of destroyed bodies are not kept
+        if ((manifold->bodyA == NULL) || (manifold->bodyB == NULL)) continue;
+
+        unsigned int slot = (manifold->bodyA->id*73856093u ^ manifold->bodyB->id*19349663u) & mask;
+        while (previousContactsTable[slot] != -1) slot = (slot + 1) & mask;
+
+        previousContactsTable[slot] = (int)i;
+    }
+}
 
-        if (index == -1) return;     // Prevent access to index -1
+// Finds previous step manifold of a bodies pair, NULL if bodies were not in contact
+static PhysicsManifold FindPreviousManifold(PhysicsBody a, PhysicsBody b)
+{
+    if (previousManifoldsCount == 0) return NULL;
 
-        // Free manifold allocated memory
-        PHYSAC_FREE(manifold);
-        usedMemory -= sizeof(PhysicsManifoldData);
-        contacts[index] = NULL;
+    unsigned int mask = previousContactsTableSize - 1;
+    unsigned int slot = (a->id*73856093u ^ b->id*19349663u) & mask;
 
-        // Reorder physics manifolds pointers array and its catched index
-        for (unsigned int i = index; i < physicsManifoldsCount; i++)
-        {
-            if ((i + 1) < physicsManifoldsCount) contacts[i] = contacts[i + 1];
-        }
+    while (previousContactsTable[slot] != -1)
+    {
+        PhysicsManifold manifold = &previousContacts[previousContactsTable[slot]];
 
-        // Update physics manifolds count
-        physicsManifoldsCount--;
+        if ((manifold->bodyA == a) && (manifold->bodyB == b)) return manifold;
+
+        slot = (slot + 1) & mask;
     }
-    else TRACELOG("[PHYSAC] WARNING: DestroyPhysicsManifold: NULL physic manifold\n");
+
+    return NULL;
 }
 
-// Solves a created physics manifold between two physics bodies
-static void SolvePhysicsManifold(PhysicsManifold manifold)
+// Copies previous step accumulated impulses to matching contacts (warm starting)
+// NOTE: Contacts are matched by position, previous contact normal must be similar
+static void WarmStartPhysicsManifold(PhysicsManifold manifold)
 {
-    switch (manifold->bodyA->shape.type)
+    PhysicsManifold previous = FindPreviousManifold(manifold->bodyA, manifold->bodyB);
+
+    if ((previous == NULL) || (MathVector2DotProduct(previous->normal, manifold->normal) < 0.95f)) return;
+
+    for (unsigned int i = 0; i < manifold->contactsCount; i++)
     {
-        case PHYSICS_CIRCLE:
-        {
-            switch (manifold->bodyB->shape.type)
-            {
-                case PHYSICS_CIRCLE: SolveCircleToCircle(manifold); break;
-                case PHYSICS_POLYGON: SolveCircleToPolygon(manifold); break;
-                default: break;
-            }
-        } break;
-        case PHYSICS_POLYGON:
+        for (unsigned int j = 0; j < previous->contactsCount; j++)
         {
-            switch (manifold->bodyB->shape.type)
+            if (MathVector2SqrDistance(manifold->contacts[i], previous->contacts[j]) < (PHYSAC_CONTACT_MATCH_DISTANCE*PHYSAC_CONTACT_MATCH_DISTANCE))
             {
-                case PHYSICS_CIRCLE: SolvePolygonToCircle(manifold); break;
-                case PHYSICS_POLYGON: SolvePolygonToPolygon(manifold); break;
-                default: break;
+                manifold->normalImpulse[i] = previous->normalImpulse[j];
+                manifold->tangentImpulse[i] = previous->tangentImpulse[j];
+                break;
             }
-        } break;
-        default: break;
+        }
     }
-
-    // Update physics body grounded state if normal direction is down and grounded state is not set yet in previous manifolds
-    if (!manifold->bodyB->isGrounded) manifold->bodyB->isGrounded = (manifold->normal.y < 0);
 }
 
-// Solves collision between two circle shape physics bodies
-static void SolveCircleToCircle(PhysicsManifold manifold)
+// Groups bodies connected by contacts into islands, islands touched by awake bodies are woken up
+// NOTE: Disabled bodies do not connect islands, they are never modified by solver (shared by islands)
+// NOTE: Bodies state is loaded into solver bodies arrays ordered by island, body index is its solver index
+static void UpdatePhysicsIslands(void)
 {
-    PhysicsBody bodyA = manifold->bodyA;
-    PhysicsBody bodyB = manifold->bodyB;
+    islandsCount = 0;
 
-    if ((bodyA == NULL) || (bodyB == NULL)) return;
+    if (physicsBodiesCount == 0) return;
 
-    // Calculate translational vector, which is normal
-    Vector2 normal = MathVector2Subtract(bodyB->position, bodyA->position);
+    // Islands indices: union-find parents [0, bodies), bodies by island [bodies, 2*bodies), manifolds by island [2*bodies, 2*bodies + manifolds)
+    int *indices = (int *)GrowPhysicsStorage(islandIndices, &islandIndicesCapacity, 2*physicsBodiesCount + physicsManifoldsCount, 2*PHYSAC_INITIAL_BODIES, sizeof(int));
+    PhysicsIsland *newIslands = (PhysicsIsland *)GrowPhysicsStorage(islands, &islandsCapacity, physicsBodiesCount, PHYSAC_INITIAL_BODIES, sizeof(PhysicsIsland));
+    float *solverData = (float *)GrowPhysicsStorage(solverBodies.positionX, &solverBodies.capacity, physicsBodiesCount, PHYSAC_INITIAL_BODIES, PHYSAC_SOLVER_ARRAYS*sizeof(float));
 
-    float distSqr = MathVector2SqrLen(normal);
-    float radius = bodyA->shape.radius + bodyB->shape.radius;
+    if (indices != NULL) islandIndices = indices;
+    if (newIslands != NULL) islands = newIslands;
 
-    // Check if circles are not in contact
-    if (distSqr >= radius*radius)
+    if (solverData != NULL)
     {
-        manifold->contactsCount = 0;
-        return;
+        // Solver bodies arrays share one allocation, arrays are placed by capacity
+        unsigned int capacity = solverBodies.capacity;
+
+        solverBodies.positionX = solverData;
+        solverBodies.positionY = solverData + capacity;
+        solverBodies.velocityX = solverData + 2*capacity;
+        solverBodies.velocityY = solverData + 3*capacity;
+        solverBodies.angularVelocity = solverData + 4*capacity;
+        solverBodies.orient = solverData + 5*capacity;
+        solverBodies.forceX = solverData + 6*capacity;
+        solverBodies.forceY = solverData + 7*capacity;
+        solverBodies.torque = solverData + 8*capacity;
+        solverBodies.inverseMass = solverData + 9*capacity;
+        solverBodies.inverseInertia = solverData + 10*capacity;
+        solverBodies.gravityScale = solverData + 11*capacity;
+    }
+
+    if ((indices == NULL) || (newIslands == NULL) || (solverData == NULL))
+    {
+        TRACELOG("[PHYSAC] WARNING: Physics islands storage could not be grown, dynamics not solved\n");
+        return;
+    }
+
+    int *parents = islandIndices;
+    int *islandBodies = islandIndices + physicsBodiesCount;
+    int *islandManifolds = islandIndices + 2*physicsBodiesCount;
+
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        bodies[i]->index = (int)i;
+        parents[i] = (int)i;
+    }
+
+    // Join islands of bodies in contact, lower body index is kept as root
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        PhysicsManifold manifold = &contacts[i];
+
+        if (!manifold->bodyA->enabled || !manifold->bodyB->enabled) continue;
+
+        int rootA = FindIslandRoot(parents, manifold->bodyA->index);
+        int rootB = FindIslandRoot(parents, manifold->bodyB->index);
+
+        if (rootA < rootB) parents[rootB] = rootA;
+        else if (rootB < rootA) parents[rootA] = rootB;
+    }
+
+    // Assign islands to bodies (body index used as island index until solver bodies are loaded)
+    // NOTE: Roots are lower than their bodies indices, root island is assigned first
+    // NOTE: Island is sleeping if all its enabled bodies are sleeping
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        int root = FindIslandRoot(parents, (int)i);
+
+        if (root == (int)i)
+        {
+            PhysicsIsland island = { 0, 0, 0, 0, true };
+            islands[islandsCount] = island;
+            body->index = (int)islandsCount;
+            islandsCount++;
+        }
+        else body->index = bodies[root]->index;
+
+        islands[body->index].bodiesCount++;
+        if (body->enabled && !body->isSleeping) islands[body->index].sleeping = false;
+    }
+
+    // Manifolds island is the island of its enabled body
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        PhysicsManifold manifold = &contacts[i];
+        islands[manifold->bodyA->enabled? manifold->bodyA->index : manifold->bodyB->index].manifoldsCount++;
+    }
+
+    unsigned int bodiesStart = 0;
+    unsigned int manifoldsStart = 0;
+
+    for (unsigned int i = 0; i < islandsCount; i++)
+    {
+        islands[i].bodiesStart = bodiesStart;
+        islands[i].manifoldsStart = manifoldsStart;
+        bodiesStart += islands[i].bodiesCount;
+        manifoldsStart += islands[i].manifoldsCount;
+        islands[i].bodiesCount = 0;
+        islands[i].manifoldsCount = 0;
+    }
+
+    // Fill manifolds indices by island
+    for (unsigned int i = 0; i < physicsManifoldsCount; i++)
+    {
+        PhysicsManifold manifold = &contacts[i];
+        PhysicsIsland *island = &islands[manifold->bodyA->enabled? manifold->bodyA->index : manifold->bodyB->index];
+
+        islandManifolds[island->manifoldsStart + island->manifoldsCount] = (int)i;
+        island->manifoldsCount++;
+    }
+
+    // Fill bodies indices by island and load solver bodies, bodies of awake islands are woken up
+    // NOTE: Sleeping islands bodies are not loaded, disabled bodies can be in contact with awake islands
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        PhysicsIsland *island = &islands[body->index];
+        int index = (int)(island->bodiesStart + island->bodiesCount);
+
+        islandBodies[index] = (int)i;
+        island->bodiesCount++;
+
+        if (!island->sleeping && body->isSleeping) SetPhysicsBodyAwake(body, true);
+
+        body->index = index;
+        if (!island->sleeping || !body->enabled) LoadPhysicsSolverBody(body, index);
+    }
+}
+
+// Finds body island root in union-find parents array (path halving)
+static int FindIslandRoot(int *parents, int index)
+{
+    while (parents[index] != index)
+    {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+
+    return index;
+}
+
+// Solves a range of islands, [start, end): dynamics, collisions, position corrections and sleeping
+// NOTE: Islands do not share modified bodies, they can be solved in parallel
+static void SolvePhysicsIslands(void *data, int start, int end)
+{
+    (void)data;
+
+    for (int k = start; k < end; k++)
+    {
+        PhysicsIsland island = islands[k];
+
+        if (island.sleeping) continue;
+
+        const int *islandBodies = islandIndices + physicsBodiesCount + island.bodiesStart;
+        const int *islandManifolds = islandIndices + 2*physicsBodiesCount + island.manifoldsStart;
+
+        // Integrate forces to solver bodies, island bodies are contiguous in solver bodies arrays
+        IntegratePhysicsForces(island.bodiesStart, island.bodiesCount);
+
+        // Initialize physics manifolds to solve collisions
+        for (unsigned int i = 0; i < island.manifoldsCount; i++) InitializePhysicsManifolds(&contacts[islandManifolds[i]]);
+
+        // Integrate physics collisions impulses to solve collisions
+        for (unsigned int i = 0; i < PHYSAC_COLLISION_ITERATIONS; i++)
+        {
+            for (unsigned int j = 0; j < island.manifoldsCount; j++) IntegratePhysicsImpulses(&contacts[islandManifolds[j]]);
+        }
+
+        // Update bodies resting time, island falls asleep once all its bodies are resting long enough
+        float minSleepTime = PHYSAC_FLT_MAX;
+
+        for (unsigned int i = 0; i < island.bodiesCount; i++)
+        {
+            PhysicsBody body = bodies[islandBodies[i]];
+
+            if (!body->enabled) continue;
+
+            unsigned int index = island.bodiesStart + i;
+            Vector2 velocity = { solverBodies.velocityX[index], solverBodies.velocityY[index] };
+
+            if ((MathVector2SqrLen(velocity) > (PHYSAC_SLEEP_LINEAR_VELOCITY*PHYSAC_SLEEP_LINEAR_VELOCITY)) ||
+                ((float)fabs(solverBodies.angularVelocity[index]) > PHYSAC_SLEEP_ANGULAR_VELOCITY)) body->sleepTime = 0.0f;
+            else body->sleepTime += (float)deltaTime;
+
+            minSleepTime = PHYSAC_MIN(minSleepTime, body->sleepTime);
+        }
+
+        // Integrate velocity to solver bodies
+        IntegratePhysicsVelocity(island.bodiesStart, island.bodiesCount);
+
+        // Correct solver bodies positions based on manifolds collision information
+        for (unsigned int i = 0; i < island.manifoldsCount; i++) CorrectPhysicsPositions(&contacts[islandManifolds[i]]);
+
+        // Store solver bodies state into physics bodies and clear physics bodies forces
+        for (unsigned int i = 0; i < island.bodiesCount; i++)
+        {
+            PhysicsBody body = bodies[islandBodies[i]];
+
+            if (body->enabled) StorePhysicsSolverBody(body, (int)(island.bodiesStart + i));
+
+            body->force = PHYSAC_VECTOR_ZERO;
+            body->torque = 0.0f;
+
+            if ((minSleepTime >= PHYSAC_SLEEP_TIME) && body->enabled) SetPhysicsBodyAwake(body, false);
+        }
+    }
+}
+
+// Loads physics body state into solver bodies arrays
+// NOTE: Disabled bodies are loaded as infinite mass and not moving, frozen orientation as infinite inertia
+static void LoadPhysicsSolverBody(PhysicsBody body, int index)
+{
+    bool dynamic = body->enabled;
+    bool rotating = body->enabled && !body->freezeOrient;
+
+    solverBodies.positionX[index] = body->position.x;
+    solverBodies.positionY[index] = body->position.y;
+    solverBodies.velocityX[index] = dynamic? body->velocity.x : 0.0f;
+    solverBodies.velocityY[index] = dynamic? body->velocity.y : 0.0f;
+    solverBodies.angularVelocity[index] = rotating? body->angularVelocity : 0.0f;
+    solverBodies.orient[index] = body->orient;
+    solverBodies.forceX[index] = body->force.x;
+    solverBodies.forceY[index] = body->force.y;
+    solverBodies.torque[index] = body->torque;
+    solverBodies.inverseMass[index] = dynamic? body->inverseMass : 0.0f;
+    solverBodies.inverseInertia[index] = rotating? body->inverseInertia : 0.0f;
+    solverBodies.gravityScale[index] = (dynamic && body->useGravity && (body->inverseMass != 0.0f))? 1.0f : 0.0f;
+}
+
+// Stores solver bodies arrays state into physics body (enabled bodies only)
+static void StorePhysicsSolverBody(PhysicsBody body, int index)
+{
+    body->position.x = solverBodies.positionX[index];
+    body->position.y = solverBodies.positionY[index];
+    body->velocity.x = solverBodies.velocityX[index];
+    body->velocity.y = solverBodies.velocityY[index];
+
+    if (!body->freezeOrient)
+    {
+        body->angularVelocity = solverBodies.angularVelocity[index];
+        body->orient = solverBodies.orient[index];
+    }
+
+    body->shape.transform = MathMatFromRadians(body->orient);
+}
+
+// Returns physics body shape bounding box (world space)
+static PhysicsAABB GetPhysicsBodyAABB(PhysicsBody body)
+{
+    PhysicsAABB aabb = { body->position, body->position };
+
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        aabb.min.x -= body->shape.radius;
+        aabb.min.y -= body->shape.radius;
+        aabb.max.x += body->shape.radius;
+        aabb.max.y += body->shape.radius;
+    }
+    else
+    {
+        const Vector2 *positions = body->shape.vertexData.positions;
+        const unsigned int vertexCount = body->shape.vertexData.vertexCount;
+        const Matrix2x2 transform = body->shape.transform;
+        unsigned int i = 0;
+
+#if defined(PHYSAC_SIMD_SSE)
+        if (vertexCount >= 2)
+        {
+            // Two vertices transformed per register: (x0, y0, x1, y1)
+            const __m128 column0 = _mm_setr_ps(transform.m00, transform.m10, transform.m00, transform.m10);
+            const __m128 column1 = _mm_setr_ps(transform.m01, transform.m11, transform.m01, transform.m11);
+            const __m128 position = _mm_setr_ps(body->position.x, body->position.y, body->position.x, body->position.y);
+            __m128 minimum = position;
+            __m128 maximum = position;
+
+            for (; (i + 2) <= vertexCount; i += 2)
+            {
+                __m128 vertices = _mm_loadu_ps(&positions[i].x);
+                __m128 x = _mm_shuffle_ps(vertices, vertices, _MM_SHUFFLE(2, 2, 0, 0));
+                __m128 y = _mm_shuffle_ps(vertices, vertices, _MM_SHUFFLE(3, 3, 1, 1));
+                __m128 vertex = _mm_add_ps(position, _mm_add_ps(_mm_mul_ps(x, column0), _mm_mul_ps(y, column1)));
+
+                minimum = _mm_min_ps(minimum, vertex);
+                maximum = _mm_max_ps(maximum, vertex);
+            }
+
+            // Reduce both vertices lanes
+            float result[4] = { 0 };
+            _mm_storeu_ps(result, _mm_min_ps(minimum, _mm_movehl_ps(minimum, minimum)));
+            aabb.min.x = result[0];
+            aabb.min.y = result[1];
+            _mm_storeu_ps(result, _mm_max_ps(maximum, _mm_movehl_ps(maximum, maximum)));
+            aabb.max.x = result[0];
+            aabb.max.y = result[1];
+        }
+#elif defined(PHYSAC_SIMD_NEON)
+        if (vertexCount >= 4)
+        {
+            // Four vertices transformed per register, loaded deinterleaved: (x0, x1, x2, x3), (y0, y1, y2, y3)
+            float32x4_t minimumX = vdupq_n_f32(body->position.x);
+            float32x4_t minimumY = vdupq_n_f32(body->position.y);
+            float32x4_t maximumX = minimumX;
+            float32x4_t maximumY = minimumY;
+
+            for (; (i + 4) <= vertexCount; i += 4)
+            {
+                float32x4x2_t vertices = vld2q_f32(&positions[i].x);
+                float32x4_t x = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(body->position.x), vertices.val[0], transform.m00), vertices.val[1], transform.m01);
+                float32x4_t y = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(body->position.y), vertices.val[0], transform.m10), vertices.val[1], transform.m11);
+
+                minimumX = vminq_f32(minimumX, x);
+                minimumY = vminq_f32(minimumY, y);
+                maximumX = vmaxq_f32(maximumX, x);
+                maximumY = vmaxq_f32(maximumY, y);
+            }
+
+            // Reduce lanes (pairwise, also available on ARMv7)
+            float32x2_t minimum = vpmin_f32(vget_low_f32(minimumX), vget_high_f32(minimumX));
+            aabb.min.x = vget_lane_f32(vpmin_f32(minimum, minimum), 0);
+            minimum = vpmin_f32(vget_low_f32(minimumY), vget_high_f32(minimumY));
+            aabb.min.y = vget_lane_f32(vpmin_f32(minimum, minimum), 0);
+            float32x2_t maximum = vpmax_f32(vget_low_f32(maximumX), vget_high_f32(maximumX));
+            aabb.max.x = vget_lane_f32(vpmax_f32(maximum, maximum), 0);
+            maximum = vpmax_f32(vget_low_f32(maximumY), vget_high_f32(maximumY));
+            aabb.max.y = vget_lane_f32(vpmax_f32(maximum, maximum), 0);
+        }
+#endif
+        for (; i < vertexCount; i++)
+        {
+            Vector2 vertex = MathVector2Add(body->position, MathMatVector2Product(transform, positions[i]));
+
+            aabb.min.x = PHYSAC_MIN(aabb.min.x, vertex.x);
+            aabb.min.y = PHYSAC_MIN(aabb.min.y, vertex.y);
+            aabb.max.x = PHYSAC_MAX(aabb.max.x, vertex.x);
+            aabb.max.y = PHYSAC_MAX(aabb.max.y, vertex.y);
+        }
+    }
+
+    return aabb;
+}
+
+// Updates broadphase tree and creates manifolds for bodies pairs in contact
+// NOTE: Tree leaves hold bodies fat AABBs, bodies are only reinserted when moved out of it
+static void UpdatePhysicsBroadphase(void)
+{
+    if (!UpdatePhysicsTree())
+    {
+        TRACELOG("[PHYSAC] WARNING: Broadphase tree storage could not be grown, collisions not solved\n");
+        return;
+    }
+
+    // Query tree for every body, overlapping pairs are solved
+    int stack[PHYSAC_TREE_STACK_SIZE] = { 0 };
+
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody bodyA = bodies[i];
+        PhysicsAABB aabb = treeNodes[bodyA->treeNode].aabb;
+        int stackCount = 0;
+
+        stack[stackCount++] = treeRoot;
+
+        while (stackCount > 0)
+        {
+            PhysicsTreeNode *node = &treeNodes[stack[--stackCount]];
+
+            if ((node->aabb.max.x < aabb.min.x) || (node->aabb.min.x > aabb.max.x) ||
+                (node->aabb.max.y < aabb.min.y) || (node->aabb.min.y > aabb.max.y)) continue;
+
+            if (node->child1 == -1)
+            {
+                PhysicsBody bodyB = node->body;
+
+                // Every pair is found from both bodies, solved once with older body as bodyA
+                if (bodyB->id <= bodyA->id) continue;
+                if (!(bodyA->layer & bodyB->mask) || !(bodyB->layer & bodyA->mask)) continue;
+                if ((bodyA->inverseMass == 0) && (bodyB->inverseMass == 0)) continue;
+
+                // Pairs without awake bodies are not solved, sleeping pairs keep previous manifold (bodies not moved)
+                if ((bodyA->isSleeping || !bodyA->enabled) && (bodyB->isSleeping || !bodyB->enabled))
+                {
+                    PhysicsManifold previous = (bodyA->isSleeping && bodyB->isSleeping)? FindPreviousManifold(bodyA, bodyB) : NULL;
+
+                    if (previous != NULL)
+                    {
+                        PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
+
+                        if (manifold != NULL)
+                        {
+                            unsigned int id = manifold->id;
+                            *manifold = *previous;
+                            manifold->id = id;
+                        }
+                    }
+
+                    continue;
+                }
+
+                PhysicsManifold manifold = CreatePhysicsManifold(bodyA, bodyB);
+
+                if (manifold != NULL)
+                {
+                    SolvePhysicsManifold(manifold);
+
+                    // Only manifolds with contacts are kept
+                    if (manifold->contactsCount == 0) physicsManifoldsCount--;
+                    else WarmStartPhysicsManifold(manifold);
+                }
+            }
+            else if ((stackCount + 2) <= PHYSAC_TREE_STACK_SIZE)
+            {
+                stack[stackCount++] = node->child1;
+                stack[stackCount++] = node->child2;
+            }
+        }
+    }
+}
+
+// Updates broadphase tree leaves, new bodies are inserted and bodies moved out of their fat AABB are reinserted
+static bool UpdatePhysicsTree(void)
+{
+    // Tree nodes storage must fit all bodies leaves and internal nodes, no allocation while updating the tree
+    PhysicsTreeNode *newNodes = (PhysicsTreeNode *)GrowPhysicsStorage(treeNodes, &treeNodesCapacity, 2*physicsBodiesCount, 2*PHYSAC_INITIAL_BODIES, sizeof(PhysicsTreeNode));
+
+    if (newNodes == NULL) return false;
+
+    treeNodes = newNodes;
+
+    // Update bodies tree leaves
+    for (unsigned int i = 0; i < physicsBodiesCount; i++)
+    {
+        PhysicsBody body = bodies[i];
+        PhysicsAABB aabb = GetPhysicsBodyAABB(body);
+
+        if (body->treeNode != -1)
+        {
+            PhysicsAABB fatAABB = treeNodes[body->treeNode].aabb;
+
+            // Body still inside its fat AABB, tree not modified
+            if ((aabb.min.x >= fatAABB.min.x) && (aabb.min.y >= fatAABB.min.y) &&
+                (aabb.max.x <= fatAABB.max.x) && (aabb.max.y <= fatAABB.max.y)) continue;
+
+            RemoveTreeLeaf(body->treeNode);
+        }
+        else
+        {
+            body->treeNode = AllocateTreeNode();
+            treeNodes[body->treeNode].body = body;
+        }
+
+        treeNodes[body->treeNode].aabb.min = CLITERAL(Vector2){ aabb.min.x - PHYSAC_AABB_MARGIN, aabb.min.y - PHYSAC_AABB_MARGIN };
+        treeNodes[body->treeNode].aabb.max = CLITERAL(Vector2){ aabb.max.x + PHYSAC_AABB_MARGIN, aabb.max.y + PHYSAC_AABB_MARGIN };
+        InsertTreeLeaf(body->treeNode);
+    }
+
+    treeLeavesPending = false;
+
+    return true;
+}
+
+// Returns tree bodies overlapping bounds, with a layer in mask and passing shape check
+// NOTE: Bodies are found from their fat AABB, shape check tests current body shape
+static int QueryPhysicsTree(PhysicsAABB aabb, unsigned int mask, bool (*check)(PhysicsBody, const void *), const void *data, PhysicsBody *results, int maxResults)
+{
+    int resultsCount = 0;
+
+    if ((results == NULL) || (maxResults <= 0)) return 0;
+    if (treeLeavesPending && !UpdatePhysicsTree()) return 0;
+    if (treeRoot == -1) return 0;
+
+    int stack[PHYSAC_TREE_STACK_SIZE] = { 0 };
+    int stackCount = 0;
+
+    stack[stackCount++] = treeRoot;
+
+    while ((stackCount > 0) && (resultsCount < maxResults))
+    {
+        PhysicsTreeNode *node = &treeNodes[stack[--stackCount]];
+
+        if ((node->aabb.max.x < aabb.min.x) || (node->aabb.min.x > aabb.max.x) ||
+            (node->aabb.max.y < aabb.min.y) || (node->aabb.min.y > aabb.max.y)) continue;
+
+        if (node->child1 == -1)
+        {
+            if ((node->body->layer & mask) && check(node->body, data)) results[resultsCount++] = node->body;
+        }
+        else if ((stackCount + 2) <= PHYSAC_TREE_STACK_SIZE)
+        {
+            stack[stackCount++] = node->child1;
+            stack[stackCount++] = node->child2;
+        }
+    }
+
+    return resultsCount;
+}
+
+// Checks if a physics body shape contains a point
+static bool CheckPhysicsBodyPoint(PhysicsBody body, const void *data)
+{
+    Vector2 point = *(const Vector2 *)data;
+
+    if (body->shape.type == PHYSICS_CIRCLE) return (MathVector2SqrDistance(point, body->position) <= body->shape.radius*body->shape.radius);
+
+    // Point in polygon model space, inside all faces
+    Vector2 local = MathMatVector2Product(MathMatTranspose(body->shape.transform), MathVector2Subtract(point, body->position));
+    const PhysicsVertexData *vertexData = &body->shape.vertexData;
+
+    for (unsigned int i = 0; i < vertexData->vertexCount; i++)
+    {
+        if (MathVector2DotProduct(vertexData->normals[i], MathVector2Subtract(local, vertexData->positions[i])) > 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Checks if a physics body shape overlaps a bounding box
+static bool CheckPhysicsBodyAABB(PhysicsBody body, const void *data)
+{
+    PhysicsAABB aabb = *(const PhysicsAABB *)data;
+
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        Vector2 closest = { PHYSAC_MIN(PHYSAC_MAX(body->position.x, aabb.min.x), aabb.max.x), PHYSAC_MIN(PHYSAC_MAX(body->position.y, aabb.min.y), aabb.max.y) };
+        return (MathVector2SqrDistance(closest, body->position) <= body->shape.radius*body->shape.radius);
+    }
+
+    // Separating axis: box axes (bounds overlap) and polygon faces normals
+    PhysicsAABB bounds = GetPhysicsBodyAABB(body);
+
+    if ((bounds.max.x < aabb.min.x) || (bounds.min.x > aabb.max.x) ||
+        (bounds.max.y < aabb.min.y) || (bounds.min.y > aabb.max.y)) return false;
+
+    const PhysicsVertexData *vertexData = &body->shape.vertexData;
+
+    for (unsigned int i = 0; i < vertexData->vertexCount; i++)
+    {
+        Vector2 normal = MathMatVector2Product(body->shape.transform, vertexData->normals[i]);
+        Vector2 vertex = MathVector2Add(body->position, MathMatVector2Product(body->shape.transform, vertexData->positions[i]));
+
+        // Box corner deepest along face normal
+        Vector2 corner = { (normal.x >= 0.0f)? aabb.min.x : aabb.max.x, (normal.y >= 0.0f)? aabb.min.y : aabb.max.y };
+
+        if (MathVector2DotProduct(normal, MathVector2Subtract(corner, vertex)) > 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Checks if a physics body shape overlaps a circle
+static bool CheckPhysicsBodyCircle(PhysicsBody body, const void *data)
+{
+    const float *circle = (const float *)data;
+    Vector2 center = { circle[0], circle[1] };
+    float radius = circle[2];
+
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        float distance = radius + body->shape.radius;
+        return (MathVector2SqrDistance(center, body->position) <= distance*distance);
+    }
+
+    // Circle center in polygon model space, separation from faces
+    Vector2 local = MathMatVector2Product(MathMatTranspose(body->shape.transform), MathVector2Subtract(center, body->position));
+    const PhysicsVertexData *vertexData = &body->shape.vertexData;
+    float separation = -PHYSAC_FLT_MAX;
+
+    for (unsigned int i = 0; i < vertexData->vertexCount; i++)
+    {
+        float faceSeparation = MathVector2DotProduct(vertexData->normals[i], MathVector2Subtract(local, vertexData->positions[i]));
+
+        if (faceSeparation > radius) return false;
+        separation = PHYSAC_MAX(separation, faceSeparation);
+    }
+
+    // Center inside polygon
+    if (separation <= 0.0f) return true;
+
+    // Center outside polygon, closest point on polygon edges
+    for (unsigned int i = 0; i < vertexData->vertexCount; i++)
+    {
+        Vector2 v1 = vertexData->positions[i];
+        Vector2 v2 = vertexData->positions[((i + 1) < vertexData->vertexCount)? (i + 1) : 0];
+        Vector2 edge = MathVector2Subtract(v2, v1);
+        float edgeSqrLen = MathVector2SqrLen(edge);
+        float t = (edgeSqrLen > 0.0f)? MathVector2DotProduct(MathVector2Subtract(local, v1), edge)/edgeSqrLen : 0.0f;
+
+        t = PHYSAC_MIN(PHYSAC_MAX(t, 0.0f), 1.0f);
+
+        if (MathVector2SqrDistance(local, CLITERAL(Vector2){ v1.x + edge.x*t, v1.y + edge.y*t }) <= radius*radius) return true;
+    }
+
+    return false;
+}
+
+// Casts a ray (normalized direction) against a physics body shape
+// NOTE: Shapes containing ray origin are not hit
+static bool RaycastPhysicsBody(PhysicsBody body, Vector2 origin, Vector2 direction, float maxDistance, PhysicsRaycastHit *hit)
+{
+    if (body->shape.type == PHYSICS_CIRCLE)
+    {
+        Vector2 offset = MathVector2Subtract(origin, body->position);
+        float b = MathVector2SqrLen(offset) - body->shape.radius*body->shape.radius;
+        if (b < 0.0f) return false;
+
+        float c = MathVector2DotProduct(offset, direction);
+        float discriminant = c*c - b;
+        if ((c > 0.0f) || (discriminant < 0.0f)) return false;
+
+        float t = -c - sqrtf(discriminant);
+        if (t > maxDistance) return false;
+
+        hit->normal = CLITERAL(Vector2){ offset.x + direction.x*t, offset.y + direction.y*t };
+        MathVector2Normalize(&hit->normal);
+        hit->distance = t;
+    }
+    else
+    {
+        // Ray clipped by polygon faces in model space
+        Matrix2x2 transpose = MathMatTranspose(body->shape.transform);
+        Vector2 localOrigin = MathMatVector2Product(transpose, MathVector2Subtract(origin, body->position));
+        Vector2 localDirection = MathMatVector2Product(transpose, direction);
+        const PhysicsVertexData *vertexData = &body->shape.vertexData;
+        float tmin = 0.0f;
+        float tmax = maxDistance;
+        int face = -1;
+
+        for (unsigned int i = 0; i < vertexData->vertexCount; i++)
+        {
+            float numerator = MathVector2DotProduct(vertexData->normals[i], MathVector2Subtract(vertexData->positions[i], localOrigin));
+            float denominator = MathVector2DotProduct(vertexData->normals[i], localDirection);
+
+            if (denominator == 0.0f)
+            {
+                if (numerator < 0.0f) return false;     // Ray parallel to face and outside
+            }
+            else if (denominator < 0.0f)
+            {
+                // Ray entering face half-plane
+                if (numerator < tmin*denominator)
+                {
+                    tmin = numerator/denominator;
+                    face = (int)i;
+                }
+            }
+            else if (numerator < tmax*denominator) tmax = numerator/denominator;     // Ray leaving face half-plane
+
+            if (tmax < tmin) return false;
+        }
+
+        if (face == -1) return false;
+
+        hit->normal = MathMatVector2Product(body->shape.transform, vertexData->normals[face]);
+        hit->distance = tmin;
+    }
+
+    hit->body = body;
+    hit->point = CLITERAL(Vector2){ origin.x + direction.x*hit->distance, origin.y + direction.y*hit->distance };
+
+    return true;
+}
+
+// Allocates a broadphase tree node, from free nodes list or array end
+// NOTE: Tree nodes storage must fit the node, it is grown before updating the tree
+static int AllocateTreeNode(void)
+{
+    int node = treeFreeNode;
+
+    if (node != -1) treeFreeNode = treeNodes[node].parent;
+    else node = (int)treeNodesCount++;
+
+    treeNodes[node].aabb = CLITERAL(PhysicsAABB){ PHYSAC_VECTOR_ZERO, PHYSAC_VECTOR_ZERO };
+    treeNodes[node].body = NULL;
+    treeNodes[node].parent = -1;
+    treeNodes[node].child1 = -1;
+    treeNodes[node].child2 = -1;
+    treeNodes[node].height = 0;
+
+    return node;
+}
+
+// Frees a broadphase tree node, added to free nodes list
+static void FreeTreeNode(int node)
+{
+    treeNodes[node].parent = treeFreeNode;
+    treeNodes[node].height = -1;
+    treeFreeNode = node;
+}
+
+// Returns union of two bounding boxes
+static PhysicsAABB CombineAABB(PhysicsAABB a, PhysicsAABB b)
+{
+    PhysicsAABB aabb = { 0 };
+
+    aabb.min.x = PHYSAC_MIN(a.min.x, b.min.x);
+    aabb.min.y = PHYSAC_MIN(a.min.y, b.min.y);
+    aabb.max.x = PHYSAC_MAX(a.max.x, b.max.x);
+    aabb.max.y = PHYSAC_MAX(a.max.y, b.max.y);
+
+    return aabb;
+}
+
+// Returns bounding box perimeter (used as tree insertion cost)
+static float GetAABBPerimeter(PhysicsAABB aabb)
+{
+    return 2.0f*((aabb.max.x - aabb.min.x) + (aabb.max.y - aabb.min.y));
+}
+
+// Inserts a leaf into broadphase tree, sibling chosen by perimeter cost heuristic
+static void InsertTreeLeaf(int leaf)
+{
+    if (treeRoot == -1)
+    {
+        treeRoot = leaf;
+        treeNodes[leaf].parent = -1;
+        return;
+    }
+
+    // Find best sibling for the new leaf
+    PhysicsAABB leafAABB = treeNodes[leaf].aabb;
+    int index = treeRoot;
+
+    while (treeNodes[index].child1 != -1)
+    {
+        float perimeter = GetAABBPerimeter(treeNodes[index].aabb);
+        float combinedPerimeter = GetAABBPerimeter(CombineAABB(treeNodes[index].aabb, leafAABB));
+
+        float cost = 2.0f*combinedPerimeter;                            // Cost of creating a new parent for this node and the new leaf
+        float inheritanceCost = 2.0f*(combinedPerimeter - perimeter);   // Minimum cost of pushing the leaf further down the tree
+
+        // Cost of descending into each child
+        float childCost[2] = { 0 };
+        int children[2] = { treeNodes[index].child1, treeNodes[index].child2 };
+
+        for (int i = 0; i < 2; i++)
+        {
+            PhysicsTreeNode *child = &treeNodes[children[i]];
+            childCost[i] = GetAABBPerimeter(CombineAABB(child->aabb, leafAABB)) + inheritanceCost;
+            if (child->child1 != -1) childCost[i] -= GetAABBPerimeter(child->aabb);
+        }
+
+        if ((cost < childCost[0]) && (cost < childCost[1])) break;
+
+        index = (childCost[0] < childCost[1])? children[0] : children[1];
+    }
+
+    // Create a new parent for sibling and leaf
+    int sibling = index;
+    int oldParent = treeNodes[sibling].parent;
+    int newParent = AllocateTreeNode();
+
+    treeNodes[newParent].parent = oldParent;
+    treeNodes[newParent].aabb = CombineAABB(leafAABB, treeNodes[sibling].aabb);
+    treeNodes[newParent].height = treeNodes[sibling].height + 1;
+    treeNodes[newParent].child1 = sibling;
+    treeNodes[newParent].child2 = leaf;
+    treeNodes[sibling].parent = newParent;
+    treeNodes[leaf].parent = newParent;
+
+    if (oldParent != -1)
+    {
+        if (treeNodes[oldParent].child1 == sibling) treeNodes[oldParent].child1 = newParent;
+        else treeNodes[oldParent].child2 = newParent;
+    }
+    else treeRoot = newParent;
+
+    // Walk back up the tree fixing heights and bounds
+    index = treeNodes[leaf].parent;
+
+    while (index != -1)
+    {
+        index = BalanceTreeNode(index);
+
+        int child1 = treeNodes[index].child1;
+        int child2 = treeNodes[index].child2;
+
+        treeNodes[index].height = 1 + PHYSAC_MAX(treeNodes[child1].height, treeNodes[child2].height);
+        treeNodes[index].aabb = CombineAABB(treeNodes[child1].aabb, treeNodes[child2].aabb);
+
+        index = treeNodes[index].parent;
+    }
+}
+
+// Removes a leaf from broadphase tree, leaf node is not freed
+static void RemoveTreeLeaf(int leaf)
+{
+    if (leaf == treeRoot)
+    {
+        treeRoot = -1;
+        return;
+    }
+
+    int parent = treeNodes[leaf].parent;
+    int grandParent = treeNodes[parent].parent;
+    int sibling = (treeNodes[parent].child1 == leaf)? treeNodes[parent].child2 : treeNodes[parent].child1;
+
+    // Replace parent by sibling
+    if (grandParent != -1)
+    {
+        if (treeNodes[grandParent].child1 == parent) treeNodes[grandParent].child1 = sibling;
+        else treeNodes[grandParent].child2 = sibling;
+
+        treeNodes[sibling].parent = grandParent;
+        FreeTreeNode(parent);
+
+        // Walk back up the tree fixing heights and bounds
+        int index = grandParent;
+
+        while (index != -1)
+        {
+            index = BalanceTreeNode(index);
+
+            int child1 = treeNodes[index].child1;
+            int child2 = treeNodes[index].child2;
+
+            treeNodes[index].height = 1 + PHYSAC_MAX(treeNodes[child1].height, treeNodes[child2].height);
+            treeNodes[index].aabb = CombineAABB(treeNodes[child1].aabb, treeNodes[child2].aabb);
+
+            index = treeNodes[index].parent;
+        }
+    }
+    else
+    {
+        treeRoot = sibling;
+        treeNodes[sibling].parent = -1;
+        FreeTreeNode(parent);
+    }
+
+    treeNodes[leaf].parent = -1;
+}
+
+// Balances a broadphase tree node if children heights differ more than one (rotation)
+// NOTE: Returns the new subtree root node index
+static int BalanceTreeNode(int iA)
+{
+    PhysicsTreeNode *A = &treeNodes[iA];
+
+    if ((A->child1 == -1) || (A->height < 2)) return iA;
+
+    int iB = A->child1;
+    int iC = A->child2;
+    PhysicsTreeNode *B = &treeNodes[iB];
+    PhysicsTreeNode *C = &treeNodes[iC];
+
+    int balance = C->height - B->height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        int iF = C->child1;
+        int iG = C->child2;
+        PhysicsTreeNode *F = &treeNodes[iF];
+        PhysicsTreeNode *G = &treeNodes[iG];
+
+        // Swap A and C
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+
+        if (C->parent != -1)
+        {
+            if (treeNodes[C->parent].child1 == iA) treeNodes[C->parent].child1 = iC;
+            else treeNodes[C->parent].child2 = iC;
+        }
+        else treeRoot = iC;
+
+        // Rotate
+        if (F->height > G->height)
+        {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->aabb = CombineAABB(B->aabb, G->aabb);
+            C->aabb = CombineAABB(A->aabb, F->aabb);
+            A->height = 1 + PHYSAC_MAX(B->height, G->height);
+            C->height = 1 + PHYSAC_MAX(A->height, F->height);
+        }
+        else
+        {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->aabb = CombineAABB(B->aabb, F->aabb);
+            C->aabb = CombineAABB(A->aabb, G->aabb);
+            A->height = 1 + PHYSAC_MAX(B->height, F->height);
+            C->height = 1 + PHYSAC_MAX(A->height, G->height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        int iD = B->child1;
+        int iE = B->child2;
+        PhysicsTreeNode *D = &treeNodes[iD];
+        PhysicsTreeNode *E = &treeNodes[iE];
+
+        // Swap A and B
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+
+        if (B->parent != -1)
+        {
+            if (treeNodes[B->parent].child1 == iA) treeNodes[B->parent].child1 = iB;
+            else treeNodes[B->parent].child2 = iB;
+        }
+        else treeRoot = iB;
+
+        // Rotate
+        if (D->height > E->height)
+        {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->aabb = CombineAABB(C->aabb, E->aabb);
+            B->aabb = CombineAABB(A->aabb, D->aabb);
+            A->height = 1 + PHYSAC_MAX(C->height, E->height);
+            B->height = 1 + PHYSAC_MAX(A->height, D->height);
+        }
+        else
+        {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->aabb = CombineAABB(C->aabb, D->aabb);
+            B->aabb = CombineAABB(A->aabb, E->aabb);
+            A->height = 1 + PHYSAC_MAX(C->height, D->height);
+            B->height = 1 + PHYSAC_MAX(A->height, E->height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Solves a created physics manifold between two physics bodies
+static void SolvePhysicsManifold(PhysicsManifold manifold)
+{
+    switch (manifold->bodyA->shape.type)
+    {
+        case PHYSICS_CIRCLE:
+        {
+            switch (manifold->bodyB->shape.type)
+            {
+                case PHYSICS_CIRCLE: SolveCircleToCircle(manifold); break;
+                case PHYSICS_POLYGON: SolveCircleToPolygon(manifold); break;
+                default: break;
+            }
+        } break;
+        case PHYSICS_POLYGON:
+        {
+            switch (manifold->bodyB->shape.type)
+            {
+                case PHYSICS_CIRCLE: SolvePolygonToCircle(manifold); break;
+                case PHYSICS_POLYGON: SolvePolygonToPolygon(manifold); break;
+                default: break;
+            }
+        } break;
+        default: break;
+    }
+
+    // Update physics body grounded state if normal direction is down and grounded state is not set yet in previous manifolds
+    if (!manifold->bodyB->isGrounded) manifold->bodyB->isGrounded = (manifold->normal.y < 0);
+}
+
+// Solves collision between two circle shape physics bodies
+static void SolveCircleToCircle(PhysicsManifold manifold)
+{
+    PhysicsBody bodyA = manifold->bodyA;
+    PhysicsBody bodyB = manifold->bodyB;
+
+    if ((bodyA == NULL) || (bodyB == NULL)) return;
+
+    // Calculate translational vector, which is normal
+    Vector2 normal = MathVector2Subtract(bodyB->position, bodyA->position);
+
+    float distSqr = MathVector2SqrLen(normal);
+    float radius = bodyA->shape.radius + bodyB->shape.radius;
+
+    // Check if circles are not in contact
+    if (distSqr >= radius*radius)
+    {
+        manifold->contactsCount = 0;
+        return;
     }
 
     float distance = sqrtf(distSqr);
@@ -1563,24 +2891,65 @@ static void SolvePolygonToPolygon(PhysicsManifold manifold)
     manifold->contactsCount = currentPoint;
 }
 
-// Integrates physics forces into velocity
-static void IntegratePhysicsForces(PhysicsBody body)
+// Integrates solver bodies forces into velocities, [start, start + count)
+// NOTE: Bodies not affected by forces or gravity have 0 inverse mass, inverse inertia and gravity scale
+static void IntegratePhysicsForces(unsigned int start, unsigned int count)
 {
-    if ((body == NULL) || (body->inverseMass == 0.0f) || !body->enabled) return;
+    const float halfStep = (float)(deltaTime/2.0);
+    const float gravityX = (float)(gravityForce.x*(deltaTime/1000/2.0));
+    const float gravityY = (float)(gravityForce.y*(deltaTime/1000/2.0));
+    const unsigned int end = start + count;
+    unsigned int i = start;
 
-    body->velocity.x += (float)((body->force.x*body->inverseMass)*(deltaTime/2.0));
-    body->velocity.y += (float)((body->force.y*body->inverseMass)*(deltaTime/2.0));
+#if defined(PHYSAC_SIMD_SSE)
+    const __m128 step = _mm_set1_ps(halfStep);
 
-    if (body->useGravity)
+    for (; (i + 4) <= end; i += 4)
     {
-        body->velocity.x += (float)(gravityForce.x*(deltaTime/1000/2.0));
-        body->velocity.y += (float)(gravityForce.y*(deltaTime/1000/2.0));
+        __m128 inverseMass = _mm_mul_ps(_mm_loadu_ps(&solverBodies.inverseMass[i]), step);
+        __m128 gravityScale = _mm_loadu_ps(&solverBodies.gravityScale[i]);
+
+        __m128 velocityX = _mm_add_ps(_mm_loadu_ps(&solverBodies.velocityX[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.forceX[i]), inverseMass));
+        __m128 velocityY = _mm_add_ps(_mm_loadu_ps(&solverBodies.velocityY[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.forceY[i]), inverseMass));
+        velocityX = _mm_add_ps(velocityX, _mm_mul_ps(gravityScale, _mm_set1_ps(gravityX)));
+        velocityY = _mm_add_ps(velocityY, _mm_mul_ps(gravityScale, _mm_set1_ps(gravityY)));
+
+        __m128 inverseInertia = _mm_mul_ps(_mm_loadu_ps(&solverBodies.inverseInertia[i]), step);
+        __m128 angularVelocity = _mm_add_ps(_mm_loadu_ps(&solverBodies.angularVelocity[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.torque[i]), inverseInertia));
+
+        _mm_storeu_ps(&solverBodies.velocityX[i], velocityX);
+        _mm_storeu_ps(&solverBodies.velocityY[i], velocityY);
+        _mm_storeu_ps(&solverBodies.angularVelocity[i], angularVelocity);
     }
+#elif defined(PHYSAC_SIMD_NEON)
+    for (; (i + 4) <= end; i += 4)
+    {
+        float32x4_t inverseMass = vmulq_n_f32(vld1q_f32(&solverBodies.inverseMass[i]), halfStep);
+        float32x4_t gravityScale = vld1q_f32(&solverBodies.gravityScale[i]);
+
+        float32x4_t velocityX = vmlaq_f32(vld1q_f32(&solverBodies.velocityX[i]), vld1q_f32(&solverBodies.forceX[i]), inverseMass);
+        float32x4_t velocityY = vmlaq_f32(vld1q_f32(&solverBodies.velocityY[i]), vld1q_f32(&solverBodies.forceY[i]), inverseMass);
+        velocityX = vmlaq_n_f32(velocityX, gravityScale, gravityX);
+        velocityY = vmlaq_n_f32(velocityY, gravityScale, gravityY);
 
-    if (!body->freezeOrient) body->angularVelocity += (float)(body->torque*body->inverseInertia*(deltaTime/2.0));
+        float32x4_t inverseInertia = vmulq_n_f32(vld1q_f32(&solverBodies.inverseInertia[i]), halfStep);
+        float32x4_t angularVelocity = vmlaq_f32(vld1q_f32(&solverBodies.angularVelocity[i]), vld1q_f32(&solverBodies.torque[i]), inverseInertia);
+
+        vst1q_f32(&solverBodies.velocityX[i], velocityX);
+        vst1q_f32(&solverBodies.velocityY[i], velocityY);
+        vst1q_f32(&solverBodies.angularVelocity[i], angularVelocity);
+    }
+#endif
+
+    for (; i < end; i++)
+    {
+        solverBodies.velocityX[i] += solverBodies.forceX[i]*solverBodies.inverseMass[i]*halfStep + solverBodies.gravityScale[i]*gravityX;
+        solverBodies.velocityY[i] += solverBodies.forceY[i]*solverBodies.inverseMass[i]*halfStep + solverBodies.gravityScale[i]*gravityY;
+        solverBodies.angularVelocity[i] += solverBodies.torque[i]*solverBodies.inverseInertia[i]*halfStep;
+    }
 }
 
-// Initializes physics manifolds to solve collisions
+// Initializes physics manifolds to solve collisions, previous step impulses are applied (warm starting)
 static void InitializePhysicsManifolds(PhysicsManifold manifold)
 {
     PhysicsBody bodyA = manifold->bodyA;
@@ -1593,26 +2962,38 @@ static void InitializePhysicsManifolds(PhysicsManifold manifold)
     manifold->staticFriction = sqrtf(bodyA->staticFriction*bodyB->staticFriction);
     manifold->dynamicFriction = sqrtf(bodyA->dynamicFriction*bodyB->dynamicFriction);
 
+    int a = bodyA->index;
+    int b = bodyB->index;
+    Vector2 positionA = { solverBodies.positionX[a], solverBodies.positionY[a] };
+    Vector2 positionB = { solverBodies.positionX[b], solverBodies.positionY[b] };
+    Vector2 tangent = { manifold->normal.y, -manifold->normal.x };
+
     for (unsigned int i = 0; i < manifold->contactsCount; i++)
     {
         // Caculate radius from center of mass to contact
-        Vector2 radiusA = MathVector2Subtract(manifold->contacts[i], bodyA->position);
-        Vector2 radiusB = MathVector2Subtract(manifold->contacts[i], bodyB->position);
-
-        Vector2 crossA = MathVector2Product(radiusA, bodyA->angularVelocity);
-        Vector2 crossB = MathVector2Product(radiusB, bodyB->angularVelocity);
+        Vector2 radiusA = MathVector2Subtract(manifold->contacts[i], positionA);
+        Vector2 radiusB = MathVector2Subtract(manifold->contacts[i], positionB);
 
-        Vector2 radiusV = { 0.0f, 0.0f };
-        radiusV.x = bodyB->velocity.x + crossB.x - bodyA->velocity.x - crossA.x;
-        radiusV.y = bodyB->velocity.y + crossB.y - bodyA->velocity.y - crossA.y;
+        Vector2 radiusV = GetPhysicsRelativeVelocity(a, b, radiusA, radiusB);
 
         // Determine if we should perform a resting collision or not;
         // The idea is if the only thing moving this object is gravity, then the collision should be performed without any restitution
-        if (MathVector2SqrLen(radiusV) < (MathVector2SqrLen(CLITERAL(Vector2){ (float)(gravityForce.x*deltaTime/1000), (float)(gravityForce.y*deltaTime/1000) }) + PHYSAC_EPSILON)) manifold->restitution = 0;
+        float contactVelocity = MathVector2DotProduct(radiusV, manifold->normal);
+
+        if ((contactVelocity >= 0.0f) || (MathVector2SqrLen(radiusV) < (MathVector2SqrLen(CLITERAL(Vector2){ (float)(gravityForce.x*deltaTime/1000), (float)(gravityForce.y*deltaTime/1000) }) + PHYSAC_EPSILON))) manifold->velocityBias[i] = 0.0f;
+        else manifold->velocityBias[i] = -manifold->restitution*contactVelocity;
+
+        // Apply previous step accumulated impulses
+        Vector2 impulse = { manifold->normal.x*manifold->normalImpulse[i] + tangent.x*manifold->tangentImpulse[i],
+                            manifold->normal.y*manifold->normalImpulse[i] + tangent.y*manifold->tangentImpulse[i] };
+
+        ApplyPhysicsImpulse(a, CLITERAL(Vector2){ -impulse.x, -impulse.y }, radiusA);
+        ApplyPhysicsImpulse(b, impulse, radiusB);
     }
 }
 
 // Integrates physics collisions impulses to solve collisions
+// NOTE: Impulses are accumulated per contact and clamped, accumulated impulses are reused next step (warm starting)
 static void IntegratePhysicsImpulses(PhysicsManifold manifold)
 {
     PhysicsBody bodyA = manifold->bodyA;
@@ -1620,111 +3001,113 @@ static void IntegratePhysicsImpulses(PhysicsManifold manifold)
 
     if ((bodyA == NULL) || (bodyB == NULL)) return;
 
-    // Early out and positional correct if both objects have infinite mass
-    if (fabs(bodyA->inverseMass + bodyB->inverseMass) <= PHYSAC_EPSILON)
-    {
-        bodyA->velocity = PHYSAC_VECTOR_ZERO;
-        bodyB->velocity = PHYSAC_VECTOR_ZERO;
-        return;
-    }
+    // Disabled bodies and frozen orientations are loaded as infinite mass and inertia
+    int a = bodyA->index;
+    int b = bodyB->index;
+    float inverseMassA = solverBodies.inverseMass[a];
+    float inverseMassB = solverBodies.inverseMass[b];
+    float inverseInertiaA = solverBodies.inverseInertia[a];
+    float inverseInertiaB = solverBodies.inverseInertia[b];
+
+    // Early out if both objects have infinite mass
+    if ((inverseMassA + inverseMassB) <= PHYSAC_EPSILON) return;
+
+    Vector2 positionA = { solverBodies.positionX[a], solverBodies.positionY[a] };
+    Vector2 positionB = { solverBodies.positionX[b], solverBodies.positionY[b] };
+    Vector2 tangent = { manifold->normal.y, -manifold->normal.x };
 
     for (unsigned int i = 0; i < manifold->contactsCount; i++)
     {
         // Calculate radius from center of mass to contact
-        Vector2 radiusA = MathVector2Subtract(manifold->contacts[i], bodyA->position);
-        Vector2 radiusB = MathVector2Subtract(manifold->contacts[i], bodyB->position);
+        Vector2 radiusA = MathVector2Subtract(manifold->contacts[i], positionA);
+        Vector2 radiusB = MathVector2Subtract(manifold->contacts[i], positionB);
 
         // Calculate relative velocity
-        Vector2 radiusV = { 0.0f, 0.0f };
-        radiusV.x = bodyB->velocity.x + MathVector2Product(radiusB, bodyB->angularVelocity).x - bodyA->velocity.x - MathVector2Product(radiusA, bodyA->angularVelocity).x;
-        radiusV.y = bodyB->velocity.y + MathVector2Product(radiusB, bodyB->angularVelocity).y - bodyA->velocity.y - MathVector2Product(radiusA, bodyA->angularVelocity).y;
+        Vector2 radiusV = GetPhysicsRelativeVelocity(a, b, radiusA, radiusB);
 
         // Relative velocity along the normal
         float contactVelocity = MathVector2DotProduct(radiusV, manifold->normal);
 
-        // Do not resolve if velocities are separating
-        if (contactVelocity > 0.0f) return;
-
         float raCrossN = MathVector2CrossProduct(radiusA, manifold->normal);
         float rbCrossN = MathVector2CrossProduct(radiusB, manifold->normal);
 
-        float inverseMassSum = bodyA->inverseMass + bodyB->inverseMass + (raCrossN*raCrossN)*bodyA->inverseInertia + (rbCrossN*rbCrossN)*bodyB->inverseInertia;
+        float inverseMassSum = inverseMassA + inverseMassB + (raCrossN*raCrossN)*inverseInertiaA + (rbCrossN*rbCrossN)*inverseInertiaB;
+        if (inverseMassSum <= PHYSAC_EPSILON) continue;
 
-        // Calculate impulse scalar value
-        float impulse = -(1.0f + manifold->restitution)*contactVelocity;
-        impulse /= inverseMassSum;
-        impulse /= (float)manifold->contactsCount;
+        // Calculate impulse scalar value, accumulated impulse can only push bodies apart
+        float impulse = -(contactVelocity - manifold->velocityBias[i])/inverseMassSum;
+        float accumulatedImpulse = PHYSAC_MAX(manifold->normalImpulse[i] + impulse, 0.0f);
+        impulse = accumulatedImpulse - manifold->normalImpulse[i];
+        manifold->normalImpulse[i] = accumulatedImpulse;
 
         // Apply impulse to each physics body
         Vector2 impulseV = { manifold->normal.x*impulse, manifold->normal.y*impulse };
-
-        if (bodyA->enabled)
-        {
-            bodyA->velocity.x += bodyA->inverseMass*(-impulseV.x);
-            bodyA->velocity.y += bodyA->inverseMass*(-impulseV.y);
-            if (!bodyA->freezeOrient) bodyA->angularVelocity += bodyA->inverseInertia*MathVector2CrossProduct(radiusA, CLITERAL(Vector2){ -impulseV.x, -impulseV.y });
-        }
-
-        if (bodyB->enabled)
-        {
-            bodyB->velocity.x += bodyB->inverseMass*(impulseV.x);
-            bodyB->velocity.y += bodyB->inverseMass*(impulseV.y);
-            if (!bodyB->freezeOrient) bodyB->angularVelocity += bodyB->inverseInertia*MathVector2CrossProduct(radiusB, impulseV);
-        }
+        ApplyPhysicsImpulse(a, CLITERAL(Vector2){ -impulseV.x, -impulseV.y }, radiusA);
+        ApplyPhysicsImpulse(b, impulseV, radiusB);
 
         // Apply friction impulse to each physics body
-        radiusV.x = bodyB->velocity.x + MathVector2Product(radiusB, bodyB->angularVelocity).x - bodyA->velocity.x - MathVector2Product(radiusA, bodyA->angularVelocity).x;
-        radiusV.y = bodyB->velocity.y + MathVector2Product(radiusB, bodyB->angularVelocity).y - bodyA->velocity.y - MathVector2Product(radiusA, bodyA->angularVelocity).y;
+        radiusV = GetPhysicsRelativeVelocity(a, b, radiusA, radiusB);
 
-        Vector2 tangent = { radiusV.x - (manifold->normal.x*MathVector2DotProduct(radiusV, manifold->normal)), radiusV.y - (manifold->normal.y*MathVector2DotProduct(radiusV, manifold->normal)) };
-        MathVector2Normalize(&tangent);
+        float raCrossT = MathVector2CrossProduct(radiusA, tangent);
+        float rbCrossT = MathVector2CrossProduct(radiusB, tangent);
+        float inverseMassSumTangent = inverseMassA + inverseMassB + (raCrossT*raCrossT)*inverseInertiaA + (rbCrossT*rbCrossT)*inverseInertiaB;
 
         // Calculate impulse tangent magnitude
-        float impulseTangent = -MathVector2DotProduct(radiusV, tangent);
-        impulseTangent /= inverseMassSum;
-        impulseTangent /= (float)manifold->contactsCount;
+        float impulseTangent = -MathVector2DotProduct(radiusV, tangent)/inverseMassSumTangent;
 
-        float absImpulseTangent = (float)fabs(impulseTangent);
+        // Apply coulumb's law, static friction holds contact up to its limit, dynamic friction limits sliding
+        float accumulatedTangent = manifold->tangentImpulse[i] + impulseTangent;
 
-        // Don't apply tiny friction impulses
-        if (absImpulseTangent <= PHYSAC_EPSILON) return;
-
-        // Apply coulumb's law
-        Vector2 tangentImpulse = { 0.0f, 0.0f };
-        if (absImpulseTangent < impulse*manifold->staticFriction) tangentImpulse = CLITERAL(Vector2){ tangent.x*impulseTangent, tangent.y*impulseTangent };
-        else tangentImpulse = CLITERAL(Vector2){ tangent.x*-impulse*manifold->dynamicFriction, tangent.y*-impulse*manifold->dynamicFriction };
-
-        // Apply friction impulse
-        if (bodyA->enabled)
+        if ((float)fabs(accumulatedTangent) > manifold->staticFriction*manifold->normalImpulse[i])
         {
-            bodyA->velocity.x += bodyA->inverseMass*(-tangentImpulse.x);
-            bodyA->velocity.y += bodyA->inverseMass*(-tangentImpulse.y);
-
-            if (!bodyA->freezeOrient) bodyA->angularVelocity += bodyA->inverseInertia*MathVector2CrossProduct(radiusA, CLITERAL(Vector2){ -tangentImpulse.x, -tangentImpulse.y });
+            float maxFriction = manifold->dynamicFriction*manifold->normalImpulse[i];
+            accumulatedTangent = PHYSAC_MAX(-maxFriction, PHYSAC_MIN(accumulatedTangent, maxFriction));
         }
 
-        if (bodyB->enabled)
-        {
-            bodyB->velocity.x += bodyB->inverseMass*(tangentImpulse.x);
-            bodyB->velocity.y += bodyB->inverseMass*(tangentImpulse.y);
+        impulseTangent = accumulatedTangent - manifold->tangentImpulse[i];
+        manifold->tangentImpulse[i] = accumulatedTangent;
 
-            if (!bodyB->freezeOrient) bodyB->angularVelocity += bodyB->inverseInertia*MathVector2CrossProduct(radiusB, tangentImpulse);
-        }
+        // Apply friction impulse
+        Vector2 tangentImpulse = { tangent.x*impulseTangent, tangent.y*impulseTangent };
+        ApplyPhysicsImpulse(a, CLITERAL(Vector2){ -tangentImpulse.x, -tangentImpulse.y }, radiusA);
+        ApplyPhysicsImpulse(b, tangentImpulse, radiusB);
     }
 }
 
-// Integrates physics velocity into position and forces
-static void IntegratePhysicsVelocity(PhysicsBody body)
+// Integrates solver bodies velocities into positions and forces, [start, start + count)
+// NOTE: Disabled bodies and frozen orientations are loaded with 0 velocities, they are not moved
+static void IntegratePhysicsVelocity(unsigned int start, unsigned int count)
 {
-    if ((body == NULL) ||!body->enabled) return;
+    const float step = (float)deltaTime;
+    const unsigned int end = start + count;
+    unsigned int i = start;
 
-    body->position.x += (float)(body->velocity.x*deltaTime);
-    body->position.y += (float)(body->velocity.y*deltaTime);
+#if defined(PHYSAC_SIMD_SSE)
+    const __m128 stepV = _mm_set1_ps(step);
 
-    if (!body->freezeOrient) body->orient += (float)(body->angularVelocity*deltaTime);
-    body->shape.transform = MathMatFromRadians(body->orient);
+    for (; (i + 4) <= end; i += 4)
+    {
+        _mm_storeu_ps(&solverBodies.positionX[i], _mm_add_ps(_mm_loadu_ps(&solverBodies.positionX[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.velocityX[i]), stepV)));
+        _mm_storeu_ps(&solverBodies.positionY[i], _mm_add_ps(_mm_loadu_ps(&solverBodies.positionY[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.velocityY[i]), stepV)));
+        _mm_storeu_ps(&solverBodies.orient[i], _mm_add_ps(_mm_loadu_ps(&solverBodies.orient[i]), _mm_mul_ps(_mm_loadu_ps(&solverBodies.angularVelocity[i]), stepV)));
+    }
+#elif defined(PHYSAC_SIMD_NEON)
+    for (; (i + 4) <= end; i += 4)
+    {
+        vst1q_f32(&solverBodies.positionX[i], vmlaq_n_f32(vld1q_f32(&solverBodies.positionX[i]), vld1q_f32(&solverBodies.velocityX[i]), step));
+        vst1q_f32(&solverBodies.positionY[i], vmlaq_n_f32(vld1q_f32(&solverBodies.positionY[i]), vld1q_f32(&solverBodies.velocityY[i]), step));
+        vst1q_f32(&solverBodies.orient[i], vmlaq_n_f32(vld1q_f32(&solverBodies.orient[i]), vld1q_f32(&solverBodies.angularVelocity[i]), step));
+    }
+#endif
 
-    IntegratePhysicsForces(body);
+    for (; i < end; i++)
+    {
+        solverBodies.positionX[i] += solverBodies.velocityX[i]*step;
+        solverBodies.positionY[i] += solverBodies.velocityY[i]*step;
+        solverBodies.orient[i] += solverBodies.angularVelocity[i]*step;
+    }
+
+    IntegratePhysicsForces(start, count);
 }
 
 // Corrects physics bodies positions based on manifolds collision information
@@ -1735,23 +3118,57 @@ static void CorrectPhysicsPositions(PhysicsManifold manifold)
 
     if ((bodyA == NULL) || (bodyB == NULL)) return;
 
+    int a = bodyA->index;
+    int b = bodyB->index;
+    float inverseMassA = solverBodies.inverseMass[a];
+    float inverseMassB = solverBodies.inverseMass[b];
+
+    if ((inverseMassA + inverseMassB) <= PHYSAC_EPSILON) return;
+
     Vector2 correction = { 0.0f, 0.0f };
-    correction.x = (PHYSAC_MAX(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(bodyA->inverseMass + bodyB->inverseMass))*manifold->normal.x*PHYSAC_PENETRATION_CORRECTION;
-    correction.y = (PHYSAC_MAX(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(bodyA->inverseMass + bodyB->inverseMass))*manifold->normal.y*PHYSAC_PENETRATION_CORRECTION;
+    correction.x = (PHYSAC_MAX(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(inverseMassA + inverseMassB))*manifold->normal.x*PHYSAC_PENETRATION_CORRECTION;
+    correction.y = (PHYSAC_MAX(manifold->penetration - PHYSAC_PENETRATION_ALLOWANCE, 0.0f)/(inverseMassA + inverseMassB))*manifold->normal.y*PHYSAC_PENETRATION_CORRECTION;
 
-    if (bodyA->enabled)
+    // NOTE: Infinite mass bodies are not written, disabled bodies are shared by islands
+    if (inverseMassA != 0.0f)
     {
-        bodyA->position.x -= correction.x*bodyA->inverseMass;
-        bodyA->position.y -= correction.y*bodyA->inverseMass;
+        solverBodies.positionX[a] -= correction.x*inverseMassA;
+        solverBodies.positionY[a] -= correction.y*inverseMassA;
     }
 
-    if (bodyB->enabled)
+    if (inverseMassB != 0.0f)
     {
-        bodyB->position.x += correction.x*bodyB->inverseMass;
-        bodyB->position.y += correction.y*bodyB->inverseMass;
+        solverBodies.positionX[b] += correction.x*inverseMassB;
+        solverBodies.positionY[b] += correction.y*inverseMassB;
     }
 }
 
+// Applies an impulse to a solver body at a contact radius
+// NOTE: Infinite mass and inertia bodies are not written, disabled bodies are shared by islands
+static void ApplyPhysicsImpulse(int index, Vector2 impulse, Vector2 radius)
+{
+    float inverseMass = solverBodies.inverseMass[index];
+    float inverseInertia = solverBodies.inverseInertia[index];
+
+    if ((inverseMass == 0.0f) && (inverseInertia == 0.0f)) return;
+
+    solverBodies.velocityX[index] += inverseMass*impulse.x;
+    solverBodies.velocityY[index] += inverseMass*impulse.y;
+    solverBodies.angularVelocity[index] += inverseInertia*MathVector2CrossProduct(radius, impulse);
+}
+
+// Returns solver bodies relative velocity at contact radius (b relative to a)
+static Vector2 GetPhysicsRelativeVelocity(int a, int b, Vector2 radiusA, Vector2 radiusB)
+{
+    Vector2 crossA = MathVector2Product(radiusA, solverBodies.angularVelocity[a]);
+    Vector2 crossB = MathVector2Product(radiusB, solverBodies.angularVelocity[b]);
+
+    Vector2 result = { solverBodies.velocityX[b] + crossB.x - solverBodies.velocityX[a] - crossA.x,
+                       solverBodies.velocityY[b] + crossB.y - solverBodies.velocityY[a] - crossA.y };
+
+    return result;
+}
+
 // Returns the extreme point along a direction within a polygon
 static Vector2 GetSupport(PhysicsShape shape, Vector2 dir)
 {
@@ -91,6 +91,24 @@
 *   TOOL: rGuiIcons is a visual tool to customize raygui icons.
 *
 *
+*   GUI PANEL CACHE (opt-in):
+*
+*   A block of controls can be cached into a render texture with GuiBeginPanelCache()/GuiEndPanelCache(),
+*   block controls are only processed and drawn again when mouse input hits the panel, the provided
+*   version value changes or gui global state (state, lock, alpha, font, style) changes, otherwise
+*   the panel is drawn as one textured quad:
+*
+*       if (GuiBeginPanelCache(id, bounds, version))
+*       {
+*           // Panel controls, drawn in screen coordinates inside bounds
+*           GuiEndPanelCache();
+*       }
+*
+*   Version should change when any value shown by the panel changes (i.e. a hash of panel values),
+*   keyboard input does not invalidate the cache, controls in edit mode must change the version
+*   Controls drawn out of panel bounds are clipped (DropdownBox lists, MessageBox...)
+*
+*
 *   CONFIGURATION:
 *
 *   #define RAYGUI_IMPLEMENTATION
@@ -484,6 +502,13 @@ RAYGUIAPI Font GuiGetFont(void);                                        // Get g
 RAYGUIAPI void GuiSetStyle(int control, int property, int value);       // Set one style property
 RAYGUIAPI int GuiGetStyle(int control, int property);                   // Get one style property
 
+#if !defined(RAYGUI_STANDALONE)
+// Panel cache functions (opt-in), panel controls are drawn from a render texture while not changed
+RAYGUIAPI bool GuiBeginPanelCache(int id, Rectangle bounds, unsigned int version);  // Begin cached panel, returns true if panel controls must be processed (call GuiEndPanelCache() after)
+RAYGUIAPI void GuiEndPanelCache(void);                                  // End cached panel, panel render texture is drawn
+RAYGUIAPI void GuiUnloadPanelCaches(void);                              // Unload cached panels render textures
+#endif
+
 // Container/separator controls, useful for controls organization
 RAYGUIAPI bool GuiWindowBox(Rectangle bounds, const char *title);                                       // Window Box control, shows a window that can be closed
 RAYGUIAPI void GuiGroupBox(Rectangle bounds, const char *text);                                         // Group Box control with text name
@@ -546,6 +571,9 @@ RAYGUIAPI void GuiSetIconData(int iconId, unsigned int *data);  // Set icon bit
 RAYGUIAPI void GuiSetIconPixel(int iconId, int x, int y);       // Set icon pixel value
 RAYGUIAPI void GuiClearIconPixel(int iconId, int x, int y);     // Clear icon pixel value
 RAYGUIAPI bool GuiCheckIconPixel(int iconId, int x, int y);     // Check icon pixel value
+#if !defined(RAYGUI_STANDALONE)
+RAYGUIAPI void GuiUnloadIconsTexture(void);                     // Unload icons atlas texture (rasterized again on next icon draw)
+#endif
 #endif
 
 #if defined(__cplusplus)
@@ -1136,6 +1164,7 @@ static unsigned int guiIcons[RICON_MAX_ICONS*RICON_DATA_ELEMENTS] = {
 #define RAYGUI_MAX_CONTROLS             16      // Maximum number of standard controls
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of standard properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
+#define RAYGUI_MAX_PANEL_CACHES          8      // Maximum number of cached panels [GuiBeginPanelCache()]
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -1143,6 +1172,21 @@ static unsigned int guiIcons[RICON_MAX_ICONS*RICON_DATA_ELEMENTS] = {
 // Gui control property style color element
 typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 
+#if !defined(RAYGUI_STANDALONE)
+// Gui cached panel, panel controls rendered into a render texture
+typedef struct GuiPanelCache {
+    int id;                     // Panel id provided by user
+    bool used;                  // Panel cache slot in use
+    bool valid;                 // Render texture contains panel controls
+    bool active;                // Panel input was active on last render (rendered again once inactive)
+    RenderTexture2D target;     // Panel controls render texture
+    Rectangle bounds;           // Panel bounds on last render
+    unsigned int version;       // Panel values version on last render
+    unsigned int state;         // Gui global state hash on last render
+    Vector2 mousePosition;      // Mouse position on last begin
+} GuiPanelCache;
+#endif
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -1168,6 +1212,17 @@ static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI
 
 static bool guiStyleLoaded = false;     // Style loaded flag for lazy style initialization
 
+#if !defined(RAYGUI_STANDALONE)
+static GuiPanelCache guiPanelCaches[RAYGUI_MAX_PANEL_CACHES] = { 0 };   // Cached panels
+static GuiPanelCache *guiPanelCache = NULL;     // Cached panel being rendered
+static int guiPanelCacheDepth = 0;              // Panels begun while rendering a cached panel (processed uncached)
+#endif
+
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_RICONS)
+static Texture2D guiIconsTexture = { 0 };       // Icons atlas texture, icons rasterized in a 16 columns grid
+static bool guiIconsDirty = true;               // Icons data changed since icons atlas rasterization
+#endif
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1246,6 +1301,12 @@ static void GuiDrawText(const char *text, Rectangle bounds, int alignment, Color
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color);   // Gui draw rectangle using default raygui style
 
 static const char **GuiTextSplit(const char *text, int *count, int *textRow);   // Split controls text into multiple strings
+#if !defined(RAYGUI_STANDALONE)
+static unsigned int GetPanelCacheState(void);                   // Get gui global state hash (state, lock, alpha, font, style)
+#endif
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_RICONS)
+static void UpdateIconsTexture(void);                           // Rasterize icons data into icons atlas texture
+#endif
 static Vector3 ConvertHSVtoRGB(Vector3 hsv);                    // Convert color data from HSV to RGB
 static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color data from RGB to HSV
 
@@ -1324,6 +1385,132 @@ int GuiGetStyle(int control, int property)
     return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
 }
 
+#if !defined(RAYGUI_STANDALONE)
+// Begin cached panel, returns true if panel controls must be processed, GuiEndPanelCache() must be called after them
+// NOTE: Panel is rendered again on mouse input over it (or while dragging from it), on version or gui state change,
+// otherwise cached render texture is drawn and false is returned (panel controls are skipped)
+// NOTE: Panels are processed uncached if no cache slot available or if begun inside a cached panel
+bool GuiBeginPanelCache(int id, Rectangle bounds, unsigned int version)
+{
+    if (guiPanelCache != NULL)
+    {
+        guiPanelCacheDepth++;
+        return true;
+    }
+
+    GuiPanelCache *cache = NULL;
+    GuiPanelCache *freeCache = NULL;
+
+    for (int i = 0; i < RAYGUI_MAX_PANEL_CACHES; i++)
+    {
+        if (guiPanelCaches[i].used && (guiPanelCaches[i].id == id))
+        {
+            cache = &guiPanelCaches[i];
+            break;
+        }
+        else if (!guiPanelCaches[i].used && (freeCache == NULL)) freeCache = &guiPanelCaches[i];
+    }
+
+    if (cache == NULL)
+    {
+        if (freeCache == NULL) return true;
+
+        cache = freeCache;
+        cache->id = id;
+        cache->used = true;
+        cache->valid = false;
+    }
+
+    int width = (int)bounds.width;
+    int height = (int)bounds.height;
+
+    if ((width <= 0) || (height <= 0)) return true;
+
+    // Render texture reloaded on panel size change
+    if ((cache->target.id == 0) || (cache->target.texture.width != width) || (cache->target.texture.height != height))
+    {
+        if (cache->target.id > 0) UnloadRenderTexture(cache->target);
+        cache->target = LoadRenderTexture(width, height);
+        cache->valid = false;
+
+        if (cache->target.id == 0) return true;
+    }
+
+    // Panel input is active on mouse input over it, dragging started on the panel keeps it active
+    // NOTE: A still mouse over the panel does not change controls drawing (touch position is kept after release)
+    Vector2 mousePosition = GetMousePosition();
+    bool mouseInput = (mousePosition.x != cache->mousePosition.x) || (mousePosition.y != cache->mousePosition.y) ||
+        IsMouseButtonDown(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_LEFT_BUTTON) || (GetMouseWheelMove() != 0.0f);
+    bool active = !guiLocked && ((mouseInput && CheckCollisionPointRec(mousePosition, bounds)) || (cache->active && IsMouseButtonDown(MOUSE_LEFT_BUTTON)));
+    unsigned int state = GetPanelCacheState();
+
+    cache->mousePosition = mousePosition;
+
+    bool render = !cache->valid || active || cache->active || (version != cache->version) || (state != cache->state) ||
+        (bounds.x != cache->bounds.x) || (bounds.y != cache->bounds.y);
+
+    if (!render)
+    {
+        DrawTextureRec(cache->target.texture, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)width, -(float)height }, RAYGUI_CLITERAL(Vector2){ bounds.x, bounds.y }, WHITE);
+        return false;
+    }
+
+    cache->valid = true;
+    cache->active = active;
+    cache->bounds = bounds;
+    cache->version = version;
+    cache->state = state;
+
+    // Panel controls are drawn in screen coordinates, translated to render texture origin
+    Camera2D camera = { 0 };
+    camera.target = RAYGUI_CLITERAL(Vector2){ bounds.x, bounds.y };
+    camera.zoom = 1.0f;
+
+    guiPanelCache = cache;
+    BeginTextureMode(cache->target);
+    ClearBackground(BLANK);
+    BeginMode2D(camera);
+
+    return true;
+}
+
+// End cached panel, panel render texture is drawn
+// NOTE: Panels are cached in screen space, cached panels must not be used inside texture mode
+void GuiEndPanelCache(void)
+{
+    if (guiPanelCacheDepth > 0)
+    {
+        guiPanelCacheDepth--;
+        return;
+    }
+
+    if (guiPanelCache == NULL) return;
+
+    GuiPanelCache *cache = guiPanelCache;
+    guiPanelCache = NULL;
+
+    EndMode2D();
+    EndTextureMode();
+
+    DrawTextureRec(cache->target.texture, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)cache->target.texture.width, -(float)cache->target.texture.height }, RAYGUI_CLITERAL(Vector2){ cache->bounds.x, cache->bounds.y }, WHITE);
+}
+
+// Unload cached panels render textures
+void GuiUnloadPanelCaches(void)
+{
+    for (int i = 0; i < RAYGUI_MAX_PANEL_CACHES; i++)
+    {
+        if (guiPanelCaches[i].target.id > 0) UnloadRenderTexture(guiPanelCaches[i].target);
+
+        GuiPanelCache cache = { 0 };
+        guiPanelCaches[i] = cache;
+    }
+
+    guiPanelCache = NULL;
+    guiPanelCacheDepth = 0;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Gui Controls Functions Definition
 //----------------------------------------------------------------------------------
@@ -3574,7 +3761,14 @@ const char *GuiIconText(int iconId, const char *text)
 #if !defined(RAYGUI_NO_RICONS)
 
 // Get full icons data pointer
-unsigned int *GuiGetIcons(void) { return guiIcons; }
+// NOTE: Data could be modified through pointer, icons atlas is rasterized again on next icon draw
+unsigned int *GuiGetIcons(void)
+{
+#if !defined(RAYGUI_STANDALONE)
+    guiIconsDirty = true;
+#endif
+    return guiIcons;
+}
 
 // Load raygui icons file (.rgi)
 // NOTE: In case nameIds are required, they can be requested with loadIconsName,
@@ -3642,6 +3836,9 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
 
             // Read icons data directly over guiIcons data array
             fread(guiIcons, iconCount*(iconSize*iconSize/32), sizeof(unsigned int), rgiFile);
+#if !defined(RAYGUI_STANDALONE)
+            guiIconsDirty = true;
+#endif
         }
 
         fclose(rgiFile);
@@ -3650,26 +3847,33 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
     return guiIconsName;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
+// Draw selected icon as one textured quad from icons atlas
+// NOTE: Icons atlas is rasterized on first draw and after icons data changes
 void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
 {
-    #define BIT_CHECK(a,b) ((a) & (1<<(b)))
+#if !defined(RAYGUI_STANDALONE)
+    if ((iconId < 0) || (iconId >= RICON_MAX_ICONS)) return;
 
-    for (int i = 0, y = 0; i < RICON_SIZE*RICON_SIZE/32; i++)
-    {
-        for (int k = 0; k < 32; k++)
-        {
-            if (BIT_CHECK(guiIcons[iconId*RICON_DATA_ELEMENTS + i], k))
-            {
-            #if !defined(RAYGUI_STANDALONE)
-                DrawRectangle(posX + (k%RICON_SIZE)*pixelSize, posY + y*pixelSize, pixelSize, pixelSize, color);
-            #endif
-            }
+    if (guiIconsDirty) UpdateIconsTexture();
 
-            if ((k == 15) || (k == 31)) y++;
-        }
-    }
+    Rectangle source = { (float)((iconId%16)*RICON_SIZE), (float)((iconId/16)*RICON_SIZE), (float)RICON_SIZE, (float)RICON_SIZE };
+    Rectangle dest = { (float)posX, (float)posY, (float)(RICON_SIZE*pixelSize), (float)(RICON_SIZE*pixelSize) };
+
+    DrawTexturePro(guiIconsTexture, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, color);
+#endif
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Unload icons atlas texture
+void GuiUnloadIconsTexture(void)
+{
+    if (guiIconsTexture.id > 0) UnloadTexture(guiIconsTexture);
+
+    Texture2D texture = { 0 };
+    guiIconsTexture = texture;
+    guiIconsDirty = true;
 }
+#endif
 
 // Get icon bit data
 // NOTE: Bit data array grouped as unsigned int (ICON_SIZE*ICON_SIZE/32 elements)
@@ -3688,6 +3892,9 @@ unsigned int *GuiGetIconData(int iconId)
 void GuiSetIconData(int iconId, unsigned int *data)
 {
     if (iconId < RICON_MAX_ICONS) memcpy(&guiIcons[iconId*RICON_DATA_ELEMENTS], data, RICON_DATA_ELEMENTS*sizeof(unsigned int));
+#if !defined(RAYGUI_STANDALONE)
+    guiIconsDirty = true;
+#endif
 }
 
 // Set icon pixel value
@@ -3698,6 +3905,9 @@ void GuiSetIconPixel(int iconId, int x, int y)
     // This logic works for any RICON_SIZE pixels icons,
     // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
     BIT_SET(guiIcons[iconId*RICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RICON_SIZE)*RICON_SIZE));
+#if !defined(RAYGUI_STANDALONE)
+    guiIconsDirty = true;
+#endif
 }
 
 // Clear icon pixel value
@@ -3708,6 +3918,9 @@ void GuiClearIconPixel(int iconId, int x, int y)
     // This logic works for any RICON_SIZE pixels icons,
     // For example, in case of 16x16 pixels, every 2 lines fit in one unsigned int data element
     BIT_CLEAR(guiIcons[iconId*RICON_DATA_ELEMENTS + y/(sizeof(unsigned int)*8/RICON_SIZE)], x + (y%(sizeof(unsigned int)*8/RICON_SIZE)*RICON_SIZE));
+#if !defined(RAYGUI_STANDALONE)
+    guiIconsDirty = true;
+#endif
 }
 
 // Check icon pixel value
@@ -3885,6 +4098,70 @@ static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor,
     }
 }
 
+#if !defined(RAYGUI_STANDALONE)
+// Get gui global state hash (state, lock, alpha, font and style), cached panels are rendered again on change
+static unsigned int GetPanelCacheState(void)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    unsigned int hash = 2166136261u;    // FNV-1a
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++) hash = (hash ^ guiStyle[i])*16777619u;
+
+    hash = (hash ^ (unsigned int)guiState)*16777619u;
+    hash = (hash ^ (unsigned int)guiLocked)*16777619u;
+    hash = (hash ^ (unsigned int)(guiAlpha*255.0f))*16777619u;
+    hash = (hash ^ guiFont.texture.id)*16777619u;
+
+    return hash;
+}
+#endif
+
+#if !defined(RAYGUI_STANDALONE) && !defined(RAYGUI_NO_RICONS)
+// Rasterize icons data into icons atlas texture (white pixels, icon bits stored as alpha)
+// NOTE: Atlas texture is updated in place if already loaded, icons are drawn by GuiDrawIcon() with point filtering
+static void UpdateIconsTexture(void)
+{
+    #define BIT_CHECK(a,b) ((a) & (1<<(b)))
+
+    Image image = { 0 };
+    image.width = 16*RICON_SIZE;
+    image.height = ((RICON_MAX_ICONS + 15)/16)*RICON_SIZE;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    image.data = RAYGUI_CALLOC(image.width*image.height*2, sizeof(unsigned char));
+
+    unsigned char *pixels = (unsigned char *)image.data;
+
+    for (int icon = 0; icon < RICON_MAX_ICONS; icon++)
+    {
+        int iconX = (icon%16)*RICON_SIZE;
+        int iconY = (icon/16)*RICON_SIZE;
+
+        for (int p = 0; p < RICON_SIZE*RICON_SIZE; p++)
+        {
+            int index = ((iconY + p/RICON_SIZE)*image.width + iconX + p%RICON_SIZE)*2;
+
+            pixels[index] = 255;
+            if (BIT_CHECK(guiIcons[icon*RICON_DATA_ELEMENTS + p/32], p%32)) pixels[index + 1] = 255;
+        }
+    }
+
+    if (guiIconsTexture.id == 0)
+    {
+        guiIconsTexture = LoadTextureFromImage(image);
+        SetTextureFilter(guiIconsTexture, TEXTURE_FILTER_POINT);
+        SetTextureWrap(guiIconsTexture, TEXTURE_WRAP_CLAMP);
+    }
+    else UpdateTexture(guiIconsTexture, image.data);
+
+    RAYGUI_FREE(image.data);
+
+    // NOTE: Rasterization is tried again on next draw if texture could not be loaded (no GPU context)
+    guiIconsDirty = (guiIconsTexture.id == 0);
+}
+#endif
+
 // Split controls text into multiple strings
 // Also check for multiple columns (required by GuiToggleGroup())
 static const char **GuiTextSplit(const char *text, int *count, int *textRow)
@@ -28,6 +28,10 @@
 *       Selected desired fileformats to be supported for loading. Some of those formats are
 *       supported by default, to remove support, just comment unrequired #define in this module
 *
+*   #define SUPPORT_AUDIO_MIXER_PROFILING
+*       Mixer thread time is accounted per audio stream and per processor (GetAudioStreamMixTime()),
+*       mixer DSP load and voices counts are always available (GetAudioMixerStats())
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -78,6 +82,7 @@
     #if !defined(EXTERNAL_CONFIG_FLAGS)
         #include "config.h"     // Defines module configuration flags
     #endif
+    #define RL_MEMORY_TAG MEMORY_TAG_AUDIO  // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
     #include "utils.h"          // Required for: fopen() Android mapping
 #endif
 
@@ -175,6 +180,7 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf(), fabsf() [Used in UpdateAudioVoiceSpatial()]
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -194,6 +200,14 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef RL_FREE
         #define RL_FREE(ptr)        free(ptr)
     #endif
+
+    // File data views are just file data on standalone mode (no file packs)
+    #define LoadFileDataView(fileName, bytesRead)   LoadFileData(fileName, bytesRead)
+    #define UnloadFileDataView(data)                RL_FREE((void *)(data))
+
+    // Profiling zones are provided by raylib utils (SUPPORT_PROFILING_ZONES)
+    #define RL_PROFILE_ZONE_BEGIN(zone, name)       (void)0
+    #define RL_PROFILE_ZONE_END(zone)               (void)0
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_OGG)
@@ -235,6 +249,13 @@ typedef struct tagBITMAPINFOHEADER {
 
     #define DR_MP3_IMPLEMENTATION
     #include "external/dr_mp3.h"        // MP3 loading functions
+
+    #if defined(SUPPORT_MUSIC_SEEK_TABLE)
+        // MP3 music decoder context, seek table points are stored after it (same allocation)
+        #define MUSIC_MP3_CONTEXT_SIZE  (sizeof(drmp3) + MUSIC_SEEK_TABLE_POINTS*sizeof(drmp3_seek_point))
+    #else
+        #define MUSIC_MP3_CONTEXT_SIZE  sizeof(drmp3)
+    #endif
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_FLAC)
@@ -247,6 +268,19 @@ typedef struct tagBITMAPINFOHEADER {
     #include "external/dr_flac.h"       // FLAC loading functions
 #endif
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>                   // Required for: NEON intrinsics [Used in MixAudioFrames(), wave conversion]
+    #define MIXING_SIMD_NEON
+    #define WAVE_SIMD_NEON
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>                  // Required for: SSE intrinsics [Used in MixAudioFrames()]
+    #define MIXING_SIMD_SSE
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in wave conversion]
+        #define WAVE_SIMD_SSE2
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -259,6 +293,18 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef AUDIO_DEVICE_SAMPLE_RATE
     #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device output sample rate
 #endif
+#ifndef AUDIO_DEVICE_PERIOD_FRAMES
+    #define AUDIO_DEVICE_PERIOD_FRAMES         0    // Device period size in frames (backend default)
+#endif
+#ifndef AUDIO_DEVICE_PERIODS
+    #define AUDIO_DEVICE_PERIODS               0    // Device periods count (backend default)
+#endif
+#ifndef AUDIO_LATE_CALLBACK_FACTOR
+    #define AUDIO_LATE_CALLBACK_FACTOR      1.5f    // Device callback interval over period duration counted as late callback
+#endif
+#ifndef AUDIO_MIXER_LOAD_WINDOW
+    #define AUDIO_MIXER_LOAD_WINDOW         0.5f    // Mixer DSP load average and peak window (in seconds)
+#endif
 
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
@@ -266,6 +312,52 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef DEFAULT_AUDIO_BUFFER_SIZE
     #define DEFAULT_AUDIO_BUFFER_SIZE       4096    // Default audio buffer size
 #endif
+#ifndef AUDIO_VOICE_MIN_VOLUME
+    #define AUDIO_VOICE_MIN_VOLUME        0.001f    // Minimum volume for a multichannel voice to be mixed (audible)
+#endif
+#ifndef MUSIC_STREAM_DEFAULT_LOOKAHEAD
+    #define MUSIC_STREAM_DEFAULT_LOOKAHEAD  0.5f    // Music stream thread default decoded data ahead of the stream (in seconds)
+#endif
+#ifndef AUDIO_SPEED_OF_SOUND
+    #define AUDIO_SPEED_OF_SOUND          343.0f    // Speed of sound for spatial voices doppler effect (world units per second)
+#endif
+#ifndef AUDIO_DOPPLER_MAX_PITCH
+    #define AUDIO_DOPPLER_MAX_PITCH         2.0f    // Spatial voices doppler pitch factor limit (and its inverse)
+#endif
+#ifndef MUSIC_SEEK_TABLE_POINTS
+    #define MUSIC_SEEK_TABLE_POINTS          256    // Maximum seek points for MP3 music streams (24 bytes per point)
+#endif
+#ifndef MUSIC_MODULE_DEFAULT_QUALITY
+    #define MUSIC_MODULE_DEFAULT_QUALITY       1    // Music modules (XM/MOD) default resampling quality: 0=nearest, 1=linear, 2=cubic
+#endif
+#ifndef MUSIC_STREAM_THREAD_SLEEP
+    #define MUSIC_STREAM_THREAD_SLEEP          5    // Music stream thread sleep time between updates (in milliseconds)
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Mixer commands queue size (must be a power of two)
+#endif
+#ifndef MAX_AUDIO_BUSES
+    #define MAX_AUDIO_BUSES                    8    // Maximum number of audio mixer buses (including master bus)
+#endif
+#ifndef AUDIO_BUS_BUFFER_FRAMES
+    #define AUDIO_BUS_BUFFER_FRAMES         1024    // Audio mixer buses block size, frames mixed per bus on every processing step
+#endif
+#ifndef AUDIO_SOUND_HEAD_FRAMES
+    #define AUDIO_SOUND_HEAD_FRAMES         4096    // Compressed sound frames decoded ahead on play (cached head)
+#endif
+#ifndef AUDIO_SOUND_HEAD_CACHE_SIZE
+    #define AUDIO_SOUND_HEAD_CACHE_SIZE  1048576    // Compressed sounds decoded heads cache size (in bytes)
+#endif
+#ifndef AUDIO_STREAM_RING_PERIODS
+    #define AUDIO_STREAM_RING_PERIODS          3    // Ring audio streams default size (in device periods), see LoadAudioStreamRing()
+#endif
+#ifndef WAVE_CONVERSION_CHUNK_SAMPLES
+    #define WAVE_CONVERSION_CHUNK_SAMPLES   1024    // Wave format conversion intermediate float buffer size (in samples)
+#endif
+
+#if defined(SUPPORT_NATIVE_FILEIO) && !defined(RAUDIO_STANDALONE)
+    #define MUSIC_FILE_STREAMS                  // Music files (WAV, FLAC, MP3) decoded from read-ahead file streams
+#endif
 
 
 //----------------------------------------------------------------------------------
@@ -304,10 +396,26 @@ typedef enum {
 // depending on whether or not data is streamed (Music vs Sound)
 typedef enum {
     AUDIO_BUFFER_USAGE_STATIC = 0,
-    AUDIO_BUFFER_USAGE_STREAM
+    AUDIO_BUFFER_USAGE_STREAM,
+    AUDIO_BUFFER_USAGE_RING         // Stream written in place through a ring buffer (single producer, single consumer)
 } AudioBufferUsage;
 
 // Audio buffer struct
+// Compressed sound decoder, sound frames are decoded by the mixer while playing
+typedef struct rAudioDecoder rAudioDecoder;
+struct rAudioDecoder {
+    Music music;                    // Music stream decoder (from memory), its stream buffer is the sound buffer
+    unsigned char *fileData;        // Compressed file data, referenced by decoder context
+    unsigned int position;          // Next frame returned by decoder
+
+    unsigned char *head;            // Sound first frames (decoded), NULL if not cached
+    unsigned int headFrames;        // Sound first frames count
+    unsigned int lastPlayed;        // Heads cache counter when last played, least recently played heads are released first
+
+    rAudioDecoder *next;            // Next compressed sound decoder on the list
+    rAudioDecoder *prev;            // Previous compressed sound decoder on the list
+};
+
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
 
@@ -324,11 +432,38 @@ struct rAudioBuffer {
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
     bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 ringWrite;            // Ring stream frames committed, only modified by the game thread
+    ma_uint32 ringRead;             // Ring stream frames consumed, only modified by the mixer thread
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
+    float frameCursorFraction;      // Frame cursor position fraction, pitched sounds linear resampling
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    int priority;                   // Sound priority for multichannel voices, higher priority voices are mixed first
+    bool isStreamEnding;            // Stream source ended, stop once queued sub-buffers are played (music stream thread)
+    float mixLevels[2];             // Channel levels used on last mix, ramped to new volume/pan (negative: not mixed yet)
+    ma_uint64 mixTime;              // Stats: total mixing time in nanoseconds, processors included (mixer thread)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    rAudioDecoder *decoder;         // Compressed sound decoder, used instead of data buffer
+    int bus;                        // Audio mixer bus the buffer is mixed into (0: master)
+#if defined(SUPPORT_FILE_PACKS)
+    const unsigned char *fileData;  // Music stream file data view (file packs), released on UnloadMusicStream()
+#endif
+#if defined(MUSIC_FILE_STREAMS)
+    FileStream *fileStream;         // Music stream file stream (read-ahead), closed on UnloadMusicStream()
+#endif
+
+    // NOTE: Fields above are owned by the mixer thread, the game thread only changes them through
+    // queued commands and keeps the state it requested here until the mixer has applied it
+    struct {
+        float volume;               // Requested volume
+        float pitch;                // Requested pitch
+        float pan;                  // Requested pan
+        bool playing;               // Requested state: AUDIO_PLAYING
+        bool paused;                // Requested state: AUDIO_PAUSED
+        int bus;                    // Requested audio mixer bus
+        ma_uint32 sequence;         // Commands queue position after the last command for this buffer
+    } request;
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -338,32 +473,184 @@ struct rAudioBuffer {
 // NOTE: Useful to apply effects to an AudioBuffer
 struct rAudioProcessor {
     AudioCallback process;          // Processor callback function
+    ma_uint64 processTime;          // Stats: total processing time in nanoseconds (mixer thread)
     rAudioProcessor *next;          // Next audio processor on the list
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Multichannel voice, played sound that is mixed using a pool channel when audible (real)
+// or only keeps playing time until a channel is available for it (virtual)
+typedef struct AudioVoice {
+    unsigned int id;                // Voice id, 0 if voice is free
+    AudioBuffer *sound;             // Sound audio buffer played by the voice (data owner)
+    int priority;                   // Voice priority
+    float volume;                   // Voice volume (sound volume multiplied by voice attenuation)
+    float pitch;                    // Voice pitch
+    float pan;                      // Voice pan
+    bool looping;                   // Voice looping
+    ma_uint32 startFrame;           // Mixer frames counter when voice started (at pitch 1.0f)
+    int channel;                    // Pool channel mixing the voice, -1 for virtual voices
+    float doppler;                  // Doppler pitch factor, 1.0f for non spatial voices (not considered by voice playing time)
+    bool spatial;                   // Voice is a 3D emitter, volume, pan and doppler computed from listener
+    float gain;                     // Spatial voice volume before distance attenuation
+    Vector3 position;               // Spatial voice emitter position
+    Vector3 velocity;               // Spatial voice emitter velocity
+    float minDistance;              // Spatial voice distance with no attenuation
+    float maxDistance;              // Spatial voice distance attenuated to silence (voice is virtual)
+} AudioVoice;
+
+// Music stream decoded by the music stream thread
+typedef struct MusicStreamSlot {
+    Music music;                    // Music stream (copy, decoder context is shared with the caller)
+    unsigned char *frames;          // Decoded frames ring buffer, kept ahead of the stream buffer
+    unsigned int frameCapacity;     // Decoded frames ring buffer size (in frames)
+    unsigned int frameRead;         // Decoded frames ring buffer read position (in frames)
+    unsigned int frameCount;        // Decoded frames available
+    unsigned int framesDecoded;     // Music frames decoded from start
+    bool decoderEnded;              // All music frames decoded, music not looping
+    void *pcm;                      // Sub-buffer frames, copied from ring buffer
+} MusicStreamSlot;
+
+// Audio mixer command types
+typedef enum {
+    AUDIO_COMMAND_TRACK = 0,        // Add buffer to the mixing list
+    AUDIO_COMMAND_UNTRACK,          // Remove buffer from the mixing list
+    AUDIO_COMMAND_PLAY,             // Play buffer (value != 0.0f keeps the frame cursor position)
+    AUDIO_COMMAND_STOP,             // Stop buffer and reset it
+    AUDIO_COMMAND_PAUSE,            // Pause buffer
+    AUDIO_COMMAND_RESUME,           // Resume buffer
+    AUDIO_COMMAND_VOLUME,           // Set buffer volume
+    AUDIO_COMMAND_PITCH,            // Set buffer pitch
+    AUDIO_COMMAND_PAN,              // Set buffer pan
+    AUDIO_COMMAND_DATA,             // Set buffer data (value != 0.0f enables looping)
+    AUDIO_COMMAND_SEEK,             // Set buffer frame cursor position
+    AUDIO_COMMAND_CALLBACK,         // Set buffer callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Add processor at the end of the buffer processors chain (bus chain if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Remove processor from the buffer processors chain (bus chain if no buffer)
+    AUDIO_COMMAND_BUS,              // Set buffer audio mixer bus
+    AUDIO_COMMAND_LOAD_BUS,         // Enable audio mixer bus mixing
+    AUDIO_COMMAND_UNLOAD_BUS,       // Disable audio mixer bus mixing, buffers routed to it go back to master bus
+    AUDIO_COMMAND_BUS_VOLUME        // Set audio mixer bus volume
+} AudioCommandType;
+
+// Audio mixer command, sent from the game thread to the mixer thread
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer
+    float value;                    // Command value (volume, pitch, pan, flags)
+    unsigned char *data;            // Command data (AUDIO_COMMAND_DATA)
+    unsigned int frames;            // Command frames: data size (AUDIO_COMMAND_DATA), cursor position (AUDIO_COMMAND_SEEK)
+    AudioCallback callback;         // Command callback (AUDIO_COMMAND_CALLBACK)
+    rAudioProcessor *processor;     // Command processor (AUDIO_COMMAND_ATTACH_PROCESSOR, AUDIO_COMMAND_DETACH_PROCESSOR)
+    int bus;                        // Command audio mixer bus (AUDIO_COMMAND_BUS...)
+} AudioCommand;
+
+// Audio mixer bus, buffers routed to the bus are mixed together and processed once before mixing into master
+// NOTE: Master bus (0) mixes directly into the device output, its processors are applied to the final mix
+typedef struct AudioBus {
+    char name[32];                  // Bus name (game thread)
+    bool loaded;                    // Bus loaded (game thread)
+    bool active;                    // Bus mixed (mixer thread)
+    float volume;                   // Bus volume (mixer thread)
+    float *frames;                  // Bus mixing buffer, AUDIO_BUS_BUFFER_FRAMES frames (not used by master bus)
+    rAudioProcessor *processor;     // Bus processors chain (mixer thread)
+} AudioBus;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        ma_uint32 framesMixed;      // Total frames mixed, only modified by the mixer thread (virtual voices timing)
+        ma_timer mixTimer;          // Mixing time timer (mixer thread)
+        ma_uint32 mixPeriods;       // Stats: device periods mixed (mixer thread)
+        ma_uint32 mixVoices;        // Stats: audio buffers mixed on last period (mixer thread)
+        ma_uint32 lastMixTime;      // Stats: last period mixing time in microseconds (mixer thread)
+        ma_uint32 mixTime;          // Stats: total mixing time in microseconds (mixer thread)
+        ma_uint32 lateCallbacks;    // Stats: device callbacks later than period interval (mixer thread)
+        ma_uint32 underruns;        // Stats: device callbacks after device buffer drained (mixer thread)
+        ma_uint32 budgetTime;       // Stats: last period mixing time budget in microseconds (mixer thread)
+        ma_uint32 loadAverage;      // Stats: DSP load average over last load window, per thousand (mixer thread)
+        ma_uint32 loadPeak;         // Stats: DSP load peak over last load window, per thousand (mixer thread)
+        double loadWindowTime;      // Current load window periods time (mixer thread)
+        double loadWindowMixTime;   // Current load window mixing time (mixer thread)
+        double loadWindowPeak;      // Current load window DSP load peak (mixer thread)
+        double lastCallbackTime;    // Last device callback time (mixer thread)
+        double bufferedTime;        // Estimated device buffered audio time (mixer thread)
+        AudioDeviceConfig config;   // Device config requested, applied on InitAudioDevice()
     } System;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE];   // Commands ring buffer (single producer, single consumer)
+        ma_uint32 head;             // Commands written, only modified by the game thread
+        ma_uint32 tail;             // Commands applied, only modified by the mixer thread
+    } Command;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
     struct {
-        unsigned int poolCounter;                               // AudioBuffer pointers pool counter
-        AudioBuffer *pool[MAX_AUDIO_BUFFER_POOL_CHANNELS];      // Multichannel AudioBuffer pointers pool
-        unsigned int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // AudioBuffer pool channels
+        unsigned int voiceCounter;                              // Voices id counter
+        AudioBuffer *pool[MAX_AUDIO_BUFFER_POOL_CHANNELS];      // Multichannel AudioBuffer pointers pool (mixed voices)
+        int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];           // Voice index using every pool channel, -1 if free
+        AudioVoice *voices;                                     // Voices playing, real and virtual (dynamic array)
+        int voiceCount;                                         // Voices array used size
+        int voiceCapacity;                                      // Voices array allocated size
     } MultiChannel;
+    struct {
+        ma_thread thread;           // Music streams decoding thread
+        ma_mutex lock;              // Music streams decoders lock, shared by game thread and decoding thread (never the mixer)
+        ma_uint32 isRunning;        // Music stream thread running, set by game thread
+        float lookahead;            // Decoded data kept ahead of music streams (in seconds)
+        MusicStreamSlot *slots;     // Music streams decoded by the thread
+        int slotCount;              // Music streams decoded by the thread count
+    } MusicThread;
+    struct {
+        AudioBus buses[MAX_AUDIO_BUSES];    // Audio mixer buses, bus 0 is master
+    } Bus;
+    struct {
+        Vector3 position;           // Listener position
+        Vector3 forward;            // Listener forward direction
+        Vector3 up;                 // Listener up direction
+        Vector3 velocity;           // Listener velocity (doppler effect)
+    } Listener;
+    struct {
+        rAudioDecoder *first;       // Compressed sounds decoders list, game thread only
+        unsigned int size;          // Decoded heads cache size (in bytes)
+        unsigned int counter;       // Played sounds counter, used to release least recently played heads
+    } SoundCache;
 } AudioData;
 
+#if defined(SUPPORT_FILEFORMAT_MP3) && defined(SUPPORT_MUSIC_SEEK_TABLE_CACHE)
+// MP3 music seek table cache file header, seek points follow it
+typedef struct MusicSeekTableHeader {
+    char id[4];                     // Seek table file identifier: "rSKT"
+    unsigned int dataSize;          // Music file size, cache is discarded if music file changes
+    unsigned int frameCount;        // Music total frames
+    unsigned int pointCount;        // Seek points count
+} MusicSeekTableHeader;
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Sound async load job data
+typedef struct SoundLoadJob {
+    char fileName[512];             // Sound file name
+    Wave wave;                      // Decoded wave (worker thread)
+    Sound sound;                    // Loaded sound (main thread)
+} SoundLoadJob;
+#endif
+
+// Waves batch format conversion data, see WaveFormatMany()
+typedef struct WaveFormatBatch {
+    Wave *waves;                    // Waves converted
+    int sampleRate;                 // Output sample rate
+    int sampleSize;                 // Output sample size (8, 16 or 32 bits)
+    int channels;                   // Output channels
+} WaveFormatBatch;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -373,7 +660,12 @@ static AudioData AUDIO = {          // Global AUDIO context
     // After some math, considering a sampleRate of 48000, a buffer refill rate of 1/60 seconds and a
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
-    .Buffer.defaultSize = 0
+    .Buffer.defaultSize = 0,
+
+    .System.config = { AUDIO_DEVICE_SAMPLE_RATE, AUDIO_DEVICE_PERIOD_FRAMES, AUDIO_DEVICE_PERIODS, false },
+
+    .Listener.forward = { 0.0f, 0.0f, -1.0f },
+    .Listener.up = { 0.0f, 1.0f, 0.0f }
 };
 
 //----------------------------------------------------------------------------------
@@ -382,6 +674,63 @@ static AudioData AUDIO = {          // Global AUDIO context
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static ma_uint32 MixAudioBuffers(float *framesOut, ma_uint32 frameCount);      // Mix playing audio buffers into master output and buses, returns buffers mixed (mixer thread)
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount);             // Apply buses processors and mix them into master output (mixer thread)
+static void ApplyAudioProcessors(rAudioProcessor *processor, float *frames, ma_uint32 frameCount); // Apply processors chain to mixing format frames (mixer thread)
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+static void AddAudioMixerTime(ma_uint64 *counter, double startTime);            // Add mixer time since start time to stats counter (mixer thread)
+#endif
+static bool IsAudioBufferInMixingFormat(AudioBuffer *buffer);                   // Check if audio buffer data does not require conversion for mixing
+static bool IsAudioBufferPitchedSound(AudioBuffer *buffer);                     // Check if audio buffer is a pitched sound in device format (linear resampling)
+static ma_uint32 ReadAudioBufferFramesPitched(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);  // Read pitched sound frames with linear resampling (mixer thread)
+
+static void ConvertWaveSamplesToFloat(float *samples, const void *data, unsigned int count, int sampleSize);    // Convert wave samples (8, 16 or 32 bit) to float
+static void ConvertFloatToWaveSamples(void *data, const float *samples, unsigned int count, int sampleSize);    // Convert float samples to wave samples (8, 16 or 32 bit), clipped
+static void ConvertWaveChannels(float *framesOut, const float *framesIn, unsigned int frameCount, int channelsIn, int channelsOut);  // Convert float frames channels (mono/stereo)
+static void FormatWavesRange(void *data, int start, int end);                  // Convert waves range format (WaveFormatMany() range callback)
+
+static void PushAudioCommand(AudioCommand command);                             // Push command into mixer queue (game thread)
+static void WaitAudioCommands(ma_uint32 maxPending);                            // Wait for mixer to apply queued commands (game thread)
+static bool IsAudioCommandPending(AudioBuffer *buffer);                         // Check if buffer has commands not yet applied (game thread)
+static void ProcessAudioCommands(void);                                         // Apply queued commands (mixer thread)
+static void ResetAudioBuffer(AudioBuffer *buffer);                              // Stop and reset audio buffer (mixer thread)
+
+static void ReadMusicStreamFrames(Music music, void *pcm, unsigned int frameCount);   // Decode music stream frames into pcm buffer
+static void SeekMusicStreamDecoder(Music music, unsigned int positionInFrames); // Seek music stream decoder to a frame position
+#if defined(SUPPORT_FILEFORMAT_MP3)
+static unsigned int LoadMusicSeekTableMP3(drmp3 *ctxMp3, const char *fileName, unsigned int dataSize);  // Load MP3 music seek table, returns music frame count
+#endif
+#if defined(MUSIC_FILE_STREAMS)
+static size_t ReadMusicFileStream(void *userData, void *buffer, size_t size);  // Music decoders read callback (file stream)
+#if defined(SUPPORT_FILEFORMAT_WAV)
+static drwav_bool32 SeekMusicFileStreamWAV(void *userData, int offset, drwav_seek_origin origin);     // WAV music decoder seek callback (file stream)
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+static drflac_bool32 SeekMusicFileStreamFLAC(void *userData, int offset, drflac_seek_origin origin);  // FLAC music decoder seek callback (file stream)
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+static drmp3_bool32 SeekMusicFileStreamMP3(void *userData, int offset, drmp3_seek_origin origin);     // MP3 music decoder seek callback (file stream)
+#endif
+#endif
+static int GetMusicStreamSlot(AudioBuffer *buffer);                             // Get music stream thread slot for a stream buffer, -1 if not registered
+static void RegisterMusicStreamSlot(Music music);                               // Register music stream to be decoded by music stream thread
+static void UnregisterMusicStreamSlot(AudioBuffer *buffer);                     // Unregister music stream from music stream thread
+static void ResetMusicStreamSlot(MusicStreamSlot *slot, unsigned int framesDecoded);  // Discard decoded frames of a music stream slot
+static void UpdateMusicStreamSlot(MusicStreamSlot *slot);                       // Decode frames ahead and refill stream buffers (music stream thread)
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data);            // Music stream thread entry point
+
+static int GetAudioVoiceIndex(int voice);                                       // Get multichannel voice index from id, -1 if not playing
+static void FreeAudioVoice(int index);                                          // Free multichannel voice, stopping its pool channel
+static void UpdateAudioVoiceSpatial(AudioVoice *voice);                         // Compute spatial voice volume, pan and doppler from listener
+
+static ma_uint32 ReadAudioDecoderFrames(AudioBuffer *buffer, void *framesOut, ma_uint32 frameCount); // Decode compressed sound frames (mixer thread)
+static void LoadAudioDecoderHead(rAudioDecoder *decoder);                       // Decode compressed sound head into heads cache (game thread)
+static void UnloadAudioDecoderHead(rAudioDecoder *decoder);                     // Release compressed sound head from heads cache (game thread)
+
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeSoundJob(void *data);                                         // Sound async load decode stage: load wave (worker thread)
+static bool UploadSoundJob(void *data);                                         // Sound async load upload stage: load sound from wave (main thread)
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -407,6 +756,7 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferBus(AudioBuffer *buffer, int bus);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -436,10 +786,17 @@ void InitAudioDevice(void)
     config.capture.pDeviceID = NULL;  // NULL for the default capture AUDIO.System.device.
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
-    config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.sampleRate = AUDIO.System.config.sampleRate;
+    config.periodSizeInFrames = AUDIO.System.config.periodFrames;
+    config.periods = AUDIO.System.config.periods;
+    config.performanceProfile = AUDIO.System.config.lowLatency? ma_performance_profile_low_latency : ma_performance_profile_conservative;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
 
+    ma_timer_init(&AUDIO.System.mixTimer);
+    AUDIO.System.lastCallbackTime = 0.0;
+    AUDIO.System.bufferedTime = 0.0;
+
     result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
     if (result != MA_SUCCESS)
     {
@@ -459,21 +816,21 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a seperate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
+    // NOTE: Mixing happens on a separate thread, to keep it real-time no lock is shared with it,
+    // any change to the audio buffers is sent through the commands queue, see PushAudioCommand()
+
+    // Init master bus, mixed directly into device output
+    strcpy(AUDIO.Bus.buses[0].name, "master");
+    AUDIO.Bus.buses[0].loaded = true;
+    AUDIO.Bus.buses[0].active = true;
+    AUDIO.Bus.buses[0].volume = 1.0f;
 
     // Init dummy audio buffers pool for multichannel sound playing
     for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
     {
         // WARNING: An empty audio buffer is created (data = 0) and added to list, AudioBuffer data is filled on PlaySoundMulti()
         AUDIO.MultiChannel.pool[i] = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        AUDIO.MultiChannel.channels[i] = -1;
     }
 
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
@@ -482,6 +839,8 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
+    TRACELOG(LOG_INFO, "    > Periods:       %d x %d frames (%s)", AUDIO.System.device.playback.internalPeriods, AUDIO.System.device.playback.internalPeriodSizeInFrames,
+        AUDIO.System.config.lowLatency? "low latency" : "conservative");
 
     AUDIO.System.isReady = true;
 }
@@ -491,6 +850,8 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
+        DisableMusicStreamThread();
+
         // Unload dummy audio buffers pool
         // WARNING: They can be pointing to already unloaded data
         for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
@@ -498,14 +859,25 @@ void CloseAudioDevice(void)
             //UnloadAudioBuffer(AUDIO.MultiChannel.pool[i]);
             if (AUDIO.MultiChannel.pool[i] != NULL)
             {
-                ma_data_converter_uninit(&AUDIO.MultiChannel.pool[i]->converter, NULL);
                 UntrackAudioBuffer(AUDIO.MultiChannel.pool[i]);
+                ma_data_converter_uninit(&AUDIO.MultiChannel.pool[i]->converter, NULL);
                 //RL_FREE(buffer->data);    // Already unloaded by UnloadSound()
                 RL_FREE(AUDIO.MultiChannel.pool[i]);
+                AUDIO.MultiChannel.pool[i] = NULL;
             }
         }
 
-        ma_mutex_uninit(&AUDIO.System.lock);
+        RL_FREE(AUDIO.MultiChannel.voices);
+        AUDIO.MultiChannel.voices = NULL;
+        AUDIO.MultiChannel.voiceCount = 0;
+        AUDIO.MultiChannel.voiceCapacity = 0;
+
+        // Unload audio mixer buses and their processors
+        for (int i = MAX_AUDIO_BUSES - 1; i >= 0; i--)
+        {
+            if (AUDIO.Bus.buses[i].loaded) UnloadAudioBus(i);
+        }
+
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
@@ -522,12 +894,91 @@ bool IsAudioDeviceReady(void)
     return AUDIO.System.isReady;
 }
 
+// Suspend audio device, mixing stops until ResumeAudioDevice() (playing sounds and music keep their position)
+void SuspendAudioDevice(void)
+{
+    if (AUDIO.System.isReady && ma_device_is_started(&AUDIO.System.device))
+    {
+        if (ma_device_stop(&AUDIO.System.device) == MA_SUCCESS) TRACELOG(LOG_INFO, "AUDIO: Device suspended");
+        else TRACELOG(LOG_WARNING, "AUDIO: Failed to suspend playback device");
+    }
+}
+
+// Resume audio device suspended by SuspendAudioDevice()
+void ResumeAudioDevice(void)
+{
+    if (AUDIO.System.isReady && !ma_device_is_started(&AUDIO.System.device))
+    {
+        if (ma_device_start(&AUDIO.System.device) == MA_SUCCESS) TRACELOG(LOG_INFO, "AUDIO: Device resumed");
+        else TRACELOG(LOG_WARNING, "AUDIO: Failed to resume playback device");
+    }
+}
+
 // Set master volume (listener)
 void SetMasterVolume(float volume)
 {
     ma_device_set_master_volume(&AUDIO.System.device, volume);
 }
 
+// Get audio mixer thread stats (periods, frames, DSP load, voices and mixing time)
+// NOTE: Every counter is read atomically but the mixer can complete a period meanwhile, stats are approximate
+AudioMixerStats GetAudioMixerStats(void)
+{
+    AudioMixerStats stats = { 0 };
+
+    stats.periods = c89atomic_load_explicit_32(&AUDIO.System.mixPeriods, c89atomic_memory_order_acquire);
+    stats.frames = c89atomic_load_explicit_32(&AUDIO.System.framesMixed, c89atomic_memory_order_acquire);
+    stats.voices = c89atomic_load_explicit_32(&AUDIO.System.mixVoices, c89atomic_memory_order_relaxed);
+    stats.lastMixTime = c89atomic_load_explicit_32(&AUDIO.System.lastMixTime, c89atomic_memory_order_relaxed);
+    stats.mixTime = c89atomic_load_explicit_32(&AUDIO.System.mixTime, c89atomic_memory_order_relaxed);
+    stats.lateCallbacks = c89atomic_load_explicit_32(&AUDIO.System.lateCallbacks, c89atomic_memory_order_relaxed);
+    stats.underruns = c89atomic_load_explicit_32(&AUDIO.System.underruns, c89atomic_memory_order_relaxed);
+
+    // DSP load: mixing time over the period duration, the time available before the device consumes the mixed period
+    stats.budgetTime = c89atomic_load_explicit_32(&AUDIO.System.budgetTime, c89atomic_memory_order_relaxed);
+    if (stats.budgetTime > 0) stats.load = (float)stats.lastMixTime/stats.budgetTime;
+    stats.loadAverage = c89atomic_load_explicit_32(&AUDIO.System.loadAverage, c89atomic_memory_order_relaxed)/1000.0f;
+    stats.loadPeak = c89atomic_load_explicit_32(&AUDIO.System.loadPeak, c89atomic_memory_order_relaxed)/1000.0f;
+
+    // Multichannel voices are owned by the game thread
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        AudioVoice *voice = &AUDIO.MultiChannel.voices[i];
+
+        if (voice->id == 0) continue;
+
+        if (voice->channel != -1) stats.activeVoices++;
+        else if (voice->volume < AUDIO_VOICE_MIN_VOLUME) stats.culledVoices++;
+        else stats.virtualVoices++;
+    }
+
+    return stats;
+}
+
+// Set audio device config: sample rate, period size, periods count and latency profile
+// NOTE: Applied on InitAudioDevice(), zero values use backend defaults (low latency profile selects smaller periods)
+void SetAudioDeviceConfig(AudioDeviceConfig config)
+{
+    if (AUDIO.System.isReady) TRACELOG(LOG_WARNING, "AUDIO: Device already initialized, config applied on next InitAudioDevice()");
+
+    AUDIO.System.config = config;
+}
+
+// Get audio device config, actual device sample rate and periods once device is initialized
+AudioDeviceConfig GetAudioDeviceConfig(void)
+{
+    AudioDeviceConfig config = AUDIO.System.config;
+
+    if (AUDIO.System.isReady)
+    {
+        config.sampleRate = AUDIO.System.device.sampleRate;
+        config.periodFrames = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+        config.periods = AUDIO.System.device.playback.internalPeriods;
+    }
+
+    return config;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -562,6 +1013,8 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
+    audioBuffer->mixLevels[0] = -1.0f;
+    audioBuffer->mixLevels[1] = -1.0f;
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
@@ -570,6 +1023,10 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->paused = false;
     audioBuffer->looping = false;
 
+    audioBuffer->request.volume = audioBuffer->volume;
+    audioBuffer->request.pitch = audioBuffer->pitch;
+    audioBuffer->request.pan = audioBuffer->pan;
+
     audioBuffer->usage = usage;
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
@@ -590,19 +1047,24 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+        UntrackAudioBuffer(buffer);     // WARNING: Waits for the mixer to stop using the buffer
         ma_data_converter_uninit(&buffer->converter, NULL);
-        UntrackAudioBuffer(buffer);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
 }
 
 // Check if an audio buffer is playing
+// NOTE: While commands for the buffer are pending on the mixer, the requested state is reported
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL)
+    {
+        if (IsAudioCommandPending(buffer)) result = (buffer->request.playing && !buffer->request.paused);
+        else result = (buffer->playing && !buffer->paused);
+    }
 
     return result;
 }
@@ -614,9 +1076,10 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PLAY, buffer, 0.0f });
+
+        buffer->request.playing = true;
+        buffer->request.paused = false;
     }
 }
 
@@ -625,49 +1088,51 @@ void StopAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        if (IsAudioBufferPlaying(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_STOP, buffer, 0.0f });
+
+        buffer->request.playing = false;
+        buffer->request.paused = false;
     }
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = true;
+    if (buffer != NULL)
+    {
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PAUSE, buffer, 0.0f });
+        buffer->request.paused = true;
+    }
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = false;
+    if (buffer != NULL)
+    {
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_RESUME, buffer, 0.0f });
+        buffer->request.paused = false;
+    }
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL)
+    {
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_VOLUME, buffer, volume });
+        buffer->request.volume = volume;
+    }
 }
 
 // Set pitch for an audio buffer
+// NOTE: Data converter sample rate is updated by the mixer, see ProcessAudioCommands()
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PITCH, buffer, pitch });
+        buffer->request.pitch = pitch;
     }
 }
 
@@ -677,41 +1142,37 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL) buffer->pan = pan;
+    if (buffer != NULL)
+    {
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PAN, buffer, pan });
+        buffer->request.pan = pan;
+    }
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
+// Set audio mixer bus for an audio buffer
+void SetAudioBufferBus(AudioBuffer *buffer, int bus)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) bus = 0;
 
-        AUDIO.Buffer.last = buffer;
+    if ((buffer != NULL) && (buffer->request.bus != bus))
+    {
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_BUS, buffer, 0.0f, NULL, 0, NULL, NULL, bus });
+        buffer->request.bus = bus;
     }
-    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Track audio buffer to linked list next position
+void TrackAudioBuffer(AudioBuffer *buffer)
+{
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_TRACK, buffer, 0.0f });
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits until the mixer has removed the buffer, so it can be safely freed after
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_UNTRACK, buffer, 0.0f });
+    WaitAudioCommands(0);
 }
 
 //----------------------------------------------------------------------------------
@@ -723,14 +1184,14 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
+    // Loading file to memory (borrowed view from file packs when possible)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
 
     // Loading wave from memory data
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnloadFileDataView(fileData);
 
     return wave;
 }
@@ -830,15 +1291,49 @@ Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 Sound LoadSound(const char *fileName)
 {
+#if defined(SUPPORT_RESOURCE_CACHE)
+    Sound cached = { 0 };
+    if (LoadCachedResource(RESOURCE_SOUND, fileName, &cached, sizeof(Sound))) return cached;
+#endif
+
     Wave wave = LoadWave(fileName);
 
     Sound sound = LoadSoundFromWave(wave);
 
     UnloadWave(wave);       // Sound is loaded, we can unload wave
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if (sound.stream.buffer != NULL) CacheResource(RESOURCE_SOUND, fileName, &sound, sizeof(Sound), (unsigned long long)(size_t)sound.stream.buffer);
+#endif
+
     return sound;
 }
 
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load sound from file asynchronously, wave is decoded on a worker thread and sound loaded on EndDrawing()
+// NOTE: Sound buffer is created on main thread, mixer commands queue only supports a single producer
+unsigned int LoadSoundAsync(const char *fileName)
+{
+    SoundLoadJob *job = (SoundLoadJob *)RL_CALLOC(1, sizeof(SoundLoadJob));
+    strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+    return SubmitAsyncJob(ASYNC_JOB_SOUND, job, DecodeSoundJob, UploadSoundJob);
+}
+
+// Get sound loaded asynchronously, waits for the load to finish and releases the load handle
+Sound GetAsyncSound(unsigned int handle)
+{
+    Sound sound = { 0 };
+
+    SoundLoadJob *job = (SoundLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_SOUND);
+    if (job != NULL) sound = job->sound;
+
+    ReleaseAsyncJob(handle);
+
+    return sound;
+}
+#endif
+
 // Load sound from wave data
 // NOTE: Wave data must be unallocated manually
 Sound LoadSoundFromWave(Wave wave)
@@ -856,6 +1351,7 @@ Sound LoadSoundFromWave(Wave wave)
         //
         // First option has been selected, format conversion is done on the loading stage.
         // The downside is that it uses more memory if the original sound is u8 or s16.
+        // Mixer reads converted data directly, pitched sounds are resampled by linear interpolation (no data converter).
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
@@ -882,6 +1378,95 @@ Sound LoadSoundFromWave(Wave wave)
     return sound;
 }
 
+// Load sound from file, keeping compressed data in memory (decoded while playing)
+Sound LoadSoundCompressed(const char *fileName)
+{
+    Sound sound = { 0 };
+
+    unsigned int dataSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        sound = LoadSoundCompressedFromMemory(GetFileExtension(fileName), fileData, dataSize);
+        UnloadFileDataView(fileData);
+    }
+
+    return sound;
+}
+
+// Load sound from compressed file data, data is copied and kept in memory (decoded while playing)
+// NOTE: Sound frames are decoded by the mixer from a memory music decoder, only the first frames
+// (head) are decoded ahead on PlaySound() and kept in a small cache to avoid start latency
+// WARNING: Compressed sounds can not be played with PlaySoundMulti() or updated with UpdateSound()
+Sound LoadSoundCompressedFromMemory(const char *fileType, const unsigned char *data, int dataSize)
+{
+    Sound sound = { 0 };
+
+    if ((data == NULL) || (dataSize <= 0)) return sound;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (strcmp(fileType, ".wav") == 0) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (strcmp(fileType, ".ogg") == 0) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if (strcmp(fileType, ".flac") == 0) { }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (strcmp(fileType, ".mp3") == 0) { }
+#endif
+    else
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Compressed data format not supported");
+        return sound;
+    }
+
+    rAudioDecoder *decoder = (rAudioDecoder *)RL_CALLOC(1, sizeof(rAudioDecoder));
+    decoder->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    memcpy(decoder->fileData, data, dataSize);
+
+    // Decoder contexts reference the file data, it must be kept while sound is loaded
+    decoder->music = LoadMusicStreamFromMemory(fileType, decoder->fileData, dataSize);
+
+    if ((decoder->music.ctxData == NULL) || (decoder->music.frameCount == 0))
+    {
+        if (decoder->music.ctxData != NULL) UnloadMusicStream(decoder->music);
+        RL_FREE(decoder->fileData);
+        RL_FREE(decoder);
+
+        TRACELOG(LOG_WARNING, "SOUND: Failed to load compressed sound data");
+        return sound;
+    }
+
+    // Music stream buffer is turned into a static buffer without data, frames are read from decoder
+    // NOTE: Buffer is not playing yet, mixer does not access it until the first play command
+    AudioBuffer *audioBuffer = decoder->music.stream.buffer;
+    RL_FREE(audioBuffer->data);
+    audioBuffer->data = NULL;
+    audioBuffer->usage = AUDIO_BUFFER_USAGE_STATIC;
+    audioBuffer->looping = false;
+    audioBuffer->sizeInFrames = decoder->music.frameCount;
+    audioBuffer->frameCursorPos = 0;
+    audioBuffer->decoder = decoder;
+
+    // Wait for buffer tracking, head can only be decoded once no commands are pending
+    WaitAudioCommands(0);
+
+    decoder->next = AUDIO.SoundCache.first;
+    if (AUDIO.SoundCache.first != NULL) AUDIO.SoundCache.first->prev = decoder;
+    AUDIO.SoundCache.first = decoder;
+
+    sound.frameCount = decoder->music.frameCount;
+    sound.stream = decoder->music.stream;
+
+    TRACELOG(LOG_INFO, "SOUND: Compressed sound loaded successfully (%i bytes, %i frames)", dataSize, sound.frameCount);
+
+    return sound;
+}
+
 // Unload wave data
 void UnloadWave(Wave wave)
 {
@@ -892,6 +1477,33 @@ void UnloadWave(Wave wave)
 // Unload sound
 void UnloadSound(Sound sound)
 {
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Cached sound is unloaded with its last reference, voices playing it keep playing
+    if ((sound.stream.buffer != NULL) && (ReleaseCachedResource(RESOURCE_SOUND, (unsigned long long)(size_t)sound.stream.buffer) > 0)) return;
+#endif
+
+    // Stop multichannel voices playing this sound data
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        if ((AUDIO.MultiChannel.voices[i].id != 0) && (AUDIO.MultiChannel.voices[i].sound == sound.stream.buffer)) FreeAudioVoice(i);
+    }
+
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->decoder != NULL))
+    {
+        rAudioDecoder *decoder = sound.stream.buffer->decoder;
+
+        if (decoder->prev != NULL) decoder->prev->next = decoder->next;
+        else AUDIO.SoundCache.first = decoder->next;
+        if (decoder->next != NULL) decoder->next->prev = decoder->prev;
+
+        // Stream buffer is untracked (waiting for mixer) before decoder is released
+        UnloadMusicStream(decoder->music);
+        UnloadAudioDecoderHead(decoder);
+        RL_FREE(decoder->fileData);
+        RL_FREE(decoder);
+        return;
+    }
+
     UnloadAudioBuffer(sound.stream.buffer);
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
@@ -899,7 +1511,11 @@ void UnloadSound(Sound sound)
 // Update sound buffer with new data
 void UpdateSound(Sound sound, const void *data, int sampleCount)
 {
-    if (sound.stream.buffer != NULL)
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->decoder != NULL))
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Compressed sound data can not be updated");
+    }
+    else if (sound.stream.buffer != NULL)
     {
         StopAudioBuffer(sound.stream.buffer);
 
@@ -1018,112 +1634,377 @@ bool ExportWaveAsCode(Wave wave, const char *fileName)
 // Play a sound
 void PlaySound(Sound sound)
 {
+    if ((sound.stream.buffer != NULL) && (sound.stream.buffer->decoder != NULL)) LoadAudioDecoderHead(sound.stream.buffer->decoder);
+
     PlayAudioBuffer(sound.stream.buffer);
 }
 
 // Play a sound in the multichannel buffer pool
 void PlaySoundMulti(Sound sound)
 {
-    int index = -1;
-    unsigned int oldAge = 0;
-    int oldIndex = -1;
+    PlaySoundMultiEx(sound, 1.0f, sound.stream.buffer->request.pan);
+}
 
-    // find the first non playing pool entry
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+// Play a sound in the multichannel buffer pool with attenuation volume and pan, returns voice id (0 if failed)
+// NOTE: Sound is mixed only if it is audible and within the MAX_AUDIO_BUFFER_POOL_CHANNELS voices with
+// higher priority and volume, otherwise it becomes a virtual voice that only keeps playing time
+int PlaySoundMultiEx(Sound sound, float volume, float pan)
+{
+    if (sound.stream.buffer == NULL) return 0;
+    if (sound.stream.buffer->decoder != NULL)
     {
-        if (AUDIO.MultiChannel.channels[i] > oldAge)
-        {
-            oldAge = AUDIO.MultiChannel.channels[i];
-            oldIndex = i;
-        }
+        TRACELOG(LOG_WARNING, "SOUND: Compressed sounds can not be played on multichannel voices");
+        return 0;
+    }
+
+    // Free finished voices before looking for an available one
+    UpdateSoundMulti();
+
+    int index = -1;
 
-        if (!IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i]))
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        if (AUDIO.MultiChannel.voices[i].id == 0)
         {
             index = i;
             break;
         }
     }
 
-    // If no none playing pool members can be index choose the oldest
     if (index == -1)
     {
-        TRACELOG(LOG_WARNING, "SOUND: Buffer pool is already full, count: %i", AUDIO.MultiChannel.poolCounter);
-
-        if (oldIndex == -1)
+        if (AUDIO.MultiChannel.voiceCount == AUDIO.MultiChannel.voiceCapacity)
         {
-            // Shouldn't be able to get here... but just in case something odd happens!
-            TRACELOG(LOG_WARNING, "SOUND: Buffer pool could not determine oldest buffer not playing sound");
-            return;
-        }
+            int capacity = (AUDIO.MultiChannel.voiceCapacity == 0)? MAX_AUDIO_BUFFER_POOL_CHANNELS*4 : AUDIO.MultiChannel.voiceCapacity*2;
+            AudioVoice *voices = (AudioVoice *)RL_REALLOC(AUDIO.MultiChannel.voices, capacity*sizeof(AudioVoice));
 
-        index = oldIndex;
+            if (voices == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SOUND: Failed to allocate memory for multichannel voices");
+                return 0;
+            }
 
-        // Just in case...
-        StopAudioBuffer(AUDIO.MultiChannel.pool[index]);
-    }
+            AUDIO.MultiChannel.voices = voices;
+            AUDIO.MultiChannel.voiceCapacity = capacity;
+        }
 
-    // Experimentally mutex lock doesn't seem to be needed this makes sense
-    // as pool[index] isn't playing and the only stuff we're copying
-    // shouldn't be changing...
+        index = AUDIO.MultiChannel.voiceCount;
+        AUDIO.MultiChannel.voiceCount++;
+    }
 
-    AUDIO.MultiChannel.channels[index] = AUDIO.MultiChannel.poolCounter;
-    AUDIO.MultiChannel.poolCounter++;
+    AUDIO.MultiChannel.voiceCounter++;
+    if (AUDIO.MultiChannel.voiceCounter == 0) AUDIO.MultiChannel.voiceCounter++;    // Id 0 is reserved for free voices
 
-    SetAudioBufferVolume(AUDIO.MultiChannel.pool[index], sound.stream.buffer->volume);
-    SetAudioBufferPitch(AUDIO.MultiChannel.pool[index], sound.stream.buffer->pitch);
-    SetAudioBufferPan(AUDIO.MultiChannel.pool[index], sound.stream.buffer->pan);
+    AudioVoice *voice = &AUDIO.MultiChannel.voices[index];
 
-    AUDIO.MultiChannel.pool[index]->looping = sound.stream.buffer->looping;
-    AUDIO.MultiChannel.pool[index]->usage = sound.stream.buffer->usage;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[0] = false;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[1] = false;
-    AUDIO.MultiChannel.pool[index]->sizeInFrames = sound.stream.buffer->sizeInFrames;
+    voice->id = AUDIO.MultiChannel.voiceCounter;
+    voice->sound = sound.stream.buffer;
+    voice->priority = sound.stream.buffer->priority;
+    voice->volume = sound.stream.buffer->request.volume*volume;
+    voice->pitch = sound.stream.buffer->request.pitch;
+    voice->pan = (pan < 0.0f)? 0.0f : ((pan > 1.0f)? 1.0f : pan);
+    voice->looping = sound.stream.buffer->looping;
+    voice->startFrame = c89atomic_load_explicit_32(&AUDIO.System.framesMixed, c89atomic_memory_order_acquire);
+    voice->channel = -1;
+    voice->doppler = 1.0f;
+    voice->spatial = false;
 
-    AUDIO.MultiChannel.pool[index]->data = sound.stream.buffer->data;       // Fill dummy track with data for playing
+    // Assign pool channels to the voices with higher priority
+    UpdateSoundMulti();
 
-    PlayAudioBuffer(AUDIO.MultiChannel.pool[index]);
+    return (int)voice->id;
 }
 
 // Stop any sound played with PlaySoundMulti()
 void StopSoundMulti(void)
 {
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++) StopAudioBuffer(AUDIO.MultiChannel.pool[i]);
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        if (AUDIO.MultiChannel.voices[i].id != 0) FreeAudioVoice(i);
+    }
+
+    AUDIO.MultiChannel.voiceCount = 0;
 }
 
-// Get number of sounds playing in the multichannel buffer pool
-int GetSoundsPlaying(void)
+// Stop a multichannel voice
+void StopSoundMultiVoice(int voice)
 {
-    int counter = 0;
+    int index = GetAudioVoiceIndex(voice);
 
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    if (index != -1)
     {
-        if (IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i])) counter++;
+        FreeAudioVoice(index);
+        UpdateSoundMulti();     // Channel could be used by a virtual voice
     }
-
-    return counter;
 }
 
-// Pause a sound
-void PauseSound(Sound sound)
+// Check if a multichannel voice is playing (mixed or virtual)
+bool IsSoundMultiVoicePlaying(int voice)
 {
-    PauseAudioBuffer(sound.stream.buffer);
-}
+    UpdateSoundMulti();
 
-// Resume a paused sound
-void ResumeSound(Sound sound)
-{
-    ResumeAudioBuffer(sound.stream.buffer);
+    return (GetAudioVoiceIndex(voice) != -1);
 }
 
-// Stop reproducing a sound
-void StopSound(Sound sound)
+// Set attenuation volume for a multichannel voice (i.e. distance attenuation)
+// NOTE: Voices below AUDIO_VOICE_MIN_VOLUME are not mixed, they are promoted again when audible
+void SetSoundMultiVolume(int voice, float volume)
 {
-    StopAudioBuffer(sound.stream.buffer);
-}
+    int index = GetAudioVoiceIndex(voice);
 
-// Check if a sound is playing
-bool IsSoundPlaying(Sound sound)
-{
+    if (index != -1)
+    {
+        AudioVoice *audioVoice = &AUDIO.MultiChannel.voices[index];
+
+        if (audioVoice->spatial)
+        {
+            // Spatial voices keep distance attenuation
+            audioVoice->gain = audioVoice->sound->request.volume*volume;
+            UpdateAudioVoiceSpatial(audioVoice);
+        }
+        else
+        {
+            audioVoice->volume = audioVoice->sound->request.volume*volume;
+
+            if (audioVoice->channel != -1) SetAudioBufferVolume(AUDIO.MultiChannel.pool[audioVoice->channel], audioVoice->volume);
+        }
+
+        UpdateSoundMulti();
+    }
+}
+
+// Set pan for a multichannel voice
+void SetSoundMultiPan(int voice, float pan)
+{
+    int index = GetAudioVoiceIndex(voice);
+
+    if (index != -1)
+    {
+        AudioVoice *audioVoice = &AUDIO.MultiChannel.voices[index];
+        audioVoice->pan = (pan < 0.0f)? 0.0f : ((pan > 1.0f)? 1.0f : pan);
+
+        if (audioVoice->channel != -1) SetAudioBufferPan(AUDIO.MultiChannel.pool[audioVoice->channel], audioVoice->pan);
+    }
+}
+
+// Set sound priority for multichannel voices, higher priority voices are mixed first (default: 0)
+void SetSoundPriority(Sound sound, int priority)
+{
+    if (sound.stream.buffer != NULL) sound.stream.buffer->priority = priority;
+}
+
+// Update multichannel voices: free finished voices and assign pool channels to the
+// audible voices with higher priority, demoting the others to virtual voices
+// NOTE: Should be called once per frame to promote virtual voices when pool channels get available
+void UpdateSoundMulti(void)
+{
+    if (!AUDIO.System.isReady) return;
+
+    ma_uint32 framesMixed = c89atomic_load_explicit_32(&AUDIO.System.framesMixed, c89atomic_memory_order_acquire);
+
+    // Free finished voices
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        AudioVoice *voice = &AUDIO.MultiChannel.voices[i];
+
+        if (voice->id == 0) continue;
+
+        if (voice->channel != -1)
+        {
+            if (!IsAudioBufferPlaying(AUDIO.MultiChannel.pool[voice->channel])) FreeAudioVoice(i);
+        }
+        else if (!voice->looping && ((float)(framesMixed - voice->startFrame)*voice->pitch >= (float)voice->sound->sizeInFrames)) FreeAudioVoice(i);
+    }
+
+    // Shrink voices array used size, trailing voices are free
+    while ((AUDIO.MultiChannel.voiceCount > 0) && (AUDIO.MultiChannel.voices[AUDIO.MultiChannel.voiceCount - 1].id == 0)) AUDIO.MultiChannel.voiceCount--;
+
+    // Select the audible voices to mix, ordered by priority and volume
+    // NOTE: Voices already mixed are kept on draw, avoiding channels swapping between equal voices
+    int selected[MAX_AUDIO_BUFFER_POOL_CHANNELS] = { 0 };
+    int selectedCount = 0;
+
+    for (int n = 0; n < MAX_AUDIO_BUFFER_POOL_CHANNELS; n++)
+    {
+        int best = -1;
+
+        for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+        {
+            AudioVoice *voice = &AUDIO.MultiChannel.voices[i];
+
+            if ((voice->id == 0) || (voice->volume < AUDIO_VOICE_MIN_VOLUME)) continue;
+
+            bool isSelected = false;
+            for (int k = 0; k < selectedCount; k++) if (selected[k] == i) { isSelected = true; break; }
+            if (isSelected) continue;
+
+            if (best == -1) best = i;
+            else
+            {
+                AudioVoice *bestVoice = &AUDIO.MultiChannel.voices[best];
+
+                if (voice->priority != bestVoice->priority) { if (voice->priority > bestVoice->priority) best = i; }
+                else if (voice->volume != bestVoice->volume) { if (voice->volume > bestVoice->volume) best = i; }
+                else if ((voice->channel != -1) && (bestVoice->channel == -1)) best = i;
+            }
+        }
+
+        if (best == -1) break;
+
+        selected[selectedCount] = best;
+        selectedCount++;
+    }
+
+    // Demote mixed voices not selected to virtual voices
+    for (int c = 0; c < MAX_AUDIO_BUFFER_POOL_CHANNELS; c++)
+    {
+        int index = AUDIO.MultiChannel.channels[c];
+
+        if (index == -1) continue;
+
+        bool isSelected = false;
+        for (int k = 0; k < selectedCount; k++) if (selected[k] == index) { isSelected = true; break; }
+
+        if (!isSelected)
+        {
+            StopAudioBuffer(AUDIO.MultiChannel.pool[c]);
+            AUDIO.MultiChannel.voices[index].channel = -1;
+            AUDIO.MultiChannel.channels[c] = -1;
+        }
+    }
+
+    // Promote selected virtual voices to the free pool channels
+    for (int k = 0; k < selectedCount; k++)
+    {
+        AudioVoice *voice = &AUDIO.MultiChannel.voices[selected[k]];
+
+        if (voice->channel != -1) continue;
+
+        int channel = -1;
+        for (int c = 0; c < MAX_AUDIO_BUFFER_POOL_CHANNELS; c++) if (AUDIO.MultiChannel.channels[c] == -1) { channel = c; break; }
+        if ((channel == -1) || (AUDIO.MultiChannel.pool[channel] == NULL)) break;
+
+        AudioBuffer *buffer = AUDIO.MultiChannel.pool[channel];
+
+        // Voice continues from its virtual playing position
+        ma_uint32 position = (ma_uint32)((float)(framesMixed - voice->startFrame)*voice->pitch);
+        if (voice->looping && (voice->sound->sizeInFrames > 0)) position %= voice->sound->sizeInFrames;
+
+        // NOTE: Pool channel was stopped, commands are applied in order before it is mixed again
+        SetAudioBufferVolume(buffer, voice->volume);
+        SetAudioBufferPitch(buffer, voice->pitch*voice->doppler);
+        SetAudioBufferPan(buffer, voice->pan);
+        SetAudioBufferBus(buffer, voice->sound->request.bus);
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_DATA, buffer, voice->looping? 1.0f : 0.0f, voice->sound->data, voice->sound->sizeInFrames });
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_SEEK, buffer, 0.0f, NULL, position });
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PLAY, buffer, 1.0f });     // Keep cursor position
+
+        buffer->request.playing = true;
+        buffer->request.paused = false;
+
+        voice->channel = channel;
+        AUDIO.MultiChannel.channels[channel] = selected[k];
+    }
+}
+
+// Play a sound in the multichannel buffer pool at 3D position, returns spatial voice id (0 if failed)
+// NOTE: Volume is attenuated from minDistance to silence at maxDistance, voices out of range are virtual (not mixed)
+int PlaySoundMulti3D(Sound sound, Vector3 position, float minDistance, float maxDistance)
+{
+    // NOTE: Voice starts silent (virtual), it is promoted once its attenuation is computed
+    int id = PlaySoundMultiEx(sound, 0.0f, 0.5f);
+    int index = GetAudioVoiceIndex(id);
+
+    if (index != -1)
+    {
+        AudioVoice *voice = &AUDIO.MultiChannel.voices[index];
+
+        voice->spatial = true;
+        voice->gain = sound.stream.buffer->request.volume;
+        voice->position = position;
+        voice->velocity = (Vector3){ 0.0f, 0.0f, 0.0f };
+        voice->minDistance = (minDistance > 0.0f)? minDistance : 0.0f;
+        voice->maxDistance = (maxDistance > voice->minDistance)? maxDistance : voice->minDistance;
+
+        UpdateAudioVoiceSpatial(voice);
+        UpdateSoundMulti();
+    }
+
+    return id;
+}
+
+// Set 3D audio listener position, orientation and velocity
+// NOTE: Spatial voices are updated with the new listener on next UpdateAudioEmitters() call
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity)
+{
+    AUDIO.Listener.position = position;
+    AUDIO.Listener.forward = forward;
+    AUDIO.Listener.up = up;
+    AUDIO.Listener.velocity = velocity;
+}
+
+// Update spatial voices emitters positions and compute all spatial voices attenuation, pan and doppler
+// NOTE: Expected once per frame, mixed voices only get mixer commands when their values change,
+// voices attenuated to silence become virtual and free their pool channel for audible voices
+void UpdateAudioEmitters(const AudioEmitter *emitters, int count)
+{
+    for (int i = 0; (emitters != NULL) && (i < count); i++)
+    {
+        int index = GetAudioVoiceIndex(emitters[i].voice);
+
+        if ((index != -1) && AUDIO.MultiChannel.voices[index].spatial)
+        {
+            AUDIO.MultiChannel.voices[index].position = emitters[i].position;
+            AUDIO.MultiChannel.voices[index].velocity = emitters[i].velocity;
+        }
+    }
+
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        AudioVoice *voice = &AUDIO.MultiChannel.voices[i];
+
+        if ((voice->id != 0) && voice->spatial) UpdateAudioVoiceSpatial(voice);
+    }
+
+    UpdateSoundMulti();
+}
+
+// Get number of sounds playing in the multichannel buffer pool (mixed and virtual voices)
+int GetSoundsPlaying(void)
+{
+    int counter = 0;
+
+    UpdateSoundMulti();
+
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        if (AUDIO.MultiChannel.voices[i].id != 0) counter++;
+    }
+
+    return counter;
+}
+
+// Pause a sound
+void PauseSound(Sound sound)
+{
+    PauseAudioBuffer(sound.stream.buffer);
+}
+
+// Resume a paused sound
+void ResumeSound(Sound sound)
+{
+    ResumeAudioBuffer(sound.stream.buffer);
+}
+
+// Stop reproducing a sound
+void StopSound(Sound sound)
+{
+    StopAudioBuffer(sound.stream.buffer);
+}
+
+// Check if a sound is playing
+bool IsSoundPlaying(Sound sound)
+{
     return IsAudioBufferPlaying(sound.stream.buffer);
 }
 
@@ -1146,8 +2027,65 @@ void SetSoundPan(Sound sound, float pan)
 }
 
 // Convert wave data to desired format
+// NOTE: Sample format and mono/stereo conversions at same sample rate use SIMD kernels (in place if output frames
+// are not bigger), resampling and other channel layouts are converted by miniaudio
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
+    if ((wave->data == NULL) || (wave->frameCount == 0)) return;
+    if ((wave->sampleRate == (unsigned int)sampleRate) && (wave->sampleSize == (unsigned int)sampleSize) && (wave->channels == (unsigned int)channels)) return;
+
+    bool validSizes = ((wave->sampleSize == 8) || (wave->sampleSize == 16) || (wave->sampleSize == 32)) && ((sampleSize == 8) || (sampleSize == 16) || (sampleSize == 32));
+    bool validChannels = (wave->channels == (unsigned int)channels) || ((wave->channels <= 2) && (channels <= 2));
+
+    if (validSizes && validChannels && (channels > 0) && (wave->sampleRate == (unsigned int)sampleRate))
+    {
+        unsigned int frameSizeIn = wave->channels*wave->sampleSize/8;
+        unsigned int frameSizeOut = channels*sampleSize/8;
+
+        // NOTE: Converted chunk is read before it is written, output never overwrites frames not yet read
+        bool inPlace = (frameSizeOut <= frameSizeIn);
+        unsigned char *data = inPlace? (unsigned char *)wave->data : (unsigned char *)RL_MALLOC(wave->frameCount*frameSizeOut);
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "WAVE: Failed to allocate memory for format conversion");
+            return;
+        }
+
+        float samplesIn[WAVE_CONVERSION_CHUNK_SAMPLES];
+        float samplesOut[WAVE_CONVERSION_CHUNK_SAMPLES];
+        unsigned int chunkFrames = WAVE_CONVERSION_CHUNK_SAMPLES/((wave->channels > (unsigned int)channels)? wave->channels : (unsigned int)channels);
+
+        for (unsigned int frame = 0; frame < wave->frameCount; frame += chunkFrames)
+        {
+            unsigned int frameCount = ((wave->frameCount - frame) < chunkFrames)? (wave->frameCount - frame) : chunkFrames;
+            const float *samples = samplesIn;
+
+            ConvertWaveSamplesToFloat(samplesIn, (unsigned char *)wave->data + frame*frameSizeIn, frameCount*wave->channels, wave->sampleSize);
+
+            if (wave->channels != (unsigned int)channels)
+            {
+                ConvertWaveChannels(samplesOut, samplesIn, frameCount, wave->channels, channels);
+                samples = samplesOut;
+            }
+
+            ConvertFloatToWaveSamples(data + frame*frameSizeOut, samples, frameCount*channels, sampleSize);
+        }
+
+        // Shrink converted data kept in place
+        if (inPlace && (frameSizeOut < frameSizeIn))
+        {
+            unsigned char *shrunk = (unsigned char *)RL_REALLOC(data, wave->frameCount*frameSizeOut);
+            if (shrunk != NULL) data = shrunk;
+        }
+
+        if (!inPlace) RL_FREE(wave->data);
+        wave->data = data;
+        wave->sampleSize = sampleSize;
+        wave->channels = channels;
+        return;
+    }
+
     ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
     ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
 
@@ -1166,6 +2104,7 @@ void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
     if (frameCount == 0)
     {
         TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
+        RL_FREE(data);
         return;
     }
 
@@ -1177,6 +2116,21 @@ void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
     wave->data = data;
 }
 
+// Convert waves data to desired format
+// NOTE: Waves are converted in parallel on job system workers (calling thread included), waits for completion
+void WaveFormatMany(Wave *waves, int count, int sampleRate, int sampleSize, int channels)
+{
+    if ((waves == NULL) || (count <= 0)) return;
+
+    WaveFormatBatch batch = { waves, sampleRate, sampleSize, channels };
+
+#if defined(RAUDIO_STANDALONE)
+    FormatWavesRange(&batch, 0, count);
+#else
+    ParallelFor(FormatWavesRange, &batch, count, 1);
+#endif
+}
+
 // Copy a wave to a new wave
 Wave WaveCopy(Wave wave)
 {
@@ -1198,20 +2152,21 @@ Wave WaveCopy(Wave wave)
     return newWave;
 }
 
-// Crop a wave to defined samples range
-// NOTE: Security check in case of out-of-range
-void WaveCrop(Wave *wave, int initSample, int finalSample)
+// Crop a wave to defined frames range
+// NOTE: Frames are moved to the start of wave data, data is shrunk in place (no copy)
+void WaveCrop(Wave *wave, int initFrame, int finalFrame)
 {
-    if ((initSample >= 0) && (initSample < finalSample) && ((unsigned int)finalSample < (wave->frameCount*wave->channels)))
+    if ((initFrame >= 0) && (initFrame < finalFrame) && ((unsigned int)finalFrame <= wave->frameCount))
     {
-        int sampleCount = finalSample - initSample;
+        unsigned int frameSize = wave->channels*wave->sampleSize/8;
+        unsigned int frameCount = finalFrame - initFrame;
 
-        void *data = RL_MALLOC(sampleCount*wave->sampleSize/8);
+        if (initFrame > 0) memmove(wave->data, (unsigned char *)wave->data + initFrame*frameSize, frameCount*frameSize);
 
-        memcpy(data, (unsigned char *)wave->data + (initSample*wave->channels*wave->sampleSize/8), sampleCount*wave->sampleSize/8);
+        void *data = RL_REALLOC(wave->data, frameCount*frameSize);
+        if (data != NULL) wave->data = data;
 
-        RL_FREE(wave->data);
-        wave->data = data;
+        wave->frameCount = frameCount;
     }
     else TRACELOG(LOG_WARNING, "WAVE: Crop range out of bounds");
 }
@@ -1221,16 +2176,11 @@ void WaveCrop(Wave *wave, int initSample, int finalSample)
 // NOTE 2: Sample data allocated should be freed with UnloadWaveSamples()
 float *LoadWaveSamples(Wave wave)
 {
-    float *samples = (float *)RL_MALLOC(wave.frameCount*wave.channels*sizeof(float));
-
     // NOTE: sampleCount is the total number of interlaced samples (including channels)
+    unsigned int sampleCount = wave.frameCount*wave.channels;
+    float *samples = (float *)RL_MALLOC(sampleCount*sizeof(float));
 
-    for (unsigned int i = 0; i < wave.frameCount*wave.channels; i++)
-    {
-        if (wave.sampleSize == 8) samples[i] = (float)(((unsigned char *)wave.data)[i] - 127)/256.0f;
-        else if (wave.sampleSize == 16) samples[i] = (float)(((short *)wave.data)[i])/32767.0f;
-        else if (wave.sampleSize == 32) samples[i] = ((float *)wave.data)[i];
-    }
+    if (samples != NULL) ConvertWaveSamplesToFloat(samples, wave.data, sampleCount, wave.sampleSize);
 
     return samples;
 }
@@ -1250,13 +2200,41 @@ Music LoadMusicStream(const char *fileName)
 {
     Music music = { 0 };
     bool musicLoaded = false;
+#if defined(MUSIC_FILE_STREAMS)
+    FileStream *fileStream = NULL;      // WAV, FLAC and MP3 decoders read file ahead, other decoders read file directly
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+    // Music provided by a mounted file pack is streamed from a file data view, kept until UnloadMusicStream()
+    if (IsFilePacked(fileName))
+    {
+        unsigned int dataSize = 0;
+        const unsigned char *data = LoadFileDataView(fileName, &dataSize);
+
+        if (data != NULL)
+        {
+            music = LoadMusicStreamFromMemory(GetFileExtension(fileName), data, dataSize);
+
+            // NOTE: Module formats (XM, MOD) copy data on load, other formats read it while playing
+            if ((music.ctxData != NULL) && (music.ctxType != MUSIC_MODULE_XM) && (music.ctxType != MUSIC_MODULE_MOD)) music.stream.buffer->fileData = data;
+            else UnloadFileDataView(data);
+        }
+
+        return music;
+    }
+#endif
 
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (IsFileExtension(fileName, ".wav"))
     {
         drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
+    #if defined(MUSIC_FILE_STREAMS)
+        fileStream = OpenFileStream(fileName);
+        bool success = (fileStream != NULL) && drwav_init(ctxWav, ReadMusicFileStream, SeekMusicFileStreamWAV, fileStream, NULL);
+    #else
         bool success = drwav_init_file(ctxWav, fileName, NULL);
+    #endif
 
         music.ctxType = MUSIC_AUDIO_WAV;
         music.ctxData = ctxWav;
@@ -1298,7 +2276,12 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".flac"))
     {
         music.ctxType = MUSIC_AUDIO_FLAC;
+    #if defined(MUSIC_FILE_STREAMS)
+        fileStream = OpenFileStream(fileName);
+        music.ctxData = (fileStream != NULL)? drflac_open(ReadMusicFileStream, SeekMusicFileStreamFLAC, fileStream, NULL) : NULL;
+    #else
         music.ctxData = drflac_open_file(fileName, NULL);
+    #endif
 
         if (music.ctxData != NULL)
         {
@@ -1314,8 +2297,13 @@ Music LoadMusicStream(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_MP3)
     else if (IsFileExtension(fileName, ".mp3"))
     {
-        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
+        drmp3 *ctxMp3 = RL_CALLOC(1, MUSIC_MP3_CONTEXT_SIZE);
+    #if defined(MUSIC_FILE_STREAMS)
+        fileStream = OpenFileStream(fileName);
+        int result = (fileStream != NULL) && drmp3_init(ctxMp3, ReadMusicFileStream, SeekMusicFileStreamMP3, fileStream, NULL);
+    #else
         int result = drmp3_init_file(ctxMp3, fileName, NULL);
+    #endif
 
         music.ctxType = MUSIC_AUDIO_MP3;
         music.ctxData = ctxMp3;
@@ -1323,7 +2311,7 @@ Music LoadMusicStream(const char *fileName)
         if (result > 0)
         {
             music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
-            music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+            music.frameCount = LoadMusicSeekTableMP3(ctxMp3, fileName, 0);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
         }
@@ -1341,6 +2329,7 @@ Music LoadMusicStream(const char *fileName)
         if (result == 0)    // XM AUDIO.System.context created successfully
         {
             jar_xm_set_max_loop_count(ctxXm, 0);    // Set infinite number of loops
+            jar_xm_set_interpolation(ctxXm, MUSIC_MODULE_DEFAULT_QUALITY);
 
             unsigned int bits = 32;
             if (AUDIO_DEVICE_FORMAT == ma_format_s16) bits = 16;
@@ -1360,6 +2349,7 @@ Music LoadMusicStream(const char *fileName)
     {
         jar_mod_context_t *ctxMod = RL_CALLOC(1, sizeof(jar_mod_context_t));
         jar_mod_init(ctxMod);
+        jar_mod_setinterpolation(ctxMod, MUSIC_MODULE_DEFAULT_QUALITY);
         int result = jar_mod_load_file(ctxMod, fileName);
 
         music.ctxType = MUSIC_MODULE_MOD;
@@ -1404,6 +2394,15 @@ Music LoadMusicStream(const char *fileName)
     }
     else
     {
+    #if defined(MUSIC_FILE_STREAMS)
+        // File stream is kept while decoder is open
+        if (music.stream.buffer != NULL)
+        {
+            music.stream.buffer->fileStream = fileStream;
+            fileStream = NULL;
+        }
+    #endif
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "FILEIO: [%s] Music file loaded successfully", fileName);
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
@@ -1412,6 +2411,10 @@ Music LoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
     }
 
+#if defined(MUSIC_FILE_STREAMS)
+    CloseFileStream(fileStream);        // Decoder failed or music stream not loaded
+#endif
+
     return music;
 }
 
@@ -1465,7 +2468,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
 #if defined(SUPPORT_FILEFORMAT_MP3)
     else if (strcmp(fileType, ".mp3") == 0)
     {
-        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
+        drmp3 *ctxMp3 = RL_CALLOC(1, MUSIC_MP3_CONTEXT_SIZE);
         int success = drmp3_init_memory(ctxMp3, (const void*)data, dataSize, NULL);
 
         music.ctxType = MUSIC_AUDIO_MP3;
@@ -1474,7 +2477,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         if (success)
         {
             music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
-            music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+            music.frameCount = LoadMusicSeekTableMP3(ctxMp3, NULL, (unsigned int)dataSize);
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
         }
@@ -1511,6 +2514,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         {
             music.ctxType = MUSIC_MODULE_XM;
             jar_xm_set_max_loop_count(ctxXm, 0);    // Set infinite number of loops
+            jar_xm_set_interpolation(ctxXm, MUSIC_MODULE_DEFAULT_QUALITY);
 
             unsigned int bits = 32;
             if (AUDIO_DEVICE_FORMAT == ma_format_s16) bits = 16;
@@ -1534,6 +2538,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
         int result = 0;
 
         jar_mod_init(ctxMod);
+        jar_mod_setinterpolation(ctxMod, MUSIC_MODULE_DEFAULT_QUALITY);
 
         // Copy data to allocated memory for default UnloadMusicStream
         unsigned char *newData = (unsigned char *)RL_MALLOC(dataSize);
@@ -1606,6 +2611,14 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_FILE_PACKS)
+    const unsigned char *fileData = (music.stream.buffer != NULL)? music.stream.buffer->fileData : NULL;
+#endif
+#if defined(MUSIC_FILE_STREAMS)
+    FileStream *fileStream = (music.stream.buffer != NULL)? music.stream.buffer->fileStream : NULL;
+#endif
+
+    UnregisterMusicStreamSlot(music.stream.buffer);
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1630,6 +2643,13 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+#if defined(SUPPORT_FILE_PACKS)
+    UnloadFileDataView(fileData);       // Released once decoders are closed
+#endif
+#if defined(MUSIC_FILE_STREAMS)
+    CloseFileStream(fileStream);
+#endif
 }
 
 // Start music playing (open stream)
@@ -1641,9 +2661,13 @@ void PlayMusicStream(Music music)
         // This is a hack for this section of code in UpdateMusicStream()
         // NOTE: In case window is minimized, music stream is stopped, just make sure to
         // play again on window restore: if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = music.stream.buffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        music.stream.buffer->frameCursorPos = frameCursorPos;
+        // Music stream thread decodes all the music streams played while it is running
+        if (c89atomic_load_32(&AUDIO.MusicThread.isRunning)) RegisterMusicStreamSlot(music);
+
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_PLAY, music.stream.buffer, 1.0f });  // Keep cursor position
+
+        music.stream.buffer->request.playing = true;
+        music.stream.buffer->request.paused = false;
     }
 }
 
@@ -1662,29 +2686,23 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
-    StopAudioStream(music.stream);
+    int slot = GetMusicStreamSlot(music.stream.buffer);
 
-    switch (music.ctxType)
+    if (slot != -1)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        // Decoder is owned by the music stream thread, decoded frames ahead are discarded
+        ma_mutex_lock(&AUDIO.MusicThread.lock);
+        {
+            StopAudioStream(music.stream);
+            SeekMusicStreamDecoder(music, 0);
+            ResetMusicStreamSlot(&AUDIO.MusicThread.slots[slot], 0);
+        }
+        ma_mutex_unlock(&AUDIO.MusicThread.lock);
+    }
+    else
+    {
+        StopAudioStream(music.stream);
+        SeekMusicStreamDecoder(music, 0);
     }
 }
 
@@ -1696,30 +2714,28 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
-#endif
-        default: break;
-    }
+    int slot = GetMusicStreamSlot(music.stream.buffer);
+    if (slot != -1) ma_mutex_lock(&AUDIO.MusicThread.lock);
+
+    SeekMusicStreamDecoder(music, positionInFrames);
 
     music.stream.buffer->framesProcessed = positionInFrames;
+
+    if (slot != -1)
+    {
+        ResetMusicStreamSlot(&AUDIO.MusicThread.slots[slot], positionInFrames);
+        ma_mutex_unlock(&AUDIO.MusicThread.lock);
+    }
 }
 
 // Update (re-fill) music buffers if data already processed
+// NOTE: Not required for music streams decoded by the music stream thread, see EnableMusicStreamThread()
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
+    if (GetMusicStreamSlot(music.stream.buffer) != -1) return;   // Music stream updated by music stream thread
+
+    RL_PROFILE_ZONE_BEGIN(zone, "UpdateMusicStream");
 
     bool streamEnding = false;
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1738,59 +2754,7 @@ void UpdateMusicStream(Music music)
         if (framesLeft >= subBufferSizeInFrames) frameCountToStream = subBufferSizeInFrames;
         else frameCountToStream = framesLeft;
 
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                // NOTE: Returns the number of samples to process (not required)
-                if (music.stream.sampleSize == 16) drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountToStream, (short *)pcm);
-                else if (music.stream.sampleSize == 32) drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountToStream, (float *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
-                stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, frameCountToStream*music.stream.channels);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                // NOTE: Returns the number of samples to process (not required)
-                drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountToStream*music.stream.channels, (short *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountToStream, (float *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcm, frameCountToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, frameCountToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcm, frameCountToStream);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, frameCountToStream, 0);
-            } break;
-        #endif
-            default: break;
-        }
+        ReadMusicStreamFrames(music, pcm, frameCountToStream);
 
         UpdateAudioStream(music.stream, pcm, frameCountToStream);
 
@@ -1818,6 +2782,8 @@ void UpdateMusicStream(Music music)
         // just make sure to play again on window restore
         if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
     }
+
+    RL_PROFILE_ZONE_END(zone);
 }
 
 // Check if any music is playing
@@ -1844,15 +2810,40 @@ void SetMusicPan(Music music, float pan)
     SetAudioBufferPan(music.stream.buffer, pan);
 }
 
-// Get music time length (in seconds)
-float GetMusicTimeLength(Music music)
+// Set music module (XM/MOD) resampling quality
+// NOTE: Inactive module channels are never resampled, quality only affects playing channels cost
+void SetMusicQuality(Music music, int quality)
 {
-    float totalSeconds = 0.0f;
+    if (quality < 0) quality = 0;
+    else if (quality > 2) quality = 2;
 
-    totalSeconds = (float)music.frameCount/music.stream.sampleRate;
-
-    return totalSeconds;
-}
+    // Module could be rendering on music stream thread
+    int slot = GetMusicStreamSlot(music.stream.buffer);
+    if (slot != -1) ma_mutex_lock(&AUDIO.MusicThread.lock);
+
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_set_interpolation((jar_xm_context_t *)music.ctxData, (uint16_t)quality); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_setinterpolation((jar_mod_context_t *)music.ctxData, quality); break;
+#endif
+        default: break;
+    }
+
+    if (slot != -1) ma_mutex_unlock(&AUDIO.MusicThread.lock);
+}
+
+// Get music time length (in seconds)
+float GetMusicTimeLength(Music music)
+{
+    float totalSeconds = 0.0f;
+
+    totalSeconds = (float)music.frameCount/music.stream.sampleRate;
+
+    return totalSeconds;
+}
 
 // Get current music time played (in seconds)
 float GetMusicTimePlayed(Music music)
@@ -1865,7 +2856,10 @@ float GetMusicTimePlayed(Music music)
         {
             uint64_t framesPlayed = 0;
 
+            int slot = GetMusicStreamSlot(music.stream.buffer);
+            if (slot != -1) ma_mutex_lock(&AUDIO.MusicThread.lock);
             jar_xm_get_position(music.ctxData, NULL, NULL, NULL, &framesPlayed);
+            if (slot != -1) ma_mutex_unlock(&AUDIO.MusicThread.lock);
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
@@ -1880,6 +2874,56 @@ float GetMusicTimePlayed(Music music)
     return secondsPlayed;
 }
 
+// Enable music stream thread: all music streams played are decoded on a background thread,
+// keeping lookahead seconds of decoded data ahead of the stream, UpdateMusicStream() is not required
+void EnableMusicStreamThread(float lookahead)
+{
+    if (c89atomic_load_32(&AUDIO.MusicThread.isRunning)) return;
+
+    if (ma_mutex_init(&AUDIO.MusicThread.lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create mutex for music stream thread");
+        return;
+    }
+
+    AUDIO.MusicThread.lookahead = (lookahead > 0.0f)? lookahead : MUSIC_STREAM_DEFAULT_LOOKAHEAD;
+    c89atomic_store_32(&AUDIO.MusicThread.isRunning, 1);
+
+    if (ma_thread_create(&AUDIO.MusicThread.thread, ma_thread_priority_normal, 0, MusicStreamThread, NULL, NULL) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music stream thread");
+        c89atomic_store_32(&AUDIO.MusicThread.isRunning, 0);
+        ma_mutex_uninit(&AUDIO.MusicThread.lock);
+        return;
+    }
+
+    TRACELOG(LOG_INFO, "STREAM: Music stream thread started (lookahead: %.2f s)", AUDIO.MusicThread.lookahead);
+}
+
+// Disable music stream thread, music streams must be updated again with UpdateMusicStream()
+void DisableMusicStreamThread(void)
+{
+    if (!c89atomic_load_32(&AUDIO.MusicThread.isRunning)) return;
+
+    c89atomic_store_32(&AUDIO.MusicThread.isRunning, 0);
+    ma_thread_wait(&AUDIO.MusicThread.thread);
+
+    for (int i = 0; i < AUDIO.MusicThread.slotCount; i++)
+    {
+        RL_FREE(AUDIO.MusicThread.slots[i].frames);
+        RL_FREE(AUDIO.MusicThread.slots[i].pcm);
+        AUDIO.MusicThread.slots[i].music.stream.buffer->isStreamEnding = false;
+    }
+
+    RL_FREE(AUDIO.MusicThread.slots);
+    AUDIO.MusicThread.slots = NULL;
+    AUDIO.MusicThread.slotCount = 0;
+
+    ma_mutex_uninit(&AUDIO.MusicThread.lock);
+
+    TRACELOG(LOG_INFO, "STREAM: Music stream thread stopped");
+}
+
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -1912,6 +2956,89 @@ AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, un
     return stream;
 }
 
+// Load ring audio stream, written in place with AcquireAudioStreamWrite()/CommitAudioStreamWrite()
+// NOTE: Ring size sets the maximum latency, frames are mixed as soon as committed (0: AUDIO_STREAM_RING_PERIODS device periods)
+AudioStream LoadAudioStreamRing(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int frameCount)
+{
+    AudioStream stream = { 0 };
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+
+    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    // Ring must keep at least one device period, converted to stream sample rate
+    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    if (AUDIO.System.device.sampleRate > 0) periodSize = (unsigned int)((ma_uint64)periodSize*sampleRate/AUDIO.System.device.sampleRate);
+
+    if (frameCount == 0) frameCount = periodSize*AUDIO_STREAM_RING_PERIODS;
+    if (frameCount < periodSize) frameCount = periodSize;
+
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, frameCount, AUDIO_BUFFER_USAGE_RING);
+
+    if (stream.buffer != NULL)
+    {
+        stream.buffer->looping = true;    // Always loop for streaming buffers
+        TRACELOG(LOG_INFO, "STREAM: Initialized ring successfully (%i Hz, %i bit, %s, %i frames)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo", frameCount);
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, ring stream could not be created");
+
+    return stream;
+}
+
+// Acquire ring audio stream memory to write frames in place
+// NOTE: frameCount sets the frames requested (0: all free frames) and returns the contiguous frames that can be written,
+// region could be smaller than free space when it wraps around, commit and acquire again to write the rest
+void *AcquireAudioStreamWrite(AudioStream stream, unsigned int *frameCount)
+{
+    if ((stream.buffer == NULL) || (stream.buffer->usage != AUDIO_BUFFER_USAGE_RING) || (frameCount == NULL))
+    {
+        if (frameCount != NULL) *frameCount = 0;
+        return NULL;
+    }
+
+    AudioBuffer *buffer = stream.buffer;
+    ma_uint32 writePos = buffer->ringWrite;
+    ma_uint32 freeFrames = buffer->sizeInFrames - (writePos - c89atomic_load_explicit_32(&buffer->ringRead, c89atomic_memory_order_acquire));
+
+    ma_uint32 offset = writePos%buffer->sizeInFrames;
+    ma_uint32 frames = buffer->sizeInFrames - offset;
+    if (frames > freeFrames) frames = freeFrames;
+    if ((*frameCount > 0) && (frames > *frameCount)) frames = *frameCount;
+
+    *frameCount = frames;
+
+    return (frames > 0)? buffer->data + offset*stream.channels*(stream.sampleSize/8) : NULL;
+}
+
+// Commit ring audio stream frames written in acquired memory, frames are available to the mixer after commit
+void CommitAudioStreamWrite(AudioStream stream, unsigned int frameCount)
+{
+    if ((stream.buffer == NULL) || (stream.buffer->usage != AUDIO_BUFFER_USAGE_RING)) return;
+
+    AudioBuffer *buffer = stream.buffer;
+    ma_uint32 writePos = buffer->ringWrite;
+    ma_uint32 freeFrames = buffer->sizeInFrames - (writePos - c89atomic_load_explicit_32(&buffer->ringRead, c89atomic_memory_order_acquire));
+
+    if (frameCount > freeFrames)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Committing more frames than acquired, ring stream could be corrupted");
+        frameCount = freeFrames;
+    }
+
+    // Frames data must be visible to the mixer before the write position
+    c89atomic_store_explicit_32(&buffer->ringWrite, writePos + frameCount, c89atomic_memory_order_release);
+}
+
+// Get ring audio stream committed frames not mixed yet (queued latency)
+unsigned int GetAudioStreamQueuedFrames(AudioStream stream)
+{
+    if ((stream.buffer == NULL) || (stream.buffer->usage != AUDIO_BUFFER_USAGE_RING)) return 0;
+
+    return stream.buffer->ringWrite - c89atomic_load_explicit_32(&stream.buffer->ringRead, c89atomic_memory_order_acquire);
+}
+
 // Unload audio stream and free memory
 void UnloadAudioStream(AudioStream stream)
 {
@@ -1925,6 +3052,30 @@ void UnloadAudioStream(AudioStream stream)
 // NOTE 2: To unqueue a buffer it needs to be processed: IsAudioStreamProcessed()
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
+    // Ring streams copy data into free ring space, no need to wait a full sub-buffer
+    if ((stream.buffer != NULL) && (stream.buffer->usage == AUDIO_BUFFER_USAGE_RING))
+    {
+        const unsigned char *frames = (const unsigned char *)data;
+        unsigned int frameSize = stream.channels*(stream.sampleSize/8);
+        unsigned int remaining = (frameCount > 0)? (unsigned int)frameCount : 0;
+
+        while (remaining > 0)
+        {
+            unsigned int count = remaining;
+            void *region = AcquireAudioStreamWrite(stream, &count);
+            if (region == NULL) break;
+
+            memcpy(region, frames, count*frameSize);
+            CommitAudioStreamWrite(stream, count);
+
+            frames += count*frameSize;
+            remaining -= count;
+        }
+
+        if (remaining > 0) TRACELOG(LOG_WARNING, "STREAM: Ring buffer full, %i frames dropped", remaining);
+        return;
+    }
+
     if (stream.buffer != NULL)
     {
         if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
@@ -1935,6 +3086,7 @@ void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
             {
                 // Both buffers are available for updating.
                 // Update the first one and make sure the cursor is moved back to the front.
+                // NOTE: Mixer does not move the cursor while both sub-buffers are processed
                 subBufferToUpdate = 0;
                 stream.buffer->frameCursorPos = 0;
             }
@@ -1966,6 +3118,8 @@ void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
+                // Sub-buffer data and cursor must be visible to the mixer before it is marked as not processed
+                c89atomic_thread_fence(c89atomic_memory_order_release);
                 stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
@@ -1979,6 +3133,9 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
+    // Ring streams require refill while there is free ring space
+    if (stream.buffer->usage == AUDIO_BUFFER_USAGE_RING) return (GetAudioStreamQueuedFrames(stream) < stream.buffer->sizeInFrames);
+
     return (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1]);
 }
 
@@ -2039,7 +3196,7 @@ void SetAudioStreamBufferSizeDefault(int size)
 // Audio thread callback to request new data
 void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
-    if (stream.buffer != NULL) stream.buffer->callback = callback;
+    if (stream.buffer != NULL) PushAudioCommand((AudioCommand){ AUDIO_COMMAND_CALLBACK, stream.buffer, 0.0f, NULL, 0, callback });
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important.
@@ -2047,56 +3204,264 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element.
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
+    // NOTE: Processor is linked at the end of the chain by the mixer
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_ATTACH_PROCESSOR, stream.buffer, 0.0f, NULL, 0, NULL, processor });
+}
+
+void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
+{
+    if (stream.buffer == NULL) return;
+
+    // Processors chain is only modified by the mixer when applying commands,
+    // once all commands are applied it can be safely read from this thread
+    WaitAudioCommands(0);
+
+    rAudioProcessor *processor = stream.buffer->processor;
 
-    while (last && last->next)
+    while (processor)
     {
-        last = last->next;
+        rAudioProcessor *next = processor->next;
+
+        if (processor->process == process)
+        {
+            // Wait for the mixer to unlink the processor before freeing it
+            PushAudioCommand((AudioCommand){ AUDIO_COMMAND_DETACH_PROCESSOR, stream.buffer, 0.0f, NULL, 0, NULL, processor });
+            WaitAudioCommands(0);
+
+            RL_FREE(processor);
+        }
+
+        processor = next;
     }
-    if (last)
+}
+
+// Get audio stream total mixing time, processors included (in microseconds)
+// NOTE: Counter wraps around, compare two values for deltas, multichannel voices are accounted to pool channels
+unsigned int GetAudioStreamMixTime(AudioStream stream)
+{
+    if (stream.buffer == NULL) return 0;
+
+    return (unsigned int)(c89atomic_load_explicit_64(&stream.buffer->mixTime, c89atomic_memory_order_relaxed)/1000);
+}
+
+// Get audio stream processor total time (in microseconds)
+// NOTE: Processors are allocated and freed by this thread, the mixer only links them, so the chain can be walked
+unsigned int GetAudioStreamProcessorTime(AudioStream stream, AudioCallback process)
+{
+    if (stream.buffer == NULL) return 0;
+
+    ma_uint64 time = 0;
+
+    for (rAudioProcessor *processor = stream.buffer->processor; processor != NULL; processor = processor->next)
     {
-        processor->prev = last;
-        last->next = processor;
+        if (processor->process == process) time += c89atomic_load_explicit_64(&processor->processTime, c89atomic_memory_order_relaxed);
     }
-    else stream.buffer->processor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    return (unsigned int)(time/1000);
 }
 
-void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio mixer buses
+//----------------------------------------------------------------------------------
+
+// Load audio mixer bus (or get it if already loaded), buses are mixed into master bus (0)
+// NOTE: Processors attached to a bus run once per mixing block on all the buffers routed to the bus
+int LoadAudioBus(const char *name)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (name == NULL) return -1;
 
-    rAudioProcessor *processor = stream.buffer->processor;
+    int bus = GetAudioBus(name);
+    if (bus != -1) return bus;
+
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++)
+    {
+        if (!AUDIO.Bus.buses[i].loaded)
+        {
+            bus = i;
+            break;
+        }
+    }
+
+    if (bus == -1)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Maximum number of audio buses reached (%i)", MAX_AUDIO_BUSES);
+        return -1;
+    }
+
+    AudioBus *audioBus = &AUDIO.Bus.buses[bus];
+
+    // NOTE: Mixer does not access the bus until it is enabled by the load command
+    strncpy(audioBus->name, name, sizeof(audioBus->name) - 1);
+    audioBus->frames = (float *)RL_CALLOC(AUDIO_BUS_BUFFER_FRAMES*AUDIO_DEVICE_CHANNELS, sizeof(float));
+    audioBus->loaded = true;
+
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_LOAD_BUS, NULL, 0.0f, NULL, 0, NULL, NULL, bus });
+
+    TRACELOG(LOG_INFO, "AUDIO: [%s] Audio bus loaded successfully (%i)", audioBus->name, bus);
+
+    return bus;
+}
+
+// Unload audio mixer bus, buffers routed to the bus go back to master bus
+void UnloadAudioBus(int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) return;
+
+    AudioBus *audioBus = &AUDIO.Bus.buses[bus];
+
+    if (bus > 0) PushAudioCommand((AudioCommand){ AUDIO_COMMAND_UNLOAD_BUS, NULL, 0.0f, NULL, 0, NULL, NULL, bus });
+
+    // Wait for the mixer to stop using the bus, then the processors chain can be freed from this thread
+    WaitAudioCommands(0);
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (buffer->request.bus == bus) buffer->request.bus = 0;
+    }
+
+    rAudioProcessor *processor = audioBus->processor;
+
+    while (processor)
+    {
+        rAudioProcessor *next = processor->next;
+
+        PushAudioCommand((AudioCommand){ AUDIO_COMMAND_DETACH_PROCESSOR, NULL, 0.0f, NULL, 0, NULL, processor, bus });
+        WaitAudioCommands(0);
+
+        RL_FREE(processor);
+        processor = next;
+    }
+
+    RL_FREE(audioBus->frames);
+    memset(audioBus, 0, sizeof(AudioBus));
+}
+
+// Get audio mixer bus by name, -1 if not loaded
+int GetAudioBus(const char *name)
+{
+    if (name == NULL) return -1;
+
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+    {
+        if (AUDIO.Bus.buses[i].loaded && (strcmp(AUDIO.Bus.buses[i].name, name) == 0)) return i;
+    }
+
+    return -1;
+}
+
+// Set audio mixer bus volume (1.0 is max level)
+// NOTE: Master bus volume is the device master volume, see SetMasterVolume()
+void SetAudioBusVolume(int bus, float volume)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) return;
+
+    if (bus == 0) SetMasterVolume(volume);
+    else PushAudioCommand((AudioCommand){ AUDIO_COMMAND_BUS_VOLUME, NULL, volume, NULL, 0, NULL, NULL, bus });
+}
+
+// Add processor to audio mixer bus, processors are applied in the order they are attached
+// NOTE: Processor receives the bus mix in mixing format (float, device channels)
+void AttachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) return;
+
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+
+    PushAudioCommand((AudioCommand){ AUDIO_COMMAND_ATTACH_PROCESSOR, NULL, 0.0f, NULL, 0, NULL, processor, bus });
+}
+
+// Remove processor from audio mixer bus
+void DetachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) return;
+
+    // Processors chain is only modified by the mixer when applying commands
+    WaitAudioCommands(0);
+
+    rAudioProcessor *processor = AUDIO.Bus.buses[bus].processor;
 
     while (processor)
     {
         rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
 
         if (processor->process == process)
         {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+            PushAudioCommand((AudioCommand){ AUDIO_COMMAND_DETACH_PROCESSOR, NULL, 0.0f, NULL, 0, NULL, processor, bus });
+            WaitAudioCommands(0);
 
             RL_FREE(processor);
         }
 
         processor = next;
     }
+}
+
+// Get audio mixer bus processor total time (in microseconds)
+unsigned int GetAudioBusProcessorTime(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || !AUDIO.Bus.buses[bus].loaded) return 0;
+
+    ma_uint64 time = 0;
+
+    for (rAudioProcessor *processor = AUDIO.Bus.buses[bus].processor; processor != NULL; processor = processor->next)
+    {
+        if (processor->process == process) time += c89atomic_load_explicit_64(&processor->processTime, c89atomic_memory_order_relaxed);
+    }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    return (unsigned int)(time/1000);
+}
+
+// Route sound to audio mixer bus (0: master)
+// NOTE: Multichannel voices playing the sound use the bus set when they start mixing
+void SetSoundBus(Sound sound, int bus)
+{
+    SetAudioBufferBus(sound.stream.buffer, bus);
+}
+
+// Route music to audio mixer bus (0: master)
+void SetMusicBus(Music music, int bus)
+{
+    SetAudioBufferBus(music.stream.buffer, bus);
+}
+
+// Route audio stream to audio mixer bus (0: master)
+void SetAudioStreamBus(AudioStream stream, int bus)
+{
+    SetAudioBufferBus(stream.buffer, bus);
 }
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+// Sound async load decode stage: load wave (worker thread)
+static bool DecodeSoundJob(void *data)
+{
+    SoundLoadJob *job = (SoundLoadJob *)data;
+
+    job->wave = LoadWave(job->fileName);
+
+    return (job->wave.data != NULL);
+}
+
+// Sound async load upload stage: load sound from wave (main thread)
+static bool UploadSoundJob(void *data)
+{
+    SoundLoadJob *job = (SoundLoadJob *)data;
+
+    job->sound = LoadSoundFromWave(job->wave);
+    UnloadWave(job->wave);
+
+    return (job->sound.stream.buffer != NULL);
+}
+#endif
+
 
 // Log callback function
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage)
@@ -2116,6 +3481,34 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         return frameCount;
     }
 
+    // Using compressed sound decoder
+    if (audioBuffer->decoder != NULL) return ReadAudioDecoderFrames(audioBuffer, framesOut, frameCount);
+
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // Using ring stream, committed frames are read in place and missing frames are silence
+    if (audioBuffer->usage == AUDIO_BUFFER_USAGE_RING)
+    {
+        ma_uint32 readPos = audioBuffer->ringRead;
+        ma_uint32 available = c89atomic_load_explicit_32(&audioBuffer->ringWrite, c89atomic_memory_order_acquire) - readPos;
+        ma_uint32 framesRead = (available < frameCount)? available : frameCount;
+
+        // Copy committed frames, it could wrap around
+        ma_uint32 offset = readPos%audioBuffer->sizeInFrames;
+        ma_uint32 firstPart = audioBuffer->sizeInFrames - offset;
+        if (firstPart > framesRead) firstPart = framesRead;
+
+        memcpy(framesOut, audioBuffer->data + offset*frameSizeInBytes, firstPart*frameSizeInBytes);
+        memcpy((unsigned char *)framesOut + firstPart*frameSizeInBytes, audioBuffer->data, (framesRead - firstPart)*frameSizeInBytes);
+        if (framesRead < frameCount) memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        // Frames are released to the game thread once copied
+        c89atomic_store_explicit_32(&audioBuffer->ringRead, readPos + framesRead, c89atomic_memory_order_release);
+        audioBuffer->framesProcessed += framesRead;
+
+        return frameCount;
+    }
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -2126,8 +3519,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     bool isSubBufferProcessed[2] = { 0 };
     isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
     isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
-
-    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    c89atomic_thread_fence(c89atomic_memory_order_acquire);
 
     // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
     ma_uint32 framesRead = 0;
@@ -2178,7 +3570,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                ResetAudioBuffer(audioBuffer);
                 break;
             }
         }
@@ -2199,6 +3591,55 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     return framesRead;
 }
 
+// Read pitched sound frames in mixing format, resampled with linear interpolation between frames
+// NOTE: Cheaper than data converter pipeline, sound data is device rate so input frames step is the pitch
+static ma_uint32 ReadAudioBufferFramesPitched(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = audioBuffer->converter.channelsIn;
+    const float *data = (const float *)audioBuffer->data;
+    const float step = audioBuffer->pitch;
+
+    ma_uint32 framesRead = 0;
+
+    while ((framesRead < frameCount) && (audioBuffer->frameCursorPos < audioBuffer->sizeInFrames))
+    {
+        ma_uint32 frame = audioBuffer->frameCursorPos;
+        ma_uint32 nextFrame = frame + 1;
+
+        // Last frame interpolates with first frame when looping, it is kept otherwise
+        if (nextFrame >= audioBuffer->sizeInFrames) nextFrame = audioBuffer->looping? 0 : frame;
+
+        const float *frameIn = data + frame*channels;
+        const float *nextFrameIn = data + nextFrame*channels;
+        float *frameOut = framesOut + framesRead*channels;
+        float fraction = audioBuffer->frameCursorFraction;
+
+        for (ma_uint32 c = 0; c < channels; c++) frameOut[c] = frameIn[c] + (nextFrameIn[c] - frameIn[c])*fraction;
+
+        framesRead++;
+
+        fraction += step;
+        ma_uint32 advance = (ma_uint32)fraction;
+        audioBuffer->frameCursorFraction = fraction - (float)advance;
+        audioBuffer->frameCursorPos += advance;
+
+        if (audioBuffer->frameCursorPos >= audioBuffer->sizeInFrames)
+        {
+            if (audioBuffer->looping) audioBuffer->frameCursorPos %= audioBuffer->sizeInFrames;
+            else
+            {
+                ResetAudioBuffer(audioBuffer);
+                break;
+            }
+        }
+    }
+
+    // Zero-fill excess, not reported as read (sound finished playing)
+    if (framesRead < frameCount) memset(framesOut + framesRead*channels, 0, (frameCount - framesRead)*channels*sizeof(float));
+
+    return framesRead;
+}
+
 // Reads audio data from an AudioBuffer object in device format. Returned data will be in a format appropriate for mixing.
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
@@ -2206,7 +3647,13 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
-    ma_uint8 inputBuffer[4096] = { 0 };
+    // Data already in mixing format (float32, output channels, no resampling) skips the converter
+    if (IsAudioBufferInMixingFormat(audioBuffer)) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
+    // Pitched sounds are already in device format (converted on loading), only resampling is required
+    if (IsAudioBufferPitchedSound(audioBuffer)) return ReadAudioBufferFramesPitched(audioBuffer, framesOut, frameCount);
+
+    ma_uint8 inputBuffer[4096];
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2253,134 +3700,1398 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
-    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
-    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+    double mixStartTime = ma_timer_get_time_in_seconds(&AUDIO.System.mixTimer);
+    ma_uint32 voices = 0;
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+    // Device timing stats: device buffer is estimated as drained by callbacks interval and refilled by frames mixed
+    // NOTE: Buffered time is limited to device buffer size, so timer drift is not accumulated
+    double periodTime = (double)frameCount/pDevice->sampleRate;
 
-            ma_uint32 framesRead = 0;
+    if (AUDIO.System.lastCallbackTime > 0.0)
+    {
+        double interval = mixStartTime - AUDIO.System.lastCallbackTime;
 
-            while (1)
-            {
-                if (framesRead >= frameCount) break;
+        if (interval > periodTime*AUDIO_LATE_CALLBACK_FACTOR) c89atomic_store_explicit_32(&AUDIO.System.lateCallbacks, AUDIO.System.lateCallbacks + 1, c89atomic_memory_order_relaxed);
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+        AUDIO.System.bufferedTime -= interval;
+        if (AUDIO.System.bufferedTime < 0.0)
+        {
+            c89atomic_store_explicit_32(&AUDIO.System.underruns, AUDIO.System.underruns + 1, c89atomic_memory_order_relaxed);
+            AUDIO.System.bufferedTime = 0.0;
+        }
+    }
 
-                while (framesToRead > 0)
-                {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+    double bufferTime = (double)pDevice->playback.internalPeriodSizeInFrames*pDevice->playback.internalPeriods/pDevice->playback.internalSampleRate;
+    AUDIO.System.bufferedTime += periodTime;
+    if (AUDIO.System.bufferedTime > bufferTime) AUDIO.System.bufferedTime = bufferTime;
+    AUDIO.System.lastCallbackTime = mixStartTime;
+
+    // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
+    memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
+
+    // Apply changes requested by the game thread, no lock is taken so mixing stays real-time
+    ProcessAudioCommands();
+
+    // Frames are mixed in blocks that fit the buses mixing buffers
+    for (ma_uint32 framesMixed = 0; framesMixed < frameCount; framesMixed += AUDIO_BUS_BUFFER_FRAMES)
+    {
+        ma_uint32 blockFrames = frameCount - framesMixed;
+        if (blockFrames > AUDIO_BUS_BUFFER_FRAMES) blockFrames = AUDIO_BUS_BUFFER_FRAMES;
+
+        float *framesOut = (float *)pFramesOut + framesMixed*pDevice->playback.channels;
+
+        ma_uint32 blockVoices = MixAudioBuffers(framesOut, blockFrames);
+        if (blockVoices > voices) voices = blockVoices;
+
+        MixAudioBuses(framesOut, blockFrames);
+    }
+
+    // Mixer stats, mixing time includes commands processing and buses processors
+    double mixDuration = ma_timer_get_time_in_seconds(&AUDIO.System.mixTimer) - mixStartTime;
+    ma_uint32 mixTime = (ma_uint32)(mixDuration*1000000.0);
+
+    // DSP load average and peak are published once per load window, so short spikes are kept visible
+    AUDIO.System.loadWindowTime += periodTime;
+    AUDIO.System.loadWindowMixTime += mixDuration;
+    if (mixDuration/periodTime > AUDIO.System.loadWindowPeak) AUDIO.System.loadWindowPeak = mixDuration/periodTime;
+
+    if (AUDIO.System.loadWindowTime >= AUDIO_MIXER_LOAD_WINDOW)
+    {
+        c89atomic_store_explicit_32(&AUDIO.System.loadAverage, (ma_uint32)(AUDIO.System.loadWindowMixTime/AUDIO.System.loadWindowTime*1000.0), c89atomic_memory_order_relaxed);
+        c89atomic_store_explicit_32(&AUDIO.System.loadPeak, (ma_uint32)(AUDIO.System.loadWindowPeak*1000.0), c89atomic_memory_order_relaxed);
+
+        AUDIO.System.loadWindowTime = 0.0;
+        AUDIO.System.loadWindowMixTime = 0.0;
+        AUDIO.System.loadWindowPeak = 0.0;
+    }
+
+    c89atomic_store_explicit_32(&AUDIO.System.budgetTime, (ma_uint32)(periodTime*1000000.0), c89atomic_memory_order_relaxed);
+
+    c89atomic_store_explicit_32(&AUDIO.System.mixVoices, voices, c89atomic_memory_order_relaxed);
+    c89atomic_store_explicit_32(&AUDIO.System.lastMixTime, mixTime, c89atomic_memory_order_relaxed);
+    c89atomic_store_explicit_32(&AUDIO.System.mixTime, AUDIO.System.mixTime + mixTime, c89atomic_memory_order_relaxed);
+    c89atomic_store_explicit_32(&AUDIO.System.mixPeriods, AUDIO.System.mixPeriods + 1, c89atomic_memory_order_release);
+
+    // NOTE: Only the mixer modifies the counter, game thread reads it for virtual voices timing
+    c89atomic_store_explicit_32(&AUDIO.System.framesMixed, AUDIO.System.framesMixed + frameCount, c89atomic_memory_order_release);
+}
+
+// Mix playing audio buffers into master output or into the mixing buffer of their bus, returns buffers mixed
+static ma_uint32 MixAudioBuffers(float *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 mixed = 0;
+
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++)
+    {
+        if (AUDIO.Bus.buses[i].active) memset(AUDIO.Bus.buses[i].frames, 0, frameCount*AUDIO.System.device.playback.channels*sizeof(float));
+    }
+
+    for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+    {
+        // Ignore stopped or paused sounds
+        if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+        // Streams with ended source are stopped once all queued sub-buffers have been played
+        if (audioBuffer->isStreamEnding && audioBuffer->isSubBufferProcessed[0] && audioBuffer->isSubBufferProcessed[1])
+        {
+            ResetAudioBuffer(audioBuffer);
+            continue;
+        }
+
+        ma_uint32 framesRead = 0;
+        float *mixOut = ((audioBuffer->bus > 0) && AUDIO.Bus.buses[audioBuffer->bus].active)? AUDIO.Bus.buses[audioBuffer->bus].frames : framesOut;
+        mixed++;
+
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+        double bufferStartTime = ma_timer_get_time_in_seconds(&AUDIO.System.mixTimer);
+#endif
+
+        // Static buffers already in mixing format are mixed directly from their data,
+        // no intermediate copy is required if there are no processors to apply
+        if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (audioBuffer->callback == NULL) && (audioBuffer->decoder == NULL) &&
+            (audioBuffer->processor == NULL) && IsAudioBufferInMixingFormat(audioBuffer))
+        {
+            const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+            while (framesRead < frameCount)
+            {
+                ma_uint32 framesToMix = audioBuffer->sizeInFrames - audioBuffer->frameCursorPos;
+                if (framesToMix > (frameCount - framesRead)) framesToMix = frameCount - framesRead;
+
+                MixAudioFrames(mixOut + framesRead*channels, (float *)audioBuffer->data + audioBuffer->frameCursorPos*channels, framesToMix, audioBuffer);
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                audioBuffer->frameCursorPos += framesToMix;
+                framesRead += framesToMix;
+
+                if (audioBuffer->frameCursorPos >= audioBuffer->sizeInFrames)
+                {
+                    if (audioBuffer->looping && (audioBuffer->sizeInFrames > 0)) audioBuffer->frameCursorPos = 0;
+                    else
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        ResetAudioBuffer(audioBuffer);
+                        break;
                     }
+                }
+            }
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+            AddAudioMixerTime(&audioBuffer->mixTime, bufferStartTime);
+#endif
+            continue;
+        }
+
+        while (1)
+        {
+            if (framesRead >= frameCount) break;
 
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+            // Just read as much data as we can from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+            while (framesToRead > 0)
+            {
+                float tempBuffer[1024];         // Frames for stereo
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                {
+                    framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                }
+
+                ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+                if (framesJustRead > 0)
+                {
+                    float *framesMixOut = mixOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = tempBuffer;
+
+                    // Apply processors chain if defined
+                    ApplyAudioProcessors(audioBuffer->processor, framesIn, framesJustRead);
+
+                    MixAudioFrames(framesMixOut, framesIn, framesJustRead, audioBuffer);
+
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
+
+                if (!audioBuffer->playing)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
 
-                    if (!audioBuffer->playing)
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        ResetAudioBuffer(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBuffer(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        audioBuffer->frameCursorPos = 0;
+                        continue;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            // If for some reason we weren't able to read every frame we'll need to break from the loop
+            // Not doing this could theoretically put us into an infinite loop
+            if (framesToRead > 0) break;
         }
+
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+        AddAudioMixerTime(&audioBuffer->mixTime, bufferStartTime);
+#endif
+    }
+
+    return mixed;
+}
+
+// Apply buses processors chain once per block and mix buses into master output
+// NOTE: Active buses are processed even with no buffers playing, so effects tails (reverb) keep sounding
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 sampleCount = frameCount*AUDIO.System.device.playback.channels;
+
+    for (int i = 1; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &AUDIO.Bus.buses[i];
+
+        if (!bus->active) continue;
+
+        ApplyAudioProcessors(bus->processor, bus->frames, frameCount);
+
+        for (ma_uint32 s = 0; s < sampleCount; s++) framesOut[s] += bus->frames[s]*bus->volume;
+    }
+
+    // Master bus processors are applied to the final mix
+    ApplyAudioProcessors(AUDIO.Bus.buses[0].processor, framesOut, frameCount);
+}
+
+// Apply processors chain to mixing format frames, in the order processors were attached
+static void ApplyAudioProcessors(rAudioProcessor *processor, float *frames, ma_uint32 frameCount)
+{
+    for (; processor != NULL; processor = processor->next)
+    {
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+        double processStartTime = ma_timer_get_time_in_seconds(&AUDIO.System.mixTimer);
+        processor->process(frames, frameCount);
+        AddAudioMixerTime(&processor->processTime, processStartTime);
+#else
+        processor->process(frames, frameCount);
+#endif
     }
+}
+
+#if defined(SUPPORT_AUDIO_MIXER_PROFILING)
+// Add mixer time since start time to stats counter (in nanoseconds)
+// NOTE: Only the mixer modifies the counter, the store is atomic so the game thread reads it whole
+static void AddAudioMixerTime(ma_uint64 *counter, double startTime)
+{
+    ma_uint64 time = (ma_uint64)((ma_timer_get_time_in_seconds(&AUDIO.System.mixTimer) - startTime)*1000000000.0);
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    c89atomic_store_explicit_64(counter, *counter + time, c89atomic_memory_order_relaxed);
 }
+#endif
+
+// Mixing 4-float vector operations
+#if defined(MIXING_SIMD_SSE)
+    typedef __m128 MixingVec4;
+    #define MixingLoad(p)               _mm_loadu_ps(p)
+    #define MixingSet(x, y, z, w)       _mm_setr_ps(x, y, z, w)
+    #define MixingAdd(a, b)             _mm_add_ps(a, b)
+    #define MixingMulAdd(acc, v, g)     _mm_add_ps(acc, _mm_mul_ps(v, g))
+    #define MixingStore(p, v)           _mm_storeu_ps(p, v)
+#elif defined(MIXING_SIMD_NEON)
+    typedef float32x4_t MixingVec4;
+    static inline MixingVec4 MixingSet(float x, float y, float z, float w) { const float v[4] = { x, y, z, w }; return vld1q_f32(v); }
+    #define MixingLoad(p)               vld1q_f32(p)
+    #define MixingAdd(a, b)             vaddq_f32(a, b)
+    #define MixingMulAdd(acc, v, g)     vmlaq_f32(acc, v, g)
+    #define MixingStore(p, v)           vst1q_f32(p, v)
+#else
+    typedef struct { float x, y, z, w; } MixingVec4;
+    static inline MixingVec4 MixingLoad(const float *p) { MixingVec4 v = { p[0], p[1], p[2], p[3] }; return v; }
+    static inline MixingVec4 MixingSet(float x, float y, float z, float w) { MixingVec4 v = { x, y, z, w }; return v; }
+    static inline MixingVec4 MixingAdd(MixingVec4 a, MixingVec4 b) { MixingVec4 r = { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; return r; }
+    static inline MixingVec4 MixingMulAdd(MixingVec4 acc, MixingVec4 v, MixingVec4 g) { MixingVec4 r = { acc.x + v.x*g.x, acc.y + v.y*g.y, acc.z + v.z*g.z, acc.w + v.w*g.w }; return r; }
+    static inline void MixingStore(float *p, MixingVec4 v) { p[0] = v.x; p[1] = v.y; p[2] = v.z; p[3] = v.w; }
+#endif
 
 // Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// NOTE 1: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// NOTE 2: Levels are linearly ramped from the previous mix levels to avoid clicks on volume/pan changes
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
 {
+    if (frameCount == 0) return;
+
     const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
+    float levels[2] = { localVolume, localVolume };
+
     if (channels == 2)  // We consider panning
     {
         const float left = buffer->pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        levels[0] = localVolume*0.5f*left*(3.0f - left*left);
+        levels[1] = localVolume*0.5f*right*(3.0f - right*right);
+    }
+
+    // First mix after playing starts uses the levels directly
+    if (buffer->mixLevels[0] < 0.0f)
+    {
+        buffer->mixLevels[0] = levels[0];
+        buffer->mixLevels[1] = levels[1];
+    }
+
+    const float start[2] = { buffer->mixLevels[0], buffer->mixLevels[1] };
+    const float step[2] = { (levels[0] - start[0])/frameCount, (levels[1] - start[1])/frameCount };
+
+    ma_uint32 frame = 0;
+
+    if (channels == 2)
+    {
+        // Two stereo frames per vector
+        MixingVec4 gain = MixingSet(start[0], start[1], start[0] + step[0], start[1] + step[1]);
+        const MixingVec4 gainStep = MixingSet(2.0f*step[0], 2.0f*step[1], 2.0f*step[0], 2.0f*step[1]);
+
+        for (; (frame + 2) <= frameCount; frame += 2)
+        {
+            MixingVec4 out = MixingLoad(framesOut + frame*2);
+            out = MixingMulAdd(out, MixingLoad(framesIn + frame*2), gain);
+            MixingStore(framesOut + frame*2, out);
+
+            gain = MixingAdd(gain, gainStep);
+        }
+
+        for (; frame < frameCount; frame++)
+        {
+            framesOut[frame*2] += framesIn[frame*2]*(start[0] + step[0]*frame);
+            framesOut[frame*2 + 1] += framesIn[frame*2 + 1]*(start[1] + step[1]*frame);
+        }
+    }
+    else if (channels == 1)
+    {
+        // Four mono frames per vector
+        MixingVec4 gain = MixingSet(start[0], start[0] + step[0], start[0] + 2.0f*step[0], start[0] + 3.0f*step[0]);
+        const MixingVec4 gainStep = MixingSet(4.0f*step[0], 4.0f*step[0], 4.0f*step[0], 4.0f*step[0]);
+
+        for (; (frame + 4) <= frameCount; frame += 4)
+        {
+            MixingVec4 out = MixingLoad(framesOut + frame);
+            out = MixingMulAdd(out, MixingLoad(framesIn + frame), gain);
+            MixingStore(framesOut + frame, out);
+
+            gain = MixingAdd(gain, gainStep);
+        }
 
+        for (; frame < frameCount; frame++) framesOut[frame] += framesIn[frame]*(start[0] + step[0]*frame);
+    }
+    else  // We do not consider panning
+    {
         float *frameOut = framesOut;
         const float *frameIn = framesIn;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        for (; frame < frameCount; frame++)
         {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+            const float gain = start[0] + step[0]*frame;
+
+            // Output accumulates input multiplied by volume to provided output (usually 0)
+            for (ma_uint32 c = 0; c < channels; c++) frameOut[c] += (frameIn[c]*gain);
 
-            frameOut += 2;
-            frameIn += 2;
+            frameOut += channels;
+            frameIn += channels;
         }
     }
-    else  // We do not consider panning
+
+    buffer->mixLevels[0] = levels[0];
+    buffer->mixLevels[1] = levels[1];
+}
+
+// Convert wave samples (8, 16 or 32 bit) to float, normalized to range [-1..1]
+// NOTE: Integer samples are scaled by a power of two (u8: 128, s16: 32768), so they convert back unchanged
+static void ConvertWaveSamplesToFloat(float *samples, const void *data, unsigned int count, int sampleSize)
+{
+    unsigned int i = 0;
+
+    if (sampleSize == 8)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        const unsigned char *src = (const unsigned char *)data;
+
+#if defined(WAVE_SIMD_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 scale = _mm_set1_ps(1.0f/128.0f);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (; i + 8 <= count; i += 8)
         {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+            __m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + i)), zero);
+            _mm_storeu_ps(samples + i, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale), one));
+            _mm_storeu_ps(samples + i + 4, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale), one));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        const float32x4_t one = vdupq_n_f32(1.0f);
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
+        for (; i + 8 <= count; i += 8)
+        {
+            uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+            vst1q_f32(samples + i, vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), 1.0f/128.0f), one));
+            vst1q_f32(samples + i + 4, vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), 1.0f/128.0f), one));
+        }
+#endif
+        for (; i < count; i++) samples[i] = src[i]*(1.0f/128.0f) - 1.0f;
+    }
+    else if (sampleSize == 16)
+    {
+        const short *src = (const short *)data;
+
+#if defined(WAVE_SIMD_SSE2)
+        const __m128 scale = _mm_set1_ps(1.0f/32768.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+            _mm_storeu_ps(samples + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)), scale));
+            _mm_storeu_ps(samples + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16)), scale));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        for (; i + 8 <= count; i += 8)
+        {
+            int16x8_t v = vld1q_s16(src + i);
+            vst1q_f32(samples + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), 1.0f/32768.0f));
+            vst1q_f32(samples + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), 1.0f/32768.0f));
+        }
+#endif
+        for (; i < count; i++) samples[i] = src[i]*(1.0f/32768.0f);
+    }
+    else if (sampleSize == 32) memmove(samples, data, count*sizeof(float));
+}
+
+// Convert float samples to wave samples (8, 16 or 32 bit), samples are clipped to range [-1..1]
+// NOTE: Samples are truncated and saturated (no dithering), data can alias samples (converted forward)
+static void ConvertFloatToWaveSamples(void *data, const float *samples, unsigned int count, int sampleSize)
+{
+    unsigned int i = 0;
+
+    if (sampleSize == 8)
+    {
+        unsigned char *dst = (unsigned char *)data;
+
+#if defined(WAVE_SIMD_SSE2)
+        const __m128 minValue = _mm_set1_ps(-1.0f);
+        const __m128 maxValue = _mm_set1_ps(1.0f);
+        const __m128 scale = _mm_set1_ps(128.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i), minValue), maxValue), maxValue), scale));
+            __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i + 4), minValue), maxValue), maxValue), scale));
+            __m128i v = _mm_packs_epi32(lo, hi);
+            _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(v, v));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        const float32x4_t minValue = vdupq_n_f32(-1.0f);
+        const float32x4_t maxValue = vdupq_n_f32(1.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            uint32x4_t lo = vcvtq_u32_f32(vmulq_n_f32(vaddq_f32(vminq_f32(vmaxq_f32(vld1q_f32(samples + i), minValue), maxValue), maxValue), 128.0f));
+            uint32x4_t hi = vcvtq_u32_f32(vmulq_n_f32(vaddq_f32(vminq_f32(vmaxq_f32(vld1q_f32(samples + i + 4), minValue), maxValue), maxValue), 128.0f));
+            vst1_u8(dst + i, vqmovn_u16(vcombine_u16(vqmovn_u32(lo), vqmovn_u32(hi))));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            float x = samples[i];
+            x = (x < -1.0f)? -1.0f : ((x > 1.0f)? 1.0f : x);
+            int value = (int)((x + 1.0f)*128.0f);
+            dst[i] = (unsigned char)((value > 255)? 255 : value);
+        }
+    }
+    else if (sampleSize == 16)
+    {
+        short *dst = (short *)data;
+
+#if defined(WAVE_SIMD_SSE2)
+        const __m128 minValue = _mm_set1_ps(-1.0f);
+        const __m128 maxValue = _mm_set1_ps(1.0f);
+        const __m128 scale = _mm_set1_ps(32768.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i), minValue), maxValue), scale));
+            __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i + 4), minValue), maxValue), scale));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(lo, hi));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        const float32x4_t minValue = vdupq_n_f32(-1.0f);
+        const float32x4_t maxValue = vdupq_n_f32(1.0f);
+
+        for (; i + 8 <= count; i += 8)
+        {
+            int32x4_t lo = vcvtq_s32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(samples + i), minValue), maxValue), 32768.0f));
+            int32x4_t hi = vcvtq_s32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(samples + i + 4), minValue), maxValue), 32768.0f));
+            vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            float x = samples[i];
+            x = (x < -1.0f)? -1.0f : ((x > 1.0f)? 1.0f : x);
+            int value = (int)(x*32768.0f);
+            dst[i] = (short)((value > 32767)? 32767 : value);
+        }
+    }
+    else if (sampleSize == 32) memmove(data, samples, count*sizeof(float));
+}
+
+// Convert float frames channels, mono is duplicated to stereo and stereo is averaged to mono
+// NOTE: Only mono/stereo conversions are supported, matching miniaudio default channel mapping
+static void ConvertWaveChannels(float *framesOut, const float *framesIn, unsigned int frameCount, int channelsIn, int channelsOut)
+{
+    unsigned int i = 0;
+
+    if ((channelsIn == 1) && (channelsOut == 2))
+    {
+#if defined(WAVE_SIMD_SSE2)
+        for (; i + 4 <= frameCount; i += 4)
+        {
+            __m128 v = _mm_loadu_ps(framesIn + i);
+            _mm_storeu_ps(framesOut + i*2, _mm_unpacklo_ps(v, v));
+            _mm_storeu_ps(framesOut + i*2 + 4, _mm_unpackhi_ps(v, v));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        for (; i + 4 <= frameCount; i += 4)
+        {
+            float32x4x2_t v = { { vld1q_f32(framesIn + i), vld1q_f32(framesIn + i) } };
+            vst2q_f32(framesOut + i*2, v);
+        }
+#endif
+        for (; i < frameCount; i++) framesOut[i*2] = framesOut[i*2 + 1] = framesIn[i];
+    }
+    else if ((channelsIn == 2) && (channelsOut == 1))
+    {
+#if defined(WAVE_SIMD_SSE2)
+        const __m128 half = _mm_set1_ps(0.5f);
+
+        for (; i + 4 <= frameCount; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(framesIn + i*2);
+            __m128 b = _mm_loadu_ps(framesIn + i*2 + 4);
+            __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(framesOut + i, _mm_mul_ps(_mm_add_ps(left, right), half));
+        }
+#elif defined(WAVE_SIMD_NEON)
+        for (; i + 4 <= frameCount; i += 4)
+        {
+            float32x4x2_t v = vld2q_f32(framesIn + i*2);
+            vst1q_f32(framesOut + i, vmulq_n_f32(vaddq_f32(v.val[0], v.val[1]), 0.5f));
         }
+#endif
+        for (; i < frameCount; i++) framesOut[i] = (framesIn[i*2] + framesIn[i*2 + 1])*0.5f;
+    }
+    else memcpy(framesOut, framesIn, frameCount*channelsIn*sizeof(float));
+}
+
+// Convert waves range format (WaveFormatMany() range callback)
+static void FormatWavesRange(void *data, int start, int end)
+{
+    WaveFormatBatch *batch = (WaveFormatBatch *)data;
+
+    for (int i = start; i < end; i++) WaveFormat(&batch->waves[i], batch->sampleRate, batch->sampleSize, batch->channels);
+}
+
+// Check if audio buffer data is already in mixing format: float32, output channels and no resampling required
+static bool IsAudioBufferInMixingFormat(AudioBuffer *buffer)
+{
+    const ma_data_converter *converter = &buffer->converter;
+
+    bool result = ((converter->formatIn == ma_format_f32) && (converter->formatOut == ma_format_f32) && (converter->channelsIn == converter->channelsOut));
+
+    if (result)
+    {
+        if (converter->hasResampler) result = (converter->resampler.sampleRateIn == converter->resampler.sampleRateOut);
+        else result = (converter->sampleRateIn == converter->sampleRateOut);
+    }
+
+    return result;
+}
+
+// Check if audio buffer is a pitched sound in device format: float32, output channels and device sample rate
+// NOTE: Sounds are converted to device format on loading, pitch is the only resampling required
+static bool IsAudioBufferPitchedSound(AudioBuffer *buffer)
+{
+    const ma_data_converter *converter = &buffer->converter;
+
+    return ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (buffer->callback == NULL) && (buffer->decoder == NULL) && (buffer->data != NULL) &&
+        (converter->formatIn == ma_format_f32) && (converter->formatOut == ma_format_f32) && (converter->channelsIn == converter->channelsOut) &&
+        (converter->sampleRateIn == converter->sampleRateOut) && (buffer->pitch > 0.0f));
+}
+
+// Decode music stream frames into pcm buffer, in stream format
+static void ReadMusicStreamFrames(Music music, void *pcm, unsigned int frameCount)
+{
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            // NOTE: Returns the number of samples to process (not required)
+            if (music.stream.sampleSize == 16) drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCount, (short *)pcm);
+            else if (music.stream.sampleSize == 32) drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCount, (float *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
+            stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, frameCount*music.stream.channels);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            // NOTE: Returns the number of samples to process (not required)
+            drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCount*music.stream.channels, (short *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCount, (float *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcm, frameCount);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, frameCount, 0);
+        } break;
+    #endif
+        default: break;
     }
 }
 
+// Seek music stream decoder to a frame position
+// NOTE: Module formats can only be seeked to start
+static void SeekMusicStreamDecoder(Music music, unsigned int positionInFrames)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            if (positionInFrames == 0) stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            else stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames);
+        } break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: if (positionInFrames == 0) jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: if (positionInFrames == 0) jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+// Load MP3 music seek table, seek points are stored after decoder context and bound to it
+// NOTE: Seeking decodes from the closest previous seek point, without table MP3 streams are scanned from start,
+// cached seek tables (file name provided) avoid scanning the whole stream on load
+static unsigned int LoadMusicSeekTableMP3(drmp3 *ctxMp3, const char *fileName, unsigned int dataSize)
+{
+#if defined(SUPPORT_MUSIC_SEEK_TABLE)
+    drmp3_seek_point *points = (drmp3_seek_point *)(ctxMp3 + 1);
+    drmp3_uint32 pointCount = 0;
+    unsigned int frameCount = 0;
+
+#if defined(SUPPORT_MUSIC_SEEK_TABLE_CACHE)
+    char cacheFileName[512] = { 0 };
+    MusicSeekTableHeader header = { 0 };
+
+    if (fileName != NULL)
+    {
+        snprintf(cacheFileName, sizeof(cacheFileName), "%s.seek", fileName);
+
+        // Music file size validates cached table
+        FILE *file = fopen(fileName, "rb");
+        if (file != NULL)
+        {
+            fseek(file, 0, SEEK_END);
+            dataSize = (unsigned int)ftell(file);
+            fclose(file);
+        }
+
+        file = fopen(cacheFileName, "rb");
+        if (file != NULL)
+        {
+            if ((fread(&header, sizeof(MusicSeekTableHeader), 1, file) == 1) && (memcmp(header.id, "rSKT", 4) == 0) &&
+                (header.dataSize == dataSize) && (header.pointCount <= MUSIC_SEEK_TABLE_POINTS) &&
+                (fread(points, sizeof(drmp3_seek_point), header.pointCount, file) == header.pointCount))
+            {
+                pointCount = header.pointCount;
+                frameCount = header.frameCount;
+            }
+
+            fclose(file);
+        }
+    }
+#endif
+
+    if (frameCount == 0)
+    {
+        frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+
+        pointCount = MUSIC_SEEK_TABLE_POINTS;
+        if (!drmp3_calculate_seek_points(ctxMp3, &pointCount, points)) pointCount = 0;
+
+#if defined(SUPPORT_MUSIC_SEEK_TABLE_CACHE)
+        if ((fileName != NULL) && (pointCount > 0))
+        {
+            memcpy(header.id, "rSKT", 4);
+            header.dataSize = dataSize;
+            header.frameCount = frameCount;
+            header.pointCount = pointCount;
+
+            // NOTE: Cache is optional, music files folder could be read-only
+            FILE *file = fopen(cacheFileName, "wb");
+            if (file != NULL)
+            {
+                fwrite(&header, sizeof(MusicSeekTableHeader), 1, file);
+                fwrite(points, sizeof(drmp3_seek_point), pointCount, file);
+                fclose(file);
+            }
+        }
+#endif
+    }
+
+    if (pointCount > 0) drmp3_bind_seek_table(ctxMp3, pointCount, points);
+
+    TRACELOG(LOG_DEBUG, "STREAM: MP3 seek table loaded (%i points)", pointCount);
+
+    return frameCount;
+#else
+    (void)fileName;
+    (void)dataSize;
+
+    return (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+#endif
+}
+#endif
+
+#if defined(MUSIC_FILE_STREAMS)
+// Music decoders read callback, file stream blocks are read ahead by jobs
+static size_t ReadMusicFileStream(void *userData, void *buffer, size_t size)
+{
+    return ReadFileStream((FileStream *)userData, buffer, (unsigned int)size);
+}
+
+#if defined(SUPPORT_FILEFORMAT_WAV)
+// WAV music decoder seek callback
+static drwav_bool32 SeekMusicFileStreamWAV(void *userData, int offset, drwav_seek_origin origin)
+{
+    return SeekFileStream((FileStream *)userData, offset, (origin == drwav_seek_origin_current)? SEEK_CUR : SEEK_SET);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+// FLAC music decoder seek callback
+static drflac_bool32 SeekMusicFileStreamFLAC(void *userData, int offset, drflac_seek_origin origin)
+{
+    return SeekFileStream((FileStream *)userData, offset, (origin == drflac_seek_origin_current)? SEEK_CUR : SEEK_SET);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+// MP3 music decoder seek callback
+static drmp3_bool32 SeekMusicFileStreamMP3(void *userData, int offset, drmp3_seek_origin origin)
+{
+    return SeekFileStream((FileStream *)userData, offset, (origin == drmp3_seek_origin_current)? SEEK_CUR : SEEK_SET);
+}
+#endif
+#endif
+
+// Get music stream thread slot for a stream buffer, -1 if not registered
+// NOTE: Slots are only added/removed by the game thread, no lock required to look for them
+static int GetMusicStreamSlot(AudioBuffer *buffer)
+{
+    if ((buffer == NULL) || !c89atomic_load_32(&AUDIO.MusicThread.isRunning)) return -1;
+
+    for (int i = 0; i < AUDIO.MusicThread.slotCount; i++)
+    {
+        if (AUDIO.MusicThread.slots[i].music.stream.buffer == buffer) return i;
+    }
+
+    return -1;
+}
+
+// Register music stream to be decoded by music stream thread
+// NOTE: Music is registered again on every PlayMusicStream() to keep its looping state updated
+static void RegisterMusicStreamSlot(Music music)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+    int index = GetMusicStreamSlot(buffer);
+
+    ma_mutex_lock(&AUDIO.MusicThread.lock);
+
+    if (index == -1)
+    {
+        MusicStreamSlot *slots = (MusicStreamSlot *)RL_REALLOC(AUDIO.MusicThread.slots, (AUDIO.MusicThread.slotCount + 1)*sizeof(MusicStreamSlot));
+
+        if (slots != NULL)
+        {
+            AUDIO.MusicThread.slots = slots;
+            index = AUDIO.MusicThread.slotCount;
+            AUDIO.MusicThread.slotCount++;
+
+            MusicStreamSlot *slot = &AUDIO.MusicThread.slots[index];
+            unsigned int frameSize = music.stream.channels*music.stream.sampleSize/8;
+            unsigned int subBufferSizeInFrames = buffer->sizeInFrames/2;
+
+            // Decoded frames ring buffer keeps at least two sub-buffers ahead
+            slot->frameCapacity = (unsigned int)(AUDIO.MusicThread.lookahead*music.stream.sampleRate);
+            if (slot->frameCapacity < subBufferSizeInFrames*2) slot->frameCapacity = subBufferSizeInFrames*2;
+
+            slot->frames = (unsigned char *)RL_MALLOC(slot->frameCapacity*frameSize);
+            slot->pcm = RL_MALLOC(subBufferSizeInFrames*frameSize);
+            slot->framesDecoded = buffer->framesProcessed;  // Music could have been updated with UpdateMusicStream()
+            slot->frameRead = 0;
+            slot->frameCount = 0;
+            slot->decoderEnded = false;
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music stream thread");
+    }
+
+    if (index != -1)
+    {
+        MusicStreamSlot *slot = &AUDIO.MusicThread.slots[index];
+        slot->music = music;
+
+        // Music stream stopped after ending, decode it again from start
+        if (slot->decoderEnded)
+        {
+            slot->decoderEnded = false;
+            buffer->isStreamEnding = false;
+        }
+    }
+
+    ma_mutex_unlock(&AUDIO.MusicThread.lock);
+}
+
+// Unregister music stream from music stream thread
+static void UnregisterMusicStreamSlot(AudioBuffer *buffer)
+{
+    int index = GetMusicStreamSlot(buffer);
+
+    if (index != -1)
+    {
+        ma_mutex_lock(&AUDIO.MusicThread.lock);
+
+        RL_FREE(AUDIO.MusicThread.slots[index].frames);
+        RL_FREE(AUDIO.MusicThread.slots[index].pcm);
+
+        AUDIO.MusicThread.slotCount--;
+        AUDIO.MusicThread.slots[index] = AUDIO.MusicThread.slots[AUDIO.MusicThread.slotCount];
+
+        ma_mutex_unlock(&AUDIO.MusicThread.lock);
+    }
+}
+
+// Discard decoded frames of a music stream slot, decoder continues from framesDecoded
+// NOTE: Requires music stream thread lock
+static void ResetMusicStreamSlot(MusicStreamSlot *slot, unsigned int framesDecoded)
+{
+    slot->frameRead = 0;
+    slot->frameCount = 0;
+    slot->framesDecoded = framesDecoded;
+    slot->decoderEnded = false;
+    slot->music.stream.buffer->isStreamEnding = false;
+}
+
+// Decode frames ahead and refill processed stream sub-buffers
+// NOTE: Called by music stream thread with lock, decoding is limited to one sub-buffer
+// per update unless the stream is waiting for data, to keep lock times small
+static void UpdateMusicStreamSlot(MusicStreamSlot *slot)
+{
+    Music *music = &slot->music;
+    AudioBuffer *buffer = music->stream.buffer;
+
+    unsigned int frameSize = music->stream.channels*music->stream.sampleSize/8;
+    unsigned int subBufferSizeInFrames = buffer->sizeInFrames/2;
+
+    // Stream changes requested by the game thread (i.e. stop) must be applied before refilling it
+    bool refill = !IsAudioCommandPending(buffer) && !buffer->isStreamEnding;
+
+    while (!slot->decoderEnded && (slot->frameCount < slot->frameCapacity))
+    {
+        if (slot->framesDecoded >= music->frameCount)
+        {
+            SeekMusicStreamDecoder(*music, 0);
+            slot->framesDecoded = 0;
+
+            // Looping music continues decoding from start, without gaps
+            if (!music->looping)
+            {
+                slot->decoderEnded = true;
+                break;
+            }
+        }
+
+        unsigned int frameWrite = (slot->frameRead + slot->frameCount)%slot->frameCapacity;
+        unsigned int framesToDecode = slot->frameCapacity - slot->frameCount;
+
+        if (framesToDecode > (slot->frameCapacity - frameWrite)) framesToDecode = slot->frameCapacity - frameWrite;
+        if (framesToDecode > (music->frameCount - slot->framesDecoded)) framesToDecode = music->frameCount - slot->framesDecoded;
+        if (framesToDecode > subBufferSizeInFrames) framesToDecode = subBufferSizeInFrames;
+
+        ReadMusicStreamFrames(*music, slot->frames + frameWrite*frameSize, framesToDecode);
+
+        slot->frameCount += framesToDecode;
+        slot->framesDecoded += framesToDecode;
+
+        // Keep decoding only while a processed sub-buffer is waiting for data
+        if (!(refill && IsAudioStreamProcessed(music->stream) && (slot->frameCount < subBufferSizeInFrames))) break;
+    }
+
+    while (refill && IsAudioStreamProcessed(music->stream))
+    {
+        unsigned int frameCount = (slot->frameCount < subBufferSizeInFrames)? slot->frameCount : subBufferSizeInFrames;
+
+        if (frameCount == 0)
+        {
+            // Music ended, mixer stops the stream once queued sub-buffers are played
+            if (slot->decoderEnded) buffer->isStreamEnding = true;
+            break;
+        }
+        else if ((frameCount < subBufferSizeInFrames) && !slot->decoderEnded) break;   // Wait for more frames decoded
+
+        // Copy frames from ring buffer, it could wrap around
+        unsigned int firstFrameCount = slot->frameCapacity - slot->frameRead;
+        if (firstFrameCount > frameCount) firstFrameCount = frameCount;
+
+        memcpy(slot->pcm, slot->frames + slot->frameRead*frameSize, firstFrameCount*frameSize);
+        memcpy((unsigned char *)slot->pcm + firstFrameCount*frameSize, slot->frames, (frameCount - firstFrameCount)*frameSize);
+
+        UpdateAudioStream(music->stream, slot->pcm, frameCount);
+
+        slot->frameRead = (slot->frameRead + frameCount)%slot->frameCapacity;
+        slot->frameCount -= frameCount;
+
+        // Looping music played time restarts with the loop
+        if (music->looping && (buffer->framesProcessed >= music->frameCount)) buffer->framesProcessed -= music->frameCount;
+    }
+}
+
+// Music stream thread entry point
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data)
+{
+    (void)data;
+
+    while (c89atomic_load_32(&AUDIO.MusicThread.isRunning))
+    {
+        ma_mutex_lock(&AUDIO.MusicThread.lock);
+        {
+            for (int i = 0; i < AUDIO.MusicThread.slotCount; i++) UpdateMusicStreamSlot(&AUDIO.MusicThread.slots[i]);
+        }
+        ma_mutex_unlock(&AUDIO.MusicThread.lock);
+
+        ma_sleep(MUSIC_STREAM_THREAD_SLEEP);
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Get multichannel voice index from id, -1 if not playing
+static int GetAudioVoiceIndex(int voice)
+{
+    if (voice <= 0) return -1;
+
+    for (int i = 0; i < AUDIO.MultiChannel.voiceCount; i++)
+    {
+        if (AUDIO.MultiChannel.voices[i].id == (unsigned int)voice) return i;
+    }
+
+    return -1;
+}
+
+// Free multichannel voice, stopping its pool channel
+static void FreeAudioVoice(int index)
+{
+    AudioVoice *voice = &AUDIO.MultiChannel.voices[index];
+
+    if (voice->channel != -1)
+    {
+        StopAudioBuffer(AUDIO.MultiChannel.pool[voice->channel]);
+        AUDIO.MultiChannel.channels[voice->channel] = -1;
+    }
+
+    voice->id = 0;
+    voice->sound = NULL;
+    voice->channel = -1;
+}
+
+// Compute spatial voice volume, pan and doppler pitch from listener, changed values are sent to its pool channel
+// NOTE: Inverse distance attenuation faded to silence at maxDistance, equal power panning is applied by the mixer
+static void UpdateAudioVoiceSpatial(AudioVoice *voice)
+{
+    Vector3 *listener = &AUDIO.Listener.position;
+    Vector3 delta = { voice->position.x - listener->x, voice->position.y - listener->y, voice->position.z - listener->z };
+    float distance = sqrtf(delta.x*delta.x + delta.y*delta.y + delta.z*delta.z);
+
+    float attenuation = 1.0f;
+    if (distance >= voice->maxDistance) attenuation = (distance > voice->minDistance)? 0.0f : 1.0f;
+    else if (distance > voice->minDistance) attenuation = (voice->minDistance/distance)*(voice->maxDistance - distance)/(voice->maxDistance - voice->minDistance);
+
+    float pan = 0.5f;
+    float doppler = 1.0f;
+
+    if (distance > 0.0f)
+    {
+        Vector3 direction = { delta.x/distance, delta.y/distance, delta.z/distance };
+
+        // Listener right direction: forward x up
+        Vector3 *forward = &AUDIO.Listener.forward;
+        Vector3 *up = &AUDIO.Listener.up;
+        Vector3 right = { forward->y*up->z - forward->z*up->y, forward->z*up->x - forward->x*up->z, forward->x*up->y - forward->y*up->x };
+        float length = sqrtf(right.x*right.x + right.y*right.y + right.z*right.z);
+
+        // NOTE: Pan 1.0f is full left channel
+        if (length > 0.0f) pan = 0.5f - 0.5f*(direction.x*right.x + direction.y*right.y + direction.z*right.z)/length;
+
+        // Doppler: listener and emitter velocities along the line between them
+        Vector3 *velocity = &AUDIO.Listener.velocity;
+        float listenerSpeed = velocity->x*direction.x + velocity->y*direction.y + velocity->z*direction.z;
+        float emitterSpeed = voice->velocity.x*direction.x + voice->velocity.y*direction.y + voice->velocity.z*direction.z;
+
+        if ((AUDIO_SPEED_OF_SOUND + emitterSpeed) > 0.0f) doppler = (AUDIO_SPEED_OF_SOUND + listenerSpeed)/(AUDIO_SPEED_OF_SOUND + emitterSpeed);
+        if (doppler > AUDIO_DOPPLER_MAX_PITCH) doppler = AUDIO_DOPPLER_MAX_PITCH;
+        else if (doppler < 1.0f/AUDIO_DOPPLER_MAX_PITCH) doppler = 1.0f/AUDIO_DOPPLER_MAX_PITCH;
+    }
+
+    voice->volume = voice->gain*attenuation;
+    voice->pan = pan;
+    voice->doppler = doppler;
+
+    // Mixer ramps levels between periods, small changes are not sent
+    if (voice->channel != -1)
+    {
+        AudioBuffer *buffer = AUDIO.MultiChannel.pool[voice->channel];
+
+        if (fabsf(buffer->request.volume - voice->volume) > 0.001f) SetAudioBufferVolume(buffer, voice->volume);
+        if (fabsf(buffer->request.pan - voice->pan) > 0.001f) SetAudioBufferPan(buffer, voice->pan);
+        if (fabsf(buffer->request.pitch - voice->pitch*voice->doppler) > 0.001f) SetAudioBufferPitch(buffer, voice->pitch*voice->doppler);
+    }
+}
+
+// Decode compressed sound frames at cursor position, cached head frames are copied
+// NOTE: Decoder is only used by the mixer while the sound is playing, it seeks only when cursor
+// does not match the decoder position (sound restarted or head frames copied from cache)
+static ma_uint32 ReadAudioDecoderFrames(AudioBuffer *buffer, void *framesOut, ma_uint32 frameCount)
+{
+    rAudioDecoder *decoder = buffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
+
+    while (framesRead < frameCount)
+    {
+        if (buffer->frameCursorPos >= buffer->sizeInFrames)
+        {
+            if (buffer->looping) buffer->frameCursorPos = 0;
+            else
+            {
+                ResetAudioBuffer(buffer);
+                break;
+            }
+        }
+
+        ma_uint32 framesToRead = frameCount - framesRead;
+        if (framesToRead > (buffer->sizeInFrames - buffer->frameCursorPos)) framesToRead = buffer->sizeInFrames - buffer->frameCursorPos;
+
+        unsigned char *frames = (unsigned char *)framesOut + framesRead*frameSizeInBytes;
+
+        if ((decoder->head != NULL) && (buffer->frameCursorPos < decoder->headFrames))
+        {
+            if (framesToRead > (decoder->headFrames - buffer->frameCursorPos)) framesToRead = decoder->headFrames - buffer->frameCursorPos;
+
+            memcpy(frames, decoder->head + buffer->frameCursorPos*frameSizeInBytes, framesToRead*frameSizeInBytes);
+        }
+        else
+        {
+            if (decoder->position != buffer->frameCursorPos)
+            {
+                if (buffer->frameCursorPos <= decoder->headFrames)
+                {
+                    // Decoders frame seek is not sample accurate for every format (OGG),
+                    // head end is reached decoding from start to avoid a gap after head frames
+                    SeekMusicStreamDecoder(decoder->music, 0);
+                    decoder->position = 0;
+
+                    while (decoder->position < buffer->frameCursorPos)
+                    {
+                        ma_uint32 framesToSkip = buffer->frameCursorPos - decoder->position;
+                        if (framesToSkip > framesToRead) framesToSkip = framesToRead;
+
+                        ReadMusicStreamFrames(decoder->music, frames, framesToSkip);
+                        decoder->position += framesToSkip;
+                    }
+                }
+                else
+                {
+                    SeekMusicStreamDecoder(decoder->music, buffer->frameCursorPos);
+                    decoder->position = buffer->frameCursorPos;
+                }
+            }
+
+            ReadMusicStreamFrames(decoder->music, frames, framesToRead);
+            decoder->position += framesToRead;
+        }
+
+        buffer->frameCursorPos += framesToRead;
+        framesRead += framesToRead;
+    }
+
+    // Zero-fill excess, not reported as read to let the caller detect the end of the sound
+    if (framesRead < frameCount) memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+    return framesRead;
+}
+
+// Decode compressed sound head into heads cache, least recently played heads are released to fit it
+// NOTE: Decoder is only used here while the mixer is not playing the sound, if the sound is still
+// playing (restarted) its head is not decoded this time and the mixer decodes it from the start
+static void LoadAudioDecoderHead(rAudioDecoder *decoder)
+{
+    AudioBuffer *buffer = decoder->music.stream.buffer;
+
+    decoder->lastPlayed = ++AUDIO.SoundCache.counter;
+
+    if (decoder->head != NULL) return;
+    if (IsAudioBufferPlaying(buffer) || IsAudioCommandPending(buffer)) return;
+
+    unsigned int headFrames = (buffer->sizeInFrames < AUDIO_SOUND_HEAD_FRAMES)? buffer->sizeInFrames : AUDIO_SOUND_HEAD_FRAMES;
+    unsigned int headSize = headFrames*decoder->music.stream.channels*decoder->music.stream.sampleSize/8;
+
+    if (headSize > AUDIO_SOUND_HEAD_CACHE_SIZE) return;
+
+    while ((AUDIO.SoundCache.size + headSize) > AUDIO_SOUND_HEAD_CACHE_SIZE)
+    {
+        rAudioDecoder *oldest = NULL;
+
+        for (rAudioDecoder *cached = AUDIO.SoundCache.first; cached != NULL; cached = cached->next)
+        {
+            AudioBuffer *cachedBuffer = cached->music.stream.buffer;
+
+            // Heads of sounds playing (or about to) are still read by the mixer
+            if ((cached->head == NULL) || IsAudioBufferPlaying(cachedBuffer) || IsAudioCommandPending(cachedBuffer)) continue;
+            if ((oldest == NULL) || ((ma_int32)(cached->lastPlayed - oldest->lastPlayed) < 0)) oldest = cached;
+        }
+
+        if (oldest == NULL) return;     // Cache full of playing sounds heads
+
+        UnloadAudioDecoderHead(oldest);
+    }
+
+    unsigned char *head = (unsigned char *)RL_MALLOC(headSize);
+
+    SeekMusicStreamDecoder(decoder->music, 0);
+    ReadMusicStreamFrames(decoder->music, head, headFrames);
+    decoder->position = headFrames;
+
+    // Head is published to the mixer by the play command
+    decoder->head = head;
+    decoder->headFrames = headFrames;
+    AUDIO.SoundCache.size += headSize;
+}
+
+// Release compressed sound head from heads cache
+static void UnloadAudioDecoderHead(rAudioDecoder *decoder)
+{
+    if (decoder->head == NULL) return;
+
+    AUDIO.SoundCache.size -= decoder->headFrames*decoder->music.stream.channels*decoder->music.stream.sampleSize/8;
+
+    RL_FREE(decoder->head);
+    decoder->head = NULL;
+    decoder->headFrames = 0;
+}
+
+// Push command into the mixer commands queue
+// NOTE: Only the game thread pushes commands (single producer), waits for the mixer if queue is full
+static void PushAudioCommand(AudioCommand command)
+{
+    WaitAudioCommands(AUDIO_COMMAND_QUEUE_SIZE - 1);
+
+    AudioBuffer *buffer = command.buffer;
+
+    // Requested state starts from the mixer state once previous commands have been applied,
+    // mixer could have stopped the buffer by itself when reaching the end of the data
+    if ((buffer != NULL) && !IsAudioCommandPending(buffer))
+    {
+        buffer->request.playing = buffer->playing;
+        buffer->request.paused = buffer->paused;
+    }
+
+    ma_uint32 head = AUDIO.Command.head;
+    AUDIO.Command.queue[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+    if (buffer != NULL) buffer->request.sequence = head + 1;
+
+    // Command must be fully written before it is visible to the mixer
+    c89atomic_store_explicit_32(&AUDIO.Command.head, head + 1, c89atomic_memory_order_release);
+}
+
+// Wait until no more than maxPending commands are waiting to be applied by the mixer
+// NOTE: If the device is not running, the commands are applied on the calling thread
+static void WaitAudioCommands(ma_uint32 maxPending)
+{
+    while ((AUDIO.Command.head - c89atomic_load_explicit_32(&AUDIO.Command.tail, c89atomic_memory_order_acquire)) > maxPending)
+    {
+        ma_device_state state = ma_device_get_state(&AUDIO.System.device);
+
+        if ((state == ma_device_state_uninitialized) || (state == ma_device_state_stopped)) ProcessAudioCommands();
+        else ma_sleep(1);
+    }
+}
+
+// Check if audio buffer has commands still not applied by the mixer
+static bool IsAudioCommandPending(AudioBuffer *buffer)
+{
+    ma_uint32 tail = c89atomic_load_explicit_32(&AUDIO.Command.tail, c89atomic_memory_order_acquire);
+
+    // NOTE: Sequence numbers wrap around, difference is checked as signed
+    return ((ma_int32)(buffer->request.sequence - tail) > 0);
+}
+
+// Apply all commands available on the queue
+// NOTE: Only called by the mixer thread (single consumer) or when the device is not running
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 tail = AUDIO.Command.tail;
+    ma_uint32 head = c89atomic_load_explicit_32(&AUDIO.Command.head, c89atomic_memory_order_acquire);
+
+    while (tail != head)
+    {
+        AudioCommand *command = &AUDIO.Command.queue[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+        AudioBuffer *buffer = command->buffer;
+
+        switch (command->type)
+        {
+            case AUDIO_COMMAND_TRACK:
+            {
+                if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+                else
+                {
+                    AUDIO.Buffer.last->next = buffer;
+                    buffer->prev = AUDIO.Buffer.last;
+                }
+
+                AUDIO.Buffer.last = buffer;
+            } break;
+            case AUDIO_COMMAND_UNTRACK:
+            {
+                if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+                else buffer->prev->next = buffer->next;
+
+                if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+                else buffer->next->prev = buffer->prev;
+
+                buffer->prev = NULL;
+                buffer->next = NULL;
+            } break;
+            case AUDIO_COMMAND_PLAY:
+            {
+                buffer->playing = true;
+                buffer->paused = false;
+                if (command->value == 0.0f)
+                {
+                    buffer->frameCursorPos = 0;
+                    buffer->frameCursorFraction = 0.0f;
+                    buffer->mixLevels[0] = -1.0f;   // No levels ramp on playing start
+                }
+            } break;
+            case AUDIO_COMMAND_STOP: if (buffer->playing && !buffer->paused) ResetAudioBuffer(buffer); break;
+            case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+            case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+            case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+            case AUDIO_COMMAND_PITCH:
+            {
+                // Pitching is just an adjustment of the sample rate.
+                // Note that this changes the duration of the sound:
+                //  - higher pitches will make the sound faster
+                //  - lower pitches make it slower
+                ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+                buffer->pitch = command->value;
+            } break;
+            case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+            case AUDIO_COMMAND_DATA:
+            {
+                buffer->data = command->data;
+                buffer->sizeInFrames = command->frames;
+                buffer->looping = (command->value != 0.0f);
+                buffer->isSubBufferProcessed[0] = false;
+                buffer->isSubBufferProcessed[1] = false;
+            } break;
+            case AUDIO_COMMAND_SEEK:
+            {
+                buffer->frameCursorPos = (command->frames < buffer->sizeInFrames)? command->frames : 0;
+                buffer->frameCursorFraction = 0.0f;
+            } break;
+            case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+            case AUDIO_COMMAND_ATTACH_PROCESSOR:
+            {
+                rAudioProcessor **chain = (buffer != NULL)? &buffer->processor : &AUDIO.Bus.buses[command->bus].processor;
+                rAudioProcessor *last = *chain;
+
+                while (last && last->next) last = last->next;
+
+                if (last)
+                {
+                    command->processor->prev = last;
+                    last->next = command->processor;
+                }
+                else *chain = command->processor;
+            } break;
+            case AUDIO_COMMAND_DETACH_PROCESSOR:
+            {
+                rAudioProcessor **chain = (buffer != NULL)? &buffer->processor : &AUDIO.Bus.buses[command->bus].processor;
+                rAudioProcessor *processor = command->processor;
+
+                if (*chain == processor) *chain = processor->next;
+                if (processor->prev) processor->prev->next = processor->next;
+                if (processor->next) processor->next->prev = processor->prev;
+            } break;
+            case AUDIO_COMMAND_BUS: buffer->bus = command->bus; break;
+            case AUDIO_COMMAND_LOAD_BUS:
+            {
+                AUDIO.Bus.buses[command->bus].volume = 1.0f;
+                AUDIO.Bus.buses[command->bus].active = true;
+            } break;
+            case AUDIO_COMMAND_UNLOAD_BUS:
+            {
+                AUDIO.Bus.buses[command->bus].active = false;
+
+                for (AudioBuffer *routed = AUDIO.Buffer.first; routed != NULL; routed = routed->next)
+                {
+                    if (routed->bus == command->bus) routed->bus = 0;
+                }
+            } break;
+            case AUDIO_COMMAND_BUS_VOLUME: AUDIO.Bus.buses[command->bus].volume = command->value; break;
+            default: break;
+        }
+
+        tail++;
+    }
+
+    // Commands must be fully applied before the game thread sees them completed
+    c89atomic_store_explicit_32(&AUDIO.Command.tail, tail, c89atomic_memory_order_release);
+}
+
+// Stop audio buffer and reset its playing position
+static void ResetAudioBuffer(AudioBuffer *buffer)
+{
+    buffer->playing = false;
+    buffer->paused = false;
+    buffer->frameCursorPos = 0;
+    buffer->frameCursorFraction = 0.0f;
+    buffer->framesProcessed = 0;
+    buffer->isSubBufferProcessed[0] = true;
+    buffer->isSubBufferProcessed[1] = true;
+
+    // Ring stream committed frames are dropped
+    if (buffer->usage == AUDIO_BUFFER_USAGE_RING) c89atomic_store_explicit_32(&buffer->ringRead, c89atomic_load_explicit_32(&buffer->ringWrite, c89atomic_memory_order_acquire), c89atomic_memory_order_release);
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
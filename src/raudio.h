@@ -78,6 +78,16 @@
     #endif
 #endif
 
+#if !defined(RL_VECTOR3_TYPE)
+// Vector3, 3 components
+typedef struct Vector3 {
+    float x;                    // Vector x component
+    float y;                    // Vector y component
+    float z;                    // Vector z component
+} Vector3;
+#define RL_VECTOR3_TYPE
+#endif
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -114,6 +124,39 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// AudioMixerStats, audio mixer thread stats (counters wrap around, compare two stats for deltas)
+typedef struct AudioMixerStats {
+    unsigned int periods;       // Device periods mixed
+    unsigned int frames;        // Frames mixed
+    unsigned int voices;        // Audio buffers mixed on last period (sounds, multichannel voices and streams)
+    unsigned int lastMixTime;   // Last period mixing time (in microseconds)
+    unsigned int mixTime;       // Total mixing time (in microseconds)
+    unsigned int lateCallbacks; // Device callbacks later than expected period interval
+    unsigned int underruns;     // Device callbacks after device buffer was drained (estimated from callbacks timing)
+    unsigned int budgetTime;    // Last period mixing time budget, period duration (in microseconds)
+    float load;                 // Last period DSP load, mixing time over budget (1.0f: mixing takes the whole period)
+    float loadAverage;          // DSP load average over last load window
+    float loadPeak;             // DSP load peak over last load window
+    unsigned int activeVoices;  // Multichannel voices mixed on a pool channel
+    unsigned int virtualVoices; // Multichannel voices audible but not mixed, pool channels used by higher priority voices
+    unsigned int culledVoices;  // Multichannel voices not mixed, attenuated below audible volume (distance)
+} AudioMixerStats;
+
+// AudioDeviceConfig, audio device init parameters, zero values use backend defaults
+typedef struct AudioDeviceConfig {
+    unsigned int sampleRate;    // Device sample rate
+    unsigned int periodFrames;  // Device period size (in frames), data callback size
+    unsigned int periods;       // Device periods count, buffered periods
+    bool lowLatency;            // Low latency performance profile (smaller default periods)
+} AudioDeviceConfig;
+
+// AudioEmitter, spatial multichannel voice position update (UpdateAudioEmitters())
+typedef struct AudioEmitter {
+    int voice;                  // Spatial voice id (PlaySoundMulti3D())
+    Vector3 position;           // Emitter position
+    Vector3 velocity;           // Emitter velocity (units per second, doppler effect)
+} AudioEmitter;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -132,12 +175,17 @@ void InitAudioDevice(void);                                     // Initialize au
 void CloseAudioDevice(void);                                    // Close the audio device and context
 bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 void SetMasterVolume(float volume);                             // Set master volume (listener)
+AudioMixerStats GetAudioMixerStats(void);                       // Get audio mixer thread stats (periods, frames, DSP load, voices and mixing time)
+void SetAudioDeviceConfig(AudioDeviceConfig config);            // Set audio device config: sample rate, periods and latency profile (before InitAudioDevice())
+AudioDeviceConfig GetAudioDeviceConfig(void);                   // Get audio device config, actual device values once initialized
 
 // Wave/Sound loading/unloading functions
 Wave LoadWave(const char *fileName);                            // Load wave data from file
 Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. ".wav"
 Sound LoadSound(const char *fileName);                          // Load sound from file
 Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+Sound LoadSoundCompressed(const char *fileName);               // Load sound from file, keeping compressed data in memory (decoded while playing)
+Sound LoadSoundCompressedFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load sound from compressed file data (decoded while playing)
 void UpdateSound(Sound sound, const void *data, int samplesCount);// Update sound buffer with new data
 void UnloadWave(Wave wave);                                     // Unload wave data
 void UnloadSound(Sound sound);                                  // Unload sound
@@ -152,13 +200,24 @@ void ResumeSound(Sound sound);                                  // Resume a paus
 void PlaySoundMulti(Sound sound);                               // Play a sound (using multichannel buffer pool)
 void StopSoundMulti(void);                                      // Stop any sound playing (using multichannel buffer pool)
 int GetSoundsPlaying(void);                                     // Get number of sounds playing in the multichannel
+int PlaySoundMultiEx(Sound sound, float volume, float pan);     // Play a sound with attenuation volume and pan, returns voice id (using multichannel buffer pool)
+void StopSoundMultiVoice(int voice);                            // Stop a multichannel voice
+bool IsSoundMultiVoicePlaying(int voice);                       // Check if a multichannel voice is playing (mixed or virtual)
+void SetSoundMultiVolume(int voice, float volume);              // Set attenuation volume for a multichannel voice, inaudible voices are not mixed
+void SetSoundMultiPan(int voice, float pan);                    // Set pan for a multichannel voice
+void SetSoundPriority(Sound sound, int priority);               // Set sound priority for multichannel voices (higher priority is mixed first)
+void UpdateSoundMulti(void);                                    // Update multichannel voices, promotes virtual voices when channels get available
+int PlaySoundMulti3D(Sound sound, Vector3 position, float minDistance, float maxDistance); // Play a sound at 3D position, returns spatial voice id (using multichannel buffer pool)
+void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set 3D audio listener, applied to spatial voices by UpdateAudioEmitters()
+void UpdateAudioEmitters(const AudioEmitter *emitters, int count); // Update spatial voices positions in one batch, attenuation, pan and doppler computed from listener
 bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.0 to 1.0, 0.5=center)
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
+void WaveFormatMany(Wave *waves, int count, int sampleRate, int sampleSize, int channels); // Convert waves data to desired format
 Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
-void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
+void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range (in place)
 float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a floats array
 void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
 
@@ -175,9 +234,12 @@ void ResumeMusicStream(Music music);                            // Resume playin
 void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
 void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 void SetMusicPan(Music sound, float pan);                       // Set pan for a music (0.0 to 1.0, 0.5=center)
+void SetMusicQuality(Music music, int quality);                 // Set music module (XM/MOD) resampling quality (0=nearest, 1=linear, 2=cubic)
 void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+void EnableMusicStreamThread(float lookahead);                  // Decode music streams on a background thread, UpdateMusicStream() not required
+void DisableMusicStreamThread(void);                            // Stop decoding music streams on a background thread
 
 // AudioStream management functions
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
@@ -193,6 +255,16 @@ void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume fo
 void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
 void SetAudioStreamPan(AudioStream strean, float pan);          // Set pan for audio stream  (0.0 to 1.0, 0.5=center)
 void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
+unsigned int GetAudioStreamMixTime(AudioStream stream);         // Get audio stream total mixing time, processors included (in microseconds)
+
+// Audio mixer buses management functions
+int LoadAudioBus(const char *name);                           // Load audio mixer bus (or get it if already loaded), mixed into master bus (0)
+void UnloadAudioBus(int bus);                                 // Unload audio mixer bus, routed sounds and streams go back to master bus
+int GetAudioBus(const char *name);                            // Get audio mixer bus by name, -1 if not loaded
+void SetAudioBusVolume(int bus, float volume);                // Set audio mixer bus volume (1.0 is max level)
+void SetSoundBus(Sound sound, int bus);                       // Route sound to audio mixer bus
+void SetMusicBus(Music music, int bus);                       // Route music to audio mixer bus
+void SetAudioStreamBus(AudioStream stream, int bus);          // Route audio stream to audio mixer bus
 
 #ifdef __cplusplus
 }
@@ -40,7 +40,6 @@
 *       [rtextures] stb_image_resize (Sean Barret) for image resizing algorithms
 *       [rtext] stb_truetype (Sean Barret) for ttf fonts loading
 *       [rtext] stb_rect_pack (Sean Barret) for rectangles packing
-*       [rmodels] par_shapes (Philip Rideout) for parametric 3d shapes generation
 *       [rmodels] tinyobj_loader_c (Syoyo Fujita) for models loading (OBJ, MTL)
 *       [rmodels] cgltf (Johannes Kuhlmann) for models loading (glTF)
 *       [raudio] dr_wav (David Reid) for WAV audio file loading
@@ -241,6 +240,15 @@ typedef struct Image {
     int format;             // Data format (PixelFormat type)
 } Image;
 
+// ImageView, non-owning view of image pixels rectangle (pixels are not copied)
+typedef struct ImageView {
+    const void *data;       // View first pixel (referenced image data, not owned)
+    int stride;             // Bytes between consecutive rows
+    int width;              // View width
+    int height;             // View height
+    int format;             // Data format (PixelFormat type), uncompressed formats only
+} ImageView;
+
 // Texture, tex data stored in GPU memory (VRAM)
 typedef struct Texture {
     unsigned int id;        // OpenGL texture id
@@ -256,6 +264,22 @@ typedef Texture Texture2D;
 // TextureCubemap, same as Texture
 typedef Texture TextureCubemap;
 
+// TextureArray, layered texture, data stored in GPU memory (VRAM)
+typedef struct TextureArray {
+    unsigned int id;        // OpenGL texture id
+    int width;              // Texture base width
+    int height;             // Texture base height
+    int layers;             // Texture layers (texture array) or slices (3D texture)
+    int mipmaps;            // Mipmap levels, 1 by default
+    int format;             // Data format (PixelFormat type)
+} TextureArray;
+
+// Texture2DArray, same as TextureArray (sampler2DArray)
+typedef TextureArray Texture2DArray;
+
+// Texture3D, same as TextureArray (sampler3D)
+typedef TextureArray Texture3D;
+
 // RenderTexture, fbo for texture rendering
 typedef struct RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -276,6 +300,41 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteRef, sprite reference: atlas page texture and sprite rectangle
+typedef struct SpriteRef {
+    Texture2D texture;      // Atlas page texture containing the sprite
+    Rectangle source;       // Sprite rectangle in atlas page (padding excluded)
+} SpriteRef;
+
+// SpriteInstance, compact sprite data drawn as one instance (DrawSpriteInstances()), 32 bytes
+typedef struct SpriteInstance {
+    Vector2 position;       // Sprite center position
+    Vector2 size;           // Sprite size, negative width/height flips the sprite horizontally/vertically
+    float rotation;         // Sprite rotation around its center (degrees)
+    unsigned short source[4];   // Texture source rectangle (pixels): x, y, width, height
+    Color tint;             // Sprite tint
+} SpriteInstance;
+
+// SpriteAtlas, sprites packed into one or more atlas pages
+typedef struct SpriteAtlas {
+    int pageCount;          // Atlas pages count
+    Texture2D *pages;       // Atlas pages textures
+    int spriteCount;        // Sprites count
+    SpriteRef *sprites;     // Sprites references, same order as source images (empty texture if not packed)
+} SpriteAtlas;
+
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rtextures module
+typedef struct rTextureAnimStream rTextureAnimStream;
+
+// TextureAnim, animated texture, frames are decoded on playback (GIF)
+typedef struct TextureAnim {
+    Texture2D texture;              // Texture with current frame
+    int frameCount;                 // Animation frames count
+    int currentFrame;               // Current frame shown on texture
+    rTextureAnimStream *stream;     // Frames decoding stream (NULL for single frame textures)
+} TextureAnim;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -285,6 +344,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphCache rGlyphCache;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -293,8 +356,21 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    int *glyphMap;          // Codepoint to glyph index hash table (built on font loading, optional)
+    rGlyphCache *cache;     // Pointer to internal glyphs cache, only for dynamic fonts (glyphs rasterized on demand)
+    int type;               // Font glyphs type (FontType), SDF fonts are drawn with built-in SDF shader
 } Font;
 
+// TextLayout, precomputed text glyphs quads for static text drawing
+typedef struct TextLayout {
+    Texture2D texture;      // Font texture atlas referenced by glyphs
+    int glyphCount;         // Number of glyphs quads
+    float *quads;           // Glyphs quads: pen position (xy), offset (xy), size (wh), texcoords (u0v0, u1v1)
+    int lineCount;          // Number of text lines
+    int *lines;             // First glyph index of every line
+    Rectangle bounds;       // Text bounding box (relative to drawing position)
+} TextLayout;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -314,6 +390,16 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// CameraMatrices, camera transforms computed once (per camera and frame) for screen-space functions
+typedef struct CameraMatrices {
+    Matrix view;            // View matrix (camera transform)
+    Matrix projection;      // Projection matrix (identity for 2d cameras)
+    Matrix worldToScreen;   // World to screen pixels transform (3d: homogeneous, divided by w)
+    Matrix screenToWorld;   // Screen pixels to world transform (worldToScreen inverse)
+    int width;              // Screen width used for viewport transform
+    int height;             // Screen height used for viewport transform
+} CameraMatrices;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -333,18 +419,75 @@ typedef struct Mesh {
     float *animNormals;     // Animated normals (after bones transformations)
     unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    Matrix *boneMatrices;   // Bones animated transformation matrices (GPU skinning)
+    int boneCount;          // Number of bones matrices
+
+    // Cached bounds (object space, computed on UploadMesh()/UpdateMeshBounds())
+    Vector3 boundsMin;      // Bounding box minimum vertex
+    Vector3 boundsMax;      // Bounding box maximum vertex
+    float boundsRadius;     // Bounding sphere radius (centered on bounding box), 0 if bounds not computed
+
+    // Quantized vertex data (set on UploadMesh(), see SetMeshQuantization())
+    unsigned int quantization;  // Quantized vertex attributes uploaded to GPU (MeshQuantizeFlags), 0 if all float
+    Vector3 quantizeOffset;     // Quantized positions offset (bounding box center)
+    float quantizeScale;        // Quantized positions scale (bounding box largest half extent)
+
+    // Interleaved vertex data (set on UploadMesh(), see SetMeshInterleaving())
+    int vertexStride;           // Interleaved vertex size in bytes (all attributes stored in vboId[0]), 0 if one buffer per attribute
+    int vertexOffsets[6];       // Interleaved attributes offsets (shader-locations 0 to 5), -1 if attribute not available
+
+    // Morph targets data (blend shapes, see SetMeshMorphWeights())
+    int morphTargetCount;       // Number of morph targets
+    float *morphVertices;       // Morph targets position deltas (XYZ, morphTargetCount deltas per vertex, stored by vertex)
+    float *morphNormals;        // Morph targets normal deltas (XYZ, morphTargetCount deltas per vertex, stored by vertex)
+    float *morphWeights;        // Morph targets current weights
+    unsigned int morphTextureId;    // Morph targets deltas texture (GPU morphing), 0 if morph targets are blended on CPU
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } Mesh;
 
+// InstanceBuffer, per-instance data for instanced mesh drawing
+typedef struct InstanceBuffer {
+    int instanceCount;      // Number of instances stored (highest updated instance + 1)
+    int capacity;           // Number of instances buffers can store (grows on updates)
+
+    // Instance attributes data
+    Matrix *transforms;     // Instance transforms (shader-location = SHADER_LOC_MATRIX_MODEL)
+    Color *colors;          // Instance colors, optional (shader-location = SHADER_LOC_INSTANCE_COLOR)
+    Vector4 *custom;        // Instance custom data, optional (shader-location = SHADER_LOC_INSTANCE_CUSTOM)
+
+    // OpenGL identifiers
+    unsigned int vboId[3];  // OpenGL Vertex Buffer Objects id (transforms, colors, custom)
+} InstanceBuffer;
+
 // Shader
 typedef struct Shader {
     unsigned int id;        // Shader program id
     int *locs;              // Shader locations array (RL_MAX_SHADER_LOCATIONS)
 } Shader;
 
+// PostEffect, post-processing chain effect: shader pass or per-pixel color effect
+typedef struct PostEffect {
+    Shader shader;          // Pass shader, generated shader for first color effect of a fused run
+    char *code;             // Color effect GLSL code (modifies 'color', reads 'uv' and 'params'), NULL for shader passes
+    Vector4 params;         // Color effect parameters
+    int paramsLoc;          // Fused color effects parameters uniform location
+    float scale;            // Pass resolution scale (1.0f: full resolution, 0.5f: half resolution)
+} PostEffect;
+
+// PostProcess, post-processing chain drawn through pooled render textures
+typedef struct PostProcess {
+    int width;              // Scene render texture width
+    int height;             // Scene render texture height
+    int format;             // Render textures pixel format (PixelFormat type)
+    int effectCount;        // Effects count
+    PostEffect *effects;    // Effects, applied in order
+    RenderTexture2D target; // Scene render texture (transient, between BeginPostProcess() and EndPostProcess())
+    bool dirty;             // Color effects changed, fused shaders must be generated again
+} PostProcess;
+
 // MaterialMap
 typedef struct MaterialMap {
     Texture2D texture;      // Material map texture
@@ -386,16 +529,88 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+
+    // Levels of detail data
+    int lodCount;           // Number of simplified levels of detail (base meshes not included)
+    Mesh *lodMeshes;        // LOD meshes array (lodCount*meshCount), level n meshes start at (n - 1)*meshCount, empty if not simplified
+    float *lodScreenSizes;  // LOD level n is drawn when model projected height (fraction of screen) is under lodScreenSizes[n - 1]
 } Model;
 
+// ModelAnimationTrack, compressed animation channel (translation, rotation or scale of one bone)
+typedef struct ModelAnimationTrack {
+    int keyCount;           // Number of keys (1 for constant tracks)
+    int firstKey;           // First key index in animation keys arrays
+    Vector3 offset;         // Dequantization offset (translation/scale)
+    Vector3 range;          // Dequantization step (translation/scale)
+} ModelAnimationTrack;
+
 // ModelAnimation
 typedef struct ModelAnimation {
     int boneCount;          // Number of bones
     int frameCount;         // Number of animation frames
     BoneInfo *bones;        // Bones information (skeleton)
-    Transform **framePoses; // Poses array by frame
+    Transform **framePoses; // Poses array by frame (NULL if compressed)
+
+    // Compressed animation data, see CompressModelAnimation()
+    ModelAnimationTrack *tracks;    // Tracks by bone (boneCount*3: translation, rotation, scale)
+    unsigned short *keyFrames;      // Keys frame index
+    unsigned short *keyValues;      // Keys quantized values (3 per key, rotations smallest-three encoded)
 } ModelAnimation;
 
+// ModelPose, animation pose buffer to sample and blend animations
+typedef struct ModelPose {
+    int boneCount;          // Number of bones
+    Transform *transforms;  // Bones transforms (model space)
+    Matrix *matrices;       // Bones skinning matrices, cached by UpdateModelPose()
+} ModelPose;
+
+// AnimationTexture, model animations bones matrices baked into a float texture (instanced crowds)
+typedef struct AnimationTexture {
+    unsigned int id;        // OpenGL texture id (0 if not supported)
+    int boneCount;          // Number of bones by frame
+    int frameCount;         // Number of frames (all animations)
+    int animCount;          // Number of animations
+    int *animFrames;        // Animations first frame and frames count (animCount*2)
+} AnimationTexture;
+
+// AnimatedModel, animated model instance updated by animation scheduler
+typedef struct AnimatedModel {
+    Model model;            // Skinned model (meshes can be shared by several animated models)
+    ModelAnimation anim;    // Playing animation
+    Matrix transform;       // Model transform (world space), applied after model.transform
+    float frame;            // Current animation frame (fractional, looped)
+    float frameRate;        // Animation playback rate (frames per second)
+    int interval;           // Bones update interval (1, 2, 4 or 8 frames), set by UpdateAnimationScheduler()
+    bool visible;           // Model inside camera view, set by UpdateAnimationScheduler()
+    Transform root;         // Root bone transform at current frame (root motion), updated even if not visible
+    ModelPose pose;         // Bones pose: last sampled transforms and current (interpolated) matrices
+    Matrix *keyMatrices;    // Bones matrices at previous and next updates (2*boneCount), interpolated in between
+    int keyFrames[2];       // Scheduler frames of previous and next updates (previous is -1 if keys are not valid)
+    Vector3 boundsCenter;   // Bind pose bounding sphere center (model space)
+    float boundsRadius;     // Bind pose bounding sphere radius (model space)
+} AnimatedModel;
+
+// AnimationScheduler, registered animated models bones are updated at a rate depending on their projected size
+typedef struct AnimationScheduler {
+    int modelCount;         // Registered models count
+    int modelCapacity;      // Registered models array capacity
+    AnimatedModel **models; // Registered models (not owned by scheduler)
+    float screenSizes[3];   // Models projected height (fraction of screen) under screenSizes[n] update every 2^(n + 1) frames
+    int frameCounter;       // Scheduler updates counter
+    int sampledCount;       // Models poses sampled on last update
+    int interpolatedCount;  // Models bones matrices interpolated on last update
+    int rootOnlyCount;      // Models outside camera view on last update (root motion only)
+} AnimationScheduler;
+
+// MorphAnimation, morph targets weights animation (blend shapes)
+typedef struct MorphAnimation {
+    int meshCount;          // Number of model meshes (weights stored for every model mesh)
+    int targetCount;        // Number of weights by mesh and frame (largest mesh morph targets count)
+    int frameCount;         // Number of animation frames
+    float *weights;         // Frames weights (frameCount*meshCount*targetCount)
+    char name[32];          // Animation name
+} MorphAnimation;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -416,6 +631,216 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// CollisionWorld, collision bodies broadphase, uniform grid spatial hash (opaque)
+// NOTE: Bodies (rectangles, circles, boxes, spheres) are referenced by user ids, 2d bodies are stored on z = 0 plane
+typedef struct CollisionWorld CollisionWorld;
+
+// CollisionPair, colliding bodies ids (idA < idB)
+typedef struct CollisionPair {
+    int idA;                // First body id
+    int idB;                // Second body id
+} CollisionPair;
+
+// Billboard, camera-facing textured quad drawn in batches (DrawBillboards())
+typedef struct Billboard {
+    Vector3 position;       // Billboard center position
+    Vector2 size;           // Billboard size (world units)
+    Rectangle source;       // Texture source rectangle (pixels)
+    Color tint;             // Billboard tint
+} Billboard;
+
+// Frustum, camera view volume planes
+typedef struct Frustum {
+    Vector4 planes[6];      // Normalized planes pointing inside: left, right, bottom, top, near, far (xyz: normal, w: distance)
+} Frustum;
+
+// MeshBVHNode, mesh bounding volume hierarchy node (32 bytes)
+typedef struct MeshBVHNode {
+    Vector3 min;            // Node bounding box minimum (object space)
+    int offset;             // Leaf: first triangle index, inner node: second child node index (first child is next node)
+    Vector3 max;            // Node bounding box maximum (object space)
+    int count;              // Leaf: triangles count, inner node: 0
+} MeshBVHNode;
+
+// MeshBVH, mesh triangles bounding volume hierarchy, accelerates ray and overlap queries
+typedef struct MeshBVH {
+    int nodeCount;          // Number of nodes (root is first node)
+    int triangleCount;      // Number of triangles
+    MeshBVHNode *nodes;     // Nodes, stored depth-first
+    Vector3 *vertices;      // Triangles vertices, 3 per triangle in leaves order (object space)
+} MeshBVH;
+
+// VoxelMap, chunked voxels volume, every chunk is meshed with greedy faces merging and uploaded separately
+typedef struct VoxelMap {
+    int width;              // Voxels count along X
+    int height;             // Voxels count along Y
+    int depth;              // Voxels count along Z
+    Vector3 voxelSize;      // Voxel size (world units)
+    Vector3 origin;         // Voxel (0, 0, 0) minimum corner position (map space)
+    unsigned char *voxels;  // Voxels ids (0: empty), index: x + z*width + y*width*depth
+    Color *palette;         // Voxels ids colors (256 entries), used as vertex colors
+    unsigned char *tiles;   // Voxels ids atlas tiles per face (256*6 entries: +X, -X, +Y, -Y, +Z, -Z)
+    int atlasColumns;       // Texture atlas tiles columns (0: no atlas, texcoords repeat every voxel)
+    int atlasRows;          // Texture atlas tiles rows
+    int chunksX;            // Chunks count along X
+    int chunksY;            // Chunks count along Y
+    int chunksZ;            // Chunks count along Z
+    Mesh *chunks;           // Chunks meshes, index: x + z*chunksX + y*chunksX*chunksZ
+    bool *chunksDirty;      // Chunks meshes requiring rebuild on UpdateVoxelMap()
+} VoxelMap;
+
+// Terrain, heightmap split in chunks, chunks levels of detail are selected by view distance (geomipmapping)
+typedef struct Terrain {
+    int width;              // Heightmap samples along X
+    int depth;              // Heightmap samples along Z
+    Vector3 size;           // Terrain size (world units), same placement as GenMeshHeightmap()
+    float *heights;         // Heights (world units), index: x + z*width
+    int chunksX;            // Chunks count along X
+    int chunksZ;            // Chunks count along Z
+    int lodCount;           // Levels of detail count, level n uses one vertex every 2^n samples
+    float lodDistance;      // View distance to chunk bounds switching to level 1, doubled for every next level
+    Mesh *chunks;           // Chunks meshes (lodCount*chunksX*chunksZ), level n meshes start at n*chunksX*chunksZ, vertex buffers shared by levels
+} Terrain;
+
+// TileAnimation, tilemap animated tile, frames are consecutive tileset tiles
+typedef struct TileAnimation {
+    int tile;               // First frame tile id, tiles using this id are animated
+    int frameCount;         // Frames count
+    float frameTime;        // Frame duration (seconds)
+} TileAnimation;
+
+// Tilemap, 2D tiles layers split in chunks, every chunk layer is meshed once and drawn from static vertex buffers
+typedef struct Tilemap {
+    int width;              // Tiles count along X
+    int height;             // Tiles count along Y
+    int layerCount;         // Layers count, layers are drawn in order
+    int tileWidth;          // Tile width (pixels, same size in tileset and world units)
+    int tileHeight;         // Tile height (pixels, same size in tileset and world units)
+    Texture2D tileset;      // Tileset texture, tiles ids ordered by rows (not owned by tilemap)
+    short *tiles;           // Layers tiles ids (-1: empty), index: x + y*width + layer*width*height
+    TileAnimation *animations;  // Animated tiles (TILEMAP_MAX_ANIMATIONS entries)
+    int animationCount;     // Animated tiles count
+    int chunksX;            // Chunks count along X
+    int chunksY;            // Chunks count along Y
+    Mesh *chunks;           // Chunks layers meshes (layerCount*chunksX*chunksY), index: x + y*chunksX + layer*chunksX*chunksY
+    bool *chunksDirty;      // Chunks layers meshes requiring rebuild on UpdateTilemap()
+} Tilemap;
+
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rmodels module
+typedef struct rWorldSectorLoad rWorldSectorLoad;
+
+// WorldObject, world sector model placement
+typedef struct WorldObject {
+    int model;              // Sector model index
+    Matrix transform;       // Object transform (world space)
+} WorldObject;
+
+// WorldSector, world grid cell streamed from its manifest file
+typedef struct WorldSector {
+    int x;                  // Sector grid position along X (sector bounds start at x*sectorSize)
+    int z;                  // Sector grid position along Z (sector bounds start at z*sectorSize)
+    int priority;           // Sector priority, higher priority sectors are loaded first and evicted last
+    int state;              // Sector state (WorldSectorState)
+    float distance;         // Distance from streaming position to sector bounds (XZ plane), updated by UpdateWorld()
+    char *manifest;         // Sector manifest file path
+    int modelCount;         // Models count
+    Model *models;          // Models (valid when sector is loaded)
+    int textureCount;       // Textures count
+    Texture2D *textures;    // Textures (valid when sector is loaded)
+    int objectCount;        // Objects count
+    WorldObject *objects;   // Objects, models placements (valid when sector is loaded)
+    long long memory[2];    // Estimated memory used by sector resources by category (WorldBudget)
+    rWorldSectorLoad *load; // Pointer to internal sector loading state, only while sector is loading
+} WorldSector;
+
+// World, sectors grid streamed around a position within memory budgets
+typedef struct World {
+    float sectorSize;       // Sectors size (world units, square cells on XZ plane)
+    int sectorCount;        // Sectors count
+    WorldSector *sectors;   // Sectors
+    float loadDistance;     // Sectors closer than this distance to streaming position are loaded
+    float unloadDistance;   // Loaded sectors farther than this distance are unloaded (hysteresis, >= loadDistance)
+    long long budgets[2];   // Memory budgets by category (WorldBudget), 0: no budget
+    long long memory[2];    // Estimated memory used by loaded sectors by category (WorldBudget)
+} World;
+
+// ParticleEmitter, particles emission and simulation parameters
+typedef struct ParticleEmitter {
+    Vector3 position;       // Emission position (world space)
+    Vector3 positionVariance;   // Emission position random offset (per axis, +/-)
+    Vector3 velocity;       // Initial velocity
+    Vector3 velocityVariance;   // Initial velocity random offset (per axis, +/-)
+    Vector3 acceleration;   // Constant acceleration (gravity, wind)
+    float drag;             // Velocity damping (fraction lost per second)
+    float emissionRate;     // Particles emitted per second
+    float lifetime;         // Particle lifetime (seconds)
+    float lifetimeVariance; // Particle lifetime random offset (+/-)
+    float startSize;        // Particle size on emission (world units)
+    float endSize;          // Particle size on death (world units)
+    Color startColor;       // Particle color on emission
+    Color endColor;         // Particle color on death
+} ParticleEmitter;
+
+// ParticleSystem, particles state stored in a ring buffer, simulated on GPU (compute shader) when supported
+typedef struct ParticleSystem {
+    int maxParticles;       // Particles slots, oldest particles are replaced when all slots are alive
+    ParticleEmitter emitter;    // Emitter parameters (can be changed between updates)
+    unsigned int bufferId;  // Particles state buffer id (SSBO, GPU simulated)
+    float *particles;       // Particles state (CPU simulated, NULL if GPU simulated): position + life, velocity + lifetime
+    int nextParticle;       // Next particle slot to emit
+    float emitPending;      // Particles pending emission (bursts and fractional rate emission)
+    unsigned int seed;      // Emission random seed, advanced on every update
+} ParticleSystem;
+
+// StaticBatchObject, static batch source object triangles range in merged mesh
+typedef struct StaticBatchObject {
+    int mesh;               // Merged mesh index
+    int firstTriangle;      // First triangle in merged mesh indices
+    int triangleCount;      // Number of triangles
+    BoundingBox bounds;     // Object bounding box (world space)
+} StaticBatchObject;
+
+// StaticBatch, static meshes transformed to world space and merged, one mesh per material
+typedef struct StaticBatch {
+    Model model;            // Merged meshes and materials (can be drawn or exported as a model)
+    int objectCount;        // Number of source objects
+    StaticBatchObject *objects; // Source objects ranges, stored in merged meshes order
+    unsigned short *visibleIndices; // Visible objects indices scratch buffer (culled draws)
+    int *visibleTriangles;  // Merged meshes triangles currently in GPU indices buffers
+} StaticBatch;
+
+// Scene, transforms hierarchy stored in flat arrays, parents always stored before their children
+typedef struct Scene {
+    int nodeCount;          // Number of nodes
+    int capacity;           // Nodes arrays capacity
+    int *parents;           // Nodes parent index (-1 for root nodes)
+    Vector3 *translations;  // Nodes local translation
+    Quaternion *rotations;  // Nodes local rotation
+    Vector3 *scales;        // Nodes local scale
+    Matrix *worldMatrices;  // Nodes world matrices, computed by UpdateScene()
+    bool *dirty;            // Nodes local transform changed since last UpdateScene()
+} Scene;
+
+// SceneModelNode, model meshes range placed by a scene node, shared by all nodes referencing the same mesh
+typedef struct SceneModelNode {
+    int node;               // Scene node index (meshes world transform)
+    int firstMesh;          // First model mesh (glTF mesh primitives are consecutive meshes)
+    int meshCount;          // Number of model meshes
+    int instanceCount;      // Number of node instances (EXT_mesh_gpu_instancing), 0 if not instanced
+    Matrix *instanceTransforms; // Instances local transforms (relative to node)
+    InstanceBuffer instances;   // Instances world transforms, updated when node world matrix changes
+    Matrix instancesMatrix; // Node world matrix instances world transforms were computed with
+} SceneModelNode;
+
+// SceneModel, model meshes placed by scene nodes (glTF nodes hierarchy)
+typedef struct SceneModel {
+    Model model;            // Shared meshes and materials
+    int rootNode;           // Scene node parent of all model nodes
+    int nodeCount;          // Number of mesh nodes
+    SceneModelNode *nodes;  // Mesh nodes
+} SceneModel;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -440,6 +865,35 @@ typedef struct AudioStream {
     unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
 } AudioStream;
 
+// VideoDecoder, video frames and audio decoder callbacks, called from a job worker thread
+// NOTE: Frames are decoded as YUV 4:2:0 planar (I420): Y plane (width*height), U and V planes (half size, rounded up),
+// audio is decoded as 32bit float samples (interleaved channels), custom decoders allow any format or hardware decoding
+typedef struct VideoDecoder {
+    void *userData;                 // Decoder data, passed to callbacks
+    int width;                      // Video frames width
+    int height;                     // Video frames height
+    float frameRate;                // Video frames per second
+    int frameCount;                 // Video frames count (0 if unknown)
+    unsigned int sampleRate;        // Audio sample rate (0 if no audio)
+    unsigned int channels;          // Audio channels
+    bool (*decodeFrame)(void *userData, unsigned char *data);           // Decode next frame into I420 data, false on end
+    int (*decodeAudio)(void *userData, float *samples, int frameCount); // Decode next audio frames, returns frames decoded (optional)
+    void (*rewind)(void *userData); // Restart decoding from first frame (optional, required for looping)
+    void (*close)(void *userData);  // Release decoder data (optional)
+} VideoDecoder;
+
+// VideoStream, video playback to textures, frames are decoded ahead of playback
+typedef struct rVideoStream rVideoStream;
+typedef struct VideoStream {
+    Texture2D planes[3];            // Current frame Y, U, V planes textures (RGBA frame on planes[0] if shaders not supported)
+    AudioStream audio;              // Audio stream (no buffer if video has no audio)
+    float frameRate;                // Video frames per second
+    int frameCount;                 // Video frames count (0 if unknown)
+    int currentFrame;               // Current frame shown on textures
+    bool looping;                   // Video looping enable
+    rVideoStream *stream;           // Frames decoding stream
+} VideoStream;
+
 // Sound
 typedef struct Sound {
     AudioStream stream;         // Audio stream
@@ -456,6 +910,39 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// AudioMixerStats, audio mixer thread stats (counters wrap around, compare two stats for deltas)
+typedef struct AudioMixerStats {
+    unsigned int periods;       // Device periods mixed
+    unsigned int frames;        // Frames mixed
+    unsigned int voices;        // Audio buffers mixed on last period (sounds, multichannel voices and streams)
+    unsigned int lastMixTime;   // Last period mixing time (in microseconds)
+    unsigned int mixTime;       // Total mixing time (in microseconds)
+    unsigned int lateCallbacks; // Device callbacks later than expected period interval
+    unsigned int underruns;     // Device callbacks after device buffer was drained (estimated from callbacks timing)
+    unsigned int budgetTime;    // Last period mixing time budget, period duration (in microseconds)
+    float load;                 // Last period DSP load, mixing time over budget (1.0f: mixing takes the whole period)
+    float loadAverage;          // DSP load average over last load window
+    float loadPeak;             // DSP load peak over last load window
+    unsigned int activeVoices;  // Multichannel voices mixed on a pool channel
+    unsigned int virtualVoices; // Multichannel voices audible but not mixed, pool channels used by higher priority voices
+    unsigned int culledVoices;  // Multichannel voices not mixed, attenuated below audible volume (distance)
+} AudioMixerStats;
+
+// AudioDeviceConfig, audio device init parameters, zero values use backend defaults
+typedef struct AudioDeviceConfig {
+    unsigned int sampleRate;    // Device sample rate
+    unsigned int periodFrames;  // Device period size (in frames), data callback size
+    unsigned int periods;       // Device periods count, buffered periods
+    bool lowLatency;            // Low latency performance profile (smaller default periods)
+} AudioDeviceConfig;
+
+// AudioEmitter, spatial multichannel voice position update (UpdateAudioEmitters())
+typedef struct AudioEmitter {
+    int voice;                  // Spatial voice id (PlaySoundMulti3D())
+    Vector3 position;           // Emitter position
+    Vector3 velocity;           // Emitter velocity (units per second, doppler effect)
+} AudioEmitter;
+
 // VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -482,6 +969,72 @@ typedef struct VrStereoConfig {
     float scaleIn[2];               // VR distortion scale in
 } VrStereoConfig;
 
+// InputEvent, timestamped input event registered on current frame
+typedef struct InputEvent {
+    int type;                       // Event type (InputEventType)
+    double time;                    // Event time in seconds (GetTime() base)
+    int device;                     // Gamepad index (gamepad events), 0 otherwise
+    int code;                       // Key, unicode codepoint, mouse button or gamepad button
+    Vector2 value;                  // Mouse position (mouse move) or wheel movement (mouse wheel)
+} InputEvent;
+
+// JobCounter, pending jobs counter used to wait for jobs and as jobs dependency
+// NOTE: It must be zero-initialized, it can be reused once pending jobs are done
+typedef struct JobCounter {
+    int pending;                    // Pending jobs (submitted, not finished)
+} JobCounter;
+
+// DrawList, retained drawing recorded once and drawn many times (opaque)
+// NOTE: Recorded drawing is kept on a GPU vertex buffer, it requires RLGL_ENABLE_COMMAND_LISTS
+typedef struct DrawList DrawList;
+
+// ShaderVariants, shader code template specialized by feature defines (opaque)
+// NOTE: Variants are compiled on first use and cached, indexed by features bitmask
+typedef struct ShaderVariants ShaderVariants;
+
+// CompressionStream, incremental compression/decompression context (opaque)
+// NOTE: Memory used is bounded, data is processed in independent blocks (COMPRESSION_STREAM_BLOCK_SIZE)
+typedef struct CompressionStream CompressionStream;
+
+// ObjectPool, fixed size objects pool, objects can be allocated and freed from any thread (opaque)
+// NOTE: Job system threads keep a small cache of free objects, shared free list is lock-free
+typedef struct ObjectPool ObjectPool;
+
+// ObjectPoolStats, object pool usage and contention stats (approximate while other threads use the pool)
+typedef struct ObjectPoolStats {
+    int capacity;                   // Objects capacity
+    int used;                       // Objects allocated
+    int cached;                     // Free objects kept on thread caches
+    unsigned int allocations;       // Allocations done
+    unsigned int frees;             // Frees done
+    unsigned int cacheHits;         // Allocations and frees served by thread caches (shared free list not accessed)
+    unsigned int contention;        // Shared free list updates retried (other thread updated it meanwhile)
+    unsigned int failures;          // Allocations failed (pool exhausted)
+} ObjectPoolStats;
+
+// RandomGenerator, random numbers generator state (xoshiro128**), not shared between threads
+typedef struct RandomGenerator {
+    unsigned int state[4];          // Generator state, seeded with InitRandomGenerator()
+} RandomGenerator;
+
+// MemoryStats, memory usage by tag (MemoryTag)
+typedef struct MemoryStats {
+    long long usedBytes;            // Memory live (in bytes)
+    long long peakBytes;            // Memory peak (in bytes)
+    int allocationCount;            // Allocations live (video memory: objects loaded)
+    int frameAllocations;           // Allocations on last frame
+    int frameFrees;                 // Frees on last frame
+} MemoryStats;
+
+// FrameTiming, one frame timing and counters from frames history
+typedef struct FrameTiming {
+    float frameTime;                // Frame time: update + draw + wait (seconds)
+    float cpuTime;                  // Frame CPU time: update + draw (seconds)
+    float gpuTime;                  // Frame GPU time (seconds), -1.0f if timer queries not supported
+    int batchFlushes;               // Render batch flushes
+    int allocations;                // Memory allocations (SUPPORT_MEMORY_TRACKING, 0 otherwise)
+} FrameTiming;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -701,6 +1254,20 @@ typedef enum {
     GAMEPAD_AXIS_RIGHT_TRIGGER = 5      // Gamepad back trigger right, pressure level: [1..-1]
 } GamepadAxis;
 
+// Input event type
+typedef enum {
+    INPUT_EVENT_NONE = 0,           // No event
+    INPUT_EVENT_KEY_DOWN,           // Key pressed (code: KeyboardKey)
+    INPUT_EVENT_KEY_UP,             // Key released (code: KeyboardKey)
+    INPUT_EVENT_CHAR,               // Char input (code: unicode codepoint)
+    INPUT_EVENT_MOUSE_BUTTON_DOWN,  // Mouse button pressed (code: MouseButton)
+    INPUT_EVENT_MOUSE_BUTTON_UP,    // Mouse button released (code: MouseButton)
+    INPUT_EVENT_MOUSE_MOVE,         // Mouse moved (value: position)
+    INPUT_EVENT_MOUSE_WHEEL,        // Mouse wheel moved (value: movement XY)
+    INPUT_EVENT_GAMEPAD_BUTTON_DOWN,    // Gamepad button pressed (device: gamepad, code: GamepadButton)
+    INPUT_EVENT_GAMEPAD_BUTTON_UP       // Gamepad button released (device: gamepad, code: GamepadButton)
+} InputEventType;
+
 // Material map index
 typedef enum {
     MATERIAL_MAP_ALBEDO    = 0,     // Albedo material (same as: MATERIAL_MAP_DIFFUSE)
@@ -713,12 +1280,38 @@ typedef enum {
     MATERIAL_MAP_CUBEMAP,           // Cubemap material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
     MATERIAL_MAP_IRRADIANCE,        // Irradiance material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
     MATERIAL_MAP_PREFILTER,         // Prefilter material (NOTE: Uses GL_TEXTURE_CUBE_MAP)
-    MATERIAL_MAP_BRDF               // Brdf material
+    MATERIAL_MAP_BRDF,              // Brdf material
+    MATERIAL_MAP_LIGHTMAP           // Lightmap material (NOTE: Sampled with texcoords2, see BakeModelLightmap())
 } MaterialMapIndex;
 
 #define MATERIAL_MAP_DIFFUSE      MATERIAL_MAP_ALBEDO
 #define MATERIAL_MAP_SPECULAR     MATERIAL_MAP_METALNESS
 
+// Render queue pass
+typedef enum {
+    RENDER_PASS_AUTO = 0,           // Pass selected by material diffuse color alpha (transparent if < 255)
+    RENDER_PASS_OPAQUE,             // Opaque pass, sorted by state (shader, material, mesh) and front-to-back
+    RENDER_PASS_TRANSPARENT         // Transparent pass, drawn after opaque pass and sorted back-to-front
+} RenderPass;
+
+// Mesh vertex attributes quantization flags
+// NOTE: Quantized attributes are fetched normalized, no shader changes are required
+typedef enum {
+    MESH_QUANTIZE_POSITION = 1,     // Positions as 16 bit normalized integers, dequantized by model transform
+    MESH_QUANTIZE_TEXCOORD = 2,     // Texcoords as 16 bit unsigned normalized integers (only if inside [0..1] range)
+    MESH_QUANTIZE_NORMAL   = 4,     // Normals and tangents as 8 bit normalized integers
+    MESH_QUANTIZE_ALL      = 7      // All previous attributes quantized
+} MeshQuantizeFlags;
+
+// Mesh optimization flags
+typedef enum {
+    MESH_OPTIMIZE_WELD          = 1,    // Weld identical vertices (all attributes), mesh gets indexed
+    MESH_OPTIMIZE_VERTEX_CACHE  = 2,    // Reorder triangles for post-transform vertex cache efficiency
+    MESH_OPTIMIZE_OVERDRAW      = 4,    // Reorder triangles clusters to reduce overdraw
+    MESH_OPTIMIZE_VERTEX_FETCH  = 8,    // Reorder vertices in first use order, vertex fetch locality
+    MESH_OPTIMIZE_ALL           = 15    // All previous optimizations
+} MeshOptimizeFlags;
+
 // Shader location index
 typedef enum {
     SHADER_LOC_VERTEX_POSITION = 0, // Shader location: vertex attribute: position
@@ -746,7 +1339,19 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
+    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
+    SHADER_LOC_BONE_MATRICES,       // Shader location: array of matrices uniform: boneMatrices
+    SHADER_LOC_INSTANCE_COLOR,      // Shader location: instance attribute: color
+    SHADER_LOC_INSTANCE_CUSTOM,     // Shader location: instance attribute: custom data
+    SHADER_LOC_BLOCK_FRAME,         // Shader location: uniform block: per-frame data (camera matrices)
+    SHADER_LOC_BLOCK_MATERIAL,      // Shader location: uniform block: per-material data (colors and params)
+    SHADER_LOC_MAP_MORPH,           // Shader location: sampler2d texture: morph targets deltas
+    SHADER_LOC_MORPH_TARGET_COUNT,  // Shader location: int uniform: morph targets count
+    SHADER_LOC_MORPH_INDICES,       // Shader location: array of ints uniform: blended morph targets indices
+    SHADER_LOC_MORPH_WEIGHTS,       // Shader location: array of floats uniform: blended morph targets weights
+    SHADER_LOC_MAP_LIGHTMAP         // Shader location: sampler2d texture: lightmap
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -786,6 +1391,7 @@ typedef enum {
     PIXELFORMAT_UNCOMPRESSED_R32,           // 32 bpp (1 channel - float)
     PIXELFORMAT_UNCOMPRESSED_R32G32B32,     // 32*3 bpp (3 channels - float)
     PIXELFORMAT_UNCOMPRESSED_R32G32B32A32,  // 32*4 bpp (4 channels - float)
+    PIXELFORMAT_UNCOMPRESSED_R11G11B10F,    // 32 bpp (3 channels - packed unsigned float)
     PIXELFORMAT_COMPRESSED_DXT1_RGB,        // 4 bpp (no alpha)
     PIXELFORMAT_COMPRESSED_DXT1_RGBA,       // 4 bpp (1 bit alpha)
     PIXELFORMAT_COMPRESSED_DXT3_RGBA,       // 8 bpp
@@ -833,7 +1439,7 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF                        // SDF font generation, drawn with built-in SDF shader (or external one)
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -844,7 +1450,8 @@ typedef enum {
     BLEND_ADD_COLORS,               // Blend textures adding colors (alternative)
     BLEND_SUBTRACT_COLORS,          // Blend textures subtracting colors (alternative)
     BLEND_ALPHA_PREMUL,             // Blend premultiplied textures considering alpha
-    BLEND_CUSTOM                    // Blend textures using custom src/dst factors (use rlSetBlendMode())
+    BLEND_CUSTOM,                   // Blend textures using custom src/dst factors (use rlSetBlendFactors())
+    BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
 } BlendMode;
 
 // Gesture
@@ -885,6 +1492,83 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Line join type (polylines)
+typedef enum {
+    LINE_JOIN_MITER = 0,            // Line join: sharp corner (bevel if too long)
+    LINE_JOIN_BEVEL,                // Line join: flat corner
+    LINE_JOIN_ROUND                 // Line join: round corner
+} LineJoinType;
+
+// Line cap type (polylines)
+typedef enum {
+    LINE_CAP_BUTT = 0,              // Line cap: line ends at first/last point
+    LINE_CAP_SQUARE,                // Line cap: line extended half thickness
+    LINE_CAP_ROUND                  // Line cap: half circle
+} LineCapType;
+
+// Async load state
+typedef enum {
+    ASYNC_LOAD_NONE = 0,            // Async load handle not valid (or already retrieved)
+    ASYNC_LOAD_PENDING,             // Async load in progress (decoding or waiting upload)
+    ASYNC_LOAD_READY,               // Async load finished, ready to be retrieved
+    ASYNC_LOAD_FAILED               // Async load failed, retrieving returns default/empty data
+} AsyncLoadState;
+
+// World sector state
+typedef enum {
+    WORLD_SECTOR_UNLOADED = 0,      // Sector content not loaded
+    WORLD_SECTOR_LOADING,           // Sector manifest or resources being loaded asynchronously
+    WORLD_SECTOR_LOADED             // Sector content loaded, objects drawn by DrawWorld()
+} WorldSectorState;
+
+// World memory budget categories
+typedef enum {
+    WORLD_BUDGET_MESHES = 0,        // Models meshes vertex and index data
+    WORLD_BUDGET_TEXTURES           // Models materials textures and sector textures
+} WorldBudget;
+
+// Frame pacing mode
+typedef enum {
+    FRAME_PACING_TIMER = 0,         // Frame pacing: wait remaining target frame time (SetTargetFPS()), default
+    FRAME_PACING_VSYNC,             // Frame pacing: frames presented on display vsync cadence (only PLATFORM_NX)
+    FRAME_PACING_LOW_LATENCY        // Frame pacing: vsync cadence, input polled just in time for next present (only PLATFORM_NX)
+} FramePacingMode;
+
+// CPU/GPU clocks profile
+typedef enum {
+    CLOCK_PROFILE_DEFAULT = 0,      // Clocks profile: system default clocks for current operation mode
+    CLOCK_PROFILE_POWER_SAVING,     // Clocks profile: lower GPU and memory clocks, longer battery life (only PLATFORM_NX)
+    CLOCK_PROFILE_BOOST             // Clocks profile: CPU boost mode, GPU clock lowered, for loading screens (only PLATFORM_NX)
+} ClockProfile;
+
+// Compression codec
+typedef enum {
+    COMPRESSION_DEFLATE = 0,        // DEFLATE (RFC 1951), better ratio
+    COMPRESSION_LZ4                 // LZ4 block format, faster compression and decompression
+} CompressionCodec;
+
+// Music module (XM/MOD) resampling quality
+typedef enum {
+    MUSIC_QUALITY_NEAREST = 0,      // Music quality: nearest sample, lowest cost
+    MUSIC_QUALITY_LINEAR,           // Music quality: linear interpolation, default
+    MUSIC_QUALITY_CUBIC             // Music quality: cubic (Catmull-Rom) interpolation, highest cost
+} MusicQuality;
+
+// Memory stats tags, modules allocations are tagged by subsystem
+// NOTE: Only video memory tags are available without SUPPORT_MEMORY_TRACKING
+typedef enum {
+    MEMORY_TAG_ALL = 0,             // Memory tag: all tracked allocations (video memory not included)
+    MEMORY_TAG_CORE,                // Memory tag: rcore and rlgl allocations
+    MEMORY_TAG_TEXTURES,            // Memory tag: rtextures allocations (images)
+    MEMORY_TAG_TEXT,                // Memory tag: rtext allocations (fonts)
+    MEMORY_TAG_MODELS,              // Memory tag: rmodels allocations (meshes, materials, animations)
+    MEMORY_TAG_AUDIO,               // Memory tag: raudio allocations (waves, sounds, music)
+    MEMORY_TAG_FILES,               // Memory tag: files data, file packs and async load jobs
+    MEMORY_TAG_USER,                // Memory tag: MemAlloc() allocations
+    MEMORY_TAG_VIDEO_TEXTURES,      // Memory tag: video memory estimated for textures and renderbuffers
+    MEMORY_TAG_VIDEO_BUFFERS        // Memory tag: video memory estimated for vertex, index, uniform and pixel buffers
+} MemoryTag;
+
 // Callbacks to hook some internal functions
 // WARNING: This callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -892,6 +1576,15 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, unsigned in
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, unsigned int bytesToWrite);  // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);       // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, char *text);     // FileIO: Save text data
+typedef void (*FixedUpdateCallback)(float deltaTime);   // Timing: Fixed simulation update step
+typedef void (*FocusCallback)(bool focused);            // Window: Focus changed, state could be saved on focus lost
+typedef void (*JobCallback)(void *data);                // Jobs: Job function
+typedef void (*JobRangeCallback)(void *data, int start, int end);   // Jobs: Parallel-for range function, [start, end)
+typedef void *(*MemAllocCallback)(unsigned int size, void *userData);               // Memory: Custom allocator allocation
+typedef void *(*MemReallocCallback)(void *ptr, unsigned int size, void *userData);  // Memory: Custom allocator reallocation (optional)
+typedef void (*MemFreeCallback)(void *ptr, void *userData);                         // Memory: Custom allocator free
+typedef unsigned long long (*ProfileZoneBeginCallback)(const char *name);           // Profiling: Zone begin, returned value is provided on zone end
+typedef void (*ProfileZoneEndCallback)(unsigned long long zone);                    // Profiling: Zone end
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -915,7 +1608,9 @@ RLAPI bool IsWindowFullscreen(void);                              // Check if wi
 RLAPI bool IsWindowHidden(void);                                  // Check if window is currently hidden (only PLATFORM_DESKTOP)
 RLAPI bool IsWindowMinimized(void);                               // Check if window is currently minimized (only PLATFORM_DESKTOP)
 RLAPI bool IsWindowMaximized(void);                               // Check if window is currently maximized (only PLATFORM_DESKTOP)
-RLAPI bool IsWindowFocused(void);                                 // Check if window is currently focused (only PLATFORM_DESKTOP)
+RLAPI bool IsWindowFocused(void);                                 // Check if window is currently focused (PLATFORM_DESKTOP and PLATFORM_NX applet focus)
+RLAPI void SetWindowFocusCallback(FocusCallback callback);        // Set window focus changes callback (PLATFORM_DESKTOP and PLATFORM_NX)
+RLAPI bool IsWindowDocked(void);                                  // Check if console is docked, framebuffer resized to 1920x1080 (only PLATFORM_NX)
 RLAPI bool IsWindowResized(void);                                 // Check if window has been resized last frame
 RLAPI bool IsWindowState(unsigned int flag);                      // Check if one specific window flag is enabled
 RLAPI void SetWindowState(unsigned int flags);                    // Set window configuration state using flags (only PLATFORM_DESKTOP)
@@ -951,6 +1646,10 @@ RLAPI void SetClipboardText(const char *text);                    // Set clipboa
 RLAPI const char *GetClipboardText(void);                         // Get clipboard text content
 RLAPI void EnableEventWaiting(void);                              // Enable waiting for events on EndDrawing(), no automatic event polling
 RLAPI void DisableEventWaiting(void);                             // Disable waiting for events on EndDrawing(), automatic events polling
+RLAPI void EnablePartialRedraw(void);                             // Enable partial redraw, only changed screen area is redrawn, no buffers swap if nothing changed
+RLAPI void DisablePartialRedraw(void);                            // Disable partial redraw, full frame drawn every frame
+RLAPI void EnableRenderThread(void);                              // Enable render thread, frames are recorded on main thread and drawn/presented on render thread (one frame latency)
+RLAPI void DisableRenderThread(void);                             // Disable render thread, frames drawn and presented on main thread
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advance users that want full control over the frame processing
@@ -984,8 +1683,26 @@ RLAPI void BeginBlendMode(int mode);                              // Begin blend
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void BeginOpaqueMode(void);                                 // Begin opaque drawing (fully opaque, hides drawing below it with 2D depth ordering)
+RLAPI void EndOpaqueMode(void);                                   // End opaque drawing
+RLAPI void EnableDepthOrdering2D(void);                           // Enable 2D depth ordering (opaque drawing first front-to-back, early depth rejection)
+RLAPI void DisableDepthOrdering2D(void);                          // Disable 2D depth ordering
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
+RLAPI void BeginDynamicResolutionMode(void);                      // Begin drawing to render texture scaled by GPU frame time
+RLAPI void EndDynamicResolutionMode(void);                        // Ends dynamic resolution drawing, render texture upscaled to screen
+RLAPI void SetDynamicResolutionLimits(float minScale, float maxScale); // Set dynamic resolution scale limits (relative to framebuffer size)
+RLAPI float GetDynamicResolutionScale(void);                      // Get current dynamic resolution scale
+
+// Draw list functions (retained drawing)
+// NOTE: Drawing calls between BeginDrawList()/EndDrawList() are recorded instead of drawn,
+// a list is only recorded again when its content changes, matrix transforms are applied on recording
+RLAPI DrawList *LoadDrawList(void);                               // Load draw list
+RLAPI void UnloadDrawList(DrawList *list);                        // Unload draw list
+RLAPI void BeginDrawList(DrawList *list);                         // Begin recording draw list (previous recording discarded)
+RLAPI void EndDrawList(void);                                     // End recording draw list
+RLAPI void DrawDrawList(DrawList *list, Vector2 position, Color tint);    // Draw recorded draw list at position with tint
+RLAPI void DrawDrawListEx(DrawList *list, Matrix transform, Color tint);   // Draw recorded draw list with transform and tint
 
 // VR stereo config functions for VR simulator
 RLAPI VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device);     // Load VR stereo config for VR simulator device parameters
@@ -995,14 +1712,33 @@ RLAPI void UnloadVrStereoConfig(VrStereoConfig config);           // Unload VR s
 // NOTE: Shader functionality is not available on OpenGL 1.1
 RLAPI Shader LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
 RLAPI Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
+RLAPI unsigned int LoadShaderAsync(const char *vsFileName, const char *fsFileName);    // Load shader from files asynchronously (compiled by driver threads if supported), returns async load handle
+RLAPI unsigned int LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode);  // Load shader from code strings asynchronously, returns async load handle
+RLAPI Shader GetAsyncShader(unsigned int handle);                          // Get shader loaded asynchronously (waits for load to finish)
 RLAPI int GetShaderLocation(Shader shader, const char *uniformName);       // Get shader uniform location
 RLAPI int GetShaderLocationAttrib(Shader shader, const char *attribName);  // Get shader attribute location
 RLAPI void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType);               // Set shader uniform value
 RLAPI void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniformType, int count);   // Set shader uniform value vector
 RLAPI void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat);         // Set shader uniform value (matrix 4x4)
 RLAPI void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture); // Set shader uniform value for texture (sampler2d)
+RLAPI void SetShaderValueTextureArray(Shader shader, int locIndex, TextureArray texture); // Set shader uniform value for texture array (sampler2DArray/sampler3D)
+RLAPI int GetShaderUniform(Shader shader, const char *uniformName);        // Get shader uniform handle (reflected uniforms table), -1 if not found
+RLAPI void SetShaderUniformFloat(Shader shader, int uniform, float value); // Set shader uniform value by handle (float), unchanged values are not uploaded
+RLAPI void SetShaderUniformInt(Shader shader, int uniform, int value);     // Set shader uniform value by handle (int), unchanged values are not uploaded
+RLAPI void SetShaderUniformVector2(Shader shader, int uniform, Vector2 value);  // Set shader uniform value by handle (vec2), unchanged values are not uploaded
+RLAPI void SetShaderUniformVector3(Shader shader, int uniform, Vector3 value);  // Set shader uniform value by handle (vec3), unchanged values are not uploaded
+RLAPI void SetShaderUniformVector4(Shader shader, int uniform, Vector4 value);  // Set shader uniform value by handle (vec4), unchanged values are not uploaded
+RLAPI void SetShaderUniformMatrix(Shader shader, int uniform, Matrix mat); // Set shader uniform value by handle (matrix 4x4), unchanged values are not uploaded
+RLAPI void SetShaderUniformTexture(Shader shader, int uniform, Texture2D texture);  // Set shader uniform value by handle (sampler2d)
 RLAPI void UnloadShader(Shader shader);                                    // Unload shader from GPU memory (VRAM)
 
+// Shader variants functions
+// NOTE: Feature i set in features bitmask adds "#define featureNames[i]" to both shader stages code,
+// after #version directive, variant shaders are owned by variants and unloaded with them
+RLAPI ShaderVariants *LoadShaderVariants(const char *vsCode, const char *fsCode, const char **featureNames, int featureCount); // Load shader variants from code template and feature define names
+RLAPI void UnloadShaderVariants(ShaderVariants *variants);                 // Unload shader variants (all compiled variants)
+RLAPI Shader GetShaderVariant(ShaderVariants *variants, unsigned int features);  // Get shader variant for features bitmask (compiled on first request)
+
 // Screen-space-related functions
 RLAPI Ray GetMouseRay(Vector2 mousePosition, Camera camera);      // Get a ray trace from mouse position
 RLAPI Matrix GetCameraMatrix(Camera camera);                      // Get camera transform matrix (view matrix)
@@ -1011,24 +1747,62 @@ RLAPI Vector2 GetWorldToScreen(Vector3 position, Camera camera);  // Get the scr
 RLAPI Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height); // Get size position for a 3d world space position
 RLAPI Vector2 GetWorldToScreen2D(Vector2 position, Camera2D camera); // Get the screen space position for a 2d camera world space position
 RLAPI Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera); // Get the world space position for a 2d camera screen space position
+RLAPI CameraMatrices GetCameraMatrices(Camera camera, int width, int height); // Get camera matrices for screen-space functions, 3d camera and screen size
+RLAPI CameraMatrices GetCameraMatrices2D(Camera2D camera);        // Get camera matrices for screen-space functions, 2d camera
+RLAPI void GetWorldToScreenArray(const Vector3 *positions, Vector2 *screenPositions, int count, const CameraMatrices *matrices); // Get screen space positions for an array of 3d world space positions
+RLAPI void GetWorldToScreen2DArray(const Vector2 *positions, Vector2 *screenPositions, int count, const CameraMatrices *matrices); // Get screen space positions for an array of 2d camera world space positions
+RLAPI void GetScreenToWorld2DArray(const Vector2 *positions, Vector2 *worldPositions, int count, const CameraMatrices *matrices); // Get world space positions for an array of 2d camera screen space positions
 
 // Timing-related functions
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
+RLAPI void SetFramePacing(int mode, int fps);                     // Set frame pacing mode (FramePacingMode) and cadence (vsync modes: 30 or 60 FPS)
+RLAPI float GetPresentInterval(void);                             // Get measured time in seconds between presented frames (vsync pacing modes)
+RLAPI void SetFixedUpdateRate(int hz);                            // Set fixed simulation update rate (steps per second), 0 disables fixed update
+RLAPI void SetFixedUpdateCallback(FixedUpdateCallback callback);  // Set fixed simulation update callback, runs on EndDrawing() as many steps as frame time requires
+RLAPI float GetFixedUpdateAlpha(void);                            // Get interpolation factor between last two simulation steps [0..1]
+RLAPI int GetFixedUpdateSteps(void);                              // Get number of simulation steps run on last frame
 RLAPI int GetFPS(void);                                           // Get current FPS
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
+RLAPI FrameTiming GetFrameTiming(int frame);                      // Get frame timing from frames history (0: last frame)
+RLAPI int GetFrameTimeHistogram(int *bins, int binCount, float maxTime); // Get frames history frame times histogram (last bin includes frames over maxTime), returns frames counted
+RLAPI void SetFrameHitchThreshold(float threshold, int traceFrames, const char *fileName); // Set frame hitch threshold (seconds, 0: disabled), profiling zones of last traceFrames exported on hitches
+RLAPI int GetFrameHitchCount(void);                               // Get frames over hitch threshold since threshold set
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
+RLAPI unsigned long long GetTimeTicks(void);                      // Get raw monotonic time counter ticks (cheap, for instrumentation)
+RLAPI unsigned long long GetTicksFrequency(void);                 // Get raw monotonic time counter frequency (ticks per second)
 
 // Misc. functions
-RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
-RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
+RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included), calling thread generator
+RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator (every thread generator, seeded per thread)
+RLAPI RandomGenerator *GetRandomGenerator(void);                  // Get calling thread random generator (used by GetRandomValue())
+RLAPI RandomGenerator InitRandomGenerator(unsigned int seed);     // Init random generator state from seed (same sequence as main thread after SetRandomSeed())
+RLAPI unsigned int GetRandomBits(RandomGenerator *generator);     // Get random 32 bits value from generator
+RLAPI int GetRandomValueEx(RandomGenerator *generator, int min, int max);     // Get random value between min and max (both included) from generator, no modulo bias
+RLAPI float GetRandomFloat(RandomGenerator *generator, float min, float max); // Get random float value in [min, max) from generator
+RLAPI void GenRandomValues(RandomGenerator *generator, int *values, int count, int min, int max);         // Generate random values between min and max (both included) into array
+RLAPI void GenRandomFloats(RandomGenerator *generator, float *values, int count, float min, float max);  // Generate random float values in [min, max) into array
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI void StartAutomationEventsRecording(float deltaTime);       // Start input events recording, frame time fixed to deltaTime (0.0f: target frame time)
+RLAPI void StopAutomationEventsRecording(const char *fileName);   // Stop input events recording and export events to file
+RLAPI bool StartAutomationEventsReplay(const char *fileName, const char *statsFileName); // Start recorded events replay at uncapped frame rate, frames stats exported to .csv/.json
+RLAPI void StopAutomationEventsReplay(void);                      // Stop recorded events replay and export frames stats
+RLAPI bool IsAutomationEventsReplaying(void);                     // Check if recorded events replay is running
+RLAPI void SetClockProfile(int profile);                          // Set CPU/GPU clocks profile (ClockProfile), only PLATFORM_NX
+RLAPI void BeginLoadingBoost(void);                               // Begin loading boost scope (nestable), CPU boost mode while loading (only PLATFORM_NX)
+RLAPI void EndLoadingBoost(void);                                 // End loading boost scope, CPU boost mode released on EndDrawing()
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
 RLAPI void TraceLog(int logLevel, const char *text, ...);         // Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...)
 RLAPI void SetTraceLogLevel(int logLevel);                        // Set the current threshold (minimum) log level
+RLAPI bool IsTraceLogEnabled(int logLevel);                       // Check if log level is shown with current threshold (checked by TRACELOG() before formatting)
 RLAPI void *MemAlloc(int size);                                   // Internal memory allocator
 RLAPI void *MemRealloc(void *ptr, int size);                      // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
+RLAPI MemoryStats GetMemoryStats(int tag);                        // Get memory stats by tag (MemoryTag), live/peak bytes and last frame allocations
+RLAPI unsigned long long BeginProfileZone(const char *name);      // Begin profiling zone, name must be a static string (SUPPORT_PROFILING_ZONES)
+RLAPI void EndProfileZone(unsigned long long zone);               // End profiling zone, value returned by BeginProfileZone() required
+RLAPI void StartProfileCapture(int maxEvents);                    // Start profiling zones capture (0: default events buffer size)
+RLAPI bool StopProfileCapture(const char *fileName);              // Stop profiling zones capture and export it as Chrome trace JSON (chrome://tracing, Perfetto)
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advance users
@@ -1037,10 +1811,28 @@ RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
+RLAPI void SetProfileZoneCallbacks(ProfileZoneBeginCallback begin, ProfileZoneEndCallback end); // Set custom profiling zones sink, NULL callbacks restore capture
+RLAPI void SetAllocator(int tag, MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback, void *userData); // Set custom allocator for memory tag (MemoryTag), NULL callbacks restore default
+
+// Job system functions
+// NOTE: Main thread jobs run on EndDrawing() or while main thread waits a counter (WaitJobCounter())
+RLAPI int GetJobWorkerCount(void);                                // Get job system worker threads count (0: jobs run on submit)
+RLAPI void SubmitJob(JobCallback callback, void *data, JobCounter *dependency, JobCounter *counter);            // Submit job to worker threads, queued once dependency (optional) is done, counter (optional) tracks it
+RLAPI void SubmitMainThreadJob(JobCallback callback, void *data, JobCounter *dependency, JobCounter *counter);  // Submit job run on main thread only (GL work), queued once dependency (optional) is done
+RLAPI void WaitJobCounter(JobCounter *counter);                   // Wait for counter pending jobs, calling thread runs queued jobs meanwhile
+RLAPI bool IsJobCounterDone(JobCounter *counter);                 // Check if counter has no pending jobs
+RLAPI void ParallelFor(JobRangeCallback callback, void *data, int count, int grainSize);    // Run range callback over [0, count) split in jobs (grainSize 0: automatic), waits for completion
+RLAPI ObjectPool *LoadObjectPool(int objectSize, int capacity);   // Load fixed size objects pool, thread-safe allocations (job system threads cached)
+RLAPI void UnloadObjectPool(ObjectPool *pool);                    // Unload objects pool, objects allocated become invalid
+RLAPI void *AllocPoolObject(ObjectPool *pool);                    // Allocate object from pool (not initialized), NULL if pool is exhausted
+RLAPI void FreePoolObject(ObjectPool *pool, void *object);        // Free object back to pool, any thread
+RLAPI ObjectPoolStats GetObjectPoolStats(ObjectPool *pool);       // Get objects pool usage and contention stats
 
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead);       // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI const unsigned char *LoadFileDataView(const char *fileName, unsigned int *bytesRead); // Load file data as read-only view (zero-copy from memory-mapped file packs)
+RLAPI void UnloadFileDataView(const unsigned char *data);         // Unload file data view loaded by LoadFileDataView()
 RLAPI bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite);   // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const char *data, unsigned int size, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1065,15 +1857,48 @@ RLAPI char **GetDroppedFiles(int *count);                         // Get dropped
 RLAPI void ClearDroppedFiles(void);                               // Clear dropped files paths buffer (free memory)
 RLAPI long GetFileModTime(const char *fileName);                  // Get file modification time (last write time)
 
+// File packs functions (virtual file system)
+RLAPI int MountFilePack(const char *fileName, const char *mountPath);  // Mount file pack at a path prefix (NULL for root), returns pack id or -1 on failure
+RLAPI void UnmountFilePack(int id);                               // Unmount file pack, data views borrowed from the pack become invalid
+RLAPI bool IsFilePacked(const char *fileName);                    // Check if file is provided by a mounted file pack
+RLAPI bool ExportFilePack(const char *fileName, const char **files, int fileCount, bool compress); // Export files into a file pack, returns true on success
+
+// Async loading functions
+// NOTE: Async load handles are retrieved with GetAsync*() functions, that release the handle
+RLAPI void SetAsyncLoadBudget(float milliseconds);                // Set async load GPU upload time budget per frame (run on EndDrawing())
+RLAPI void SetAsyncLoadTransferBudget(int bytes);                 // Set async load GPU transfers bytes budget per frame (pixel buffers uploads)
+RLAPI int GetAsyncLoadState(unsigned int handle);                 // Get async load state (AsyncLoadState)
+RLAPI void WaitAsyncLoad(unsigned int handle);                    // Wait for async load to finish (runs pending upload stage)
+RLAPI unsigned int LoadFileDataAsync(const char *fileName);       // Load file data asynchronously (worker thread), returns async load handle
+RLAPI unsigned char *GetAsyncFileData(unsigned int handle, unsigned int *bytesRead);  // Get file data loaded asynchronously (waits for load to finish), memory must be UnloadFileData()
+
 // Compression/Encoding functionality
 RLAPI unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int codec); // Compress data with codec (CompressionCodec), memory must be MemFree()
+RLAPI int DecompressDataToBuffer(const unsigned char *compData, int compDataSize, unsigned char *buffer, int bufferSize, int codec); // Decompress data into provided buffer, returns data size or -1 on failure
+RLAPI CompressionStream *LoadCompressionStream(int codec);        // Load compression stream (CompressionCodec)
+RLAPI CompressionStream *LoadDecompressionStream(void);           // Load decompression stream (codec defined by stream data)
+RLAPI void UnloadCompressionStream(CompressionStream *stream);    // Unload compression/decompression stream
+RLAPI int FeedCompressionStream(CompressionStream *stream, const unsigned char *data, int dataSize); // Feed stream input data, returns bytes consumed or -1 on failure
+RLAPI int DrainCompressionStream(CompressionStream *stream, unsigned char *buffer, int bufferSize); // Drain stream output data, returns bytes written or -1 on failure
+RLAPI void FinishCompressionStream(CompressionStream *stream);    // Finish compression stream input, remaining data is output on drain
+RLAPI bool IsCompressionStreamDone(CompressionStream *stream);    // Check if stream finished and all output data was drained
 RLAPI char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 
 // Persistent storage management
-RLAPI bool SaveStorageValue(unsigned int position, int value);    // Save integer value to storage file (to defined position), returns true on success
-RLAPI int LoadStorageValue(unsigned int position);                // Load integer value from storage file (from defined position)
+// NOTE: Storage is cached on first access, changes are committed on FlushStorage() or once idle (write-behind)
+RLAPI bool SaveStorageValue(unsigned int position, int value);    // Save integer value to storage (to defined position), returns true on success
+RLAPI int LoadStorageValue(unsigned int position);                // Load integer value from storage (from defined position)
+RLAPI bool SaveStorageInt(const char *key, int value);            // Save integer value to storage (keyed entry), returns true on success
+RLAPI int LoadStorageInt(const char *key, int defaultValue);      // Load integer value from storage (keyed entry), default value if not found
+RLAPI bool SaveStorageFloat(const char *key, float value);        // Save float value to storage (keyed entry), returns true on success
+RLAPI float LoadStorageFloat(const char *key, float defaultValue);    // Load float value from storage (keyed entry), default value if not found
+RLAPI bool SaveStorageData(const char *key, const void *data, unsigned int size);              // Save bytes blob to storage (keyed entry), returns true on success
+RLAPI unsigned int LoadStorageData(const char *key, void *buffer, unsigned int bufferSize);    // Load bytes blob from storage (keyed entry) into buffer, returns blob size (0 if not found)
+RLAPI bool RemoveStorageKey(const char *key);                     // Remove keyed entry from storage, returns true if found
+RLAPI bool FlushStorage(void);                                    // Commit storage changes to file now (waits for write), returns true on success
 
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1090,6 +1915,9 @@ RLAPI void SetExitKey(int key);                               // Set a custom ke
 RLAPI int GetKeyPressed(void);                                // Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty
 RLAPI int GetCharPressed(void);                               // Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty
 
+// Input-related functions: events
+RLAPI bool PollInputEvent(InputEvent *event);                 // Get next input event registered on current frame, returns false when no events left
+
 // Input-related functions: gamepads
 RLAPI bool IsGamepadAvailable(int gamepad);                   // Check if a gamepad is available
 RLAPI const char *GetGamepadName(int gamepad);                // Get gamepad internal name id
@@ -1097,9 +1925,12 @@ RLAPI bool IsGamepadButtonPressed(int gamepad, int button);   // Check if a game
 RLAPI bool IsGamepadButtonDown(int gamepad, int button);      // Check if a gamepad button is being pressed
 RLAPI bool IsGamepadButtonReleased(int gamepad, int button);  // Check if a gamepad button has been released once
 RLAPI bool IsGamepadButtonUp(int gamepad, int button);        // Check if a gamepad button is NOT being pressed
+RLAPI double GetGamepadButtonTime(int gamepad, int button);   // Get time of last gamepad button press or release (PLATFORM_NX)
 RLAPI int GetGamepadButtonPressed(void);                      // Get the last gamepad button pressed
 RLAPI int GetGamepadAxisCount(int gamepad);                   // Get gamepad axis count for a gamepad
 RLAPI float GetGamepadAxisMovement(int gamepad, int axis);    // Get axis movement value for a gamepad axis
+RLAPI Vector3 GetGamepadAccelerometer(int gamepad);           // Get gamepad accelerometer value in G (PLATFORM_NX)
+RLAPI Vector3 GetGamepadGyroscope(int gamepad);               // Get gamepad gyroscope angular velocity in radians/second (PLATFORM_NX)
 RLAPI int SetGamepadMappings(const char *mappings);           // Set internal gamepad mappings (SDL_GameControllerDB)
 
 // Input-related functions: mouse
@@ -1154,6 +1985,8 @@ RLAPI void SetCameraMoveControls(int keyFront, int keyBack, int keyRight, int ke
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI Texture2D GetShapesTexture(void);                                 // Get texture that is used for shapes drawing
+RLAPI Rectangle GetShapesTextureRectangle(void);                        // Get texture source rectangle that is used for shapes drawing
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1165,6 +1998,7 @@ RLAPI void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color c
 RLAPI void DrawLineBezierQuad(Vector2 startPos, Vector2 endPos, Vector2 controlPos, float thick, Color color); // Draw line using quadratic bezier curves with a control point
 RLAPI void DrawLineBezierCubic(Vector2 startPos, Vector2 endPos, Vector2 startControlPos, Vector2 endControlPos, float thick, Color color); // Draw line using cubic bezier curves with 2 control points
 RLAPI void DrawLineStrip(Vector2 *points, int pointCount, Color color);                                  // Draw lines sequence
+RLAPI void DrawLineStripEx(Vector2 *points, int pointCount, float thick, int joinType, int capType, Color color); // Draw lines sequence defining thickness, joins and caps
 RLAPI void DrawCircle(int centerX, int centerY, float radius, Color color);                              // Draw a color-filled circle
 RLAPI void DrawCircleSector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color);      // Draw a piece of a circle
 RLAPI void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color); // Draw circle sector outline
@@ -1205,6 +2039,21 @@ RLAPI bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 start
 RLAPI bool CheckCollisionPointLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 RLAPI Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
+// Collision world functions (broadphase, 2d and 3d bodies)
+RLAPI CollisionWorld *LoadCollisionWorld(float cellSize, int capacity);                                  // Load collision world, uniform grid spatial hash (bodies ids in range [0..capacity - 1])
+RLAPI void UnloadCollisionWorld(CollisionWorld *world);                                                  // Unload collision world
+RLAPI void SetCollisionBodyRec(CollisionWorld *world, int id, Rectangle rec);                            // Add or move rectangle collision body (2d)
+RLAPI void SetCollisionBodyCircle(CollisionWorld *world, int id, Vector2 center, float radius);          // Add or move circle collision body (2d)
+RLAPI void SetCollisionBodyBox(CollisionWorld *world, int id, BoundingBox box);                          // Add or move bounding box collision body (3d)
+RLAPI void SetCollisionBodySphere(CollisionWorld *world, int id, Vector3 center, float radius);          // Add or move sphere collision body (3d)
+RLAPI void RemoveCollisionBody(CollisionWorld *world, int id);                                           // Remove collision body
+RLAPI int GetCollisionPairs(CollisionWorld *world, CollisionPair *pairs, int maxPairs);                  // Get colliding bodies pairs, returns pairs count (up to maxPairs)
+RLAPI int QueryCollisionRec(CollisionWorld *world, Rectangle rec, int *ids, int maxIds);                 // Get bodies ids colliding with rectangle, returns ids count
+RLAPI int QueryCollisionCircle(CollisionWorld *world, Vector2 center, float radius, int *ids, int maxIds);   // Get bodies ids colliding with circle, returns ids count
+RLAPI int QueryCollisionBox(CollisionWorld *world, BoundingBox box, int *ids, int maxIds);               // Get bodies ids colliding with bounding box, returns ids count
+RLAPI int QueryCollisionSphere(CollisionWorld *world, Vector3 center, float radius, int *ids, int maxIds);   // Get bodies ids colliding with sphere, returns ids count
+RLAPI int QueryCollisionRay(CollisionWorld *world, Ray ray, float maxDistance, int *ids, int maxIds);    // Get bodies ids hit by ray up to max distance, returns ids count
+
 //------------------------------------------------------------------------------------
 // Texture Loading and Drawing Functions (Module: textures)
 //------------------------------------------------------------------------------------
@@ -1215,11 +2064,14 @@ RLAPI Image LoadImage(const char *fileName);
 RLAPI Image LoadImageRaw(const char *fileName, int width, int height, int format, int headerSize);       // Load image from RAW file data
 RLAPI Image LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 RLAPI Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+RLAPI Image *LoadImagesParallel(const char **fileNames, int count);                                      // Load multiple images from files, decoded in parallel on async load workers
 RLAPI Image LoadImageFromTexture(Texture2D texture);                                                     // Load image from GPU texture data
 RLAPI Image LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
 RLAPI void UnloadImage(Image image);                                                                     // Unload image from CPU memory (RAM)
+RLAPI void UnloadImages(Image *images, int count);                                                       // Unload images array loaded with LoadImagesParallel()
 RLAPI bool ExportImage(Image image, const char *fileName);                                               // Export image data to file, returns true on success
 RLAPI bool ExportImageAsCode(Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
+RLAPI bool ExportImageView(ImageView view, const char *fileName);                                        // Export image view pixels to file (PNG encoded in place), returns true on success
 
 // Image generation functions
 RLAPI Image GenImageColor(int width, int height, Color color);                                           // Generate image: plain color
@@ -1233,6 +2085,8 @@ RLAPI Image GenImageCellular(int width, int height, int tileSize);
 // Image manipulation functions
 RLAPI Image ImageCopy(Image image);                                                                      // Create an image duplicate (useful for transformations)
 RLAPI Image ImageFromImage(Image image, Rectangle rec);                                                  // Create an image from another image piece
+RLAPI ImageView GetImageView(Image image, Rectangle rec);                                                 // Get image piece view, pixels referenced without copy (rectangle clamped to image)
+RLAPI Image ImageFromView(ImageView view);                                                               // Create an image from image view pixels (copy)
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
@@ -1247,6 +2101,7 @@ RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Compute all mipmap levels for a provided image
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+RLAPI Color *ImageQuantize(Image *image, int maxPaletteSize, bool dither, int *colorCount);              // Quantize image colors to indexed image (median cut, up to 256 colors), returns palette
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
 RLAPI void ImageRotateCW(Image *image);                                                                  // Rotate image clockwise 90deg
@@ -1261,6 +2116,7 @@ RLAPI Color *LoadImageColors(Image image);
 RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a Color array (RGBA - 32bit)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
+RLAPI Image LoadImageFromIndexed(Image indexed, const Color *palette, int colorCount);                    // Load image from indexed image (palette indices) and palette
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
 RLAPI Color GetImageColor(Image image, int x, int y);                                                    // Get image pixel color at (x, y) position
 
@@ -1278,25 +2134,99 @@ RLAPI void ImageDrawRectangleV(Image *dst, Vector2 position, Vector2 size, Color
 RLAPI void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);                                // Draw rectangle within an image
 RLAPI void ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color);                   // Draw rectangle lines within an image
 RLAPI void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);             // Draw a source image within a destination image (tint applied to source)
+RLAPI void ImageDrawView(Image *dst, ImageView src, Vector2 position, Color tint);                        // Draw a source image view within a destination image (no scaling, tint applied to source)
 RLAPI void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color);   // Draw text (using default font) within an image (destination)
 RLAPI void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text (custom sprite font) within an image (destination)
 
 // Texture loading functions
 // NOTE: These functions require GPU access
 RLAPI Texture2D LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
+RLAPI unsigned int LoadTextureAsync(const char *fileName);                                                // Load texture from file asynchronously, returns async load handle
+RLAPI Texture2D GetAsyncTexture(unsigned int handle);                                                    // Get texture loaded asynchronously (waits for load to finish)
 RLAPI Texture2D LoadTextureFromImage(Image image);                                                       // Load texture from image data
+RLAPI Texture2D LoadTextureFromView(ImageView view);                                                     // Load texture from image view pixels (rows uploaded in place)
+RLAPI Texture2DArray LoadTextureArray(const Image *images, int count);                                   // Load texture array from images, one layer per image (same size required)
+RLAPI Texture2DArray LoadTextureArrayFromImage(Image image, int columns, int rows);                      // Load texture array from image grid, one layer per cell (row by row)
+RLAPI Texture3D LoadTexture3D(Image image, int depth);                                                   // Load 3D texture from image, slices stacked vertically
 RLAPI TextureCubemap LoadTextureCubemap(Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
+RLAPI TextureCubemap LoadTextureCubemapFromFile(const char *fileName);                                   // Load cubemap with mipmaps from file (KTX), exported with ExportTextureCubemap()
+RLAPI bool ExportTextureCubemap(TextureCubemap cubemap, const char *fileName);                           // Export cubemap with mipmaps to file (KTX), returns true on success
+RLAPI TextureCubemap GenTextureCubemapFromPanorama(Texture2D panorama, int size, int format);            // Generate cubemap from equirectangular panorama texture (GPU, mipmaps generated)
+RLAPI TextureCubemap GenTextureIrradiance(TextureCubemap cubemap, int size);                             // Generate irradiance cubemap from environment cubemap (GPU, diffuse convolution)
+RLAPI TextureCubemap GenTexturePrefilter(TextureCubemap cubemap, int size);                              // Generate prefiltered specular cubemap from environment cubemap (GPU, roughness per mipmap)
+RLAPI Texture2D GenTextureBRDF(int size);                                                                // Generate BRDF integration lookup texture (GPU, split-sum approximation)
+RLAPI Texture2D GenTextureGradientRadial(int width, int height, float density, Color inner, Color outer);  // Generate texture: radial gradient (GPU)
+RLAPI Texture2D GenTextureChecked(int width, int height, int checksX, int checksY, Color col1, Color col2); // Generate texture: checked (GPU)
+RLAPI Texture2D GenTextureWhiteNoise(int width, int height, float factor);                               // Generate texture: white noise (GPU)
+RLAPI Texture2D GenTextureCellular(int width, int height, int tileSize);                                 // Generate texture: cellular algorithm, bigger tileSize means bigger cells (GPU)
+RLAPI Texture2D GenTexturePerlinNoise(int width, int height, int offsetX, int offsetY, float scale);      // Generate texture: perlin noise (GPU)
 RLAPI RenderTexture2D LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
+RLAPI RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool useDepth);             // Load texture for rendering (framebuffer) with color format and optional depth
+RLAPI RenderTexture2D LoadRenderTextureDepthTex(int width, int height, int format);                      // Load texture for rendering (framebuffer) with depth texture (depth can be sampled)
+RLAPI RenderTexture2D GetRenderTextureTransient(int width, int height, int format, bool useDepth);       // Get transient render texture from pool, recycled on EndDrawing()
+RLAPI void ReleaseRenderTextureTransient(RenderTexture2D target);                                        // Release transient render texture to pool before EndDrawing()
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+RLAPI void UnloadTextureArray(TextureArray texture);                                                     // Unload texture array or 3D texture from GPU memory (VRAM)
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
+RLAPI void UpdateTextureFromView(Texture2D texture, Vector2 position, ImageView view);                   // Update GPU texture rectangle at position with image view pixels (rows uploaded in place)
+RLAPI void UpdateTextureArrayLayer(TextureArray texture, int layer, Image image);                        // Update texture array layer (or 3D texture slice) with image data
 
 // Texture configuration functions
 RLAPI void GenTextureMipmaps(Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
+RLAPI void GenTextureArrayMipmaps(TextureArray *texture);                                                // Generate GPU mipmaps for a texture array (per layer) or 3D texture
 RLAPI void SetTextureFilter(Texture2D texture, int filter);                                              // Set texture scaling filter mode
 RLAPI void SetTextureWrap(Texture2D texture, int wrap);                                                  // Set texture wrapping mode
 
+// Texture streaming functions
+// NOTE: Streamed textures keep smallest mipmaps resident, higher mipmaps are loaded on demand within a VRAM budget
+RLAPI Texture2D LoadTextureStreamed(const char *fileName);                                               // Load texture for mipmaps streaming (DDS/KTX compressed with mipmaps)
+RLAPI bool IsTextureStreamed(Texture2D texture);                                                         // Check if a texture mipmaps are streamed
+RLAPI void SetTextureStreamingUsage(Texture2D texture, float screenSize);                                // Set streamed texture usage for current frame (size on screen in pixels)
+RLAPI void SetTextureStreamingBudget(int bytes);                                                         // Set VRAM budget for streamed textures mipmaps (in bytes)
+RLAPI int GetTextureStreamingMemory(void);                                                               // Get VRAM used by streamed textures mipmaps (in bytes)
+
+// Sprite atlas functions
+// NOTE: Sprites are packed into atlas pages, sprites drawn from the same page do not break batching
+RLAPI Image *GenImageSpriteAtlas(const Image *images, int count, int pageSize, int padding, Rectangle *recs, int *pages, int *pageCount); // Generate sprite atlas pages images, sprites rectangles and pages indices (-1 if not packed)
+RLAPI SpriteAtlas LoadSpriteAtlas(const Image *images, int count, int pageSize, int padding);              // Load sprite atlas from images, pages uploaded to GPU (VRAM)
+RLAPI SpriteAtlas LoadSpriteAtlasFromFiles(const char **fileNames, int count, int pageSize, int padding);  // Load sprite atlas from image files (decoded in parallel)
+RLAPI void UnloadSpriteAtlas(SpriteAtlas atlas);                                                         // Unload sprite atlas pages (VRAM) and sprites
+
+// Animated texture functions
+// NOTE: Frames are decoded ahead of playback by a job into a small frames ring, only current frame is uploaded
+RLAPI TextureAnim LoadTextureAnim(const char *fileName);                                                 // Load animated texture from file (GIF), first frame uploaded
+RLAPI void UnloadTextureAnim(TextureAnim anim);                                                          // Unload animated texture and frames decoding data
+RLAPI void UpdateTextureAnim(TextureAnim *anim, float deltaTime);                                        // Update animated texture playback by time (in seconds), uploads new current frame
+
+// Video playback functions
+// NOTE: Frames are decoded by a job into a small frames ring, YUV planes are converted to RGB on drawing (built-in shader)
+RLAPI VideoStream LoadVideoStream(const char *fileName);                                                 // Load video stream from file (Y4M, YUV 4:2:0)
+RLAPI VideoStream LoadVideoStreamFromDecoder(VideoDecoder decoder);                                      // Load video stream from custom decoder (decoder closed on unload)
+RLAPI void UnloadVideoStream(VideoStream video);                                                         // Unload video stream, textures, audio stream and decoder
+RLAPI void PlayVideoStream(VideoStream video);                                                           // Start video playback
+RLAPI void PauseVideoStream(VideoStream video);                                                          // Pause video playback
+RLAPI bool IsVideoStreamPlaying(VideoStream video);                                                      // Check if video is playing (false once last frame played, if not looping)
+RLAPI void UpdateVideoStream(VideoStream *video, float deltaTime);                                       // Update video playback by time (in seconds), uploads new current frame and audio
+RLAPI void DrawVideoStream(VideoStream video, Rectangle dest, Color tint);                                // Draw video current frame in destination rectangle (YUV to RGB conversion)
+
+// Post-processing functions
+// NOTE: Adjacent color effects are fused into one pass, intermediate render textures are pooled and invalidated
+RLAPI PostProcess LoadPostProcess(int width, int height);                                                // Load post-processing chain, scene drawn at width x height
+RLAPI void UnloadPostProcess(PostProcess *postProcess);                                                  // Unload post-processing chain (effects shaders not unloaded)
+RLAPI int AddPostEffect(PostProcess *postProcess, Shader shader, float scale);                           // Add shader pass at resolution scale, scene available as 'texture1', returns effect index
+RLAPI int AddPostColorEffect(PostProcess *postProcess, const char *code, Vector4 params);                // Add per-pixel color effect (GLSL code), fused with adjacent color effects, returns effect index
+RLAPI void SetPostEffectParams(PostProcess *postProcess, int index, Vector4 params);                    // Set color effect parameters
+RLAPI void BeginPostProcess(PostProcess *postProcess);                                                   // Begin drawing scene to post-processing chain
+RLAPI void EndPostProcess(PostProcess *postProcess);                                                     // End drawing scene and draw post-processing chain to screen
+
+// Reduced resolution effects functions
+// NOTE: Blended effects (particles, smoke) are drawn to a pooled reduced resolution render texture, depth tested
+// against downsampled scene depth and composited back to current render target with a depth-aware upsample
+RLAPI void BeginLowResEffects(int downscale, Texture2D sceneDepth);                                      // Begin drawing blended effects at reduced resolution (2: half, 4: quarter), scene depth texture optional (id 0)
+RLAPI void EndLowResEffects(void);                                                                       // End drawing blended effects and composite them to current render target (bilateral upsample)
+
 // Texture drawing functions
 RLAPI void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
 RLAPI void DrawTextureV(Texture2D texture, Vector2 position, Color tint);                                // Draw a Texture2D with position defined as Vector2
@@ -1307,6 +2237,10 @@ RLAPI void DrawTextureTiled(Texture2D texture, Rectangle source, Rectangle dest,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);           // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint);   // Draws a texture (or part of it) that stretches or shrinks nicely
 RLAPI void DrawTexturePoly(Texture2D texture, Vector2 center, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint);       // Draw a textured polygon
+RLAPI void DrawSprite(SpriteRef sprite, Vector2 position, Color tint);                                   // Draw a sprite (atlas page part)
+RLAPI void DrawSpriteEx(SpriteRef sprite, Vector2 position, float rotation, float scale, Color tint);   // Draw a sprite with extended parameters
+RLAPI void DrawSpritePro(SpriteRef sprite, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a sprite with 'pro' parameters
+RLAPI void DrawSpriteInstances(Texture2D texture, const SpriteInstance *sprites, int count);            // Draw sprites sharing one texture, big batches drawn as instanced quads
 
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1329,22 +2263,32 @@ RLAPI int GetPixelDataSize(int width, int height, int format);              // G
 // Font loading/unloading functions
 RLAPI Font GetFontDefault(void);                                                            // Get the default Font
 RLAPI Font LoadFont(const char *fileName);                                                  // Load font from file into GPU memory (VRAM)
+RLAPI unsigned int LoadFontAsync(const char *fileName);                                     // Load font from file asynchronously, returns async load handle
+RLAPI Font GetAsyncFont(unsigned int handle);                                               // Get font loaded asynchronously (waits for load to finish)
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load font from file with extended parameters, use NULL for fontChars and 0 for glyphCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontSDF(const char *fileName, int fontSize, int *fontChars, int glyphCount);  // Load SDF font from TTF file, one atlas for any drawing size
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);             // Load dynamic font from TTF file, glyphs rasterized on demand into atlas (LRU eviction)
+RLAPI Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load dynamic font from memory buffer, fileType refers to extension: i.e. '.ttf'
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **recs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 RLAPI void UnloadFontData(GlyphInfo *chars, int glyphCount);                                // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload font from GPU memory (VRAM)
+RLAPI bool ExportFont(Font font, const char *fileName);                                     // Export font as cooked binary file (.rfnt), returns true on success
 RLAPI bool ExportFontAsCode(Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Draw last frame render stats (draw calls, batch flushes, vertex, textures, CPU/GPU times)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing); // Load text layout, glyphs quads precomputed for static text
+RLAPI void UnloadTextLayout(TextLayout layout);                                              // Unload text layout data
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                  // Draw text layout, glyphs quads emitted in one batch
 
 // Text font info functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1406,35 +2350,80 @@ RLAPI void DrawPlane(Vector3 centerPos, Vector2 size, Color color);
 RLAPI void DrawRay(Ray ray, Color color);                                                                // Draw a ray line
 RLAPI void DrawGrid(int slices, float spacing);                                                          // Draw a grid (centered at (0, 0, 0))
 
+// Debug draw functions (retained primitives drawn in one batch, empty without SUPPORT_DEBUG_DRAW)
+RLAPI void AddDebugLine(Vector3 startPos, Vector3 endPos, Color color, float duration);                  // Add debug line (duration in seconds, 0 for one frame)
+RLAPI void AddDebugBox(BoundingBox box, Color color, float duration);                                    // Add debug box wires
+RLAPI void AddDebugSphere(Vector3 center, float radius, Color color, float duration);                    // Add debug sphere wires (three axis circles)
+RLAPI void AddDebugAxes(Matrix transform, float size, float duration);                                   // Add debug transform axes (X red, Y green, Z blue)
+RLAPI void AddDebugGrid(int slices, float spacing, Color color, float duration);                         // Add debug grid (XZ plane, centered at (0, 0, 0))
+RLAPI void DrawDebugPrimitives(void);                                                                    // Draw debug primitives (inside BeginMode3D()), expired ones are removed
+RLAPI void ClearDebugPrimitives(void);                                                                   // Clear all debug primitives
+RLAPI void SetDebugDrawDepthTest(bool enabled);                                                          // Set debug primitives depth test (enabled by default)
+
 //------------------------------------------------------------------------------------
 // Model 3d Loading and Drawing Functions (Module: models)
 //------------------------------------------------------------------------------------
 
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
+RLAPI unsigned int LoadModelAsync(const char *fileName);                                    // Load model from file asynchronously, returns async load handle
+RLAPI Model GetAsyncModel(unsigned int handle);                                             // Get model loaded asynchronously (waits for load to finish)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI void UnloadModelKeepMeshes(Model model);                                              // Unload model (but not meshes) from memory (RAM and/or VRAM)
+RLAPI bool ExportModel(Model model, const ModelAnimation *animations, int animCount, const char *fileName);  // Export model (and animations, optional) as cooked .rmdl file, returns true on success
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI void GenModelLods(Model *model, int levels, float reduction);                         // Generate model simplified levels of detail (reduction: triangles kept per level)
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);                           // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);                      // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
+RLAPI void DrawModelCulled(Model model, Frustum frustum, Vector3 position, float scale, Color tint);   // Draw a model, meshes outside frustum are skipped
+RLAPI void DrawModelExCulled(Model model, Frustum frustum, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters, meshes outside frustum are skipped
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                               // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint);   // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint); // Draw a billboard texture defined by source
 RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint); // Draw a billboard texture defined by source and rotation
+RLAPI void DrawBillboards(Camera camera, Texture2D texture, const Billboard *billboards, int count, Vector3 up);  // Draw billboards batch sharing texture (big batches drawn as instanced quads)
 
 // Mesh management functions
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
+RLAPI void SetMeshMorphWeights(Mesh mesh, const float *weights, int count);                 // Set mesh morph targets weights (blended on GPU if supported)
+RLAPI void *MapMeshBuffer(Mesh mesh, int index);                                             // Map mesh vertex buffer for writing (previous data discarded, whole buffer must be written)
+RLAPI void UnmapMeshBuffer(Mesh mesh, int index);                                            // Unmap mesh vertex buffer, written data is used by next draws
+RLAPI void SetMeshQuantization(unsigned int flags);                                         // Set vertex attributes quantization for next static meshes uploaded (MeshQuantizeFlags)
+RLAPI void SetMeshInterleaving(bool enabled);                                               // Set vertex attributes interleaving for next static meshes uploaded (single vertex buffer)
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
+RLAPI void UnloadMeshCPUData(Mesh *mesh);                                                   // Unload mesh vertex attributes kept in CPU after upload, positions and indices kept for collisions
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI int DrawMeshInstancedCulled(Mesh mesh, Material material, Frustum frustum, const Matrix *transforms, int instances); // Draw multiple mesh instances, instances outside frustum are skipped, returns instances drawn
+RLAPI void BeginRenderQueue(void);                                                          // Begin deferred 3D render queue, DrawMesh()/DrawModel() are recorded
+RLAPI void EndRenderQueue(void);                                                            // End deferred 3D render queue, recorded draws are sorted and drawn
+RLAPI void SetRenderQueuePass(int pass);                                                    // Set render pass for next recorded draws (RenderPass)
+RLAPI void SetRenderQueueShadows(bool castShadows);                                         // Set if next recorded draws cast shadows (dynamic shadow casters)
+RLAPI void SetRenderQueueInstancing(bool enabled);                                          // Set render queue automatic instancing, repeated draws of same mesh and material are drawn as instances
+RLAPI void SetRenderQueuePickId(unsigned int id);                                           // Set picking id for next recorded draws (0: not pickable)
+RLAPI void RequestRenderQueuePick(Vector2 position);                                        // Request picking of draw id under position, rendered by next EndRenderQueue() and read back later
+RLAPI unsigned int GetRenderQueuePick(void);                                                // Get last picked draw id read back (0: no draw)
+RLAPI void SetOcclusionCulling(bool enabled);                                               // Set occlusion culling, large meshes occluded on previous frame are skipped (GPU occlusion queries)
+RLAPI int GetOcclusionCulledCount(void);                                                    // Get draws found occluded on last frame (occlusion culling)
+RLAPI void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count); // Draw mesh instances range with material and instance buffer data
+RLAPI void DrawMeshInstancedBufferCulled(Mesh mesh, Material material, InstanceBuffer buffer, Frustum frustum); // Draw instance buffer instances inside frustum (culled on GPU with compute shaders when supported)
+RLAPI void DrawMeshInstancedAnimated(Mesh mesh, Material material, AnimationTexture texture, InstanceBuffer buffer, float time); // Draw skinned mesh instances animated from animation texture (instance custom data selects animation)
+
+// Instance buffer management functions
+RLAPI InstanceBuffer LoadInstanceBuffer(int capacity);                                      // Load instance buffer with initial capacity (instances)
+RLAPI void UpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, const Color *colors, const Vector4 *custom, int offset, int count); // Update instances range data (NULL streams not updated), buffer grows if required
+RLAPI void UnloadInstanceBuffer(InstanceBuffer buffer);                                     // Unload instance buffer data from CPU and GPU
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
-RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
+RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Get mesh bounding box limits (cached bounds if computed and positions not updated since)
+RLAPI void UpdateMeshBounds(Mesh *mesh);                                                    // Compute and cache mesh bounds (required if vertices are modified)
+RLAPI Mesh GenMeshSimplified(Mesh mesh, int triangleCount);                                 // Generate simplified mesh by edge collapse (target triangles count)
+RLAPI void OptimizeMesh(Mesh *mesh, int flags);                                             // Optimize mesh vertex data before upload: welding, triangles and vertices order (MeshOptimizeFlags)
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
 RLAPI void GenMeshBinormals(Mesh *mesh);                                                    // Compute mesh binormals
 
@@ -1461,20 +2450,141 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount);   // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation bones matrices (GPU skinning)
+RLAPI ModelPose LoadModelPose(Model model);                                                 // Load model pose buffer (initialized to bind pose)
+RLAPI void UnloadModelPose(ModelPose pose);                                                 // Unload model pose buffer
+RLAPI void SampleModelAnimation(ModelPose *pose, ModelAnimation anim, float frame);         // Sample model animation pose at fractional frame (interpolated)
+RLAPI void BlendModelPoses(ModelPose *pose, const ModelPose *poses, const float *weights, int count);      // Blend several model poses linearly by weight
+RLAPI void BlendModelPoseAdditive(ModelPose *pose, ModelPose additive, ModelPose reference, float weight); // Blend additive pose (additive - reference) into pose
+RLAPI void UpdateModelPose(Model model, ModelPose *pose);                                   // Update model with pose (computes bones matrices and skins once)
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, unsigned int count);           // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI void CompressModelAnimation(ModelAnimation *anim, float tolerance);                  // Compress model animation (keyframe reduction and quantization, decoded on sampling)
+RLAPI MorphAnimation *LoadMorphAnimations(const char *fileName, unsigned int *animCount);   // Load morph targets weights animations from file (glTF weights channels)
+RLAPI void UpdateModelMorphAnimation(Model model, MorphAnimation anim, int frame);          // Update model meshes morph targets weights for a given frame
+RLAPI void UnloadMorphAnimations(MorphAnimation *animations, unsigned int count);           // Unload morph animations array data
+RLAPI AnimationTexture LoadAnimationTexture(Model model, const ModelAnimation *animations, int animCount); // Load animations bones matrices baked into texture (instanced animated draws)
+RLAPI void UnloadAnimationTexture(AnimationTexture texture);                                // Unload animation texture from CPU and GPU
+RLAPI Vector4 GetAnimationInstanceData(AnimationTexture texture, int animIndex, float frameOffset, float frameRate); // Get instance custom data to play animation (first frame, frames count, offset, rate)
+
+// Animation scheduler functions
+RLAPI AnimationScheduler LoadAnimationScheduler(void);                                      // Load animation scheduler (default projected size thresholds)
+RLAPI void UnloadAnimationScheduler(AnimationScheduler scheduler);                          // Unload animation scheduler (registered models are not unloaded)
+RLAPI AnimatedModel LoadAnimatedModel(Model model, ModelAnimation anim, float frameRate);    // Load animated model instance (pose buffers, bind pose bounds)
+RLAPI void UnloadAnimatedModel(AnimatedModel animModel);                                    // Unload animated model instance (model and animation are not unloaded)
+RLAPI void SetAnimatedModelAnimation(AnimatedModel *animModel, ModelAnimation anim, float frame); // Set animated model playing animation and frame (pose sampled on next update)
+RLAPI void RegisterAnimatedModel(AnimationScheduler *scheduler, AnimatedModel *animModel);  // Register animated model on scheduler
+RLAPI void UnregisterAnimatedModel(AnimationScheduler *scheduler, AnimatedModel *animModel); // Unregister animated model from scheduler
+RLAPI void UpdateAnimationScheduler(AnimationScheduler *scheduler, Camera camera, float deltaTime); // Advance registered models animations, bones updated at a rate depending on projected size
+RLAPI void DrawAnimatedModel(AnimatedModel animModel, Color tint);                           // Draw animated model with its own bones matrices
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
 RLAPI bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2);                                 // Check collision between two bounding boxes
 RLAPI bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius);                  // Check collision between box and sphere
+RLAPI Frustum GetCameraFrustum(Camera camera, float aspect);                                       // Get camera view frustum planes (same projection as BeginMode3D())
+RLAPI Frustum GetMatrixFrustum(Matrix matViewProjection);                                           // Get frustum planes from combined view-projection matrix
+RLAPI bool CheckFrustumSphere(Frustum frustum, Vector3 center, float radius);                      // Check if sphere is (partially) inside frustum
+RLAPI bool CheckFrustumBox(Frustum frustum, BoundingBox box);                                      // Check if bounding box is (partially) inside frustum
 RLAPI RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision GetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
 RLAPI RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
+// Mesh BVH collision functions
+RLAPI MeshBVH LoadMeshBVH(Mesh mesh);                                                               // Load mesh triangles bounding volume hierarchy (SAH built, mesh vertices copied)
+RLAPI void UnloadMeshBVH(MeshBVH bvh);                                                              // Unload mesh bounding volume hierarchy
+RLAPI RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform);                  // Get closest collision info between ray and mesh BVH
+RLAPI void GetRayCollisionsMeshBVH(const Ray *rays, RayCollision *collisions, int count, MeshBVH bvh, Matrix transform);  // Get closest collisions info between rays and mesh BVH
+RLAPI RayCollision GetRayCollisionMeshBVHAny(Ray ray, MeshBVH bvh, Matrix transform, float maxDistance);  // Get any collision info between ray and mesh BVH up to max distance (line of sight)
+RLAPI bool CheckCollisionMeshBVHSphere(MeshBVH bvh, Matrix transform, Vector3 center, float radius);     // Check collision between mesh BVH triangles and sphere
+RLAPI bool CheckCollisionMeshBVHBox(MeshBVH bvh, Matrix transform, BoundingBox box);                 // Check collision between mesh BVH triangles and box
+
+// Voxel map functions
+RLAPI VoxelMap LoadVoxelMap(int width, int height, int depth, Vector3 voxelSize);                  // Load empty voxel map (white palette, no atlas)
+RLAPI VoxelMap LoadVoxelMapFromCubicmap(Image cubicmap, Vector3 cubeSize);                          // Load voxel map from cubicmap image (GenMeshCubicmap() layout and 2x2 atlas)
+RLAPI void UnloadVoxelMap(VoxelMap map);                                                            // Unload voxel map data and chunks meshes (RAM and VRAM)
+RLAPI void SetVoxel(VoxelMap *map, int x, int y, int z, unsigned char id);                          // Set voxel id (0: empty), affected chunks are marked for rebuild
+RLAPI unsigned char GetVoxel(VoxelMap map, int x, int y, int z);                                    // Get voxel id (0 if empty or outside map)
+RLAPI void UpdateVoxelMap(VoxelMap *map);                                                           // Rebuild and upload dirty chunks meshes
+RLAPI void DrawVoxelMap(VoxelMap map, Material material, Vector3 position);                          // Draw voxel map chunks
+RLAPI void DrawVoxelMapCulled(VoxelMap map, Material material, Frustum frustum, Vector3 position);   // Draw voxel map chunks, chunks outside frustum are skipped
+
+// Terrain functions
+RLAPI Terrain LoadTerrain(Image heightmap, Vector3 size);                                          // Load chunked terrain from heightmap image (GenMeshHeightmap() placement)
+RLAPI void UnloadTerrain(Terrain terrain);                                                          // Unload terrain heights and chunks meshes (RAM and VRAM)
+RLAPI void DrawTerrain(Terrain terrain, Material material, Vector3 position);                       // Draw terrain chunks, levels of detail and culling from current view and projection
+RLAPI float GetTerrainHeight(Terrain terrain, Vector3 position, float x, float z);                  // Get terrain surface height at world position (x, z), clamped to terrain borders
+RLAPI Vector3 GetTerrainNormal(Terrain terrain, Vector3 position, float x, float z);                // Get terrain surface normal at world position (x, z), clamped to terrain borders
+RLAPI void GetTerrainHeights(Terrain terrain, Vector3 position, const Vector2 *points, float *heights, int count);  // Get terrain surface heights at many world positions (points as x, z)
+RLAPI RayCollision GetRayCollisionTerrain(Ray ray, Terrain terrain, Vector3 position);              // Get collision info between ray and terrain surface (cells traversal, no mesh raycast)
+
+// Tilemap functions
+RLAPI Tilemap LoadTilemap(Texture2D tileset, int tileWidth, int tileHeight, int width, int height, int layerCount);  // Load empty tilemap (all tiles -1), tileset is not copied
+RLAPI void UnloadTilemap(Tilemap map);                                                              // Unload tilemap data and chunks meshes (RAM and VRAM), tileset is not unloaded
+RLAPI void SetTilemapTile(Tilemap *map, int layer, int x, int y, int tile);                         // Set tile id (-1: empty), tile chunk layer is marked for rebuild
+RLAPI int GetTilemapTile(Tilemap map, int layer, int x, int y);                                     // Get tile id (-1 if empty or outside map)
+RLAPI void SetTilemapLayer(Tilemap *map, int layer, const int *tiles);                              // Set layer tiles ids (width*height), chunks with changed tiles are marked for rebuild
+RLAPI void SetTilemapAnimation(Tilemap *map, int tile, int frameCount, float frameTime);            // Set animated tile (frames are consecutive tileset tiles), frameCount < 2 removes animation
+RLAPI void UpdateTilemap(Tilemap *map);                                                             // Rebuild and upload dirty chunks layers meshes
+RLAPI void DrawTilemap(Tilemap map, Camera2D camera, Vector2 position, Color tint);                 // Draw tilemap layers, chunks outside camera view are skipped
+RLAPI void DrawTilemapLayer(Tilemap map, int layer, Camera2D camera, Vector2 position, Color tint); // Draw tilemap layer, chunks outside camera view are skipped
+
+// World streaming functions
+// NOTE: Sectors manifests and resources are loaded asynchronously, models and textures shared by sectors are loaded once
+RLAPI World LoadWorld(const char *fileName);                                                        // Load world manifest (sectors grid), no sector content is loaded until UpdateWorld()
+RLAPI void UnloadWorld(World world);                                                                // Unload world and loaded sectors content (pending loads are finished first)
+RLAPI void UpdateWorld(World *world, Vector3 position);                                             // Stream sectors around position: load near sectors, unload far ones, evict over budget
+RLAPI void DrawWorld(World world, Color tint);                                                      // Draw loaded sectors objects
+
+// Particle system functions
+RLAPI ParticleSystem LoadParticleSystem(ParticleEmitter emitter, int maxParticles);                 // Load particle system, particles simulated by compute shader when supported (CPU otherwise)
+RLAPI void UnloadParticleSystem(ParticleSystem system);                                             // Unload particle system state (RAM and/or VRAM)
+RLAPI void EmitParticles(ParticleSystem *system, int count);                                        // Emit particles burst on next update
+RLAPI void UpdateParticleSystem(ParticleSystem *system, float deltaTime);                           // Emit particles (emission rate and bursts) and simulate alive particles
+RLAPI void DrawParticleSystem(ParticleSystem system, Texture2D texture);                            // Draw particles as camera-facing textured quads (instanced, no CPU readback)
+
+// Lighting functions
+// NOTE: Meshes with normals drawn with default material shader are lit while any light is active (clustered forward lighting)
+RLAPI int AddPointLight(Vector3 position, float radius, Color color, float intensity);              // Add point light, returns light id (-1 if maximum lights reached)
+RLAPI void UpdatePointLight(int id, Vector3 position, float radius, Color color, float intensity);  // Update point light parameters
+RLAPI void RemovePointLight(int id);                                                                // Remove point light
+RLAPI void SetDirectionalLight(Vector3 direction, Color color);                                     // Set directional light (direction light travels), BLACK disables it
+RLAPI void SetAmbientLight(Color color);                                                            // Set ambient light color
+RLAPI const char *GetLightingShaderInclude(void);                                                   // Get clustered lighting GLSL code for custom shaders (GLSL 330), defines GetLighting()
+RLAPI void SetShaderLighting(Shader shader);                                                        // Set clustered lighting data to custom shader, lights binned for current camera
+RLAPI void SetDirectionalShadows(bool enabled);                                                     // Set directional light shadows (cascaded shadow maps, rendered by EndRenderQueue())
+RLAPI void SetPointLightShadows(int id, bool enabled);                                              // Set point light shadows (up to MAX_SHADOWED_POINT_LIGHTS)
+RLAPI int AddShadowCaster(Mesh mesh, Matrix transform);                                             // Add static shadow caster (cached shadow tiles), returns caster id
+RLAPI void RemoveShadowCaster(int id);                                                              // Remove static shadow caster
+
+// Lightmap functions
+// NOTE: Default material meshes with texcoords2 and a MATERIAL_MAP_LIGHTMAP texture are drawn with baked lighting only
+RLAPI void GenModelLightmapUVs(Model *model, int size, int padding);                                 // Generate model lightmap texture coordinates (texcoords2), meshes charts packed into one size x size atlas
+RLAPI Image BakeModelLightmap(Model model, int size, int samples);                                  // Bake current lights into model lightmap: direct light and one bounce (samples rays per texel), multithreaded
+
+// Static batch functions
+RLAPI StaticBatch LoadStaticBatch(const Mesh *meshes, const Material *materials, const Matrix *transforms, int count); // Load static batch, meshes transformed and merged by material
+RLAPI void UnloadStaticBatch(StaticBatch batch);                                                    // Unload static batch merged meshes (materials shaders and textures not unloaded)
+RLAPI void DrawStaticBatch(StaticBatch batch);                                                      // Draw static batch, one draw per merged mesh
+RLAPI void DrawStaticBatchCulled(StaticBatch batch, Frustum frustum);                               // Draw static batch, objects outside frustum are skipped
+
+// Scene functions
+RLAPI Scene LoadScene(int capacity);                                                                // Load scene transforms hierarchy (nodes capacity grows as required)
+RLAPI void UnloadScene(Scene scene);                                                                // Unload scene nodes data
+RLAPI int AddSceneNode(Scene *scene, int parent, Transform transform);                              // Add scene node with local transform (parent -1 for root), returns node index
+RLAPI void SetSceneNodeTransform(Scene *scene, int node, Transform transform);                      // Set scene node local transform, subtree marked for update
+RLAPI Transform GetSceneNodeTransform(Scene scene, int node);                                       // Get scene node local transform
+RLAPI Matrix GetSceneNodeMatrix(Scene scene, int node);                                             // Get scene node world matrix (as of last UpdateScene())
+RLAPI void UpdateScene(Scene *scene);                                                               // Update world matrices of changed nodes subtrees
+RLAPI void DrawSceneModel(Scene scene, int node, Model model, Color tint);                          // Draw a model with scene node world transform
+RLAPI void DrawSceneModelCulled(Scene scene, int node, Model model, Frustum frustum, Color tint);    // Draw a model with scene node world transform, meshes outside frustum are skipped
+RLAPI SceneModel LoadSceneModel(const char *fileName, Scene *scene, int parent);                    // Load model nodes hierarchy into scene (under a root node added to parent), shared meshes loaded once
+RLAPI void UnloadSceneModel(SceneModel sceneModel);                                                 // Unload scene model meshes, materials and instances (scene nodes are kept)
+RLAPI void DrawSceneModelNodes(Scene scene, SceneModel sceneModel, Color tint);                     // Draw scene model meshes with nodes world transforms, instanced nodes drawn with one draw per mesh
+
 //------------------------------------------------------------------------------------
 // Audio Loading and Playing Functions (Module: audio)
 //------------------------------------------------------------------------------------
@@ -1484,13 +2594,22 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
+RLAPI void SuspendAudioDevice(void);                                  // Suspend audio device mixing (application out of focus)
+RLAPI void ResumeAudioDevice(void);                                   // Resume audio device mixing
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI AudioMixerStats GetAudioMixerStats(void);                       // Get audio mixer thread stats (periods, frames, DSP load, voices and mixing time)
+RLAPI void SetAudioDeviceConfig(AudioDeviceConfig config);            // Set audio device config: sample rate, periods and latency profile (before InitAudioDevice())
+RLAPI AudioDeviceConfig GetAudioDeviceConfig(void);                   // Get audio device config, actual device values once initialized
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
 RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load wave from memory buffer, fileType refers to extension: i.e. '.wav'
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI unsigned int LoadSoundAsync(const char *fileName);              // Load sound from file asynchronously, returns async load handle
+RLAPI Sound GetAsyncSound(unsigned int handle);                       // Get sound loaded asynchronously (waits for load to finish)
+RLAPI Sound LoadSoundCompressed(const char *fileName);               // Load sound from file, keeping compressed data in memory (decoded while playing)
+RLAPI Sound LoadSoundCompressedFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load sound from compressed file data (decoded while playing)
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
 RLAPI void UnloadWave(Wave wave);                                     // Unload wave data
 RLAPI void UnloadSound(Sound sound);                                  // Unload sound
@@ -1505,13 +2624,24 @@ RLAPI void ResumeSound(Sound sound);                                  // Resume
 RLAPI void PlaySoundMulti(Sound sound);                               // Play a sound (using multichannel buffer pool)
 RLAPI void StopSoundMulti(void);                                      // Stop any sound playing (using multichannel buffer pool)
 RLAPI int GetSoundsPlaying(void);                                     // Get number of sounds playing in the multichannel
+RLAPI int PlaySoundMultiEx(Sound sound, float volume, float pan);     // Play a sound with attenuation volume and pan, returns voice id (using multichannel buffer pool)
+RLAPI void StopSoundMultiVoice(int voice);                            // Stop a multichannel voice
+RLAPI bool IsSoundMultiVoicePlaying(int voice);                       // Check if a multichannel voice is playing (mixed or virtual)
+RLAPI void SetSoundMultiVolume(int voice, float volume);              // Set attenuation volume for a multichannel voice, inaudible voices are not mixed
+RLAPI void SetSoundMultiPan(int voice, float pan);                    // Set pan for a multichannel voice
+RLAPI void SetSoundPriority(Sound sound, int priority);               // Set sound priority for multichannel voices (higher priority is mixed first)
+RLAPI void UpdateSoundMulti(void);                                    // Update multichannel voices, promotes virtual voices when channels get available
+RLAPI int PlaySoundMulti3D(Sound sound, Vector3 position, float minDistance, float maxDistance); // Play a sound at 3D position, returns spatial voice id (using multichannel buffer pool)
+RLAPI void SetAudioListener(Vector3 position, Vector3 forward, Vector3 up, Vector3 velocity); // Set 3D audio listener, applied to spatial voices by UpdateAudioEmitters()
+RLAPI void UpdateAudioEmitters(const AudioEmitter *emitters, int count); // Update spatial voices positions in one batch, attenuation, pan and doppler computed from listener
 RLAPI bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
-RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
+RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range (in place)
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
+RLAPI void WaveFormatMany(Wave *waves, int count, int sampleRate, int sampleSize, int channels); // Convert waves data to desired format (waves converted in parallel on job system)
 RLAPI float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a 32bit float data array
 RLAPI void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
 
@@ -1529,11 +2659,18 @@ RLAPI void SeekMusicStream(Music music, float position);              // Seek mu
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
+RLAPI void SetMusicQuality(Music music, int quality);                 // Set music module (XM/MOD) resampling quality (MusicQuality)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI void EnableMusicStreamThread(float lookahead);                  // Decode music streams on a background thread, UpdateMusicStream() not required
+RLAPI void DisableMusicStreamThread(void);                            // Stop decoding music streams on a background thread
 
 // AudioStream management functions
 RLAPI AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
+RLAPI AudioStream LoadAudioStreamRing(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int frameCount); // Load ring audio stream, written in place (frameCount sets ring size, 0 for default)
+RLAPI void *AcquireAudioStreamWrite(AudioStream stream, unsigned int *frameCount); // Acquire ring audio stream memory to write frames (frameCount: requested in, contiguous frames out)
+RLAPI void CommitAudioStreamWrite(AudioStream stream, unsigned int frameCount); // Commit ring audio stream frames written in acquired memory
+RLAPI unsigned int GetAudioStreamQueuedFrames(AudioStream stream);    // Get ring audio stream committed frames not mixed yet
 RLAPI void UnloadAudioStream(AudioStream stream);                     // Unload audio stream and free memory
 RLAPI void UpdateAudioStream(AudioStream stream, const void *data, int frameCount); // Update audio stream buffers with data
 RLAPI bool IsAudioStreamProcessed(AudioStream stream);                // Check if any audio stream buffers requires refill
@@ -1550,6 +2687,20 @@ RLAPI void SetAudioStreamCallback(AudioStream stream, AudioCallback callback);
 
 RLAPI void AttachAudioStreamProcessor(AudioStream stream, AudioCallback processor);
 RLAPI void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processor);
+RLAPI unsigned int GetAudioStreamMixTime(AudioStream stream);                                   // Get audio stream total mixing time, processors included (in microseconds)
+RLAPI unsigned int GetAudioStreamProcessorTime(AudioStream stream, AudioCallback processor);    // Get audio stream processor total time (in microseconds)
+
+// Audio mixer buses management functions
+RLAPI int LoadAudioBus(const char *name);                           // Load audio mixer bus (or get it if already loaded), mixed into master bus (0)
+RLAPI void UnloadAudioBus(int bus);                                 // Unload audio mixer bus, routed sounds and streams go back to master bus
+RLAPI int GetAudioBus(const char *name);                            // Get audio mixer bus by name, -1 if not loaded
+RLAPI void SetAudioBusVolume(int bus, float volume);                // Set audio mixer bus volume (1.0 is max level)
+RLAPI void AttachAudioBusProcessor(int bus, AudioCallback processor);   // Add processor to audio mixer bus, applied once to the bus mix
+RLAPI void DetachAudioBusProcessor(int bus, AudioCallback processor);   // Remove processor from audio mixer bus
+RLAPI unsigned int GetAudioBusProcessorTime(int bus, AudioCallback processor);  // Get audio mixer bus processor total time (in microseconds)
+RLAPI void SetSoundBus(Sound sound, int bus);                       // Route sound to audio mixer bus
+RLAPI void SetMusicBus(Music music, int bus);                       // Route music to audio mixer bus
+RLAPI void SetAudioStreamBus(AudioStream stream, int bus);          // Route audio stream to audio mixer bus
 
 #if defined(__cplusplus)
 }
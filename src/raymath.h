@@ -13,11 +13,18 @@
 *       Define static inline functions code, so #include header suffices for use.
 *       This may use up lots of memory.
 *
+*   #define RAYMATH_SIMD
+*       Use SSE (x86) or NEON (ARM, AArch64) implementations of matrix, quaternion and vector
+*       transform functions, API and structs layout are not changed.
+*       NOTE: Ignored if no supported SIMD instruction set is available on target
+*
 *   CONVENTIONS:
 *
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
 *     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Array functions (*Array) receive input and output arrays pointers, output array can be
+*       the input array (in-place), partially overlapping arrays are not supported
 *     - Functions use always a "result" variable for return
 *     - Functions are always defined inline
 *     - Angles are always in radians (DEG2RAD/RAD2DEG macros provided for convenience)
@@ -160,6 +167,16 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), fminf(), fmaxf(), fabs()
 
+#if defined(RAYMATH_SIMD)
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+        #define RAYMATH_SIMD_NEON
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #include <xmmintrin.h>      // Required for: SSE intrinsics
+        #define RAYMATH_SIMD_SSE
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -369,6 +386,49 @@ RMAPI Vector2 Vector2Transform(Vector2 v, Matrix mat)
     return result;
 }
 
+// Transforms an array of Vector2 by a given Matrix
+RMAPI void Vector2TransformArray(const Vector2 *points, Vector2 *results, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Points are processed by pairs, x and y broadcast to both lanes of every point
+    __m128 colX = _mm_setr_ps(mat.m0, mat.m1, mat.m0, mat.m1);
+    __m128 colY = _mm_setr_ps(mat.m4, mat.m5, mat.m4, mat.m5);
+    __m128 colT = _mm_setr_ps(mat.m12, mat.m13, mat.m12, mat.m13);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 v = _mm_loadu_ps(&points[i].x);
+        __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+
+        _mm_storeu_ps(&results[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, colX), _mm_mul_ps(y, colY)), colT));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    // Points are processed by 4, deinterleaved to x and y lanes on load
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x2_t v = vld2q_f32(&points[i].x);
+        float32x4x2_t r;
+
+        r.val[0] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m12), v.val[0], mat.m0), v.val[1], mat.m4);
+        r.val[1] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m13), v.val[0], mat.m1), v.val[1], mat.m5);
+
+        vst2q_f32(&results[i].x, r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+
+        results[i].x = mat.m0*x + mat.m4*y + mat.m12;
+        results[i].y = mat.m1*x + mat.m5*y + mat.m13;
+    }
+}
+
 // Calculate linear interpolation between two vectors
 RMAPI Vector2 Vector2Lerp(Vector2 v1, Vector2 v2, float amount)
 {
@@ -682,6 +742,75 @@ RMAPI Vector3 Vector3Normalize(Vector3 v)
     return result;
 }
 
+// Normalize an array of Vector3, zero length vectors are not changed
+RMAPI void Vector3NormalizeArray(const Vector3 *vectors, Vector3 *results, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Vectors are processed by 4: loaded as 3 vectors, deinterleaved to x, y, z lanes and interleaved back
+    __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *src = &vectors[i].x;
+        float *dst = &results[i].x;
+
+        __m128 v0 = _mm_loadu_ps(src);          // x0 y0 z0 x1
+        __m128 v1 = _mm_loadu_ps(src + 4);      // y1 z1 x2 y2
+        __m128 v2 = _mm_loadu_ps(src + 8);      // z2 x3 y3 z3
+
+        __m128 t = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));                  // x2 y2 x3 y3
+        __m128 x = _mm_shuffle_ps(v0, t, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1)), t, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 valid = _mm_cmpneq_ps(length, _mm_setzero_ps());
+        __m128 ilength = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, length)), _mm_andnot_ps(valid, one));
+
+        x = _mm_mul_ps(x, ilength);
+        y = _mm_mul_ps(y, ilength);
+        z = _mm_mul_ps(z, ilength);
+
+        _mm_storeu_ps(dst, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#elif defined(RAYMATH_SIMD_NEON) && defined(__aarch64__)
+    // Vectors are processed by 4, deinterleaved to x, y, z lanes on load
+    // NOTE: Vector square root and division only available on AArch64
+    float32x4_t one = vdupq_n_f32(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&vectors[i].x);
+
+        float32x4_t length = vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(v.val[0], v.val[0]), v.val[1], v.val[1]), v.val[2], v.val[2]));
+        float32x4_t ilength = vbslq_f32(vceqq_f32(length, vdupq_n_f32(0.0f)), one, vdivq_f32(one, length));
+
+        v.val[0] = vmulq_f32(v.val[0], ilength);
+        v.val[1] = vmulq_f32(v.val[1], ilength);
+        v.val[2] = vmulq_f32(v.val[2], ilength);
+
+        vst3q_f32(&results[i].x, v);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Vector3 v = vectors[i];
+
+        float length = sqrtf(v.x*v.x + v.y*v.y + v.z*v.z);
+        if (length == 0.0f) length = 1.0f;
+        float ilength = 1.0f/length;
+
+        results[i].x = v.x*ilength;
+        results[i].y = v.y*ilength;
+        results[i].z = v.z*ilength;
+    }
+}
+
 // Orthonormalize provided vectors
 // Makes vectors normalized and orthogonal to each other
 // Gram-Schmidt function implementation
@@ -722,6 +851,33 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), transposed to combine columns
+    __m128 col0 = _mm_loadu_ps(&mat.m0);
+    __m128 col1 = _mm_loadu_ps(&mat.m1);
+    __m128 col2 = _mm_loadu_ps(&mat.m2);
+    __m128 col3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+    __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(v.x)), _mm_mul_ps(col1, _mm_set1_ps(v.y))), _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(v.z)), col3));
+
+    float values[4];
+    _mm_storeu_ps(values, value);
+    result.x = values[0];
+    result.y = values[1];
+    result.z = values[2];
+#elif defined(RAYMATH_SIMD_NEON)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), deinterleaved on load to get columns
+    float32x4x4_t cols = vld4q_f32(&mat.m0);
+
+    float32x4_t value = vmlaq_n_f32(cols.val[3], cols.val[0], v.x);
+    value = vmlaq_n_f32(value, cols.val[1], v.y);
+    value = vmlaq_n_f32(value, cols.val[2], v.z);
+
+    result.x = vgetq_lane_f32(value, 0);
+    result.y = vgetq_lane_f32(value, 1);
+    result.z = vgetq_lane_f32(value, 2);
+#else
     float x = v.x;
     float y = v.y;
     float z = v.z;
@@ -729,10 +885,67 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
     result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
     result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+#endif
 
     return result;
 }
 
+// Transforms an array of Vector3 by a given Matrix
+RMAPI void Vector3TransformArray(const Vector3 *points, Vector3 *results, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Points are processed by 4: loaded as 3 vectors, deinterleaved to x, y, z lanes and interleaved back
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *src = &points[i].x;
+        float *dst = &results[i].x;
+
+        __m128 v0 = _mm_loadu_ps(src);          // x0 y0 z0 x1
+        __m128 v1 = _mm_loadu_ps(src + 4);      // y1 z1 x2 y2
+        __m128 v2 = _mm_loadu_ps(src + 8);      // z2 x3 y3 z3
+
+        __m128 t = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));                  // x2 y2 x3 y3
+        __m128 x = _mm_shuffle_ps(v0, t, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1)), t, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m0)), _mm_mul_ps(y, _mm_set1_ps(mat.m4))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m8)), _mm_set1_ps(mat.m12)));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m1)), _mm_mul_ps(y, _mm_set1_ps(mat.m5))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m9)), _mm_set1_ps(mat.m13)));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m2)), _mm_mul_ps(y, _mm_set1_ps(mat.m6))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m10)), _mm_set1_ps(mat.m14)));
+
+        _mm_storeu_ps(dst, _mm_shuffle_ps(_mm_shuffle_ps(rx, ry, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    // Points are processed by 4, deinterleaved to x, y, z lanes on load
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&points[i].x);
+        float32x4x3_t r;
+
+        r.val[0] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m12), v.val[0], mat.m0), v.val[1], mat.m4), v.val[2], mat.m8);
+        r.val[1] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m13), v.val[0], mat.m1), v.val[1], mat.m5), v.val[2], mat.m9);
+        r.val[2] = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m14), v.val[0], mat.m2), v.val[1], mat.m6), v.val[2], mat.m10);
+
+        vst3q_f32(&results[i].x, r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        float z = points[i].z;
+
+        results[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        results[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        results[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
 // Transform a vector by quaternion rotation
 RMAPI Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -1043,6 +1256,25 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 row0 = _mm_loadu_ps(&mat.m0);
+    __m128 row1 = _mm_loadu_ps(&mat.m1);
+    __m128 row2 = _mm_loadu_ps(&mat.m2);
+    __m128 row3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+    _mm_storeu_ps(&result.m0, row0);
+    _mm_storeu_ps(&result.m1, row1);
+    _mm_storeu_ps(&result.m2, row2);
+    _mm_storeu_ps(&result.m3, row3);
+#elif defined(RAYMATH_SIMD_NEON)
+    float32x4x4_t rows = vld4q_f32(&mat.m0);
+
+    vst1q_f32(&result.m0, rows.val[0]);
+    vst1q_f32(&result.m1, rows.val[1]);
+    vst1q_f32(&result.m2, rows.val[2]);
+    vst1q_f32(&result.m3, rows.val[3]);
+#else
     result.m0 = mat.m0;
     result.m1 = mat.m4;
     result.m2 = mat.m8;
@@ -1059,6 +1291,7 @@ RMAPI Matrix MatrixTranspose(Matrix mat)
     result.m13 = mat.m7;
     result.m14 = mat.m11;
     result.m15 = mat.m15;
+#endif
 
     return result;
 }
@@ -1090,6 +1323,39 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     // Calculate the invert determinant (inlined to avoid double-caching)
     float invDet = 1.0f/(b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06);
 
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    // Result rows (m0, m4, m8, m12) share the same cofactors pattern: rows 0/1 use a0x/a1x with b06..b11,
+    // rows 2/3 use a2x/a3x with b00..b05, odd lanes and rows 1/3 negated
+    const float cofactors[6][4] = {
+        { b11, b11, b10, b09 }, { b10, b08, b08, b07 }, { b09, b07, b06, b06 },
+        { b05, b05, b04, b03 }, { b04, b02, b02, b01 }, { b03, b01, b00, b00 }
+    };
+    const float elements[4][3][4] = {
+        { { a11, a10, a10, a10 }, { a12, a12, a11, a11 }, { a13, a13, a13, a12 } },
+        { { a01, a00, a00, a00 }, { a02, a02, a01, a01 }, { a03, a03, a03, a02 } },
+        { { a31, a30, a30, a30 }, { a32, a32, a31, a31 }, { a33, a33, a33, a32 } },
+        { { a21, a20, a20, a20 }, { a22, a22, a21, a21 }, { a23, a23, a23, a22 } }
+    };
+    float *rows[4] = { &result.m0, &result.m1, &result.m2, &result.m3 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        const float *c = cofactors[(i < 2)? 0 : 3];
+        float sign = ((i%2) == 0)? invDet : -invDet;
+#if defined(RAYMATH_SIMD_SSE)
+        __m128 value = _mm_mul_ps(_mm_loadu_ps(elements[i][0]), _mm_loadu_ps(c));
+        value = _mm_sub_ps(value, _mm_mul_ps(_mm_loadu_ps(elements[i][1]), _mm_loadu_ps(c + 4)));
+        value = _mm_add_ps(value, _mm_mul_ps(_mm_loadu_ps(elements[i][2]), _mm_loadu_ps(c + 8)));
+        _mm_storeu_ps(rows[i], _mm_mul_ps(value, _mm_setr_ps(sign, -sign, sign, -sign)));
+#else
+        const float signs[4] = { sign, -sign, sign, -sign };
+        float32x4_t value = vmulq_f32(vld1q_f32(elements[i][0]), vld1q_f32(c));
+        value = vmlsq_f32(value, vld1q_f32(elements[i][1]), vld1q_f32(c + 4));
+        value = vmlaq_f32(value, vld1q_f32(elements[i][2]), vld1q_f32(c + 8));
+        vst1q_f32(rows[i], vmulq_f32(value, vld1q_f32(signs)));
+#endif
+    }
+#else
     result.m0 = (a11*b11 - a12*b10 + a13*b09)*invDet;
     result.m1 = (-a01*b11 + a02*b10 - a03*b09)*invDet;
     result.m2 = (a31*b05 - a32*b04 + a33*b03)*invDet;
@@ -1106,6 +1372,7 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1126,6 +1393,17 @@ RMAPI Matrix MatrixAdd(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    _mm_storeu_ps(&result.m0, _mm_add_ps(_mm_loadu_ps(&left.m0), _mm_loadu_ps(&right.m0)));
+    _mm_storeu_ps(&result.m1, _mm_add_ps(_mm_loadu_ps(&left.m1), _mm_loadu_ps(&right.m1)));
+    _mm_storeu_ps(&result.m2, _mm_add_ps(_mm_loadu_ps(&left.m2), _mm_loadu_ps(&right.m2)));
+    _mm_storeu_ps(&result.m3, _mm_add_ps(_mm_loadu_ps(&left.m3), _mm_loadu_ps(&right.m3)));
+#elif defined(RAYMATH_SIMD_NEON)
+    vst1q_f32(&result.m0, vaddq_f32(vld1q_f32(&left.m0), vld1q_f32(&right.m0)));
+    vst1q_f32(&result.m1, vaddq_f32(vld1q_f32(&left.m1), vld1q_f32(&right.m1)));
+    vst1q_f32(&result.m2, vaddq_f32(vld1q_f32(&left.m2), vld1q_f32(&right.m2)));
+    vst1q_f32(&result.m3, vaddq_f32(vld1q_f32(&left.m3), vld1q_f32(&right.m3)));
+#else
     result.m0 = left.m0 + right.m0;
     result.m1 = left.m1 + right.m1;
     result.m2 = left.m2 + right.m2;
@@ -1142,6 +1420,7 @@ RMAPI Matrix MatrixAdd(Matrix left, Matrix right)
     result.m13 = left.m13 + right.m13;
     result.m14 = left.m14 + right.m14;
     result.m15 = left.m15 + right.m15;
+#endif
 
     return result;
 }
@@ -1151,6 +1430,17 @@ RMAPI Matrix MatrixSubtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    _mm_storeu_ps(&result.m0, _mm_sub_ps(_mm_loadu_ps(&left.m0), _mm_loadu_ps(&right.m0)));
+    _mm_storeu_ps(&result.m1, _mm_sub_ps(_mm_loadu_ps(&left.m1), _mm_loadu_ps(&right.m1)));
+    _mm_storeu_ps(&result.m2, _mm_sub_ps(_mm_loadu_ps(&left.m2), _mm_loadu_ps(&right.m2)));
+    _mm_storeu_ps(&result.m3, _mm_sub_ps(_mm_loadu_ps(&left.m3), _mm_loadu_ps(&right.m3)));
+#elif defined(RAYMATH_SIMD_NEON)
+    vst1q_f32(&result.m0, vsubq_f32(vld1q_f32(&left.m0), vld1q_f32(&right.m0)));
+    vst1q_f32(&result.m1, vsubq_f32(vld1q_f32(&left.m1), vld1q_f32(&right.m1)));
+    vst1q_f32(&result.m2, vsubq_f32(vld1q_f32(&left.m2), vld1q_f32(&right.m2)));
+    vst1q_f32(&result.m3, vsubq_f32(vld1q_f32(&left.m3), vld1q_f32(&right.m3)));
+#else
     result.m0 = left.m0 - right.m0;
     result.m1 = left.m1 - right.m1;
     result.m2 = left.m2 - right.m2;
@@ -1167,6 +1457,7 @@ RMAPI Matrix MatrixSubtract(Matrix left, Matrix right)
     result.m13 = left.m13 - right.m13;
     result.m14 = left.m14 - right.m14;
     result.m15 = left.m15 - right.m15;
+#endif
 
     return result;
 }
@@ -1177,6 +1468,33 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), every result row is a combination of left rows
+    __m128 row0 = _mm_loadu_ps(&left.m0);
+    __m128 row1 = _mm_loadu_ps(&left.m1);
+    __m128 row2 = _mm_loadu_ps(&left.m2);
+    __m128 row3 = _mm_loadu_ps(&left.m3);
+
+    _mm_storeu_ps(&result.m0, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m0), row0), _mm_mul_ps(_mm_set1_ps(right.m4), row1)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m8), row2), _mm_mul_ps(_mm_set1_ps(right.m12), row3))));
+    _mm_storeu_ps(&result.m1, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m1), row0), _mm_mul_ps(_mm_set1_ps(right.m5), row1)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m9), row2), _mm_mul_ps(_mm_set1_ps(right.m13), row3))));
+    _mm_storeu_ps(&result.m2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m2), row0), _mm_mul_ps(_mm_set1_ps(right.m6), row1)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m10), row2), _mm_mul_ps(_mm_set1_ps(right.m14), row3))));
+    _mm_storeu_ps(&result.m3, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m3), row0), _mm_mul_ps(_mm_set1_ps(right.m7), row1)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(right.m11), row2), _mm_mul_ps(_mm_set1_ps(right.m15), row3))));
+#elif defined(RAYMATH_SIMD_NEON)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), every result row is a combination of left rows
+    float32x4_t row0 = vld1q_f32(&left.m0);
+    float32x4_t row1 = vld1q_f32(&left.m1);
+    float32x4_t row2 = vld1q_f32(&left.m2);
+    float32x4_t row3 = vld1q_f32(&left.m3);
+
+    vst1q_f32(&result.m0, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(row0, right.m0), row1, right.m4), row2, right.m8), row3, right.m12));
+    vst1q_f32(&result.m1, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(row0, right.m1), row1, right.m5), row2, right.m9), row3, right.m13));
+    vst1q_f32(&result.m2, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(row0, right.m2), row1, right.m6), row2, right.m10), row3, right.m14));
+    vst1q_f32(&result.m3, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(row0, right.m3), row1, right.m7), row2, right.m11), row3, right.m15));
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1193,10 +1511,86 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
 
+// Get matrices array multiplication by a matrix: results[i] = MatrixMultiply(matrices[i], right)
+RMAPI void MatrixMultiplyArray(const Matrix *matrices, Matrix *results, int count, Matrix right)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), every result row is a combination of left rows
+    const float *r = &right.m0;     // Right matrix elements by row: r[row*4 + k] = right.m(row + 4*k)
+
+    __m128 coefs[16];
+    for (int k = 0; k < 16; k++) coefs[k] = _mm_set1_ps(r[k]);
+
+    for (; i < count; i++)
+    {
+        const float *l = &matrices[i].m0;
+        float *m = &results[i].m0;
+
+        __m128 row0 = _mm_loadu_ps(l);
+        __m128 row1 = _mm_loadu_ps(l + 4);
+        __m128 row2 = _mm_loadu_ps(l + 8);
+        __m128 row3 = _mm_loadu_ps(l + 12);
+
+        for (int k = 0; k < 4; k++)
+        {
+            _mm_storeu_ps(m + k*4, _mm_add_ps(_mm_add_ps(_mm_mul_ps(coefs[k*4], row0), _mm_mul_ps(coefs[k*4 + 1], row1)),
+                                              _mm_add_ps(_mm_mul_ps(coefs[k*4 + 2], row2), _mm_mul_ps(coefs[k*4 + 3], row3))));
+        }
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), every result row is a combination of left rows
+    const float *r = &right.m0;     // Right matrix elements by row: r[row*4 + k] = right.m(row + 4*k)
+
+    for (; i < count; i++)
+    {
+        const float *l = &matrices[i].m0;
+        float *m = &results[i].m0;
+
+        float32x4_t row0 = vld1q_f32(l);
+        float32x4_t row1 = vld1q_f32(l + 4);
+        float32x4_t row2 = vld1q_f32(l + 8);
+        float32x4_t row3 = vld1q_f32(l + 12);
+
+        for (int k = 0; k < 4; k++)
+        {
+            vst1q_f32(m + k*4, vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(row0, r[k*4]), row1, r[k*4 + 1]), row2, r[k*4 + 2]), row3, r[k*4 + 3]));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Matrix left = matrices[i];
+        Matrix result = { 0 };
+
+        result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+        result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+        result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+        result.m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+        result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+        result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+        result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+        result.m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+        result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+        result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+        result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+        result.m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+        result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+        result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+        result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+        result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+
+        results[i] = result;
+    }
+}
+
 // Get translation matrix
 RMAPI Matrix MatrixTranslate(float x, float y, float z)
 {
@@ -1649,6 +2043,34 @@ RMAPI Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // Products grouped by lanes: qaw*qb + (qax, qay, qaz, -qaz)*(qbw, qbw, qbw, qbz) + ...
+    __m128 qa = _mm_loadu_ps(&q1.x);
+    __m128 qb = _mm_loadu_ps(&q2.x);
+    __m128 sign = _mm_setr_ps(1.0f, 1.0f, 1.0f, -1.0f);
+
+    __m128 value = _mm_mul_ps(_mm_set1_ps(q1.w), qb);
+    value = _mm_add_ps(value, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(2, 2, 1, 0)), sign), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 3, 3, 3))));
+    value = _mm_add_ps(value, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(0, 0, 2, 1)), sign), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 1, 0, 2))));
+    value = _mm_sub_ps(value, _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(1, 1, 0, 2)), _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 0, 2, 1))));
+
+    _mm_storeu_ps(&result.x, value);
+#elif defined(RAYMATH_SIMD_NEON)
+    // Products grouped by lanes: qaw*qb + (qax, qay, qaz, -qaz)*(qbw, qbw, qbw, qbz) + ...
+    float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
+    float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
+
+    const float a1[4] = { qax, qay, qaz, -qaz }, b1[4] = { qbw, qbw, qbw, qbz };
+    const float a2[4] = { qay, qaz, qax, -qax }, b2[4] = { qbz, qbx, qby, qbx };
+    const float a3[4] = { qaz, qax, qay, qay }, b3[4] = { qby, qbz, qbx, qby };
+
+    float32x4_t value = vmulq_n_f32(vld1q_f32(&q2.x), qaw);
+    value = vmlaq_f32(value, vld1q_f32(a1), vld1q_f32(b1));
+    value = vmlaq_f32(value, vld1q_f32(a2), vld1q_f32(b2));
+    value = vmlsq_f32(value, vld1q_f32(a3), vld1q_f32(b3));
+
+    vst1q_f32(&result.x, value);
+#else
     float qax = q1.x, qay = q1.y, qaz = q1.z, qaw = q1.w;
     float qbx = q2.x, qby = q2.y, qbz = q2.z, qbw = q2.w;
 
@@ -1656,6 +2078,7 @@ RMAPI Quaternion QuaternionMultiply(Quaternion q1, Quaternion q2)
     result.y = qay*qbw + qaw*qby + qaz*qbx - qax*qbz;
     result.z = qaz*qbw + qaw*qbz + qax*qby - qay*qbx;
     result.w = qaw*qbw - qax*qbx - qay*qby - qaz*qbz;
+#endif
 
     return result;
 }
@@ -1686,10 +2109,18 @@ RMAPI Quaternion QuaternionLerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    __m128 qa = _mm_loadu_ps(&q1.x);
+    _mm_storeu_ps(&result.x, _mm_add_ps(qa, _mm_mul_ps(_mm_set1_ps(amount), _mm_sub_ps(_mm_loadu_ps(&q2.x), qa))));
+#elif defined(RAYMATH_SIMD_NEON)
+    float32x4_t qa = vld1q_f32(&q1.x);
+    vst1q_f32(&result.x, vmlaq_n_f32(qa, vsubq_f32(vld1q_f32(&q2.x), qa), amount));
+#else
     result.x = q1.x + amount*(q2.x - q1.x);
     result.y = q1.y + amount*(q2.y - q1.y);
     result.z = q1.z + amount*(q2.z - q1.z);
     result.w = q1.w + amount*(q2.w - q1.w);
+#endif
 
     return result;
 }
@@ -1699,6 +2130,30 @@ RMAPI Quaternion QuaternionNlerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // QuaternionLerp(q1, q2, amount), QuaternionNormalize(q), lanes dot product added by pairs
+    __m128 qa = _mm_loadu_ps(&q1.x);
+    __m128 q = _mm_add_ps(qa, _mm_mul_ps(_mm_set1_ps(amount), _mm_sub_ps(_mm_loadu_ps(&q2.x), qa)));
+    __m128 dot = _mm_mul_ps(q, q);
+    dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+    dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    float length = sqrtf(_mm_cvtss_f32(dot));
+    if (length == 0.0f) length = 1.0f;
+
+    _mm_storeu_ps(&result.x, _mm_mul_ps(q, _mm_set1_ps(1.0f/length)));
+#elif defined(RAYMATH_SIMD_NEON)
+    // QuaternionLerp(q1, q2, amount), QuaternionNormalize(q)
+    float32x4_t qa = vld1q_f32(&q1.x);
+    float32x4_t q = vmlaq_n_f32(qa, vsubq_f32(vld1q_f32(&q2.x), qa), amount);
+    float32x4_t dot = vmulq_f32(q, q);
+    float32x2_t sum = vadd_f32(vget_low_f32(dot), vget_high_f32(dot));
+
+    float length = sqrtf(vget_lane_f32(vpadd_f32(sum, sum), 0));
+    if (length == 0.0f) length = 1.0f;
+
+    vst1q_f32(&result.x, vmulq_n_f32(q, 1.0f/length));
+#else
     // QuaternionLerp(q1, q2, amount)
     result.x = q1.x + amount*(q2.x - q1.x);
     result.y = q1.y + amount*(q2.y - q1.y);
@@ -1715,6 +2170,7 @@ RMAPI Quaternion QuaternionNlerp(Quaternion q1, Quaternion q2, float amount)
     result.y = q.y*ilength;
     result.z = q.z*ilength;
     result.w = q.w*ilength;
+#endif
 
     return result;
 }
@@ -1751,10 +2207,16 @@ RMAPI Quaternion QuaternionSlerp(Quaternion q1, Quaternion q2, float amount)
             float ratioA = sinf((1 - amount)*halfTheta)/sinHalfTheta;
             float ratioB = sinf(amount*halfTheta)/sinHalfTheta;
 
+#if defined(RAYMATH_SIMD_SSE)
+            _mm_storeu_ps(&result.x, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&q1.x), _mm_set1_ps(ratioA)), _mm_mul_ps(_mm_loadu_ps(&q2.x), _mm_set1_ps(ratioB))));
+#elif defined(RAYMATH_SIMD_NEON)
+            vst1q_f32(&result.x, vmlaq_n_f32(vmulq_n_f32(vld1q_f32(&q1.x), ratioA), vld1q_f32(&q2.x), ratioB));
+#else
             result.x = (q1.x*ratioA + q2.x*ratioB);
             result.y = (q1.y*ratioA + q2.y*ratioB);
             result.z = (q1.z*ratioA + q2.z*ratioB);
             result.w = (q1.w*ratioA + q2.w*ratioB);
+#endif
         }
     }
 
@@ -1856,6 +2318,110 @@ RMAPI Matrix QuaternionToMatrix(Quaternion q)
     return result;
 }
 
+// Get rotation matrices for an array of quaternions
+RMAPI void QuaternionToMatrixArray(const Quaternion *quaternions, Matrix *results, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE) || defined(RAYMATH_SIMD_NEON)
+    // Quaternions are processed by 4, transposed to x, y, z, w lanes, matrices rows transposed back
+    for (; i + 4 <= count; i += 4)
+    {
+#if defined(RAYMATH_SIMD_SSE)
+        __m128 x = _mm_loadu_ps(&quaternions[i].x);
+        __m128 y = _mm_loadu_ps(&quaternions[i + 1].x);
+        __m128 z = _mm_loadu_ps(&quaternions[i + 2].x);
+        __m128 w = _mm_loadu_ps(&quaternions[i + 3].x);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        __m128 one = _mm_set1_ps(1.0f);
+        __m128 two = _mm_set1_ps(2.0f);
+        __m128 a2 = _mm_mul_ps(x, x), b2 = _mm_mul_ps(y, y), c2 = _mm_mul_ps(z, z);
+        __m128 ac = _mm_mul_ps(x, z), ab = _mm_mul_ps(x, y), bc = _mm_mul_ps(y, z);
+        __m128 ad = _mm_mul_ps(w, x), bd = _mm_mul_ps(w, y), cd = _mm_mul_ps(w, z);
+
+        // Rows (m0, m4, m8, m12), (m1, m5, m9, m13), (m2, m6, m10, m14) elements for 4 matrices
+        __m128 rows[3][4] = {
+            { _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(b2, c2))), _mm_mul_ps(two, _mm_sub_ps(ab, cd)), _mm_mul_ps(two, _mm_add_ps(ac, bd)), _mm_setzero_ps() },
+            { _mm_mul_ps(two, _mm_add_ps(ab, cd)), _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(a2, c2))), _mm_mul_ps(two, _mm_sub_ps(bc, ad)), _mm_setzero_ps() },
+            { _mm_mul_ps(two, _mm_sub_ps(ac, bd)), _mm_mul_ps(two, _mm_add_ps(bc, ad)), _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(a2, b2))), _mm_setzero_ps() }
+        };
+
+        for (int r = 0; r < 3; r++)
+        {
+            _MM_TRANSPOSE4_PS(rows[r][0], rows[r][1], rows[r][2], rows[r][3]);
+            for (int k = 0; k < 4; k++) _mm_storeu_ps(&results[i + k].m0 + r*4, rows[r][k]);
+        }
+
+        for (int k = 0; k < 4; k++) _mm_storeu_ps(&results[i + k].m3, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+#else
+        float32x4x4_t q = vld4q_f32(&quaternions[i].x);
+        float32x4_t x = q.val[0], y = q.val[1], z = q.val[2], w = q.val[3];
+
+        float32x4_t one = vdupq_n_f32(1.0f);
+        float32x4_t zero = vdupq_n_f32(0.0f);
+        float32x4_t a2 = vmulq_f32(x, x), b2 = vmulq_f32(y, y), c2 = vmulq_f32(z, z);
+        float32x4_t ac = vmulq_f32(x, z), ab = vmulq_f32(x, y), bc = vmulq_f32(y, z);
+        float32x4_t ad = vmulq_f32(w, x), bd = vmulq_f32(w, y), cd = vmulq_f32(w, z);
+
+        // Rows (m0, m4, m8, m12), (m1, m5, m9, m13), (m2, m6, m10, m14) elements for 4 matrices
+        float32x4_t rows[3][4] = {
+            { vmlsq_n_f32(one, vaddq_f32(b2, c2), 2.0f), vmulq_n_f32(vsubq_f32(ab, cd), 2.0f), vmulq_n_f32(vaddq_f32(ac, bd), 2.0f), zero },
+            { vmulq_n_f32(vaddq_f32(ab, cd), 2.0f), vmlsq_n_f32(one, vaddq_f32(a2, c2), 2.0f), vmulq_n_f32(vsubq_f32(bc, ad), 2.0f), zero },
+            { vmulq_n_f32(vsubq_f32(ac, bd), 2.0f), vmulq_n_f32(vaddq_f32(bc, ad), 2.0f), vmlsq_n_f32(one, vaddq_f32(a2, b2), 2.0f), zero }
+        };
+
+        for (int r = 0; r < 3; r++)
+        {
+            float32x4x2_t t01 = vtrnq_f32(rows[r][0], rows[r][1]);
+            float32x4x2_t t23 = vtrnq_f32(rows[r][2], rows[r][3]);
+
+            vst1q_f32(&results[i].m0 + r*4, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+            vst1q_f32(&results[i + 1].m0 + r*4, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+            vst1q_f32(&results[i + 2].m0 + r*4, vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+            vst1q_f32(&results[i + 3].m0 + r*4, vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+        }
+
+        const float last[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        for (int k = 0; k < 4; k++) vst1q_f32(&results[i + k].m3, vld1q_f32(last));
+#endif
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Quaternion q = quaternions[i];
+        Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
+                          0.0f, 1.0f, 0.0f, 0.0f,
+                          0.0f, 0.0f, 1.0f, 0.0f,
+                          0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
+
+        float a2 = q.x*q.x;
+        float b2 = q.y*q.y;
+        float c2 = q.z*q.z;
+        float ac = q.x*q.z;
+        float ab = q.x*q.y;
+        float bc = q.y*q.z;
+        float ad = q.w*q.x;
+        float bd = q.w*q.y;
+        float cd = q.w*q.z;
+
+        result.m0 = 1 - 2*(b2 + c2);
+        result.m1 = 2*(ab + cd);
+        result.m2 = 2*(ac - bd);
+
+        result.m4 = 2*(ab - cd);
+        result.m5 = 1 - 2*(a2 + c2);
+        result.m6 = 2*(bc + ad);
+
+        result.m8 = 2*(ac + bd);
+        result.m9 = 2*(bc - ad);
+        result.m10 = 1 - 2*(a2 + b2);
+
+        results[i] = result;
+    }
+}
+
 // Get rotation quaternion for an angle and axis
 // NOTE: angle must be provided in radians
 RMAPI Quaternion QuaternionFromAxisAngle(Vector3 axis, float angle)
@@ -1990,10 +2556,30 @@ RMAPI Quaternion QuaternionTransform(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
+#if defined(RAYMATH_SIMD_SSE)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), transposed to combine columns
+    __m128 col0 = _mm_loadu_ps(&mat.m0);
+    __m128 col1 = _mm_loadu_ps(&mat.m1);
+    __m128 col2 = _mm_loadu_ps(&mat.m2);
+    __m128 col3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+    _mm_storeu_ps(&result.x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, _mm_set1_ps(q.x)), _mm_mul_ps(col1, _mm_set1_ps(q.y))),
+                                        _mm_add_ps(_mm_mul_ps(col2, _mm_set1_ps(q.z)), _mm_mul_ps(col3, _mm_set1_ps(q.w)))));
+#elif defined(RAYMATH_SIMD_NEON)
+    // Matrix rows are stored contiguously (m0, m4, m8, m12), deinterleaved on load to get columns
+    float32x4x4_t cols = vld4q_f32(&mat.m0);
+
+    float32x4_t value = vmulq_n_f32(cols.val[0], q.x);
+    value = vmlaq_n_f32(value, cols.val[1], q.y);
+    value = vmlaq_n_f32(value, cols.val[2], q.z);
+    vst1q_f32(&result.x, vmlaq_n_f32(value, cols.val[3], q.w));
+#else
     result.x = mat.m0*q.x + mat.m4*q.y + mat.m8*q.z + mat.m12*q.w;
     result.y = mat.m1*q.x + mat.m5*q.y + mat.m9*q.z + mat.m13*q.w;
     result.z = mat.m2*q.x + mat.m6*q.y + mat.m10*q.z + mat.m14*q.w;
     result.w = mat.m3*q.x + mat.m7*q.y + mat.m11*q.z + mat.m15*q.w;
+#endif
 
     return result;
 }
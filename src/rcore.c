@@ -14,6 +14,7 @@
 *       - PLATFORM_DRM:     Linux native mode, including Raspberry Pi 4 with V3D fkms driver
 *       - PLATFORM_WEB:     HTML5 with WebAssembly
 *       - PLATFORM_NX:      Nintendo Switch support
+*       - PLATFORM_3DS:     Nintendo 3DS support (libctru, citro3d)
 *
 *   CONFIGURATION:
 *
@@ -37,6 +38,11 @@
 *       Windowing and input system configured for HTML5 (run on browser), code converted from C to asm.js
 *       using emscripten compiler. OpenGL ES 2.0 required for direct translation to WebGL equivalent code.
 *
+*   #define PLATFORM_3DS
+*       Windowing and input system configured for Nintendo 3DS (libctru), graphic device is managed by citro3d,
+*       rlgl uses its OpenGL ES 2.0 subset translation layer (rlgl_c3d.h). Top screen is used for drawing (400x240),
+*       bottom screen touch is mapped to mouse/touch input.
+*
 *   #define SUPPORT_DEFAULT_FONT (default)
 *       Default font is loaded on window initialization to be available for the user to render simple text.
 *       NOTE: If enabled, uses external module functions to load default raylib font (module: text)
@@ -76,16 +82,34 @@
 *   #define SUPPORT_GIF_RECORDING
 *       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 *
+*   #define SUPPORT_NX_SYSTEM_CAPTURE
+*       On PLATFORM_NX, screenshots are saved to the console album and video is recorded by the system
+*       (hardware encoded, Capture button), CTRL+F12 toggles system recording instead of GIF recording
+*
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
 *       provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
 *       for linkage
+*       Also LZ4 block codec (CompressDataEx()) and block-framed compression streams, bounded memory
 *
 *   #define SUPPORT_DATA_STORAGE
-*       Support saving binary data automatically to a generated storage.data file. This file is managed internally
+*       Support saving binary data automatically to a generated storage.data file. This file is managed internally,
+*       it is cached on first access and changes are committed on FlushStorage() or once idle (write-behind),
+*       alternating two files (double buffering), so an interrupted commit keeps the previous one valid
 *
 *   #define SUPPORT_EVENTS_AUTOMATION
-*       Support automatic generated events, loading and recording of those events when required
+*       Support input events recording and deterministic replay with fixed frame time,
+*       replay runs at uncapped frame rate and exports frames timings and render stats (.csv/.json)
+*
+*   #define SUPPORT_JOB_SYSTEM
+*       Job system with one worker thread per available core (libnx threads on PLATFORM_NX, POSIX threads otherwise),
+*       work-stealing jobs deques, parallel-for, jobs dependency counters and main thread only jobs (GL work)
+*
+*   #define SUPPORT_RENDER_THREAD
+*       Pipelined rendering (EnableRenderThread()): frame drawing is recorded into double-buffered command lists
+*       and a render thread owning the GL context submits, draws and presents previous frame while main thread
+*       builds next one, GL context is current on main thread on frame end only (main thread jobs, async uploads)
+*       NOTE: Requires SUPPORT_PARTIAL_REDRAW recorded core calls, drawing must be done by raylib/rlgl calls
 *
 *   DEPENDENCIES:
 *       rglfw    - Manage graphic device, OpenGL context and inputs on PLATFORM_DESKTOP (Windows, Linux, OSX. FreeBSD, OpenBSD, NetBSD, DragonFly)
@@ -122,6 +146,7 @@
     #include "config.h"             // Defines module configuration flags
 #endif
 
+#define RL_MEMORY_TAG   MEMORY_TAG_CORE     // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"                  // Required for: TRACELOG() macros
 
 #define RLGL_IMPLEMENTATION
@@ -180,7 +205,7 @@
     #endif // OSs
 #endif // PLATFORM_DESKTOP
 
-#include <stdlib.h>                 // Required for: srand(), rand(), atexit()
+#include <stdlib.h>                 // Required for: atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
@@ -287,9 +312,68 @@
 #endif
 
 #if defined(PLATFORM_NX)
-    #define GLFW_INCLUDE_NONE
-    #include <GLFW/glfw3.h>
+    #if defined(SUPPORT_NX_NATIVE_PLATFORM)
+        #if !defined(SUPPORT_NX_HID_INPUT)
+            #define SUPPORT_NX_HID_INPUT        // Native platform layer has no GLFW input, native input is required
+        #endif
+        #include <EGL/egl.h>                // EGL: context and surface on default nwindow
+    #else
+        #define NX_USE_GLFW                 // GLFW port: window, context and input
+        #define GLFW_INCLUDE_NONE
+        #include <GLFW/glfw3.h>
+    #endif
     #include <switch.h>
+    #if defined(SUPPORT_NX_HID_INPUT)
+        #include <stdatomic.h>          // Required for: atomic_uint, atomic_int, atomic_bool [Used by native input thread]
+    #endif
+#endif
+
+#if defined(PLATFORM_3DS)
+    // NOTE: libctru HID keys names collide with raylib KeyboardKey names, they are renamed while included
+    #define KEY_A       CTRU_KEY_A
+    #define KEY_B       CTRU_KEY_B
+    #define KEY_L       CTRU_KEY_L
+    #define KEY_R       CTRU_KEY_R
+    #define KEY_X       CTRU_KEY_X
+    #define KEY_Y       CTRU_KEY_Y
+    #define KEY_UP      CTRU_KEY_UP
+    #define KEY_DOWN    CTRU_KEY_DOWN
+    #define KEY_LEFT    CTRU_KEY_LEFT
+    #define KEY_RIGHT   CTRU_KEY_RIGHT
+    #include <3ds.h>                    // libctru: services, HID input, system ticks
+    #include <citro3d.h>                // citro3d: PICA200 GPU render targets
+    #undef KEY_A
+    #undef KEY_B
+    #undef KEY_L
+    #undef KEY_R
+    #undef KEY_X
+    #undef KEY_Y
+    #undef KEY_UP
+    #undef KEY_DOWN
+    #undef KEY_LEFT
+    #undef KEY_RIGHT
+#endif
+
+// NOTE: 3DS applications run on a single core (system core is shared), jobs run on submit
+#if defined(SUPPORT_JOB_SYSTEM) && !defined(_MSC_VER) && !defined(PLATFORM_WEB) && !defined(PLATFORM_3DS)
+    #if !defined(PLATFORM_NX)
+        #include <pthread.h>            // Required for: pthread_create(), pthread_cond_wait() [Used by job system workers]
+        #include <sched.h>              // Required for: sched_yield() [Used in WaitJobCounter()]
+    #endif
+    #define JOBS_THREADED               // Jobs run on worker threads, otherwise jobs run on submit
+#endif
+
+// Render thread uses job system threads primitives, GL context is moved between threads (GLFW or EGL)
+#if defined(SUPPORT_RENDER_THREAD) && defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES) && \
+    defined(JOBS_THREADED) && (defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX))
+    #define RENDER_THREAD_SUPPORTED
+#endif
+
+// System capture replaces screenshots export and GIF recording, album screenshots are resized (rtextures)
+#if defined(SUPPORT_NX_SYSTEM_CAPTURE) && defined(SUPPORT_SCREEN_CAPTURE) && defined(SUPPORT_MODULE_RTEXTURES) && defined(PLATFORM_NX)
+    #define NX_SYSTEM_CAPTURE_SUPPORTED
+    #define NX_ALBUM_SCREENSHOT_WIDTH   1280    // Album screenshots width, required by system capture service
+    #define NX_ALBUM_SCREENSHOT_HEIGHT   720    // Album screenshots height, required by system capture service
 #endif
 
 //----------------------------------------------------------------------------------
@@ -334,17 +418,204 @@
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef MAX_INPUT_EVENTS
+    #define MAX_INPUT_EVENTS             512        // Maximum number of input events queued between frames (power of two)
+#endif
 
 #if defined(SUPPORT_DATA_STORAGE)
     #ifndef STORAGE_DATA_FILE
         #define STORAGE_DATA_FILE  "storage.data"   // Automatic storage filename
     #endif
+    #ifndef STORAGE_COMMIT_DELAY
+        #define STORAGE_COMMIT_DELAY        1.0     // Storage changes committed once idle for this time (seconds)
+    #endif
+
+    #define STORAGE_VERSION                   1     // Storage file format version
 #endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
 
+#define COMPRESSION_QUALITY_DEFLATE        8        // DEFLATE compression level, same as stb_image_write
+#define COMPRESSION_LZ4_HASH_BITS         12        // LZ4 compressor hash table size (bits), table is stack allocated
+#define COMPRESSION_LZ4_BOUND(size) ((size) + (size)/255 + 16)    // LZ4 compressed data maximum size
+#ifndef COMPRESSION_STREAM_BLOCK_SIZE
+    #define COMPRESSION_STREAM_BLOCK_SIZE  65536    // Compression streams block size, memory used is bounded by it (in bytes)
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE) && !defined(SUPPORT_ASYNC_LOADING)
+    #undef SUPPORT_ASYNC_SCREEN_CAPTURE     // Screen captures are encoded by async load worker threads
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    #ifndef MAX_SCREEN_CAPTURE_JOBS
+        #define MAX_SCREEN_CAPTURE_JOBS        4    // Maximum screen capture encoding jobs in flight
+    #endif
+#endif
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    #ifndef DYNAMIC_RESOLUTION_MIN_SCALE
+        #define DYNAMIC_RESOLUTION_MIN_SCALE    0.5f    // Default minimum dynamic resolution scale (relative to framebuffer size)
+    #endif
+    #ifndef DYNAMIC_RESOLUTION_MAX_SCALE
+        #define DYNAMIC_RESOLUTION_MAX_SCALE    1.0f    // Default maximum dynamic resolution scale (relative to framebuffer size)
+    #endif
+    #ifndef DYNAMIC_RESOLUTION_GPU_BUDGET
+        #define DYNAMIC_RESOLUTION_GPU_BUDGET   0.85f   // Fraction of target frame time available for GPU work
+    #endif
+    #ifndef DYNAMIC_RESOLUTION_MAX_STEP
+        #define DYNAMIC_RESOLUTION_MAX_STEP     0.05f   // Maximum scale change per frame
+    #endif
+#endif
+
+#if defined(SUPPORT_PARTIAL_REDRAW)
+    #ifndef PARTIAL_REDRAW_TILE_SIZE
+        #define PARTIAL_REDRAW_TILE_SIZE          32    // Partial redraw damage tracking tile size (in pixels)
+    #endif
+#endif
+
+#ifndef MAX_SHADER_VARIANT_FEATURES
+    #define MAX_SHADER_VARIANT_FEATURES        8    // Maximum features by shader variants template (2^features variants table)
+#endif
+
+#ifndef FRAME_PACING_LATENCY_MARGIN
+    #define FRAME_PACING_LATENCY_MARGIN     0.002   // Low latency frame pacing margin kept before present deadline (seconds)
+#endif
+
+#ifndef FIXED_UPDATE_MAX_STEPS
+    #define FIXED_UPDATE_MAX_STEPS             8    // Maximum fixed update steps per frame, remaining time is dropped
+#endif
+
+#if defined(SUPPORT_FRAME_HISTORY)
+    #ifndef FRAME_HISTORY_SIZE
+        #define FRAME_HISTORY_SIZE               256    // Frames kept on frames history (timings and histogram)
+    #endif
+    #ifndef FRAME_HITCH_TRACE_EVENTS
+        #define FRAME_HITCH_TRACE_EVENTS       65536    // Profiling zones rolling capture events buffer, while hitch threshold is set
+    #endif
+#endif
+
+#if !defined(PLATFORM_NX)
+    #undef SUPPORT_NX_NATIVE_PLATFORM       // Native platform layer uses libnx nwindow and applet services
+    #undef SUPPORT_NX_HID_INPUT             // Native input backend uses libnx
+    #undef SUPPORT_NX_CLOCK_PROFILES        // Clocks control uses libnx applet and apm services
+#endif
+
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    #define NX_FRAMEBUFFER_WIDTH          1920   // Native window framebuffer width (docked size, cropped in handheld mode)
+    #define NX_FRAMEBUFFER_HEIGHT         1080   // Native window framebuffer height (docked size, cropped in handheld mode)
+#endif
+
+#if defined(PLATFORM_NX)
+    #ifndef NX_BACKGROUND_FPS
+        #define NX_BACKGROUND_FPS               10   // Frame rate while application is out of focus, frames are not presented
+    #endif
+#endif
+
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    #ifndef NX_CLOCK_POWER_SAVING_HANDHELD
+        #define NX_CLOCK_POWER_SAVING_HANDHELD  0x00020005  // Power saving performance configuration, handheld (CPU 1020, GPU 307.2, EMC 1065.6 MHz)
+    #endif
+    #ifndef NX_CLOCK_POWER_SAVING_DOCKED
+        #define NX_CLOCK_POWER_SAVING_DOCKED    0x00010000  // Power saving performance configuration, docked (CPU 1020, GPU 384, EMC 1600 MHz)
+    #endif
+#endif
+
+#if defined(PLATFORM_3DS)
+    #define N3DS_TOP_SCREEN_WIDTH          400   // Top screen width (landscape orientation)
+    #define N3DS_TOP_SCREEN_HEIGHT         240   // Top screen height (landscape orientation)
+    #define N3DS_BOTTOM_SCREEN_WIDTH       320   // Bottom screen (touch) width
+    #define N3DS_BOTTOM_SCREEN_HEIGHT      240   // Bottom screen (touch) height
+    #define N3DS_STICK_RANGE             156.0f  // Circle pad and C-stick maximum displacement
+    #ifndef N3DS_STEREO_SEPARATION
+        #define N3DS_STEREO_SEPARATION   0.33f   // Stereoscopic 3D eyes separation with 3D slider at top (view space units)
+    #endif
+    #ifndef N3DS_STEREO_CONVERGENCE
+        #define N3DS_STEREO_CONVERGENCE  2.0f    // Stereoscopic 3D zero parallax distance (view space units)
+    #endif
+
+    // Render target to framebuffer transfer: RGBA8 render target to RGB8 framebuffer, no scaling
+    #define N3DS_DISPLAY_TRANSFER_FLAGS (GX_TRANSFER_FLIP_VERT(0) | GX_TRANSFER_OUT_TILED(0) | GX_TRANSFER_RAW_COPY(0) | \
+        GX_TRANSFER_IN_FORMAT(GX_TRANSFER_FMT_RGBA8) | GX_TRANSFER_OUT_FORMAT(GX_TRANSFER_FMT_RGB8) | GX_TRANSFER_SCALING(GX_TRANSFER_SCALE_NO))
+#endif
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    #ifndef NX_HID_SAMPLE_RATE
+        #define NX_HID_SAMPLE_RATE           1000   // Native input sampling rate (Hz)
+    #endif
+    #ifndef MAX_NX_INPUT_EVENTS
+        #define MAX_NX_INPUT_EVENTS           256   // Maximum gamepad button events queued between frames (power of two)
+    #endif
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    #ifndef JOB_WORKER_THREADS
+        #define JOB_WORKER_THREADS             0    // Job system worker threads, 0: one per available core (main thread core excluded)
+    #endif
+    #ifndef MAX_JOB_WORKERS
+        #define MAX_JOB_WORKERS               16    // Maximum job system worker threads
+    #endif
+    #ifndef MAX_JOBS_QUEUED
+        #define MAX_JOBS_QUEUED              256    // Maximum jobs queued per worker deque (power of two), jobs run on submit if full
+    #endif
+    #ifndef MAX_JOBS_DEFERRED
+        #define MAX_JOBS_DEFERRED            256    // Maximum jobs waiting for a dependency counter
+    #endif
+    #ifndef OBJECT_POOL_CACHE_SIZE
+        #define OBJECT_POOL_CACHE_SIZE        32    // Object pools thread cache size (objects), half is moved from/to shared free list at once
+    #endif
+
+    #define OBJECT_POOL_ALIGNMENT             16    // Object pools objects alignment (in bytes)
+#endif
+
+#if defined(JOBS_THREADED)
+    #if defined(PLATFORM_NX)
+        #define JOB_MUTEX_INIT(m)           mutexInit(m)
+        #define JOB_MUTEX_DESTROY(m)        (void)0
+        #define JOB_MUTEX_LOCK(m)           mutexLock(m)
+        #define JOB_MUTEX_UNLOCK(m)         mutexUnlock(m)
+        #define JOB_CONDITION_INIT(c)       condvarInit(c)
+        #define JOB_CONDITION_DESTROY(c)    (void)0
+        #define JOB_CONDITION_WAIT(c, m)    condvarWait(c, m)
+        #define JOB_CONDITION_SIGNAL(c)     condvarWakeOne(c)
+        #define JOB_CONDITION_BROADCAST(c)  condvarWakeAll(c)
+        #define JOB_YIELD()                 svcSleepThread(0)
+    #else
+        #define JOB_MUTEX_INIT(m)           pthread_mutex_init(m, NULL)
+        #define JOB_MUTEX_DESTROY(m)        pthread_mutex_destroy(m)
+        #define JOB_MUTEX_LOCK(m)           pthread_mutex_lock(m)
+        #define JOB_MUTEX_UNLOCK(m)         pthread_mutex_unlock(m)
+        #define JOB_CONDITION_INIT(c)       pthread_cond_init(c, NULL)
+        #define JOB_CONDITION_DESTROY(c)    pthread_cond_destroy(c)
+        #define JOB_CONDITION_WAIT(c, m)    pthread_cond_wait(c, m)
+        #define JOB_CONDITION_SIGNAL(c)     pthread_cond_signal(c)
+        #define JOB_CONDITION_BROADCAST(c)  pthread_cond_broadcast(c)
+        #define JOB_YIELD()                 sched_yield()
+    #endif
+
+    // Job system shared counters access, sequentially consistent (sleep and dependency checks rely on it)
+    #define JOB_ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_SEQ_CST)
+    #define JOB_ATOMIC_STORE(ptr, value)    __atomic_store_n((ptr), (value), __ATOMIC_SEQ_CST)
+    #define JOB_ATOMIC_ADD(ptr, value)      __atomic_add_fetch((ptr), (value), __ATOMIC_SEQ_CST)
+    #define JOB_ATOMIC_CAS(ptr, expected, desired)  __atomic_compare_exchange_n((ptr), (expected), (desired), true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#else
+    #define JOB_ATOMIC_LOAD(ptr)            (*(ptr))
+    #define JOB_ATOMIC_STORE(ptr, value)    (*(ptr) = (value))
+    #define JOB_ATOMIC_ADD(ptr, value)      (*(ptr) += (value))
+    #define JOB_ATOMIC_CAS(ptr, expected, desired)  ((*(ptr) = (desired)), true)
+#endif
+
+// Input events queue positions access, queue can be written from a thread other than the main one
+// NOTE: MSVC volatile accesses have acquire/release semantics (/volatile:ms, default on x86/x64)
+#if defined(_MSC_VER)
+    #define INPUT_QUEUE_LOAD(ptr)          (*(volatile unsigned int *)(ptr))
+    #define INPUT_QUEUE_STORE(ptr, value)  (*(volatile unsigned int *)(ptr) = (value))
+#else
+    #define INPUT_QUEUE_LOAD(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define INPUT_QUEUE_STORE(ptr, value)  __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -369,13 +640,241 @@ typedef struct {
 } InputEventWorker;
 #endif
 
+#if defined(SUPPORT_NX_HID_INPUT)
+// Native input gamepad button event, queued by input thread
+typedef struct {
+    double time;                    // Event time (GetTime() base)
+    unsigned char gamepad;          // Gamepad index
+    unsigned char button;           // Gamepad button (GamepadButton)
+    unsigned char pressed;          // Button state after event
+} NxInputEvent;
+
+// Native input sampled state, latest sample published by input thread
+typedef struct {
+    bool connected[MAX_GAMEPADS];               // Gamepads connected
+    float axis[MAX_GAMEPADS][6];                // Gamepads axis (GamepadAxis)
+    Vector3 accelerometer[MAX_GAMEPADS];        // Gamepads acceleration (G)
+    Vector3 gyroscope[MAX_GAMEPADS];            // Gamepads angular velocity (radians/second)
+    int touchCount;                             // Touch points count
+    int touchId[MAX_TOUCH_POINTS];              // Touch points identifiers
+    Vector2 touch[MAX_TOUCH_POINTS];            // Touch points position (touch screen 1280x720)
+} NxInputState;
+#endif
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Job, queued by value on jobs deques
+typedef struct {
+    JobCallback callback;           // Job function, NULL for range jobs
+    JobRangeCallback rangeCallback; // Range job function (ParallelFor())
+    void *data;                     // Job user data
+    int start;                      // Range job first index
+    int end;                        // Range job last index (not included)
+    JobCounter *dependency;         // Counter the job waits for before being queued, optional
+    JobCounter *counter;            // Counter decremented when the job is finished, optional
+    bool mainThread;                // Job runs on main thread only
+} Job;
+
+#if defined(JOBS_THREADED)
+#if defined(PLATFORM_NX)
+typedef Mutex JobMutex;             // Job system mutex (libnx)
+typedef CondVar JobCondition;       // Job system condition variable (libnx)
+typedef Thread JobThread;           // Job system worker thread (libnx)
+#else
+typedef pthread_mutex_t JobMutex;   // Job system mutex (POSIX)
+typedef pthread_cond_t JobCondition;    // Job system condition variable (POSIX)
+typedef pthread_t JobThread;        // Job system worker thread (POSIX)
+#endif
+
+// Jobs deque, owner thread pushes and pops at bottom (LIFO, cache friendly), other threads steal at top (FIFO)
+// NOTE: Deque is protected by its own mutex, thieves only contend with the owner when running out of jobs
+typedef struct {
+    Job jobs[MAX_JOBS_QUEUED];      // Jobs ring buffer
+    unsigned int top;               // Steal position (oldest job)
+    unsigned int bottom;            // Push/pop position (newest job)
+    JobMutex lock;                  // Deque access mutex
+} JobQueue;
+#endif
+
+// Object pool stats counters, updated by one thread (thread cache) or atomically (shared)
+typedef struct {
+    unsigned int allocations;       // Allocations done
+    unsigned int frees;             // Frees done
+    unsigned int cacheHits;         // Allocations and frees served by thread cache
+    unsigned int contention;        // Shared free list updates retried
+    unsigned int failures;          // Allocations failed (pool exhausted)
+} ObjectPoolCounters;
+
+// Object pool thread cache, free objects owned by one job system thread
+typedef struct {
+    unsigned int objects[OBJECT_POOL_CACHE_SIZE];   // Free objects (index + 1)
+    int count;                      // Free objects cached
+    ObjectPoolCounters counters;    // Thread stats counters
+} ObjectPoolCache;
+
+// Object pool, shared free list is a lock-free stack (Treiber stack) of objects indices
+// NOTE: Free list head is tagged (changes counter), a head popped and pushed back meanwhile (ABA) fails the update
+struct ObjectPool {
+    unsigned char *objects;         // Objects memory
+    unsigned int *next;             // Free list links, next free object (index + 1), 0 at list end (atomic)
+    unsigned long long head;        // Free list head: tag (high 32 bits), first free object (index + 1) or 0 if empty (low 32 bits) (atomic)
+    int objectSize;                 // Object size, aligned to OBJECT_POOL_ALIGNMENT
+    int capacity;                   // Objects capacity
+    ObjectPoolCache caches[MAX_JOB_WORKERS + 1];    // Thread caches, by jobs deque index (main thread first)
+    ObjectPoolCounters shared;      // Stats counters for threads not cached (atomic)
+};
+#endif
+
+#if defined(SUPPORT_DATA_STORAGE)
+// Storage entry type
+typedef enum {
+    STORAGE_ENTRY_INT = 0,          // Integer value
+    STORAGE_ENTRY_FLOAT,            // Float value
+    STORAGE_ENTRY_DATA              // Bytes blob
+} StorageEntryType;
+
+// Storage file header, entries follow header
+// NOTE: Two files are alternated on commits, the valid one with latest sequence is loaded
+typedef struct {
+    char id[4];                     // Storage file identifier: "rSTG"
+    unsigned int version;           // Storage file format version
+    unsigned int sequence;          // Commit sequence number
+    unsigned int valueCount;        // Positional integer values count (SaveStorageValue())
+    unsigned int entryCount;        // Keyed entries count
+    unsigned int dataSize;          // Values and entries data size after header (in bytes)
+    unsigned int checksum;          // Values and entries data checksum (FNV-1a), detects interrupted commits
+    unsigned int reserved;          // Reserved for future use
+} StorageHeader;
+
+// Storage keyed entry (cached)
+// NOTE: Stored as type, key length and data size (unsigned int each), key (not terminated) and data, 4 bytes aligned
+typedef struct {
+    unsigned int hash;              // Key hash (FNV-1a)
+    int type;                       // Entry type (StorageEntryType)
+    char *key;                      // Entry key
+    unsigned char *data;            // Entry data
+    unsigned int size;              // Entry data size (in bytes)
+} StorageEntry;
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compression stream block header, precedes every block data
+// NOTE: Blocks are compressed independently, an empty block (size 0) marks the stream end
+typedef struct {
+    unsigned int size;              // Block data size (uncompressed)
+    unsigned int storedSize;        // Block data size stored (24 bits) and block method (8 bits, CompressionBlockMethod)
+} CompressionBlockHeader;
+
+// Compression stream block method
+typedef enum {
+    COMPRESSION_BLOCK_STORED = 0,   // Block data stored as is (compression did not save size)
+    COMPRESSION_BLOCK_DEFLATE,      // Block data compressed with DEFLATE
+    COMPRESSION_BLOCK_LZ4           // Block data compressed with LZ4
+} CompressionBlockMethod;
+
+// Compression stream, input data accumulated into one block, output data produced by block
+struct CompressionStream {
+    int codec;                      // Compression codec (CompressionCodec), -1 for decompression streams
+    bool finished;                  // Input finished (compression) or end block read (decompression)
+    bool ended;                     // End block output (compression)
+    bool failed;                    // Stream data not valid (decompression)
+    unsigned char *input;           // Input block data
+    int inputSize;                  // Input block data size
+    unsigned char *output;          // Output block data
+    int outputSize;                 // Output block data size
+    int outputOffset;               // Output block data already drained
+    struct sdefl *deflate;          // DEFLATE compressor state (DEFLATE compression streams)
+};
+#endif
+
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+// Partial redraw recorded core calls types, GL state changes are replayed when frame is redrawn
+typedef enum {
+    REDRAW_CLEAR_BACKGROUND = 0,    // ClearBackground()
+    REDRAW_BEGIN_MODE_3D,           // BeginMode3D(), full redraw required
+    REDRAW_END_MODE_3D,             // EndMode3D()
+    REDRAW_BEGIN_TEXTURE_MODE,      // BeginTextureMode(), full redraw required
+    REDRAW_END_TEXTURE_MODE,        // EndTextureMode()
+    REDRAW_BEGIN_SHADER_MODE,       // BeginShaderMode()
+    REDRAW_END_SHADER_MODE,         // EndShaderMode()
+    REDRAW_BEGIN_BLEND_MODE,        // BeginBlendMode()
+    REDRAW_END_BLEND_MODE,          // EndBlendMode()
+    REDRAW_BEGIN_SCISSOR_MODE,      // BeginScissorMode()
+    REDRAW_END_SCISSOR_MODE,        // EndScissorMode()
+    REDRAW_SETUP_VIEWPORT           // SetupViewport(), window resized while recording (render thread)
+} RedrawCallType;
+
+// Partial redraw recorded core call, recorded as command list callback data
+// NOTE: Call data is zero initialized, recorded data is hashed to detect changes
+typedef struct RedrawCall {
+    int type;                       // Call type (RedrawCallType)
+    union {
+        Color color;                // ClearBackground() color
+        Camera3D camera;            // BeginMode3D() camera
+        RenderTexture2D target;     // BeginTextureMode() target
+        Shader shader;              // BeginShaderMode() shader
+        int mode;                   // BeginBlendMode() mode
+        int rec[4];                 // BeginScissorMode() area
+        int size[2];                // SetupViewport() size
+    } params;
+} RedrawCall;
+#endif
+
+#if defined(RENDER_THREAD_SUPPORTED)
+// Render thread recorded shader uniform value, values are stored after call data
+typedef struct ShaderValueCall {
+    unsigned int shaderId;          // Shader program id
+    int locIndex;                   // Uniform location
+    int uniformType;                // Uniform type (ShaderUniformDataType), -1: matrix, -2: texture sampler
+    int count;                      // Uniform values count
+} ShaderValueCall;
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Shader async load job data
+typedef struct ShaderLoadJob {
+    char fileName[2][MAX_FILEPATH_LENGTH];  // Vertex and fragment shader files, empty if not provided
+    char *code[2];                  // Vertex and fragment shader code, NULL for default shader stage
+    bool compiling;                 // Shader program compilation started, upload stage runs until program is ready
+    Shader shader;                  // Loaded shader (main thread)
+} ShaderLoadJob;
+#endif
+
+#if defined(SUPPORT_SHADER_REFLECTION)
+// Shader reflected uniform or attribute, uniforms keep last value set by handle setters
+typedef struct ShaderReflectionEntry {
+    unsigned int hash;              // Name hash (FNV-1a)
+    char *name;                     // Uniform or attribute name
+    int location;                   // Location, -1 if not active (failed lookups are kept too)
+    bool attrib;                    // Entry is a vertex attribute
+    bool untracked;                 // Uniform also set by raylib (default locations), value always uploaded
+    int valueSize;                  // Last value set size (in bytes), 0 if unknown
+    unsigned char value[64];        // Last value set (up to matrix 4x4)
+} ShaderReflectionEntry;
+
+// Shader reflection, entries hashed by name (open addressing)
+typedef struct ShaderReflection {
+    ShaderReflectionEntry *entries; // Reflected entries
+    int count;                      // Entries count
+    int capacity;                   // Entries capacity
+    int *slots;                     // Hash slots, entry index (-1: empty), twice entries capacity
+} ShaderReflection;
+#endif
+
+// Shader variants, code template specialized by feature defines
+struct ShaderVariants {
+    char *code[2];                  // Vertex and fragment shader code template, NULL for default shader stage
+    char **featureNames;            // Feature define names, feature bit i defines featureNames[i]
+    int featureCount;               // Number of features
+    Shader *shaders;                // Variants table indexed by features bitmask, variant not compiled while locs is NULL
+};
+
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
 // Core global state context data
 typedef struct CoreData {
     struct {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
         GLFWwindow *handle;                 // GLFW window handle (graphic device)
 #endif
 #if defined(PLATFORM_RPI)
@@ -416,6 +915,8 @@ typedef struct CoreData {
         char **dropFilesPath;               // Store dropped files paths as strings
         int dropFileCount;                  // Count dropped files strings
 
+        FocusCallback focusCallback;        // User callback on focus changes (application focus on PLATFORM_NX)
+
     } Window;
 #if defined(PLATFORM_ANDROID)
     struct {
@@ -424,9 +925,74 @@ typedef struct CoreData {
         struct android_poll_source *source; // Android events polling source
         bool contextRebindRequired;         // Used to know context rebind required
     } Android;
+#endif
+#if defined(PLATFORM_NX)
+    struct {
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+        NWindow *window;                    // Default native window (framebuffer cropped to operation mode size)
+        EGLDisplay eglDisplay;              // EGL display
+        EGLSurface eglSurface;              // EGL window surface on default native window
+        EGLContext eglContext;              // EGL graphic context
+#endif
+        AppletHookCookie hookCookie;        // Applet messages hook (operation mode, performance mode, focus)
+        AppletOperationMode operationMode;  // Current operation mode (handheld or docked)
+        ApmPerformanceMode performanceMode; // Current performance mode (normal or boost)
+        ViDisplay display;                  // Default display, used to get vsync event
+        Event vsyncEvent;                   // Display vsync event (frame pacing)
+        bool vsyncReady;                    // Display vsync event available
+        bool suspended;                     // Application out of focus: frames not presented, audio suspended, loop throttled
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+        int clockProfile;                   // Current clocks profile (ClockProfile)
+        int loadingBoost;                   // Loading boost scopes nesting level
+        bool cpuBoostReady;                 // CPU boost mode available (HOS 7.0.0+)
+        bool cpuBoost;                      // CPU boost mode currently set
+        bool apmReady;                      // Performance configurations available
+        u32 defaultConfig[2];               // Default performance configurations (normal and boost performance modes)
+#endif
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+        bool albumReady;                    // Album screenshots service available (caps:su)
+        bool recordingReady;                // System video recording available (application with video capture)
+        bool recording;                     // System video recording enabled
+#endif
+#if defined(SUPPORT_NX_HID_INPUT)
+        Thread inputThread;                 // Native input sampling thread
+        atomic_bool inputRunning;           // Native input thread running
+        atomic_bool inputThrottled;         // Native input sampled at background frame rate (application out of focus)
+        PadState pads[MAX_GAMEPADS];        // Pads state, owned by input thread
+        HidSixAxisSensorHandle sensors[MAX_GAMEPADS][3];    // Pads six-axis sensors (full key, joy-con left, joy-con right)
+        HidSixAxisSensorHandle handheldSensor;              // Handheld six-axis sensor (first gamepad)
+        NxInputEvent events[MAX_NX_INPUT_EVENTS];           // Button events ring (single producer, single consumer)
+        atomic_uint eventHead;              // Button events ring write position (input thread)
+        atomic_uint eventTail;              // Button events ring read position (PollInputEvents)
+        NxInputState states[3];             // Sampled states triple buffer
+        atomic_int stateLatest;             // Latest published state index, bit 2 set if not read yet
+        int stateBack;                      // State written by input thread
+        int stateFront;                     // State read by PollInputEvents
+#endif
+    } Nx;
+#endif
+#if defined(PLATFORM_3DS)
+    struct {
+        C3D_RenderTarget *target;           // Top screen render target (left eye)
+        C3D_RenderTarget *targetRight;      // Top screen right eye render target (stereoscopic 3D)
+        bool stereo;                        // Stereoscopic 3D output enabled (3D slider up)
+        u32 keys;                           // Buttons held on last input poll
+    } N3ds;
 #endif
     struct {
         const char *basePath;               // Base path for data storage
+#if defined(SUPPORT_DATA_STORAGE)
+        bool loaded;                        // Storage file loaded into cache
+        int *values;                        // Positional integer values
+        unsigned int valueCount;            // Positional integer values count
+        StorageEntry *entries;              // Keyed entries
+        unsigned int entryCount;            // Keyed entries count
+        unsigned int sequence;              // Last commit sequence number
+        int slot;                           // Storage file of last commit (0: STORAGE_DATA_FILE, 1: STORAGE_DATA_FILE.1)
+        bool dirty;                         // Changes not committed yet
+        double changeTime;                  // Time of last change not committed
+        JobCounter commit;                  // Commit write in progress (job)
+#endif
     } Storage;
     struct {
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
@@ -487,11 +1053,24 @@ typedef struct CoreData {
             char currentButtonState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];     // Current gamepad buttons state
             char previousButtonState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];    // Previous gamepad buttons state
             float axisState[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];                // Gamepad axis state
+#if defined(SUPPORT_NX_HID_INPUT)
+            double buttonTime[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];           // Gamepad buttons last state change time
+            Vector3 accelerometer[MAX_GAMEPADS];                            // Gamepad acceleration (G)
+            Vector3 gyroscope[MAX_GAMEPADS];                                // Gamepad angular velocity (radians/second)
+#endif
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
             pthread_t threadId;             // Gamepad reading thread id
             int streamId[MAX_GAMEPADS];     // Gamepad device file descriptor
 #endif
         } Gamepad;
+        struct {
+            InputEvent queue[MAX_INPUT_EVENTS];     // Input events ring, written by input callbacks (single producer, single consumer)
+            unsigned int head;                      // Input events ring write position (producer)
+            unsigned int tail;                      // Input events ring read position (PollInputEvents)
+            InputEvent frame[MAX_INPUT_EVENTS];     // Input events registered on current frame
+            int frameCount;                         // Input events registered on current frame count
+            int frameRead;                          // Input events already read by PollInputEvent()
+        } Events;
     } Input;
     struct {
         double current;                     // Current time measure
@@ -500,11 +1079,102 @@ typedef struct CoreData {
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+        int pacing;                         // Frame pacing mode (FramePacingMode)
+        int swapInterval;                   // Vsync periods per frame on vsync pacing modes
+        double presentTime;                 // Last frame present time, 0 if not measured yet
+        double presentInterval;             // Filtered time between presented frames, 0 if not measured yet
+        double workTime;                    // Filtered frame work time before present (low latency pacing)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_3DS) || defined(PLATFORM_NX)
         unsigned long long base;            // Base time measure for hi-res timer
 #endif
         unsigned int frameCounter;          // Frame counter
     } Time;
+    struct {
+        FixedUpdateCallback callback;       // Fixed update callback, runs every simulation step
+        double step;                        // Fixed update step time (seconds), 0 if disabled
+        double accumulator;                 // Frames time not simulated yet
+        float alpha;                        // Interpolation factor between last two simulation steps
+        int steps;                          // Simulation steps run on last frame
+        char previousKeyState[MAX_KEYBOARD_KEYS];                       // Keys state on last simulation step
+        char previousMouseState[MAX_MOUSE_BUTTONS];                     // Mouse buttons state on last simulation step
+        char previousGamepadState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];   // Gamepads buttons state on last simulation step
+        char previousTouchState[MAX_TOUCH_POINTS];                      // Touch points state on last simulation step
+    } Simulation;
+#if defined(SUPPORT_FRAME_HISTORY)
+    struct {
+        FrameTiming frames[FRAME_HISTORY_SIZE]; // Frames history ring
+        unsigned int count;                 // Frames recorded, last frame at (count - 1)%FRAME_HISTORY_SIZE
+        float hitchThreshold;               // Frame time considered a hitch (seconds), 0 if disabled
+        int hitchTraceFrames;               // Frames exported on hitch trace (hitch frame included)
+        int hitchCount;                     // Frames over hitch threshold since threshold set
+        unsigned int hitchNextTrace;        // First frame a new hitch trace can be exported (traces do not overlap)
+        char hitchFileName[MAX_FILEPATH_LENGTH];    // Hitch traces base file name
+    } FrameHistory;
+#endif
+#if defined(SUPPORT_JOB_SYSTEM)
+    struct {
+        int workerCount;                    // Worker threads running, jobs run on submit if 0
+#if defined(JOBS_THREADED)
+        JobThread workers[MAX_JOB_WORKERS]; // Worker threads
+        JobQueue queues[MAX_JOB_WORKERS + 1];   // Jobs deques, main thread (and external threads) deque first, then one per worker
+        JobQueue mainQueue;                 // Main thread only jobs (FIFO), never stolen by workers
+        Job deferred[MAX_JOBS_DEFERRED];    // Jobs waiting for a dependency counter
+        int deferredCount;                  // Jobs waiting for a dependency counter (atomic)
+        JobMutex deferredLock;              // Deferred jobs access mutex
+        int queued;                         // Jobs queued on deques, main thread only jobs not included (atomic)
+        int sleeping;                       // Worker threads sleeping (atomic)
+        JobMutex sleepLock;                 // Worker threads sleep mutex
+        JobCondition wake;                  // Signaled when jobs are queued or workers must quit
+        bool running;                       // Worker threads keep running (atomic)
+#endif
+    } Jobs;
+#endif
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    struct {
+        float scale;                        // Current scale (relative to framebuffer size)
+        float minScale;                     // Minimum scale allowed
+        float maxScale;                     // Maximum scale allowed
+        double gpuTime;                     // Filtered GPU frame time, 0.0 if not measured yet
+        bool used;                          // Dynamic resolution mode used on current frame
+        RenderTexture2D target;             // Current frame scaled render target (transient), id 0 if not scaled
+    } Resolution;
+#endif
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    struct {
+        rlCommandList *list;                // Frame drawing commands, NULL if partial redraw is disabled
+        RenderTexture2D target;             // Redraw target, keeps previous frames drawing
+        unsigned int *tiles[2];             // Screen tiles hashes: current and previous frame
+        int tilesX;                         // Screen tiles per row
+        int tilesY;                         // Screen tiles per column
+        int current;                        // Current frame tiles hashes index
+        int damage[4];                      // Damage area scissor (x, y, width, height), bottom-left origin
+        bool valid;                         // Redraw target drawing and previous tiles hashes valid
+        bool recording;                     // Frame drawing commands being recorded (BeginDrawing() to EndDrawing())
+        bool fullDamage;                    // Frame drawing can not be bounded (3D or render texture drawing)
+        bool drawing;                       // Frame drawing commands replayed on redraw target
+        bool targetActive;                  // Redraw target is current framebuffer, scissor is limited to damage area
+        bool damaged;                       // Frame has damage, screen buffers are swapped
+    } Redraw;
+#endif
+#if defined(SUPPORT_SHADER_REFLECTION)
+    struct {
+        ShaderReflection **reflections;     // Shaders reflections indexed by shader program id, NULL if not reflected yet
+        unsigned int capacity;              // Reflections array capacity (highest program id + 1)
+    } Shaders;
+#endif
+#if defined(RENDER_THREAD_SUPPORTED)
+    struct {
+        rlCommandList *lists[2];            // Frames drawing commands (double-buffered): recorded by main thread, submitted by render thread
+        int current;                        // Frame drawing commands being recorded
+        rlCommandList *pending;             // Frame drawing commands waiting for render thread, NULL if render thread is idle
+        JobThread thread;                   // Render thread, GL context is current on it while drawing a frame
+        JobMutex lock;                      // Render thread state mutex
+        JobCondition signal;                // Signaled when a frame is pending, done or render thread must quit
+        bool running;                       // Render thread keeps running
+        bool enabled;                       // Render thread enabled, GL context is not current on main thread (except on frame end)
+        bool recording;                     // Frame drawing commands being recorded on main thread
+    } RenderThread;
+#endif
 } CoreData;
 
 //----------------------------------------------------------------------------------
@@ -517,6 +1187,33 @@ static int dirFileCount = 0;                // Count directory files strings
 
 const char *raylibVersion = RAYLIB_VERSION; // raylib version symbol, it could be required for some bindings
 
+#if defined(SUPPORT_DATA_STORAGE)
+// Storage commit write, data owned by the commit job while writing
+static struct {
+    char path[MAX_FILEPATH_LENGTH];         // Storage file path
+    int slot;                               // Storage file written (0: STORAGE_DATA_FILE, 1: STORAGE_DATA_FILE.1)
+    unsigned char *data;                    // Storage file data (header, values and entries)
+    unsigned int size;                      // Storage file data size
+    bool success;                           // Storage file written successfully
+    bool pending;                           // Commit result not checked yet (main thread)
+} storageCommit = { 0 };
+#endif
+
+#if defined(JOBS_THREADED)
+static __thread int jobThreadIndex = -1;    // Current thread jobs deque index: 0 main thread, -1 external threads
+#endif
+
+// Random generators, one per thread seeded from the same seed and the thread stream (SetRandomSeed())
+// NOTE: Main thread uses stream 0, job workers their worker index, other threads get streams on first use
+static unsigned int randomSeed = 0;         // Random generators seed
+static unsigned int randomSeedEpoch = 0;    // Random seed changes, thread generators are seeded again on change (atomic)
+static RL_THREAD_LOCAL RandomGenerator threadRandom = { 0 };    // Calling thread random generator
+static RL_THREAD_LOCAL unsigned int threadRandomEpoch = 0;      // Seed epoch of calling thread generator plus one, 0 if never seeded
+#if defined(JOBS_THREADED)
+static int randomStreamCounter = MAX_JOB_WORKERS;               // Last random stream assigned to external threads (atomic)
+static RL_THREAD_LOCAL int threadRandomStream = -1;             // Random stream of external thread, -1 if not assigned
+#endif
+
 #if defined(SUPPORT_SCREEN_CAPTURE)
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
@@ -527,28 +1224,68 @@ static bool gifRecording = false;           // GIF recording state
 static MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
-#if defined(SUPPORT_EVENTS_AUTOMATION)
-#define MAX_CODE_AUTOMATION_EVENTS      16384
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Screen capture readback usage flags
+#define SCREEN_CAPTURE_IMAGE        1       // Readback exported as image file (TakeScreenshot())
+#define SCREEN_CAPTURE_GIF_FRAME    2       // Readback added as GIF recording frame
+
+#if defined(RENDER_THREAD_SUPPORTED)
+// Render thread recorded screen capture, screen is read once frame drawing is submitted
+typedef struct ScreenCaptureCall {
+    int usage;                              // Readback usage flags
+    char fileName[MAX_FILEPATH_LENGTH];     // Image file path (SCREEN_CAPTURE_IMAGE)
+} ScreenCaptureCall;
+#endif
+
+// Screen capture readback, pixels read into a pixel buffer are collected next frame
+typedef struct ScreenCaptureReadback {
+    unsigned int buffer;                    // Pixel buffer id (PBO), 0 if not supported
+    int size;                               // Pixel buffer size in bytes
+    int width;                              // Readback width
+    int height;                             // Readback height
+    int usage;                              // Readback usage flags, 0 if no readback pending
+    unsigned char *pixels;                  // Pixels read synchronously (pixel buffers not supported)
+    char fileName[MAX_FILEPATH_LENGTH];     // Image file path (SCREEN_CAPTURE_IMAGE)
+} ScreenCaptureReadback;
+
+// Screen capture encoding job data, pixels are stored after job data
+typedef struct ScreenCaptureJob {
+    unsigned char *pixels;                  // Pixels data (RGBA)
+    int width;                              // Pixels width
+    int height;                             // Pixels height
+    int usage;                              // Readback usage flags
+    bool flipped;                           // Pixels already flipped (top-left origin)
+    char fileName[MAX_FILEPATH_LENGTH];     // Image file path (SCREEN_CAPTURE_IMAGE)
+} ScreenCaptureJob;
+
+static ScreenCaptureReadback captureReadback[2] = { 0 };            // Screen capture readbacks (double-buffered)
+static int captureReadbackIndex = 0;                                // Screen capture readback for current frame
+static char captureFileName[MAX_FILEPATH_LENGTH] = { 0 };           // Screenshot requested file path, read on EndDrawing()
+static unsigned int captureJobs[MAX_SCREEN_CAPTURE_JOBS] = { 0 };   // Screen capture encoding jobs in flight
+static int captureJobsIndex = 0;                                    // Screen capture next encoding job slot
+static unsigned int captureGifJob = 0;                              // Last GIF frame encoding job (frames encoded in order)
+#endif
 
+#if defined(SUPPORT_EVENTS_AUTOMATION)
 typedef enum AutomationEventType {
     EVENT_NONE = 0,
     // Input events
     INPUT_KEY_UP,                   // param[0]: key
     INPUT_KEY_DOWN,                 // param[0]: key
-    INPUT_KEY_PRESSED,              // param[0]: key
+    INPUT_KEY_PRESSED,              // param[0]: key (keys pressed queue)
     INPUT_KEY_RELEASED,             // param[0]: key
     INPUT_MOUSE_BUTTON_UP,          // param[0]: button
     INPUT_MOUSE_BUTTON_DOWN,        // param[0]: button
     INPUT_MOUSE_POSITION,           // param[0]: x, param[1]: y
-    INPUT_MOUSE_WHEEL_MOTION,       // param[0]: delta
+    INPUT_MOUSE_WHEEL_MOTION,       // param[0]: delta (x1000)
     INPUT_GAMEPAD_CONNECT,          // param[0]: gamepad
     INPUT_GAMEPAD_DISCONNECT,       // param[0]: gamepad
-    INPUT_GAMEPAD_BUTTON_UP,        // param[0]: button
-    INPUT_GAMEPAD_BUTTON_DOWN,      // param[0]: button
-    INPUT_GAMEPAD_AXIS_MOTION,      // param[0]: axis, param[1]: delta
+    INPUT_GAMEPAD_BUTTON_UP,        // param[0]: gamepad, param[1]: button
+    INPUT_GAMEPAD_BUTTON_DOWN,      // param[0]: gamepad, param[1]: button
+    INPUT_GAMEPAD_AXIS_MOTION,      // param[0]: gamepad, param[1]: axis, param[2]: value (x32768)
     INPUT_TOUCH_UP,                 // param[0]: id
     INPUT_TOUCH_DOWN,               // param[0]: id
-    INPUT_TOUCH_POSITION,           // param[0]: x, param[1]: y
+    INPUT_TOUCH_POSITION,           // param[0]: id, param[1]: x, param[2]: y
     INPUT_GESTURE,                  // param[0]: gesture
     // Window events
     WINDOW_CLOSE,                   // no params
@@ -606,10 +1343,30 @@ typedef struct AutomationEvent {
     int params[3];                      // Event parameters (if required)
 } AutomationEvent;
 
+// Automation replay frame stats
+typedef struct AutomationFrameStats {
+    double frameTime;                   // Frame time: update + draw + wait (seconds)
+    double updateTime;                  // Frame update time (seconds)
+    double drawTime;                    // Frame draw time, buffers swap included (seconds)
+    rlFrameStats render;                // Render counters and CPU/GPU times
+} AutomationFrameStats;
+
 static AutomationEvent *events = NULL;        // Events array
 static unsigned int eventCount = 0;     // Events count
+static unsigned int eventCapacity = 0;  // Events array capacity (grows as required)
 static bool eventsPlaying = false;      // Play events
 static bool eventsRecording = false;    // Record events
+static unsigned int eventsFrame = 0;            // Frames since recording/replay start
+static unsigned int eventsFrameCount = 0;       // Recorded frames count
+static unsigned int eventsPlayIndex = 0;        // Next event to play
+static float eventsDeltaTime = 0.0f;            // Frame time returned by GetFrameTime() while recording/replaying
+static unsigned int eventsSeed = 0;             // Random seed set on recording/replay start
+static Vector2 eventsMousePosition = { 0 };     // Mouse position last recorded/replayed
+static bool eventsGamepadReady[MAX_GAMEPADS] = { 0 };               // Gamepads ready state last recorded/replayed
+static int eventsAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXIS] = { 0 };      // Gamepads axis last recorded/replayed (x32768)
+static AutomationFrameStats *eventsStats = NULL;        // Replayed frames stats
+static unsigned int eventsStatsCount = 0;               // Replayed frames stats count
+static char eventsStatsFileName[512] = { 0 };           // Replayed frames stats export file name
 
 //static short eventsEnabled = 0b0000001111111111;    // Events enabled for checking
 #endif
@@ -622,16 +1379,201 @@ static bool eventsRecording = false;    // Record events
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void InitShapesTables(void);         // [Module: shapes] Inits trig tables and tessellation thresholds on InitWindow()
+#endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadSkinningData(void);       // [Module: models] Unloads skinning shader, worker threads and buffers
+extern void UnloadRenderQueue(void);        // [Module: models] Unloads render queue buffers
+extern void UnloadVoxelShader(void);        // [Module: models] Unloads voxel map atlas shader
+extern void UnloadTilemapShader(void);      // [Module: models] Unloads tilemap animated tiles shader
+extern void UnloadParticlesShaders(void);   // [Module: models] Unloads particles shaders and quad buffers
+extern void UnloadBillboardsShader(void);   // [Module: models] Unloads instanced billboards shader and quad buffers
+extern void UnloadDebugDraw(void);          // [Module: models] Unloads debug draw shader, unit shapes buffer and primitives
+extern void UnloadLighting(void);           // [Module: models] Unloads clustered lighting shader, textures and buffers
+#endif
+#if defined(SUPPORT_MODULE_RMODELS) && defined(SUPPORT_OCCLUSION_CULLING) && !defined(GRAPHICS_API_OPENGL_11)
+extern void UpdateOcclusionCulling(void);   // [Module: models] Advances occlusion culling frame, evicts draws not tested recently
+#endif
+#if defined(SUPPORT_MODULE_RMODELS) && defined(SUPPORT_SKINNING_CACHE) && defined(GRAPHICS_API_OPENGL_43)
+extern void UpdateSkinningCache(void);      // [Module: models] Advances skinning cache frame, releases buffers not drawn recently
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UpdateRenderTexturePool(void);  // [Module: textures] Recycles transient render textures, unloads idle ones
+extern void UnloadRenderTexturePool(void);  // [Module: textures] Unloads all pooled render textures
+extern void UnloadTextureTiledShader(void); // [Module: textures] Unloads tiled texture wrap shader
+extern void UnloadSpriteInstancesShader(void);  // [Module: textures] Unloads instanced sprites shader and quad buffers
+extern void UnloadTextureIBLShaders(void);  // [Module: textures] Unloads image-based lighting generation shaders
+extern void UnloadTexturePatternShaders(void);  // [Module: textures] Unloads procedural pattern generation shaders
+extern void UnloadVideoStreamShader(void);  // [Module: textures] Unloads video YUV to RGB conversion shader
+extern void UnloadLowResEffectsShaders(void);   // [Module: textures] Unloads reduced resolution effects shaders
+extern void UnloadTextureUploadBuffer(void);    // [Module: textures] Unloads async textures upload buffer (PBO)
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_STREAMING)
+extern void UpdateTextureStreaming(void);   // [Module: textures] Requests and evicts streamed textures mipmaps for frame usage
+extern void UnloadTextureStreaming(void);   // [Module: textures] Unloads textures streaming data
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void InitTimer(void);                            // Initialize timer (hi-resolution if available)
+static double GetSystemTime(void);                      // Get system monotonic time in seconds (window-less timing)
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
+static void UpdateFixedSimulation(double frameTime);    // Run fixed update steps for frame time, update interpolation factor
+#if defined(SUPPORT_FRAME_HISTORY)
+static void UpdateFrameHistory(void);                   // Record last frame timing on frames history, export trace on hitches
+#endif
+static bool PushInputEvent(int type, int device, int code, Vector2 value);  // Queue input event (timestamped), returns false if queue is full
+static void RegisterInputEvent(InputEvent event);       // Register input event on current frame events
+static void SetShaderDefaultLocations(Shader shader);
+#if defined(SUPPORT_SHADER_REFLECTION)
+static ShaderReflection *LoadShaderReflection(unsigned int shaderId);    // Load shader active uniforms and attributes reflection (replaces previous one)
+static void UnloadShaderReflection(unsigned int shaderId);              // Unload shader reflection
+static ShaderReflection *GetShaderReflection(unsigned int shaderId);    // Get shader reflection, loaded on first request
+static int GetShaderReflectionEntry(ShaderReflection *reflection, unsigned int shaderId, const char *name, bool attrib);   // Get reflected entry index, driver queried and entry added if not found
+static void InvalidateShaderReflectionValue(unsigned int shaderId, int location);  // Invalidate cached uniform value, set by location
+static void UnloadShaderReflections(void);                              // Unload all shaders reflections
+#endif
+static void SetShaderUniformValue(Shader shader, int uniform, const void *value, int uniformType, int size);   // Set uniform value by handle, skipped if unchanged   // Load shader variant code, features defines are added after #version directive (required to be first)
+// NOTE: Returns NULL for NULL code template (default shader stage), code must be freed with RL_FREE()
+static char *LoadShaderVariantCode(const char *code, const ShaderVariants *variants, unsigned int features)
+{
+    if (code == NULL) return NULL;
+
+    int codeLength = (int)strlen(code);
+    int definesLength = 0;
+
+    for (int i = 0; i < variants->featureCount; i++)
+    {
+        if (features & (1u << i)) definesLength += (int)strlen(variants->featureNames[i]) + 9;   // "#define " + name + "\n"
+    }
 
+    // Defines are inserted after #version line, at code start if not found
+    int offset = 0;
+    const char *version = strstr(code, "#version");
+
+    if (version != NULL)
+    {
+        const char *lineEnd = strchr(version, '\n');
+        offset = (lineEnd != NULL)? (int)(lineEnd - code) + 1 : codeLength;
+    }
+
+    char *variantCode = (char *)RL_MALLOC(codeLength + definesLength + 2);
+    char *ptr = variantCode;
+
+    memcpy(ptr, code, offset);
+    ptr += offset;
+    if ((offset > 0) && (code[offset - 1] != '\n')) *ptr++ = '\n';
+
+    for (int i = 0; i < variants->featureCount; i++)
+    {
+        if (features & (1u << i)) ptr += sprintf(ptr, "#define %s\n", variants->featureNames[i]);
+    }
+
+    memcpy(ptr, code + offset, codeLength - offset);
+    ptr[codeLength - offset] = '\0';
+
+    return variantCode;
+}
+
+// Set shader default attributes and uniforms locations
+static char *LoadShaderVariantCode(const char *code, const ShaderVariants *variants, unsigned int features);  // Load shader variant code, features defines added after #version
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+static bool DecodeShaderReloadJob(void *data);          // Shader reload decode stage: load shader code files (worker thread)
+static bool UploadShaderReloadJob(void *data);          // Shader reload upload stage: relink shader program in place (main thread)
+static void WatchShaderFiles(Shader shader, const char *vsFileName, const char *fsFileName);  // Watch shader code files, shader reloaded in place when changed
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeShaderJob(void *data);                // Shader async load decode stage: load shader code files (worker thread)
+static bool UploadShaderJob(void *data);                // Shader async load upload stage: compile shader program, finish it once ready (main thread)
+#endif
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+static void ProcessInputEvents(void);                   // Register queued input events, updates keyboard and mouse states
+#endif
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+static void UpdateDynamicResolution(void);              // Update dynamic resolution scale from last measured GPU frame time
+#endif
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+static bool RecordRedrawCall(int type, const void *params, int size);  // Record core call on frame drawing commands, false if not recording
+static void ReplayRedrawCall(void *data);               // Replay core call recorded by RecordRedrawCall()
+static bool DrawPartialRedraw(void);                    // Redraw frame damaged area to redraw target and copy it to screen, false if no damage
+static void BeginPartialRedrawTarget(void);             // Set redraw target as current framebuffer, scissor limited to damage area
+static void SetPartialRedrawScissor(int x, int y, int width, int height);   // Set scissor area limited to damage area (bottom-left origin)
+#endif
+#if defined(RENDER_THREAD_SUPPORTED)
+static void SetGraphicsContextCurrent(bool current);    // Make GL context current on calling thread or release it
+static void FinishRenderThreadFrame(void);              // End frame drawing recording, wait render thread and make GL context current (main thread)
+static void SubmitRenderThreadFrame(void);              // Release GL context, pass frame to render thread and begin next frame recording (main thread)
+static void DrawRenderThreadFrame(rlCommandList *list); // Draw recorded frame and present it (render thread)
+static bool RecordShaderValueCall(Shader shader, int locIndex, const void *value, int uniformType, int count);   // Record shader uniform value on frame drawing commands, false if not recording
+static void ReplayShaderValueCall(void *data);          // Set shader uniform value recorded by RecordShaderValueCall()
+#if defined(PLATFORM_NX)
+static void RenderThreadLoop(void *arg);                // Render thread, draws and presents recorded frames
+#else
+static void *RenderThreadLoop(void *arg);               // Render thread, draws and presents recorded frames
+#endif
+#endif
+#if defined(SUPPORT_DATA_STORAGE)
+static void LoadStorage(void);                          // Load storage file into cache (latest valid commit), on first access
+static void UnloadStorage(void);                        // Unload storage cache, changes must be committed before
+static void UpdateStorage(void);                        // Commit storage changes once idle (write-behind)
+static bool CommitStorage(bool wait);                   // Commit storage changes to file, write runs as a job
+static void FinishStorageCommit(void);                  // Finish storage commit (write done), failed commits are retried
+static void CommitStorageJob(void *data);               // Storage commit write job
+static unsigned int GetStorageChecksum(const unsigned char *data, unsigned int size);   // Get storage data checksum (FNV-1a)
+static StorageEntry *GetStorageEntry(const char *key);  // Get storage entry by key, NULL if not found
+static bool SetStorageEntry(const char *key, int type, const void *data, unsigned int size);  // Set storage entry data, created if required
+#endif
+static RandomGenerator SeedRandomGenerator(unsigned long long seed);    // Seed random generator state (splitmix64 expansion)
+static unsigned int NextRandomBits(unsigned int *state);                // Get next random 32 bits and advance state (xoshiro128**)
+static unsigned int GetRandomRange(unsigned int *state, unsigned int range);    // Get random value in [0, range), range 0 for full 32 bits
+#if defined(SUPPORT_COMPRESSION_API)
+static int CompressLZ4(const unsigned char *data, int dataSize, unsigned char *compData);   // Compress data (LZ4 block format), output must fit GetCompressBoundLZ4()
+static int DecompressLZ4(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity);  // Decompress data (LZ4 block format), returns -1 on failure
+static int GetCompressionStreamNeeded(CompressionStream *stream);  // Get input data required to complete current block
+static void ProcessCompressionStream(CompressionStream *stream);   // Process input block into output block (once output drained)
+#endif
+#if defined(SUPPORT_JOB_SYSTEM)
+static void InitJobSystem(void);                        // Initialize job system, start one worker thread per available core
+static void CloseJobSystem(void);                       // Stop job system worker threads, remaining jobs run on main thread
+static void QueueJob(Job job);                          // Queue job (dependency done), main thread only jobs queued apart
+static void RunJob(Job *job);                           // Run job and decrement its counter, release jobs depending on it
+static bool RunMainThreadJobs(void);                    // Run main thread only jobs queued, returns true if any job was run
+static ObjectPoolCache *GetObjectPoolCache(ObjectPool *pool);   // Get current thread object pool cache, NULL if thread is not cached
+static unsigned int PopObjectPool(ObjectPool *pool, unsigned int *retries);    // Pop free object (index + 1) from shared free list, 0 if empty
+static void PushObjectPool(ObjectPool *pool, unsigned int object, unsigned int *retries);  // Push free object (index + 1) to shared free list
+#if defined(JOBS_THREADED)
+static bool DeferJob(Job job);                          // Defer job until its dependency counter is done, returns false if already done
+static bool NextJob(int index, Job *job);               // Get next job: own deque bottom first, then steal from other deques top
+static void ReleaseDeferredJobs(void);                  // Queue deferred jobs with dependency counter done
+#if defined(PLATFORM_NX)
+static void JobWorkerThread(void *arg);                 // Job system worker thread
+#else
+static void *JobWorkerThread(void *arg);                // Job system worker thread
+#endif
+#endif
+#endif
+#if defined(PLATFORM_NX)
+static void SetupOperationMode(void);                   // Resize framebuffer for current operation mode (handheld/docked)
+static void SetSwapInterval(int interval);              // Set buffers swap interval (GLFW port or EGL)
+static void AppletHookCallback(AppletHookType hook, void *param);   // Applet hook, runs on operation/performance mode and focus changes
+static void SetNxFocusState(bool focused);              // Suspend/resume frames presentation, audio and input sampling on focus changes
+static void WaitFramePacing(double workTime);           // Measure present interval and wait low latency pacing deadline
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+static void UpdateCpuBoost(void);                       // Set CPU boost mode for current clocks profile and loading boost scopes
+#endif
+#if defined(SUPPORT_NX_HID_INPUT)
+static void InitNxInput(void);                          // Initialize pads, touch screen and six-axis sensors, start input thread
+static void CloseNxInput(void);                         // Stop input thread and six-axis sensors
+static void NxInputThread(void *arg);                   // Native input sampling thread
+static void PollNxInputEvents(void);                    // Register native input events and latest sampled state
+#endif
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
 // Window callbacks events
 static void WindowSizeCallback(GLFWwindow *window, int width, int height);                 // GLFW3 WindowSize Callback, runs when window is resized
@@ -688,16 +1630,38 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 
 #endif  // PLATFORM_RPI || PLATFORM_DRM
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+static void ReadScreenCapture(int usage, const char *fileName);    // Read current frame screen pixels into a pixel buffer, collected next frame
+#if defined(RENDER_THREAD_SUPPORTED)
+static void ReplayScreenCapture(void *data);                // Read screen capture recorded by ReadScreenCapture() (render thread)
+#endif
+static void CollectScreenCapture(ScreenCaptureReadback *readback);  // Collect screen readback pixels and submit encoding job
+static void UpdateScreenCapture(void);                      // Collect previous frame readback and release finished encoding jobs
+static void FlushScreenCapture(void);                       // Collect pending readbacks and wait for encoding jobs to finish
+static void UnloadScreenCapture(void);                      // Flush screen capture and unload pixel buffers
+static bool EncodeScreenCaptureJob(void *data);             // Flip and encode screen capture (async job decode stage)
+#endif
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+static bool SaveAlbumScreenshot(Image image);               // Save screenshot to console album, resized to album screenshots size
+#endif
+
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-static void LoadAutomationEvents(const char *fileName);     // Load automation events from file
+static void AddAutomationEvent(unsigned int frame, unsigned int type, int param0, int param1, int param2);  // Add event to events array
+static bool LoadAutomationEvents(const char *fileName);     // Load automation events from file
 static void ExportAutomationEvents(const char *fileName);   // Export recorded automation events into a file
 static void RecordAutomationEvent(unsigned int frame);      // Record frame events (to internal events array)
 static void PlayAutomationEvent(unsigned int frame);        // Play frame events (from internal events array)
+static void RecordAutomationFrameStats(void);               // Register last drawn frame timings and render stats (replay)
+static void ExportAutomationFrameStats(const char *fileName);   // Export replayed frames timings and render stats (.csv/.json)
+static void ResetAutomationSwapInterval(bool replay);       // Set swap interval for replay (no vsync) or restore it
+static void UpdateAutomationEvents(void);                   // Update automation events recording or replay (frame end)
 #endif
 
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
+int __stdcall QueryPerformanceCounter(long long int *lpPerformanceCount);     // Required for: GetSystemTime(), GetTimeTicks()
+int __stdcall QueryPerformanceFrequency(long long int *lpFrequency);          // Required for: GetSystemTime(), GetTicksFrequency()
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -763,11 +1727,6 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "    > raudio:.... not loaded (optional)");
 #endif
 
-#if defined(PLATFORM_NX)
-    Result rc = romfsInit();
-    if (R_FAILED(rc)) TRACELOG(LOG_WARNING, "ROMFS failed to load!");
-#endif
-
     if ((title != NULL) && (title[0] != 0)) CORE.Window.title = title;
 
     // Initialize global input state
@@ -779,6 +1738,12 @@ void InitWindow(int width, int height, const char *title)
 #if defined(SUPPORT_EVENTS_WAITING)
     CORE.Window.eventWaiting = true;
 #endif
+
+#if defined(SUPPORT_MODULE_RSHAPES)
+    // Init shapes trig tables, before any shape drawing (or command lists recording on worker threads)
+    // WARNING: External function: Module required: rshapes
+    InitShapesTables();
+#endif
 #if defined(PLATFORM_ANDROID)
     CORE.Window.screen.width = width;
     CORE.Window.screen.height = height;
@@ -843,11 +1808,26 @@ void InitWindow(int width, int height, const char *title)
         }
     }
 #endif
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_NX) || defined(PLATFORM_3DS)
+    // Initialization stages times, logged on completion (cold start cost breakdown)
+    double initTime = GetSystemTime();
+    double stageTime = initTime;
+
+#if defined(PLATFORM_NX) || defined(PLATFORM_3DS)
+    Result rc = romfsInit();
+    if (R_FAILED(rc)) TRACELOG(LOG_WARNING, "ROMFS failed to load!");
+
+    double romfsTime = GetSystemTime() - stageTime;
+    stageTime += romfsTime;
+#endif
+
     // Initialize graphics device (display device and OpenGL context)
     // NOTE: returns true if window and graphic device has been initialized successfully
     CORE.Window.ready = InitGraphicsDevice(width, height);
 
+    double deviceTime = GetSystemTime() - stageTime;
+    stageTime += deviceTime;
+
     // If graphic device is no properly initialized, we end program
     if (!CORE.Window.ready)
     {
@@ -858,13 +1838,82 @@ void InitWindow(int width, int height, const char *title)
     // Initialize hi-res timer
     InitTimer();
 
+#if defined(SUPPORT_JOB_SYSTEM)
+    InitJobSystem();
+#endif
+
+#if defined(PLATFORM_NX)
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    // Exit requests are notified to the application (AppletHookType_OnExitRequest),
+    // so pending storage changes are committed on CloseWindow() instead of process being killed
+    appletLockExit();
+#endif
+    // Track operation mode changes, framebuffer size depends on it
+    appletHook(&CORE.Nx.hookCookie, AppletHookCallback, NULL);
+    CORE.Nx.performanceMode = appletGetPerformanceMode();
+    SetupOperationMode();
+
+    // Display vsync event, used by low latency frame pacing to align on actual presents
+    if (R_SUCCEEDED(viInitialize(ViServiceType_Default)))
+    {
+        if (R_SUCCEEDED(viOpenDefaultDisplay(&CORE.Nx.display)))
+        {
+            CORE.Nx.vsyncReady = R_SUCCEEDED(viGetDisplayVsyncEvent(&CORE.Nx.display, &CORE.Nx.vsyncEvent));
+            if (!CORE.Nx.vsyncReady) viCloseDisplay(&CORE.Nx.display);
+        }
+    }
+
+    if (!CORE.Nx.vsyncReady) TRACELOG(LOG_WARNING, "DISPLAY: Vsync event not available, frame pacing uses buffers swap times");
+
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    CORE.Nx.cpuBoostReady = hosversionAtLeast(7, 0, 0);
+
+    // Default performance configurations are stored to be restored, power saving profile overrides them
+    if (R_SUCCEEDED(apmInitialize()))
+    {
+        CORE.Nx.apmReady = R_SUCCEEDED(apmGetPerformanceConfiguration(ApmPerformanceMode_Normal, &CORE.Nx.defaultConfig[0])) &&
+                           R_SUCCEEDED(apmGetPerformanceConfiguration(ApmPerformanceMode_Boost, &CORE.Nx.defaultConfig[1]));
+        if (!CORE.Nx.apmReady) apmExit();
+    }
+
+    if (!CORE.Nx.apmReady) TRACELOG(LOG_WARNING, "SYSTEM: Performance configurations not available, power saving clocks profile disabled");
+
+    SetClockProfile(CORE.Nx.clockProfile);  // Profile could be set before InitWindow()
+#endif
+
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+    // Capture button screenshots and videos are saved by the system, TakeScreenshot() saves to the album too
+    appletSetScreenShotPermission(AppletScreenShotPermission_Enable);
+    CORE.Nx.albumReady = R_SUCCEEDED(capssuInitialize());
+    if (!CORE.Nx.albumReady) TRACELOG(LOG_WARNING, "SYSTEM: Album service not available, screenshots exported to files");
+
+    // NOTE: Video recording is only available to applications with video capture enabled (4.0.0+)
+    CORE.Nx.recordingReady = R_SUCCEEDED(appletInitializeGamePlayRecording());
+    if (CORE.Nx.recordingReady) CORE.Nx.recording = R_SUCCEEDED(appletSetGamePlayRecordingState(AppletGamePlayRecordingState_Enabled));
+    else TRACELOG(LOG_INFO, "SYSTEM: System video recording not available");
+#endif
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    InitNxInput();
+#endif
+#endif
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    CORE.Resolution.minScale = DYNAMIC_RESOLUTION_MIN_SCALE;
+    CORE.Resolution.maxScale = DYNAMIC_RESOLUTION_MAX_SCALE;
+    CORE.Resolution.scale = CORE.Resolution.maxScale;
+#endif
+
     // Initialize random seed
-    srand((unsigned int)time(NULL));
+    SetRandomSeed((unsigned int)time(NULL));
 
     // Initialize base path for storage
     CORE.Storage.basePath = GetWorkingDirectory();
 
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+    double systemsTime = GetSystemTime() - stageTime;
+    stageTime += systemsTime;
+
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT) && !defined(SUPPORT_LAZY_DEFAULT_FONT)
     // Load default font
     // WARNING: External function: Module required: rtext
     LoadFontDefault();
@@ -881,7 +1930,7 @@ void InitWindow(int width, int height, const char *title)
     SetShapesTexture(texture, (Rectangle){ 0.0f, 0.0f, 1.0f, 1.0f });    // WARNING: Module required: rshapes
     #endif
 #endif
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT) && !defined(SUPPORT_LAZY_DEFAULT_FONT)
     if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
     {
         // Set default font texture filter for HighDPI (blurry)
@@ -891,6 +1940,9 @@ void InitWindow(int width, int height, const char *title)
     }
 #endif
 
+    double fontTime = GetSystemTime() - stageTime;
+    stageTime += fontTime;
+
 #if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
     // Initialize raw input system
     InitEvdevInput();   // Evdev inputs initialization
@@ -932,16 +1984,37 @@ void InitWindow(int width, int height, const char *title)
     CORE.Input.Mouse.currentPosition.y = (float)CORE.Window.screen.height/2.0f;
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    events = (AutomationEvent *)malloc(MAX_CODE_AUTOMATION_EVENTS*sizeof(AutomationEvent));
     CORE.Time.frameCounter = 0;
 #endif
 
-#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM
+    double inputTime = GetSystemTime() - stageTime;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Initialization completed in %.2f ms", (GetSystemTime() - initTime)*1000.0);
+#if defined(PLATFORM_NX) || defined(PLATFORM_3DS)
+    TRACELOG(LOG_INFO, "    > Storage (romfs):  %.2f ms", romfsTime*1000.0);
+#endif
+    TRACELOG(LOG_INFO, "    > Graphics device:  %.2f ms (window, context, rlgl default resources)", deviceTime*1000.0);
+    TRACELOG(LOG_INFO, "    > Systems:          %.2f ms (timer, jobs, platform services)", systemsTime*1000.0);
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT) && defined(SUPPORT_LAZY_DEFAULT_FONT)
+    TRACELOG(LOG_INFO, "    > Default font:     deferred to first use");
+#else
+    TRACELOG(LOG_INFO, "    > Default font:     %.2f ms", fontTime*1000.0);
+#endif
+    TRACELOG(LOG_INFO, "    > Input:            %.2f ms", inputTime*1000.0);
+#endif        // PLATFORM_DESKTOP || PLATFORM_WEB || PLATFORM_RPI || PLATFORM_DRM || PLATFORM_NX || PLATFORM_3DS
 }
 
 // Close window and unload OpenGL context
 void CloseWindow(void)
 {
+#if defined(RENDER_THREAD_SUPPORTED)
+    DisableRenderThread();      // Stop render thread, GL context current on main thread (before any GL work)
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    UnloadScreenCapture();      // Wait for screen capture encoding jobs (before GIF recording is finished)
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     if (gifRecording)
     {
@@ -951,18 +2024,79 @@ void CloseWindow(void)
     }
 #endif
 
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
-    UnloadFontDefault();        // WARNING: Module required: rtext
+#if defined(SUPPORT_DATA_STORAGE)
+    FlushStorage();             // Commit pending storage changes (before job system is closed)
+    UnloadStorage();
 #endif
 
-    rlglClose();                // De-init rlgl
+#if defined(SUPPORT_JOB_SYSTEM)
+    CloseJobSystem();           // Stop job system workers, remaining jobs run now (before GPU resources are released)
+#endif
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    glfwDestroyWindow(CORE.Window.handle);
-    glfwTerminate();
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    CloseAssetWatch();          // Stop watching assets, pending reloads cancelled
 #endif
 
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+#if defined(SUPPORT_RESOURCE_CACHE)
+    CloseResourceCache();       // Release cached resources entries (resources not unloaded are leaked)
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    CloseAsyncJobs();           // Stop async load workers (before GPU resources are released)
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_STREAMING)
+    UnloadTextureStreaming();   // WARNING: Module required: rtextures
+#endif
+
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    DisablePartialRedraw();     // Unload partial redraw target (before render textures pool)
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadRenderTexturePool();  // WARNING: Module required: rtextures
+    UnloadTextureTiledShader(); // WARNING: Module required: rtextures
+    UnloadSpriteInstancesShader();  // WARNING: Module required: rtextures
+    UnloadTextureIBLShaders();  // WARNING: Module required: rtextures
+    UnloadTexturePatternShaders();  // WARNING: Module required: rtextures
+    UnloadVideoStreamShader();  // WARNING: Module required: rtextures
+    UnloadLowResEffectsShaders();   // WARNING: Module required: rtextures
+    UnloadTextureUploadBuffer(); // WARNING: Module required: rtextures
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+    UnloadFontDefault();        // WARNING: Module required: rtext
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadSkinningData();       // WARNING: Module required: rmodels
+    UnloadRenderQueue();        // WARNING: Module required: rmodels
+    UnloadVoxelShader();        // WARNING: Module required: rmodels
+    UnloadTilemapShader();      // WARNING: Module required: rmodels
+    UnloadParticlesShaders();   // WARNING: Module required: rmodels
+    UnloadBillboardsShader();   // WARNING: Module required: rmodels
+    UnloadDebugDraw();          // WARNING: Module required: rmodels
+    UnloadLighting();           // WARNING: Module required: rmodels
+#endif
+
+#if defined(SUPPORT_SHADER_REFLECTION)
+    UnloadShaderReflections();  // Unload shaders reflections (not unloaded shaders)
+#endif
+
+#if defined(SUPPORT_FRAME_HISTORY) && defined(SUPPORT_PROFILING_ZONES)
+    if (CORE.FrameHistory.hitchThreshold > 0.0f) StopProfileHistory();
+#endif
+
+    rlglClose();                // De-init rlgl
+
+    UnloadScratchMemory();      // Unload main thread scratch memory
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
+    glfwDestroyWindow(CORE.Window.handle);
+    glfwTerminate();
+#endif
+
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
     timeEndPeriod(1);           // Restore time period
 #endif
 
@@ -989,6 +2123,22 @@ void CloseWindow(void)
     }
 #endif
 
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    // Close surface, context and display, default native window is owned by the system
+    if (CORE.Nx.eglDisplay != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(CORE.Nx.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (CORE.Nx.eglContext != EGL_NO_CONTEXT) eglDestroyContext(CORE.Nx.eglDisplay, CORE.Nx.eglContext);
+        if (CORE.Nx.eglSurface != EGL_NO_SURFACE) eglDestroySurface(CORE.Nx.eglDisplay, CORE.Nx.eglSurface);
+
+        eglTerminate(CORE.Nx.eglDisplay);
+        CORE.Nx.eglDisplay = EGL_NO_DISPLAY;
+        CORE.Nx.eglSurface = EGL_NO_SURFACE;
+        CORE.Nx.eglContext = EGL_NO_CONTEXT;
+    }
+#endif
+
 #if defined(PLATFORM_DRM)
     if (CORE.Window.prevFB)
     {
@@ -1080,10 +2230,57 @@ void CloseWindow(void)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    free(events);
+    if (eventsPlaying) StopAutomationEventsReplay();
+    eventsRecording = false;
+
+    RL_FREE(events);
+    events = NULL;
+    eventCount = 0;
+    eventCapacity = 0;
 #endif
 
 #if defined(PLATFORM_NX)
+#if defined(SUPPORT_NX_HID_INPUT)
+    CloseNxInput();
+#endif
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    // Clocks must be restored before exit, they are not reset by the system on application exit
+    CORE.Nx.loadingBoost = 0;
+    SetClockProfile(CLOCK_PROFILE_DEFAULT);
+    if (CORE.Nx.apmReady) apmExit();
+    CORE.Nx.apmReady = false;
+#endif
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+    // NOTE: Screen capture jobs were finished by UnloadScreenCapture(), video recording memory is released on exit
+    if (CORE.Nx.albumReady) capssuExit();
+    CORE.Nx.albumReady = false;
+#endif
+    appletUnhook(&CORE.Nx.hookCookie);
+
+    if (CORE.Nx.vsyncReady)
+    {
+        eventClose(&CORE.Nx.vsyncEvent);
+        viCloseDisplay(&CORE.Nx.display);
+        CORE.Nx.vsyncReady = false;
+    }
+    viExit();
+
+    romfsExit();
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    appletUnlockExit();         // Application can be closed by the system now
+#endif
+#endif
+
+#if defined(PLATFORM_3DS)
+    c3dglDestroyContext();      // Retired GPU resources are released, render targets are not owned by the context
+    if (CORE.N3ds.targetRight != NULL) C3D_RenderTargetDelete(CORE.N3ds.targetRight);
+    C3D_RenderTargetDelete(CORE.N3ds.target);
+    CORE.N3ds.targetRight = NULL;
+    CORE.N3ds.target = NULL;
+    CORE.N3ds.stereo = false;
+    C3D_Fini();
+    gfxExit();
+
     romfsExit();
 #endif
 
@@ -1104,7 +2301,7 @@ bool WindowShouldClose(void)
     return false;
 #endif
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(NX_USE_GLFW)
     if (CORE.Window.ready)
     {
         // While window minimized, stop loop execution
@@ -1120,10 +2317,16 @@ bool WindowShouldClose(void)
     else return true;
 #endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(SUPPORT_NX_NATIVE_PLATFORM)
     if (CORE.Window.ready) return CORE.Window.shouldClose;
     else return true;
 #endif
+
+#if defined(PLATFORM_3DS)
+    // NOTE: aptMainLoop() returns false when the system requests the application to exit (HOME menu close, power off)
+    if (CORE.Window.ready) return (CORE.Window.shouldClose || !aptMainLoop());
+    else return true;
+#endif
 }
 
 // Check if window has been initialized successfully
@@ -1170,13 +2373,74 @@ bool IsWindowMaximized(void)
 // Check if window has the focus
 bool IsWindowFocused(void)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
     return ((CORE.Window.flags & FLAG_WINDOW_UNFOCUSED) == 0);
 #else
     return true;
 #endif
 }
 
+// Set window focus changes callback
+// NOTE: On PLATFORM_NX callback is called before suspending on focus lost, state could be saved there
+void SetWindowFocusCallback(FocusCallback callback)
+{
+    CORE.Window.focusCallback = callback;
+}
+
+// Check if console is docked (only PLATFORM_NX)
+bool IsWindowDocked(void)
+{
+#if defined(PLATFORM_NX)
+    return (CORE.Nx.operationMode == AppletOperationMode_Console);
+#else
+    return false;
+#endif
+}
+
+// Set CPU/GPU clocks profile (only PLATFORM_NX)
+// NOTE: Power saving profile sets lower clocks performance configurations (handheld and docked),
+// boost profile keeps CPU boost mode enabled (CPU clock raised, GPU clock lowered), intended for loading screens
+void SetClockProfile(int profile)
+{
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    if ((profile < CLOCK_PROFILE_DEFAULT) || (profile > CLOCK_PROFILE_BOOST)) return;
+
+    CORE.Nx.clockProfile = profile;
+
+    if (CORE.Nx.apmReady)
+    {
+        bool saving = (profile == CLOCK_PROFILE_POWER_SAVING);
+
+        apmSetPerformanceConfiguration(ApmPerformanceMode_Normal, saving? NX_CLOCK_POWER_SAVING_HANDHELD : CORE.Nx.defaultConfig[0]);
+        apmSetPerformanceConfiguration(ApmPerformanceMode_Boost, saving? NX_CLOCK_POWER_SAVING_DOCKED : CORE.Nx.defaultConfig[1]);
+    }
+
+    UpdateCpuBoost();
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    CORE.Resolution.gpuTime = 0.0;      // GPU clock changed, previous measures not valid
+#endif
+#endif
+}
+
+// Begin loading boost scope, CPU boost mode is enabled while loading (only PLATFORM_NX)
+// NOTE: Scopes can be nested, LoadModel(), LoadTexture() and shaders loading use them internally
+void BeginLoadingBoost(void)
+{
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    CORE.Nx.loadingBoost++;
+    UpdateCpuBoost();
+#endif
+}
+
+// End loading boost scope, CPU boost mode is released on EndDrawing() once all scopes are ended
+void EndLoadingBoost(void)
+{
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    if (CORE.Nx.loadingBoost > 0) CORE.Nx.loadingBoost--;
+#endif
+}
+
 // Check if window has been resizedLastFrame
 bool IsWindowResized(void)
 {
@@ -1350,7 +2614,7 @@ void RestoreWindow(void)
 // Set window configuration state using flags
 void SetWindowState(unsigned int flags)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(NX_USE_GLFW)
     // Check previous state and requested state to apply required changes
     // NOTE: In most cases the functions already change the flags internally
 
@@ -1447,13 +2711,20 @@ void SetWindowState(unsigned int flags)
     {
         TRACELOG(LOG_WARNING, "RPI: Interlaced mode can only by configured before window initialization");
     }
+#elif defined(SUPPORT_NX_NATIVE_PLATFORM)
+    // NOTE: Native window is always fullscreen, only vsync state can be changed
+    if (((CORE.Window.flags & FLAG_VSYNC_HINT) != (flags & FLAG_VSYNC_HINT)) && ((flags & FLAG_VSYNC_HINT) > 0))
+    {
+        SetSwapInterval(1);
+        CORE.Window.flags |= FLAG_VSYNC_HINT;
+    }
 #endif
 }
 
 // Clear window configuration state flags
 void ClearWindowState(unsigned int flags)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(NX_USE_GLFW)
     // Check previous state and requested state to apply required changes
     // NOTE: In most cases the functions already change the flags internally
 
@@ -1548,6 +2819,13 @@ void ClearWindowState(unsigned int flags)
     {
         TRACELOG(LOG_WARNING, "RPI: Interlaced mode can only by configured before window initialization");
     }
+#elif defined(SUPPORT_NX_NATIVE_PLATFORM)
+    // NOTE: Native window is always fullscreen, only vsync state can be changed
+    if (((CORE.Window.flags & FLAG_VSYNC_HINT) > 0) && ((flags & FLAG_VSYNC_HINT) > 0))
+    {
+        SetSwapInterval(0);
+        CORE.Window.flags &= ~FLAG_VSYNC_HINT;
+    }
 #endif
 }
 
@@ -1943,6 +3221,166 @@ RLAPI void DisableEventWaiting(void)
     CORE.Window.eventWaiting = false;
 }
 
+// Enable partial redraw, frame drawing is recorded and only changed screen area is redrawn
+// NOTE: Screen buffers are not swapped if nothing changed, combined with EnableEventWaiting()
+// static screens do not use GPU, drawing must be done by raylib/rlgl calls (no direct GL calls)
+void EnablePartialRedraw(void)
+{
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (CORE.RenderThread.enabled)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Partial redraw not supported with render thread enabled");
+        return;
+    }
+#endif
+    if (CORE.Redraw.list == NULL) CORE.Redraw.list = rlLoadCommandList(0);
+    CORE.Redraw.valid = false;
+
+    if (CORE.Redraw.list == NULL) TRACELOG(LOG_WARNING, "DISPLAY: Partial redraw not supported (command lists not available)");
+#else
+    TRACELOG(LOG_WARNING, "DISPLAY: Partial redraw not supported (SUPPORT_PARTIAL_REDRAW)");
+#endif
+}
+
+// Disable partial redraw, full frame drawn every frame
+void DisablePartialRedraw(void)
+{
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (CORE.Redraw.list == NULL) return;
+
+    // Frame drawing recorded until now is drawn as usual
+    if (CORE.Redraw.recording)
+    {
+        rlEndCommandList();
+        CORE.Redraw.recording = false;
+        rlSubmitCommandList(CORE.Redraw.list);
+    }
+
+    rlUnloadCommandList(CORE.Redraw.list);
+    if (CORE.Redraw.target.id > 0) UnloadRenderTexture(CORE.Redraw.target);
+    RL_FREE(CORE.Redraw.tiles[0]);
+    RL_FREE(CORE.Redraw.tiles[1]);
+
+    memset(&CORE.Redraw, 0, sizeof(CORE.Redraw));
+#endif
+}
+
+// Enable render thread (pipelined rendering), frame drawing is recorded on main thread and a render thread
+// owning GL context draws and presents it while main thread builds next frame (one frame latency)
+// NOTE: GL context is only current on main thread on EndDrawing() frame end work, GL resources must be loaded
+// and unloaded with main thread jobs or async loading (or with render thread disabled), drawing must be done
+// by raylib/rlgl calls (no direct GL calls), shader uniforms set with SetShaderValue*() are recorded
+void EnableRenderThread(void)
+{
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (CORE.RenderThread.enabled) return;
+
+    if (CORE.Redraw.list != NULL)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Render thread not supported with partial redraw enabled");
+        return;
+    }
+
+    CORE.RenderThread.lists[0] = rlLoadCommandList(0);
+    CORE.RenderThread.lists[1] = rlLoadCommandList(0);
+
+    if ((CORE.RenderThread.lists[0] == NULL) || (CORE.RenderThread.lists[1] == NULL))
+    {
+        rlUnloadCommandList(CORE.RenderThread.lists[0]);
+        rlUnloadCommandList(CORE.RenderThread.lists[1]);
+        memset(&CORE.RenderThread, 0, sizeof(CORE.RenderThread));
+
+        TRACELOG(LOG_WARNING, "DISPLAY: Render thread not supported (command lists not available)");
+        return;
+    }
+
+    rlDrawRenderBatchActive();          // Drawing done before enabling is drawn on main thread
+
+    JOB_MUTEX_INIT(&CORE.RenderThread.lock);
+    JOB_CONDITION_INIT(&CORE.RenderThread.signal);
+    CORE.RenderThread.pending = NULL;
+    CORE.RenderThread.running = true;
+
+    SetGraphicsContextCurrent(false);   // GL context can only be current on one thread
+
+    bool created = false;
+#if defined(PLATFORM_NX)
+    // Render thread runs on core 1 above job workers priority (0x2B), so frames are not delayed by jobs
+    created = R_SUCCEEDED(threadCreate(&CORE.RenderThread.thread, RenderThreadLoop, NULL, NULL, 0x40000, 0x2B, 1));
+    if (created && R_FAILED(threadStart(&CORE.RenderThread.thread)))
+    {
+        threadClose(&CORE.RenderThread.thread);
+        created = false;
+    }
+#else
+    created = (pthread_create(&CORE.RenderThread.thread, NULL, RenderThreadLoop, NULL) == 0);
+#endif
+
+    if (!created)
+    {
+        SetGraphicsContextCurrent(true);
+
+        JOB_MUTEX_DESTROY(&CORE.RenderThread.lock);
+        JOB_CONDITION_DESTROY(&CORE.RenderThread.signal);
+        rlUnloadCommandList(CORE.RenderThread.lists[0]);
+        rlUnloadCommandList(CORE.RenderThread.lists[1]);
+        memset(&CORE.RenderThread, 0, sizeof(CORE.RenderThread));
+
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create render thread");
+        return;
+    }
+
+    // Drawing is recorded from now on, including render textures drawing before BeginDrawing()
+    CORE.RenderThread.enabled = true;
+    CORE.RenderThread.current = 0;
+    rlBeginCommandList(CORE.RenderThread.lists[0]);
+    CORE.RenderThread.recording = true;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Render thread enabled successfully");
+#else
+    TRACELOG(LOG_WARNING, "DISPLAY: Render thread not supported (SUPPORT_RENDER_THREAD)");
+#endif
+}
+
+// Disable render thread, frames drawn and presented on main thread
+// NOTE: Pending frame is presented by render thread before it quits, drawing recorded since is drawn as usual
+void DisableRenderThread(void)
+{
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (!CORE.RenderThread.enabled) return;
+
+    if (CORE.RenderThread.recording)
+    {
+        rlEndCommandList();
+        CORE.RenderThread.recording = false;
+    }
+
+    JOB_MUTEX_LOCK(&CORE.RenderThread.lock);
+    CORE.RenderThread.running = false;
+    JOB_CONDITION_BROADCAST(&CORE.RenderThread.signal);
+    JOB_MUTEX_UNLOCK(&CORE.RenderThread.lock);
+
+#if defined(PLATFORM_NX)
+    threadWaitForExit(&CORE.RenderThread.thread);
+    threadClose(&CORE.RenderThread.thread);
+#else
+    pthread_join(CORE.RenderThread.thread, NULL);
+#endif
+
+    SetGraphicsContextCurrent(true);
+    rlSubmitCommandList(CORE.RenderThread.lists[CORE.RenderThread.current]);
+
+    JOB_MUTEX_DESTROY(&CORE.RenderThread.lock);
+    JOB_CONDITION_DESTROY(&CORE.RenderThread.signal);
+    rlUnloadCommandList(CORE.RenderThread.lists[0]);
+    rlUnloadCommandList(CORE.RenderThread.lists[1]);
+    memset(&CORE.RenderThread, 0, sizeof(CORE.RenderThread));
+
+    TRACELOG(LOG_INFO, "DISPLAY: Render thread disabled");
+#endif
+}
+
 // Get clipboard text content
 // NOTE: returned string is allocated and freed by GLFW
 const char *GetClipboardText(void)
@@ -2019,6 +3457,10 @@ bool IsCursorOnScreen(void)
 // Set background color (framebuffer clear color)
 void ClearBackground(Color color)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_CLEAR_BACKGROUND, &color, sizeof(Color))) return;
+#endif
+
     rlClearColor(color.r, color.g, color.b, color.a);   // Set clear color
     rlClearScreenBuffers();                             // Clear current framebuffers
 }
@@ -2033,9 +3475,29 @@ void BeginDrawing(void)
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+#if defined(RENDER_THREAD_SUPPORTED)
+    // Frame render counters and 2d depth ordering are reset by render thread, drawing is being recorded
+    if (!CORE.RenderThread.enabled)
+#endif
+    rlBeginFrameStats(CORE.Time.current);   // Reset frame render counters, start GPU timing
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
 
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (!CORE.RenderThread.enabled)
+#endif
+    rlResetDepthOrdering2D();           // Restart 2d depth ordering (if enabled)
+
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Frame drawing is recorded, damaged area is redrawn on EndDrawing()
+    if (CORE.Redraw.list != NULL)
+    {
+        rlBeginCommandList(CORE.Redraw.list);
+        CORE.Redraw.recording = true;
+    }
+#endif
+
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
 }
@@ -2043,6 +3505,10 @@ void BeginDrawing(void)
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (CORE.Redraw.recording) CORE.Redraw.damaged = DrawPartialRedraw();
+#endif
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
 #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MOUSE_CURSOR_POINT)
@@ -2054,6 +3520,15 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // Read screen for requested screenshot (before record indicators are drawn)
+    if (captureFileName[0] != '\0')
+    {
+        ReadScreenCapture(SCREEN_CAPTURE_IMAGE, captureFileName);
+        captureFileName[0] = '\0';
+    }
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
@@ -2064,6 +3539,10 @@ void EndDrawing(void)
         // NOTE: We record one gif frame every 10 game frames
         if ((gifFrameCounter%GIF_RECORD_FRAMERATE) == 0)
         {
+        #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+            // Get image data for the current frame, collected next frame and encoded on worker thread
+            ReadScreenCapture(SCREEN_CAPTURE_GIF_FRAME, NULL);
+        #else
             // Get image data for the current frame (from backbuffer)
             // NOTE: This process is quite slow... :(
             Vector2 scale = GetWindowScaleDPI();
@@ -2071,6 +3550,7 @@ void EndDrawing(void)
             msf_gif_frame(&gifState, screenData, 10, 16, CORE.Window.render.width*scale.x*4);
 
             RL_FREE(screenData);    // Free image data
+        #endif
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -2113,7 +3593,88 @@ void EndDrawing(void)
     }
 #endif
 
+#if defined(RENDER_THREAD_SUPPORTED)
+    // Frame end GL work runs on main thread, once render thread is done with previous frame
+    if (CORE.RenderThread.enabled) FinishRenderThreadFrame();
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UpdateRenderTexturePool();          // Recycle transient render textures, unload idle ones
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_TEXTURE_STREAMING)
+    UpdateTextureStreaming();           // Request and evict streamed textures mipmaps for frame usage
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS) && defined(SUPPORT_OCCLUSION_CULLING) && !defined(GRAPHICS_API_OPENGL_11)
+    UpdateOcclusionCulling();           // Advance occlusion culling frame, evict draws not tested recently
+#endif
+
+#if defined(SUPPORT_MODULE_RMODELS) && defined(SUPPORT_SKINNING_CACHE) && defined(GRAPHICS_API_OPENGL_43)
+    UpdateSkinningCache();              // Advance skinning cache frame, release buffers not drawn recently
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    UpdateScreenCapture();              // Collect previous frame screen readback, submit encoding jobs
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    UpdateAssetWatch();                 // Check watched assets files, submit reload jobs
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    ProcessAsyncJobs();                 // Run async load jobs upload stage (within frame budget)
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    UpdateMemoryStats();                // Update memory stats frame allocations/frees counters
+#endif
+
+    ResetScratchMemory();               // Rewind main thread scratch memory, frame temporaries expire
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    RunMainThreadJobs();                // Run main thread only jobs queued (GL work)
+#endif
+
+    rlProcessDeferredUnloads();         // Delete unloaded GPU objects once GPU is done with them, fence this frame unloads
+
+#if defined(SUPPORT_DATA_STORAGE)
+    UpdateStorage();                    // Commit storage changes once idle (write-behind)
+#endif
+
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+    UpdateCpuBoost();                   // Loading boost is released on frame end, so loading bursts keep clocks boosted
+#endif
+
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (!CORE.RenderThread.enabled)     // Frame render counters are measured by render thread
+#endif
+    rlEndFrameStats(GetTime());         // Stop frame render counters and GPU timing
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    UpdateDynamicResolution();          // Scale next frames dynamic resolution target to fit GPU budget
+#endif
+
+#if defined(RENDER_THREAD_SUPPORTED)
+    // Frame is drawn and presented by render thread, main thread continues with next frame
+    if (CORE.RenderThread.enabled) SubmitRenderThreadFrame();
+#endif
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+#if defined(PLATFORM_NX)
+    double workTime = CORE.Time.update + (GetTime() - CORE.Time.previous);   // Frame work before present (update + draw)
+#endif
+
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (!CORE.RenderThread.enabled)
+#endif
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Previous frame is kept on screen if frame has no damage
+    if ((CORE.Redraw.list == NULL) || CORE.Redraw.damaged)
+#endif
+#if defined(PLATFORM_NX)
+    if (!CORE.Nx.suspended)             // Frames are not presented while application is out of focus
+#endif
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
     // Frame time control system
@@ -2123,8 +3684,31 @@ void EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
+    bool uncapped = false;
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    uncapped = eventsPlaying;   // Events replay runs at uncapped frame rate
+#endif
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    uncapped = true;            // Headless mode runs at uncapped frame rate, no display to pace frames
+#endif
+
+#if defined(PLATFORM_NX)
+    // Out of focus, loop is throttled to background frame rate
+    if (CORE.Nx.suspended)
+    {
+        double target = 1.0/NX_BACKGROUND_FPS;
+        if (CORE.Time.frame < target) WaitTime((float)(target - CORE.Time.frame)*1000.0f);
+
+        CORE.Time.current = GetTime();
+        CORE.Time.frame += CORE.Time.current - CORE.Time.previous;
+        CORE.Time.previous = CORE.Time.current;
+    }
+    // Vsync pacing modes, frames cadence is set by buffers swap interval
+    else if ((CORE.Time.pacing != FRAME_PACING_TIMER) && !uncapped) WaitFramePacing(workTime);
+    else
+#endif
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    if ((CORE.Time.frame < CORE.Time.target) && !uncapped)
     {
         WaitTime((float)(CORE.Time.target - CORE.Time.frame)*1000.0f);
 
@@ -2139,14 +3723,18 @@ void EndDrawing(void)
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-    // Events recording and playing logic
-    if (eventsRecording) RecordAutomationEvent(CORE.Time.frameCounter);
-    else if (eventsPlaying)
-    {
-        // TODO: When should we play? After/before/replace PollInputEvents()?
-        if (CORE.Time.frameCounter >= eventCount) eventsPlaying = false;
-        PlayAutomationEvent(CORE.Time.frameCounter);
-    }
+    UpdateAutomationEvents();   // Events recording and replay, recorded input replaces polled input
+#endif
+
+#if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    // Fixed simulation steps for last frame time, with input just polled
+    if (CORE.Simulation.step > 0.0) UpdateFixedSimulation(GetFrameTime());
+#endif
+
+    RL_PROFILE_FRAME_MARK();
+
+#if defined(SUPPORT_FRAME_HISTORY)
+    UpdateFrameHistory();       // Record frame timing, hitch frame zones are already captured (frame mark)
 #endif
 
     CORE.Time.frameCounter++;
@@ -2178,6 +3766,10 @@ void EndMode2D(void)
 // Initializes 3D mode with custom camera (3D)
 void BeginMode3D(Camera3D camera)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_BEGIN_MODE_3D, &camera, sizeof(Camera3D))) return;
+#endif
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
@@ -2217,6 +3809,10 @@ void BeginMode3D(Camera3D camera)
 // Ends 3D mode and returns to default 2D orthographic mode
 void EndMode3D(void)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_END_MODE_3D, NULL, 0)) return;
+#endif
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
@@ -2228,14 +3824,29 @@ void EndMode3D(void)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
 
     rlDisableDepthTest();           // Disable DEPTH_TEST for 2D
+    rlResetDepthOrdering2D();       // Clear 3D depth values for 2D depth ordering (if enabled)
 }
 
 // Initializes render texture for drawing
 void BeginTextureMode(RenderTexture2D target)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_BEGIN_TEXTURE_MODE, &target, sizeof(RenderTexture2D))) return;
+#endif
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Redraw target scissor is not applied to other render targets
+    if (CORE.Redraw.targetActive)
+    {
+        rlDisableDrawScissor();
+        CORE.Redraw.targetActive = false;
+    }
+#endif
+
     rlEnableFramebuffer(target.id); // Enable render target
+    rlResetDepthOrdering2D();       // Restart 2D depth ordering on render target (if enabled)
 
     // Set viewport and RLGL internal framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -2263,11 +3874,25 @@ void BeginTextureMode(RenderTexture2D target)
 // Ends drawing to render texture
 void EndTextureMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_END_TEXTURE_MODE, NULL, 0)) return;
+#endif
 
-    rlDisableFramebuffer();         // Disable render target (fbo)
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
 
-    // Set viewport to default framebuffer size
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Frame drawing replayed on redraw target continues on it
+    if (CORE.Redraw.drawing)
+    {
+        BeginPartialRedrawTarget();
+        return;
+    }
+#endif
+
+    rlDisableFramebuffer();         // Disable render target (fbo)
+    rlResetDepthOrdering2D();       // Restart 2D depth ordering on screen (if enabled)
+
+    // Set viewport to default framebuffer size
     SetupViewport(CORE.Window.render.width, CORE.Window.render.height);
 
     // Reset current fbo to screen size
@@ -2278,12 +3903,24 @@ void EndTextureMode(void)
 // Begin custom shader mode
 void BeginShaderMode(Shader shader)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    Shader params;
+    memset(&params, 0, sizeof(Shader));     // Recorded data is hashed, padding must be zero
+    params.id = shader.id;
+    params.locs = shader.locs;
+    if (RecordRedrawCall(REDRAW_BEGIN_SHADER_MODE, &params, sizeof(Shader))) return;
+#endif
+
     rlSetShader(shader.id, shader.locs);
 }
 
 // End custom shader mode (returns to default shader)
 void EndShaderMode(void)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_END_SHADER_MODE, NULL, 0)) return;
+#endif
+
     rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 }
 
@@ -2291,12 +3928,20 @@ void EndShaderMode(void)
 // NOTE: Blend modes supported are enumerated in BlendMode enum
 void BeginBlendMode(int mode)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_BEGIN_BLEND_MODE, &mode, sizeof(int))) return;
+#endif
+
     rlSetBlendMode(mode);
 }
 
 // End blending mode (reset to default: alpha blending)
 void EndBlendMode(void)
 {
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_END_BLEND_MODE, NULL, 0)) return;
+#endif
+
     rlSetBlendMode(BLEND_ALPHA);
 }
 
@@ -2304,22 +3949,33 @@ void EndBlendMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void BeginScissorMode(int x, int y, int width, int height)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    int rec[4] = { x, y, width, height };
+    if (RecordRedrawCall(REDRAW_BEGIN_SCISSOR_MODE, rec, 4*sizeof(int))) return;
+#endif
 
-    rlEnableScissorTest();
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Scissor area is limited to damage area on redraw target
+    if (CORE.Redraw.targetActive)
+    {
+        SetPartialRedrawScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
+        return;
+    }
+#endif
 
+    // NOTE: Scissor rect is recorded by render batch draws (RLGL_ENABLE_BATCH_DRAW_STATE), batch is not flushed
 #if defined(__APPLE__)
     Vector2 scale = GetWindowScaleDPI();
-    rlScissor((int)(x*scale.x), (int)(GetScreenHeight()*scale.y - (((y + height)*scale.y))), (int)(width*scale.x), (int)(height*scale.y));
+    rlEnableDrawScissor((int)(x*scale.x), (int)(GetScreenHeight()*scale.y - (((y + height)*scale.y))), (int)(width*scale.x), (int)(height*scale.y));
 #else
     if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0)
     {
         Vector2 scale = GetWindowScaleDPI();
-        rlScissor((int)(x*scale.x), (int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (int)(width*scale.x), (int)(height*scale.y));
+        rlEnableDrawScissor((int)(x*scale.x), (int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (int)(width*scale.x), (int)(height*scale.y));
     }
     else
     {
-        rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
+        rlEnableDrawScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
     }
 #endif
 }
@@ -2327,8 +3983,48 @@ void BeginScissorMode(int x, int y, int width, int height)
 // End scissor mode
 void EndScissorMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
-    rlDisableScissorTest();
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (RecordRedrawCall(REDRAW_END_SCISSOR_MODE, NULL, 0)) return;
+#endif
+
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+    // Damage area scissor is kept on redraw target
+    if (CORE.Redraw.targetActive)
+    {
+        SetPartialRedrawScissor(CORE.Redraw.damage[0], CORE.Redraw.damage[1], CORE.Redraw.damage[2], CORE.Redraw.damage[3]);
+        return;
+    }
+#endif
+
+    rlDisableDrawScissor();
+}
+
+// Begin opaque drawing mode
+// NOTE: Following drawing must be fully opaque (no transparent pixels), with 2D depth ordering
+// enabled it is drawn front-to-back writing depth and hides any drawing below it
+void BeginOpaqueMode(void)
+{
+    rlSetDrawOpaque(true);
+}
+
+// End opaque drawing mode
+void EndOpaqueMode(void)
+{
+    rlSetDrawOpaque(false);
+}
+
+// Enable 2D depth ordering
+// NOTE: Drawing hidden by opaque drawing (BeginOpaqueMode()) is rejected by depth test before shading,
+// it reduces overdraw on layered 2D scenes, depth buffer is cleared on every frame and render target change
+void EnableDepthOrdering2D(void)
+{
+    rlEnableDepthOrdering2D();
+}
+
+// Disable 2D depth ordering
+void DisableDepthOrdering2D(void)
+{
+    rlDisableDepthOrdering2D();
 }
 
 // Begin VR drawing configuration
@@ -2347,6 +4043,128 @@ void EndVrStereoMode(void)
     rlDisableStereoRender();
 }
 
+// Begin drawing to render texture scaled by GPU frame time
+// NOTE: Screen coordinates are kept, 2D drawing is also scaled, intended for 3D scene drawing
+// WARNING: Can not be nested with BeginTextureMode()
+void BeginDynamicResolutionMode(void)
+{
+#if defined(SUPPORT_DYNAMIC_RESOLUTION) && defined(SUPPORT_MODULE_RTEXTURES)
+    CORE.Resolution.used = true;
+    CORE.Resolution.target.id = 0;
+
+    // NOTE: Size is aligned to 16 pixels to limit the number of different pooled render textures
+    int width = ((int)(CORE.Window.render.width*CORE.Resolution.scale)/16)*16;
+    int height = ((int)(CORE.Window.render.height*CORE.Resolution.scale)/16)*16;
+
+    if (width < 16) width = 16;
+    if (height < 16) height = 16;
+
+    // Full size, just draw to default framebuffer
+    if ((width >= (int)CORE.Window.render.width) && (height >= (int)CORE.Window.render.height)) return;
+
+    CORE.Resolution.target = GetRenderTextureTransient(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, true);   // WARNING: Module required: rtextures
+    if (CORE.Resolution.target.id == 0) return;
+
+    SetTextureFilter(CORE.Resolution.target.texture, TEXTURE_FILTER_BILINEAR);    // WARNING: Module required: rtextures
+    BeginTextureMode(CORE.Resolution.target);
+
+    // Keep screen coordinates for 2D drawing
+    rlMatrixMode(RL_PROJECTION);
+    rlLoadIdentity();
+    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+    rlMatrixMode(RL_MODELVIEW);
+    rlLoadIdentity();
+#endif
+}
+
+// Ends dynamic resolution drawing, render texture upscaled to screen
+void EndDynamicResolutionMode(void)
+{
+#if defined(SUPPORT_DYNAMIC_RESOLUTION) && defined(SUPPORT_MODULE_RTEXTURES)
+    if (CORE.Resolution.target.id == 0) return;
+
+    EndTextureMode();
+
+    // Upscale render texture to screen, it replaces framebuffer content (no blending)
+    Texture2D texture = CORE.Resolution.target.texture;
+    rlDisableColorBlend();
+    DrawTexturePro(texture, (Rectangle){ 0, 0, (float)texture.width, (float)-texture.height },
+        (Rectangle){ 0, 0, (float)CORE.Window.render.width, (float)CORE.Window.render.height }, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);    // WARNING: Module required: rtextures
+    rlDrawRenderBatchActive();
+    rlEnableColorBlend();
+
+    ReleaseRenderTextureTransient(CORE.Resolution.target);
+    CORE.Resolution.target.id = 0;
+#endif
+}
+
+// Set dynamic resolution scale limits (relative to framebuffer size)
+void SetDynamicResolutionLimits(float minScale, float maxScale)
+{
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    if (minScale < 0.1f) minScale = 0.1f;
+    if (maxScale > 1.0f) maxScale = 1.0f;
+    if (maxScale < minScale) maxScale = minScale;
+
+    CORE.Resolution.minScale = minScale;
+    CORE.Resolution.maxScale = maxScale;
+
+    if (CORE.Resolution.scale < minScale) CORE.Resolution.scale = minScale;
+    if (CORE.Resolution.scale > maxScale) CORE.Resolution.scale = maxScale;
+#endif
+}
+
+// Get current dynamic resolution scale
+float GetDynamicResolutionScale(void)
+{
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    return CORE.Resolution.scale;
+#else
+    return 1.0f;
+#endif
+}
+
+// Load draw list
+// NOTE: Draw list is a rlgl command list, recorded vertex storage grows if required
+DrawList *LoadDrawList(void)
+{
+    return (DrawList *)rlLoadCommandList(0);
+}
+
+// Unload draw list
+void UnloadDrawList(DrawList *list)
+{
+    rlUnloadCommandList((rlCommandList *)list);
+}
+
+// Begin recording draw list
+// NOTE: Recording is done by calling thread, list GPU vertex buffer is updated on next draw
+void BeginDrawList(DrawList *list)
+{
+    rlBeginCommandList((rlCommandList *)list);
+}
+
+// End recording draw list
+void EndDrawList(void)
+{
+    rlEndCommandList();
+}
+
+// Draw recorded draw list at position with tint
+void DrawDrawList(DrawList *list, Vector2 position, Color tint)
+{
+    DrawDrawListEx(list, MatrixTranslate(position.x, position.y, 0.0f), tint);
+}
+
+// Draw recorded draw list with transform and tint
+// NOTE: List vertex are not sent again, transform and tint are applied by shader
+void DrawDrawListEx(DrawList *list, Matrix transform, Color tint)
+{
+    float color[4] = { (float)tint.r/255.0f, (float)tint.g/255.0f, (float)tint.b/255.0f, (float)tint.a/255.0f };
+
+    rlDrawCommandList((rlCommandList *)list, transform, color);
+}
+
 // Load VR stereo config for VR simulator device parameters
 VrStereoConfig LoadVrStereoConfig(VrDeviceInfo device)
 {
@@ -2433,6 +4251,14 @@ Shader LoadShader(const char *vsFileName, const char *fsFileName)
 {
     Shader shader = { 0 };
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Shader is cached by both files paths, missing file path is kept empty
+    char key[1040] = { 0 };
+    snprintf(key, sizeof(key), "%s|%s", (vsFileName != NULL)? vsFileName : "", (fsFileName != NULL)? fsFileName : "");
+
+    if (LoadCachedResource(RESOURCE_SHADER, key, &shader, sizeof(Shader))) return shader;
+#endif
+
     char *vShaderStr = NULL;
     char *fShaderStr = NULL;
 
@@ -2444,6 +4270,14 @@ Shader LoadShader(const char *vsFileName, const char *fsFileName)
     UnloadFileText(vShaderStr);
     UnloadFileText(fShaderStr);
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault())) CacheResource(RESOURCE_SHADER, key, &shader, sizeof(Shader), shader.id);
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    WatchShaderFiles(shader, vsFileName, fsFileName);
+#endif
+
     return shader;
 }
 
@@ -2456,68 +4290,295 @@ RLAPI Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
     // NOTE: All locations must be reseted to -1 (no location)
     for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
+    BeginLoadingBoost();
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+    EndLoadingBoost();
+
+#if defined(SUPPORT_SHADER_REFLECTION)
+    // Reflect active uniforms and attributes, default locations are then found without querying the driver
+    // NOTE: Failed loads return default shader id, its reflection is kept
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault())) LoadShaderReflection(shader.id);
+#endif
 
     // After shader loading, we TRY to set default location names
-    if (shader.id > 0)
-    {
-        // Default shader attribute locations have been binded before linking:
-        //          vertex position location    = 0
-        //          vertex texcoord location    = 1
-        //          vertex normal location      = 2
-        //          vertex color location       = 3
-        //          vertex tangent location     = 4
-        //          vertex texcoord2 location   = 5
-
-        // NOTE: If any location is not found, loc point becomes -1
-
-        // Get handles to GLSL input attibute locations
-        shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-        shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-        shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-        shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-
-        // Get handles to GLSL uniform locations (vertex shader)
-        shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
-        shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
-        shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
-        shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
-
-        // Get handles to GLSL uniform locations (fragment shader)
-        shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
-        shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
-        shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+    if (shader.id > 0) SetShaderDefaultLocations(shader);
+
+    return shader;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load shader from files asynchronously, code files are loaded on a worker thread and program compiled on EndDrawing()
+// NOTE: With parallel shader compilation support, programs are compiled by driver threads and finished once ready,
+// otherwise programs are compiled within async load frame budget, shader is retrieved with GetAsyncShader()
+unsigned int LoadShaderAsync(const char *vsFileName, const char *fsFileName)
+{
+    ShaderLoadJob *job = (ShaderLoadJob *)RL_CALLOC(1, sizeof(ShaderLoadJob));
+
+    if (vsFileName != NULL) strncpy(job->fileName[0], vsFileName, sizeof(job->fileName[0]) - 1);
+    if (fsFileName != NULL) strncpy(job->fileName[1], fsFileName, sizeof(job->fileName[1]) - 1);
+
+    return SubmitAsyncJob(ASYNC_JOB_SHADER, job, DecodeShaderJob, UploadShaderJob);
+}
+
+// Load shader from code strings asynchronously, code strings are copied
+unsigned int LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode)
+{
+    ShaderLoadJob *job = (ShaderLoadJob *)RL_CALLOC(1, sizeof(ShaderLoadJob));
+    const char *code[2] = { vsCode, fsCode };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (code[i] == NULL) continue;
+
+        job->code[i] = (char *)RL_MALLOC(strlen(code[i]) + 1);
+        strcpy(job->code[i], code[i]);
     }
 
+    return SubmitAsyncJob(ASYNC_JOB_SHADER, job, DecodeShaderJob, UploadShaderJob);
+}
+
+// Get shader loaded asynchronously, waits for the load to finish and releases the load handle
+Shader GetAsyncShader(unsigned int handle)
+{
+    Shader shader = { 0 };
+
+    ShaderLoadJob *job = (ShaderLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_SHADER);
+    if (job != NULL) shader = job->shader;
+
+    ReleaseAsyncJob(handle);
+
     return shader;
 }
+#endif
 
 // Unload shader from GPU memory (VRAM)
 void UnloadShader(Shader shader)
 {
     if (shader.id != rlGetShaderIdDefault())
     {
+#if defined(SUPPORT_RESOURCE_CACHE)
+        // NOTE: Cached shader is unloaded with its last reference
+        if (ReleaseCachedResource(RESOURCE_SHADER, shader.id) > 0) return;
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+        UnwatchAsset(ASSET_WATCH_SHADER, shader.id, shader.locs);
+#endif
+#if defined(SUPPORT_SHADER_REFLECTION)
+        UnloadShaderReflection(shader.id);
+#endif
         rlUnloadShaderProgram(shader.id);
         RL_FREE(shader.locs);
     }
 }
 
+// Load shader variants from code template and feature define names
+// NOTE: Code template and feature names are copied, no variant is compiled until requested
+ShaderVariants *LoadShaderVariants(const char *vsCode, const char *fsCode, const char **featureNames, int featureCount)
+{
+    if (featureCount < 0) featureCount = 0;
+    if (featureCount > MAX_SHADER_VARIANT_FEATURES)
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Variants support up to %i features, %i requested", MAX_SHADER_VARIANT_FEATURES, featureCount);
+        featureCount = MAX_SHADER_VARIANT_FEATURES;
+    }
+
+    ShaderVariants *variants = (ShaderVariants *)RL_CALLOC(1, sizeof(ShaderVariants));
+    const char *code[2] = { vsCode, fsCode };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (code[i] == NULL) continue;
+
+        variants->code[i] = (char *)RL_MALLOC(strlen(code[i]) + 1);
+        strcpy(variants->code[i], code[i]);
+    }
+
+    variants->featureCount = featureCount;
+    variants->featureNames = (char **)RL_CALLOC((featureCount > 0)? featureCount : 1, sizeof(char *));
+
+    for (int i = 0; i < featureCount; i++)
+    {
+        const char *name = ((featureNames != NULL) && (featureNames[i] != NULL))? featureNames[i] : "";
+
+        variants->featureNames[i] = (char *)RL_MALLOC(strlen(name) + 1);
+        strcpy(variants->featureNames[i], name);
+    }
+
+    variants->shaders = (Shader *)RL_CALLOC(1 << featureCount, sizeof(Shader));
+
+    return variants;
+}
+
+// Unload shader variants, compiled variants shaders are unloaded
+void UnloadShaderVariants(ShaderVariants *variants)
+{
+    if (variants == NULL) return;
+
+    for (int i = 0; i < (1 << variants->featureCount); i++)
+    {
+        Shader shader = variants->shaders[i];
+        if (shader.locs == NULL) continue;
+
+        // NOTE: Failed variants fall back to default shader program, only their locations are owned
+        if (shader.id != rlGetShaderIdDefault()) UnloadShader(shader);
+        else RL_FREE(shader.locs);
+    }
+
+    for (int i = 0; i < variants->featureCount; i++) RL_FREE(variants->featureNames[i]);
+
+    RL_FREE(variants->featureNames);
+    RL_FREE(variants->shaders);
+    RL_FREE(variants->code[0]);
+    RL_FREE(variants->code[1]);
+    RL_FREE(variants);
+}
+
+// Get shader variant for features bitmask, variant is compiled on first request
+// NOTE: Features bits over variants features count are ignored
+Shader GetShaderVariant(ShaderVariants *variants, unsigned int features)
+{
+    Shader shader = { 0 };
+    if (variants == NULL) return shader;
+
+    features &= (1u << variants->featureCount) - 1;
+
+    if (variants->shaders[features].locs == NULL)
+    {
+        char *vsCode = LoadShaderVariantCode(variants->code[0], variants, features);
+        char *fsCode = LoadShaderVariantCode(variants->code[1], variants, features);
+
+        shader = LoadShaderFromMemory(vsCode, fsCode);
+
+        RL_FREE(vsCode);
+        RL_FREE(fsCode);
+
+        if (shader.id == rlGetShaderIdDefault()) TRACELOG(LOG_WARNING, "SHADER: Failed to compile variant 0x%x, using default shader", features);
+        else TRACELOG(LOG_DEBUG, "SHADER: [ID %i] Variant 0x%x compiled successfully", shader.id, features);
+
+        variants->shaders[features] = shader;
+    }
+
+    return variants->shaders[features];
+}
+
 // Get shader uniform location
+// NOTE: Location is found in shader reflection (hashed), driver is only queried for names not reflected
 int GetShaderLocation(Shader shader, const char *uniformName)
 {
+#if defined(SUPPORT_SHADER_REFLECTION)
+    ShaderReflection *reflection = GetShaderReflection(shader.id);
+
+    if (reflection != NULL)
+    {
+        int entry = GetShaderReflectionEntry(reflection, shader.id, uniformName, false);
+        if (entry >= 0) return reflection->entries[entry].location;
+    }
+#endif
+
     return rlGetLocationUniform(shader.id, uniformName);
 }
 
 // Get shader attribute location
 int GetShaderLocationAttrib(Shader shader, const char *attribName)
 {
+#if defined(SUPPORT_SHADER_REFLECTION)
+    ShaderReflection *reflection = GetShaderReflection(shader.id);
+
+    if (reflection != NULL)
+    {
+        int entry = GetShaderReflectionEntry(reflection, shader.id, attribName, true);
+        if (entry >= 0) return reflection->entries[entry].location;
+    }
+#endif
+
     return rlGetLocationAttrib(shader.id, attribName);
 }
 
+// Get shader uniform handle, used by handle setters (SetShaderUniformFloat()...)
+// NOTE: Uniforms set by raylib on draws (shader default locations) are always uploaded by handle setters
+int GetShaderUniform(Shader shader, const char *uniformName)
+{
+    int uniform = -1;
+
+#if defined(SUPPORT_SHADER_REFLECTION)
+    ShaderReflection *reflection = GetShaderReflection(shader.id);
+
+    if (reflection != NULL)
+    {
+        uniform = GetShaderReflectionEntry(reflection, shader.id, uniformName, false);
+
+        if (uniform >= 0)
+        {
+            ShaderReflectionEntry *entry = &reflection->entries[uniform];
+
+            if (entry->location == -1) uniform = -1;
+            else if (shader.locs != NULL)
+            {
+                for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++)
+                {
+                    if (shader.locs[i] == entry->location) entry->untracked = true;
+                }
+            }
+        }
+    }
+#else
+    // Without reflection, handles are uniforms locations
+    uniform = rlGetLocationUniform(shader.id, uniformName);
+#endif
+
+    return uniform;
+}
+
+// Set shader uniform value by handle (float)
+void SetShaderUniformFloat(Shader shader, int uniform, float value)
+{
+    SetShaderUniformValue(shader, uniform, &value, SHADER_UNIFORM_FLOAT, sizeof(float));
+}
+
+// Set shader uniform value by handle (int)
+void SetShaderUniformInt(Shader shader, int uniform, int value)
+{
+    SetShaderUniformValue(shader, uniform, &value, SHADER_UNIFORM_INT, sizeof(int));
+}
+
+// Set shader uniform value by handle (vec2)
+void SetShaderUniformVector2(Shader shader, int uniform, Vector2 value)
+{
+    SetShaderUniformValue(shader, uniform, &value, SHADER_UNIFORM_VEC2, sizeof(Vector2));
+}
+
+// Set shader uniform value by handle (vec3)
+void SetShaderUniformVector3(Shader shader, int uniform, Vector3 value)
+{
+    SetShaderUniformValue(shader, uniform, &value, SHADER_UNIFORM_VEC3, sizeof(Vector3));
+}
+
+// Set shader uniform value by handle (vec4)
+void SetShaderUniformVector4(Shader shader, int uniform, Vector4 value)
+{
+    SetShaderUniformValue(shader, uniform, &value, SHADER_UNIFORM_VEC4, sizeof(Vector4));
+}
+
+// Set shader uniform value by handle (matrix 4x4)
+void SetShaderUniformMatrix(Shader shader, int uniform, Matrix mat)
+{
+    SetShaderUniformValue(shader, uniform, &mat, -1, sizeof(Matrix));
+}
+
+// Set shader uniform value by handle (sampler2d)
+// NOTE: Texture is bound on every draw, samplers values are not cached
+void SetShaderUniformTexture(Shader shader, int uniform, Texture2D texture)
+{
+#if defined(SUPPORT_SHADER_REFLECTION)
+    ShaderReflection *reflection = GetShaderReflection(shader.id);
+    if ((reflection == NULL) || (uniform < 0) || (uniform >= reflection->count)) return;
+
+    SetShaderValueTexture(shader, reflection->entries[uniform].location, texture);
+#else
+    SetShaderValueTexture(shader, uniform, texture);
+#endif
+}
+
 // Set shader uniform value
 void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformType)
 {
@@ -2527,6 +4588,13 @@ void SetShaderValue(Shader shader, int locIndex, const void *value, int uniformT
 // Set shader uniform value vector
 void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniformType, int count)
 {
+#if defined(SUPPORT_SHADER_REFLECTION)
+    InvalidateShaderReflectionValue(shader.id, locIndex);
+#endif
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (RecordShaderValueCall(shader, locIndex, value, uniformType, count)) return;
+#endif
+
     rlEnableShader(shader.id);
     rlSetUniform(locIndex, value, uniformType, count);
     //rlDisableShader();      // Avoid reseting current shader program, in case other uniforms are set
@@ -2535,6 +4603,13 @@ void SetShaderValueV(Shader shader, int locIndex, const void *value, int uniform
 // Set shader uniform value (matrix 4x4)
 void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat)
 {
+#if defined(SUPPORT_SHADER_REFLECTION)
+    InvalidateShaderReflectionValue(shader.id, locIndex);
+#endif
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (RecordShaderValueCall(shader, locIndex, &mat, -1, 1)) return;
+#endif
+
     rlEnableShader(shader.id);
     rlSetUniformMatrix(locIndex, mat);
     //rlDisableShader();
@@ -2543,11 +4618,27 @@ void SetShaderValueMatrix(Shader shader, int locIndex, Matrix mat)
 // Set shader uniform value for texture
 void SetShaderValueTexture(Shader shader, int locIndex, Texture2D texture)
 {
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (RecordShaderValueCall(shader, locIndex, &texture.id, -2, 1)) return;
+#endif
+
     rlEnableShader(shader.id);
     rlSetUniformSampler(locIndex, texture.id);
     //rlDisableShader();
 }
 
+// Set shader uniform value for texture array or 3D texture
+// NOTE: Sampler texture unit binds layered textures to their own target
+void SetShaderValueTextureArray(Shader shader, int locIndex, TextureArray texture)
+{
+#if defined(RENDER_THREAD_SUPPORTED)
+    if (RecordShaderValueCall(shader, locIndex, &texture.id, -2, 1)) return;
+#endif
+
+    rlEnableShader(shader.id);
+    rlSetUniformSampler(locIndex, texture.id);
+}
+
 // Get a ray trace from mouse position
 Ray GetMouseRay(Vector2 mouse, Camera camera)
 {
@@ -2646,45 +4737,13 @@ Vector2 GetWorldToScreen(Vector3 position, Camera camera)
 }
 
 // Get size position for a 3d world space position (useful for texture drawing)
+// NOTE: Matrices are computed on every call, use GetCameraMatrices() and GetWorldToScreenArray() for many positions
 Vector2 GetWorldToScreenEx(Vector3 position, Camera camera, int width, int height)
 {
-    // Calculate projection matrix (from perspective instead of frustum
-    Matrix matProj = MatrixIdentity();
-
-    if (camera.projection == CAMERA_PERSPECTIVE)
-    {
-        // Calculate projection matrix from perspective
-        matProj = MatrixPerspective(camera.fovy*DEG2RAD, ((double)width/(double)height), RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
-    }
-    else if (camera.projection == CAMERA_ORTHOGRAPHIC)
-    {
-        float aspect = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
-        double top = camera.fovy/2.0;
-        double right = top*aspect;
+    Vector2 screenPosition = { 0 };
+    CameraMatrices matrices = GetCameraMatrices(camera, width, height);
 
-        // Calculate projection matrix from orthographic
-        matProj = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
-    }
-
-    // Calculate view matrix from camera look at (and transpose it)
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
-
-    // TODO: Why not use Vector3Transform(Vector3 v, Matrix mat)?
-
-    // Convert world position vector to quaternion
-    Quaternion worldPos = { position.x, position.y, position.z, 1.0f };
-
-    // Transform world position to view
-    worldPos = QuaternionTransform(worldPos, matView);
-
-    // Transform result to projection (clip space position)
-    worldPos = QuaternionTransform(worldPos, matProj);
-
-    // Calculate normalized device coordinates (inverted y)
-    Vector3 ndcPos = { worldPos.x/worldPos.w, -worldPos.y/worldPos.w, worldPos.z/worldPos.w };
-
-    // Calculate 2d screen position vector
-    Vector2 screenPosition = { (ndcPos.x + 1.0f)/2.0f*(float)width, (ndcPos.y + 1.0f)/2.0f*(float)height };
+    GetWorldToScreenArray(&position, &screenPosition, 1, &matrices);
 
     return screenPosition;
 }
@@ -2707,14 +4766,220 @@ Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera)
     return (Vector2){ transform.x, transform.y };
 }
 
-// Set target FPS (maximum)
-void SetTargetFPS(int fps)
+// Get camera matrices for screen-space functions, 3d camera and screen size
+// NOTE: World to screen transform includes view, projection and viewport (inverted y),
+// screen position is the transformed position divided by its w component
+CameraMatrices GetCameraMatrices(Camera camera, int width, int height)
 {
-    if (fps < 1) CORE.Time.target = 0.0;
-    else CORE.Time.target = 1.0/(double)fps;
+    CameraMatrices matrices = { 0 };
 
-    TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
-}
+    matrices.view = MatrixLookAt(camera.position, camera.target, camera.up);
+    matrices.projection = MatrixIdentity();
+    matrices.width = width;
+    matrices.height = height;
+
+    if (camera.projection == CAMERA_PERSPECTIVE)
+    {
+        // Calculate projection matrix from perspective
+        matrices.projection = MatrixPerspective(camera.fovy*DEG2RAD, ((double)width/(double)height), RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    else if (camera.projection == CAMERA_ORTHOGRAPHIC)
+    {
+        float aspect = (float)width/(float)height;
+        double top = camera.fovy/2.0;
+        double right = top*aspect;
+
+        // Calculate projection matrix from orthographic
+        matrices.projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    // Viewport transform: normalized device coordinates to screen pixels (inverted y), depth kept
+    float halfWidth = (float)width/2.0f;
+    float halfHeight = (float)height/2.0f;
+    Matrix matViewport = {
+        halfWidth, 0.0f, 0.0f, halfWidth,
+        0.0f, -halfHeight, 0.0f, halfHeight,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    matrices.worldToScreen = MatrixMultiply(MatrixMultiply(matrices.view, matrices.projection), matViewport);
+    matrices.screenToWorld = MatrixInvert(matrices.worldToScreen);
+
+    return matrices;
+}
+
+// Get camera matrices for screen-space functions, 2d camera
+CameraMatrices GetCameraMatrices2D(Camera2D camera)
+{
+    CameraMatrices matrices = { 0 };
+
+    matrices.view = GetCameraMatrix2D(camera);
+    matrices.projection = MatrixIdentity();
+    matrices.worldToScreen = matrices.view;
+    matrices.screenToWorld = MatrixInvert(matrices.view);
+    matrices.width = GetScreenWidth();
+    matrices.height = GetScreenHeight();
+
+    return matrices;
+}
+
+// Get screen space positions for an array of 3d world space positions
+// NOTE: Output array can not overlap input array (different element size)
+void GetWorldToScreenArray(const Vector3 *positions, Vector2 *screenPositions, int count, const CameraMatrices *matrices)
+{
+    Matrix mat = matrices->worldToScreen;
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Positions are processed by 4: loaded as 3 vectors, deinterleaved to x, y, z lanes
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *src = &positions[i].x;
+
+        __m128 v0 = _mm_loadu_ps(src);          // x0 y0 z0 x1
+        __m128 v1 = _mm_loadu_ps(src + 4);      // y1 z1 x2 y2
+        __m128 v2 = _mm_loadu_ps(src + 8);      // z2 x3 y3 z3
+
+        __m128 t = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));                  // x2 y2 x3 y3
+        __m128 x = _mm_shuffle_ps(v0, t, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1)), t, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 sx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m0)), _mm_mul_ps(y, _mm_set1_ps(mat.m4))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m8)), _mm_set1_ps(mat.m12)));
+        __m128 sy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m1)), _mm_mul_ps(y, _mm_set1_ps(mat.m5))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m9)), _mm_set1_ps(mat.m13)));
+        __m128 sw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(mat.m3)), _mm_mul_ps(y, _mm_set1_ps(mat.m7))), _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(mat.m11)), _mm_set1_ps(mat.m15)));
+
+        sx = _mm_div_ps(sx, sw);
+        sy = _mm_div_ps(sy, sw);
+
+        _mm_storeu_ps(&screenPositions[i].x, _mm_unpacklo_ps(sx, sy));
+        _mm_storeu_ps(&screenPositions[i + 2].x, _mm_unpackhi_ps(sx, sy));
+    }
+#elif defined(RAYMATH_SIMD_NEON) && defined(__aarch64__)
+    // Positions are processed by 4, deinterleaved to x, y, z lanes on load
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&positions[i].x);
+        float32x4x2_t r;
+
+        float32x4_t sw = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m15), v.val[0], mat.m3), v.val[1], mat.m7), v.val[2], mat.m11);
+        r.val[0] = vdivq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m12), v.val[0], mat.m0), v.val[1], mat.m4), v.val[2], mat.m8), sw);
+        r.val[1] = vdivq_f32(vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(mat.m13), v.val[0], mat.m1), v.val[1], mat.m5), v.val[2], mat.m9), sw);
+
+        vst2q_f32(&screenPositions[i].x, r);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float x = positions[i].x;
+        float y = positions[i].y;
+        float z = positions[i].z;
+        float w = mat.m3*x + mat.m7*y + mat.m11*z + mat.m15;
+
+        screenPositions[i].x = (mat.m0*x + mat.m4*y + mat.m8*z + mat.m12)/w;
+        screenPositions[i].y = (mat.m1*x + mat.m5*y + mat.m9*z + mat.m13)/w;
+    }
+}
+
+// Get screen space positions for an array of 2d camera world space positions
+void GetWorldToScreen2DArray(const Vector2 *positions, Vector2 *screenPositions, int count, const CameraMatrices *matrices)
+{
+    Vector2TransformArray(positions, screenPositions, count, matrices->worldToScreen);
+}
+
+// Get world space positions for an array of 2d camera screen space positions
+void GetScreenToWorld2DArray(const Vector2 *positions, Vector2 *worldPositions, int count, const CameraMatrices *matrices)
+{
+    Vector2TransformArray(positions, worldPositions, count, matrices->screenToWorld);
+}
+
+// Set target FPS (maximum)
+void SetTargetFPS(int fps)
+{
+    if (fps < 1) CORE.Time.target = 0.0;
+    else CORE.Time.target = 1.0/(double)fps;
+
+    TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
+}
+
+// Set frame pacing mode and cadence
+// NOTE: Vsync pacing modes are only available on PLATFORM_NX (60 Hz display), cadence is 60 FPS or 30 FPS (fps <= 30),
+// timer pacing waits remaining target frame time, same as SetTargetFPS(fps)
+void SetFramePacing(int mode, int fps)
+{
+    CORE.Time.presentTime = 0.0;
+    CORE.Time.presentInterval = 0.0;
+    CORE.Time.workTime = 0.0;
+
+#if defined(PLATFORM_NX)
+    if ((mode == FRAME_PACING_VSYNC) || (mode == FRAME_PACING_LOW_LATENCY))
+    {
+        CORE.Time.pacing = mode;
+        CORE.Time.swapInterval = ((fps > 0) && (fps <= 30))? 2 : 1;
+        CORE.Time.target = 0.0;
+
+        SetSwapInterval(CORE.Time.swapInterval);
+
+        TRACELOG(LOG_INFO, "TIMER: Frame pacing: %s, %i FPS cadence", (mode == FRAME_PACING_LOW_LATENCY)? "vsync low latency" : "vsync", 60/CORE.Time.swapInterval);
+        return;
+    }
+
+    // Restore swap interval requested by window flags
+    SetSwapInterval(((CORE.Window.flags & FLAG_VSYNC_HINT) > 0)? 1 : 0);
+#else
+    if (mode != FRAME_PACING_TIMER) TRACELOG(LOG_WARNING, "TIMER: Vsync frame pacing not supported on this platform, timer pacing used");
+#endif
+
+    CORE.Time.pacing = FRAME_PACING_TIMER;
+    CORE.Time.swapInterval = 0;
+
+    SetTargetFPS(fps);
+}
+
+// Get measured time in seconds between presented frames (vsync pacing modes)
+float GetPresentInterval(void)
+{
+    return (float)CORE.Time.presentInterval;
+}
+
+// Set fixed simulation update rate (steps per second), 0 disables fixed update
+// NOTE: Steps run at EndDrawing(), after input polling, as many as frame time requires (FIXED_UPDATE_MAX_STEPS max),
+// rendering cadence is independent (i.e. 30 FPS vsync pacing runs two 60 Hz steps per frame)
+void SetFixedUpdateRate(int hz)
+{
+    CORE.Simulation.step = (hz > 0)? 1.0/(double)hz : 0.0;
+    CORE.Simulation.accumulator = 0.0;
+    CORE.Simulation.alpha = 0.0f;
+
+    // Simulation buttons edges start from current input state
+    memcpy(CORE.Simulation.previousKeyState, CORE.Input.Keyboard.currentKeyState, MAX_KEYBOARD_KEYS);
+    memcpy(CORE.Simulation.previousMouseState, CORE.Input.Mouse.currentButtonState, MAX_MOUSE_BUTTONS);
+    memcpy(CORE.Simulation.previousGamepadState, CORE.Input.Gamepad.currentButtonState, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+    memcpy(CORE.Simulation.previousTouchState, CORE.Input.Touch.currentTouchState, MAX_TOUCH_POINTS);
+
+    if (hz > 0) TRACELOG(LOG_INFO, "TIMER: Fixed update rate: %i Hz (%02.03f milliseconds per step)", hz, (float)CORE.Simulation.step*1000.0f);
+}
+
+// Set fixed simulation update callback, receives fixed step time in seconds
+void SetFixedUpdateCallback(FixedUpdateCallback callback)
+{
+    CORE.Simulation.callback = callback;
+}
+
+// Get interpolation factor between last two simulation steps [0..1]
+// NOTE: Drawing shows previous state lerped to current state by this factor (frame time not simulated yet)
+float GetFixedUpdateAlpha(void)
+{
+    return CORE.Simulation.alpha;
+}
+
+// Get number of simulation steps run on last frame
+int GetFixedUpdateSteps(void)
+{
+    return CORE.Simulation.steps;
+}
 
 // Get current FPS
 // NOTE: We calculate an average framerate
@@ -2752,15 +5017,108 @@ int GetFPS(void)
 // Get time in seconds for last frame drawn (delta time)
 float GetFrameTime(void)
 {
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (eventsRecording || eventsPlaying) return eventsDeltaTime;   // Fixed frame time, deterministic replay
+#endif
+
     return (float)CORE.Time.frame;
 }
 
+// Get frame timing from frames history (0: last frame)
+// NOTE: GPU time is the last measured, timer queries results are collected with some frames latency
+FrameTiming GetFrameTiming(int frame)
+{
+    FrameTiming timing = { 0 };
+
+#if defined(SUPPORT_FRAME_HISTORY)
+    unsigned int available = (CORE.FrameHistory.count < FRAME_HISTORY_SIZE)? CORE.FrameHistory.count : FRAME_HISTORY_SIZE;
+
+    if ((frame >= 0) && ((unsigned int)frame < available)) timing = CORE.FrameHistory.frames[(CORE.FrameHistory.count - 1 - frame)%FRAME_HISTORY_SIZE];
+#else
+    (void)frame;
+#endif
+
+    return timing;
+}
+
+// Get frames history frame times histogram, bins cover [0..maxTime] evenly
+// NOTE: Frames over maxTime are counted on last bin, returns frames counted
+int GetFrameTimeHistogram(int *bins, int binCount, float maxTime)
+{
+    int frames = 0;
+
+    if ((bins == NULL) || (binCount <= 0) || (maxTime <= 0.0f)) return 0;
+
+    for (int i = 0; i < binCount; i++) bins[i] = 0;
+
+#if defined(SUPPORT_FRAME_HISTORY)
+    frames = (CORE.FrameHistory.count < FRAME_HISTORY_SIZE)? (int)CORE.FrameHistory.count : FRAME_HISTORY_SIZE;
+
+    for (int i = 0; i < frames; i++)
+    {
+        int bin = (int)(CORE.FrameHistory.frames[i].frameTime/maxTime*binCount);
+
+        if (bin < 0) bin = 0;
+        else if (bin >= binCount) bin = binCount - 1;
+
+        bins[bin]++;
+    }
+#endif
+
+    return frames;
+}
+
+// Set frame hitch threshold (seconds, 0: disabled), frames over it are logged and count as hitches
+// NOTE: Profiling zones of last traceFrames (hitch frame included) are exported to fileName_XXXX.json (Chrome trace),
+// zones are kept on a rolling capture while threshold is set, it requires SUPPORT_PROFILING_ZONES
+void SetFrameHitchThreshold(float threshold, int traceFrames, const char *fileName)
+{
+#if defined(SUPPORT_FRAME_HISTORY)
+    if (threshold < 0.0f) threshold = 0.0f;
+    if (traceFrames < 1) traceFrames = 1;
+
+    CORE.FrameHistory.hitchThreshold = threshold;
+    CORE.FrameHistory.hitchTraceFrames = traceFrames;
+    CORE.FrameHistory.hitchCount = 0;
+    CORE.FrameHistory.hitchNextTrace = 0;
+
+    if (fileName == NULL) fileName = "hitch";
+    strncpy(CORE.FrameHistory.hitchFileName, fileName, MAX_FILEPATH_LENGTH - 1);
+    CORE.FrameHistory.hitchFileName[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    if (threshold > 0.0f) StartProfileHistory(FRAME_HITCH_TRACE_EVENTS);
+    else StopProfileHistory();
+#else
+    if (threshold > 0.0f) TRACELOG(LOG_WARNING, "TIMER: Frame hitches traces not supported, enable SUPPORT_PROFILING_ZONES");
+#endif
+#else
+    (void)threshold;
+    (void)traceFrames;
+    (void)fileName;
+    TRACELOG(LOG_WARNING, "TIMER: Frames history not supported, enable SUPPORT_FRAME_HISTORY");
+#endif
+}
+
+// Get frames over hitch threshold since threshold set
+int GetFrameHitchCount(void)
+{
+#if defined(SUPPORT_FRAME_HISTORY)
+    return CORE.FrameHistory.hitchCount;
+#else
+    return 0;
+#endif
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
+// NOTE: Without window (i.e. tools, benchmarks) system monotonic clock is used, elapsed since first call
 double GetTime(void)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB)
+    if (!CORE.Window.ready) return GetSystemTime();
+
     return glfwGetTime();   // Elapsed time since glfwInit()
 #endif
 
@@ -2771,6 +5129,170 @@ double GetTime(void)
 
     return (double)(time - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
 #endif
+
+#if defined(PLATFORM_3DS)
+    return (double)(svcGetSystemTick() - CORE.Time.base)/SYSCLOCK_ARM11;    // Elapsed time since InitTimer()
+#endif
+
+#if defined(PLATFORM_NX)
+    // NOTE: System counter is read directly (not through GLFW port), it is a single register read
+    return (double)(armGetSystemTick() - CORE.Time.base)/(double)armGetSystemTickFreq();    // Elapsed time since InitTimer()
+#endif
+}
+
+// Get raw monotonic time counter ticks, cheapest time measure available (instrumentation)
+// NOTE: Ticks are platform specific units, use GetTicksFrequency() to convert them to seconds
+unsigned long long GetTimeTicks(void)
+{
+    unsigned long long ticks = 0;
+
+#if defined(PLATFORM_NX)
+    ticks = armGetSystemTick();
+#elif defined(PLATFORM_3DS)
+    ticks = svcGetSystemTick();
+#elif defined(_WIN32)
+    long long int counter = 0;
+    QueryPerformanceCounter(&counter);
+    ticks = (unsigned long long)counter;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ticks = (unsigned long long)ts.tv_sec*1000000000ULL + (unsigned long long)ts.tv_nsec;
+#endif
+
+    return ticks;
+}
+
+// Get raw monotonic time counter frequency (ticks per second)
+unsigned long long GetTicksFrequency(void)
+{
+    unsigned long long frequency = 1000000000ULL;   // Nanoseconds (clock_gettime())
+
+#if defined(PLATFORM_NX)
+    frequency = armGetSystemTickFreq();             // 19.2 MHz
+#elif defined(PLATFORM_3DS)
+    frequency = SYSCLOCK_ARM11;                     // 268 MHz
+#elif defined(_WIN32)
+    long long int counterFrequency = 1;
+    QueryPerformanceFrequency(&counterFrequency);
+    frequency = (unsigned long long)counterFrequency;
+#endif
+
+    return frequency;
+}
+
+// Start input events recording, frame time is fixed to deltaTime while recording (0.0f: target frame time or 1/60)
+// NOTE: Random seed is reset, replay must be started from the same program state as recording
+void StartAutomationEventsRecording(float deltaTime)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (eventsPlaying) StopAutomationEventsReplay();
+
+    eventCount = 0;
+    eventsFrame = 0;
+    eventsFrameCount = 0;
+    eventsDeltaTime = (deltaTime > 0.0f)? deltaTime : ((CORE.Time.target > 0.0)? (float)CORE.Time.target : 1.0f/60.0f);
+    eventsSeed = (unsigned int)time(NULL);
+    eventsMousePosition = (Vector2){ -1.0f, -1.0f };    // Force first position record
+    memset(eventsGamepadReady, 0, sizeof(eventsGamepadReady));
+    memset(eventsAxis, 0, sizeof(eventsAxis));
+
+    SetRandomSeed(eventsSeed);
+    eventsRecording = true;
+
+    TRACELOG(LOG_INFO, "AUTOMATION: Events recording started (frame time: %.3f ms)", eventsDeltaTime*1000.0f);
+#endif
+}
+
+// Stop input events recording and export events to file
+void StopAutomationEventsRecording(const char *fileName)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsRecording) return;
+
+    eventsRecording = false;
+    eventsFrameCount = eventsFrame;
+
+    ExportAutomationEvents(fileName);
+#endif
+}
+
+// Start recorded events replay at uncapped frame rate (no frame wait, no vsync)
+// NOTE: Frames timings and render stats are exported to statsFileName (.csv or .json) when replay finishes,
+// same events file replayed by different builds lets compare their performance on the same frames
+bool StartAutomationEventsReplay(const char *fileName, const char *statsFileName)
+{
+    bool result = false;
+
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (eventsRecording) StopAutomationEventsRecording(fileName);
+    if (eventsPlaying) StopAutomationEventsReplay();
+
+    if (!LoadAutomationEvents(fileName)) return false;
+
+    RL_FREE(eventsStats);
+    eventsStats = (AutomationFrameStats *)RL_CALLOC((eventsFrameCount > 0)? eventsFrameCount : 1, sizeof(AutomationFrameStats));
+    eventsStatsCount = 0;
+    eventsStatsFileName[0] = '\0';
+    if (statsFileName != NULL) strncpy(eventsStatsFileName, statsFileName, sizeof(eventsStatsFileName) - 1);
+
+    eventsFrame = 0;
+    eventsPlayIndex = 0;
+    eventsMousePosition = CORE.Input.Mouse.currentPosition;
+    memset(eventsGamepadReady, 0, sizeof(eventsGamepadReady));
+    memset(eventsAxis, 0, sizeof(eventsAxis));
+
+    SetRandomSeed(eventsSeed);
+    ResetAutomationSwapInterval(true);
+    eventsPlaying = true;
+    result = true;
+
+    TRACELOG(LOG_INFO, "AUTOMATION: Events replay started (frame time: %.3f ms)", eventsDeltaTime*1000.0f);
+#endif
+
+    return result;
+}
+
+// Stop recorded events replay, frames stats replayed are exported
+void StopAutomationEventsReplay(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    if (!eventsPlaying) return;
+
+    eventsPlaying = false;
+    ResetAutomationSwapInterval(false);
+
+    if (eventsStatsCount > 0)
+    {
+        double total = 0.0;
+        double maxTime = 0.0;
+
+        for (unsigned int i = 0; i < eventsStatsCount; i++)
+        {
+            total += eventsStats[i].frameTime;
+            if (eventsStats[i].frameTime > maxTime) maxTime = eventsStats[i].frameTime;
+        }
+
+        TRACELOG(LOG_INFO, "AUTOMATION: Events replay finished: %i frames, %.3f s, frame time avg: %.3f ms, max: %.3f ms",
+            eventsStatsCount, total, total/eventsStatsCount*1000.0, maxTime*1000.0);
+
+        if (eventsStatsFileName[0] != '\0') ExportAutomationFrameStats(eventsStatsFileName);
+    }
+
+    RL_FREE(eventsStats);
+    eventsStats = NULL;
+    eventsStatsCount = 0;
+#endif
+}
+
+// Check if recorded events replay is running
+bool IsAutomationEventsReplaying(void)
+{
+#if defined(SUPPORT_EVENTS_AUTOMATION)
+    return eventsPlaying;
+#else
+    return false;
+#endif
 }
 
 // Setup window configuration flags (view FLAGS)
@@ -2787,13 +5309,26 @@ void SetConfigFlags(unsigned int flags)
 // NOTE TRACELOG() function is located in [utils.h]
 
 // Takes a screenshot of current screen (saved a .png)
+// NOTE: On PLATFORM_NX with system capture, screenshot is saved to the console album (fileName not used)
 void TakeScreenshot(const char *fileName)
 {
-#if defined(SUPPORT_MODULE_RTEXTURES)
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+    // Screen is read on next EndDrawing() and image exported on async load worker thread
+    strncpy(captureFileName, TextFormat("%s/%s", CORE.Storage.basePath, fileName), MAX_FILEPATH_LENGTH - 1);
+#elif defined(SUPPORT_MODULE_RTEXTURES)
     Vector2 scale = GetWindowScaleDPI();
     unsigned char *imgData = rlReadScreenPixels(CORE.Window.render.width*scale.x, CORE.Window.render.height*scale.y);
     Image image = { imgData, CORE.Window.render.width*scale.x, CORE.Window.render.height*scale.y, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+    if (CORE.Nx.albumReady)
+    {
+        SaveAlbumScreenshot(image);
+        RL_FREE(imgData);
+        return;
+    }
+#endif
+
     char path[2048] = { 0 };
     strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, fileName));
 
@@ -2812,61 +5347,153 @@ void TakeScreenshot(const char *fileName)
 #endif
 }
 
-// Get a random value between min and max (both included)
+// Get a random value between min and max (both included), calling thread generator
 int GetRandomValue(int min, int max)
 {
-    if (min > max)
-    {
-        int tmp = max;
-        max = min;
-        min = tmp;
-    }
-
-    return (rand()%(abs(max - min) + 1) + min);
+    return GetRandomValueEx(GetRandomGenerator(), min, max);
 }
 
 // Set the seed for the random number generator
+// NOTE: Every thread generator is seeded again on its next use, with the seed and the thread stream
 void SetRandomSeed(unsigned int seed)
 {
-    srand(seed);
+    JOB_ATOMIC_STORE(&randomSeed, seed);
+    JOB_ATOMIC_ADD(&randomSeedEpoch, 1);
 }
 
-// Check if the file exists
-bool FileExists(const char *fileName)
+// Get calling thread random generator, seeded on first use and on seed changes
+// NOTE: Returned generator must only be used by calling thread
+RandomGenerator *GetRandomGenerator(void)
 {
-    bool result = false;
+    unsigned int epoch = JOB_ATOMIC_LOAD(&randomSeedEpoch) + 1;
 
-#if defined(_WIN32)
-    if (_access(fileName, 0) != -1) result = true;
-#else
-    if (access(fileName, F_OK) != -1) result = true;
+    if (threadRandomEpoch != epoch)
+    {
+        unsigned int stream = 0;
+#if defined(JOBS_THREADED)
+        if (jobThreadIndex >= 0) stream = (unsigned int)jobThreadIndex;
+        else
+        {
+            if (threadRandomStream < 0) threadRandomStream = JOB_ATOMIC_ADD(&randomStreamCounter, 1);
+            stream = (unsigned int)threadRandomStream;
+        }
 #endif
+        threadRandom = SeedRandomGenerator(((unsigned long long)stream << 32) | JOB_ATOMIC_LOAD(&randomSeed));
+        threadRandomEpoch = epoch;
+    }
 
-    // NOTE: Alternatively, stat() can be used instead of access()
-    //#include <sys/stat.h>
-    //struct stat statbuf;
-    //if (stat(filename, &statbuf) == 0) result = true;
+    return &threadRandom;
+}
 
-    return result;
+// Init random generator state from seed
+// NOTE: Generator produces same sequence as main thread generator after SetRandomSeed(seed)
+RandomGenerator InitRandomGenerator(unsigned int seed)
+{
+    return SeedRandomGenerator(seed);
 }
 
-// Check file extension
-// NOTE: Extensions checking is not case-sensitive
-bool IsFileExtension(const char *fileName, const char *ext)
+// Get random 32 bits value from generator
+unsigned int GetRandomBits(RandomGenerator *generator)
 {
-    bool result = false;
-    const char *fileExt = GetFileExtension(fileName);
+    return NextRandomBits(generator->state);
+}
 
-    if (fileExt != NULL)
+// Get random value between min and max (both included) from generator
+// NOTE: Range mapped with multiply-shift, values rejected to avoid bias (Lemire's method)
+int GetRandomValueEx(RandomGenerator *generator, int min, int max)
+{
+    if (min > max)
     {
-#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
-        int extCount = 0;
-        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
 
-        char fileExtLower[16] = { 0 };
-        strcpy(fileExtLower, TextToLower(fileExt));  // WARNING: Module required: rtext
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
 
-        for (int i = 0; i < extCount; i++)
+    return (int)((unsigned int)min + GetRandomRange(generator->state, range));
+}
+
+// Get random float value in [min, max) from generator, 24 bits precision
+float GetRandomFloat(RandomGenerator *generator, float min, float max)
+{
+    return min + (float)(NextRandomBits(generator->state) >> 8)*(1.0f/16777216.0f)*(max - min);
+}
+
+// Generate random values between min and max (both included) into array
+// NOTE: Generator state is kept local while filling the array (registers), same sequence as GetRandomValueEx()
+void GenRandomValues(RandomGenerator *generator, int *values, int count, int min, int max)
+{
+    if (min > max)
+    {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+    unsigned int state[4] = { generator->state[0], generator->state[1], generator->state[2], generator->state[3] };
+
+    for (int i = 0; i < count; i++) values[i] = (int)((unsigned int)min + GetRandomRange(state, range));
+
+    for (int i = 0; i < 4; i++) generator->state[i] = state[i];
+}
+
+// Generate random float values in [min, max) into array, 24 bits precision
+// NOTE: Bits are generated by blocks and converted in a branchless loop (vectorized by compilers)
+void GenRandomFloats(RandomGenerator *generator, float *values, int count, float min, float max)
+{
+    unsigned int state[4] = { generator->state[0], generator->state[1], generator->state[2], generator->state[3] };
+    unsigned int bits[64] = { 0 };
+    float scale = (max - min)*(1.0f/16777216.0f);
+
+    for (int i = 0; i < count; i += 64)
+    {
+        int blockCount = ((count - i) < 64)? (count - i) : 64;
+
+        for (int k = 0; k < blockCount; k++) bits[k] = NextRandomBits(state);
+        for (int k = 0; k < blockCount; k++) values[i + k] = min + (float)(bits[k] >> 8)*scale;
+    }
+
+    for (int i = 0; i < 4; i++) generator->state[i] = state[i];
+}
+
+// Check if the file exists
+bool FileExists(const char *fileName)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    if (_access(fileName, 0) != -1) result = true;
+#else
+    if (access(fileName, F_OK) != -1) result = true;
+#endif
+
+    // NOTE: Alternatively, stat() can be used instead of access()
+    //#include <sys/stat.h>
+    //struct stat statbuf;
+    //if (stat(filename, &statbuf) == 0) result = true;
+
+    return result;
+}
+
+// Check file extension
+// NOTE: Extensions checking is not case-sensitive
+bool IsFileExtension(const char *fileName, const char *ext)
+{
+    bool result = false;
+    const char *fileExt = GetFileExtension(fileName);
+
+    if (fileExt != NULL)
+    {
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_TEXT_MANIPULATION)
+        int extCount = 0;
+        const char **checkExts = TextSplit(ext, ';', &extCount); // WARNING: Module required: rtext
+
+        char fileExtLower[16] = { 0 };
+        strcpy(fileExtLower, TextToLower(fileExt));  // WARNING: Module required: rtext
+
+        for (int i = 0; i < extCount; i++)
         {
             if (strcmp(fileExtLower, TextToLower(checkExts[i])) == 0)
             {
@@ -3229,33 +5856,45 @@ long GetFileModTime(const char *fileName)
 // Compress data (DEFLATE algorithm)
 unsigned char *CompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
-    unsigned char *compData = NULL;
-
-#if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl sdefl = { 0 };
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
-    *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbwi
-
-    TraceLog(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
-#endif
-
-    return compData;
+    return CompressDataEx(data, dataSize, compDataSize, COMPRESSION_DEFLATE);
 }
 
 // Decompress data (DEFLATE algorithm)
+// NOTE: Output buffer grows until data fits, up to MAX_DECOMPRESSION_SIZE
 unsigned char *DecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
+    *dataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
     // Decompress data from a valid DEFLATE stream
-    data = RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE, compData, compDataSize);
-    unsigned char *temp = RL_REALLOC(data, length);
+    int maxSize = MAX_DECOMPRESSION_SIZE*1024*1024;
+    int capacity = (compDataSize < maxSize/4)? compDataSize*4 : maxSize;
+    int length = -1;
+
+    if (capacity < 65536) capacity = 65536;
+
+    while (length < 0)
+    {
+        unsigned char *temp = (unsigned char *)RL_REALLOC(data, capacity);
+
+        if (temp == NULL) break;
+
+        data = temp;
+        length = sinflate(data, capacity, compData, compDataSize);
+
+        if (capacity >= maxSize) break;
+        capacity = (capacity < maxSize/2)? capacity*2 : maxSize;
+    }
+
+    if (length < 0)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress data, size exceeds maximum (%i MB)", MAX_DECOMPRESSION_SIZE);
+        RL_FREE(data);
+        return NULL;
+    }
+
+    unsigned char *temp = (unsigned char *)RL_REALLOC(data, (length > 0)? length : 1);
 
     if (temp != NULL) data = temp;
     else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
@@ -3268,6 +5907,229 @@ unsigned char *DecompressData(const unsigned char *compData, int compDataSize, i
     return data;
 }
 
+// Compress data with codec (CompressionCodec)
+// NOTE: COMPRESSION_LZ4 output is a raw LZ4 block, decompressed data size must be known to decompress it
+unsigned char *CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int codec)
+{
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (codec == COMPRESSION_LZ4)
+    {
+        compData = (unsigned char *)RL_MALLOC(COMPRESSION_LZ4_BOUND(dataSize));
+        if (compData != NULL) *compDataSize = CompressLZ4(data, dataSize, compData);
+    }
+    else
+    {
+        // Compress data and generate a valid DEFLATE stream
+        struct sdefl sdefl = { 0 };
+        int bounds = sdefl_bound(dataSize);
+        compData = (unsigned char *)RL_CALLOC(bounds, 1);
+        *compDataSize = sdeflate(&sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);
+    }
+
+    TraceLog(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
+#endif
+
+    return compData;
+}
+
+// Decompress data into provided buffer, returns decompressed data size or -1 on failure
+// NOTE: Decompressed data must fit bufferSize, DEFLATE decompressor reads up to 16 bytes ahead of compressed data
+int DecompressDataToBuffer(const unsigned char *compData, int compDataSize, unsigned char *buffer, int bufferSize, int codec)
+{
+    int size = -1;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((compData == NULL) || (buffer == NULL) || (compDataSize <= 0)) return -1;
+
+    if (codec == COMPRESSION_LZ4) size = DecompressLZ4(compData, compDataSize, buffer, bufferSize);
+    else size = sinflate(buffer, bufferSize, compData, compDataSize);
+#endif
+
+    return size;
+}
+
+// Load compression stream, data is compressed by blocks with codec (CompressionCodec)
+// NOTE: Stream data is framed (blocks headers), it must be decompressed with a decompression stream
+CompressionStream *LoadCompressionStream(int codec)
+{
+    CompressionStream *stream = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream = (CompressionStream *)RL_CALLOC(1, sizeof(CompressionStream));
+    if (stream == NULL) return NULL;
+
+    stream->codec = (codec == COMPRESSION_LZ4)? COMPRESSION_LZ4 : COMPRESSION_DEFLATE;
+
+    int bound = (stream->codec == COMPRESSION_LZ4)? COMPRESSION_LZ4_BOUND(COMPRESSION_STREAM_BLOCK_SIZE) : sdefl_bound(COMPRESSION_STREAM_BLOCK_SIZE);
+
+    // NOTE: Input block padded, compressors read ahead of data end
+    stream->input = (unsigned char *)RL_CALLOC(COMPRESSION_STREAM_BLOCK_SIZE + 16, 1);
+    stream->output = (unsigned char *)RL_MALLOC(sizeof(CompressionBlockHeader) + bound);
+    if (stream->codec == COMPRESSION_DEFLATE) stream->deflate = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+
+    if ((stream->input == NULL) || (stream->output == NULL) || ((stream->codec == COMPRESSION_DEFLATE) && (stream->deflate == NULL)))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compression stream memory");
+        UnloadCompressionStream(stream);
+        stream = NULL;
+    }
+#endif
+
+    return stream;
+}
+
+// Load decompression stream, codec is defined by every stream block
+CompressionStream *LoadDecompressionStream(void)
+{
+    CompressionStream *stream = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream = (CompressionStream *)RL_CALLOC(1, sizeof(CompressionStream));
+    if (stream == NULL) return NULL;
+
+    stream->codec = -1;
+
+    // NOTE: Input block padded, DEFLATE decompressor reads ahead of block data end
+    stream->input = (unsigned char *)RL_CALLOC(sizeof(CompressionBlockHeader) + COMPRESSION_STREAM_BLOCK_SIZE + 16, 1);
+    stream->output = (unsigned char *)RL_MALLOC(COMPRESSION_STREAM_BLOCK_SIZE);
+
+    if ((stream->input == NULL) || (stream->output == NULL))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate decompression stream memory");
+        UnloadCompressionStream(stream);
+        stream = NULL;
+    }
+#endif
+
+    return stream;
+}
+
+// Unload compression/decompression stream
+void UnloadCompressionStream(CompressionStream *stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream == NULL) return;
+
+    RL_FREE(stream->input);
+    RL_FREE(stream->output);
+    RL_FREE(stream->deflate);
+    RL_FREE(stream);
+#endif
+}
+
+// Feed stream input data, returns bytes consumed or -1 on failure
+// NOTE: Input is consumed up to one block, remaining data must be fed again once output is drained
+int FeedCompressionStream(CompressionStream *stream, const unsigned char *data, int dataSize)
+{
+    int consumed = -1;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((stream == NULL) || stream->failed || ((data == NULL) && (dataSize > 0))) return -1;
+
+    consumed = 0;
+
+    while (consumed < dataSize)
+    {
+        int needed = GetCompressionStreamNeeded(stream);
+
+        if (needed == 0)
+        {
+            ProcessCompressionStream(stream);
+            if (stream->failed) return -1;
+
+            // Output block not drained yet or stream finished
+            needed = GetCompressionStreamNeeded(stream);
+            if (needed == 0) break;
+        }
+
+        int count = ((dataSize - consumed) < needed)? (dataSize - consumed) : needed;
+        memcpy(stream->input + stream->inputSize, data + consumed, count);
+        stream->inputSize += count;
+        consumed += count;
+
+        // Decompression: block header validated once complete, stored size defines block input
+        if ((stream->codec < 0) && (stream->inputSize == (int)sizeof(CompressionBlockHeader)))
+        {
+            CompressionBlockHeader header = { 0 };
+            memcpy(&header, stream->input, sizeof(CompressionBlockHeader));
+
+            unsigned int storedSize = header.storedSize & 0xffffff;
+            unsigned int method = header.storedSize >> 24;
+
+            if ((header.size > COMPRESSION_STREAM_BLOCK_SIZE) || (storedSize > COMPRESSION_STREAM_BLOCK_SIZE) || (method > COMPRESSION_BLOCK_LZ4) ||
+                ((method == COMPRESSION_BLOCK_STORED) && (storedSize != header.size)) || ((header.size == 0) && (header.storedSize != 0)))
+            {
+                TRACELOG(LOG_WARNING, "SYSTEM: Decompression stream data not valid");
+                stream->failed = true;
+                return -1;
+            }
+        }
+    }
+
+    ProcessCompressionStream(stream);
+    if (stream->failed) return -1;
+#endif
+
+    return consumed;
+}
+
+// Drain stream output data, returns bytes written or -1 on failure
+// NOTE: Compression stream last block is only output once FinishCompressionStream() is called
+int DrainCompressionStream(CompressionStream *stream, unsigned char *buffer, int bufferSize)
+{
+    int written = -1;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((stream == NULL) || stream->failed || ((buffer == NULL) && (bufferSize > 0))) return -1;
+
+    written = 0;
+
+    while (written < bufferSize)
+    {
+        if (stream->outputOffset == stream->outputSize)
+        {
+            ProcessCompressionStream(stream);
+            if (stream->failed) return -1;
+
+            // No output block available, more input required
+            if (stream->outputOffset == stream->outputSize) break;
+        }
+
+        int available = stream->outputSize - stream->outputOffset;
+        int count = ((bufferSize - written) < available)? (bufferSize - written) : available;
+        memcpy(buffer + written, stream->output + stream->outputOffset, count);
+        stream->outputOffset += count;
+        written += count;
+    }
+#endif
+
+    return written;
+}
+
+// Finish compression stream input, last block and end block are output on drain
+void FinishCompressionStream(CompressionStream *stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((stream != NULL) && (stream->codec >= 0)) stream->finished = true;
+#endif
+}
+
+// Check if stream finished and all output data was drained
+// NOTE: Decompression streams finish once the end block is read
+bool IsCompressionStreamDone(CompressionStream *stream)
+{
+    bool done = false;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream != NULL) done = stream->finished && ((stream->codec < 0) || stream->ended) && (stream->outputOffset == stream->outputSize);
+#endif
+
+    return done;
+}
+
 // Encode data to Base64 string
 char *EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
@@ -3362,139 +6224,203 @@ unsigned char *DecodeDataBase64(const unsigned char *data, int *outputSize)
     return decodedData;
 }
 
-// Save integer value to storage file (to defined position)
-// NOTE: Storage positions is directly related to file memory layout (4 bytes each integer)
+// Save integer value to storage (to defined position)
+// NOTE: Storage is cached, change is committed on FlushStorage() or once idle, returns true on success
 bool SaveStorageValue(unsigned int position, int value)
 {
     bool success = false;
 
 #if defined(SUPPORT_DATA_STORAGE)
-    char path[512] = { 0 };
-    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, STORAGE_DATA_FILE));
+    LoadStorage();
 
-    unsigned int dataSize = 0;
-    unsigned int newDataSize = 0;
-    unsigned char *fileData = LoadFileData(path, &dataSize);
-    unsigned char *newFileData = NULL;
-
-    if (fileData != NULL)
+    if (position >= CORE.Storage.valueCount)
     {
-        if (dataSize <= (position*sizeof(int)))
-        {
-            // Increase data size up to position and store value
-            newDataSize = (position + 1)*sizeof(int);
-            newFileData = (unsigned char *)RL_REALLOC(fileData, newDataSize);
-
-            if (newFileData != NULL)
-            {
-                // RL_REALLOC succeded
-                int *dataPtr = (int *)newFileData;
-                dataPtr[position] = value;
-            }
-            else
-            {
-                // RL_REALLOC failed
-                TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to realloc data (%u), position in bytes (%u) bigger than actual file size", path, dataSize, position*sizeof(int));
+        int *values = (int *)RL_REALLOC(CORE.Storage.values, (position + 1)*sizeof(int));
 
-                // We store the old size of the file
-                newFileData = fileData;
-                newDataSize = dataSize;
-            }
-        }
-        else
+        if (values == NULL)
         {
-            // Store the old size of the file
-            newFileData = fileData;
-            newDataSize = dataSize;
-
-            // Replace value on selected position
-            int *dataPtr = (int *)newFileData;
-            dataPtr[position] = value;
+            TRACELOG(LOG_WARNING, "STORAGE: Failed to allocate storage position: %i", position);
+            return false;
         }
 
-        success = SaveFileData(path, newFileData, newDataSize);
-        RL_FREE(newFileData);
-
-        TRACELOG(LOG_INFO, "FILEIO: [%s] Saved storage value: %i", path, value);
+        memset(values + CORE.Storage.valueCount, 0, (position + 1 - CORE.Storage.valueCount)*sizeof(int));
+        CORE.Storage.values = values;
+        CORE.Storage.valueCount = position + 1;
     }
-    else
-    {
-        TRACELOG(LOG_INFO, "FILEIO: [%s] File created successfully", path);
-
-        dataSize = (position + 1)*sizeof(int);
-        fileData = (unsigned char *)RL_MALLOC(dataSize);
-        int *dataPtr = (int *)fileData;
-        dataPtr[position] = value;
 
-        success = SaveFileData(path, fileData, dataSize);
-        UnloadFileData(fileData);
-
-        TRACELOG(LOG_INFO, "FILEIO: [%s] Saved storage value: %i", path, value);
+    if (CORE.Storage.values[position] != value)
+    {
+        CORE.Storage.values[position] = value;
+        CORE.Storage.dirty = true;
+        CORE.Storage.changeTime = GetTime();
     }
+
+    success = true;
 #endif
 
     return success;
 }
 
-// Load integer value from storage file (from defined position)
+// Load integer value from storage (from defined position)
 // NOTE: If requested position could not be found, value 0 is returned
 int LoadStorageValue(unsigned int position)
 {
     int value = 0;
 
 #if defined(SUPPORT_DATA_STORAGE)
-    char path[512] = { 0 };
-    strcpy(path, TextFormat("%s/%s", CORE.Storage.basePath, STORAGE_DATA_FILE));
+    LoadStorage();
+
+    if (position < CORE.Storage.valueCount) value = CORE.Storage.values[position];
+    else TRACELOG(LOG_WARNING, "STORAGE: Failed to find storage position: %i", position);
+#endif
 
-    unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(path, &dataSize);
+    return value;
+}
 
-    if (fileData != NULL)
-    {
-        if (dataSize < (position*4)) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to find storage position: %i", path, position);
-        else
-        {
-            int *dataPtr = (int *)fileData;
-            value = dataPtr[position];
-        }
+// Save integer value to storage (keyed entry)
+bool SaveStorageInt(const char *key, int value)
+{
+#if defined(SUPPORT_DATA_STORAGE)
+    return SetStorageEntry(key, STORAGE_ENTRY_INT, &value, sizeof(int));
+#else
+    return false;
+#endif
+}
 
-        UnloadFileData(fileData);
+// Load integer value from storage (keyed entry), default value is returned if not found
+int LoadStorageInt(const char *key, int defaultValue)
+{
+    int value = defaultValue;
 
-        TRACELOG(LOG_INFO, "FILEIO: [%s] Loaded storage value: %i", path, value);
-    }
+#if defined(SUPPORT_DATA_STORAGE)
+    StorageEntry *entry = GetStorageEntry(key);
+    if ((entry != NULL) && (entry->type == STORAGE_ENTRY_INT)) memcpy(&value, entry->data, sizeof(int));
 #endif
+
     return value;
 }
 
-// Open URL with default system browser (if available)
-// NOTE: This function is only safe to use if you control the URL given.
-// A user could craft a malicious string performing another action.
-// Only call this function yourself not with user input or make sure to check the string yourself.
-// Ref: https://github.com/raysan5/raylib/issues/686
-void OpenURL(const char *url)
+// Save float value to storage (keyed entry)
+bool SaveStorageFloat(const char *key, float value)
 {
-    // Small security check trying to avoid (partially) malicious code...
-    // sorry for the inconvenience when you hit this point...
-    if (strchr(url, '\'') != NULL)
-    {
-        TRACELOG(LOG_WARNING, "SYSTEM: Provided URL is not valid");
-    }
-    else
-    {
-#if defined(PLATFORM_DESKTOP)
-        char *cmd = (char *)RL_CALLOC(strlen(url) + 10, sizeof(char));
-    #if defined(_WIN32)
-        sprintf(cmd, "explorer \"%s\"", url);
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
-    #endif
-    #if defined(__APPLE__)
-        sprintf(cmd, "open '%s'", url);
-    #endif
-        int result = system(cmd);
-        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
-        RL_FREE(cmd);
+#if defined(SUPPORT_DATA_STORAGE)
+    return SetStorageEntry(key, STORAGE_ENTRY_FLOAT, &value, sizeof(float));
+#else
+    return false;
+#endif
+}
+
+// Load float value from storage (keyed entry), default value is returned if not found
+float LoadStorageFloat(const char *key, float defaultValue)
+{
+    float value = defaultValue;
+
+#if defined(SUPPORT_DATA_STORAGE)
+    StorageEntry *entry = GetStorageEntry(key);
+    if ((entry != NULL) && (entry->type == STORAGE_ENTRY_FLOAT)) memcpy(&value, entry->data, sizeof(float));
+#endif
+
+    return value;
+}
+
+// Save bytes blob to storage (keyed entry)
+bool SaveStorageData(const char *key, const void *data, unsigned int size)
+{
+#if defined(SUPPORT_DATA_STORAGE)
+    if ((data == NULL) && (size > 0)) return false;
+
+    return SetStorageEntry(key, STORAGE_ENTRY_DATA, data, size);
+#else
+    return false;
+#endif
+}
+
+// Load bytes blob from storage (keyed entry) into buffer, returns blob size (0 if not found)
+// NOTE: Only bufferSize bytes are copied, buffer can be NULL to get the blob size
+unsigned int LoadStorageData(const char *key, void *buffer, unsigned int bufferSize)
+{
+    unsigned int size = 0;
+
+#if defined(SUPPORT_DATA_STORAGE)
+    StorageEntry *entry = GetStorageEntry(key);
+
+    if ((entry != NULL) && (entry->type == STORAGE_ENTRY_DATA))
+    {
+        size = entry->size;
+        if (buffer != NULL) memcpy(buffer, entry->data, (size < bufferSize)? size : bufferSize);
+    }
+#endif
+
+    return size;
+}
+
+// Remove keyed entry from storage, returns true if it was found
+bool RemoveStorageKey(const char *key)
+{
+    bool removed = false;
+
+#if defined(SUPPORT_DATA_STORAGE)
+    StorageEntry *entry = GetStorageEntry(key);
+
+    if (entry != NULL)
+    {
+        RL_FREE(entry->key);
+        RL_FREE(entry->data);
+
+        CORE.Storage.entryCount--;
+        *entry = CORE.Storage.entries[CORE.Storage.entryCount];
+
+        CORE.Storage.dirty = true;
+        CORE.Storage.changeTime = GetTime();
+        removed = true;
+    }
+#endif
+
+    return removed;
+}
+
+// Commit storage changes to file now, waits for the write to finish, returns true on success
+// NOTE: Changes are also committed once idle for STORAGE_COMMIT_DELAY seconds (checked on EndDrawing())
+bool FlushStorage(void)
+{
+    bool success = true;
+
+#if defined(SUPPORT_DATA_STORAGE)
+    if (CORE.Storage.loaded) success = CommitStorage(true);
+#endif
+
+    return success;
+}
+
+// Open URL with default system browser (if available)
+// NOTE: This function is only safe to use if you control the URL given.
+// A user could craft a malicious string performing another action.
+// Only call this function yourself not with user input or make sure to check the string yourself.
+// Ref: https://github.com/raysan5/raylib/issues/686
+void OpenURL(const char *url)
+{
+    // Small security check trying to avoid (partially) malicious code...
+    // sorry for the inconvenience when you hit this point...
+    if (strchr(url, '\'') != NULL)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Provided URL is not valid");
+    }
+    else
+    {
+#if defined(PLATFORM_DESKTOP)
+        char *cmd = (char *)RL_CALLOC(strlen(url) + 10, sizeof(char));
+    #if defined(_WIN32)
+        sprintf(cmd, "explorer \"%s\"", url);
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+        sprintf(cmd, "xdg-open '%s'", url); // Alternatives: firefox, x-www-browser
+    #endif
+    #if defined(__APPLE__)
+        sprintf(cmd, "open '%s'", url);
+    #endif
+        int result = system(cmd);
+        if (result == -1) TRACELOG(LOG_WARNING, "OpenURL() child process could not be created");
+        RL_FREE(cmd);
 #endif
 #if defined(PLATFORM_WEB)
         emscripten_run_script(TextFormat("window.open('%s', '_blank')", url));
@@ -3525,6 +6451,316 @@ void OpenURL(const char *url)
     }
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Job system Functions
+//----------------------------------------------------------------------------------
+// Get job system worker threads count, jobs run on submit if 0
+int GetJobWorkerCount(void)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    return CORE.Jobs.workerCount;
+#else
+    return 0;
+#endif
+}
+
+// Submit job to worker threads, job is queued once dependency counter (optional) is done
+// NOTE: Counter (optional) is incremented now and decremented when the job is finished
+void SubmitJob(JobCallback callback, void *data, JobCounter *dependency, JobCounter *counter)
+{
+    if (callback == NULL) return;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    Job job = { callback, NULL, data, 0, 0, dependency, counter, false };
+
+    if (counter != NULL) JOB_ATOMIC_ADD(&counter->pending, 1);
+
+#if defined(JOBS_THREADED)
+    if (DeferJob(job)) return;
+#endif
+
+    // Dependency not done and job can not be deferred, wait for it (calling thread runs jobs meanwhile)
+    if (dependency != NULL) WaitJobCounter(dependency);
+
+    QueueJob(job);
+#else
+    (void)dependency;
+    (void)counter;
+    callback(data);
+#endif
+}
+
+// Submit job run on main thread only (GL work), job is queued once dependency counter (optional) is done
+// NOTE: Main thread only jobs run on EndDrawing() or while main thread waits a counter
+void SubmitMainThreadJob(JobCallback callback, void *data, JobCounter *dependency, JobCounter *counter)
+{
+    if (callback == NULL) return;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    Job job = { callback, NULL, data, 0, 0, dependency, counter, true };
+
+    if (counter != NULL) JOB_ATOMIC_ADD(&counter->pending, 1);
+
+#if defined(JOBS_THREADED)
+    if (DeferJob(job)) return;
+#endif
+
+    if (dependency != NULL) WaitJobCounter(dependency);
+
+    QueueJob(job);
+#else
+    (void)dependency;
+    (void)counter;
+    callback(data);
+#endif
+}
+
+// Wait for counter pending jobs, calling thread runs queued jobs meanwhile
+// NOTE: Main thread also runs main thread only jobs, waiting on them from another thread requires main thread to
+// reach EndDrawing() or wait a counter
+void WaitJobCounter(JobCounter *counter)
+{
+    if (counter == NULL) return;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    while (JOB_ATOMIC_LOAD(&counter->pending) > 0)
+    {
+#if defined(JOBS_THREADED)
+        Job job = { 0 };
+
+        if ((jobThreadIndex == 0) && RunMainThreadJobs()) continue;
+
+        if (NextJob(jobThreadIndex, &job)) RunJob(&job);
+        else JOB_YIELD();
+#else
+        // Jobs run on submit, only main thread only jobs can be pending
+        if (!RunMainThreadJobs()) break;
+#endif
+    }
+#endif
+}
+
+// Check if counter has no pending jobs
+bool IsJobCounterDone(JobCounter *counter)
+{
+    if (counter == NULL) return true;
+
+    return (JOB_ATOMIC_LOAD(&counter->pending) <= 0);
+}
+
+// Run range callback over [0, count) split in jobs, waits for completion (calling thread runs jobs meanwhile)
+// NOTE: If grainSize is 0, range is split in 4 jobs per thread (workers and calling thread)
+void ParallelFor(JobRangeCallback callback, void *data, int count, int grainSize)
+{
+    if ((callback == NULL) || (count <= 0)) return;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (grainSize <= 0) grainSize = count/((CORE.Jobs.workerCount + 1)*4);
+    if (grainSize < 1) grainSize = 1;
+
+    if ((CORE.Jobs.workerCount == 0) || (count <= grainSize))
+    {
+        callback(data, 0, count);
+        return;
+    }
+
+    JobCounter counter = { 0 };
+
+    for (int start = 0; start < count; start += grainSize)
+    {
+        Job job = { NULL, callback, data, start, ((count - start) > grainSize)? (start + grainSize) : count, NULL, &counter, false };
+
+        JOB_ATOMIC_ADD(&counter.pending, 1);
+        QueueJob(job);
+    }
+
+    WaitJobCounter(&counter);
+#else
+    (void)grainSize;
+    callback(data, 0, count);
+#endif
+}
+
+// Load fixed size objects pool, objects can be allocated and freed from any thread
+// NOTE: Job system threads cache up to OBJECT_POOL_CACHE_SIZE free objects, capacity should consider it
+ObjectPool *LoadObjectPool(int objectSize, int capacity)
+{
+    ObjectPool *pool = NULL;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if ((objectSize <= 0) || (capacity <= 0)) return NULL;
+
+    pool = (ObjectPool *)RL_CALLOC(1, sizeof(ObjectPool));
+    if (pool == NULL) return NULL;
+
+    pool->objectSize = (objectSize + OBJECT_POOL_ALIGNMENT - 1) & ~(OBJECT_POOL_ALIGNMENT - 1);
+    pool->capacity = capacity;
+    pool->objects = (unsigned char *)RL_MALLOC((size_t)pool->objectSize*capacity);
+    pool->next = (unsigned int *)RL_MALLOC(capacity*sizeof(unsigned int));
+
+    if ((pool->objects == NULL) || (pool->next == NULL))
+    {
+        TRACELOG(LOG_WARNING, "POOL: Failed to allocate objects pool (%i objects of %i bytes)", capacity, objectSize);
+        UnloadObjectPool(pool);
+        return NULL;
+    }
+
+    // Free list initialized in objects order
+    for (int i = 0; i < capacity; i++) pool->next[i] = ((i + 1) < capacity)? (unsigned int)(i + 2) : 0;
+    pool->head = 1;
+#else
+    (void)objectSize;
+    (void)capacity;
+#endif
+
+    return pool;
+}
+
+// Unload objects pool
+void UnloadObjectPool(ObjectPool *pool)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (pool == NULL) return;
+
+    RL_FREE(pool->objects);
+    RL_FREE(pool->next);
+    RL_FREE(pool);
+#else
+    (void)pool;
+#endif
+}
+
+// Allocate object from pool, NULL if pool is exhausted
+// NOTE: Thread cache is refilled with half its size from shared free list once empty
+void *AllocPoolObject(ObjectPool *pool)
+{
+    void *object = NULL;
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (pool == NULL) return NULL;
+
+    ObjectPoolCache *cache = GetObjectPoolCache(pool);
+    unsigned int index = 0;
+
+    if (cache != NULL)
+    {
+        if (cache->count > 0) cache->counters.cacheHits++;
+        else
+        {
+            for (int i = 0; i < OBJECT_POOL_CACHE_SIZE/2; i++)
+            {
+                unsigned int refill = PopObjectPool(pool, &cache->counters.contention);
+                if (refill == 0) break;
+
+                cache->objects[cache->count++] = refill;
+            }
+        }
+
+        if (cache->count > 0)
+        {
+            index = cache->objects[--cache->count];
+            cache->counters.allocations++;
+        }
+        else cache->counters.failures++;
+    }
+    else
+    {
+        unsigned int retries = 0;
+        index = PopObjectPool(pool, &retries);
+
+        if (retries > 0) JOB_ATOMIC_ADD(&pool->shared.contention, retries);
+        if (index != 0) JOB_ATOMIC_ADD(&pool->shared.allocations, 1);
+        else JOB_ATOMIC_ADD(&pool->shared.failures, 1);
+    }
+
+    if (index != 0) object = pool->objects + (size_t)(index - 1)*pool->objectSize;
+#else
+    (void)pool;
+#endif
+
+    return object;
+}
+
+// Free object back to pool
+// NOTE: Thread cache is flushed by half its size to shared free list once full
+void FreePoolObject(ObjectPool *pool, void *object)
+{
+#if defined(SUPPORT_JOB_SYSTEM)
+    if ((pool == NULL) || (object == NULL)) return;
+
+    size_t offset = (size_t)((unsigned char *)object - pool->objects);
+
+    if (((unsigned char *)object < pool->objects) || (offset >= (size_t)pool->objectSize*pool->capacity) || ((offset%pool->objectSize) != 0))
+    {
+        TRACELOG(LOG_WARNING, "POOL: Object not allocated from pool, free ignored");
+        return;
+    }
+
+    unsigned int index = (unsigned int)(offset/pool->objectSize) + 1;
+    ObjectPoolCache *cache = GetObjectPoolCache(pool);
+
+    if (cache != NULL)
+    {
+        if (cache->count < OBJECT_POOL_CACHE_SIZE) cache->counters.cacheHits++;
+        else
+        {
+            for (int i = 0; i < OBJECT_POOL_CACHE_SIZE/2; i++) PushObjectPool(pool, cache->objects[--cache->count], &cache->counters.contention);
+        }
+
+        cache->objects[cache->count++] = index;
+        cache->counters.frees++;
+    }
+    else
+    {
+        unsigned int retries = 0;
+        PushObjectPool(pool, index, &retries);
+
+        if (retries > 0) JOB_ATOMIC_ADD(&pool->shared.contention, retries);
+        JOB_ATOMIC_ADD(&pool->shared.frees, 1);
+    }
+#else
+    (void)pool;
+    (void)object;
+#endif
+}
+
+// Get objects pool usage and contention stats
+// NOTE: Threads caches counters are read while owners could update them, stats are approximate
+ObjectPoolStats GetObjectPoolStats(ObjectPool *pool)
+{
+    ObjectPoolStats stats = { 0 };
+
+#if defined(SUPPORT_JOB_SYSTEM)
+    if (pool == NULL) return stats;
+
+    ObjectPoolCounters counters = pool->shared;
+
+    for (int i = 0; i < (MAX_JOB_WORKERS + 1); i++)
+    {
+        ObjectPoolCache *cache = &pool->caches[i];
+
+        counters.allocations += cache->counters.allocations;
+        counters.frees += cache->counters.frees;
+        counters.cacheHits += cache->counters.cacheHits;
+        counters.contention += cache->counters.contention;
+        counters.failures += cache->counters.failures;
+        stats.cached += cache->count;
+    }
+
+    stats.capacity = pool->capacity;
+    stats.used = (int)(counters.allocations - counters.frees);
+    stats.allocations = counters.allocations;
+    stats.frees = counters.frees;
+    stats.cacheHits = counters.cacheHits;
+    stats.contention = counters.contention;
+    stats.failures = counters.failures;
+#else
+    (void)pool;
+#endif
+
+    return stats;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Input (Keyboard, Mouse, Gamepad) Functions
 //----------------------------------------------------------------------------------
@@ -3606,6 +6842,19 @@ int GetCharPressed(void)
     return value;
 }
 
+// Get next input event registered on current frame, returns false when no events left
+// NOTE: Events are registered by PollInputEvents() with their own timestamp, keyboard and mouse events
+// are only queued on platforms using GLFW (PLATFORM_DESKTOP, PLATFORM_WEB, PLATFORM_NX)
+bool PollInputEvent(InputEvent *event)
+{
+    if ((event == NULL) || (CORE.Input.Events.frameRead >= CORE.Input.Events.frameCount)) return false;
+
+    *event = CORE.Input.Events.frame[CORE.Input.Events.frameRead];
+    CORE.Input.Events.frameRead++;
+
+    return true;
+}
+
 // Set a custom key to exit program
 // NOTE: default exitKey is ESCAPE
 void SetExitKey(int key)
@@ -3667,6 +6916,30 @@ float GetGamepadAxisMovement(int gamepad, int axis)
     return value;
 }
 
+// Get gamepad accelerometer value (G), only available on PLATFORM_NX
+Vector3 GetGamepadAccelerometer(int gamepad)
+{
+    Vector3 value = { 0.0f, 0.0f, 0.0f };
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) value = CORE.Input.Gamepad.accelerometer[gamepad];
+#endif
+
+    return value;
+}
+
+// Get gamepad gyroscope angular velocity (radians/second), only available on PLATFORM_NX
+Vector3 GetGamepadGyroscope(int gamepad)
+{
+    Vector3 value = { 0.0f, 0.0f, 0.0f };
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad]) value = CORE.Input.Gamepad.gyroscope[gamepad];
+#endif
+
+    return value;
+}
+
 // Check if a gamepad button has been pressed once
 bool IsGamepadButtonPressed(int gamepad, int button)
 {
@@ -3711,6 +6984,19 @@ bool IsGamepadButtonUp(int gamepad, int button)
     return result;
 }
 
+// Get time of last gamepad button press or release (GetTime() base), only available on PLATFORM_NX
+// NOTE: Native input samples buttons on a high-rate thread, time is the sample time, not the frame time
+double GetGamepadButtonTime(int gamepad, int button)
+{
+    double time = 0.0;
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    if ((gamepad < MAX_GAMEPADS) && CORE.Input.Gamepad.ready[gamepad] && (button < MAX_GAMEPAD_BUTTONS)) time = CORE.Input.Gamepad.buttonTime[gamepad][button];
+#endif
+
+    return time;
+}
+
 // Get the last gamepad button pressed
 int GetGamepadButtonPressed(void)
 {
@@ -3875,7 +7161,7 @@ void SetMouseCursor(int cursor)
 // Get touch position X for touch point 0 (relative to screen size)
 int GetTouchX(void)
 {
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(SUPPORT_NX_HID_INPUT)
     return (int)CORE.Input.Touch.position[0].x;
 #else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
     return GetMouseX();
@@ -3885,7 +7171,7 @@ int GetTouchX(void)
 // Get touch position Y for touch point 0 (relative to screen size)
 int GetTouchY(void)
 {
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB)
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_WEB) || defined(SUPPORT_NX_HID_INPUT)
     return (int)CORE.Input.Touch.position[0].y;
 #else   // PLATFORM_DESKTOP, PLATFORM_RPI, PLATFORM_DRM
     return GetMouseY();
@@ -3919,7 +7205,7 @@ Vector2 GetTouchPosition(int index)
         position.y = position.y*((float)CORE.Window.render.height/(float)CORE.Window.display.height) - CORE.Window.renderOffset.y/2;
     }
 #endif
-#if defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+#if defined(PLATFORM_WEB) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(SUPPORT_NX_HID_INPUT)
     if (index < MAX_TOUCH_POINTS) position = CORE.Input.Touch.position[index];
     else TRACELOG(LOG_WARNING, "INPUT: Required touch point out of range (Max touch points: %i)", MAX_TOUCH_POINTS);
 #endif
@@ -3960,7 +7246,7 @@ static bool InitGraphicsDevice(int width, int height)
     // NOTE: Framebuffer (render area - CORE.Window.render.width, CORE.Window.render.height) could include black bars...
     // ...in top-down or left-right to match display aspect ratio (no weird scalings)
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
     glfwSetErrorCallback(ErrorCallback);
 /*
     // TODO: Setup GLFW custom allocators to match raylib ones
@@ -4111,6 +7397,16 @@ static bool InitGraphicsDevice(int width, int height)
 #endif
     }
 
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    // Headless mode (GLFW null platform): offscreen OSMesa context, no window shown and no input available
+    // NOTE: Only OpenGL contexts are supported (no OpenGL ES), framebuffer size is the requested screen size
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    CORE.Window.fullscreen = false;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Headless mode, rendering to offscreen context");
+#endif
+
 #if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX)
     // NOTE: GLFW 3.4+ defers initialization of the Joystick subsystem on the first call to any Joystick related functions.
     // Forcing this initialization here avoids doing it on PollInputEvents() called by EndDrawing() after first frame has been just drawn.
@@ -4684,11 +7980,193 @@ static bool InitGraphicsDevice(int width, int height)
     }
 #endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
 
-    // Load OpenGL extensions
-    // NOTE: GL procedures address loader is required to load extensions
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    rlLoadExtensions(glfwGetProcAddress);
-#else
+#if defined(PLATFORM_3DS)
+    // NOTE: Top screen framebuffer is fixed (400x240), requested size is ignored,
+    // PICA200 framebuffers are stored rotated (240x400), rlgl_c3d.h rotates drawing to landscape orientation
+    gfxInitDefault();
+
+    if (!C3D_Init(C3D_DEFAULT_CMDBUF_SIZE))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize citro3d");
+        gfxExit();
+        return false;
+    }
+
+    CORE.N3ds.target = C3D_RenderTargetCreate(N3DS_TOP_SCREEN_HEIGHT, N3DS_TOP_SCREEN_WIDTH, GPU_RB_RGBA8, GPU_RB_DEPTH24_STENCIL8);
+
+    if (CORE.N3ds.target == NULL)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create top screen render target");
+        C3D_Fini();
+        gfxExit();
+        return false;
+    }
+
+    C3D_RenderTargetSetOutput(CORE.N3ds.target, GFX_TOP, GFX_LEFT, N3DS_DISPLAY_TRANSFER_FLAGS);
+
+    // Right eye render target, only drawn while stereoscopic 3D is enabled (3D slider up)
+    // NOTE: Stereo is not available if right eye target can not be created, drawing is mono
+    CORE.N3ds.targetRight = C3D_RenderTargetCreate(N3DS_TOP_SCREEN_HEIGHT, N3DS_TOP_SCREEN_WIDTH, GPU_RB_RGBA8, GPU_RB_DEPTH24_STENCIL8);
+
+    if (CORE.N3ds.targetRight != NULL) C3D_RenderTargetSetOutput(CORE.N3ds.targetRight, GFX_TOP, GFX_RIGHT, N3DS_DISPLAY_TRANSFER_FLAGS);
+    else TRACELOG(LOG_WARNING, "DISPLAY: Failed to create right eye render target, stereoscopic 3D not available");
+
+    CORE.Window.display.width = N3DS_TOP_SCREEN_WIDTH;
+    CORE.Window.display.height = N3DS_TOP_SCREEN_HEIGHT;
+    CORE.Window.screen.width = N3DS_TOP_SCREEN_WIDTH;
+    CORE.Window.screen.height = N3DS_TOP_SCREEN_HEIGHT;
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+    CORE.Window.fullscreen = true;
+    CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+
+    if (!c3dglCreateContext(CORE.N3ds.target, CORE.Window.screen.width, CORE.Window.screen.height))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create citro3d GL context");
+        if (CORE.N3ds.targetRight != NULL) C3D_RenderTargetDelete(CORE.N3ds.targetRight);
+        C3D_RenderTargetDelete(CORE.N3ds.target);
+        CORE.N3ds.targetRight = NULL;
+        CORE.N3ds.target = NULL;
+        C3D_Fini();
+        gfxExit();
+        return false;
+    }
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+#endif  // PLATFORM_3DS
+
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    // NOTE: Default native window is always fullscreen, requested size is ignored, framebuffer is created
+    // at docked size and cropped to current operation mode size (SetupOperationMode()), no surface recreation required
+    CORE.Nx.window = nwindowGetDefault();
+    nwindowSetDimensions(CORE.Nx.window, NX_FRAMEBUFFER_WIDTH, NX_FRAMEBUFFER_HEIGHT);
+
+    CORE.Nx.eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if ((CORE.Nx.eglDisplay == EGL_NO_DISPLAY) || !eglInitialize(CORE.Nx.eglDisplay, NULL, NULL))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL display");
+        CORE.Nx.eglDisplay = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (CORE.Window.flags & FLAG_MSAA_4X_HINT)
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+    }
+
+    const EGLint framebufferAttribs[] =
+    {
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,    // Type of context support
+#else
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,        // Type of context support
+#endif
+        EGL_RED_SIZE, 8,            // RED color bit depth
+        EGL_GREEN_SIZE, 8,          // GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // ALPHA bit depth
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size
+        EGL_STENCIL_SIZE, 8,        // Stencil buffer size
+        EGL_SAMPLE_BUFFERS, sampleBuffer,    // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated
+        EGL_NONE
+    };
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_CLIENT_VERSION, 2,
+        EGL_NONE
+    };
+
+    eglBindAPI(EGL_OPENGL_ES_API);
+#else
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    #if defined(GRAPHICS_API_OPENGL_43)
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+    #else
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+    #endif
+        EGL_NONE
+    };
+
+    eglBindAPI(EGL_OPENGL_API);
+#endif
+
+    EGLConfig config = NULL;
+    EGLint numConfigs = 0;
+
+    if (!eglChooseConfig(CORE.Nx.eglDisplay, framebufferAttribs, &config, 1, &numConfigs) || (numConfigs == 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to get EGL framebuffer config");
+        eglTerminate(CORE.Nx.eglDisplay);
+        CORE.Nx.eglDisplay = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    CORE.Nx.eglSurface = eglCreateWindowSurface(CORE.Nx.eglDisplay, config, (EGLNativeWindowType)CORE.Nx.window, NULL);
+    CORE.Nx.eglContext = eglCreateContext(CORE.Nx.eglDisplay, config, EGL_NO_CONTEXT, contextAttribs);
+
+    if ((CORE.Nx.eglSurface == EGL_NO_SURFACE) || (CORE.Nx.eglContext == EGL_NO_CONTEXT) ||
+        !eglMakeCurrent(CORE.Nx.eglDisplay, CORE.Nx.eglSurface, CORE.Nx.eglSurface, CORE.Nx.eglContext))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL surface and context (error: 0x%04x)", eglGetError());
+        if (CORE.Nx.eglContext != EGL_NO_CONTEXT) eglDestroyContext(CORE.Nx.eglDisplay, CORE.Nx.eglContext);
+        if (CORE.Nx.eglSurface != EGL_NO_SURFACE) eglDestroySurface(CORE.Nx.eglDisplay, CORE.Nx.eglSurface);
+        eglTerminate(CORE.Nx.eglDisplay);
+        CORE.Nx.eglDisplay = EGL_NO_DISPLAY;
+        CORE.Nx.eglSurface = EGL_NO_SURFACE;
+        CORE.Nx.eglContext = EGL_NO_CONTEXT;
+        return false;
+    }
+
+    // Try to enable GPU V-Sync, so frames are limited to screen refresh rate (60Hz -> 60 FPS)
+    eglSwapInterval(CORE.Nx.eglDisplay, ((CORE.Window.flags & FLAG_VSYNC_HINT) > 0)? 1 : 0);
+
+    // Framebuffer visible region for current operation mode, updated by SetupOperationMode() on mode changes
+    CORE.Nx.operationMode = appletGetOperationMode();
+    int modeWidth = (CORE.Nx.operationMode == AppletOperationMode_Console)? 1920 : 1280;
+    int modeHeight = (CORE.Nx.operationMode == AppletOperationMode_Console)? 1080 : 720;
+    nwindowSetCrop(CORE.Nx.window, 0, NX_FRAMEBUFFER_HEIGHT - modeHeight, modeWidth, NX_FRAMEBUFFER_HEIGHT);
+
+    CORE.Window.display.width = modeWidth;
+    CORE.Window.display.height = modeHeight;
+    CORE.Window.screen.width = modeWidth;
+    CORE.Window.screen.height = modeHeight;
+    CORE.Window.render.width = modeWidth;
+    CORE.Window.render.height = modeHeight;
+    CORE.Window.currentFbo.width = modeWidth;
+    CORE.Window.currentFbo.height = modeHeight;
+    CORE.Window.fullscreen = true;
+    CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+#endif  // SUPPORT_NX_NATIVE_PLATFORM
+
+    // Load OpenGL extensions
+    // NOTE: GL procedures address loader is required to load extensions
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
+    rlLoadExtensions(glfwGetProcAddress);
+#elif defined(PLATFORM_3DS)
+    rlLoadExtensions(c3dglGetProcAddress);
+#else
     rlLoadExtensions(eglGetProcAddress);
 #endif
 
@@ -4717,6 +8195,12 @@ static void SetupViewport(int width, int height)
     CORE.Window.render.width = width;
     CORE.Window.render.height = height;
 
+#if defined(RENDER_THREAD_SUPPORTED)
+    // Viewport is set by render thread when window is resized while recording
+    int size[2] = { width, height };
+    if (CORE.RenderThread.recording && RecordRedrawCall(REDRAW_SETUP_VIEWPORT, size, 2*sizeof(int))) return;
+#endif
+
     // Set viewport width and height
     // NOTE: We consider render size (scaled) and offset in case black bars are required and
     // render area does not match full display area (this situation is only applicable on fullscreen mode)
@@ -4739,461 +8223,2888 @@ static void SetupViewport(int width, int height)
     rlLoadIdentity();                   // Reset current matrix (modelview)
 }
 
-// Compute framebuffer size relative to screen size and display size
-// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
-static void SetupFramebuffer(int width, int height)
+#if defined(SUPPORT_SHADER_REFLECTION)
+// Hash shader uniform or attribute name (FNV-1a)
+static unsigned int HashShaderReflectionName(const char *name, int length)
 {
-    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
-    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
-    {
-        TRACELOG(LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
-
-        // Downscaling to fit display with border-bars
-        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
-        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
-
-        if (widthRatio <= heightRatio)
-        {
-            CORE.Window.render.width = CORE.Window.display.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
-        }
-        else
-        {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
-            CORE.Window.render.height = CORE.Window.display.height;
-            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
-            CORE.Window.renderOffset.y = 0;
-        }
+    unsigned int hash = 2166136261u;
 
-        // Screen scaling required
-        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
-        CORE.Window.screenScale = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+    for (int i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
 
-        // NOTE: We render to full display resolution!
-        // We just need to calculate above parameters for downscale matrix and offsets
-        CORE.Window.render.width = CORE.Window.display.width;
-        CORE.Window.render.height = CORE.Window.display.height;
+    return hash;
+}
 
-        TRACELOG(LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
-    }
-    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+// Add shader reflection entry, table grown as required
+static int AddShaderReflectionEntry(ShaderReflection *reflection, const char *name, int length, int location, bool attrib)
+{
+    if (reflection->count >= reflection->capacity)
     {
-        // Required screen size is smaller than display size
-        TRACELOG(LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+        int capacity = (reflection->capacity > 0)? reflection->capacity*2 : 16;
+        ShaderReflectionEntry *entries = (ShaderReflectionEntry *)RL_REALLOC(reflection->entries, capacity*sizeof(ShaderReflectionEntry));
+        int *slots = (int *)RL_REALLOC(reflection->slots, 2*capacity*sizeof(int));
 
-        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        if ((entries == NULL) || (slots == NULL))
         {
-            CORE.Window.screen.width = CORE.Window.display.width;
-            CORE.Window.screen.height = CORE.Window.display.height;
+            if (entries != NULL) reflection->entries = entries;
+            if (slots != NULL) reflection->slots = slots;
+            return -1;
         }
 
-        // Upscaling to fit display with border-bars
-        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
-        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
+        reflection->entries = entries;
+        reflection->slots = slots;
+        reflection->capacity = capacity;
 
-        if (displayRatio <= screenRatio)
-        {
-            CORE.Window.render.width = CORE.Window.screen.width;
-            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
-            CORE.Window.renderOffset.x = 0;
-            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
-        }
-        else
+        // Rehash entries into grown slots
+        for (int i = 0; i < 2*capacity; i++) reflection->slots[i] = -1;
+        for (int i = 0; i < reflection->count; i++)
         {
-            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
-            CORE.Window.render.height = CORE.Window.screen.height;
-            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
-            CORE.Window.renderOffset.y = 0;
+            unsigned int slot = reflection->entries[i].hash%(2*capacity);
+            while (reflection->slots[slot] != -1) slot = (slot + 1)%(2*capacity);
+            reflection->slots[slot] = i;
         }
     }
-    else
-    {
-        CORE.Window.render.width = CORE.Window.screen.width;
-        CORE.Window.render.height = CORE.Window.screen.height;
-        CORE.Window.renderOffset.x = 0;
-        CORE.Window.renderOffset.y = 0;
-    }
-}
-
-// Initialize hi-resolution timer
-static void InitTimer(void)
-{
-// Setting a higher resolution can improve the accuracy of time-out intervals in wait functions.
-// However, it can also reduce overall system performance, because the thread scheduler switches tasks more often.
-// High resolutions can also prevent the CPU power management system from entering power-saving modes.
-// Setting a higher resolution does not improve the accuracy of the high-resolution performance counter.
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
-    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
-#endif
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    struct timespec now = { 0 };
+    int index = reflection->count;
+    ShaderReflectionEntry *entry = &reflection->entries[index];
 
-    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    memset(entry, 0, sizeof(ShaderReflectionEntry));
+    entry->hash = HashShaderReflectionName(name, length);
+    entry->name = (char *)RL_MALLOC(length + 1);
+    if (entry->name != NULL)
     {
-        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+        memcpy(entry->name, name, length);
+        entry->name[length] = '\0';
     }
-    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
-#endif
-
-    CORE.Time.previous = GetTime();     // Get time as double
-}
-
-// Wait for some milliseconds (stop program execution)
-// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
-// take longer than expected... for that reason we use the busy wait loop
-// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
-// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timming on Win32!
-void WaitTime(float ms)
-{
-#if defined(SUPPORT_BUSY_WAIT_LOOP)
-    double previousTime = GetTime();
-    double currentTime = 0.0;
+    entry->location = location;
+    entry->attrib = attrib;
 
-    // Busy wait loop
-    while ((currentTime - previousTime) < ms/1000.0f) currentTime = GetTime();
-#else
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double busyWait = ms*0.05;     // NOTE: We are using a busy wait of 5% of the time
-        ms -= (float)busyWait;
-    #endif
+    unsigned int slot = entry->hash%(2*reflection->capacity);
+    while (reflection->slots[slot] != -1) slot = (slot + 1)%(2*reflection->capacity);
+    reflection->slots[slot] = index;
 
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned int)ms);
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__) || defined(__SWITCH__)
-        struct timespec req = { 0 };
-        time_t sec = (int)(ms/1000.0f);
-        ms -= (sec*1000);
-        req.tv_sec = sec;
-        req.tv_nsec = ms*1000000L;
+    reflection->count++;
 
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
-        while (nanosleep(&req, &req) == -1) continue;
-    #endif
-    #if defined(__APPLE__)
-        usleep(ms*1000.0f);
-    #endif
+    return index;
+}
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double previousTime = GetTime();
-        double currentTime = 0.0;
+// Free shader reflection data
+static void FreeShaderReflection(ShaderReflection *reflection)
+{
+    if (reflection == NULL) return;
 
-        // Partial busy wait loop (only a fraction of the total wait time)
-        while ((currentTime - previousTime) < (busyWait/1000.0f)) currentTime = GetTime();
-    #endif
-#endif
+    for (int i = 0; i < reflection->count; i++) RL_FREE(reflection->entries[i].name);
+    RL_FREE(reflection->entries);
+    RL_FREE(reflection->slots);
+    RL_FREE(reflection);
 }
 
-// Swap back buffer with front buffer (screen drawing)
-void SwapScreenBuffer(void)
+// Load shader active uniforms and attributes reflection (replaces previous one)
+// NOTE: Arrays are also reflected without "[0]" suffix, as usually requested by users
+static ShaderReflection *LoadShaderReflection(unsigned int shaderId)
 {
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    glfwSwapBuffers(CORE.Window.handle);
-#endif
+    if (shaderId == 0) return NULL;
 
-#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+    if (shaderId >= CORE.Shaders.capacity)
+    {
+        unsigned int capacity = (CORE.Shaders.capacity > 0)? CORE.Shaders.capacity : 16;
+        while (capacity <= shaderId) capacity *= 2;
 
-#if defined(PLATFORM_DRM)
+        ShaderReflection **reflections = (ShaderReflection **)RL_REALLOC(CORE.Shaders.reflections, capacity*sizeof(ShaderReflection *));
+        if (reflections == NULL) return NULL;
 
-    if (!CORE.Window.gbmSurface || (-1 == CORE.Window.fd) || !CORE.Window.connector || !CORE.Window.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+        for (unsigned int i = CORE.Shaders.capacity; i < capacity; i++) reflections[i] = NULL;
+        CORE.Shaders.reflections = reflections;
+        CORE.Shaders.capacity = capacity;
+    }
 
-    struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
-    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+    FreeShaderReflection(CORE.Shaders.reflections[shaderId]);
+    CORE.Shaders.reflections[shaderId] = NULL;
 
-    uint32_t fb = 0;
-    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+    ShaderReflection *reflection = (ShaderReflection *)RL_CALLOC(1, sizeof(ShaderReflection));
+    if (reflection == NULL) return NULL;
 
-    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
-    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+    char name[256] = { 0 };
+    int uniformCount = rlGetActiveUniformCount(shaderId);
+    int attribCount = rlGetActiveAttribCount(shaderId);
 
-    if (CORE.Window.prevFB)
+    for (int i = 0; i < uniformCount; i++)
     {
-        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
-        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+        int size = 0;
+        int location = rlGetActiveUniform(shaderId, i, name, sizeof(name), &size);
+        int length = (int)strlen(name);
+
+        if (length == 0) continue;
+        AddShaderReflectionEntry(reflection, name, length, location, false);
+
+        if ((length > 3) && (strcmp(name + length - 3, "[0]") == 0)) AddShaderReflectionEntry(reflection, name, length - 3, location, false);
     }
 
-    CORE.Window.prevFB = fb;
+    for (int i = 0; i < attribCount; i++)
+    {
+        int size = 0;
+        int location = rlGetActiveAttrib(shaderId, i, name, sizeof(name), &size);
+        int length = (int)strlen(name);
 
-    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+        if (length > 0) AddShaderReflectionEntry(reflection, name, length, location, true);
+    }
 
-    CORE.Window.prevBO = bo;
+    CORE.Shaders.reflections[shaderId] = reflection;
 
-#endif  // PLATFORM_DRM
-#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
+    TRACELOG(LOG_DEBUG, "SHADER: [ID %i] Reflected %i uniforms and %i attributes", shaderId, uniformCount, attribCount);
+
+    return reflection;
+}
+
+// Unload shader reflection
+static void UnloadShaderReflection(unsigned int shaderId)
+{
+    if (shaderId >= CORE.Shaders.capacity) return;
+
+    FreeShaderReflection(CORE.Shaders.reflections[shaderId]);
+    CORE.Shaders.reflections[shaderId] = NULL;
+}
+
+// Unload all shaders reflections
+static void UnloadShaderReflections(void)
+{
+    for (unsigned int i = 0; i < CORE.Shaders.capacity; i++) FreeShaderReflection(CORE.Shaders.reflections[i]);
+
+    RL_FREE(CORE.Shaders.reflections);
+    CORE.Shaders.reflections = NULL;
+    CORE.Shaders.capacity = 0;
+}
+
+// Get shader reflection, loaded on first request
+static ShaderReflection *GetShaderReflection(unsigned int shaderId)
+{
+    if ((shaderId < CORE.Shaders.capacity) && (CORE.Shaders.reflections[shaderId] != NULL)) return CORE.Shaders.reflections[shaderId];
+
+    return LoadShaderReflection(shaderId);
+}
+
+// Get reflected entry index, driver queried and entry added if not found
+// NOTE: Failed lookups are also added (location -1), so missing uniforms are queried only once
+static int GetShaderReflectionEntry(ShaderReflection *reflection, unsigned int shaderId, const char *name, bool attrib)
+{
+    if (name == NULL) return -1;
+
+    int length = (int)strlen(name);
+    unsigned int hash = HashShaderReflectionName(name, length);
+
+    if (reflection->capacity > 0)
+    {
+        unsigned int slot = hash%(2*reflection->capacity);
+
+        while (reflection->slots[slot] != -1)
+        {
+            ShaderReflectionEntry *entry = &reflection->entries[reflection->slots[slot]];
+
+            if ((entry->hash == hash) && (entry->attrib == attrib) && (entry->name != NULL) && (strcmp(entry->name, name) == 0)) return reflection->slots[slot];
+
+            slot = (slot + 1)%(2*reflection->capacity);
+        }
+    }
+
+    int location = attrib? rlGetLocationAttrib(shaderId, name) : rlGetLocationUniform(shaderId, name);
+
+    return AddShaderReflectionEntry(reflection, name, length, location, attrib);
+}
+
+// Invalidate cached uniform value, set by location
+static void InvalidateShaderReflectionValue(unsigned int shaderId, int location)
+{
+    if ((location < 0) || (shaderId >= CORE.Shaders.capacity)) return;
+
+    ShaderReflection *reflection = CORE.Shaders.reflections[shaderId];
+    if (reflection == NULL) return;
+
+    for (int i = 0; i < reflection->count; i++)
+    {
+        if (!reflection->entries[i].attrib && (reflection->entries[i].location == location)) reflection->entries[i].valueSize = 0;
+    }
+}
+#endif
+
+// Set uniform value by handle, skipped if unchanged
+// NOTE: uniformType -1 sets a matrix 4x4
+static void SetShaderUniformValue(Shader shader, int uniform, const void *value, int uniformType, int size)
+{
+#if defined(SUPPORT_SHADER_REFLECTION)
+    ShaderReflection *reflection = GetShaderReflection(shader.id);
+    if ((reflection == NULL) || (uniform < 0) || (uniform >= reflection->count)) return;
+
+    ShaderReflectionEntry *entry = &reflection->entries[uniform];
+    if (entry->location == -1) return;
+
+    if (!entry->untracked && (entry->valueSize == size) && (memcmp(entry->value, value, size) == 0)) return;
+
+    // Set by location first (invalidates entries with same location), then cache value
+    if (uniformType == -1) SetShaderValueMatrix(shader, entry->location, *(const Matrix *)value);
+    else SetShaderValueV(shader, entry->location, value, uniformType, 1);
+
+    if (!entry->untracked)
+    {
+        memcpy(entry->value, value, size);
+        entry->valueSize = size;
+    }
+#else
+    if (uniformType == -1) SetShaderValueMatrix(shader, uniform, *(const Matrix *)value);
+    else SetShaderValueV(shader, uniform, value, uniformType, 1);
+#endif
+}
+
+// Set shader default attributes and uniforms locations (shader.locs)
+static void SetShaderDefaultLocations(Shader shader)
+{
+    // Default shader attribute locations have been binded before linking:
+    //          vertex position location    = 0
+    //          vertex texcoord location    = 1
+    //          vertex normal location      = 2
+    //          vertex color location       = 3
+    //          vertex tangent location     = 4
+    //          vertex texcoord2 location   = 5
+    //          vertex bone ids location    = 6
+    //          vertex bone weights location = 7
+
+    // NOTE: If any location is not found, loc point becomes -1
+
+    // Get handles to GLSL input attibute locations
+    shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    shader.locs[SHADER_LOC_INSTANCE_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR);
+    shader.locs[SHADER_LOC_INSTANCE_CUSTOM] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    if (shader.locs[SHADER_LOC_MATRIX_MODEL] == -1) shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM);
+    shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
+    shader.locs[SHADER_LOC_MAP_MORPH] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS);
+    shader.locs[SHADER_LOC_MORPH_TARGET_COUNT] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_TARGET_COUNT);
+    shader.locs[SHADER_LOC_MORPH_INDICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_INDICES);
+    shader.locs[SHADER_LOC_MORPH_WEIGHTS] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS);
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
+    shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
+    shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+    shader.locs[SHADER_LOC_MAP_LIGHTMAP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_LIGHTMAP);
+
+    // Get handles to GLSL uniform blocks, binded to fixed binding points shared by all shaders
+    shader.locs[SHADER_LOC_BLOCK_FRAME] = rlGetLocationUniformBlock(shader.id, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME);
+    shader.locs[SHADER_LOC_BLOCK_MATERIAL] = rlGetLocationUniformBlock(shader.id, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_MATERIAL);
+    rlSetUniformBlockBinding(shader.id, shader.locs[SHADER_LOC_BLOCK_FRAME], RL_UNIFORM_BLOCK_BINDING_FRAME);
+    rlSetUniformBlockBinding(shader.id, shader.locs[SHADER_LOC_BLOCK_MATERIAL], RL_UNIFORM_BLOCK_BINDING_MATERIAL);
+}
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Shader reload decode stage: load shader code files (worker thread)
+static bool DecodeShaderReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+    char **code = (char **)RL_CALLOC(2, sizeof(char *));
+
+    // NOTE: Missing files fail the reload, default shader code is not used instead
+    for (int i = 0; i < 2; i++)
+    {
+        if (job->fileName[i][0] == '\0') continue;
+
+        code[i] = LoadFileText(job->fileName[i]);
+
+        if (code[i] == NULL)
+        {
+            UnloadFileText(code[0]);
+            RL_FREE(code);
+            return false;
+        }
+    }
+
+    job->data = code;
+
+    return true;
+}
+
+// Shader reload upload stage: relink shader program in place and get default locations again (main thread)
+static bool UploadShaderReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+    char **code = (char **)job->data;
+    bool success = false;
+
+    if (!job->cancelled && rlReloadShaderCode(job->id, code[0], code[1]))
+    {
+        Shader shader = { job->id, (int *)job->ptr[0] };
+#if defined(SUPPORT_SHADER_REFLECTION)
+        LoadShaderReflection(shader.id);    // Relinked program locations could change
+#endif
+        SetShaderDefaultLocations(shader);
+
+        success = true;
+    }
+
+    UnloadFileText(code[0]);
+    UnloadFileText(code[1]);
+    RL_FREE(code);
+
+    return success;
+}
+
+// Watch shader code files, shader program reloaded in place when changed
+static void WatchShaderFiles(Shader shader, const char *vsFileName, const char *fsFileName)
+{
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()))
+    {
+        AssetReloadJob asset = { 0 };
+        if (vsFileName != NULL) strncpy(asset.fileName[0], vsFileName, sizeof(asset.fileName[0]) - 1);
+        if (fsFileName != NULL) strncpy(asset.fileName[1], fsFileName, sizeof(asset.fileName[1]) - 1);
+        asset.id = shader.id;
+        asset.ptr[0] = shader.locs;
+
+        WatchAsset(ASSET_WATCH_SHADER, &asset, DecodeShaderReloadJob, UploadShaderReloadJob);
+    }
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Shader async load decode stage: load shader code files (worker thread)
+// NOTE: Missing files use default shader stage, same as LoadShader()
+static bool DecodeShaderJob(void *data)
+{
+    ShaderLoadJob *job = (ShaderLoadJob *)data;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (job->fileName[i][0] != '\0') job->code[i] = LoadFileText(job->fileName[i]);
+    }
+
+    return true;
+}
+
+// Shader async load upload stage: compile shader program, finish it once ready (main thread)
+// NOTE: Stage is deferred to next frames while the driver compiles the program
+static bool UploadShaderJob(void *data)
+{
+    ShaderLoadJob *job = (ShaderLoadJob *)data;
+
+    if (!job->compiling)
+    {
+        job->shader.id = rlLoadShaderCodeAsync(job->code[0], job->code[1]);
+        job->compiling = true;
+
+        UnloadFileText(job->code[0]);
+        UnloadFileText(job->code[1]);
+        job->code[0] = NULL;
+        job->code[1] = NULL;
+    }
+
+    if (!rlIsShaderProgramReady(job->shader.id))
+    {
+        DeferAsyncJobUpload();
+        return true;
+    }
+
+    job->shader.id = rlFinishShaderProgram(job->shader.id);
+    if (job->shader.id == 0) return false;
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    job->shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) job->shader.locs[i] = -1;
+#if defined(SUPPORT_SHADER_REFLECTION)
+    if (job->shader.id != rlGetShaderIdDefault()) LoadShaderReflection(job->shader.id);
+#endif
+
+    SetShaderDefaultLocations(job->shader);
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    WatchShaderFiles(job->shader, (job->fileName[0][0] != '\0')? job->fileName[0] : NULL, (job->fileName[1][0] != '\0')? job->fileName[1] : NULL);
+#endif
+
+    return true;
+}
+#endif
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+// Update dynamic resolution scale from last measured GPU frame time
+// NOTE: GPU time is available with some frames latency, it's filtered and scale changes are limited to avoid oscillations
+static void UpdateDynamicResolution(void)
+{
+    if (!CORE.Resolution.used) return;
+    CORE.Resolution.used = false;
+
+    rlFrameStats stats = rlGetFrameStats();
+    if (stats.gpuTime <= 0.0) return;   // GPU timer queries not supported, scale not changed
+
+    if (CORE.Resolution.gpuTime <= 0.0) CORE.Resolution.gpuTime = stats.gpuTime;
+    else CORE.Resolution.gpuTime += (stats.gpuTime - CORE.Resolution.gpuTime)*0.1;
+
+    double budget = ((CORE.Time.target > 0.0)? CORE.Time.target : 1.0/60.0)*DYNAMIC_RESOLUTION_GPU_BUDGET;
+
+    // GPU cost mostly scales with pixels count (scale squared)
+    float scale = CORE.Resolution.scale*sqrtf((float)(budget/CORE.Resolution.gpuTime));
+
+    if (scale > CORE.Resolution.scale + DYNAMIC_RESOLUTION_MAX_STEP) scale = CORE.Resolution.scale + DYNAMIC_RESOLUTION_MAX_STEP;
+    else if (scale < CORE.Resolution.scale - DYNAMIC_RESOLUTION_MAX_STEP) scale = CORE.Resolution.scale - DYNAMIC_RESOLUTION_MAX_STEP;
+
+    if (scale < CORE.Resolution.minScale) scale = CORE.Resolution.minScale;
+    else if (scale > CORE.Resolution.maxScale) scale = CORE.Resolution.maxScale;
+
+    CORE.Resolution.scale = scale;
+}
+#endif
+
+#if defined(SUPPORT_PARTIAL_REDRAW) && defined(SUPPORT_MODULE_RTEXTURES)
+// Record core call on frame drawing commands, returns false if frame drawing is not recorded
+// NOTE: Call data is copied into zero initialized data, params structure must not contain padding
+static bool RecordRedrawCall(int type, const void *params, int size)
+{
+    bool recording = CORE.Redraw.recording;
+#if defined(RENDER_THREAD_SUPPORTED)
+    recording = recording || CORE.RenderThread.recording;
+#endif
+    if (!recording || !rlIsCommandListRecording()) return false;
+
+    RedrawCall call;
+    memset(&call, 0, sizeof(RedrawCall));
+
+    call.type = type;
+    if (params != NULL) memcpy(&call.params, params, size);
+
+    rlRecordCommandCallback(ReplayRedrawCall, &call, sizeof(RedrawCall));
+
+    // 3D and render texture drawing bounds on screen are unknown
+    if ((type == REDRAW_BEGIN_MODE_3D) || (type == REDRAW_BEGIN_TEXTURE_MODE)) CORE.Redraw.fullDamage = true;
+
+    return true;
+}
+
+// Replay core call recorded by RecordRedrawCall()
+static void ReplayRedrawCall(void *data)
+{
+    RedrawCall *call = (RedrawCall *)data;
+
+    switch (call->type)
+    {
+        case REDRAW_CLEAR_BACKGROUND: ClearBackground(call->params.color); break;
+        case REDRAW_BEGIN_MODE_3D: BeginMode3D(call->params.camera); break;
+        case REDRAW_END_MODE_3D: EndMode3D(); break;
+        case REDRAW_BEGIN_TEXTURE_MODE: BeginTextureMode(call->params.target); break;
+        case REDRAW_END_TEXTURE_MODE: EndTextureMode(); break;
+        case REDRAW_BEGIN_SHADER_MODE: BeginShaderMode(call->params.shader); break;
+        case REDRAW_END_SHADER_MODE: EndShaderMode(); break;
+        case REDRAW_BEGIN_BLEND_MODE: BeginBlendMode(call->params.mode); break;
+        case REDRAW_END_BLEND_MODE: EndBlendMode(); break;
+        case REDRAW_BEGIN_SCISSOR_MODE: BeginScissorMode(call->params.rec[0], call->params.rec[1], call->params.rec[2], call->params.rec[3]); break;
+        case REDRAW_END_SCISSOR_MODE: EndScissorMode(); break;
+        case REDRAW_SETUP_VIEWPORT: SetupViewport(call->params.size[0], call->params.size[1]); break;
+        default: break;
+    }
+}
+
+// Redraw frame damaged area to redraw target and copy it to screen
+// NOTE: Frame drawing is hashed by screen tiles, damage area is the bounds of tiles changed since previous frame,
+// returns false if frame has no damage (nothing drawn, previous frame kept on screen)
+static bool DrawPartialRedraw(void)
+{
+    rlEndCommandList();
+    CORE.Redraw.recording = false;
+
+    int width = CORE.Window.render.width;
+    int height = CORE.Window.render.height;
+
+    // Redraw target and tiles follow screen size, previous drawing is not valid after a resize
+    if ((CORE.Redraw.target.id == 0) || (CORE.Redraw.target.texture.width != width) || (CORE.Redraw.target.texture.height != height))
+    {
+        if (CORE.Redraw.target.id > 0) UnloadRenderTexture(CORE.Redraw.target);
+        RL_FREE(CORE.Redraw.tiles[0]);
+        RL_FREE(CORE.Redraw.tiles[1]);
+
+        CORE.Redraw.target = LoadRenderTexture(width, height);
+        CORE.Redraw.tilesX = (width + PARTIAL_REDRAW_TILE_SIZE - 1)/PARTIAL_REDRAW_TILE_SIZE;
+        CORE.Redraw.tilesY = (height + PARTIAL_REDRAW_TILE_SIZE - 1)/PARTIAL_REDRAW_TILE_SIZE;
+        CORE.Redraw.tiles[0] = (unsigned int *)RL_MALLOC(CORE.Redraw.tilesX*CORE.Redraw.tilesY*sizeof(unsigned int));
+        CORE.Redraw.tiles[1] = (unsigned int *)RL_MALLOC(CORE.Redraw.tilesX*CORE.Redraw.tilesY*sizeof(unsigned int));
+        CORE.Redraw.valid = false;
+    }
+
+    // Redraw target not available, frame is drawn as usual
+    if ((CORE.Redraw.target.id == 0) || (CORE.Redraw.tiles[0] == NULL) || (CORE.Redraw.tiles[1] == NULL))
+    {
+        rlSubmitCommandList(CORE.Redraw.list);
+        CORE.Redraw.fullDamage = false;
+        return true;
+    }
+
+    unsigned int *tiles = CORE.Redraw.tiles[CORE.Redraw.current];
+    unsigned int *previous = CORE.Redraw.tiles[1 - CORE.Redraw.current];
+
+    // Frame drawing starts with screen scaling (BeginDrawing()), draws bounds are computed in render pixels
+    rlGetCommandListTileHashes(CORE.Redraw.list, CORE.Window.screenScale, width, height, PARTIAL_REDRAW_TILE_SIZE, tiles);
+    CORE.Redraw.current = 1 - CORE.Redraw.current;
+
+    int minX = CORE.Redraw.tilesX, minY = CORE.Redraw.tilesY, maxX = -1, maxY = -1;
+
+    if (!CORE.Redraw.valid || CORE.Redraw.fullDamage)
+    {
+        minX = 0;
+        minY = 0;
+        maxX = CORE.Redraw.tilesX - 1;
+        maxY = CORE.Redraw.tilesY - 1;
+    }
+    else
+    {
+        for (int y = 0; y < CORE.Redraw.tilesY; y++)
+        {
+            for (int x = 0; x < CORE.Redraw.tilesX; x++)
+            {
+                if (tiles[y*CORE.Redraw.tilesX + x] == previous[y*CORE.Redraw.tilesX + x]) continue;
+
+                if (x < minX) minX = x;
+                if (y < minY) minY = y;
+                if (x > maxX) maxX = x;
+                if (y > maxY) maxY = y;
+            }
+        }
+    }
+
+    CORE.Redraw.valid = true;
+    CORE.Redraw.fullDamage = false;
+
+    if (maxX < 0) return false;
+
+    // Damage area scissor on redraw target (bottom-left origin)
+    int damageX = minX*PARTIAL_REDRAW_TILE_SIZE;
+    int damageY = minY*PARTIAL_REDRAW_TILE_SIZE;
+    int damageWidth = (((maxX + 1)*PARTIAL_REDRAW_TILE_SIZE < width)? (maxX + 1)*PARTIAL_REDRAW_TILE_SIZE : width) - damageX;
+    int damageHeight = (((maxY + 1)*PARTIAL_REDRAW_TILE_SIZE < height)? (maxY + 1)*PARTIAL_REDRAW_TILE_SIZE : height) - damageY;
+
+    CORE.Redraw.damage[0] = damageX;
+    CORE.Redraw.damage[1] = height - (damageY + damageHeight);
+    CORE.Redraw.damage[2] = damageWidth;
+    CORE.Redraw.damage[3] = damageHeight;
+
+    // Replay frame drawing on redraw target, only damage area is updated
+    CORE.Redraw.drawing = true;
+    BeginPartialRedrawTarget();
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));
+    rlSubmitCommandList(CORE.Redraw.list);
+    CORE.Redraw.drawing = false;
+
+    if (CORE.Redraw.targetActive) rlDisableDrawScissor();
+    rlDrawRenderBatchActive();
+    CORE.Redraw.targetActive = false;
+    EndTextureMode();
+
+    // Copy redraw target to screen, it replaces framebuffer content (no blending)
+    Texture2D texture = CORE.Redraw.target.texture;
+    rlDisableColorBlend();
+    DrawTexturePro(texture, (Rectangle){ 0, 0, (float)texture.width, (float)-texture.height },
+        (Rectangle){ 0, 0, (float)width, (float)height }, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);    // WARNING: Module required: rtextures
+    rlDrawRenderBatchActive();
+    rlEnableColorBlend();
+
+    rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));     // Following drawing keeps screen scaling (BeginDrawing())
+
+    return true;
+}
+
+// Set redraw target as current framebuffer, scissor limited to damage area
+static void BeginPartialRedrawTarget(void)
+{
+    BeginTextureMode(CORE.Redraw.target);
+
+    CORE.Redraw.targetActive = true;
+    SetPartialRedrawScissor(CORE.Redraw.damage[0], CORE.Redraw.damage[1], CORE.Redraw.damage[2], CORE.Redraw.damage[3]);
+}
+
+// Set scissor area limited to damage area (bottom-left origin)
+static void SetPartialRedrawScissor(int x, int y, int width, int height)
+{
+    int x0 = (x > CORE.Redraw.damage[0])? x : CORE.Redraw.damage[0];
+    int y0 = (y > CORE.Redraw.damage[1])? y : CORE.Redraw.damage[1];
+    int x1 = ((x + width) < (CORE.Redraw.damage[0] + CORE.Redraw.damage[2]))? (x + width) : (CORE.Redraw.damage[0] + CORE.Redraw.damage[2]);
+    int y1 = ((y + height) < (CORE.Redraw.damage[1] + CORE.Redraw.damage[3]))? (y + height) : (CORE.Redraw.damage[1] + CORE.Redraw.damage[3]);
+
+    rlEnableDrawScissor(x0, y0, (x1 > x0)? (x1 - x0) : 0, (y1 > y0)? (y1 - y0) : 0);
+}
+#endif
+
+#if defined(RENDER_THREAD_SUPPORTED)
+// Make GL context current on calling thread or release it from calling thread
+static void SetGraphicsContextCurrent(bool current)
+{
+#if defined(PLATFORM_DESKTOP) || defined(NX_USE_GLFW)
+    glfwMakeContextCurrent(current? CORE.Window.handle : NULL);
+#elif defined(SUPPORT_NX_NATIVE_PLATFORM)
+    if (current) eglMakeCurrent(CORE.Nx.eglDisplay, CORE.Nx.eglSurface, CORE.Nx.eglSurface, CORE.Nx.eglContext);
+    else eglMakeCurrent(CORE.Nx.eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+#endif
+}
+
+// End frame drawing recording, wait for render thread to finish previous frame and make GL context current
+// NOTE: Waiting here keeps at most one frame in flight, recorded lists are double-buffered
+static void FinishRenderThreadFrame(void)
+{
+    RL_PROFILE_ZONE_BEGIN(zone, "FinishRenderThreadFrame");
+
+    rlEndCommandList();
+    CORE.RenderThread.recording = false;
+
+    JOB_MUTEX_LOCK(&CORE.RenderThread.lock);
+    while (CORE.RenderThread.pending != NULL) JOB_CONDITION_WAIT(&CORE.RenderThread.signal, &CORE.RenderThread.lock);
+    JOB_MUTEX_UNLOCK(&CORE.RenderThread.lock);
+
+    SetGraphicsContextCurrent(true);
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Release GL context, pass recorded frame to render thread and begin recording next frame
+static void SubmitRenderThreadFrame(void)
+{
+    SetGraphicsContextCurrent(false);
+
+    JOB_MUTEX_LOCK(&CORE.RenderThread.lock);
+    CORE.RenderThread.pending = CORE.RenderThread.lists[CORE.RenderThread.current];
+    JOB_CONDITION_BROADCAST(&CORE.RenderThread.signal);
+    JOB_MUTEX_UNLOCK(&CORE.RenderThread.lock);
+
+    CORE.RenderThread.current = 1 - CORE.RenderThread.current;
+    rlBeginCommandList(CORE.RenderThread.lists[CORE.RenderThread.current]);
+    CORE.RenderThread.recording = true;
+}
+
+// Draw recorded frame and present it, frame render counters are measured here
+static void DrawRenderThreadFrame(rlCommandList *list)
+{
+    RL_PROFILE_ZONE_BEGIN(zone, "DrawRenderThreadFrame");
+
+    rlBeginFrameStats(GetTime());
+    rlResetDepthOrdering2D();
+
+    rlSubmitCommandList(list);
+    rlDrawRenderBatchActive();
+
+    rlEndFrameStats(GetTime());
+    SwapScreenBuffer();
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Render thread, draws and presents recorded frames until render thread is disabled
+// NOTE: GL context is released after every frame, main thread takes it on frame end
+#if defined(PLATFORM_NX)
+static void RenderThreadLoop(void *arg)
+#else
+static void *RenderThreadLoop(void *arg)
+#endif
+{
+    (void)arg;
+
+    JOB_MUTEX_LOCK(&CORE.RenderThread.lock);
+
+    while (true)
+    {
+        while (CORE.RenderThread.running && (CORE.RenderThread.pending == NULL)) JOB_CONDITION_WAIT(&CORE.RenderThread.signal, &CORE.RenderThread.lock);
+        if (CORE.RenderThread.pending == NULL) break;
+
+        rlCommandList *list = CORE.RenderThread.pending;
+        JOB_MUTEX_UNLOCK(&CORE.RenderThread.lock);
+
+        SetGraphicsContextCurrent(true);
+        DrawRenderThreadFrame(list);
+        SetGraphicsContextCurrent(false);
+
+        JOB_MUTEX_LOCK(&CORE.RenderThread.lock);
+        CORE.RenderThread.pending = NULL;
+        JOB_CONDITION_BROADCAST(&CORE.RenderThread.signal);
+    }
+
+    JOB_MUTEX_UNLOCK(&CORE.RenderThread.lock);
+
+#if !defined(PLATFORM_NX)
+    return NULL;
+#endif
+}
+
+// Record shader uniform value on frame drawing commands, returns false if frame drawing is not recorded
+// NOTE: Uniform values are copied (4 bytes components), uniform type -1 is a matrix and -2 a texture sampler
+static bool RecordShaderValueCall(Shader shader, int locIndex, const void *value, int uniformType, int count)
+{
+    if (!CORE.RenderThread.recording || !rlIsCommandListRecording() || (value == NULL) || (count <= 0)) return false;
+
+    int components = 1;
+    if (uniformType == -1) components = 16;
+    else if (uniformType <= SHADER_UNIFORM_VEC4) components = uniformType - SHADER_UNIFORM_FLOAT + 1;
+    else if (uniformType <= SHADER_UNIFORM_IVEC4) components = uniformType - SHADER_UNIFORM_INT + 1;
+
+    int size = (int)sizeof(ShaderValueCall) + components*count*4;
+    ShaderValueCall *call = (ShaderValueCall *)RL_CALLOC(1, size);
+    if (call == NULL) return false;
+
+    call->shaderId = shader.id;
+    call->locIndex = locIndex;
+    call->uniformType = uniformType;
+    call->count = count;
+    memcpy(call + 1, value, components*count*4);
+
+    rlRecordCommandCallback(ReplayShaderValueCall, call, size);
+    RL_FREE(call);
+
+    return true;
+}
+
+// Set shader uniform value recorded by RecordShaderValueCall()
+static void ReplayShaderValueCall(void *data)
+{
+    ShaderValueCall *call = (ShaderValueCall *)data;
+    const void *value = (const void *)(call + 1);
+
+    rlEnableShader(call->shaderId);
+
+    if (call->uniformType == -1) rlSetUniformMatrix(call->locIndex, *(const Matrix *)value);
+    else if (call->uniformType == -2) rlSetUniformSampler(call->locIndex, *(const unsigned int *)value);
+    else rlSetUniform(call->locIndex, value, call->uniformType, call->count);
+}
+#endif
+
+#if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+// Read current frame screen pixels into a pixel buffer, collected next frame by UpdateScreenCapture()
+// NOTE: Multiple usages requested on the same frame share the readback
+static void ReadScreenCapture(int usage, const char *fileName)
+{
+#if defined(RENDER_THREAD_SUPPORTED)
+    // Screen is read by render thread once frame drawing is submitted
+    if (CORE.RenderThread.recording && rlIsCommandListRecording())
+    {
+        ScreenCaptureCall call = { 0 };
+        call.usage = usage;
+        if (usage == SCREEN_CAPTURE_IMAGE) strncpy(call.fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+
+        rlRecordCommandCallback(ReplayScreenCapture, &call, sizeof(ScreenCaptureCall));
+        return;
+    }
+#endif
+
+    ScreenCaptureReadback *readback = &captureReadback[captureReadbackIndex];
+
+    if (readback->usage == 0)
+    {
+        Vector2 scale = GetWindowScaleDPI();
+        readback->width = (int)(CORE.Window.render.width*scale.x);
+        readback->height = (int)(CORE.Window.render.height*scale.y);
+
+        // Pixel buffer is reloaded on screen size change
+        int size = readback->width*readback->height*4;
+
+        if (readback->size != size)
+        {
+            if (readback->buffer != 0) rlUnloadPixelBuffer(readback->buffer);
+            readback->buffer = rlLoadPixelBuffer(size);
+            readback->size = size;
+        }
+
+        if (readback->buffer != 0) rlReadScreenPixelsToBuffer(readback->buffer, readback->width, readback->height);
+        else readback->pixels = rlReadScreenPixels(readback->width, readback->height);   // Pixel buffers not supported, screen read now
+    }
+
+    if (usage == SCREEN_CAPTURE_IMAGE) strcpy(readback->fileName, fileName);
+
+    readback->usage |= usage;
+}
+
+#if defined(RENDER_THREAD_SUPPORTED)
+// Read screen capture recorded by ReadScreenCapture(), frame drawing submitted until now is drawn first
+static void ReplayScreenCapture(void *data)
+{
+    ScreenCaptureCall *call = (ScreenCaptureCall *)data;
+
+    rlDrawRenderBatchActive();
+    ReadScreenCapture(call->usage, call->fileName);
+}
+#endif
+
+// Collect screen readback pixels and submit encoding job
+// NOTE: GIF frames encoding jobs are serialized, previous frame job is waited before submitting a new one
+static void CollectScreenCapture(ScreenCaptureReadback *readback)
+{
+    // Job data and pixels are allocated together, so they are released together
+    ScreenCaptureJob *job = (ScreenCaptureJob *)RL_CALLOC(1, sizeof(ScreenCaptureJob) + readback->size);
+    job->pixels = (unsigned char *)(job + 1);
+    job->width = readback->width;
+    job->height = readback->height;
+    job->usage = readback->usage;
+    strcpy(job->fileName, readback->fileName);
+
+    bool collected = false;
+
+    if (readback->buffer != 0)
+    {
+        unsigned char *pixels = (unsigned char *)rlMapPixelBuffer(readback->buffer, readback->size);
+
+        if (pixels != NULL)
+        {
+            memcpy(job->pixels, pixels, readback->size);
+            collected = true;
+        }
+
+        rlUnmapPixelBuffer(readback->buffer);
+    }
+    else if (readback->pixels != NULL)
+    {
+        memcpy(job->pixels, readback->pixels, readback->size);
+        job->flipped = true;
+        collected = true;
+
+        RL_FREE(readback->pixels);
+        readback->pixels = NULL;
+    }
+
+    readback->usage = 0;
+
+    if (!collected)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to read screen capture pixels");
+        RL_FREE(job);
+        return;
+    }
+
+    if (job->usage & SCREEN_CAPTURE_GIF_FRAME) ReleaseAsyncJob(captureGifJob);
+
+    // Oldest job in flight is waited if all job slots are used
+    ReleaseAsyncJob(captureJobs[captureJobsIndex]);
+
+    unsigned int handle = SubmitAsyncJob(ASYNC_JOB_SCREEN_CAPTURE, job, EncodeScreenCaptureJob, NULL);
+
+    captureJobs[captureJobsIndex] = handle;
+    captureJobsIndex = (captureJobsIndex + 1)%MAX_SCREEN_CAPTURE_JOBS;
+
+    if (job->usage & SCREEN_CAPTURE_GIF_FRAME) captureGifJob = handle;
+}
+
+// Collect previous frame readback and release finished encoding jobs
+// NOTE: Current frame readback is queued on GPU before previous one is mapped (double-buffered)
+static void UpdateScreenCapture(void)
+{
+    ScreenCaptureReadback *readback = &captureReadback[(captureReadbackIndex + 1)%2];
+    if (readback->usage != 0) CollectScreenCapture(readback);
+
+    captureReadbackIndex = (captureReadbackIndex + 1)%2;
+
+    for (int i = 0; i < MAX_SCREEN_CAPTURE_JOBS; i++)
+    {
+        if ((captureJobs[i] != 0) && (GetAsyncLoadState(captureJobs[i]) != ASYNC_LOAD_PENDING))
+        {
+            ReleaseAsyncJob(captureJobs[i]);
+            captureJobs[i] = 0;
+        }
+    }
+}
+
+// Collect pending readbacks and wait for encoding jobs to finish
+static void FlushScreenCapture(void)
+{
+    // Older readback is collected first
+    for (int i = 1; i <= 2; i++)
+    {
+        ScreenCaptureReadback *readback = &captureReadback[(captureReadbackIndex + i)%2];
+        if (readback->usage != 0) CollectScreenCapture(readback);
+    }
+
+    for (int i = 0; i < MAX_SCREEN_CAPTURE_JOBS; i++)
+    {
+        ReleaseAsyncJob(captureJobs[i]);
+        captureJobs[i] = 0;
+    }
+
+    captureGifJob = 0;
+}
+
+// Flush screen capture and unload pixel buffers
+static void UnloadScreenCapture(void)
+{
+    FlushScreenCapture();
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (captureReadback[i].buffer != 0) rlUnloadPixelBuffer(captureReadback[i].buffer);
+    }
+
+    memset(captureReadback, 0, sizeof(captureReadback));
+    captureFileName[0] = '\0';
+}
+
+// Flip and encode screen capture, runs as async load job decode stage (worker thread)
+// NOTE: Pixels are read from framebuffer bottom-left origin, alpha is not retrieved (see rlReadScreenPixels())
+static bool EncodeScreenCaptureJob(void *data)
+{
+    ScreenCaptureJob *job = (ScreenCaptureJob *)data;
+    int stride = job->width*4;
+
+    if (!job->flipped)
+    {
+        unsigned char *line = (unsigned char *)RL_MALLOC(stride);
+
+        for (int y = 0; y < job->height/2; y++)
+        {
+            unsigned char *top = job->pixels + y*stride;
+            unsigned char *bottom = job->pixels + (job->height - 1 - y)*stride;
+
+            memcpy(line, top, stride);
+            memcpy(top, bottom, stride);
+            memcpy(bottom, line, stride);
+        }
+
+        RL_FREE(line);
+
+        for (int i = 3; i < stride*job->height; i += 4) job->pixels[i] = 255;
+    }
+
+#if defined(SUPPORT_GIF_RECORDING)
+    if (job->usage & SCREEN_CAPTURE_GIF_FRAME) msf_gif_frame(&gifState, job->pixels, 10, 16, stride);
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    if (job->usage & SCREEN_CAPTURE_IMAGE)
+    {
+        Image image = { job->pixels, job->width, job->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+    #if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+        if (CORE.Nx.albumReady) return SaveAlbumScreenshot(image);
+    #endif
+
+        if (!ExportImage(image, job->fileName)) return false;    // WARNING: Module required: rtextures
+
+    #if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+        emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(job->fileName), GetFileName(job->fileName)));
+    #endif
+
+        TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", job->fileName);
+    }
+#endif
+
+    return true;
+}
+#endif  // SUPPORT_ASYNC_SCREEN_CAPTURE
+
+#if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+// Save screenshot to console album, image is resized to album screenshots size if required
+// NOTE: Called from async load worker threads when screen capture is async, album service calls are thread-safe
+static bool SaveAlbumScreenshot(Image image)
+{
+    Image album = image;
+
+    if ((image.width != NX_ALBUM_SCREENSHOT_WIDTH) || (image.height != NX_ALBUM_SCREENSHOT_HEIGHT))
+    {
+        album = ImageCopy(image);
+        ImageResize(&album, NX_ALBUM_SCREENSHOT_WIDTH, NX_ALBUM_SCREENSHOT_HEIGHT);     // WARNING: Module required: rtextures
+    }
+
+    CapsApplicationAlbumEntry entry = { 0 };
+    Result result = capssuSaveScreenShot(album.data, NX_ALBUM_SCREENSHOT_WIDTH*NX_ALBUM_SCREENSHOT_HEIGHT*4,
+        AlbumReportOption_Enable, AlbumImageOrientation_Degrees0, &entry);
+
+    if (album.data != image.data) UnloadImage(album);
+
+    if (R_FAILED(result))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to save screenshot to album (result: 0x%x)", result);
+        return false;
+    }
+
+    TRACELOG(LOG_INFO, "SYSTEM: Screenshot saved to album successfully");
+    return true;
+}
+#endif
+
+// Compute framebuffer size relative to screen size and display size
+// NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
+static void SetupFramebuffer(int width, int height)
+{
+    // Calculate CORE.Window.render.width and CORE.Window.render.height, we have the display size (input params) and the desired screen size (global var)
+    if ((CORE.Window.screen.width > CORE.Window.display.width) || (CORE.Window.screen.height > CORE.Window.display.height))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Downscaling required: Screen size (%ix%i) is bigger than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+
+        // Downscaling to fit display with border-bars
+        float widthRatio = (float)CORE.Window.display.width/(float)CORE.Window.screen.width;
+        float heightRatio = (float)CORE.Window.display.height/(float)CORE.Window.screen.height;
+
+        if (widthRatio <= heightRatio)
+        {
+            CORE.Window.render.width = CORE.Window.display.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.height*widthRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.display.height - CORE.Window.render.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.width*heightRatio);
+            CORE.Window.render.height = CORE.Window.display.height;
+            CORE.Window.renderOffset.x = (CORE.Window.display.width - CORE.Window.render.width);
+            CORE.Window.renderOffset.y = 0;
+        }
+
+        // Screen scaling required
+        float scaleRatio = (float)CORE.Window.render.width/(float)CORE.Window.screen.width;
+        CORE.Window.screenScale = MatrixScale(scaleRatio, scaleRatio, 1.0f);
+
+        // NOTE: We render to full display resolution!
+        // We just need to calculate above parameters for downscale matrix and offsets
+        CORE.Window.render.width = CORE.Window.display.width;
+        CORE.Window.render.height = CORE.Window.display.height;
+
+        TRACELOG(LOG_WARNING, "DISPLAY: Downscale matrix generated, content will be rendered at (%ix%i)", CORE.Window.render.width, CORE.Window.render.height);
+    }
+    else if ((CORE.Window.screen.width < CORE.Window.display.width) || (CORE.Window.screen.height < CORE.Window.display.height))
+    {
+        // Required screen size is smaller than display size
+        TRACELOG(LOG_INFO, "DISPLAY: Upscaling required: Screen size (%ix%i) smaller than display size (%ix%i)", CORE.Window.screen.width, CORE.Window.screen.height, CORE.Window.display.width, CORE.Window.display.height);
+
+        if ((CORE.Window.screen.width == 0) || (CORE.Window.screen.height == 0))
+        {
+            CORE.Window.screen.width = CORE.Window.display.width;
+            CORE.Window.screen.height = CORE.Window.display.height;
+        }
+
+        // Upscaling to fit display with border-bars
+        float displayRatio = (float)CORE.Window.display.width/(float)CORE.Window.display.height;
+        float screenRatio = (float)CORE.Window.screen.width/(float)CORE.Window.screen.height;
+
+        if (displayRatio <= screenRatio)
+        {
+            CORE.Window.render.width = CORE.Window.screen.width;
+            CORE.Window.render.height = (int)round((float)CORE.Window.screen.width/displayRatio);
+            CORE.Window.renderOffset.x = 0;
+            CORE.Window.renderOffset.y = (CORE.Window.render.height - CORE.Window.screen.height);
+        }
+        else
+        {
+            CORE.Window.render.width = (int)round((float)CORE.Window.screen.height*displayRatio);
+            CORE.Window.render.height = CORE.Window.screen.height;
+            CORE.Window.renderOffset.x = (CORE.Window.render.width - CORE.Window.screen.width);
+            CORE.Window.renderOffset.y = 0;
+        }
+    }
+    else
+    {
+        CORE.Window.render.width = CORE.Window.screen.width;
+        CORE.Window.render.height = CORE.Window.screen.height;
+        CORE.Window.renderOffset.x = 0;
+        CORE.Window.renderOffset.y = 0;
+    }
+}
+
+// Initialize hi-resolution timer
+static void InitTimer(void)
+{
+// Setting a higher resolution can improve the accuracy of time-out intervals in wait functions.
+// However, it can also reduce overall system performance, because the thread scheduler switches tasks more often.
+// High resolutions can also prevent the CPU power management system from entering power-saving modes.
+// Setting a higher resolution does not improve the accuracy of the high-resolution performance counter.
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+    timeBeginPeriod(1);                 // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    struct timespec now = { 0 };
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)  // Success
+    {
+        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+    }
+    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
+#endif
+
+#if defined(PLATFORM_3DS)
+    CORE.Time.base = svcGetSystemTick();    // ARM11 system ticks (SYSCLOCK_ARM11 Hz)
+#endif
+
+#if defined(PLATFORM_NX)
+    CORE.Time.base = armGetSystemTick();    // System counter ticks (armGetSystemTickFreq(), 19.2 MHz)
+#endif
+
+    CORE.Time.previous = GetTime();     // Get time as double
+}
+
+// Get system monotonic time in seconds, elapsed since first call
+// NOTE: Used by GetTime() while no window is initialized (GLFW timer requires glfwInit()),
+// and for initialization time measures, independent of InitTimer()
+static double GetSystemTime(void)
+{
+    static double base = -1.0;
+    double time = 0.0;
+
+#if defined(_WIN32)
+    long long int counter = 0;
+    long long int frequency = 1;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    time = (double)counter/(double)frequency;
+#elif defined(PLATFORM_3DS)
+    time = (double)svcGetSystemTick()/SYSCLOCK_ARM11;
+#elif defined(PLATFORM_NX)
+    time = (double)armGetSystemTick()/(double)armGetSystemTickFreq();
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    time = (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+
+    if (base < 0.0) base = time;
+
+    return time - base;
+}
+
+// Wait for some milliseconds (stop program execution)
+// NOTE: Sleep() granularity could be around 10 ms, it means, Sleep() could
+// take longer than expected... for that reason we use the busy wait loop
+// Ref: http://stackoverflow.com/questions/43057578/c-programming-win32-games-sleep-taking-longer-than-expected
+// Ref: http://www.geisswerks.com/ryan/FAQS/timing.html --> All about timming on Win32!
+void WaitTime(float ms)
+{
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+    double previousTime = GetTime();
+    double currentTime = 0.0;
+
+    // Busy wait loop
+    while ((currentTime - previousTime) < ms/1000.0f) currentTime = GetTime();
+#else
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        double busyWait = ms*0.05;     // NOTE: We are using a busy wait of 5% of the time
+        ms -= (float)busyWait;
+    #endif
+
+    // System halt functions
+    #if defined(_WIN32)
+        Sleep((unsigned int)ms);
+    #endif
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__) || defined(__SWITCH__)
+        struct timespec req = { 0 };
+        time_t sec = (int)(ms/1000.0f);
+        ms -= (sec*1000);
+        req.tv_sec = sec;
+        req.tv_nsec = ms*1000000L;
+
+        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated.
+        while (nanosleep(&req, &req) == -1) continue;
+    #endif
+    #if defined(__APPLE__)
+        usleep(ms*1000.0f);
+    #endif
+    #if defined(__3DS__)
+        svcSleepThread((s64)(ms*1000000.0f));
+    #endif
+
+    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+        double previousTime = GetTime();
+        double currentTime = 0.0;
+
+        // Partial busy wait loop (only a fraction of the total wait time)
+        while ((currentTime - previousTime) < (busyWait/1000.0f)) currentTime = GetTime();
+    #endif
+#endif
+}
+
+// Swap back buffer with front buffer (screen drawing)
+void SwapScreenBuffer(void)
+{
+    RL_PROFILE_ZONE_BEGIN(zone, "SwapScreenBuffer");
+    double swapTime = GetTime();        // Buffers swap start time, for frame stats
+
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    // Headless mode: nothing to present, frame is kept on offscreen buffer (readable by LoadImageFromScreen())
+#elif defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
+    glfwSwapBuffers(CORE.Window.handle);
+#elif defined(PLATFORM_3DS)
+    c3dglSwapBuffers();                 // Frame end, render target transferred to top screen framebuffer on vblank
+#elif defined(SUPPORT_NX_NATIVE_PLATFORM)
+    eglSwapBuffers(CORE.Nx.eglDisplay, CORE.Nx.eglSurface);
+#endif
+
+#if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    eglSwapBuffers(CORE.Window.device, CORE.Window.surface);
+
+#if defined(PLATFORM_DRM)
+
+    if (!CORE.Window.gbmSurface || (-1 == CORE.Window.fd) || !CORE.Window.connector || !CORE.Window.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
+
+    struct gbm_bo *bo = gbm_surface_lock_front_buffer(CORE.Window.gbmSurface);
+    if (!bo) TRACELOG(LOG_ERROR, "DISPLAY: Failed GBM to lock front buffer");
+
+    uint32_t fb = 0;
+    int result = drmModeAddFB(CORE.Window.fd, CORE.Window.connector->modes[CORE.Window.modeIndex].hdisplay, CORE.Window.connector->modes[CORE.Window.modeIndex].vdisplay, 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb);
+    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d", result);
+
+    result = drmModeSetCrtc(CORE.Window.fd, CORE.Window.crtc->crtc_id, fb, 0, 0, &CORE.Window.connector->connector_id, 1, &CORE.Window.connector->modes[CORE.Window.modeIndex]);
+    if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d", result);
+
+    if (CORE.Window.prevFB)
+    {
+        result = drmModeRmFB(CORE.Window.fd, CORE.Window.prevFB);
+        if (result != 0) TRACELOG(LOG_ERROR, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+    }
+
+    CORE.Window.prevFB = fb;
+
+    if (CORE.Window.prevBO) gbm_surface_release_buffer(CORE.Window.gbmSurface, CORE.Window.prevBO);
+
+    CORE.Window.prevBO = bo;
+
+#endif  // PLATFORM_DRM
+#endif  // PLATFORM_ANDROID || PLATFORM_RPI || PLATFORM_DRM
+
+    rlSetFrameStatsSwapTime(GetTime() - swapTime);    // Register buffers swap time (vsync wait included)
+    RL_PROFILE_ZONE_END(zone);
 }
 
 // Register all input events
 void PollInputEvents(void)
 {
-#if defined(SUPPORT_GESTURES_SYSTEM)
-    // NOTE: Gestures update must be called every frame to reset gestures correctly
-    // because ProcessGestureEvent() is just called on an event, not every frame
-    UpdateGestures();
-#endif
+    RL_PROFILE_ZONE_BEGIN(zone, "PollInputEvents");
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset input events registered
+    CORE.Input.Events.frameCount = 0;
+    CORE.Input.Events.frameRead = 0;
+
+#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = -1;
+    CORE.Input.Gamepad.axisCount = 0;
+#endif
+
+#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    PollKeyboardEvents();
+
+    // Register previous mouse states
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = 0.0f;
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+    {
+        CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+        CORE.Input.Mouse.currentButtonState[i] = CORE.Input.Mouse.currentButtonStateEvdev[i];
+    }
+
+    // Register gamepads buttons events
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i])
+        {
+            // Register previous gamepad states
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+        }
+    }
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous mouse wheel state
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = 0.0f;
+
+    // Register previous mouse position
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+#endif
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Reset touch positions
+    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
+    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
+    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+
+#if defined(SUPPORT_NX_HID_INPUT)
+    // Native input: buttons events and latest state sampled by input thread
+    PollNxInputEvents();
+#endif
+
+#if defined(SUPPORT_NX_NATIVE_PLATFORM)
+    CORE.Window.resizedLastFrame = false;
+
+    // Process applet messages, hooks run inside (focus, operation and performance mode, exit request)
+    // NOTE: appletMainLoop() blocks while application is suspended (HOME menu, sleep mode)
+    if (!appletMainLoop()) CORE.Window.shouldClose = true;
+#endif
+
+#if defined(PLATFORM_DESKTOP) || defined(NX_USE_GLFW)
+#if !defined(SUPPORT_NX_HID_INPUT)
+    // Check if gamepads are ready
+    // NOTE: We do it here in case of disconnection
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (glfwJoystickPresent(i)) CORE.Input.Gamepad.ready[i] = true;
+        else CORE.Input.Gamepad.ready[i] = false;
+    }
+
+    // Register gamepads buttons events
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
+        {
+            // Register previous gamepad states
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+
+            // Get current gamepad state
+            // NOTE: There is no callback available, so we get it manually
+            // Get remapped buttons
+            GLFWgamepadstate state = { 0 };
+            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+
+            const unsigned char *buttons = state.buttons;
+
+            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
+            {
+                GamepadButton button = -1;
+
+                switch (k)
+                {
+                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
+                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+
+                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
+                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
+                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
+                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+
+                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
+                    case GLFW_GAMEPAD_BUTTON_RIGHT_THUMB: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
+                    default: break;
+                }
+
+                if (button != -1)   // Check for valid button
+                {
+                    if (buttons[k] == GLFW_PRESS)
+                    {
+                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
+                        CORE.Input.Gamepad.lastButtonPressed = button;
+                    }
+                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                }
+            }
+
+            // Get current axis state
+            const float *axes = state.axes;
+
+            for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1) && (k < MAX_GAMEPAD_AXIS); k++)
+            {
+                CORE.Input.Gamepad.axisState[i][k] = axes[k];
+            }
+
+            // Register buttons for 2nd triggers (because GLFW doesn't count these as buttons but rather axis)
+            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
+            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
+
+            CORE.Input.Gamepad.axisCount = GLFW_GAMEPAD_AXIS_LAST + 1;
+
+            // Register gamepad buttons events, buttons state is polled once per frame
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+            {
+                if (CORE.Input.Gamepad.currentButtonState[i][k] != CORE.Input.Gamepad.previousButtonState[i][k])
+                {
+                    InputEvent event = { CORE.Input.Gamepad.currentButtonState[i][k]? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, GetTime(), i, k, { 0 } };
+                    RegisterInputEvent(event);
+                }
+            }
+        }
+    }
+#endif  // !SUPPORT_NX_HID_INPUT
+
+    CORE.Window.resizedLastFrame = false;
+
+    if (CORE.Window.eventWaiting) glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
+    else glfwPollEvents();      // Poll input events: keyboard/mouse/window events (callbacks)
+#endif  // PLATFORM_DESKTOP
+
+#if defined(PLATFORM_WEB)
+    CORE.Window.resizedLastFrame = false;
+#endif  // PLATFORM_WEB
+
+#if defined(PLATFORM_3DS)
+    // Register previous mouse states (bottom screen touch)
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    hidScanInput();
+    CORE.N3ds.keys = hidKeysHeld();
+
+    // Built-in controls are always available as first gamepad
+    CORE.Input.Gamepad.ready[0] = true;
+    for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[0][k] = CORE.Input.Gamepad.currentButtonState[0][k];
+
+    // NOTE: Buttons are mapped by position, like PLATFORM_NX (A is the right face button)
+    static const struct { u32 key; int button; } buttonsMap[] = {
+        { CTRU_KEY_A, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT }, { CTRU_KEY_B, GAMEPAD_BUTTON_RIGHT_FACE_DOWN },
+        { CTRU_KEY_X, GAMEPAD_BUTTON_RIGHT_FACE_UP }, { CTRU_KEY_Y, GAMEPAD_BUTTON_RIGHT_FACE_LEFT },
+        { KEY_DUP, GAMEPAD_BUTTON_LEFT_FACE_UP }, { KEY_DRIGHT, GAMEPAD_BUTTON_LEFT_FACE_RIGHT },
+        { KEY_DDOWN, GAMEPAD_BUTTON_LEFT_FACE_DOWN }, { KEY_DLEFT, GAMEPAD_BUTTON_LEFT_FACE_LEFT },
+        { CTRU_KEY_L, GAMEPAD_BUTTON_LEFT_TRIGGER_1 }, { CTRU_KEY_R, GAMEPAD_BUTTON_RIGHT_TRIGGER_1 },
+        { KEY_ZL, GAMEPAD_BUTTON_LEFT_TRIGGER_2 }, { KEY_ZR, GAMEPAD_BUTTON_RIGHT_TRIGGER_2 },
+        { KEY_SELECT, GAMEPAD_BUTTON_MIDDLE_LEFT }, { KEY_START, GAMEPAD_BUTTON_MIDDLE_RIGHT }
+    };
+
+    for (int k = 0; k < (int)(sizeof(buttonsMap)/sizeof(buttonsMap[0])); k++)
+    {
+        char state = ((CORE.N3ds.keys & buttonsMap[k].key) != 0);
+
+        CORE.Input.Gamepad.currentButtonState[0][buttonsMap[k].button] = state;
+        if (state) CORE.Input.Gamepad.lastButtonPressed = buttonsMap[k].button;
+    }
+
+    // Circle pad and C-stick (New 3DS only) to left/right axis, positive Y is down
+    circlePosition circle = { 0 };
+    circlePosition cstick = { 0 };
+    hidCircleRead(&circle);
+    hidCstickRead(&cstick);
+
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_LEFT_X] = Clamp((float)circle.dx/N3DS_STICK_RANGE, -1.0f, 1.0f);
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_LEFT_Y] = Clamp(-(float)circle.dy/N3DS_STICK_RANGE, -1.0f, 1.0f);
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_RIGHT_X] = Clamp((float)cstick.dx/N3DS_STICK_RANGE, -1.0f, 1.0f);
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_RIGHT_Y] = Clamp(-(float)cstick.dy/N3DS_STICK_RANGE, -1.0f, 1.0f);
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_LEFT_TRIGGER] = (CORE.N3ds.keys & KEY_ZL)? 1.0f : -1.0f;
+    CORE.Input.Gamepad.axisState[0][GAMEPAD_AXIS_RIGHT_TRIGGER] = (CORE.N3ds.keys & KEY_ZR)? 1.0f : -1.0f;
+    CORE.Input.Gamepad.axisCount = GAMEPAD_AXIS_RIGHT_TRIGGER + 1;
+
+    for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+    {
+        if (CORE.Input.Gamepad.currentButtonState[0][k] != CORE.Input.Gamepad.previousButtonState[0][k])
+        {
+            InputEvent event = { CORE.Input.Gamepad.currentButtonState[0][k]? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, GetTime(), 0, k, { 0 } };
+            RegisterInputEvent(event);
+        }
+    }
+
+    // Bottom screen touch to mouse left button and first touch point
+    // NOTE: Touch position is scaled from bottom screen to top screen size, both screens have the same height
+    bool touching = ((CORE.N3ds.keys & KEY_TOUCH) != 0);
+
+    if (touching)
+    {
+        touchPosition touch = { 0 };
+        hidTouchRead(&touch);
+
+        Vector2 position = { (float)touch.px*CORE.Window.screen.width/N3DS_BOTTOM_SCREEN_WIDTH, (float)touch.py*CORE.Window.screen.height/N3DS_BOTTOM_SCREEN_HEIGHT };
+
+        if ((position.x != CORE.Input.Mouse.currentPosition.x) || (position.y != CORE.Input.Mouse.currentPosition.y))
+        {
+            InputEvent event = { INPUT_EVENT_MOUSE_MOVE, GetTime(), 0, 0, position };
+            RegisterInputEvent(event);
+        }
+
+        CORE.Input.Mouse.currentPosition = position;
+        CORE.Input.Touch.position[0] = position;
+    }
+
+    CORE.Input.Touch.currentTouchState[0] = touching;
+    CORE.Input.Touch.pointCount = touching? 1 : 0;
+
+    if (CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] != (char)touching)
+    {
+        CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = touching;
+
+        InputEvent event = { touching? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, GetTime(), 0, MOUSE_BUTTON_LEFT, { 0 } };
+        RegisterInputEvent(event);
+    }
+
+    // Stereoscopic 3D follows 3D slider for next frame, slider down falls back to mono (right eye not drawn)
+    float slider = (CORE.N3ds.targetRight != NULL)? osGet3DSliderState() : 0.0f;
+    bool stereo = (slider > 0.0f);
+
+    if (stereo != CORE.N3ds.stereo)
+    {
+        gfxSet3D(stereo);
+        c3dglSetStereoTarget(stereo? CORE.N3ds.targetRight : NULL);
+        CORE.N3ds.stereo = stereo;
+    }
+
+    rlSetStereoScreen(slider*N3DS_STEREO_SEPARATION, N3DS_STEREO_CONVERGENCE);
+#endif  // PLATFORM_3DS
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+    // Keyboard/Mouse states are updated from input events queued by callbacks
+    ProcessInputEvents();
+#endif
+
+// Gamepad support using emscripten API
+// NOTE: GLFW3 joystick functionality not available in web
+#if defined(PLATFORM_WEB)
+    // Get number of gamepads connected
+    int numGamepads = 0;
+    if (emscripten_sample_gamepad_data() == EMSCRIPTEN_RESULT_SUCCESS) numGamepads = emscripten_get_num_gamepads();
+
+    for (int i = 0; (i < numGamepads) && (i < MAX_GAMEPADS); i++)
+    {
+        // Register previous gamepad button states
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+
+        EmscriptenGamepadEvent gamepadState;
+
+        int result = emscripten_get_gamepad_status(i, &gamepadState);
+
+        if (result == EMSCRIPTEN_RESULT_SUCCESS)
+        {
+            // Register buttons data for every connected gamepad
+            for (int j = 0; (j < gamepadState.numButtons) && (j < MAX_GAMEPAD_BUTTONS); j++)
+            {
+                GamepadButton button = -1;
+
+                // Gamepad Buttons reference: https://www.w3.org/TR/gamepad/#gamepad-interface
+                switch (j)
+                {
+                    case 0: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
+                    case 1: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
+                    case 2: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+                    case 3: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
+                    case 4: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
+                    case 5: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+                    case 6: button = GAMEPAD_BUTTON_LEFT_TRIGGER_2; break;
+                    case 7: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_2; break;
+                    case 8: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
+                    case 9: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+                    case 10: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
+                    case 11: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
+                    case 12: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
+                    case 13: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
+                    case 14: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+                    case 15: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
+                    default: break;
+                }
+
+                if (button != -1)   // Check for valid button
+                {
+                    if (gamepadState.digitalButton[j] == 1)
+                    {
+                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
+                        CORE.Input.Gamepad.lastButtonPressed = button;
+                    }
+                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                }
+
+                //TRACELOGD("INPUT: Gamepad %d, button %d: Digital: %d, Analog: %g", gamepadState.index, j, gamepadState.digitalButton[j], gamepadState.analogButton[j]);
+            }
+
+            // Register axis data for every connected gamepad
+            for (int j = 0; (j < gamepadState.numAxes) && (j < MAX_GAMEPAD_AXIS); j++)
+            {
+                CORE.Input.Gamepad.axisState[i][j] = gamepadState.axis[j];
+            }
+
+            CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
+        }
+    }
+#endif
+
+#if defined(PLATFORM_ANDROID)
+    // Register previous keys states
+    // NOTE: Android supports up to 260 keys
+    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+
+    // Android ALooper_pollAll() variables
+    int pollResult = 0;
+    int pollEvents = 0;
+
+    // Poll Events (registered events)
+    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
+    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
+    {
+        // Process this event
+        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+
+        // NOTE: Never close window, native activity is controlled by the system!
+        if (CORE.Android.app->destroyRequested != 0)
+        {
+            //CORE.Window.shouldClose = true;
+            //ANativeActivity_finish(CORE.Android.app->activity);
+        }
+    }
+#endif
+
+#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
+    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
+    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
+
+    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
+
+    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
+    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
+#endif
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Queue input event (timestamped), returns false if queue is full
+// NOTE: Single producer queue, events must be pushed from a single thread (input callbacks)
+static bool PushInputEvent(int type, int device, int code, Vector2 value)
+{
+    unsigned int head = CORE.Input.Events.head;
+    unsigned int tail = INPUT_QUEUE_LOAD(&CORE.Input.Events.tail);
+
+    if ((head - tail) >= MAX_INPUT_EVENTS)
+    {
+        TRACELOG(LOG_DEBUG, "INPUT: Input events queue full, event discarded");
+        return false;
+    }
+
+    InputEvent *event = &CORE.Input.Events.queue[head & (MAX_INPUT_EVENTS - 1)];
+    event->type = type;
+    event->time = GetTime();
+    event->device = device;
+    event->code = code;
+    event->value = value;
+
+    INPUT_QUEUE_STORE(&CORE.Input.Events.head, head + 1);
+
+    return true;
+}
+
+// Register input event on current frame events
+static void RegisterInputEvent(InputEvent event)
+{
+    if (CORE.Input.Events.frameCount < MAX_INPUT_EVENTS)
+    {
+        CORE.Input.Events.frame[CORE.Input.Events.frameCount] = event;
+        CORE.Input.Events.frameCount++;
+    }
+}
+
+#if defined(SUPPORT_FRAME_HISTORY)
+// Record last frame timing on frames history, export last frames profiling zones on hitches
+// NOTE: Trace export time is included on next frame, traces are not exported again until traced frames are renewed
+static void UpdateFrameHistory(void)
+{
+    rlFrameStats stats = rlGetFrameStats();
+    FrameTiming *timing = &CORE.FrameHistory.frames[CORE.FrameHistory.count%FRAME_HISTORY_SIZE];
+
+    timing->frameTime = (float)CORE.Time.frame;
+    timing->cpuTime = (float)(CORE.Time.update + CORE.Time.draw);
+    timing->gpuTime = (float)stats.gpuTime;
+    timing->batchFlushes = stats.batchFlushes;
+#if defined(SUPPORT_MEMORY_TRACKING)
+    timing->allocations = GetMemoryStats(MEMORY_TAG_ALL).frameAllocations;
+#else
+    timing->allocations = 0;
+#endif
+
+    CORE.FrameHistory.count++;
+
+    if (CORE.FrameHistory.hitchThreshold <= 0.0f) return;
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    // Rolling capture is restarted once a capture replacing it (StartProfileCapture()) is stopped
+    bool tracing = StartProfileHistory(FRAME_HITCH_TRACE_EVENTS);
+#endif
+
+    if (timing->frameTime <= CORE.FrameHistory.hitchThreshold) return;
+
+    CORE.FrameHistory.hitchCount++;
+
+    TRACELOG(LOG_WARNING, "TIMER: Frame %u hitch: %.2f ms (CPU: %.2f ms, GPU: %.2f ms, flushes: %i, allocations: %i)", CORE.Time.frameCounter,
+        timing->frameTime*1000.0f, timing->cpuTime*1000.0f, timing->gpuTime*1000.0f, timing->batchFlushes, timing->allocations);
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    if (tracing && (CORE.FrameHistory.count >= CORE.FrameHistory.hitchNextTrace))
+    {
+        const char *fileName = TextFormat("%s_%04i.json", CORE.FrameHistory.hitchFileName, CORE.FrameHistory.hitchCount);
+
+        if (ExportProfileHistory(fileName, CORE.FrameHistory.hitchTraceFrames)) CORE.FrameHistory.hitchNextTrace = CORE.FrameHistory.count + CORE.FrameHistory.hitchTraceFrames;
+    }
+#endif
+}
+#endif
+
+// Run fixed update steps for frame time, update interpolation factor
+// NOTE: Buttons pressed/released checks inside steps are relative to last step input state, so an edge is seen
+// by one step only, also on frames that run no step, frame previous states are restored for frame update/draw
+static void UpdateFixedSimulation(double frameTime)
+{
+    CORE.Simulation.accumulator += frameTime;
+    CORE.Simulation.steps = 0;
+
+    if (CORE.Simulation.accumulator >= CORE.Simulation.step)
+    {
+        char previousKeyState[MAX_KEYBOARD_KEYS];
+        char previousMouseState[MAX_MOUSE_BUTTONS];
+        char previousGamepadState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];
+        char previousTouchState[MAX_TOUCH_POINTS];
+
+        memcpy(previousKeyState, CORE.Input.Keyboard.previousKeyState, MAX_KEYBOARD_KEYS);
+        memcpy(previousMouseState, CORE.Input.Mouse.previousButtonState, MAX_MOUSE_BUTTONS);
+        memcpy(previousGamepadState, CORE.Input.Gamepad.previousButtonState, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+        memcpy(previousTouchState, CORE.Input.Touch.previousTouchState, MAX_TOUCH_POINTS);
+
+        while ((CORE.Simulation.accumulator >= CORE.Simulation.step) && (CORE.Simulation.steps < FIXED_UPDATE_MAX_STEPS))
+        {
+            memcpy(CORE.Input.Keyboard.previousKeyState, CORE.Simulation.previousKeyState, MAX_KEYBOARD_KEYS);
+            memcpy(CORE.Input.Mouse.previousButtonState, CORE.Simulation.previousMouseState, MAX_MOUSE_BUTTONS);
+            memcpy(CORE.Input.Gamepad.previousButtonState, CORE.Simulation.previousGamepadState, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+            memcpy(CORE.Input.Touch.previousTouchState, CORE.Simulation.previousTouchState, MAX_TOUCH_POINTS);
+
+            if (CORE.Simulation.callback != NULL) CORE.Simulation.callback((float)CORE.Simulation.step);
+
+            // Next steps see no edges, input is the same
+            memcpy(CORE.Simulation.previousKeyState, CORE.Input.Keyboard.currentKeyState, MAX_KEYBOARD_KEYS);
+            memcpy(CORE.Simulation.previousMouseState, CORE.Input.Mouse.currentButtonState, MAX_MOUSE_BUTTONS);
+            memcpy(CORE.Simulation.previousGamepadState, CORE.Input.Gamepad.currentButtonState, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+            memcpy(CORE.Simulation.previousTouchState, CORE.Input.Touch.currentTouchState, MAX_TOUCH_POINTS);
+
+            CORE.Simulation.accumulator -= CORE.Simulation.step;
+            CORE.Simulation.steps++;
+        }
+
+        memcpy(CORE.Input.Keyboard.previousKeyState, previousKeyState, MAX_KEYBOARD_KEYS);
+        memcpy(CORE.Input.Mouse.previousButtonState, previousMouseState, MAX_MOUSE_BUTTONS);
+        memcpy(CORE.Input.Gamepad.previousButtonState, previousGamepadState, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+        memcpy(CORE.Input.Touch.previousTouchState, previousTouchState, MAX_TOUCH_POINTS);
+
+        // Simulation can't keep up (long frame or stall), remaining time is dropped
+        if (CORE.Simulation.accumulator >= CORE.Simulation.step) CORE.Simulation.accumulator = fmod(CORE.Simulation.accumulator, CORE.Simulation.step);
+    }
+
+    CORE.Simulation.alpha = (float)(CORE.Simulation.accumulator/CORE.Simulation.step);
+}
+
+#if defined(SUPPORT_JOB_SYSTEM)
+// Initialize job system, start one worker thread per available core
+// NOTE: On PLATFORM_NX, workers are pinned to application cores 1 and 2 (main thread runs on core 0)
+static void InitJobSystem(void)
+{
+    CORE.Jobs.workerCount = 0;
+
+#if defined(JOBS_THREADED)
+    int workerCount = JOB_WORKER_THREADS;
+
+    if (workerCount <= 0)
+    {
+#if defined(PLATFORM_NX)
+        workerCount = 2;
+#elif defined(_SC_NPROCESSORS_ONLN)
+        workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN) - 1;
+#else
+        workerCount = 3;
+#endif
+    }
+
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
+
+    for (int i = 0; i < MAX_JOB_WORKERS + 1; i++) JOB_MUTEX_INIT(&CORE.Jobs.queues[i].lock);
+    JOB_MUTEX_INIT(&CORE.Jobs.mainQueue.lock);
+    JOB_MUTEX_INIT(&CORE.Jobs.deferredLock);
+    JOB_MUTEX_INIT(&CORE.Jobs.sleepLock);
+    JOB_CONDITION_INIT(&CORE.Jobs.wake);
+
+    jobThreadIndex = 0;
+    JOB_ATOMIC_STORE(&CORE.Jobs.running, true);
+
+    for (int i = 0; i < workerCount; i++)
+    {
+        // NOTE: Worker index is passed as argument, its deque is queues[index + 1]
+        void *arg = (void *)(size_t)(CORE.Jobs.workerCount + 1);
+#if defined(PLATFORM_NX)
+        // Workers run with main thread priority (0x2C), 256 KB stack
+        Thread *thread = &CORE.Jobs.workers[CORE.Jobs.workerCount];
+        if (R_FAILED(threadCreate(thread, JobWorkerThread, arg, NULL, 0x40000, 0x2C, 1 + i%2))) break;
+        if (R_FAILED(threadStart(thread)))
+        {
+            threadClose(thread);
+            break;
+        }
+#else
+        if (pthread_create(&CORE.Jobs.workers[CORE.Jobs.workerCount], NULL, JobWorkerThread, arg) != 0) break;
+#endif
+        CORE.Jobs.workerCount++;
+    }
+
+    if ((workerCount > 0) && (CORE.Jobs.workerCount == 0)) TRACELOG(LOG_WARNING, "JOBS: Failed to create worker threads, jobs run on submit");
+    else TRACELOG(LOG_INFO, "JOBS: Job system initialized successfully (%i worker threads)", CORE.Jobs.workerCount);
+#endif
+}
+
+// Stop job system worker threads, remaining jobs run on main thread
+static void CloseJobSystem(void)
+{
+#if defined(JOBS_THREADED)
+    if (JOB_ATOMIC_LOAD(&CORE.Jobs.running))
+    {
+        JOB_MUTEX_LOCK(&CORE.Jobs.sleepLock);
+        JOB_ATOMIC_STORE(&CORE.Jobs.running, false);
+        JOB_CONDITION_BROADCAST(&CORE.Jobs.wake);
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.sleepLock);
+
+        for (int i = 0; i < CORE.Jobs.workerCount; i++)
+        {
+#if defined(PLATFORM_NX)
+            threadWaitForExit(&CORE.Jobs.workers[i]);
+            threadClose(&CORE.Jobs.workers[i]);
+#else
+            pthread_join(CORE.Jobs.workers[i], NULL);
+#endif
+        }
+
+        // Remaining jobs run now, so no counter is left pending
+        // NOTE: Deferred jobs are queued by the jobs they depend on
+        bool pending = true;
+
+        while (pending)
+        {
+            Job job = { 0 };
+
+            pending = RunMainThreadJobs();
+
+            if (NextJob(0, &job))
+            {
+                RunJob(&job);
+                pending = true;
+            }
+        }
+
+        CORE.Jobs.workerCount = 0;
+
+        if (CORE.Jobs.deferredCount > 0) TRACELOG(LOG_WARNING, "JOBS: %i jobs waiting for a dependency not run", CORE.Jobs.deferredCount);
+        CORE.Jobs.deferredCount = 0;
+
+        for (int i = 0; i < MAX_JOB_WORKERS + 1; i++) JOB_MUTEX_DESTROY(&CORE.Jobs.queues[i].lock);
+        JOB_MUTEX_DESTROY(&CORE.Jobs.mainQueue.lock);
+        JOB_MUTEX_DESTROY(&CORE.Jobs.deferredLock);
+        JOB_MUTEX_DESTROY(&CORE.Jobs.sleepLock);
+        JOB_CONDITION_DESTROY(&CORE.Jobs.wake);
+    }
+#endif
+}
+
+// Queue job, its dependency (if any) must be done
+// NOTE: Job runs now if no worker threads are available or deque is full
+static void QueueJob(Job job)
+{
+#if defined(JOBS_THREADED)
+    if ((CORE.Jobs.workerCount > 0) || job.mainThread)
+    {
+        JobQueue *queue = job.mainThread? &CORE.Jobs.mainQueue : &CORE.Jobs.queues[(jobThreadIndex < 0)? 0 : jobThreadIndex];
+
+        JOB_MUTEX_LOCK(&queue->lock);
+
+        bool full = ((queue->bottom - queue->top) >= MAX_JOBS_QUEUED);
+
+        if (!full)
+        {
+            queue->jobs[queue->bottom & (MAX_JOBS_QUEUED - 1)] = job;
+            queue->bottom++;
+        }
+
+        JOB_MUTEX_UNLOCK(&queue->lock);
+
+        if (!full)
+        {
+            if (job.mainThread) return;
+
+            // NOTE: Queued count is incremented before checking sleeping workers, a worker going to sleep
+            // checks queued count after incrementing sleeping count, so the wake up can not be missed
+            JOB_ATOMIC_ADD(&CORE.Jobs.queued, 1);
+
+            if (JOB_ATOMIC_LOAD(&CORE.Jobs.sleeping) > 0)
+            {
+                JOB_MUTEX_LOCK(&CORE.Jobs.sleepLock);
+                JOB_CONDITION_SIGNAL(&CORE.Jobs.wake);
+                JOB_MUTEX_UNLOCK(&CORE.Jobs.sleepLock);
+            }
+
+            return;
+        }
+
+        if (job.mainThread && (jobThreadIndex != 0))
+        {
+            // Main thread only jobs queue full, wait for main thread to run some jobs
+            while (full)
+            {
+                JOB_YIELD();
+
+                JOB_MUTEX_LOCK(&queue->lock);
+                full = ((queue->bottom - queue->top) >= MAX_JOBS_QUEUED);
+                if (!full)
+                {
+                    queue->jobs[queue->bottom & (MAX_JOBS_QUEUED - 1)] = job;
+                    queue->bottom++;
+                }
+                JOB_MUTEX_UNLOCK(&queue->lock);
+            }
+
+            return;
+        }
+    }
+#else
+    // Jobs run on submit, main thread only jobs submitted from other threads are not supported
+#endif
+
+    RunJob(&job);
+}
+
+// Run job and decrement its counter, release jobs depending on it
+static void RunJob(Job *job)
+{
+    if (job->callback != NULL) job->callback(job->data);
+    else job->rangeCallback(job->data, job->start, job->end);
+
+    if ((job->counter != NULL) && (JOB_ATOMIC_ADD(&job->counter->pending, -1) == 0))
+    {
+#if defined(JOBS_THREADED)
+        if (JOB_ATOMIC_LOAD(&CORE.Jobs.deferredCount) > 0) ReleaseDeferredJobs();
+#endif
+    }
+}
+
+// Run main thread only jobs queued (FIFO), returns true if any job was run
+// NOTE: Jobs queued by the jobs run are also run
+static bool RunMainThreadJobs(void)
+{
+    bool run = false;
+
+#if defined(JOBS_THREADED)
+    if (jobThreadIndex != 0) return false;
+
+    JobQueue *queue = &CORE.Jobs.mainQueue;
+
+    while (true)
+    {
+        Job job = { 0 };
+        bool found = false;
+
+        JOB_MUTEX_LOCK(&queue->lock);
+
+        if (queue->bottom != queue->top)
+        {
+            job = queue->jobs[queue->top & (MAX_JOBS_QUEUED - 1)];
+            queue->top++;
+            found = true;
+        }
+
+        JOB_MUTEX_UNLOCK(&queue->lock);
+
+        if (!found) break;
+
+        RunJob(&job);
+        run = true;
+    }
+#endif
+
+    return run;
+}
+
+#if defined(JOBS_THREADED)
+// Defer job until its dependency counter is done, returns false if already done (or no room to defer it)
+static bool DeferJob(Job job)
+{
+    if ((job.dependency == NULL) || (JOB_ATOMIC_LOAD(&job.dependency->pending) <= 0) || (CORE.Jobs.workerCount == 0)) return false;
+
+    bool deferred = false;
+
+    JOB_MUTEX_LOCK(&CORE.Jobs.deferredLock);
+
+    // NOTE: Deferred count is incremented before checking dependency again, the thread finishing
+    // the dependency checks deferred count after decrementing it, so the job can not be missed
+    JOB_ATOMIC_ADD(&CORE.Jobs.deferredCount, 1);
+
+    if ((JOB_ATOMIC_LOAD(&job.dependency->pending) > 0) && (CORE.Jobs.deferredCount <= MAX_JOBS_DEFERRED))
+    {
+        CORE.Jobs.deferred[CORE.Jobs.deferredCount - 1] = job;
+        deferred = true;
+    }
+    else JOB_ATOMIC_ADD(&CORE.Jobs.deferredCount, -1);
+
+    JOB_MUTEX_UNLOCK(&CORE.Jobs.deferredLock);
+
+    return deferred;
+}
+
+// Get next job: own deque bottom first (newest job), then steal from other deques top (oldest job)
+// NOTE: External threads (index -1) only steal jobs
+static bool NextJob(int index, Job *job)
+{
+    int queueCount = CORE.Jobs.workerCount + 1;
+
+    for (int i = 0; i < queueCount; i++)
+    {
+        int current = (index < 0)? i : (index + i)%queueCount;
+        JobQueue *queue = &CORE.Jobs.queues[current];
+        bool found = false;
+
+        // Avoid locking empty deques
+        if (JOB_ATOMIC_LOAD(&queue->bottom) == JOB_ATOMIC_LOAD(&queue->top)) continue;
+
+        JOB_MUTEX_LOCK(&queue->lock);
+
+        if (queue->bottom != queue->top)
+        {
+            if (current == index)
+            {
+                queue->bottom--;
+                *job = queue->jobs[queue->bottom & (MAX_JOBS_QUEUED - 1)];
+            }
+            else
+            {
+                *job = queue->jobs[queue->top & (MAX_JOBS_QUEUED - 1)];
+                queue->top++;
+            }
+
+            found = true;
+        }
+
+        JOB_MUTEX_UNLOCK(&queue->lock);
+
+        if (found)
+        {
+            JOB_ATOMIC_ADD(&CORE.Jobs.queued, -1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Queue deferred jobs with dependency counter done
+// NOTE: Jobs are queued with deferred jobs mutex unlocked, queuing can run jobs (deque full)
+static void ReleaseDeferredJobs(void)
+{
+    while (true)
+    {
+        Job job = { 0 };
+        bool found = false;
+
+        JOB_MUTEX_LOCK(&CORE.Jobs.deferredLock);
+
+        for (int i = 0; i < CORE.Jobs.deferredCount; i++)
+        {
+            if (JOB_ATOMIC_LOAD(&CORE.Jobs.deferred[i].dependency->pending) <= 0)
+            {
+                job = CORE.Jobs.deferred[i];
+                CORE.Jobs.deferred[i] = CORE.Jobs.deferred[CORE.Jobs.deferredCount - 1];
+                JOB_ATOMIC_ADD(&CORE.Jobs.deferredCount, -1);
+                found = true;
+                break;
+            }
+        }
+
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.deferredLock);
+
+        if (!found) break;
+
+        QueueJob(job);
+    }
+}
+
+// Job system worker thread, runs jobs and sleeps while no jobs are queued
+#if defined(PLATFORM_NX)
+static void JobWorkerThread(void *arg)
+#else
+static void *JobWorkerThread(void *arg)
+#endif
+{
+    jobThreadIndex = (int)(size_t)arg;
+
+    while (JOB_ATOMIC_LOAD(&CORE.Jobs.running))
+    {
+        Job job = { 0 };
+
+        if (NextJob(jobThreadIndex, &job))
+        {
+            RunJob(&job);
+            continue;
+        }
+
+        JOB_MUTEX_LOCK(&CORE.Jobs.sleepLock);
+
+        JOB_ATOMIC_ADD(&CORE.Jobs.sleeping, 1);
+        if ((JOB_ATOMIC_LOAD(&CORE.Jobs.queued) == 0) && JOB_ATOMIC_LOAD(&CORE.Jobs.running)) JOB_CONDITION_WAIT(&CORE.Jobs.wake, &CORE.Jobs.sleepLock);
+        JOB_ATOMIC_ADD(&CORE.Jobs.sleeping, -1);
+
+        JOB_MUTEX_UNLOCK(&CORE.Jobs.sleepLock);
+    }
+
+    UnloadScratchMemory();
+
+#if !defined(PLATFORM_NX)
+    return NULL;
+#endif
+}
+#endif  // JOBS_THREADED
+
+// Get current thread object pool cache, job system threads only (external threads use shared free list)
+static ObjectPoolCache *GetObjectPoolCache(ObjectPool *pool)
+{
+#if defined(JOBS_THREADED)
+    if ((jobThreadIndex >= 0) && (jobThreadIndex <= MAX_JOB_WORKERS)) return &pool->caches[jobThreadIndex];
+
+    return NULL;
+#else
+    return &pool->caches[0];
+#endif
+}
+
+// Pop free object (index + 1) from shared free list, 0 if empty
+// NOTE: Head tag changes on every update, a stale next link read (object popped meanwhile) fails the update
+static unsigned int PopObjectPool(ObjectPool *pool, unsigned int *retries)
+{
+    unsigned long long head = JOB_ATOMIC_LOAD(&pool->head);
+
+    while ((unsigned int)(head & 0xffffffff) != 0)
+    {
+        unsigned int first = (unsigned int)(head & 0xffffffff);
+        unsigned long long next = JOB_ATOMIC_LOAD(&pool->next[first - 1]);
+        unsigned long long newHead = ((head + 0x100000000ull) & 0xffffffff00000000ull) | next;
+
+        if (JOB_ATOMIC_CAS(&pool->head, &head, newHead)) return first;
+
+        (*retries)++;
+    }
+
+    return 0;
+}
+
+// Push free object (index + 1) to shared free list
+static void PushObjectPool(ObjectPool *pool, unsigned int object, unsigned int *retries)
+{
+    unsigned long long head = JOB_ATOMIC_LOAD(&pool->head);
+
+    for (;;)
+    {
+        JOB_ATOMIC_STORE(&pool->next[object - 1], (unsigned int)(head & 0xffffffff));
+
+        unsigned long long newHead = ((head + 0x100000000ull) & 0xffffffff00000000ull) | object;
+
+        if (JOB_ATOMIC_CAS(&pool->head, &head, newHead)) return;
+
+        (*retries)++;
+    }
+}
+#endif  // SUPPORT_JOB_SYSTEM
+
+// Seed random generator state, seed expanded with splitmix64 (state is never all zeros)
+static RandomGenerator SeedRandomGenerator(unsigned long long seed)
+{
+    RandomGenerator generator = { 0 };
+
+    for (int i = 0; i < 4; i += 2)
+    {
+        unsigned long long z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+        z = z ^ (z >> 31);
+
+        generator.state[i] = (unsigned int)z;
+        generator.state[i + 1] = (unsigned int)(z >> 32);
+    }
+
+    if ((generator.state[0] | generator.state[1] | generator.state[2] | generator.state[3]) == 0) generator.state[0] = 1;
+
+    return generator;
+}
+
+// Get next random 32 bits and advance state, xoshiro128** (period 2^128 - 1)
+static unsigned int NextRandomBits(unsigned int *state)
+{
+    unsigned int result = state[1]*5;
+    result = ((result << 7) | (result >> 25))*9;
+
+    unsigned int t = state[1] << 9;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = (state[3] << 11) | (state[3] >> 21);
+
+    return result;
+}
+
+// Get random value in [0, range), range 0 returns full 32 bits
+// NOTE: Multiply-shift range mapping, low products under threshold are rejected to avoid bias (Lemire's method)
+static unsigned int GetRandomRange(unsigned int *state, unsigned int range)
+{
+    if (range == 0) return NextRandomBits(state);
+
+    unsigned long long m = (unsigned long long)NextRandomBits(state)*range;
+
+    if ((unsigned int)m < range)
+    {
+        unsigned int threshold = (0u - range)%range;
+
+        while ((unsigned int)m < threshold) m = (unsigned long long)NextRandomBits(state)*range;
+    }
+
+    return (unsigned int)(m >> 32);
+}
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compress data (LZ4 block format), returns compressed data size
+// NOTE: Greedy matching with a hash table of last positions, match search steps faster on incompressible data
+static int CompressLZ4(const unsigned char *data, int dataSize, unsigned char *compData)
+{
+    int table[1 << COMPRESSION_LZ4_HASH_BITS];
+    for (int i = 0; i < (1 << COMPRESSION_LZ4_HASH_BITS); i++) table[i] = -1;
+
+    unsigned char *out = compData;
+    int anchor = 0;                     // First literal not yet output
+    int position = 0;
+    int matchStartLimit = dataSize - 12;    // Last match must start 12 bytes before data end
+    int matchEndLimit = dataSize - 5;       // Last 5 bytes are always literals
+
+    while (position < matchStartLimit)
+    {
+        unsigned int sequence = 0;
+        memcpy(&sequence, data + position, 4);
+
+        unsigned int hash = (sequence*2654435761u) >> (32 - COMPRESSION_LZ4_HASH_BITS);
+        int reference = table[hash];
+        table[hash] = position;
+
+        unsigned int referenceSequence = 0;
+        if (reference >= 0) memcpy(&referenceSequence, data + reference, 4);
+
+        if ((reference < 0) || ((position - reference) > 65535) || (referenceSequence != sequence))
+        {
+            position += 1 + ((position - anchor) >> 6);
+            continue;
+        }
+
+        // Extend match backwards (over pending literals) and forward
+        while ((position > anchor) && (reference > 0) && (data[position - 1] == data[reference - 1])) { position--; reference--; }
+
+        int matchLength = 4;
+        while (((position + matchLength) < matchEndLimit) && (data[position + matchLength] == data[reference + matchLength])) matchLength++;
+
+        // Sequence: token, literals length, literals, match offset, match length
+        int literalCount = position - anchor;
+        int matchCode = matchLength - 4;
+        unsigned char *token = out++;
+
+        *token = (unsigned char)((((literalCount < 15)? literalCount : 15) << 4) | ((matchCode < 15)? matchCode : 15));
+
+        if (literalCount >= 15)
+        {
+            int count = literalCount - 15;
+            for (; count >= 255; count -= 255) *out++ = 255;
+            *out++ = (unsigned char)count;
+        }
+
+        memcpy(out, data + anchor, literalCount);
+        out += literalCount;
+
+        *out++ = (unsigned char)((position - reference) & 0xff);
+        *out++ = (unsigned char)((position - reference) >> 8);
+
+        if (matchCode >= 15)
+        {
+            int count = matchCode - 15;
+            for (; count >= 255; count -= 255) *out++ = 255;
+            *out++ = (unsigned char)count;
+        }
+
+        position += matchLength;
+        anchor = position;
+    }
+
+    // Last sequence, literals only
+    int literalCount = dataSize - anchor;
+    *out++ = (unsigned char)(((literalCount < 15)? literalCount : 15) << 4);
+
+    if (literalCount >= 15)
+    {
+        int count = literalCount - 15;
+        for (; count >= 255; count -= 255) *out++ = 255;
+        *out++ = (unsigned char)count;
+    }
+
+    memcpy(out, data + anchor, literalCount);
+    out += literalCount;
+
+    return (int)(out - compData);
+}
+
+// Decompress data (LZ4 block format), returns decompressed data size or -1 on failure
+// NOTE: Compressed data is fully validated, reads and writes never exceed provided sizes
+static int DecompressLZ4(const unsigned char *compData, int compDataSize, unsigned char *data, int dataCapacity)
+{
+    int in = 0;
+    int out = 0;
+
+    while (in < compDataSize)
+    {
+        int token = compData[in++];
+        int literalCount = token >> 4;
+
+        if (literalCount == 15)
+        {
+            unsigned char value = 255;
+            while ((value == 255) && (literalCount <= dataCapacity))
+            {
+                if (in >= compDataSize) return -1;
+                value = compData[in++];
+                literalCount += value;
+            }
+        }
+
+        if ((literalCount > (compDataSize - in)) || (literalCount > (dataCapacity - out))) return -1;
+
+        memcpy(data + out, compData + in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        // Last sequence ends after literals
+        if (in == compDataSize) break;
+        if ((compDataSize - in) < 2) return -1;
+
+        int offset = compData[in] | (compData[in + 1] << 8);
+        in += 2;
+
+        if ((offset == 0) || (offset > out)) return -1;
+
+        int matchLength = token & 15;
+
+        if (matchLength == 15)
+        {
+            unsigned char value = 255;
+            while ((value == 255) && (matchLength <= dataCapacity))
+            {
+                if (in >= compDataSize) return -1;
+                value = compData[in++];
+                matchLength += value;
+            }
+        }
+
+        matchLength += 4;
+
+        if (matchLength > (dataCapacity - out)) return -1;
+
+        // Overlapped matches (offset smaller than length) repeat data, copied byte by byte
+        const unsigned char *match = data + out - offset;
+
+        if (offset >= matchLength) memcpy(data + out, match, matchLength);
+        else for (int i = 0; i < matchLength; i++) data[out + i] = match[i];
+
+        out += matchLength;
+    }
+
+    return out;
+}
+
+// Get stream input data required to complete current block, 0 if block complete (or stream finished)
+static int GetCompressionStreamNeeded(CompressionStream *stream)
+{
+    if (stream->finished) return 0;
+
+    if (stream->codec >= 0) return COMPRESSION_STREAM_BLOCK_SIZE - stream->inputSize;
+
+    if (stream->inputSize < (int)sizeof(CompressionBlockHeader)) return (int)sizeof(CompressionBlockHeader) - stream->inputSize;
+
+    CompressionBlockHeader header = { 0 };
+    memcpy(&header, stream->input, sizeof(CompressionBlockHeader));
+
+    return (int)sizeof(CompressionBlockHeader) + (int)(header.storedSize & 0xffffff) - stream->inputSize;
+}
+
+// Process stream input block into output block, only once previous output block is drained
+// NOTE: Compressed blocks not saving size are stored as is, so stored blocks never exceed block size
+static void ProcessCompressionStream(CompressionStream *stream)
+{
+    if (stream->outputOffset < stream->outputSize) return;
+
+    CompressionBlockHeader header = { 0 };
+
+    if (stream->codec >= 0)
+    {
+        // Compression: full input block compressed, last block and end block once input finished
+        if (!stream->finished && (stream->inputSize < COMPRESSION_STREAM_BLOCK_SIZE)) return;
+        if (stream->ended) return;
+
+        unsigned char *blockData = stream->output + sizeof(CompressionBlockHeader);
+
+        if (stream->inputSize > 0)
+        {
+            int compSize = 0;
+
+            if (stream->codec == COMPRESSION_LZ4) compSize = CompressLZ4(stream->input, stream->inputSize, blockData);
+            else compSize = sdeflate(stream->deflate, blockData, stream->input, stream->inputSize, COMPRESSION_QUALITY_DEFLATE);
+
+            header.size = stream->inputSize;
+
+            if ((compSize > 0) && (compSize < stream->inputSize)) header.storedSize = compSize | (((stream->codec == COMPRESSION_LZ4)? COMPRESSION_BLOCK_LZ4 : COMPRESSION_BLOCK_DEFLATE) << 24);
+            else
+            {
+                memcpy(blockData, stream->input, stream->inputSize);
+                header.storedSize = stream->inputSize;
+            }
+        }
+        else stream->ended = true;      // End block (empty)
+
+        memcpy(stream->output, &header, sizeof(CompressionBlockHeader));
+        stream->outputSize = sizeof(CompressionBlockHeader) + (header.storedSize & 0xffffff);
+        stream->outputOffset = 0;
+        stream->inputSize = 0;
+    }
+    else
+    {
+        // Decompression: block decompressed once its stored data is complete (header validated on feed)
+        if (stream->finished || (stream->inputSize < (int)sizeof(CompressionBlockHeader)) || (GetCompressionStreamNeeded(stream) > 0)) return;
+
+        memcpy(&header, stream->input, sizeof(CompressionBlockHeader));
+
+        const unsigned char *blockData = stream->input + sizeof(CompressionBlockHeader);
+        int storedSize = (int)(header.storedSize & 0xffffff);
+        int size = -1;
+
+        switch (header.storedSize >> 24)
+        {
+            case COMPRESSION_BLOCK_STORED: memcpy(stream->output, blockData, storedSize); size = storedSize; break;
+            case COMPRESSION_BLOCK_DEFLATE: size = sinflate(stream->output, COMPRESSION_STREAM_BLOCK_SIZE, blockData, storedSize); break;
+            case COMPRESSION_BLOCK_LZ4: size = DecompressLZ4(blockData, storedSize, stream->output, COMPRESSION_STREAM_BLOCK_SIZE); break;
+            default: break;
+        }
+
+        if (size != (int)header.size)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Failed to decompress stream block");
+            stream->failed = true;
+            return;
+        }
+
+        if (header.size == 0) stream->finished = true;
+
+        stream->outputSize = size;
+        stream->outputOffset = 0;
+        stream->inputSize = 0;
+    }
+}
+#endif  // SUPPORT_COMPRESSION_API
+
+#if defined(SUPPORT_DATA_STORAGE)
+// Get storage data checksum (FNV-1a)
+static unsigned int GetStorageChecksum(const unsigned char *data, unsigned int size)
+{
+    unsigned int hash = 2166136261u;
 
-    // Reset keys/chars pressed registered
-    CORE.Input.Keyboard.keyPressedQueueCount = 0;
-    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    for (unsigned int i = 0; i < size; i++) hash = (hash ^ data[i])*16777619u;
 
-#if !(defined(PLATFORM_RPI) || defined(PLATFORM_DRM))
-    // Reset last gamepad button/axis registered state
-    CORE.Input.Gamepad.lastButtonPressed = -1;
-    CORE.Input.Gamepad.axisCount = 0;
-#endif
+    return hash;
+}
 
-#if defined(PLATFORM_RPI) || defined(PLATFORM_DRM)
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+// Load storage file into cache (latest valid commit), on first access
+// NOTE: Legacy storage files (integer values array, no header) are imported as positional values
+static void LoadStorage(void)
+{
+    if (CORE.Storage.loaded) return;
 
-    PollKeyboardEvents();
+    CORE.Storage.loaded = true;
+    CORE.Storage.slot = 0;      // First commit writes the other file, a legacy storage file is not overwritten
 
-    // Register previous mouse states
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = 0.0f;
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++)
+    unsigned char *slotData[2] = { NULL };
+    unsigned int slotSize[2] = { 0 };
+    int latest = -1;
+
+    for (int i = 0; i < 2; i++)
     {
-        CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
-        CORE.Input.Mouse.currentButtonState[i] = CORE.Input.Mouse.currentButtonStateEvdev[i];
+        const char *path = TextFormat((i == 0)? "%s/%s" : "%s/%s.1", CORE.Storage.basePath, STORAGE_DATA_FILE);
+
+        if (!FileExists(path)) continue;
+
+        slotData[i] = LoadFileData(path, &slotSize[i]);
+
+        if ((slotData[i] == NULL) || (slotSize[i] < sizeof(StorageHeader))) continue;
+
+        StorageHeader *header = (StorageHeader *)slotData[i];
+
+        if ((memcmp(header->id, "rSTG", 4) != 0) || (header->version != STORAGE_VERSION) ||
+            (header->dataSize != (slotSize[i] - sizeof(StorageHeader))) ||
+            (header->checksum != GetStorageChecksum(slotData[i] + sizeof(StorageHeader), header->dataSize)))
+        {
+            if (memcmp(header->id, "rSTG", 4) == 0) TRACELOG(LOG_WARNING, "STORAGE: [%s] Storage file not valid, interrupted commit discarded", path);
+            continue;
+        }
+
+        if ((latest == -1) || ((int)(header->sequence - ((StorageHeader *)slotData[latest])->sequence) > 0)) latest = i;
     }
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    if (latest != -1)
     {
-        if (CORE.Input.Gamepad.ready[i])
+        StorageHeader *header = (StorageHeader *)slotData[latest];
+        unsigned char *data = slotData[latest] + sizeof(StorageHeader);
+        unsigned int offset = header->valueCount*sizeof(int);
+
+        CORE.Storage.sequence = header->sequence;
+        CORE.Storage.slot = latest;
+
+        if ((offset <= header->dataSize) && (header->valueCount > 0))
         {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+            CORE.Storage.values = (int *)RL_MALLOC(offset);
+            memcpy(CORE.Storage.values, data, offset);
+            CORE.Storage.valueCount = header->valueCount;
+        }
+
+        if (header->entryCount > 0) CORE.Storage.entries = (StorageEntry *)RL_CALLOC(header->entryCount, sizeof(StorageEntry));
+
+        for (unsigned int i = 0; (i < header->entryCount) && ((offset + 3*sizeof(unsigned int)) <= header->dataSize); i++)
+        {
+            unsigned int fields[3] = { 0 };     // Type, key length, data size
+            memcpy(fields, data + offset, sizeof(fields));
+            offset += sizeof(fields);
+
+            if ((fields[1] > (header->dataSize - offset)) || (fields[2] > (header->dataSize - offset - fields[1]))) break;
+
+            StorageEntry *entry = &CORE.Storage.entries[CORE.Storage.entryCount];
+            entry->type = (int)fields[0];
+            entry->key = (char *)RL_CALLOC(fields[1] + 1, 1);
+            memcpy(entry->key, data + offset, fields[1]);
+            entry->hash = GetStorageChecksum((unsigned char *)entry->key, fields[1]);
+            entry->size = fields[2];
+            entry->data = (unsigned char *)RL_MALLOC((entry->size > 0)? entry->size : 1);
+            memcpy(entry->data, data + offset + fields[1], entry->size);
+            CORE.Storage.entryCount++;
+
+            offset += (fields[1] + fields[2] + 3) & ~3u;    // Entries are 4 bytes aligned
         }
+
+        TRACELOG(LOG_INFO, "STORAGE: Storage loaded successfully (%u values, %u entries)", CORE.Storage.valueCount, CORE.Storage.entryCount);
     }
-#endif
+    else if ((slotData[0] != NULL) && (slotSize[0] >= sizeof(int)) && ((slotSize[0]%sizeof(int)) == 0))
+    {
+        // Legacy storage file, integer values array
+        CORE.Storage.values = (int *)RL_MALLOC(slotSize[0]);
+        memcpy(CORE.Storage.values, slotData[0], slotSize[0]);
+        CORE.Storage.valueCount = slotSize[0]/sizeof(int);
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
-    // Keyboard/Mouse input polling (automatically managed by GLFW3 through callback)
+        TRACELOG(LOG_INFO, "STORAGE: Legacy storage file imported (%u values)", CORE.Storage.valueCount);
+    }
 
-    // Register previous keys states
-    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    UnloadFileData(slotData[0]);
+    UnloadFileData(slotData[1]);
+}
 
-    // Register previous mouse states
-    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+// Unload storage cache, changes must be committed before
+static void UnloadStorage(void)
+{
+    WaitJobCounter(&CORE.Storage.commit);
+    storageCommit.pending = false;
 
-    // Register previous mouse wheel state
-    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
-    CORE.Input.Mouse.currentWheelMove = 0.0f;
+    for (unsigned int i = 0; i < CORE.Storage.entryCount; i++)
+    {
+        RL_FREE(CORE.Storage.entries[i].key);
+        RL_FREE(CORE.Storage.entries[i].data);
+    }
 
-    // Register previous mouse position
-    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
-#endif
+    RL_FREE(CORE.Storage.entries);
+    RL_FREE(CORE.Storage.values);
 
-    // Register previous touch states
-    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+    CORE.Storage.entries = NULL;
+    CORE.Storage.entryCount = 0;
+    CORE.Storage.values = NULL;
+    CORE.Storage.valueCount = 0;
+    CORE.Storage.dirty = false;
+    CORE.Storage.loaded = false;
+}
 
-    // Reset touch positions
-    // TODO: It resets on PLATFORM_WEB the mouse position and not filled again until a move-event,
-    // so, if mouse is not moved it returns a (0, 0) position... this behaviour should be reviewed!
-    //for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.position[i] = (Vector2){ 0, 0 };
+// Commit storage changes once idle (write-behind), write runs on a worker thread
+static void UpdateStorage(void)
+{
+    // Previous commit still writing, checked again next frame
+    if (!IsJobCounterDone(&CORE.Storage.commit)) return;
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_NX)
-    // Check if gamepads are ready
-    // NOTE: We do it here in case of disconnection
-    for (int i = 0; i < MAX_GAMEPADS; i++)
+    if (storageCommit.pending) FinishStorageCommit();
+
+    if (CORE.Storage.dirty && ((GetTime() - CORE.Storage.changeTime) >= STORAGE_COMMIT_DELAY)) CommitStorage(false);
+}
+
+// Commit storage changes to file, write runs as a job (waited if required)
+// NOTE: Commits alternate the two storage files, the other file keeps previous commit if this one is interrupted
+static bool CommitStorage(bool wait)
+{
+    // Previous commit write must be finished, its data is released by the job
+    WaitJobCounter(&CORE.Storage.commit);
+    if (storageCommit.pending) FinishStorageCommit();
+
+    if (!CORE.Storage.dirty) return true;
+
+    unsigned int dataSize = CORE.Storage.valueCount*sizeof(int);
+    for (unsigned int i = 0; i < CORE.Storage.entryCount; i++) dataSize += 3*sizeof(unsigned int) + (((unsigned int)strlen(CORE.Storage.entries[i].key) + CORE.Storage.entries[i].size + 3) & ~3u);
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(sizeof(StorageHeader) + dataSize, 1);
+    if (fileData == NULL) return false;
+
+    unsigned char *data = fileData + sizeof(StorageHeader);
+    unsigned int offset = CORE.Storage.valueCount*sizeof(int);
+
+    if (CORE.Storage.valueCount > 0) memcpy(data, CORE.Storage.values, offset);
+
+    for (unsigned int i = 0; i < CORE.Storage.entryCount; i++)
     {
-        if (glfwJoystickPresent(i)) CORE.Input.Gamepad.ready[i] = true;
-        else CORE.Input.Gamepad.ready[i] = false;
+        StorageEntry *entry = &CORE.Storage.entries[i];
+        unsigned int fields[3] = { (unsigned int)entry->type, (unsigned int)strlen(entry->key), entry->size };
+
+        memcpy(data + offset, fields, sizeof(fields));
+        memcpy(data + offset + sizeof(fields), entry->key, fields[1]);
+        memcpy(data + offset + sizeof(fields) + fields[1], entry->data, fields[2]);
+        offset += sizeof(fields) + ((fields[1] + fields[2] + 3) & ~3u);
     }
 
-    // Register gamepads buttons events
-    for (int i = 0; i < MAX_GAMEPADS; i++)
-    {
-        if (CORE.Input.Gamepad.ready[i])     // Check if gamepad is available
-        {
-            // Register previous gamepad states
-            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    CORE.Storage.sequence++;
 
-            // Get current gamepad state
-            // NOTE: There is no callback available, so we get it manually
-            // Get remapped buttons
-            GLFWgamepadstate state = { 0 };
-            glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
+    StorageHeader *header = (StorageHeader *)fileData;
+    memcpy(header->id, "rSTG", 4);
+    header->version = STORAGE_VERSION;
+    header->sequence = CORE.Storage.sequence;
+    header->valueCount = CORE.Storage.valueCount;
+    header->entryCount = CORE.Storage.entryCount;
+    header->dataSize = dataSize;
+    header->checksum = GetStorageChecksum(data, dataSize);
 
-            const unsigned char *buttons = state.buttons;
+    storageCommit.slot = (CORE.Storage.slot + 1)%2;
+    strncpy(storageCommit.path, TextFormat((storageCommit.slot == 0)? "%s/%s" : "%s/%s.1", CORE.Storage.basePath, STORAGE_DATA_FILE), MAX_FILEPATH_LENGTH - 1);
+    storageCommit.data = fileData;
+    storageCommit.size = sizeof(StorageHeader) + dataSize;
+    storageCommit.success = false;
+    storageCommit.pending = true;
 
-            for (int k = 0; (buttons != NULL) && (k < GLFW_GAMEPAD_BUTTON_DPAD_LEFT + 1) && (k < MAX_GAMEPAD_BUTTONS); k++)
-            {
-                GamepadButton button = -1;
+    CORE.Storage.dirty = false;
 
-                switch (k)
-                {
-                    case GLFW_GAMEPAD_BUTTON_Y: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_B: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_A: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_X: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
+    SubmitJob(CommitStorageJob, NULL, NULL, &CORE.Storage.commit);
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_BUMPER: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
-                    case GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
+    if (!wait) return true;
 
-                    case GLFW_GAMEPAD_BUTTON_BACK: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
-                    case GLFW_GAMEPAD_BUTTON_GUIDE: button = GAMEPAD_BUTTON_MIDDLE; break;
-                    case GLFW_GAMEPAD_BUTTON_START: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
+    WaitJobCounter(&CORE.Storage.commit);
+    FinishStorageCommit();
 
-                    case GLFW_GAMEPAD_BUTTON_DPAD_UP: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_RIGHT: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_DOWN: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
-                    case GLFW_GAMEPAD_BUTTON_DPAD_LEFT: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
+    return storageCommit.success;
+}
 
-                    case GLFW_GAMEPAD_BUTTON_LEFT_THUMB: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
-                    case GLFW_GAMEPAD_BUTTON_RIGHT_THUMB: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
-                    default: break;
-                }
+// Finish storage commit (write done), failed commits are retried after STORAGE_COMMIT_DELAY
+static void FinishStorageCommit(void)
+{
+    storageCommit.pending = false;
 
-                if (button != -1)   // Check for valid button
-                {
-                    if (buttons[k] == GLFW_PRESS)
-                    {
-                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
-                        CORE.Input.Gamepad.lastButtonPressed = button;
-                    }
-                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
-                }
-            }
+    if (storageCommit.success) CORE.Storage.slot = storageCommit.slot;
+    else
+    {
+        // NOTE: Retry writes the same file again, last valid commit file is kept
+        CORE.Storage.dirty = true;
+        CORE.Storage.changeTime = GetTime();
+    }
+}
 
-            // Get current axis state
-            const float *axes = state.axes;
+// Storage commit write job
+// NOTE: On PLATFORM_NX, save data devices are journaled, the write is applied on device commit
+static void CommitStorageJob(void *data)
+{
+    (void)data;
 
-            for (int k = 0; (axes != NULL) && (k < GLFW_GAMEPAD_AXIS_LAST + 1) && (k < MAX_GAMEPAD_AXIS); k++)
-            {
-                CORE.Input.Gamepad.axisState[i][k] = axes[k];
-            }
+    storageCommit.success = SaveFileData(storageCommit.path, storageCommit.data, storageCommit.size);
 
-            // Register buttons for 2nd triggers (because GLFW doesn't count these as buttons but rather axis)
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
+#if defined(PLATFORM_NX)
+    const char *separator = strchr(storageCommit.path, ':');
 
-            CORE.Input.Gamepad.axisCount = GLFW_GAMEPAD_AXIS_LAST + 1;
-        }
+    if (storageCommit.success && (separator != NULL) && ((separator - storageCommit.path) < 32))
+    {
+        char device[32] = { 0 };
+        memcpy(device, storageCommit.path, separator - storageCommit.path);
+
+        // NOTE: Devices not journaled (sdmc) fail to commit, data is already written
+        fsdevCommitDevice(device);
     }
+#endif
 
-    CORE.Window.resizedLastFrame = false;
+    RL_FREE(storageCommit.data);
+    storageCommit.data = NULL;
 
-    if (CORE.Window.eventWaiting) glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
-    else glfwPollEvents();      // Poll input events: keyboard/mouse/window events (callbacks)
-#endif  // PLATFORM_DESKTOP
+    if (!storageCommit.success) TRACELOG(LOG_WARNING, "STORAGE: [%s] Failed to commit storage", storageCommit.path);
+}
 
-#if defined(PLATFORM_WEB)
-    CORE.Window.resizedLastFrame = false;
-#endif  // PLATFORM_WEB
+// Get storage entry by key, NULL if not found
+static StorageEntry *GetStorageEntry(const char *key)
+{
+    if (key == NULL) return NULL;
 
-// Gamepad support using emscripten API
-// NOTE: GLFW3 joystick functionality not available in web
-#if defined(PLATFORM_WEB)
-    // Get number of gamepads connected
-    int numGamepads = 0;
-    if (emscripten_sample_gamepad_data() == EMSCRIPTEN_RESULT_SUCCESS) numGamepads = emscripten_get_num_gamepads();
+    LoadStorage();
 
-    for (int i = 0; (i < numGamepads) && (i < MAX_GAMEPADS); i++)
-    {
-        // Register previous gamepad button states
-        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    unsigned int hash = GetStorageChecksum((const unsigned char *)key, (unsigned int)strlen(key));
 
-        EmscriptenGamepadEvent gamepadState;
+    for (unsigned int i = 0; i < CORE.Storage.entryCount; i++)
+    {
+        if ((CORE.Storage.entries[i].hash == hash) && (strcmp(CORE.Storage.entries[i].key, key) == 0)) return &CORE.Storage.entries[i];
+    }
 
-        int result = emscripten_get_gamepad_status(i, &gamepadState);
+    return NULL;
+}
 
-        if (result == EMSCRIPTEN_RESULT_SUCCESS)
-        {
-            // Register buttons data for every connected gamepad
-            for (int j = 0; (j < gamepadState.numButtons) && (j < MAX_GAMEPAD_BUTTONS); j++)
-            {
-                GamepadButton button = -1;
+// Set storage entry data, created if required, returns false on allocation failure
+static bool SetStorageEntry(const char *key, int type, const void *data, unsigned int size)
+{
+    if ((key == NULL) || (key[0] == '\0')) return false;
 
-                // Gamepad Buttons reference: https://www.w3.org/TR/gamepad/#gamepad-interface
-                switch (j)
-                {
-                    case 0: button = GAMEPAD_BUTTON_RIGHT_FACE_DOWN; break;
-                    case 1: button = GAMEPAD_BUTTON_RIGHT_FACE_RIGHT; break;
-                    case 2: button = GAMEPAD_BUTTON_RIGHT_FACE_LEFT; break;
-                    case 3: button = GAMEPAD_BUTTON_RIGHT_FACE_UP; break;
-                    case 4: button = GAMEPAD_BUTTON_LEFT_TRIGGER_1; break;
-                    case 5: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_1; break;
-                    case 6: button = GAMEPAD_BUTTON_LEFT_TRIGGER_2; break;
-                    case 7: button = GAMEPAD_BUTTON_RIGHT_TRIGGER_2; break;
-                    case 8: button = GAMEPAD_BUTTON_MIDDLE_LEFT; break;
-                    case 9: button = GAMEPAD_BUTTON_MIDDLE_RIGHT; break;
-                    case 10: button = GAMEPAD_BUTTON_LEFT_THUMB; break;
-                    case 11: button = GAMEPAD_BUTTON_RIGHT_THUMB; break;
-                    case 12: button = GAMEPAD_BUTTON_LEFT_FACE_UP; break;
-                    case 13: button = GAMEPAD_BUTTON_LEFT_FACE_DOWN; break;
-                    case 14: button = GAMEPAD_BUTTON_LEFT_FACE_LEFT; break;
-                    case 15: button = GAMEPAD_BUTTON_LEFT_FACE_RIGHT; break;
-                    default: break;
-                }
+    StorageEntry *entry = GetStorageEntry(key);
 
-                if (button != -1)   // Check for valid button
-                {
-                    if (gamepadState.digitalButton[j] == 1)
-                    {
-                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
-                        CORE.Input.Gamepad.lastButtonPressed = button;
-                    }
-                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
-                }
+    // Value not changed, nothing to commit
+    if ((entry != NULL) && (entry->type == type) && (entry->size == size) && ((size == 0) || (memcmp(entry->data, data, size) == 0))) return true;
 
-                //TRACELOGD("INPUT: Gamepad %d, button %d: Digital: %d, Analog: %g", gamepadState.index, j, gamepadState.digitalButton[j], gamepadState.analogButton[j]);
-            }
+    unsigned char *entryData = (unsigned char *)RL_MALLOC((size > 0)? size : 1);
+    if (entryData == NULL) return false;
+    if (size > 0) memcpy(entryData, data, size);
 
-            // Register axis data for every connected gamepad
-            for (int j = 0; (j < gamepadState.numAxes) && (j < MAX_GAMEPAD_AXIS); j++)
-            {
-                CORE.Input.Gamepad.axisState[i][j] = gamepadState.axis[j];
-            }
+    if (entry == NULL)
+    {
+        StorageEntry *entries = (StorageEntry *)RL_REALLOC(CORE.Storage.entries, (CORE.Storage.entryCount + 1)*sizeof(StorageEntry));
 
-            CORE.Input.Gamepad.axisCount = gamepadState.numAxes;
+        if (entries == NULL)
+        {
+            RL_FREE(entryData);
+            return false;
         }
+
+        CORE.Storage.entries = entries;
+        entry = &CORE.Storage.entries[CORE.Storage.entryCount];
+        CORE.Storage.entryCount++;
+
+        unsigned int keyLength = (unsigned int)strlen(key);
+        entry->key = (char *)RL_CALLOC(keyLength + 1, 1);
+        memcpy(entry->key, key, keyLength);
+        entry->hash = GetStorageChecksum((const unsigned char *)key, keyLength);
     }
-#endif
+    else RL_FREE(entry->data);
 
-#if defined(PLATFORM_ANDROID)
-    // Register previous keys states
-    // NOTE: Android supports up to 260 keys
-    for (int i = 0; i < 260; i++) CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+    entry->type = type;
+    entry->data = entryData;
+    entry->size = size;
 
-    // Android ALooper_pollAll() variables
-    int pollResult = 0;
-    int pollEvents = 0;
+    CORE.Storage.dirty = true;
+    CORE.Storage.changeTime = GetTime();
 
-    // Poll Events (registered events)
-    // NOTE: Activity is paused if not enabled (CORE.Android.appEnabled)
-    while ((pollResult = ALooper_pollAll(CORE.Android.appEnabled? 0 : -1, NULL, &pollEvents, (void**)&CORE.Android.source)) >= 0)
+    return true;
+}
+#endif  // SUPPORT_DATA_STORAGE
+
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+// Register queued input events, updates keyboard and mouse states
+// NOTE: Only one state change per key/button is registered each frame, a quick tap (press and release
+// between two frames) is registered as pressed on this frame and released on next one
+static void ProcessInputEvents(void)
+{
+    char keyChanged[MAX_KEYBOARD_KEYS] = { 0 };
+    char buttonChanged[MAX_MOUSE_BUTTONS] = { 0 };
+
+    unsigned int tail = CORE.Input.Events.tail;
+    unsigned int head = INPUT_QUEUE_LOAD(&CORE.Input.Events.head);
+
+    while (tail != head)
     {
-        // Process this event
-        if (CORE.Android.source != NULL) CORE.Android.source->process(CORE.Android.app, CORE.Android.source);
+        const InputEvent *event = &CORE.Input.Events.queue[tail & (MAX_INPUT_EVENTS - 1)];
+        bool deferred = false;
 
-        // NOTE: Never close window, native activity is controlled by the system!
-        if (CORE.Android.app->destroyRequested != 0)
+        switch (event->type)
         {
-            //CORE.Window.shouldClose = true;
-            //ANativeActivity_finish(CORE.Android.app->activity);
+            case INPUT_EVENT_KEY_DOWN:
+            case INPUT_EVENT_KEY_UP:
+            {
+                if ((event->code < 0) || (event->code >= MAX_KEYBOARD_KEYS)) break;
+
+                // Key already changed this frame, remaining events wait for next frame (keeps events order)
+                if (keyChanged[event->code]) { deferred = true; break; }
+                keyChanged[event->code] = 1;
+
+                CORE.Input.Keyboard.currentKeyState[event->code] = (event->type == INPUT_EVENT_KEY_DOWN);
+
+                // Check if there is space available in the key queue
+                if ((event->type == INPUT_EVENT_KEY_DOWN) && (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE))
+                {
+                    CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = event->code;
+                    CORE.Input.Keyboard.keyPressedQueueCount++;
+                }
+            } break;
+            case INPUT_EVENT_CHAR:
+            {
+                // Check if there is space available in the char queue
+                if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
+                {
+                    CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = event->code;
+                    CORE.Input.Keyboard.charPressedQueueCount++;
+                }
+            } break;
+            case INPUT_EVENT_MOUSE_BUTTON_DOWN:
+            case INPUT_EVENT_MOUSE_BUTTON_UP:
+            {
+                if ((event->code < 0) || (event->code >= MAX_MOUSE_BUTTONS)) break;
+
+                if (buttonChanged[event->code]) { deferred = true; break; }
+                buttonChanged[event->code] = 1;
+
+                CORE.Input.Mouse.currentButtonState[event->code] = (event->type == INPUT_EVENT_MOUSE_BUTTON_DOWN);
+            } break;
+            case INPUT_EVENT_MOUSE_MOVE:
+            {
+                CORE.Input.Mouse.currentPosition = event->value;
+                CORE.Input.Touch.position[0] = event->value;
+            } break;
+            case INPUT_EVENT_MOUSE_WHEEL:
+            {
+                // Wheel move registers the main scrolling axis
+                if (fabsf(event->value.x) > fabsf(event->value.y)) CORE.Input.Mouse.currentWheelMove += event->value.x;
+                else CORE.Input.Mouse.currentWheelMove += event->value.y;
+            } break;
+            default: break;
         }
-    }
-#endif
 
-#if (defined(PLATFORM_RPI) || defined(PLATFORM_DRM)) && defined(SUPPORT_SSH_KEYBOARD_RPI)
-    // NOTE: Keyboard reading could be done using input_event(s) or just read from stdin, both methods are used here.
-    // stdin reading is still used for legacy purposes, it allows keyboard input trough SSH console
+        if (deferred) break;
 
-    if (!CORE.Input.Keyboard.evtMode) ProcessKeyboard();
+        RegisterInputEvent(*event);
+        tail++;
+    }
 
-    // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
-    // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
-#endif
+    INPUT_QUEUE_STORE(&CORE.Input.Events.tail, tail);
 }
+#endif
 
-#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(PLATFORM_NX)
+#if defined(PLATFORM_DESKTOP) || defined(PLATFORM_WEB) || defined(NX_USE_GLFW)
 // GLFW3 Error Callback, runs on GLFW3 error
 static void ErrorCallback(int error, const char *description)
 {
@@ -5256,23 +11167,16 @@ static void WindowFocusCallback(GLFWwindow *window, int focused)
 {
     if (focused) CORE.Window.flags &= ~FLAG_WINDOW_UNFOCUSED;   // The window was focused
     else CORE.Window.flags |= FLAG_WINDOW_UNFOCUSED;            // The window lost focus
+
+    if (CORE.Window.focusCallback != NULL) CORE.Window.focusCallback(focused != 0);
 }
 
 // GLFW3 Keyboard Callback, runs on key pressed
 static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, int mods)
 {
-    // WARNING: GLFW could return GLFW_REPEAT, we need to consider it as 1
-    // to work properly with our implementation (IsKeyDown/IsKeyUp checks)
-    if (action == GLFW_RELEASE) CORE.Input.Keyboard.currentKeyState[key] = 0;
-    else CORE.Input.Keyboard.currentKeyState[key] = 1;
-
-    // Check if there is space available in the key queue
-    if ((CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE) && (action == GLFW_PRESS))
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
-        CORE.Input.Keyboard.keyPressedQueueCount++;
-    }
+    // NOTE: GLFW_REPEAT is not queued, key state is already down
+    if (action == GLFW_PRESS) PushInputEvent(INPUT_EVENT_KEY_DOWN, 0, key, (Vector2){ 0 });
+    else if (action == GLFW_RELEASE) PushInputEvent(INPUT_EVENT_KEY_UP, 0, key, (Vector2){ 0 });
 
     // Check the exit key to set close window
     if ((key == CORE.Input.Keyboard.exitKey) && (action == GLFW_PRESS)) glfwSetWindowShouldClose(CORE.Window.handle, GLFW_TRUE);
@@ -5283,10 +11187,27 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_GIF_RECORDING)
         if (mods == GLFW_MOD_CONTROL)
         {
+        #if defined(NX_SYSTEM_CAPTURE_SUPPORTED)
+            // System video recording is toggled, frames are hardware encoded and saved by the system (Capture button)
+            if (CORE.Nx.recordingReady)
+            {
+                if (R_SUCCEEDED(appletSetGamePlayRecordingState(CORE.Nx.recording? AppletGamePlayRecordingState_Disabled : AppletGamePlayRecordingState_Enabled)))
+                {
+                    CORE.Nx.recording = !CORE.Nx.recording;
+                }
+
+                TRACELOG(LOG_INFO, "SYSTEM: System video recording %s", CORE.Nx.recording? "enabled" : "disabled");
+            }
+            else
+        #endif
             if (gifRecording)
             {
                 gifRecording = false;
 
+            #if defined(SUPPORT_ASYNC_SCREEN_CAPTURE)
+                FlushScreenCapture();   // Wait for pending GIF frames to be encoded
+            #endif
+
                 MsfGifResult result = msf_gif_end(&gifState);
 
                 SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
@@ -5324,17 +11245,14 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_EVENTS_AUTOMATION)
     if ((key == GLFW_KEY_F11) && (action == GLFW_PRESS))
     {
-        eventsRecording = !eventsRecording;
-
         // On finish recording, we export events into a file
-        if (!eventsRecording) ExportAutomationEvents("eventsrec.rep");
+        if (eventsRecording) StopAutomationEventsRecording("eventsrec.rep");
+        else StartAutomationEventsRecording(0.0f);
     }
     else if ((key == GLFW_KEY_F9) && (action == GLFW_PRESS))
     {
-        LoadAutomationEvents("eventsrec.rep");
-        eventsPlaying = true;
-
-        TRACELOG(LOG_WARNING, "eventsPlaying enabled!");
+        if (eventsPlaying) StopAutomationEventsReplay();
+        else StartAutomationEventsReplay("eventsrec.rep", "eventsrec.csv");
     }
 #endif
 }
@@ -5349,13 +11267,7 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
     // Ref: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // Ref: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
-    // Check if there is space available in the queue
-    if (CORE.Input.Keyboard.charPressedQueueCount < MAX_KEY_PRESSED_QUEUE)
-    {
-        // Add character to the queue
-        CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = key;
-        CORE.Input.Keyboard.charPressedQueueCount++;
-    }
+    PushInputEvent(INPUT_EVENT_CHAR, 0, (int)key, (Vector2){ 0 });
 }
 
 // GLFW3 Mouse Button Callback, runs on mouse button pressed
@@ -5363,98 +11275,514 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
 {
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
-    CORE.Input.Mouse.currentButtonState[button] = action;
+    if (action == GLFW_PRESS) PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_DOWN, 0, button, (Vector2){ 0 });
+    else if (action == GLFW_RELEASE) PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_UP, 0, button, (Vector2){ 0 });
+
+#if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
+    // Process mouse events as touches to be able to use mouse-gestures
+    GestureEvent gestureEvent = { 0 };
+
+    // Register touch actions
+    if (action == GLFW_PRESS) gestureEvent.touchAction = TOUCH_ACTION_DOWN;
+    else if (action == GLFW_RELEASE) gestureEvent.touchAction = TOUCH_ACTION_UP;
+
+    // NOTE: TOUCH_ACTION_MOVE event is registered in MouseCursorPosCallback()
+
+    // Assign a pointer ID
+    gestureEvent.pointId[0] = 0;
+
+    // Register touch points count
+    gestureEvent.pointCount = 1;
+
+    // Register touch points position, only one point registered
+    gestureEvent.position[0] = GetMousePosition();
+
+    // Normalize gestureEvent.position[0] for CORE.Window.screen.width and CORE.Window.screen.height
+    gestureEvent.position[0].x /= (float)GetScreenWidth();
+    gestureEvent.position[0].y /= (float)GetScreenHeight();
+
+    // Gesture data is sent to gestures system for processing
+    ProcessGestureEvent(gestureEvent);
+#endif
+}
+
+// GLFW3 Cursor Position Callback, runs on mouse move
+static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
+{
+    PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, (Vector2){ (float)x, (float)y });
+
+#if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
+    // Process mouse events as touches to be able to use mouse-gestures
+    GestureEvent gestureEvent = { 0 };
+
+    gestureEvent.touchAction = TOUCH_ACTION_MOVE;
+
+    // Assign a pointer ID
+    gestureEvent.pointId[0] = 0;
+
+    // Register touch points count
+    gestureEvent.pointCount = 1;
+
+    // Register touch points position, only one point registered
+    gestureEvent.position[0] = (Vector2){ (float)x, (float)y };
+
+    // Normalize gestureEvent.position[0] for CORE.Window.screen.width and CORE.Window.screen.height
+    gestureEvent.position[0].x /= (float)GetScreenWidth();
+    gestureEvent.position[0].y /= (float)GetScreenHeight();
+
+    // Gesture data is sent to gestures system for processing
+    ProcessGestureEvent(gestureEvent);
+#endif
+}
+
+// GLFW3 Scrolling Callback, runs on mouse wheel
+static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
+{
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (Vector2){ (float)xoffset, (float)yoffset });
+}
+
+// GLFW3 CursorEnter Callback, when cursor enters the window
+static void CursorEnterCallback(GLFWwindow *window, int enter)
+{
+    if (enter == true) CORE.Input.Mouse.cursorOnScreen = true;
+    else CORE.Input.Mouse.cursorOnScreen = false;
+}
+
+// GLFW3 Window Drop Callback, runs when drop files into window
+// NOTE: Paths are stored in dynamic memory for further retrieval
+// Everytime new files are dropped, old ones are discarded
+static void WindowDropCallback(GLFWwindow *window, int count, const char **paths)
+{
+    ClearDroppedFiles();
+
+    CORE.Window.dropFilesPath = (char **)RL_MALLOC(count*sizeof(char *));
+
+    for (int i = 0; i < count; i++)
+    {
+        CORE.Window.dropFilesPath[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
+        strcpy(CORE.Window.dropFilesPath[i], paths[i]);
+    }
+
+    CORE.Window.dropFileCount = count;
+}
+#endif
+
+#if defined(PLATFORM_NX)
+// Resize framebuffer for current operation mode: handheld 1280x720, docked 1920x1080
+static void SetupOperationMode(void)
+{
+    CORE.Nx.operationMode = appletGetOperationMode();
+
+    int width = (CORE.Nx.operationMode == AppletOperationMode_Console)? 1920 : 1280;
+    int height = (CORE.Nx.operationMode == AppletOperationMode_Console)? 1080 : 720;
+
+    CORE.Window.display.width = width;
+    CORE.Window.display.height = height;
+
+    if ((CORE.Window.currentFbo.width == (unsigned int)width) && (CORE.Window.currentFbo.height == (unsigned int)height)) return;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Operation mode %s, framebuffer resized to %i x %i", (width == 1920)? "docked" : "handheld", width, height);
+
+#if defined(NX_USE_GLFW)
+    glfwSetWindowSize(CORE.Window.handle, width, height);
+
+    // NOTE: Window is always fullscreen, WindowSizeCallback() does not update screen size
+    WindowSizeCallback(CORE.Window.handle, width, height);
+#else
+    // NOTE: Native window framebuffer is kept at docked size and cropped to the visible region,
+    // crop rectangle origin is top-left while OpenGL renders from bottom-left, bottom rows are used
+    nwindowSetCrop(CORE.Nx.window, 0, NX_FRAMEBUFFER_HEIGHT - height, width, NX_FRAMEBUFFER_HEIGHT);
+
+    SetupViewport(width, height);
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+#endif
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+
+#if defined(SUPPORT_DYNAMIC_RESOLUTION)
+    CORE.Resolution.gpuTime = 0.0;      // Framebuffer size changed, previous measures not valid
+#endif
+}
+
+// Set buffers swap interval, 0 disables vsync
+static void SetSwapInterval(int interval)
+{
+#if defined(NX_USE_GLFW)
+    glfwSwapInterval(interval);
+#else
+    eglSwapInterval(CORE.Nx.eglDisplay, interval);
+#endif
+}
+
+// Set application focus state, out of focus work is suspended (HOME menu, overlays, sleep)
+// NOTE: User focus callback is called before suspending (state could be saved) and after resuming
+static void SetNxFocusState(bool focused)
+{
+    if (focused == !CORE.Nx.suspended) return;
+
+    if (focused)
+    {
+        CORE.Window.flags &= ~FLAG_WINDOW_UNFOCUSED;
+        CORE.Nx.suspended = false;
+
+    #if defined(SUPPORT_NX_HID_INPUT)
+        atomic_store_explicit(&CORE.Nx.inputThrottled, false, memory_order_relaxed);
+    #endif
+    #if defined(SUPPORT_MODULE_RAUDIO)
+        ResumeAudioDevice();        // WARNING: Module required: raudio
+    #endif
+
+        // Avoid a huge frame time on first frame after resume
+        CORE.Time.previous = GetTime();
+        CORE.Time.presentTime = 0.0;
+
+        if (CORE.Window.focusCallback != NULL) CORE.Window.focusCallback(true);
+    }
+    else
+    {
+        if (CORE.Window.focusCallback != NULL) CORE.Window.focusCallback(false);
+
+        CORE.Window.flags |= FLAG_WINDOW_UNFOCUSED;
+        CORE.Nx.suspended = true;
+
+    #if defined(SUPPORT_NX_HID_INPUT)
+        atomic_store_explicit(&CORE.Nx.inputThrottled, true, memory_order_relaxed);
+    #endif
+    #if defined(SUPPORT_MODULE_RAUDIO)
+        SuspendAudioDevice();       // WARNING: Module required: raudio
+    #endif
+    }
+
+    TRACELOG(LOG_INFO, "SYSTEM: Application %s", focused? "resumed (in focus)" : "suspended (out of focus)");
+}
+
+// Applet hook, runs on applet messages processed by appletMainLoop() (called on PollInputEvents())
+static void AppletHookCallback(AppletHookType hook, void *param)
+{
+    switch (hook)
+    {
+        case AppletHookType_OnFocusState: SetNxFocusState(appletGetFocusState() == AppletFocusState_InFocus); break;
+        case AppletHookType_OnOperationMode: SetupOperationMode(); break;
+        case AppletHookType_OnPerformanceMode:
+        {
+            CORE.Nx.performanceMode = appletGetPerformanceMode();
+    #if defined(SUPPORT_DYNAMIC_RESOLUTION)
+            CORE.Resolution.gpuTime = 0.0;  // GPU clock changed, previous measures not valid
+    #endif
+        } break;
+        case AppletHookType_OnExitRequest: CORE.Window.shouldClose = true; break;
+        case AppletHookType_OnResume:
+        {
+            // Time stopped while suspended, avoid a huge frame time on first frame after resume
+            CORE.Time.previous = GetTime();
+            CORE.Time.presentTime = 0.0;
+        } break;
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_NX_CLOCK_PROFILES)
+// Set CPU boost mode for current clocks profile and loading boost scopes, only changed on mode switch
+static void UpdateCpuBoost(void)
+{
+    bool boost = (CORE.Nx.clockProfile == CLOCK_PROFILE_BOOST) || (CORE.Nx.loadingBoost > 0);
+
+    if (!CORE.Nx.cpuBoostReady || (boost == CORE.Nx.cpuBoost)) return;
+
+    if (R_SUCCEEDED(appletSetCpuBoostMode(boost? ApmCpuBoostMode_FastLoad : ApmCpuBoostMode_Normal)))
+    {
+        CORE.Nx.cpuBoost = boost;
+        TRACELOGD("SYSTEM: CPU boost mode %s", boost? "enabled" : "disabled");
+    }
+}
+#endif
+
+// Measure present interval and wait low latency pacing deadline
+// NOTE: Buffers swap is blocked by swap interval, so frames are already presented on vsync cadence,
+// low latency mode sleeps after present, so input is polled and next frame simulated just in time for the
+// following present (deadline minus filtered frame work time and margin) instead of one frame earlier
+static void WaitFramePacing(double workTime)
+{
+    double presentTime = CORE.Time.current;
+
+    // Swap returns once the frame is queued, align on the vsync actually presenting it
+    if ((CORE.Time.pacing == FRAME_PACING_LOW_LATENCY) && CORE.Nx.vsyncReady)
+    {
+        if (R_SUCCEEDED(eventWait(&CORE.Nx.vsyncEvent, 100000000ULL))) presentTime = GetTime();  // 100 ms timeout
+    }
+
+    if (CORE.Time.presentTime > 0.0)
+    {
+        double interval = presentTime - CORE.Time.presentTime;
+
+        CORE.Time.presentInterval = (CORE.Time.presentInterval > 0.0)? (CORE.Time.presentInterval*0.9 + interval*0.1) : interval;
+        CORE.Time.frame = interval;     // Frame time is the time between presents
+    }
+
+    CORE.Time.presentTime = presentTime;
+
+    if (CORE.Time.pacing == FRAME_PACING_LOW_LATENCY)
+    {
+        // Work time estimate raises on spikes, decays slowly
+        CORE.Time.workTime = (CORE.Time.workTime > 0.0)? fmax(workTime, CORE.Time.workTime*0.95 + workTime*0.05) : workTime;
+
+        double period = (CORE.Time.presentInterval > 0.0)? CORE.Time.presentInterval : CORE.Time.swapInterval/60.0;
+        double wait = presentTime + period - CORE.Time.workTime - FRAME_PACING_LATENCY_MARGIN - GetTime();
+
+        if (wait > 0.0) svcSleepThread((s64)(wait*1e9));
+    }
+
+    CORE.Time.current = GetTime();
+    CORE.Time.previous = CORE.Time.current;
+}
+
+#if defined(SUPPORT_NX_HID_INPUT)
+// Initialize pads, touch screen and six-axis sensors, start input thread
+// NOTE: First gamepad also reads handheld mode controllers (attached joy-cons)
+static void InitNxInput(void)
+{
+    padConfigureInput(MAX_GAMEPADS, HidNpadStyleSet_NpadStandard);
+    hidInitializeTouchScreen();
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        HidNpadIdType id = (HidNpadIdType)(HidNpadIdType_No1 + i);
+
+        if (i == 0) padInitialize(&CORE.Nx.pads[i], HidNpadIdType_No1, HidNpadIdType_Handheld);
+        else padInitialize(&CORE.Nx.pads[i], id);
+
+        hidGetSixAxisSensorHandles(&CORE.Nx.sensors[i][0], 1, id, HidNpadStyleTag_NpadFullKey);
+        hidGetSixAxisSensorHandles(&CORE.Nx.sensors[i][1], 2, id, HidNpadStyleTag_NpadJoyDual);
+        for (int k = 0; k < 3; k++) hidStartSixAxisSensor(CORE.Nx.sensors[i][k]);
+    }
+
+    hidGetSixAxisSensorHandles(&CORE.Nx.handheldSensor, 1, HidNpadIdType_Handheld, HidNpadStyleTag_NpadHandheld);
+    hidStartSixAxisSensor(CORE.Nx.handheldSensor);
+
+    atomic_store(&CORE.Nx.eventHead, 0);
+    atomic_store(&CORE.Nx.eventTail, 0);
+    atomic_store(&CORE.Nx.stateLatest, 1);
+    CORE.Nx.stateBack = 0;
+    CORE.Nx.stateFront = 2;
+    atomic_store(&CORE.Nx.inputRunning, true);
+
+    // Input thread runs with higher priority than main thread (0x2C), on default core
+    if (R_SUCCEEDED(threadCreate(&CORE.Nx.inputThread, NxInputThread, NULL, NULL, 0x4000, 0x2B, -2)) &&
+        R_SUCCEEDED(threadStart(&CORE.Nx.inputThread)))
+    {
+        TRACELOG(LOG_INFO, "INPUT: Native input initialized successfully (%i Hz)", NX_HID_SAMPLE_RATE);
+    }
+    else
+    {
+        atomic_store(&CORE.Nx.inputRunning, false);
+        TRACELOG(LOG_WARNING, "INPUT: Failed to create native input thread");
+    }
+}
+
+// Stop input thread and six-axis sensors
+static void CloseNxInput(void)
+{
+    if (atomic_exchange(&CORE.Nx.inputRunning, false))
+    {
+        threadWaitForExit(&CORE.Nx.inputThread);
+        threadClose(&CORE.Nx.inputThread);
+    }
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < 3; k++) hidStopSixAxisSensor(CORE.Nx.sensors[i][k]);
+    }
+
+    hidStopSixAxisSensor(CORE.Nx.handheldSensor);
+}
+
+// Native input sampling thread
+// NOTE: Buttons changes are queued as events, a change not fitting in the queue is retried next sample,
+// axis, motion and touch are published as latest sampled state (triple buffer, no locks on any side)
+static void NxInputThread(void *arg)
+{
+    static const struct { u64 mask; unsigned char button; } buttonMap[] = {
+        { HidNpadButton_X, GAMEPAD_BUTTON_RIGHT_FACE_UP },
+        { HidNpadButton_A, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT },
+        { HidNpadButton_B, GAMEPAD_BUTTON_RIGHT_FACE_DOWN },
+        { HidNpadButton_Y, GAMEPAD_BUTTON_RIGHT_FACE_LEFT },
+        { HidNpadButton_Up, GAMEPAD_BUTTON_LEFT_FACE_UP },
+        { HidNpadButton_Right, GAMEPAD_BUTTON_LEFT_FACE_RIGHT },
+        { HidNpadButton_Down, GAMEPAD_BUTTON_LEFT_FACE_DOWN },
+        { HidNpadButton_Left, GAMEPAD_BUTTON_LEFT_FACE_LEFT },
+        { HidNpadButton_L, GAMEPAD_BUTTON_LEFT_TRIGGER_1 },
+        { HidNpadButton_ZL, GAMEPAD_BUTTON_LEFT_TRIGGER_2 },
+        { HidNpadButton_R, GAMEPAD_BUTTON_RIGHT_TRIGGER_1 },
+        { HidNpadButton_ZR, GAMEPAD_BUTTON_RIGHT_TRIGGER_2 },
+        { HidNpadButton_Minus, GAMEPAD_BUTTON_MIDDLE_LEFT },
+        { HidNpadButton_Plus, GAMEPAD_BUTTON_MIDDLE_RIGHT },
+        { HidNpadButton_StickL, GAMEPAD_BUTTON_LEFT_THUMB },
+        { HidNpadButton_StickR, GAMEPAD_BUTTON_RIGHT_THUMB },
+    };
+
+    u64 registered[MAX_GAMEPADS] = { 0 };   // Buttons state already queued
+    const u64 period = 1000000000ULL/NX_HID_SAMPLE_RATE;
+
+    while (atomic_load_explicit(&CORE.Nx.inputRunning, memory_order_acquire))
+    {
+        u64 start = armGetSystemTick();
+        double time = GetTime();
+        NxInputState *state = &CORE.Nx.states[CORE.Nx.stateBack];
+
+        for (int i = 0; i < MAX_GAMEPADS; i++)
+        {
+            PadState *pad = &CORE.Nx.pads[i];
+            padUpdate(pad);
+
+            state->connected[i] = padIsConnected(pad);
+            u64 buttons = state->connected[i]? padGetButtons(pad) : 0;
+
+            // Queue buttons changes in map order
+            for (int k = 0; k < (int)(sizeof(buttonMap)/sizeof(buttonMap[0])); k++)
+            {
+                if (((buttons ^ registered[i]) & buttonMap[k].mask) == 0) continue;
+
+                unsigned int head = atomic_load_explicit(&CORE.Nx.eventHead, memory_order_relaxed);
+                unsigned int tail = atomic_load_explicit(&CORE.Nx.eventTail, memory_order_acquire);
+                if ((head - tail) >= MAX_NX_INPUT_EVENTS) break;
+
+                NxInputEvent *event = &CORE.Nx.events[head & (MAX_NX_INPUT_EVENTS - 1)];
+                event->time = time;
+                event->gamepad = (unsigned char)i;
+                event->button = buttonMap[k].button;
+                event->pressed = ((buttons & buttonMap[k].mask) != 0);
+
+                atomic_store_explicit(&CORE.Nx.eventHead, head + 1, memory_order_release);
+                registered[i] ^= buttonMap[k].mask;
+            }
 
-#if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
-    // Process mouse events as touches to be able to use mouse-gestures
-    GestureEvent gestureEvent = { 0 };
+            // Axis mapped as GLFW gamepads: Y axis down positive, triggers range [-1..1]
+            HidAnalogStickState left = padGetStickPos(pad, 0);
+            HidAnalogStickState right = padGetStickPos(pad, 1);
 
-    // Register touch actions
-    if ((CORE.Input.Mouse.currentButtonState[button] == 1) && (CORE.Input.Mouse.previousButtonState[button] == 0)) gestureEvent.touchAction = TOUCH_ACTION_DOWN;
-    else if ((CORE.Input.Mouse.currentButtonState[button] == 0) && (CORE.Input.Mouse.previousButtonState[button] == 1)) gestureEvent.touchAction = TOUCH_ACTION_UP;
+            state->axis[i][GAMEPAD_AXIS_LEFT_X] = (float)left.x/JOYSTICK_MAX;
+            state->axis[i][GAMEPAD_AXIS_LEFT_Y] = -(float)left.y/JOYSTICK_MAX;
+            state->axis[i][GAMEPAD_AXIS_RIGHT_X] = (float)right.x/JOYSTICK_MAX;
+            state->axis[i][GAMEPAD_AXIS_RIGHT_Y] = -(float)right.y/JOYSTICK_MAX;
+            state->axis[i][GAMEPAD_AXIS_LEFT_TRIGGER] = (buttons & HidNpadButton_ZL)? 1.0f : -1.0f;
+            state->axis[i][GAMEPAD_AXIS_RIGHT_TRIGGER] = (buttons & HidNpadButton_ZR)? 1.0f : -1.0f;
 
-    // NOTE: TOUCH_ACTION_MOVE event is registered in MouseCursorPosCallback()
+            // Six-axis sensor depends on controller style: handheld, full key (pro controller) or joy-con pair (right one)
+            u32 style = padGetStyleSet(pad);
+            HidSixAxisSensorState sensor = { 0 };
+            bool motion = false;
 
-    // Assign a pointer ID
-    gestureEvent.pointId[0] = 0;
+            if (style & HidNpadStyleTag_NpadHandheld) motion = (hidGetSixAxisSensorStates(CORE.Nx.handheldSensor, &sensor, 1) > 0);
+            else if (style & HidNpadStyleTag_NpadFullKey) motion = (hidGetSixAxisSensorStates(CORE.Nx.sensors[i][0], &sensor, 1) > 0);
+            else if (style & HidNpadStyleTag_NpadJoyDual) motion = (hidGetSixAxisSensorStates(CORE.Nx.sensors[i][2], &sensor, 1) > 0);
 
-    // Register touch points count
-    gestureEvent.pointCount = 1;
+            if (!motion) memset(&sensor, 0, sizeof(HidSixAxisSensorState));
 
-    // Register touch points position, only one point registered
-    gestureEvent.position[0] = GetMousePosition();
+            // NOTE: Angular velocity is given in rotations per second
+            state->accelerometer[i] = (Vector3){ sensor.acceleration.x, sensor.acceleration.y, sensor.acceleration.z };
+            state->gyroscope[i] = (Vector3){ sensor.angular_velocity.x*2.0f*PI, sensor.angular_velocity.y*2.0f*PI, sensor.angular_velocity.z*2.0f*PI };
+        }
 
-    // Normalize gestureEvent.position[0] for CORE.Window.screen.width and CORE.Window.screen.height
-    gestureEvent.position[0].x /= (float)GetScreenWidth();
-    gestureEvent.position[0].y /= (float)GetScreenHeight();
+        HidTouchScreenState touch = { 0 };
+        state->touchCount = 0;
 
-    // Gesture data is sent to gestures system for processing
-    ProcessGestureEvent(gestureEvent);
-#endif
+        if (hidGetTouchScreenStates(&touch, 1) > 0)
+        {
+            for (int k = 0; (k < touch.count) && (k < MAX_TOUCH_POINTS); k++)
+            {
+                state->touchId[k] = touch.touches[k].finger_id;
+                state->touch[k] = (Vector2){ (float)touch.touches[k].x, (float)touch.touches[k].y };
+                state->touchCount++;
+            }
+        }
+
+        // Publish sampled state, take back the previously published one if not read
+        CORE.Nx.stateBack = atomic_exchange_explicit(&CORE.Nx.stateLatest, CORE.Nx.stateBack | 4, memory_order_acq_rel) & 3;
+
+        // NOTE: Application out of focus, input is sampled at background frame rate
+        u64 target = atomic_load_explicit(&CORE.Nx.inputThrottled, memory_order_relaxed)? 1000000000ULL/NX_BACKGROUND_FPS : period;
+        u64 elapsed = armTicksToNs(armGetSystemTick() - start);
+        if (elapsed < target) svcSleepThread((s64)(target - elapsed));
+    }
 }
 
-// GLFW3 Cursor Position Callback, runs on mouse move
-static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
+// Register native input events and latest sampled state
+// NOTE: Only one state change per button is registered each frame, a quick tap (press and release
+// between two frames) is registered as pressed on this frame and released on next one
+static void PollNxInputEvents(void)
 {
-    CORE.Input.Mouse.currentPosition.x = (float)x;
-    CORE.Input.Mouse.currentPosition.y = (float)y;
-    CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
-
-#if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)         // PLATFORM_DESKTOP
-    // Process mouse events as touches to be able to use mouse-gestures
-    GestureEvent gestureEvent = { 0 };
+    bool changed[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS] = { 0 };
 
-    gestureEvent.touchAction = TOUCH_ACTION_MOVE;
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    }
 
-    // Assign a pointer ID
-    gestureEvent.pointId[0] = 0;
+    unsigned int tail = atomic_load_explicit(&CORE.Nx.eventTail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&CORE.Nx.eventHead, memory_order_acquire);
 
-    // Register touch points count
-    gestureEvent.pointCount = 1;
+    while (tail != head)
+    {
+        const NxInputEvent *event = &CORE.Nx.events[tail & (MAX_NX_INPUT_EVENTS - 1)];
 
-    // Register touch points position, only one point registered
-    gestureEvent.position[0] = CORE.Input.Touch.position[0];
+        // Button already changed this frame, remaining events wait for next frame (keeps events order)
+        if (changed[event->gamepad][event->button]) break;
 
-    // Normalize gestureEvent.position[0] for CORE.Window.screen.width and CORE.Window.screen.height
-    gestureEvent.position[0].x /= (float)GetScreenWidth();
-    gestureEvent.position[0].y /= (float)GetScreenHeight();
+        changed[event->gamepad][event->button] = true;
+        CORE.Input.Gamepad.currentButtonState[event->gamepad][event->button] = event->pressed;
+        CORE.Input.Gamepad.buttonTime[event->gamepad][event->button] = event->time;
+        if (event->pressed) CORE.Input.Gamepad.lastButtonPressed = event->button;
 
-    // Gesture data is sent to gestures system for processing
-    ProcessGestureEvent(gestureEvent);
-#endif
-}
+        InputEvent input = { event->pressed? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, event->time, event->gamepad, event->button, { 0 } };
+        RegisterInputEvent(input);
 
-// GLFW3 Scrolling Callback, runs on mouse wheel
-static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
-{
-    if (fabs(xoffset) > fabs(yoffset)) CORE.Input.Mouse.currentWheelMove = (float)xoffset;
-    else CORE.Input.Mouse.currentWheelMove = (float)yoffset;
-}
+        tail++;
+    }
 
-// GLFW3 CursorEnter Callback, when cursor enters the window
-static void CursorEnterCallback(GLFWwindow *window, int enter)
-{
-    if (enter == true) CORE.Input.Mouse.cursorOnScreen = true;
-    else CORE.Input.Mouse.cursorOnScreen = false;
-}
+    atomic_store_explicit(&CORE.Nx.eventTail, tail, memory_order_release);
 
-// GLFW3 Window Drop Callback, runs when drop files into window
-// NOTE: Paths are stored in dynamic memory for further retrieval
-// Everytime new files are dropped, old ones are discarded
-static void WindowDropCallback(GLFWwindow *window, int count, const char **paths)
-{
-    ClearDroppedFiles();
+    // Get latest sampled state, if input thread published a new one
+    if (atomic_load_explicit(&CORE.Nx.stateLatest, memory_order_relaxed) & 4)
+    {
+        CORE.Nx.stateFront = atomic_exchange_explicit(&CORE.Nx.stateLatest, CORE.Nx.stateFront, memory_order_acq_rel) & 3;
+    }
 
-    CORE.Window.dropFilesPath = (char **)RL_MALLOC(count*sizeof(char *));
+    const NxInputState *state = &CORE.Nx.states[CORE.Nx.stateFront];
 
-    for (int i = 0; i < count; i++)
+    for (int i = 0; i < MAX_GAMEPADS; i++)
     {
-        CORE.Window.dropFilesPath[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-        strcpy(CORE.Window.dropFilesPath[i], paths[i]);
+        CORE.Input.Gamepad.ready[i] = state->connected[i];
+
+        for (int k = 0; (k < 6) && (k < MAX_GAMEPAD_AXIS); k++) CORE.Input.Gamepad.axisState[i][k] = state->axis[i][k];
+
+        CORE.Input.Gamepad.accelerometer[i] = state->accelerometer[i];
+        CORE.Input.Gamepad.gyroscope[i] = state->gyroscope[i];
     }
 
-    CORE.Window.dropFileCount = count;
+    CORE.Input.Gamepad.axisCount = 6;
+
+    // Touch screen is 1280x720, scaled to screen size
+    CORE.Input.Touch.pointCount = state->touchCount;
+
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+    {
+        if (i < state->touchCount)
+        {
+            CORE.Input.Touch.pointId[i] = state->touchId[i];
+            CORE.Input.Touch.position[i].x = state->touch[i].x*(float)CORE.Window.screen.width/1280.0f;
+            CORE.Input.Touch.position[i].y = state->touch[i].y*(float)CORE.Window.screen.height/720.0f;
+            CORE.Input.Touch.currentTouchState[i] = 1;
+        }
+        else
+        {
+            CORE.Input.Touch.pointId[i] = -1;
+            CORE.Input.Touch.currentTouchState[i] = 0;
+        }
+    }
 }
+#endif  // SUPPORT_NX_HID_INPUT
 #endif
 
 #if defined(PLATFORM_ANDROID)
@@ -5497,7 +11825,7 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     InitTimer();
 
                     // Initialize random seed
-                    srand((unsigned int)time(NULL));
+                    SetRandomSeed((unsigned int)time(NULL));
 
                 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
                     // Load default font
@@ -6667,363 +12995,440 @@ static int FindNearestConnectorMode(const drmModeConnector *connector, uint widt
 #endif
 
 #if defined(SUPPORT_EVENTS_AUTOMATION)
-// NOTE: Loading happens over AutomationEvent *events
-// TODO: This system should probably be redesigned
-static void LoadAutomationEvents(const char *fileName)
+// Add event to events array, array grows as required
+static void AddAutomationEvent(unsigned int frame, unsigned int type, int param0, int param1, int param2)
 {
-    //unsigned char fileId[4] = { 0 };
+    if (eventCount >= eventCapacity)
+    {
+        unsigned int capacity = (eventCapacity > 0)? eventCapacity*2 : 1024;
+        AutomationEvent *resized = (AutomationEvent *)RL_REALLOC(events, capacity*sizeof(AutomationEvent));
 
-    // Load binary
-    /*
-    FILE *repFile = fopen(fileName, "rb");
-    fread(fileId, 4, 1, repFile);
+        if (resized == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: Failed to allocate events, event discarded");
+            return;
+        }
 
-    if ((fileId[0] == 'r') && (fileId[1] == 'E') && (fileId[2] == 'P') && (fileId[1] == ' '))
-    {
-        fread(&eventCount, sizeof(int), 1, repFile);
-        TraceLog(LOG_WARNING, "Events loaded: %i\n", eventCount);
-        fread(events, sizeof(AutomationEvent), eventCount, repFile);
+        events = resized;
+        eventCapacity = capacity;
     }
 
-    fclose(repFile);
-    */
+    events[eventCount].frame = frame;
+    events[eventCount].type = type;
+    events[eventCount].params[0] = param0;
+    events[eventCount].params[1] = param1;
+    events[eventCount].params[2] = param2;
+
+    TRACELOG(LOG_DEBUG, "[%i] %s: %i, %i, %i", frame, autoEventTypeName[type], param0, param1, param2);
+    eventCount++;
+}
 
-    // Load events (text file)
+// Load automation events from file
+// NOTE: Frames are relative to recording start, events are expected in frames order
+static bool LoadAutomationEvents(const char *fileName)
+{
     FILE *repFile = fopen(fileName, "rt");
 
-    if (repFile != NULL)
+    if (repFile == NULL)
     {
-        unsigned int count = 0;
-        char buffer[256] = { 0 };
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events file", fileName);
+        return false;
+    }
+
+    eventCount = 0;
+    eventsFrameCount = 0;
+    eventsDeltaTime = 1.0f/60.0f;
+    eventsSeed = 0;
 
-        fgets(buffer, 256, repFile);
+    unsigned int count = 0;
+    char buffer[256] = { 0 };
 
-        while (!feof(repFile))
+    while (fgets(buffer, 256, repFile) != NULL)
+    {
+        if (buffer[0] == 'c') sscanf(buffer, "c %u", &count);
+        else if (buffer[0] == 'd') sscanf(buffer, "d %f %u %u", &eventsDeltaTime, &eventsSeed, &eventsFrameCount);
+        else if (buffer[0] == 'e')
         {
-            if (buffer[0] == 'c') sscanf(buffer, "c %i", &eventCount);
-            else if (buffer[0] == 'e')
-            {
-                sscanf(buffer, "e %d %d %d %d %d", &events[count].frame, &events[count].type,
-                       &events[count].params[0], &events[count].params[1], &events[count].params[2]);
+            unsigned int frame = 0;
+            unsigned int type = 0;
+            int params[3] = { 0 };
 
-                count++;
+            if ((sscanf(buffer, "e %u %u %d %d %d", &frame, &type, &params[0], &params[1], &params[2]) == 5) && (type <= ACTION_SETTARGETFPS))
+            {
+                AddAutomationEvent(frame, type, params[0], params[1], params[2]);
+                if (frame >= eventsFrameCount) eventsFrameCount = frame + 1;
             }
-
-            fgets(buffer, 256, repFile);
         }
+    }
 
-        if (count != eventCount) TRACELOG(LOG_WARNING, "Events count provided is different than count");
+    fclose(repFile);
 
-        fclose(repFile);
-    }
+    if (count != eventCount) TRACELOG(LOG_WARNING, "AUTOMATION: Events count provided is different than count");
 
-    TRACELOG(LOG_WARNING, "Events loaded: %i", eventCount);
+    TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events loaded: %i (%i frames)", fileName, eventCount, eventsFrameCount);
+
+    return true;
 }
 
 // Export recorded events into a file
 static void ExportAutomationEvents(const char *fileName)
 {
-    unsigned char fileId[4] = "rEP ";
-
-    // Save as binary
-    /*
-    FILE *repFile = fopen(fileName, "wb");
-    fwrite(fileId, 4, 1, repFile);
-    fwrite(&eventCount, sizeof(int), 1, repFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, repFile);
-    fclose(repFile);
-    */
-
     // Export events as text
     FILE *repFile = fopen(fileName, "wt");
 
     if (repFile != NULL)
     {
         fprintf(repFile, "# Automation events list\n");
+        fprintf(repFile, "#    d <frame_delta_time> <random_seed> <frames_count>\n");
         fprintf(repFile, "#    c <events_count>\n");
         fprintf(repFile, "#    e <frame> <event_type> <param0> <param1> <param2> // <event_type_name>\n");
 
-        fprintf(repFile, "c %i\n", eventCount);
-        for (int i = 0; i < eventCount; i++)
+        fprintf(repFile, "d %.9f %u %u\n", eventsDeltaTime, eventsSeed, eventsFrameCount);
+        fprintf(repFile, "c %u\n", eventCount);
+        for (unsigned int i = 0; i < eventCount; i++)
         {
-            fprintf(repFile, "e %i %i %i %i %i // %s\n", events[i].frame, events[i].type,
+            fprintf(repFile, "e %u %u %i %i %i // %s\n", events[i].frame, events[i].type,
                     events[i].params[0], events[i].params[1], events[i].params[2], autoEventTypeName[events[i].type]);
         }
 
         fclose(repFile);
+
+        TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events exported: %i (%i frames)", fileName, eventCount, eventsFrameCount);
     }
+    else TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to export events", fileName);
 }
 
 // EndDrawing() -> After PollInputEvents()
 // Check event in current frame and save into the events[i] array
+// NOTE: Analog values are quantized as recorded, so recording and replay runs see the same input
 static void RecordAutomationEvent(unsigned int frame)
 {
     for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
     {
         // INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_UP;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key]) AddAutomationEvent(frame, INPUT_KEY_UP, key, 0, 0);
 
         // INPUT_KEY_DOWN
-        if (CORE.Input.Keyboard.currentKeyState[key])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_KEY_DOWN;
-            events[eventCount].params[0] = key;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_KEY_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Keyboard.currentKeyState[key]) AddAutomationEvent(frame, INPUT_KEY_DOWN, key, 0, 0);
     }
 
+    // INPUT_KEY_PRESSED (keys pressed queue, GetKeyPressed())
+    for (int i = 0; i < CORE.Input.Keyboard.keyPressedQueueCount; i++) AddAutomationEvent(frame, INPUT_KEY_PRESSED, CORE.Input.Keyboard.keyPressedQueue[i], 0, 0);
+
     for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
     {
         // INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_UP;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button]) AddAutomationEvent(frame, INPUT_MOUSE_BUTTON_UP, button, 0, 0);
 
         // INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_MOUSE_BUTTON_DOWN;
-            events[eventCount].params[0] = button;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Mouse.currentButtonState[button]) AddAutomationEvent(frame, INPUT_MOUSE_BUTTON_DOWN, button, 0, 0);
     }
 
     // INPUT_MOUSE_POSITION (only saved if changed)
-    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
-        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
-    {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_POSITION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        events[eventCount].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        events[eventCount].params[2] = 0;
+    CORE.Input.Mouse.currentPosition.x = (float)(int)CORE.Input.Mouse.currentPosition.x;
+    CORE.Input.Mouse.currentPosition.y = (float)(int)CORE.Input.Mouse.currentPosition.y;
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
+    if ((CORE.Input.Mouse.currentPosition.x != eventsMousePosition.x) || (CORE.Input.Mouse.currentPosition.y != eventsMousePosition.y))
+    {
+        eventsMousePosition = CORE.Input.Mouse.currentPosition;
+        AddAutomationEvent(frame, INPUT_MOUSE_POSITION, (int)eventsMousePosition.x, (int)eventsMousePosition.y, 0);
     }
 
-    // INPUT_MOUSE_WHEEL_MOTION
-    if ((int)CORE.Input.Mouse.currentWheelMove != (int)CORE.Input.Mouse.previousWheelMove)
-    {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_MOUSE_WHEEL_MOTION;
-        events[eventCount].params[0] = (int)CORE.Input.Mouse.currentWheelMove;
-        events[eventCount].params[1] = 0;
-        events[eventCount].params[2] = 0;
+    // INPUT_MOUSE_WHEEL_MOTION (only saved if moved)
+    int wheelMove = (int)(CORE.Input.Mouse.currentWheelMove*1000.0f);
+    CORE.Input.Mouse.currentWheelMove = (float)wheelMove/1000.0f;
 
-        TRACELOG(LOG_INFO, "[%i] INPUT_MOUSE_WHEEL_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
-    }
+    if (wheelMove != 0) AddAutomationEvent(frame, INPUT_MOUSE_WHEEL_MOTION, wheelMove, 0, 0);
 
     for (int id = 0; id < MAX_TOUCH_POINTS; id++)
     {
         // INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_UP;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
+        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id]) AddAutomationEvent(frame, INPUT_TOUCH_UP, id, 0, 0);
 
         // INPUT_TOUCH_DOWN
         if (CORE.Input.Touch.currentTouchState[id])
         {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_DOWN;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = 0;
-            events[eventCount].params[2] = 0;
+            AddAutomationEvent(frame, INPUT_TOUCH_DOWN, id, 0, 0);
 
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
+            // INPUT_TOUCH_POSITION (touch point down)
+            CORE.Input.Touch.position[id].x = (float)(int)CORE.Input.Touch.position[id].x;
+            CORE.Input.Touch.position[id].y = (float)(int)CORE.Input.Touch.position[id].y;
+            AddAutomationEvent(frame, INPUT_TOUCH_POSITION, id, (int)CORE.Input.Touch.position[id].x, (int)CORE.Input.Touch.position[id].y);
         }
-
-        // INPUT_TOUCH_POSITION
-        // TODO: It requires the id!
-        /*
-        if (((int)CORE.Input.Touch.currentPosition[id].x != (int)CORE.Input.Touch.previousPosition[id].x) ||
-            ((int)CORE.Input.Touch.currentPosition[id].y != (int)CORE.Input.Touch.previousPosition[id].y))
-        {
-            events[eventCount].frame = frame;
-            events[eventCount].type = INPUT_TOUCH_POSITION;
-            events[eventCount].params[0] = id;
-            events[eventCount].params[1] = (int)CORE.Input.Touch.currentPosition[id].x;
-            events[eventCount].params[2] = (int)CORE.Input.Touch.currentPosition[id].y;
-
-            TRACELOG(LOG_INFO, "[%i] INPUT_TOUCH_POSITION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-            eventCount++;
-        }
-        */
     }
 
     for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
     {
-        // INPUT_GAMEPAD_CONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == true)) // Check if changed to ready
-        {
-            // TODO: Save gamepad connect event
-        }
-        */
-
-        // INPUT_GAMEPAD_DISCONNECT
-        /*
-        if ((CORE.Input.Gamepad.currentState[gamepad] != CORE.Input.Gamepad.previousState[gamepad]) &&
-            (CORE.Input.Gamepad.currentState[gamepad] == false)) // Check if changed to not-ready
+        // INPUT_GAMEPAD_CONNECT, INPUT_GAMEPAD_DISCONNECT
+        if (CORE.Input.Gamepad.ready[gamepad] != eventsGamepadReady[gamepad])
         {
-            // TODO: Save gamepad disconnect event
+            eventsGamepadReady[gamepad] = CORE.Input.Gamepad.ready[gamepad];
+            AddAutomationEvent(frame, eventsGamepadReady[gamepad]? INPUT_GAMEPAD_CONNECT : INPUT_GAMEPAD_DISCONNECT, gamepad, 0, 0);
         }
-        */
 
         for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
         {
             // INPUT_GAMEPAD_BUTTON_UP
-            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button])
-            {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_UP;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_UP: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
-            }
+            if (CORE.Input.Gamepad.previousButtonState[gamepad][button] && !CORE.Input.Gamepad.currentButtonState[gamepad][button]) AddAutomationEvent(frame, INPUT_GAMEPAD_BUTTON_UP, gamepad, button, 0);
 
             // INPUT_GAMEPAD_BUTTON_DOWN
-            if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
-            {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_BUTTON_DOWN;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = button;
-                events[eventCount].params[2] = 0;
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_BUTTON_DOWN: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
-            }
+            if (CORE.Input.Gamepad.currentButtonState[gamepad][button]) AddAutomationEvent(frame, INPUT_GAMEPAD_BUTTON_DOWN, gamepad, button, 0);
         }
 
         for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
         {
-            // INPUT_GAMEPAD_AXIS_MOTION
-            if (CORE.Input.Gamepad.axisState[gamepad][axis] > 0.1f)
+            // INPUT_GAMEPAD_AXIS_MOTION (only saved if changed)
+            int value = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
+            CORE.Input.Gamepad.axisState[gamepad][axis] = (float)value/32768.0f;
+
+            if (value != eventsAxis[gamepad][axis])
             {
-                events[eventCount].frame = frame;
-                events[eventCount].type = INPUT_GAMEPAD_AXIS_MOTION;
-                events[eventCount].params[0] = gamepad;
-                events[eventCount].params[1] = axis;
-                events[eventCount].params[2] = (int)(CORE.Input.Gamepad.axisState[gamepad][axis]*32768.0f);
-
-                TRACELOG(LOG_INFO, "[%i] INPUT_GAMEPAD_AXIS_MOTION: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-                eventCount++;
+                eventsAxis[gamepad][axis] = value;
+                AddAutomationEvent(frame, INPUT_GAMEPAD_AXIS_MOTION, gamepad, axis, value);
             }
         }
     }
 
+#if defined(SUPPORT_GESTURES_SYSTEM)
     // INPUT_GESTURE
-    if (GESTURES.current != GESTURE_NONE)
-    {
-        events[eventCount].frame = frame;
-        events[eventCount].type = INPUT_GESTURE;
-        events[eventCount].params[0] = GESTURES.current;
-        events[eventCount].params[1] = 0;
-        events[eventCount].params[2] = 0;
-
-        TRACELOG(LOG_INFO, "[%i] INPUT_GESTURE: %i, %i, %i", events[eventCount].frame, events[eventCount].params[0], events[eventCount].params[1], events[eventCount].params[2]);
-        eventCount++;
-    }
+    if (GESTURES.current != GESTURE_NONE) AddAutomationEvent(frame, INPUT_GESTURE, GESTURES.current, 0, 0);
+#endif
 }
 
 // Play automation event
+// NOTE: Recorded input replaces real input, buttons states and pressed queues are rebuilt from frame events
 static void PlayAutomationEvent(unsigned int frame)
 {
-    for (unsigned int i = 0; i < eventCount; i++)
+    memset(CORE.Input.Keyboard.currentKeyState, 0, MAX_KEYBOARD_KEYS);
+    memset(CORE.Input.Mouse.currentButtonState, 0, MAX_MOUSE_BUTTONS);
+    memset(CORE.Input.Touch.currentTouchState, 0, MAX_TOUCH_POINTS);
+    memset(CORE.Input.Gamepad.currentButtonState, 0, MAX_GAMEPADS*MAX_GAMEPAD_BUTTONS);
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+    CORE.Input.Mouse.currentWheelMove = 0.0f;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    GESTURES.current = GESTURE_NONE;
+#endif
+
+    for (; (eventsPlayIndex < eventCount) && (events[eventsPlayIndex].frame <= frame); eventsPlayIndex++)
     {
-        if (events[i].frame == frame)
+        const AutomationEvent *event = &events[eventsPlayIndex];
+        const int *params = event->params;
+
+        if (event->frame < frame) continue;
+
+        switch (event->type)
         {
-            switch (events[i].type)
+            // Input events
+            case INPUT_KEY_UP:
+            case INPUT_KEY_DOWN:        // param[0]: key
             {
-                // Input events
-                case INPUT_KEY_UP: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = false; break;             // param[0]: key
-                case INPUT_KEY_DOWN: CORE.Input.Keyboard.currentKeyState[events[i].params[0]] = true; break;            // param[0]: key
-                case INPUT_MOUSE_BUTTON_UP: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = false; break;    // param[0]: key
-                case INPUT_MOUSE_BUTTON_DOWN: CORE.Input.Mouse.currentButtonState[events[i].params[0]] = true; break;   // param[0]: key
-                case INPUT_MOUSE_POSITION:      // param[0]: x, param[1]: y
-                {
-                    CORE.Input.Mouse.currentPosition.x = (float)events[i].params[0];
-                    CORE.Input.Mouse.currentPosition.y = (float)events[i].params[1];
-                } break;
-                case INPUT_MOUSE_WHEEL_MOTION: CORE.Input.Mouse.currentWheelMove = (float)events[i].params[0]; break;   // param[0]: delta
-                case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[events[i].params[0]] = false; break;            // param[0]: id
-                case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[events[i].params[0]] = true; break;           // param[0]: id
-                case INPUT_TOUCH_POSITION:      // param[0]: id, param[1]: x, param[2]: y
-                {
-                    CORE.Input.Touch.position[events[i].params[0]].x = (float)events[i].params[1];
-                    CORE.Input.Touch.position[events[i].params[0]].y = (float)events[i].params[2];
-                } break;
-                case INPUT_GAMEPAD_CONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = true; break;                // param[0]: gamepad
-                case INPUT_GAMEPAD_DISCONNECT: CORE.Input.Gamepad.ready[events[i].params[0]] = false; break;            // param[0]: gamepad
-                case INPUT_GAMEPAD_BUTTON_UP: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = false; break;    // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_BUTTON_DOWN: CORE.Input.Gamepad.currentButtonState[events[i].params[0]][events[i].params[1]] = true; break;   // param[0]: gamepad, param[1]: button
-                case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
+                if ((params[0] >= 0) && (params[0] < MAX_KEYBOARD_KEYS)) CORE.Input.Keyboard.currentKeyState[params[0]] = (event->type == INPUT_KEY_DOWN);
+            } break;
+            case INPUT_KEY_PRESSED:     // param[0]: key
+            {
+                if (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE)
                 {
-                    CORE.Input.Gamepad.axisState[events[i].params[0]][events[i].params[1]] = ((float)events[i].params[2]/32768.0f);
-                } break;
-                case INPUT_GESTURE: GESTURES.current = events[i].params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
-
-                // Window events
-                case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
-                case WINDOW_MAXIMIZE: MaximizeWindow(); break;
-                case WINDOW_MINIMIZE: MinimizeWindow(); break;
-                case WINDOW_RESIZE: SetWindowSize(events[i].params[0], events[i].params[1]); break;
-
-                // Custom events
-                case ACTION_TAKE_SCREENSHOT:
+                    CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = params[0];
+                    CORE.Input.Keyboard.keyPressedQueueCount++;
+                }
+            } break;
+            case INPUT_MOUSE_BUTTON_UP:
+            case INPUT_MOUSE_BUTTON_DOWN:   // param[0]: button
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_MOUSE_BUTTONS)) CORE.Input.Mouse.currentButtonState[params[0]] = (event->type == INPUT_MOUSE_BUTTON_DOWN);
+            } break;
+            case INPUT_MOUSE_POSITION: eventsMousePosition = (Vector2){ (float)params[0], (float)params[1] }; break;  // param[0]: x, param[1]: y
+            case INPUT_MOUSE_WHEEL_MOTION: CORE.Input.Mouse.currentWheelMove = (float)params[0]/1000.0f; break;         // param[0]: delta (x1000)
+            case INPUT_TOUCH_UP:
+            case INPUT_TOUCH_DOWN:      // param[0]: id
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_TOUCH_POINTS)) CORE.Input.Touch.currentTouchState[params[0]] = (event->type == INPUT_TOUCH_DOWN);
+            } break;
+            case INPUT_TOUCH_POSITION:  // param[0]: id, param[1]: x, param[2]: y
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_TOUCH_POINTS)) CORE.Input.Touch.position[params[0]] = (Vector2){ (float)params[1], (float)params[2] };
+            } break;
+            case INPUT_GAMEPAD_CONNECT:
+            case INPUT_GAMEPAD_DISCONNECT:  // param[0]: gamepad
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS)) eventsGamepadReady[params[0]] = (event->type == INPUT_GAMEPAD_CONNECT);
+            } break;
+            case INPUT_GAMEPAD_BUTTON_UP:
+            case INPUT_GAMEPAD_BUTTON_DOWN: // param[0]: gamepad, param[1]: button
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_BUTTONS))
                 {
-                    TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
-                    screenshotCounter++;
-                } break;
-                case ACTION_SETTARGETFPS: SetTargetFPS(events[i].params[0]); break;
-                default: break;
+                    CORE.Input.Gamepad.currentButtonState[params[0]][params[1]] = (event->type == INPUT_GAMEPAD_BUTTON_DOWN);
+                }
+            } break;
+            case INPUT_GAMEPAD_AXIS_MOTION: // param[0]: gamepad, param[1]: axis, param[2]: delta
+            {
+                if ((params[0] >= 0) && (params[0] < MAX_GAMEPADS) && (params[1] >= 0) && (params[1] < MAX_GAMEPAD_AXIS)) eventsAxis[params[0]][params[1]] = params[2];
+            } break;
+#if defined(SUPPORT_GESTURES_SYSTEM)
+            case INPUT_GESTURE: GESTURES.current = params[0]; break;     // param[0]: gesture (enum Gesture) -> rgestures.h: GESTURES.current
+#endif
+
+            // Window events
+            case WINDOW_CLOSE: CORE.Window.shouldClose = true; break;
+            case WINDOW_MAXIMIZE: MaximizeWindow(); break;
+            case WINDOW_MINIMIZE: MinimizeWindow(); break;
+            case WINDOW_RESIZE: SetWindowSize(params[0], params[1]); break;
+
+            // Custom events
+            case ACTION_TAKE_SCREENSHOT:
+            {
+                TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+                screenshotCounter++;
+            } break;
+            case ACTION_SETTARGETFPS: SetTargetFPS(params[0]); break;
+            default: break;
+        }
+    }
+
+    // Persistent states, only recorded on changes
+    CORE.Input.Mouse.currentPosition = eventsMousePosition;
+
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
+        CORE.Input.Gamepad.ready[gamepad] = eventsGamepadReady[gamepad];
+        for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++) CORE.Input.Gamepad.axisState[gamepad][axis] = (float)eventsAxis[gamepad][axis]/32768.0f;
+    }
+
+    // Input events stream (PollInputEvent()) is rebuilt from replayed states changes
+    double time = GetTime();
+    CORE.Input.Events.frameCount = 0;
+    CORE.Input.Events.frameRead = 0;
+
+    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+    {
+        if (CORE.Input.Keyboard.currentKeyState[key] != CORE.Input.Keyboard.previousKeyState[key])
+        {
+            RegisterInputEvent((InputEvent){ CORE.Input.Keyboard.currentKeyState[key]? INPUT_EVENT_KEY_DOWN : INPUT_EVENT_KEY_UP, time, 0, key, { 0 } });
+        }
+    }
+
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        if (CORE.Input.Mouse.currentButtonState[button] != CORE.Input.Mouse.previousButtonState[button])
+        {
+            RegisterInputEvent((InputEvent){ CORE.Input.Mouse.currentButtonState[button]? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP, time, 0, button, { 0 } });
+        }
+    }
+
+    if ((CORE.Input.Mouse.currentPosition.x != CORE.Input.Mouse.previousPosition.x) || (CORE.Input.Mouse.currentPosition.y != CORE.Input.Mouse.previousPosition.y))
+    {
+        RegisterInputEvent((InputEvent){ INPUT_EVENT_MOUSE_MOVE, time, 0, 0, CORE.Input.Mouse.currentPosition });
+    }
+
+    if (CORE.Input.Mouse.currentWheelMove != 0.0f) RegisterInputEvent((InputEvent){ INPUT_EVENT_MOUSE_WHEEL, time, 0, 0, { 0.0f, CORE.Input.Mouse.currentWheelMove } });
+
+    for (int gamepad = 0; gamepad < MAX_GAMEPADS; gamepad++)
+    {
+        for (int button = 0; button < MAX_GAMEPAD_BUTTONS; button++)
+        {
+            if (CORE.Input.Gamepad.currentButtonState[gamepad][button] != CORE.Input.Gamepad.previousButtonState[gamepad][button])
+            {
+                RegisterInputEvent((InputEvent){ CORE.Input.Gamepad.currentButtonState[gamepad][button]? INPUT_EVENT_GAMEPAD_BUTTON_DOWN : INPUT_EVENT_GAMEPAD_BUTTON_UP, time, gamepad, button, { 0 } });
             }
         }
     }
 }
+
+// Register last drawn frame timings and render stats (replay)
+static void RecordAutomationFrameStats(void)
+{
+    if (eventsStatsCount >= eventsFrameCount) return;
+
+    AutomationFrameStats *stats = &eventsStats[eventsStatsCount];
+    stats->frameTime = CORE.Time.frame;
+    stats->updateTime = CORE.Time.update;
+    stats->drawTime = CORE.Time.draw;
+    stats->render = rlGetFrameStats();
+
+    eventsStatsCount++;
+}
+
+// Export replayed frames timings and render stats, format depends on file extension (.json or .csv)
+static void ExportAutomationFrameStats(const char *fileName)
+{
+    FILE *statsFile = fopen(fileName, "wt");
+
+    if (statsFile == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to export frames stats", fileName);
+        return;
+    }
+
+    bool json = IsFileExtension(fileName, ".json");
+
+    if (json) fprintf(statsFile, "{\n    \"deltaTime\": %.9f,\n    \"frames\": [\n", eventsDeltaTime);
+    else fprintf(statsFile, "frame,frame_time,update_time,draw_time,cpu_draw_time,cpu_swap_time,gpu_time,draw_calls,batch_flushes,batch_overflows,vertex_count,texture_changes,texture_binds,state_changes_skipped\n");
+
+    for (unsigned int i = 0; i < eventsStatsCount; i++)
+    {
+        const AutomationFrameStats *stats = &eventsStats[i];
+        const rlFrameStats *render = &stats->render;
+
+        if (json)
+        {
+            fprintf(statsFile, "        { \"frame\": %u, \"frameTime\": %.6f, \"updateTime\": %.6f, \"drawTime\": %.6f, \"cpuDrawTime\": %.6f, \"cpuSwapTime\": %.6f, \"gpuTime\": %.6f, "
+                "\"drawCalls\": %i, \"batchFlushes\": %i, \"batchOverflows\": %i, \"vertexCount\": %i, \"textureChanges\": %i, \"textureBinds\": %i, \"stateChangesSkipped\": %i }%s\n",
+                i, stats->frameTime, stats->updateTime, stats->drawTime, render->cpuEndTime - render->cpuBeginTime, render->cpuSwapTime, render->gpuTime,
+                render->drawCalls, render->batchFlushes, render->batchOverflows, render->vertexCount, render->textureChanges, render->textureBinds, render->stateChangesSkipped,
+                (i < (eventsStatsCount - 1))? "," : "");
+        }
+        else
+        {
+            fprintf(statsFile, "%u,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%i,%i,%i,%i,%i,%i,%i\n",
+                i, stats->frameTime, stats->updateTime, stats->drawTime, render->cpuEndTime - render->cpuBeginTime, render->cpuSwapTime, render->gpuTime,
+                render->drawCalls, render->batchFlushes, render->batchOverflows, render->vertexCount, render->textureChanges, render->textureBinds, render->stateChangesSkipped);
+        }
+    }
+
+    if (json) fprintf(statsFile, "    ]\n}\n");
+
+    fclose(statsFile);
+
+    TRACELOG(LOG_INFO, "AUTOMATION: [%s] Frames stats exported: %i frames", fileName, eventsStatsCount);
+}
+
+// Restore swap interval, replay runs without vsync
+static void ResetAutomationSwapInterval(bool replay)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (replay) glfwSwapInterval(0);
+    else if (CORE.Time.pacing != FRAME_PACING_TIMER) glfwSwapInterval(CORE.Time.swapInterval);
+    else glfwSwapInterval(((CORE.Window.flags & FLAG_VSYNC_HINT) > 0)? 1 : 0);
+#elif defined(PLATFORM_NX)
+    if (replay) SetSwapInterval(0);
+    else if (CORE.Time.pacing != FRAME_PACING_TIMER) SetSwapInterval(CORE.Time.swapInterval);
+    else SetSwapInterval(((CORE.Window.flags & FLAG_VSYNC_HINT) > 0)? 1 : 0);
+#endif
+}
+
+// Update automation events recording or replay, called at frame end (after PollInputEvents())
+static void UpdateAutomationEvents(void)
+{
+    if (eventsRecording) RecordAutomationEvent(eventsFrame);
+    else if (eventsPlaying)
+    {
+        // Frame drawn with previous frame replayed input
+        if (eventsFrame > 0) RecordAutomationFrameStats();
+
+        if (eventsFrame >= eventsFrameCount)
+        {
+            StopAutomationEventsReplay();
+            return;
+        }
+
+        PlayAutomationEvent(eventsFrame);
+    }
+    else return;
+
+    eventsFrame++;
+}
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
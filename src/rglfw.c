@@ -34,19 +34,21 @@
 // _GLFW_X11        to use the X Window System
 // _GLFW_WAYLAND    to use the Wayland API (experimental and incomplete)
 // _GLFW_COCOA      to use the Cocoa frameworks
-// _GLFW_OSMESA     to use the OSMesa API (headless and non-interactive)
+// _GLFW_OSMESA     to use the OSMesa API (headless and non-interactive), null platform (no window, no input)
 // _GLFW_MIR        experimental, not supported at this moment
 
 #if defined(_WIN32)
     #define _GLFW_WIN32
 #endif
 #if defined(__linux__)
-    #if !defined(_GLFW_WAYLAND)     // Required for Wayland windowing
+    #if !defined(_GLFW_WAYLAND) && !defined(_GLFW_OSMESA)   // Required for Wayland windowing and headless mode
         #define _GLFW_X11
     #endif
 #endif
 #if defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
-    #define _GLFW_X11
+    #if !defined(_GLFW_OSMESA)
+        #define _GLFW_X11
+    #endif
 #endif
 #if defined(__APPLE__)
     #define _GLFW_COCOA
@@ -91,25 +93,41 @@
         #include "external/glfw/src/x11_window.c"
         #include "external/glfw/src/glx_context.c"
     #endif
-
-    #include "external/glfw/src/linux_joystick.c"
+    #if defined(_GLFW_OSMESA)
+        #include "external/glfw/src/null_init.c"
+        #include "external/glfw/src/null_monitor.c"
+        #include "external/glfw/src/null_window.c"
+        #include "external/glfw/src/null_joystick.c"
+    #else
+        #include "external/glfw/src/linux_joystick.c"
+    #endif
     #include "external/glfw/src/posix_thread.c"
     #include "external/glfw/src/posix_time.c"
     #include "external/glfw/src/xkb_unicode.c"
-    #include "external/glfw/src/egl_context.c"
+    #if !defined(_GLFW_OSMESA)
+        #include "external/glfw/src/egl_context.c"
+    #endif
     #include "external/glfw/src/osmesa_context.c"
 #endif
 
 #if defined(__FreeBSD__) || defined(__OpenBSD__) || defined( __NetBSD__) || defined(__DragonFly__)
-    #include "external/glfw/src/x11_init.c"
-    #include "external/glfw/src/x11_monitor.c"
-    #include "external/glfw/src/x11_window.c"
+    #if defined(_GLFW_OSMESA)
+        #include "external/glfw/src/null_init.c"
+        #include "external/glfw/src/null_monitor.c"
+        #include "external/glfw/src/null_window.c"
+    #else
+        #include "external/glfw/src/x11_init.c"
+        #include "external/glfw/src/x11_monitor.c"
+        #include "external/glfw/src/x11_window.c"
+    #endif
     #include "external/glfw/src/xkb_unicode.c"
     #include "external/glfw/src/null_joystick.c"
     #include "external/glfw/src/posix_time.c"
     #include "external/glfw/src/posix_thread.c"
-    #include "external/glfw/src/glx_context.c"
-    #include "external/glfw/src/egl_context.c"
+    #if !defined(_GLFW_OSMESA)
+        #include "external/glfw/src/glx_context.c"
+        #include "external/glfw/src/egl_context.c"
+    #endif
     #include "external/glfw/src/osmesa_context.c"
 #endif
 
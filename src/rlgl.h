@@ -30,6 +30,11 @@
 *       Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *       required by any other module, use rlGetVersion() to check it
 *
+*   #define GRAPHICS_API_CITRO3D
+*       Use citro3d backend (Nintendo 3DS), OpenGL ES 2.0 code path is used over the
+*       OpenGL ES 2.0 subset provided by rlgl_c3d.h (no GLSL shaders, default shader only)
+*       Stereoscopic screen is supported, see rlSetStereoScreen()
+*
 *   #define RLGL_IMPLEMENTATION
 *       Generates the implementation of the library into the included file.
 *       If not defined, the library is in header only mode and can be included in other headers
@@ -45,16 +50,84 @@
 *   #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *       Enable debug context (only available on OpenGL 4.3)
 *
+*   #define RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+*       Use an interleaved vertex layout for the render batch (position + texcoord + color, 24 bytes),
+*       stored in a single vertex buffer, instead of one separate vertex buffer per attribute
+*
+*   #define RLGL_ENABLE_BATCH_MULTI_TEXTURE
+*       Let one render batch draw call use up to 4 textures, selected by a per-vertex texture index
+*       on default shader, so changing between a few textures does not require a new draw call
+*       NOTE: It requires (and enables) RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+*
+*   #define RLGL_ENABLE_BATCH_SDF_SHAPES
+*       Store an analytic shape (rounded box: half size, corner radius, outline thickness) per vertex,
+*       evaluated by default shader, so a rounded rectangle, circle or ring is drawn as one quad
+*       and batched with any other drawing, shape local position is provided as texture coordinates
+*       NOTE: It requires (and enables) RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+*
+*   #define RLGL_ENABLE_BATCH_TRIANGLE_LIST
+*       Build render batch indices on rlEnd() instead of using a static quads index buffer, quads, triangles,
+*       triangle strips and triangle fans are converted to a triangle list and share the same draw call,
+*       so shapes can be drawn with their native primitive (no degenerate quads) without breaking batching
+*       NOTE: RL_TRIANGLE_STRIP and RL_TRIANGLE_FAN modes are only supported by render batch with it
+*
+*   #define RLGL_ENABLE_BATCH_DRAW_STATE
+*       Record blend mode (rlSetBlendMode()) and scissor rect (rlEnableDrawScissor()) per render batch draw call,
+*       applied while drawing the batch, so clipped or blended drawing does not flush the batch on every change,
+*       direct draws (rlDrawVertexArray*()) and clears apply current state before drawing
+*       NOTE: Blend factors changes (rlSetBlendFactors*()) still flush the batch, factors are not recorded per draw
+*
+*   #define RLGL_ENABLE_BATCH_BUFFER_RING
+*       Use the render batch vertex buffers as a fenced ring: on OpenGL 3.3 with GL_ARB_buffer_storage
+*       buffers are persistently mapped and rlVertex*() writes directly into GPU-visible memory,
+*       otherwise buffers are orphaned on every upload to avoid implicit CPU-GPU syncs
+*       NOTE: It requires 3 or more batch buffers (RL_DEFAULT_BATCH_BUFFERS, rlLoadRenderBatch() numBuffers) to let
+*       the GPU consume previous segments, rlLoadRenderBatch() warns at runtime on batches loaded with less buffers
+*
+*   #define RLGL_ENABLE_BATCH_GROWTH
+*       Grow render batch buffers (doubling capacity) when vertex or draw calls limits are reached,
+*       instead of drawing the batch in the middle of the frame, up to RL_MAX_BATCH_BUFFER_ELEMENTS
+*       and RL_MAX_BATCH_DRAWCALLS, batch is only flushed when those ceilings are reached
+*       NOTE: Persistently mapped buffers (RLGL_ENABLE_BATCH_BUFFER_RING) are not grown
+*
+*   #define RLGL_ENABLE_SHADER_CACHE
+*       Cache linked shader programs binaries on disk (glGetProgramBinary(), GL_OES_get_program_binary on ES2),
+*       keyed by shaders code and driver version, programs are only compiled on cache misses,
+*       cache files are stored with rlSetShaderCachePath() prefix (RL_DEFAULT_SHADER_CACHE_PATH by default)
+*
+*   #define RLGL_ENABLE_COMMAND_LISTS
+*       Let any thread record rlgl immediate-mode calls into a command list (rlBeginCommandList()),
+*       recorded lists are submitted in order to the render batch on the GL thread (rlSubmitCommandList())
+*       NOTE: Recording state is thread-local, it requires C11 _Thread_local (or __declspec(thread) on MSVC)
+*
+*   #define RLGL_ENABLE_DEFERRED_UNLOAD
+*       Defer GPU objects deletion (rlUnloadTexture(), rlUnloadFramebuffer(), rlUnloadVertexArray(), rlUnloadVertexBuffer(),
+*       rlUnloadShaderProgram()), unloads can be requested from any thread and are queued (lock-free), deleted on
+*       rlProcessDeferredUnloads() at frame end once a fence confirms GPU is done with them (RL_DEFERRED_UNLOAD_FRAMES if not supported)
+*       NOTE: Objects are deleted on GL thread, so GL commands are never issued from other threads and drivers do not stall on deletion
+*
+*   #define RLGL_DISABLE_SIMD
+*       Disable SSE/NEON vertex spans transform (rlVertex2fv(), rlVertex3fv(), rlTexCoordVertex2fv()),
+*       SIMD path is used by default if compiler targets SSE (x86/x64) or NEON (ARM/AArch64)
+*
 *   rlgl capabilities could be customized just defining some internal
 *   values before library inclusion (default values listed):
 *
 *   #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *   #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
+*   #define RL_MAX_BATCH_BUFFER_ELEMENTS      65536    // Maximum render batch elements grown to (RLGL_ENABLE_BATCH_GROWTH), 16384 on ES2
+*   #define RL_MAX_BATCH_DRAWCALLS             4096    // Maximum render batch draw calls grown to (RLGL_ENABLE_BATCH_GROWTH)
 *   #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*   #define RL_MAX_STATE_CACHE_TEXTURE_UNITS     16    // Maximum number of texture units tracked by GL state cache
+*   #define RL_MAX_STATE_CACHE_PROGRAMS           8    // Maximum number of shader programs with batch uniforms tracked by GL state cache
+*   #define RL_DEFAULT_SHADER_CACHE_PATH         ""    // Default shader program binaries cache path prefix (RLGL_ENABLE_SHADER_CACHE)
+*   #define RL_MAX_PENDING_SHADER_PROGRAMS       64    // Maximum number of shader programs loaded asynchronously not finished yet
+*   #define RL_DEFAULT_INSTANCE_STREAM_SIZE   1048576    // Default instance stream buffer size in bytes (grows if required)
+*   #define RL_DEFERRED_UNLOAD_FRAMES             2    // Frames deferred unloads wait if GPU fences are not supported (RLGL_ENABLE_DEFERRED_UNLOAD)
 *
 *   #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
-*   #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*   #define RL_MAX_SHADER_LOCATIONS              40    // Maximum number of shader locations supported
 *   #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *   #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -67,15 +140,30 @@
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Binded by default to shader location: 3
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Binded by default to shader location: 4
 *   #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Binded by default to shader location: 5
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX     "vertexTexIndex"    // Binded by default to shader location: 6 (RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Binded by default to shader location: 6
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Binded by default to shader location: 7
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE        "vertexShape"       // Binded by default to shader location: 7 (RLGL_ENABLE_BATCH_SDF_SHAPES)
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM "instanceTransform" // Instance transform (used if "matModel" uniform not found)
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR     "instanceColor"     // Instance color
+*   #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM    "instanceCustom"    // Instance custom data
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 *   #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+*   #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (GPU skinning)
+*   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_TARGET_COUNT "morphTargetCount"  // morph targets count (GPU morphing)
+*   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_INDICES "morphIndices"    // blended morph targets indices array (GPU morphing)
+*   #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS "morphWeights"    // blended morph targets weights array (GPU morphing)
+*   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS "morphTargets"  // morph targets deltas texture (GPU morphing)
 *   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
+*   #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_LIGHTMAP  "lightmap"          // lightmap (baked lighting, sampled with texcoords2)
+*   #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME     "FrameData"     // per-frame uniform block (camera matrices), OpenGL 3.3 only
+*   #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_MATERIAL  "MaterialData"  // per-material uniform block (material colors and params), OpenGL 3.3 only
 *
 *   DEPENDENCIES:
 *
@@ -130,6 +218,12 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Support profiling zones macros, provided by raylib utils (SUPPORT_PROFILING_ZONES)
+#ifndef RL_PROFILE_ZONE_BEGIN
+    #define RL_PROFILE_ZONE_BEGIN(zone, name) (void)0
+    #define RL_PROFILE_ZONE_END(zone) (void)0
+#endif
+
 // Allow custom memory allocators
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)     malloc(sz)
@@ -144,6 +238,11 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// citro3d backend uses OpenGL ES 2.0 code path (rlgl_c3d.h)
+#if defined(GRAPHICS_API_CITRO3D)
+    #define GRAPHICS_API_OPENGL_ES2
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -188,6 +287,41 @@
 // Defines and Macros
 //----------------------------------------------------------------------------------
 
+// Multi-texture batching requires a GLSL default shader, not available on citro3d backend
+#if defined(GRAPHICS_API_CITRO3D) && defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    #undef RLGL_ENABLE_BATCH_MULTI_TEXTURE
+#endif
+
+// Multi-texture batching stores the texture index in interleaved vertex data
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE) && !defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    #define RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+#endif
+
+// SDF shapes batching requires a GLSL default shader, not available on OpenGL 1.1 and citro3d backend
+#if (defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_CITRO3D)) && defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    #undef RLGL_ENABLE_BATCH_SDF_SHAPES
+#endif
+
+// SDF shapes batching stores the shape in interleaved vertex data
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES) && !defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    #define RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX
+#endif
+
+// Triangle list batching uploads indices with vertex data, not supported by citro3d backend
+#if defined(GRAPHICS_API_CITRO3D) && defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    #undef RLGL_ENABLE_BATCH_TRIANGLE_LIST
+#endif
+
+// Draw state batching records state applied by batch drawing, not available on OpenGL 1.1
+#if defined(GRAPHICS_API_OPENGL_11) && defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    #undef RLGL_ENABLE_BATCH_DRAW_STATE
+#endif
+
+// Deferred unloads are processed on rlgl data, not available on OpenGL 1.1
+#if defined(GRAPHICS_API_OPENGL_11) && defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    #undef RLGL_ENABLE_DEFERRED_UNLOAD
+#endif
+
 // Default internal render batch elements limits
 #ifndef RL_DEFAULT_BATCH_BUFFER_ELEMENTS
     #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
@@ -203,14 +337,50 @@
     #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_BUFFERS
-    #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
+    #if defined(RLGL_ENABLE_BATCH_BUFFER_RING)
+        #define RL_DEFAULT_BATCH_BUFFERS             3      // Default number of batch buffers (ring segments, fenced)
+    #else
+        #define RL_DEFAULT_BATCH_BUFFERS             1      // Default number of batch buffers (multi-buffering)
+    #endif
 #endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
+#ifndef RL_MAX_BATCH_BUFFER_ELEMENTS
+    #define RL_MAX_BATCH_BUFFER_ELEMENTS         65536      // Maximum render batch elements (quads) grown to (RLGL_ENABLE_BATCH_GROWTH)
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2) && (RL_MAX_BATCH_BUFFER_ELEMENTS > 16384)
+    // ES2 batch indices are 16-bit, a batch buffer can not address more than 65536 vertex
+    #undef RL_MAX_BATCH_BUFFER_ELEMENTS
+    #define RL_MAX_BATCH_BUFFER_ELEMENTS         16384
+#endif
+#ifndef RL_MAX_BATCH_DRAWCALLS
+    #define RL_MAX_BATCH_DRAWCALLS                4096      // Maximum render batch draw calls grown to (RLGL_ENABLE_BATCH_GROWTH)
+#endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_MAX_STATE_CACHE_TEXTURE_UNITS
+    #define RL_MAX_STATE_CACHE_TEXTURE_UNITS        16      // Maximum number of texture units tracked by GL state cache (binds on other units are not cached)
+#endif
+#ifndef RL_MAX_STATE_CACHE_PROGRAMS
+    #define RL_MAX_STATE_CACHE_PROGRAMS              8      // Maximum number of shader programs with batch uniforms tracked by GL state cache (least recently claimed replaced)
+#endif
+#ifndef RL_DEFAULT_SHADER_CACHE_PATH
+    #define RL_DEFAULT_SHADER_CACHE_PATH            ""      // Default shader program binaries cache path prefix, directory must exist (RLGL_ENABLE_SHADER_CACHE)
+#endif
+#ifndef RL_MAX_PENDING_SHADER_PROGRAMS
+    #define RL_MAX_PENDING_SHADER_PROGRAMS          64      // Maximum number of shader programs loaded asynchronously not finished yet (loaded synchronously if exceeded)
+#endif
+#ifndef RL_DEFERRED_UNLOAD_FRAMES
+    #define RL_DEFERRED_UNLOAD_FRAMES                2      // Frames deferred unloads wait before deletion if GPU fences are not supported (RLGL_ENABLE_DEFERRED_UNLOAD)
+#endif
+#ifndef RL_DEFAULT_INSTANCE_STREAM_SIZE
+    #define RL_DEFAULT_INSTANCE_STREAM_SIZE    1048576      // Default instance stream buffer size in bytes, grows if a single upload does not fit (rlUpdateInstanceStream())
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    #define RL_BATCH_MULTI_TEXTURES                  4      // Number of textures per batch draw call with multi-texture batching (fixed by default shader)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -219,8 +389,15 @@
 
 // Shader limits
 #ifndef RL_MAX_SHADER_LOCATIONS
-    #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
+    #define RL_MAX_SHADER_LOCATIONS                 40      // Maximum number of shader locations supported
 #endif
+#ifndef RL_MAX_STATE_CACHE_UNIFORM_BUFFERS
+    #define RL_MAX_STATE_CACHE_UNIFORM_BUFFERS       8      // Maximum number of uniform buffer binding points tracked by GL state cache
+#endif
+
+// Uniform blocks binding points shared by all shaders
+#define RL_UNIFORM_BLOCK_BINDING_FRAME               0      // Per-frame uniform block binding point
+#define RL_UNIFORM_BLOCK_BINDING_MATERIAL            1      // Per-material uniform block binding point
 
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
@@ -235,6 +412,8 @@
 #define RL_TEXTURE_WRAP_T                       0x2803      // GL_TEXTURE_WRAP_T
 #define RL_TEXTURE_MAG_FILTER                   0x2800      // GL_TEXTURE_MAG_FILTER
 #define RL_TEXTURE_MIN_FILTER                   0x2801      // GL_TEXTURE_MIN_FILTER
+#define RL_TEXTURE_BASE_LEVEL                   0x813C      // GL_TEXTURE_BASE_LEVEL
+#define RL_TEXTURE_MAX_LEVEL                    0x813D      // GL_TEXTURE_MAX_LEVEL
 
 #define RL_TEXTURE_FILTER_NEAREST               0x2600      // GL_NEAREST
 #define RL_TEXTURE_FILTER_LINEAR                0x2601      // GL_LINEAR
@@ -257,10 +436,15 @@
 // Primitive assembly draw modes
 #define RL_LINES                                0x0001      // GL_LINES
 #define RL_TRIANGLES                            0x0004      // GL_TRIANGLES
+#define RL_TRIANGLE_STRIP                       0x0005      // GL_TRIANGLE_STRIP
+#define RL_TRIANGLE_FAN                         0x0006      // GL_TRIANGLE_FAN
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_SHORT                                0x1402      // GL_SHORT
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
 
 // Buffer usage hint
@@ -279,9 +463,33 @@
 #define RL_VERTEX_SHADER                        0x8B31      // GL_VERTEX_SHADER
 #define RL_COMPUTE_SHADER                       0x91B9      // GL_COMPUTE_SHADER
 
+// GL blending factors
+#define RL_ZERO                                 0           // GL_ZERO
+#define RL_ONE                                  1           // GL_ONE
+#define RL_SRC_COLOR                            0x0300      // GL_SRC_COLOR
+#define RL_ONE_MINUS_SRC_COLOR                  0x0301      // GL_ONE_MINUS_SRC_COLOR
+#define RL_SRC_ALPHA                            0x0302      // GL_SRC_ALPHA
+#define RL_ONE_MINUS_SRC_ALPHA                  0x0303      // GL_ONE_MINUS_SRC_ALPHA
+#define RL_DST_ALPHA                            0x0304      // GL_DST_ALPHA
+#define RL_ONE_MINUS_DST_ALPHA                  0x0305      // GL_ONE_MINUS_DST_ALPHA
+#define RL_DST_COLOR                            0x0306      // GL_DST_COLOR
+#define RL_ONE_MINUS_DST_COLOR                  0x0307      // GL_ONE_MINUS_DST_COLOR
+
+// GL blending equations
+#define RL_FUNC_ADD                             0x8006      // GL_FUNC_ADD
+#define RL_FUNC_SUBTRACT                        0x800A      // GL_FUNC_SUBTRACT
+#define RL_FUNC_REVERSE_SUBTRACT                0x800B      // GL_FUNC_REVERSE_SUBTRACT
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+#if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    #include <stdbool.h>
+#elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
+    // Boolean type
+typedef enum bool { false = 0, true = !false } bool;
+#endif
+
 typedef enum {
     OPENGL_11 = 1,
     OPENGL_21,
@@ -314,21 +522,77 @@ typedef enum {
     RL_ATTACHMENT_RENDERBUFFER = 200,
 } rlFramebufferAttachTextureType;
 
+// Video memory stats types
+typedef enum {
+    RL_MEMORY_TEXTURES = 0,     // Textures, cubemaps and renderbuffers
+    RL_MEMORY_BUFFERS           // Vertex, index, pixel, uniform and storage buffers
+} rlMemoryType;
+
+// Video memory stats, estimated from loaded objects data sizes (driver padding and alignment not included)
+typedef struct rlMemoryStats {
+    long long usedBytes;        // Video memory used (in bytes)
+    long long peakBytes;        // Video memory used peak (in bytes)
+    int objectCount;            // Objects loaded
+    int frameLoads;             // Objects loaded on last frame
+    int frameUnloads;           // Objects unloaded on last frame
+} rlMemoryStats;
+
+// Frame stats, render batch counters and CPU/GPU times of one frame
+typedef struct rlFrameStats {
+    int drawCalls;              // Draw calls issued (render batch draws, vertex arrays and instanced draws)
+    int batchFlushes;           // Render batch flushes with vertex data (rlDrawRenderBatch())
+    int batchOverflows;         // Render batch flushes forced by buffers limits (rlCheckRenderBatchLimit())
+    int batchGrowths;           // Render batch buffers grown instead of flushed (RLGL_ENABLE_BATCH_GROWTH)
+    int batchVertexPeak;        // Render batch vertex high-water mark (largest batch flushed)
+    int batchDrawsPeak;         // Render batch draw calls high-water mark (largest batch flushed)
+    int vertexCount;            // Vertex drawn by render batch
+    int textureChanges;         // Render batch draws closed by a texture change (rlSetTexture())
+    int textureBinds;           // Texture binds on render batch drawing
+    int stateChangesSkipped;    // Redundant GL state changes skipped by state cache (program, textures, buffers, capabilities)
+    double cpuBeginTime;        // CPU time at frame drawing begin (seconds, provided by rlBeginFrameStats())
+    double cpuEndTime;          // CPU time at frame drawing end (seconds, provided by rlEndFrameStats())
+    double cpuSwapTime;         // CPU time spent on buffers swap (seconds, provided by rlSetFrameStatsSwapTime())
+    double gpuTime;             // GPU time for frame drawing (seconds), -1.0 if timer queries not supported
+} rlFrameStats;
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+// Interleaved batch vertex (24 bytes, +4 bytes with multi-texture batching, +16 bytes with SDF shapes batching)
+typedef struct rlVertexInterleaved {
+    float x, y, z;              // Vertex position (shader-location = 0)
+    float u, v;                 // Vertex texture coordinates (shader-location = 1)
+    unsigned char r, g, b, a;   // Vertex color (shader-location = 3)
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    unsigned char texIndex;     // Vertex texture index on draw call textures (shader-location = 6)
+    unsigned char padding[3];   // Padding to keep vertex data 4-byte aligned
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    float shape[4];             // Vertex SDF shape: half width, half height, corner radius, outline thickness (shader-location = 7)
+#endif
+} rlVertexInterleaved;
+#endif
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    rlVertexInterleaved *vertices;  // Vertex data interleaved (position, texcoords, color) (shader-locations = 0, 1, 3)
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+    unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad, up to 3 per vertex with triangle list)
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
+    unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad, up to 3 per vertex with triangle list)
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+
+    void *fence;                // GPU sync object, signaled when the buffer can be reused (RLGL_ENABLE_BATCH_BUFFER_RING)
+    bool mapped;                // Vertex data arrays point to persistently mapped GPU memory (RLGL_ENABLE_BATCH_BUFFER_RING)
 } rlVertexBuffer;
 
 // Draw call type
@@ -339,9 +603,22 @@ typedef struct rlDrawCall {
     int mode;                   // Drawing mode: LINES, TRIANGLES, QUADS
     int vertexCount;            // Number of vertex of the draw
     int vertexAlignment;        // Number of vertex required for index alignment (LINES, TRIANGLES)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    int indexCount;             // Number of triangle list indices of the draw (consecutive on index buffer, following draws order)
+#endif
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Layer of the draw, draws are sorted by layer on batch drawing -> Use to create new draw call if changes
+    bool opaque;                // Draw is opaque, drawn front-to-back with 2d depth ordering -> Use to create new draw call if changes
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    int blendMode;              // Blend mode of the draw -> Use to create new draw call if changes
+    int scissor[4];             // Scissor rect of the draw (x, y, width, height), width -1: scissor test disabled -> Use to create new draw call if changes
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    int textureCount;           // Number of additional textures used by the draw (selected by vertex texture index)
+    unsigned int textureIds[RL_BATCH_MULTI_TEXTURES - 1];   // Additional textures ids, binded to texture slots 1..3
+#endif
 
     //Matrix projection;      // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;       // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -355,15 +632,12 @@ typedef struct rlRenderBatch {
 
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
+    int drawCapacity;           // Draw calls array capacity (grows with RLGL_ENABLE_BATCH_GROWTH)
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
-#if (defined(__STDC__) && __STDC_VERSION__ >= 199901L) || (defined(_MSC_VER) && _MSC_VER >= 1800)
-    #include <stdbool.h>
-#elif !defined(__cplusplus) && !defined(bool) && !defined(RL_BOOL_TYPE)
-    // Boolean type
-typedef enum bool { false = 0, true = !false } bool;
-#endif
+// Recorded rlgl commands list (RLGL_ENABLE_COMMAND_LISTS)
+typedef struct rlCommandList rlCommandList;
 
 #if !defined(RL_MATRIX_TYPE)
 // Matrix, 4x4 components, column major, OpenGL style, right handed
@@ -401,6 +675,7 @@ typedef enum {
     RL_PIXELFORMAT_UNCOMPRESSED_R32,               // 32 bpp (1 channel - float)
     RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32,         // 32*3 bpp (3 channels - float)
     RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32,      // 32*4 bpp (4 channels - float)
+    RL_PIXELFORMAT_UNCOMPRESSED_R11G11B10F,        // 32 bpp (3 channels - packed unsigned float)
     RL_PIXELFORMAT_COMPRESSED_DXT1_RGB,            // 4 bpp (no alpha)
     RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA,           // 4 bpp (1 bit alpha)
     RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA,           // 8 bpp
@@ -434,7 +709,8 @@ typedef enum {
     RL_BLEND_ADD_COLORS,               // Blend textures adding colors (alternative)
     RL_BLEND_SUBTRACT_COLORS,          // Blend textures subtracting colors (alternative)
     RL_BLEND_ALPHA_PREMUL,             // Blend premultiplied textures considering alpha
-    RL_BLEND_CUSTOM                    // Blend textures using custom src/dst factors (use rlSetBlendFactors())
+    RL_BLEND_CUSTOM,                   // Blend textures using custom src/dst factors (use rlSetBlendFactors())
+    RL_BLEND_CUSTOM_SEPARATE           // Blend textures using custom rgb/alpha separate src/dst factors (use rlSetBlendFactorsSeparate())
 } rlBlendMode;
 
 // Shader location point type
@@ -464,7 +740,19 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
+    RL_SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
+    RL_SHADER_LOC_BONE_MATRICES,       // Shader location: array of matrices uniform: boneMatrices
+    RL_SHADER_LOC_INSTANCE_COLOR,      // Shader location: instance attribute: color
+    RL_SHADER_LOC_INSTANCE_CUSTOM,     // Shader location: instance attribute: custom data
+    RL_SHADER_LOC_BLOCK_FRAME,         // Shader location: uniform block: per-frame data (camera matrices)
+    RL_SHADER_LOC_BLOCK_MATERIAL,      // Shader location: uniform block: per-material data (colors and params)
+    RL_SHADER_LOC_MAP_MORPH,           // Shader location: sampler2d texture: morph targets deltas
+    RL_SHADER_LOC_MORPH_TARGET_COUNT,  // Shader location: int uniform: morph targets count
+    RL_SHADER_LOC_MORPH_INDICES,       // Shader location: array of ints uniform: blended morph targets indices
+    RL_SHADER_LOC_MORPH_WEIGHTS,       // Shader location: array of floats uniform: blended morph targets weights
+    RL_SHADER_LOC_MAP_LIGHTMAP         // Shader location: sampler2d texture: lightmap
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE      RL_SHADER_LOC_MAP_ALBEDO
@@ -510,6 +798,7 @@ RLAPI void rlMultMatrixf(float *matf);                // Multiply the current ma
 RLAPI void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar);
 RLAPI void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar);
 RLAPI void rlViewport(int x, int y, int width, int height); // Set the viewport area
+RLAPI void rlGetViewport(int *x, int *y, int *width, int *height); // Get the viewport area
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - Vertex level operations
@@ -520,10 +809,15 @@ RLAPI void rlVertex2i(int x, int y);                  // Define one vertex (posi
 RLAPI void rlVertex2f(float x, float y);              // Define one vertex (position) - 2 float
 RLAPI void rlVertex3f(float x, float y, float z);     // Define one vertex (position) - 3 float
 RLAPI void rlTexCoord2f(float x, float y);            // Define one vertex (texture coordinate) - 2 float
+RLAPI void rlVertex2fv(const float *vertices, int count);  // Define multiple vertex (position) - 2 float each, current texcoord and color
+RLAPI void rlVertex3fv(const float *vertices, int count);  // Define multiple vertex (position) - 3 float each, current texcoord and color
+RLAPI void rlTexCoordVertex2fv(const float *texcoords, const float *vertices, int count);  // Define multiple vertex (texture coordinate and position) - 2 float each
 RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (normal) - 3 float
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI void rlShape4f(float halfWidth, float halfHeight, float radius, float thickness);   // Define one vertex (SDF shape) - 4 float, all zero for regular vertex
+RLAPI bool rlIsShapeSdfEnabled(void);                 // Check if vertex SDF shapes are evaluated on drawing (RLGL_ENABLE_BATCH_SDF_SHAPES, default shader active)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -552,6 +846,7 @@ RLAPI void rlDisableTexture(void);                      // Disable texture
 RLAPI void rlEnableTextureCubemap(unsigned int id);     // Enable texture cubemap
 RLAPI void rlDisableTextureCubemap(void);               // Disable texture cubemap
 RLAPI void rlTextureParameters(unsigned int id, int param, int value); // Set texture parameters (filter, wrap)
+RLAPI bool rlTextureSwizzleAlpha(unsigned int id);     // Set single channel texture sampled as white with red channel as alpha, returns false if not supported (id 0 only checks)
 
 // Shader state
 RLAPI void rlEnableShader(unsigned int id);             // Enable shader program
@@ -560,6 +855,7 @@ RLAPI void rlDisableShader(void);                       // Disable shader progra
 // Framebuffer state
 RLAPI void rlEnableFramebuffer(unsigned int id);        // Enable render texture (fbo)
 RLAPI void rlDisableFramebuffer(void);                  // Disable render texture (fbo), return to default framebuffer
+RLAPI unsigned int rlGetActiveFramebuffer(void);        // Get the currently active render texture (fbo), 0 for default framebuffer
 RLAPI void rlActiveDrawBuffers(int count);              // Activate multiple draw color buffers
 
 // General render state
@@ -569,11 +865,15 @@ RLAPI void rlEnableDepthTest(void);                     // Enable depth test
 RLAPI void rlDisableDepthTest(void);                    // Disable depth test
 RLAPI void rlEnableDepthMask(void);                     // Enable depth write
 RLAPI void rlDisableDepthMask(void);                    // Disable depth write
+RLAPI void rlEnableColorMask(void);                     // Enable color write
+RLAPI void rlDisableColorMask(void);                    // Disable color write (i.e. depth-only passes, occlusion queries)
 RLAPI void rlEnableBackfaceCulling(void);               // Enable backface culling
 RLAPI void rlDisableBackfaceCulling(void);              // Disable backface culling
 RLAPI void rlEnableScissorTest(void);                   // Enable scissor test
 RLAPI void rlDisableScissorTest(void);                  // Disable scissor test
 RLAPI void rlScissor(int x, int y, int width, int height); // Scissor test
+RLAPI void rlEnableDrawScissor(int x, int y, int width, int height); // Enable scissor rect for following draws (bottom-left origin), batch flushed only without RLGL_ENABLE_BATCH_DRAW_STATE
+RLAPI void rlDisableDrawScissor(void);                  // Disable scissor rect for following draws
 RLAPI void rlEnableWireMode(void);                      // Enable wire mode
 RLAPI void rlDisableWireMode(void);                     // Disable wire mode
 RLAPI void rlSetLineWidth(float width);                 // Set the line drawing width
@@ -583,12 +883,15 @@ RLAPI void rlDisableSmoothLines(void);                  // Disable line aliasing
 RLAPI void rlEnableStereoRender(void);                  // Enable stereo rendering
 RLAPI void rlDisableStereoRender(void);                 // Disable stereo rendering
 RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo render is enabled
+RLAPI void rlSetStereoScreen(float separation, float convergence);    // Set stereoscopic screen eyes separation (0: mono) and zero parallax distance (citro3d only)
 
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
+RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately for rgb and alpha (using OpenGL factors)
+RLAPI void rlResetStateCache(void);                     // Reset GL state cache (required after changing GL state with raw OpenGL calls)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -606,6 +909,8 @@ RLAPI int rlGetFramebufferHeight(void);               // Get default framebuffer
 RLAPI unsigned int rlGetTextureIdDefault(void);       // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);        // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);              // Get default shader locations
+RLAPI bool rlEnableShaderSdf(float smoothing);        // Enable built-in SDF text shader (only replaces default shader), smoothing used if no derivatives support
+RLAPI void rlDisableShaderSdf(void);                  // Disable built-in SDF text shader, default shader restored
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -614,9 +919,48 @@ RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // L
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
+RLAPI void rlSetDefaultBatchSize(int numBuffers, int bufferElements);       // Set default internal render batch size, before rlglInit() (0: compile-time default)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
 RLAPI void rlSetTexture(unsigned int id);           // Set current texture for render batch and check buffers limits
+RLAPI void rlSetDrawLayer(int layer);               // Set current draw layer for render batch (draws sorted by layer on batch drawing)
+RLAPI void rlSetDrawOpaque(bool opaque);            // Set following draws as opaque for render batch (drawn front-to-back with 2d depth ordering)
+RLAPI void rlEnableDepthOrdering2D(void);           // Enable 2d depth ordering: opaque draws reject hidden fragments by depth test
+RLAPI void rlDisableDepthOrdering2D(void);          // Disable 2d depth ordering
+RLAPI void rlResetDepthOrdering2D(void);            // Reset 2d depth ordering: clear depth buffer and restart batch depth (i.e. after 3d drawing)
+
+// Command lists (RLGL_ENABLE_COMMAND_LISTS)
+// NOTE: While the calling thread records a list, immediate-mode calls are recorded instead of executed:
+// rlBegin()/rlEnd(), rlVertex*(), rlTexCoord2f(), rlNormal3f(), rlColor*(), rlSetTexture(), rlSetDrawLayer(), rlSetDrawOpaque()
+// and matrix stack operations (except rlFrustum()/rlOrtho()), any other rlgl call must be recorded as a callback
+// Lists can be recorded while recording another list (previous one is restored on end), submitted or drawn lists are recorded
+RLAPI rlCommandList *rlLoadCommandList(int vertexCapacity);   // Load command list, vertex storage grows if required
+RLAPI void rlUnloadCommandList(rlCommandList *list);          // Unload command list
+RLAPI void rlBeginCommandList(rlCommandList *list);           // Begin recording command list on calling thread (previous commands are discarded)
+RLAPI void rlEndCommandList(void);                            // End recording command list on calling thread
+RLAPI bool rlIsCommandListRecording(void);                    // Check if calling thread is recording a command list
+RLAPI void rlRecordCommandCallback(void (*callback)(void *data), const void *data, int size);   // Record callback executed on submit with a copy of data
+RLAPI void rlSubmitCommandList(rlCommandList *list);          // Submit command list to active render batch (GL thread only, list can be submitted again)
+RLAPI void rlDrawCommandList(rlCommandList *list, Matrix transform, const float *tint);   // Draw command list from GPU vertex buffer (uploaded once per recording) with transform and tint
+RLAPI void rlGetCommandListTileHashes(rlCommandList *list, Matrix transform, int width, int height, int tileSize, unsigned int *hashes);   // Get command list draws hashes per screen tile (damage tracking)
+
+// Frame stats
+// NOTE: rlgl has no timer, CPU times are provided by the platform layer (usually rcore)
+RLAPI void rlBeginFrameStats(double time);          // Begin frame stats recording (resets counters, starts GPU timer query)
+RLAPI void rlEndFrameStats(double time);            // End frame stats recording (stops GPU timer query)
+RLAPI void rlSetFrameStatsSwapTime(double time);    // Set buffers swap CPU time for last recorded frame
+RLAPI rlFrameStats rlGetFrameStats(void);           // Get last recorded frame stats
+RLAPI rlMemoryStats rlGetVideoMemoryStats(int type);    // Get video memory stats (rlMemoryType), frame counters updated on rlEndFrameStats()
+
+// Occlusion queries
+// NOTE: Results are read without stalling, they are usually available one frame later
+RLAPI unsigned int rlLoadOcclusionQuery(void);          // Load occlusion query, returns 0 if not supported
+RLAPI void rlUnloadOcclusionQuery(unsigned int id);     // Unload occlusion query
+RLAPI void rlBeginOcclusionQuery(unsigned int id);      // Begin occlusion query, samples passing depth test are counted until rlEndOcclusionQuery()
+RLAPI void rlEndOcclusionQuery(void);                   // End occlusion query
+RLAPI int rlGetOcclusionQueryResult(unsigned int id);   // Get occlusion query result: -1 not available yet, 0 occluded, 1 visible
+RLAPI bool rlBeginConditionalRender(unsigned int id);   // Begin conditional render, draws are skipped by GPU if query was occluded (returns false if not supported)
+RLAPI void rlEndConditionalRender(void);                // End conditional render
 
 //------------------------------------------------------------------------------------------------------------------------
 
@@ -626,6 +970,10 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset);     // Update GPU buffer with new data
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset);   // Update vertex buffer elements with new data
+RLAPI void rlResizeVertexBuffer(unsigned int id, const void *data, int size, bool dynamic);      // Reallocate vertex buffer data store with new size (previous data is orphaned)
+RLAPI void *rlMapVertexBuffer(unsigned int id, int size);                                       // Map vertex buffer for writing, previous data is orphaned (returns NULL if not supported)
+RLAPI void rlUnmapVertexBuffer(unsigned int id);                                                // Unmap vertex buffer
+RLAPI unsigned int rlUpdateInstanceStream(const void *data, int dataSize, int *offset);         // Upload per-draw instance data to internal ring buffer, returns buffer id and data offset (bytes)
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer);
@@ -635,34 +983,74 @@ RLAPI void rlDrawVertexArray(int offset, int count);
 RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer);
 RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances);
 RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances);
+RLAPI void rlDrawVertexArrayLines(int offset, int count);             // Draw vertex array as lines (two vertices per line)
+RLAPI void rlDrawVertexArrayLinesInstanced(int offset, int count, int instances);   // Draw vertex array as lines instanced
+RLAPI bool rlIsInstancingSupported(void);                              // Check if instanced drawing is supported (always on OpenGL 3.3, extensions required on OpenGL ES 2.0)
+RLAPI void rlDrawVertexArrayIndirect(unsigned int commandId, int offset, int drawCount);          // Draw vertex array with commands from buffer (4 uint each: count, instances, first, base instance)
+RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int commandId, int offset, int drawCount);  // Draw vertex array elements with commands from buffer (5 uint each: count, instances, first index, base vertex, base instance)
 
 // Textures management
 RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture in GPU
 RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer);               // Load depth texture/renderbuffer (to be attached to fbo)
 RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format);                        // Load texture cubemap
+RLAPI unsigned int rlLoadTextureCubemapMipmaps(const void *data, int size, int format, int mipmapCount); // Load texture cubemap with mipmaps (6 faces per level, data can be NULL)
+RLAPI unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, int mipmapCount); // Load texture array (all layers per level, data can be NULL)
+RLAPI unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format);     // Load 3D texture (slices one after the other, data can be NULL)
 RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data);  // Update GPU texture with new data
+RLAPI void rlUpdateTextureStride(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data, int stride); // Update GPU texture with new data rows separated by stride (bytes)
+RLAPI void rlUpdateTextureLayer(unsigned int id, int layer, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture array layer (or 3D texture slice) with new data
+RLAPI void rlUpdateTextureMipmap(unsigned int id, int level, int width, int height, int format, const void *data); // Update GPU texture mipmap level storage (size 0 releases it)
 RLAPI void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType);  // Get OpenGL internal formats
+RLAPI bool rlIsPixelFormatSupported(int format);                       // Check if pixel format is supported by GPU (compressed formats extensions)
 RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
+RLAPI void rlGenTextureCubemapMipmaps(unsigned int id);                   // Generate mipmap data for cubemap texture (levels storage must be allocated)
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format);              // Read texture pixel data
+RLAPI void *rlReadTextureCubemapPixels(unsigned int id, int size, int format, int mipmapCount);   // Read texture cubemap pixel data (6 faces per level)
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel buffer for async screen readback (PBO), returns 0 if not supported
+RLAPI void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height); // Read screen pixel data into pixel buffer (async, not flipped)
+RLAPI void *rlMapPixelBuffer(unsigned int id, int size);                  // Map pixel buffer data for reading (waits for readback to finish)
+RLAPI void rlUnmapPixelBuffer(unsigned int id);                           // Unmap pixel buffer data
+RLAPI void rlUnloadPixelBuffer(unsigned int id);                          // Unload pixel buffer
+RLAPI unsigned int rlLoadTextureIds(int width, int height);               // Load ids texture (32 bit unsigned integer, R32UI) to be attached to fbo, returns 0 if not supported
+RLAPI void rlClearFramebufferIds(void);                                   // Clear active framebuffer ids color attachment (to 0) and depth
+RLAPI void rlReadFramebufferIdsToBuffer(unsigned int id, int x, int y, int width, int height); // Read active framebuffer ids into pixel buffer (async)
+RLAPI void *rlLoadUploadBuffer(unsigned int *id, int size);               // Load texture upload buffer (PBO) persistently mapped for writing, returns NULL if not supported
+RLAPI void rlUnloadUploadBuffer(unsigned int id);                         // Unload texture upload buffer
+RLAPI void rlBindUploadBuffer(unsigned int id);                           // Bind texture upload buffer, texture load/update data pointers are buffer offsets (0 to unbind)
+RLAPI void *rlInsertFence(void);                                          // Insert GPU fence after queued commands, returns NULL if not supported
+RLAPI bool rlIsFenceSignaled(void *fence);                                // Check if GPU fence is signaled (does not wait)
+RLAPI void rlUnloadFence(void *fence);                                    // Unload GPU fence
+RLAPI void rlProcessDeferredUnloads(void);                                // Delete unloaded GPU objects the GPU is done with (RLGL_ENABLE_DEFERRED_UNLOAD), call once per frame
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
 RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel);  // Attach texture/renderbuffer to a framebuffer
 RLAPI bool rlFramebufferComplete(unsigned int id);                        // Verify framebuffer is complete
 RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Delete framebuffer from GPU
+RLAPI void rlInvalidateFramebuffer(unsigned int id, bool color, bool depth); // Invalidate framebuffer attachments contents (not stored back to memory)
 
 // Shaders management
 RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
+RLAPI unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode);   // Load shader from code strings without waiting for compilation (finish with rlFinishShaderProgram())
+RLAPI bool rlIsShaderProgramReady(unsigned int id);                      // Check shader program loaded asynchronously is compiled and linked (finishing it does not wait)
+RLAPI unsigned int rlFinishShaderProgram(unsigned int id);               // Finish shader program loaded asynchronously (waits if not ready), returns default shader id if failed
+RLAPI bool rlReloadShaderCode(unsigned int id, const char *vsCode, const char *fsCode);  // Reload shader program code in place (same id), program is kept if code fails
+RLAPI void rlSetShaderCachePath(const char *path);                        // Set shader program binaries cache path prefix, NULL disables cache (RLGL_ENABLE_SHADER_CACHE)
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
+RLAPI int rlGetActiveUniformCount(unsigned int shaderId);                       // Get shader active uniforms count (reflection)
+RLAPI int rlGetActiveUniform(unsigned int shaderId, int index, char *name, int nameSize, int *size);   // Get shader active uniform name and array size, returns location
+RLAPI int rlGetActiveAttribCount(unsigned int shaderId);                        // Get shader active attributes count (reflection)
+RLAPI int rlGetActiveAttrib(unsigned int shaderId, int index, char *name, int nameSize, int *size);    // Get shader active attribute name and array size, returns location
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count);    // Set shader value matrices array
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
@@ -677,6 +1065,15 @@ RLAPI void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsig
 RLAPI unsigned long long rlGetShaderBufferSize(unsigned int id);                // Get SSBO buffer size
 RLAPI void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset);    // Bind SSBO buffer
 RLAPI void rlBindShaderBuffer(unsigned int id, unsigned int index);             // Copy SSBO buffer data
+RLAPI void rlShaderBufferBarrier(void);                                         // Make compute shader SSBO writes visible to following SSBO, vertex attributes and indirect commands reads
+
+// Uniform buffer object management (ubo)
+RLAPI unsigned int rlLoadUniformBuffer(int size, const void *data, bool dynamic);  // Load uniform buffer object (UBO)
+RLAPI void rlUnloadUniformBuffer(unsigned int uboId);                           // Unload uniform buffer object (UBO)
+RLAPI void rlUpdateUniformBuffer(unsigned int id, const void *data, int dataSize, int offset);  // Update UBO buffer data
+RLAPI void rlBindUniformBuffer(unsigned int id, unsigned int index);            // Bind UBO buffer to uniform block binding point
+RLAPI int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName); // Get shader uniform block index
+RLAPI void rlSetUniformBlockBinding(unsigned int shaderId, int blockIndex, unsigned int bindingIndex); // Set shader uniform block binding point
 
 // Buffer management
 RLAPI void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count); // Copy SSBO buffer data
@@ -746,7 +1143,10 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #endif
 #endif
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_CITRO3D)
+    #define RLGL_C3D_IMPLEMENTATION
+    #include "rlgl_c3d.h"               // OpenGL ES 2.0 subset over citro3d (Nintendo 3DS)
+#elif defined(GRAPHICS_API_OPENGL_ES2)
     #define GL_GLEXT_PROTOTYPES
     //#include <EGL/egl.h>              // EGL library -> not required, platform layer
     #include <GLES2/gl2.h>              // OpenGL ES 2.0 library
@@ -764,6 +1164,22 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    #include <stdio.h>                  // Required for: fopen(), fread(), fwrite(), snprintf() [Used in shader program binaries cache]
+#endif
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD) && defined(_MSC_VER)
+    #include <intrin.h>                 // Required for: _InterlockedCompareExchangePointer(), _InterlockedExchangePointer() [Used in deferred unloads queue]
+#endif
+
+#if !defined(RLGL_DISABLE_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RLGL_SIMD_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in rlVertexSpan()]
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define RLGL_SIMD_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in rlVertexSpan()]
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -822,6 +1238,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef GL_TEXTURE_MAX_ANISOTROPY_EXT
     #define GL_TEXTURE_MAX_ANISOTROPY_EXT       0x84FE
 #endif
+#ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR            0x91B1
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_UNSIGNED_SHORT_5_6_5             0x8363
@@ -838,6 +1257,13 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define glClearDepth                 glClearDepthf
     #define GL_READ_FRAMEBUFFER         GL_FRAMEBUFFER
     #define GL_DRAW_FRAMEBUFFER         GL_FRAMEBUFFER
+    #define GL_TIME_ELAPSED             0x88BF      // GL_TIME_ELAPSED_EXT
+    #define GL_QUERY_RESULT             0x8866      // GL_QUERY_RESULT_EXT
+    #define GL_QUERY_RESULT_AVAILABLE   0x8867      // GL_QUERY_RESULT_AVAILABLE_EXT
+    #define GL_ANY_SAMPLES_PASSED       0x8C2F      // GL_ANY_SAMPLES_PASSED_EXT
+    #ifndef GL_GPU_DISJOINT_EXT
+        #define GL_GPU_DISJOINT_EXT     0x8FBB
+    #endif
 #endif
 
 // Default shader vertex attribute names to set location points
@@ -859,6 +1285,27 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Binded by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX     "vertexTexIndex"    // Binded by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE        "vertexShape"       // Binded by default to shader location: 7
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Binded by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Binded by default to shader location: 7
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TRANSFORM "instanceTransform" // Instance transform (used if model matrix uniform not found)
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_COLOR     "instanceColor"     // Instance color
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_CUSTOM    "instanceCustom"    // Instance custom data
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -878,6 +1325,21 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (GPU skinning)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_TARGET_COUNT
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_TARGET_COUNT "morphTargetCount"  // morph targets count (GPU morphing)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_INDICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_INDICES "morphIndices"    // blended morph targets indices array (GPU morphing)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_MORPH_WEIGHTS "morphWeights"    // blended morph targets weights array (GPU morphing)
+#endif
+#ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS
+    #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_MORPH_TARGETS "morphTargets"  // morph targets deltas texture (GPU morphing)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -887,20 +1349,176 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
+#ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_LIGHTMAP
+    #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_LIGHTMAP  "lightmap"          // lightmap (baked lighting, sampled with texcoords2)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_FRAME     "FrameData"     // per-frame uniform block (camera matrices), binded to RL_UNIFORM_BLOCK_BINDING_FRAME
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_MATERIAL
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_MATERIAL  "MaterialData"  // per-material uniform block (material colors and params), binded to RL_UNIFORM_BLOCK_BINDING_MATERIAL
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+// Command list recorded commands types
+typedef enum {
+    RL_COMMAND_DRAW = 0,        // rlBegin()/rlEnd() block, vertex range on list storage
+    RL_COMMAND_SET_TEXTURE,     // rlSetTexture()
+    RL_COMMAND_SET_DRAW_LAYER,  // rlSetDrawLayer()
+    RL_COMMAND_SET_DRAW_OPAQUE, // rlSetDrawOpaque()
+    RL_COMMAND_MATRIX_MODE,     // rlMatrixMode()
+    RL_COMMAND_PUSH_MATRIX,     // rlPushMatrix()
+    RL_COMMAND_POP_MATRIX,      // rlPopMatrix()
+    RL_COMMAND_LOAD_IDENTITY,   // rlLoadIdentity()
+    RL_COMMAND_TRANSLATE,       // rlTranslatef()
+    RL_COMMAND_ROTATE,          // rlRotatef()
+    RL_COMMAND_SCALE,           // rlScalef()
+    RL_COMMAND_MULT_MATRIX,     // rlMultMatrixf(), matrix stored on list data storage
+    RL_COMMAND_CALLBACK         // rlRecordCommandCallback(), data copy stored on list data storage
+} rlCommandType;
+
+// Command list recorded command
+typedef struct rlCommand {
+    int type;                   // Command type (rlCommandType)
+    unsigned int value;         // Command value: draw mode, texture id, draw layer or matrix mode
+    int offset;                 // Vertex or data offset on list storage
+    int count;                  // Vertex count or data size
+    float params[4];            // Command parameters (translation, rotation or scale)
+    void (*callback)(void *data);   // Callback executed on submit
+} rlCommand;
+
+// Command list recorded vertex
+typedef struct rlCommandVertex {
+    float x, y, z;              // Vertex position (untransformed, matrix commands are replayed on submit)
+    float u, v;                 // Vertex texture coordinates
+    float nx, ny, nz;           // Vertex normal
+    unsigned char r, g, b, a;   // Vertex color
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    float shape[4];             // Vertex SDF shape
+#endif
+    bool depth2d;               // Vertex defined with rlVertex2f(), depth provided by render batch on submit
+} rlCommandVertex;
+
+// Command list retained draw range, consecutive vertex drawn with same mode and texture
+typedef struct rlCommandRange {
+    int mode;                   // Draw mode: RL_LINES or RL_TRIANGLES (quads, strips and fans converted on upload)
+    unsigned int textureId;     // Texture id, 0 for default texture
+    int offset;                 // First vertex on retained vertex buffer
+    int count;                  // Vertex count
+} rlCommandRange;
+
+// Command list, only accessed by recording thread until recording ends
+struct rlCommandList {
+    rlCommand *commands;        // Recorded commands
+    int commandCount;           // Recorded commands count
+    int commandCapacity;        // Recorded commands allocated
+    rlCommandVertex *vertices;  // Recorded vertex storage (thread-local arena while recording)
+    int vertexCount;            // Recorded vertex count
+    int vertexCapacity;         // Recorded vertex allocated
+    unsigned char *data;        // Recorded data storage: matrices and callbacks data copies
+    int dataSize;               // Recorded data size
+    int dataCapacity;           // Recorded data allocated
+    int currentDraw;            // Command index of current rlBegin() block, -1 if none
+    rlCommandVertex state;      // Current vertex attributes (texcoord, normal, color)
+
+    // Retained drawing data (rlDrawCommandList()), uploaded on first draw after recording
+    int retained;               // Retained state: 0 - upload required, 1 - uploaded, -1 - not supported by commands
+    rlCommandRange *ranges;     // Retained draw ranges
+    int rangeCount;             // Retained draw ranges count
+    int rangeCapacity;          // Retained draw ranges allocated
+    int depthCount;             // Retained 2d depth increments (rlBegin()/rlEnd() blocks)
+    unsigned int vaoId;         // Retained vertex array object id
+    unsigned int vboId;         // Retained vertex buffer id
+    int vboCapacity;            // Retained vertex buffer capacity (vertex)
+
+    rlCommandList *parent;      // Command list recording when this one began, restored on recording end
+    unsigned int version;       // Recording version, increased on every recording begin
+};
+
+// Command list submitted or drawn while recording, recorded as callback data
+typedef struct rlCommandListCall {
+    rlCommandList *list;        // Command list submitted or drawn
+    unsigned int version;       // Command list recording version (list content changes are hashed)
+    int draw;                   // Drawn with rlDrawCommandList() instead of submitted
+    Matrix transform;           // Draw transform
+    float tint[4];              // Draw tint (normalized RGBA)
+} rlCommandListCall;
+#endif
+
+// Layered texture target, texture arrays and 3D textures are bound to their own target
+typedef struct rlLayeredTexture {
+    unsigned int target;                // GL_TEXTURE_2D_ARRAY or GL_TEXTURE_3D, 0 for GL_TEXTURE_2D textures
+    int depth;                          // Layers (texture array) or slices (3D texture) count
+} rlLayeredTexture;
+
+// Batch default uniforms values sent to a shader program
+typedef struct rlProgramUniforms {
+    unsigned int program;               // Shader program id, 0 if entry not used
+    int locs[3];                        // Uniform locations values were sent to: mvp, colDiffuse, texture0
+    float mvp[16];                      // Last modelview-projection matrix sent
+    bool mvpSent;                       // Modelview-projection matrix sent
+    bool defaults;                      // Default colDiffuse and texture0 values sent
+} rlProgramUniforms;
+
+// Shader program loaded asynchronously, compilation and linking results not checked yet
+typedef struct rlPendingProgram {
+    unsigned int id;                    // Shader program id, 0 if entry not used
+    unsigned int vShaderId;             // Vertex shader id (default shader stage not deleted)
+    unsigned int fShaderId;             // Fragment shader id (default shader stage not deleted)
+    unsigned long long cacheKey;        // Shader program binaries cache key (RLGL_ENABLE_SHADER_CACHE)
+} rlPendingProgram;
+
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+// GPU object types deleted deferred
+typedef enum {
+    RL_DEFERRED_TEXTURE = 0,            // Texture (rlUnloadTexture())
+    RL_DEFERRED_FRAMEBUFFER,            // Framebuffer and its depth attachment (rlUnloadFramebuffer())
+    RL_DEFERRED_VERTEX_ARRAY,           // Vertex array (rlUnloadVertexArray())
+    RL_DEFERRED_VERTEX_BUFFER,          // Vertex buffer (rlUnloadVertexBuffer())
+    RL_DEFERRED_SHADER_PROGRAM          // Shader program (rlUnloadShaderProgram())
+} rlDeferredType;
+
+// GPU object unload requested, deleted once GPU is done with it
+typedef struct rlDeferredUnload {
+    int type;                           // Object type (rlDeferredType)
+    unsigned int id;                    // Object id
+    struct rlDeferredUnload *next;      // Next unload on same queue or generation
+} rlDeferredUnload;
+
+// GPU object unloads requested on the same frame, deleted together once fence is signaled
+typedef struct rlUnloadGeneration {
+    rlDeferredUnload *unloads;          // Unloads list
+    void *fence;                        // Fence inserted at frame end, NULL if not supported
+    unsigned int frame;                 // Frame generation was queued (used if fence not supported)
+} rlUnloadGeneration;
+#endif
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
+    int defaultBatchBuffers;                // Default internal render batch buffers count (0: RL_DEFAULT_BATCH_BUFFERS)
+    int defaultBatchElements;               // Default internal render batch elements per buffer (0: RL_DEFAULT_BATCH_BUFFER_ELEMENTS)
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        unsigned char texindex;             // Current active texture index on draw call textures (added on glVertex*())
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+        float shape[4];                     // Current active SDF shape (added on glVertex*())
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        int indexCounter;                   // Current active render batch triangle list index counter
+        int primitiveMode;                  // Current rlBegin() mode, indices are added on rlEnd() (RL_LINES if no primitive open)
+        int primitiveStart;                 // Current rlBegin() first vertex on render batch
+#endif
 
         int currentMatrixMode;              // Current matrix mode
         Matrix *currentMatrix;              // Current matrix pointer
@@ -912,27 +1530,80 @@ typedef struct rlglData {
         int stackCounter;                   // Matrix stack counter
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
+        int currentDrawLayer;               // Current draw layer for render batch draws (0 by default)
+        bool currentDrawOpaque;             // Current draw opaque flag for render batch draws (false by default)
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+        int currentDrawBlendMode;           // Current blend mode for render batch draws (applied blend mode: currentBlendMode)
+        int currentDrawScissor[4];          // Current scissor rect for render batch draws, width -1: scissor test disabled
+        int scissor[4];                     // Scissor rect set on GL
+        bool scissorTest;                   // Scissor test enabled on GL
+        bool drawStateDirty;                // Current draw state changed since applied, applied before direct draws
+#endif
+        bool depthOrdering2D;               // 2d depth ordering enabled: batch depth kept between batch draws, reset per frame
+        void *drawSortBuffer;               // Scratch draws and vertex data buffer used for render batch draws sorting
+        int drawSortBufferSize;             // Scratch draws and vertex data buffer size (in bytes)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        const char *defaultVShaderCode;     // Default vertex shader code (default shader ids compiled on demand if program was cached)
+        const char *defaultFShaderCode;     // Default fragment shader code
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        unsigned int sdfShaderId;           // SDF text shader program id (lazily loaded on first use)
+        int *sdfShaderLocs;                 // SDF text shader locations pointer
+        int sdfSmoothingLoc;                // SDF text shader smoothing uniform location (only without derivatives support)
+        float sdfSmoothing;                 // SDF text shader current smoothing value
+        bool sdfShaderFailed;               // SDF text shader loading failed, not tried again
+        unsigned int instanceStreamId;      // Instance stream buffer id (lazily loaded on first use)
+        int instanceStreamSize;             // Instance stream buffer size (in bytes)
+        int instanceStreamOffset;           // Instance stream buffer next upload offset (in bytes)
+#if defined(GRAPHICS_API_OPENGL_33)
+        rlLayeredTexture *layeredTextures;  // Layered textures target by texture id, looked up on texture binds
+        unsigned int layeredTexturesCapacity;   // Texture ids tracked by layered textures array
+#endif
 
         bool stereoRender;                  // Stereo rendering flag
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
         Matrix viewOffsetStereo[2];         // VR stereo rendering eyes view offset matrices
+#if defined(GRAPHICS_API_CITRO3D)
+        float stereoSeparation;             // Stereoscopic screen eyes separation (view space units), 0: mono
+        float stereoConvergence;            // Stereoscopic screen zero parallax distance (view space units)
+#endif
 
         int currentBlendMode;               // Blending mode active
         int glBlendSrcFactor;               // Blending source factor
         int glBlendDstFactor;               // Blending destination factor
         int glBlendEquation;                // Blending equation
+        int glBlendSrcFactorAlpha;          // Blending source alpha factor (RL_BLEND_CUSTOM_SEPARATE)
+        int glBlendDstFactorAlpha;          // Blending destination alpha factor (RL_BLEND_CUSTOM_SEPARATE)
+        int glBlendEquationAlpha;           // Blending alpha equation (RL_BLEND_CUSTOM_SEPARATE)
 
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
     } State;            // Renderer state
+    struct {
+        unsigned int program;               // Shader program in use (glUseProgram())
+        unsigned int activeUnit;            // Active texture unit (glActiveTexture())
+        unsigned int textures[RL_MAX_STATE_CACHE_TEXTURE_UNITS];   // Texture bound per texture unit (GL_TEXTURE_2D or its layered target)
+        unsigned int vao;                   // Vertex array bound (glBindVertexArray())
+        unsigned int arrayBuffer;           // GL_ARRAY_BUFFER buffer bound
+        unsigned int elementBuffer;         // GL_ELEMENT_ARRAY_BUFFER buffer bound (vertex array state)
+        unsigned int blend;                 // GL_BLEND capability enabled
+        unsigned int depthTest;             // GL_DEPTH_TEST capability enabled
+        unsigned int cullFace;              // GL_CULL_FACE capability enabled
+        unsigned int blendSrcFactor;        // Blending source factor (glBlendFunc())
+        unsigned int blendDstFactor;        // Blending destination factor (glBlendFunc())
+        unsigned int blendEquation;         // Blending equation (glBlendEquation())
+        unsigned int blendSrcFactorAlpha;   // Blending source alpha factor (glBlendFuncSeparate())
+        unsigned int blendDstFactorAlpha;   // Blending destination alpha factor (glBlendFuncSeparate())
+        unsigned int blendEquationAlpha;    // Blending alpha equation (glBlendEquationSeparate())
+        unsigned int uniformBuffers[RL_MAX_STATE_CACHE_UNIFORM_BUFFERS];   // GL_UNIFORM_BUFFER buffer bound per binding point (glBindBufferBase())
+        rlProgramUniforms programUniforms[RL_MAX_STATE_CACHE_PROGRAMS];    // Batch uniforms values sent per shader program
+        int programUniformsNext;            // Next program uniforms entry to claim
+    } Cache;            // GL state cache, RL_STATE_UNKNOWN values are always sent to GL
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -948,15 +1619,63 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable, persistently mappable buffers support (GL_ARB_buffer_storage)
+        bool timerQuery;                    // GPU timer queries support (GL_ARB_timer_query, GL_EXT_disjoint_timer_query)
+        bool occlusionQuery;                // Occlusion queries support (GL 1.5, GL_EXT_occlusion_query_boolean)
+        bool conditionalRender;             // Conditional rendering on occlusion queries support (GL 3.0)
+        bool programBinary;                 // Shader program binaries support (GL_ARB_get_program_binary, GL_OES_get_program_binary)
+        bool invalidateFramebuffer;         // Framebuffer invalidation support (GL 4.3, GL_EXT_discard_framebuffer)
+        bool parallelShaderCompile;         // Shader programs compiled by driver threads, completion can be polled (GL_KHR_parallel_shader_compile, GL_ARB_parallel_shader_compile)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        rlFrameStats current;               // Current frame stats (being recorded)
+        rlFrameStats last;                  // Last recorded frame stats
+        bool recording;                     // Frame stats recording in progress
+        unsigned int queries[3];            // GPU timer queries (results read with some frames latency to avoid stalls)
+        bool queryIssued[3];                // GPU timer query has been issued and result is pending
+        int queryIndex;                     // GPU timer query used by current frame
+        double gpuTime;                     // Latest available GPU time result (seconds)
+    } Stats;            // Frame stats
+    struct {
+        unsigned int *sizes[3];             // Data store size by object id: textures, renderbuffers and buffers
+        unsigned int capacity[3];           // Object ids tracked by sizes arrays
+        rlMemoryStats stats[2];             // Video memory stats by type (rlMemoryType)
+        int loads[2];                       // Objects loaded on current frame by type
+        int unloads[2];                     // Objects unloaded on current frame by type
+    } Memory;           // Video memory tracking (estimate)
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    struct {
+        char path[512];                     // Cache files path prefix (i.e. "sdmc:/config/game/")
+        bool disabled;                      // Cache disabled by user (rlSetShaderCachePath(NULL))
+        unsigned long long driverHash;      // Driver vendor, renderer and version strings hash (computed on first use)
+    } ShaderCache;      // Shader program binaries cache
+#endif
+    struct {
+        rlPendingProgram programs[RL_MAX_PENDING_SHADER_PROGRAMS];  // Shader programs loaded asynchronously not finished yet
+    } ShaderAsync;      // Shader programs async loading
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    struct {
+        rlDeferredUnload *volatile queue;   // Unloads requested since last processing (lock-free stack, pushed from any thread)
+        rlUnloadGeneration *generations;    // Unloads queued waiting for GPU, oldest first
+        int count;                          // Generations waiting
+        int capacity;                       // Generations array capacity
+        unsigned int frame;                 // Processed frames counter
+    } Unload;           // Deferred GPU objects deletion
+#endif
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+#define RL_STATE_UNKNOWN    0xFFFFFFFF      // GL state cache value not known (GL state set outside rlgl or object deleted)
+
+#define RL_MEMORY_OBJECT_TEXTURE        0   // Video memory tracked object: texture (ids namespace)
+#define RL_MEMORY_OBJECT_RENDERBUFFER   1   // Video memory tracked object: renderbuffer (ids namespace)
+#define RL_MEMORY_OBJECT_BUFFER         2   // Video memory tracked object: buffer (ids namespace)
+
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 //----------------------------------------------------------------------------------
@@ -964,6 +1683,21 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
+
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+#ifndef RL_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #else
+        #define RL_THREAD_LOCAL _Thread_local
+    #endif
+#endif
+static RL_THREAD_LOCAL rlCommandList *rlRecordingList = NULL;   // Command list recorded by current thread
+#endif
+
+// NOTE: Parallel shader compile threads count is set through extension (KHR or ARB)
+typedef void (*rlglMaxShaderCompilerThreadsProc)(unsigned int count);
+static rlglMaxShaderCompilerThreadsProc glMaxShaderCompilerThreads = NULL;
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -976,6 +1710,21 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: GPU timer and occlusion queries are exposed through extensions (EXT)
+static PFNGLGENQUERIESEXTPROC glGenQueries = NULL;
+static PFNGLDELETEQUERIESEXTPROC glDeleteQueries = NULL;
+static PFNGLBEGINQUERYEXTPROC glBeginQuery = NULL;
+static PFNGLENDQUERYEXTPROC glEndQuery = NULL;
+static PFNGLGETQUERYOBJECTUIVEXTPROC glGetQueryObjectuiv = NULL;
+static PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64v = NULL;
+
+// NOTE: Program binaries are exposed through extension (OES)
+static PFNGLGETPROGRAMBINARYOESPROC glGetProgramBinary = NULL;
+static PFNGLPROGRAMBINARYOESPROC glProgramBinary = NULL;
+
+// NOTE: Framebuffer invalidation is exposed through extension (EXT)
+static PFNGLDISCARDFRAMEBUFFEREXTPROC glDiscardFramebuffer = NULL;
 #endif
 
 //----------------------------------------------------------------------------------
@@ -983,15 +1732,93 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
+static void rlLoadShaderSdf(void);          // Load SDF text shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static unsigned int rlGetDefaultShaderStage(int type);     // Get default vertex/fragment shader id (compiled on demand)
+static unsigned int rlCompileShaderAsync(const char *shaderCode, int type);    // Compile shader without waiting for compilation (compile status not queried)
+static bool rlCheckShaderCompile(unsigned int shader, int type);               // Check shader compile status, errors are logged
+static unsigned int rlCreateShaderProgram(unsigned int vShaderId, unsigned int fShaderId);  // Create shader program and link it without waiting (link status not queried)
+static bool rlCheckShaderProgramLink(unsigned int program);    // Check shader program link status, errors are logged and program deleted if failed
+static void rlReleaseShaderStages(unsigned int program, unsigned int vShaderId, unsigned int fShaderId);    // Detach and delete program shaders (default shader stages are kept)
+static rlPendingProgram *rlGetPendingProgram(unsigned int id); // Get shader program loaded asynchronously not finished yet, NULL if not pending
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+static bool rlDeferUnload(int type, unsigned int id);       // Queue GPU object deletion (any thread), false if it can not be queued
+static rlDeferredUnload *rlTakeDeferredUnloads(void);       // Take all queued unloads (queue emptied)
+static void rlDestroyDeferredUnloads(rlDeferredUnload *unloads);    // Delete unloads list objects and free list
+#endif
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+static unsigned long long rlHashShaderCode(unsigned long long hash, const char *text);   // Hash shader code string (FNV-1a, NULL hashed as empty)
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode);   // Get shader program cache key (code and driver)
+static unsigned int rlLoadShaderProgramCache(unsigned long long key);    // Load shader program from cached binary, 0 on miss
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long key);  // Save linked shader program binary to cache
+#endif
+static void rlSetBatchVertexAttributes(const rlVertexBuffer *buffer);   // Set render batch vertex attributes for current shader
+static void rlSortRenderBatchDraws(rlRenderBatch *batch);   // Sort render batch draws by layer and merge compatible draws
+static void rlCheckRenderBatchDrawLimit(rlRenderBatch *batch);  // Check draw calls limit for a new draw, grow draws array or draw batch
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+static bool rlGrowRenderBatch(rlRenderBatch *batch, int vCount);    // Grow current batch vertex buffer to fit vertex (doubling capacity)
+#endif
+static void rlDrawRenderBatchDraw(const rlDrawCall *draw, int vertexOffset, int indexOffset);  // Draw render batch draw call
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlApplyBlendMode(int mode);                     // Set GL blend function for blend mode
+#endif
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+static rlDrawCall *rlNextDrawCall(void);                    // Start a new draw (if current one has vertex), keeping current draw mode and textures
+static void rlApplyDrawState(int blendMode, const int *scissor);    // Set GL blend mode and scissor for a draw, skipped if already set
+static void rlSyncDrawState(void);                          // Apply current draw state before direct draws, if changed
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+static void rlAddBatchIndices(void);                        // Add triangle list indices for current primitive vertex
+#endif
+static void rlStateUseProgram(unsigned int id);             // Use shader program, skipped if already in use
+static void rlStateActiveTexture(unsigned int slot);        // Set active texture unit, skipped if already active
+static void rlStateBindVertexArray(unsigned int id);        // Bind vertex array, skipped if already bound
+static void rlStateBindBuffer(int target, unsigned int id); // Bind array/element buffer, skipped if already bound
+static void rlStateSetBlendFunction(int srcFactor, int dstFactor, int equation);   // Set blending factors and equation, skipped if already set
+static void rlStateSetBlendFunctionSeparate(int srcRGB, int dstRGB, int srcAlpha, int dstAlpha, int eqRGB, int eqAlpha);  // Set rgb and alpha blending factors and equations, skipped if already set
+static void rlStateReleaseTexture(unsigned int id);         // Forget texture in state cache (texture deleted)
+static void rlStateReleaseBuffer(unsigned int id);          // Forget buffer in state cache (buffer deleted)
+static void rlStateReleaseVertexArray(unsigned int id);     // Forget vertex array in state cache (vertex array deleted)
+static void rlStateReleaseProgram(unsigned int id);         // Forget shader program in state cache (program deleted)
+static rlProgramUniforms *rlStateGetProgramUniforms(unsigned int id);   // Get batch uniforms sent to shader program (claims an entry if not tracked)
+static void rlVertexSpan(const float *vertices, int components, const float *texcoords, int count);   // Add multiple vertex to render batch, transformed in a single pass
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+static rlCommand *rlRecordCommand(int type, unsigned int value);        // Record a command on current thread command list
+static void rlRecordVertex(float x, float y, float z, bool depth2d);    // Record a vertex on current thread command list draw
+static void *rlReserveCommandListData(int size);                        // Reserve data on current thread command list storage (16 bytes aligned)
+static bool rlUploadCommandList(rlCommandList *list);                   // Upload command list draws to retained vertex buffer
+static void rlSetCommandListVertexAttributes(const rlCommandList *list);    // Set retained vertex buffer attributes for current shader
+static void rlRecordCommandListCall(rlCommandList *list, int draw, Matrix transform, const float *tint);  // Record command list submit or draw on current thread command list
+static void rlReplayCommandListCall(void *data);                        // Submit or draw command list recorded by rlRecordCommandListCall()
+static unsigned int rlHashCommandData(unsigned int hash, const void *data, int size);  // Hash data bytes (FNV-1a)
+static void rlMixTileHashes(unsigned int *hashes, int tilesX, int x0, int y0, int x1, int y1, unsigned int hash);  // Mix hash into tiles range hashes
+#endif
+static void rlStateReleaseProgramUniforms(unsigned int id);             // Forget batch uniforms sent to shader program (uniforms changed or program deleted)
+static void rlTrackVideoMemory(int object, unsigned int id, unsigned int size);  // Track object data store size (video memory estimate), size 0 on unload
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+static void *rlLoadMappedBuffer(unsigned int *id, int size);        // Load vertex buffer with immutable storage and map it persistently
+static void rlWaitBufferFence(rlVertexBuffer *buffer);              // Wait for GPU to release a batch vertex buffer
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 #if defined(GRAPHICS_API_OPENGL_11)
-static int rlGenTextureMipmapsData(unsigned char *data, int baseWidth, int baseHeight);         // Generate mipmaps data on CPU side
-static unsigned char *rlGenNextMipmapData(unsigned char *srcData, int srcWidth, int srcHeight); // Generate next mipmap level on CPU side
+static int rlGenTextureMipmapsData(unsigned char **data, int baseWidth, int baseHeight);        // Generate mipmaps data on CPU side
+static void rlGenNextMipmapData(const unsigned char *srcData, int srcWidth, int srcHeight, unsigned char *mipmap); // Generate next mipmap level on CPU side
+#endif
+static void rlDestroyTexture(unsigned int id);              // Delete texture (immediately)
+static void rlDestroyFramebuffer(unsigned int id);          // Delete framebuffer and its depth attachment (immediately)
+static void rlDestroyVertexArray(unsigned int vaoId);       // Delete vertex array (immediately)
+static void rlDestroyVertexBuffer(unsigned int vboId);      // Delete vertex buffer (immediately)
+static void rlDestroyShaderProgram(unsigned int id);        // Delete shader program (immediately)
+static void rlStateBindTexture(unsigned int id);            // Bind texture to active unit (GL_TEXTURE_2D or layered target), skipped if already bound
+#if defined(GRAPHICS_API_OPENGL_33)
+static void rlSetLayeredTexture(unsigned int id, unsigned int target, int depth);   // Set texture layered target (0 for GL_TEXTURE_2D)
+static rlLayeredTexture rlGetLayeredTexture(unsigned int id);  // Get texture layered target (0 for GL_TEXTURE_2D)
+static unsigned int rlLoadTextureLayered(unsigned int target, const void *data, int width, int height, int depth, int format, int mipmapCount); // Load texture array or 3D texture
 #endif
+static void rlStateSetCapability(int capability, bool enabled);    // Enable/disable GL_BLEND, GL_DEPTH_TEST or GL_CULL_FACE, skipped if already set
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                             // Get identity matrix
@@ -1037,6 +1864,10 @@ void rlMultMatrixf(float *matf) { glMultMatrixf(matf); }
 // Choose the current matrix to be transformed
 void rlMatrixMode(int mode)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_MATRIX_MODE, mode); return; }
+#endif
+
     if (mode == RL_PROJECTION) RLGL.State.currentMatrix = &RLGL.State.projection;
     else if (mode == RL_MODELVIEW) RLGL.State.currentMatrix = &RLGL.State.modelview;
     //else if (mode == RL_TEXTURE) // Not supported
@@ -1047,6 +1878,10 @@ void rlMatrixMode(int mode)
 // Push the current matrix into RLGL.State.stack
 void rlPushMatrix(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_PUSH_MATRIX, 0); return; }
+#endif
+
     if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
 
     if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
@@ -1062,6 +1897,10 @@ void rlPushMatrix(void)
 // Pop lattest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_POP_MATRIX, 0); return; }
+#endif
+
     if (RLGL.State.stackCounter > 0)
     {
         Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
@@ -1079,12 +1918,25 @@ void rlPopMatrix(void)
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_LOAD_IDENTITY, 0); return; }
+#endif
+
     *RLGL.State.currentMatrix = rlMatrixIdentity();
 }
 
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlCommand *command = rlRecordCommand(RL_COMMAND_TRANSLATE, 0);
+        if (command != NULL) { command->params[0] = x; command->params[1] = y; command->params[2] = z; }
+        return;
+    }
+#endif
+
     Matrix matTranslation = {
         1.0f, 0.0f, 0.0f, x,
         0.0f, 1.0f, 0.0f, y,
@@ -1100,6 +1952,15 @@ void rlTranslatef(float x, float y, float z)
 // NOTE: The provided angle must be in degrees
 void rlRotatef(float angle, float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlCommand *command = rlRecordCommand(RL_COMMAND_ROTATE, 0);
+        if (command != NULL) { command->params[0] = angle; command->params[1] = x; command->params[2] = y; command->params[3] = z; }
+        return;
+    }
+#endif
+
     Matrix matRotation = rlMatrixIdentity();
 
     // Axis vector (x, y, z) normalization
@@ -1144,6 +2005,15 @@ void rlRotatef(float angle, float x, float y, float z)
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlCommand *command = rlRecordCommand(RL_COMMAND_SCALE, 0);
+        if (command != NULL) { command->params[0] = x; command->params[1] = y; command->params[2] = z; }
+        return;
+    }
+#endif
+
     Matrix matScale = {
         x, 0.0f, 0.0f, 0.0f,
         0.0f, y, 0.0f, 0.0f,
@@ -1158,6 +2028,22 @@ void rlScalef(float x, float y, float z)
 // Multiply the current matrix by another matrix
 void rlMultMatrixf(float *matf)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        float *data = (float *)rlReserveCommandListData(16*sizeof(float));
+        rlCommand *command = (data != NULL)? rlRecordCommand(RL_COMMAND_MULT_MATRIX, 0) : NULL;
+
+        if (command != NULL)
+        {
+            memcpy(data, matf, 16*sizeof(float));
+            command->offset = (int)((unsigned char *)data - rlRecordingList->data);
+            command->count = 16*sizeof(float);
+        }
+        return;
+    }
+#endif
+
     // Matrix creation from array
     Matrix mat = { matf[0], matf[4], matf[8], matf[12],
                    matf[1], matf[5], matf[9], matf[13],
@@ -1238,6 +2124,18 @@ void rlViewport(int x, int y, int width, int height)
     glViewport(x, y, width, height);
 }
 
+// Get the viewport area
+void rlGetViewport(int *x, int *y, int *width, int *height)
+{
+    int viewport[4] = { 0 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    if (x != NULL) *x = viewport[0];
+    if (y != NULL) *y = viewport[1];
+    if (width != NULL) *width = viewport[2];
+    if (height != NULL) *height = viewport[3];
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Vertex level operations
 //----------------------------------------------------------------------------------
@@ -1250,6 +2148,8 @@ void rlBegin(int mode)
     {
         case RL_LINES: glBegin(GL_LINES); break;
         case RL_TRIANGLES: glBegin(GL_TRIANGLES); break;
+        case RL_TRIANGLE_STRIP: glBegin(GL_TRIANGLE_STRIP); break;
+        case RL_TRIANGLE_FAN: glBegin(GL_TRIANGLE_FAN); break;
         case RL_QUADS: glBegin(GL_QUADS); break;
         default: break;
     }
@@ -1264,11 +2164,36 @@ void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
 void rlColor3f(float x, float y, float z) { glColor3f(x, y, z); }
 void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
+void rlVertex2fv(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex2fv(vertices + 2*i); }
+void rlVertex3fv(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex3fv(vertices + 3*i); }
+void rlTexCoordVertex2fv(const float *texcoords, const float *vertices, int count)
+{
+    for (int i = 0; i < count; i++) { glTexCoord2fv(texcoords + 2*i); glVertex2fv(vertices + 2*i); }
+}
 #endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlCommand *command = rlRecordCommand(RL_COMMAND_DRAW, mode);
+        if (command != NULL)
+        {
+            command->offset = rlRecordingList->vertexCount;
+            rlRecordingList->currentDraw = rlRecordingList->commandCount - 1;
+        }
+        return;
+    }
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Quads, triangles, strips and fans share triangle list draws, primitive indices are added on rlEnd()
+    int primitiveMode = mode;
+    if (mode != RL_LINES) mode = RL_TRIANGLES;
+#endif
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1291,17 +2216,44 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        rlCheckRenderBatchDrawLimit(RLGL.currentBatch);
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentDrawLayer;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].opaque = RLGL.State.currentDrawOpaque;
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].blendMode = RLGL.State.currentDrawBlendMode;
+        memcpy(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].scissor, RLGL.State.currentDrawScissor, 4*sizeof(int));
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+        RLGL.State.texindex = 0;
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].indexCount = 0;
+#endif
     }
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    RLGL.State.primitiveMode = primitiveMode;
+    RLGL.State.primitiveStart = RLGL.State.vertexCounter;
+#endif
 }
 
 // Finish vertex providing
 void rlEnd(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordingList->currentDraw = -1; return; }
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlAddBatchIndices();
+    RLGL.State.primitiveMode = RL_LINES;
+#endif
+
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
@@ -1309,7 +2261,11 @@ void rlEnd(void)
 
     // Verify internal buffers limits
     // NOTE: This check is combined with usage of rlCheckRenderBatchLimit()
-    if (RLGL.State.vertexCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4))
+    if (RLGL.State.vertexCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4 - 4)
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+        && !rlGrowRenderBatch(RLGL.currentBatch, 4)
+#endif
+        )
     {
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a rlDrawRenderBatch(),
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
@@ -1323,6 +2279,10 @@ void rlEnd(void)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordVertex(x, y, z, false); return; }
+#endif
+
     float tx = x;
     float ty = y;
     float tz = z;
@@ -1335,9 +2295,35 @@ void rlVertex3f(float x, float y, float z)
         tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
     }
 
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+    if (RLGL.State.vertexCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)) rlGrowRenderBatch(RLGL.currentBatch, 1);
+#endif
+
     // Verify that current vertex buffer elements limit has not been reached
     if (RLGL.State.vertexCounter < (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
     {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        // Add vertex position, current texcoord and current color, all in a single memory write location
+        rlVertexInterleaved *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[RLGL.State.vertexCounter];
+        vertex->x = tx;
+        vertex->y = ty;
+        vertex->z = tz;
+        vertex->u = RLGL.State.texcoordx;
+        vertex->v = RLGL.State.texcoordy;
+        vertex->r = RLGL.State.colorr;
+        vertex->g = RLGL.State.colorg;
+        vertex->b = RLGL.State.colorb;
+        vertex->a = RLGL.State.colora;
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        vertex->texIndex = RLGL.State.texindex;
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+        vertex->shape[0] = RLGL.State.shape[0];
+        vertex->shape[1] = RLGL.State.shape[1];
+        vertex->shape[2] = RLGL.State.shape[2];
+        vertex->shape[3] = RLGL.State.shape[3];
+#endif
+#else
         // Add vertices
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1355,6 +2341,7 @@ void rlVertex3f(float x, float y, float z)
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
         RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+#endif
 
         RLGL.State.vertexCounter++;
 
@@ -1366,19 +2353,52 @@ void rlVertex3f(float x, float y, float z)
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordVertex(x, y, 0.0f, true); return; }
+#endif
+
     rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordVertex((float)x, (float)y, 0.0f, true); return; }
+#endif
+
     rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
+// Define multiple vertex (position), 2 components each
+// NOTE: Current texcoord and color are used for all vertex, z is current batch depth
+void rlVertex2fv(const float *vertices, int count)
+{
+    rlVertexSpan(vertices, 2, NULL, count);
+}
+
+// Define multiple vertex (position), 3 components each
+// NOTE: Current texcoord and color are used for all vertex
+void rlVertex3fv(const float *vertices, int count)
+{
+    rlVertexSpan(vertices, 3, NULL, count);
+}
+
+// Define multiple vertex (texture coordinate and position), 2 components each
+// NOTE: Current texture coordinate is set to last vertex one, same as rlTexCoord2f() + rlVertex2f() calls
+void rlTexCoordVertex2fv(const float *texcoords, const float *vertices, int count)
+{
+    rlVertexSpan(vertices, 2, texcoords, count);
+}
+
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordingList->state.u = x; rlRecordingList->state.v = y; return; }
+#endif
+
     RLGL.State.texcoordx = x;
     RLGL.State.texcoordy = y;
 }
@@ -1387,6 +2407,10 @@ void rlTexCoord2f(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordingList->state.nx = x; rlRecordingList->state.ny = y; rlRecordingList->state.nz = z; return; }
+#endif
+
     RLGL.State.normalx = x;
     RLGL.State.normaly = y;
     RLGL.State.normalz = z;
@@ -1395,6 +2419,17 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlRecordingList->state.r = x;
+        rlRecordingList->state.g = y;
+        rlRecordingList->state.b = z;
+        rlRecordingList->state.a = w;
+        return;
+    }
+#endif
+
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -1415,6 +2450,44 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Define one vertex (SDF shape)
+// NOTE: Shape is a rounded box centered on shape local origin, provided as texture coordinates,
+// thickness > 0 keeps only an outline band inside the edge, all zero for regular (textured) vertex
+void rlShape4f(float halfWidth, float halfHeight, float radius, float thickness)
+{
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        rlRecordingList->state.shape[0] = halfWidth;
+        rlRecordingList->state.shape[1] = halfHeight;
+        rlRecordingList->state.shape[2] = radius;
+        rlRecordingList->state.shape[3] = thickness;
+        return;
+    }
+#endif
+
+    RLGL.State.shape[0] = halfWidth;
+    RLGL.State.shape[1] = halfHeight;
+    RLGL.State.shape[2] = radius;
+    RLGL.State.shape[3] = thickness;
+#endif
+}
+
+// Check if vertex SDF shapes are evaluated on drawing
+// NOTE: Only default shader evaluates shapes, recorded command lists are expected to be submitted with it
+bool rlIsShapeSdfEnabled(void)
+{
+    bool result = false;
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) return true;
+#endif
+    result = (RLGL.State.defaultShaderId > 0) && (RLGL.State.currentShaderId == RLGL.State.defaultShaderId);
+#endif
+    return result;
+}
+
 //--------------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL style functions (common to 1.1, 3.3+, ES2)
 //--------------------------------------------------------------------------------------
@@ -1422,6 +2495,10 @@ void rlColor3f(float x, float y, float z)
 // Set current texture to use
 void rlSetTexture(unsigned int id)
 {
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_SET_TEXTURE, id); return; }
+#endif
+
     if (id == 0)
     {
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -1440,6 +2517,27 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        // Look for the texture on current draw textures, or add it to a free texture slot,
+        // only default shader selects the texture by vertex texture index
+        rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+        if (draw->textureId == id) { RLGL.State.texindex = 0; return; }
+
+        for (int i = 0; i < draw->textureCount; i++)
+        {
+            if (draw->textureIds[i] == id) { RLGL.State.texindex = i + 1; return; }
+        }
+
+        if ((draw->vertexCount > 0) && (draw->textureCount < (RL_BATCH_MULTI_TEXTURES - 1)) &&
+            (RLGL.State.currentShaderId == RLGL.State.defaultShaderId))
+        {
+            draw->textureIds[draw->textureCount] = id;
+            draw->textureCount++;
+            RLGL.State.texindex = draw->textureCount;
+            return;
+        }
+#endif
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
@@ -1453,6 +2551,8 @@ void rlSetTexture(unsigned int id)
                 else if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode == RL_TRIANGLES) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = ((RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount < 4)? 1 : (4 - (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount%4)));
                 else RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment = 0;
 
+                RLGL.Stats.current.textureChanges++;
+
                 if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment))
                 {
                     RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
@@ -1461,30 +2561,183 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            rlCheckRenderBatchDrawLimit(RLGL.currentBatch);
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentDrawLayer;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].opaque = RLGL.State.currentDrawOpaque;
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].blendMode = RLGL.State.currentDrawBlendMode;
+            memcpy(RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].scissor, RLGL.State.currentDrawScissor, 4*sizeof(int));
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+            RLGL.State.texindex = 0;
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].indexCount = 0;
+#endif
         }
 #endif
     }
 }
 
-// Select and active a texture slot
-void rlActiveTextureSlot(int slot)
+// Set current draw layer for render batch
+// NOTE: On batch drawing, draws are sorted by layer (lower layers drawn first) and compatible
+// consecutive draws are merged; submission order (painter's order) is kept within a layer
+void rlSetDrawLayer(int layer)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_SET_DRAW_LAYER, (unsigned int)layer); return; }
 #endif
-}
 
-// Enable texture
-void rlEnableTexture(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_11)
-    glEnable(GL_TEXTURE_2D);
+    RLGL.State.currentDrawLayer = layer;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->layer != layer)
+    {
+        if (draw->vertexCount > 0)
+        {
+            // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlSetTexture())
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            rlDrawCall current = *draw;
+
+            if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+            {
+                RLGL.State.vertexCounter += draw->vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            rlCheckRenderBatchDrawLimit(RLGL.currentBatch);
+
+            // New draw keeps current mode and textures, only layer changes
+            draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            *draw = current;
+            draw->vertexCount = 0;
+            draw->vertexAlignment = 0;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+            draw->indexCount = 0;
+#endif
+        }
+
+        draw->layer = layer;
+    }
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+}
+
+// Set following draws as opaque for render batch
+// NOTE: Opaque draws must fully cover their fragments (no transparency), with 2d depth ordering enabled
+// they are drawn front-to-back with depth writes and no blending, before any other draw of the batch
+void rlSetDrawOpaque(bool opaque)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { rlRecordCommand(RL_COMMAND_SET_DRAW_OPAQUE, opaque? 1 : 0); return; }
+#endif
+
+    RLGL.State.currentDrawOpaque = opaque;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->opaque != opaque)
+    {
+        if (draw->vertexCount > 0)
+        {
+            // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlSetTexture())
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+            rlDrawCall current = *draw;
+
+            if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+            {
+                RLGL.State.vertexCounter += draw->vertexAlignment;
+                RLGL.currentBatch->drawCounter++;
+            }
+
+            rlCheckRenderBatchDrawLimit(RLGL.currentBatch);
+
+            // New draw keeps current mode, textures and layer, only opaque flag changes
+            draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            *draw = current;
+            draw->vertexCount = 0;
+            draw->vertexAlignment = 0;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+            draw->indexCount = 0;
+#endif
+        }
+
+        draw->opaque = opaque;
+    }
+#endif
+}
+
+// Enable 2d depth ordering
+// NOTE: 2d vertex get increasing depth values (submission order), opaque draws (rlSetDrawOpaque()) are drawn first
+// front-to-back writing depth, blended draws are drawn after in submission order testing depth, so fragments
+// hidden by opaque draws are rejected by early depth test; it is only applied while depth test is disabled (2d)
+// WARNING: Draw layers (rlSetDrawLayer()) do not change depth values, they should not be used with it
+void rlEnableDepthOrdering2D(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.depthOrdering2D) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.State.depthOrdering2D = true;
+    rlResetDepthOrdering2D();
+#endif
+}
+
+// Disable 2d depth ordering
+void rlDisableDepthOrdering2D(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.depthOrdering2D) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.State.depthOrdering2D = false;
+    RLGL.currentBatch->currentDepth = -1.0f;
+#endif
+}
+
+// Reset 2d depth ordering: clear depth buffer and restart batch depth
+// NOTE: Required once per frame and after 3d drawing (depth buffer contains 3d depth values)
+void rlResetDepthOrdering2D(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.depthOrdering2D) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    glClear(GL_DEPTH_BUFFER_BIT);
+    RLGL.currentBatch->currentDepth = -1.0f;
+#endif
+}
+
+// Select and active a texture slot
+void rlActiveTextureSlot(int slot)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateActiveTexture(slot);
+#endif
+}
+
+// Enable texture
+void rlEnableTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    glEnable(GL_TEXTURE_2D);
+#endif
+    rlStateBindTexture(id);
 }
 
 // Disable texture
@@ -1493,7 +2746,7 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
 }
 
 // Enable texture cubemap
@@ -1515,7 +2768,12 @@ void rlDisableTextureCubemap(void)
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    unsigned int target = GL_TEXTURE_2D;
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (rlGetLayeredTexture(id).target != 0) target = rlGetLayeredTexture(id).target;
+#endif
+
+    rlStateBindTexture(id);
 
     switch (param)
     {
@@ -1525,23 +2783,32 @@ void rlTextureParameters(unsigned int id, int param, int value)
             if (value == RL_TEXTURE_WRAP_MIRROR_CLAMP)
             {
 #if !defined(GRAPHICS_API_OPENGL_11)
-                if (RLGL.ExtSupported.texMirrorClamp) glTexParameteri(GL_TEXTURE_2D, param, value);
+                if (RLGL.ExtSupported.texMirrorClamp) glTexParameteri(target, param, value);
                 else TRACELOG(RL_LOG_WARNING, "GL: Clamp mirror wrap mode not supported (GL_MIRROR_CLAMP_EXT)");
 #endif
             }
-            else glTexParameteri(GL_TEXTURE_2D, param, value);
+            else glTexParameteri(target, param, value);
 
         } break;
         case RL_TEXTURE_MAG_FILTER:
-        case RL_TEXTURE_MIN_FILTER: glTexParameteri(GL_TEXTURE_2D, param, value); break;
+        case RL_TEXTURE_MIN_FILTER: glTexParameteri(target, param, value); break;
+        case RL_TEXTURE_BASE_LEVEL:
+        case RL_TEXTURE_MAX_LEVEL:
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            glTexParameteri(target, param, value);
+#else
+            TRACELOG(RL_LOG_WARNING, "GL: Texture mipmap levels range not supported");
+#endif
+        } break;
         case RL_TEXTURE_FILTER_ANISOTROPIC:
         {
 #if !defined(GRAPHICS_API_OPENGL_11)
-            if (value <= RLGL.ExtSupported.maxAnisotropyLevel) glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+            if (value <= RLGL.ExtSupported.maxAnisotropyLevel) glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
             else if (RLGL.ExtSupported.maxAnisotropyLevel > 0.0f)
             {
                 TRACELOG(RL_LOG_WARNING, "GL: Maximum anisotropic filter level supported is %iX", id, (int)RLGL.ExtSupported.maxAnisotropyLevel);
-                glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+                glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
             }
             else TRACELOG(RL_LOG_WARNING, "GL: Anisotropic filtering not supported");
 #endif
@@ -1549,14 +2816,37 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlStateBindTexture(0);
+}
+
+// Set single channel texture sampled as white color with red channel as alpha: (1, 1, 1, r)
+// NOTE: Coverage masks (font atlases) are stored with one byte per pixel and tinted as GRAY_ALPHA ones,
+// texture swizzle requires OpenGL 3.3 (not available on OpenGL 2.1), otherwise returns false (use GRAY_ALPHA data instead)
+bool rlTextureSwizzleAlpha(unsigned int id)
+{
+    bool supported = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    supported = true;
+
+    if (id > 0)
+    {
+        GLint swizzleMask[] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+
+        rlStateBindTexture(id);
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+        rlStateBindTexture(0);
+    }
+#endif
+
+    return supported;
 }
 
 // Enable shader program
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlStateUseProgram(id);
 #endif
 }
 
@@ -1564,7 +2854,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlStateUseProgram(0);
 #endif
 }
 
@@ -1584,6 +2874,16 @@ void rlDisableFramebuffer(void)
 #endif
 }
 
+// Get the currently active render texture (fbo), 0 for default framebuffer
+unsigned int rlGetActiveFramebuffer(void)
+{
+    int fboId = 0;
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fboId);
+#endif
+    return (unsigned int)fboId;
+}
+
 // Activate multiple draw color buffers
 // NOTE: One color buffer is always active by default
 void rlActiveDrawBuffers(int count)
@@ -1622,16 +2922,16 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlStateSetCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlStateSetCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlStateSetCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlStateSetCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
 void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
@@ -1639,20 +2939,86 @@ void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
 // Disable depth write
 void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
 
+// Enable color write
+void rlEnableColorMask(void) { glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE); }
+
+// Disable color write
+void rlDisableColorMask(void) { glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE); }
+
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlStateSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlStateSetCapability(GL_CULL_FACE, false); }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
+void rlEnableScissorTest(void)
+{
+    glEnable(GL_SCISSOR_TEST);
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    RLGL.State.scissorTest = true;
+#endif
+}
 
 // Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
+void rlDisableScissorTest(void)
+{
+    glDisable(GL_SCISSOR_TEST);
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    RLGL.State.scissorTest = false;
+#endif
+}
 
 // Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
+void rlScissor(int x, int y, int width, int height)
+{
+    glScissor(x, y, width, height);
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    RLGL.State.scissor[0] = x;
+    RLGL.State.scissor[1] = y;
+    RLGL.State.scissor[2] = width;
+    RLGL.State.scissor[3] = height;
+#endif
+}
+
+// Enable scissor rect for following draws (bottom-left origin)
+// NOTE: With RLGL_ENABLE_BATCH_DRAW_STATE, rect is recorded per draw and applied on batch drawing (no batch flush)
+void rlEnableDrawScissor(int x, int y, int width, int height)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    int scissor[4] = { x, y, (width > 0)? width : 0, (height > 0)? height : 0 };
+
+    if (memcmp(RLGL.State.currentDrawScissor, scissor, 4*sizeof(int)) != 0)
+    {
+        rlDrawCall *draw = rlNextDrawCall();
+        memcpy(draw->scissor, scissor, 4*sizeof(int));
+        memcpy(RLGL.State.currentDrawScissor, scissor, 4*sizeof(int));
+        RLGL.State.drawStateDirty = true;
+    }
+#else
+    rlDrawRenderBatchActive();
+    rlEnableScissorTest();
+    rlScissor(x, y, width, height);
+#endif
+}
+
+// Disable scissor rect for following draws
+void rlDisableDrawScissor(void)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    if (RLGL.State.currentDrawScissor[2] >= 0)
+    {
+        rlDrawCall *draw = rlNextDrawCall();
+        int scissor[4] = { 0, 0, -1, -1 };
+        memcpy(draw->scissor, scissor, 4*sizeof(int));
+        memcpy(RLGL.State.currentDrawScissor, scissor, 4*sizeof(int));
+        RLGL.State.drawStateDirty = true;
+    }
+#else
+    rlDrawRenderBatchActive();
+    rlDisableScissorTest();
+#endif
+}
 
 // Enable wire mode
 void rlEnableWireMode(void)
@@ -1725,6 +3091,20 @@ bool rlIsStereoRenderEnabled(void)
 #endif
 }
 
+// Set stereoscopic screen eyes separation (0: mono) and zero parallax distance
+// NOTE: Each eye is drawn to its own screen framebuffer from the same batch buffers, eye offset is
+// derived from current projection on draw: perspective projections get depth, orthographic ones are flat
+void rlSetStereoScreen(float separation, float convergence)
+{
+#if defined(GRAPHICS_API_CITRO3D)
+    bool changed = (separation != RLGL.State.stereoSeparation) || (convergence != RLGL.State.stereoConvergence);
+    if (changed && (RLGL.currentBatch != NULL)) rlDrawRenderBatch(RLGL.currentBatch);    // Draw pending batch with previous eyes setup
+
+    RLGL.State.stereoSeparation = (separation > 0.0f)? separation : 0.0f;
+    RLGL.State.stereoConvergence = (convergence > 0.0f)? convergence : 1.0f;
+#endif
+}
+
 // Clear color buffer with color
 void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
 {
@@ -1740,6 +3120,9 @@ void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned ch
 // Clear used screen buffers (color and depth)
 void rlClearScreenBuffers(void)
 {
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();      // Clear is limited by current scissor rect
+#endif
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: Color and Depth (Depth is used for 3D)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
@@ -1769,37 +3152,69 @@ void rlCheckErrors()
 }
 
 // Set blend mode
+// NOTE: With RLGL_ENABLE_BATCH_DRAW_STATE, blend mode is recorded per draw and applied on batch drawing (no batch flush)
 void rlSetBlendMode(int mode)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.currentBlendMode != mode)
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    if (RLGL.State.currentDrawBlendMode != mode)
+    {
+        rlDrawCall *draw = rlNextDrawCall();
+        draw->blendMode = mode;
+        RLGL.State.currentDrawBlendMode = mode;
+        RLGL.State.drawStateDirty = true;
+    }
+#elif defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Custom modes are applied again, factors could have changed
+    if ((RLGL.State.currentBlendMode != mode) || (mode == RL_BLEND_CUSTOM_SEPARATE))
     {
         rlDrawRenderBatch(RLGL.currentBatch);
+        rlApplyBlendMode(mode);
+    }
+#endif
+}
 
-        switch (mode)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Set GL blend function for blend mode
+static void rlApplyBlendMode(int mode)
+{
+    switch (mode)
+    {
+        case RL_BLEND_ALPHA: rlStateSetBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD); break;
+        case RL_BLEND_ADDITIVE: rlStateSetBlendFunction(GL_SRC_ALPHA, GL_ONE, GL_FUNC_ADD); break;
+        case RL_BLEND_MULTIPLIED: rlStateSetBlendFunction(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD); break;
+        case RL_BLEND_ADD_COLORS: rlStateSetBlendFunction(GL_ONE, GL_ONE, GL_FUNC_ADD); break;
+        case RL_BLEND_SUBTRACT_COLORS: rlStateSetBlendFunction(GL_ONE, GL_ONE, GL_FUNC_SUBTRACT); break;
+        case RL_BLEND_ALPHA_PREMUL: rlStateSetBlendFunction(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_FUNC_ADD); break;
+        case RL_BLEND_CUSTOM:
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMUL: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_CUSTOM:
-            {
-                // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
-            } break;
-            default: break;
-        }
-
-        RLGL.State.currentBlendMode = mode;
+            // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
+            rlStateSetBlendFunction(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendEquation);
+        } break;
+        case RL_BLEND_CUSTOM_SEPARATE:
+        {
+            // NOTE: Using GL blend factors and equations configured with rlSetBlendFactorsSeparate()
+            rlStateSetBlendFunctionSeparate(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor, RLGL.State.glBlendSrcFactorAlpha,
+                RLGL.State.glBlendDstFactorAlpha, RLGL.State.glBlendEquation, RLGL.State.glBlendEquationAlpha);
+        } break;
+        default: break;
     }
-#endif
+
+    RLGL.State.currentBlendMode = mode;
 }
+#endif
 
 // Set blending mode factor and equation
 void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 {
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    // Factors are not recorded per draw, custom blend mode draws already batched use previous factors
+    if ((RLGL.State.glBlendSrcFactor != glSrcFactor) || (RLGL.State.glBlendDstFactor != glDstFactor) || (RLGL.State.glBlendEquation != glEquation))
+    {
+        if (RLGL.currentBatch != NULL) rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentBlendMode = -1;       // Blend function applied again on next draw
+        RLGL.State.drawStateDirty = true;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     RLGL.State.glBlendSrcFactor = glSrcFactor;
     RLGL.State.glBlendDstFactor = glDstFactor;
@@ -1807,6 +3222,55 @@ void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 #endif
 }
 
+// Set blending mode factors and equations separately for rgb and alpha
+// NOTE: Used by RL_BLEND_CUSTOM_SEPARATE blending mode
+void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    // Factors are not recorded per draw, custom blend mode draws already batched use previous factors
+    if ((RLGL.State.glBlendSrcFactor != glSrcRGB) || (RLGL.State.glBlendDstFactor != glDstRGB) || (RLGL.State.glBlendSrcFactorAlpha != glSrcAlpha) ||
+        (RLGL.State.glBlendDstFactorAlpha != glDstAlpha) || (RLGL.State.glBlendEquation != glEqRGB) || (RLGL.State.glBlendEquationAlpha != glEqAlpha))
+    {
+        if (RLGL.currentBatch != NULL) rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentBlendMode = -1;       // Blend function applied again on next draw
+        RLGL.State.drawStateDirty = true;
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.glBlendSrcFactor = glSrcRGB;
+    RLGL.State.glBlendDstFactor = glDstRGB;
+    RLGL.State.glBlendSrcFactorAlpha = glSrcAlpha;
+    RLGL.State.glBlendDstFactorAlpha = glDstAlpha;
+    RLGL.State.glBlendEquation = glEqRGB;
+    RLGL.State.glBlendEquationAlpha = glEqAlpha;
+#endif
+}
+
+// Reset GL state cache, all cached states are sent to GL again on next change
+// NOTE: Required after changing program, texture, buffer, blending or capabilities with raw OpenGL calls
+void rlResetStateCache(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.program = RL_STATE_UNKNOWN;
+    RLGL.Cache.activeUnit = RL_STATE_UNKNOWN;
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_UNITS; i++) RLGL.Cache.textures[i] = RL_STATE_UNKNOWN;
+    RLGL.Cache.vao = RL_STATE_UNKNOWN;
+    RLGL.Cache.arrayBuffer = RL_STATE_UNKNOWN;
+    RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;
+    RLGL.Cache.blend = RL_STATE_UNKNOWN;
+    RLGL.Cache.depthTest = RL_STATE_UNKNOWN;
+    RLGL.Cache.cullFace = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendSrcFactor = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendDstFactor = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendEquation = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendSrcFactorAlpha = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendDstFactorAlpha = RL_STATE_UNKNOWN;
+    RLGL.Cache.blendEquationAlpha = RL_STATE_UNKNOWN;
+    for (int i = 0; i < RL_MAX_STATE_CACHE_UNIFORM_BUFFERS; i++) RLGL.Cache.uniformBuffers[i] = RL_STATE_UNKNOWN;
+    memset(RLGL.Cache.programUniforms, 0, sizeof(RLGL.Cache.programUniforms));
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -1890,6 +3354,9 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Init GL state cache, current context state is not assumed
+    rlResetStateCache();
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -1903,8 +3370,17 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderId = RLGL.State.defaultShaderId;
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    // Init draw state, scissor test disabled (render batch draws initialized with it)
+    RLGL.State.currentDrawBlendMode = RL_BLEND_ALPHA;
+    RLGL.State.currentDrawScissor[2] = -1;
+    RLGL.State.currentDrawScissor[3] = -1;
+#endif
+
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    // NOTE: Size could be set at runtime before initialization: rlSetDefaultBatchSize()
+    RLGL.defaultBatch = rlLoadRenderBatch((RLGL.defaultBatchBuffers > 0)? RLGL.defaultBatchBuffers : RL_DEFAULT_BATCH_BUFFERS,
+                                          (RLGL.defaultBatchElements > 0)? RLGL.defaultBatchElements : RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -1921,17 +3397,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlStateSetCapability(GL_DEPTH_TEST, false);             // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlStateSetCapability(GL_BLEND, true);                   // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlStateSetCapability(GL_CULL_FACE, true);               // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -1967,6 +3443,52 @@ void rlglClose(void)
 
     rlUnloadShaderDefault();          // Unload default shader
 
+    if (RLGL.State.sdfShaderId > 0) glDeleteProgram(RLGL.State.sdfShaderId);   // Unload SDF text shader
+    RL_FREE(RLGL.State.sdfShaderLocs);
+    RLGL.State.sdfShaderId = 0;
+    RLGL.State.sdfShaderLocs = NULL;
+    RLGL.State.sdfShaderFailed = false;
+
+    RL_FREE(RLGL.State.drawSortBuffer); // Unload draws sorting scratch buffer
+    RLGL.State.drawSortBuffer = NULL;
+    RLGL.State.drawSortBufferSize = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    RL_FREE(RLGL.State.layeredTextures);    // Unload layered textures targets
+    RLGL.State.layeredTextures = NULL;
+    RLGL.State.layeredTexturesCapacity = 0;
+#endif
+
+    if (RLGL.State.instanceStreamId > 0) rlUnloadVertexBuffer(RLGL.State.instanceStreamId);  // Unload instance stream buffer
+    RLGL.State.instanceStreamId = 0;
+    RLGL.State.instanceStreamSize = 0;
+    RLGL.State.instanceStreamOffset = 0;
+
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    // Delete all pending unloads, waiting for GPU to finish
+    glFinish();
+    for (int i = 0; i < RLGL.Unload.count; i++)
+    {
+        rlUnloadFence(RLGL.Unload.generations[i].fence);
+        rlDestroyDeferredUnloads(RLGL.Unload.generations[i].unloads);
+    }
+    rlDestroyDeferredUnloads(rlTakeDeferredUnloads());
+
+    RL_FREE(RLGL.Unload.generations);
+    RLGL.Unload.generations = NULL;
+    RLGL.Unload.count = 0;
+    RLGL.Unload.capacity = 0;
+#endif
+
+    for (int i = 0; i < 3; i++)
+    {
+        RL_FREE(RLGL.Memory.sizes[i]);      // Unload video memory tracking data
+        RLGL.Memory.sizes[i] = NULL;
+        RLGL.Memory.capacity[i] = 0;
+    }
+
+    if (RLGL.Stats.queries[0] != 0) glDeleteQueries(3, RLGL.Stats.queries);    // Unload GPU timer queries
+
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
@@ -2013,6 +3535,24 @@ void rlLoadExtensions(void *loader)
     // NOTE: With GLAD, we can check if an extension is supported using the GLAD_GL_xxx booleans
     if (GLAD_GL_EXT_texture_compression_s3tc) RLGL.ExtSupported.texCompDXT = true;  // Texture compression: DXT
     if (GLAD_GL_ARB_ES3_compatibility) RLGL.ExtSupported.texCompETC2 = true;        // Texture compression: ETC2/EAC
+    if (GLAD_GL_ARB_buffer_storage && (glBufferStorage != NULL) && (glFenceSync != NULL)) RLGL.ExtSupported.bufferStorage = true; // Persistent mapped buffers
+    if ((GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query) && (glGetQueryObjectui64v != NULL)) RLGL.ExtSupported.timerQuery = true;   // GPU timer queries
+    if (GLAD_GL_VERSION_1_5 && (glGenQueries != NULL)) RLGL.ExtSupported.occlusionQuery = true;    // Occlusion queries
+    if (GLAD_GL_VERSION_3_0 && (glBeginConditionalRender != NULL)) RLGL.ExtSupported.conditionalRender = true;   // Conditional rendering
+    if ((GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary) && (glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;  // Program binaries
+    if (GLAD_GL_VERSION_4_3 && (glInvalidateFramebuffer != NULL)) RLGL.ExtSupported.invalidateFramebuffer = true;   // Framebuffer invalidation
+
+    // Parallel shader compilation is not loaded by glad, extension is checked on extensions list
+    for (int i = 0; (i < numExt) && (glGetStringi != NULL) && (loader != NULL); i++)
+    {
+        const char *extension = (const char *)glGetStringi(GL_EXTENSIONS, i);
+
+        if ((strcmp(extension, "GL_KHR_parallel_shader_compile") == 0) || (strcmp(extension, "GL_ARB_parallel_shader_compile") == 0))
+        {
+            glMaxShaderCompilerThreads = (rlglMaxShaderCompilerThreadsProc)((rlglLoadProc)loader)((extension[3] == 'K')? "glMaxShaderCompilerThreadsKHR" : "glMaxShaderCompilerThreadsARB");
+            RLGL.ExtSupported.parallelShaderCompile = true;
+        }
+    }
     #endif
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2084,6 +3624,58 @@ void rlLoadExtensions(void *loader)
             }
         }
 
+        // Check GPU timer queries support
+        if (strcmp(extList[i], (const char *)"GL_EXT_disjoint_timer_query") == 0)
+        {
+            glGenQueries = (PFNGLGENQUERIESEXTPROC)((rlglLoadProc)loader)("glGenQueriesEXT");
+            glDeleteQueries = (PFNGLDELETEQUERIESEXTPROC)((rlglLoadProc)loader)("glDeleteQueriesEXT");
+            glBeginQuery = (PFNGLBEGINQUERYEXTPROC)((rlglLoadProc)loader)("glBeginQueryEXT");
+            glEndQuery = (PFNGLENDQUERYEXTPROC)((rlglLoadProc)loader)("glEndQueryEXT");
+            glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectuivEXT");
+            glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectui64vEXT");
+
+            if ((glGenQueries != NULL) && (glDeleteQueries != NULL) && (glBeginQuery != NULL) && (glEndQuery != NULL) &&
+                (glGetQueryObjectuiv != NULL) && (glGetQueryObjectui64v != NULL)) RLGL.ExtSupported.timerQuery = true;
+        }
+
+        // Check occlusion queries support
+        // NOTE: Query functions are shared with timer queries extension
+        if (strcmp(extList[i], (const char *)"GL_EXT_occlusion_query_boolean") == 0)
+        {
+            glGenQueries = (PFNGLGENQUERIESEXTPROC)((rlglLoadProc)loader)("glGenQueriesEXT");
+            glDeleteQueries = (PFNGLDELETEQUERIESEXTPROC)((rlglLoadProc)loader)("glDeleteQueriesEXT");
+            glBeginQuery = (PFNGLBEGINQUERYEXTPROC)((rlglLoadProc)loader)("glBeginQueryEXT");
+            glEndQuery = (PFNGLENDQUERYEXTPROC)((rlglLoadProc)loader)("glEndQueryEXT");
+            glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVEXTPROC)((rlglLoadProc)loader)("glGetQueryObjectuivEXT");
+
+            if ((glGenQueries != NULL) && (glDeleteQueries != NULL) && (glBeginQuery != NULL) && (glEndQuery != NULL) &&
+                (glGetQueryObjectuiv != NULL)) RLGL.ExtSupported.occlusionQuery = true;
+        }
+
+        // Check program binaries support
+        if (strcmp(extList[i], (const char *)"GL_OES_get_program_binary") == 0)
+        {
+            glGetProgramBinary = (PFNGLGETPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glGetProgramBinaryOES");
+            glProgramBinary = (PFNGLPROGRAMBINARYOESPROC)((rlglLoadProc)loader)("glProgramBinaryOES");
+
+            if ((glGetProgramBinary != NULL) && (glProgramBinary != NULL)) RLGL.ExtSupported.programBinary = true;
+        }
+
+        // Check framebuffer invalidation support
+        if (strcmp(extList[i], (const char *)"GL_EXT_discard_framebuffer") == 0)
+        {
+            glDiscardFramebuffer = (PFNGLDISCARDFRAMEBUFFEREXTPROC)((rlglLoadProc)loader)("glDiscardFramebufferEXT");
+
+            if (glDiscardFramebuffer != NULL) RLGL.ExtSupported.invalidateFramebuffer = true;
+        }
+
+        // Check parallel shader compilation support
+        if (strcmp(extList[i], (const char *)"GL_KHR_parallel_shader_compile") == 0)
+        {
+            glMaxShaderCompilerThreads = (rlglMaxShaderCompilerThreadsProc)((rlglLoadProc)loader)("glMaxShaderCompilerThreadsKHR");
+            RLGL.ExtSupported.parallelShaderCompile = true;
+        }
+
         // Check NPOT textures support
         // NOTE: Only check on OpenGL ES, OpenGL 3.3 has NPOT textures full support as core feature
         if (strcmp(extList[i], (const char *)"GL_OES_texture_npot") == 0) RLGL.ExtSupported.texNPOT = true;
@@ -2144,6 +3736,24 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // NOTE: Program binaries are only usable if driver exposes some binary format
+    #ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+        #define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+    #endif
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        if (binaryFormats <= 0) RLGL.ExtSupported.programBinary = false;
+    }
+
+    // NOTE: Driver chooses compiler threads count by default, maximum available is requested
+    if (RLGL.ExtSupported.parallelShaderCompile)
+    {
+        if (glMaxShaderCompilerThreads != NULL) glMaxShaderCompilerThreads(0xFFFFFFFF);
+        TRACELOG(RL_LOG_INFO, "GL: Parallel shader compilation supported");
+    }
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2192,6 +3802,12 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
+    if (RLGL.ExtSupported.timerQuery) TRACELOG(RL_LOG_INFO, "GL: GPU timer queries supported");
+    if (RLGL.ExtSupported.occlusionQuery) TRACELOG(RL_LOG_INFO, "GL: Occlusion queries supported");
+    if (RLGL.ExtSupported.conditionalRender) TRACELOG(RL_LOG_INFO, "GL: Conditional rendering supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
+    if (RLGL.ExtSupported.invalidateFramebuffer) TRACELOG(RL_LOG_INFO, "GL: Framebuffer invalidation supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2289,6 +3905,43 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Enable built-in SDF text shader
+// NOTE: Only replaces default shader, any custom shader enabled by user is kept, returns true if enabled
+bool rlEnableShaderSdf(float smoothing)
+{
+    bool enabled = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.currentShaderId != RLGL.State.defaultShaderId) && ((RLGL.State.sdfShaderId == 0) || (RLGL.State.currentShaderId != RLGL.State.sdfShaderId))) return false;
+
+    if ((RLGL.State.sdfShaderId == 0) && !RLGL.State.sdfShaderFailed) rlLoadShaderSdf();
+    if (RLGL.State.sdfShaderId == 0) return false;
+
+    // Smoothing uniform is shared by all batched draws, batch must be drawn before changing it
+    if ((RLGL.State.sdfSmoothingLoc != -1) && (RLGL.State.sdfSmoothing != smoothing))
+    {
+        if (RLGL.State.currentShaderId == RLGL.State.sdfShaderId) rlDrawRenderBatch(RLGL.currentBatch);
+
+        rlStateUseProgram(RLGL.State.sdfShaderId);
+        glUniform1f(RLGL.State.sdfSmoothingLoc, smoothing);
+        rlStateUseProgram(0);
+
+        RLGL.State.sdfSmoothing = smoothing;
+    }
+
+    rlSetShader(RLGL.State.sdfShaderId, RLGL.State.sdfShaderLocs);
+    enabled = true;
+#endif
+    return enabled;
+}
+
+// Disable built-in SDF text shader, default shader is restored
+void rlDisableShaderSdf(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.sdfShaderId > 0) && (RLGL.State.currentShaderId == RLGL.State.sdfShaderId)) rlSetShader(RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs);
+#endif
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
@@ -2299,15 +3952,43 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
+
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING)
+    if (numBuffers < 3) TRACELOG(RL_LOG_WARNING, "RLGL: Batch buffer ring with less than 3 buffers, CPU will wait for GPU on every flush");
+#endif
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+        // NOTE: Persistently mapped vertex data arrays are directly provided by GPU driver on buffers loading
+        if (RLGL.ExtSupported.bufferStorage) batch.vertexBuffer[i].mapped = true;
+#endif
+        if (!batch.vertexBuffer[i].mapped)
+        {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+            batch.vertexBuffer[i].vertices = (rlVertexInterleaved *)RL_CALLOC(bufferElements*4, sizeof(rlVertexInterleaved));     // 4 vertex by quad
+#else
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#endif
+        }
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        // Triangle list indices are added on rlEnd(), strips and fans require up to 3 indices per vertex
+    #if defined(GRAPHICS_API_OPENGL_33)
+        batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*4*3*sizeof(unsigned int));
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*4*3*sizeof(unsigned short));
+    #endif
+#else
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2315,10 +3996,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2333,8 +4010,14 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
             k++;
         }
+#endif
 
         RLGL.State.vertexCounter = 0;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        RLGL.State.indexCounter = 0;
+        RLGL.State.primitiveMode = RL_LINES;
+        RLGL.State.primitiveStart = 0;
+#endif
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in RAM (CPU)");
@@ -2348,51 +4031,113 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
+        }
+
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].mapped)
+        {
+            // Vertex buffers storage is immutable and persistently mapped, rlVertex*() writes directly into it
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+            batch.vertexBuffer[i].vertices = (rlVertexInterleaved *)rlLoadMappedBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*4*sizeof(rlVertexInterleaved));
+
+            if (batch.vertexBuffer[i].vertices == NULL)
+            {
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular buffers");
+
+                rlStateReleaseBuffer(batch.vertexBuffer[i].vboId[0]);
+                glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+                batch.vertexBuffer[i].mapped = false;
+                batch.vertexBuffer[i].vertices = (rlVertexInterleaved *)RL_CALLOC(bufferElements*4, sizeof(rlVertexInterleaved));
+            }
+#else
+            batch.vertexBuffer[i].vertices = (float *)rlLoadMappedBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*3*4*sizeof(float));
+            batch.vertexBuffer[i].texcoords = (float *)rlLoadMappedBuffer(&batch.vertexBuffer[i].vboId[1], bufferElements*2*4*sizeof(float));
+            batch.vertexBuffer[i].colors = (unsigned char *)rlLoadMappedBuffer(&batch.vertexBuffer[i].vboId[2], bufferElements*4*4*sizeof(unsigned char));
+
+            if ((batch.vertexBuffer[i].vertices == NULL) || (batch.vertexBuffer[i].texcoords == NULL) || (batch.vertexBuffer[i].colors == NULL))
+            {
+                TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffers, using regular buffers");
+
+                for (int k = 0; k < 3; k++) rlStateReleaseBuffer(batch.vertexBuffer[i].vboId[k]);
+                glDeleteBuffers(3, batch.vertexBuffer[i].vboId);
+                batch.vertexBuffer[i].mapped = false;
+                batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));
+                batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));
+                batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));
+            }
+#endif
         }
+#endif
+        // Quads - Vertex buffers loading
+        if (!batch.vertexBuffer[i].mapped)
+        {
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+            // Vertex interleaved buffer (shader-locations = 0, 1, 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            rlStateBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlVertexInterleaved), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+#else
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            rlStateBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            rlStateBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            rlStateBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+#endif
+        }
+
+        // Quads - Vertex attributes enable (stored by VAO if supported)
+        rlSetBatchVertexAttributes(&batch.vertexBuffer[i]);
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+        rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        // Index buffer is updated on batch drawing, same as vertex data
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*4*3*sizeof(batch.vertexBuffer[i].indices[0]), NULL, GL_DYNAMIC_DRAW);
+#else
 #if defined(GRAPHICS_API_OPENGL_33)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
+#endif
+#endif
+
+        // Video memory estimate, vertex buffers (mapped or not) and index buffer
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[0], bufferElements*4*sizeof(rlVertexInterleaved));
+#else
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[0], bufferElements*3*4*sizeof(float));
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[1], bufferElements*2*4*sizeof(float));
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[2], bufferElements*4*4*sizeof(unsigned char));
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[3], bufferElements*4*3*sizeof(batch.vertexBuffer[i].indices[0]));
+#else
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[3], bufferElements*6*sizeof(batch.vertexBuffer[i].indices[0]));
 #endif
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
     //--------------------------------------------------------------------------------------------
     batch.draws = (rlDrawCall *)RL_MALLOC(RL_DEFAULT_BATCH_DRAWCALLS*sizeof(rlDrawCall));
+    batch.drawCapacity = RL_DEFAULT_BATCH_DRAWCALLS;
 
     for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
     {
@@ -2402,6 +4147,18 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].layer = RLGL.State.currentDrawLayer;
+        batch.draws[i].opaque = RLGL.State.currentDrawOpaque;
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+        batch.draws[i].blendMode = RLGL.State.currentDrawBlendMode;
+        memcpy(batch.draws[i].scissor, RLGL.State.currentDrawScissor, 4*sizeof(int));
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        batch.draws[i].textureCount = 0;
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        batch.draws[i].indexCount = 0;
+#endif
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2420,8 +4177,8 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Unbind everything
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     // Unload all vertex buffers data
     for (int i = 0; i < batch.bufferCount; i++)
@@ -2429,27 +4186,51 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlStateBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(0);
             glDisableVertexAttribArray(1);
             glDisableVertexAttribArray(2);
             glDisableVertexAttribArray(3);
-            glBindVertexArray(0);
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+            glDisableVertexAttribArray(6);
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+            glDisableVertexAttribArray(7);
+#endif
+            rlStateBindVertexArray(0);
         }
 
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+#endif
         // Delete VBOs from GPU (VRAM)
+        // NOTE: Deleting a persistently mapped buffer unmaps it implicitly
+        for (int k = 0; k < 4; k++)
+        {
+            rlStateReleaseBuffer(batch.vertexBuffer[i].vboId[k]);
+            rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[k], 0);
+        }
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao)
+        {
+            rlStateReleaseVertexArray(batch.vertexBuffer[i].vaoId);
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        }
 
         // Free vertex arrays memory from CPU (RAM)
-        RL_FREE(batch.vertexBuffer[i].vertices);
-        RL_FREE(batch.vertexBuffer[i].texcoords);
-        RL_FREE(batch.vertexBuffer[i].colors);
+        if (!batch.vertexBuffer[i].mapped)
+        {
+            RL_FREE(batch.vertexBuffer[i].vertices);
+#if !defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+            RL_FREE(batch.vertexBuffer[i].texcoords);
+            RL_FREE(batch.vertexBuffer[i].colors);
+#endif
+        }
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2464,29 +4245,68 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RL_PROFILE_ZONE_BEGIN(zone, "rlDrawRenderBatch");
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Add indices of primitive still open (batch drawn inside rlBegin()/rlEnd(), i.e. batch limit reached)
+    rlAddBatchIndices();
+#endif
+    if (RLGL.State.vertexCounter > RLGL.Stats.current.batchVertexPeak) RLGL.Stats.current.batchVertexPeak = RLGL.State.vertexCounter;
+    if (batch->drawCounter > RLGL.Stats.current.batchDrawsPeak) RLGL.Stats.current.batchDrawsPeak = batch->drawCounter;
+
+    if (batch->drawCounter > 1) rlSortRenderBatchDraws(batch);
+
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        RLGL.Stats.current.batchFlushes++;
+        RLGL.Stats.current.vertexCount += RLGL.State.vertexCounter;
+    }
 
+    if ((RLGL.State.vertexCounter > 0) && !batch->vertexBuffer[batch->currentBuffer].mapped)
+    {
+        // Activate elements VAO
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING)
+        // Orphan previous buffers storage, driver provides new storage immediately while GPU could still be
+        // reading the previous one, that way glBufferSubData() does not require an implicit sync
+        int elementCount = batch->vertexBuffer[batch->currentBuffer].elementCount;
+    #if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*4*sizeof(rlVertexInterleaved), NULL, GL_DYNAMIC_DRAW);
+    #else
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+    #endif
+#endif
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        // Vertex interleaved buffer: positions, texture coordinates and colors
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlVertexInterleaved), batch->vertexBuffer[batch->currentBuffer].vertices);
+#else
         // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
 
         // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
 
         // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+        rlStateBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+#endif
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2504,8 +4324,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+    }
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Triangle list indices buffer, indices are not mapped so they are updated even if vertex data is
+    if (RLGL.State.indexCounter > 0)
+    {
+        // NOTE: Element buffer binding is vertex array state
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+
+        rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING)
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*3*sizeof(batch->vertexBuffer[batch->currentBuffer].indices[0]), NULL, GL_DYNAMIC_DRAW);
+#endif
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, RLGL.State.indexCounter*sizeof(batch->vertexBuffer[batch->currentBuffer].indices[0]), batch->vertexBuffer[batch->currentBuffer].indices);
+
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
     }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Draw batch vertex buffers (considering VR stereo if required)
@@ -2516,8 +4353,36 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     int eyeCount = 1;
     if (RLGL.State.stereoRender) eyeCount = 2;
 
+#if defined(GRAPHICS_API_CITRO3D)
+    // Stereoscopic screen: batch buffers are uploaded once and drawn on each eye framebuffer,
+    // only draw commands are repeated, right eye is not drawn when mono (separation 0, 3D slider down)
+    bool stereoScreen = (RLGL.State.stereoSeparation > 0.0f) && c3dglIsStereoActive();
+    if (stereoScreen) eyeCount = 2;
+#endif
+
     for (int eye = 0; eye < eyeCount; eye++)
     {
+#if defined(GRAPHICS_API_CITRO3D)
+        if (stereoScreen)
+        {
+            // Eye offset: view translated by half separation (left eye: 0, right eye: 1), projection
+            // shifted on clip space for zero parallax at convergence distance
+            // NOTE: Orthographic projections (w = 1) get no offset, 2d drawing stays on screen plane
+            Matrix matEyeView = rlMatrixIdentity();
+            Matrix matEyeShift = rlMatrixIdentity();
+
+            if (matProjection.m15 == 0.0f)
+            {
+                matEyeView.m12 = ((eye == 0)? 0.5f : -0.5f)*RLGL.State.stereoSeparation;
+                matEyeShift.m12 = -matEyeView.m12*matProjection.m0/RLGL.State.stereoConvergence;
+            }
+
+            c3dglSetEye(eye);
+            rlSetMatrixModelview(rlMatrixMultiply(matModelView, matEyeView));
+            rlSetMatrixProjection(rlMatrixMultiply(matProjection, matEyeShift));
+        }
+        else
+#endif
         if (eyeCount == 2)
         {
             // Setup current eye viewport (half screen width)
@@ -2533,7 +4398,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlStateUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -2543,32 +4408,47 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
                 matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
             };
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            // NOTE: Uniforms values are kept by shader program, only send them if changed since last batch
+            rlProgramUniforms *uniforms = rlStateGetProgramUniforms(RLGL.State.currentShaderId);
+
+            if ((uniforms->locs[0] != RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP]) ||
+                (uniforms->locs[1] != RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE]) ||
+                (uniforms->locs[2] != RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE]))
+            {
+                // Shader locations changed (rlSetShader() with other locs), values must be sent again
+                uniforms->locs[0] = RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP];
+                uniforms->locs[1] = RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE];
+                uniforms->locs[2] = RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE];
+                uniforms->mvpSent = false;
+                uniforms->defaults = false;
+            }
+
+            if (!uniforms->mvpSent || (memcmp(uniforms->mvp, matMVPfloat, sizeof(matMVPfloat)) != 0))
+            {
+                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+                memcpy(uniforms->mvp, matMVPfloat, sizeof(matMVPfloat));
+                uniforms->mvpSent = true;
+            }
+            else RLGL.Stats.current.stateChangesSkipped++;
+
+            if (RLGL.ExtSupported.vao) rlStateBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+                // Bind vertex attribs: position (shader-location = 0), texcoord (shader-location = 1), color (shader-location = 3)
+                rlSetBatchVertexAttributes(&batch->vertexBuffer[batch->currentBuffer]);
+
+                rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            if (!uniforms->defaults)
+            {
+                glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+                uniforms->defaults = true;
+            }
+            else RLGL.Stats.current.stateChangesSkipped += 2;
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -2576,74 +4456,173 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlStateActiveTexture(1 + i);
+                    rlStateBindTexture(RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlStateActiveTexture(0);
+
+            // 2d depth ordering: opaque draws are drawn first front-to-back with depth writes and no blending, then
+            // blended draws back-to-front with depth test only, fragments hidden by opaque draws are rejected early
+            bool depthOrdered = false;
+            unsigned int blend = RLGL.Cache.blend;
+
+            if (RLGL.State.depthOrdering2D && (RLGL.Cache.depthTest == false))
+            {
+                for (int i = 0; i < batch->drawCounter; i++)
+                {
+                    if (batch->draws[i].opaque && (batch->draws[i].vertexCount > 0)) { depthOrdered = true; break; }
+                }
+            }
 
-            for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+            for (int pass = 0; pass < (depthOrdered? 2 : 1); pass++)
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                bool reverse = depthOrdered && (pass == 0);
+                int vertexOffset = 0;
+                int indexOffset = 0;
 
-                if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
-                else
+                if (depthOrdered)
                 {
-#if defined(GRAPHICS_API_OPENGL_33)
-                    // We need to define the number of indices to be processed: elementCount*6
-                    // NOTE: The final parameter tells the GPU the offset in bytes from the
-                    // start of the index buffer to the location of the first index to process
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+                    if (pass == 0)
+                    {
+                        rlStateSetCapability(GL_DEPTH_TEST, true);
+                        rlStateSetCapability(GL_BLEND, false);
+                        glDepthMask(GL_TRUE);
+                    }
+                    else
+                    {
+                        rlStateSetCapability(GL_BLEND, (blend != 0));
+                        glDepthMask(GL_FALSE);
+                    }
+                }
+
+                // Front-to-back pass offsets are computed from the end of batch buffers
+                if (reverse)
+                {
+                    for (int i = 0; i < batch->drawCounter; i++)
+                    {
+                        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+                        indexOffset += batch->draws[i].indexCount;
 #endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-                    glDrawElements(GL_TRIANGLES, batch->draws[i].vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+                    }
+                }
+
+                for (int d = 0; d < batch->drawCounter; d++)
+                {
+                    int i = reverse? (batch->drawCounter - 1 - d) : d;
+
+                    if (reverse)
+                    {
+                        vertexOffset -= (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+                        indexOffset -= batch->draws[i].indexCount;
+#endif
+                    }
+
+                    if (!depthOrdered || (batch->draws[i].opaque == reverse))
+                    {
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+                        if (batch->draws[i].vertexCount > 0) rlApplyDrawState(batch->draws[i].blendMode, batch->draws[i].scissor);
+#endif
+                        rlDrawRenderBatchDraw(&batch->draws[i], vertexOffset, indexOffset);
+                    }
+
+                    if (!reverse)
+                    {
+                        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+                        indexOffset += batch->draws[i].indexCount;
 #endif
+                    }
                 }
+            }
 
-                vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+            if (depthOrdered)
+            {
+                glDepthMask(GL_TRUE);
+                rlStateSetCapability(GL_DEPTH_TEST, false);
             }
 
             if (!RLGL.ExtSupported.vao)
             {
-                glBindBuffer(GL_ARRAY_BUFFER, 0);
-                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
+                rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
-
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        // NOTE: Shader program and textures are kept bound, state cache skips binding them again on next draw
     }
 
     // Restore viewport to default measures
+#if defined(GRAPHICS_API_CITRO3D)
+    if (stereoScreen) c3dglSetEye(0);
+    else
+#endif
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    // Current draw state is left applied, following direct draws and raw GL calls use it
+    rlApplyDrawState(RLGL.State.currentDrawBlendMode, RLGL.State.currentDrawScissor);
+    RLGL.State.drawStateDirty = false;
+#endif
+
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+    // Register a fence after the draw commands reading current mapped buffer,
+    // it must be signaled before CPU writes again on this ring segment
+    if (batch->vertexBuffer[batch->currentBuffer].mapped && (RLGL.State.vertexCounter > 0))
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    RLGL.State.indexCounter = 0;
+    RLGL.State.primitiveStart = 0;
+#endif
 
     // Reset depth for next draw
-    batch->currentDepth = -1.0f;
+    // NOTE: With 2d depth ordering, depth keeps increasing until reset (rlResetDepthOrdering2D()),
+    // following batches must be drawn over depth values already written
+    if (!RLGL.State.depthOrdering2D) batch->currentDepth = -1.0f;
 
     // Restore projection/modelview matrices
     RLGL.State.projection = matProjection;
     RLGL.State.modelview = matModelView;
 
     // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    for (int i = 0; i < batch->drawCapacity; i++)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.currentDrawLayer;
+        batch->draws[i].opaque = RLGL.State.currentDrawOpaque;
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+        batch->draws[i].blendMode = RLGL.State.currentDrawBlendMode;
+        memcpy(batch->draws[i].scissor, RLGL.State.currentDrawScissor, 4*sizeof(int));
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        batch->draws[i].textureCount = 0;
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        batch->draws[i].indexCount = 0;
+#endif
     }
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    RLGL.State.texindex = 0;
+#endif
 
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
@@ -2655,6 +4634,23 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+    // Make sure GPU is not reading next ring segment before rlVertex*() starts writing on it
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) rlWaitBufferFence(&batch->vertexBuffer[batch->currentBuffer]);
+#endif
+
+    RL_PROFILE_ZONE_END(zone);
+#endif
+}
+
+// Set default internal render batch size, applied on rlglInit()
+// NOTE: Smaller batches reduce initialization time and memory, bigger batches reduce draw calls on heavy scenes
+void rlSetDefaultBatchSize(int numBuffers, int bufferElements)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.defaultBatchBuffers = (numBuffers > 0)? numBuffers : 0;
+    RLGL.defaultBatchElements = (bufferElements > 0)? bufferElements : 0;
 #endif
 }
 
@@ -2673,6 +4669,10 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 void rlDrawRenderBatchActive(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { return; }
+#endif
+
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
 }
@@ -2684,1743 +4684,5332 @@ bool rlCheckRenderBatchLimit(int vCount)
     bool overflow = false;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexCounter + vCount) >=
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL) { return false; }
+#endif
+
+    if (((RLGL.State.vertexCounter + vCount) >=
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+        && !rlGrowRenderBatch(RLGL.currentBatch, vCount)
+#endif
+        )
     {
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        rlDrawCall currentDraw = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        unsigned char currentTexIndex = RLGL.State.texindex;
+#endif
 
         overflow = true;
+        RLGL.Stats.current.batchOverflows++;
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = currentDraw.textureCount;
+        for (int i = 0; i < currentDraw.textureCount; i++) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureIds[i] = currentDraw.textureIds[i];
+        RLGL.State.texindex = currentTexIndex;
+#endif
     }
 #endif
 
     return overflow;
 }
 
-// Textures data management
-//-----------------------------------------------------------------------------------------
-// Convert image data to OpenGL texture (returns OpenGL valid Id)
-unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
+// Begin frame stats recording
+// NOTE: Counters are reset and a GPU timer query is started (if supported)
+void rlBeginFrameStats(double time)
 {
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Stats.recording) rlEndFrameStats(time);
 
-    unsigned int id = 0;
+    memset(&RLGL.Stats.current, 0, sizeof(rlFrameStats));
+    RLGL.Stats.current.cpuBeginTime = time;
+    RLGL.Stats.current.gpuTime = -1.0;
 
-    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
-        return id;
-    }
-#else
-    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
-        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    if (RLGL.ExtSupported.timerQuery)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
-        return id;
+        if (RLGL.Stats.queries[0] == 0) glGenQueries(3, RLGL.Stats.queries);
+
+        // Read oldest pending query result, it's available with some frames latency
+        // NOTE: Query is only reused once its result has been read
+        int index = RLGL.Stats.queryIndex;
+
+        if (RLGL.Stats.queryIssued[index])
+        {
+            unsigned int available = 0;
+            glGetQueryObjectuiv(RLGL.Stats.queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+
+            if (available)
+            {
+                GLuint64 elapsed = 0;
+                glGetQueryObjectui64v(RLGL.Stats.queries[index], GL_QUERY_RESULT, &elapsed);
+                RLGL.Stats.queryIssued[index] = false;
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+                // GPU disjoint operation (i.e. power saving) makes timer results invalid
+                int disjoint = 0;
+                glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+                if (!disjoint) RLGL.Stats.gpuTime = (double)elapsed/1000000000.0;
+    #else
+                RLGL.Stats.gpuTime = (double)elapsed/1000000000.0;
+    #endif
+            }
+        }
+
+        if (!RLGL.Stats.queryIssued[index])
+        {
+            glBeginQuery(GL_TIME_ELAPSED, RLGL.Stats.queries[index]);
+            RLGL.Stats.queryIssued[index] = true;
+        }
+        else index = -1;    // Skip GPU timing for this frame, all queries pending
+
+        RLGL.Stats.queryIndex = index;
     }
+
+    RLGL.Stats.recording = true;
+#endif
+}
+
+// End frame stats recording
+void rlEndFrameStats(double time)
+{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
-        return id;
-    }
+    if (!RLGL.Stats.recording) return;
 
-    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    if (RLGL.ExtSupported.timerQuery)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
-        return id;
-    }
+        if (RLGL.Stats.queryIndex >= 0)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            RLGL.Stats.queryIndex = (RLGL.Stats.queryIndex + 1)%3;
+        }
+        else RLGL.Stats.queryIndex = 0;
 
-    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
-    {
-        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
-        return id;
+        RLGL.Stats.current.gpuTime = RLGL.Stats.gpuTime;
     }
 
-    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    RLGL.Stats.current.cpuEndTime = time;
+    RLGL.Stats.last = RLGL.Stats.current;
+    RLGL.Stats.recording = false;
+
+    for (int i = 0; i < 2; i++)
     {
-        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
-        return id;
+        RLGL.Memory.stats[i].frameLoads = RLGL.Memory.loads[i];
+        RLGL.Memory.stats[i].frameUnloads = RLGL.Memory.unloads[i];
+        RLGL.Memory.loads[i] = 0;
+        RLGL.Memory.unloads[i] = 0;
     }
 #endif
-#endif  // GRAPHICS_API_OPENGL_11
+}
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+// Set buffers swap CPU time for last recorded frame
+void rlSetFrameStatsSwapTime(double time)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.last.cpuSwapTime = time;
+#endif
+}
 
-    glGenTextures(1, &id);              // Generate texture id
+// Get last recorded frame stats
+rlFrameStats rlGetFrameStats(void)
+{
+    rlFrameStats stats = { 0 };
+    stats.gpuTime = -1.0;
 
-    glBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats.last;
+#endif
 
-    int mipWidth = width;
-    int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset
+    return stats;
+}
 
-    // Load the different mipmap levels
-    for (int i = 0; i < mipmapCount; i++)
-    {
-        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
+// Get video memory stats (rlMemoryType)
+// NOTE: Estimated from objects data sizes loaded through rlgl, objects loaded directly with OpenGL are not tracked
+rlMemoryStats rlGetVideoMemoryStats(int type)
+{
+    rlMemoryStats stats = { 0 };
 
-        int glInternalFormat, glFormat, glType;
-        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((type == RL_MEMORY_TEXTURES) || (type == RL_MEMORY_BUFFERS)) stats = RLGL.Memory.stats[type];
+#endif
 
-        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
+    return stats;
+}
 
-        if (glInternalFormat != -1)
-        {
-            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
-#if !defined(GRAPHICS_API_OPENGL_11)
-            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+// Load occlusion query
+unsigned int rlLoadOcclusionQuery(void)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.occlusionQuery) glGenQueries(1, &id);
 #endif
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+    return id;
+}
+
+// Unload occlusion query
+void rlUnloadOcclusionQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0) glDeleteQueries(1, &id);
+#endif
+}
+
+// Begin occlusion query
+// NOTE: Any samples passed queries are used if supported (GL 3.3, OpenGL ES), counting samples is slower on some GPUs
+void rlBeginOcclusionQuery(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0) glBeginQuery(GL_ANY_SAMPLES_PASSED, id);
 #elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+    if (id > 0) glBeginQuery(GLAD_GL_VERSION_3_3? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED, id);
 #endif
-                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
+}
+
+// End occlusion query
+void rlEndOcclusionQuery(void)
+{
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.occlusionQuery) glEndQuery(GL_ANY_SAMPLES_PASSED);
+#elif defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.occlusionQuery) glEndQuery(GLAD_GL_VERSION_3_3? GL_ANY_SAMPLES_PASSED : GL_SAMPLES_PASSED);
 #endif
-        }
+}
 
-        mipWidth /= 2;
-        mipHeight /= 2;
-        mipOffset += mipSize;
+// Get occlusion query result, never waits for the GPU
+// NOTE: Returns -1 if result is not available yet, 0 if no samples passed depth test (occluded), 1 otherwise
+int rlGetOcclusionQueryResult(unsigned int id)
+{
+    int result = -1;
 
-        // Security check for NPOT textures
-        if (mipWidth < 1) mipWidth = 1;
-        if (mipHeight < 1) mipHeight = 1;
-    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (id > 0)
+    {
+        unsigned int available = 0;
+        glGetQueryObjectuiv(id, GL_QUERY_RESULT_AVAILABLE, &available);
 
-    // Texture parameters configuration
-    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
-    if (RLGL.ExtSupported.texNPOT)
-    {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+        if (available)
+        {
+            unsigned int samples = 0;
+            glGetQueryObjectuiv(id, GL_QUERY_RESULT, &samples);
+            result = (samples > 0)? 1 : 0;
+        }
     }
-    else
+#endif
+
+    return result;
+}
+
+// Begin conditional render, following draws are skipped by the GPU if query samples did not pass depth test
+// NOTE: GPU waits for query result (no CPU stall), returns false if conditional rendering is not supported
+bool rlBeginConditionalRender(unsigned int id)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.conditionalRender && (id > 0))
     {
-        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+        glBeginConditionalRender(id, GL_QUERY_WAIT);
+        result = true;
     }
-#else
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
 #endif
 
-    // Magnification and minification filters
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    return result;
+}
 
+// End conditional render
+void rlEndConditionalRender(void)
+{
 #if defined(GRAPHICS_API_OPENGL_33)
-    if (mipmapCount > 1)
+    if (RLGL.ExtSupported.conditionalRender) glEndConditionalRender();
+#endif
+}
+
+// Load command list, vertex storage grows if required
+rlCommandList *rlLoadCommandList(int vertexCapacity)
+{
+    rlCommandList *list = NULL;
+
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    list = (rlCommandList *)RL_CALLOC(1, sizeof(rlCommandList));
+
+    if (list != NULL)
     {
-        // Activate Trilinear filtering if mipmaps are available
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        if (vertexCapacity > 0)
+        {
+            list->vertices = (rlCommandVertex *)RL_MALLOC(vertexCapacity*sizeof(rlCommandVertex));
+            if (list->vertices != NULL) list->vertexCapacity = vertexCapacity;
+        }
+
+        list->currentDraw = -1;
     }
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Command lists not supported (RLGL_ENABLE_COMMAND_LISTS)");
 #endif
 
-    // At this point we have the texture loaded in GPU and texture parameters configured
+    return list;
+}
 
-    // NOTE: If mipmaps were not in data, they are not generated automatically
+// Unload command list
+void rlUnloadCommandList(rlCommandList *list)
+{
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (list == NULL) return;
 
-    // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (rlRecordingList == list) rlRecordingList = list->parent;
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+    if (list->vaoId > 0) rlUnloadVertexArray(list->vaoId);
+    if (list->vboId > 0) rlUnloadVertexBuffer(list->vboId);
 
-    return id;
+    RL_FREE(list->commands);
+    RL_FREE(list->vertices);
+    RL_FREE(list->data);
+    RL_FREE(list->ranges);
+    RL_FREE(list);
+#endif
 }
 
-// Load depth texture/renderbuffer (to be attached to fbo)
-// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
-unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
+// Begin recording command list on calling thread
+// NOTE: Previous list commands are discarded, storage is kept for reuse
+void rlBeginCommandList(rlCommandList *list)
 {
-    unsigned int id = 0;
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (list == NULL) return;
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // In case depth textures not supported, we force renderbuffer usage
-    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
+    list->commandCount = 0;
+    list->vertexCount = 0;
+    list->dataSize = 0;
+    list->currentDraw = -1;
+    list->retained = 0;         // Retained vertex buffer is uploaded again on next draw
+    list->version++;
 
-    // NOTE: We let the implementation to choose the best bit-depth
-    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
-    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
+    // Default vertex attributes
+    memset(&list->state, 0, sizeof(rlCommandVertex));
+    list->state.nz = 1.0f;
+    list->state.r = 255;
+    list->state.g = 255;
+    list->state.b = 255;
+    list->state.a = 255;
 
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
-    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
-    else glInternalFormat = GL_DEPTH_COMPONENT16;
+    // Nested recording, list recorded before is restored on recording end
+    if (rlRecordingList != list) list->parent = rlRecordingList;
+    rlRecordingList = list;
 #endif
+}
 
-    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
-    {
-        glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
-        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+// End recording command list on calling thread
+// NOTE: If recording began while recording another list, that list recording continues
+void rlEndCommandList(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (rlRecordingList == NULL) return;
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    rlCommandList *parent = rlRecordingList->parent;
+    rlRecordingList->parent = NULL;
+    rlRecordingList = parent;
+#endif
+}
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+// Check if calling thread is recording a command list
+bool rlIsCommandListRecording(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    return (rlRecordingList != NULL);
+#else
+    return false;
+#endif
+}
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
-    }
-    else
+// Record callback executed on submit with a copy of data
+// NOTE: Callback runs on the submitting thread (GL thread), data copy is 16 bytes aligned
+void rlRecordCommandCallback(void (*callback)(void *data), const void *data, int size)
+{
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if ((rlRecordingList == NULL) || (callback == NULL)) return;
+
+    void *copy = NULL;
+
+    if ((data != NULL) && (size > 0))
     {
-        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
-        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
-        glGenRenderbuffers(1, &id);
-        glBindRenderbuffer(GL_RENDERBUFFER, id);
-        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
+        copy = rlReserveCommandListData(size);
+        if (copy == NULL) return;
 
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        memcpy(copy, data, size);
+    }
 
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    rlCommand *command = rlRecordCommand(RL_COMMAND_CALLBACK, 0);
+
+    if (command != NULL)
+    {
+        command->callback = callback;
+        command->offset = (copy != NULL)? (int)((unsigned char *)copy - rlRecordingList->data) : -1;
+        command->count = (copy != NULL)? size : 0;
     }
 #endif
-
-    return id;
 }
 
-// Load texture cubemap
-// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
-// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
-unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
+// Submit command list to active render batch
+// NOTE: Recorded commands are replayed on current rlgl state, matrix commands apply to current matrix
+void rlSubmitCommandList(rlCommandList *list)
 {
-    unsigned int id = 0;
-
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (list == NULL) return;
 
-    glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    // Submit is recorded on list being recorded, list is submitted when that one is replayed
+    if (rlRecordingList != NULL)
+    {
+        rlRecordCommandListCall(list, 0, rlMatrixIdentity(), NULL);
+        return;
+    }
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    // Draws are split to fit on render batch, keeping primitives complete (12 vertex multiple: lines, triangles and quads)
+    int maxDrawVertex = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4/2;
+    maxDrawVertex -= maxDrawVertex%12;
 
-    if (glInternalFormat != -1)
+    for (int i = 0; i < list->commandCount; i++)
     {
-        // Load cubemap faces
-        for (unsigned int i = 0; i < 6; i++)
+        const rlCommand *command = &list->commands[i];
+
+        switch (command->type)
         {
-            if (data == NULL)
+            case RL_COMMAND_DRAW:
             {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                // Strips and fans parts overlap previous part last 2 vertex (fan parts start from fan center instead of first one)
+                int overlap = ((command->value == RL_TRIANGLE_STRIP) || (command->value == RL_TRIANGLE_FAN))? 2 : 0;
+
+                for (int first = 0; first < command->count; first += (maxDrawVertex - overlap))
                 {
-                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
-                    {
-                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
-                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
-                        else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    }
-                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
-                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
-                }
-                else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
-            }
-            else
-            {
-                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
-                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
-            }
+                    int count = ((command->count - first) < maxDrawVertex)? (command->count - first) : maxDrawVertex;
 
-#if defined(GRAPHICS_API_OPENGL_33)
-            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-            {
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
-            {
-#if defined(GRAPHICS_API_OPENGL_21)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
-#elif defined(GRAPHICS_API_OPENGL_33)
-                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
-#endif
-                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
-            }
-#endif
-        }
-    }
+                    rlCheckRenderBatchLimit(count);
+                    rlBegin(command->value);
 
-    // Set cubemap texture sampling parameters
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#if defined(GRAPHICS_API_OPENGL_33)
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
-#endif
+                    for (int v = 0; v < count; v++)
+                    {
+                        const rlCommandVertex *vertex = &list->vertices[command->offset + first + v];
+                        if ((v == 0) && (first > 0) && (command->value == RL_TRIANGLE_FAN)) vertex = &list->vertices[command->offset];
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+                        rlTexCoord2f(vertex->u, vertex->v);
+                        rlNormal3f(vertex->nx, vertex->ny, vertex->nz);
+                        rlColor4ub(vertex->r, vertex->g, vertex->b, vertex->a);
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+                        rlShape4f(vertex->shape[0], vertex->shape[1], vertex->shape[2], vertex->shape[3]);
 #endif
 
-    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+                        if (vertex->depth2d) rlVertex2f(vertex->x, vertex->y);
+                        else rlVertex3f(vertex->x, vertex->y, vertex->z);
+                    }
 
-    return id;
+                    rlEnd();
+
+                    if ((first + count) >= command->count) break;
+                }
+            } break;
+            case RL_COMMAND_SET_TEXTURE: rlSetTexture(command->value); break;
+            case RL_COMMAND_SET_DRAW_LAYER: rlSetDrawLayer((int)command->value); break;
+            case RL_COMMAND_SET_DRAW_OPAQUE: rlSetDrawOpaque(command->value != 0); break;
+            case RL_COMMAND_MATRIX_MODE: rlMatrixMode(command->value); break;
+            case RL_COMMAND_PUSH_MATRIX: rlPushMatrix(); break;
+            case RL_COMMAND_POP_MATRIX: rlPopMatrix(); break;
+            case RL_COMMAND_LOAD_IDENTITY: rlLoadIdentity(); break;
+            case RL_COMMAND_TRANSLATE: rlTranslatef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_ROTATE: rlRotatef(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+            case RL_COMMAND_SCALE: rlScalef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_MULT_MATRIX: rlMultMatrixf((float *)(list->data + command->offset)); break;
+            case RL_COMMAND_CALLBACK: command->callback((command->offset >= 0)? (void *)(list->data + command->offset) : NULL); break;
+            default: break;
+        }
+    }
+#endif
 }
 
-// Update already loaded texture in GPU with new data
-// NOTE: We don't know safely if internal texture format is the expected one...
-void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
+// Draw command list from GPU vertex buffer with transform and tint (normalized RGBA, NULL for white)
+// NOTE: Recorded draws are uploaded once after recording (matrix commands applied on vertex), drawing does not
+// touch the render batch vertex data, lists with callbacks or projection matrix commands are submitted instead
+void rlDrawCommandList(rlCommandList *list, Matrix transform, const float *tint)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
-
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (list == NULL) return;
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    // Draw is recorded on list being recorded, list is drawn when that one is replayed
+    if (rlRecordingList != NULL)
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        rlRecordCommandListCall(list, 1, transform, tint);
+        return;
     }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
-}
 
-// Get OpenGL internal formats and data type from raylib PixelFormat
-void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
-{
-    *glInternalFormat = -1;
-    *glFormat = -1;
-    *glType = -1;
+    if (list->retained == 0) list->retained = rlUploadCommandList(list)? 1 : -1;
 
-    switch (format)
+    if (list->retained < 0)
     {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-    #endif
-    #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-    #endif
-        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+        // Commands can not be retained, list is submitted to render batch (tint is not applied)
+        int matrixMode = RLGL.State.currentMatrixMode;
+        rlMatrixMode(RL_MODELVIEW);
+        rlPushMatrix();
+        *RLGL.State.currentMatrix = rlMatrixMultiply(transform, *RLGL.State.currentMatrix);
+        rlSubmitCommandList(list);
+        rlPopMatrix();
+        rlMatrixMode(matrixMode);
+        return;
     }
-}
 
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
-{
-    glDeleteTextures(1, &id);
-}
-
-// Generate mipmap data for selected texture
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
-{
-    glBindTexture(GL_TEXTURE_2D, id);
+    if (list->rangeCount == 0) return;
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+    // Previous drawing must be drawn first to keep drawing order
+    rlDrawRenderBatchActive();
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+    // Create model-view-projection matrix, current pushed transform (rlPushMatrix()) is applied after list transform
+    Matrix matModel = RLGL.State.transformRequired? rlMatrixMultiply(transform, RLGL.State.transform) : transform;
 
-#if defined(GRAPHICS_API_OPENGL_11)
-    if (texIsPOT)
+    // List 2d vertex depth starts from batch initial depth, with 2d depth ordering it is offset to current depth
+    if (RLGL.State.depthOrdering2D)
     {
-        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
-        if (format == RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
-        {
-            // Retrieve texture data from VRAM
-            void *texData = rlReadTexturePixels(id, width, height, format);
-
-            // NOTE: Texture data size is reallocated to fit mipmaps data
-            // NOTE: CPU mipmap generation only supports RGBA 32bit data
-            int mipmapCount = rlGenTextureMipmapsData(texData, width, height);
-
-            int size = width*height*4;
-            int offset = size;
+        Matrix matDepth = rlMatrixIdentity();
+        matDepth.m14 = RLGL.currentBatch->currentDepth + 1.0f;
+        matModel = rlMatrixMultiply(matModel, matDepth);
+    }
+    Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(matModel, RLGL.State.modelview), RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
 
-            int mipWidth = width/2;
-            int mipHeight = height/2;
+    rlStateUseProgram(RLGL.State.currentShaderId);
 
-            // Load the mipmaps
-            for (int level = 1; level < mipmapCount; level++)
-            {
-                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)texData + offset);
+    glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+    if (tint != NULL) glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], tint[0], tint[1], tint[2], tint[3]);
+    else glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
 
-                size = mipWidth*mipHeight*4;
-                offset += size;
+    // Batch uniforms values have been overwritten, they must be sent again on next batch draw
+    rlProgramUniforms *uniforms = rlStateGetProgramUniforms(RLGL.State.currentShaderId);
+    uniforms->mvpSent = false;
+    uniforms->defaults = false;
 
-                mipWidth /= 2;
-                mipHeight /= 2;
-            }
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(list->vaoId);
+    else rlSetCommandListVertexAttributes(list);
 
-            *mipmaps = mipmapCount + 1;
-            RL_FREE(texData); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    // Retained vertex do not provide texture index, default shader samples texture0
+    glVertexAttrib1f(6, 0.0f);
+#endif
 
-            TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps generated manually on CPU side, total: %i", id, *mipmaps);
+    // Activate additional sampler textures, common for all draw ranges
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] > 0)
+        {
+            rlStateActiveTexture(1 + i);
+            rlStateBindTexture(RLGL.State.activeTextureId[i]);
         }
-        else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps for provided texture format", id);
     }
-#endif
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
-    {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
+    rlStateActiveTexture(0);
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
-        #define MAX(a,b) (((a)>(b))?(a):(b))
+    for (int i = 0; i < list->rangeCount; i++)
+    {
+        rlStateBindTexture((list->ranges[i].textureId > 0)? list->ranges[i].textureId : RLGL.State.defaultTextureId);
+        glDrawArrays(list->ranges[i].mode, list->ranges[i].offset, list->ranges[i].count);
 
-        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+        RLGL.Stats.current.textureBinds++;
+        RLGL.Stats.current.drawCalls++;
     }
-#endif
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-}
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+    else rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
 
+    // Following 2d drawing is placed over the list drawing (list 2d vertex start from batch initial depth)
+    RLGL.currentBatch->currentDepth += list->depthCount*(1.0f/20000.0f);
+#endif
+}
 
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Get command list draws hashes per screen tile (tiles of tileSize pixels covering width x height, row-major)
+// NOTE: A tile hash changes if any draw covering it changes (vertex, texture, order), matrix commands are applied from
+// transform (screen space modelview) to get draws bounds, callbacks and draws after projection matrix commands are hashed on all tiles
+void rlGetCommandListTileHashes(rlCommandList *list, Matrix transform, int width, int height, int tileSize, unsigned int *hashes)
 {
-    void *pixels = NULL;
+#if defined(RLGL_ENABLE_COMMAND_LISTS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if ((list == NULL) || (hashes == NULL) || (tileSize <= 0)) return;
 
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    int tilesX = (width + tileSize - 1)/tileSize;
+    int tilesY = (height + tileSize - 1)/tileSize;
 
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    for (int i = 0; i < tilesX*tilesY; i++) hashes[i] = 2166136261u;
 
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    // Replay matrix commands on a local matrix stack, transformations are computed by rlgl matrix functions
+    Matrix stack[RL_MAX_MATRIX_STACK_SIZE] = { 0 };
+    int stackCounter = 0;
+    Matrix matrix = transform;
+    Matrix *currentMatrix = RLGL.State.currentMatrix;
+    RLGL.State.currentMatrix = &matrix;
 
-    int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlGetPixelDataSize(width, height, format);
+    unsigned int textureId = 0;
+    unsigned int layer = 0;
+    unsigned int opaque = 0;
+    unsigned int matrixMode = RL_MODELVIEW;
+    unsigned int projection = 2166136261u;      // Projection matrix commands hash
+    bool bounded = true;                        // Draws bounds known (no projection matrix commands)
 
-    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    for (int i = 0; i < list->commandCount; i++)
     {
-        pixels = RL_MALLOC(size);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
-    }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-#endif
-
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    unsigned int fboId = rlLoadFramebuffer(width, height);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    // Attach our texture to FBO
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+        const rlCommand *command = &list->commands[i];
 
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Matrix commands out of modelview are only hashed, following draws cover all tiles
+        if ((matrixMode != RL_MODELVIEW) && (command->type >= RL_COMMAND_PUSH_MATRIX) && (command->type <= RL_COMMAND_MULT_MATRIX))
+        {
+            projection = rlHashCommandData(projection, &command->type, sizeof(int));
+            projection = rlHashCommandData(projection, command->params, 4*sizeof(float));
+            if (command->type == RL_COMMAND_MULT_MATRIX) projection = rlHashCommandData(projection, list->data + command->offset, 16*sizeof(float));
+            continue;
+        }
 
-    // Clean up temporal fbo
-    rlUnloadFramebuffer(fboId);
-#endif
+        switch (command->type)
+        {
+            case RL_COMMAND_DRAW:
+            {
+                if (command->count == 0) break;
 
-    return pixels;
-}
+                unsigned int hash = 2166136261u;
+                hash = rlHashCommandData(hash, &command->value, sizeof(unsigned int));
+                hash = rlHashCommandData(hash, &textureId, sizeof(unsigned int));
+                hash = rlHashCommandData(hash, &layer, sizeof(unsigned int));
+                hash = rlHashCommandData(hash, &opaque, sizeof(unsigned int));
+                if (!bounded) hash = rlHashCommandData(hash, &projection, sizeof(unsigned int));
 
+                float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
-{
-    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+                for (int v = 0; v < command->count; v++)
+                {
+                    const rlCommandVertex *vertex = &list->vertices[command->offset + v];
+
+                    // Vertex fields are hashed one by one, structure padding is not initialized
+                    float z = vertex->depth2d? 0.0f : vertex->z;
+                    float position[3] = {
+                        matrix.m0*vertex->x + matrix.m4*vertex->y + matrix.m8*z + matrix.m12,
+                        matrix.m1*vertex->x + matrix.m5*vertex->y + matrix.m9*z + matrix.m13,
+                        matrix.m2*vertex->x + matrix.m6*vertex->y + matrix.m10*z + matrix.m14
+                    };
+
+                    hash = rlHashCommandData(hash, position, 3*sizeof(float));
+                    hash = rlHashCommandData(hash, &vertex->u, sizeof(float));
+                    hash = rlHashCommandData(hash, &vertex->v, sizeof(float));
+                    hash = rlHashCommandData(hash, &vertex->r, 4*sizeof(unsigned char));
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+                    hash = rlHashCommandData(hash, vertex->shape, 4*sizeof(float));
+#endif
+
+                    if ((v == 0) || (position[0] < minX)) minX = position[0];
+                    if ((v == 0) || (position[1] < minY)) minY = position[1];
+                    if ((v == 0) || (position[0] > maxX)) maxX = position[0];
+                    if ((v == 0) || (position[1] > maxY)) maxY = position[1];
+                }
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+                if (!bounded || !((minX > -1e8f) && (maxX < 1e8f) && (minY > -1e8f) && (maxY < 1e8f)))
+                {
+                    rlMixTileHashes(hashes, tilesX, 0, 0, tilesX - 1, tilesY - 1, hash);
+                }
+                else
+                {
+                    // Draw bounds (1 pixel margin for rasterization) to tiles range, draws out of screen are not hashed
+                    int x0 = (int)floorf((minX - 1.0f)/tileSize), y0 = (int)floorf((minY - 1.0f)/tileSize);
+                    int x1 = (int)floorf((maxX + 1.0f)/tileSize), y1 = (int)floorf((maxY + 1.0f)/tileSize);
 
-    // Flip image vertically!
-    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+                    if (x0 < 0) x0 = 0;
+                    if (y0 < 0) y0 = 0;
+                    if (x1 > (tilesX - 1)) x1 = tilesX - 1;
+                    if (y1 > (tilesY - 1)) y1 = tilesY - 1;
 
-    for (int y = height - 1; y >= 0; y--)
-    {
-        for (int x = 0; x < (width*4); x++)
-        {
-            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+                    rlMixTileHashes(hashes, tilesX, x0, y0, x1, y1, hash);
+                }
+            } break;
+            case RL_COMMAND_SET_TEXTURE: textureId = command->value; break;
+            case RL_COMMAND_SET_DRAW_LAYER: layer = command->value; break;
+            case RL_COMMAND_SET_DRAW_OPAQUE: opaque = command->value; break;
+            case RL_COMMAND_MATRIX_MODE:
+            {
+                matrixMode = command->value;
+                if (matrixMode != RL_MODELVIEW) bounded = false;
+            } break;
+            case RL_COMMAND_PUSH_MATRIX: if (stackCounter < RL_MAX_MATRIX_STACK_SIZE) stack[stackCounter++] = matrix; break;
+            case RL_COMMAND_POP_MATRIX: if (stackCounter > 0) matrix = stack[--stackCounter]; break;
+            case RL_COMMAND_LOAD_IDENTITY: matrix = rlMatrixIdentity(); break;
+            case RL_COMMAND_TRANSLATE: rlTranslatef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_ROTATE: rlRotatef(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+            case RL_COMMAND_SCALE: rlScalef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_MULT_MATRIX: rlMultMatrixf((float *)(list->data + command->offset)); break;
+            case RL_COMMAND_CALLBACK:
+            {
+                // Callback effect is unknown, callback and its data are hashed on all tiles
+                unsigned int hash = rlHashCommandData(2166136261u, &command->callback, sizeof(command->callback));
+                if (command->offset >= 0) hash = rlHashCommandData(hash, list->data + command->offset, command->count);
 
-            // Set alpha component value to 255 (no trasparent image retrieval)
-            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+                rlMixTileHashes(hashes, tilesX, 0, 0, tilesX - 1, tilesY - 1, hash);
+            } break;
+            default: break;
         }
     }
 
-    RL_FREE(screenData);
-
-    return imgData;     // NOTE: image data should be freed
+    RLGL.State.currentMatrix = currentMatrix;
+#endif
 }
 
-// Framebuffer management (fbo)
+// Textures data management
 //-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(int width, int height)
+// Convert image data to OpenGL texture (returns OpenGL valid Id)
+unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount)
 {
-    unsigned int fboId = 0;
+    rlStateBindTexture(0);    // Free any old binding
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
-#endif
-
-    return fboId;
-}
-
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
-{
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    unsigned int id = 0;
 
-    switch (attachType)
+    // Check texture format support by OpenGL 1.1 (compressed textures not supported)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
-
-        } break;
-        case RL_ATTACHMENT_DEPTH:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+        TRACELOG(RL_LOG_WARNING, "GL: OpenGL 1.1 does not support GPU compressed texture formats");
+        return id;
+    }
+#else
+    if ((!RLGL.ExtSupported.texCompDXT) && ((format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: DXT compressed texture format not supported");
+        return id;
+    }
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((!RLGL.ExtSupported.texCompETC1) && (format == RL_PIXELFORMAT_COMPRESSED_ETC1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC1 compressed texture format not supported");
+        return id;
+    }
 
-        } break;
-        case RL_ATTACHMENT_STENCIL:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+    if ((!RLGL.ExtSupported.texCompETC2) && ((format == RL_PIXELFORMAT_COMPRESSED_ETC2_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ETC2 compressed texture format not supported");
+        return id;
+    }
 
-        } break;
-        default: break;
+    if ((!RLGL.ExtSupported.texCompPVRT) && ((format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGB) || (format == RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: PVRT compressed texture format not supported");
+        return id;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if ((!RLGL.ExtSupported.texCompASTC) && ((format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA) || (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
+        return id;
+    }
 #endif
-}
+#endif  // GRAPHICS_API_OPENGL_11
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
-{
-    bool result = false;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
+    glGenTextures(1, &id);              // Generate texture id
 
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    rlStateBindTexture(id);
 
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipOffset = 0;          // Mipmap data offset
+
+    // Load the different mipmap levels
+    for (int i = 0; i < mipmapCount; i++)
     {
-        switch (status)
-        {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
-        }
-    }
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        int glInternalFormat, glFormat, glType;
+        rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
-#endif
+        TRACELOGD("TEXTURE: Load mipmap level %i (%i x %i), size: %i, offset: %i", i, mipWidth, mipHeight, mipSize, mipOffset);
 
-    return result;
-}
+        if (glInternalFormat != -1)
+        {
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, (unsigned char *)data + mipOffset);
+#if !defined(GRAPHICS_API_OPENGL_11)
+            else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
+#endif
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
-{
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
 
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+        mipWidth /= 2;
+        mipHeight /= 2;
+        mipOffset += mipSize;
 
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_RENDERBUFFER) glDeleteTextures(1, &depthIdU);
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
 
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer.
+    // Texture parameters configuration
+    // NOTE: glTexParameteri does NOT affect texture uploading, just the way it's used
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support (i.e. WebGL) has limited NPOT support, so CLAMP_TO_EDGE must be used
+    if (RLGL.ExtSupported.texNPOT)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+    }
+    else
+    {
+        // NOTE: If using negative texture coordinates (LoadOBJ()), it does not work!
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);       // Set texture to clamp on x-axis
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);       // Set texture to clamp on y-axis
+    }
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);       // Set texture to repeat on x-axis
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);       // Set texture to repeat on y-axis
+#endif
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
+    // Magnification and minification filters
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
 
-    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (mipmapCount > 1)
+    {
+        // Activate Trilinear filtering if mipmaps are available
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
 #endif
-}
 
-// Vertex data management
-//-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
-{
-    unsigned int id = 0;
+    // At this point we have the texture loaded in GPU and texture parameters configured
+
+    // NOTE: If mipmaps were not in data, they are not generated automatically
+
+    // Unbind current texture
+    rlStateBindTexture(0);
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, (unsigned int)mipOffset);    // All mipmap levels data size
 #endif
 
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
+
     return id;
 }
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
+// Load depth texture/renderbuffer (to be attached to fbo)
+// WARNING: OpenGL ES 2.0 requires GL_OES_depth_texture/WEBGL_depth_texture extensions
+unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 {
     unsigned int id = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-#endif
+    // In case depth textures not supported, we force renderbuffer usage
+    if (!RLGL.ExtSupported.texDepth) useRenderBuffer = true;
 
-    return id;
-}
+    // NOTE: We let the implementation to choose the best bit-depth
+    // Possible formats: GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT32 and GL_DEPTH_COMPONENT32F
+    unsigned int glInternalFormat = GL_DEPTH_COMPONENT;
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.maxDepthBits == 32) glInternalFormat = GL_DEPTH_COMPONENT32_OES;
+    else if (RLGL.ExtSupported.maxDepthBits == 24) glInternalFormat = GL_DEPTH_COMPONENT24_OES;
+    else glInternalFormat = GL_DEPTH_COMPONENT16;
 #endif
-}
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-#endif
-}
+    if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
+    {
+        glGenTextures(1, &id);
+        rlStateBindTexture(id);
+        glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-#endif
-}
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-#endif
-}
+        rlStateBindTexture(0);
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, width*height*4);   // Assumed 32 bits depth (implementation chosen)
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
-#endif
-}
+        TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
+    }
+    else
+    {
+        // Create the renderbuffer that will serve as the depth attachment for the framebuffer
+        // NOTE: A renderbuffer is simpler than a texture and could offer better performance on embedded devices
+        glGenRenderbuffers(1, &id);
+        glBindRenderbuffer(GL_RENDERBUFFER, id);
+        glRenderbufferStorage(GL_RENDERBUFFER, glInternalFormat, width, height);
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_RENDERBUFFER, id, width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
+
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
+    }
 #endif
+
+    return id;
 }
 
-// Enable vertex array object (VAO)
-bool rlEnableVertexArray(unsigned int vaoId)
+// Load texture cubemap
+// NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
+// expected the following convention: +X, -X, +Y, -Y, +Z, -Z
+unsigned int rlLoadTextureCubemap(const void *data, int size, int format)
 {
-    bool result = false;
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    unsigned int dataSize = rlGetPixelDataSize(size, size, format);
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
     {
-        glBindVertexArray(vaoId);
-        result = true;
+        // Load cubemap faces
+        for (unsigned int i = 0; i < 6; i++)
+        {
+            if (data == NULL)
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                {
+                    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32)
+                    {
+                        // Instead of using a sized internal texture format (GL_RGB16F, GL_RGB32F), we let the driver to choose the better format for us (GL_RGB)
+                        if (RLGL.ExtSupported.texFloat32) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, size, size, 0, GL_RGB, GL_FLOAT, NULL);
+                        else TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    }
+                    else if ((format == RL_PIXELFORMAT_UNCOMPRESSED_R32) || (format == RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(RL_LOG_WARNING, "TEXTURES: Cubemap requested format not supported");
+                    else glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, NULL);
+                }
+                else TRACELOG(RL_LOG_WARNING, "TEXTURES: Empty cubemap creation does not support compressed format");
+            }
+            else
+            {
+                if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
+                else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+            }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+            else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+            {
+#if defined(GRAPHICS_API_OPENGL_21)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ALPHA };
+#elif defined(GRAPHICS_API_OPENGL_33)
+                GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+#endif
+                glTexParameteriv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+            }
+#endif
+        }
     }
+
+    // Set cubemap texture sampling parameters
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
-    return result;
-}
 
-// Disable vertex array object (VAO)
-void rlDisableVertexArray(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, 6*dataSize);
 #endif
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
+
+    return id;
 }
 
-// Enable vertex attribute index
-void rlEnableVertexAttribute(unsigned int index)
+// Load texture cubemap with mipmaps
+// NOTE: Levels data is provided one level after the other, every level with its 6 faces (+X, -X, +Y, -Y, +Z, -Z),
+// data can be NULL to only allocate levels storage (render targets), compressed formats require data
+unsigned int rlLoadTextureCubemapMipmaps(const void *data, int size, int format, int mipmapCount)
 {
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glEnableVertexAttribArray(index);
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat == -1) || ((data == NULL) && (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Cubemap requested format not supported (%i)", format);
+        return 0;
+    }
+
+    if (mipmapCount < 1) mipmapCount = 1;
+
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+    const unsigned char *levelData = (const unsigned char *)data;
+    unsigned int dataSize = 0;
+
+    for (int level = 0, levelSize = size; level < mipmapCount; level++)
+    {
+        unsigned int faceSize = rlGetPixelDataSize(levelSize, levelSize, format);
+
+        for (int face = 0; face < 6; face++)
+        {
+            const unsigned char *faceData = (levelData != NULL)? levelData + face*faceSize : NULL;
+
+            if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, glInternalFormat, levelSize, levelSize, 0, glFormat, glType, faceData);
+            else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, glInternalFormat, levelSize, levelSize, 0, faceSize, faceData);
+        }
+
+        if (levelData != NULL) levelData += 6*faceSize;
+        dataSize += 6*faceSize;
+        levelSize = (levelSize > 1)? levelSize/2 : 1;
+    }
+
+    // Set cubemap texture sampling parameters, trilinear if mipmaps available
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, (mipmapCount > 1)? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
 #endif
-}
 
-// Disable vertex attribute index
-void rlDisableVertexAttribute(unsigned int index)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDisableVertexAttribArray(index);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, dataSize);
 #endif
-}
 
-// Draw vertex array
-void rlDrawVertexArray(int offset, int count)
-{
-    glDrawArrays(GL_TRIANGLES, offset, count);
-}
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i | %i mipmaps)", id, size, size, mipmapCount);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load cubemap texture");
 
-// Draw vertex array elements
-void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
-{
-    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+    return id;
 }
 
-// Draw vertex array instanced
-void rlDrawVertexArrayInstanced(int offset, int count, int instances)
+// Load texture array
+// NOTE: Levels data is provided one level after the other, every level with all its layers,
+// data can be NULL to only allocate levels storage (layers uploaded with rlUpdateTextureLayer())
+unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, int mipmapCount)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    id = rlLoadTextureLayered(GL_TEXTURE_2D_ARRAY, data, width, height, layers, format, mipmapCount);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Texture arrays not supported, OpenGL 3.3 required");
 #endif
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture array loaded successfully (%ix%i | %i layers | %i mipmaps)", id, width, height, layers, mipmapCount);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture array");
+
+    return id;
 }
 
-// Draw vertex array elements instanced
-void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+// Load 3D texture
+// NOTE: Slices data is provided one slice after the other, data can be NULL to only allocate storage
+unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    id = rlLoadTextureLayered(GL_TEXTURE_3D, data, width, height, depth, format, 1);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: 3D textures not supported, OpenGL 3.3 required");
 #endif
+
+    if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] 3D texture loaded successfully (%ix%ix%i)", id, width, height, depth);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load 3D texture");
+
+    return id;
 }
 
-#if defined(GRAPHICS_API_OPENGL_11)
-// Enable vertex state pointer
-void rlEnableStatePointer(int vertexAttribType, void *buffer)
+// Update already loaded texture in GPU with new data
+// NOTE: We don't know safely if internal texture format is the expected one...
+void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    if (buffer != NULL) glEnableClientState(vertexAttribType);
-    switch (vertexAttribType)
+    rlStateBindTexture(id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
-        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
-        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
-        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
-        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
-        default: break;
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
     }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
-// Disable vertex state pointer
-void rlDisableStatePointer(int vertexAttribType)
+// Update already loaded texture in GPU with data rows separated by stride (bytes), i.e. a sub-rectangle of a bigger image
+// NOTE: Rows are read in place with GL_UNPACK_ROW_LENGTH, OpenGL ES 2.0 uploads them one by one
+void rlUpdateTextureStride(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data, int stride)
 {
-    glDisableClientState(vertexAttribType);
-}
+    int bytesPerPixel = rlGetPixelDataSize(1, 1, format);
+
+    if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) || (bytesPerPixel == 0) || (stride%bytesPerPixel != 0))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update with stride for current texture format (%i)", id, format);
+        return;
+    }
+
+    if (stride == width*bytesPerPixel) { rlUpdateTexture(id, offsetX, offsetY, width, height, format, data); return; }
+
+    rlStateBindTexture(id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+#if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_CITRO3D)
+        // NOTE: GL_UNPACK_ROW_LENGTH requires OpenGL ES 3.0 (or GL_EXT_unpack_subimage)
+        for (int y = 0; y < height; y++) glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY + y, width, 1, glFormat, glType, (const unsigned char *)data + y*stride);
+#else
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, stride/bytesPerPixel);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, data);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 #endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+}
 
-// Load vertex array object (VAO)
-unsigned int rlLoadVertexArray(void)
+// Update texture array layer (or 3D texture slice) with new data, base level only
+void rlUpdateTextureLayer(unsigned int id, int layer, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    unsigned int vaoId = 0;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlLayeredTexture texture = rlGetLayeredTexture(id);
+
+    if ((texture.target == 0) || (layer < 0) || (layer >= texture.depth))
     {
-        glGenVertexArrays(1, &vaoId);
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update layer %i, not a texture array or out of range", id, layer);
+        return;
+    }
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        rlStateBindTexture(id);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage3D(texture.target, 0, offsetX, offsetY, layer, width, height, 1, glFormat, glType, data);
     }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Texture arrays not supported, OpenGL 3.3 required");
 #endif
-    return vaoId;
 }
 
-// Set vertex attribute
-void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer)
+// Update (reallocate) one mipmap level of an already loaded texture
+// NOTE: Level storage is released if width or height are 0, useful to drop unused mipmaps
+void rlUpdateTextureMipmap(unsigned int id, int level, int width, int height, int format, const void *data)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+    rlStateBindTexture(id);
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != -1)
+    {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        if ((width == 0) || (height == 0)) width = height = 0;
+
+        if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, level, glInternalFormat, width, height, 0, glFormat, glType, (width > 0)? data : NULL);
+#if !defined(GRAPHICS_API_OPENGL_11)
+        else glCompressedTexImage2D(GL_TEXTURE_2D, level, glInternalFormat, width, height, 0, (width > 0)? rlGetPixelDataSize(width, height, format) : 0, (width > 0)? data : NULL);
 #endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update mipmap level %i for current texture format (%i)", id, level, format);
+
+    rlStateBindTexture(0);
 }
 
-// Set vertex attribute divisor
-void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+// Get OpenGL internal formats and data type from raylib PixelFormat
+void rlGetGlTextureFormats(int format, int *glInternalFormat, int *glFormat, int *glType)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glVertexAttribDivisor(index, divisor);
-#endif
+    *glInternalFormat = -1;
+    *glFormat = -1;
+    *glType = -1;
+
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;   // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;         // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;    // NOTE: Requires extension OES_texture_float
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R11G11B10F: *glInternalFormat = GL_R11F_G11F_B10F; *glFormat = GL_RGB; *glType = GL_UNSIGNED_INT_10F_11F_11F_REV; break;
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+    #endif
+        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
 }
 
-// Unload vertex array object (VAO)
-void rlUnloadVertexArray(unsigned int vaoId)
+// Check if pixel format is supported by GPU
+// NOTE: Uncompressed formats are always supported (packed float requires OpenGL 3.3),
+// compressed formats depend on available extensions
+bool rlIsPixelFormatSupported(int format)
 {
+    bool supported = (format >= RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB);
+
+#if !defined(GRAPHICS_API_OPENGL_33)
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_R11G11B10F) supported = false;
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao)
+    switch (format)
     {
-        glBindVertexArray(0);
-        glDeleteVertexArrays(1, &vaoId);
-        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: supported = RLGL.ExtSupported.texCompDXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: supported = RLGL.ExtSupported.texCompETC1; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: supported = RLGL.ExtSupported.texCompETC2; break;
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: supported = RLGL.ExtSupported.texCompPVRT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: supported = RLGL.ExtSupported.texCompASTC; break;
+        default: break;
     }
 #endif
+
+    return supported;
 }
 
-// Unload vertex buffer (VBO)
-void rlUnloadVertexBuffer(unsigned int vboId)
+// Unload texture from GPU memory
+// NOTE: Deletion deferred until GPU is done with it if RLGL_ENABLE_DEFERRED_UNLOAD
+void rlUnloadTexture(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteBuffers(1, &vboId);
-    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    if (rlDeferUnload(RL_DEFERRED_TEXTURE, id)) return;
 #endif
+    rlDestroyTexture(id);
 }
 
-// Shaders management
-//-----------------------------------------------------------------------------------------------
-// Load shader from code strings
-// NOTE: If shader string is NULL, using default vertex/fragment shaders
-unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+// Delete texture from GPU memory (immediately)
+static void rlDestroyTexture(unsigned int id)
 {
-    unsigned int id = 0;
-
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int vertexShaderId = 0;
-    unsigned int fragmentShaderId = 0;
+    rlStateReleaseTexture(id);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, 0);
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlSetLayeredTexture(id, 0, 0);
+#endif
+    glDeleteTextures(1, &id);
+}
 
-    // Compile vertex shader (if provided)
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+// Generate mipmap data for selected texture
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+    rlStateBindTexture(id);
 
-    // Compile fragment shader (if provided)
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
-    // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
 
-    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
-    else
-    {
-        // One of or both shader are new, we need to compile a new shader program
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
 
-        // We can detach and delete vertex/fragment shaders (if not default ones)
-        // NOTE: We detach shader before deletion to make sure memory is freed
-        if (vertexShaderId != RLGL.State.defaultVShaderId)
-        {
-            glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+#if defined(GRAPHICS_API_OPENGL_11)
+    if (texIsPOT)
+    {
+        // WARNING: Manual mipmap generation only works for RGBA 32bit textures!
+        if (format == RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
         {
-            glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
-        }
+            // Retrieve texture data from VRAM
+            void *texData = rlReadTexturePixels(id, width, height, format);
 
-        // In case shader program loading failed, we assign default shader
-        if (id == 0)
-        {
-            // In case shader loading fails, we return the default shader
-            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
-            id = RLGL.State.defaultShaderId;
-        }
-        /*
-        else
-        {
-            // Get available shader uniforms
-            // NOTE: This information is useful for debug...
-            int uniformCount = -1;
-            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+            // NOTE: Texture data size is reallocated to fit mipmaps data
+            // NOTE: CPU mipmap generation only supports RGBA 32bit data
+            int mipmapCount = rlGenTextureMipmapsData((unsigned char **)&texData, width, height);
 
-            for (int i = 0; i < uniformCount; i++)
+            int size = width*height*4;
+            int offset = size;
+
+            int mipWidth = width/2;
+            int mipHeight = height/2;
+
+            // Load the mipmaps
+            for (int level = 1; level < mipmapCount; level++)
             {
-                int namelen = -1;
-                int num = -1;
-                char name[256] = { 0 };     // Assume no variable names longer than 256
-                GLenum type = GL_ZERO;
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mipWidth, mipHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char *)texData + offset);
 
-                // Get the name of the uniforms
-                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+                size = mipWidth*mipHeight*4;
+                offset += size;
 
-                name[namelen] = 0;
-                TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+                mipWidth /= 2;
+                mipHeight /= 2;
             }
+
+            *mipmaps = mipmapCount + 1;
+            RL_FREE(texData); // Once mipmaps have been generated and data has been uploaded to GPU VRAM, we can discard RAM data
+
+            TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps generated manually on CPU side, total: %i", id, *mipmaps);
         }
-        */
+        else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps for provided texture format", id);
     }
 #endif
-
-    return id;
-}
-
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
-{
-    unsigned int shader = 0;
-
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    shader = glCreateShader(type);
-    glShaderSource(shader, 1, &shaderCode, NULL);
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        // Texture arrays generate mipmaps per layer, 3D textures also halve depth per level
+        unsigned int target = GL_TEXTURE_2D;
+        int depth = 1;
+#if defined(GRAPHICS_API_OPENGL_33)
+        rlLayeredTexture layered = rlGetLayeredTexture(id);
+        if (layered.target != 0) { target = layered.target; depth = layered.depth; }
+#endif
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(target);    // Generate mipmaps automatically
 
-    GLint success = 0;
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);   // Activate Trilinear filtering for mipmaps
 
-    if (success == GL_FALSE)
-    {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
-        #endif
-            default: break;
-        }
+        #define MIN(a,b) (((a)<(b))?(a):(b))
+        #define MAX(a,b) (((a)>(b))?(a):(b))
 
-        int maxLength = 0;
-        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+        int maxSize = MAX(width, height);
+#if defined(GRAPHICS_API_OPENGL_33)
+        if (target == GL_TEXTURE_3D) maxSize = MAX(maxSize, depth);
+#endif
+        *mipmaps = 1 + (int)floor(log(maxSize)/log(2));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
 
-        if (maxLength > 0)
+        unsigned int size = 0;
+        for (int i = 0, mipWidth = width, mipHeight = height, mipDepth = depth; i < *mipmaps; i++, mipWidth = MAX(mipWidth/2, 1), mipHeight = MAX(mipHeight/2, 1))
         {
-            int length = 0;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetShaderInfoLog(shader, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
-            RL_FREE(log);
-        }
-    }
-    else
-    {
-        switch (type)
-        {
-            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
-            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
-            //case GL_GEOMETRY_SHADER:
-        #if defined(GRAPHICS_API_OPENGL_43)
-            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
-        #endif
-            default: break;
+            size += rlGetPixelDataSize(mipWidth, mipHeight, format)*mipDepth;
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (target == GL_TEXTURE_3D) mipDepth = MAX(mipDepth/2, 1);
+#endif
         }
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, size);
     }
 #endif
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    return shader;
+    rlStateBindTexture(0);
 }
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Generate mipmap data for cubemap texture
+// NOTE: Levels storage must be allocated (rlLoadTextureCubemapMipmaps()), only allocated levels are generated
+void rlGenTextureCubemapMipmaps(unsigned int id)
 {
-    unsigned int program = 0;
-
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    program = glCreateProgram();
-
-    glAttachShader(program, vShaderId);
-    glAttachShader(program, fShaderId);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+#endif
+}
 
-    // NOTE: Default attribute shader locations must be binded before linking
-    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    void *pixels = NULL;
 
-    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    rlStateBindTexture(id);
 
-    glLinkProgram(program);
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding.
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting.
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlGetPixelDataSize(width, height, format);
 
-    if (success == GL_FALSE)
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+        pixels = RL_MALLOC(size);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+    rlStateBindTexture(0);
+#endif
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // Texture width and height are required on OpenGL ES 2.0. There is no way to get it from texture id.
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    unsigned int fboId = rlLoadFramebuffer(width, height);
 
-        glDeleteProgram(program);
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlStateBindTexture(0);
 
-        program = 0;
-    }
-    else
-    {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
-    }
-#endif
-    return program;
-}
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = (unsigned char *)RL_MALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
-// Unload shader program
-void rlUnloadShaderProgram(unsigned int id)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glDeleteProgram(id);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+    // Clean up temporal fbo
+    rlUnloadFramebuffer(fboId);
 #endif
+
+    return pixels;
 }
 
-// Get shader location uniform
-int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+// Read texture cubemap pixel data, levels one after the other, every level with its 6 faces (+X, -X, +Y, -Y, +Z, -Z)
+// NOTE: Not supported on OpenGL ES 2.0 (glGetTexImage() not available)
+void *rlReadTextureCubemapPixels(unsigned int id, int size, int format, int mipmapCount)
 {
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetUniformLocation(shaderId, uniformName);
+    void *pixels = NULL;
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
-#endif
-    return location;
-}
+#if defined(GRAPHICS_API_OPENGL_33)
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-// Get shader location attribute
-int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
-{
-    int location = -1;
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    location = glGetAttribLocation(shaderId, attribName);
+    if ((glInternalFormat != -1) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        unsigned int dataSize = 0;
+        for (int level = 0, levelSize = size; level < mipmapCount; level++, levelSize = MAX(levelSize/2, 1)) dataSize += 6*rlGetPixelDataSize(levelSize, levelSize, format);
 
-    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
-    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
+        pixels = RL_MALLOC(dataSize);
+
+        if (pixels != NULL)
+        {
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+
+            unsigned char *levelData = (unsigned char *)pixels;
+
+            for (int level = 0, levelSize = size; level < mipmapCount; level++, levelSize = MAX(levelSize/2, 1))
+            {
+                unsigned int faceSize = rlGetPixelDataSize(levelSize, levelSize, format);
+
+                for (int face = 0; face < 6; face++) glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, glFormat, glType, levelData + face*faceSize);
+                levelData += 6*faceSize;
+            }
+
+            glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        }
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Cubemap data retrieval not supported for pixel format (%i)", id, format);
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Cubemap data retrieval not supported", id);
 #endif
-    return location;
-}
 
-// Set shader value uniform
-void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+    return pixels;
+}
+
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (uniformType)
+    unsigned char *screenData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, screenData);
+
+    // Flip image vertically!
+    unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4*sizeof(unsigned char));
+
+    for (int y = height - 1; y >= 0; y--)
     {
-        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
-        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
-        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+        for (int x = 0; x < (width*4); x++)
+        {
+            imgData[((height - 1) - y)*width*4 + x] = screenData[(y*width*4) + x];  // Flip line
+
+            // Set alpha component value to 255 (no trasparent image retrieval)
+            // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+            if (((x + 1)%4) == 0) imgData[((height - 1) - y)*width*4 + x] = 255;
+        }
     }
-#endif
+
+    RL_FREE(screenData);
+
+    return imgData;     // NOTE: image data should be freed
 }
 
-// Set shader value attribute
-void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+// Load pixel buffer for async screen readback (PBO)
+// NOTE: Pixel buffers require OpenGL 3.3, returns 0 if not supported (screen must be read with rlReadScreenPixels())
+unsigned int rlLoadPixelBuffer(int size)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    switch (attribType)
-    {
-        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
-        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
-        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
-    }
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, size);
+
+    if (id > 0) TRACELOG(RL_LOG_DEBUG, "PBO: [ID %i] Pixel buffer loaded successfully (%i bytes)", id, size);
 #endif
+
+    return id;
 }
 
-// Set shader value uniform matrix
-void rlSetUniformMatrix(int locIndex, Matrix mat)
+// Read screen pixel data into pixel buffer
+// NOTE: Read is queued on GPU and returns immediately, data is vertically flipped and includes alpha (see rlReadScreenPixels())
+void rlReadScreenPixelsToBuffer(unsigned int id, int width, int height)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 #endif
 }
 
-// Set shader value uniform sampler
-void rlSetUniformSampler(int locIndex, unsigned int textureId)
+// Map pixel buffer data for reading
+// NOTE: Waits for readback to finish, map it at least one frame after the read to avoid stalls
+void *rlMapPixelBuffer(unsigned int id, int size)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Check if texture is already active
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+    void *data = NULL;
 
-    // Register a new active texture for the internal batch system
-    // NOTE: Default texture is always activated as GL_TEXTURE0
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
-    {
-        if (RLGL.State.activeTextureId[i] == 0)
-        {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
-            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
-            break;
-        }
-    }
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 #endif
+
+    return data;
 }
 
-// Set shader currently active (id and locations)
-void rlSetShader(unsigned int id, int *locs)
+// Unmap pixel buffer data
+void rlUnmapPixelBuffer(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.State.currentShaderId != id)
-    {
-        rlDrawRenderBatch(RLGL.currentBatch);
-        RLGL.State.currentShaderId = id;
-        RLGL.State.currentShaderLocs = locs;
-    }
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 #endif
 }
 
-// Load compute shader program
-unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+// Unload pixel buffer
+void rlUnloadPixelBuffer(unsigned int id)
 {
-    unsigned int program = 0;
-
-#if defined(GRAPHICS_API_OPENGL_43)
-    GLint success = 0;
-    program = glCreateProgram();
-    glAttachShader(program, shaderId);
-    glLinkProgram(program);
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, 0);
+    glDeleteBuffers(1, &id);
+    TRACELOG(RL_LOG_DEBUG, "PBO: [ID %i] Unloaded pixel buffer from VRAM (GPU)", id);
+#endif
+}
 
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+// Load ids texture (32 bit unsigned integer per pixel) to be attached to fbo
+// NOTE: Integer textures require OpenGL 3.3, returns 0 if not supported (not available on OpenGL 2.1)
+unsigned int rlLoadTextureIds(int width, int height)
+{
+    unsigned int id = 0;
 
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glGenTextures(1, &id);
+    rlStateBindTexture(id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, width, height, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, NULL);
 
-    if (success == GL_FALSE)
-    {
-        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+    // NOTE: Integer textures can not be filtered
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        int maxLength = 0;
-        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+    rlStateBindTexture(0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, width*height*4);
 
-        if (maxLength > 0)
-        {
-            int length = 0;
-            char *log = RL_CALLOC(maxLength, sizeof(char));
-            glGetProgramInfoLog(program, maxLength, &length, log);
-            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
-            RL_FREE(log);
-        }
+    TRACELOG(RL_LOG_DEBUG, "TEXTURE: [ID %i] Ids texture loaded successfully (%ix%i)", id, width, height);
+#endif
 
-        glDeleteProgram(program);
+    return id;
+}
 
-        program = 0;
-    }
-    else
-    {
-        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
-        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
-        //GLint binarySize = 0;
-        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+// Clear active framebuffer ids color attachment and depth
+// NOTE: Integer color attachments are not cleared by glClear(), cleared id is 0
+void rlClearFramebufferIds(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    GLuint clearId[4] = { 0 };
+    GLfloat clearDepth = 1.0f;
 
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
-    }
+    glClearBufferuiv(GL_COLOR, 0, clearId);
+    glClearBufferfv(GL_DEPTH, 0, &clearDepth);
 #endif
-
-    return program;
 }
 
-// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
-void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+// Read active framebuffer ids (R32UI color attachment) into pixel buffer
+// NOTE: Read is queued on GPU and returns immediately, buffer receives 4 bytes per pixel (see rlMapPixelBuffer())
+void rlReadFramebufferIdsToBuffer(unsigned int id, int x, int y, int width, int height)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDispatchCompute(groupX, groupY, groupZ);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(x, y, width, height, GL_RED_INTEGER, GL_UNSIGNED_INT, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
 #endif
 }
 
-// Load shader storage buffer object (SSBO)
-unsigned int rlLoadShaderBuffer(unsigned long long size, const void *data, int usageHint)
+// Load texture upload buffer (PBO), mapped persistently so any thread can write pixel data into it
+// NOTE: Requires persistent mapped buffers (GL_ARB_buffer_storage), returns NULL if not supported (textures must be loaded from client memory)
+void *rlLoadUploadBuffer(unsigned int *id, int size)
 {
-    unsigned int ssbo = 0;
+    void *data = NULL;
+    *id = 0;
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glGenBuffers(1, &ssbo);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
-    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.bufferStorage)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glGenBuffers(1, id);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, *id);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, NULL, flags);
+        data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (data != NULL)
+        {
+            rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, *id, size);
+            TRACELOG(RL_LOG_DEBUG, "PBO: [ID %i] Upload buffer loaded successfully (%i bytes)", *id, size);
+        }
+        else
+        {
+            TRACELOG(RL_LOG_WARNING, "PBO: Failed to map upload buffer");
+            glDeleteBuffers(1, id);
+            *id = 0;
+        }
+    }
 #endif
 
-    return ssbo;
+    return data;
 }
 
-// Unload shader storage buffer object (SSBO)
-void rlUnloadShaderBuffer(unsigned int ssboId)
+// Unload texture upload buffer
+// WARNING: Transfers from the buffer must be finished (fence signaled)
+void rlUnloadUploadBuffer(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glDeleteBuffers(1, &ssboId);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, 0);
+    glDeleteBuffers(1, &id);
+    TRACELOG(RL_LOG_DEBUG, "PBO: [ID %i] Unloaded upload buffer from VRAM (GPU)", id);
 #endif
 }
 
-// Update SSBO buffer data
-void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsigned long long dataSize, unsigned long long offset)
+// Bind texture upload buffer, rlLoadTexture() and rlUpdateTexture() data pointers are offsets into it
+// NOTE: Transfer is queued on GPU and returns immediately, buffer data must not change until a fence inserted after it is signaled
+void rlBindUploadBuffer(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, id);
 #endif
 }
 
-// Get SSBO buffer size
-unsigned long long rlGetShaderBufferSize(unsigned int id)
+// Insert GPU fence, signaled once all previously queued commands are finished
+void *rlInsertFence(void)
 {
-    long long size = 0;
+    void *fence = NULL;
 
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (glFenceSync != NULL) fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 #endif
 
-    return (size > 0)? size : 0;
+    return fence;
 }
 
-// Read SSBO buffer data
-void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset)
+// Check if GPU fence is signaled, pending commands are flushed so it is eventually signaled
+// NOTE: NULL fence (not supported) is always signaled
+bool rlIsFenceSignaled(void *fence)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
-    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+    bool signaled = true;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (fence != NULL)
+    {
+        GLenum result = glClientWaitSync((GLsync)fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        signaled = (result != GL_TIMEOUT_EXPIRED);
+    }
 #endif
+
+    return signaled;
 }
 
-// Bind SSBO buffer
-void rlBindShaderBuffer(unsigned int id, unsigned int index)
+// Unload GPU fence
+void rlUnloadFence(void *fence)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (fence != NULL) glDeleteSync((GLsync)fence);
 #endif
 }
 
-// Copy SSBO buffer data
-void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count)
+// Delete unloaded GPU objects the GPU is done with, unloads requested since last call are fenced
+// NOTE: Called once per frame on GL thread, after frame commands are queued
+void rlProcessDeferredUnloads(void)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
-    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
-    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    RLGL.Unload.frame++;
+
+    rlDeferredUnload *unloads = rlTakeDeferredUnloads();
+
+    if (unloads != NULL)
+    {
+        if (RLGL.Unload.count == RLGL.Unload.capacity)
+        {
+            int capacity = (RLGL.Unload.capacity == 0)? 8 : RLGL.Unload.capacity*2;
+            rlUnloadGeneration *generations = (rlUnloadGeneration *)RL_REALLOC(RLGL.Unload.generations, capacity*sizeof(rlUnloadGeneration));
+
+            if (generations == NULL)
+            {
+                // No memory to wait for GPU, objects are deleted (driver defers the deletion)
+                rlDestroyDeferredUnloads(unloads);
+                unloads = NULL;
+            }
+            else
+            {
+                RLGL.Unload.generations = generations;
+                RLGL.Unload.capacity = capacity;
+            }
+        }
+
+        if (unloads != NULL)
+        {
+            rlUnloadGeneration *generation = &RLGL.Unload.generations[RLGL.Unload.count];
+            generation->unloads = unloads;
+            generation->fence = rlInsertFence();
+            generation->frame = RLGL.Unload.frame;
+            RLGL.Unload.count++;
+        }
+    }
+
+    // Generations are retired in order, fences are signaled in submission order
+    int retired = 0;
+
+    for (; retired < RLGL.Unload.count; retired++)
+    {
+        rlUnloadGeneration *generation = &RLGL.Unload.generations[retired];
+
+        bool done = (generation->fence != NULL)? rlIsFenceSignaled(generation->fence) :
+            ((RLGL.Unload.frame - generation->frame) >= RL_DEFERRED_UNLOAD_FRAMES);
+
+        if (!done) break;
+
+        rlUnloadFence(generation->fence);
+        rlDestroyDeferredUnloads(generation->unloads);
+    }
+
+    if (retired > 0)
+    {
+        RLGL.Unload.count -= retired;
+        memmove(RLGL.Unload.generations, RLGL.Unload.generations + retired, RLGL.Unload.count*sizeof(rlUnloadGeneration));
+    }
 #endif
 }
 
-// Bind image texture
-void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly)
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(int width, int height)
 {
-#if defined(GRAPHICS_API_OPENGL_43)
-    int glInternalFormat = 0, glFormat = 0, glType = 0;
+    unsigned int fboId = 0;
 
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
 #endif
+
+    return fboId;
 }
 
-// Matrix state management
-//-----------------------------------------------------------------------------------------
-// Get internal modelview matrix
-Matrix rlGetMatrixModelview(void)
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-Color, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
 {
-    Matrix matrix = rlMatrixIdentity();
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
-    matrix.m0 = mat[0];
-    matrix.m1 = mat[1];
-    matrix.m2 = mat[2];
-    matrix.m3 = mat[3];
-    matrix.m4 = mat[4];
-    matrix.m5 = mat[5];
-    matrix.m6 = mat[6];
-    matrix.m7 = mat[7];
-    matrix.m8 = mat[8];
-    matrix.m9 = mat[9];
-    matrix.m10 = mat[10];
-    matrix.m11 = mat[11];
-    matrix.m12 = mat[12];
-    matrix.m13 = mat[13];
-    matrix.m14 = mat[14];
-    matrix.m15 = mat[15];
-#else
-    matrix = RLGL.State.modelview;
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+
+        } break;
+        default: break;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
-    return matrix;
 }
 
-// Get internal projection matrix
-Matrix rlGetMatrixProjection(void)
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_11)
-    float mat[16];
-    glGetFloatv(GL_PROJECTION_MATRIX,mat);
-    Matrix m;
-    m.m0 = mat[0];
-    m.m1 = mat[1];
-    m.m2 = mat[2];
-    m.m3 = mat[3];
-    m.m4 = mat[4];
-    m.m5 = mat[5];
-    m.m6 = mat[6];
-    m.m7 = mat[7];
-    m.m8 = mat[8];
-    m.m9 = mat[9];
-    m.m10 = mat[10];
-    m.m11 = mat[11];
-    m.m12 = mat[12];
-    m.m13 = mat[13];
-    m.m14 = mat[14];
-    m.m15 = mat[15];
-    return m;
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Invalidate framebuffer attachments, their contents are undefined after the call
+// NOTE: Lets tiled GPUs skip storing attachments back to memory when they are not read again
+// (i.e. depth after a render pass or intermediate post-processing targets), no-op if not supported
+void rlInvalidateFramebuffer(unsigned int id, bool color, bool depth)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (!RLGL.ExtSupported.invalidateFramebuffer || (id == 0)) return;
+
+    GLenum attachments[2] = { 0 };
+    int count = 0;
+
+    if (color) attachments[count++] = GL_COLOR_ATTACHMENT0;
+    if (depth) attachments[count++] = GL_DEPTH_ATTACHMENT;
+    if (count == 0) return;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+#if defined(GRAPHICS_API_OPENGL_33)
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
 #else
-    return RLGL.State.projection;
+    glDiscardFramebuffer(GL_FRAMEBUFFER, count, attachments);
+#endif
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
 }
 
-// Get internal accumulated transform matrix
-Matrix rlGetMatrixTransform(void)
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted,
+// deletion deferred until GPU is done with it if RLGL_ENABLE_DEFERRED_UNLOAD
+void rlUnloadFramebuffer(unsigned int id)
 {
-    Matrix mat = rlMatrixIdentity();
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    if (rlDeferUnload(RL_DEFERRED_FRAMEBUFFER, id)) return;
+#endif
+    rlDestroyFramebuffer(id);
+}
+
+// Delete framebuffer and its depth attachment from GPU memory (immediately)
+static void rlDestroyFramebuffer(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER)
+    {
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_RENDERBUFFER, depthIdU, 0);
+        glDeleteRenderbuffers(1, &depthIdU);
+    }
+    else if (depthType == GL_TEXTURE)
+    {
+        rlStateReleaseTexture(depthIdU);
+        rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, depthIdU, 0);
+        glDeleteTextures(1, &depthIdU);
+    }
+
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer.
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#endif
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // TODO: Consider possible transform matrices in the RLGL.State.stack
-    // Is this the right order? or should we start with the first stored matrix instead of the last one?
-    //Matrix matStackTransform = rlMatrixIdentity();
-    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
-    mat = RLGL.State.transform;
+    glGenBuffers(1, &id);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, size);
 #endif
-    return mat;
+
+    return id;
 }
 
-// Get internal projection matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
 {
-    Matrix mat = rlMatrixIdentity();
+    unsigned int id = 0;
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.projectionStereo[eye];
+    glGenBuffers(1, &id);
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, size);
 #endif
-    return mat;
+
+    return id;
 }
 
-// Get internal view offset matrix for stereo render (selected eye)
-RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
 {
-    Matrix mat = rlMatrixIdentity();
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    mat = RLGL.State.viewOffsetStereo[eye];
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
 #endif
-    return mat;
 }
 
-// Set a custom modelview matrix (replaces internal modelview matrix)
-void rlSetMatrixModelview(Matrix view)
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.modelview = view;
+    rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
 #endif
 }
 
-// Set a custom projection matrix (replaces internal projection matrix)
-void rlSetMatrixProjection(Matrix projection)
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projection = projection;
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
 #endif
 }
 
-// Set eyes projection matrices for stereo rendering
-void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.projectionStereo[0] = right;
-    RLGL.State.projectionStereo[1] = left;
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 #endif
 }
 
-// Set eyes view offsets matrices for stereo rendering
-void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    RLGL.State.viewOffsetStereo[0] = right;
-    RLGL.State.viewOffsetStereo[1] = left;
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
 #endif
 }
 
-// Load and draw a quad in NDC
-void rlLoadDrawQuad(void)
+// Reallocate vertex buffer data store with new size
+// NOTE: Previous data store is orphaned, GPU keeps it alive until pending draws using it are completed
+void rlResizeVertexBuffer(unsigned int id, const void *data, int size, bool dynamic)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int quadVAO = 0;
-    unsigned int quadVBO = 0;
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, data, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, size);
+#endif
+}
 
-    float vertices[] = {
-         // Positions         Texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
-    };
+// Map vertex buffer data store for writing, previous data store is orphaned (invalidated)
+// NOTE: GPU keeps reading previous data for pending draws, so mapping never waits for it,
+// the whole buffer must be written before unmapping. Requires OpenGL 3.3, returns NULL if not supported
+void *rlMapVertexBuffer(unsigned int id, int size)
+{
+    void *data = NULL;
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
+    data = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+#endif
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &quadVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+    return data;
+}
 
-    // Bind vertex attributes (position, texcoords)
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+// Unmap vertex buffer data store
+void rlUnmapVertexBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, id);
+    if (glUnmapBuffer(GL_ARRAY_BUFFER) == GL_FALSE) TRACELOG(RL_LOG_WARNING, "VBO: [ID %i] Mapped buffer data was corrupted, it must be written again", id);
+#endif
+}
 
-    // Draw quad
-    glBindVertexArray(quadVAO);
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+// Upload per-draw instance data to internal instance stream buffer
+// NOTE: Uploads are appended into a ring buffer, when full the buffer is orphaned (and grown if required)
+// and writing restarts from the beginning, so the GPU reading previous draws data is never waited for
+unsigned int rlUpdateInstanceStream(const void *data, int dataSize, int *offset)
+{
+    unsigned int id = 0;
+    *offset = 0;
 
-    // Delete buffers (VBO and VAO)
-    glDeleteBuffers(1, &quadVBO);
-    glDeleteVertexArrays(1, &quadVAO);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int size = (dataSize + 15) & ~15;   // Keep uploads 16 bytes aligned
+
+    if (RLGL.State.instanceStreamId == 0)
+    {
+        RLGL.State.instanceStreamSize = (size > RL_DEFAULT_INSTANCE_STREAM_SIZE)? 2*size : RL_DEFAULT_INSTANCE_STREAM_SIZE;
+        RLGL.State.instanceStreamId = rlLoadVertexBuffer(NULL, RLGL.State.instanceStreamSize, true);
+        RLGL.State.instanceStreamOffset = 0;
+    }
+    else if ((RLGL.State.instanceStreamOffset + size) > RLGL.State.instanceStreamSize)
+    {
+        if (size > RLGL.State.instanceStreamSize) RLGL.State.instanceStreamSize = 2*size;
+
+        rlResizeVertexBuffer(RLGL.State.instanceStreamId, NULL, RLGL.State.instanceStreamSize, true);
+        RLGL.State.instanceStreamOffset = 0;
+    }
+
+    rlUpdateVertexBuffer(RLGL.State.instanceStreamId, data, dataSize, RLGL.State.instanceStreamOffset);
+
+    id = RLGL.State.instanceStreamId;
+    *offset = RLGL.State.instanceStreamOffset;
+    RLGL.State.instanceStreamOffset += size;
 #endif
+
+    return id;
 }
 
-// Load and draw a cube in NDC
-void rlLoadDrawCube(void)
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    unsigned int cubeVAO = 0;
-    unsigned int cubeVBO = 0;
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+#endif
+}
 
-    float vertices[] = {
-         // Positions          Normals               Texcoords
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
-        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
-         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
-        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
-        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
-    };
+// Enable vertex array object (VAO)
+bool rlEnableVertexArray(unsigned int vaoId)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlStateBindVertexArray(vaoId);
+        result = true;
+    }
+#endif
+    return result;
+}
 
-    // Gen VAO to contain VBO
-    glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+// Disable vertex array object (VAO)
+void rlDisableVertexArray(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+#endif
+}
 
-    // Gen and fill vertex buffer (VBO)
-    glGenBuffers(1, &cubeVBO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+// Enable vertex attribute index
+void rlEnableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glEnableVertexAttribArray(index);
+#endif
+}
 
-    // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+// Disable vertex attribute index
+void rlDisableVertexAttribute(unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDisableVertexAttribArray(index);
+#endif
+}
 
-    // Draw cube
-    glBindVertexArray(cubeVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+// Draw vertex array
+void rlDrawVertexArray(int offset, int count)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+    glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
 
-    // Delete VBO and VAO
-    glDeleteBuffers(1, &cubeVBO);
-    glDeleteVertexArrays(1, &cubeVAO);
+// Draw vertex array elements
+void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+    glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.current.drawCalls++;
 #endif
 }
 
-// Get name string for pixel format
-const char *rlGetPixelFormatName(unsigned int format)
+// Draw vertex array instanced
+void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
-    switch (format)
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+// Draw vertex array elements instanced
+void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+// Draw vertex array as lines
+void rlDrawVertexArrayLines(int offset, int count)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+    glDrawArrays(GL_LINES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+// Draw vertex array as lines instanced
+void rlDrawVertexArrayLinesInstanced(int offset, int count, int instances)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glDrawArraysInstanced(GL_LINES, offset, count, instances);
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+// Check if instanced drawing is supported
+bool rlIsInstancingSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.ExtSupported.instancing;
+#else
+    return false;
+#endif
+}
+
+// Draw vertex array with draw commands read from buffer (offset in bytes)
+// NOTE: Commands can be written by GPU (compute shaders), only supported on OpenGL 4.3
+void rlDrawVertexArrayIndirect(unsigned int commandId, int offset, int drawCount)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandId);
+    glMultiDrawArraysIndirect(GL_TRIANGLES, (const void *)(size_t)offset, drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+// Draw vertex array elements with draw commands read from buffer (offset in bytes)
+// NOTE: Commands can be written by GPU (compute shaders), only supported on OpenGL 4.3
+void rlDrawVertexArrayElementsIndirect(unsigned int commandId, int offset, int drawCount)
+{
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+    rlSyncDrawState();
+#endif
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandId);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)(size_t)offset, drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.Stats.current.drawCalls++;
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_11)
+// Enable vertex state pointer
+void rlEnableStatePointer(int vertexAttribType, void *buffer)
+{
+    if (buffer != NULL) glEnableClientState(vertexAttribType);
+    switch (vertexAttribType)
     {
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
-        default: return "UNKNOWN"; break;
+        case GL_VERTEX_ARRAY: glVertexPointer(3, GL_FLOAT, 0, buffer); break;
+        case GL_TEXTURE_COORD_ARRAY: glTexCoordPointer(2, GL_FLOAT, 0, buffer); break;
+        case GL_NORMAL_ARRAY: if (buffer != NULL) glNormalPointer(GL_FLOAT, 0, buffer); break;
+        case GL_COLOR_ARRAY: if (buffer != NULL) glColorPointer(4, GL_UNSIGNED_BYTE, 0, buffer); break;
+        //case GL_INDEX_ARRAY: if (buffer != NULL) glIndexPointer(GL_SHORT, 0, buffer); break; // Indexed colors
+        default: break;
+    }
+}
+
+// Disable vertex state pointer
+void rlDisableStatePointer(int vertexAttribType)
+{
+    glDisableClientState(vertexAttribType);
+}
+#endif
+
+// Load vertex array object (VAO)
+unsigned int rlLoadVertexArray(void)
+{
+    unsigned int vaoId = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        glGenVertexArrays(1, &vaoId);
+    }
+#endif
+    return vaoId;
+}
+
+// Set vertex attribute
+void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glVertexAttribPointer(index, compSize, type, normalized, stride, pointer);
+#endif
+}
+
+// Set vertex attribute divisor
+void rlSetVertexAttributeDivisor(unsigned int index, int divisor)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glVertexAttribDivisor(index, divisor);
+#endif
+}
+
+// Unload vertex array object (VAO)
+void rlUnloadVertexArray(unsigned int vaoId)
+{
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    if (rlDeferUnload(RL_DEFERRED_VERTEX_ARRAY, vaoId)) return;
+#endif
+    rlDestroyVertexArray(vaoId);
+}
+
+// Delete vertex array object (VAO) (immediately)
+static void rlDestroyVertexArray(unsigned int vaoId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.vao)
+    {
+        rlStateBindVertexArray(0);
+        glDeleteVertexArrays(1, &vaoId);
+        TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
+    }
+#endif
+}
+
+// Unload vertex buffer (VBO)
+void rlUnloadVertexBuffer(unsigned int vboId)
+{
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    if (rlDeferUnload(RL_DEFERRED_VERTEX_BUFFER, vboId)) return;
+#endif
+    rlDestroyVertexBuffer(vboId);
+}
+
+// Delete vertex buffer (VBO) (immediately)
+static void rlDestroyVertexBuffer(unsigned int vboId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateReleaseBuffer(vboId);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, vboId, 0);
+    glDeleteBuffers(1, &vboId);
+    //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
+#endif
+}
+
+// Shaders management
+//-----------------------------------------------------------------------------------------------
+// Load shader from code strings
+// NOTE: If shader string is NULL, using default vertex/fragment shaders
+unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int vertexShaderId = 0;
+    unsigned int fragmentShaderId = 0;
+
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    // Try loading program from cached binary, default shader is not reloaded
+    unsigned long long cacheKey = 0;
+    if ((vsCode != NULL) || (fsCode != NULL))
+    {
+        cacheKey = rlGetShaderCacheKey(vsCode, fsCode);
+        id = rlLoadShaderProgramCache(cacheKey);
+        if (id > 0) return id;
+    }
+#endif
+
+    // Compile vertex shader (if provided)
+    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
+    // In case no vertex shader was provided or compilation failed, we use default vertex shader
+    if (vertexShaderId == 0) vertexShaderId = rlGetDefaultShaderStage(GL_VERTEX_SHADER);
+
+    // Compile fragment shader (if provided)
+    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
+    // In case no fragment shader was provided or compilation failed, we use default fragment shader
+    if (fragmentShaderId == 0) fragmentShaderId = rlGetDefaultShaderStage(GL_FRAGMENT_SHADER);
+
+    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
+    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
+    else
+    {
+        // One of or both shader are new, we need to compile a new shader program
+        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        // We can detach and delete vertex/fragment shaders (if not default ones)
+        // NOTE: We detach shader before deletion to make sure memory is freed
+        if (vertexShaderId != RLGL.State.defaultVShaderId)
+        {
+            glDetachShader(id, vertexShaderId);
+            glDeleteShader(vertexShaderId);
+        }
+        if (fragmentShaderId != RLGL.State.defaultFShaderId)
+        {
+            glDetachShader(id, fragmentShaderId);
+            glDeleteShader(fragmentShaderId);
+        }
+
+        // In case shader program loading failed, we assign default shader
+        if (id == 0)
+        {
+            // In case shader loading fails, we return the default shader
+            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+            id = RLGL.State.defaultShaderId;
+        }
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+        else rlSaveShaderProgramCache(id, cacheKey);
+#endif
+        /*
+        else
+        {
+            // Get available shader uniforms
+            // NOTE: This information is useful for debug...
+            int uniformCount = -1;
+            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+            for (int i = 0; i < uniformCount; i++)
+            {
+                int namelen = -1;
+                int num = -1;
+                char name[256] = { 0 };     // Assume no variable names longer than 256
+                GLenum type = GL_ZERO;
+
+                // Get the name of the uniforms
+                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+
+                name[namelen] = 0;
+                TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+            }
+        }
+        */
+    }
+#endif
+
+    return id;
+}
+
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
+{
+    unsigned int shader = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    shader = rlCompileShaderAsync(shaderCode, type);
+    rlCheckShaderCompile(shader, type);
+#endif
+
+    return shader;
+}
+
+// Load shader from code strings without waiting for compilation and linking
+// NOTE: With parallel shader compilation support, program is compiled by driver threads meanwhile, program must be
+// finished with rlFinishShaderProgram() (once rlIsShaderProgramReady() to avoid waiting), cached programs are finished on return
+unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlPendingProgram *pending = NULL;
+
+    for (int i = 0; i < RL_MAX_PENDING_SHADER_PROGRAMS; i++)
+    {
+        if (RLGL.ShaderAsync.programs[i].id == 0)
+        {
+            pending = &RLGL.ShaderAsync.programs[i];
+            break;
+        }
+    }
+
+    // Pending programs limit reached, shader is loaded synchronously
+    if (pending == NULL) return rlLoadShaderCode(vsCode, fsCode);
+
+    unsigned long long cacheKey = 0;
+
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    // Try loading program from cached binary, default shader is not reloaded
+    if ((vsCode != NULL) || (fsCode != NULL))
+    {
+        cacheKey = rlGetShaderCacheKey(vsCode, fsCode);
+        id = rlLoadShaderProgramCache(cacheKey);
+        if (id > 0) return id;
+    }
+#endif
+
+    // Compile shaders (if provided), default shaders stages are used otherwise
+    unsigned int vertexShaderId = (vsCode != NULL)? rlCompileShaderAsync(vsCode, GL_VERTEX_SHADER) : rlGetDefaultShaderStage(GL_VERTEX_SHADER);
+    unsigned int fragmentShaderId = (fsCode != NULL)? rlCompileShaderAsync(fsCode, GL_FRAGMENT_SHADER) : rlGetDefaultShaderStage(GL_FRAGMENT_SHADER);
+
+    // In case vertex and fragment shader are the default ones, default shader program id is assigned
+    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) return RLGL.State.defaultShaderId;
+
+    id = rlCreateShaderProgram(vertexShaderId, fragmentShaderId);
+
+    pending->id = id;
+    pending->vShaderId = vertexShaderId;
+    pending->fShaderId = fragmentShaderId;
+    pending->cacheKey = cacheKey;
+#endif
+
+    return id;
+}
+
+// Check shader program loaded asynchronously is compiled and linked
+// NOTE: Without parallel shader compilation support, programs are always reported ready (finishing them waits for the driver)
+bool rlIsShaderProgramReady(unsigned int id)
+{
+    bool ready = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.parallelShaderCompile && (rlGetPendingProgram(id) != NULL))
+    {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(id, GL_COMPLETION_STATUS_KHR, &completed);
+        ready = (completed == GL_TRUE);
+    }
+#endif
+
+    return ready;
+}
+
+// Finish shader program loaded asynchronously: check compilation and linking, release shaders and cache program binary
+// NOTE: Waits for the driver if program is not ready, programs not pending (cached or default) are returned as is
+unsigned int rlFinishShaderProgram(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlPendingProgram *pending = rlGetPendingProgram(id);
+    if (pending == NULL) return id;
+
+    rlPendingProgram program = *pending;
+    memset(pending, 0, sizeof(rlPendingProgram));
+
+    if (program.vShaderId != RLGL.State.defaultVShaderId) rlCheckShaderCompile(program.vShaderId, GL_VERTEX_SHADER);
+    if (program.fShaderId != RLGL.State.defaultFShaderId) rlCheckShaderCompile(program.fShaderId, GL_FRAGMENT_SHADER);
+
+    rlReleaseShaderStages(id, program.vShaderId, program.fShaderId);
+
+    // In case shader program loading failed, we assign default shader
+    if (!rlCheckShaderProgramLink(id))
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+        id = RLGL.State.defaultShaderId;
+    }
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    else rlSaveShaderProgramCache(id, program.cacheKey);
+#endif
+#endif
+
+    return id;
+}
+
+// Set shader program binaries cache path prefix, NULL disables cache
+// NOTE: Path is used as file names prefix (i.e. "sdmc:/config/game/"), directory must exist
+void rlSetShaderCachePath(const char *path)
+{
+#if defined(RLGL_ENABLE_SHADER_CACHE) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    RLGL.ShaderCache.disabled = (path == NULL);
+    if (path != NULL) snprintf(RLGL.ShaderCache.path, sizeof(RLGL.ShaderCache.path), "%s", path);
+#endif
+}
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    program = rlCreateShaderProgram(vShaderId, fShaderId);
+
+    if (!rlCheckShaderProgramLink(program)) program = 0;
+#endif
+    return program;
+}
+
+// Reload shader program code in place, program id is kept (shaders referencing it are still valid)
+// NOTE: New code is validated on a temporary program first, current program is kept if it fails,
+// uniforms values are reset by relinking and locations could change
+bool rlReloadShaderCode(unsigned int id, const char *vsCode, const char *fsCode)
+{
+    bool success = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (id == RLGL.State.defaultShaderId)) return false;
+
+    unsigned int vertexShaderId = (vsCode != NULL)? rlCompileShader(vsCode, GL_VERTEX_SHADER) : RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = (fsCode != NULL)? rlCompileShader(fsCode, GL_FRAGMENT_SHADER) : RLGL.State.defaultFShaderId;
+
+    GLint compiled = GL_TRUE;
+    if (vsCode != NULL) glGetShaderiv(vertexShaderId, GL_COMPILE_STATUS, &compiled);
+    if ((compiled == GL_TRUE) && (fsCode != NULL)) glGetShaderiv(fragmentShaderId, GL_COMPILE_STATUS, &compiled);
+
+    unsigned int program = (compiled == GL_TRUE)? rlLoadShaderProgram(vertexShaderId, fragmentShaderId) : 0;
+
+    if (program > 0)
+    {
+        glDetachShader(program, vertexShaderId);
+        glDetachShader(program, fragmentShaderId);
+        glDeleteProgram(program);
+
+        // Replace program shaders and relink it, default attributes locations are kept from first link
+        GLuint attached[2] = { 0 };
+        GLsizei attachedCount = 0;
+        glGetAttachedShaders(id, 2, &attachedCount, attached);
+        for (int i = 0; i < attachedCount; i++) glDetachShader(id, attached[i]);
+
+        glAttachShader(id, vertexShaderId);
+        glAttachShader(id, fragmentShaderId);
+        glLinkProgram(id);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(id, GL_LINK_STATUS, &linked);
+        success = (linked == GL_TRUE);
+
+        // Default shaders are kept attached, as done on loading
+        if (vertexShaderId != RLGL.State.defaultVShaderId) glDetachShader(id, vertexShaderId);
+        if (fragmentShaderId != RLGL.State.defaultFShaderId) glDetachShader(id, fragmentShaderId);
+
+        // Uniforms values sent by batch are not valid anymore
+        rlStateReleaseProgramUniforms(id);
+
+        if (success) TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader reloaded successfully", id);
+        else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to relink shader program", id);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to reload shader code, program not changed", id);
+
+    if ((vertexShaderId != 0) && (vertexShaderId != RLGL.State.defaultVShaderId)) glDeleteShader(vertexShaderId);
+    if ((fragmentShaderId != 0) && (fragmentShaderId != RLGL.State.defaultFShaderId)) glDeleteShader(fragmentShaderId);
+#endif
+
+    return success;
+}
+
+// Unload shader program
+void rlUnloadShaderProgram(unsigned int id)
+{
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+    if (rlDeferUnload(RL_DEFERRED_SHADER_PROGRAM, id)) return;
+#endif
+    rlDestroyShaderProgram(id);
+}
+
+// Delete shader program (immediately)
+static void rlDestroyShaderProgram(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Program loaded asynchronously not finished, its shaders are released too
+    rlPendingProgram *pending = rlGetPendingProgram(id);
+
+    if (pending != NULL)
+    {
+        rlReleaseShaderStages(id, pending->vShaderId, pending->fShaderId);
+        memset(pending, 0, sizeof(rlPendingProgram));
+    }
+
+    rlStateReleaseProgram(id);
+    glDeleteProgram(id);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
+#endif
+}
+
+// Get shader location uniform
+int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    location = glGetUniformLocation(shaderId, uniformName);
+
+    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader uniform: %s", shaderId, uniformName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform (%s) set at location: %i", shaderId, uniformName, location);
+#endif
+    return location;
+}
+
+// Get shader location attribute
+int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    location = glGetAttribLocation(shaderId, attribName);
+
+    if (location == -1) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find shader attribute: %s", shaderId, attribName);
+    else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader attribute (%s) set at location: %i", shaderId, attribName, location);
+#endif
+    return location;
+}
+
+// Get shader active uniforms count
+int rlGetActiveUniformCount(unsigned int shaderId)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGetProgramiv(shaderId, GL_ACTIVE_UNIFORMS, &count);
+#endif
+    return count;
+}
+
+// Get shader active uniform name and array size, returns uniform location
+// NOTE: Uniforms inside uniform blocks have no location (-1), arrays names end with "[0]"
+int rlGetActiveUniform(unsigned int shaderId, int index, char *name, int nameSize, int *size)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    GLsizei length = 0;
+    GLint uniformSize = 0;
+    GLenum type = GL_ZERO;
+
+    glGetActiveUniform(shaderId, index, nameSize, &length, &uniformSize, &type, name);
+    if (length > 0) location = glGetUniformLocation(shaderId, name);
+    if (size != NULL) *size = uniformSize;
+#endif
+    return location;
+}
+
+// Get shader active attributes count
+int rlGetActiveAttribCount(unsigned int shaderId)
+{
+    int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGetProgramiv(shaderId, GL_ACTIVE_ATTRIBUTES, &count);
+#endif
+    return count;
+}
+
+// Get shader active attribute name and array size, returns attribute location
+int rlGetActiveAttrib(unsigned int shaderId, int index, char *name, int nameSize, int *size)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    GLsizei length = 0;
+    GLint attribSize = 0;
+    GLenum type = GL_ZERO;
+
+    glGetActiveAttrib(shaderId, index, nameSize, &length, &attribSize, &type, name);
+    if (length > 0) location = glGetAttribLocation(shaderId, name);
+    if (size != NULL) *size = attribSize;
+#endif
+    return location;
+}
+
+// Set shader value uniform
+void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlStateReleaseProgramUniforms(RLGL.Cache.program);  // Batch uniforms could be overwritten
+    switch (uniformType)
+    {
+        case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC2: glUniform2fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC3: glUniform3fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_VEC4: glUniform4fv(locIndex, count, (float *)value); break;
+        case RL_SHADER_UNIFORM_INT: glUniform1iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC2: glUniform2iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC3: glUniform3iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_IVEC4: glUniform4iv(locIndex, count, (int *)value); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: glUniform1iv(locIndex, count, (int *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set uniform value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value attribute
+void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    switch (attribType)
+    {
+        case RL_SHADER_ATTRIB_FLOAT: if (count == 1) glVertexAttrib1fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC2: if (count == 2) glVertexAttrib2fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC3: if (count == 3) glVertexAttrib3fv(locIndex, (float *)value); break;
+        case RL_SHADER_ATTRIB_VEC4: if (count == 4) glVertexAttrib4fv(locIndex, (float *)value); break;
+        default: TRACELOG(RL_LOG_WARNING, "SHADER: Failed to set attrib default value, data type not recognized");
+    }
+#endif
+}
+
+// Set shader value uniform matrix
+void rlSetUniformMatrix(int locIndex, Matrix mat)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float matfloat[16] = {
+        mat.m0, mat.m1, mat.m2, mat.m3,
+        mat.m4, mat.m5, mat.m6, mat.m7,
+        mat.m8, mat.m9, mat.m10, mat.m11,
+        mat.m12, mat.m13, mat.m14, mat.m15
+    };
+    rlStateReleaseProgramUniforms(RLGL.Cache.program);  // Batch uniforms could be overwritten
+    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+#endif
+}
+
+// Set shader value uniform matrices array
+// NOTE: Small arrays are converted on stack, bigger ones use a temporal buffer
+void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float stackfloat[16*16] = { 0 };
+    float *matfloat = (count > 16)? (float *)RL_MALLOC(count*16*sizeof(float)) : stackfloat;
+
+    for (int i = 0; i < count; i++)
+    {
+        float *f = &matfloat[i*16];
+
+        f[0] = mat[i].m0; f[1] = mat[i].m1; f[2] = mat[i].m2; f[3] = mat[i].m3;
+        f[4] = mat[i].m4; f[5] = mat[i].m5; f[6] = mat[i].m6; f[7] = mat[i].m7;
+        f[8] = mat[i].m8; f[9] = mat[i].m9; f[10] = mat[i].m10; f[11] = mat[i].m11;
+        f[12] = mat[i].m12; f[13] = mat[i].m13; f[14] = mat[i].m14; f[15] = mat[i].m15;
+    }
+
+    rlStateReleaseProgramUniforms(RLGL.Cache.program);  // Batch uniforms could be overwritten
+    glUniformMatrix4fv(locIndex, count, false, matfloat);
+
+    if (matfloat != stackfloat) RL_FREE(matfloat);
+#endif
+}
+
+// Set shader value uniform sampler
+void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Check if texture is already active
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) if (RLGL.State.activeTextureId[i] == textureId) return;
+
+    // Register a new active texture for the internal batch system
+    // NOTE: Default texture is always activated as GL_TEXTURE0
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.State.activeTextureId[i] == 0)
+        {
+            rlStateReleaseProgramUniforms(RLGL.Cache.program);  // Batch uniforms could be overwritten
+            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            break;
+        }
+    }
+#endif
+}
+
+// Set shader currently active (id and locations)
+void rlSetShader(unsigned int id, int *locs)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentShaderId != id)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.currentShaderId = id;
+        RLGL.State.currentShaderLocs = locs;
+    }
+#endif
+}
+
+// Load compute shader program
+unsigned int rlLoadComputeShaderProgram(unsigned int shaderId)
+{
+    unsigned int program = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    GLint success = 0;
+    program = glCreateProgram();
+    glAttachShader(program, shaderId);
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link compute shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+
+        program = 0;
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader program loaded successfully", program);
+    }
+#endif
+
+    return program;
+}
+
+// Dispatch compute shader (equivalent to *draw* for graphics pilepine)
+void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glDispatchCompute(groupX, groupY, groupZ);
+#endif
+}
+
+// Load uniform buffer object (UBO)
+// NOTE: Uniform blocks are only supported on OpenGL 3.3, returns 0 otherwise
+unsigned int rlLoadUniformBuffer(int size, const void *data, bool dynamic)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, id, size);
+#endif
+
+    return id;
+}
+
+// Unload uniform buffer object (UBO)
+void rlUnloadUniformBuffer(unsigned int uboId)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    rlStateReleaseBuffer(uboId);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, uboId, 0);
+    glDeleteBuffers(1, &uboId);
+#endif
+}
+
+// Update UBO buffer data
+void rlUpdateUniformBuffer(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, dataSize, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+#endif
+}
+
+// Bind UBO buffer to uniform block binding point, skipped if already bound
+void rlBindUniformBuffer(unsigned int id, unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (index < RL_MAX_STATE_CACHE_UNIFORM_BUFFERS)
+    {
+        if (RLGL.Cache.uniformBuffers[index] == id)
+        {
+            RLGL.Stats.current.stateChangesSkipped++;
+            return;
+        }
+
+        RLGL.Cache.uniformBuffers[index] = id;
+    }
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, index, id);
+#endif
+}
+
+// Get shader uniform block index, -1 if not found
+int rlGetLocationUniformBlock(unsigned int shaderId, const char *blockName)
+{
+    int location = -1;
+#if defined(GRAPHICS_API_OPENGL_33)
+    unsigned int index = glGetUniformBlockIndex(shaderId, blockName);
+
+    if (index != GL_INVALID_INDEX)
+    {
+        location = (int)index;
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Shader uniform block (%s) set at index: %i", shaderId, blockName, location);
+    }
+#endif
+    return location;
+}
+
+// Set shader uniform block binding point
+void rlSetUniformBlockBinding(unsigned int shaderId, int blockIndex, unsigned int bindingIndex)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (blockIndex >= 0) glUniformBlockBinding(shaderId, (unsigned int)blockIndex, bindingIndex);
+#endif
+}
+
+// Load shader storage buffer object (SSBO)
+unsigned int rlLoadShaderBuffer(unsigned long long size, const void *data, int usageHint)
+{
+    unsigned int ssbo = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glGenBuffers(1, &ssbo);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, ssbo, (unsigned int)size);
+#endif
+
+    return ssbo;
+}
+
+// Unload shader storage buffer object (SSBO)
+void rlUnloadShaderBuffer(unsigned int ssboId)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, ssboId, 0);
+    glDeleteBuffers(1, &ssboId);
+#endif
+}
+
+// Update SSBO buffer data
+void rlUpdateShaderBufferElements(unsigned int id, const void *data, unsigned long long dataSize, unsigned long long offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Get SSBO buffer size
+unsigned long long rlGetShaderBufferSize(unsigned int id)
+{
+    long long size = 0;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetInteger64v(GL_SHADER_STORAGE_BUFFER_SIZE, &size);
+#endif
+
+    return (size > 0)? size : 0;
+}
+
+// Read SSBO buffer data
+void rlReadShaderBufferElements(unsigned int id, void *dest, unsigned long long count, unsigned long long offset)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, count, dest);
+#endif
+}
+
+// Bind SSBO buffer
+void rlBindShaderBuffer(unsigned int id, unsigned int index)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, index, id);
+#endif
+}
+
+// Wait for compute shader SSBO writes before next SSBO reads, vertex attributes fetch or indirect commands from the same buffers
+void rlShaderBufferBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+#endif
+}
+
+// Copy SSBO buffer data
+void rlCopyBuffersElements(unsigned int destId, unsigned int srcId, unsigned long long destOffset, unsigned long long srcOffset, unsigned long long count)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, count);
+#endif
+}
+
+// Bind image texture
+void rlBindImageTexture(unsigned int id, unsigned int index, unsigned int format, int readonly)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    int glInternalFormat = 0, glFormat = 0, glType = 0;
+
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    glBindImageTexture(index, id, 0, 0, 0, readonly ? GL_READ_ONLY : GL_READ_WRITE, glInternalFormat);
+#endif
+}
+
+// Matrix state management
+//-----------------------------------------------------------------------------------------
+// Get internal modelview matrix
+Matrix rlGetMatrixModelview(void)
+{
+    Matrix matrix = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, mat);
+    matrix.m0 = mat[0];
+    matrix.m1 = mat[1];
+    matrix.m2 = mat[2];
+    matrix.m3 = mat[3];
+    matrix.m4 = mat[4];
+    matrix.m5 = mat[5];
+    matrix.m6 = mat[6];
+    matrix.m7 = mat[7];
+    matrix.m8 = mat[8];
+    matrix.m9 = mat[9];
+    matrix.m10 = mat[10];
+    matrix.m11 = mat[11];
+    matrix.m12 = mat[12];
+    matrix.m13 = mat[13];
+    matrix.m14 = mat[14];
+    matrix.m15 = mat[15];
+#else
+    matrix = RLGL.State.modelview;
+#endif
+    return matrix;
+}
+
+// Get internal projection matrix
+Matrix rlGetMatrixProjection(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11)
+    float mat[16];
+    glGetFloatv(GL_PROJECTION_MATRIX,mat);
+    Matrix m;
+    m.m0 = mat[0];
+    m.m1 = mat[1];
+    m.m2 = mat[2];
+    m.m3 = mat[3];
+    m.m4 = mat[4];
+    m.m5 = mat[5];
+    m.m6 = mat[6];
+    m.m7 = mat[7];
+    m.m8 = mat[8];
+    m.m9 = mat[9];
+    m.m10 = mat[10];
+    m.m11 = mat[11];
+    m.m12 = mat[12];
+    m.m13 = mat[13];
+    m.m14 = mat[14];
+    m.m15 = mat[15];
+    return m;
+#else
+    return RLGL.State.projection;
+#endif
+}
+
+// Get internal accumulated transform matrix
+Matrix rlGetMatrixTransform(void)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // TODO: Consider possible transform matrices in the RLGL.State.stack
+    // Is this the right order? or should we start with the first stored matrix instead of the last one?
+    //Matrix matStackTransform = rlMatrixIdentity();
+    //for (int i = RLGL.State.stackCounter; i > 0; i--) matStackTransform = rlMatrixMultiply(RLGL.State.stack[i], matStackTransform);
+    mat = RLGL.State.transform;
+#endif
+    return mat;
+}
+
+// Get internal projection matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.projectionStereo[eye];
+#endif
+    return mat;
+}
+
+// Get internal view offset matrix for stereo render (selected eye)
+RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye)
+{
+    Matrix mat = rlMatrixIdentity();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mat = RLGL.State.viewOffsetStereo[eye];
+#endif
+    return mat;
+}
+
+// Set a custom modelview matrix (replaces internal modelview matrix)
+void rlSetMatrixModelview(Matrix view)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.modelview = view;
+#endif
+}
+
+// Set a custom projection matrix (replaces internal projection matrix)
+void rlSetMatrixProjection(Matrix projection)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.projection = projection;
+#endif
+}
+
+// Set eyes projection matrices for stereo rendering
+void rlSetMatrixProjectionStereo(Matrix right, Matrix left)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.projectionStereo[0] = right;
+    RLGL.State.projectionStereo[1] = left;
+#endif
+}
+
+// Set eyes view offsets matrices for stereo rendering
+void rlSetMatrixViewOffsetStereo(Matrix right, Matrix left)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.viewOffsetStereo[0] = right;
+    RLGL.State.viewOffsetStereo[1] = left;
+#endif
+}
+
+// Load and draw a quad in NDC
+void rlLoadDrawQuad(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int quadVAO = 0;
+    unsigned int quadVBO = 0;
+
+    float vertices[] = {
+         // Positions         Texcoords
+        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &quadVAO);
+    rlStateBindVertexArray(quadVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &quadVBO);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), &vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, texcoords)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
+
+    // Draw quad
+    rlStateBindVertexArray(quadVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    rlStateBindVertexArray(0);
+
+    // Delete buffers (VBO and VAO)
+    rlStateReleaseBuffer(quadVBO);
+    glDeleteBuffers(1, &quadVBO);
+    glDeleteVertexArrays(1, &quadVAO);
+#endif
+}
+
+// Load and draw a cube in NDC
+void rlLoadDrawCube(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int cubeVAO = 0;
+    unsigned int cubeVBO = 0;
+
+    float vertices[] = {
+         // Positions          Normals               Texcoords
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f, -1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f, -1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f,  1.0f,  1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f, -1.0f,  1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+        -1.0f, -1.0f, -1.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+         1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+        -1.0f,  1.0f, -1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f
+    };
+
+    // Gen VAO to contain VBO
+    glGenVertexArrays(1, &cubeVAO);
+    rlStateBindVertexArray(cubeVAO);
+
+    // Gen and fill vertex buffer (VBO)
+    glGenBuffers(1, &cubeVBO);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    // Bind vertex attributes (position, normals, texcoords)
+    rlStateBindVertexArray(cubeVAO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(3*sizeof(float))); // Normals
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
+    rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
+    rlStateBindVertexArray(0);
+
+    // Draw cube
+    rlStateBindVertexArray(cubeVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    rlStateBindVertexArray(0);
+
+    // Delete VBO and VAO
+    rlStateReleaseBuffer(cubeVBO);
+    glDeleteBuffers(1, &cubeVBO);
+    glDeleteVertexArrays(1, &cubeVAO);
+#endif
+}
+
+// Get name string for pixel format
+const char *rlGetPixelFormatName(unsigned int format)
+{
+    switch (format)
+    {
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return "GRAYSCALE"; break;         // 8 bit per pixel (no alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return "GRAY_ALPHA"; break;       // 8*2 bpp (2 channels)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: return "R5G6B5"; break;               // 16 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: return "R8G8B8"; break;               // 24 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return "R5G5B5A1"; break;           // 16 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return "R4G4B4A4"; break;           // 16 bpp (4 bit alpha)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return "R8G8B8A8"; break;           // 32 bpp
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: return "R32"; break;                     // 32 bpp (1 channel - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: return "R32G32B32"; break;         // 32*3 bpp (3 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return "R32G32B32A32"; break;   // 32*4 bpp (4 channels - float)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R11G11B10F: return "R11G11B10F"; break;       // 32 bpp (3 channels - packed unsigned float)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: return "DXT1_RGB"; break;             // 4 bpp (no alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return "DXT1_RGBA"; break;           // 4 bpp (1 bit alpha)
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return "DXT3_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return "DXT5_RGBA"; break;           // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: return "ETC1_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: return "ETC2_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return "ETC2_RGBA"; break;       // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: return "PVRT_RGB"; break;             // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        default: return "UNKNOWN"; break;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+// Default fragment shader SDF shape coverage, replaces texel color for shape vertex (half width > 0)
+// NOTE: Rounded box distance, shapes are provided in screen pixel units so edges are anti-aliased over one pixel,
+// an outline band is kept inside the edge for thickness > 0; code is valid for GLSL 100, 120 and 330
+#define RL_SHADER_SDF_SHAPE_COVERAGE \
+    "    if (fragShape.x > 0.0)         \n" \
+    "    {                              \n" \
+    "        vec2 q = abs(fragTexCoord) - fragShape.xy + fragShape.z;                 \n" \
+    "        float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - fragShape.z;   \n" \
+    "        if (fragShape.w > 0.0) d = abs(d + 0.5*fragShape.w) - 0.5*fragShape.w;   \n" \
+    "        texelColor = vec4(1.0, 1.0, 1.0, clamp(0.5 - d, 0.0, 1.0));              \n" \
+    "    }                              \n"
+#else
+#define RL_SHADER_SDF_SHAPE_COVERAGE ""
+#endif
+
+// Load default shader (just vertex positioning and texture coloring)
+// NOTE: This shader program is used for internal buffers
+// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlLoadShaderDefault(void)
+{
+    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *defaultVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+  #if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    "attribute float vertexTexIndex;    \n"
+    "varying float fragTexIndex;        \n"
+  #endif
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "attribute vec4 vertexShape;        \n"
+    "varying vec4 fragShape;            \n"
+  #endif
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+  #if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    "in float vertexTexIndex;           \n"
+    "out float fragTexIndex;            \n"
+  #endif
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "in vec4 vertexShape;               \n"
+    "out vec4 fragShape;                \n"
+  #endif
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+  #if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    "attribute float vertexTexIndex;    \n"
+    "varying float fragTexIndex;        \n"
+  #endif
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "attribute vec4 vertexShape;        \n"
+    "varying vec4 fragShape;            \n"
+  #endif
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    "    fragTexIndex = vertexTexIndex; \n"
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "    fragShape = vertexShape;       \n"
+#endif
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    // Fragment shader selecting draw call texture by vertex texture index (multi-texture batching)
+    // NOTE: Samplers are selected by branching, dynamic sampler indexing is not supported by GLSL 100
+    const char *defaultFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexIndex;        \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "varying vec4 fragShape;            \n"
+  #endif
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexIndex < 0.5) texelColor = texture2D(texture0, fragTexCoord);      \n"
+    "    else if (fragTexIndex < 1.5) texelColor = texture2D(texture1, fragTexCoord); \n"
+    "    else if (fragTexIndex < 2.5) texelColor = texture2D(texture2, fragTexCoord); \n"
+    "    else texelColor = texture2D(texture3, fragTexCoord);                        \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTexIndex;             \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "in vec4 fragShape;                 \n"
+  #endif
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexIndex < 0.5) texelColor = texture(texture0, fragTexCoord);      \n"
+    "    else if (fragTexIndex < 1.5) texelColor = texture(texture1, fragTexCoord); \n"
+    "    else if (fragTexIndex < 2.5) texelColor = texture(texture2, fragTexCoord); \n"
+    "    else texelColor = texture(texture3, fragTexCoord);                        \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTexIndex;        \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "varying vec4 fragShape;            \n"
+  #endif
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D texture1;        \n"
+    "uniform sampler2D texture2;        \n"
+    "uniform sampler2D texture3;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor;               \n"
+    "    if (fragTexIndex < 0.5) texelColor = texture2D(texture0, fragTexCoord);      \n"
+    "    else if (fragTexIndex < 1.5) texelColor = texture2D(texture1, fragTexCoord); \n"
+    "    else if (fragTexIndex < 2.5) texelColor = texture2D(texture2, fragTexCoord); \n"
+    "    else texelColor = texture2D(texture3, fragTexCoord);                        \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+#else
+    // Fragment shader directly defined, no external file required
+    const char *defaultFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "varying vec4 fragShape;            \n"
+  #endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "in vec4 fragShape;                 \n"
+  #endif
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+  #if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    "varying vec4 fragShape;            \n"
+  #endif
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    RL_SHADER_SDF_SHAPE_COVERAGE
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+#endif  // RLGL_ENABLE_BATCH_MULTI_TEXTURE
+
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
+
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    // NOTE: If default program is loaded from cache, default vertex/fragment
+    // shaders are only compiled when required by some shader loading
+    unsigned long long cacheKey = rlGetShaderCacheKey(defaultVShaderCode, defaultFShaderCode);
+    RLGL.State.defaultShaderId = rlLoadShaderProgramCache(cacheKey);
+#endif
+
+    if (RLGL.State.defaultShaderId == 0)
+    {
+        // NOTE: Compiled vertex/fragment shaders are not deleted,
+        // they are kept for re-use as default shaders in case some shader loading fails
+        RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+        RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+        if (RLGL.State.defaultShaderId > 0) rlSaveShaderProgramCache(RLGL.State.defaultShaderId, cacheKey);
+#endif
+    }
+
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+
+        // Set default shader locations: uniform locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        // Set default shader additional samplers to texture slots 1..3, they are not changed afterwards
+        rlStateUseProgram(RLGL.State.defaultShaderId);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture1"), 1);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture2"), 2);
+        glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, "texture3"), 3);
+        rlStateUseProgram(0);
+#endif
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
+}
+
+// Load SDF text shader
+// NOTE: Default vertex shader is reused, fragment shader computes glyph coverage from distance field (alpha),
+// edge smoothing uses screen-space derivatives when available, a smoothing uniform otherwise (OpenGL ES 2.0)
+static void rlLoadShaderSdf(void)
+{
+    const char *sdfFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a;                       \n"
+    "    float smoothing = 0.7*length(vec2(dFdx(distance), dFdy(distance)));         \n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);       \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;           \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture(texture0, fragTexCoord).a;                         \n"
+    "    float smoothing = 0.7*length(vec2(dFdx(distance), dFdy(distance)));         \n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);       \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;             \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform float sdfSmoothing;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a;                       \n"
+    "    float alpha = smoothstep(0.5 - sdfSmoothing, 0.5 + sdfSmoothing, distance); \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;           \n"
+    "}                                  \n";
+#endif
+
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+    unsigned long long cacheKey = rlGetShaderCacheKey(RLGL.State.defaultVShaderCode, sdfFShaderCode);
+    RLGL.State.sdfShaderId = rlLoadShaderProgramCache(cacheKey);
+#endif
+
+    unsigned int fragmentShaderId = (RLGL.State.sdfShaderId == 0)? rlCompileShader(sdfFShaderCode, GL_FRAGMENT_SHADER) : 0;
+    if (fragmentShaderId > 0)
+    {
+        RLGL.State.sdfShaderId = rlLoadShaderProgram(rlGetDefaultShaderStage(GL_VERTEX_SHADER), fragmentShaderId);
+
+        if (RLGL.State.sdfShaderId > 0)
+        {
+            glDetachShader(RLGL.State.sdfShaderId, fragmentShaderId);
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+            rlSaveShaderProgramCache(RLGL.State.sdfShaderId, cacheKey);
+#endif
+        }
+        glDeleteShader(fragmentShaderId);
+    }
+
+    if (RLGL.State.sdfShaderId > 0)
+    {
+        RLGL.State.sdfShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.sdfShaderLocs[i] = -1;
+
+        // Same locations used by default shader on batch rendering
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexPosition");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexTexCoord");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexColor");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.sdfShaderId, "mvp");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShaderId, "colDiffuse");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShaderId, "texture0");
+
+        RLGL.State.sdfSmoothingLoc = glGetUniformLocation(RLGL.State.sdfShaderId, "sdfSmoothing");
+        RLGL.State.sdfSmoothing = -1.0f;
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF text shader loaded successfully", RLGL.State.sdfShaderId);
+    }
+    else
+    {
+        RLGL.State.sdfShaderFailed = true;
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load SDF text shader");
+    }
+}
+
+// Unload default shader
+// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
+static void rlUnloadShaderDefault(void)
+{
+    rlStateUseProgram(0);
+
+    // NOTE: Default shaders could have not been compiled (default program loaded from cache)
+    if (RLGL.State.defaultVShaderId > 0)
+    {
+        glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
+        glDeleteShader(RLGL.State.defaultVShaderId);
+    }
+    if (RLGL.State.defaultFShaderId > 0)
+    {
+        glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+        glDeleteShader(RLGL.State.defaultFShaderId);
+    }
+
+    glDeleteProgram(RLGL.State.defaultShaderId);
+
+    RL_FREE(RLGL.State.defaultShaderLocs);
+
+    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+
+    RLGL.State.defaultVShaderId = 0;
+    RLGL.State.defaultFShaderId = 0;
+}
+
+// Get default vertex/fragment shader id
+// NOTE: Default shaders are compiled on demand if default program was loaded from cache
+static unsigned int rlGetDefaultShaderStage(int type)
+{
+    if (type == GL_VERTEX_SHADER)
+    {
+        if (RLGL.State.defaultVShaderId == 0) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);
+        return RLGL.State.defaultVShaderId;
+    }
+    else
+    {
+        if (RLGL.State.defaultFShaderId == 0) RLGL.State.defaultFShaderId = rlCompileShader(RLGL.State.defaultFShaderCode, GL_FRAGMENT_SHADER);
+        return RLGL.State.defaultFShaderId;
+    }
+}
+
+// Compile shader without waiting for compilation, compile status is not queried
+// NOTE: Drivers compiling on their own threads (parallel shader compilation) are only waited by status queries
+static unsigned int rlCompileShaderAsync(const char *shaderCode, int type)
+{
+    unsigned int shader = glCreateShader(type);
+
+    glShaderSource(shader, 1, &shaderCode, NULL);
+    glCompileShader(shader);
+
+    return shader;
+}
+
+// Check shader compile status, errors are logged
+static bool rlCheckShaderCompile(unsigned int shader, int type)
+{
+    GLint success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile vertex shader code", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile fragment shader code", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to compile compute shader code", shader); break;
+        #endif
+            default: break;
+        }
+
+        int maxLength = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetShaderInfoLog(shader, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shader, log);
+            RL_FREE(log);
+        }
+    }
+    else
+    {
+        switch (type)
+        {
+            case GL_VERTEX_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Vertex shader compiled successfully", shader); break;
+            case GL_FRAGMENT_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Fragment shader compiled successfully", shader); break;
+            //case GL_GEOMETRY_SHADER:
+        #if defined(GRAPHICS_API_OPENGL_43)
+            case GL_COMPUTE_SHADER: TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Compute shader compiled successfully", shader); break;
+        #endif
+            default: break;
+        }
+    }
+
+    return (success == GL_TRUE);
+}
+
+// Create shader program and link it without waiting, link status is not queried
+static unsigned int rlCreateShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int program = glCreateProgram();
+
+    glAttachShader(program, vShaderId);
+    glAttachShader(program, fShaderId);
+
+    // NOTE: Default attribute shader locations must be binded before linking
+    glBindAttribLocation(program, 0, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    glBindAttribLocation(program, 1, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    glBindAttribLocation(program, 2, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX);
+#endif
+    // NOTE: Bone ids share location 6 with batch texture index, it's
+    // only used by the batch default shader, never by a skinning shader
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // NOTE: Vertex shape shares location 7 with bone weights, only used by the batch default shader
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_SHAPE);
+#endif
+
+    // NOTE: If some attrib name is no found on the shader, it locations becomes -1
+
+#if defined(RLGL_ENABLE_SHADER_CACHE) && defined(GRAPHICS_API_OPENGL_33) && !defined(__APPLE__)
+    // Let driver know program binary will be retrieved (cached)
+    if (RLGL.ExtSupported.programBinary && (glProgramParameteri != NULL)) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
+    glLinkProgram(program);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    return program;
+}
+
+// Check shader program link status, errors are logged and program is deleted if failed
+static bool rlCheckShaderProgramLink(unsigned int program)
+{
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to link shader program", program);
+
+        int maxLength = 0;
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+
+        if (maxLength > 0)
+        {
+            int length = 0;
+            char *log = RL_CALLOC(maxLength, sizeof(char));
+            glGetProgramInfoLog(program, maxLength, &length, log);
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", program, log);
+            RL_FREE(log);
+        }
+
+        glDeleteProgram(program);
+    }
+    else
+    {
+        // Get the size of compiled shader program (not available on OpenGL ES 2.0)
+        // NOTE: If GL_LINK_STATUS is GL_FALSE, program binary length is zero.
+        //GLint binarySize = 0;
+        //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", program);
+    }
+
+    return (success == GL_TRUE);
+}
+
+// Detach and delete program shaders, default shader stages are kept
+// NOTE: We detach shader before deletion to make sure memory is freed
+static void rlReleaseShaderStages(unsigned int program, unsigned int vShaderId, unsigned int fShaderId)
+{
+    if (vShaderId != RLGL.State.defaultVShaderId)
+    {
+        glDetachShader(program, vShaderId);
+        glDeleteShader(vShaderId);
+    }
+    if (fShaderId != RLGL.State.defaultFShaderId)
+    {
+        glDetachShader(program, fShaderId);
+        glDeleteShader(fShaderId);
+    }
+}
+
+// Get shader program loaded asynchronously not finished yet, NULL if not pending
+static rlPendingProgram *rlGetPendingProgram(unsigned int id)
+{
+    if (id == 0) return NULL;
+
+    for (int i = 0; i < RL_MAX_PENDING_SHADER_PROGRAMS; i++)
+    {
+        if (RLGL.ShaderAsync.programs[i].id == id) return &RLGL.ShaderAsync.programs[i];
+    }
+
+    return NULL;
+}
+
+#if defined(RLGL_ENABLE_DEFERRED_UNLOAD)
+// Queue GPU object deletion, lock-free push so unloads can be requested from any thread
+static bool rlDeferUnload(int type, unsigned int id)
+{
+    if (id == 0) return true;
+
+    rlDeferredUnload *unload = (rlDeferredUnload *)RL_MALLOC(sizeof(rlDeferredUnload));
+    if (unload == NULL) return false;
+
+    unload->type = type;
+    unload->id = id;
+
+#if defined(_MSC_VER)
+    void *head = NULL;
+    do
+    {
+        head = RLGL.Unload.queue;
+        unload->next = (rlDeferredUnload *)head;
+    } while (_InterlockedCompareExchangePointer((void *volatile *)&RLGL.Unload.queue, unload, head) != head);
+#else
+    rlDeferredUnload *head = __atomic_load_n(&RLGL.Unload.queue, __ATOMIC_RELAXED);
+    do unload->next = head;
+    while (!__atomic_compare_exchange_n(&RLGL.Unload.queue, &head, unload, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#endif
+
+    return true;
+}
+
+// Take all queued unloads, queue is emptied
+static rlDeferredUnload *rlTakeDeferredUnloads(void)
+{
+#if defined(_MSC_VER)
+    return (rlDeferredUnload *)_InterlockedExchangePointer((void *volatile *)&RLGL.Unload.queue, NULL);
+#else
+    return __atomic_exchange_n(&RLGL.Unload.queue, NULL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// Delete unloads list objects and free list nodes
+static void rlDestroyDeferredUnloads(rlDeferredUnload *unloads)
+{
+    while (unloads != NULL)
+    {
+        rlDeferredUnload *next = unloads->next;
+
+        switch (unloads->type)
+        {
+            case RL_DEFERRED_TEXTURE: rlDestroyTexture(unloads->id); break;
+            case RL_DEFERRED_FRAMEBUFFER: rlDestroyFramebuffer(unloads->id); break;
+            case RL_DEFERRED_VERTEX_ARRAY: rlDestroyVertexArray(unloads->id); break;
+            case RL_DEFERRED_VERTEX_BUFFER: rlDestroyVertexBuffer(unloads->id); break;
+            case RL_DEFERRED_SHADER_PROGRAM: rlDestroyShaderProgram(unloads->id); break;
+            default: break;
+        }
+
+        RL_FREE(unloads);
+        unloads = next;
+    }
+}
+#endif
+
+#if defined(RLGL_ENABLE_SHADER_CACHE)
+// Hash shader code string (FNV-1a, NULL hashed as empty)
+static unsigned long long rlHashShaderCode(unsigned long long hash, const char *text)
+{
+    if (text != NULL)
+    {
+        for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+        {
+            hash ^= *c;
+            hash *= 0x100000001B3ULL;
+        }
+    }
+
+    // String terminator is hashed too, so ("ab", "c") and ("a", "bc") keys differ
+    hash ^= 0xFF;
+    hash *= 0x100000001B3ULL;
+
+    return hash;
+}
+
+// Get shader program cache key (code and driver)
+// NOTE: Driver strings are hashed, binaries are rejected by a different driver anyway but it avoids reloading them
+static unsigned long long rlGetShaderCacheKey(const char *vsCode, const char *fsCode)
+{
+    if (RLGL.ShaderCache.driverHash == 0)
+    {
+        unsigned long long hash = 0xCBF29CE484222325ULL;
+        hash = rlHashShaderCode(hash, (const char *)glGetString(GL_VENDOR));
+        hash = rlHashShaderCode(hash, (const char *)glGetString(GL_RENDERER));
+        hash = rlHashShaderCode(hash, (const char *)glGetString(GL_VERSION));
+        RLGL.ShaderCache.driverHash = hash;
+    }
+
+    unsigned long long key = rlHashShaderCode(RLGL.ShaderCache.driverHash, vsCode);
+    key = rlHashShaderCode(key, fsCode);
+
+    return key;
+}
+
+// Load shader program from cached binary, 0 on miss
+// NOTE: Cache file: "RLSC" + key (8 bytes) + binary format (4 bytes) + binary size (4 bytes) + binary data
+static unsigned int rlLoadShaderProgramCache(unsigned long long key)
+{
+    unsigned int program = 0;
+
+    if (!RLGL.ExtSupported.programBinary || RLGL.ShaderCache.disabled) return program;
+
+    char fileName[600] = { 0 };
+    snprintf(fileName, sizeof(fileName), "%sshader_%016llx.rlsc", (RLGL.ShaderCache.path[0] != '\0')? RLGL.ShaderCache.path : RL_DEFAULT_SHADER_CACHE_PATH, key);
+
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) return program;
+
+    char magic[4] = { 0 };
+    unsigned long long fileKey = 0;
+    unsigned int format = 0;
+    unsigned int size = 0;
+
+    if ((fread(magic, 1, 4, file) == 4) && (memcmp(magic, "RLSC", 4) == 0) &&
+        (fread(&fileKey, sizeof(fileKey), 1, file) == 1) && (fileKey == key) &&
+        (fread(&format, sizeof(format), 1, file) == 1) && (fread(&size, sizeof(size), 1, file) == 1) && (size > 0))
+    {
+        void *binary = RL_MALLOC(size);
+
+        if (fread(binary, 1, size, file) == size)
+        {
+            program = glCreateProgram();
+            glProgramBinary(program, format, binary, size);
+
+            // NOTE: Program binary could be rejected by driver (i.e. driver updated), it's compiled again
+            GLint success = 0;
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+            if (success == GL_FALSE)
+            {
+                glDeleteProgram(program);
+                program = 0;
+                TRACELOG(RL_LOG_INFO, "SHADER: [%s] Cached program binary rejected by driver", fileName);
+            }
+            else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program loaded successfully from cache", program);
+        }
+
+        RL_FREE(binary);
+    }
+
+    fclose(file);
+
+    return program;
+}
+
+// Save linked shader program binary to cache
+static void rlSaveShaderProgramCache(unsigned int id, unsigned long long key)
+{
+    if (!RLGL.ExtSupported.programBinary || RLGL.ShaderCache.disabled) return;
+
+    #ifndef GL_PROGRAM_BINARY_LENGTH
+        #define GL_PROGRAM_BINARY_LENGTH 0x8741
+    #endif
+    GLint size = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (size <= 0) return;
+
+    void *binary = RL_MALLOC(size);
+    GLenum format = 0;
+    GLsizei length = 0;
+    glGetProgramBinary(id, size, &length, &format, binary);
+
+    if (length > 0)
+    {
+        char fileName[600] = { 0 };
+        snprintf(fileName, sizeof(fileName), "%sshader_%016llx.rlsc", (RLGL.ShaderCache.path[0] != '\0')? RLGL.ShaderCache.path : RL_DEFAULT_SHADER_CACHE_PATH, key);
+
+        FILE *file = fopen(fileName, "wb");
+
+        if (file != NULL)
+        {
+            unsigned int binaryFormat = (unsigned int)format;
+            unsigned int binarySize = (unsigned int)length;
+
+            fwrite("RLSC", 1, 4, file);
+            fwrite(&key, sizeof(key), 1, file);
+            fwrite(&binaryFormat, sizeof(binaryFormat), 1, file);
+            fwrite(&binarySize, sizeof(binarySize), 1, file);
+            fwrite(binary, 1, length, file);
+            fclose(file);
+
+            TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program binary cached successfully", id);
+        }
+        else TRACELOG(RL_LOG_WARNING, "SHADER: [%s] Failed to write program binary cache", fileName);
+    }
+
+    RL_FREE(binary);
+}
+#endif  // RLGL_ENABLE_SHADER_CACHE
+
+// Set render batch vertex attributes for current shader locations
+// NOTE: Attributes setup is stored by current VAO (if supported)
+static void rlSetBatchVertexAttributes(const rlVertexBuffer *buffer)
+{
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    // All attributes are sourced from a single buffer, with a stride of one interleaved vertex
+    int stride = sizeof(rlVertexInterleaved);
+
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, stride, (void *)0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, stride, (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *)(5*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    // Vertex texture index is binded to a fixed location on all shaders (shader-location = 6)
+    glVertexAttribPointer(6, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride, (void *)(5*sizeof(float) + 4*sizeof(unsigned char)));
+    glEnableVertexAttribArray(6);
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // Vertex SDF shape is binded to a fixed location on all shaders (shader-location = 7)
+    glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, stride, (void *)(sizeof(rlVertexInterleaved) - 4*sizeof(float)));
+    glEnableVertexAttribArray(7);
+#endif
+#else
+    // Vertex position buffer (shader-location = 0)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    // Vertex texcoord buffer (shader-location = 1)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    // Vertex color buffer (shader-location = 3)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
+}
+
+// Draw render batch draw call, vertex and indices offsets of the draw on batch buffers
+// NOTE: Batch shader, uniforms and vertex array must be already set
+static void rlDrawRenderBatchDraw(const rlDrawCall *draw, int vertexOffset, int indexOffset)
+{
+    // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
+    rlStateBindTexture(draw->textureId);
+    RLGL.Stats.current.textureBinds++;
+    RLGL.Stats.current.drawCalls++;
+
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+    // Bind additional draw call textures, selected by vertex texture index on default shader
+    if (draw->textureCount > 0)
+    {
+        for (int j = 0; j < draw->textureCount; j++)
+        {
+            rlStateActiveTexture(1 + j);
+            rlStateBindTexture(draw->textureIds[j]);
+            RLGL.Stats.current.textureBinds++;
+        }
+
+        rlStateActiveTexture(0);
+    }
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    if (draw->mode == RL_LINES) glDrawArrays(GL_LINES, vertexOffset, draw->vertexCount);
+    else if (draw->indexCount > 0)
+    {
+        // NOTE: Draws indices are consecutive on index buffer, following draws order
+    #if defined(GRAPHICS_API_OPENGL_33)
+        glDrawElements(GL_TRIANGLES, draw->indexCount, GL_UNSIGNED_INT, (GLvoid *)(indexOffset*sizeof(GLuint)));
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        glDrawElements(GL_TRIANGLES, draw->indexCount, GL_UNSIGNED_SHORT, (GLvoid *)(indexOffset*sizeof(GLushort)));
+    #endif
+    }
+#else
+    if ((draw->mode == RL_LINES) || (draw->mode == RL_TRIANGLES)) glDrawArrays(draw->mode, vertexOffset, draw->vertexCount);
+    else
+    {
+#if defined(GRAPHICS_API_OPENGL_33)
+        // We need to define the number of indices to be processed: elementCount*6
+        // NOTE: The final parameter tells the GPU the offset in bytes from the
+        // start of the index buffer to the location of the first index to process
+        glDrawElements(GL_TRIANGLES, draw->vertexCount/4*6, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset/4*6*sizeof(GLuint)));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        glDrawElements(GL_TRIANGLES, draw->vertexCount/4*6, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset/4*6*sizeof(GLushort)));
+#endif
+    }
+#endif
+}
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+// Add triangle list indices for current primitive (rlBegin() mode) vertex, not yet indexed
+// NOTE: Quads, strips and fans are converted to triangles, lines are drawn without indices,
+// incomplete primitives (i.e. a quad with less than 4 vertex) are not drawn
+static void rlAddBatchIndices(void)
+{
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+    int first = RLGL.State.primitiveStart;
+    int count = RLGL.State.vertexCounter - first;
+    int index = RLGL.State.indexCounter;
+
+    switch (RLGL.State.primitiveMode)
+    {
+        case RL_QUADS:
+        {
+            for (int i = first; i <= (RLGL.State.vertexCounter - 4); i += 4)
+            {
+                buffer->indices[index++] = i;
+                buffer->indices[index++] = i + 1;
+                buffer->indices[index++] = i + 2;
+                buffer->indices[index++] = i;
+                buffer->indices[index++] = i + 2;
+                buffer->indices[index++] = i + 3;
+            }
+        } break;
+        case RL_TRIANGLES:
+        {
+            for (int i = first; i < (first + count - count%3); i++) buffer->indices[index++] = i;
+        } break;
+        case RL_TRIANGLE_STRIP:
+        {
+            // Odd triangles vertex order is swapped to keep strip winding
+            for (int i = 0; i < (count - 2); i++)
+            {
+                buffer->indices[index++] = first + i + (i%2);
+                buffer->indices[index++] = first + i + 1 - (i%2);
+                buffer->indices[index++] = first + i + 2;
+            }
+        } break;
+        case RL_TRIANGLE_FAN:
+        {
+            for (int i = 1; i < (count - 1); i++)
+            {
+                buffer->indices[index++] = first;
+                buffer->indices[index++] = first + i;
+                buffer->indices[index++] = first + i + 1;
+            }
+        } break;
+        default: break;
+    }
+
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].indexCount += (index - RLGL.State.indexCounter);
+    RLGL.State.indexCounter = index;
+    RLGL.State.primitiveStart = RLGL.State.vertexCounter;
+}
+#endif
+
+// Check draw calls limit before a new draw is started
+// NOTE: Draws array grows if RLGL_ENABLE_BATCH_GROWTH (up to RL_MAX_BATCH_DRAWCALLS), batch is drawn otherwise
+static void rlCheckRenderBatchDrawLimit(rlRenderBatch *batch)
+{
+    if (batch->drawCounter < batch->drawCapacity) return;
+
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+    if (batch->drawCapacity < RL_MAX_BATCH_DRAWCALLS)
+    {
+        int capacity = ((batch->drawCapacity*2) < RL_MAX_BATCH_DRAWCALLS)? batch->drawCapacity*2 : RL_MAX_BATCH_DRAWCALLS;
+        rlDrawCall *draws = (rlDrawCall *)RL_REALLOC(batch->draws, capacity*sizeof(rlDrawCall));
+
+        if (draws != NULL)
+        {
+            for (int i = batch->drawCapacity; i < capacity; i++)
+            {
+                memset(&draws[i], 0, sizeof(rlDrawCall));
+                draws[i].mode = RL_QUADS;
+                draws[i].textureId = RLGL.State.defaultTextureId;
+                draws[i].layer = RLGL.State.currentDrawLayer;
+                draws[i].opaque = RLGL.State.currentDrawOpaque;
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+                draws[i].blendMode = RLGL.State.currentDrawBlendMode;
+                memcpy(draws[i].scissor, RLGL.State.currentDrawScissor, 4*sizeof(int));
+#endif
+            }
+
+            batch->draws = draws;
+            batch->drawCapacity = capacity;
+            RLGL.Stats.current.batchGrowths++;
+            TRACELOG(RL_LOG_DEBUG, "RLGL: Render batch draw calls grown to %i", capacity);
+            return;
+        }
+    }
+#endif
+
+    rlDrawRenderBatch(batch);
+}
+
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+// Grow current render batch vertex buffer to fit the required vertex, doubling its capacity
+// NOTE: Vertex data already added is kept, GPU buffers storage is re-specified (same ids, VAO attributes still valid),
+// it fails if RL_MAX_BATCH_BUFFER_ELEMENTS is reached or buffer is persistently mapped (immutable storage)
+static bool rlGrowRenderBatch(rlRenderBatch *batch, int vCount)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int required = RLGL.State.vertexCounter + vCount;
+
+    if (buffer->mapped || (buffer->elementCount >= RL_MAX_BATCH_BUFFER_ELEMENTS)) return false;
+
+    int elementCount = buffer->elementCount;
+    while (((elementCount*4) <= required) && (elementCount < RL_MAX_BATCH_BUFFER_ELEMENTS)) elementCount *= 2;
+    if (elementCount > RL_MAX_BATCH_BUFFER_ELEMENTS) elementCount = RL_MAX_BATCH_BUFFER_ELEMENTS;
+    if ((elementCount*4) <= required) return false;
+
+    // Grow CPU (RAM) arrays, on failure grown arrays are kept but capacity is not updated
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    rlVertexInterleaved *vertices = (rlVertexInterleaved *)RL_REALLOC(buffer->vertices, elementCount*4*sizeof(rlVertexInterleaved));
+    if (vertices == NULL) return false;
+    buffer->vertices = vertices;
+#else
+    float *vertices = (float *)RL_REALLOC(buffer->vertices, elementCount*3*4*sizeof(float));
+    if (vertices == NULL) return false;
+    buffer->vertices = vertices;
+
+    float *texcoords = (float *)RL_REALLOC(buffer->texcoords, elementCount*2*4*sizeof(float));
+    if (texcoords == NULL) return false;
+    buffer->texcoords = texcoords;
+
+    unsigned char *colors = (unsigned char *)RL_REALLOC(buffer->colors, elementCount*4*4*sizeof(unsigned char));
+    if (colors == NULL) return false;
+    buffer->colors = colors;
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    int indexCount = elementCount*4*3;
+#else
+    int indexCount = elementCount*6;
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    unsigned int *indices = (unsigned int *)RL_REALLOC(buffer->indices, indexCount*sizeof(unsigned int));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *indices = (unsigned short *)RL_REALLOC(buffer->indices, indexCount*sizeof(unsigned short));
+#endif
+    if (indices == NULL) return false;
+    buffer->indices = indices;
+
+#if !defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Static quads indices for new elements
+    for (int j = 6*buffer->elementCount, k = buffer->elementCount; j < indexCount; j += 6, k++)
+    {
+        buffer->indices[j] = 4*k;
+        buffer->indices[j + 1] = 4*k + 1;
+        buffer->indices[j + 2] = 4*k + 2;
+        buffer->indices[j + 3] = 4*k;
+        buffer->indices[j + 4] = 4*k + 2;
+        buffer->indices[j + 5] = 4*k + 3;
+    }
+#endif
+
+    // Re-specify GPU (VRAM) buffers storage, vertex data is uploaded on batch drawing
+    // NOTE: Element buffer binding is vertex array state
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(buffer->vaoId);
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*4*sizeof(rlVertexInterleaved), NULL, GL_DYNAMIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, buffer->vboId[0], elementCount*4*sizeof(rlVertexInterleaved));
+#else
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[0]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[1]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[2]);
+    glBufferData(GL_ARRAY_BUFFER, elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, buffer->vboId[0], elementCount*3*4*sizeof(float));
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, buffer->vboId[1], elementCount*2*4*sizeof(float));
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, buffer->vboId[2], elementCount*4*4*sizeof(unsigned char));
+#endif
+
+    rlStateBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->vboId[3]);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount*sizeof(buffer->indices[0]), NULL, GL_DYNAMIC_DRAW);
+#else
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount*sizeof(buffer->indices[0]), buffer->indices, GL_STATIC_DRAW);
+#endif
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_BUFFER, buffer->vboId[3], indexCount*sizeof(buffer->indices[0]));
+
+    if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+
+    buffer->elementCount = elementCount;
+    RLGL.Stats.current.batchGrowths++;
+    TRACELOG(RL_LOG_DEBUG, "RLGL: Render batch vertex buffer grown to %i elements", elementCount);
+
+    return true;
+}
+#endif
+
+// Sort render batch draws by layer and merge consecutive compatible draws (same mode, texture and draw state)
+// NOTE: Sorting is stable, so submission order is kept within a layer; vertex data is reordered
+// to match new draws order, only required when some draw layer is lower than a previous one
+static void rlSortRenderBatchDraws(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    int drawCount = batch->drawCounter;
+    bool sorted = true;
+
+    for (int i = 1; i < drawCount; i++)
+    {
+        if ((batch->draws[i].vertexCount > 0) && (batch->draws[i].layer < batch->draws[i - 1].layer)) { sorted = false; break; }
+    }
+
+    if (sorted) return;
+
+    int mergedCount = 0;
+    int capacity = buffer->elementCount*4;
+
+    // Get scratch draws and vertex data buffer, it keeps the capacity of the largest batch sorted
+    // NOTE: Draws arrays are sized by draws counter, draws array can grow (RLGL_ENABLE_BATCH_GROWTH)
+    int drawsScratchSize = drawCount*(sizeof(rlDrawCall) + 3*sizeof(int));
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    int scratchSize = drawsScratchSize + capacity*sizeof(rlVertexInterleaved);
+#else
+    int scratchSize = drawsScratchSize + capacity*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Triangle list indices are reordered with vertex data, rebased to draws new vertex offsets
+    int indexScratchOffset = scratchSize;
+    scratchSize += capacity*3*sizeof(buffer->indices[0]);
+#endif
+    if (RLGL.State.drawSortBufferSize < scratchSize)
+    {
+        void *scratch = RL_REALLOC(RLGL.State.drawSortBuffer, scratchSize);
+        if (scratch == NULL) return;    // Keep submission order
+
+        RLGL.State.drawSortBuffer = scratch;
+        RLGL.State.drawSortBufferSize = scratchSize;
+    }
+
+    rlDrawCall *merged = (rlDrawCall *)RLGL.State.drawSortBuffer;
+    int *order = (int *)(merged + drawCount);
+    int *offsets = order + drawCount;
+    int *indexOffsets = offsets + drawCount;
+
+    // Stable insertion sort of draws indices by layer
+    for (int i = 0, vertexOffset = 0; i < drawCount; i++)
+    {
+        offsets[i] = vertexOffset;
+        vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        indexOffsets[i] = (i > 0)? (indexOffsets[i - 1] + batch->draws[i - 1].indexCount) : 0;
+#endif
+
+        int j = i;
+        while ((j > 0) && (batch->draws[order[j - 1]].layer > batch->draws[i].layer)) { order[j] = order[j - 1]; j--; }
+        order[j] = i;
+    }
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    rlVertexInterleaved *vertices = (rlVertexInterleaved *)(indexOffsets + drawCount);
+#else
+    float *vertices = (float *)(indexOffsets + drawCount);
+    float *texcoords = vertices + capacity*3;
+    unsigned char *colors = (unsigned char *)(texcoords + capacity*2);
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned short *indices = (unsigned short *)((unsigned char *)RLGL.State.drawSortBuffer + indexScratchOffset);
+#else
+    unsigned int *indices = (unsigned int *)((unsigned char *)RLGL.State.drawSortBuffer + indexScratchOffset);
+#endif
+    int indexCounter = 0;
+#endif
+
+    // Copy draws vertex data in sorted order, merging consecutive draws with same mode and texture
+    int vertexCounter = 0;
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[order[i]];
+        if (draw->vertexCount == 0) continue;
+
+        bool compatible = (mergedCount > 0) && (merged[mergedCount - 1].mode == draw->mode) && (merged[mergedCount - 1].textureId == draw->textureId) &&
+            (merged[mergedCount - 1].opaque == draw->opaque);
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+        if (compatible) compatible = (merged[mergedCount - 1].blendMode == draw->blendMode) &&
+            (memcmp(merged[mergedCount - 1].scissor, draw->scissor, 4*sizeof(int)) == 0);
+#endif
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        // Vertex texture indices refer to draw textures, they must match
+        if (compatible) compatible = (merged[mergedCount - 1].textureCount == draw->textureCount) &&
+            (memcmp(merged[mergedCount - 1].textureIds, draw->textureIds, draw->textureCount*sizeof(unsigned int)) == 0);
+#endif
+        if (compatible)
+        {
+            merged[mergedCount - 1].vertexCount += draw->vertexCount;
+            merged[mergedCount - 1].layer = draw->layer;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+            merged[mergedCount - 1].indexCount += draw->indexCount;
+#endif
+        }
+        else
+        {
+            if (mergedCount > 0)
+            {
+                // Previous draw alignment, next draw must start at a multiple of 4 vertex for QUADS indices
+                merged[mergedCount - 1].vertexAlignment = (4 - vertexCounter%4)%4;
+                vertexCounter += merged[mergedCount - 1].vertexAlignment;
+            }
+
+            merged[mergedCount] = *draw;
+            merged[mergedCount].vertexAlignment = 0;
+            mergedCount++;
+        }
+
+        // Alignment vertex could make reordered data exceed buffer capacity, keep submission order in that case
+        if ((vertexCounter + draw->vertexCount) > capacity) return;
+
+        int src = offsets[order[i]];
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        memcpy(vertices + vertexCounter, buffer->vertices + src, draw->vertexCount*sizeof(rlVertexInterleaved));
+#else
+        memcpy(vertices + 3*vertexCounter, buffer->vertices + 3*src, draw->vertexCount*3*sizeof(float));
+        memcpy(texcoords + 2*vertexCounter, buffer->texcoords + 2*src, draw->vertexCount*2*sizeof(float));
+        memcpy(colors + 4*vertexCounter, buffer->colors + 4*src, draw->vertexCount*4*sizeof(unsigned char));
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        for (int k = 0; k < draw->indexCount; k++) indices[indexCounter + k] = buffer->indices[indexOffsets[order[i]] + k] - src + vertexCounter;
+        indexCounter += draw->indexCount;
+#endif
+        vertexCounter += draw->vertexCount;
+    }
+
+    if (mergedCount == 0) return;
+
+    // Move reordered vertex data back to batch buffer (mapped or not) and replace draws
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    memcpy(buffer->vertices, vertices, vertexCounter*sizeof(rlVertexInterleaved));
+#else
+    memcpy(buffer->vertices, vertices, vertexCounter*3*sizeof(float));
+    memcpy(buffer->texcoords, texcoords, vertexCounter*2*sizeof(float));
+    memcpy(buffer->colors, colors, vertexCounter*4*sizeof(unsigned char));
+#endif
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    memcpy(buffer->indices, indices, indexCounter*sizeof(buffer->indices[0]));
+    RLGL.State.indexCounter = indexCounter;
+#endif
+    memcpy(batch->draws, merged, mergedCount*sizeof(rlDrawCall));
+
+    batch->drawCounter = mergedCount;
+    RLGL.State.vertexCounter = vertexCounter;
+}
+
+// Use shader program, skipped if already in use
+static void rlStateUseProgram(unsigned int id)
+{
+    if (RLGL.Cache.program == id) { RLGL.Stats.current.stateChangesSkipped++; return; }
+
+    glUseProgram(id);
+    RLGL.Cache.program = id;
+}
+
+// Set active texture unit, skipped if already active
+static void rlStateActiveTexture(unsigned int slot)
+{
+    if (RLGL.Cache.activeUnit == slot) { RLGL.Stats.current.stateChangesSkipped++; return; }
+
+    glActiveTexture(GL_TEXTURE0 + slot);
+    RLGL.Cache.activeUnit = slot;
+}
+
+// Bind vertex array, skipped if already bound
+// NOTE: Element buffer binding is vertex array state, it becomes unknown on vertex array change
+static void rlStateBindVertexArray(unsigned int id)
+{
+    if (RLGL.Cache.vao == id) { RLGL.Stats.current.stateChangesSkipped++; return; }
+
+    glBindVertexArray(id);
+    RLGL.Cache.vao = id;
+    RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;
+}
+
+// Bind array/element buffer, skipped if already bound
+// NOTE: Only GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER targets are cached
+static void rlStateBindBuffer(int target, unsigned int id)
+{
+    unsigned int *cached = NULL;
+
+    if (target == GL_ARRAY_BUFFER) cached = &RLGL.Cache.arrayBuffer;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) cached = &RLGL.Cache.elementBuffer;
+
+    if ((cached != NULL) && (*cached == id)) { RLGL.Stats.current.stateChangesSkipped++; return; }
+
+    glBindBuffer(target, id);
+    if (cached != NULL) *cached = id;
+}
+
+// Set blending factors and equation, skipped if already set
+static void rlStateSetBlendFunction(int srcFactor, int dstFactor, int equation)
+{
+    rlStateSetBlendFunctionSeparate(srcFactor, dstFactor, srcFactor, dstFactor, equation, equation);
+}
+
+// Set rgb and alpha blending factors and equations, skipped if already set
+// NOTE: Separate GL functions only used if rgb and alpha differ
+static void rlStateSetBlendFunctionSeparate(int srcRGB, int dstRGB, int srcAlpha, int dstAlpha, int eqRGB, int eqAlpha)
+{
+    if ((RLGL.Cache.blendSrcFactor != (unsigned int)srcRGB) || (RLGL.Cache.blendDstFactor != (unsigned int)dstRGB) ||
+        (RLGL.Cache.blendSrcFactorAlpha != (unsigned int)srcAlpha) || (RLGL.Cache.blendDstFactorAlpha != (unsigned int)dstAlpha))
+    {
+        if ((srcRGB == srcAlpha) && (dstRGB == dstAlpha)) glBlendFunc(srcRGB, dstRGB);
+        else glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+        RLGL.Cache.blendSrcFactor = srcRGB;
+        RLGL.Cache.blendDstFactor = dstRGB;
+        RLGL.Cache.blendSrcFactorAlpha = srcAlpha;
+        RLGL.Cache.blendDstFactorAlpha = dstAlpha;
+    }
+    else RLGL.Stats.current.stateChangesSkipped++;
+
+    if ((RLGL.Cache.blendEquation != (unsigned int)eqRGB) || (RLGL.Cache.blendEquationAlpha != (unsigned int)eqAlpha))
+    {
+        if (eqRGB == eqAlpha) glBlendEquation(eqRGB);
+        else glBlendEquationSeparate(eqRGB, eqAlpha);
+
+        RLGL.Cache.blendEquation = eqRGB;
+        RLGL.Cache.blendEquationAlpha = eqAlpha;
+    }
+    else RLGL.Stats.current.stateChangesSkipped++;
+}
+
+// Forget texture in state cache (texture deleted)
+// NOTE: OpenGL reverts deleted texture bindings to 0 on all texture units
+static void rlStateReleaseTexture(unsigned int id)
+{
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.Cache.textures[i] == id) RLGL.Cache.textures[i] = 0;
+    }
+}
+
+// Forget buffer in state cache (buffer deleted)
+static void rlStateReleaseBuffer(unsigned int id)
+{
+    if (RLGL.Cache.arrayBuffer == id) RLGL.Cache.arrayBuffer = 0;
+    if (RLGL.Cache.elementBuffer == id) RLGL.Cache.elementBuffer = 0;
+    for (int i = 0; i < RL_MAX_STATE_CACHE_UNIFORM_BUFFERS; i++) if (RLGL.Cache.uniformBuffers[i] == id) RLGL.Cache.uniformBuffers[i] = 0;
+}
+
+// Forget vertex array in state cache (vertex array deleted)
+static void rlStateReleaseVertexArray(unsigned int id)
+{
+    if (RLGL.Cache.vao == id)
+    {
+        RLGL.Cache.vao = 0;
+        RLGL.Cache.elementBuffer = RL_STATE_UNKNOWN;
+    }
+}
+
+// Forget shader program in state cache (program deleted)
+// NOTE: A deleted program in use stays in use until replaced, next glUseProgram() is always sent
+static void rlStateReleaseProgram(unsigned int id)
+{
+    if (RLGL.Cache.program == id) RLGL.Cache.program = RL_STATE_UNKNOWN;
+
+    rlStateReleaseProgramUniforms(id);
+}
+
+// Get batch uniforms sent to shader program, claims an entry if program not tracked
+// NOTE: Claimed entries are reset, all values are sent again on next batch draw
+static rlProgramUniforms *rlStateGetProgramUniforms(unsigned int id)
+{
+    for (int i = 0; i < RL_MAX_STATE_CACHE_PROGRAMS; i++)
+    {
+        if (RLGL.Cache.programUniforms[i].program == id) return &RLGL.Cache.programUniforms[i];
+    }
+
+    rlProgramUniforms *uniforms = &RLGL.Cache.programUniforms[RLGL.Cache.programUniformsNext];
+    RLGL.Cache.programUniformsNext = (RLGL.Cache.programUniformsNext + 1)%RL_MAX_STATE_CACHE_PROGRAMS;
+
+    memset(uniforms, 0, sizeof(rlProgramUniforms));
+    uniforms->program = id;
+
+    return uniforms;
+}
+
+// Forget batch uniforms sent to shader program (uniforms changed or program deleted)
+static void rlStateReleaseProgramUniforms(unsigned int id)
+{
+    for (int i = 0; i < RL_MAX_STATE_CACHE_PROGRAMS; i++)
+    {
+        if (RLGL.Cache.programUniforms[i].program == id) RLGL.Cache.programUniforms[i].program = 0;
+    }
+}
+
+// Track object data store size (video memory estimate), size 0 on unload
+// NOTE: Sizes are indexed by object id (ids are reused by OpenGL), objects resized keep their count
+static void rlTrackVideoMemory(int object, unsigned int id, unsigned int size)
+{
+    if (id == 0) return;
+
+    if (id >= RLGL.Memory.capacity[object])
+    {
+        if (size == 0) return;      // Object not tracked
+
+        unsigned int capacity = (RLGL.Memory.capacity[object] > 0)? RLGL.Memory.capacity[object]*2 : 256;
+        if (capacity <= id) capacity = id + 1;
+
+        unsigned int *sizes = (unsigned int *)RL_REALLOC(RLGL.Memory.sizes[object], capacity*sizeof(unsigned int));
+        if (sizes == NULL) return;
+
+        memset(sizes + RLGL.Memory.capacity[object], 0, (capacity - RLGL.Memory.capacity[object])*sizeof(unsigned int));
+        RLGL.Memory.sizes[object] = sizes;
+        RLGL.Memory.capacity[object] = capacity;
+    }
+
+    int type = (object == RL_MEMORY_OBJECT_BUFFER)? RL_MEMORY_BUFFERS : RL_MEMORY_TEXTURES;
+    rlMemoryStats *stats = &RLGL.Memory.stats[type];
+    unsigned int previous = RLGL.Memory.sizes[object][id];
+
+    if ((previous == 0) && (size > 0))
+    {
+        stats->objectCount++;
+        RLGL.Memory.loads[type]++;
+    }
+    else if ((previous > 0) && (size == 0))
+    {
+        stats->objectCount--;
+        RLGL.Memory.unloads[type]++;
+    }
+
+    stats->usedBytes += (long long)size - (long long)previous;
+    if (stats->usedBytes > stats->peakBytes) stats->peakBytes = stats->usedBytes;
+
+    RLGL.Memory.sizes[object][id] = size;
+}
+
+// Add multiple vertex to render batch, positions transformed by current matrix in a single pass (SSE/NEON if available)
+// NOTE: Vertex with 2 components use current batch depth, texcoords are optional (current texcoord used if NULL)
+static void rlVertexSpan(const float *vertices, int components, const float *texcoords, int count)
+{
+    if ((vertices == NULL) || (count <= 0)) return;
+
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlRecordingList != NULL)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (texcoords != NULL) { rlRecordingList->state.u = texcoords[2*i]; rlRecordingList->state.v = texcoords[2*i + 1]; }
+            rlRecordVertex(vertices[components*i], vertices[components*i + 1], (components == 3)? vertices[3*i + 2] : 0.0f, (components == 2));
+        }
+        return;
+    }
+#endif
+
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+#if defined(RLGL_ENABLE_BATCH_GROWTH)
+    if ((RLGL.State.vertexCounter + count) > buffer->elementCount*4) rlGrowRenderBatch(RLGL.currentBatch, count);
+#endif
+
+    // Span does not fit on current batch buffer, add vertex one by one (overflow reported same way)
+    if ((RLGL.State.vertexCounter + count) > buffer->elementCount*4)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (texcoords != NULL) rlTexCoord2f(texcoords[2*i], texcoords[2*i + 1]);
+            if (components == 3) rlVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]);
+            else rlVertex2f(vertices[2*i], vertices[2*i + 1]);
+        }
+        return;
+    }
+
+    float depth = RLGL.currentBatch->currentDepth;
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+    rlVertexInterleaved *dst = &buffer->vertices[RLGL.State.vertexCounter];
+    float *position = &dst->x;
+    const int stride = sizeof(rlVertexInterleaved)/sizeof(float);
+#else
+    float *position = &buffer->vertices[3*RLGL.State.vertexCounter];
+    const int stride = 3;
+#endif
+
+    // Add vertex positions, transformed if required
+    if (RLGL.State.transformRequired)
+    {
+        const Matrix mat = RLGL.State.transform;
+
+#if defined(RLGL_SIMD_SSE)
+        const __m128 col0 = _mm_set_ps(0.0f, mat.m2, mat.m1, mat.m0);
+        const __m128 col1 = _mm_set_ps(0.0f, mat.m6, mat.m5, mat.m4);
+        const __m128 col2 = _mm_set_ps(0.0f, mat.m10, mat.m9, mat.m8);
+        const __m128 col3 = _mm_set_ps(0.0f, mat.m14, mat.m13, mat.m12);
+
+        for (int i = 0; i < count; i++, position += stride)
+        {
+            const float *v = vertices + components*i;
+            __m128 result = _mm_add_ps(col3, _mm_mul_ps(col0, _mm_set1_ps(v[0])));
+            result = _mm_add_ps(result, _mm_mul_ps(col1, _mm_set1_ps(v[1])));
+            result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_set1_ps((components == 3)? v[2] : depth)));
+
+            // NOTE: Only 3 components stored, next vertex data must not be overwritten
+            _mm_storel_pi((__m64 *)position, result);
+            _mm_store_ss(position + 2, _mm_movehl_ps(result, result));
+        }
+#elif defined(RLGL_SIMD_NEON)
+        const float32x4_t col0 = { mat.m0, mat.m1, mat.m2, 0.0f };
+        const float32x4_t col1 = { mat.m4, mat.m5, mat.m6, 0.0f };
+        const float32x4_t col2 = { mat.m8, mat.m9, mat.m10, 0.0f };
+        const float32x4_t col3 = { mat.m12, mat.m13, mat.m14, 0.0f };
+
+        for (int i = 0; i < count; i++, position += stride)
+        {
+            const float *v = vertices + components*i;
+            float32x4_t result = vmlaq_n_f32(col3, col0, v[0]);
+            result = vmlaq_n_f32(result, col1, v[1]);
+            result = vmlaq_n_f32(result, col2, (components == 3)? v[2] : depth);
+
+            // NOTE: Only 3 components stored, next vertex data must not be overwritten
+            vst1_f32(position, vget_low_f32(result));
+            vst1q_lane_f32(position + 2, result, 2);
+        }
+#else
+        for (int i = 0; i < count; i++, position += stride)
+        {
+            const float *v = vertices + components*i;
+            float z = (components == 3)? v[2] : depth;
+
+            position[0] = mat.m0*v[0] + mat.m4*v[1] + mat.m8*z + mat.m12;
+            position[1] = mat.m1*v[0] + mat.m5*v[1] + mat.m9*z + mat.m13;
+            position[2] = mat.m2*v[0] + mat.m6*v[1] + mat.m10*z + mat.m14;
+        }
+#endif
+    }
+    else
+    {
+        for (int i = 0; i < count; i++, position += stride)
+        {
+            const float *v = vertices + components*i;
+            position[0] = v[0];
+            position[1] = v[1];
+            position[2] = (components == 3)? v[2] : depth;
+        }
+    }
+
+    // Add texcoords and current color
+    if (texcoords != NULL)
+    {
+        RLGL.State.texcoordx = texcoords[2*(count - 1)];
+        RLGL.State.texcoordy = texcoords[2*(count - 1) + 1];
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        float u = (texcoords != NULL)? texcoords[2*i] : RLGL.State.texcoordx;
+        float v = (texcoords != NULL)? texcoords[2*i + 1] : RLGL.State.texcoordy;
+
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED_VERTEX)
+        dst[i].u = u;
+        dst[i].v = v;
+        dst[i].r = RLGL.State.colorr;
+        dst[i].g = RLGL.State.colorg;
+        dst[i].b = RLGL.State.colorb;
+        dst[i].a = RLGL.State.colora;
+#if defined(RLGL_ENABLE_BATCH_MULTI_TEXTURE)
+        dst[i].texIndex = RLGL.State.texindex;
+#endif
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+        memcpy(dst[i].shape, RLGL.State.shape, sizeof(dst[i].shape));
+#endif
+#else
+        int index = RLGL.State.vertexCounter + i;
+
+        buffer->texcoords[2*index] = u;
+        buffer->texcoords[2*index + 1] = v;
+
+        buffer->colors[4*index] = RLGL.State.colorr;
+        buffer->colors[4*index + 1] = RLGL.State.colorg;
+        buffer->colors[4*index + 2] = RLGL.State.colorb;
+        buffer->colors[4*index + 3] = RLGL.State.colora;
+#endif
+    }
+
+    RLGL.State.vertexCounter += count;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count;
+}
+
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+// Record a command on current thread command list, storage grows if required
+static rlCommand *rlRecordCommand(int type, unsigned int value)
+{
+    rlCommandList *list = rlRecordingList;
+
+    // Command inside rlBegin()/rlEnd() block (i.e. rlSetTexture()), following vertex continue on a new draw
+    int continueMode = ((type != RL_COMMAND_DRAW) && (list->currentDraw >= 0))? (int)list->commands[list->currentDraw].value : -1;
+
+    if ((list->commandCount + 2) > list->commandCapacity)
+    {
+        int capacity = (list->commandCapacity > 0)? list->commandCapacity*2 : 64;
+        rlCommand *commands = (rlCommand *)RL_REALLOC(list->commands, capacity*sizeof(rlCommand));
+
+        if (commands == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow command list commands");
+            return NULL;
+        }
+
+        list->commands = commands;
+        list->commandCapacity = capacity;
+    }
+
+    rlCommand *command = &list->commands[list->commandCount];
+    memset(command, 0, sizeof(rlCommand));
+    command->type = type;
+    command->value = value;
+    list->commandCount++;
+
+    if (type != RL_COMMAND_DRAW)
+    {
+        list->currentDraw = -1;
+
+        if (continueMode >= 0)
+        {
+            rlCommand *draw = &list->commands[list->commandCount];
+            memset(draw, 0, sizeof(rlCommand));
+            draw->type = RL_COMMAND_DRAW;
+            draw->value = continueMode;
+            draw->offset = list->vertexCount;
+            list->currentDraw = list->commandCount;
+            list->commandCount++;
+        }
+    }
+
+    return command;
+}
+
+// Record a vertex on current thread command list draw, with current vertex attributes
+static void rlRecordVertex(float x, float y, float z, bool depth2d)
+{
+    rlCommandList *list = rlRecordingList;
+
+    if (list->currentDraw < 0) return;  // Vertex outside rlBegin()/rlEnd() block
+
+    if (list->vertexCount >= list->vertexCapacity)
+    {
+        int capacity = (list->vertexCapacity > 0)? list->vertexCapacity*2 : 1024;
+        rlCommandVertex *vertices = (rlCommandVertex *)RL_REALLOC(list->vertices, capacity*sizeof(rlCommandVertex));
+
+        if (vertices == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow command list vertex storage");
+            return;
+        }
+
+        list->vertices = vertices;
+        list->vertexCapacity = capacity;
+    }
+
+    rlCommandVertex *vertex = &list->vertices[list->vertexCount];
+    *vertex = list->state;
+    vertex->x = x;
+    vertex->y = y;
+    vertex->z = z;
+    vertex->depth2d = depth2d;
+    list->vertexCount++;
+
+    list->commands[list->currentDraw].count++;
+}
+
+// Reserve data on current thread command list storage (16 bytes aligned)
+// WARNING: Returned pointer is only valid until next reserve (storage could be moved)
+static void *rlReserveCommandListData(int size)
+{
+    rlCommandList *list = rlRecordingList;
+
+    int offset = (list->dataSize + 15) & ~15;
+
+    if ((offset + size) > list->dataCapacity)
+    {
+        int capacity = (list->dataCapacity > 0)? list->dataCapacity : 4096;
+        while (capacity < (offset + size)) capacity *= 2;
+
+        unsigned char *data = (unsigned char *)RL_REALLOC(list->data, capacity);
+
+        if (data == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow command list data storage");
+            return NULL;
+        }
+
+        list->data = data;
+        list->dataCapacity = capacity;
+    }
+
+    list->dataSize = offset + size;
+
+    return list->data + offset;
+}
+
+// Upload command list draws to retained vertex buffer
+// NOTE: Quads, strips and fans are converted to triangles, matrix commands are applied on vertex and
+// 2d vertex get the depth they would get on an empty render batch, draw layers are not considered
+static bool rlUploadCommandList(rlCommandList *list)
+{
+    static const int quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    // Check commands can be retained and compute retained vertex count
+    int vertexCount = 0;
+
+    for (int i = 0; i < list->commandCount; i++)
+    {
+        const rlCommand *command = &list->commands[i];
+
+        if ((command->type == RL_COMMAND_CALLBACK) ||
+            ((command->type == RL_COMMAND_MATRIX_MODE) && (command->value != RL_MODELVIEW))) return false;
+
+        if (command->type == RL_COMMAND_DRAW)
+        {
+            switch (command->value)
+            {
+                case RL_LINES: vertexCount += (command->count - command->count%2); break;
+                case RL_TRIANGLES: vertexCount += (command->count - command->count%3); break;
+                case RL_QUADS: vertexCount += command->count/4*6; break;
+                case RL_TRIANGLE_STRIP:
+                case RL_TRIANGLE_FAN: if (command->count > 2) vertexCount += (command->count - 2)*3; break;
+                default: break;
+            }
+        }
+    }
+
+    rlCommandVertex *vertices = NULL;
+
+    if (vertexCount > 0)
+    {
+        vertices = (rlCommandVertex *)RL_MALLOC(vertexCount*sizeof(rlCommandVertex));
+        if (vertices == NULL) return false;
+    }
+
+    // Replay matrix commands on a local matrix stack, transformations are computed by rlgl matrix functions
+    Matrix stack[RL_MAX_MATRIX_STACK_SIZE] = { 0 };
+    int stackCounter = 0;
+    Matrix matrix = rlMatrixIdentity();
+    Matrix *currentMatrix = RLGL.State.currentMatrix;
+    RLGL.State.currentMatrix = &matrix;
+
+    unsigned int textureId = 0;
+    float depth = -1.0f;
+    int offset = 0;
+
+    list->rangeCount = 0;
+    list->depthCount = 0;
+
+    for (int i = 0; i < list->commandCount; i++)
+    {
+        const rlCommand *command = &list->commands[i];
+
+        switch (command->type)
+        {
+            case RL_COMMAND_DRAW:
+            {
+                int count = 0;
+                switch (command->value)
+                {
+                    case RL_LINES: count = command->count - command->count%2; break;
+                    case RL_TRIANGLES: count = command->count - command->count%3; break;
+                    case RL_QUADS: count = command->count/4*6; break;
+                    case RL_TRIANGLE_STRIP:
+                    case RL_TRIANGLE_FAN: count = (command->count > 2)? (command->count - 2)*3 : 0; break;
+                    default: break;
+                }
+
+                for (int k = 0; k < count; k++)
+                {
+                    // Source vertex of retained vertex k (strips odd triangles order swapped to keep winding)
+                    int t = k/3, c = k%3;
+                    int index = k;
+                    if (command->value == RL_QUADS) index = (k/6)*4 + quadIndices[k%6];
+                    else if (command->value == RL_TRIANGLE_STRIP) index = (c == 0)? (t + t%2) : ((c == 1)? (t + 1 - t%2) : (t + 2));
+                    else if (command->value == RL_TRIANGLE_FAN) index = (c == 0)? 0 : (t + c);
+
+                    rlCommandVertex vertex = list->vertices[command->offset + index];
+                    float x = vertex.x, y = vertex.y, z = vertex.depth2d? depth : vertex.z;
+
+                    vertex.x = matrix.m0*x + matrix.m4*y + matrix.m8*z + matrix.m12;
+                    vertex.y = matrix.m1*x + matrix.m5*y + matrix.m9*z + matrix.m13;
+                    vertex.z = matrix.m2*x + matrix.m6*y + matrix.m10*z + matrix.m14;
+                    vertices[offset + k] = vertex;
+                }
+
+                depth += (1.0f/20000.0f);
+                list->depthCount++;
+
+                if (count == 0) break;
+
+                // Merge with previous range if compatible, otherwise add a new range
+                int mode = (command->value == RL_LINES)? RL_LINES : RL_TRIANGLES;
+                rlCommandRange *range = (list->rangeCount > 0)? &list->ranges[list->rangeCount - 1] : NULL;
+
+                if ((range != NULL) && (range->mode == mode) && (range->textureId == textureId)) range->count += count;
+                else
+                {
+                    if (list->rangeCount >= list->rangeCapacity)
+                    {
+                        int capacity = (list->rangeCapacity > 0)? list->rangeCapacity*2 : 16;
+                        rlCommandRange *ranges = (rlCommandRange *)RL_REALLOC(list->ranges, capacity*sizeof(rlCommandRange));
+
+                        if (ranges == NULL)
+                        {
+                            RLGL.State.currentMatrix = currentMatrix;
+                            RL_FREE(vertices);
+                            return false;
+                        }
+
+                        list->ranges = ranges;
+                        list->rangeCapacity = capacity;
+                    }
+
+                    range = &list->ranges[list->rangeCount];
+                    range->mode = mode;
+                    range->textureId = textureId;
+                    range->offset = offset;
+                    range->count = count;
+                    list->rangeCount++;
+                }
+
+                offset += count;
+            } break;
+            case RL_COMMAND_SET_TEXTURE: textureId = command->value; break;
+            case RL_COMMAND_PUSH_MATRIX: if (stackCounter < RL_MAX_MATRIX_STACK_SIZE) stack[stackCounter++] = matrix; break;
+            case RL_COMMAND_POP_MATRIX: if (stackCounter > 0) matrix = stack[--stackCounter]; break;
+            case RL_COMMAND_LOAD_IDENTITY: matrix = rlMatrixIdentity(); break;
+            case RL_COMMAND_TRANSLATE: rlTranslatef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_ROTATE: rlRotatef(command->params[0], command->params[1], command->params[2], command->params[3]); break;
+            case RL_COMMAND_SCALE: rlScalef(command->params[0], command->params[1], command->params[2]); break;
+            case RL_COMMAND_MULT_MATRIX: rlMultMatrixf((float *)(list->data + command->offset)); break;
+            default: break;
+        }
+    }
+
+    RLGL.State.currentMatrix = currentMatrix;
+
+    // Upload retained vertex, buffer storage is reused (orphaned) if big enough
+    if (vertexCount > 0)
+    {
+        if (RLGL.ExtSupported.vao) rlStateBindVertexArray(0);
+
+        if (vertexCount > list->vboCapacity)
+        {
+            if (list->vboId > 0) rlUnloadVertexBuffer(list->vboId);
+
+            list->vboId = rlLoadVertexBuffer(vertices, vertexCount*sizeof(rlCommandVertex), false);
+            list->vboCapacity = vertexCount;
+
+            // Vertex array attributes point to new buffer
+            if (RLGL.ExtSupported.vao)
+            {
+                if (list->vaoId == 0) list->vaoId = rlLoadVertexArray();
+
+                rlStateBindVertexArray(list->vaoId);
+                rlSetCommandListVertexAttributes(list);
+                rlStateBindVertexArray(0);
+            }
+        }
+        else
+        {
+            rlStateBindBuffer(GL_ARRAY_BUFFER, list->vboId);
+            glBufferData(GL_ARRAY_BUFFER, list->vboCapacity*sizeof(rlCommandVertex), NULL, GL_STATIC_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount*sizeof(rlCommandVertex), vertices);
+        }
+
+        rlStateBindBuffer(GL_ARRAY_BUFFER, 0);
     }
+
+    RL_FREE(vertices);
+
+    return true;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-// Load default shader (just vertex positioning and texture coloring)
-// NOTE: This shader program is used for internal buffers
-// NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlLoadShaderDefault(void)
+// Set retained vertex buffer attributes for current shader locations
+// NOTE: Attributes setup is stored by command list VAO (if supported)
+static void rlSetCommandListVertexAttributes(const rlCommandList *list)
 {
-    RLGL.State.defaultShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
-
-    // NOTE: All locations must be reseted to -1 (no location)
-    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.defaultShaderLocs[i] = -1;
+    int stride = sizeof(rlCommandVertex);
 
-    // Vertex shader directly defined, no external file required
-    const char *defaultVShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330                       \n"
-    "in vec3 vertexPosition;            \n"
-    "in vec2 vertexTexCoord;            \n"
-    "in vec4 vertexColor;               \n"
-    "out vec2 fragTexCoord;             \n"
-    "out vec4 fragColor;                \n"
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "attribute vec3 vertexPosition;     \n"
-    "attribute vec2 vertexTexCoord;     \n"
-    "attribute vec4 vertexColor;        \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
+    rlStateBindBuffer(GL_ARRAY_BUFFER, list->vboId);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, stride, (void *)0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, stride, (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] != -1)
+    {
+        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, stride, (void *)(5*sizeof(float)));
+        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+    }
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *)(8*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // Vertex SDF shape is binded to a fixed location on all shaders (shader-location = 7)
+    glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, stride, (void *)(8*sizeof(float) + 4*sizeof(unsigned char)));
+    glEnableVertexAttribArray(7);
 #endif
-    "uniform mat4 mvp;                  \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    fragTexCoord = vertexTexCoord; \n"
-    "    fragColor = vertexColor;       \n"
-    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
-    "}                                  \n";
+}
 
-    // Fragment shader directly defined, no external file required
-    const char *defaultFShaderCode =
-#if defined(GRAPHICS_API_OPENGL_21)
-    "#version 120                       \n"
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#elif defined(GRAPHICS_API_OPENGL_33)
-    "#version 330       \n"
-    "in vec2 fragTexCoord;              \n"
-    "in vec4 fragColor;                 \n"
-    "out vec4 finalColor;               \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
-    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
-    "}                                  \n";
-#endif
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    "#version 100                       \n"
-    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
-    "varying vec2 fragTexCoord;         \n"
-    "varying vec4 fragColor;            \n"
-    "uniform sampler2D texture0;        \n"
-    "uniform vec4 colDiffuse;           \n"
-    "void main()                        \n"
-    "{                                  \n"
-    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
-    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
-    "}                                  \n";
-#endif
+// Record command list submit or draw on current thread command list
+// NOTE: Call data is zero initialized, so it can be hashed (rlGetCommandListTileHashes())
+static void rlRecordCommandListCall(rlCommandList *list, int draw, Matrix transform, const float *tint)
+{
+    if (list == rlRecordingList)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Command list can not be submitted or drawn while recording itself");
+        return;
+    }
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    rlCommandListCall call;
+    memset(&call, 0, sizeof(rlCommandListCall));
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+    call.list = list;
+    call.version = list->version;
+    call.draw = draw;
+    call.transform = transform;
+    for (int i = 0; i < 4; i++) call.tint[i] = (tint != NULL)? tint[i] : 1.0f;
 
-    if (RLGL.State.defaultShaderId > 0)
+    rlRecordCommandCallback(rlReplayCommandListCall, &call, sizeof(rlCommandListCall));
+}
+
+// Submit or draw command list recorded by rlRecordCommandListCall()
+static void rlReplayCommandListCall(void *data)
+{
+    rlCommandListCall *call = (rlCommandListCall *)data;
+
+    if (call->draw) rlDrawCommandList(call->list, call->transform, call->tint);
+    else rlSubmitCommandList(call->list);
+}
+
+// Hash data bytes (FNV-1a)
+static unsigned int rlHashCommandData(unsigned int hash, const void *data, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (int i = 0; i < size; i++)
     {
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
 
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexPosition");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexTexCoord");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, "vertexColor");
+    return hash;
+}
 
-        // Set default shader locations: uniform locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.defaultShaderId, "mvp");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "colDiffuse");
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, "texture0");
+// Mix hash into tiles range hashes (inclusive range, empty if reversed)
+static void rlMixTileHashes(unsigned int *hashes, int tilesX, int x0, int y0, int x1, int y1, unsigned int hash)
+{
+    for (int y = y0; y <= y1; y++)
+    {
+        for (int x = x0; x <= x1; x++) hashes[y*tilesX + x] = (hashes[y*tilesX + x] ^ hash)*16777619u;
     }
-    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
+#endif
 
-// Unload default shader
-// NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
-static void rlUnloadShaderDefault(void)
+#if defined(RLGL_ENABLE_BATCH_BUFFER_RING) && defined(GRAPHICS_API_OPENGL_33)
+// Load vertex buffer with immutable storage and map it persistently into client memory
+// NOTE: Coherent mapping is used, CPU writes are visible to GPU without explicit flushes
+static void *rlLoadMappedBuffer(unsigned int *id, int size)
 {
-    glUseProgram(0);
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    glGenBuffers(1, id);
+    rlStateBindBuffer(GL_ARRAY_BUFFER, *id);
+    glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
 
-    glDeleteProgram(RLGL.State.defaultShaderId);
+    void *data = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+    if (data != NULL) memset(data, 0, size);
 
-    RL_FREE(RLGL.State.defaultShaderLocs);
+    return data;
+}
 
-    TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
+// Wait for GPU to release a batch vertex buffer (fence signaled)
+static void rlWaitBufferFence(rlVertexBuffer *buffer)
+{
+    GLenum result = GL_TIMEOUT_EXPIRED;
+
+    // NOTE: First wait flushes pending commands, so fence is guaranteed to be signaled eventually
+    GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+    while ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED) && (result != GL_WAIT_FAILED))
+    {
+        result = glClientWaitSync((GLsync)buffer->fence, waitFlags, 1000000);    // 1 ms timeout
+        waitFlags = 0;
+    }
+
+    if (result == GL_WAIT_FAILED) TRACELOG(RL_LOG_WARNING, "RLGL: Failed to wait for batch buffer fence");
+
+    glDeleteSync((GLsync)buffer->fence);
+    buffer->fence = NULL;
 }
+#endif
 
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
@@ -4501,9 +10090,9 @@ static char *rlGetCompressedFormatName(int format)
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_11)
-// Mipmaps data is generated after image data
+// Mipmaps data is generated after image data, data is reallocated to fit all mipmaps
 // NOTE: Only works with RGBA (4 bytes) data!
-static int rlGenTextureMipmapsData(unsigned char *data, int baseWidth, int baseHeight)
+static int rlGenTextureMipmapsData(unsigned char **data, int baseWidth, int baseHeight)
 {
     int mipmapCount = 1;                // Required mipmap levels count (including base level)
     int width = baseWidth;
@@ -4526,105 +10115,273 @@ static int rlGenTextureMipmapsData(unsigned char *data, int baseWidth, int baseH
     TRACELOGD("TEXTURE: Total mipmaps required: %i", mipmapCount);
     TRACELOGD("TEXTURE: Total size of data required: %i", size);
 
-    unsigned char *temp = RL_REALLOC(data, size);
+    unsigned char *temp = RL_REALLOC(*data, size);
 
-    if (temp != NULL) data = temp;
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to re-allocate required mipmaps memory");
+    if (temp != NULL) *data = temp;
+    else
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to re-allocate required mipmaps memory");
+        return 1;
+    }
 
+    // Generate mipmaps
+    // NOTE: Every mipmap is generated from previous level, stored right after it (RGBA - 4 bytes)
+    unsigned char *level = *data;
     width = baseWidth;
     height = baseHeight;
-    size = (width*height*4);    // RGBA: 4 bytes
-
-    // Generate mipmaps
-    // NOTE: Every mipmap data is stored after data (RGBA - 4 bytes)
-    unsigned char *image = (unsigned char *)RL_MALLOC(width*height*4);
-    unsigned char *mipmap = NULL;
-    int offset = 0;
-
-    for (int i = 0; i < size; i += 4)
-    {
-        image[i] = data[i];
-        image[i + 1] = data[i + 1];
-        image[i + 2] = data[i + 2];
-        image[i + 3] = data[i + 3];
-    }
 
     TRACELOGD("TEXTURE: Mipmap base size (%ix%i)", width, height);
 
     for (int mip = 1; mip < mipmapCount; mip++)
     {
-        mipmap = rlGenNextMipmapData(image, width, height);
+        unsigned char *mipmap = level + width*height*4;
 
-        offset += (width*height*4); // Size of last mipmap
+        rlGenNextMipmapData(level, width, height, mipmap);
 
+        level = mipmap;
         width /= 2;
         height /= 2;
-        size = (width*height*4);    // Mipmap size to store after offset
+    }
+
+    return mipmapCount;
+}
 
-        // Add mipmap to data
-        for (int i = 0; i < size; i += 4)
+// Manual mipmap generation (box-filter, 2x2 pixels rounded average)
+static void rlGenNextMipmapData(const unsigned char *srcData, int srcWidth, int srcHeight, unsigned char *mipmap)
+{
+    int width = srcWidth/2;
+    int height = srcHeight/2;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row0 = srcData + (2*y*srcWidth)*4;
+        const unsigned char *row1 = row0 + srcWidth*4;
+
+        for (int x = 0; x < width*4; x++)
         {
-            data[offset + i] = mipmap[i];
-            data[offset + i + 1] = mipmap[i + 1];
-            data[offset + i + 2] = mipmap[i + 2];
-            data[offset + i + 3] = mipmap[i + 3];
+            int i = (x/4)*8 + (x%4);    // First source pixel channel
+
+            mipmap[y*width*4 + x] = (unsigned char)((row0[i] + row0[i + 4] + row1[i] + row1[i + 4] + 2)/4);
         }
+    }
+
+    TRACELOGD("TEXTURE: Mipmap generated successfully (%ix%i)", width, height);
+}
+#endif  // GRAPHICS_API_OPENGL_11
 
-        RL_FREE(image);
+// Bind texture to active unit, skipped if already bound
+// NOTE: Texture arrays and 3D textures are bound to their own target, so render batch draws, command lists
+// and shader samplers (rlSetUniformSampler()) use them as any 2D texture
+static void rlStateBindTexture(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int unit = RLGL.Cache.activeUnit;
 
-        image = mipmap;
-        mipmap = NULL;
+    if (unit < RL_MAX_STATE_CACHE_TEXTURE_UNITS)
+    {
+        if (RLGL.Cache.textures[unit] == id) { RLGL.Stats.current.stateChangesSkipped++; return; }
+        RLGL.Cache.textures[unit] = id;
     }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((id > 0) && (id < RLGL.State.layeredTexturesCapacity) && (RLGL.State.layeredTextures[id].target != 0))
+    {
+        glBindTexture(RLGL.State.layeredTextures[id].target, id);
+        return;
+    }
+#endif
+    glBindTexture(GL_TEXTURE_2D, id);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Set texture layered target, 0 for GL_TEXTURE_2D textures (texture unloaded)
+static void rlSetLayeredTexture(unsigned int id, unsigned int target, int depth)
+{
+    if (id == 0) return;
 
-    RL_FREE(mipmap);       // free mipmap data
+    if (id >= RLGL.State.layeredTexturesCapacity)
+    {
+        if (target == 0) return;    // Texture not tracked
 
-    return mipmapCount;
+        unsigned int capacity = (RLGL.State.layeredTexturesCapacity > 0)? RLGL.State.layeredTexturesCapacity*2 : 256;
+        if (capacity <= id) capacity = id + 1;
+
+        rlLayeredTexture *textures = (rlLayeredTexture *)RL_REALLOC(RLGL.State.layeredTextures, capacity*sizeof(rlLayeredTexture));
+        if (textures == NULL) return;
+
+        memset(textures + RLGL.State.layeredTexturesCapacity, 0, (capacity - RLGL.State.layeredTexturesCapacity)*sizeof(rlLayeredTexture));
+        RLGL.State.layeredTextures = textures;
+        RLGL.State.layeredTexturesCapacity = capacity;
+    }
+
+    RLGL.State.layeredTextures[id].target = target;
+    RLGL.State.layeredTextures[id].depth = depth;
 }
 
-// Manual mipmap generation (basic scaling algorithm)
-static unsigned char *rlGenNextMipmapData(unsigned char *srcData, int srcWidth, int srcHeight)
+// Get texture layered target, 0 for GL_TEXTURE_2D textures
+static rlLayeredTexture rlGetLayeredTexture(unsigned int id)
 {
-    int x2 = 0;
-    int y2 = 0;
-    unsigned char prow[4] = { 0 };
-    unsigned char pcol[4] = { 0 };
+    rlLayeredTexture texture = { 0 };
 
-    int width = srcWidth/2;
-    int height = srcHeight/2;
+    if ((id > 0) && (id < RLGL.State.layeredTexturesCapacity)) texture = RLGL.State.layeredTextures[id];
 
-    unsigned char *mipmap = (unsigned char *)RL_MALLOC(width*height*4);
+    return texture;
+}
 
-    // Scaling algorithm works perfectly (box-filter)
-    for (int y = 0; y < height; y++)
+// Load texture array (GL_TEXTURE_2D_ARRAY) or 3D texture (GL_TEXTURE_3D), all layers of a level one after the other
+// NOTE: Texture arrays keep layers count on every mipmap level, 3D textures halve depth per level
+static unsigned int rlLoadTextureLayered(unsigned int target, const void *data, int width, int height, int depth, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+
+    int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if ((width <= 0) || (height <= 0) || (depth <= 0) || (glInternalFormat == -1) ||
+        ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && ((data == NULL) || (target == GL_TEXTURE_3D))))
+    {
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: Layered texture requested size or format not supported (%i)", format);
+        return 0;
+    }
+
+    if (mipmapCount < 1) mipmapCount = 1;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenTextures(1, &id);
+
+    rlSetLayeredTexture(id, target, depth);     // Registered before binding, so bind uses the layered target
+    rlStateBindTexture(id);
+
+    const unsigned char *levelData = (const unsigned char *)data;
+    unsigned int dataSize = 0;
+
+    for (int level = 0, mipWidth = width, mipHeight = height, mipDepth = depth; level < mipmapCount; level++)
+    {
+        unsigned int levelSize = rlGetPixelDataSize(mipWidth, mipHeight, format)*mipDepth;
+
+        if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage3D(target, level, glInternalFormat, mipWidth, mipHeight, mipDepth, 0, glFormat, glType, levelData);
+        else glCompressedTexImage3D(target, level, glInternalFormat, mipWidth, mipHeight, mipDepth, 0, levelSize, levelData);
+
+        if (levelData != NULL) levelData += levelSize;
+        dataSize += levelSize;
+
+        mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+        mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+        if ((target == GL_TEXTURE_3D) && (mipDepth > 1)) mipDepth /= 2;
+    }
+
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(target, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+    else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+        glTexParameteriv(target, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+
+    glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    if (target == GL_TEXTURE_3D) glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_REPEAT);
+
+    // Trilinear filtering if mipmaps available, layers are never filtered between them
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, (mipmapCount > 1)? GL_LINEAR : GL_NEAREST);
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, (mipmapCount > 1)? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST);
+    if (mipmapCount > 1) glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);   // Default keeps rlGenTextureMipmaps() levels
+
+    rlStateBindTexture(0);
+    rlTrackVideoMemory(RL_MEMORY_OBJECT_TEXTURE, id, dataSize);
+
+    return id;
+}
+#endif
+
+// Enable/disable GL_BLEND, GL_DEPTH_TEST or GL_CULL_FACE capability, skipped if already set
+#if defined(RLGL_ENABLE_BATCH_DRAW_STATE)
+// Start a new draw (if current one has vertex), keeping current draw mode, textures, layer and state
+static rlDrawCall *rlNextDrawCall(void)
+{
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
     {
-        y2 = 2*y;
+        // Make sure current draw vertexCount is aligned a multiple of 4 (same as rlSetTexture())
+            if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+            else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+            else draw->vertexAlignment = 0;
+
+        rlDrawCall current = *draw;
 
-        for (int x = 0; x < width; x++)
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
         {
-            x2 = 2*x;
-
-            prow[0] = (srcData[(y2*srcWidth + x2)*4 + 0] + srcData[(y2*srcWidth + x2 + 1)*4 + 0])/2;
-            prow[1] = (srcData[(y2*srcWidth + x2)*4 + 1] + srcData[(y2*srcWidth + x2 + 1)*4 + 1])/2;
-            prow[2] = (srcData[(y2*srcWidth + x2)*4 + 2] + srcData[(y2*srcWidth + x2 + 1)*4 + 2])/2;
-            prow[3] = (srcData[(y2*srcWidth + x2)*4 + 3] + srcData[(y2*srcWidth + x2 + 1)*4 + 3])/2;
-
-            pcol[0] = (srcData[((y2 + 1)*srcWidth + x2)*4 + 0] + srcData[((y2 + 1)*srcWidth + x2 + 1)*4 + 0])/2;
-            pcol[1] = (srcData[((y2 + 1)*srcWidth + x2)*4 + 1] + srcData[((y2 + 1)*srcWidth + x2 + 1)*4 + 1])/2;
-            pcol[2] = (srcData[((y2 + 1)*srcWidth + x2)*4 + 2] + srcData[((y2 + 1)*srcWidth + x2 + 1)*4 + 2])/2;
-            pcol[3] = (srcData[((y2 + 1)*srcWidth + x2)*4 + 3] + srcData[((y2 + 1)*srcWidth + x2 + 1)*4 + 3])/2;
-
-            mipmap[(y*width + x)*4 + 0] = (prow[0] + pcol[0])/2;
-            mipmap[(y*width + x)*4 + 1] = (prow[1] + pcol[1])/2;
-            mipmap[(y*width + x)*4 + 2] = (prow[2] + pcol[2])/2;
-            mipmap[(y*width + x)*4 + 3] = (prow[3] + pcol[3])/2;
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+            RLGL.currentBatch->drawCounter++;
         }
+
+        rlCheckRenderBatchDrawLimit(RLGL.currentBatch);
+
+        draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+        *draw = current;
+        draw->vertexCount = 0;
+        draw->vertexAlignment = 0;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        draw->indexCount = 0;
+#endif
     }
 
-    TRACELOGD("TEXTURE: Mipmap generated successfully (%ix%i)", width, height);
+    return draw;
+}
+
+// Set GL blend mode and scissor for a draw, skipped if already set
+static void rlApplyDrawState(int blendMode, const int *scissor)
+{
+    if (blendMode != RLGL.State.currentBlendMode) rlApplyBlendMode(blendMode);
 
-    return mipmap;
+    if (scissor[2] < 0)
+    {
+        if (RLGL.State.scissorTest) rlDisableScissorTest();
+    }
+    else
+    {
+        if (!RLGL.State.scissorTest) rlEnableScissorTest();
+        if (memcmp(RLGL.State.scissor, scissor, 4*sizeof(int)) != 0) rlScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+    }
+}
+
+// Apply current draw state before direct draws, if changed
+// NOTE: Batch drawing leaves current state applied, so it is only required for state changed after it
+static void rlSyncDrawState(void)
+{
+    if (!RLGL.State.drawStateDirty) return;
+
+    rlApplyDrawState(RLGL.State.currentDrawBlendMode, RLGL.State.currentDrawScissor);
+    RLGL.State.drawStateDirty = false;
+}
+#endif
+
+static void rlStateSetCapability(int capability, bool enabled)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    unsigned int *cached = NULL;
+
+    switch (capability)
+    {
+        case GL_BLEND: cached = &RLGL.Cache.blend; break;
+        case GL_DEPTH_TEST: cached = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: cached = &RLGL.Cache.cullFace; break;
+        default: break;
+    }
+
+    if (cached != NULL)
+    {
+        if (*cached == (unsigned int)enabled) { RLGL.Stats.current.stateChangesSkipped++; return; }
+        *cached = enabled;
+    }
+#endif
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
 }
-#endif  // GRAPHICS_API_OPENGL_11
 
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
@@ -4645,6 +10402,7 @@ static int rlGetPixelDataSize(int width, int height, int format)
         case RL_PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
         case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
         case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R11G11B10F: bpp = 32; break;
         case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB:
         case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
         case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
@@ -4661,13 +10419,12 @@ static int rlGetPixelDataSize(int width, int height, int format)
 
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    // Most compressed formats works on 4x4 blocks, partial blocks
+    // at the borders (and textures smaller than a block) take a full block
+    if (((format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if (format == RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
+    else if ((width < 4) && (height < 4) && (format >= RL_PIXELFORMAT_COMPRESSED_PVRT_RGB)) dataSize = 16;
 
     return dataSize;
 }
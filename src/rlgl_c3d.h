@@ -0,0 +1,2443 @@
+/**********************************************************************************************
+*
+*   rlgl_c3d - OpenGL ES 2.0 subset implemented over citro3d (Nintendo 3DS, PICA200 GPU)
+*
+*   DESCRIPTION:
+*       Backend used by rlgl when GRAPHICS_API_CITRO3D is defined, rlgl code runs its
+*       OpenGL ES 2.0 path and GL calls are translated to citro3d, this way the batch system,
+*       textures, framebuffers and meshes work the same way on the 3DS
+*
+*       - Buffers are kept in linear memory and used directly by the PICA200 attribute loaders
+*       - Textures are converted (PICA200 components order) and 8x8 tiled (Morton order) on upload,
+*         size is padded to power-of-two and texture coordinates scaled accordingly by the shader
+*       - Default PICA200 vertex shader (rlgl_c3d.v.pica) is precompiled into .shbin and embedded
+*         in the library, used by all the programs (GLSL shaders code is ignored)
+*       - Resources updated after being drawn in current frame are orphaned, previous memory is
+*         released on next frame, once GPU has finished with it
+*
+*   LIMITATIONS:
+*       - GLSL shaders are not compiled, only default shader uniforms are supported (mvp, colDiffuse, texture0)
+*       - Only one texture unit, no mipmaps, no cubemaps, no compressed textures
+*       - Lines are expanded into triangles on CPU, points are not supported
+*       - Only framebuffers with a color texture attachment are supported, depth is never sampled
+*       - Clear operations ignore scissor
+*
+*   CONFIGURATION:
+*
+*   #define RLGL_C3D_IMPLEMENTATION
+*       Generates the implementation of the library into the included file (rlgl implementation)
+*
+*   DEPENDENCIES:
+*       libctru     - 3DS system library (linear memory, GSP)
+*       citro3d     - PICA200 GPU library
+*       picasso     - PICA200 shader assembler (build time, rlgl_c3d.v.pica -> rlgl_c3d.shbin)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2014-2022 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLGL_C3D_H
+#define RLGL_C3D_H
+
+// NOTE: Full <3ds.h> is not included, libctru HID keys names collide with raylib KeyboardKey names
+#include <3ds/types.h>
+#include <3ds/allocator/linear.h>       // Required for: linearAlloc(), linearFree()
+#include <3ds/services/gspgpu.h>        // Required for: GSPGPU_FlushDataCache(), GSPGPU_InvalidateDataCache(), gspWaitForP3D()
+#include <citro3d.h>                    // Required for: PICA200 GPU functionality
+#include <stddef.h>                     // Required for: ptrdiff_t
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef unsigned int GLenum;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef void GLvoid;
+typedef signed char GLbyte;
+typedef short GLshort;
+typedef int GLint;
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef unsigned int GLuint;
+typedef int GLsizei;
+typedef float GLfloat;
+typedef float GLclampf;
+typedef char GLchar;
+typedef ptrdiff_t GLintptr;
+typedef ptrdiff_t GLsizeiptr;
+typedef long long GLint64;
+typedef unsigned long long GLuint64;
+
+#define GL_APIENTRY
+#define GL_APIENTRYP GL_APIENTRY *
+
+// Extension functions types (required by rlgl declarations, never provided)
+typedef void (GL_APIENTRYP PFNGLGENVERTEXARRAYSOESPROC) (GLsizei n, GLuint *arrays);
+typedef void (GL_APIENTRYP PFNGLBINDVERTEXARRAYOESPROC) (GLuint array);
+typedef void (GL_APIENTRYP PFNGLDELETEVERTEXARRAYSOESPROC) (GLsizei n, const GLuint *arrays);
+typedef void (GL_APIENTRYP PFNGLDRAWARRAYSINSTANCEDEXTPROC) (GLenum mode, GLint start, GLsizei count, GLsizei primcount);
+typedef void (GL_APIENTRYP PFNGLDRAWELEMENTSINSTANCEDEXTPROC) (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount);
+typedef void (GL_APIENTRYP PFNGLVERTEXATTRIBDIVISOREXTPROC) (GLuint index, GLuint divisor);
+typedef void (GL_APIENTRYP PFNGLGENQUERIESEXTPROC) (GLsizei n, GLuint *ids);
+typedef void (GL_APIENTRYP PFNGLDELETEQUERIESEXTPROC) (GLsizei n, const GLuint *ids);
+typedef void (GL_APIENTRYP PFNGLBEGINQUERYEXTPROC) (GLenum target, GLuint id);
+typedef void (GL_APIENTRYP PFNGLENDQUERYEXTPROC) (GLenum target);
+typedef void (GL_APIENTRYP PFNGLGETQUERYOBJECTUIVEXTPROC) (GLuint id, GLenum pname, GLuint *params);
+typedef void (GL_APIENTRYP PFNGLGETQUERYOBJECTUI64VEXTPROC) (GLuint id, GLenum pname, GLuint64 *params);
+typedef void (GL_APIENTRYP PFNGLGETPROGRAMBINARYOESPROC) (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (GL_APIENTRYP PFNGLPROGRAMBINARYOESPROC) (GLuint program, GLenum binaryFormat, const void *binary, GLint length);
+typedef void (GL_APIENTRYP PFNGLDISCARDFRAMEBUFFEREXTPROC) (GLenum target, GLsizei numAttachments, const GLenum *attachments);
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GL_FALSE                                        0
+#define GL_TRUE                                         1
+#define GL_ZERO                                         0
+#define GL_ONE                                          1
+#define GL_NONE                                         0
+
+#define GL_POINTS                                       0x0000
+#define GL_LINES                                        0x0001
+#define GL_LINE_LOOP                                    0x0002
+#define GL_LINE_STRIP                                   0x0003
+#define GL_TRIANGLES                                    0x0004
+#define GL_TRIANGLE_STRIP                               0x0005
+#define GL_TRIANGLE_FAN                                 0x0006
+
+#define GL_DEPTH_BUFFER_BIT                             0x00000100
+#define GL_STENCIL_BUFFER_BIT                           0x00000400
+#define GL_COLOR_BUFFER_BIT                             0x00004000
+
+#define GL_NEVER                                        0x0200
+#define GL_LESS                                         0x0201
+#define GL_EQUAL                                        0x0202
+#define GL_LEQUAL                                       0x0203
+#define GL_GREATER                                      0x0204
+#define GL_NOTEQUAL                                     0x0205
+#define GL_GEQUAL                                       0x0206
+#define GL_ALWAYS                                       0x0207
+
+#define GL_SRC_COLOR                                    0x0300
+#define GL_ONE_MINUS_SRC_COLOR                          0x0301
+#define GL_SRC_ALPHA                                    0x0302
+#define GL_ONE_MINUS_SRC_ALPHA                          0x0303
+#define GL_DST_ALPHA                                    0x0304
+#define GL_ONE_MINUS_DST_ALPHA                          0x0305
+#define GL_DST_COLOR                                    0x0306
+#define GL_ONE_MINUS_DST_COLOR                          0x0307
+#define GL_SRC_ALPHA_SATURATE                           0x0308
+#define GL_CONSTANT_COLOR                               0x8001
+#define GL_ONE_MINUS_CONSTANT_COLOR                     0x8002
+#define GL_CONSTANT_ALPHA                               0x8003
+#define GL_ONE_MINUS_CONSTANT_ALPHA                     0x8004
+#define GL_FUNC_ADD                                     0x8006
+#define GL_MIN                                          0x8007      // GL_MIN_EXT
+#define GL_MAX                                          0x8008      // GL_MAX_EXT
+#define GL_FUNC_SUBTRACT                                0x800A
+#define GL_FUNC_REVERSE_SUBTRACT                        0x800B
+
+#define GL_FRONT                                        0x0404
+#define GL_BACK                                         0x0405
+#define GL_FRONT_AND_BACK                               0x0408
+#define GL_CW                                           0x0900
+#define GL_CCW                                          0x0901
+
+#define GL_CULL_FACE                                    0x0B44
+#define GL_DEPTH_TEST                                   0x0B71
+#define GL_STENCIL_TEST                                 0x0B90
+#define GL_DITHER                                       0x0BD0
+#define GL_BLEND                                        0x0BE2
+#define GL_SCISSOR_TEST                                 0x0C11
+
+#define GL_NO_ERROR                                     0
+#define GL_INVALID_ENUM                                 0x0500
+#define GL_INVALID_VALUE                                0x0501
+#define GL_INVALID_OPERATION                            0x0502
+#define GL_OUT_OF_MEMORY                                0x0505
+#define GL_INVALID_FRAMEBUFFER_OPERATION                0x0506
+
+#define GL_LINE_WIDTH                                   0x0B21
+#define GL_VIEWPORT                                     0x0BA2
+#define GL_SCISSOR_BOX                                  0x0C10
+#define GL_UNPACK_ROW_LENGTH                            0x0CF2
+#define GL_UNPACK_ALIGNMENT                             0x0CF5
+#define GL_PACK_ALIGNMENT                               0x0D05
+#define GL_MAX_TEXTURE_SIZE                             0x0D33
+#define GL_MAX_VIEWPORT_DIMS                            0x0D3A
+#define GL_NUM_COMPRESSED_TEXTURE_FORMATS               0x86A2
+#define GL_COMPRESSED_TEXTURE_FORMATS                   0x86A3
+#define GL_MAX_VERTEX_ATTRIBS                           0x8869
+#define GL_MAX_TEXTURE_IMAGE_UNITS                      0x8872
+#define GL_MAX_CUBE_MAP_TEXTURE_SIZE                    0x851C
+#define GL_MAX_RENDERBUFFER_SIZE                        0x84E8
+#define GL_NUM_PROGRAM_BINARY_FORMATS_OES               0x87FE
+
+#define GL_VENDOR                                       0x1F00
+#define GL_RENDERER                                     0x1F01
+#define GL_VERSION                                      0x1F02
+#define GL_EXTENSIONS                                   0x1F03
+#define GL_SHADING_LANGUAGE_VERSION                     0x8B8C
+
+#define GL_BYTE                                         0x1400
+#define GL_UNSIGNED_BYTE                                0x1401
+#define GL_SHORT                                        0x1402
+#define GL_UNSIGNED_SHORT                               0x1403
+#define GL_INT                                          0x1404
+#define GL_UNSIGNED_INT                                 0x1405
+#define GL_FLOAT                                        0x1406
+#define GL_HALF_FLOAT_OES                               0x8D61
+#define GL_UNSIGNED_SHORT_4_4_4_4                       0x8033
+#define GL_UNSIGNED_SHORT_5_5_5_1                       0x8034
+#define GL_UNSIGNED_SHORT_5_6_5                         0x8363
+
+#define GL_DEPTH_COMPONENT                              0x1902
+#define GL_ALPHA                                        0x1906
+#define GL_RGB                                          0x1907
+#define GL_RGBA                                         0x1908
+#define GL_LUMINANCE                                    0x1909
+#define GL_LUMINANCE_ALPHA                              0x190A
+
+#define GL_TEXTURE                                      0x1702
+#define GL_TEXTURE_2D                                   0x0DE1
+#define GL_TEXTURE_CUBE_MAP                             0x8513
+#define GL_TEXTURE_CUBE_MAP_POSITIVE_X                  0x8515
+#define GL_TEXTURE0                                     0x84C0
+#define GL_TEXTURE_MAG_FILTER                           0x2800
+#define GL_TEXTURE_MIN_FILTER                           0x2801
+#define GL_TEXTURE_WRAP_S                               0x2802
+#define GL_TEXTURE_WRAP_T                               0x2803
+#define GL_NEAREST                                      0x2600
+#define GL_LINEAR                                       0x2601
+#define GL_NEAREST_MIPMAP_NEAREST                       0x2700
+#define GL_LINEAR_MIPMAP_NEAREST                        0x2701
+#define GL_NEAREST_MIPMAP_LINEAR                        0x2702
+#define GL_LINEAR_MIPMAP_LINEAR                         0x2703
+#define GL_REPEAT                                       0x2901
+#define GL_CLAMP_TO_EDGE                                0x812F
+#define GL_MIRRORED_REPEAT                              0x8370
+
+#define GL_ARRAY_BUFFER                                 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER                         0x8893
+#define GL_STREAM_DRAW                                  0x88E0
+#define GL_STATIC_DRAW                                  0x88E4
+#define GL_DYNAMIC_DRAW                                 0x88E8
+
+#define GL_FRAGMENT_SHADER                              0x8B30
+#define GL_VERTEX_SHADER                                0x8B31
+#define GL_SHADER_TYPE                                  0x8B4F
+#define GL_DELETE_STATUS                                0x8B80
+#define GL_COMPILE_STATUS                               0x8B81
+#define GL_LINK_STATUS                                  0x8B82
+#define GL_VALIDATE_STATUS                              0x8B83
+#define GL_INFO_LOG_LENGTH                              0x8B84
+#define GL_ATTACHED_SHADERS                             0x8B85
+#define GL_ACTIVE_UNIFORMS                              0x8B86
+#define GL_ACTIVE_UNIFORM_MAX_LENGTH                    0x8B87
+#define GL_ACTIVE_ATTRIBUTES                            0x8B89
+#define GL_ACTIVE_ATTRIBUTE_MAX_LENGTH                  0x8B8A
+
+#define GL_FRAMEBUFFER                                  0x8D40
+#define GL_RENDERBUFFER                                 0x8D41
+#define GL_RGBA4                                        0x8056
+#define GL_RGB5_A1                                      0x8057
+#define GL_RGB565                                       0x8D62
+#define GL_DEPTH_COMPONENT16                            0x81A5
+#define GL_DEPTH_COMPONENT24_OES                        0x81A6
+#define GL_DEPTH_COMPONENT32_OES                        0x81A7
+#define GL_DEPTH24_STENCIL8_OES                         0x88F0
+#define GL_STENCIL_INDEX8                               0x8D48
+#define GL_COLOR_ATTACHMENT0                            0x8CE0
+#define GL_DEPTH_ATTACHMENT                             0x8D00
+#define GL_STENCIL_ATTACHMENT                           0x8D20
+#define GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE           0x8CD0
+#define GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME           0x8CD1
+#define GL_FRAMEBUFFER_COMPLETE                         0x8CD5
+#define GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT            0x8CD6
+#define GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT    0x8CD7
+#define GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS            0x8CD9
+#define GL_FRAMEBUFFER_UNSUPPORTED                      0x8CDD
+#define GL_FRAMEBUFFER_BINDING                          0x8CA6
+#define GL_RENDERBUFFER_BINDING                         0x8CA7
+
+//----------------------------------------------------------------------------------
+// Functions Declaration - OpenGL ES 2.0 subset
+//----------------------------------------------------------------------------------
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+// Buffers
+void glGenBuffers(GLsizei n, GLuint *buffers);
+void glDeleteBuffers(GLsizei n, const GLuint *buffers);
+void glBindBuffer(GLenum target, GLuint buffer);
+void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+
+// Textures
+void glGenTextures(GLsizei n, GLuint *textures);
+void glDeleteTextures(GLsizei n, const GLuint *textures);
+void glActiveTexture(GLenum texture);
+void glBindTexture(GLenum target, GLuint texture);
+void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+void glTexParameteri(GLenum target, GLenum pname, GLint param);
+void glTexParameterf(GLenum target, GLenum pname, GLfloat param);
+void glGenerateMipmap(GLenum target);
+void glPixelStorei(GLenum pname, GLint param);
+
+// Shaders and programs
+GLuint glCreateShader(GLenum type);
+void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length);
+void glCompileShader(GLuint shader);
+void glDeleteShader(GLuint shader);
+void glGetShaderiv(GLuint shader, GLenum pname, GLint *params);
+void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+GLuint glCreateProgram(void);
+void glAttachShader(GLuint program, GLuint shader);
+void glDetachShader(GLuint program, GLuint shader);
+void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
+void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name);
+void glLinkProgram(GLuint program);
+void glDeleteProgram(GLuint program);
+void glUseProgram(GLuint program);
+void glGetProgramiv(GLuint program, GLenum pname, GLint *params);
+void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+GLint glGetAttribLocation(GLuint program, const GLchar *name);
+GLint glGetUniformLocation(GLuint program, const GLchar *name);
+void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+
+// Uniforms
+void glUniform1f(GLint location, GLfloat v0);
+void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void glUniform1i(GLint location, GLint v0);
+void glUniform1fv(GLint location, GLsizei count, const GLfloat *value);
+void glUniform2fv(GLint location, GLsizei count, const GLfloat *value);
+void glUniform3fv(GLint location, GLsizei count, const GLfloat *value);
+void glUniform4fv(GLint location, GLsizei count, const GLfloat *value);
+void glUniform1iv(GLint location, GLsizei count, const GLint *value);
+void glUniform2iv(GLint location, GLsizei count, const GLint *value);
+void glUniform3iv(GLint location, GLsizei count, const GLint *value);
+void glUniform4iv(GLint location, GLsizei count, const GLint *value);
+void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+
+// Vertex attributes
+void glEnableVertexAttribArray(GLuint index);
+void glDisableVertexAttribArray(GLuint index);
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+void glVertexAttrib1fv(GLuint index, const GLfloat *v);
+void glVertexAttrib2fv(GLuint index, const GLfloat *v);
+void glVertexAttrib3fv(GLuint index, const GLfloat *v);
+void glVertexAttrib4fv(GLuint index, const GLfloat *v);
+
+// Framebuffers
+void glGenFramebuffers(GLsizei n, GLuint *framebuffers);
+void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers);
+void glBindFramebuffer(GLenum target, GLuint framebuffer);
+void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+GLenum glCheckFramebufferStatus(GLenum target);
+void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params);
+void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers);
+void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers);
+void glBindRenderbuffer(GLenum target, GLuint renderbuffer);
+void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+
+// Render state
+void glEnable(GLenum cap);
+void glDisable(GLenum cap);
+void glBlendFunc(GLenum sfactor, GLenum dfactor);
+void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+void glBlendEquation(GLenum mode);
+void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha);
+void glDepthFunc(GLenum func);
+void glDepthMask(GLboolean flag);
+void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void glCullFace(GLenum mode);
+void glFrontFace(GLenum mode);
+void glLineWidth(GLfloat width);
+void glViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void glScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void glClearDepthf(GLfloat d);
+void glClear(GLbitfield mask);
+
+// Drawing
+void glDrawArrays(GLenum mode, GLint first, GLsizei count);
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+void glFlush(void);
+void glFinish(void);
+
+// Queries
+GLenum glGetError(void);
+const GLubyte *glGetString(GLenum name);
+void glGetIntegerv(GLenum pname, GLint *data);
+void glGetFloatv(GLenum pname, GLfloat *data);
+
+//----------------------------------------------------------------------------------
+// Functions Declaration - Platform context
+//----------------------------------------------------------------------------------
+bool c3dglCreateContext(C3D_RenderTarget *screen, int width, int height);  // Create context over screen render target (framebuffer 0), size in landscape orientation
+void c3dglDestroyContext(void);                         // Destroy context, free all resources
+void c3dglSwapBuffers(void);                            // Finish current frame, screen render target is presented
+void *c3dglGetProcAddress(const char *name);            // Get extension function address (no extensions provided)
+void c3dglSetStereoTarget(C3D_RenderTarget *right);     // Set right eye screen render target for stereo drawing, NULL: mono
+bool c3dglIsStereoActive(void);                         // Check if screen drawing is stereo (right eye target set, framebuffer 0 bound)
+void c3dglSetEye(int eye);                              // Set eye for screen drawing (0: left, 1: right)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLGL_C3D_H
+
+/***********************************************************************************
+*
+*   RLGL_C3D IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLGL_C3D_IMPLEMENTATION)
+
+#include <stdlib.h>                     // Required for: malloc(), free(), realloc()
+#include <string.h>                     // Required for: memcpy(), memset(), strcmp()
+#include <math.h>                       // Required for: sqrtf()
+
+#ifndef TRACELOG
+    #define TRACELOG(level, ...) (void)0
+#endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(n,sz)  realloc(n,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(p)        free(p)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef C3DGL_MAX_BUFFERS
+    #define C3DGL_MAX_BUFFERS           1024    // Maximum number of buffer objects
+#endif
+#ifndef C3DGL_MAX_TEXTURES
+    #define C3DGL_MAX_TEXTURES           512    // Maximum number of texture objects
+#endif
+#ifndef C3DGL_MAX_SHADERS
+    #define C3DGL_MAX_SHADERS            128    // Maximum number of shader objects
+#endif
+#ifndef C3DGL_MAX_PROGRAMS
+    #define C3DGL_MAX_PROGRAMS            64    // Maximum number of program objects
+#endif
+#ifndef C3DGL_MAX_FRAMEBUFFERS
+    #define C3DGL_MAX_FRAMEBUFFERS        32    // Maximum number of framebuffer objects
+#endif
+#ifndef C3DGL_MAX_RENDERBUFFERS
+    #define C3DGL_MAX_RENDERBUFFERS       32    // Maximum number of renderbuffer objects
+#endif
+
+#define C3DGL_MAX_ATTRIBS                  8    // Maximum number of vertex attributes (GL locations)
+#define C3DGL_MAX_TEXTURE_SIZE          1024    // Maximum texture size supported by PICA200
+
+// Default shader uniform locations (GL side)
+#define C3DGL_UNIFORM_MVP                  0
+#define C3DGL_UNIFORM_COLOR                1
+#define C3DGL_UNIFORM_TEXTURE0             2
+
+// GL attribute locations loaded by default shader, mapped to PICA200 input registers v0, v1, v2
+#define C3DGL_ATTRIB_POSITION              0
+#define C3DGL_ATTRIB_TEXCOORD              1
+#define C3DGL_ATTRIB_COLOR                 3
+
+// Retired resource types
+#define C3DGL_RETIRED_MEMORY               0
+#define C3DGL_RETIRED_TEXTURE              1
+#define C3DGL_RETIRED_TARGET               2
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct c3dglBuffer {
+    bool active;                // Buffer id in use
+    unsigned char *data;        // Buffer data (linear memory)
+    int size;                   // Buffer size in bytes
+    unsigned int frame;         // Last frame buffer was used for drawing
+} c3dglBuffer;
+
+typedef struct c3dglTexture {
+    bool active;                // Texture id in use
+    bool ready;                 // Texture memory allocated
+    C3D_Tex tex;                // citro3d texture (power-of-two size)
+    int width;                  // Texture width requested
+    int height;                 // Texture height requested
+    GPU_TEXTURE_FILTER_PARAM magFilter;
+    GPU_TEXTURE_FILTER_PARAM minFilter;
+    GPU_TEXTURE_WRAP_PARAM wrapS;
+    GPU_TEXTURE_WRAP_PARAM wrapT;
+    int attachments;            // Framebuffers using texture as color attachment (texture memory can not be orphaned)
+    unsigned int frame;         // Last frame texture was used for drawing
+} c3dglTexture;
+
+typedef struct c3dglShader {
+    bool active;                // Shader id in use
+    GLenum type;                // Shader type
+} c3dglShader;
+
+typedef struct c3dglProgram {
+    bool active;                // Program id in use
+    float mvp[16];              // Uniform: mvp (column-major)
+    float colDiffuse[4];        // Uniform: colDiffuse
+} c3dglProgram;
+
+typedef struct c3dglFramebuffer {
+    bool active;                // Framebuffer id in use
+    GLuint colorTexture;        // Color attachment (texture)
+    GLuint depthTexture;        // Depth attachment (texture, used as depth buffer only)
+    GLuint depthRenderbuffer;   // Depth attachment (renderbuffer)
+    C3D_RenderTarget *target;   // citro3d render target, created on first use
+    bool dirty;                 // Attachments changed, render target must be recreated
+} c3dglFramebuffer;
+
+typedef struct c3dglRenderbuffer {
+    bool active;                // Renderbuffer id in use
+    GLenum format;              // Renderbuffer internal format
+    int width;
+    int height;
+} c3dglRenderbuffer;
+
+typedef struct c3dglAttrib {
+    bool enabled;               // Vertex array enabled
+    GLint size;                 // Components count
+    GLenum type;                // Components type
+    GLboolean normalized;       // Components normalized
+    GLsizei stride;             // Vertex stride in bytes
+    const void *pointer;        // Offset in buffer (or client pointer if no buffer bound)
+    GLuint buffer;              // Array buffer bound when pointer was defined
+    float value[4];             // Constant value used when array disabled
+} c3dglAttrib;
+
+typedef struct c3dglRetired {
+    int type;                   // Retired resource type
+    void *memory;               // Linear memory
+    C3D_Tex tex;                // Texture
+    C3D_RenderTarget *target;   // Render target
+} c3dglRetired;
+
+typedef struct c3dglVertex {
+    float position[4];          // Clip space position
+    float texcoord[2];
+    float color[4];
+} c3dglVertex;
+
+typedef struct c3dglContext {
+    C3D_RenderTarget *screen;   // Screen render target (framebuffer 0), rotated (portrait)
+    C3D_RenderTarget *screenRight;  // Right eye screen render target (stereo), NULL if mono
+    int eye;                    // Eye used for screen drawing (0: left, 1: right)
+    int screenWidth;            // Screen width (landscape)
+    int screenHeight;           // Screen height (landscape)
+
+    DVLB_s *shaderDvlb;         // Default shader binary
+    shaderProgram_s shader;     // Default shader program
+    int locMvp;                 // Default shader uniform location: mvp
+    int locColor;               // Default shader uniform location: colDiffuse
+    int locScale;               // Default shader uniform location: attribScale
+
+    bool frameActive;           // Frame started (C3D_FrameBegin)
+    unsigned int frame;         // Frame counter
+    C3D_RenderTarget *drawTarget;   // Render target used for drawing in current frame
+
+    c3dglRetired *retired;      // Resources pending to be released (GPU could be using them)
+    int retiredCount;
+    int retiredCapacity;
+
+    c3dglBuffer buffers[C3DGL_MAX_BUFFERS];
+    c3dglTexture textures[C3DGL_MAX_TEXTURES];
+    c3dglShader shaders[C3DGL_MAX_SHADERS];
+    c3dglProgram programs[C3DGL_MAX_PROGRAMS];
+    c3dglFramebuffer framebuffers[C3DGL_MAX_FRAMEBUFFERS];
+    c3dglRenderbuffer renderbuffers[C3DGL_MAX_RENDERBUFFERS];
+    c3dglAttrib attribs[C3DGL_MAX_ATTRIBS];
+
+    GLuint arrayBuffer;         // Bound: GL_ARRAY_BUFFER
+    GLuint elementBuffer;       // Bound: GL_ELEMENT_ARRAY_BUFFER
+    GLuint texture;             // Bound: GL_TEXTURE_2D (unit 0)
+    int activeTexture;          // Active texture unit
+    GLuint program;             // Current program
+    GLuint framebuffer;         // Bound: GL_FRAMEBUFFER
+    GLuint renderbuffer;        // Bound: GL_RENDERBUFFER
+
+    float clearColor[4];
+    float clearDepth;
+    int viewport[4];
+    int scissor[4];
+    bool scissorTest;
+    bool blend;
+    GLenum blendEquation[2];    // Blend equation: rgb, alpha
+    GLenum blendFactor[4];      // Blend factors: src rgb, dst rgb, src alpha, dst alpha
+    bool depthTest;
+    GLenum depthFunc;
+    bool depthMask;
+    unsigned int colorMask;     // Color channels write mask (GPU_WRITEMASK bits)
+    bool cullFace;
+    GLenum cullMode;
+    GLenum frontFace;
+    float lineWidth;
+    int unpackAlignment;
+    int unpackRowLength;        // Source rows length (pixels), 0: rows are width long
+    int packAlignment;
+    GLenum error;               // Last error
+} c3dglContext;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern const unsigned char rlgl_c3d_shbin[];        // Default shader binary (rlgl_c3d.v.pica), embedded with bin2s
+extern const unsigned int rlgl_c3d_shbin_size;      // Default shader binary size
+
+static c3dglContext *C3DGL = NULL;
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static void c3dglSetError(GLenum error);            // Set error, only first error is kept until queried
+static void c3dglBeginFrame(void);                  // Begin frame if required, retired resources released
+static void c3dglRetire(int type, void *memory, const C3D_Tex *tex, C3D_RenderTarget *target);  // Retire resource, released once GPU is done with it
+static void c3dglReleaseRetired(bool targets);      // Release retired resources (render targets only outside frame)
+static void *c3dglAllocTransient(int size);         // Allocate linear memory valid for current frame
+static C3D_RenderTarget *c3dglGetTarget(void);      // Get render target for current framebuffer (created if required)
+static bool c3dglIsScreenTarget(const C3D_RenderTarget *target);   // Check if render target is a screen eye target (rotated)
+static void c3dglBindTarget(void);                  // Bind current render target for drawing (frame started)
+static void c3dglApplyViewport(void);               // Apply viewport and scissor to current render target
+static void c3dglApplyState(void);                  // Apply blending, depth and culling state
+static void c3dglUploadUniforms(const float *mvp, float colorScale);   // Upload default shader uniforms for draw
+static bool c3dglSetupAttribs(int vertexCount, float *colorScale);     // Setup vertex attribute loaders for draw
+static void c3dglFetchAttrib(int index, int vertex, float *value);     // Get vertex attribute value as floats
+static void c3dglDrawLines(GLenum mode, int count, GLenum type, const void *indices, int first);   // Draw lines expanded into triangles
+static bool c3dglGetTextureFormat(GLenum format, GLenum type, GPU_TEXCOLOR *gpuFormat, int *bytes);
+static void c3dglUploadTexels(c3dglTexture *texture, int x, int y, int width, int height, GLenum format, GLenum type, const unsigned char *pixels, bool padding);
+static void c3dglOrphanTexture(c3dglTexture *texture);  // Replace texture memory, previous one retired
+static void c3dglDeleteTarget(c3dglFramebuffer *framebuffer);
+
+// Get tiled texel offset (8x8 tiles, Morton order inside tile)
+static inline unsigned int c3dglTileOffset(unsigned int x, unsigned int y, unsigned int width)
+{
+    unsigned int morton = (x & 1) | ((y & 1) << 1) | ((x & 2) << 1) | ((y & 2) << 2) | ((x & 4) << 2) | ((y & 4) << 3);
+
+    return (((y >> 3)*(width >> 3) + (x >> 3)) << 6) + morton;
+}
+
+// Get next power-of-two size (PICA200 minimum texture size is 8)
+static inline int c3dglPotSize(int size)
+{
+    int pot = 8;
+    while (pot < size) pot <<= 1;
+
+    return pot;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Platform context
+//----------------------------------------------------------------------------------
+
+// Create context over screen render target (framebuffer 0)
+bool c3dglCreateContext(C3D_RenderTarget *screen, int width, int height)
+{
+    if (C3DGL != NULL) return true;
+
+    C3DGL = (c3dglContext *)RL_CALLOC(1, sizeof(c3dglContext));
+    if (C3DGL == NULL) return false;
+
+    C3DGL->screen = screen;
+    C3DGL->screenWidth = width;
+    C3DGL->screenHeight = height;
+
+    C3DGL->shaderDvlb = DVLB_ParseFile((u32 *)rlgl_c3d_shbin, rlgl_c3d_shbin_size);
+
+    if (C3DGL->shaderDvlb == NULL)
+    {
+        TRACELOG(RL_LOG_WARNING, "C3DGL: Failed to load default shader binary");
+        RL_FREE(C3DGL);
+        C3DGL = NULL;
+        return false;
+    }
+
+    shaderProgramInit(&C3DGL->shader);
+    shaderProgramSetVsh(&C3DGL->shader, &C3DGL->shaderDvlb->DVLE[0]);
+    C3D_BindProgram(&C3DGL->shader);
+
+    C3DGL->locMvp = shaderInstanceGetUniformLocation(C3DGL->shader.vertexShader, "mvp");
+    C3DGL->locColor = shaderInstanceGetUniformLocation(C3DGL->shader.vertexShader, "colDiffuse");
+    C3DGL->locScale = shaderInstanceGetUniformLocation(C3DGL->shader.vertexShader, "attribScale");
+
+    // NOTE: Frame 0 means resource never drawn
+    C3DGL->frame = 1;
+
+    // Default GL state
+    for (int i = 0; i < C3DGL_MAX_ATTRIBS; i++) C3DGL->attribs[i].value[3] = 1.0f;
+    C3DGL->clearDepth = 1.0f;
+    C3DGL->viewport[2] = width;
+    C3DGL->viewport[3] = height;
+    C3DGL->scissor[2] = width;
+    C3DGL->scissor[3] = height;
+    C3DGL->blendEquation[0] = GL_FUNC_ADD;
+    C3DGL->blendEquation[1] = GL_FUNC_ADD;
+    C3DGL->blendFactor[0] = GL_ONE;
+    C3DGL->blendFactor[1] = GL_ZERO;
+    C3DGL->blendFactor[2] = GL_ONE;
+    C3DGL->blendFactor[3] = GL_ZERO;
+    C3DGL->depthFunc = GL_LESS;
+    C3DGL->depthMask = true;
+    C3DGL->colorMask = GPU_WRITE_COLOR;
+    C3DGL->cullMode = GL_BACK;
+    C3DGL->frontFace = GL_CCW;
+    C3DGL->lineWidth = 1.0f;
+    C3DGL->unpackAlignment = 4;
+    C3DGL->packAlignment = 4;
+
+    TRACELOG(RL_LOG_INFO, "C3DGL: Context created successfully (%ix%i)", width, height);
+
+    return true;
+}
+
+// Destroy context, free all resources
+void c3dglDestroyContext(void)
+{
+    if (C3DGL == NULL) return;
+
+    if (C3DGL->frameActive)
+    {
+        C3D_FrameEnd(0);
+        C3DGL->frameActive = false;
+    }
+
+    for (int i = 0; i < C3DGL_MAX_FRAMEBUFFERS; i++) if (C3DGL->framebuffers[i].target != NULL) C3D_RenderTargetDelete(C3DGL->framebuffers[i].target);
+
+    // NOTE: C3D_RenderTargetDelete() waits for GPU, remaining resources can be freed
+    c3dglReleaseRetired(true);
+    RL_FREE(C3DGL->retired);
+
+    for (int i = 0; i < C3DGL_MAX_BUFFERS; i++) if (C3DGL->buffers[i].data != NULL) linearFree(C3DGL->buffers[i].data);
+    for (int i = 0; i < C3DGL_MAX_TEXTURES; i++) if (C3DGL->textures[i].ready) C3D_TexDelete(&C3DGL->textures[i].tex);
+
+    shaderProgramFree(&C3DGL->shader);
+    DVLB_Free(C3DGL->shaderDvlb);
+
+    RL_FREE(C3DGL);
+    C3DGL = NULL;
+}
+
+// Finish current frame, screen render target is presented
+void c3dglSwapBuffers(void)
+{
+    // NOTE: A frame is always submitted, screen output requires it
+    c3dglBeginFrame();
+
+    C3D_FrameEnd(0);
+    C3DGL->frameActive = false;
+    C3DGL->drawTarget = NULL;
+
+    // Render targets can only be deleted outside frame
+    c3dglReleaseRetired(true);
+}
+
+// Get extension function address (no extensions provided)
+void *c3dglGetProcAddress(const char *name)
+{
+    (void)name;
+    return NULL;
+}
+
+// Set right eye screen render target for stereo drawing, NULL: mono
+// NOTE: Render target output (GFX_RIGHT) is linked by platform, right eye is only transferred if drawn in frame
+void c3dglSetStereoTarget(C3D_RenderTarget *right)
+{
+    C3DGL->screenRight = right;
+    if (right == NULL) C3DGL->eye = 0;
+}
+
+// Check if screen drawing is stereo (right eye target set, framebuffer 0 bound)
+bool c3dglIsStereoActive(void)
+{
+    return ((C3DGL != NULL) && (C3DGL->screenRight != NULL) && (C3DGL->framebuffer == 0));
+}
+
+// Set eye for screen drawing (0: left, 1: right)
+// NOTE: Render target is switched on next draw or clear, GL state applies to both eyes
+void c3dglSetEye(int eye)
+{
+    C3DGL->eye = ((eye == 1) && (C3DGL->screenRight != NULL))? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Buffers
+//----------------------------------------------------------------------------------
+void glGenBuffers(GLsizei n, GLuint *buffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        buffers[i] = 0;
+
+        for (int id = 0; id < C3DGL_MAX_BUFFERS; id++)
+        {
+            if (!C3DGL->buffers[id].active)
+            {
+                memset(&C3DGL->buffers[id], 0, sizeof(c3dglBuffer));
+                C3DGL->buffers[id].active = true;
+                buffers[i] = id + 1;
+                break;
+            }
+        }
+
+        if (buffers[i] == 0) c3dglSetError(GL_OUT_OF_MEMORY);
+    }
+}
+
+void glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if ((buffers[i] == 0) || (buffers[i] > C3DGL_MAX_BUFFERS)) continue;
+
+        c3dglBuffer *buffer = &C3DGL->buffers[buffers[i] - 1];
+
+        if (buffer->data != NULL)
+        {
+            if (buffer->frame == C3DGL->frame) c3dglRetire(C3DGL_RETIRED_MEMORY, buffer->data, NULL, NULL);
+            else linearFree(buffer->data);
+        }
+
+        memset(buffer, 0, sizeof(c3dglBuffer));
+
+        if (C3DGL->arrayBuffer == buffers[i]) C3DGL->arrayBuffer = 0;
+        if (C3DGL->elementBuffer == buffers[i]) C3DGL->elementBuffer = 0;
+    }
+}
+
+void glBindBuffer(GLenum target, GLuint buffer)
+{
+    if (buffer > C3DGL_MAX_BUFFERS) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    if (target == GL_ARRAY_BUFFER) C3DGL->arrayBuffer = buffer;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) C3DGL->elementBuffer = buffer;
+    else c3dglSetError(GL_INVALID_ENUM);
+}
+
+void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    (void)usage;
+
+    GLuint id = (target == GL_ARRAY_BUFFER)? C3DGL->arrayBuffer : (target == GL_ELEMENT_ARRAY_BUFFER)? C3DGL->elementBuffer : 0;
+    if (id == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglBuffer *buffer = &C3DGL->buffers[id - 1];
+
+    // Buffer memory reused if possible, GPU could be reading it if drawn in current frame
+    if ((buffer->data == NULL) || (buffer->size != (int)size) || (buffer->frame == C3DGL->frame))
+    {
+        if (buffer->data != NULL)
+        {
+            if (buffer->frame == C3DGL->frame) c3dglRetire(C3DGL_RETIRED_MEMORY, buffer->data, NULL, NULL);
+            else linearFree(buffer->data);
+        }
+
+        buffer->data = (unsigned char *)linearAlloc((size > 0)? size : 4);
+        buffer->size = (buffer->data != NULL)? (int)size : 0;
+        buffer->frame = 0;
+
+        if (buffer->data == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Failed to allocate buffer memory (%i bytes)", id, (int)size);
+            c3dglSetError(GL_OUT_OF_MEMORY);
+            return;
+        }
+    }
+
+    if (data != NULL) memcpy(buffer->data, data, size);
+    else memset(buffer->data, 0, size);
+
+    GSPGPU_FlushDataCache(buffer->data, size);
+}
+
+void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    GLuint id = (target == GL_ARRAY_BUFFER)? C3DGL->arrayBuffer : (target == GL_ELEMENT_ARRAY_BUFFER)? C3DGL->elementBuffer : 0;
+    if (id == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglBuffer *buffer = &C3DGL->buffers[id - 1];
+    if ((buffer->data == NULL) || (offset < 0) || ((offset + size) > buffer->size)) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    // Buffer drawn in current frame: orphaned, new memory keeps data not updated
+    if (buffer->frame == C3DGL->frame)
+    {
+        unsigned char *memory = (unsigned char *)linearAlloc(buffer->size);
+
+        if (memory == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Failed to orphan buffer memory (%i bytes)", id, buffer->size);
+            c3dglSetError(GL_OUT_OF_MEMORY);
+            return;
+        }
+
+        if (offset > 0) memcpy(memory, buffer->data, offset);
+        if ((offset + size) < buffer->size) memcpy(memory + offset + size, buffer->data + offset + size, buffer->size - (offset + size));
+
+        c3dglRetire(C3DGL_RETIRED_MEMORY, buffer->data, NULL, NULL);
+        buffer->data = memory;
+        buffer->frame = 0;
+
+        memcpy(buffer->data + offset, data, size);
+        GSPGPU_FlushDataCache(buffer->data, buffer->size);
+    }
+    else
+    {
+        memcpy(buffer->data + offset, data, size);
+        GSPGPU_FlushDataCache(buffer->data + offset, size);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Textures
+//----------------------------------------------------------------------------------
+void glGenTextures(GLsizei n, GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
+    {
+        textures[i] = 0;
+
+        for (int id = 0; id < C3DGL_MAX_TEXTURES; id++)
+        {
+            if (!C3DGL->textures[id].active)
+            {
+                c3dglTexture *texture = &C3DGL->textures[id];
+
+                memset(texture, 0, sizeof(c3dglTexture));
+                texture->active = true;
+                texture->magFilter = GPU_LINEAR;
+                texture->minFilter = GPU_LINEAR;
+                texture->wrapS = GPU_REPEAT;
+                texture->wrapT = GPU_REPEAT;
+                textures[i] = id + 1;
+                break;
+            }
+        }
+
+        if (textures[i] == 0) c3dglSetError(GL_OUT_OF_MEMORY);
+    }
+}
+
+void glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if ((textures[i] == 0) || (textures[i] > C3DGL_MAX_TEXTURES)) continue;
+
+        c3dglTexture *texture = &C3DGL->textures[textures[i] - 1];
+
+        if (texture->ready)
+        {
+            if ((texture->frame == C3DGL->frame) || (texture->attachments > 0)) c3dglRetire(C3DGL_RETIRED_TEXTURE, NULL, &texture->tex, NULL);
+            else C3D_TexDelete(&texture->tex);
+        }
+
+        for (int j = 0; j < C3DGL_MAX_FRAMEBUFFERS; j++) if (C3DGL->framebuffers[j].colorTexture == textures[i]) C3DGL->framebuffers[j].dirty = true;
+
+        memset(texture, 0, sizeof(c3dglTexture));
+
+        if (C3DGL->texture == textures[i]) C3DGL->texture = 0;
+    }
+}
+
+void glActiveTexture(GLenum texture)
+{
+    // NOTE: Only texture unit 0 is supported, other units binds are ignored
+    C3DGL->activeTexture = texture - GL_TEXTURE0;
+}
+
+void glBindTexture(GLenum target, GLuint texture)
+{
+    if ((target != GL_TEXTURE_2D) || (C3DGL->activeTexture != 0)) return;
+    if (texture > C3DGL_MAX_TEXTURES) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    C3DGL->texture = texture;
+}
+
+void glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    (void)internalformat;
+    (void)border;
+
+    // NOTE: Mipmaps and cubemaps not supported
+    if ((target != GL_TEXTURE_2D) || (level != 0)) return;
+    if ((C3DGL->texture == 0) || (C3DGL->activeTexture != 0)) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglTexture *texture = &C3DGL->textures[C3DGL->texture - 1];
+    GPU_TEXCOLOR gpuFormat = GPU_RGBA8;
+    int bytes = 0;
+
+    if (!c3dglGetTextureFormat(format, type, &gpuFormat, &bytes))
+    {
+        TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Texture format not supported (0x%x, 0x%x)", C3DGL->texture, format, type);
+        c3dglSetError(GL_INVALID_ENUM);
+        return;
+    }
+
+    int potWidth = c3dglPotSize(width);
+    int potHeight = c3dglPotSize(height);
+
+    if ((potWidth > C3DGL_MAX_TEXTURE_SIZE) || (potHeight > C3DGL_MAX_TEXTURE_SIZE))
+    {
+        TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Texture size not supported (%ix%i), maximum size is %i", C3DGL->texture, width, height, C3DGL_MAX_TEXTURE_SIZE);
+        c3dglSetError(GL_INVALID_VALUE);
+        return;
+    }
+
+    bool reuse = texture->ready && (texture->tex.width == potWidth) && (texture->tex.height == potHeight) && (texture->tex.fmt == gpuFormat);
+
+    if (reuse && (texture->frame == C3DGL->frame) && (texture->attachments == 0)) reuse = false;
+
+    if (!reuse)
+    {
+        if (texture->ready)
+        {
+            if ((texture->frame == C3DGL->frame) || (texture->attachments > 0)) c3dglRetire(C3DGL_RETIRED_TEXTURE, NULL, &texture->tex, NULL);
+            else C3D_TexDelete(&texture->tex);
+
+            texture->ready = false;
+
+            // Render targets using previous texture memory must be recreated
+            for (int i = 0; i < C3DGL_MAX_FRAMEBUFFERS; i++) if (C3DGL->framebuffers[i].colorTexture == C3DGL->texture) C3DGL->framebuffers[i].dirty = true;
+        }
+
+        if (!C3D_TexInit(&texture->tex, potWidth, potHeight, gpuFormat))
+        {
+            TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Failed to allocate texture memory (%ix%i)", C3DGL->texture, potWidth, potHeight);
+            c3dglSetError(GL_OUT_OF_MEMORY);
+            return;
+        }
+
+        texture->ready = true;
+        texture->frame = 0;
+        C3D_TexSetFilter(&texture->tex, texture->magFilter, texture->minFilter);
+        C3D_TexSetWrap(&texture->tex, texture->wrapS, texture->wrapT);
+    }
+
+    texture->width = width;
+    texture->height = height;
+
+    if (pixels != NULL) c3dglUploadTexels(texture, 0, 0, width, height, format, type, (const unsigned char *)pixels, true);
+    else
+    {
+        memset(texture->tex.data, 0, texture->tex.size);
+        C3D_TexFlush(&texture->tex);
+    }
+}
+
+void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    if ((target != GL_TEXTURE_2D) || (level != 0) || (pixels == NULL)) return;
+    if ((C3DGL->texture == 0) || (C3DGL->activeTexture != 0)) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglTexture *texture = &C3DGL->textures[C3DGL->texture - 1];
+    GPU_TEXCOLOR gpuFormat = GPU_RGBA8;
+    int bytes = 0;
+
+    if (!texture->ready) { c3dglSetError(GL_INVALID_OPERATION); return; }
+    if (!c3dglGetTextureFormat(format, type, &gpuFormat, &bytes) || (gpuFormat != texture->tex.fmt)) { c3dglSetError(GL_INVALID_OPERATION); return; }
+    if ((xoffset < 0) || (yoffset < 0) || ((xoffset + width) > texture->width) || ((yoffset + height) > texture->height)) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    if ((texture->frame == C3DGL->frame) && (texture->attachments == 0)) c3dglOrphanTexture(texture);
+
+    c3dglUploadTexels(texture, xoffset, yoffset, width, height, format, type, (const unsigned char *)pixels, false);
+}
+
+void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    (void)target; (void)level; (void)width; (void)height; (void)border; (void)imageSize; (void)data;
+
+    // NOTE: No compressed texture extension is exposed, rlgl does not use this path
+    TRACELOG(RL_LOG_WARNING, "C3DGL: Compressed texture format not supported (0x%x)", internalformat);
+    c3dglSetError(GL_INVALID_ENUM);
+}
+
+void glTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+    if ((target != GL_TEXTURE_2D) || (C3DGL->texture == 0) || (C3DGL->activeTexture != 0)) return;
+
+    c3dglTexture *texture = &C3DGL->textures[C3DGL->texture - 1];
+
+    switch (pname)
+    {
+        case GL_TEXTURE_MAG_FILTER: texture->magFilter = (param == GL_NEAREST)? GPU_NEAREST : GPU_LINEAR; break;
+        case GL_TEXTURE_MIN_FILTER: texture->minFilter = ((param == GL_NEAREST) || (param == GL_NEAREST_MIPMAP_NEAREST) || (param == GL_NEAREST_MIPMAP_LINEAR))? GPU_NEAREST : GPU_LINEAR; break;
+        case GL_TEXTURE_WRAP_S: texture->wrapS = (param == GL_CLAMP_TO_EDGE)? GPU_CLAMP_TO_EDGE : (param == GL_MIRRORED_REPEAT)? GPU_MIRRORED_REPEAT : GPU_REPEAT; break;
+        case GL_TEXTURE_WRAP_T: texture->wrapT = (param == GL_CLAMP_TO_EDGE)? GPU_CLAMP_TO_EDGE : (param == GL_MIRRORED_REPEAT)? GPU_MIRRORED_REPEAT : GPU_REPEAT; break;
+        default: return;
+    }
+
+    if (texture->ready)
+    {
+        C3D_TexSetFilter(&texture->tex, texture->magFilter, texture->minFilter);
+        C3D_TexSetWrap(&texture->tex, texture->wrapS, texture->wrapT);
+    }
+}
+
+void glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+    glTexParameteri(target, pname, (GLint)param);
+}
+
+void glGenerateMipmap(GLenum target)
+{
+    // NOTE: Mipmaps not supported, base level is used
+    (void)target;
+}
+
+void glPixelStorei(GLenum pname, GLint param)
+{
+    if (pname == GL_UNPACK_ALIGNMENT) C3DGL->unpackAlignment = param;
+    else if (pname == GL_UNPACK_ROW_LENGTH) C3DGL->unpackRowLength = param;
+    else if (pname == GL_PACK_ALIGNMENT) C3DGL->packAlignment = param;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Shaders and programs
+// NOTE: GLSL code is not compiled, all programs use default PICA200 shader
+//----------------------------------------------------------------------------------
+GLuint glCreateShader(GLenum type)
+{
+    for (int id = 0; id < C3DGL_MAX_SHADERS; id++)
+    {
+        if (!C3DGL->shaders[id].active)
+        {
+            C3DGL->shaders[id].active = true;
+            C3DGL->shaders[id].type = type;
+            return id + 1;
+        }
+    }
+
+    c3dglSetError(GL_OUT_OF_MEMORY);
+    return 0;
+}
+
+void glShaderSource(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length) { (void)shader; (void)count; (void)string; (void)length; }
+void glCompileShader(GLuint shader) { (void)shader; }
+
+void glDeleteShader(GLuint shader)
+{
+    if ((shader > 0) && (shader <= C3DGL_MAX_SHADERS)) C3DGL->shaders[shader - 1].active = false;
+}
+
+void glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    switch (pname)
+    {
+        case GL_COMPILE_STATUS: *params = GL_TRUE; break;
+        case GL_SHADER_TYPE: *params = ((shader > 0) && (shader <= C3DGL_MAX_SHADERS))? (GLint)C3DGL->shaders[shader - 1].type : 0; break;
+        default: *params = 0; break;
+    }
+}
+
+void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    (void)shader;
+
+    if (length != NULL) *length = 0;
+    if ((infoLog != NULL) && (bufSize > 0)) infoLog[0] = '\0';
+}
+
+GLuint glCreateProgram(void)
+{
+    for (int id = 0; id < C3DGL_MAX_PROGRAMS; id++)
+    {
+        if (!C3DGL->programs[id].active)
+        {
+            c3dglProgram *program = &C3DGL->programs[id];
+
+            memset(program, 0, sizeof(c3dglProgram));
+            program->active = true;
+            for (int i = 0; i < 4; i++) program->mvp[i*5] = 1.0f;
+            for (int i = 0; i < 4; i++) program->colDiffuse[i] = 1.0f;
+
+            return id + 1;
+        }
+    }
+
+    c3dglSetError(GL_OUT_OF_MEMORY);
+    return 0;
+}
+
+void glAttachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+void glDetachShader(GLuint program, GLuint shader) { (void)program; (void)shader; }
+void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { (void)program; (void)maxCount; (void)shaders; if (count != NULL) *count = 0; }
+void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { (void)program; (void)index; (void)name; }
+void glLinkProgram(GLuint program) { (void)program; }
+
+void glDeleteProgram(GLuint program)
+{
+    if ((program == 0) || (program > C3DGL_MAX_PROGRAMS)) return;
+
+    C3DGL->programs[program - 1].active = false;
+    if (C3DGL->program == program) C3DGL->program = 0;
+}
+
+void glUseProgram(GLuint program)
+{
+    if (program > C3DGL_MAX_PROGRAMS) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    C3DGL->program = program;
+}
+
+void glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+    (void)program;
+
+    switch (pname)
+    {
+        case GL_LINK_STATUS:
+        case GL_VALIDATE_STATUS: *params = GL_TRUE; break;
+        default: *params = 0; break;
+    }
+}
+
+void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    glGetShaderInfoLog(program, bufSize, length, infoLog);
+}
+
+// Get attribute location, locations match rlgl default binding
+GLint glGetAttribLocation(GLuint program, const GLchar *name)
+{
+    static const char *names[] = { "vertexPosition", "vertexTexCoord", "vertexNormal", "vertexColor", "vertexTangent", "vertexTexCoord2" };
+
+    (void)program;
+
+    for (int i = 0; i < (int)(sizeof(names)/sizeof(names[0])); i++) if (strcmp(name, names[i]) == 0) return i;
+
+    return -1;
+}
+
+// Get uniform location, only default shader uniforms are available
+GLint glGetUniformLocation(GLuint program, const GLchar *name)
+{
+    (void)program;
+
+    if (strcmp(name, "mvp") == 0) return C3DGL_UNIFORM_MVP;
+    if (strcmp(name, "colDiffuse") == 0) return C3DGL_UNIFORM_COLOR;
+    if (strcmp(name, "texture0") == 0) return C3DGL_UNIFORM_TEXTURE0;
+
+    return -1;
+}
+
+void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    (void)program; (void)index; (void)size; (void)type;
+
+    if (length != NULL) *length = 0;
+    if ((name != NULL) && (bufSize > 0)) name[0] = '\0';
+}
+
+void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Uniforms
+// NOTE: Only mvp and colDiffuse are stored (per program), other uniforms ignored
+//----------------------------------------------------------------------------------
+void glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    if ((location != C3DGL_UNIFORM_COLOR) || (count < 1) || (C3DGL->program == 0)) return;
+
+    memcpy(C3DGL->programs[C3DGL->program - 1].colDiffuse, value, 4*sizeof(float));
+}
+
+void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    float value[4] = { v0, v1, v2, v3 };
+    glUniform4fv(location, 1, value);
+}
+
+void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    if ((location != C3DGL_UNIFORM_MVP) || (count < 1) || (C3DGL->program == 0)) return;
+
+    float *mvp = C3DGL->programs[C3DGL->program - 1].mvp;
+
+    if (transpose) for (int i = 0; i < 16; i++) mvp[i] = value[(i%4)*4 + i/4];
+    else memcpy(mvp, value, 16*sizeof(float));
+}
+
+void glUniform1f(GLint location, GLfloat v0) { (void)location; (void)v0; }
+void glUniform1i(GLint location, GLint v0) { (void)location; (void)v0; }
+void glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { (void)location; (void)count; (void)value; }
+void glUniform1iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void glUniform2iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void glUniform3iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+void glUniform4iv(GLint location, GLsizei count, const GLint *value) { (void)location; (void)count; (void)value; }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Vertex attributes
+//----------------------------------------------------------------------------------
+void glEnableVertexAttribArray(GLuint index)
+{
+    if (index < C3DGL_MAX_ATTRIBS) C3DGL->attribs[index].enabled = true;
+}
+
+void glDisableVertexAttribArray(GLuint index)
+{
+    if (index < C3DGL_MAX_ATTRIBS) C3DGL->attribs[index].enabled = false;
+}
+
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    if (index >= C3DGL_MAX_ATTRIBS) return;
+
+    c3dglAttrib *attrib = &C3DGL->attribs[index];
+
+    attrib->size = size;
+    attrib->type = type;
+    attrib->normalized = normalized;
+    attrib->stride = stride;
+    attrib->pointer = pointer;
+    attrib->buffer = C3DGL->arrayBuffer;
+}
+
+void glVertexAttrib4fv(GLuint index, const GLfloat *v)
+{
+    if (index >= C3DGL_MAX_ATTRIBS) return;
+
+    memcpy(C3DGL->attribs[index].value, v, 4*sizeof(float));
+}
+
+void glVertexAttrib1fv(GLuint index, const GLfloat *v) { float value[4] = { v[0], 0.0f, 0.0f, 1.0f }; glVertexAttrib4fv(index, value); }
+void glVertexAttrib2fv(GLuint index, const GLfloat *v) { float value[4] = { v[0], v[1], 0.0f, 1.0f }; glVertexAttrib4fv(index, value); }
+void glVertexAttrib3fv(GLuint index, const GLfloat *v) { float value[4] = { v[0], v[1], v[2], 1.0f }; glVertexAttrib4fv(index, value); }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Framebuffers
+//----------------------------------------------------------------------------------
+void glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        framebuffers[i] = 0;
+
+        for (int id = 0; id < C3DGL_MAX_FRAMEBUFFERS; id++)
+        {
+            if (!C3DGL->framebuffers[id].active)
+            {
+                memset(&C3DGL->framebuffers[id], 0, sizeof(c3dglFramebuffer));
+                C3DGL->framebuffers[id].active = true;
+                framebuffers[i] = id + 1;
+                break;
+            }
+        }
+
+        if (framebuffers[i] == 0) c3dglSetError(GL_OUT_OF_MEMORY);
+    }
+}
+
+void glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if ((framebuffers[i] == 0) || (framebuffers[i] > C3DGL_MAX_FRAMEBUFFERS)) continue;
+
+        c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[framebuffers[i] - 1];
+
+        if ((framebuffer->colorTexture > 0) && C3DGL->textures[framebuffer->colorTexture - 1].active) C3DGL->textures[framebuffer->colorTexture - 1].attachments--;
+
+        c3dglDeleteTarget(framebuffer);
+        memset(framebuffer, 0, sizeof(c3dglFramebuffer));
+
+        if (C3DGL->framebuffer == framebuffers[i]) C3DGL->framebuffer = 0;
+    }
+}
+
+void glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    (void)target;
+
+    if (framebuffer > C3DGL_MAX_FRAMEBUFFERS) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    C3DGL->framebuffer = framebuffer;
+}
+
+void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    (void)target; (void)textarget; (void)level;
+
+    if (C3DGL->framebuffer == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[C3DGL->framebuffer - 1];
+
+    if (attachment == GL_COLOR_ATTACHMENT0)
+    {
+        if ((framebuffer->colorTexture > 0) && C3DGL->textures[framebuffer->colorTexture - 1].active) C3DGL->textures[framebuffer->colorTexture - 1].attachments--;
+        if ((texture > 0) && (texture <= C3DGL_MAX_TEXTURES)) C3DGL->textures[texture - 1].attachments++;
+
+        framebuffer->colorTexture = texture;
+    }
+    else if (attachment == GL_DEPTH_ATTACHMENT)
+    {
+        // NOTE: Depth textures can not be sampled, attachment is used as a depth buffer
+        framebuffer->depthTexture = texture;
+        framebuffer->depthRenderbuffer = 0;
+    }
+    else return;
+
+    framebuffer->dirty = true;
+}
+
+void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    (void)target; (void)renderbuffertarget;
+
+    if (C3DGL->framebuffer == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+    if (attachment != GL_DEPTH_ATTACHMENT) return;
+
+    c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[C3DGL->framebuffer - 1];
+
+    framebuffer->depthRenderbuffer = renderbuffer;
+    framebuffer->depthTexture = 0;
+    framebuffer->dirty = true;
+}
+
+GLenum glCheckFramebufferStatus(GLenum target)
+{
+    (void)target;
+
+    if (C3DGL->framebuffer == 0) return GL_FRAMEBUFFER_COMPLETE;
+
+    c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[C3DGL->framebuffer - 1];
+
+    if ((framebuffer->colorTexture == 0) || (framebuffer->colorTexture > C3DGL_MAX_TEXTURES)) return GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT;
+
+    c3dglTexture *texture = &C3DGL->textures[framebuffer->colorTexture - 1];
+
+    if (!texture->ready) return GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT;
+
+    // PICA200 color buffer formats
+    if ((texture->tex.fmt != GPU_RGBA8) && (texture->tex.fmt != GPU_RGB8) && (texture->tex.fmt != GPU_RGBA5551) &&
+        (texture->tex.fmt != GPU_RGB565) && (texture->tex.fmt != GPU_RGBA4)) return GL_FRAMEBUFFER_UNSUPPORTED;
+
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    (void)target;
+
+    *params = 0;
+    if (C3DGL->framebuffer == 0) return;
+
+    c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[C3DGL->framebuffer - 1];
+    GLuint textureId = (attachment == GL_COLOR_ATTACHMENT0)? framebuffer->colorTexture : (attachment == GL_DEPTH_ATTACHMENT)? framebuffer->depthTexture : 0;
+    GLuint renderbufferId = (attachment == GL_DEPTH_ATTACHMENT)? framebuffer->depthRenderbuffer : 0;
+
+    if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE) *params = (textureId > 0)? GL_TEXTURE : (renderbufferId > 0)? GL_RENDERBUFFER : GL_NONE;
+    else if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME) *params = (textureId > 0)? (GLint)textureId : (GLint)renderbufferId;
+}
+
+void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        renderbuffers[i] = 0;
+
+        for (int id = 0; id < C3DGL_MAX_RENDERBUFFERS; id++)
+        {
+            if (!C3DGL->renderbuffers[id].active)
+            {
+                memset(&C3DGL->renderbuffers[id], 0, sizeof(c3dglRenderbuffer));
+                C3DGL->renderbuffers[id].active = true;
+                renderbuffers[i] = id + 1;
+                break;
+            }
+        }
+
+        if (renderbuffers[i] == 0) c3dglSetError(GL_OUT_OF_MEMORY);
+    }
+}
+
+void glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if ((renderbuffers[i] == 0) || (renderbuffers[i] > C3DGL_MAX_RENDERBUFFERS)) continue;
+
+        C3DGL->renderbuffers[renderbuffers[i] - 1].active = false;
+        if (C3DGL->renderbuffer == renderbuffers[i]) C3DGL->renderbuffer = 0;
+    }
+}
+
+void glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    (void)target;
+
+    if (renderbuffer > C3DGL_MAX_RENDERBUFFERS) { c3dglSetError(GL_INVALID_VALUE); return; }
+
+    C3DGL->renderbuffer = renderbuffer;
+}
+
+// NOTE: Renderbuffer memory is allocated with the render target (depth buffer), only format is kept
+void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    (void)target;
+
+    if (C3DGL->renderbuffer == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    c3dglRenderbuffer *renderbuffer = &C3DGL->renderbuffers[C3DGL->renderbuffer - 1];
+
+    renderbuffer->format = internalformat;
+    renderbuffer->width = width;
+    renderbuffer->height = height;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Render state
+//----------------------------------------------------------------------------------
+static void c3dglSetCapability(GLenum cap, bool enabled)
+{
+    switch (cap)
+    {
+        case GL_BLEND: C3DGL->blend = enabled; break;
+        case GL_DEPTH_TEST: C3DGL->depthTest = enabled; break;
+        case GL_CULL_FACE: C3DGL->cullFace = enabled; break;
+        case GL_SCISSOR_TEST:
+        {
+            C3DGL->scissorTest = enabled;
+            if (C3DGL->frameActive) c3dglApplyViewport();
+        } break;
+        default: break;
+    }
+}
+
+void glEnable(GLenum cap) { c3dglSetCapability(cap, true); }
+void glDisable(GLenum cap) { c3dglSetCapability(cap, false); }
+
+void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    C3DGL->blendFactor[0] = sfactorRGB;
+    C3DGL->blendFactor[1] = dfactorRGB;
+    C3DGL->blendFactor[2] = sfactorAlpha;
+    C3DGL->blendFactor[3] = dfactorAlpha;
+}
+
+void glBlendFunc(GLenum sfactor, GLenum dfactor) { glBlendFuncSeparate(sfactor, dfactor, sfactor, dfactor); }
+
+void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    C3DGL->blendEquation[0] = modeRGB;
+    C3DGL->blendEquation[1] = modeAlpha;
+}
+
+void glBlendEquation(GLenum mode) { glBlendEquationSeparate(mode, mode); }
+void glDepthFunc(GLenum func) { C3DGL->depthFunc = func; }
+void glDepthMask(GLboolean flag) { C3DGL->depthMask = flag; }
+void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+    C3DGL->colorMask = (red? GPU_WRITE_RED : 0) | (green? GPU_WRITE_GREEN : 0) | (blue? GPU_WRITE_BLUE : 0) | (alpha? GPU_WRITE_ALPHA : 0);
+}
+void glCullFace(GLenum mode) { C3DGL->cullMode = mode; }
+void glFrontFace(GLenum mode) { C3DGL->frontFace = mode; }
+void glLineWidth(GLfloat width) { C3DGL->lineWidth = width; }
+
+void glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    C3DGL->viewport[0] = x;
+    C3DGL->viewport[1] = y;
+    C3DGL->viewport[2] = width;
+    C3DGL->viewport[3] = height;
+
+    if (C3DGL->frameActive) c3dglApplyViewport();
+}
+
+void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    C3DGL->scissor[0] = x;
+    C3DGL->scissor[1] = y;
+    C3DGL->scissor[2] = width;
+    C3DGL->scissor[3] = height;
+
+    if (C3DGL->frameActive) c3dglApplyViewport();
+}
+
+void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    C3DGL->clearColor[0] = red;
+    C3DGL->clearColor[1] = green;
+    C3DGL->clearColor[2] = blue;
+    C3DGL->clearColor[3] = alpha;
+}
+
+void glClearDepthf(GLfloat d) { C3DGL->clearDepth = d; }
+
+void glClear(GLbitfield mask)
+{
+    int bits = 0;
+    if (mask & GL_COLOR_BUFFER_BIT) bits |= C3D_CLEAR_COLOR;
+    if (mask & GL_DEPTH_BUFFER_BIT) bits |= C3D_CLEAR_DEPTH;
+    if (bits == 0) return;
+
+    unsigned int color = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        float value = (C3DGL->clearColor[i] < 0.0f)? 0.0f : (C3DGL->clearColor[i] > 1.0f)? 1.0f : C3DGL->clearColor[i];
+        color = (color << 8) | (unsigned int)(value*255.0f + 0.5f);
+    }
+
+    // NOTE: PICA200 depth range is inverted (near plane is 1.0), see c3dglUploadUniforms()
+    float depth = (C3DGL->clearDepth < 0.0f)? 0.0f : (C3DGL->clearDepth > 1.0f)? 1.0f : C3DGL->clearDepth;
+
+    // Pending draws submitted first, clear is executed in order with them
+    c3dglBeginFrame();
+    C3D_FrameSplit(0);
+
+    // NOTE: On stereo, screen clear applies to both eyes, both targets are drawn on frame and transferred
+    int eye = C3DGL->eye;
+    int eyeCount = c3dglIsStereoActive()? 2 : 1;
+
+    for (int i = 0; i < eyeCount; i++)
+    {
+        if (eyeCount == 2) C3DGL->eye = i;
+
+        c3dglBindTarget();
+
+        C3D_RenderTarget *target = c3dglGetTarget();
+        if (target != NULL) C3D_RenderTargetClear(target, (C3D_ClearBits)bits, color, (unsigned int)((1.0f - depth)*0xFFFFFF));
+    }
+
+    C3DGL->eye = eye;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Drawing
+//----------------------------------------------------------------------------------
+static GPU_Primitive_t c3dglGetPrimitive(GLenum mode)
+{
+    return (mode == GL_TRIANGLE_STRIP)? GPU_TRIANGLE_STRIP : (mode == GL_TRIANGLE_FAN)? GPU_TRIANGLE_FAN : GPU_TRIANGLES;
+}
+
+void glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    if (count <= 0) return;
+
+    if ((mode == GL_LINES) || (mode == GL_LINE_STRIP) || (mode == GL_LINE_LOOP)) { c3dglDrawLines(mode, count, GL_NONE, NULL, first); return; }
+    if (mode == GL_POINTS) return;
+
+    float colorScale = 1.0f;
+
+    c3dglBindTarget();
+    if (!c3dglSetupAttribs(first + count, &colorScale)) return;
+
+    c3dglApplyState();
+    c3dglUploadUniforms((C3DGL->program > 0)? C3DGL->programs[C3DGL->program - 1].mvp : NULL, colorScale);
+
+    C3D_DrawArrays(c3dglGetPrimitive(mode), first, count);
+}
+
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    if (count <= 0) return;
+
+    c3dglBindTarget();
+
+    // Get indices data: element buffer (offset) or client memory
+    const unsigned char *indexData = (const unsigned char *)indices;
+
+    if (C3DGL->elementBuffer > 0)
+    {
+        c3dglBuffer *buffer = &C3DGL->buffers[C3DGL->elementBuffer - 1];
+        if (buffer->data == NULL) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+        indexData = buffer->data + (size_t)indices;
+        buffer->frame = C3DGL->frame;
+    }
+
+    if ((mode == GL_LINES) || (mode == GL_LINE_STRIP) || (mode == GL_LINE_LOOP)) { c3dglDrawLines(mode, count, type, indexData, 0); return; }
+    if (mode == GL_POINTS) return;
+
+    // Vertex count required for client arrays, maximum index referenced
+    int maxIndex = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int index = (type == GL_UNSIGNED_BYTE)? indexData[i] : (type == GL_UNSIGNED_SHORT)? ((const unsigned short *)indexData)[i] : (int)((const unsigned int *)indexData)[i];
+        if (index > maxIndex) maxIndex = index;
+    }
+
+    float colorScale = 1.0f;
+
+    if (!c3dglSetupAttribs(maxIndex + 1, &colorScale)) return;
+
+    // PICA200 indices must be in linear memory, 32-bit indices not supported (converted)
+    const void *gpuIndices = indexData;
+    int gpuType = (type == GL_UNSIGNED_BYTE)? C3D_UNSIGNED_BYTE : C3D_UNSIGNED_SHORT;
+    int indexSize = (type == GL_UNSIGNED_BYTE)? 1 : 2;
+
+    if ((type == GL_UNSIGNED_INT) || (C3DGL->elementBuffer == 0))
+    {
+        unsigned short *transient = (unsigned short *)c3dglAllocTransient(count*indexSize);
+        if (transient == NULL) return;
+
+        if (type == GL_UNSIGNED_INT) for (int i = 0; i < count; i++) transient[i] = (unsigned short)((const unsigned int *)indexData)[i];
+        else memcpy(transient, indexData, count*indexSize);
+
+        GSPGPU_FlushDataCache(transient, count*indexSize);
+        gpuIndices = transient;
+    }
+
+    c3dglApplyState();
+    c3dglUploadUniforms((C3DGL->program > 0)? C3DGL->programs[C3DGL->program - 1].mvp : NULL, colorScale);
+
+    C3D_DrawElements(c3dglGetPrimitive(mode), count, gpuType, gpuIndices);
+}
+
+// Read pixels from current render target (only RGBA/UNSIGNED_BYTE)
+void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    if ((format != GL_RGBA) || (type != GL_UNSIGNED_BYTE)) { c3dglSetError(GL_INVALID_ENUM); return; }
+
+    c3dglBindTarget();
+
+    C3D_RenderTarget *target = c3dglGetTarget();
+    if (target == NULL) return;
+
+    // Wait for all pending rendering to finish
+    C3D_FrameSplit(0);
+    gspWaitForP3D();
+
+    C3D_FrameBuf *frameBuf = &target->frameBuf;
+    int bytes = (frameBuf->colorFmt == GPU_RB_RGBA8)? 4 : (frameBuf->colorFmt == GPU_RB_RGB8)? 3 : 0;
+
+    if (bytes == 0) { c3dglSetError(GL_INVALID_OPERATION); return; }
+
+    GSPGPU_InvalidateDataCache(frameBuf->colorBuf, frameBuf->width*frameBuf->height*bytes);
+
+    const unsigned char *colorBuf = (const unsigned char *)frameBuf->colorBuf;
+    unsigned char *output = (unsigned char *)pixels;
+    int rowSize = ((width*4 + C3DGL->packAlignment - 1)/C3DGL->packAlignment)*C3DGL->packAlignment;
+    bool rotated = c3dglIsScreenTarget(target);
+
+    for (int j = 0; j < height; j++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            // Screen framebuffer is rotated: framebuffer x is screen y, framebuffer y is screen width - x
+            int fx = rotated? (y + j) : (x + i);
+            int fy = rotated? (C3DGL->screenWidth - 1 - (x + i)) : (y + j);
+            unsigned char *dst = output + j*rowSize + i*4;
+
+            if ((fx < 0) || (fy < 0) || (fx >= frameBuf->width) || (fy >= frameBuf->height)) { memset(dst, 0, 4); continue; }
+
+            const unsigned char *src = colorBuf + c3dglTileOffset(fx, fy, frameBuf->width)*bytes;
+
+            // PICA200 components are stored in reverse order
+            if (bytes == 4) { dst[0] = src[3]; dst[1] = src[2]; dst[2] = src[1]; dst[3] = src[0]; }
+            else { dst[0] = src[2]; dst[1] = src[1]; dst[2] = src[0]; dst[3] = 255; }
+        }
+    }
+}
+
+void glFlush(void) { }
+
+void glFinish(void)
+{
+    if (!C3DGL->frameActive) return;
+
+    C3D_FrameSplit(0);
+    gspWaitForP3D();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Queries
+//----------------------------------------------------------------------------------
+GLenum glGetError(void)
+{
+    GLenum error = C3DGL->error;
+    C3DGL->error = GL_NO_ERROR;
+
+    return error;
+}
+
+const GLubyte *glGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"DMP";
+        case GL_RENDERER: return (const GLubyte *)"PICA200 (citro3d)";
+        case GL_VERSION: return (const GLubyte *)"OpenGL ES 2.0 (citro3d)";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"OpenGL ES GLSL ES 1.00 (not compiled)";
+        case GL_EXTENSIONS: return (const GLubyte *)"GL_OES_texture_npot";      // Non-power-of-two textures emulated with padding
+        default: break;
+    }
+
+    c3dglSetError(GL_INVALID_ENUM);
+    return (const GLubyte *)"";
+}
+
+void glGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_MAX_TEXTURE_SIZE:
+        case GL_MAX_RENDERBUFFER_SIZE: data[0] = C3DGL_MAX_TEXTURE_SIZE; break;
+        case GL_MAX_VIEWPORT_DIMS: data[0] = C3DGL_MAX_TEXTURE_SIZE; data[1] = C3DGL_MAX_TEXTURE_SIZE; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 1; break;
+        case GL_MAX_VERTEX_ATTRIBS: data[0] = C3DGL_MAX_ATTRIBS; break;
+        case GL_VIEWPORT: memcpy(data, C3DGL->viewport, 4*sizeof(int)); break;
+        case GL_SCISSOR_BOX: memcpy(data, C3DGL->scissor, 4*sizeof(int)); break;
+        case GL_FRAMEBUFFER_BINDING: data[0] = (GLint)C3DGL->framebuffer; break;
+        case GL_RENDERBUFFER_BINDING: data[0] = (GLint)C3DGL->renderbuffer; break;
+        case GL_UNPACK_ALIGNMENT: data[0] = C3DGL->unpackAlignment; break;
+        case GL_UNPACK_ROW_LENGTH: data[0] = C3DGL->unpackRowLength; break;
+        case GL_PACK_ALIGNMENT: data[0] = C3DGL->packAlignment; break;
+        case GL_COMPRESSED_TEXTURE_FORMATS: break;
+        default: data[0] = 0; break;
+    }
+}
+
+void glGetFloatv(GLenum pname, GLfloat *data)
+{
+    if (pname == GL_LINE_WIDTH) data[0] = C3DGL->lineWidth;
+    else data[0] = 0.0f;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Set error, only first error is kept until queried
+static void c3dglSetError(GLenum error)
+{
+    if (C3DGL->error == GL_NO_ERROR) C3DGL->error = error;
+}
+
+// Begin frame if required, retired resources released
+static void c3dglBeginFrame(void)
+{
+    if (C3DGL->frameActive) return;
+
+    // NOTE: Frame begin waits for previous frame rendering to finish
+    C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+    C3DGL->frameActive = true;
+    C3DGL->frame++;
+    C3DGL->drawTarget = NULL;
+
+    c3dglReleaseRetired(false);
+}
+
+// Retire resource, released once GPU is done with it
+static void c3dglRetire(int type, void *memory, const C3D_Tex *tex, C3D_RenderTarget *target)
+{
+    if (C3DGL->retiredCount >= C3DGL->retiredCapacity)
+    {
+        int capacity = (C3DGL->retiredCapacity > 0)? C3DGL->retiredCapacity*2 : 64;
+        c3dglRetired *retired = (c3dglRetired *)RL_REALLOC(C3DGL->retired, capacity*sizeof(c3dglRetired));
+
+        // NOTE: On allocation failure, GPU work is waited and resource is released directly
+        if (retired == NULL)
+        {
+            if (C3DGL->frameActive) { C3D_FrameSplit(0); gspWaitForP3D(); }
+
+            if (type == C3DGL_RETIRED_MEMORY) linearFree(memory);
+            else if (type == C3DGL_RETIRED_TEXTURE) C3D_TexDelete((C3D_Tex *)tex);
+            else if (!C3DGL->frameActive) C3D_RenderTargetDelete(target);
+            return;
+        }
+
+        C3DGL->retired = retired;
+        C3DGL->retiredCapacity = capacity;
+    }
+
+    c3dglRetired *item = &C3DGL->retired[C3DGL->retiredCount];
+
+    item->type = type;
+    item->memory = memory;
+    if (tex != NULL) item->tex = *tex;
+    item->target = target;
+    C3DGL->retiredCount++;
+}
+
+// Release retired resources, render targets can only be deleted outside frame
+static void c3dglReleaseRetired(bool targets)
+{
+    int kept = 0;
+
+    for (int i = 0; i < C3DGL->retiredCount; i++)
+    {
+        c3dglRetired *item = &C3DGL->retired[i];
+
+        if (item->type == C3DGL_RETIRED_MEMORY) linearFree(item->memory);
+        else if (item->type == C3DGL_RETIRED_TEXTURE) C3D_TexDelete(&item->tex);
+        else if (targets) C3D_RenderTargetDelete(item->target);
+        else C3DGL->retired[kept++] = *item;
+    }
+
+    C3DGL->retiredCount = kept;
+}
+
+// Allocate linear memory valid for current frame
+static void *c3dglAllocTransient(int size)
+{
+    void *memory = linearAlloc(size);
+
+    if (memory == NULL)
+    {
+        TRACELOG(RL_LOG_WARNING, "C3DGL: Failed to allocate transient memory (%i bytes)", size);
+        c3dglSetError(GL_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    c3dglRetire(C3DGL_RETIRED_MEMORY, memory, NULL, NULL);
+
+    return memory;
+}
+
+// Delete framebuffer render target, retired if frame is active
+static void c3dglDeleteTarget(c3dglFramebuffer *framebuffer)
+{
+    if (framebuffer->target == NULL) return;
+
+    if (C3DGL->drawTarget == framebuffer->target) C3DGL->drawTarget = NULL;
+
+    if (C3DGL->frameActive) c3dglRetire(C3DGL_RETIRED_TARGET, NULL, NULL, framebuffer->target);
+    else C3D_RenderTargetDelete(framebuffer->target);
+
+    framebuffer->target = NULL;
+}
+
+// Get render target for current framebuffer, created if required
+static C3D_RenderTarget *c3dglGetTarget(void)
+{
+    if (C3DGL->framebuffer == 0) return ((C3DGL->eye == 1) && (C3DGL->screenRight != NULL))? C3DGL->screenRight : C3DGL->screen;
+
+    c3dglFramebuffer *framebuffer = &C3DGL->framebuffers[C3DGL->framebuffer - 1];
+
+    if ((framebuffer->target != NULL) && !framebuffer->dirty) return framebuffer->target;
+
+    c3dglDeleteTarget(framebuffer);
+    framebuffer->dirty = false;
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) return NULL;
+
+    c3dglTexture *texture = &C3DGL->textures[framebuffer->colorTexture - 1];
+    int depthFormat = -1;
+
+    if (framebuffer->depthTexture > 0) depthFormat = GPU_RB_DEPTH24_STENCIL8;
+    else if ((framebuffer->depthRenderbuffer > 0) && (framebuffer->depthRenderbuffer <= C3DGL_MAX_RENDERBUFFERS))
+    {
+        GLenum format = C3DGL->renderbuffers[framebuffer->depthRenderbuffer - 1].format;
+
+        depthFormat = (format == GL_DEPTH_COMPONENT16)? GPU_RB_DEPTH16 : (format == GL_DEPTH24_STENCIL8_OES)? GPU_RB_DEPTH24_STENCIL8 : GPU_RB_DEPTH24;
+    }
+
+    framebuffer->target = C3D_RenderTargetCreateFromTex(&texture->tex, GPU_TEXFACE_2D, 0, depthFormat);
+
+    if (framebuffer->target == NULL) TRACELOG(RL_LOG_WARNING, "C3DGL: [ID %i] Failed to create render target", C3DGL->framebuffer);
+
+    return framebuffer->target;
+}
+
+// Check if render target is a screen eye target (rotated)
+static bool c3dglIsScreenTarget(const C3D_RenderTarget *target)
+{
+    return ((target != NULL) && ((target == C3DGL->screen) || (target == C3DGL->screenRight)));
+}
+
+// Bind current render target for drawing, frame started if required
+static void c3dglBindTarget(void)
+{
+    c3dglBeginFrame();
+
+    C3D_RenderTarget *target = c3dglGetTarget();
+
+    if ((target != NULL) && (target != C3DGL->drawTarget))
+    {
+        C3D_FrameDrawOn(target);
+        C3DGL->drawTarget = target;
+
+        // NOTE: C3D_FrameDrawOn() resets viewport to target size
+        c3dglApplyViewport();
+    }
+}
+
+// Apply viewport and scissor to current render target
+// NOTE: Screen framebuffer is rotated (portrait), rectangle coordinates are swapped
+static void c3dglApplyViewport(void)
+{
+    if (C3DGL->drawTarget == NULL) return;
+
+    const int *vp = C3DGL->viewport;
+    const int *sc = C3DGL->scissor;
+
+    if (c3dglIsScreenTarget(C3DGL->drawTarget))
+    {
+        int width = C3DGL->screenWidth;
+
+        C3D_SetViewport(vp[1], width - vp[0] - vp[2], vp[3], vp[2]);
+
+        if (C3DGL->scissorTest) C3D_SetScissor(GPU_SCISSOR_NORMAL, sc[1], width - sc[0] - sc[2], sc[1] + sc[3], width - sc[0]);
+        else C3D_SetScissor(GPU_SCISSOR_DISABLE, 0, 0, 0, 0);
+    }
+    else
+    {
+        C3D_SetViewport(vp[0], vp[1], vp[2], vp[3]);
+
+        if (C3DGL->scissorTest) C3D_SetScissor(GPU_SCISSOR_NORMAL, sc[0], sc[1], sc[0] + sc[2], sc[1] + sc[3]);
+        else C3D_SetScissor(GPU_SCISSOR_DISABLE, 0, 0, 0, 0);
+    }
+}
+
+static GPU_BLENDFACTOR c3dglGetBlendFactor(GLenum factor)
+{
+    switch (factor)
+    {
+        case GL_ZERO: return GPU_ZERO;
+        case GL_ONE: return GPU_ONE;
+        case GL_SRC_COLOR: return GPU_SRC_COLOR;
+        case GL_ONE_MINUS_SRC_COLOR: return GPU_ONE_MINUS_SRC_COLOR;
+        case GL_DST_COLOR: return GPU_DST_COLOR;
+        case GL_ONE_MINUS_DST_COLOR: return GPU_ONE_MINUS_DST_COLOR;
+        case GL_SRC_ALPHA: return GPU_SRC_ALPHA;
+        case GL_ONE_MINUS_SRC_ALPHA: return GPU_ONE_MINUS_SRC_ALPHA;
+        case GL_DST_ALPHA: return GPU_DST_ALPHA;
+        case GL_ONE_MINUS_DST_ALPHA: return GPU_ONE_MINUS_DST_ALPHA;
+        case GL_CONSTANT_COLOR: return GPU_CONSTANT_COLOR;
+        case GL_ONE_MINUS_CONSTANT_COLOR: return GPU_ONE_MINUS_CONSTANT_COLOR;
+        case GL_CONSTANT_ALPHA: return GPU_CONSTANT_ALPHA;
+        case GL_ONE_MINUS_CONSTANT_ALPHA: return GPU_ONE_MINUS_CONSTANT_ALPHA;
+        case GL_SRC_ALPHA_SATURATE: return GPU_SRC_ALPHA_SATURATE;
+        default: return GPU_ONE;
+    }
+}
+
+static GPU_BLENDEQUATION c3dglGetBlendEquation(GLenum equation)
+{
+    switch (equation)
+    {
+        case GL_FUNC_SUBTRACT: return GPU_BLEND_SUBTRACT;
+        case GL_FUNC_REVERSE_SUBTRACT: return GPU_BLEND_REVERSE_SUBTRACT;
+        case GL_MIN: return GPU_BLEND_MIN;
+        case GL_MAX: return GPU_BLEND_MAX;
+        default: return GPU_BLEND_ADD;
+    }
+}
+
+// Apply blending, depth and culling state
+static void c3dglApplyState(void)
+{
+    if (C3DGL->blend)
+    {
+        C3D_AlphaBlend(c3dglGetBlendEquation(C3DGL->blendEquation[0]), c3dglGetBlendEquation(C3DGL->blendEquation[1]),
+            c3dglGetBlendFactor(C3DGL->blendFactor[0]), c3dglGetBlendFactor(C3DGL->blendFactor[1]),
+            c3dglGetBlendFactor(C3DGL->blendFactor[2]), c3dglGetBlendFactor(C3DGL->blendFactor[3]));
+    }
+    else C3D_AlphaBlend(GPU_BLEND_ADD, GPU_BLEND_ADD, GPU_ONE, GPU_ZERO, GPU_ONE, GPU_ZERO);
+
+    if (C3DGL->depthTest)
+    {
+        // NOTE: PICA200 depth range is inverted (near plane is 1.0), comparison functions are reversed
+        GPU_TESTFUNC func = GPU_ALWAYS;
+
+        switch (C3DGL->depthFunc)
+        {
+            case GL_NEVER: func = GPU_NEVER; break;
+            case GL_LESS: func = GPU_GREATER; break;
+            case GL_EQUAL: func = GPU_EQUAL; break;
+            case GL_LEQUAL: func = GPU_GEQUAL; break;
+            case GL_GREATER: func = GPU_LESS; break;
+            case GL_NOTEQUAL: func = GPU_NOTEQUAL; break;
+            case GL_GEQUAL: func = GPU_LEQUAL; break;
+            default: break;
+        }
+
+        C3D_DepthTest(true, func, C3DGL->colorMask | (C3DGL->depthMask? GPU_WRITE_DEPTH : 0));
+    }
+    else C3D_DepthTest(false, GPU_ALWAYS, C3DGL->colorMask);
+
+    GPU_CULLMODE cull = GPU_CULL_NONE;
+
+    if (C3DGL->cullFace)
+    {
+        if (C3DGL->cullMode == GL_BACK) cull = (C3DGL->frontFace == GL_CCW)? GPU_CULL_BACK_CCW : GPU_CULL_FRONT_CCW;
+        else if (C3DGL->cullMode == GL_FRONT) cull = (C3DGL->frontFace == GL_CCW)? GPU_CULL_FRONT_CCW : GPU_CULL_BACK_CCW;
+    }
+
+    C3D_CullFace(cull);
+
+    // Texture combiner: texture modulated by vertex color, or vertex color only
+    c3dglTexture *texture = ((C3DGL->texture > 0) && C3DGL->textures[C3DGL->texture - 1].ready)? &C3DGL->textures[C3DGL->texture - 1] : NULL;
+    C3D_TexEnv *env = C3D_GetTexEnv(0);
+
+    C3D_TexEnvInit(env);
+
+    if (texture != NULL)
+    {
+        C3D_TexBind(0, &texture->tex);
+        C3D_TexEnvSrc(env, C3D_Both, GPU_TEXTURE0, GPU_PRIMARY_COLOR, 0);
+        C3D_TexEnvFunc(env, C3D_Both, GPU_MODULATE);
+
+        texture->frame = C3DGL->frame;
+    }
+    else
+    {
+        C3D_TexEnvSrc(env, C3D_Both, GPU_PRIMARY_COLOR, 0, 0);
+        C3D_TexEnvFunc(env, C3D_Both, GPU_REPLACE);
+    }
+}
+
+// Upload default shader uniforms for draw
+// NOTE: GL matrix is converted to PICA200 clip space: depth range [-1, 0] (near plane at -1, inverted
+// depth test functions) and screen framebuffer rotation
+static void c3dglUploadUniforms(const float *mvp, float colorScale)
+{
+    static const float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    if (mvp == NULL) mvp = identity;
+
+    C3D_FVec rows[4] = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        rows[i].x = mvp[i];
+        rows[i].y = mvp[4 + i];
+        rows[i].z = mvp[8 + i];
+        rows[i].w = mvp[12 + i];
+    }
+
+    for (int c = 0; c < 4; c++) rows[2].c[c] = 0.5f*rows[2].c[c] - 0.5f*rows[3].c[c];
+
+    if (c3dglIsScreenTarget(C3DGL->drawTarget))
+    {
+        C3D_FVec row0 = rows[0];
+
+        rows[0] = rows[1];
+        for (int c = 0; c < 4; c++) rows[1].c[c] = -row0.c[c];
+    }
+
+    memcpy(C3D_FVUnifWritePtr(GPU_VERTEX_SHADER, C3DGL->locMvp, 4), rows, sizeof(rows));
+
+    static const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const float *color = (C3DGL->program > 0)? C3DGL->programs[C3DGL->program - 1].colDiffuse : white;
+    C3D_FVec *colDiffuse = C3D_FVUnifWritePtr(GPU_VERTEX_SHADER, C3DGL->locColor, 1);
+
+    colDiffuse->x = color[0];
+    colDiffuse->y = color[1];
+    colDiffuse->z = color[2];
+    colDiffuse->w = color[3];
+
+    // Texture coordinates scale (padded textures) and vertex color scale (unsigned byte colors)
+    c3dglTexture *texture = ((C3DGL->texture > 0) && C3DGL->textures[C3DGL->texture - 1].ready)? &C3DGL->textures[C3DGL->texture - 1] : NULL;
+    C3D_FVec *scale = C3D_FVUnifWritePtr(GPU_VERTEX_SHADER, C3DGL->locScale, 1);
+
+    scale->x = (texture != NULL)? (float)texture->width/texture->tex.width : 1.0f;
+    scale->y = (texture != NULL)? (float)texture->height/texture->tex.height : 1.0f;
+    scale->z = colorScale;
+    scale->w = 1.0f;
+}
+
+// Setup vertex attribute loaders for draw
+// NOTE: GL locations 0 (position), 1 (texcoord) and 3 (color) are loaded into PICA200 registers v0, v1, v2
+static bool c3dglSetupAttribs(int vertexCount, float *colorScale)
+{
+    static const int locations[3] = { C3DGL_ATTRIB_POSITION, C3DGL_ATTRIB_TEXCOORD, C3DGL_ATTRIB_COLOR };
+
+    C3D_AttrInfo *attrInfo = C3D_GetAttrInfo();
+    C3D_BufInfo *bufInfo = C3D_GetBufInfo();
+
+    AttrInfo_Init(attrInfo);
+    BufInfo_Init(bufInfo);
+    *colorScale = 1.0f;
+
+    for (int reg = 0; reg < 3; reg++)
+    {
+        c3dglAttrib *attrib = &C3DGL->attribs[locations[reg]];
+        GPU_FORMATS format = GPU_FLOAT;
+        int componentSize = 4;
+        bool loader = attrib->enabled;
+
+        if (loader)
+        {
+            switch (attrib->type)
+            {
+                case GL_FLOAT: format = GPU_FLOAT; componentSize = 4; break;
+                case GL_UNSIGNED_BYTE: format = GPU_UNSIGNED_BYTE; componentSize = 1; break;
+                case GL_BYTE: format = GPU_BYTE; componentSize = 1; break;
+                case GL_SHORT: format = GPU_SHORT; componentSize = 2; break;
+                default: loader = false; break;
+            }
+        }
+
+        if (!loader)
+        {
+            int id = AttrInfo_AddFixed(attrInfo, reg);
+            C3D_FixedAttribSet(id, attrib->value[0], attrib->value[1], attrib->value[2], attrib->value[3]);
+            continue;
+        }
+
+        int stride = (attrib->stride > 0)? attrib->stride : attrib->size*componentSize;
+        const unsigned char *data = NULL;
+
+        if (attrib->buffer > 0)
+        {
+            c3dglBuffer *buffer = &C3DGL->buffers[attrib->buffer - 1];
+            if (!buffer->active || (buffer->data == NULL)) { c3dglSetError(GL_INVALID_OPERATION); return false; }
+
+            data = buffer->data + (size_t)attrib->pointer;
+            buffer->frame = C3DGL->frame;
+        }
+        else
+        {
+            // Client memory array, copied to linear memory
+            unsigned char *transient = (unsigned char *)c3dglAllocTransient(vertexCount*stride);
+            if (transient == NULL) return false;
+
+            memcpy(transient, attrib->pointer, vertexCount*stride);
+            GSPGPU_FlushDataCache(transient, vertexCount*stride);
+            data = transient;
+        }
+
+        int id = AttrInfo_AddLoader(attrInfo, reg, format, attrib->size);
+        BufInfo_Add(bufInfo, data, stride, 1, id);
+
+        if ((reg == 2) && (format == GPU_UNSIGNED_BYTE) && attrib->normalized) *colorScale = 1.0f/255.0f;
+    }
+
+    return true;
+}
+
+// Get vertex attribute value as floats (normalized if required)
+static void c3dglFetchAttrib(int index, int vertex, float *value)
+{
+    c3dglAttrib *attrib = &C3DGL->attribs[index];
+
+    memcpy(value, attrib->value, 4*sizeof(float));
+    if (!attrib->enabled) return;
+
+    int componentSize = (attrib->type == GL_FLOAT)? 4 : ((attrib->type == GL_SHORT) || (attrib->type == GL_UNSIGNED_SHORT))? 2 : 1;
+    int stride = (attrib->stride > 0)? attrib->stride : attrib->size*componentSize;
+    const unsigned char *data = (const unsigned char *)attrib->pointer;
+
+    if (attrib->buffer > 0)
+    {
+        c3dglBuffer *buffer = &C3DGL->buffers[attrib->buffer - 1];
+        if (buffer->data == NULL) return;
+
+        data = buffer->data + (size_t)attrib->pointer;
+    }
+
+    data += vertex*stride;
+    value[0] = 0.0f; value[1] = 0.0f; value[2] = 0.0f; value[3] = 1.0f;
+
+    for (int c = 0; (c < attrib->size) && (c < 4); c++)
+    {
+        switch (attrib->type)
+        {
+            case GL_FLOAT: memcpy(&value[c], data + c*4, 4); break;
+            case GL_UNSIGNED_BYTE: value[c] = attrib->normalized? data[c]/255.0f : data[c]; break;
+            case GL_BYTE: value[c] = attrib->normalized? ((signed char)data[c])/127.0f : (signed char)data[c]; break;
+            case GL_SHORT: { short v = 0; memcpy(&v, data + c*2, 2); value[c] = attrib->normalized? v/32767.0f : v; } break;
+            case GL_UNSIGNED_SHORT: { unsigned short v = 0; memcpy(&v, data + c*2, 2); value[c] = attrib->normalized? v/65535.0f : v; } break;
+            default: break;
+        }
+    }
+}
+
+// Draw lines expanded into triangles (PICA200 has no lines primitive)
+// NOTE: Vertices are transformed on CPU, each segment is a screen aligned quad of lineWidth pixels
+static void c3dglDrawLines(GLenum mode, int count, GLenum type, const void *indices, int first)
+{
+    int segmentCount = (mode == GL_LINES)? count/2 : (mode == GL_LINE_STRIP)? count - 1 : count;
+    if ((segmentCount <= 0) || (count < 2)) return;
+
+    c3dglBindTarget();
+
+    c3dglVertex *vertices = (c3dglVertex *)c3dglAllocTransient(segmentCount*6*sizeof(c3dglVertex));
+    if (vertices == NULL) return;
+
+    const float *mvp = (C3DGL->program > 0)? C3DGL->programs[C3DGL->program - 1].mvp : NULL;
+    float halfWidth = ((C3DGL->lineWidth > 0.0f)? C3DGL->lineWidth : 1.0f)*0.5f;
+    float viewportWidth = (C3DGL->viewport[2] > 0)? (float)C3DGL->viewport[2] : 1.0f;
+    float viewportHeight = (C3DGL->viewport[3] > 0)? (float)C3DGL->viewport[3] : 1.0f;
+
+    for (int s = 0; s < segmentCount; s++)
+    {
+        int ends[2] = { (mode == GL_LINES)? s*2 : s, (mode == GL_LINES)? s*2 + 1 : (s + 1)%count };
+        c3dglVertex line[2] = { 0 };
+
+        for (int e = 0; e < 2; e++)
+        {
+            int vertex = ends[e];
+
+            if (indices != NULL) vertex = (type == GL_UNSIGNED_BYTE)? ((const unsigned char *)indices)[vertex] :
+                (type == GL_UNSIGNED_SHORT)? ((const unsigned short *)indices)[vertex] : (int)((const unsigned int *)indices)[vertex];
+            else vertex += first;
+
+            float position[4] = { 0 };
+            float value[4] = { 0 };
+
+            c3dglFetchAttrib(C3DGL_ATTRIB_POSITION, vertex, position);
+            c3dglFetchAttrib(C3DGL_ATTRIB_TEXCOORD, vertex, value);
+            line[e].texcoord[0] = value[0];
+            line[e].texcoord[1] = value[1];
+            c3dglFetchAttrib(C3DGL_ATTRIB_COLOR, vertex, line[e].color);
+
+            for (int r = 0; r < 4; r++)
+            {
+                line[e].position[r] = (mvp != NULL)? (mvp[r]*position[0] + mvp[4 + r]*position[1] + mvp[8 + r]*position[2] + mvp[12 + r]*position[3]) : position[r];
+            }
+        }
+
+        // Segment direction in pixels, offset perpendicular to it by half line width
+        float w0 = (line[0].position[3] != 0.0f)? line[0].position[3] : 1.0f;
+        float w1 = (line[1].position[3] != 0.0f)? line[1].position[3] : 1.0f;
+        float dx = (line[1].position[0]/w1 - line[0].position[0]/w0)*viewportWidth*0.5f;
+        float dy = (line[1].position[1]/w1 - line[0].position[1]/w0)*viewportHeight*0.5f;
+        float length = sqrtf(dx*dx + dy*dy);
+
+        if (length > 0.0f) { dx /= length; dy /= length; }
+        else { dx = 1.0f; dy = 0.0f; }
+
+        float nx = -dy*halfWidth*2.0f/viewportWidth;
+        float ny = dx*halfWidth*2.0f/viewportHeight;
+
+        c3dglVertex quad[4] = { line[0], line[0], line[1], line[1] };
+
+        quad[0].position[0] += nx*w0; quad[0].position[1] += ny*w0;
+        quad[1].position[0] -= nx*w0; quad[1].position[1] -= ny*w0;
+        quad[2].position[0] -= nx*w1; quad[2].position[1] -= ny*w1;
+        quad[3].position[0] += nx*w1; quad[3].position[1] += ny*w1;
+
+        c3dglVertex *output = vertices + s*6;
+        output[0] = quad[0]; output[1] = quad[1]; output[2] = quad[2];
+        output[3] = quad[0]; output[4] = quad[2]; output[5] = quad[3];
+    }
+
+    GSPGPU_FlushDataCache(vertices, segmentCount*6*sizeof(c3dglVertex));
+
+    C3D_AttrInfo *attrInfo = C3D_GetAttrInfo();
+    C3D_BufInfo *bufInfo = C3D_GetBufInfo();
+
+    AttrInfo_Init(attrInfo);
+    AttrInfo_AddLoader(attrInfo, 0, GPU_FLOAT, 4);
+    AttrInfo_AddLoader(attrInfo, 1, GPU_FLOAT, 2);
+    AttrInfo_AddLoader(attrInfo, 2, GPU_FLOAT, 4);
+    BufInfo_Init(bufInfo);
+    BufInfo_Add(bufInfo, vertices, sizeof(c3dglVertex), 3, 0x210);
+
+    // Vertices already in clip space, line quads are not culled
+    bool cullFace = C3DGL->cullFace;
+    C3DGL->cullFace = false;
+    c3dglApplyState();
+    C3DGL->cullFace = cullFace;
+
+    c3dglUploadUniforms(NULL, 1.0f);
+
+    C3D_DrawArrays(GPU_TRIANGLES, 0, segmentCount*6);
+}
+
+// Get PICA200 texture format and source bytes per pixel for GL format/type
+static bool c3dglGetTextureFormat(GLenum format, GLenum type, GPU_TEXCOLOR *gpuFormat, int *bytes)
+{
+    if (type == GL_UNSIGNED_BYTE)
+    {
+        switch (format)
+        {
+            case GL_RGBA: *gpuFormat = GPU_RGBA8; *bytes = 4; return true;
+            case GL_RGB: *gpuFormat = GPU_RGB8; *bytes = 3; return true;
+            case GL_LUMINANCE_ALPHA: *gpuFormat = GPU_LA8; *bytes = 2; return true;
+            case GL_LUMINANCE: *gpuFormat = GPU_L8; *bytes = 1; return true;
+            case GL_ALPHA: *gpuFormat = GPU_A8; *bytes = 1; return true;
+            default: return false;
+        }
+    }
+
+    // NOTE: Packed 16-bit formats use the same bits layout on PICA200
+    if ((type == GL_UNSIGNED_SHORT_5_6_5) && (format == GL_RGB)) { *gpuFormat = GPU_RGB565; *bytes = 2; return true; }
+    if ((type == GL_UNSIGNED_SHORT_5_5_5_1) && (format == GL_RGBA)) { *gpuFormat = GPU_RGBA5551; *bytes = 2; return true; }
+    if ((type == GL_UNSIGNED_SHORT_4_4_4_4) && (format == GL_RGBA)) { *gpuFormat = GPU_RGBA4; *bytes = 2; return true; }
+
+    return false;
+}
+
+// Upload texels region into tiled texture memory
+// NOTE: Components order reversed for byte formats, padding replicates edge texels (filtering at borders)
+static void c3dglUploadTexels(c3dglTexture *texture, int x, int y, int width, int height, GLenum format, GLenum type, const unsigned char *pixels, bool padding)
+{
+    GPU_TEXCOLOR gpuFormat = GPU_RGBA8;
+    int bytes = 0;
+
+    c3dglGetTextureFormat(format, type, &gpuFormat, &bytes);
+
+    int alignment = (C3DGL->unpackAlignment > 0)? C3DGL->unpackAlignment : 1;
+    int rowLength = (C3DGL->unpackRowLength > 0)? C3DGL->unpackRowLength : width;
+    int rowSize = ((rowLength*bytes + alignment - 1)/alignment)*alignment;
+    int potWidth = texture->tex.width;
+    int endX = padding? potWidth : (x + width);
+    int endY = padding? texture->tex.height : (y + height);
+    unsigned char *data = (unsigned char *)texture->tex.data;
+    bool reverse = (type == GL_UNSIGNED_BYTE) && (bytes > 1);
+
+    for (int ty = y; ty < endY; ty++)
+    {
+        int sy = ((ty - y) < height)? (ty - y) : (height - 1);
+
+        for (int tx = x; tx < endX; tx++)
+        {
+            int sx = ((tx - x) < width)? (tx - x) : (width - 1);
+            const unsigned char *src = pixels + sy*rowSize + sx*bytes;
+            unsigned char *dst = data + c3dglTileOffset(tx, ty, potWidth)*bytes;
+
+            if (reverse) for (int c = 0; c < bytes; c++) dst[c] = src[bytes - 1 - c];
+            else memcpy(dst, src, bytes);
+        }
+    }
+
+    C3D_TexFlush(&texture->tex);
+}
+
+// Replace texture memory, previous one retired (GPU could be reading it)
+static void c3dglOrphanTexture(c3dglTexture *texture)
+{
+    C3D_Tex tex = { 0 };
+
+    if (!C3D_TexInit(&tex, texture->tex.width, texture->tex.height, texture->tex.fmt))
+    {
+        // NOTE: On allocation failure, previous memory is updated in place
+        TRACELOG(RL_LOG_WARNING, "C3DGL: Failed to orphan texture memory (%ix%i)", texture->tex.width, texture->tex.height);
+        return;
+    }
+
+    memcpy(tex.data, texture->tex.data, texture->tex.size);
+    C3D_TexSetFilter(&tex, texture->magFilter, texture->minFilter);
+    C3D_TexSetWrap(&tex, texture->wrapS, texture->wrapT);
+
+    c3dglRetire(C3DGL_RETIRED_TEXTURE, NULL, &texture->tex, NULL);
+    texture->tex = tex;
+    texture->frame = 0;
+}
+
+#endif  // RLGL_C3D_IMPLEMENTATION
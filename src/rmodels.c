@@ -12,11 +12,78 @@
 *   #define SUPPORT_FILEFORMAT_IQM
 *   #define SUPPORT_FILEFORMAT_GLTF
 *   #define SUPPORT_FILEFORMAT_VOX
+*   #define SUPPORT_FILEFORMAT_RMDL
 *       Selected desired fileformats to be supported for model data loading.
+*       NOTE: RMDL (raylib model) is a cooked binary format storing meshes arrays in UploadMesh() layout,
+*       materials with embedded textures, skeleton and animations, use ExportModel() to cook models
 *
 *   #define SUPPORT_MESH_GENERATION
-*       Support procedural mesh generation functions, uses external par_shapes.h library
-*       NOTE: Some generated meshes DO NOT include generated texture coordinates
+*       Support procedural mesh generation functions, parametric shapes are generated directly as indexed meshes
+*
+*   #define SUPPORT_MESH_GEN_WELDING
+*       Generated parametric shapes weld texture coordinates seams and poles into shared vertices (fewer vertices),
+*       NOTE: Texture coordinates are not continuous on welded seams, intended for untextured meshes
+*
+*   #define SUPPORT_GPU_SKINNING
+*       Support GPU skinning for animated models: UpdateModelAnimationBones() computes bones
+*       matrices once per frame and vertices are transformed on the vertex shader
+*       NOTE: Not supported on OpenGL 1.1, CPU skinning (UpdateModelAnimation()) is used instead
+*       NOTE: On OpenGL 3.3, mesh morph targets are also blended on the vertex shader (SetMeshMorphWeights()),
+*       morph targets deltas are fetched from a float texture, they are blended on CPU otherwise
+*
+*   #define SUPPORT_ANIMATION_TEXTURES
+*       Support animation textures for instanced crowds (LoadAnimationTexture()), all animations frames bones matrices
+*       are baked into a float texture, DrawMeshInstancedAnimated() skins every instance on vertex shader with its own
+*       animation, time offset and rate (instance custom data), interpolating consecutive frames
+*       NOTE: Requires GPU skinning and OpenGL 3.3, instances are drawn in bind pose otherwise
+*
+*   #define SUPPORT_ANIMATION_SCHEDULER
+*       Support animated models update throttling (UpdateAnimationScheduler()), registered models bones are sampled
+*       every 2nd, 4th or 8th frame depending on their projected size, bones matrices are interpolated in between,
+*       models outside camera view only advance their animation and root motion (no pose sampling or skinning)
+*       NOTE: Without GPU skinning, models are CPU skinned with last sampled pose (no interpolation)
+*
+*   #define SUPPORT_GPU_CULLING
+*       Support instance buffers culling on GPU (DrawMeshInstancedBufferCulled()), a compute shader culls instances
+*       against frustum, compacts visible instances and writes an indirect draw command, no CPU readback
+*       NOTE: Requires compute shaders (OpenGL 4.3), instances are culled on CPU otherwise
+*
+*   #define SUPPORT_SKINNING_CACHE
+*       GPU skinned meshes are skinned by a compute shader into a cached vertex buffer (positions and normals) once
+*       per frame and bones pose, shadow maps, picking and main pass draws read the cached vertices (no skinning per pass)
+*       NOTE: Requires GPU skinning and compute shaders (OpenGL 4.3), GPU morphed meshes are skinned on every draw
+*
+*   #define SUPPORT_OCCLUSION_CULLING
+*       Support occlusion culling for large meshes draws (SetOcclusionCulling()), DrawMesh()/DrawModel() and render queue
+*       draws test their bounding box with GPU occlusion queries, results are read one frame later (no stalls) and
+*       meshes occluded on previous frame are skipped or drawn with conditional rendering (OpenGL 3.0)
+*       NOTE: Not supported on OpenGL 1.1, occluded meshes could appear one frame late without conditional rendering
+*
+*   #define SUPPORT_THREADED_SKINNING
+*       CPU skinning (UpdateModelAnimation()) splits big meshes vertices between a small pool
+*       of worker threads (MAX_SKINNING_THREADS, including calling thread), uses POSIX threads
+*       NOTE: Vertices are skinned using SSE/NEON instructions when available, independently of this flag
+*
+*   #define SUPPORT_VOXEL_MESHING
+*       Support chunked voxel maps (LoadVoxelMap()), chunks are meshed with greedy faces merging and
+*       rebuilt incrementally when voxels change, VOX models are also loaded through the chunk mesher
+*       NOTE: Atlas tiles repeat across merged faces using a built-in shader (not merged on OpenGL 1.1)
+*
+*   #define SUPPORT_TILEMAP
+*       Support chunked 2D tilemaps (LoadTilemap()), every chunk layer is meshed once into static vertex
+*       buffers and rebuilt only when its tiles change, chunks outside Camera2D view are not drawn
+*       NOTE: Animated tiles frames are selected on a built-in shader (first frame drawn on OpenGL 1.1)
+*
+*   #define SUPPORT_PARTICLES
+*       Support particle systems (LoadParticleSystem()), particles state lives in a GPU buffer (SSBO) simulated
+*       by a compute shader and drawn as instanced camera-facing quads from the same buffer, no CPU readback
+*       NOTE: Without compute shaders (OpenGL 4.3) particles are simulated on CPU (SIMD when available)
+*
+*   #define SUPPORT_WORLD_STREAMING
+*       Support world streaming by sectors (LoadWorld()), sectors manifests list models, textures and objects,
+*       UpdateWorld() loads sectors around a position with async loads and unloads them with hysteresis,
+*       loaded sectors out of range are evicted by priority to keep meshes and textures memory budgets
+*       NOTE: Requires SUPPORT_ASYNC_LOADING, with SUPPORT_RESOURCE_CACHE resources shared by sectors are loaded once
 *
 *
 *   LICENSE: zlib/libpng
@@ -49,6 +116,7 @@
 
 #if defined(SUPPORT_MODULE_RMODELS)
 
+#define RL_MEMORY_TAG   MEMORY_TAG_MODELS   // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: TRACELOG(), LoadFileData(), LoadFileText(), SaveFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 #include "raymath.h"        // Required for: Vector3, Quaternion and Matrix functionality
@@ -57,6 +125,7 @@
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: DBL_MAX [Used in SimplifyMesh()], FLT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -82,18 +151,27 @@
     #define VOX_REALLOC RL_REALLOC
     #define VOX_FREE RL_FREE
 
+#if defined(SUPPORT_VOXEL_MESHING)
+    #define VOX_LOADER_NO_MESH              // VOX meshes are built by voxel map mesher
+#endif
     #define VOX_LOADER_IMPLEMENTATION
     #include "external/vox_loader.h"    // VOX file format loading (MagikaVoxel)
 #endif
 
-#if defined(SUPPORT_MESH_GENERATION)
-    #define PAR_MALLOC(T, N) ((T*)RL_MALLOC(N*sizeof(T)))
-    #define PAR_CALLOC(T, N) ((T*)RL_CALLOC(N*sizeof(T), 1))
-    #define PAR_REALLOC(T, BUF, N) ((T*)RL_REALLOC(BUF, sizeof(T)*(N)))
-    #define PAR_FREE RL_FREE
+#if defined(SUPPORT_THREADED_SKINNING) && defined(_MSC_VER)
+    #undef SUPPORT_THREADED_SKINNING    // POSIX threads not available
+#endif
+#if defined(SUPPORT_THREADED_SKINNING)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_cond_wait() [Used in UpdateModelAnimation()]
+    #include <stdint.h>     // Required for: intptr_t
+#endif
 
-    #define PAR_SHAPES_IMPLEMENTATION
-    #include "external/par_shapes.h"    // Shapes 3d parametric generation
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>   // Required for: NEON intrinsics [Used in UpdateModelAnimation()]
+    #define SKINNING_SIMD_NEON
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>  // Required for: SSE intrinsics [Used in UpdateModelAnimation()]
+    #define SKINNING_SIMD_SSE
 #endif
 
 #if defined(_WIN32)
@@ -110,19 +188,837 @@
 #ifndef MAX_MATERIAL_MAPS
     #define MAX_MATERIAL_MAPS       12    // Maximum number of maps supported
 #endif
+#if defined(SUPPORT_GPU_SKINNING) && defined(GRAPHICS_API_OPENGL_11)
+    #undef SUPPORT_GPU_SKINNING         // GPU skinning requires programmable pipeline
+#endif
 #ifndef MAX_MESH_VERTEX_BUFFERS
+  #if defined(SUPPORT_GPU_SKINNING)
+    #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh (including bone ids and weights)
+  #else
     #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
+  #endif
+#endif
+#ifndef MAX_BONE_MATRICES
+    #define MAX_BONE_MATRICES       64    // Maximum number of bones matrices supported by GPU skinning shader
+#endif
+#ifndef MAX_MORPH_WEIGHTS
+    #define MAX_MORPH_WEIGHTS        8    // Maximum morph targets blended by GPU morphing shader (highest weights)
+#endif
+#ifndef MAX_SKINNING_THREADS
+    #define MAX_SKINNING_THREADS     3    // Maximum threads used by CPU skinning (including calling thread)
+#endif
+#ifndef MODEL_LOD_LEVELS
+    #define MODEL_LOD_LEVELS         2    // Levels of detail generated on model load (static models only)
+#endif
+#ifndef MODEL_LOD_REDUCTION
+    #define MODEL_LOD_REDUCTION   0.5f    // Triangles ratio kept on every level of detail
+#endif
+#ifndef MODEL_LOD_MIN_TRIANGLES
+    #define MODEL_LOD_MIN_TRIANGLES 512   // Minimum mesh triangles to generate levels of detail
+#endif
+#ifndef MODEL_LOD_SCREEN_SIZE
+    #define MODEL_LOD_SCREEN_SIZE 0.25f   // Projected model height (fraction of screen) to switch to first level of detail
+#endif
+#ifndef ANIMATION_SCHEDULER_SCREEN_SIZE
+    #define ANIMATION_SCHEDULER_SCREEN_SIZE 0.2f    // Projected animated model height (fraction of screen) to update every 2nd frame
+#endif
+#ifndef MESH_QUANTIZATION_DEFAULT
+    #define MESH_QUANTIZATION_DEFAULT 0   // Default vertex attributes quantization for static meshes (MeshQuantizeFlags)
+#endif
+#ifndef MESH_INTERLEAVING_DEFAULT
+    #define MESH_INTERLEAVING_DEFAULT 0   // Default vertex attributes interleaving for static meshes (single vertex buffer), opt-in with SetMeshInterleaving()
+#endif
+#ifndef MESH_OPTIMIZE_CACHE_SIZE
+    #define MESH_OPTIMIZE_CACHE_SIZE   32   // Vertex cache size simulated by mesh triangles reordering (OptimizeMesh())
+#endif
+
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES     4   // Mesh BVH triangles per leaf, bigger leaves are split by surface area heuristic
+#endif
+#ifndef VOXEL_CHUNK_SIZE
+    #define VOXEL_CHUNK_SIZE           16   // Voxel map chunk size (voxels per axis), chunk meshes use 16 bit indices
+#endif
+#ifndef TERRAIN_CHUNK_SIZE
+    #define TERRAIN_CHUNK_SIZE         32   // Terrain chunk size (heightmap cells per axis, power of two, up to 128)
+#endif
+#ifndef TERRAIN_LOD_LEVELS
+    #define TERRAIN_LOD_LEVELS          4   // Terrain chunks levels of detail (including full resolution level)
+#endif
+#ifndef TILEMAP_CHUNK_SIZE
+    #define TILEMAP_CHUNK_SIZE         32   // Tilemap chunk size (tiles per axis, up to 128), chunk meshes use 16 bit indices
+#endif
+#ifndef TILEMAP_MAX_ANIMATIONS
+    #define TILEMAP_MAX_ANIMATIONS     16   // Tilemap animated tiles, frames offsets are uploaded to tilemap shader
+#endif
+#ifndef BILLBOARDS_INSTANCING_MIN_COUNT
+    #define BILLBOARDS_INSTANCING_MIN_COUNT 64  // Minimum billboards count drawn as instanced quads (DrawBillboards()), smaller batches use rlgl batch
+#endif
+#ifndef RENDER_QUEUE_INSTANCING_MIN_COUNT
+    #define RENDER_QUEUE_INSTANCING_MIN_COUNT 2 // Minimum repeated queued draws drawn as instances (SetRenderQueueInstancing()), smaller runs are drawn one by one
+#endif
+#ifndef MAX_DEBUG_LINES
+    #define MAX_DEBUG_LINES         65536   // Maximum debug draw lines kept (AddDebugLine()), lines over it are skipped
+#endif
+#ifndef MAX_DEBUG_SHAPES
+    #define MAX_DEBUG_SHAPES         8192   // Maximum debug draw boxes and spheres kept (each), shapes over it are skipped
+#endif
+#ifndef DEBUG_SPHERE_SEGMENTS
+    #define DEBUG_SPHERE_SEGMENTS      32   // Debug draw spheres circles segments (unit sphere computed once)
+#endif
+#ifndef OCCLUSION_MIN_TRIANGLES
+    #define OCCLUSION_MIN_TRIANGLES  1024   // Minimum mesh triangles to be occlusion tested (SetOcclusionCulling()), smaller meshes are always drawn
+#endif
+#ifndef GPU_CULLING_WORKGROUP_SIZE
+    #define GPU_CULLING_WORKGROUP_SIZE 256  // Instances culling compute shader workgroup size (instances culled per workgroup)
+#endif
+#ifndef SKINNING_CACHE_WORKGROUP_SIZE
+    #define SKINNING_CACHE_WORKGROUP_SIZE 64    // Skinning cache compute shader workgroup size (vertices skinned per workgroup)
+#endif
+#ifndef SKINNING_CACHE_FRAMES
+    #define SKINNING_CACHE_FRAMES     4     // Frames a skinning cache buffer is kept without being drawn
+#endif
+#ifndef PARTICLES_WORKGROUP_SIZE
+    #define PARTICLES_WORKGROUP_SIZE  256   // Particles compute shader workgroup size (particles simulated per workgroup)
+#endif
+#ifndef MAX_POINT_LIGHTS
+    #define MAX_POINT_LIGHTS         1024   // Maximum point lights (clustered lighting)
+#endif
+#ifndef LIGHT_CLUSTERS_X
+    #define LIGHT_CLUSTERS_X           16   // Light clusters grid horizontal tiles
+#endif
+#ifndef LIGHT_CLUSTERS_Y
+    #define LIGHT_CLUSTERS_Y            9   // Light clusters grid vertical tiles
+#endif
+#ifndef LIGHT_CLUSTERS_Z
+    #define LIGHT_CLUSTERS_Z           24   // Light clusters grid depth slices (exponential)
+#endif
+#ifndef MAX_LIGHT_CLUSTER_INDICES
+    #define MAX_LIGHT_CLUSTER_INDICES 32768 // Maximum lights references stored by all clusters
+#endif
+#ifndef SHADOW_CASCADES
+    #define SHADOW_CASCADES             4   // Directional light shadow cascades (1 to 4)
+#endif
+#ifndef SHADOW_CASCADE_SIZE
+    #define SHADOW_CASCADE_SIZE      1024   // Shadow cascade size (pixels), shadow atlas is 4x2 cascades
+#endif
+#ifndef SHADOW_DISTANCE
+    #define SHADOW_DISTANCE        100.0f   // Directional light shadows distance from camera
+#endif
+#ifndef SHADOW_POINT_SIZE
+    #define SHADOW_POINT_SIZE         256   // Point light shadow cube face size (pixels)
+#endif
+#ifndef MAX_SHADOWED_POINT_LIGHTS
+    #define MAX_SHADOWED_POINT_LIGHTS   8   // Maximum point lights casting shadows
+#endif
+#ifndef LIGHTMAP_CHART_ANGLE
+    #define LIGHTMAP_CHART_ANGLE     45.0   // Maximum angle between lightmap chart faces normals (degrees)
+#endif
+#ifndef LIGHTMAP_RANGE
+    #define LIGHTMAP_RANGE            2.0   // Lightmap light range, texels store light/range to keep overbright light
+#endif
+#ifndef WORLD_MAX_SECTOR_LOADS
+    #define WORLD_MAX_SECTOR_LOADS      4   // Maximum world sectors loading at the same time
+#endif
+#ifndef WORLD_MAX_LOAD_JOBS
+    #define WORLD_MAX_LOAD_JOBS        16   // Maximum world async loads in flight (async load jobs are shared with other loads)
+#endif
+
+#define LIGHT_CLUSTERS_COUNT        (LIGHT_CLUSTERS_X*LIGHT_CLUSTERS_Y*LIGHT_CLUSTERS_Z)
+#define LIGHT_INDICES_WIDTH         1024    // Light indices texture width, indices are stored in rows
+#define LIGHTING_TEXTURE_SLOT       13      // First texture unit used by lighting textures (after material maps)
+
+// Clustered lighting shaders sample lighting textures with texelFetch() (GLSL 330)
+#if defined(SUPPORT_CLUSTERED_LIGHTING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define LIGHTING_SHADERS_SUPPORTED
+#endif
+
+// Shadow atlas layout: cascades (2x2 tiles) on left half, point lights cube faces tiles on right half
+#define SHADOW_ATLAS_WIDTH          (4*SHADOW_CASCADE_SIZE)
+#define SHADOW_ATLAS_HEIGHT         (2*SHADOW_CASCADE_SIZE)
+#define SHADOW_POINT_COLUMNS        (2*SHADOW_CASCADE_SIZE/SHADOW_POINT_SIZE)   // Point lights faces tiles per row (same rows)
+#define SHADOW_POINT_SLOTS          ((6*MAX_SHADOWED_POINT_LIGHTS <= SHADOW_POINT_COLUMNS*SHADOW_POINT_COLUMNS)? MAX_SHADOWED_POINT_LIGHTS : SHADOW_POINT_COLUMNS*SHADOW_POINT_COLUMNS/6)
+#define SHADOW_TILES                (4 + 6*MAX_SHADOWED_POINT_LIGHTS)   // Shadow atlas tiles: cascades and point lights faces
+#define SHADOW_TEXTURE_SLOT         12      // Texture unit used by shadow atlas (after material maps)
+
+// Shadow maps are sampled by clustered lighting shaders (GLSL 330)
+#if defined(SUPPORT_SHADOW_MAPS) && defined(LIGHTING_SHADERS_SUPPORTED)
+    #define SHADOW_MAPS_SUPPORTED
 #endif
 
+// Lightmaps are baked from clustered lighting lights, lightmap shader replaces default shader (no shaders on OpenGL 1.1)
+#if defined(SUPPORT_LIGHTMAPS) && !defined(SUPPORT_CLUSTERED_LIGHTING)
+    #undef SUPPORT_LIGHTMAPS
+#endif
+#if defined(SUPPORT_LIGHTMAPS) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define LIGHTMAP_SHADERS_SUPPORTED
+#endif
+
+// Skinning cache skins vertices with a compute shader into vertex buffers read by all passes
+#if defined(SUPPORT_SKINNING_CACHE) && defined(SUPPORT_GPU_SKINNING) && defined(GRAPHICS_API_OPENGL_43)
+    #define SKINNING_CACHE_SUPPORTED
+#endif
+
+// GPU morph targets are blended by default material shader variants, deltas fetched with gl_VertexID and texelFetch() (GLSL 330)
+#if defined(SUPPORT_GPU_SKINNING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define GPU_MORPHING_SUPPORTED
+#endif
+
+#define MORPH_TEXTURE_WIDTH         1024    // Morph targets deltas texture width, deltas are stored in rows
+#define MORPH_TEXTURE_MAX_HEIGHT    8192    // Morph targets deltas texture maximum height, bigger meshes are not morphed on GPU
+#define MORPH_TEXTURE_SLOT          16      // Texture unit used by morph targets deltas texture (after lighting textures)
+
+// Animation textures bones matrices are fetched with texelFetch() (GLSL 330)
+#if defined(SUPPORT_ANIMATION_TEXTURES) && defined(GPU_MORPHING_SUPPORTED)
+    #define ANIMATION_TEXTURES_SUPPORTED
+#endif
+
+#define ANIMATION_TEXTURE_WIDTH     1024    // Animation texture width, bones matrices (3 texels each) are stored in rows
+#define ANIMATION_TEXTURE_MAX_HEIGHT 8192   // Animation texture maximum height, bigger animations sets are not baked
+#define ANIMATION_TEXTURE_SLOT      12      // Texture unit used by animation texture (after material maps, no lighting on instanced draws)
+
+// Render queue instances are drawn with built-in instanced shader (instance stream attributes)
+#if defined(SUPPORT_RENDER_QUEUE_INSTANCING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define RENDER_QUEUE_INSTANCING_SUPPORTED
+#endif
+
+// Occlusion culling requires GPU occlusion queries
+#if defined(SUPPORT_OCCLUSION_CULLING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define OCCLUSION_CULLING_SUPPORTED
+#endif
+
+// GPU picking requires integer render targets and pixel buffers (OpenGL 3.3)
+#if defined(SUPPORT_GPU_PICKING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define PICKING_SUPPORTED
+#endif
+
+// World streaming loads sectors manifests and resources with async load jobs
+#if defined(SUPPORT_WORLD_STREAMING) && defined(SUPPORT_ASYNC_LOADING)
+    #define WORLD_STREAMING_SUPPORTED
+#endif
+
+#define OCCLUSION_HASH_BUCKETS       1024   // Occlusion tested draws hash table buckets (power of two)
+#define OCCLUSION_ENTRY_FRAMES          4   // Frames an occlusion tested draw is kept without being drawn
+
+#define MAX_MESH_ATTRIBUTE_STREAMS     12   // Maximum mesh per-vertex attributes arrays (OptimizeMesh())
+#define RMDL_ALIGNMENT                 16   // RMDL file data blocks alignment (in bytes)
+#define RMDL_MESH_ARRAYS                9   // RMDL file mesh arrays: vertices, texcoords, texcoords2, normals, tangents, colors, indices, boneIds, boneWeights
+#define MESH_BVH_MAX_LEAF_TRIANGLES    16   // Mesh BVH maximum triangles per leaf, unless maximum depth is reached
+#define MESH_BVH_MAX_DEPTH             48   // Mesh BVH maximum depth, limits traversal stack size
+#define MESH_BVH_SAH_BINS              12   // Mesh BVH build bins per axis, surface area heuristic split candidates
+
+#define SKINNING_MIN_THREAD_VERTICES  1024  // Minimum vertices skinned by every thread, smaller meshes are not split
+#define MATERIAL_VARIANT_FEATURES       2   // Built-in default material shader variants features count
+#define MATERIAL_VARIANT_SKINNING       1   // Default material variant feature bit: GPU skinning ("SKINNING" define)
+#define MATERIAL_VARIANT_MORPHING       2   // Default material variant feature bit: GPU morph targets ("MORPHING" define)
+#define MATERIAL_MAP_LOCATION(map)      (((map) == MATERIAL_MAP_LIGHTMAP)? SHADER_LOC_MAP_LIGHTMAP : SHADER_LOC_MAP_DIFFUSE + (map))  // Material map sampler shader location
+#define GLTF_ANIMATION_FRAMERATE       60   // glTF animations sampling framerate (frames per second)
+#define PARTICLE_STATE_FLOATS           8   // Particle state floats: position + remaining life, velocity + lifetime
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Billboard instance data for built-in billboards shader (40 bytes)
+typedef struct BillboardInstance {
+    float center[4];            // Billboard center position (xyz) and width
+    float source[4];            // Texture coordinates rectangle (u0, v0, u1, v1)
+    float height;               // Billboard height
+    unsigned char color[4];     // Billboard tint
+} BillboardInstance;
+
+// Debug draw line vertex, lines vertices are uploaded as is (16 bytes)
+typedef struct DebugVertex {
+    Vector3 position;           // Vertex position
+    Color color;                // Vertex color
+} DebugVertex;
+
+// Debug draw shape instance, unit shape scaled and moved (28 bytes)
+typedef struct DebugShape {
+    Vector3 center;             // Shape center
+    Vector3 scale;              // Shape scale: box size, sphere radius
+    Color color;                // Shape color
+} DebugShape;
+
+// Debug draw unit shapes
+typedef enum {
+    DEBUG_SHAPE_BOX = 0,        // Unit box, 12 edges in range [-0.5..0.5]
+    DEBUG_SHAPE_SPHERE,         // Unit sphere, three axis circles of radius 1
+    DEBUG_SHAPE_COUNT
+} DebugShapeType;
+
+// CPU skinning bone transformation, matrices stored as 4-float columns (SIMD friendly)
+typedef struct SkinningBone {
+    float transform[16];        // Bone vertex transformation columns (xyz + padding): scale, rotation, translation
+    float rotation[12];         // Bone normal rotation columns (xyz + padding)
+} SkinningBone;
+
+// CPU skinning job, a range of mesh vertices
+typedef struct SkinningJob {
+    const SkinningBone *bones;  // Frame bones transformations
+    const float *vertices;      // Bind pose vertex positions
+    const float *normals;       // Bind pose vertex normals (optional)
+    const unsigned char *boneIds;   // Vertex bone ids
+    const float *boneWeights;   // Vertex bone weights
+    float *animVertices;        // Skinned vertex positions
+    float *animNormals;         // Skinned vertex normals (optional)
+    int start;                  // First vertex to skin
+    int end;                    // Last vertex to skin (not included)
+    bool updated;               // Some vertex has been transformed
+} SkinningJob;
+
+// Model material texture waiting to be uploaded (async loading)
+typedef struct ModelTextureUpload {
+    int material;               // Model material index
+    int map;                    // Material map index: MaterialMapIndex
+    Image image;                // Texture image data
+} ModelTextureUpload;
+
+// Model material textures upload queue
+// NOTE: When provided to a loader, material images are queued instead of uploaded to GPU
+typedef struct ModelTextureQueue {
+    const char *dirPath;        // Model directory path (resolved on main thread)
+    ModelTextureUpload *uploads;    // Queued textures
+    int count;                  // Queued textures count
+    int capacity;               // Queued textures allocated
+} ModelTextureQueue;
+
+// Render queue recorded mesh draw
+// NOTE: Material maps are copied, they could be changed after recording (i.e. DrawModelEx() tint)
+typedef struct QueuedDraw {
+    Mesh mesh;                  // Mesh to draw
+    Material material;          // Material to draw with (shader already resolved, maps pointing to copy below on flush)
+    MaterialMap maps[MAX_MATERIAL_MAPS];    // Material maps copy
+    Matrix transform;           // Model transform (SHADER_LOC_MATRIX_MODEL)
+    Matrix matModel;            // Model transform combined with rlgl internal transform
+    Matrix matView;             // View matrix at recording
+    Matrix matProjection;       // Projection matrix at recording
+    bool castShadows;           // Draw is a dynamic shadow caster
+    unsigned int pickId;        // Draw picking id, 0 if not pickable
+} QueuedDraw;
+
+// Occlusion tested draw, identified by mesh and world transform
+typedef struct OcclusionEntry {
+    unsigned long long key;     // Mesh and world transform hash
+    unsigned int query;         // Bounding box occlusion query (kept by evicted entries for reuse)
+    unsigned int frame;         // Last frame the draw was tested
+    int next;                   // Next entry in hash bucket chain (index + 1, 0 if last)
+    bool pending;               // Query issued, result not read yet
+    bool visible;               // Last query result
+} OcclusionEntry;
+
+// Occlusion test result flags, see TestOcclusionMesh()
+typedef enum {
+    OCCLUSION_DRAW = 1,         // Mesh must be drawn
+    OCCLUSION_CONDITIONAL = 2,  // Mesh must be drawn with conditional rendering (rlEndConditionalRender() after draw)
+    OCCLUSION_QUERIED = 4       // Bounding box query drawn, shader state changed
+} OcclusionTestFlags;
+
+// Static shadow caster, drawn into cached static shadow atlas tiles
+typedef struct ShadowCaster {
+    Mesh mesh;                  // Caster mesh (referenced)
+    Matrix transform;           // Caster world transform
+    bool active;                // Caster slot used, removed casters slots are reused
+} ShadowCaster;
+
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+// Command list recorded mesh draw, instances transforms (if any) follow in command data
+// NOTE: Material maps are copied, same as render queue draws
+typedef struct MeshDrawCommand {
+    Mesh mesh;                  // Mesh to draw
+    Material material;          // Material to draw with (maps pointing to copy below on submit)
+    MaterialMap maps[MAX_MATERIAL_MAPS];    // Material maps copy
+    Matrix transform;           // Model transform (single draw)
+    int instances;              // Instances transforms following command (0 for single draw)
+} MeshDrawCommand;
+#endif
+
+// Render queue draw sort key
+typedef struct QueuedDrawKey {
+    unsigned long long key;     // Sort key: pass, state (shader, material, mesh) and depth
+    int index;                  // Recorded draw index
+} QueuedDrawKey;
+
+// Mesh simplification welded vertex, all mesh vertices sharing a position
+typedef struct SimplifyNode {
+    double quadric[10];         // Error quadric, symmetric 4x4 matrix (upper triangle)
+    int *triangles;             // Triangles using the node (could include removed ones)
+    int triangleCount;          // Triangles using the node count
+    int triangleCapacity;       // Triangles using the node allocated
+    int vertex;                 // First mesh vertex with node position
+    int pass;                   // Last simplification pass node was modified
+    bool border;                // Node lies on an open border, never collapsed
+} SimplifyNode;
+
+// Mesh simplification edge collapse candidate
+typedef struct SimplifyEdge {
+    int from;                   // Node removed
+    int to;                     // Node kept (collapse target position)
+    double error;               // Collapse quadric error
+} SimplifyEdge;
+
+// Mesh simplification vertex position, sorted to weld vertices
+typedef struct SimplifyVertex {
+    float x, y, z;              // Vertex position
+    int index;                  // Mesh vertex index
+} SimplifyVertex;
+
+// Mesh per-vertex attribute array, welded and reordered by OptimizeMesh()
+typedef struct MeshAttributeStream {
+    unsigned char **data;       // Mesh attribute array pointer
+    int size;                   // Attribute size per vertex (in bytes)
+} MeshAttributeStream;
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Mesh generation parametric surface topology flags
+typedef enum {
+    MESH_SURFACE_CLOSED_U   = 1,    // Surface closed along u, last stacks row equals first
+    MESH_SURFACE_CLOSED_V   = 2,    // Surface closed along v, last slices column equals first
+    MESH_SURFACE_POLE_FIRST = 4,    // First stacks row collapses to a point (degenerate triangles skipped)
+    MESH_SURFACE_POLE_LAST  = 8     // Last stacks row collapses to a point (degenerate triangles skipped)
+} MeshSurfaceFlags;
+
+// Parametric surface function: position, normal and texture coordinates at surface coordinates (u, v) in [0..1]
+typedef void (*MeshSurfaceFunc)(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);
+
+// Mesh generation parametric surface, (stacks + 1)*(slices + 1) grid points
+typedef struct MeshSurface {
+    MeshSurfaceFunc func;       // Surface function
+    float params[4];            // Surface function parameters (shape dimensions)
+    int stacks;                 // Surface subdivisions along u
+    int slices;                 // Surface subdivisions along v
+    int flags;                  // Surface topology flags (MeshSurfaceFlags)
+} MeshSurface;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// RMDL file header (32 bytes)
+typedef struct {
+    char id[4];                 // Signature: "RMDL"
+    unsigned short version;     // File version: 100
+    unsigned short mapCount;    // Material maps stored per material
+    int meshCount;              // Meshes count
+    int lodCount;               // Levels of detail count, lodCount*meshCount meshes stored after base meshes
+    int materialCount;          // Materials count
+    int textureCount;           // Embedded textures count
+    int boneCount;              // Skeleton bones count, 0 if not animated
+    unsigned int animationsOffset;  // Animations data offset in file, 0 if no animations
+} RMDLHeader;
+
+// RMDL mesh description, followed by stored mesh arrays
+typedef struct {
+    int vertexCount;            // Number of vertices
+    int triangleCount;          // Number of triangles
+    unsigned int arrays;        // Stored arrays flags, bit n set if mesh array n is stored (GetRMDLMeshArrays() order)
+    int reserved;               // Reserved, keeps arrays aligned
+} RMDLMesh;
+
+// RMDL embedded texture description, followed by image data (including mipmaps)
+typedef struct {
+    int width;                  // Texture width
+    int height;                 // Texture height
+    int mipmaps;                // Mipmap levels stored
+    int format;                 // Data format (PixelFormat, uncompressed only)
+    unsigned int dataSize;      // Image data size (in bytes)
+} RMDLTexture;
+
+// RMDL material map
+typedef struct {
+    Color color;                // Material map color
+    float value;                // Material map value
+    int texture;                // Embedded texture index, -1 if not embedded (default)
+} RMDLMaterialMap;
+
+// RMDL animation description, followed by bones and frames poses
+typedef struct {
+    int boneCount;              // Number of bones
+    int frameCount;             // Number of frames
+} RMDLAnimation;
+
+// RMDL file data buffer (export)
+typedef struct {
+    unsigned char *data;        // File data
+    unsigned int size;          // File data size (in bytes)
+    unsigned int capacity;      // File data allocated size (in bytes)
+} RMDLBuffer;
+#endif
+
+// Mesh BVH build triangle bounds
+typedef struct MeshBVHTriangle {
+    Vector3 min;                // Triangle bounding box minimum
+    Vector3 max;                // Triangle bounding box maximum
+    Vector3 centroid;           // Triangle bounding box center, used to bin triangles
+} MeshBVHTriangle;
+
+// Lightmap chart, connected mesh faces with similar normals projected on a plane
+typedef struct LightmapChart {
+    Vector3 axisU;              // Chart plane horizontal axis (mesh space)
+    Vector3 axisV;              // Chart plane vertical axis (mesh space)
+    Vector2 min;                // Chart projected bounds minimum (mesh units)
+    Vector2 size;               // Chart projected bounds size (mesh units)
+    int x;                      // Chart atlas position x (texels, padding included)
+    int y;                      // Chart atlas position y (texels, padding included)
+} LightmapChart;
+
+// Lightmap sorting pair: edge welded vertices, corner vertex and chart, chart atlas size
+typedef struct LightmapPair {
+    int a;                      // First sorting key
+    int b;                      // Second sorting key
+    int index;                  // Triangle, corner or chart index
+} LightmapPair;
+
+// Lightmap texel surface point, rasterized from meshes triangles (world space)
+typedef struct LightmapTexel {
+    Vector3 position;           // Surface position
+    Vector3 normal;             // Surface normal (normalized)
+    bool covered;               // Texel covered by a triangle
+} LightmapTexel;
+
+// Lightmap baking data, shared by texels rows jobs
+typedef struct LightmapBake {
+    const LightmapTexel *texels;    // Texels surface points (size*size)
+    Vector3 *light;             // Texels baked light
+    int size;                   // Lightmap size (texels)
+    int samples;                // Indirect light rays per texel, 0 for direct light only
+    const MeshBVH *bvhs;        // Meshes triangles BVH (occluders)
+    const Vector3 *albedos;     // Meshes diffuse color (bounced light)
+    int meshCount;              // Meshes count
+    Matrix transform;           // Model transform
+    Matrix invTransform;        // Model inverse transform
+    float bias;                 // Rays origin offset along surface normal (self intersection)
+} LightmapBake;
+
+// Mesh overdraw optimization triangles cluster
+typedef struct OverdrawCluster {
+    float key;                  // Sort key: cluster facing outwards from mesh center
+    int start;                  // First cluster triangle
+    int count;                  // Cluster triangles count
+} OverdrawCluster;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Model async load file formats, resolved on submission (main thread)
+typedef enum {
+    MODEL_ASYNC_NONE = 0,       // Format not supported, default mesh/material generated on upload stage
+    MODEL_ASYNC_OBJ,            // OBJ: loaded on main thread (changes working directory for materials)
+    MODEL_ASYNC_IQM,            // IQM: parsed on worker thread
+    MODEL_ASYNC_GLTF,           // glTF/GLB: parsed on worker thread, material textures queued
+    MODEL_ASYNC_VOX,            // VOX: parsed on worker thread
+    MODEL_ASYNC_RMDL            // RMDL: loaded on worker thread, material textures queued
+} ModelAsyncFormat;
+
+// Model async load job data
+typedef struct ModelLoadJob {
+    char fileName[512];         // Model file name
+    char dirPath[512];          // Model directory path, for material textures
+    int format;                 // Model file format: ModelAsyncFormat
+    Model model;                // Loaded model
+    ModelTextureQueue textures; // Material textures to upload (main thread)
+} ModelLoadJob;
+
+#if defined(WORLD_STREAMING_SUPPORTED)
+// World sector loading state
+struct rWorldSectorLoad {
+    unsigned int manifestHandle;    // Sector manifest file data async load handle (0: manifest already parsed)
+    char (*files)[512];             // Resources files paths (models first, then textures)
+    unsigned int *handles;          // Resources async load handles (0: not submitted or already retrieved)
+    int nextResource;               // Next resource to submit
+    int pendingCount;               // Resources submitted not retrieved yet
+};
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// glTF image parallel decode job data
+typedef struct GLTFImageLoadJob {
+    cgltf_image *cgltfImage;    // glTF image (uri, data uri or buffer view)
+    char texPath[512];          // Model directory path, for external images
+    Image image;                // Decoded image (worker thread)
+} GLTFImageLoadJob;
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_GPU_SKINNING)
+static ShaderVariants *materialVariants = NULL; // Built-in default material shader variants (MATERIAL_VARIANT_* features)
+static Shader skinningShader = { 0 };       // Built-in skinning shader variant, replaces default shader on GPU skinned meshes
+static bool skinningShaderLoaded = false;   // Built-in skinning shader load has been tried
+#endif
+#if defined(SUPPORT_VOXEL_MESHING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static Shader voxelShader = { 0 };          // Built-in voxel atlas shader, replaces default shader on atlas voxel maps
+static bool voxelShaderLoaded = false;      // Built-in voxel atlas shader load has been tried
+static int voxelShaderTileSizeLoc = -1;     // Built-in voxel atlas shader tile size uniform location
+#endif
+#if defined(SUPPORT_TILEMAP) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static Shader tilemapShader = { 0 };        // Built-in tilemap shader, replaces default shader on tilemaps with animated tiles
+static bool tilemapShaderLoaded = false;    // Built-in tilemap shader load has been tried
+static int tilemapShaderOffsetsLoc = -1;    // Built-in tilemap shader animations offsets uniform location
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader billboardsShader = { 0 };     // Built-in billboards shader, instanced quads expanded along camera basis
+static bool billboardsShaderLoaded = false; // Built-in billboards shader load has been tried
+static int billboardsShaderLocs[6] = { 0 }; // Built-in billboards shader locations: basis (right, up), instance attributes
+static unsigned int billboardsVaoId = 0;    // Billboards quad vertex array id
+static unsigned int billboardsQuadVboId = 0;    // Billboards quad corners vertex buffer id
+#endif
+#if defined(SUPPORT_DEBUG_DRAW)
+#define DEBUG_BOX_VERTICES          24      // Unit box lines vertices
+#define DEBUG_SPHERE_VERTICES       (3*2*DEBUG_SPHERE_SEGMENTS)     // Unit sphere lines vertices
+
+// Retained debug draw primitives, kept until their duration expires
+static struct {
+    DebugVertex *vertices;      // Lines vertices (two per line)
+    float *lineTimes;           // Lines remaining time (in seconds)
+    int lineCount;              // Lines count
+    int lineCapacity;           // Lines allocated
+    DebugShape *shapes[DEBUG_SHAPE_COUNT];  // Shapes instances by type
+    float *shapeTimes[DEBUG_SHAPE_COUNT];   // Shapes remaining time (in seconds)
+    int shapeCount[DEBUG_SHAPE_COUNT];      // Shapes count by type
+    int shapeCapacity[DEBUG_SHAPE_COUNT];   // Shapes allocated by type
+    bool noDepthTest;           // Primitives drawn over scene (no depth test)
+    bool overflow;              // Primitives over limits were skipped (warned once)
+} debugDraw = { 0 };
+
+static Vector3 debugUnitShapes[DEBUG_BOX_VERTICES + DEBUG_SPHERE_VERTICES] = { 0 };  // Unit shapes lines vertices: box, sphere
+static bool debugUnitShapesReady = false;   // Unit shapes vertices have been computed
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader debugShader = { 0 };          // Built-in debug draw shader, lines and unit shapes instances
+static bool debugShaderLoaded = false;      // Built-in debug draw shader load has been tried
+static int debugShaderLocs[2] = { 0 };      // Built-in debug draw shader locations: instance attributes (center, scale)
+static unsigned int debugVaoId = 0;         // Debug draw vertex array id
+static unsigned int debugShapesVboId = 0;   // Debug draw unit shapes vertex buffer id
+#endif
+#endif
+#if defined(SUPPORT_PARTICLES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static Shader particlesShader = { 0 };      // Built-in particles shader, instanced camera-facing quads
+static bool particlesShaderLoaded = false;  // Built-in particles shader load has been tried
+static int particlesShaderLocs[9] = { 0 };  // Built-in particles shader locations: modelview, sizes, colors (start, end), state attributes, soft depth (texture, params, range)
+static unsigned int particlesVaoId = 0;     // Particles quad vertex array id
+static unsigned int particlesQuadVboId = 0; // Particles quad corners vertex buffer id
+#endif
+#if defined(SUPPORT_PARTICLES) && defined(GRAPHICS_API_OPENGL_43)
+static unsigned int particlesComputeProgram = 0;    // Built-in particles compute shader program
+static bool particlesComputeLoaded = false;         // Built-in particles compute shader load has been tried
+static int particlesComputeLocs[9] = { 0 };         // Built-in particles compute shader uniforms locations
+#endif
+
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+// Clustered lighting state, lights are binned into view frustum clusters when lights or camera change
+static struct {
+    Vector4 lights[MAX_POINT_LIGHTS];       // Point lights: position (xyz) and radius (w), radius 0 if not used
+    Vector3 colors[MAX_POINT_LIGHTS];       // Point lights color (intensity applied)
+    int lightCount;                         // Point lights slots used (including removed lights)
+    int activeCount;                        // Point lights active
+    Vector3 ambient;                        // Ambient light color
+    Vector3 direction;                      // Directional light direction (world space, normalized)
+    Vector3 directionalColor;               // Directional light color, zero if disabled
+    bool dirty;                             // Lights changed since last binning
+    Matrix matView;                         // Camera view matrix used for last binning
+    Matrix matProjection;                   // Camera projection matrix used for clusters bounds
+    float sliceScale;                       // Depth slice from view distance: log(distance)*scale + bias
+    float sliceBias;
+    BoundingBox clusters[LIGHT_CLUSTERS_COUNT]; // Clusters bounds (view space)
+    int clusterCounts[LIGHT_CLUSTERS_COUNT];    // Lights per cluster
+    int clusterOffsets[LIGHT_CLUSTERS_COUNT];   // Cluster first light index offset
+    float *indices;                         // Clusters lights indices (uploaded as float texture)
+    int visibleCount;                       // Lights binned on last update
+    unsigned int lightsTextureId;           // Lights data texture: view position and radius, color (2 texels per light)
+    unsigned int clustersTextureId;         // Clusters texture: lights offset and count
+    unsigned int indicesTextureId;          // Lights indices texture
+} lighting = { .ambient = { 0.2f, 0.2f, 0.2f }, .direction = { 0.0f, -1.0f, 0.0f } };
+#endif
+#if defined(LIGHTMAP_SHADERS_SUPPORTED)
+static Shader lightmapShader = { 0 };       // Built-in lightmap shader, replaces default shader on meshes with lightmap and texcoords2
+static bool lightmapShaderLoaded = false;   // Built-in lightmap shader load has been tried
+#endif
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+static Shader lightingShader = { 0 };       // Built-in clustered lighting shader, replaces default shader on meshes with normals
+static bool lightingShaderLoaded = false;   // Built-in clustered lighting shader load has been tried
+static int lightingShaderLocs[12] = { 0 };  // Built-in clustered lighting shader uniforms locations
+#endif
+#if defined(SUPPORT_SHADOW_MAPS)
+// Shadow maps state, shadow atlas tiles are only rendered again when their light or casters change
+static struct {
+    bool directional;                       // Directional light casts shadows (cascades)
+    int pointLights[MAX_SHADOWED_POINT_LIGHTS]; // Shadowed point lights ids + 1, 0 if slot not used
+    ShadowCaster *casters;                  // Static casters
+    int casterCount;                        // Static casters slots used (including removed casters)
+    int casterCapacity;                     // Static casters allocated
+    int version;                            // Static casters version, incremented on casters change
+    Matrix tiles[SHADOW_TILES];             // Tiles light view-projection matrices on last render
+    int tileVersions[SHADOW_TILES];         // Static casters version rendered in static atlas tiles, 0 if not rendered
+    bool tileDynamic[SHADOW_TILES];         // Tiles include dynamic casters from last render
+    Matrix cascades[4];                     // Cascades world to shadow atlas matrices (uv and depth)
+    float splits[4];                        // Cascades far distance from camera, 0 if not rendered
+    float texels[4];                        // Cascades texel world size (normal offset)
+    unsigned int atlasTextureId;            // Shadow atlas depth texture, sampled by lighting shaders
+    unsigned int atlasFboId;                // Shadow atlas framebuffer
+    unsigned int staticTextureId;           // Static casters shadow atlas depth texture (cache)
+    unsigned int staticFboId;               // Static casters shadow atlas framebuffer
+} shadows = { .version = 1 };
+#endif
+#if defined(SHADOW_MAPS_SUPPORTED)
+static Shader shadowCasterShader = { 0 };   // Built-in shadow casters shader, writes light depth or distance
+static Shader shadowCopyShader = { 0 };     // Built-in shadow atlas copy shader, writes static atlas depth
+static bool shadowShadersLoaded = false;    // Built-in shadow shaders and atlases load has been tried
+static int shadowCasterLightLoc = -1;       // Built-in shadow casters shader light location
+#endif
+
+// Deferred 3D render queue, DrawMesh() calls are recorded while active
+static struct {
+    QueuedDraw *draws;          // Recorded draws
+    QueuedDrawKey *keys;        // Recorded draws sort keys
+    int count;                  // Recorded draws count
+    int capacity;               // Recorded draws allocated
+    int pass;                   // Render pass for next recorded draws: RenderPass
+    bool castShadows;           // Next recorded draws cast shadows
+    unsigned int pickId;        // Next recorded draws picking id, 0 if not pickable
+    bool recording;             // Render queue is recording draws
+    bool instancing;            // Repeated draws are drawn as instances (automatic instancing)
+    Matrix *instanceTransforms; // Instanced draws transforms scratch buffer
+    Color *instanceColors;      // Instanced draws colors scratch buffer (material diffuse color, including tint)
+    int instanceCapacity;       // Instanced draws scratch buffers allocated
+} renderQueue = { 0 };
+
+#if defined(PICKING_SUPPORTED)
+// GPU picking state, pickable draws ids are rendered into a one pixel framebuffer through a projection zoomed on requested pixel
+static struct {
+    bool requested;             // Picking requested, rendered by next EndRenderQueue()
+    Vector2 position;           // Requested position (viewport pixels, top-left origin)
+    bool pending;               // Readback in flight, resolved once its fence is signaled
+    void *fence;                // Readback fence (NULL if fences not supported)
+    unsigned int result;        // Last picked id read back, 0 if no draw
+    unsigned int textureId;     // Ids texture (R32UI, one pixel)
+    unsigned int fboId;         // Ids framebuffer (ids texture and depth renderbuffer)
+    unsigned int pixelBufferId; // Readback pixel buffer (PBO)
+} picking = { 0 };
+
+static Shader pickingShader = { 0 };        // Built-in picking shader, writes draw id
+static bool pickingLoaded = false;          // Built-in picking shader and framebuffer load has been tried
+static int pickingIdLoc = -1;               // Built-in picking shader id location
+#endif
+
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+// Occlusion culling state, tested draws are tracked by mesh and world transform
+static struct {
+    OcclusionEntry *entries;    // Tested draws, evicted entries after count keep their queries
+    int count;                  // Tested draws count
+    int capacity;               // Tested draws allocated
+    int buckets[OCCLUSION_HASH_BUCKETS];    // Hash buckets first entry (index + 1, 0 if empty)
+    Mesh proxy;                 // Unit box mesh, drawn with tested draws bounds
+    unsigned int frame;         // Current frame counter
+    int culled;                 // Current frame occluded draws
+    int lastCulled;             // Last frame occluded draws
+    bool enabled;               // Occlusion culling enabled
+} occlusion = { 0 };
+#endif
+
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+static Shader instancingShader = { 0 };     // Built-in render queue instancing shader, default shader with instance transform and color
+static bool instancingShaderLoaded = false; // Built-in render queue instancing shader load has been tried
+#endif
+
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+static Shader animationShader = { 0 };      // Built-in animation textures shader, instancing shader skinned from animation texture
+static bool animationShaderLoaded = false;  // Built-in animation textures shader load has been tried
+static int animationShaderLocs[2] = { -1, -1 };     // Built-in animation textures shader uniforms locations (bones texture, params)
+#endif
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+static unsigned int meshQuantization = MESH_QUANTIZATION_DEFAULT;  // Vertex attributes quantization for static meshes uploads
+#endif
+#if defined(SUPPORT_MESH_INTERLEAVING)
+static bool meshInterleaving = MESH_INTERLEAVING_DEFAULT;   // Vertex attributes interleaving for static meshes uploads
+#endif
+
+// Meshes positions buffers updated after bounds were cached (UpdateMeshBuffer() receives a mesh copy,
+// cached bounds can not be reset), mesh bounds are ignored until UpdateMeshBounds() or UnloadMesh()
+static struct {
+    unsigned int *ids;          // Positions buffers ids (vboId[0])
+    int count;                  // Positions buffers with stale bounds
+    int capacity;               // Positions buffers ids allocated
+} staleBounds = { 0 };
+
+// Mesh buffer mapped into client memory (GPU buffers mapping not supported), uploaded on unmap
+static struct {
+    void *data;                 // Mapped mesh buffer data
+    unsigned int id;            // Mapped mesh buffer id, 0 if not mapped
+    int size;                   // Mapped mesh buffer size (in bytes)
+} meshBufferMapped = { 0 };
+
+// Instances transforms scratch buffer, reused by DrawMeshInstancedCulled() and quantized meshes instancing
+static struct {
+    Matrix *data;               // Visible instances transforms
+    int capacity;               // Transforms allocated
+} culledTransforms = { 0 };
+
+#if defined(SUPPORT_GPU_CULLING) && defined(GRAPHICS_API_OPENGL_43)
+// Instances GPU culling state, visible buffers are shared by all culled draws
+static struct {
+    unsigned int program;       // Culling compute shader program
+    bool loaded;                // Culling compute shader load has been tried
+    int locs[5];                // Culling compute shader uniforms locations: planes, bounds, transform, dequantize, instances
+    unsigned int visibleIds[3]; // Visible instances buffers (transforms, colors, custom), compacted by culling pass
+    unsigned int commandId;     // Indirect draw command buffer, instances count written by culling pass
+    int capacity;               // Visible instances buffers capacity (instances)
+} gpuCulling = { 0 };
+#endif
+
+// Shared uniform buffers for shaders declaring default uniform blocks, data only uploaded on changes
+// NOTE: std140 layouts, FrameData: mat4 matView, matProjection, matViewProjection
+//       MaterialData: vec4 colDiffuse, colSpecular, params
+static struct {
+    unsigned int frameId;       // Per-frame uniform buffer id (RL_UNIFORM_BLOCK_BINDING_FRAME)
+    unsigned int materialId;    // Per-material uniform buffer id (RL_UNIFORM_BLOCK_BINDING_MATERIAL)
+    float frame[48];            // Per-frame data last uploaded
+    float material[12];         // Per-material data last uploaded
+} uniformBlocks = { 0 };
+
+static SkinningBone *skinningBones = NULL;  // CPU skinning bones transformations for current frame
+static int skinningBonesCount = 0;          // CPU skinning bones transformations allocated
+static const Mesh *skinnedAnimatedMeshes = NULL;    // Animated model meshes last CPU skinned by DrawAnimatedModel() (NULL if skinned by others)
+static const Transform *skinnedAnimatedPose = NULL; // Animated model pose last CPU skinned by DrawAnimatedModel()
+static int skinnedAnimatedKey = 0;                  // Animated model next key frame last CPU skinned by DrawAnimatedModel()
+
+#if defined(SKINNING_CACHE_SUPPORTED)
+// Skinning cache buffer, mesh vertices skinned with a bones pose
+typedef struct SkinningCacheEntry {
+    unsigned int meshId;        // Mesh bind pose positions buffer (vboId[0]), entry key along bones matrices
+    int vertexCount;            // Mesh vertices count
+    Matrix *bones;              // Bones matrices skinned (copy)
+    int boneCount;              // Bones matrices count
+    unsigned int bufferId;      // Skinned vertices buffer: positions (XYZ) followed by normals (XYZ)
+    unsigned int frame;         // Frame the entry was last drawn
+} SkinningCacheEntry;
+
+// Skinning cache state, bones matrices buffer is shared by all skinning dispatches
+static struct {
+    unsigned int program;       // Skinning compute shader program
+    bool loaded;                // Skinning compute shader load has been tried
+    int countsLoc;              // Skinning compute shader counts uniform location (vertices, normals available)
+    unsigned int bonesId;       // Bones matrices buffer (column-major, updated before every dispatch)
+    int bonesCapacity;          // Bones matrices buffer capacity (matrices)
+    SkinningCacheEntry *entries;    // Skinned vertices buffers
+    int count;                  // Skinned vertices buffers used
+    int capacity;               // Skinned vertices buffers allocated
+    unsigned int frame;         // Current frame, advanced by EndDrawing()
+} skinningCache = { 0 };
+#endif
+
+#if defined(SUPPORT_THREADED_SKINNING)
+// CPU skinning worker threads pool
+// NOTE: Calling thread always processes first job, workers process the rest
+static struct {
+    pthread_t threadId[MAX_SKINNING_THREADS];   // Worker threads ids (first one unused)
+    SkinningJob jobs[MAX_SKINNING_THREADS];     // Current jobs, one per thread
+    pthread_mutex_t mutex;                      // Pool state access mutex
+    pthread_cond_t jobsReady;                   // Signaled when new jobs are available
+    pthread_cond_t jobsDone;                    // Signaled when all worker jobs are finished
+    unsigned int generation;                    // Jobs generation, increased on every dispatch
+    int jobCount;                               // Jobs dispatched on current generation
+    int pending;                                // Worker jobs not finished
+    int threadCount;                            // Worker threads running (including calling thread)
+    bool running;                               // Pool has been initialized and is running
+} skinningPool = { 0 };
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -135,12 +1031,329 @@ static Model LoadIQM(const char *fileName);     // Load IQM mesh data
 static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount);    // Load IQM animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_GLTF)
-static Model LoadGLTF(const char *fileName);    // Load GLTF mesh data
+static Model LoadGLTF(const char *fileName, ModelTextureQueue *queue, Scene *scene, SceneModel *sceneModel);    // Load GLTF mesh data (material textures optionally queued, nodes optionally loaded into scene)
+static void LoadGLTFSceneNode(const cgltf_data *data, const cgltf_node *gltfNode, int parent, const int *firstMesh, Scene *scene, SceneModel *sceneModel);    // Load glTF node and its children into scene
+static int LoadGLTFNodeInstances(const cgltf_data *data, const cgltf_node *gltfNode, Matrix **transforms);   // Load glTF node instances transforms (EXT_mesh_gpu_instancing)
+static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data);   // Load glTF external file data
+static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data);    // Release glTF external file data
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath);    // Load glTF image (uri, data uri or buffer view)
+static Image *LoadGLTFImages(cgltf_data *data, const char *texPath, char (*keys)[512], int *uses, bool parallel);   // Load glTF images used by materials (decoded in parallel)
+static Image GetGLTFTextureImage(cgltf_data *data, const cgltf_texture *texture, Image *images, int *uses);  // Get glTF material texture image (copied if still used)
+static void LoadGLTFTexture(Model *model, int material, int map, cgltf_data *data, const cgltf_texture *texture, Image *images, char (*keys)[512], int *uses, ModelTextureQueue *queue);  // Load glTF material map texture (cached textures shared)
+static bool CheckGLTFAccessorData(const cgltf_accessor *accessor);     // Check glTF accessor elements are inside buffer view data
+static void TransformGLTFMesh(cgltf_data *data, const cgltf_mesh *gltfMesh, Mesh *mesh);   // Apply glTF mesh node world transform (quantized meshes)
+static bool LoadGLTFAccessorData(const cgltf_accessor *accessor, void *dst, int elementSize);  // Load glTF accessor elements, tightly packed
+static bool LoadGLTFAccessorFloats(const cgltf_accessor *accessor, float *dst, int numComp);   // Load glTF accessor elements as floats (dequantized)
+static bool DecodeGLTFMeshopt(cgltf_data *data);    // Decode glTF buffer views compressed with EXT_meshopt_compression
+static int DecodeMeshoptVertexBuffer(unsigned char *dst, int count, int size, const unsigned char *buffer, int bufferSize);       // Decode meshopt vertex buffer
+static int DecodeMeshoptIndexBuffer(unsigned char *dst, int count, int indexSize, const unsigned char *buffer, int bufferSize);   // Decode meshopt triangles index buffer
+static int DecodeMeshoptIndexSequence(unsigned char *dst, int count, int indexSize, const unsigned char *buffer, int bufferSize); // Decode meshopt index sequence
+static void DecodeMeshoptFilter(unsigned char *data, int count, int stride, int filter);   // Decode meshopt attributes filter in place
+static void LoadGLTFMorphTargets(const cgltf_mesh *gltfMesh, const cgltf_primitive *primitive, Mesh *mesh);  // Load glTF primitive morph targets deltas and default weights
+static MorphAnimation *LoadMorphAnimationsGLTF(const char *fileName, unsigned int *animCount);    // Load glTF morph targets weights animations
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeGLTFImageJob(void *data);     // glTF image async decode stage (worker thread)
+#endif
 //static ModelAnimation *LoadModelAnimationGLTF(const char *fileName, unsigned int *animCount);    // Load GLTF animation data
 #endif
 #if defined(SUPPORT_FILEFORMAT_VOX)
 static Model LoadVOX(const char *filename);     // Load VOX mesh data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+static Model LoadRMDL(const char *fileName, ModelTextureQueue *queue);     // Load RMDL cooked model data (material textures optionally queued)
+static ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, unsigned int *animCount);    // Load RMDL animation data
+static bool SaveRMDL(Model model, const ModelAnimation *animations, int animCount, const char *fileName);  // Save model as RMDL file
+static void GetRMDLMeshArrays(Mesh *mesh, void ***arrays, unsigned int *sizes); // Get mesh arrays stored in RMDL files and their sizes
+static void WriteRMDLData(RMDLBuffer *buffer, const void *data, unsigned int size);   // Write aligned data block to RMDL file buffer
+static const void *ReadRMDLData(const unsigned char *fileData, unsigned int fileSize, unsigned int *offset, unsigned int size);  // Read aligned data block from RMDL file data
+static void WriteRMDLMesh(RMDLBuffer *buffer, Mesh mesh);   // Write mesh description and arrays to RMDL file buffer
+static bool ReadRMDLMesh(const unsigned char *fileData, unsigned int fileSize, unsigned int *offset, Mesh *mesh);    // Read mesh description and arrays from RMDL file data
+static unsigned int GetRMDLImageSize(int width, int height, int mipmaps, int format);  // Get image data size including mipmaps
+#endif
+#if defined(SUPPORT_GPU_SKINNING)
+static void LoadShaderSkinning(void);           // Load built-in skinning shader variant (lazily, on first GPU skinned update)
+#endif
+#if defined(GPU_MORPHING_SUPPORTED)
+static unsigned int LoadMeshMorphTexture(const Mesh *mesh);     // Load mesh morph targets deltas texture
+static void SetMeshMorphState(Mesh mesh, Shader shader);        // Bind mesh morph targets texture and upload highest weights
+#endif
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+static void LoadShaderAnimation(void);          // Load built-in animation textures shader (lazily, on first animated instanced draw)
+#endif
+static void BlendMeshMorphTargets(Mesh mesh);   // Blend mesh morph targets on CPU into animated vertex data
+static Matrix GetBoneSkinningMatrix(Transform bindPose, Transform pose, Matrix *rotation);  // Get bone transformation from bind pose to pose
+static bool SetSkinningBones(Model model, const Transform *pose, Matrix *matrices);   // Compute CPU skinning bones for a pose (and optionally its matrices)
+static void SkinModelMeshes(Model model);       // Skin model meshes on CPU with current skinning bones
+static bool SetModelBoneMatrices(Model model, const Matrix *matrices);   // Set model meshes bones matrices for GPU skinning
+static bool SkinVertices(SkinningJob *job);     // Skin a range of vertices (SIMD when available)
+#if defined(SUPPORT_THREADED_SKINNING)
+static void *SkinningThread(void *arg);         // Skinning worker thread loop
+static void RunSkinningJobs(SkinningJob *jobs, int count);  // Run skinning jobs on workers pool
+#endif
+extern void UnloadSkinningData(void);           // Unload skinning shader, workers and buffers (called by CloseWindow())
+#if defined(SKINNING_CACHE_SUPPORTED)
+static void LoadShaderSkinningCache(void);      // Load built-in skinning cache compute shader (lazily, on first GPU skinned draw)
+static bool IsSkinningCacheAvailable(Mesh mesh);    // Check if mesh draws read skinned vertices from skinning cache
+static unsigned int GetSkinningCacheBuffer(Mesh mesh);  // Get mesh skinned vertices buffer for its bones matrices (skinned once per frame)
+static void RemoveSkinningCacheEntries(unsigned int meshId);    // Release mesh skinning cache buffers
+#endif
+#if defined(SUPPORT_SKINNING_CACHE) && defined(GRAPHICS_API_OPENGL_43)
+extern void UpdateSkinningCache(void);          // Advance skinning cache frame, release buffers not drawn recently (called by EndDrawing())
+#endif
+static void GetModelAnimationFramePose(ModelAnimation anim, int frame, Transform *transforms);  // Get model animation frame pose (decoded if compressed)
+static Quaternion GetAnimationTrackFrame(ModelAnimation anim, int track, int frame);   // Get compressed animation track value at frame
+static Quaternion DecodeAnimationTrackKey(ModelAnimationTrack track, const unsigned short *key, int channel);  // Decode compressed animation track key
+static Quaternion GetAnimationTrackValue(Quaternion a, Quaternion b, float amount, int channel);   // Get animation track interpolated value
+static float GetAnimationTrackError(Quaternion a, Quaternion b, int channel);  // Get animation track values error
+static void EncodeAnimationRotation(Quaternion q, unsigned short *key);        // Encode rotation as smallest-three (48 bit)
+static Quaternion DecodeAnimationRotation(const unsigned short *key);          // Decode smallest-three rotation
+static Transform GetAnimationRootTransform(ModelAnimation anim, float frame);   // Get animation root bone transform at fractional frame (root motion)
+static void SampleAnimatedModelKey(AnimatedModel *animModel, float frame, Matrix *matrices);   // Sample animated model pose and compute its bones matrices
+#if defined(SUPPORT_VOXEL_MESHING)
+static Mesh GenVoxelChunkMesh(VoxelMap map, int chunk); // Generate voxel map chunk mesh with greedy faces merging (CPU only)
+static Shader GetVoxelMapShader(VoxelMap map, Material material);  // Get shader used to draw voxel map chunks
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadShaderVoxel(void);              // Load built-in voxel atlas shader (lazily, on first atlas voxel map draw)
+#endif
+#endif
+extern void UnloadVoxelShader(void);            // Unload voxel atlas shader (called by CloseWindow())
+static Mesh GenTerrainChunkMesh(Terrain terrain, int chunkX, int chunkZ);  // Generate terrain chunk vertices with border skirts (CPU only, no indices)
+static unsigned short *GenTerrainLodIndices(int lod, int *triangleCount);  // Generate terrain level of detail indices (shared by all chunks)
+static float GetTerrainSurface(Terrain terrain, float x, float z, Vector3 *normal);  // Get terrain surface height (and normal) at terrain space position (x, z)
+#if defined(SUPPORT_TILEMAP)
+static Mesh GenTilemapChunkMesh(Tilemap map, int chunk);   // Generate tilemap chunk layer mesh, one quad per tile (CPU only)
+static Shader GetTilemapShader(Tilemap map);    // Get shader used to draw tilemap chunks (animations offsets uploaded)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadShaderTilemap(void);            // Load built-in tilemap shader (lazily, on first animated tilemap draw)
+#endif
+#endif
+extern void UnloadTilemapShader(void);          // Unload tilemap shader (called by CloseWindow())
+#if defined(WORLD_STREAMING_SUPPORTED)
+static void ParseWorldSectorManifest(WorldSector *sector, const char *text);  // Parse sector manifest: models, textures and objects lines
+static int UpdateWorldSectorLoad(WorldSector *sector, int jobs);        // Retrieve and submit sector resources loads, returns async loads submitted
+static void UnloadWorldSector(World *world, WorldSector *sector);       // Unload sector resources (pending loads are finished first)
+static bool IsWorldOverBudget(World world);     // Check if loaded sectors memory exceeds any world budget
+static void GetWorldModelMemory(Model model, long long *memory);        // Add model estimated meshes and textures memory (WorldBudget)
+static long long GetWorldTextureMemory(Texture2D texture);              // Get texture estimated memory, including mipmaps
+#endif
+#if defined(SUPPORT_PARTICLES)
+static unsigned int HashParticle(unsigned int x);   // Hash particle random state (same hash used by compute shader)
+static float GetParticleRandom(unsigned int *state);    // Get particle random value in range [-1..1), state is advanced
+static void SpawnParticle(float *particle, ParticleEmitter emitter, unsigned int state);    // Spawn particle at emitter (CPU simulation)
+static void SimulateParticles(float *particles, int count, ParticleEmitter emitter, float deltaTime);   // Simulate alive particles (CPU, SIMD when available)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadShaderParticles(void);          // Load built-in particles shader (lazily, on first particles draw)
+#endif
+#if defined(GRAPHICS_API_OPENGL_43)
+static void LoadShaderParticlesCompute(void);   // Load built-in particles compute shader (lazily, on first particle system load)
+#endif
+#endif
+extern void UnloadParticlesShaders(void);       // Unload particles shaders and quad buffers (called by CloseWindow())
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern bool GetLowResEffectsSoftDepth(unsigned int *depthId, float *params);    // [Module: textures] Get soft depth test parameters for particles drawn to reduced resolution effects
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadShaderBillboards(void);         // Load built-in billboards shader (lazily, on first instanced billboards draw)
+#endif
+extern void UnloadBillboardsShader(void);       // Unload billboards shader and quad buffers (called by CloseWindow())
+#if defined(SUPPORT_DEBUG_DRAW)
+static bool ReserveDebugLines(int count);       // Reserve debug lines space, false if over MAX_DEBUG_LINES
+static void AddDebugShape(int type, Vector3 center, Vector3 scale, Color color, float duration);    // Add debug unit shape instance
+static void GenDebugUnitShapes(void);           // Compute debug unit shapes lines vertices (once)
+static void DrawDebugShapesBatch(int type);     // Draw debug shapes expanded into rlgl batch lines (no instancing)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void LoadShaderDebugDraw(void);          // Load built-in debug draw shader and unit shapes buffer (lazily, on first debug draw)
+#endif
+#endif
+extern void UnloadDebugDraw(void);              // Unload debug draw shader, buffers and primitives (called by CloseWindow())
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+static void SetLightClustersBounds(Matrix matProjection);  // Compute light clusters bounds (view space) and depth slices for projection
+static void UpdateLightClusters(Matrix matView, Matrix matProjection);  // Bin lights into clusters for camera and upload lighting textures
+static void LoadShaderLighting(void);           // Load built-in clustered lighting shader and lighting textures (lazily, on first lit draw)
+static void SetLightingShaderState(Shader shader, const int *locs, Matrix matView, Matrix matProjection);   // Bind lighting textures and upload lighting uniforms
+#endif
+#if defined(SHADOW_MAPS_SUPPORTED)
+static void LoadShadowMaps(void);               // Load shadow atlases and built-in shadow shaders (lazily, on first shadows render)
+static void RenderShadowMaps(Matrix matView, Matrix matProjection);    // Render changed shadow atlas tiles for camera (render queue draws are dynamic casters)
+static void RenderShadowTile(int index, Rectangle rect, Matrix matLightView, Matrix matLightProjection, Vector4 light);  // Render shadow atlas tile (static atlas tile cached)
+static void ClearShadowTile(unsigned int fboId, Rectangle rect);  // Bind shadow atlas framebuffer and clear tile depth
+#endif
+extern void UnloadLighting(void);               // Unload lighting shader, textures and buffers (called by CloseWindow())
+#if defined(SUPPORT_LIGHTMAPS)
+static void GenMeshLightmapCharts(Mesh mesh, int *triangleCharts, LightmapChart **charts, int *chartCount, int *chartCapacity);  // Split mesh faces into lightmap charts (connected faces with similar normals)
+static bool PackLightmapCharts(LightmapChart *charts, int count, int size, int padding, float scale);  // Pack lightmap charts into atlas shelves, false if charts do not fit
+static bool SetMeshLightmapUVs(Mesh *mesh, const int *triangleCharts, const LightmapChart *charts, int size, int padding, float scale);  // Split mesh vertices on charts seams and set lightmap texture coordinates
+static int CompareLightmapPairs(const void *a, const void *b);     // Compare lightmap sorting pairs keys
+static bool IsLightmapOccluded(const LightmapBake *bake, Vector3 position, Vector3 direction, float distance);  // Check if any mesh occludes a ray (shadow ray)
+static Vector3 GetLightmapDirectLight(const LightmapBake *bake, Vector3 position, Vector3 normal, bool ambient);  // Get direct light at surface point, lights occluded by meshes
+static void BakeLightmapRows(void *data, int start, int end);      // Bake lightmap texels rows range (ParallelFor() callback)
+#endif
+#if defined(LIGHTMAP_SHADERS_SUPPORTED)
+static void LoadShaderLightmap(void);           // Load built-in lightmap shader (lazily, on first lightmapped draw)
+#endif
+static Mesh GenStaticBatchMesh(StaticBatch *batch, const Mesh *meshes, const Matrix *transforms, const int *objectMaterials, int material, int first, int last, int vertexCount, int triangleCount);  // Generate static batch merged mesh (CPU only, no upload)
+static bool IsStaticBatchMaterialEqual(Material a, Material b);    // Check if static batch materials are equal (same shader and maps)
+static void MultiplySceneMatrix(const Matrix *local, const Matrix *parent, Matrix *result);   // Multiply scene node local matrix by parent world matrix (SIMD when available)
+
+static void LoadModelTexture(Model *model, int material, int map, Image image, ModelTextureQueue *queue);  // Load material map texture from image (or queue it), image is unloaded
+static void UploadModelTextures(Model *model, ModelTextureQueue *queue);   // Upload queued material textures and release queue
+static void UploadModel(Model *model, const char *fileName); // Upload model meshes to GPU, default mesh/material if not loaded
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader GetMeshShader(Mesh mesh, Material material);  // Get shader used to draw a mesh with a material
+static void SetMeshShaderState(Shader shader, Matrix matView, Matrix matProjection);  // Bind mesh shader program and upload view/projection matrices
+static void SetMeshMaterialState(Material material, const Material *previous);  // Upload material colors and bind material texture maps
+static void SetFrameUniformBlock(Shader shader, Matrix matView, Matrix matProjection);  // Update and bind per-frame uniform block (if available)
+static void SetMaterialUniformBlock(Material material);    // Update and bind per-material uniform block (if available)
+static void ResetMeshMaterialState(Material material);  // Unbind material texture maps
+static void DrawMeshGeometry(Mesh mesh, Material material, Matrix transform, Matrix matModel, Matrix matView, Matrix matProjection);   // Upload mesh model matrices, bind vertex data and draw
+static void RecordQueuedDraw(Mesh mesh, Material material, Matrix transform);  // Record a mesh draw into render queue
+static int CompareQueuedDraws(const void *a, const void *b);    // Compare render queue draws sort keys
+#endif
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+static bool CheckQueuedDrawsInstancing(const QueuedDraw *first, const QueuedDraw *draw);   // Check if queued draw can be drawn as an instance of first draw
+static bool DrawQueuedDrawsInstanced(int first, int count);     // Draw sorted queued draws range as instances of first draw
+static void LoadShaderInstancing(void);         // Load built-in render queue instancing shader (lazily, on first instanced queued draws)
+#endif
+extern void UnloadRenderQueue(void);            // Unload render queue and culling buffers (called by CloseWindow())
+#if defined(PICKING_SUPPORTED)
+static void LoadPicking(void);                  // Load built-in picking shader and ids framebuffer (lazily, on first picking request)
+static void UnloadPicking(void);                // Unload built-in picking shader, ids framebuffer and readback buffer
+static void RenderPicking(void);                // Resolve previous picking readback and render pickable queued draws ids if requested
+#endif
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+static int TestOcclusionMesh(Mesh mesh, Matrix matModel, Matrix matView, Matrix matProjection);    // Test mesh draw with previous frame occlusion query and issue a new one (OcclusionTestFlags)
+static OcclusionEntry *GetOcclusionEntry(unsigned long long key, bool *created);    // Get occlusion tested draw entry, created if not found
+static void DrawOcclusionProxy(unsigned int query, Matrix matBox, Matrix matView, Matrix matProjection);   // Draw unit box proxy into occlusion query (no color or depth writes)
+extern void UpdateOcclusionCulling(void);       // Advance occlusion culling frame, evict draws not tested recently (called by EndDrawing())
+static void UnloadOcclusionCulling(void);       // Unload occlusion queries and proxy mesh
+#endif
+static void ComputeMeshBounds(Mesh *mesh);      // Compute mesh cached bounds (box and sphere) from vertices
+static bool IsMeshBoundsCached(Mesh mesh);      // Check if mesh cached bounds are available and not stale
+static void SetMeshBoundsStale(unsigned int positionsId, bool stale);   // Set mesh positions buffer bounds as stale (updated after caching) or valid
+static bool CheckFrustumMesh(Frustum frustum, Mesh mesh, Matrix transform); // Check if mesh cached bounds are available and not stale (positions updated after caching)
+static bool IsMeshBoundsCached(Mesh mesh)
+{
+    if (mesh.boundsRadius <= 0.0f) return false;
+
+    if ((staleBounds.count > 0) && (mesh.vboId != NULL))
+    {
+        for (int i = 0; i < staleBounds.count; i++) if (staleBounds.ids[i] == mesh.vboId[0]) return false;
+    }
+
+    return true;
+}
+
+// Set mesh positions buffer bounds as stale (positions updated after caching) or valid (bounds computed, mesh unloaded)
+static void SetMeshBoundsStale(unsigned int positionsId, bool stale)
+{
+    if (positionsId == 0) return;
+
+    for (int i = 0; i < staleBounds.count; i++)
+    {
+        if (staleBounds.ids[i] == positionsId)
+        {
+            if (!stale)
+            {
+                staleBounds.ids[i] = staleBounds.ids[--staleBounds.count];
+
+                if (staleBounds.count == 0)
+                {
+                    RL_FREE(staleBounds.ids);
+                    staleBounds.ids = NULL;
+                    staleBounds.capacity = 0;
+                }
+            }
+
+            return;
+        }
+    }
+
+    if (!stale) return;
+
+    if (staleBounds.count == staleBounds.capacity)
+    {
+        int capacity = (staleBounds.capacity > 0)? staleBounds.capacity*2 : 16;
+        unsigned int *ids = (unsigned int *)RL_REALLOC(staleBounds.ids, capacity*sizeof(unsigned int));
+        if (ids == NULL) return;
+
+        staleBounds.ids = ids;
+        staleBounds.capacity = capacity;
+    }
+
+    staleBounds.ids[staleBounds.count++] = positionsId;
+}
+
+// Check if transformed mesh cached bounds are inside frustum
+static Mesh SimplifyMesh(Mesh mesh, int triangleCount);  // Simplify mesh by edge collapse (CPU only, no upload)
+static int CompareSimplifyVertices(const void *a, const void *b);   // Compare simplification vertices positions
+static int CompareSimplifyEdges(const void *a, const void *b);      // Compare simplification edges collapse errors
+static void SimplifyModelLods(Model *model, int levels, float reduction);   // Generate model levels of detail meshes (CPU only, no upload)
+static void UnloadModelLods(Model *model);      // Unload model levels of detail meshes and arrays
+static int GetMeshAttributeStreams(Mesh *mesh, MeshAttributeStream *streams);  // Get mesh per-vertex attributes arrays available
+static int WeldMeshVertices(Mesh *mesh, unsigned int *remap);     // Weld identical vertices (all attributes), returns unique vertices count
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *remap, int vertexCount);  // Reorder mesh vertices attributes with remap table
+static float GetVertexCacheScore(int cachePosition, int valence);  // Get vertex score for vertex cache triangles reordering
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount);  // Reorder triangles for post-transform vertex cache (Forsyth)
+static void OptimizeMeshOverdraw(unsigned int *indices, int indexCount, const float *positions, int vertexCount);  // Reorder triangles clusters to reduce overdraw
+static int OptimizeMeshVertexFetch(unsigned int *indices, int indexCount, unsigned int *remap, int vertexCount);  // Get vertices remap in first use order, returns used vertices count
+#if defined(SUPPORT_MESH_GENERATION)
+static Mesh GenMeshSurfaces(const MeshSurface *surfaces, int count);   // Generate indexed mesh from parametric surfaces (CPU only, no upload)
+static void GetMeshSurfaceSize(MeshSurface surface, bool weld, int *vertexCount, int *triangleCount);  // Get parametric surface vertices and triangles count
+static int GetMeshSurfaceVertex(MeshSurface surface, bool weld, int stack, int slice);  // Get parametric surface grid point vertex index
+static void SurfaceSphere(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);   // Sphere surface (params: radius, theta range)
+static void SurfaceCylinder(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord); // Cylinder/cone side surface (params: bottom radius, top radius, height)
+static void SurfaceDisk(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);     // Disk surface (params: radius, height, facing)
+static void SurfacePlane(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);    // Plane surface (params: width, length)
+static void SurfaceTorus(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);    // Torus surface (params: tube radius, scale)
+static void SurfaceKnot(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord);     // Trefoil knot surface (params: tube radius, scale)
+#endif
+static int CompareOverdrawClusters(const void *a, const void *b); // Compare overdraw clusters sort keys (descending)
+static int BuildMeshBVHNode(MeshBVH *bvh, const MeshBVHTriangle *triangles, int *order, int first, int count, int depth);  // Build mesh BVH node for a triangles range, returns node index
+static float GetMeshBVHBoxArea(Vector3 min, Vector3 max);   // Get box half surface area, used as SAH cost
+static float GetMeshBVHNodeDistance(const MeshBVHNode *node, Vector3 origin, Vector3 invDirection, float maxDistance);  // Get ray entry distance into mesh BVH node box, FLT_MAX if missed
+static RayCollision RayCastMeshBVH(Ray ray, MeshBVH bvh, Matrix transform, Matrix invTransform, float maxDistance, bool anyHit);  // Cast ray against mesh BVH triangles
+static bool CheckCollisionMeshBVHShape(MeshBVH bvh, Matrix transform, BoundingBox bounds, const Vector3 *center, float radius);  // Check collision between mesh BVH triangles and sphere or box
+static Vector3 GetTriangleClosestPoint(Vector3 p, Vector3 a, Vector3 b, Vector3 c);    // Get closest point on triangle to point
+static bool CheckCollisionTriangleBox(Vector3 a, Vector3 b, Vector3 c, BoundingBox box);  // Check collision between triangle and box (separating axis test)
+static float GetSphereScreenSize(Vector3 center, float radius, Matrix matModelView, Matrix matProjection);  // Get bounding sphere projected size (screen height fraction)
+static int GetModelLod(Model model, Matrix transform);  // Get model level of detail for current projection and transform
+#if defined(SUPPORT_TEXTURE_STREAMING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static void SetMeshTexturesUsage(Mesh mesh, Material material, Matrix transform);  // Set streamed material textures usage from mesh projected size
+#endif
+static Mesh GetModelLodMesh(Model model, int mesh, int lod);  // Get model mesh for a level of detail (closest generated level)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void DrawMeshInstancedStreams(Mesh mesh, Material material, const unsigned int *vboIds, const int *offsets, int instances, unsigned int commandId);  // Draw mesh instances from instance data buffers (transforms, colors, custom), optionally indirect
+#endif
+#if defined(SUPPORT_GPU_CULLING) && defined(GRAPHICS_API_OPENGL_43)
+static void LoadShaderCulling(void);            // Load built-in instances culling compute shader (lazily, on first culled instance buffer draw)
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Matrix GetMeshDequantizeMatrix(Mesh mesh);   // Get mesh quantized positions dequantization transform (identity if not quantized)
+static const Matrix *GetMeshInstancesTransforms(Mesh mesh, const Matrix *transforms, int instances);  // Get instances transforms combined with mesh dequantization
+#if defined(SUPPORT_MESH_QUANTIZATION)
+static short *QuantizeMeshPositions(Mesh *mesh);    // Quantize mesh positions to 16 bit normalized integers (4 components, w unused)
+static unsigned short *QuantizeMeshTexcoords(const float *texcoords, int count);   // Quantize texcoords to 16 bit unsigned normalized integers, NULL if out of [0..1]
+static signed char *QuantizeMeshDirections(const float *directions, int components, int count);  // Quantize normals/tangents to 8 bit normalized integers (4 components)
+#endif
+#if defined(SUPPORT_MESH_INTERLEAVING)
+static void LoadMeshInterleavedBuffer(Mesh *mesh, void **quantized);   // Load mesh vertex attributes into a single interleaved vertex buffer
+#endif
+static void SetMeshInterleavedAttributes(Mesh mesh, Shader shader);    // Set interleaved mesh vertex attributes for shader locations (no VAO)
+#endif
+static int GetMeshBufferSize(Mesh mesh, int index);                     // Get mesh vertex buffer size (in bytes), 0 if unknown (quantized or interleaved)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+static void RecordMeshDrawCommand(Mesh mesh, Material material, const Matrix *transforms, int instances);  // Record a mesh draw into current thread command list
+static void SubmitMeshDrawCommand(void *data);  // Command list mesh draw callback (rendering thread)
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeModelJob(void *data);         // Model async load decode stage: parse model file (worker thread)
+static bool UploadModelJob(void *data);         // Model async load upload stage: meshes and textures (main thread)
+static int GetModelAsyncFormat(const char *fileName);   // Get model async load file format, uses path static buffers (main thread)
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+static bool DecodeModelReloadJob(void *data);   // Model reload decode stage: parse model file (worker thread)
+static bool UploadModelReloadJob(void *data);   // Model reload upload stage: replace meshes in place (main thread)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -910,57 +2123,337 @@ void DrawGrid(int slices, float spacing)
     rlEnd();
 }
 
-// Load model from files (mesh and material)
-Model LoadModel(const char *fileName)
+// Add debug line, drawn by DrawDebugPrimitives() until duration expires (0: drawn once)
+void AddDebugLine(Vector3 startPos, Vector3 endPos, Color color, float duration)
 {
-    Model model = { 0 };
-
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#if defined(SUPPORT_DEBUG_DRAW)
+    if (!ReserveDebugLines(1)) return;
+
+    DebugVertex *vertices = &debugDraw.vertices[2*debugDraw.lineCount];
+    vertices[0] = (DebugVertex){ startPos, color };
+    vertices[1] = (DebugVertex){ endPos, color };
+    debugDraw.lineTimes[debugDraw.lineCount] = duration;
+    debugDraw.lineCount++;
 #endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
+}
+
+// Add debug box wires, drawn as unit box instance
+void AddDebugBox(BoundingBox box, Color color, float duration)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    AddDebugShape(DEBUG_SHAPE_BOX, center, Vector3Subtract(box.max, box.min), color, duration);
 #endif
-#if defined(SUPPORT_FILEFORMAT_VOX)
-    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
+}
+
+// Add debug sphere wires, drawn as unit sphere instance (three axis circles)
+void AddDebugSphere(Vector3 center, float radius, Color color, float duration)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    AddDebugShape(DEBUG_SHAPE_SPHERE, center, (Vector3){ radius, radius, radius }, color, duration);
 #endif
+}
 
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+// Add debug transform axes, axes directions are normalized to size
+void AddDebugAxes(Matrix transform, float size, float duration)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    Vector3 origin = { transform.m12, transform.m13, transform.m14 };
 
-    if (model.meshCount == 0)
-    {
-        model.meshCount = 1;
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-#if defined(SUPPORT_MESH_GENERATION)
-        TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data, default to cube mesh", fileName);
-        model.meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
-#else
-        TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data", fileName);
+    AddDebugLine(origin, Vector3Add(origin, Vector3Scale(Vector3Normalize((Vector3){ transform.m0, transform.m1, transform.m2 }), size)), RED, duration);
+    AddDebugLine(origin, Vector3Add(origin, Vector3Scale(Vector3Normalize((Vector3){ transform.m4, transform.m5, transform.m6 }), size)), GREEN, duration);
+    AddDebugLine(origin, Vector3Add(origin, Vector3Scale(Vector3Normalize((Vector3){ transform.m8, transform.m9, transform.m10 }), size)), BLUE, duration);
 #endif
-    }
-    else
+}
+
+// Add debug grid on XZ plane, centered at (0, 0, 0)
+void AddDebugGrid(int slices, float spacing, Color color, float duration)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    int halfSlices = slices/2;
+    float extent = (float)halfSlices*spacing;
+
+    for (int i = -halfSlices; i <= halfSlices; i++)
     {
-        // Upload vertex data to GPU (static mesh)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        AddDebugLine((Vector3){ (float)i*spacing, 0.0f, -extent }, (Vector3){ (float)i*spacing, 0.0f, extent }, color, duration);
+        AddDebugLine((Vector3){ -extent, 0.0f, (float)i*spacing }, (Vector3){ extent, 0.0f, (float)i*spacing }, color, duration);
     }
+#endif
+}
+
+// Draw debug primitives with current camera, primitives expired after this frame are removed
+// NOTE: Lines are uploaded and drawn with one draw call, boxes and spheres are unit shapes instances (one draw call per shape type),
+// without instancing support shapes are expanded from unit shapes into rlgl batch (OpenGL 1.1: all primitives)
+void DrawDebugPrimitives(void)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    if (!debugUnitShapesReady) GenDebugUnitShapes();
+
+    rlDrawRenderBatchActive();      // Draw pending batch before debug primitives (keep drawing order)
+    if (debugDraw.noDepthTest) rlDisableDepthTest();
 
-    if (model.materialCount == 0)
+    bool drawn = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!rlIsCommandListRecording())
     {
-        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load material data, default to white material", fileName);
+        if (!debugShaderLoaded) LoadShaderDebugDraw();
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+        if (debugShader.id > 0)
+        {
+            int positionLoc = debugShader.locs[SHADER_LOC_VERTEX_POSITION];
+            int colorLoc = debugShader.locs[SHADER_LOC_VERTEX_COLOR];
+            Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-    }
+            rlEnableShader(debugShader.id);
+            rlSetUniformMatrix(debugShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, rlGetMatrixProjection()));
 
-    return model;
-}
+            // NOTE: Attributes are set on every draw, instance data offset changes on every upload
+            // and vertex array objects could not be supported (OpenGL ES 2.0)
+            rlEnableVertexArray(debugVaoId);
+
+            if (debugDraw.lineCount > 0)
+            {
+                const float center[3] = { 0.0f, 0.0f, 0.0f };
+                const float scale[3] = { 1.0f, 1.0f, 1.0f };
+
+                int offset = 0;
+                unsigned int bufferId = rlUpdateInstanceStream(debugDraw.vertices, 2*debugDraw.lineCount*sizeof(DebugVertex), &offset);
+
+                rlEnableVertexBuffer(bufferId);
+                rlSetVertexAttribute(positionLoc, 3, RL_FLOAT, 0, sizeof(DebugVertex), (void *)(size_t)offset);
+                rlEnableVertexAttribute(positionLoc);
+                rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, 1, sizeof(DebugVertex), (void *)(size_t)(offset + 3*sizeof(float)));
+                rlEnableVertexAttribute(colorLoc);
+
+                // Lines are not moved or scaled, instance attributes take default values
+                rlDisableVertexAttribute(debugShaderLocs[0]);
+                rlDisableVertexAttribute(debugShaderLocs[1]);
+                rlSetVertexAttributeDefault(debugShaderLocs[0], center, SHADER_ATTRIB_VEC3, 3);
+                rlSetVertexAttributeDefault(debugShaderLocs[1], scale, SHADER_ATTRIB_VEC3, 3);
+
+                rlDrawVertexArrayLines(0, 2*debugDraw.lineCount);
+            }
+
+            for (int type = 0; type < DEBUG_SHAPE_COUNT; type++)
+            {
+                int count = debugDraw.shapeCount[type];
+                if ((count == 0) || !rlIsInstancingSupported()) continue;
+
+                int offset = 0;
+                unsigned int bufferId = rlUpdateInstanceStream(debugDraw.shapes[type], count*sizeof(DebugShape), &offset);
+
+                rlEnableVertexBuffer(debugShapesVboId);
+                rlSetVertexAttribute(positionLoc, 3, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(positionLoc);
+
+                rlEnableVertexBuffer(bufferId);
+                rlSetVertexAttribute(debugShaderLocs[0], 3, RL_FLOAT, 0, sizeof(DebugShape), (void *)(size_t)offset);
+                rlSetVertexAttribute(debugShaderLocs[1], 3, RL_FLOAT, 0, sizeof(DebugShape), (void *)(size_t)(offset + 3*sizeof(float)));
+                rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, 1, sizeof(DebugShape), (void *)(size_t)(offset + 6*sizeof(float)));
+
+                int locs[3] = { debugShaderLocs[0], debugShaderLocs[1], colorLoc };
+                for (int i = 0; i < 3; i++)
+                {
+                    rlEnableVertexAttribute(locs[i]);
+                    rlSetVertexAttributeDivisor(locs[i], 1);
+                }
+
+                if (type == DEBUG_SHAPE_BOX) rlDrawVertexArrayLinesInstanced(0, DEBUG_BOX_VERTICES, count);
+                else rlDrawVertexArrayLinesInstanced(DEBUG_BOX_VERTICES, DEBUG_SPHERE_VERTICES, count);
+
+                for (int i = 0; i < 3; i++)
+                {
+                    rlSetVertexAttributeDivisor(locs[i], 0);
+                    rlDisableVertexAttribute(locs[i]);
+                }
+            }
+
+            rlDisableVertexAttribute(positionLoc);
+            rlDisableVertexAttribute(colorLoc);
+            rlDisableVertexBuffer();
+            rlDisableVertexArray();
+            rlDisableShader();
+
+            // Shapes not instanced are expanded into rlgl batch
+            if (!rlIsInstancingSupported()) for (int type = 0; type < DEBUG_SHAPE_COUNT; type++) DrawDebugShapesBatch(type);
+
+            drawn = true;
+        }
+    }
+#endif
+
+    if (!drawn)
+    {
+        for (int i = 0; i < debugDraw.lineCount; i++)
+        {
+            const DebugVertex *vertices = &debugDraw.vertices[2*i];
+
+            rlCheckRenderBatchLimit(2);
+
+            rlBegin(RL_LINES);
+                rlColor4ub(vertices[0].color.r, vertices[0].color.g, vertices[0].color.b, vertices[0].color.a);
+                rlVertex3f(vertices[0].position.x, vertices[0].position.y, vertices[0].position.z);
+                rlVertex3f(vertices[1].position.x, vertices[1].position.y, vertices[1].position.z);
+            rlEnd();
+        }
+
+        for (int type = 0; type < DEBUG_SHAPE_COUNT; type++) DrawDebugShapesBatch(type);
+    }
+
+    rlDrawRenderBatchActive();      // Batch lines are drawn with debug depth test state
+    if (debugDraw.noDepthTest) rlEnableDepthTest();
+
+    // Primitives are aged by frame time, one frame primitives (duration 0) expire now
+    float frameTime = GetFrameTime();
+    int count = 0;
+
+    for (int i = 0; i < debugDraw.lineCount; i++)
+    {
+        float time = debugDraw.lineTimes[i] - frameTime;
+        if (time <= 0.0f) continue;
+
+        debugDraw.vertices[2*count] = debugDraw.vertices[2*i];
+        debugDraw.vertices[2*count + 1] = debugDraw.vertices[2*i + 1];
+        debugDraw.lineTimes[count] = time;
+        count++;
+    }
+
+    debugDraw.lineCount = count;
+
+    for (int type = 0; type < DEBUG_SHAPE_COUNT; type++)
+    {
+        count = 0;
+
+        for (int i = 0; i < debugDraw.shapeCount[type]; i++)
+        {
+            float time = debugDraw.shapeTimes[type][i] - frameTime;
+            if (time <= 0.0f) continue;
+
+            debugDraw.shapes[type][count] = debugDraw.shapes[type][i];
+            debugDraw.shapeTimes[type][count] = time;
+            count++;
+        }
+
+        debugDraw.shapeCount[type] = count;
+    }
+
+    debugDraw.overflow = false;
+#endif
+}
+
+// Clear all debug primitives (kept memory is reused)
+void ClearDebugPrimitives(void)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    debugDraw.lineCount = 0;
+    for (int type = 0; type < DEBUG_SHAPE_COUNT; type++) debugDraw.shapeCount[type] = 0;
+#endif
+}
+
+// Set debug primitives depth test, disabled primitives are drawn over scene
+void SetDebugDrawDepthTest(bool enabled)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    debugDraw.noDepthTest = !enabled;
+#endif
+}
+
+// Load model from files (mesh and material)
+Model LoadModel(const char *fileName)
+{
+    Model model = { 0 };
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if (LoadCachedResource(RESOURCE_MODEL, fileName, &model, sizeof(Model))) return model;
+#endif
+
+    BeginLoadingBoost();
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName, NULL, NULL, NULL);
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    bool cooked = IsFileExtension(fileName, ".rmdl");
+    if (cooked) model = LoadRMDL(fileName, NULL);
+#else
+    bool cooked = false;
+#endif
+
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+    // NOTE: Cooked models meshes are stored already optimized
+    if (!cooked) for (int i = 0; i < model.meshCount; i++) OptimizeMesh(&model.meshes[i], MESH_OPTIMIZE_ALL);
+#endif
+
+    UploadModel(&model, fileName);
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Cached model shares meshes, materials and skeleton, animated models share pose too
+    if (model.meshes != NULL) CacheResource(RESOURCE_MODEL, fileName, &model, sizeof(Model), (unsigned long long)(size_t)model.meshes);
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    // NOTE: Meshes are replaced on reload, materials and skeleton are kept
+    if (model.meshCount > 0)
+    {
+        AssetReloadJob asset = { 0 };
+        strncpy(asset.fileName[0], fileName, sizeof(asset.fileName[0]) - 1);
+        asset.ptr[0] = model.meshes;
+        asset.ptr[1] = model.lodMeshes;
+        asset.params[0] = model.meshCount;
+        asset.params[1] = GetModelAsyncFormat(fileName);
+        asset.params[2] = model.lodCount;
+        asset.params[3] = model.boneCount;
+
+        WatchAsset(ASSET_WATCH_MODEL, &asset, DecodeModelReloadJob, UploadModelReloadJob);
+    }
+#endif
+
+    EndLoadingBoost();
+
+    return model;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load model from file asynchronously, file is parsed on a worker thread and meshes/textures uploaded on EndDrawing()
+// NOTE: OBJ models are completely loaded on upload stage, loader changes working directory to load materials
+unsigned int LoadModelAsync(const char *fileName)
+{
+    ModelLoadJob *job = (ModelLoadJob *)RL_CALLOC(1, sizeof(ModelLoadJob));
+    strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+    // NOTE: File format and directory are resolved here, IsFileExtension() and GetDirectoryPath()
+    // use static buffers, not safe on worker threads
+    job->format = GetModelAsyncFormat(fileName);
+    strncpy(job->dirPath, GetDirectoryPath(fileName), sizeof(job->dirPath) - 1);
+    job->textures.dirPath = job->dirPath;
+
+    return SubmitAsyncJob(ASYNC_JOB_MODEL, job, DecodeModelJob, UploadModelJob);
+}
+
+// Get model loaded asynchronously, waits for the load to finish and releases the load handle
+// NOTE: As LoadModel(), a default cube mesh and material are provided if model could not be loaded
+Model GetAsyncModel(unsigned int handle)
+{
+    Model model = { 0 };
+
+    ModelLoadJob *job = (ModelLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_MODEL);
+    if (job != NULL) model = job->model;
+
+    ReleaseAsyncJob(handle);
+
+    return model;
+}
+#endif
 
 // Load model from generated mesh
 // WARNING: A shallow copy of mesh is generated, passed by value,
@@ -991,8 +2484,17 @@ Model LoadModelFromMesh(Mesh mesh)
 // over them, use UnloadMesh() and UnloadMaterial()
 void UnloadModel(Model model)
 {
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Cached model is unloaded with its last reference
+    if ((model.meshes != NULL) && (ReleaseCachedResource(RESOURCE_MODEL, (unsigned long long)(size_t)model.meshes) > 0)) return;
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    UnwatchAsset(ASSET_WATCH_MODEL, 0, model.meshes);
+#endif
+
     // Unload meshes
     for (int i = 0; i < model.meshCount; i++) UnloadMesh(model.meshes[i]);
+    UnloadModelLods(&model);
 
     // Unload materials maps
     // NOTE: As the user could be sharing shaders and textures between models,
@@ -1015,6 +2517,16 @@ void UnloadModel(Model model)
 // Unload model (but not meshes) from memory (RAM and/or VRAM)
 void UnloadModelKeepMeshes(Model model)
 {
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if ((model.meshes != NULL) && (ReleaseCachedResource(RESOURCE_MODEL, (unsigned long long)(size_t)model.meshes) > 0)) return;
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    UnwatchAsset(ASSET_WATCH_MODEL, 0, model.meshes);
+#endif
+
+    // Unload levels of detail meshes, generated by the model
+    UnloadModelLods(&model);
+
     // Unload materials maps
     // NOTE: As the user could be sharing shaders and textures between models,
     // we don't unload the material but just free it's maps,
@@ -1033,6 +2545,23 @@ void UnloadModelKeepMeshes(Model model)
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (but not meshes) from RAM and VRAM");
 }
 
+// Export model as cooked RMDL file: meshes (and levels of detail), materials, skeleton and animations (optional)
+// NOTE: Material textures are read back from GPU and embedded (with mipmaps), compressed textures are not supported
+bool ExportModel(Model model, const ModelAnimation *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) success = SaveRMDL(model, animations, animCount, fileName);
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Model export file format not supported", fileName);
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Model exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export model", fileName);
+
+    return success;
+}
+
 // Compute model bounding box limits (considers all meshes)
 BoundingBox GetModelBoundingBox(Model model)
 {
@@ -1062,6 +2591,20 @@ BoundingBox GetModelBoundingBox(Model model)
     return bounds;
 }
 
+// Generate model simplified levels of detail (reduction: triangles kept per level)
+// NOTE: Previous levels are unloaded, meshes under MODEL_LOD_MIN_TRIANGLES or skinned are not simplified,
+// levels <= 0 just removes model levels of detail
+void GenModelLods(Model *model, int levels, float reduction)
+{
+    SimplifyModelLods(model, levels, reduction);
+
+    // Upload vertex data to GPU (static mesh)
+    for (int i = 0; i < model->lodCount*model->meshCount; i++)
+    {
+        if ((model->lodMeshes[i].vertexCount > 0) && (model->lodMeshes[i].vaoId == 0)) UploadMesh(&model->lodMeshes[i], false);
+    }
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void UploadMesh(Mesh *mesh, bool dynamic)
 {
@@ -1072,8 +2615,16 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         return;
     }
 
+    // Cache mesh bounds, used by GetMeshBoundingBox() and frustum culling
+    ComputeMeshBounds(mesh);
+
+    // NOTE: Without window there is no GPU context, mesh is kept in RAM only (vboId = NULL)
+    if (!IsWindowReady()) return;
+
     mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
 
+    mesh->quantization = 0;
+
     mesh->vaoId = 0;        // Vertex Array Object
     mesh->vboId[0] = 0;     // Vertex buffer: positions
     mesh->vboId[1] = 0;     // Vertex buffer: texcoords
@@ -1082,6 +2633,10 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     mesh->vboId[4] = 0;     // Vertex buffer: tangents
     mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
     mesh->vboId[6] = 0;     // Vertex buffer: indices
+#if defined(SUPPORT_GPU_SKINNING)
+    mesh->vboId[7] = 0;     // Vertex buffer: bone ids
+    mesh->vboId[8] = 0;     // Vertex buffer: bone weights
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     mesh->vaoId = rlLoadVertexArray();
@@ -1089,94 +2644,281 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 
     // NOTE: Attributes must be uploaded considering default locations points
 
-    // Enable vertex attributes: position (shader-location = 0)
-    void *vertices = mesh->animVertices != NULL ? mesh->animVertices : mesh->vertices;
-    mesh->vboId[0] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
-    rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(0);
-
-    // Enable vertex attributes: texcoords (shader-location = 1)
-    mesh->vboId[1] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
-    rlSetVertexAttribute(1, 2, RL_FLOAT, 0, 0, 0);
-    rlEnableVertexAttribute(1);
+    // Quantized attributes data (NULL if not quantized)
+    void *quantized[4] = { NULL };  // Positions, texcoords, normals, tangents
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    // NOTE: Only static meshes are quantized, animated meshes vertex data is updated as float
+    unsigned int quantize = 0;
+    if (!dynamic && (mesh->animVertices == NULL) && (mesh->boneIds == NULL)) quantize = meshQuantization;
 
-    if (mesh->normals != NULL)
+    if ((quantize & MESH_QUANTIZE_POSITION) && (mesh->vertices != NULL)) quantized[0] = QuantizeMeshPositions(mesh);
+    if ((quantize & MESH_QUANTIZE_TEXCOORD) && (mesh->texcoords != NULL)) quantized[1] = QuantizeMeshTexcoords(mesh->texcoords, mesh->vertexCount);
+    if ((quantize & MESH_QUANTIZE_NORMAL) && (mesh->normals != NULL))
     {
-        // Enable vertex attributes: normals (shader-location = 2)
-        void *normals = mesh->animNormals != NULL ? mesh->animNormals : mesh->normals;
-        mesh->vboId[2] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
-        rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(2);
+        // NOTE: Tangents are quantized along normals, both or none
+        quantized[2] = QuantizeMeshDirections(mesh->normals, 3, mesh->vertexCount);
+        if (mesh->tangents != NULL) quantized[3] = QuantizeMeshDirections(mesh->tangents, 4, mesh->vertexCount);
+
+        if ((quantized[2] == NULL) || ((mesh->tangents != NULL) && (quantized[3] == NULL)))
+        {
+            RL_FREE(quantized[2]);
+            RL_FREE(quantized[3]);
+            quantized[2] = NULL;
+            quantized[3] = NULL;
+        }
     }
+#endif
+
+#if defined(SUPPORT_MESH_INTERLEAVING)
+    // NOTE: Only static meshes are interleaved, animated meshes and UpdateMeshBuffer() require one buffer per attribute
+    if (!dynamic && (mesh->animVertices == NULL) && (mesh->boneIds == NULL) && meshInterleaving) LoadMeshInterleavedBuffer(mesh, quantized);
     else
+#endif
     {
-        // Default color vertex attribute set to WHITE
-        float value[3] = { 1.0f, 1.0f, 1.0f };
-        rlSetVertexAttributeDefault(2, value, SHADER_ATTRIB_VEC3, 3);
-        rlDisableVertexAttribute(2);
-    }
+        // Enable vertex attributes: position (shader-location = 0)
+        if (quantized[0] != NULL)
+        {
+            // NOTE: Positions dequantized by model transform on draw (GetMeshDequantizeMatrix())
+            mesh->vboId[0] = rlLoadVertexBuffer(quantized[0], mesh->vertexCount*4*sizeof(short), dynamic);
+            rlSetVertexAttribute(0, 3, RL_SHORT, 1, 4*sizeof(short), 0);
+            mesh->quantization |= MESH_QUANTIZE_POSITION;
+        }
+        else
+        {
+            void *vertices = mesh->animVertices != NULL ? mesh->animVertices : mesh->vertices;
+            mesh->vboId[0] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
+            rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, 0);
+        }
+        rlEnableVertexAttribute(0);
 
-    if (mesh->colors != NULL)
-    {
-        // Enable vertex attribute: color (shader-location = 3)
-        mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
-        rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-        rlEnableVertexAttribute(3);
+        // Enable vertex attributes: texcoords (shader-location = 1)
+        if (quantized[1] != NULL)
+        {
+            mesh->vboId[1] = rlLoadVertexBuffer(quantized[1], mesh->vertexCount*2*sizeof(unsigned short), dynamic);
+            rlSetVertexAttribute(1, 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            mesh->quantization |= MESH_QUANTIZE_TEXCOORD;
+        }
+        else
+        {
+            mesh->vboId[1] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
+            rlSetVertexAttribute(1, 2, RL_FLOAT, 0, 0, 0);
+        }
+        rlEnableVertexAttribute(1);
+
+        if (quantized[2] != NULL)
+        {
+            // Enable vertex attributes: normals (shader-location = 2)
+            mesh->vboId[2] = rlLoadVertexBuffer(quantized[2], mesh->vertexCount*4*sizeof(signed char), dynamic);
+            rlSetVertexAttribute(2, 3, RL_BYTE, 1, 4*sizeof(signed char), 0);
+            rlEnableVertexAttribute(2);
+            mesh->quantization |= MESH_QUANTIZE_NORMAL;
+        }
+        else if (mesh->normals != NULL)
+        {
+            // Enable vertex attributes: normals (shader-location = 2)
+            void *normals = mesh->animNormals != NULL ? mesh->animNormals : mesh->normals;
+            mesh->vboId[2] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
+            rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(2);
+        }
+        else
+        {
+            // Default color vertex attribute set to WHITE
+            float value[3] = { 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(2, value, SHADER_ATTRIB_VEC3, 3);
+            rlDisableVertexAttribute(2);
+        }
+
+        if (mesh->colors != NULL)
+        {
+            // Enable vertex attribute: color (shader-location = 3)
+            mesh->vboId[3] = rlLoadVertexBuffer(mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+            rlSetVertexAttribute(3, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            rlEnableVertexAttribute(3);
+        }
+        else
+        {
+            // Default color vertex attribute set to WHITE
+            float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(3, value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(3);
+        }
+
+        if (mesh->tangents != NULL)
+        {
+            // Enable vertex attribute: tangent (shader-location = 4)
+            if (quantized[3] != NULL)
+            {
+                mesh->vboId[4] = rlLoadVertexBuffer(quantized[3], mesh->vertexCount*4*sizeof(signed char), dynamic);
+                rlSetVertexAttribute(4, 4, RL_BYTE, 1, 0, 0);
+            }
+            else
+            {
+                mesh->vboId[4] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
+                rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
+            }
+            rlEnableVertexAttribute(4);
+        }
+        else
+        {
+            // Default tangents vertex attribute
+            float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            rlSetVertexAttributeDefault(4, value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(4);
+        }
+
+        if (mesh->texcoords2 != NULL)
+        {
+            // Enable vertex attribute: texcoord2 (shader-location = 5)
+            mesh->vboId[5] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
+            rlSetVertexAttribute(5, 2, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(5);
+        }
+        else
+        {
+            // Default texcoord2 vertex attribute
+            float value[2] = { 0.0f, 0.0f };
+            rlSetVertexAttributeDefault(5, value, SHADER_ATTRIB_VEC2, 2);
+            rlDisableVertexAttribute(5);
+        }
     }
-    else
+
+    if (mesh->indices != NULL)
     {
-        // Default color vertex attribute set to WHITE
-        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-        rlSetVertexAttributeDefault(3, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(3);
+        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
     }
 
-    if (mesh->tangents != NULL)
+#if defined(SUPPORT_GPU_SKINNING)
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
     {
-        // Enable vertex attribute: tangent (shader-location = 4)
-        mesh->vboId[4] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(4);
+        // Enable vertex attribute: bone ids (shader-location = 6)
+        // NOTE: Ids are not normalized, shader receives them as float values
+        mesh->vboId[7] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+        rlSetVertexAttribute(6, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(6);
+
+        // Enable vertex attribute: bone weights (shader-location = 7)
+        mesh->vboId[8] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), dynamic);
+        rlSetVertexAttribute(7, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(7);
     }
-    else
+#endif
+
+#if defined(GPU_MORPHING_SUPPORTED)
+    // Morph targets deltas are fetched on vertex shader, vertex data is not updated on weights changes
+    // NOTE: Meshes with animated vertex data are blended on CPU
+    if ((mesh->morphTargetCount > 0) && (mesh->morphVertices != NULL) && (mesh->animVertices == NULL)) mesh->morphTextureId = LoadMeshMorphTexture(mesh);
+#endif
+
+    for (int i = 0; i < 4; i++) RL_FREE(quantized[i]);
+
+    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
+    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
+
+    rlDisableVertexArray();
+#endif
+}
+
+// Set vertex attributes quantization for next static meshes uploaded (MeshQuantizeFlags)
+// NOTE: Dynamic and animated meshes are always uploaded as float, mesh.quantization reports applied flags
+void SetMeshQuantization(unsigned int flags)
+{
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    meshQuantization = flags & MESH_QUANTIZE_ALL;
+#endif
+}
+
+// Set vertex attributes interleaving for next static meshes uploaded (single vertex buffer)
+// NOTE: Interleaved meshes store all attributes in vboId[0] (mesh.vertexStride > 0), UpdateMeshBuffer() is not supported
+void SetMeshInterleaving(bool enabled)
+{
+#if defined(SUPPORT_MESH_INTERLEAVING)
+    meshInterleaving = enabled;
+#endif
+}
+
+// Set mesh morph targets weights, weights not provided are set to 0
+// NOTE: Morph targets are blended on draw by default material shader (OpenGL 3.3), vertex data is not updated,
+// otherwise they are blended on CPU and animated vertex data uploaded on weights changes
+void SetMeshMorphWeights(Mesh mesh, const float *weights, int count)
+{
+    if ((mesh.morphTargetCount <= 0) || (mesh.morphWeights == NULL)) return;
+
+    bool changed = false;
+
+    for (int t = 0; t < mesh.morphTargetCount; t++)
     {
-        // Default tangents vertex attribute
-        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(4, value, SHADER_ATTRIB_VEC4, 4);
-        rlDisableVertexAttribute(4);
+        float weight = ((weights != NULL) && (t < count))? weights[t] : 0.0f;
+
+        if (mesh.morphWeights[t] != weight)
+        {
+            mesh.morphWeights[t] = weight;
+            changed = true;
+        }
     }
 
-    if (mesh->texcoords2 != NULL)
+    if (changed && (mesh.morphTextureId == 0)) BlendMeshMorphTargets(mesh);
+}
+
+// Update mesh vertex data in GPU for a specific buffer index
+// NOTE: Updating positions (index 0) invalidates mesh cached bounds until UpdateMeshBounds() is called
+void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
+{
+    if ((mesh.vertexStride > 0) && (index < 6))
     {
-        // Enable vertex attribute: texcoord2 (shader-location = 5)
-        mesh->vboId[5] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(5, 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(5);
+        TRACELOG(LOG_WARNING, "MESH: Interleaved mesh vertex buffers can not be updated by attribute, upload mesh as dynamic");
+        return;
     }
-    else
+
+    if ((index == 0) && (mesh.boundsRadius > 0.0f)) SetMeshBoundsStale(mesh.vboId[0], true);
+
+    // Full buffer updates replace (orphan) the buffer data store, GPU could be reading previous data (i.e. last frame draws)
+    if ((offset == 0) && (dataSize == GetMeshBufferSize(mesh, index))) rlResizeVertexBuffer(mesh.vboId[index], data, dataSize, true);
+    else rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
+}
+
+// Map mesh vertex buffer for writing, vertex data can be written directly without an intermediate array
+// NOTE: Previous buffer data is discarded (GPU keeps it for pending draws), whole buffer must be written,
+// data is mapped into client memory and uploaded on unmap if GPU buffers mapping is not supported
+// WARNING: Only one mesh buffer can be mapped at a time
+void *MapMeshBuffer(Mesh mesh, int index)
+{
+    int size = ((mesh.vboId != NULL) && (index >= 0) && (index < MAX_MESH_VERTEX_BUFFERS) && (mesh.vboId[index] != 0))? GetMeshBufferSize(mesh, index) : 0;
+
+    if (size == 0)
     {
-        // Default texcoord2 vertex attribute
-        float value[2] = { 0.0f, 0.0f };
-        rlSetVertexAttributeDefault(5, value, SHADER_ATTRIB_VEC2, 2);
-        rlDisableVertexAttribute(5);
+        TRACELOG(LOG_WARNING, "MESH: Vertex buffer %i can not be mapped (not available, quantized or interleaved)", index);
+        return NULL;
     }
 
-    if (mesh->indices != NULL)
+    void *data = rlMapVertexBuffer(mesh.vboId[index], size);
+
+    if (data == NULL)
     {
-        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
+        meshBufferMapped.data = RL_MALLOC(size);
+        meshBufferMapped.id = mesh.vboId[index];
+        meshBufferMapped.size = size;
+        data = meshBufferMapped.data;
     }
 
-    if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
-    else TRACELOG(LOG_INFO, "VBO: Mesh uploaded successfully to VRAM (GPU)");
-
-    rlDisableVertexArray();
-#endif
+    return data;
 }
 
-// Update mesh vertex data in GPU for a specific buffer index
-void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
+// Unmap mesh vertex buffer, written data is used by next draws
+void UnmapMeshBuffer(Mesh mesh, int index)
 {
-    rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
+    if ((mesh.vboId == NULL) || (index < 0) || (index >= MAX_MESH_VERTEX_BUFFERS) || (mesh.vboId[index] == 0)) return;
+
+    if ((meshBufferMapped.id != 0) && (meshBufferMapped.id == mesh.vboId[index]))
+    {
+        rlResizeVertexBuffer(meshBufferMapped.id, meshBufferMapped.data, meshBufferMapped.size, true);
+
+        RL_FREE(meshBufferMapped.data);
+        meshBufferMapped.data = NULL;
+        meshBufferMapped.id = 0;
+        meshBufferMapped.size = 0;
+    }
+    else rlUnmapVertexBuffer(mesh.vboId[index]);
 }
 
 // Draw a 3d mesh with material and transform
@@ -1215,180 +2957,278 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Bind shader program
-    rlEnableShader(material.shader.id);
-
-    // Send required data to shader (matrices, values)
-    //-----------------------------------------------------
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    // Record draw if current thread is recording a command list, it is drawn on rlSubmitCommandList()
+    if (rlIsCommandListRecording())
     {
-        float values[4] = {
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+        RecordMeshDrawCommand(mesh, material, &transform, 0);
+        return;
     }
+#endif
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    SetMeshTexturesUsage(mesh, material, transform);
+#endif
 
-    // Upload to shader material.colSpecular (if location available)
-    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    // Record draw if render queue is active, it is drawn on EndRenderQueue()
+    if (renderQueue.recording)
     {
-        float values[4] = {
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+        RecordQueuedDraw(mesh, material, transform);
+        return;
     }
 
+    RL_PROFILE_ZONE_BEGIN(zone, "DrawMesh");
+
     // Get a copy of current matrices to work with,
     // just in case stereo render is required and we need to modify them
     // NOTE: At this point the modelview matrix just contains the view matrix (camera)
     // That's because BeginMode3D() sets it and there is no model-drawing function
     // that modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matModel = MatrixIdentity();
     Matrix matView = rlGetMatrixModelview();
-    Matrix matModelView = MatrixIdentity();
     Matrix matProjection = rlGetMatrixProjection();
 
-    // Upload view and projection matrices (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
-    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
-
-    // Model transformation matrix is send to shader uniform location: SHADER_LOC_MATRIX_MODEL
-    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
-
     // Accumulate several model transformations:
     //    transform: model transformation provided (includes DrawModel() params combined with model.transform)
     //    rlGetMatrixTransform(): rlgl internal transform matrix due to push/pop matrix stack
-    matModel = MatrixMultiply(transform, rlGetMatrixTransform());
-
-    // Get model-view matrix
-    matModelView = MatrixMultiply(matModel, matView);
+    Matrix matModel = MatrixMultiply(transform, rlGetMatrixTransform());
 
-    // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
-    //-----------------------------------------------------
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+    int occlusionTest = TestOcclusionMesh(mesh, matModel, matView, matProjection);
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    if (!(occlusionTest & OCCLUSION_DRAW))
     {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+        rlDisableShader();
+        RL_PROFILE_ZONE_END(zone);
+        return;
+    }
+#endif
 
-            // Enable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
-            else rlEnableTexture(material.maps[i].texture.id);
+    material.shader = GetMeshShader(mesh, material);
 
-            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
-        }
-    }
+    SetMeshShaderState(material.shader, matView, matProjection);
+    SetMeshMaterialState(material, NULL);
+    DrawMeshGeometry(mesh, material, transform, matModel, matView, matProjection);
+    ResetMeshMaterialState(material);
 
-    // Try binding vertex array objects (VAO)
-    // or use VBOs if not possible
-    if (!rlEnableVertexArray(mesh.vaoId))
-    {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+    if (occlusionTest & OCCLUSION_CONDITIONAL) rlEndConditionalRender();
+#endif
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Disable shader program
+    rlDisableShader();
+
+    // Restore rlgl internal modelview and projection matrices
+    rlSetMatrixModelview(matView);
+    rlSetMatrixProjection(matProjection);
+
+    RL_PROFILE_ZONE_END(zone);
+#endif
+}
+
+// Begin deferred 3D render queue
+// NOTE: DrawMesh()/DrawModel() calls are recorded until EndRenderQueue(), instanced and wires draws are not queued
+void BeginRenderQueue(void)
+{
+    if (renderQueue.recording) EndRenderQueue();
+
+    renderQueue.count = 0;
+    renderQueue.pass = RENDER_PASS_AUTO;
+    renderQueue.castShadows = true;
+    renderQueue.pickId = 0;
+    renderQueue.recording = true;
+}
+
+// Set render pass for next recorded draws
+// NOTE: RENDER_PASS_AUTO selects transparent pass for materials with diffuse color alpha < 255
+void SetRenderQueuePass(int pass)
+{
+    renderQueue.pass = pass;
+}
+
+// Set if next recorded draws cast shadows (dynamic casters, drawn into shadow atlas every frame)
+// NOTE: Draws cast shadows by default, static geometry is better registered with AddShadowCaster() (cached)
+void SetRenderQueueShadows(bool castShadows)
+{
+    renderQueue.castShadows = castShadows;
+}
+
+// Set render queue automatic instancing: consecutive opaque draws of same mesh and material are drawn as instances
+// NOTE: Only default shader draws are instanced, draws diffuse color (DrawModel() tint) is sent as instance color
+void SetRenderQueueInstancing(bool enabled)
+{
+    renderQueue.instancing = enabled;
+}
+
+// Set picking id for next recorded draws, 0 for not pickable draws (default)
+// NOTE: Ids are application defined (i.e. entity index + 1), several draws could share an id
+void SetRenderQueuePickId(unsigned int id)
+{
+    renderQueue.pickId = id;
+}
+
+// Request picking of draw id under position (viewport pixels, i.e. GetMousePosition())
+// NOTE: Only the requested pixel is rendered by next EndRenderQueue(), result is read back without waiting
+// on a later EndRenderQueue(), usually next frame, requests are ignored while a readback is in flight
+void RequestRenderQueuePick(Vector2 position)
+{
+#if defined(PICKING_SUPPORTED)
+    picking.requested = true;
+    picking.position = position;
+#endif
+}
+
+// Get last picked draw id read back, 0 if no pickable draw was under position
+unsigned int GetRenderQueuePick(void)
+{
+#if defined(PICKING_SUPPORTED)
+    return picking.result;
+#else
+    return 0;
+#endif
+}
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+// Set occlusion culling: large meshes draws occluded on previous frame are skipped (DrawMesh(), DrawModel() and render queue)
+// NOTE: Draws bounding boxes are tested with GPU occlusion queries against depth of previous draws, results are read with
+// one frame of latency, draws found occluded are drawn with conditional rendering if supported (no popping)
+void SetOcclusionCulling(bool enabled)
+{
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+    if (enabled)
+    {
+        unsigned int query = rlLoadOcclusionQuery();
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+        if (query == 0)
         {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+            TRACELOG(LOG_WARNING, "MODEL: Occlusion queries not supported, occlusion culling disabled");
+            enabled = false;
         }
+        else rlUnloadOcclusionQuery(query);
+    }
+
+    occlusion.enabled = enabled;
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "MODEL: Occlusion culling not supported");
+#endif
+}
+
+// Get draws found occluded on last frame (skipped or conditionally rendered)
+int GetOcclusionCulledCount(void)
+{
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+    return occlusion.lastCulled;
+#else
+    return 0;
+#endif
+}
+
+// End deferred 3D render queue: sort recorded draws and draw them with minimal state changes
+// NOTE: Opaque draws are sorted by shader, material, mesh and front-to-back depth,
+// transparent draws are drawn after them, sorted back-to-front
+void EndRenderQueue(void)
+{
+    if (!renderQueue.recording) return;
+    renderQueue.recording = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (renderQueue.count == 0) return;
+
+    qsort(renderQueue.keys, renderQueue.count, sizeof(QueuedDrawKey), CompareQueuedDraws);
+
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matProjection = rlGetMatrixProjection();
+    QueuedDraw *previous = NULL;
+
+#if defined(SHADOW_MAPS_SUPPORTED)
+    // Shadow atlas tiles are rendered before the draws sampling them
+    RenderShadowMaps(matView, matProjection);
+#endif
+
+#if defined(PICKING_SUPPORTED)
+    // Picking ids are rendered into their own framebuffer, render target and viewport are restored
+    RenderPicking();
+#endif
+
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+    // NOTE: Instances transforms already include rlgl internal transform, instanced shader applies no other transform
+    Matrix matTransform = rlGetMatrixTransform();
+    Matrix matIdentity = MatrixIdentity();
+    bool instancing = renderQueue.instancing && (memcmp(&matTransform, &matIdentity, sizeof(Matrix)) == 0);
+
+    if (instancing && !instancingShaderLoaded) LoadShaderInstancing();
+    if (instancingShader.id == 0) instancing = false;
+#endif
+
+    for (int i = 0; i < renderQueue.count; i++)
+    {
+        QueuedDraw *draw = &renderQueue.draws[renderQueue.keys[i].index];
+        draw->material.maps = draw->maps;
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+        // Opaque draws are sorted by shader, material and mesh, repeated draws are consecutive
+        // NOTE: Transparent draws keep back-to-front order, they are never instanced
+        if (instancing && !(renderQueue.keys[i].key >> 63) && CheckQueuedDrawsInstancing(draw, draw))
         {
-            if (mesh.vboId[3] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[3]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
+            int count = 1;
+            while ((i + count < renderQueue.count) && !(renderQueue.keys[i + count].key >> 63) &&
+                CheckQueuedDrawsInstancing(draw, &renderQueue.draws[renderQueue.keys[i + count].index])) count++;
+
+            if (count >= RENDER_QUEUE_INSTANCING_MIN_COUNT)
             {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                if (previous != NULL) ResetMeshMaterialState(previous->material);
+
+                if (DrawQueuedDrawsInstanced(i, count))
+                {
+                    // Instanced draw changed shader and material state, next draw sets it again
+                    previous = NULL;
+                    i += count - 1;
+                    continue;
+                }
             }
         }
+#endif
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
-        }
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+        // Opaque draws are sorted front-to-back, occluders are mostly drawn before tested draws bounding box queries
+        int occlusionTest = TestOcclusionMesh(draw->mesh, draw->matModel, draw->matView, draw->matProjection);
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+        // Bounding box query changed shader state, next draw sets shader and material state again
+        if ((occlusionTest & OCCLUSION_QUERIED) && (previous != NULL))
         {
-            rlEnableVertexBuffer(mesh.vboId[5]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            ResetMeshMaterialState(previous->material);
+            previous = NULL;
         }
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
-    }
+        if (!(occlusionTest & OCCLUSION_DRAW)) continue;
+#endif
 
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+        // Shader program and view/projection uniforms only change with shader or camera
+        bool shaderChanged = (previous == NULL) || (draw->material.shader.id != previous->material.shader.id) ||
+            (memcmp(&draw->matView, &previous->matView, sizeof(Matrix)) != 0) ||
+            (memcmp(&draw->matProjection, &previous->matProjection, sizeof(Matrix)) != 0);
 
-    for (int eye = 0; eye < eyeCount; eye++)
-    {
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
+        if (shaderChanged) SetMeshShaderState(draw->material.shader, draw->matView, draw->matProjection);
+
+        // Material colors and maps are only uploaded on material change (or shader change, uniforms are program state)
+        if (shaderChanged || (memcmp(draw->maps, previous->maps, sizeof(draw->maps)) != 0))
         {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            SetMeshMaterialState(draw->material, (previous != NULL)? &previous->material : NULL);
         }
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
-
-        // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
-        else rlDrawVertexArray(0, mesh.vertexCount);
-    }
+        DrawMeshGeometry(draw->mesh, draw->material, draw->transform, draw->matModel, draw->matView, draw->matProjection);
 
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        // Select current shader texture slot
-        rlActiveTextureSlot(i);
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+        if (occlusionTest & OCCLUSION_CONDITIONAL) rlEndConditionalRender();
+#endif
 
-        // Disable texture for active slot
-        if ((i == MATERIAL_MAP_IRRADIANCE) ||
-            (i == MATERIAL_MAP_PREFILTER) ||
-            (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-        else rlDisableTexture();
+        previous = draw;
     }
 
+    if (previous != NULL) ResetMeshMaterialState(previous->material);
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1400,6 +3240,8 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     // Restore rlgl internal modelview and projection matrices
     rlSetMatrixModelview(matView);
     rlSetMatrixProjection(matProjection);
+
+    renderQueue.count = 0;
 #endif
 }
 
@@ -1407,3165 +3249,14992 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
-
-    // Bind shader program
-    rlEnableShader(material.shader.id);
+    if (instances <= 0) return;
 
-    // Send required data to shader (matrices, values)
-    //-----------------------------------------------------
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+    if (rlIsCommandListRecording())
     {
-        float values[4] = {
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
-            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+        RecordMeshDrawCommand(mesh, material, transforms, instances);
+        return;
     }
+#endif
 
-    // Upload to shader material.colSpecular (if location available)
-    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
-    {
-        float values[4] = {
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
-        };
+    RL_PROFILE_ZONE_BEGIN(zone, "DrawMeshInstanced");
 
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
-    }
+    // Upload instances transforms to rlgl instance stream (ring buffer, no buffer created per call)
+    // NOTE: Matrix memory layout is column-major, same as expected by shader attributes
+    unsigned int vboIds[3] = { 0 };
+    int offsets[3] = { 0 };
+    vboIds[0] = rlUpdateInstanceStream(GetMeshInstancesTransforms(mesh, transforms, instances), instances*sizeof(Matrix), &offsets[0]);
 
-    // Get a copy of current matrices to work with,
-    // just in case stereo render is required and we need to modify them
-    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
-    // That's because BeginMode3D() sets it and there is no model-drawing function
-    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
-    Matrix matModel = MatrixIdentity();
-    Matrix matView = rlGetMatrixModelview();
-    Matrix matModelView = MatrixIdentity();
-    Matrix matProjection = rlGetMatrixProjection();
+    DrawMeshInstancedStreams(mesh, material, vboIds, offsets, instances, 0);
 
-    // Upload view and projection matrices (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
-    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    RL_PROFILE_ZONE_END(zone);
+#endif
+}
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
+// Draw multiple mesh instances with material and different transforms, instances outside frustum are skipped
+// NOTE: Visible instances transforms are compacted into a reused scratch buffer, returns instances drawn
+int DrawMeshInstancedCulled(Mesh mesh, Material material, Frustum frustum, const Matrix *transforms, int instances)
+{
+    if (instances <= 0) return 0;
 
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+    if (culledTransforms.capacity < instances)
+    {
+        Matrix *data = (Matrix *)RL_REALLOC(culledTransforms.data, instances*sizeof(Matrix));
+        if (data == NULL) return 0;
 
-    // Enable mesh VAO to attach new buffer
-    rlEnableVertexArray(mesh.vaoId);
+        culledTransforms.data = data;
+        culledTransforms.capacity = instances;
+    }
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData().
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    // NOTE: Instances transforms are combined with current rlgl transform, same as DrawMeshInstanced()
+    Matrix matTransform = rlGetMatrixTransform();
+    int visible = 0;
 
-    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
+    for (int i = 0; i < instances; i++)
     {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+        if (CheckFrustumMesh(frustum, mesh, MatrixMultiply(transforms[i], matTransform))) culledTransforms.data[visible++] = transforms[i];
     }
 
-    rlDisableVertexBuffer();
-    rlDisableVertexArray();
+    if (visible > 0) DrawMeshInstanced(mesh, material, culledTransforms.data, visible);
 
-    // Accumulate internal matrix transform (push/pop) and view matrix
-    // NOTE: In this case, model instance transformation must be computed in the shader
-    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+    return visible;
+}
 
-    // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
-    //-----------------------------------------------------
+// Draw mesh instances range with material and instance buffer data
+void DrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (offset < 0) offset = 0;
+    if ((offset + count) > buffer.instanceCount) count = buffer.instanceCount - offset;
+    if ((count <= 0) || (buffer.vboId[0] == 0)) return;
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    // Instances range is selected with attributes offsets (base instance not available on OpenGL 3.3/ES2)
+    unsigned int vboIds[3] = { buffer.vboId[0], buffer.vboId[1], buffer.vboId[2] };
+    int offsets[3] = { offset*(int)sizeof(Matrix), offset*(int)sizeof(Color), offset*(int)sizeof(Vector4) };
+
+    // Quantized meshes require transforms combined with dequantization, streamed from CPU copy
+    if ((mesh.quantization & MESH_QUANTIZE_POSITION) && (buffer.transforms != NULL))
     {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+        vboIds[0] = rlUpdateInstanceStream(GetMeshInstancesTransforms(mesh, buffer.transforms + offset, count), count*sizeof(Matrix), &offsets[0]);
+    }
 
-            // Enable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
-            else rlEnableTexture(material.maps[i].texture.id);
+    DrawMeshInstancedStreams(mesh, material, vboIds, offsets, count, 0);
+#endif
+}
 
-            rlSetUniform(material.shader.locs[SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
-        }
-    }
+// Draw skinned mesh instances animated from animation texture, every instance plays its own animation
+// NOTE: Instance custom data selects animation and playback (see GetAnimationInstanceData()), time is in seconds;
+// custom shaders require "animationBones" (sampler2D) and "animationParams" (vec2) uniforms, mesh is drawn
+// in bind pose if animation textures are not supported or mesh has no bones data
+void DrawMeshInstancedAnimated(Mesh mesh, Material material, AnimationTexture texture, InstanceBuffer buffer, float time)
+{
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+    if ((buffer.instanceCount <= 0) || (buffer.vboId[0] == 0)) return;
 
-    // Try binding vertex array objects (VAO)
-    // or use VBOs if not possible
-    if (!rlEnableVertexArray(mesh.vaoId))
+    if ((texture.id > 0) && (mesh.vboId[7] != 0) && (mesh.vboId[8] != 0))
     {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[0]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
-
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[1]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+        int bonesLoc = -1;
+        int paramsLoc = -1;
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+        if (material.shader.id == rlGetShaderIdDefault())
         {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
-        }
+            if (!animationShaderLoaded) LoadShaderAnimation();
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[3] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[3]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
+            if (animationShader.id > 0)
             {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                material.shader = animationShader;
+                bonesLoc = animationShaderLocs[0];
+                paramsLoc = animationShaderLocs[1];
             }
         }
-
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+        else
         {
-            rlEnableVertexBuffer(mesh.vboId[4]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            bonesLoc = rlGetLocationUniform(material.shader.id, "animationBones");
+            paramsLoc = rlGetLocationUniform(material.shader.id, "animationParams");
         }
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+        if (bonesLoc != -1)
         {
-            rlEnableVertexBuffer(mesh.vboId[5]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            int slot = ANIMATION_TEXTURE_SLOT;
+            float params[2] = { time, (float)texture.boneCount };
+
+            rlEnableShader(material.shader.id);
+            rlActiveTextureSlot(slot);
+            rlEnableTexture(texture.id);
+            rlSetUniform(bonesLoc, &slot, SHADER_UNIFORM_INT, 1);
+            rlActiveTextureSlot(0);
+            if (paramsLoc != -1) rlSetUniform(paramsLoc, params, SHADER_UNIFORM_VEC2, 1);
+
+            int offsets[3] = { 0 };
+            DrawMeshInstancedStreams(mesh, material, buffer.vboId, offsets, buffer.instanceCount, 0);
+            return;
         }
-
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
-    }
-
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
-
-    for (int eye = 0; eye < eyeCount; eye++)
-    {
-        // Calculate model-view-projection matrix (MVP)
-        Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
-        {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
-        }
-
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
-
-        // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
-
-    // Unbind all binded texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        // Select current shader texture slot
-        rlActiveTextureSlot(i);
-
-        // Disable texture for active slot
-        if ((i == MATERIAL_MAP_IRRADIANCE) ||
-            (i == MATERIAL_MAP_PREFILTER) ||
-            (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-        else rlDisableTexture();
-    }
-
-    // Disable all possible vertex array objects (or VBOs)
-    rlDisableVertexArray();
-    rlDisableVertexBuffer();
-    rlDisableVertexBufferElement();
-
-    // Disable shader program
-    rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
 #endif
-}
-
-// Unload mesh from memory (RAM and VRAM)
-void UnloadMesh(Mesh mesh)
-{
-    // Unload rlgl mesh vboId data
-    rlUnloadVertexArray(mesh.vaoId);
-
-    if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
-    RL_FREE(mesh.vboId);
-
-    RL_FREE(mesh.vertices);
-    RL_FREE(mesh.texcoords);
-    RL_FREE(mesh.normals);
-    RL_FREE(mesh.colors);
-    RL_FREE(mesh.tangents);
-    RL_FREE(mesh.texcoords2);
-    RL_FREE(mesh.indices);
 
-    RL_FREE(mesh.animVertices);
-    RL_FREE(mesh.animNormals);
-    RL_FREE(mesh.boneWeights);
-    RL_FREE(mesh.boneIds);
+    DrawMeshInstancedBuffer(mesh, material, buffer, 0, buffer.instanceCount);
 }
 
-// Export mesh data to file
-bool ExportMesh(Mesh mesh, const char *fileName)
+// Draw instance buffer instances inside frustum, culled on GPU when compute shaders are supported
+// NOTE: GPU culling (OpenGL 4.3) compacts visible instances data into GPU buffers and writes the instances
+// count into an indirect draw command, instances are never read back on CPU; otherwise instances are culled on CPU
+void DrawMeshInstancedBufferCulled(Mesh mesh, Material material, InstanceBuffer buffer, Frustum frustum)
 {
-    bool success = false;
-
-    if (IsFileExtension(fileName, ".obj"))
-    {
-        // Estimated data size, it should be enough...
-        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
-                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
-                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
-                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
-
-        // NOTE: Text data buffer size is estimated considering mesh data size
-        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
-
-        int byteCount = 0;
-        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // more info and bugs-report:  github.com/raysan5/raylib                        //\n");
-        byteCount += sprintf(txtData + byteCount, "# // feedback and support:       ray[at]raylib.com                                //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# // Copyright (c) 2018-2022 Ramon Santamaria (@raysan5)                          //\n");
-        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
-        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n\n");
-        byteCount += sprintf(txtData + byteCount, "# Vertex Count:     %i\n", mesh.vertexCount);
-        byteCount += sprintf(txtData + byteCount, "# Triangle Count:   %i\n\n", mesh.triangleCount);
-
-        byteCount += sprintf(txtData + byteCount, "g mesh\n");
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int count = buffer.instanceCount;
+    if ((count <= 0) || (buffer.vboId[0] == 0)) return;
 
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
-        {
-            byteCount += sprintf(txtData + byteCount, "v %.2f %.2f %.2f\n", mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2]);
-        }
+    RL_PROFILE_ZONE_BEGIN(zone, "DrawMeshInstancedBufferCulled");
 
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 2)
-        {
-            byteCount += sprintf(txtData + byteCount, "vt %.3f %.3f\n", mesh.texcoords[v], mesh.texcoords[v + 1]);
-        }
+#if defined(SUPPORT_GPU_CULLING) && defined(GRAPHICS_API_OPENGL_43)
+    if (!gpuCulling.loaded) LoadShaderCulling();
 
-        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
+    if ((gpuCulling.program > 0) && !rlIsCommandListRecording())
+    {
+        // Visible instances buffers grow to instance buffer capacity, previous data is not kept
+        if (gpuCulling.capacity < buffer.capacity)
         {
-            byteCount += sprintf(txtData + byteCount, "vn %.3f %.3f %.3f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
-        }
+            const int strides[3] = { sizeof(Matrix), sizeof(Color), sizeof(Vector4) };
 
-        if (mesh.indices != NULL)
-        {
-            for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
-            {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
-                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
-                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
-                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
-            }
-        }
-        else
-        {
-            for (int i = 0, v = 1; i < mesh.triangleCount; i++, v += 3)
+            for (int i = 0; i < 3; i++)
             {
-                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n", v, v, v, v + 1, v + 1, v + 1, v + 2, v + 2, v + 2);
+                if (gpuCulling.visibleIds[i] > 0) rlUnloadShaderBuffer(gpuCulling.visibleIds[i]);
+                gpuCulling.visibleIds[i] = rlLoadShaderBuffer((unsigned long long)buffer.capacity*strides[i], NULL, RL_DYNAMIC_COPY);
             }
+
+            gpuCulling.capacity = buffer.capacity;
         }
 
-        byteCount += sprintf(txtData + byteCount, "\n");
+        if (gpuCulling.commandId == 0) gpuCulling.commandId = rlLoadShaderBuffer(5*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
 
-        // NOTE: Text data length exported is determined by '\0' (NULL) character
-        success = SaveFileText(fileName, txtData);
+        // Indirect command (elements: count, instances, first index, base vertex, base instance;
+        // arrays: count, instances, first, base instance), instances count is accumulated by culling pass
+        unsigned int command[5] = { (mesh.indices != NULL)? (unsigned int)mesh.triangleCount*3 : (unsigned int)mesh.vertexCount, 0, 0, 0, 0 };
+        rlUpdateShaderBufferElements(gpuCulling.commandId, command, sizeof(command), 0);
 
-        RL_FREE(txtData);
-    }
-    else if (IsFileExtension(fileName, ".raw"))
-    {
-        // TODO: Support additional file formats to export mesh vertex data
-    }
+        Vector3 center = Vector3Scale(Vector3Add(mesh.boundsMin, mesh.boundsMax), 0.5f);
+        float bounds[4] = { center.x, center.y, center.z, mesh.boundsRadius };
+        int instances[2] = { count, ((buffer.vboId[1] > 0)? 1 : 0) | ((buffer.vboId[2] > 0)? 2 : 0) };
 
-    return success;
-}
+        rlEnableShader(gpuCulling.program);
+        rlSetUniform(gpuCulling.locs[0], frustum.planes, SHADER_UNIFORM_VEC4, 6);
+        rlSetUniform(gpuCulling.locs[1], bounds, SHADER_UNIFORM_VEC4, 1);
+        rlSetUniformMatrix(gpuCulling.locs[2], rlGetMatrixTransform());
+        rlSetUniformMatrix(gpuCulling.locs[3], GetMeshDequantizeMatrix(mesh));
+        rlSetUniform(gpuCulling.locs[4], instances, SHADER_UNIFORM_IVEC2, 1);
 
-// Load materials from model file
-Material *LoadMaterials(const char *fileName, int *materialCount)
-{
-    Material *materials = NULL;
-    unsigned int count = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            if (buffer.vboId[i] > 0) rlBindShaderBuffer(buffer.vboId[i], i);
+            rlBindShaderBuffer(gpuCulling.visibleIds[i], 3 + i);
+        }
+        rlBindShaderBuffer(gpuCulling.commandId, 6);
 
-    // TODO: Support IQM and GLTF for materials parsing
+        rlComputeShaderDispatch((count + GPU_CULLING_WORKGROUP_SIZE - 1)/GPU_CULLING_WORKGROUP_SIZE, 1, 1);
+        rlDisableShader();
 
-#if defined(SUPPORT_FILEFORMAT_MTL)
-    if (IsFileExtension(fileName, ".mtl"))
-    {
-        tinyobj_material_t *mats = NULL;
+        // Visible instances are read as vertex attributes and instances count as indirect command
+        rlShaderBufferBarrier();
 
-        int result = tinyobj_parse_mtl_file(&mats, &count, fileName);
-        if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
+        unsigned int vboIds[3] = { gpuCulling.visibleIds[0], (buffer.vboId[1] > 0)? gpuCulling.visibleIds[1] : 0, (buffer.vboId[2] > 0)? gpuCulling.visibleIds[2] : 0 };
+        int offsets[3] = { 0 };
 
-        // TODO: Process materials to return
+        DrawMeshInstancedStreams(mesh, material, vboIds, offsets, count, gpuCulling.commandId);
 
-        tinyobj_materials_free(mats, count);
+        RL_PROFILE_ZONE_END(zone);
+        return;
     }
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load material file", fileName);
 #endif
 
-    // Set materials shader to default (DIFFUSE, SPECULAR, NORMAL)
-    if (materials != NULL)
+    // CPU culling, visible instances data is compacted on scratch memory and streamed
+    Matrix matTransform = rlGetMatrixTransform();
+    Matrix *transforms = (Matrix *)MemAllocScratch(count*sizeof(Matrix));
+    Color *colors = (buffer.colors != NULL)? (Color *)MemAllocScratch(count*sizeof(Color)) : NULL;
+    Vector4 *custom = (buffer.custom != NULL)? (Vector4 *)MemAllocScratch(count*sizeof(Vector4)) : NULL;
+    int visible = 0;
+
+    for (int i = 0; i < count; i++)
     {
-        for (unsigned int i = 0; i < count; i++)
-        {
-            materials[i].shader.id = rlGetShaderIdDefault();
-            materials[i].shader.locs = rlGetShaderLocsDefault();
-        }
-    }
+        if (!CheckFrustumMesh(frustum, mesh, MatrixMultiply(buffer.transforms[i], matTransform))) continue;
 
-    *materialCount = count;
-    return materials;
-}
+        transforms[visible] = buffer.transforms[i];
+        if (colors != NULL) colors[visible] = buffer.colors[i];
+        if (custom != NULL) custom[visible] = buffer.custom[i];
+        visible++;
+    }
 
-// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
-Material LoadMaterialDefault(void)
-{
-    Material material = { 0 };
-    material.maps = (MaterialMap *)RL_CALLOC(MAX_MATERIAL_MAPS, sizeof(MaterialMap));
+    if (visible > 0)
+    {
+        unsigned int vboIds[3] = { 0 };
+        int offsets[3] = { 0 };
 
-    // Using rlgl default shader
-    material.shader.id = rlGetShaderIdDefault();
-    material.shader.locs = rlGetShaderLocsDefault();
+        vboIds[0] = rlUpdateInstanceStream(GetMeshInstancesTransforms(mesh, transforms, visible), visible*sizeof(Matrix), &offsets[0]);
+        if (colors != NULL) vboIds[1] = rlUpdateInstanceStream(colors, visible*sizeof(Color), &offsets[1]);
+        if (custom != NULL) vboIds[2] = rlUpdateInstanceStream(custom, visible*sizeof(Vector4), &offsets[2]);
 
-    // Using rlgl default texture (1x1 pixel, UNCOMPRESSED_R8G8B8A8, 1 mipmap)
-    material.maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
-    //material.maps[MATERIAL_MAP_NORMAL].texture;         // NOTE: By default, not set
-    //material.maps[MATERIAL_MAP_SPECULAR].texture;       // NOTE: By default, not set
+        DrawMeshInstancedStreams(mesh, material, vboIds, offsets, visible, 0);
+    }
 
-    material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;    // Diffuse color
-    material.maps[MATERIAL_MAP_SPECULAR].color = WHITE;   // Specular color
+    MemFreeScratch(custom);
+    MemFreeScratch(colors);
+    MemFreeScratch(transforms);
 
-    return material;
+    RL_PROFILE_ZONE_END(zone);
+#endif
 }
 
-// Unload material from memory
-void UnloadMaterial(Material material)
+// Load instance buffer with initial capacity (instances)
+// NOTE: Colors and custom data streams are only allocated when first updated
+InstanceBuffer LoadInstanceBuffer(int capacity)
 {
-    // Unload material shader (avoid unloading default shader, managed by raylib)
-    if (material.shader.id != rlGetShaderIdDefault()) UnloadShader(material.shader);
+    InstanceBuffer buffer = { 0 };
 
-    // Unload loaded texture maps (avoid unloading default texture, managed by raylib)
-    if (material.maps != NULL)
-    {
-        for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-        {
-            if (material.maps[i].texture.id != rlGetTextureIdDefault()) rlUnloadTexture(material.maps[i].texture.id);
-        }
-    }
+    if (capacity <= 0) capacity = 1;
 
-    RL_FREE(material.maps);
-}
+    buffer.capacity = capacity;
+    buffer.transforms = (Matrix *)RL_CALLOC(capacity, sizeof(Matrix));
+    buffer.vboId[0] = rlLoadVertexBuffer(NULL, capacity*sizeof(Matrix), true);
 
-// Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
-// NOTE: Previous texture should be manually unloaded
-void SetMaterialTexture(Material *material, int mapType, Texture2D texture)
-{
-    material->maps[mapType].texture = texture;
-}
+    if (buffer.vboId[0] > 0) TRACELOG(LOG_INFO, "INSTANCES: [ID %i] Instance buffer loaded successfully (capacity: %i)", buffer.vboId[0], capacity);
 
-// Set the material for a mesh
-void SetModelMeshMaterial(Model *model, int meshId, int materialId)
-{
-    if (meshId >= model->meshCount) TRACELOG(LOG_WARNING, "MESH: Id greater than mesh count");
-    else if (materialId >= model->materialCount) TRACELOG(LOG_WARNING, "MATERIAL: Id greater than material count");
-    else  model->meshMaterial[meshId] = materialId;
+    return buffer;
 }
 
-// Load model animations from file
-ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount)
+// Update instances range data, NULL data streams are not updated
+// NOTE: Only the updated range is uploaded, buffers grow (keeping previous instances) if range exceeds capacity,
+// a full range update orphans buffers data store so GPU is not waited for while reading previous data
+void UpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, const Color *colors, const Vector4 *custom, int offset, int count)
 {
-    ModelAnimation *animations = NULL;
-
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) animations = LoadModelAnimationsIQM(fileName, animCount);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    //if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationGLTF(fileName, animCount);
-#endif
+    if ((buffer == NULL) || (buffer->transforms == NULL) || (offset < 0) || (count <= 0)) return;
 
-    return animations;
-}
+    const void *data[3] = { transforms, colors, custom };
+    void **streams[3] = { (void **)&buffer->transforms, (void **)&buffer->colors, (void **)&buffer->custom };
+    const int strides[3] = { sizeof(Matrix), sizeof(Color), sizeof(Vector4) };
 
-// Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
-void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
-{
-    if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
+    // Grow buffers if required, previous instances data is reuploaded from CPU copies
+    bool grown = false;
+    if ((offset + count) > buffer->capacity)
     {
-        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+        int capacity = buffer->capacity;
+        while (capacity < (offset + count)) capacity *= 2;
 
-        for (int m = 0; m < model.meshCount; m++)
+        for (int i = 0; i < 3; i++)
         {
-            Mesh mesh = model.meshes[m];
-            if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
-            {
-                TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation Mesh %i has no connection to bones",m);
-                continue;
-            }
+            if (*streams[i] == NULL) continue;
 
-            bool updated = false; // set to true when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
+            void *stream = RL_REALLOC(*streams[i], capacity*strides[i]);
+            if (stream == NULL) { TRACELOG(LOG_WARNING, "INSTANCES: Failed to grow instance buffer"); return; }
+            memset((unsigned char *)stream + buffer->capacity*strides[i], 0, (capacity - buffer->capacity)*strides[i]);
+            *streams[i] = stream;
+        }
 
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
+        buffer->capacity = capacity;
+        grown = true;
+    }
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+    int instanceCount = buffer->instanceCount;
+    if ((offset + count) > buffer->instanceCount) buffer->instanceCount = offset + count;
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
+    for (int i = 0; i < 3; i++)
+    {
+        bool reload = grown;
 
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter+=3)
-            {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
+        // Optional streams are created on first update
+        if ((*streams[i] == NULL) && (data[i] != NULL))
+        {
+            *streams[i] = RL_CALLOC(buffer->capacity, strides[i]);
+            buffer->vboId[i] = rlLoadVertexBuffer(NULL, buffer->capacity*strides[i], true);
+            reload = true;
+        }
 
-                if (mesh.animNormals!=NULL)
-                {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
-                }
+        if (*streams[i] == NULL) continue;
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
-                {
-                    boneWeight = mesh.boneWeights[boneCounter];
-                    // early stop when no transformation will be applied
-                    if (boneWeight == 0.0f)
-                    {
-                        continue;
-                    }
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    // inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-//                     animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
-                }
-            }
+        if (data[i] != NULL) memcpy((unsigned char *)*streams[i] + offset*strides[i], data[i], count*strides[i]);
 
-            // Upload new vertex data to GPU for model drawing
-            // Only update data when values changed.
-            if (updated){
-                rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);    // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);     // Update vertex normals
-            }
+        if (reload || ((data[i] != NULL) && (offset == 0) && (count >= instanceCount)))
+        {
+            // Reallocate data store with all instances (orphaning previous one)
+            rlResizeVertexBuffer(buffer->vboId[i], NULL, buffer->capacity*strides[i], true);
+            rlUpdateVertexBuffer(buffer->vboId[i], *streams[i], buffer->instanceCount*strides[i], 0);
         }
+        else if (data[i] != NULL) rlUpdateVertexBuffer(buffer->vboId[i], (unsigned char *)*streams[i] + offset*strides[i], count*strides[i], offset*strides[i]);
     }
 }
 
-// Unload animation array data
-void UnloadModelAnimations(ModelAnimation *animations, unsigned int count)
+// Unload instance buffer data from CPU and GPU
+void UnloadInstanceBuffer(InstanceBuffer buffer)
 {
-    for (unsigned int i = 0; i < count; i++) UnloadModelAnimation(animations[i]);
-    RL_FREE(animations);
-}
+    for (int i = 0; i < 3; i++) if (buffer.vboId[i] > 0) rlUnloadVertexBuffer(buffer.vboId[i]);
 
-// Unload animation data
-void UnloadModelAnimation(ModelAnimation anim)
-{
-    for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    RL_FREE(buffer.transforms);
+    RL_FREE(buffer.colors);
+    RL_FREE(buffer.custom);
 
-    RL_FREE(anim.bones);
-    RL_FREE(anim.framePoses);
+    if (buffer.vboId[0] > 0) TRACELOG(LOG_INFO, "INSTANCES: [ID %i] Unloaded instance buffer data from RAM and VRAM", buffer.vboId[0]);
 }
 
-// Check model animation skeleton match
-// NOTE: Only number of bones and parent connections are checked
-bool IsModelAnimationValid(Model model, ModelAnimation anim)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw mesh instances from instance data buffers (transforms, colors, custom)
+// NOTE: Offsets are provided in bytes, colors and custom data buffers are optional (id 0),
+// if an indirect command buffer is provided, instances count is read from it (OpenGL 4.3)
+static void DrawMeshInstancedStreams(Mesh mesh, Material material, const unsigned int *vboIds, const int *offsets, int instances, unsigned int commandId)
 {
-    int result = true;
-
-    if (model.boneCount != anim.boneCount) result = false;
-    else
-    {
-        for (int i = 0; i < model.boneCount; i++)
-        {
-            if (model.bones[i].parent != anim.bones[i].parent) { result = false; break; }
-        }
-    }
-
-    return result;
-}
-
-#if defined(SUPPORT_MESH_GENERATION)
-// Generate polygonal mesh
-Mesh GenMeshPoly(int sides, float radius)
-{
-    Mesh mesh = { 0 };
-
-    if (sides < 3) return mesh;
+    // Bind shader program
+    rlEnableShader(material.shader.id);
 
-    int vertexCount = sides*3;
+    // Send required data to shader (matrices, values)
+    //-----------------------------------------------------
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
 
-    // Vertices definition
-    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
 
-    float d = 0.0f, dStep = 360.0f/sides;
-    for (int v = 0; v < vertexCount; v += 3)
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
     {
-        vertices[v] = (Vector3){ 0.0f, 0.0f, 0.0f };
-        vertices[v + 1] = (Vector3){ sinf(DEG2RAD*d)*radius, 0.0f, cosf(DEG2RAD*d)*radius };
-        vertices[v + 2] = (Vector3){sinf(DEG2RAD*(d+dStep))*radius, 0.0f, cosf(DEG2RAD*(d+dStep))*radius };
-        d += dStep;
+        float values[4] = {
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
     }
 
-    // Normals definition
-    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
+    SetMaterialUniformBlock(material);
+
+    // Get a copy of current matrices to work with,
+    // just in case stereo render is required and we need to modify them
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    // That's because BeginMode3D() sets it and there is no model-drawing function
+    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
+    Matrix matModel = MatrixIdentity();
+    Matrix matView = rlGetMatrixModelview();
+    Matrix matModelView = MatrixIdentity();
+    Matrix matProjection = rlGetMatrixProjection();
 
-    // TexCoords definition
-    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-    for (int n = 0; n < vertexCount; n++) texcoords[n] = (Vector2){ 0.0f, 0.0f };
+    // Upload view and projection matrices (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+    SetFrameUniformBlock(material.shader, matView, matProjection);
 
-    mesh.vertexCount = vertexCount;
-    mesh.triangleCount = sides;
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    // Enable mesh VAO to attach instance buffers
+    rlEnableVertexArray(mesh.vaoId);
 
-    // Mesh vertices position array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
+    rlEnableVertexBuffer(vboIds[0]);
+    for (unsigned int i = 0; (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) && (i < 4); i++)
     {
-        mesh.vertices[3*i] = vertices[i].x;
-        mesh.vertices[3*i + 1] = vertices[i].y;
-        mesh.vertices[3*i + 2] = vertices[i].z;
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(size_t)(offsets[0] + i*sizeof(Vector4)));
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
     }
 
-    // Mesh texcoords array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Instances colors are send to shader attribute location: SHADER_LOC_INSTANCE_COLOR (if available)
+    if (material.shader.locs[SHADER_LOC_INSTANCE_COLOR] != -1)
     {
-        mesh.texcoords[2*i] = texcoords[i].x;
-        mesh.texcoords[2*i + 1] = texcoords[i].y;
+        if (vboIds[1] != 0)
+        {
+            rlEnableVertexBuffer(vboIds[1]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, (void *)(size_t)offsets[1]);
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], 1);
+        }
+        else
+        {
+            float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_INSTANCE_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_COLOR]);
+        }
     }
 
-    // Mesh normals array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Instances custom data is send to shader attribute location: SHADER_LOC_INSTANCE_CUSTOM (if available)
+    if (material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM] != -1)
     {
-        mesh.normals[3*i] = normals[i].x;
-        mesh.normals[3*i + 1] = normals[i].y;
-        mesh.normals[3*i + 2] = normals[i].z;
+        if (vboIds[2] != 0)
+        {
+            rlEnableVertexBuffer(vboIds[2]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM], 4, RL_FLOAT, 0, 0, (void *)(size_t)offsets[2]);
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM], 1);
+        }
+        else
+        {
+            float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM], value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_INSTANCE_CUSTOM]);
+        }
     }
 
-    RL_FREE(vertices);
-    RL_FREE(normals);
-    RL_FREE(texcoords);
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
 
-    // Upload vertex data to GPU (static mesh)
-    // NOTE: mesh.vboId array is allocated inside UploadMesh()
-    UploadMesh(&mesh, false);
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: In this case, model instance transformation must be computed in the shader
+    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
 
-    return mesh;
-}
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    //-----------------------------------------------------
 
-// Generate plane mesh (with subdivisions)
-Mesh GenMeshPlane(float width, float length, int resX, int resZ)
-{
-    Mesh mesh = { 0 };
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-#define CUSTOM_MESH_GEN_PLANE
-#if defined(CUSTOM_MESH_GEN_PLANE)
-    resX++;
-    resZ++;
+            // Enable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
 
-    // Vertices definition
-    int vertexCount = resX*resZ; // vertices get reused for the faces
+            rlSetUniform(material.shader.locs[MATERIAL_MAP_LOCATION(i)], &i, SHADER_UNIFORM_INT, 1);
+        }
+    }
 
-    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int z = 0; z < resZ; z++)
+    // Try binding vertex array objects (VAO)
+    // or use VBOs if not possible
+    if (!rlEnableVertexArray(mesh.vaoId))
     {
-        // [-length/2, length/2]
-        float zPos = ((float)z/(resZ - 1) - 0.5f)*length;
-        for (int x = 0; x < resX; x++)
+        if (mesh.vertexStride > 0) SetMeshInterleavedAttributes(mesh, material.shader);
+        else
         {
-            // [-width/2, width/2]
-            float xPos = ((float)x/(resX - 1) - 0.5f)*width;
-            vertices[x + z*resX] = (Vector3){ xPos, 0.0f, zPos };
+            // Bind mesh VBO data: vertex position (shader-location = 0)
+            rlEnableVertexBuffer(mesh.vboId[0]);
+            if (mesh.quantization & MESH_QUANTIZE_POSITION) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_SHORT, 1, 4*sizeof(short), 0);
+            else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+            // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+            rlEnableVertexBuffer(mesh.vboId[1]);
+            if (mesh.quantization & MESH_QUANTIZE_TEXCOORD) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+
+            if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+            {
+                // Bind mesh VBO data: vertex normals (shader-location = 2)
+                rlEnableVertexBuffer(mesh.vboId[2]);
+                if (mesh.quantization & MESH_QUANTIZE_NORMAL) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_BYTE, 1, 4*sizeof(signed char), 0);
+                else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+            }
+
+            // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+            {
+                if (mesh.vboId[3] != 0)
+                {
+                    rlEnableVertexBuffer(mesh.vboId[3]);
+                    rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+                    rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                }
+                else
+                {
+                    // Set default value for unused attribute
+                    // NOTE: Required when using default shader and no VAO support
+                    float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                    rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+                    rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                }
+            }
+
+            // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+            {
+                rlEnableVertexBuffer(mesh.vboId[4]);
+                if (mesh.quantization & MESH_QUANTIZE_NORMAL) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_BYTE, 1, 0, 0);
+                else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            }
+
+            // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+            {
+                rlEnableVertexBuffer(mesh.vboId[5]);
+                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            }
+
         }
+
+        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
+    else if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);    // NOTE: Indices buffer can be shared by several vertex arrays (terrain levels of detail)
 
-    // Normals definition
-    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    // TexCoords definition
-    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-    for (int v = 0; v < resZ; v++)
+    for (int eye = 0; eye < eyeCount; eye++)
     {
-        for (int u = 0; u < resX; u++)
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
+
+        // Send combined model-view-projection matrix to shader
+        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+
+        // Draw mesh instanced
+        if (commandId > 0)
         {
-            texcoords[u + v*resX] = (Vector2){ (float)u/(resX - 1), (float)v/(resZ - 1) };
+            if (mesh.indices != NULL) rlDrawVertexArrayElementsIndirect(commandId, 0, 1);
+            else rlDrawVertexArrayIndirect(commandId, 0, 1);
         }
+        else if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
 
-    // Triangles definition (indices)
-    int numFaces = (resX - 1)*(resZ - 1);
-    int *triangles = (int *)RL_MALLOC(numFaces*6*sizeof(int));
-    int t = 0;
-    for (int face = 0; face < numFaces; face++)
+    // Unbind binded texture maps
+    // NOTE: Only maps binded above need it, other texture slots were not changed
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
-        // Retrieve lower left corner from face ind
-        int i = face % (resX - 1) + (face/(resZ - 1)*resX);
-
-        triangles[t++] = i + resX;
-        triangles[t++] = i + 1;
-        triangles[t++] = i;
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-        triangles[t++] = i + resX;
-        triangles[t++] = i + resX + 1;
-        triangles[t++] = i + 1;
+            // Disable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
     }
 
-    mesh.vertexCount = vertexCount;
-    mesh.triangleCount = numFaces*2;
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+    rlActiveTextureSlot(0);
 
-    // Mesh vertices position array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Disable instance attributes, mesh VAO could be drawn later without instancing
+    for (unsigned int i = 0; (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) && (i < 4); i++)
     {
-        mesh.vertices[3*i] = vertices[i].x;
-        mesh.vertices[3*i + 1] = vertices[i].y;
-        mesh.vertices[3*i + 2] = vertices[i].z;
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 0);
+        rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
     }
 
-    // Mesh texcoords array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    for (int i = SHADER_LOC_INSTANCE_COLOR; i <= SHADER_LOC_INSTANCE_CUSTOM; i++)
     {
-        mesh.texcoords[2*i] = texcoords[i].x;
-        mesh.texcoords[2*i + 1] = texcoords[i].y;
+        if (material.shader.locs[i] != -1)
+        {
+            rlSetVertexAttributeDivisor(material.shader.locs[i], 0);
+            rlDisableVertexAttribute(material.shader.locs[i]);
+        }
     }
 
-    // Mesh normals array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Disable shader program
+    rlDisableShader();
+}
+
+// Get shader used to draw a mesh with a material
+// NOTE: GPU skinned and morphed meshes using default shader are drawn with built-in material shader variants,
+// meshes skinned by skinning cache are drawn as static meshes
+static Shader GetMeshShader(Mesh mesh, Material material)
+{
+#if defined(SUPPORT_GPU_SKINNING)
+    if (((mesh.boneMatrices != NULL) || (mesh.morphTextureId != 0)) && (material.shader.id == rlGetShaderIdDefault()))
     {
-        mesh.normals[3*i] = normals[i].x;
-        mesh.normals[3*i + 1] = normals[i].y;
-        mesh.normals[3*i + 2] = normals[i].z;
-    }
+        if (!skinningShaderLoaded) LoadShaderSkinning();
 
-    // Mesh indices array initialization
-    for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = triangles[i];
+        bool skinned = (mesh.boneMatrices != NULL) && (skinningShader.id > 0);
+#if defined(SKINNING_CACHE_SUPPORTED)
+        if (skinned && IsSkinningCacheAvailable(mesh)) skinned = false;
+#endif
+        unsigned int features = 0;
+        if (skinned) features |= MATERIAL_VARIANT_SKINNING;
+        if (mesh.morphTextureId != 0) features |= MATERIAL_VARIANT_MORPHING;
 
-    RL_FREE(vertices);
-    RL_FREE(normals);
-    RL_FREE(texcoords);
-    RL_FREE(triangles);
+        if (features == MATERIAL_VARIANT_SKINNING) return skinningShader;
+        else if (features != 0)
+        {
+            Shader shader = GetShaderVariant(materialVariants, features);
+            if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault())) return shader;
+        }
+    }
+#endif
+#if defined(LIGHTMAP_SHADERS_SUPPORTED)
+    // Default material meshes with a lightmap are drawn with baked lighting only (static geometry)
+    bool texcoords2 = (mesh.texcoords2 != NULL) || ((mesh.vboId != NULL) && (mesh.vboId[5] > 0)) || ((mesh.vertexStride > 0) && (mesh.vertexOffsets[5] != -1));
+    if (texcoords2 && (material.shader.id == rlGetShaderIdDefault()) && (material.maps[MATERIAL_MAP_LIGHTMAP].texture.id > 0))
+    {
+        if (!lightmapShaderLoaded) LoadShaderLightmap();
+        if (lightmapShader.id > 0) return lightmapShader;
+    }
+#endif
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+    // Default material meshes are lit while any light is active
+    // NOTE: Normals could be available on GPU only (UnloadMeshCPUData())
+    bool normals = (mesh.normals != NULL) || ((mesh.vboId != NULL) && (mesh.vboId[2] > 0)) || ((mesh.vertexStride > 0) && (mesh.vertexOffsets[2] != -1));
+    if (normals && (material.shader.id == rlGetShaderIdDefault()) &&
+        ((lighting.activeCount > 0) || (Vector3LengthSqr(lighting.directionalColor) > 0.0f)))
+    {
+        if (!lightingShaderLoaded) LoadShaderLighting();
+        if (lightingShader.id > 0) return lightingShader;
+    }
+#endif
+    return material.shader;
+}
 
-#else       // Use par_shapes library to generate plane mesh
+// Bind mesh shader program and upload view and projection matrices (if locations available)
+static void SetMeshShaderState(Shader shader, Matrix matView, Matrix matProjection)
+{
+    rlEnableShader(shader.id);
 
-    par_shapes_mesh *plane = par_shapes_create_plane(resX, resZ);   // No normals/texcoords generated!!!
-    par_shapes_scale(plane, width, length, 1.0f);
-    par_shapes_rotate(plane, -PI/2.0f, (float[]){ 1, 0, 0 });
-    par_shapes_translate(plane, -width/2, 0.0f, length/2);
+    if (shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    mesh.vertices = (float *)RL_MALLOC(plane->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(plane->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(plane->ntriangles*3*3*sizeof(float));
+    SetFrameUniformBlock(shader, matView, matProjection);
 
-    mesh.vertexCount = plane->ntriangles*3;
-    mesh.triangleCount = plane->ntriangles;
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+    if ((lightingShader.id > 0) && (shader.id == lightingShader.id)) SetLightingShaderState(shader, lightingShaderLocs, matView, matProjection);
+#endif
+}
 
-    for (int k = 0; k < mesh.vertexCount; k++)
-    {
-        mesh.vertices[k*3] = plane->points[plane->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = plane->points[plane->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = plane->points[plane->triangles[k]*3 + 2];
+// Update and bind per-frame uniform block (if available)
+// NOTE: Buffer is shared by all shaders, only uploaded when camera matrices change
+static void SetFrameUniformBlock(Shader shader, Matrix matView, Matrix matProjection)
+{
+    if (shader.locs[SHADER_LOC_BLOCK_FRAME] == -1) return;
 
-        mesh.normals[k*3] = plane->normals[plane->triangles[k]*3];
-        mesh.normals[k*3 + 1] = plane->normals[plane->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = plane->normals[plane->triangles[k]*3 + 2];
+    float frame[48] = { 0 };
+    memcpy(frame, MatrixToFloatV(matView).v, 16*sizeof(float));
+    memcpy(frame + 16, MatrixToFloatV(matProjection).v, 16*sizeof(float));
+    memcpy(frame + 32, MatrixToFloatV(MatrixMultiply(matView, matProjection)).v, 16*sizeof(float));
 
-        mesh.texcoords[k*2] = plane->tcoords[plane->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = plane->tcoords[plane->triangles[k]*2 + 1];
+    if (uniformBlocks.frameId == 0)
+    {
+        uniformBlocks.frameId = rlLoadUniformBuffer(sizeof(frame), frame, true);
+        memcpy(uniformBlocks.frame, frame, sizeof(frame));
+    }
+    else if (memcmp(uniformBlocks.frame, frame, sizeof(frame)) != 0)
+    {
+        rlUpdateUniformBuffer(uniformBlocks.frameId, frame, sizeof(frame), 0);
+        memcpy(uniformBlocks.frame, frame, sizeof(frame));
     }
 
-    par_shapes_free_mesh(plane);
-#endif
+    rlBindUniformBuffer(uniformBlocks.frameId, RL_UNIFORM_BLOCK_BINDING_FRAME);
+}
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+// Update and bind per-material uniform block (if available)
+// NOTE: Buffer is shared by all shaders, only uploaded when material data changes
+static void SetMaterialUniformBlock(Material material)
+{
+    if (material.shader.locs[SHADER_LOC_BLOCK_MATERIAL] == -1) return;
+
+    float data[12] = {
+        (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+        (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+        (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+        (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f,
+        (float)material.maps[MATERIAL_MAP_SPECULAR].color.r/255.0f,
+        (float)material.maps[MATERIAL_MAP_SPECULAR].color.g/255.0f,
+        (float)material.maps[MATERIAL_MAP_SPECULAR].color.b/255.0f,
+        (float)material.maps[MATERIAL_MAP_SPECULAR].color.a/255.0f,
+        material.params[0], material.params[1], material.params[2], material.params[3]
+    };
 
-    return mesh;
+    if (uniformBlocks.materialId == 0)
+    {
+        uniformBlocks.materialId = rlLoadUniformBuffer(sizeof(data), data, true);
+        memcpy(uniformBlocks.material, data, sizeof(data));
+    }
+    else if (memcmp(uniformBlocks.material, data, sizeof(data)) != 0)
+    {
+        rlUpdateUniformBuffer(uniformBlocks.materialId, data, sizeof(data), 0);
+        memcpy(uniformBlocks.material, data, sizeof(data));
+    }
+
+    rlBindUniformBuffer(uniformBlocks.materialId, RL_UNIFORM_BLOCK_BINDING_MATERIAL);
 }
 
-// Generated cuboid mesh
-Mesh GenMeshCube(float width, float height, float length)
+// Upload material colors and bind material texture maps to current shader
+// NOTE: Maps binded by previous material and not used by this one are unbinded (previous can be NULL)
+static void SetMeshMaterialState(Material material, const Material *previous)
 {
-    Mesh mesh = { 0 };
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
 
-#define CUSTOM_MESH_GEN_CUBE
-#if defined(CUSTOM_MESH_GEN_CUBE)
-    float vertices[] = {
-        -width/2, -height/2, length/2,
-        width/2, -height/2, length/2,
-        width/2, height/2, length/2,
-        -width/2, height/2, length/2,
-        -width/2, -height/2, -length/2,
-        -width/2, height/2, -length/2,
-        width/2, height/2, -length/2,
-        width/2, -height/2, -length/2,
-        -width/2, height/2, -length/2,
-        -width/2, height/2, length/2,
-        width/2, height/2, length/2,
-        width/2, height/2, -length/2,
-        -width/2, -height/2, -length/2,
-        width/2, -height/2, -length/2,
-        width/2, -height/2, length/2,
-        -width/2, -height/2, length/2,
-        width/2, -height/2, -length/2,
-        width/2, height/2, -length/2,
-        width/2, height/2, length/2,
-        width/2, -height/2, length/2,
-        -width/2, -height/2, -length/2,
-        -width/2, -height/2, length/2,
-        -width/2, height/2, length/2,
-        -width/2, height/2, -length/2
-    };
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
 
-    float texcoords[] = {
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f,
-        0.0f, 0.0f,
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 1.0f
-    };
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.r/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.g/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.b/255.0f,
+            (float)material.maps[MATERIAL_MAP_SPECULAR].color.a/255.0f
+        };
 
-    float normals[] = {
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f, 1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 0.0f,-1.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f, 1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        0.0f,-1.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f,
-        -1.0f, 0.0f, 0.0f
-    };
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
 
-    mesh.vertices = (float *)RL_MALLOC(24*3*sizeof(float));
-    memcpy(mesh.vertices, vertices, 24*3*sizeof(float));
+    SetMaterialUniformBlock(material);
 
-    mesh.texcoords = (float *)RL_MALLOC(24*2*sizeof(float));
-    memcpy(mesh.texcoords, texcoords, 24*2*sizeof(float));
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        bool cubemap = ((i == MATERIAL_MAP_IRRADIANCE) || (i == MATERIAL_MAP_PREFILTER) || (i == MATERIAL_MAP_CUBEMAP));
 
-    mesh.normals = (float *)RL_MALLOC(24*3*sizeof(float));
-    memcpy(mesh.normals, normals, 24*3*sizeof(float));
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-    mesh.indices = (unsigned short *)RL_MALLOC(36*sizeof(unsigned short));
+            // Enable texture for active slot
+            if (cubemap) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
 
-    int k = 0;
+            rlSetUniform(material.shader.locs[MATERIAL_MAP_LOCATION(i)], &i, SHADER_UNIFORM_INT, 1);
+        }
+        else if ((previous != NULL) && (previous->maps[i].texture.id > 0))
+        {
+            rlActiveTextureSlot(i);
 
-    // Indices can be initialized right now
-    for (int i = 0; i < 36; i += 6)
+            if (cubemap) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
+    }
+}
+
+// Unbind material texture maps
+// NOTE: Only maps binded by SetMeshMaterialState() need it, other texture slots were not changed
+static void ResetMeshMaterialState(Material material)
+{
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
-        mesh.indices[i] = 4*k;
-        mesh.indices[i + 1] = 4*k + 1;
-        mesh.indices[i + 2] = 4*k + 2;
-        mesh.indices[i + 3] = 4*k;
-        mesh.indices[i + 4] = 4*k + 2;
-        mesh.indices[i + 5] = 4*k + 3;
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
 
-        k++;
+            // Disable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
     }
 
-    mesh.vertexCount = 24;
-    mesh.triangleCount = 12;
-
-#else               // Use par_shapes library to generate cube mesh
-/*
-// Platonic solids:
-par_shapes_mesh* par_shapes_create_tetrahedron();       // 4 sides polyhedron (pyramid)
-par_shapes_mesh* par_shapes_create_cube();              // 6 sides polyhedron (cube)
-par_shapes_mesh* par_shapes_create_octahedron();        // 8 sides polyhedron (dyamond)
-par_shapes_mesh* par_shapes_create_dodecahedron();      // 12 sides polyhedron
-par_shapes_mesh* par_shapes_create_icosahedron();       // 20 sides polyhedron
-*/
-    // Platonic solid generation: cube (6 sides)
-    // NOTE: No normals/texcoords generated by default
-    par_shapes_mesh *cube = par_shapes_create_cube();
-    cube->tcoords = PAR_MALLOC(float, 2*cube->npoints);
-    for (int i = 0; i < 2*cube->npoints; i++) cube->tcoords[i] = 0.0f;
-    par_shapes_scale(cube, width, height, length);
-    par_shapes_translate(cube, -width/2, 0.0f, -length/2);
-    par_shapes_compute_normals(cube);
+    rlActiveTextureSlot(0);
+}
 
-    mesh.vertices = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(cube->ntriangles*3*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(cube->ntriangles*3*3*sizeof(float));
+// Upload mesh model matrices, bind mesh vertex data and draw it with current shader and material state
+static void DrawMeshGeometry(Mesh mesh, Material material, Matrix transform, Matrix matModel, Matrix matView, Matrix matProjection)
+{
+    // Quantized positions are dequantized by model transform
+    // NOTE: Dequantization scale is uniform, normal matrix keeps normals direction
+    if (mesh.quantization & MESH_QUANTIZE_POSITION)
+    {
+        Matrix matDequantize = GetMeshDequantizeMatrix(mesh);
+        transform = MatrixMultiply(matDequantize, transform);
+        matModel = MatrixMultiply(matDequantize, matModel);
+    }
 
-    mesh.vertexCount = cube->ntriangles*3;
-    mesh.triangleCount = cube->ntriangles;
+    // Model transformation matrix is send to shader uniform location: SHADER_LOC_MATRIX_MODEL
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MODEL], transform);
 
-    for (int k = 0; k < mesh.vertexCount; k++)
-    {
-        mesh.vertices[k*3] = cube->points[cube->triangles[k]*3];
-        mesh.vertices[k*3 + 1] = cube->points[cube->triangles[k]*3 + 1];
-        mesh.vertices[k*3 + 2] = cube->points[cube->triangles[k]*3 + 2];
+    // Get model-view matrix
+    Matrix matModelView = MatrixMultiply(matModel, matView);
 
-        mesh.normals[k*3] = cube->normals[cube->triangles[k]*3];
-        mesh.normals[k*3 + 1] = cube->normals[cube->triangles[k]*3 + 1];
-        mesh.normals[k*3 + 2] = cube->normals[cube->triangles[k]*3 + 2];
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
 
-        mesh.texcoords[k*2] = cube->tcoords[cube->triangles[k]*2];
-        mesh.texcoords[k*2 + 1] = cube->tcoords[cube->triangles[k]*2 + 1];
+#if defined(SUPPORT_GPU_SKINNING)
+    // Upload bones matrices (if GPU skinned and location available)
+    if ((mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
     }
-
-    par_shapes_free_mesh(cube);
+#endif
+#if defined(GPU_MORPHING_SUPPORTED)
+    // Bind morph targets deltas and upload weights (if GPU morphed and location available)
+    if ((mesh.morphTextureId != 0) && (material.shader.locs[SHADER_LOC_MAP_MORPH] != -1)) SetMeshMorphState(mesh, material.shader);
 #endif
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
-
-    return mesh;
-}
-
-// Generate sphere mesh (standard sphere)
-Mesh GenMeshSphere(float radius, int rings, int slices)
-{
-    Mesh mesh = { 0 };
+    // Skinned vertices buffer, read instead of bind pose positions and normals by shaders not skinning vertices
+    // (default material, shadow casters, picking), mesh is skinned on its first draw with current bones
+    unsigned int skinnedId = 0;
+#if defined(SKINNING_CACHE_SUPPORTED)
+    if ((mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] == -1) && IsSkinningCacheAvailable(mesh))
+    {
+        skinnedId = GetSkinningCacheBuffer(mesh);
+        rlEnableShader(material.shader.id);     // NOTE: Skinning dispatch binds compute program
+    }
+#endif
 
-    if ((rings >= 3) && (slices >= 3))
+    // Try binding vertex array objects (VAO)
+    // or use VBOs if not possible
+    if (!rlEnableVertexArray(mesh.vaoId))
     {
-        par_shapes_mesh *sphere = par_shapes_create_parametric_sphere(slices, rings);
-        par_shapes_scale(sphere, radius, radius, radius);
-        // NOTE: Soft normals are computed internally
+        if (mesh.vertexStride > 0) SetMeshInterleavedAttributes(mesh, material.shader);
+        else
+        {
+            // Bind mesh VBO data: vertex position (shader-location = 0)
+            rlEnableVertexBuffer((skinnedId > 0)? skinnedId : mesh.vboId[0]);
+            if (mesh.quantization & MESH_QUANTIZE_POSITION) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_SHORT, 1, 4*sizeof(short), 0);
+            else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+            // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+            rlEnableVertexBuffer(mesh.vboId[1]);
+            if (mesh.quantization & MESH_QUANTIZE_TEXCOORD) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+
+            if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+            {
+                // Bind mesh VBO data: vertex normals (shader-location = 2)
+                if ((skinnedId > 0) && (mesh.vboId[2] != 0))
+                {
+                    rlEnableVertexBuffer(skinnedId);
+                    rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, (void *)(size_t)(mesh.vertexCount*3*sizeof(float)));
+                }
+                else
+                {
+                    rlEnableVertexBuffer(mesh.vboId[2]);
+                    if (mesh.quantization & MESH_QUANTIZE_NORMAL) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_BYTE, 1, 4*sizeof(signed char), 0);
+                    else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
+                }
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+            }
 
-        mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
+            // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+            {
+                if (mesh.vboId[3] != 0)
+                {
+                    rlEnableVertexBuffer(mesh.vboId[3]);
+                    rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+                    rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                }
+                else
+                {
+                    // Set default value for unused attribute
+                    // NOTE: Required when using default shader and no VAO support
+                    float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                    rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+                    rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+                }
+            }
 
-        mesh.vertexCount = sphere->ntriangles*3;
-        mesh.triangleCount = sphere->ntriangles;
+            // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+            {
+                rlEnableVertexBuffer(mesh.vboId[4]);
+                if (mesh.quantization & MESH_QUANTIZE_NORMAL) rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_BYTE, 1, 0, 0);
+                else rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            }
 
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
+            // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+            if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+            {
+                rlEnableVertexBuffer(mesh.vboId[5]);
+                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            }
 
-            mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-            mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
+    #if defined(SUPPORT_GPU_SKINNING)
+            // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
+            if ((material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+            {
+                rlEnableVertexBuffer(mesh.vboId[7]);
+                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+            }
 
-            mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
-        }
+            // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
+            if ((material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+            {
+                rlEnableVertexBuffer(mesh.vboId[8]);
+                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+            }
+    #endif
 
-        par_shapes_free_mesh(sphere);
+        }
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: sphere");
+    else
+    {
+        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);    // NOTE: Indices buffer can be shared by several vertex arrays (terrain levels of detail)
 
-    return mesh;
-}
+        // Vertex array positions and normals point to skinned vertices (restored after draw)
+        if (skinnedId > 0)
+        {
+            rlEnableVertexBuffer(skinnedId);
+            rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, 0);
+            if (mesh.vboId[2] != 0) rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, (void *)(size_t)(mesh.vertexCount*3*sizeof(float)));
+        }
+    }
 
-// Generate hemi-sphere mesh (half sphere, no bottom cap)
-Mesh GenMeshHemiSphere(float radius, int rings, int slices)
-{
-    Mesh mesh = { 0 };
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-    if ((rings >= 3) && (slices >= 3))
+    for (int eye = 0; eye < eyeCount; eye++)
     {
-        if (radius < 0.0f) radius = 0.0f;
+        // Calculate model-view-projection matrix (MVP)
+        Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
 
-        par_shapes_mesh *sphere = par_shapes_create_hemisphere(slices, rings);
-        par_shapes_scale(sphere, radius, radius, radius);
-        // NOTE: Soft normals are computed internally
+        // Send combined model-view-projection matrix to shader
+        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
-        mesh.vertices = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(sphere->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(sphere->ntriangles*3*3*sizeof(float));
+        // Draw mesh
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        else rlDrawVertexArray(0, mesh.vertexCount);
+    }
 
-        mesh.vertexCount = sphere->ntriangles*3;
-        mesh.triangleCount = sphere->ntriangles;
+    // Restore vertex array bind pose positions and normals
+    if ((skinnedId > 0) && (mesh.vaoId > 0) && rlEnableVertexArray(mesh.vaoId))
+    {
+        rlEnableVertexBuffer(mesh.vboId[0]);
+        rlSetVertexAttribute(0, 3, RL_FLOAT, 0, 0, 0);
 
-        for (int k = 0; k < mesh.vertexCount; k++)
+        if (mesh.vboId[2] != 0)
         {
-            mesh.vertices[k*3] = sphere->points[sphere->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = sphere->points[sphere->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = sphere->points[sphere->triangles[k]*3 + 2];
+            rlEnableVertexBuffer(mesh.vboId[2]);
+            rlSetVertexAttribute(2, 3, RL_FLOAT, 0, 0, 0);
+        }
+    }
+}
+#endif
 
-            mesh.normals[k*3] = sphere->normals[sphere->triangles[k]*3];
-            mesh.normals[k*3 + 1] = sphere->normals[sphere->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = sphere->normals[sphere->triangles[k]*3 + 2];
+#if defined(RLGL_ENABLE_COMMAND_LISTS)
+// Record a mesh draw into current thread command list
+// NOTE: Mesh and material are only referenced, they must be valid until list is submitted
+static void RecordMeshDrawCommand(Mesh mesh, Material material, const Matrix *transforms, int instances)
+{
+    int count = (instances > 0)? instances : 1;
+    int size = (int)sizeof(MeshDrawCommand) + count*(int)sizeof(Matrix);
 
-            mesh.texcoords[k*2] = sphere->tcoords[sphere->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = sphere->tcoords[sphere->triangles[k]*2 + 1];
-        }
+    MeshDrawCommand *command = (MeshDrawCommand *)RL_MALLOC(size);
+    if (command == NULL) return;
 
-        par_shapes_free_mesh(sphere);
+    command->mesh = mesh;
+    command->material = material;
+    if (material.maps != NULL) memcpy(command->maps, material.maps, MAX_MATERIAL_MAPS*sizeof(MaterialMap));
+    else memset(command->maps, 0, MAX_MATERIAL_MAPS*sizeof(MaterialMap));
+    command->transform = transforms[0];
+    command->instances = instances;
+    memcpy((unsigned char *)command + sizeof(MeshDrawCommand), transforms, count*sizeof(Matrix));
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
-    }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: hemisphere");
+    rlRecordCommandCallback(SubmitMeshDrawCommand, command, size);
 
-    return mesh;
+    RL_FREE(command);
 }
 
-// Generate cylinder mesh
-Mesh GenMeshCylinder(float radius, float height, int slices)
+// Command list mesh draw callback, called on rlSubmitCommandList() from rendering thread
+static void SubmitMeshDrawCommand(void *data)
 {
-    Mesh mesh = { 0 };
-
-    if (slices >= 3)
-    {
-        // Instance a cylinder that sits on the Z=0 plane using the given tessellation
-        // levels across the UV domain.  Think of "slices" like a number of pizza
-        // slices, and "stacks" like a number of stacked rings.
-        // Height and radius are both 1.0, but they can easily be changed with par_shapes_scale
-        par_shapes_mesh *cylinder = par_shapes_create_cylinder(slices, 8);
-        par_shapes_scale(cylinder, radius, radius, height);
-        par_shapes_rotate(cylinder, -PI/2.0f, (float[]){ 1, 0, 0 });
+    MeshDrawCommand *command = (MeshDrawCommand *)data;
 
-        // Generate an orientable disk shape (top cap)
-        par_shapes_mesh *capTop = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, 1 });
-        capTop->tcoords = PAR_MALLOC(float, 2*capTop->npoints);
-        for (int i = 0; i < 2*capTop->npoints; i++) capTop->tcoords[i] = 0.0f;
-        par_shapes_rotate(capTop, -PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(capTop, 90*DEG2RAD, (float[]){ 0, 1, 0 });
-        par_shapes_translate(capTop, 0, height, 0);
+    Material material = command->material;
+    material.maps = command->maps;
 
-        // Generate an orientable disk shape (bottom cap)
-        par_shapes_mesh *capBottom = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, -1 });
-        capBottom->tcoords = PAR_MALLOC(float, 2*capBottom->npoints);
-        for (int i = 0; i < 2*capBottom->npoints; i++) capBottom->tcoords[i] = 0.95f;
-        par_shapes_rotate(capBottom, PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(capBottom, -90*DEG2RAD, (float[]){ 0, 1, 0 });
+    if (command->instances > 0) DrawMeshInstanced(command->mesh, material, (const Matrix *)((unsigned char *)data + sizeof(MeshDrawCommand)), command->instances);
+    else DrawMesh(command->mesh, material, command->transform);
+}
+#endif
 
-        par_shapes_merge_and_free(cylinder, capTop);
-        par_shapes_merge_and_free(cylinder, capBottom);
+#if defined(SUPPORT_MESH_INTERLEAVING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Load mesh vertex attributes into a single interleaved vertex buffer (vboId[0]), attributes offsets are stored in mesh
+// NOTE: Quantized attributes keep their quantized formats, all attributes sizes are multiple of 4 bytes (aligned)
+static void LoadMeshInterleavedBuffer(Mesh *mesh, void **quantized)
+{
+    // Attributes in shader-locations order: position, texcoords, normals, colors, tangents, texcoords2
+    const void *data[6] = {
+        (quantized[0] != NULL)? quantized[0] : (void *)mesh->vertices,
+        (quantized[1] != NULL)? quantized[1] : (void *)mesh->texcoords,
+        (quantized[2] != NULL)? quantized[2] : (void *)mesh->normals,
+        mesh->colors,
+        (quantized[3] != NULL)? quantized[3] : (void *)mesh->tangents,
+        mesh->texcoords2
+    };
+    const int sizes[6] = {
+        (quantized[0] != NULL)? 4*sizeof(short) : 3*sizeof(float),
+        (quantized[1] != NULL)? 2*sizeof(unsigned short) : 2*sizeof(float),
+        (quantized[2] != NULL)? 4*sizeof(signed char) : 3*sizeof(float),
+        4*sizeof(unsigned char),
+        (quantized[3] != NULL)? 4*sizeof(signed char) : 4*sizeof(float),
+        2*sizeof(float)
+    };
 
-        mesh.vertices = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(cylinder->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(cylinder->ntriangles*3*3*sizeof(float));
+    if (quantized[0] != NULL) mesh->quantization |= MESH_QUANTIZE_POSITION;
+    if (quantized[1] != NULL) mesh->quantization |= MESH_QUANTIZE_TEXCOORD;
+    if (quantized[2] != NULL) mesh->quantization |= MESH_QUANTIZE_NORMAL;
 
-        mesh.vertexCount = cylinder->ntriangles*3;
-        mesh.triangleCount = cylinder->ntriangles;
+    mesh->vertexStride = 0;
 
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = cylinder->points[cylinder->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = cylinder->points[cylinder->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = cylinder->points[cylinder->triangles[k]*3 + 2];
+    for (int i = 0; i < 6; i++)
+    {
+        mesh->vertexOffsets[i] = (data[i] != NULL)? mesh->vertexStride : -1;
+        if (data[i] != NULL) mesh->vertexStride += sizes[i];
+    }
 
-            mesh.normals[k*3] = cylinder->normals[cylinder->triangles[k]*3];
-            mesh.normals[k*3 + 1] = cylinder->normals[cylinder->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = cylinder->normals[cylinder->triangles[k]*3 + 2];
+    unsigned char *vertices = (unsigned char *)RL_MALLOC(mesh->vertexCount*mesh->vertexStride);
 
-            mesh.texcoords[k*2] = cylinder->tcoords[cylinder->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = cylinder->tcoords[cylinder->triangles[k]*2 + 1];
-        }
+    for (int i = 0; i < 6; i++)
+    {
+        if (data[i] == NULL) continue;
 
-        par_shapes_free_mesh(cylinder);
+        const unsigned char *src = (const unsigned char *)data[i];
+        unsigned char *dst = vertices + mesh->vertexOffsets[i];
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+        for (int v = 0; v < mesh->vertexCount; v++) memcpy(dst + v*mesh->vertexStride, src + v*sizes[i], sizes[i]);
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cylinder");
 
-    return mesh;
+    mesh->vboId[0] = rlLoadVertexBuffer(vertices, mesh->vertexCount*mesh->vertexStride, false);
+    RL_FREE(vertices);
+
+    // NOTE: Mesh vertex array is bound, attributes use default locations
+    Shader shader = { 0 };
+    int locations[SHADER_LOC_VERTEX_COLOR + 1] = { 0 };
+    locations[SHADER_LOC_VERTEX_POSITION] = 0;
+    locations[SHADER_LOC_VERTEX_TEXCOORD01] = 1;
+    locations[SHADER_LOC_VERTEX_NORMAL] = 2;
+    locations[SHADER_LOC_VERTEX_COLOR] = 3;
+    locations[SHADER_LOC_VERTEX_TANGENT] = 4;
+    locations[SHADER_LOC_VERTEX_TEXCOORD02] = 5;
+    shader.locs = locations;
+
+    SetMeshInterleavedAttributes(*mesh, shader);
 }
+#endif
 
-// Generate cone/pyramid mesh
-Mesh GenMeshCone(float radius, float height, int slices)
+// Get mesh vertex buffer size (in bytes), as uploaded by UploadMesh()
+// NOTE: Returns 0 for interleaved attributes and quantized attributes (size depends on quantization)
+static int GetMeshBufferSize(Mesh mesh, int index)
 {
-    Mesh mesh = { 0 };
+    int size = 0;
 
-    if (slices >= 3)
+    if ((mesh.vertexStride > 0) && (index < 6)) return 0;
+
+    switch (index)
     {
-        // Instance a cone that sits on the Z=0 plane using the given tessellation
-        // levels across the UV domain.  Think of "slices" like a number of pizza
-        // slices, and "stacks" like a number of stacked rings.
-        // Height and radius are both 1.0, but they can easily be changed with par_shapes_scale
-        par_shapes_mesh *cone = par_shapes_create_cone(slices, 8);
-        par_shapes_scale(cone, radius, radius, height);
-        par_shapes_rotate(cone, -PI/2.0f, (float[]){ 1, 0, 0 });
-        par_shapes_rotate(cone, PI/2.0f, (float[]){ 0, 1, 0 });
+        case 0: size = ((mesh.quantization & MESH_QUANTIZE_POSITION) != 0)? 0 : mesh.vertexCount*3*sizeof(float); break;
+        case 1: size = ((mesh.quantization & MESH_QUANTIZE_TEXCOORD) != 0)? 0 : mesh.vertexCount*2*sizeof(float); break;
+        case 2: size = ((mesh.quantization & MESH_QUANTIZE_NORMAL) != 0)? 0 : mesh.vertexCount*3*sizeof(float); break;
+        case 3: size = mesh.vertexCount*4*sizeof(unsigned char); break;
+        case 4: size = ((mesh.quantization & MESH_QUANTIZE_NORMAL) != 0)? 0 : mesh.vertexCount*4*sizeof(float); break;
+        case 5: size = mesh.vertexCount*2*sizeof(float); break;
+        case 6: size = mesh.triangleCount*3*sizeof(unsigned short); break;
+        case 7: size = mesh.vertexCount*4*sizeof(unsigned char); break;
+        case 8: size = mesh.vertexCount*4*sizeof(float); break;
+        default: break;
+    }
 
-        // Generate an orientable disk shape (bottom cap)
-        par_shapes_mesh *capBottom = par_shapes_create_disk(radius, slices, (float[]){ 0, 0, 0 }, (float[]){ 0, 0, -1 });
-        capBottom->tcoords = PAR_MALLOC(float, 2*capBottom->npoints);
-        for (int i = 0; i < 2*capBottom->npoints; i++) capBottom->tcoords[i] = 0.95f;
-        par_shapes_rotate(capBottom, PI/2.0f, (float[]){ 1, 0, 0 });
+    return size;
+}
 
-        par_shapes_merge_and_free(cone, capBottom);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Set interleaved mesh vertex attributes for shader locations (vboId[0] bound with attributes offsets)
+// NOTE: Missing attributes get the same default values set by UploadMesh()
+static void SetMeshInterleavedAttributes(Mesh mesh, Shader shader)
+{
+    const int locations[6] = {
+        shader.locs[SHADER_LOC_VERTEX_POSITION],
+        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01],
+        shader.locs[SHADER_LOC_VERTEX_NORMAL],
+        shader.locs[SHADER_LOC_VERTEX_COLOR],
+        shader.locs[SHADER_LOC_VERTEX_TANGENT],
+        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]
+    };
+    const int components[6] = { 3, 2, 3, 4, 4, 2 };
+    const int types[6] = {
+        (mesh.quantization & MESH_QUANTIZE_POSITION)? RL_SHORT : RL_FLOAT,
+        (mesh.quantization & MESH_QUANTIZE_TEXCOORD)? RL_UNSIGNED_SHORT : RL_FLOAT,
+        (mesh.quantization & MESH_QUANTIZE_NORMAL)? RL_BYTE : RL_FLOAT,
+        RL_UNSIGNED_BYTE,
+        (mesh.quantization & MESH_QUANTIZE_NORMAL)? RL_BYTE : RL_FLOAT,
+        RL_FLOAT
+    };
+    const float defaults[6][4] = {
+        { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f, 0.0f },
+        { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f }
+    };
+    const int defaultTypes[6] = { SHADER_ATTRIB_VEC3, SHADER_ATTRIB_VEC2, SHADER_ATTRIB_VEC3, SHADER_ATTRIB_VEC4, SHADER_ATTRIB_VEC4, SHADER_ATTRIB_VEC2 };
 
-        mesh.vertices = (float *)RL_MALLOC(cone->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(cone->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(cone->ntriangles*3*3*sizeof(float));
+    rlEnableVertexBuffer(mesh.vboId[0]);
 
-        mesh.vertexCount = cone->ntriangles*3;
-        mesh.triangleCount = cone->ntriangles;
+    for (int i = 0; i < 6; i++)
+    {
+        if (locations[i] == -1) continue;
 
-        for (int k = 0; k < mesh.vertexCount; k++)
+        if (mesh.vertexOffsets[i] >= 0)
         {
-            mesh.vertices[k*3] = cone->points[cone->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = cone->points[cone->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = cone->points[cone->triangles[k]*3 + 2];
-
-            mesh.normals[k*3] = cone->normals[cone->triangles[k]*3];
-            mesh.normals[k*3 + 1] = cone->normals[cone->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = cone->normals[cone->triangles[k]*3 + 2];
-
-            mesh.texcoords[k*2] = cone->tcoords[cone->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = cone->tcoords[cone->triangles[k]*2 + 1];
+            bool normalized = (types[i] != RL_FLOAT);
+            rlSetVertexAttribute(locations[i], components[i], types[i], normalized, mesh.vertexStride, (const void *)(size_t)mesh.vertexOffsets[i]);
+            rlEnableVertexAttribute(locations[i]);
         }
+        else
+        {
+            rlSetVertexAttributeDefault(locations[i], defaults[i], defaultTypes[i], components[i]);
+            rlDisableVertexAttribute(locations[i]);
+        }
+    }
+}
 
-        par_shapes_free_mesh(cone);
-
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
-    }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cone");
+// Get mesh quantized positions dequantization transform (identity if not quantized)
+static Matrix GetMeshDequantizeMatrix(Mesh mesh)
+{
+    if (!(mesh.quantization & MESH_QUANTIZE_POSITION)) return MatrixIdentity();
+
+    float scale = mesh.quantizeScale;
+    Matrix result = {
+        scale, 0.0f, 0.0f, mesh.quantizeOffset.x,
+        0.0f, scale, 0.0f, mesh.quantizeOffset.y,
+        0.0f, 0.0f, scale, mesh.quantizeOffset.z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
 
-    return mesh;
+    return result;
 }
 
-// Generate torus mesh
-Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
+// Get instances transforms combined with mesh dequantization, transforms returned if mesh positions are not quantized
+// NOTE: Combined transforms are stored on instances scratch buffer (valid until next call)
+static const Matrix *GetMeshInstancesTransforms(Mesh mesh, const Matrix *transforms, int instances)
 {
-    Mesh mesh = { 0 };
+    if (!(mesh.quantization & MESH_QUANTIZE_POSITION)) return transforms;
 
-    if ((sides >= 3) && (radSeg >= 3))
+    // NOTE: If transforms are already the scratch buffer (DrawMeshInstancedCulled()), capacity is enough
+    if (culledTransforms.capacity < instances)
     {
-        if (radius > 1.0f) radius = 1.0f;
-        else if (radius < 0.1f) radius = 0.1f;
+        Matrix *data = (Matrix *)RL_REALLOC(culledTransforms.data, instances*sizeof(Matrix));
+        if (data == NULL) return transforms;
+
+        culledTransforms.data = data;
+        culledTransforms.capacity = instances;
+    }
 
-        // Create a donut that sits on the Z=0 plane with the specified inner radius
-        // The outer radius can be controlled with par_shapes_scale
-        par_shapes_mesh *torus = par_shapes_create_torus(radSeg, sides, radius);
-        par_shapes_scale(torus, size/2, size/2, size/2);
+    Matrix matDequantize = GetMeshDequantizeMatrix(mesh);
+    for (int i = 0; i < instances; i++) culledTransforms.data[i] = MatrixMultiply(matDequantize, transforms[i]);
 
-        mesh.vertices = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(torus->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(torus->ntriangles*3*3*sizeof(float));
+    return culledTransforms.data;
+}
 
-        mesh.vertexCount = torus->ntriangles*3;
-        mesh.triangleCount = torus->ntriangles;
+#if defined(SUPPORT_MESH_QUANTIZATION)
+// Quantize mesh positions to 16 bit normalized integers (4 components, w unused for 4-byte alignment)
+// NOTE: Positions are centered on bounding box and scaled by its largest half extent (uniform scale)
+static short *QuantizeMeshPositions(Mesh *mesh)
+{
+    short *positions = (short *)RL_MALLOC(mesh->vertexCount*4*sizeof(short));
+    if (positions == NULL) return NULL;
 
-        for (int k = 0; k < mesh.vertexCount; k++)
-        {
-            mesh.vertices[k*3] = torus->points[torus->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = torus->points[torus->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = torus->points[torus->triangles[k]*3 + 2];
+    Vector3 extent = Vector3Scale(Vector3Subtract(mesh->boundsMax, mesh->boundsMin), 0.5f);
+    float scale = fmaxf(extent.x, fmaxf(extent.y, extent.z));
+    if (scale <= 0.0f) scale = 1.0f;
 
-            mesh.normals[k*3] = torus->normals[torus->triangles[k]*3];
-            mesh.normals[k*3 + 1] = torus->normals[torus->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = torus->normals[torus->triangles[k]*3 + 2];
+    mesh->quantizeOffset = Vector3Scale(Vector3Add(mesh->boundsMin, mesh->boundsMax), 0.5f);
+    mesh->quantizeScale = scale;
 
-            mesh.texcoords[k*2] = torus->tcoords[torus->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = torus->tcoords[torus->triangles[k]*2 + 1];
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            float value = (mesh->vertices[3*i + c] - (&mesh->quantizeOffset.x)[c])/scale;
+            positions[4*i + c] = (short)roundf(Clamp(value, -1.0f, 1.0f)*32767.0f);
         }
 
-        par_shapes_free_mesh(torus);
+        positions[4*i + 3] = 0;
+    }
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+    return positions;
+}
+
+// Quantize texcoords to 16 bit unsigned normalized integers, NULL if any texcoord is out of [0..1] range (wrapping)
+static unsigned short *QuantizeMeshTexcoords(const float *texcoords, int count)
+{
+    for (int i = 0; i < count*2; i++)
+    {
+        if ((texcoords[i] < 0.0f) || (texcoords[i] > 1.0f)) return NULL;
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: torus");
 
-    return mesh;
+    unsigned short *result = (unsigned short *)RL_MALLOC(count*2*sizeof(unsigned short));
+    if (result == NULL) return NULL;
+
+    for (int i = 0; i < count*2; i++) result[i] = (unsigned short)roundf(texcoords[i]*65535.0f);
+
+    return result;
 }
 
-// Generate trefoil knot mesh
-Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
+// Quantize normals/tangents to 8 bit normalized integers (4 components, w unused for normals)
+static signed char *QuantizeMeshDirections(const float *directions, int components, int count)
 {
-    Mesh mesh = { 0 };
+    signed char *result = (signed char *)RL_MALLOC(count*4*sizeof(signed char));
+    if (result == NULL) return NULL;
 
-    if ((sides >= 3) && (radSeg >= 3))
+    for (int i = 0; i < count; i++)
     {
-        if (radius > 3.0f) radius = 3.0f;
-        else if (radius < 0.5f) radius = 0.5f;
+        for (int c = 0; c < 4; c++)
+        {
+            float value = (c < components)? directions[components*i + c] : 0.0f;
+            result[4*i + c] = (signed char)roundf(Clamp(value, -1.0f, 1.0f)*127.0f);
+        }
+    }
 
-        par_shapes_mesh *knot = par_shapes_create_trefoil_knot(radSeg, sides, radius);
-        par_shapes_scale(knot, size, size, size);
+    return result;
+}
+#endif
 
-        mesh.vertices = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
-        mesh.texcoords = (float *)RL_MALLOC(knot->ntriangles*3*2*sizeof(float));
-        mesh.normals = (float *)RL_MALLOC(knot->ntriangles*3*3*sizeof(float));
+// Record a mesh draw into render queue
+static void RecordQueuedDraw(Mesh mesh, Material material, Matrix transform)
+{
+    if (renderQueue.count >= renderQueue.capacity)
+    {
+        int capacity = (renderQueue.capacity > 0)? 2*renderQueue.capacity : 256;
 
-        mesh.vertexCount = knot->ntriangles*3;
-        mesh.triangleCount = knot->ntriangles;
+        QueuedDraw *draws = (QueuedDraw *)RL_REALLOC(renderQueue.draws, capacity*sizeof(QueuedDraw));
+        if (draws != NULL) renderQueue.draws = draws;
+        QueuedDrawKey *keys = (QueuedDrawKey *)RL_REALLOC(renderQueue.keys, capacity*sizeof(QueuedDrawKey));
+        if (keys != NULL) renderQueue.keys = keys;
 
-        for (int k = 0; k < mesh.vertexCount; k++)
+        if ((draws == NULL) || (keys == NULL))
         {
-            mesh.vertices[k*3] = knot->points[knot->triangles[k]*3];
-            mesh.vertices[k*3 + 1] = knot->points[knot->triangles[k]*3 + 1];
-            mesh.vertices[k*3 + 2] = knot->points[knot->triangles[k]*3 + 2];
+            TRACELOG(LOG_WARNING, "MODEL: Render queue is full, draw skipped");
+            return;
+        }
 
-            mesh.normals[k*3] = knot->normals[knot->triangles[k]*3];
-            mesh.normals[k*3 + 1] = knot->normals[knot->triangles[k]*3 + 1];
-            mesh.normals[k*3 + 2] = knot->normals[knot->triangles[k]*3 + 2];
+        renderQueue.capacity = capacity;
+    }
 
-            mesh.texcoords[k*2] = knot->tcoords[knot->triangles[k]*2];
-            mesh.texcoords[k*2 + 1] = knot->tcoords[knot->triangles[k]*2 + 1];
-        }
+    QueuedDraw *draw = &renderQueue.draws[renderQueue.count];
+
+    draw->mesh = mesh;
+    draw->material = material;
+    draw->material.shader = GetMeshShader(mesh, material);
+    if (material.maps != NULL) memcpy(draw->maps, material.maps, sizeof(draw->maps));
+    else memset(draw->maps, 0, sizeof(draw->maps));
+    draw->transform = transform;
+    draw->matModel = MatrixMultiply(transform, rlGetMatrixTransform());
+    draw->matView = rlGetMatrixModelview();
+    draw->matProjection = rlGetMatrixProjection();
+    draw->castShadows = renderQueue.castShadows;
+    draw->pickId = renderQueue.pickId;
+
+    int pass = renderQueue.pass;
+    if (pass == RENDER_PASS_AUTO) pass = (draw->maps[MATERIAL_MAP_DIFFUSE].color.a < 255)? RENDER_PASS_TRANSPARENT : RENDER_PASS_OPAQUE;
+
+    // Camera distance from model origin in view space (camera looks towards -Z)
+    Matrix *view = &draw->matView;
+    float depth = -(view->m2*draw->matModel.m12 + view->m6*draw->matModel.m13 + view->m10*draw->matModel.m14 + view->m14);
+    if (!(depth > 0.0f)) depth = 0.0f;
+
+    // NOTE: Positive floats bits are sorted as integers
+    unsigned int depthBits = 0;
+    memcpy(&depthBits, &depth, sizeof(float));
+
+    // Material identifier, hash of material maps (FNV-1a), collisions only affect draws grouping
+    // NOTE: With automatic instancing, diffuse color is an instance attribute, tinted draws are grouped together
+    MaterialMap maps[MAX_MATERIAL_MAPS] = { 0 };
+    memcpy(maps, draw->maps, sizeof(maps));
+    if (renderQueue.instancing) maps[MATERIAL_MAP_DIFFUSE].color = (Color){ 0 };
+
+    unsigned int materialHash = 2166136261u;
+    for (unsigned int i = 0; i < sizeof(maps); i++) materialHash = (materialHash ^ ((unsigned char *)maps)[i])*16777619u;
+    materialHash = (materialHash ^ (materialHash >> 16)) & 0xffff;
+
+    unsigned long long shaderId = draw->material.shader.id & 0xffff;
+    unsigned long long meshId = ((mesh.vaoId > 0)? mesh.vaoId : ((mesh.vboId != NULL)? mesh.vboId[0] : 0)) & 0xffff;
+    unsigned long long key = 0;
+
+    // Opaque key: [pass:1][shader:16][material:16][mesh:16][depth:15] front-to-back
+    // Transparent key: [pass:1][inverted depth:32][shader:16][material:15] back-to-front
+    if (pass == RENDER_PASS_TRANSPARENT) key = (1ULL << 63) | ((unsigned long long)(~depthBits) << 31) | (shaderId << 15) | (materialHash & 0x7fff);
+    else key = (shaderId << 47) | ((unsigned long long)materialHash << 31) | (meshId << 15) | ((depthBits >> 16) & 0x7fff);
+
+    renderQueue.keys[renderQueue.count].key = key;
+    renderQueue.keys[renderQueue.count].index = renderQueue.count;
+    renderQueue.count++;
+}
 
-        par_shapes_free_mesh(knot);
+// Compare render queue draws sort keys, recording order kept for equal keys
+static int CompareQueuedDraws(const void *a, const void *b)
+{
+    const QueuedDrawKey *keyA = (const QueuedDrawKey *)a;
+    const QueuedDrawKey *keyB = (const QueuedDrawKey *)b;
 
-        // Upload vertex data to GPU (static mesh)
-        UploadMesh(&mesh, false);
+    if (keyA->key != keyB->key) return (keyA->key < keyB->key)? -1 : 1;
+
+    return keyA->index - keyB->index;
+}
+#endif
+
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+// Check if queued draw can be drawn as an instance of first draw: same mesh, camera and material (but diffuse color)
+// NOTE: Only default shader draws are instanced, lit and skinned draws shaders are resolved on recording
+static bool CheckQueuedDrawsInstancing(const QueuedDraw *first, const QueuedDraw *draw)
+{
+    if ((draw->material.shader.id != rlGetShaderIdDefault()) || (draw->mesh.boneMatrices != NULL) || (draw->mesh.morphTextureId != 0)) return false;
+    if (draw == first) return true;
+
+    if ((draw->mesh.vaoId != first->mesh.vaoId) || (draw->mesh.vboId != first->mesh.vboId)) return false;
+    if (memcmp(&draw->matView, &first->matView, sizeof(Matrix)) != 0) return false;
+    if (memcmp(&draw->matProjection, &first->matProjection, sizeof(Matrix)) != 0) return false;
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if ((i != MATERIAL_MAP_DIFFUSE) && (memcmp(&draw->maps[i].color, &first->maps[i].color, sizeof(Color)) != 0)) return false;
+        if ((draw->maps[i].texture.id != first->maps[i].texture.id) || (draw->maps[i].value != first->maps[i].value)) return false;
     }
-    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: knot");
 
-    return mesh;
+    return true;
 }
 
-// Generate a mesh from heightmap
-// NOTE: Vertex data is uploaded to GPU
-Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
+// Draw sorted queued draws range as instances of first draw, returns false if instances could not be drawn
+// NOTE: Instances data is uploaded to rlgl instance stream (persistent ring buffer, no buffer created per draw)
+static bool DrawQueuedDrawsInstanced(int first, int count)
 {
-    #define GRAY_VALUE(c) ((c.r+c.g+c.b)/3)
+    if (renderQueue.instanceCapacity < count)
+    {
+        Matrix *transforms = (Matrix *)RL_REALLOC(renderQueue.instanceTransforms, count*sizeof(Matrix));
+        if (transforms != NULL) renderQueue.instanceTransforms = transforms;
+        Color *colors = (Color *)RL_REALLOC(renderQueue.instanceColors, count*sizeof(Color));
+        if (colors != NULL) renderQueue.instanceColors = colors;
 
-    Mesh mesh = { 0 };
+        if ((transforms == NULL) || (colors == NULL)) return false;
 
-    int mapX = heightmap.width;
-    int mapZ = heightmap.height;
+        renderQueue.instanceCapacity = count;
+    }
 
-    Color *pixels = LoadImageColors(heightmap);
+    for (int i = 0; i < count; i++)
+    {
+        QueuedDraw *instance = &renderQueue.draws[renderQueue.keys[first + i].index];
 
-    // NOTE: One vertex per pixel
-    mesh.triangleCount = (mapX-1)*(mapZ-1)*2;    // One quad every four pixels
+        renderQueue.instanceTransforms[i] = instance->matModel;
+        renderQueue.instanceColors[i] = instance->maps[MATERIAL_MAP_DIFFUSE].color;
+    }
 
-    mesh.vertexCount = mesh.triangleCount*3;
+    QueuedDraw *draw = &renderQueue.draws[renderQueue.keys[first].index];
 
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.colors = NULL;
+    // Diffuse color is multiplied per instance, material color uniform is left white
+    MaterialMap maps[MAX_MATERIAL_MAPS] = { 0 };
+    memcpy(maps, draw->maps, sizeof(maps));
+    maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
 
-    int vCounter = 0;       // Used to count vertices float by float
-    int tcCounter = 0;      // Used to count texcoords float by float
-    int nCounter = 0;       // Used to count normals float by float
+    Material material = draw->material;
+    material.shader = instancingShader;
+    material.maps = maps;
 
-    int trisCounter = 0;
+    unsigned int vboIds[3] = { 0 };
+    int offsets[3] = { 0 };
+    vboIds[0] = rlUpdateInstanceStream(GetMeshInstancesTransforms(draw->mesh, renderQueue.instanceTransforms, count), count*sizeof(Matrix), &offsets[0]);
+    vboIds[1] = rlUpdateInstanceStream(renderQueue.instanceColors, count*sizeof(Color), &offsets[1]);
 
-    Vector3 scaleFactor = { size.x/mapX, size.y/255.0f, size.z/mapZ };
+    // Camera matrices at recording, restored by EndRenderQueue()
+    rlSetMatrixModelview(draw->matView);
+    rlSetMatrixProjection(draw->matProjection);
 
-    Vector3 vA = { 0 };
-    Vector3 vB = { 0 };
-    Vector3 vC = { 0 };
-    Vector3 vN = { 0 };
+    DrawMeshInstancedStreams(draw->mesh, material, vboIds, offsets, count, 0);
 
-    for (int z = 0; z < mapZ-1; z++)
-    {
-        for (int x = 0; x < mapX-1; x++)
-        {
-            // Fill vertices array with data
-            //----------------------------------------------------------
+    return true;
+}
+#endif
 
-            // one triangle - 3 vertex
-            mesh.vertices[vCounter] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 1] = (float)GRAY_VALUE(pixels[x + z*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 2] = (float)z*scaleFactor.z;
+// Unload render queue, culling buffers and shared uniform buffers
+// NOTE: Called by CloseWindow()
+extern void UnloadRenderQueue(void)
+{
+    RL_FREE(renderQueue.draws);
+    RL_FREE(renderQueue.keys);
+    RL_FREE(renderQueue.instanceTransforms);
+    RL_FREE(renderQueue.instanceColors);
+    memset(&renderQueue, 0, sizeof(renderQueue));
+
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+    if (instancingShader.id > 0) UnloadShader(instancingShader);
+    instancingShader = (Shader){ 0 };
+    instancingShaderLoaded = false;
+#endif
 
-            mesh.vertices[vCounter + 3] = (float)x*scaleFactor.x;
-            mesh.vertices[vCounter + 4] = (float)GRAY_VALUE(pixels[x + (z + 1)*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 5] = (float)(z + 1)*scaleFactor.z;
+    RL_FREE(culledTransforms.data);
+    memset(&culledTransforms, 0, sizeof(culledTransforms));
 
-            mesh.vertices[vCounter + 6] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 7] = (float)GRAY_VALUE(pixels[(x + 1) + z*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 8] = (float)z*scaleFactor.z;
+#if defined(SUPPORT_GPU_CULLING) && defined(GRAPHICS_API_OPENGL_43)
+    if (gpuCulling.program > 0) rlUnloadShaderProgram(gpuCulling.program);
+    for (int i = 0; i < 3; i++) if (gpuCulling.visibleIds[i] > 0) rlUnloadShaderBuffer(gpuCulling.visibleIds[i]);
+    if (gpuCulling.commandId > 0) rlUnloadShaderBuffer(gpuCulling.commandId);
+    memset(&gpuCulling, 0, sizeof(gpuCulling));
+#endif
 
-            // another triangle - 3 vertex
-            mesh.vertices[vCounter + 9] = mesh.vertices[vCounter + 6];
-            mesh.vertices[vCounter + 10] = mesh.vertices[vCounter + 7];
-            mesh.vertices[vCounter + 11] = mesh.vertices[vCounter + 8];
+    if (uniformBlocks.frameId > 0) rlUnloadUniformBuffer(uniformBlocks.frameId);
+    if (uniformBlocks.materialId > 0) rlUnloadUniformBuffer(uniformBlocks.materialId);
+    memset(&uniformBlocks, 0, sizeof(uniformBlocks));
 
-            mesh.vertices[vCounter + 12] = mesh.vertices[vCounter + 3];
-            mesh.vertices[vCounter + 13] = mesh.vertices[vCounter + 4];
-            mesh.vertices[vCounter + 14] = mesh.vertices[vCounter + 5];
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+    UnloadOcclusionCulling();
+#endif
+#if defined(PICKING_SUPPORTED)
+    UnloadPicking();
+#endif
+}
 
-            mesh.vertices[vCounter + 15] = (float)(x + 1)*scaleFactor.x;
-            mesh.vertices[vCounter + 16] = (float)GRAY_VALUE(pixels[(x + 1) + (z + 1)*mapX])*scaleFactor.y;
-            mesh.vertices[vCounter + 17] = (float)(z + 1)*scaleFactor.z;
-            vCounter += 18;     // 6 vertex, 18 floats
+#if defined(PICKING_SUPPORTED)
+// Load built-in picking shader and ids framebuffer
+// NOTE: Morphed draws are picked in bind pose (same as shadow casters), skinned draws too without skinning cache
+static void LoadPicking(void)
+{
+    const char *pickingVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *pickingFShaderCode =
+    "#version 330                       \n"
+    "uniform int pickId;                \n"
+    "out uint finalId;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalId = uint(pickId);        \n"    // NOTE: Bits kept, ids over INT_MAX are read back unchanged
+    "}                                  \n";
+
+    pickingLoaded = true;
+    pickingShader = LoadShaderFromMemory(pickingVShaderCode, pickingFShaderCode);
+    pickingIdLoc = GetShaderLocation(pickingShader, "pickId");
+
+    bool loaded = (pickingShader.id > 0) && (pickingShader.id != rlGetShaderIdDefault()) && (pickingIdLoc != -1);
+
+    if (loaded)
+    {
+        picking.textureId = rlLoadTextureIds(1, 1);
+        picking.fboId = rlLoadFramebuffer(1, 1);
+        rlFramebufferAttach(picking.fboId, picking.textureId, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(picking.fboId, rlLoadTextureDepth(1, 1, true), RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+        picking.pixelBufferId = rlLoadPixelBuffer(sizeof(unsigned int));
+
+        loaded = (picking.textureId > 0) && (picking.pixelBufferId > 0) && rlFramebufferComplete(picking.fboId);
+        rlDisableFramebuffer();
+    }
 
-            // Fill texcoords array with data
-            //--------------------------------------------------------------
-            mesh.texcoords[tcCounter] = (float)x/(mapX - 1);
-            mesh.texcoords[tcCounter + 1] = (float)z/(mapZ - 1);
+    if (loaded) TRACELOG(LOG_INFO, "SHADER: [ID %i] Picking shader loaded successfully", pickingShader.id);
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load picking shader, GPU picking disabled");
+        UnloadPicking();
+        pickingLoaded = true;   // Load is not tried again
+    }
+}
 
-            mesh.texcoords[tcCounter + 2] = (float)x/(mapX - 1);
-            mesh.texcoords[tcCounter + 3] = (float)(z + 1)/(mapZ - 1);
+// Unload built-in picking shader, ids framebuffer and readback buffer
+static void UnloadPicking(void)
+{
+    // NOTE: On failure, rlgl could have returned the default shader program
+    if ((pickingShader.id > 0) && (pickingShader.id != rlGetShaderIdDefault())) UnloadShader(pickingShader);
+    else RL_FREE(pickingShader.locs);
+
+    if (picking.pending) rlUnloadFence(picking.fence);
+    if (picking.fboId > 0) rlUnloadFramebuffer(picking.fboId);    // NOTE: Depth renderbuffer is unloaded with framebuffer
+    if (picking.textureId > 0) rlUnloadTexture(picking.textureId);
+    if (picking.pixelBufferId > 0) rlUnloadPixelBuffer(picking.pixelBufferId);
+
+    memset(&picking, 0, sizeof(picking));
+    pickingShader = (Shader){ 0 };
+    pickingLoaded = false;
+    pickingIdLoc = -1;
+}
 
-            mesh.texcoords[tcCounter + 4] = (float)(x + 1)/(mapX - 1);
-            mesh.texcoords[tcCounter + 5] = (float)z/(mapZ - 1);
+// Resolve previous picking readback and render pickable queued draws ids under requested position
+// NOTE: Projection is zoomed on requested pixel so it fills the one pixel ids framebuffer, draws outside
+// the pick frustum are skipped on CPU and readback is only mapped once GPU finished it (no stall)
+static void RenderPicking(void)
+{
+    if (picking.pending && rlIsFenceSignaled(picking.fence))
+    {
+        unsigned int *id = (unsigned int *)rlMapPixelBuffer(picking.pixelBufferId, sizeof(unsigned int));
 
-            mesh.texcoords[tcCounter + 6] = mesh.texcoords[tcCounter + 4];
-            mesh.texcoords[tcCounter + 7] = mesh.texcoords[tcCounter + 5];
+        if (id != NULL)
+        {
+            picking.result = *id;
+            rlUnmapPixelBuffer(picking.pixelBufferId);
+        }
 
-            mesh.texcoords[tcCounter + 8] = mesh.texcoords[tcCounter + 2];
-            mesh.texcoords[tcCounter + 9] = mesh.texcoords[tcCounter + 3];
+        rlUnloadFence(picking.fence);
+        picking.fence = NULL;
+        picking.pending = false;
+    }
 
-            mesh.texcoords[tcCounter + 10] = (float)(x + 1)/(mapX - 1);
-            mesh.texcoords[tcCounter + 11] = (float)(z + 1)/(mapZ - 1);
-            tcCounter += 12;    // 6 texcoords, 12 floats
+    if (!picking.requested || picking.pending || rlIsStereoRenderEnabled()) return;
 
-            // Fill normals array with data
-            //--------------------------------------------------------------
-            for (int i = 0; i < 18; i += 9)
-            {
-                vA.x = mesh.vertices[nCounter + i];
-                vA.y = mesh.vertices[nCounter + i + 1];
-                vA.z = mesh.vertices[nCounter + i + 2];
+    RL_PROFILE_ZONE_BEGIN(zone, "RenderPicking");
 
-                vB.x = mesh.vertices[nCounter + i + 3];
-                vB.y = mesh.vertices[nCounter + i + 4];
-                vB.z = mesh.vertices[nCounter + i + 5];
+    unsigned int framebuffer = rlGetActiveFramebuffer();
+    int viewport[4] = { 0 };
+    rlGetViewport(&viewport[0], &viewport[1], &viewport[2], &viewport[3]);
 
-                vC.x = mesh.vertices[nCounter + i + 6];
-                vC.y = mesh.vertices[nCounter + i + 7];
-                vC.z = mesh.vertices[nCounter + i + 8];
+    if (!pickingLoaded) LoadPicking();
 
-                vN = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vB, vA), Vector3Subtract(vC, vA)));
+    if ((picking.fboId > 0) && (viewport[2] > 0) && (viewport[3] > 0))
+    {
+        picking.requested = false;
+
+        // Requested pixel center in clip space, scaled and moved to fill clip space
+        float width = (float)viewport[2];
+        float height = (float)viewport[3];
+        float centerX = 2.0f*(floorf(picking.position.x) + 0.5f)/width - 1.0f;
+        float centerY = 1.0f - 2.0f*(floorf(picking.position.y) + 0.5f)/height;
+        Matrix matPick = MatrixMultiply(MatrixScale(width, height, 1.0f), MatrixTranslate(-centerX*width, -centerY*height, 0.0f));
+
+        rlDrawRenderBatchActive();
+        rlEnableFramebuffer(picking.fboId);
+        rlViewport(0, 0, 1, 1);
+        rlClearFramebufferIds();
+        rlEnableShader(pickingShader.id);
+
+        Material material = { .shader = pickingShader };
+        Frustum frustum = { 0 };
+        QueuedDraw *previous = NULL;
+
+        for (int i = 0; i < renderQueue.count; i++)
+        {
+            QueuedDraw *draw = &renderQueue.draws[i];
+            if (draw->pickId == 0) continue;
 
-                mesh.normals[nCounter + i] = vN.x;
-                mesh.normals[nCounter + i + 1] = vN.y;
-                mesh.normals[nCounter + i + 2] = vN.z;
+            Matrix matProjection = MatrixMultiply(draw->matProjection, matPick);
 
-                mesh.normals[nCounter + i + 3] = vN.x;
-                mesh.normals[nCounter + i + 4] = vN.y;
-                mesh.normals[nCounter + i + 5] = vN.z;
+            // Pick frustum only changes with camera
+            if ((previous == NULL) || (memcmp(&draw->matView, &previous->matView, sizeof(Matrix)) != 0) ||
+                (memcmp(&draw->matProjection, &previous->matProjection, sizeof(Matrix)) != 0)) frustum = GetMatrixFrustum(MatrixMultiply(draw->matView, matProjection));
 
-                mesh.normals[nCounter + i + 6] = vN.x;
-                mesh.normals[nCounter + i + 7] = vN.y;
-                mesh.normals[nCounter + i + 8] = vN.z;
-            }
+            previous = draw;
 
-            nCounter += 18;     // 6 vertex, 18 floats
-            trisCounter += 2;
+            if (!CheckFrustumMesh(frustum, draw->mesh, draw->matModel)) continue;
+
+            rlSetUniform(pickingIdLoc, &draw->pickId, SHADER_UNIFORM_INT, 1);
+            DrawMeshGeometry(draw->mesh, material, draw->transform, draw->matModel, draw->matView, matProjection);
         }
-    }
 
-    UnloadImageColors(pixels);  // Unload pixels color data
+        rlReadFramebufferIdsToBuffer(picking.pixelBufferId, 0, 0, 1, 1);
+        picking.fence = rlInsertFence();
+        picking.pending = true;
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+        // Disable all possible vertex array objects (or VBOs)
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableVertexBufferElement();
+        rlDisableShader();
 
-    return mesh;
+        rlEnableFramebuffer(framebuffer);
+        rlViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    }
+
+    RL_PROFILE_ZONE_END(zone);
 }
+#endif
 
-// Generate a cubes mesh from pixel data
-// NOTE: Vertex data is uploaded to GPU
-Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
+#if defined(OCCLUSION_CULLING_SUPPORTED)
+// Test mesh draw with previous frame occlusion query result and issue a new bounding box query
+// NOTE: Draws are only tested from their second frame with same mesh and world transform (moving draws are never tested),
+// occluded draws are drawn with conditional rendering on the new query if supported, skipped otherwise
+static int TestOcclusionMesh(Mesh mesh, Matrix matModel, Matrix matView, Matrix matProjection)
 {
-    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+    if (!occlusion.enabled || (mesh.triangleCount < OCCLUSION_MIN_TRIANGLES) ||
+        !IsMeshBoundsCached(mesh) || (mesh.boneMatrices != NULL)) return OCCLUSION_DRAW;
 
-    Mesh mesh = { 0 };
+    // Bounding box as transformed unit box, padded to avoid degenerated boxes on flat meshes
+    Vector3 size = Vector3Subtract(mesh.boundsMax, mesh.boundsMin);
+    float padding = fmaxf(size.x, fmaxf(size.y, size.z))*0.01f + EPSILON;
+    Matrix matBox = MatrixMultiply(MatrixMultiply(MatrixScale(size.x + 2.0f*padding, size.y + 2.0f*padding, size.z + 2.0f*padding),
+        MatrixTranslate(mesh.boundsMin.x - padding, mesh.boundsMin.y - padding, mesh.boundsMin.z - padding)), matModel);
 
-    Color *pixels = LoadImageColors(cubicmap);
+    // Boxes crossing near plane are always visible, their proxy would be clipped
+    // NOTE: Near plane distance is extracted from perspective or orthographic projection matrix
+    Matrix matBoxView = MatrixMultiply(matBox, matView);
+    float nearPlane = (matProjection.m11 != 0.0f)? matProjection.m14/(matProjection.m10 - 1.0f) : (matProjection.m14 + 1.0f)/matProjection.m10;
 
-    int mapWidth = cubicmap.width;
-    int mapHeight = cubicmap.height;
+    for (int i = 0; i < 8; i++)
+    {
+        Vector3 corner = Vector3Transform((Vector3){ (float)(i & 1), (float)((i >> 1) & 1), (float)((i >> 2) & 1) }, matBoxView);
+        if (corner.z > -nearPlane) return OCCLUSION_DRAW;
+    }
 
-    // NOTE: Max possible number of triangles numCubes*(12 triangles by cube)
-    int maxTriangles = cubicmap.width*cubicmap.height*12;
+    // Draw identifier, mesh buffers and world transform hash (FNV-1a)
+    unsigned long long key = 14695981039346656037ULL;
+    unsigned long long meshId = (mesh.vaoId > 0)? mesh.vaoId : ((mesh.vboId != NULL)? mesh.vboId[0] : (unsigned long long)(size_t)mesh.vertices);
+    for (int i = 0; i < (int)sizeof(meshId); i++) key = (key ^ ((unsigned char *)&meshId)[i])*1099511628211ULL;
+    for (int i = 0; i < (int)sizeof(Matrix); i++) key = (key ^ ((unsigned char *)&matModel)[i])*1099511628211ULL;
 
-    int vCounter = 0;       // Used to count vertices
-    int tcCounter = 0;      // Used to count texcoords
-    int nCounter = 0;       // Used to count normals
+    bool created = false;
+    OcclusionEntry *entry = GetOcclusionEntry(key, &created);
 
-    float w = cubeSize.x;
-    float h = cubeSize.z;
-    float h2 = cubeSize.y;
+    // Draws already tested on current frame (i.e. another view) are not tested again
+    if ((entry == NULL) || created || (entry->frame == occlusion.frame))
+    {
+        if (entry != NULL) entry->frame = occlusion.frame;
+        return OCCLUSION_DRAW;
+    }
 
-    Vector3 *mapVertices = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
-    Vector2 *mapTexcoords = (Vector2 *)RL_MALLOC(maxTriangles*3*sizeof(Vector2));
-    Vector3 *mapNormals = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
+    entry->frame = occlusion.frame;
 
-    // Define the 6 normals of the cube, we will combine them accordingly later...
-    Vector3 n1 = { 1.0f, 0.0f, 0.0f };
-    Vector3 n2 = { -1.0f, 0.0f, 0.0f };
-    Vector3 n3 = { 0.0f, 1.0f, 0.0f };
-    Vector3 n4 = { 0.0f, -1.0f, 0.0f };
-    Vector3 n5 = { 0.0f, 0.0f, -1.0f };
-    Vector3 n6 = { 0.0f, 0.0f, 1.0f };
+    // Query result is read without waiting, issued queries are usually available next frame
+    if (entry->pending)
+    {
+        int result = rlGetOcclusionQueryResult(entry->query);
 
-    // NOTE: We use texture rectangles to define different textures for top-bottom-front-back-right-left (6)
-    typedef struct RectangleF {
-        float x;
-        float y;
-        float width;
-        float height;
-    } RectangleF;
+        if (result >= 0)
+        {
+            entry->visible = (result == 1);
+            entry->pending = false;
+        }
+    }
 
-    RectangleF rightTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
-    RectangleF leftTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
-    RectangleF frontTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
-    RectangleF backTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
-    RectangleF topTexUV = { 0.0f, 0.5f, 0.5f, 0.5f };
-    RectangleF bottomTexUV = { 0.5f, 0.5f, 0.5f, 0.5f };
+    int flags = 0;
 
-    for (int z = 0; z < mapHeight; ++z)
+    if (!entry->pending)
     {
-        for (int x = 0; x < mapWidth; ++x)
-        {
-            // Define the 8 vertex of the cube, we will combine them accordingly later...
-            Vector3 v1 = { w*(x - 0.5f), h2, h*(z - 0.5f) };
-            Vector3 v2 = { w*(x - 0.5f), h2, h*(z + 0.5f) };
-            Vector3 v3 = { w*(x + 0.5f), h2, h*(z + 0.5f) };
-            Vector3 v4 = { w*(x + 0.5f), h2, h*(z - 0.5f) };
-            Vector3 v5 = { w*(x + 0.5f), 0, h*(z - 0.5f) };
-            Vector3 v6 = { w*(x - 0.5f), 0, h*(z - 0.5f) };
-            Vector3 v7 = { w*(x - 0.5f), 0, h*(z + 0.5f) };
-            Vector3 v8 = { w*(x + 0.5f), 0, h*(z + 0.5f) };
+        DrawOcclusionProxy(entry->query, matBox, matView, matProjection);
+        entry->pending = true;
+        flags |= OCCLUSION_QUERIED;
+    }
 
-            // We check pixel color to be WHITE -> draw full cube
-            if (COLOR_EQUAL(pixels[z*cubicmap.width + x], WHITE))
-            {
-                // Define triangles and checking collateral cubes
-                //------------------------------------------------
-
-                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
-                // WARNING: Not required for a WHITE cubes, created to allow seeing the map from outside
-                mapVertices[vCounter] = v1;
-                mapVertices[vCounter + 1] = v2;
-                mapVertices[vCounter + 2] = v3;
-                mapVertices[vCounter + 3] = v1;
-                mapVertices[vCounter + 4] = v3;
-                mapVertices[vCounter + 5] = v4;
-                vCounter += 6;
+    if (entry->visible) flags |= OCCLUSION_DRAW;
+    else
+    {
+        // GPU skips conditional draws if latest query samples did not pass depth test, no popping on disocclusion
+        if (rlBeginConditionalRender(entry->query)) flags |= (OCCLUSION_DRAW | OCCLUSION_CONDITIONAL);
+        occlusion.culled++;
+    }
 
-                mapNormals[nCounter] = n3;
-                mapNormals[nCounter + 1] = n3;
-                mapNormals[nCounter + 2] = n3;
-                mapNormals[nCounter + 3] = n3;
-                mapNormals[nCounter + 4] = n3;
-                mapNormals[nCounter + 5] = n3;
-                nCounter += 6;
+    return flags;
+}
 
-                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
-                tcCounter += 6;
+// Get occlusion tested draw entry, created if not found
+// NOTE: Created entries reuse queries left by evicted entries
+static OcclusionEntry *GetOcclusionEntry(unsigned long long key, bool *created)
+{
+    int bucket = (int)(key & (OCCLUSION_HASH_BUCKETS - 1));
 
-                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
-                mapVertices[vCounter] = v6;
-                mapVertices[vCounter + 1] = v8;
-                mapVertices[vCounter + 2] = v7;
-                mapVertices[vCounter + 3] = v6;
-                mapVertices[vCounter + 4] = v5;
-                mapVertices[vCounter + 5] = v8;
-                vCounter += 6;
+    for (int i = occlusion.buckets[bucket]; i > 0; i = occlusion.entries[i - 1].next)
+    {
+        if (occlusion.entries[i - 1].key == key) return &occlusion.entries[i - 1];
+    }
 
-                mapNormals[nCounter] = n4;
-                mapNormals[nCounter + 1] = n4;
-                mapNormals[nCounter + 2] = n4;
-                mapNormals[nCounter + 3] = n4;
-                mapNormals[nCounter + 4] = n4;
-                mapNormals[nCounter + 5] = n4;
-                nCounter += 6;
+    if (occlusion.count >= occlusion.capacity)
+    {
+        int capacity = (occlusion.capacity > 0)? 2*occlusion.capacity : 256;
+        OcclusionEntry *entries = (OcclusionEntry *)RL_REALLOC(occlusion.entries, capacity*sizeof(OcclusionEntry));
+        if (entries == NULL) return NULL;
 
-                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
-                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                tcCounter += 6;
+        memset(entries + occlusion.capacity, 0, (capacity - occlusion.capacity)*sizeof(OcclusionEntry));
+        occlusion.entries = entries;
+        occlusion.capacity = capacity;
+    }
 
-                // Checking cube on bottom of current cube
-                if (((z < cubicmap.height - 1) && COLOR_EQUAL(pixels[(z + 1)*cubicmap.width + x], BLACK)) || (z == cubicmap.height - 1))
-                {
-                    // Define front triangles (2 tris, 6 vertex) --> v2 v7 v3, v3 v7 v8
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v2;
-                    mapVertices[vCounter + 1] = v7;
-                    mapVertices[vCounter + 2] = v3;
-                    mapVertices[vCounter + 3] = v3;
-                    mapVertices[vCounter + 4] = v7;
-                    mapVertices[vCounter + 5] = v8;
-                    vCounter += 6;
+    OcclusionEntry *entry = &occlusion.entries[occlusion.count];
+    if (entry->query == 0) entry->query = rlLoadOcclusionQuery();
+    if (entry->query == 0) return NULL;
 
-                    mapNormals[nCounter] = n6;
-                    mapNormals[nCounter + 1] = n6;
-                    mapNormals[nCounter + 2] = n6;
-                    mapNormals[nCounter + 3] = n6;
-                    mapNormals[nCounter + 4] = n6;
-                    mapNormals[nCounter + 5] = n6;
-                    nCounter += 6;
+    entry->key = key;
+    entry->frame = occlusion.frame;
+    entry->pending = false;
+    entry->visible = true;
+    entry->next = occlusion.buckets[bucket];
 
-                    mapTexcoords[tcCounter] = (Vector2){ frontTexUV.x, frontTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y + frontTexUV.height };
-                    tcCounter += 6;
-                }
+    occlusion.count++;
+    occlusion.buckets[bucket] = occlusion.count;
+    *created = true;
 
-                // Checking cube on top of current cube
-                if (((z > 0) && COLOR_EQUAL(pixels[(z - 1)*cubicmap.width + x], BLACK)) || (z == 0))
-                {
-                    // Define back triangles (2 tris, 6 vertex) --> v1 v5 v6, v1 v4 v5
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v1;
-                    mapVertices[vCounter + 1] = v5;
-                    mapVertices[vCounter + 2] = v6;
-                    mapVertices[vCounter + 3] = v1;
-                    mapVertices[vCounter + 4] = v4;
-                    mapVertices[vCounter + 5] = v5;
-                    vCounter += 6;
+    return entry;
+}
 
-                    mapNormals[nCounter] = n5;
-                    mapNormals[nCounter + 1] = n5;
-                    mapNormals[nCounter + 2] = n5;
-                    mapNormals[nCounter + 3] = n5;
-                    mapNormals[nCounter + 4] = n5;
-                    mapNormals[nCounter + 5] = n5;
-                    nCounter += 6;
+// Draw unit box proxy into occlusion query, color and depth writes are disabled
+// NOTE: Proxy is drawn with default shader, it leaves it enabled
+static void DrawOcclusionProxy(unsigned int query, Matrix matBox, Matrix matView, Matrix matProjection)
+{
+    if (occlusion.proxy.vboId == NULL)
+    {
+        // Unit box, 8 corners and 12 triangles (counter-clockwise from outside)
+        static const unsigned short indices[36] = {
+            0, 4, 6, 0, 6, 2,   1, 3, 7, 1, 7, 5,   0, 1, 5, 0, 5, 4,
+            2, 6, 7, 2, 7, 3,   0, 2, 3, 0, 3, 1,   4, 5, 7, 4, 7, 6
+        };
 
-                    mapTexcoords[tcCounter] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y + backTexUV.height };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ backTexUV.x, backTexUV.y };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
-                    tcCounter += 6;
-                }
+        Mesh proxy = { 0 };
+        proxy.vertexCount = 8;
+        proxy.triangleCount = 12;
+        proxy.vertices = (float *)RL_MALLOC(8*3*sizeof(float));
+        proxy.texcoords = (float *)RL_CALLOC(8*2, sizeof(float));
+        proxy.indices = (unsigned short *)RL_MALLOC(sizeof(indices));
+        memcpy(proxy.indices, indices, sizeof(indices));
 
-                // Checking cube on right of current cube
-                if (((x < cubicmap.width - 1) && COLOR_EQUAL(pixels[z*cubicmap.width + (x + 1)], BLACK)) || (x == cubicmap.width - 1))
-                {
-                    // Define right triangles (2 tris, 6 vertex) --> v3 v8 v4, v4 v8 v5
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v3;
-                    mapVertices[vCounter + 1] = v8;
-                    mapVertices[vCounter + 2] = v4;
-                    mapVertices[vCounter + 3] = v4;
-                    mapVertices[vCounter + 4] = v8;
-                    mapVertices[vCounter + 5] = v5;
-                    vCounter += 6;
+        for (int i = 0; i < 8; i++)
+        {
+            proxy.vertices[i*3] = (float)(i & 1);
+            proxy.vertices[i*3 + 1] = (float)((i >> 1) & 1);
+            proxy.vertices[i*3 + 2] = (float)((i >> 2) & 1);
+        }
 
-                    mapNormals[nCounter] = n1;
-                    mapNormals[nCounter + 1] = n1;
-                    mapNormals[nCounter + 2] = n1;
-                    mapNormals[nCounter + 3] = n1;
-                    mapNormals[nCounter + 4] = n1;
-                    mapNormals[nCounter + 5] = n1;
-                    nCounter += 6;
+        UploadMesh(&proxy, false);
+        occlusion.proxy = proxy;
+    }
 
-                    mapTexcoords[tcCounter] = (Vector2){ rightTexUV.x, rightTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y + rightTexUV.height };
-                    tcCounter += 6;
-                }
+    Material material = { 0 };
+    material.shader.id = rlGetShaderIdDefault();
+    material.shader.locs = rlGetShaderLocsDefault();
 
-                // Checking cube on left of current cube
-                if (((x > 0) && COLOR_EQUAL(pixels[z*cubicmap.width + (x - 1)], BLACK)) || (x == 0))
-                {
-                    // Define left triangles (2 tris, 6 vertex) --> v1 v7 v2, v1 v6 v7
-                    // NOTE: Collateral occluded faces are not generated
-                    mapVertices[vCounter] = v1;
-                    mapVertices[vCounter + 1] = v7;
-                    mapVertices[vCounter + 2] = v2;
-                    mapVertices[vCounter + 3] = v1;
-                    mapVertices[vCounter + 4] = v6;
-                    mapVertices[vCounter + 5] = v7;
-                    vCounter += 6;
+    rlDisableColorMask();
+    rlDisableDepthMask();
+    rlBeginOcclusionQuery(query);
 
-                    mapNormals[nCounter] = n2;
-                    mapNormals[nCounter + 1] = n2;
-                    mapNormals[nCounter + 2] = n2;
-                    mapNormals[nCounter + 3] = n2;
-                    mapNormals[nCounter + 4] = n2;
-                    mapNormals[nCounter + 5] = n2;
-                    nCounter += 6;
+    SetMeshShaderState(material.shader, matView, matProjection);
+    DrawMeshGeometry(occlusion.proxy, material, matBox, matBox, matView, matProjection);
 
-                    mapTexcoords[tcCounter] = (Vector2){ leftTexUV.x, leftTexUV.y };
-                    mapTexcoords[tcCounter + 1] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
-                    mapTexcoords[tcCounter + 2] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y };
-                    mapTexcoords[tcCounter + 3] = (Vector2){ leftTexUV.x, leftTexUV.y };
-                    mapTexcoords[tcCounter + 4] = (Vector2){ leftTexUV.x, leftTexUV.y + leftTexUV.height };
-                    mapTexcoords[tcCounter + 5] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
-                    tcCounter += 6;
-                }
-            }
-            // We check pixel color to be BLACK, we will only draw floor and roof
-            else if (COLOR_EQUAL(pixels[z*cubicmap.width + x], BLACK))
-            {
-                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
-                mapVertices[vCounter] = v1;
-                mapVertices[vCounter + 1] = v3;
-                mapVertices[vCounter + 2] = v2;
-                mapVertices[vCounter + 3] = v1;
-                mapVertices[vCounter + 4] = v4;
-                mapVertices[vCounter + 5] = v3;
-                vCounter += 6;
+    rlEndOcclusionQuery();
+    rlEnableDepthMask();
+    rlEnableColorMask();
 
-                mapNormals[nCounter] = n4;
-                mapNormals[nCounter + 1] = n4;
-                mapNormals[nCounter + 2] = n4;
-                mapNormals[nCounter + 3] = n4;
-                mapNormals[nCounter + 4] = n4;
-                mapNormals[nCounter + 5] = n4;
-                nCounter += 6;
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+}
 
-                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
-                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
-                tcCounter += 6;
+// Advance occlusion culling frame and evict draws not tested recently
+// NOTE: Called by EndDrawing(), evicted entries are moved after tested draws keeping their queries
+extern void UpdateOcclusionCulling(void)
+{
+    occlusion.lastCulled = occlusion.culled;
+    occlusion.culled = 0;
+    occlusion.frame++;
 
-                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
-                mapVertices[vCounter] = v6;
-                mapVertices[vCounter + 1] = v7;
-                mapVertices[vCounter + 2] = v8;
-                mapVertices[vCounter + 3] = v6;
-                mapVertices[vCounter + 4] = v8;
-                mapVertices[vCounter + 5] = v5;
-                vCounter += 6;
+    int count = 0;
 
-                mapNormals[nCounter] = n3;
-                mapNormals[nCounter + 1] = n3;
-                mapNormals[nCounter + 2] = n3;
-                mapNormals[nCounter + 3] = n3;
-                mapNormals[nCounter + 4] = n3;
-                mapNormals[nCounter + 5] = n3;
-                nCounter += 6;
+    for (int i = 0; i < occlusion.count; i++)
+    {
+        if ((occlusion.frame - occlusion.entries[i].frame) > OCCLUSION_ENTRY_FRAMES) continue;
 
-                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
-                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
-                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
-                tcCounter += 6;
-            }
-        }
+        OcclusionEntry entry = occlusion.entries[count];
+        occlusion.entries[count] = occlusion.entries[i];
+        occlusion.entries[i] = entry;
+        count++;
     }
 
-    // Move data from mapVertices temp arays to vertices float array
-    mesh.vertexCount = vCounter;
-    mesh.triangleCount = vCounter/3;
-
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.colors = NULL;
+    if (count == occlusion.count) return;
 
-    int fCounter = 0;
+    // Rebuild hash buckets chains for kept entries
+    occlusion.count = count;
+    memset(occlusion.buckets, 0, sizeof(occlusion.buckets));
 
-    // Move vertices data
-    for (int i = 0; i < vCounter; i++)
+    for (int i = 0; i < occlusion.count; i++)
     {
-        mesh.vertices[fCounter] = mapVertices[i].x;
-        mesh.vertices[fCounter + 1] = mapVertices[i].y;
-        mesh.vertices[fCounter + 2] = mapVertices[i].z;
-        fCounter += 3;
+        int bucket = (int)(occlusion.entries[i].key & (OCCLUSION_HASH_BUCKETS - 1));
+        occlusion.entries[i].next = occlusion.buckets[bucket];
+        occlusion.buckets[bucket] = i + 1;
     }
+}
 
-    fCounter = 0;
+// Unload occlusion queries (including evicted entries ones) and proxy mesh
+static void UnloadOcclusionCulling(void)
+{
+    for (int i = 0; i < occlusion.capacity; i++) rlUnloadOcclusionQuery(occlusion.entries[i].query);
+    RL_FREE(occlusion.entries);
 
-    // Move normals data
-    for (int i = 0; i < nCounter; i++)
-    {
-        mesh.normals[fCounter] = mapNormals[i].x;
-        mesh.normals[fCounter + 1] = mapNormals[i].y;
-        mesh.normals[fCounter + 2] = mapNormals[i].z;
-        fCounter += 3;
-    }
+    if (occlusion.proxy.vboId != NULL) UnloadMesh(occlusion.proxy);
 
-    fCounter = 0;
+    memset(&occlusion, 0, sizeof(occlusion));
+}
+#endif
 
-    // Move texcoords data
-    for (int i = 0; i < tcCounter; i++)
+#if defined(SUPPORT_GPU_CULLING) && defined(GRAPHICS_API_OPENGL_43)
+#define CULLING_STRINGIFY_(x)   #x
+#define CULLING_STRINGIFY(x)    CULLING_STRINGIFY_(x)
+
+// Load built-in instances culling compute shader
+// NOTE: Mirrors CPU culling (CheckFrustumMesh()): mesh bounding sphere scaled by instance largest axis scale,
+// visible instances data is appended to visible buffers and counted on indirect command instances field
+static void LoadShaderCulling(void)
+{
+    const char *cullingCShaderCode =
+    "#version 430                       \n"
+    "layout(local_size_x = " CULLING_STRINGIFY(GPU_CULLING_WORKGROUP_SIZE) ") in; \n"
+    "layout(std430, binding = 0) readonly buffer Transforms { mat4 transforms[]; }; \n"
+    "layout(std430, binding = 1) readonly buffer Colors { uint colors[]; }; \n"
+    "layout(std430, binding = 2) readonly buffer Custom { vec4 custom[]; }; \n"
+    "layout(std430, binding = 3) writeonly buffer VisibleTransforms { mat4 visibleTransforms[]; }; \n"
+    "layout(std430, binding = 4) writeonly buffer VisibleColors { uint visibleColors[]; }; \n"
+    "layout(std430, binding = 5) writeonly buffer VisibleCustom { vec4 visibleCustom[]; }; \n"
+    "layout(std430, binding = 6) buffer Command { uint command[5]; }; \n"
+    "uniform vec4 planes[6];            \n"
+    "uniform vec4 bounds;               \n"     // Mesh bounding sphere: center (object space) and radius
+    "uniform mat4 matTransform;         \n"
+    "uniform mat4 matDequantize;        \n"
+    "uniform ivec2 instances;           \n"     // Instances count and streams available (1: colors, 2: custom)
+    "void main()                        \n"
+    "{                                  \n"
+    "    uint i = gl_GlobalInvocationID.x; \n"
+    "    if (i >= uint(instances.x)) return; \n"
+    "    if (bounds.w > 0.0)            \n"
+    "    {                              \n"
+    "        mat4 world = matTransform*transforms[i]; \n"
+    "        vec3 center = (world*vec4(bounds.xyz, 1.0)).xyz; \n"
+    "        float scale = max(dot(world[0].xyz, world[0].xyz), max(dot(world[1].xyz, world[1].xyz), dot(world[2].xyz, world[2].xyz))); \n"
+    "        float radius = bounds.w*sqrt(scale); \n"
+    "        for (int p = 0; p < 6; p++) if ((dot(planes[p].xyz, center) + planes[p].w) < -radius) return; \n"
+    "    }                              \n"
+    "    uint slot = atomicAdd(command[1], 1u); \n"
+    "    visibleTransforms[slot] = transforms[i]*matDequantize; \n"
+    "    if ((instances.y & 1) != 0) visibleColors[slot] = colors[i]; \n"
+    "    if ((instances.y & 2) != 0) visibleCustom[slot] = custom[i]; \n"
+    "}                                  \n";
+
+    gpuCulling.loaded = true;
+
+    unsigned int shaderId = rlCompileShader(cullingCShaderCode, RL_COMPUTE_SHADER);
+    if (shaderId > 0) gpuCulling.program = rlLoadComputeShaderProgram(shaderId);
+
+    if (gpuCulling.program > 0)
     {
-        mesh.texcoords[fCounter] = mapTexcoords[i].x;
-        mesh.texcoords[fCounter + 1] = mapTexcoords[i].y;
-        fCounter += 2;
+        const char *names[5] = { "planes", "bounds", "matTransform", "matDequantize", "instances" };
+        for (int i = 0; i < 5; i++) gpuCulling.locs[i] = rlGetLocationUniform(gpuCulling.program, names[i]);
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Instances culling compute shader loaded successfully", gpuCulling.program);
     }
+    else TRACELOG(LOG_WARNING, "SHADER: Failed to load instances culling compute shader, instances culled on CPU");
+}
+#endif
 
-    RL_FREE(mapVertices);
-    RL_FREE(mapNormals);
-    RL_FREE(mapTexcoords);
+#if defined(SKINNING_CACHE_SUPPORTED)
+#define SKINNING_STRINGIFY_(x)  #x
+#define SKINNING_STRINGIFY(x)   SKINNING_STRINGIFY_(x)
 
-    UnloadImageColors(pixels);   // Unload pixels color data
+// Load built-in skinning cache compute shader
+// NOTE: Mirrors skinning vertex shader (LoadShaderSkinning()), positions and normals are skinned in object space,
+// skinned vertices buffer stores positions (XYZ) followed by normals (XYZ), read as regular vertex attributes
+static void LoadShaderSkinningCache(void)
+{
+    const char *skinningCShaderCode =
+    "#version 430                       \n"
+    "layout(local_size_x = " SKINNING_STRINGIFY(SKINNING_CACHE_WORKGROUP_SIZE) ") in; \n"
+    "layout(std430, binding = 0) readonly buffer Positions { float positions[]; }; \n"
+    "layout(std430, binding = 1) readonly buffer Normals { float normals[]; }; \n"
+    "layout(std430, binding = 2) readonly buffer BoneIds { uint boneIds[]; }; \n"
+    "layout(std430, binding = 3) readonly buffer BoneWeights { vec4 boneWeights[]; }; \n"
+    "layout(std430, binding = 4) readonly buffer Bones { mat4 bones[]; }; \n"
+    "layout(std430, binding = 5) writeonly buffer Skinned { float skinned[]; }; \n"
+    "uniform ivec2 counts;              \n"     // Vertices count and normals available
+    "void main()                        \n"
+    "{                                  \n"
+    "    uint i = gl_GlobalInvocationID.x; \n"
+    "    if (i >= uint(counts.x)) return; \n"
+    "    uint ids = boneIds[i];         \n"     // Bone ids packed as 4 unsigned bytes
+    "    vec4 weights = boneWeights[i]; \n"
+    "    mat4 skin = weights.x*bones[ids & 255u] + weights.y*bones[(ids >> 8) & 255u] + \n"
+    "                weights.z*bones[(ids >> 16) & 255u] + weights.w*bones[ids >> 24]; \n"
+    "    vec3 position = (skin*vec4(positions[i*3u], positions[i*3u + 1u], positions[i*3u + 2u], 1.0)).xyz; \n"
+    "    skinned[i*3u] = position.x; skinned[i*3u + 1u] = position.y; skinned[i*3u + 2u] = position.z; \n"
+    "    if (counts.y != 0)             \n"
+    "    {                              \n"
+    "        vec3 normal = normalize((skin*vec4(normals[i*3u], normals[i*3u + 1u], normals[i*3u + 2u], 0.0)).xyz); \n"
+    "        uint offset = uint(counts.x)*3u + i*3u; \n"
+    "        skinned[offset] = normal.x; skinned[offset + 1u] = normal.y; skinned[offset + 2u] = normal.z; \n"
+    "    }                              \n"
+    "}                                  \n";
+
+    skinningCache.loaded = true;
+
+    unsigned int shaderId = rlCompileShader(skinningCShaderCode, RL_COMPUTE_SHADER);
+    if (shaderId > 0) skinningCache.program = rlLoadComputeShaderProgram(shaderId);
+
+    if (skinningCache.program > 0)
+    {
+        skinningCache.countsLoc = rlGetLocationUniform(skinningCache.program, "counts");
 
-    // Upload vertex data to GPU (static mesh)
-    UploadMesh(&mesh, false);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Skinning cache compute shader loaded successfully", skinningCache.program);
+    }
+    else TRACELOG(LOG_WARNING, "SHADER: Failed to load skinning cache compute shader, meshes skinned on every draw");
+}
 
-    return mesh;
+// Check if mesh draws read skinned vertices from skinning cache
+// NOTE: Interleaved, quantized and GPU morphed meshes are skinned by vertex shader on every draw
+static bool IsSkinningCacheAvailable(Mesh mesh)
+{
+    if ((mesh.boneMatrices == NULL) || (mesh.boneCount <= 0) || (mesh.vboId == NULL) || (mesh.vboId[0] == 0) || (mesh.vboId[7] == 0) || (mesh.vboId[8] == 0)) return false;
+    if ((mesh.vertexStride > 0) || (mesh.morphTextureId != 0) || (mesh.quantization & (MESH_QUANTIZE_POSITION | MESH_QUANTIZE_NORMAL))) return false;
+
+    if (!skinningCache.loaded) LoadShaderSkinningCache();
+
+    return (skinningCache.program > 0) && !rlIsCommandListRecording();
 }
-#endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox GetMeshBoundingBox(Mesh mesh)
+// Get mesh skinned vertices buffer for its current bones matrices
+// NOTE: Mesh is skinned once per frame and bones pose, later draws (shadow maps, picking, main pass) reuse the buffer,
+// meshes shared by several models get one entry per pose
+static unsigned int GetSkinningCacheBuffer(Mesh mesh)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+    SkinningCacheEntry *entry = NULL;
 
-    if (mesh.vertices != NULL)
+    for (int i = 0; i < skinningCache.count; i++)
     {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        SkinningCacheEntry *current = &skinningCache.entries[i];
+        if ((current->meshId != mesh.vboId[0]) || (current->vertexCount != mesh.vertexCount)) continue;
 
-        for (int i = 1; i < mesh.vertexCount; i++)
+        if ((current->boneCount == mesh.boneCount) && (memcmp(current->bones, mesh.boneMatrices, mesh.boneCount*sizeof(Matrix)) == 0))
         {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            current->frame = skinningCache.frame;
+            return current->bufferId;
         }
+
+        // Entries not drawn this frame are skinned again with new pose
+        if ((entry == NULL) && (current->frame != skinningCache.frame)) entry = current;
     }
 
-    // Create the bounding box
-    BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+    if (entry == NULL)
+    {
+        if (skinningCache.count == skinningCache.capacity)
+        {
+            int capacity = (skinningCache.capacity > 0)? skinningCache.capacity*2 : 16;
+            SkinningCacheEntry *entries = (SkinningCacheEntry *)RL_REALLOC(skinningCache.entries, capacity*sizeof(SkinningCacheEntry));
+            if (entries == NULL) return 0;
 
-    return box;
-}
+            skinningCache.entries = entries;
+            skinningCache.capacity = capacity;
+        }
 
-// Compute mesh tangents
-// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
-// Implementation base don: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
-void GenMeshTangents(Mesh *mesh)
-{
-    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    else
+        unsigned int bufferId = rlLoadShaderBuffer((unsigned long long)mesh.vertexCount*6*sizeof(float), NULL, RL_DYNAMIC_COPY);
+        if (bufferId == 0) return 0;
+
+        entry = &skinningCache.entries[skinningCache.count++];
+        *entry = (SkinningCacheEntry){ 0 };
+        entry->meshId = mesh.vboId[0];
+        entry->vertexCount = mesh.vertexCount;
+        entry->bufferId = bufferId;
+    }
+
+    if (entry->boneCount != mesh.boneCount)
     {
-        RL_FREE(mesh->tangents);
-        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+        RL_FREE(entry->bones);
+        entry->bones = (Matrix *)RL_MALLOC(mesh.boneCount*sizeof(Matrix));
+        entry->boneCount = (entry->bones != NULL)? mesh.boneCount : 0;
     }
 
-    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
-    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    if (entry->bones != NULL) memcpy(entry->bones, mesh.boneMatrices, mesh.boneCount*sizeof(Matrix));
+    entry->frame = skinningCache.frame;
 
-    for (int i = 0; i < mesh->vertexCount; i += 3)
+    // Bones matrices buffer grows to largest skeleton, matrices uploaded column-major (same as rlSetUniformMatrices())
+    if (skinningCache.bonesCapacity < mesh.boneCount)
     {
-        // Get triangle vertices
-        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
-        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
-        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
-
-        // Get triangle texcoords
-        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
-        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
-        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+        if (skinningCache.bonesId > 0) rlUnloadShaderBuffer(skinningCache.bonesId);
+        skinningCache.bonesId = rlLoadShaderBuffer((unsigned long long)mesh.boneCount*sizeof(float16), NULL, RL_DYNAMIC_DRAW);
+        skinningCache.bonesCapacity = (skinningCache.bonesId > 0)? mesh.boneCount : 0;
+        if (skinningCache.bonesId == 0) return 0;
+    }
 
-        float x1 = v2.x - v1.x;
-        float y1 = v2.y - v1.y;
-        float z1 = v2.z - v1.z;
-        float x2 = v3.x - v1.x;
-        float y2 = v3.y - v1.y;
-        float z2 = v3.z - v1.z;
+    float16 *bones = (float16 *)RL_MALLOC(mesh.boneCount*sizeof(float16));
+    if (bones == NULL) return 0;
 
-        float s1 = uv2.x - uv1.x;
-        float t1 = uv2.y - uv1.y;
-        float s2 = uv3.x - uv1.x;
-        float t2 = uv3.y - uv1.y;
+    for (int i = 0; i < mesh.boneCount; i++) bones[i] = MatrixToFloatV(mesh.boneMatrices[i]);
+    rlUpdateShaderBufferElements(skinningCache.bonesId, bones, (unsigned long long)mesh.boneCount*sizeof(float16), 0);
+    RL_FREE(bones);
 
-        float div = s1*t2 - s2*t1;
-        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+    int counts[2] = { mesh.vertexCount, (mesh.vboId[2] != 0)? 1 : 0 };
 
-        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
-        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    rlEnableShader(skinningCache.program);
+    rlSetUniform(skinningCache.countsLoc, counts, SHADER_UNIFORM_IVEC2, 1);
 
-        tan1[i + 0] = sdir;
-        tan1[i + 1] = sdir;
-        tan1[i + 2] = sdir;
+    rlBindShaderBuffer(mesh.vboId[0], 0);
+    rlBindShaderBuffer((mesh.vboId[2] != 0)? mesh.vboId[2] : mesh.vboId[0], 1);   // NOTE: Positions bound as unused placeholder
+    rlBindShaderBuffer(mesh.vboId[7], 2);
+    rlBindShaderBuffer(mesh.vboId[8], 3);
+    rlBindShaderBuffer(skinningCache.bonesId, 4);
+    rlBindShaderBuffer(entry->bufferId, 5);
 
-        tan2[i + 0] = tdir;
-        tan2[i + 1] = tdir;
-        tan2[i + 2] = tdir;
-    }
+    rlComputeShaderDispatch((mesh.vertexCount + SKINNING_CACHE_WORKGROUP_SIZE - 1)/SKINNING_CACHE_WORKGROUP_SIZE, 1, 1);
+    rlDisableShader();
 
-    // Compute tangents considering normals
-    for (int i = 0; i < mesh->vertexCount; i++)
-    {
-        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        Vector3 tangent = tan1[i];
+    // Skinned vertices are read as vertex attributes
+    rlShaderBufferBarrier();
 
-        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
-#if defined(COMPUTE_TANGENTS_METHOD_01)
-        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
-        tmp = Vector3Normalize(tmp);
-        mesh->tangents[i*4 + 0] = tmp.x;
-        mesh->tangents[i*4 + 1] = tmp.y;
-        mesh->tangents[i*4 + 2] = tmp.z;
-        mesh->tangents[i*4 + 3] = 1.0f;
-#else
-        Vector3OrthoNormalize(&normal, &tangent);
-        mesh->tangents[i*4 + 0] = tangent.x;
-        mesh->tangents[i*4 + 1] = tangent.y;
-        mesh->tangents[i*4 + 2] = tangent.z;
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-#endif
-    }
+    return entry->bufferId;
+}
 
-    RL_FREE(tan1);
-    RL_FREE(tan2);
+// Release mesh skinning cache buffers
+static void RemoveSkinningCacheEntries(unsigned int meshId)
+{
+    int count = 0;
 
-    if (mesh->vboId != NULL)
+    for (int i = 0; i < skinningCache.count; i++)
     {
-        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
-        {
-            // Upate existing vertex buffer
-            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
-        }
-        else
+        if (skinningCache.entries[i].meshId == meshId)
         {
-            // Load a new tangent attributes buffer
-            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+            rlUnloadShaderBuffer(skinningCache.entries[i].bufferId);
+            RL_FREE(skinningCache.entries[i].bones);
         }
-
-        rlEnableVertexArray(mesh->vaoId);
-        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(4);
-        rlDisableVertexArray();
+        else skinningCache.entries[count++] = skinningCache.entries[i];
     }
 
-    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+    skinningCache.count = count;
 }
+#endif
 
-// Compute mesh binormals (aka bitangent)
-void GenMeshBinormals(Mesh *mesh)
+#if defined(SUPPORT_SKINNING_CACHE) && defined(GRAPHICS_API_OPENGL_43)
+// Advance skinning cache frame and release buffers not drawn recently
+// NOTE: Called by EndDrawing()
+extern void UpdateSkinningCache(void)
 {
-    for (int i = 0; i < mesh->vertexCount; i++)
-    {
-        //Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        //Vector3 tangent = { mesh->tangents[i*4 + 0], mesh->tangents[i*4 + 1], mesh->tangents[i*4 + 2] };
-        //Vector3 binormal = Vector3Scale(Vector3CrossProduct(normal, tangent), mesh->tangents[i*4 + 3]);
+#if defined(SKINNING_CACHE_SUPPORTED)
+    skinningCache.frame++;
 
-        // TODO: Register computed binormal in mesh->binormal?
-    }
-}
+    int count = 0;
 
-// Draw a model (with texture if set)
-void DrawModel(Model model, Vector3 position, float scale, Color tint)
-{
-    Vector3 vScale = { scale, scale, scale };
-    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+    for (int i = 0; i < skinningCache.count; i++)
+    {
+        if ((skinningCache.frame - skinningCache.entries[i].frame) > SKINNING_CACHE_FRAMES)
+        {
+            rlUnloadShaderBuffer(skinningCache.entries[i].bufferId);
+            RL_FREE(skinningCache.entries[i].bones);
+        }
+        else skinningCache.entries[count++] = skinningCache.entries[i];
+    }
 
-    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+    skinningCache.count = count;
+#endif
 }
+#endif
 
-// Draw a model with extended parameters
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+// Unload mesh from memory (RAM and VRAM)
+void UnloadMesh(Mesh mesh)
 {
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
-    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
-
-    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
-
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
-
-    for (int i = 0; i < model.meshCount; i++)
+    // Unload rlgl mesh vboId data, only available if mesh was uploaded
+    if (mesh.vboId != NULL)
     {
-        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
-
-        Color colorTint = WHITE;
-        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
-        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
-        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
-        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
-
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
-        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+        SetMeshBoundsStale(mesh.vboId[0], false);
+#if defined(SKINNING_CACHE_SUPPORTED)
+        if (mesh.vboId[7] != 0) RemoveSkinningCacheEntries(mesh.vboId[0]);
+#endif
+        rlUnloadVertexArray(mesh.vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
     }
-}
+    RL_FREE(mesh.vboId);
 
-// Draw a model wires (with texture if set)
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
-{
-    rlEnableWireMode();
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.tangents);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.indices);
 
-    DrawModel(model, position, scale, tint);
+    RL_FREE(mesh.animVertices);
+    RL_FREE(mesh.animNormals);
+    RL_FREE(mesh.boneWeights);
+    RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
 
-    rlDisableWireMode();
+    if (mesh.morphTextureId != 0) rlUnloadTexture(mesh.morphTextureId);
+    RL_FREE(mesh.morphVertices);
+    RL_FREE(mesh.morphNormals);
+    RL_FREE(mesh.morphWeights);
 }
 
-// Draw a model wires (with texture if set) with extended parameters
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+// Unload mesh vertex attributes kept in CPU memory after upload, mesh is drawn from GPU buffers only
+// NOTE: Positions and indices are kept as collision/picking proxy (GetRayCollisionMesh(), LoadMeshBVH()),
+// bounds are cached on upload; animated meshes (skinned or CPU morphed) update CPU data, so they are not released
+void UnloadMeshCPUData(Mesh *mesh)
 {
-    rlEnableWireMode();
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((mesh->vboId == NULL) || (mesh->vboId[0] == 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to unload mesh CPU data, mesh not uploaded to GPU");
+        return;
+    }
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    if ((mesh->animVertices != NULL) || (mesh->boneIds != NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to unload mesh CPU data, animated mesh vertex data is updated on CPU");
+        return;
+    }
 
-    rlDisableWireMode();
-}
+    int size = 0;
+    if (mesh->texcoords != NULL) size += mesh->vertexCount*2*sizeof(float);
+    if (mesh->texcoords2 != NULL) size += mesh->vertexCount*2*sizeof(float);
+    if (mesh->normals != NULL) size += mesh->vertexCount*3*sizeof(float);
+    if (mesh->tangents != NULL) size += mesh->vertexCount*4*sizeof(float);
+    if (mesh->colors != NULL) size += mesh->vertexCount*4*sizeof(unsigned char);
+
+    RL_FREE(mesh->texcoords);
+    RL_FREE(mesh->texcoords2);
+    RL_FREE(mesh->normals);
+    RL_FREE(mesh->tangents);
+    RL_FREE(mesh->colors);
+    mesh->texcoords = NULL;
+    mesh->texcoords2 = NULL;
+    mesh->normals = NULL;
+    mesh->tangents = NULL;
+    mesh->colors = NULL;
+
+    // Morph targets deltas are fetched from morph texture (GPU morphing), only weights are required
+    if (mesh->morphTextureId != 0)
+    {
+        size += mesh->vertexCount*mesh->morphTargetCount*3*sizeof(float)*((mesh->morphNormals != NULL)? 2 : 1);
 
-// Draw a billboard
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
-{
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+        RL_FREE(mesh->morphVertices);
+        RL_FREE(mesh->morphNormals);
+        mesh->morphVertices = NULL;
+        mesh->morphNormals = NULL;
+    }
 
-    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
+    TRACELOG(LOG_DEBUG, "MESH: Unloaded mesh CPU data (%i bytes), positions and indices kept", size);
+#else
+    TRACELOG(LOG_WARNING, "MESH: Failed to unload mesh CPU data, mesh is drawn from CPU data");
+#endif
 }
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+// Export mesh data to file
+bool ExportMesh(Mesh mesh, const char *fileName)
 {
-    // NOTE: Billboard locked on axis-Y
-    Vector3 up = { 0.0f, 1.0f, 0.0f };
+    bool success = false;
 
-    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
-}
+    if ((mesh.vertices == NULL) || (mesh.texcoords == NULL) || (mesh.normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to export mesh, vertex data not available in CPU memory");
+        return false;
+    }
 
-void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
-{
-    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
-    Vector2 sizeRatio = { size.y, size.x*(float)source.height/source.width };
+    if (IsFileExtension(fileName, ".obj"))
+    {
+        // Estimated data size, it should be enough...
+        int dataSize = mesh.vertexCount*(int)strlen("v 0000.00f 0000.00f 0000.00f") +
+                       mesh.vertexCount*(int)strlen("vt 0.000f 0.00f") +
+                       mesh.vertexCount*(int)strlen("vn 0.000f 0.00f 0.00f") +
+                       mesh.triangleCount*(int)strlen("f 00000/00000/00000 00000/00000/00000 00000/00000/00000");
 
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+        // NOTE: Text data buffer size is estimated considering mesh data size
+        char *txtData = (char *)RL_CALLOC(dataSize*2 + 2000, sizeof(char));
 
-    Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+        int byteCount = 0;
+        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // rMeshOBJ exporter v1.0 - Mesh exported as triangle faces and not optimized   //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // more info and bugs-report:  github.com/raysan5/raylib                        //\n");
+        byteCount += sprintf(txtData + byteCount, "# // feedback and support:       ray[at]raylib.com                                //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# // Copyright (c) 2018-2022 Ramon Santamaria (@raysan5)                          //\n");
+        byteCount += sprintf(txtData + byteCount, "# //                                                                              //\n");
+        byteCount += sprintf(txtData + byteCount, "# //////////////////////////////////////////////////////////////////////////////////\n\n");
+        byteCount += sprintf(txtData + byteCount, "# Vertex Count:     %i\n", mesh.vertexCount);
+        byteCount += sprintf(txtData + byteCount, "# Triangle Count:   %i\n\n", mesh.triangleCount);
 
-    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
-    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+        byteCount += sprintf(txtData + byteCount, "g mesh\n");
 
-    Vector3 p1 = Vector3Add(rightScaled, upScaled);
-    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
+        {
+            byteCount += sprintf(txtData + byteCount, "v %.2f %.2f %.2f\n", mesh.vertices[v], mesh.vertices[v + 1], mesh.vertices[v + 2]);
+        }
 
-    Vector3 topLeft = Vector3Scale(p2, -1);
-    Vector3 topRight = p1;
-    Vector3 bottomRight = p2;
-    Vector3 bottomLeft = Vector3Scale(p1, -1);
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 2)
+        {
+            byteCount += sprintf(txtData + byteCount, "vt %.3f %.3f\n", mesh.texcoords[v], mesh.texcoords[v + 1]);
+        }
 
-    if (rotation != 0.0f)
+        for (int i = 0, v = 0; i < mesh.vertexCount; i++, v += 3)
+        {
+            byteCount += sprintf(txtData + byteCount, "vn %.3f %.3f %.3f\n", mesh.normals[v], mesh.normals[v + 1], mesh.normals[v + 2]);
+        }
+
+        if (mesh.indices != NULL)
+        {
+            for (int i = 0, v = 0; i < mesh.triangleCount; i++, v += 3)
+            {
+                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n",
+                    mesh.indices[v] + 1, mesh.indices[v] + 1, mesh.indices[v] + 1,
+                    mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1, mesh.indices[v + 1] + 1,
+                    mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1, mesh.indices[v + 2] + 1);
+            }
+        }
+        else
+        {
+            for (int i = 0, v = 1; i < mesh.triangleCount; i++, v += 3)
+            {
+                byteCount += sprintf(txtData + byteCount, "f %i/%i/%i %i/%i/%i %i/%i/%i\n", v, v, v, v + 1, v + 1, v + 1, v + 2, v + 2, v + 2);
+            }
+        }
+
+        byteCount += sprintf(txtData + byteCount, "\n");
+
+        // NOTE: Text data length exported is determined by '\0' (NULL) character
+        success = SaveFileText(fileName, txtData);
+
+        RL_FREE(txtData);
+    }
+    else if (IsFileExtension(fileName, ".raw"))
     {
-        float sinRotation = sinf(rotation*DEG2RAD);
-        float cosRotation = cosf(rotation*DEG2RAD);
+        // TODO: Support additional file formats to export mesh vertex data
+    }
 
-        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
-        float rotateAboutX = sizeRatio.x*origin.x/2;
-        float rotateAboutY = sizeRatio.y*origin.y/2;
+    return success;
+}
 
-        float xtvalue, ytvalue;
-        float rotatedX, rotatedY;
+// Load materials from model file
+Material *LoadMaterials(const char *fileName, int *materialCount)
+{
+    Material *materials = NULL;
+    unsigned int count = 0;
 
-        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
-        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+    // TODO: Support IQM and GLTF for materials parsing
 
-        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+#if defined(SUPPORT_FILEFORMAT_MTL)
+    if (IsFileExtension(fileName, ".mtl"))
+    {
+        tinyobj_material_t *mats = NULL;
 
-        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+        int result = tinyobj_parse_mtl_file(&mats, &count, fileName);
+        if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
-        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+        // TODO: Process materials to return
+
+        tinyobj_materials_free(mats, count);
     }
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load material file", fileName);
+#endif
 
-    // Translate points to the draw center (position)
-    topLeft = Vector3Add(topLeft, position);
-    topRight = Vector3Add(topRight, position);
-    bottomRight = Vector3Add(bottomRight, position);
-    bottomLeft = Vector3Add(bottomLeft, position);
+    // Set materials shader to default (DIFFUSE, SPECULAR, NORMAL)
+    if (materials != NULL)
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            materials[i].shader.id = rlGetShaderIdDefault();
+            materials[i].shader.locs = rlGetShaderLocsDefault();
+        }
+    }
 
-    rlCheckRenderBatchLimit(4);
+    *materialCount = count;
+    return materials;
+}
 
-    rlSetTexture(texture.id);
+// Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
+// NOTE: Default shader is replaced on draw by clustered lighting shader for meshes with normals while lights are active
+Material LoadMaterialDefault(void)
+{
+    Material material = { 0 };
+    material.maps = (MaterialMap *)RL_CALLOC(MAX_MATERIAL_MAPS, sizeof(MaterialMap));
 
-    rlBegin(RL_QUADS);
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    // Using rlgl default shader
+    material.shader.id = rlGetShaderIdDefault();
+    material.shader.locs = rlGetShaderLocsDefault();
 
-        // Bottom-left corner for texture and quad
-        rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
-        rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+    // Using rlgl default texture (1x1 pixel, UNCOMPRESSED_R8G8B8A8, 1 mipmap)
+    material.maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    //material.maps[MATERIAL_MAP_NORMAL].texture;         // NOTE: By default, not set
+    //material.maps[MATERIAL_MAP_SPECULAR].texture;       // NOTE: By default, not set
 
-        // Top-left corner for texture and quad
-        rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
-        rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+    material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;    // Diffuse color
+    material.maps[MATERIAL_MAP_SPECULAR].color = WHITE;   // Specular color
 
-        // Top-right corner for texture and quad
-        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
-        rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+    return material;
+}
 
-        // Bottom-right corner for texture and quad
-        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
-        rlVertex3f(topRight.x, topRight.y, topRight.z);
-    rlEnd();
+// Unload material from memory
+void UnloadMaterial(Material material)
+{
+    // Unload material shader (avoid unloading default shader, managed by raylib)
+    if (material.shader.id != rlGetShaderIdDefault()) UnloadShader(material.shader);
 
-    rlSetTexture(0);
+    // Unload loaded texture maps (avoid unloading default texture, managed by raylib)
+    if (material.maps != NULL)
+    {
+        for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+        {
+            if (material.maps[i].texture.id != rlGetTextureIdDefault())
+            {
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+                UnwatchAsset(ASSET_WATCH_TEXTURE, material.maps[i].texture.id, NULL);
+#endif
+                rlUnloadTexture(material.maps[i].texture.id);
+            }
+        }
+    }
+
+    RL_FREE(material.maps);
 }
 
-// Draw a bounding box with wires
-void DrawBoundingBox(BoundingBox box, Color color)
+// Set texture for a material map type (MATERIAL_MAP_DIFFUSE, MATERIAL_MAP_SPECULAR...)
+// NOTE: Previous texture should be manually unloaded
+void SetMaterialTexture(Material *material, int mapType, Texture2D texture)
 {
-    Vector3 size = { 0 };
+    material->maps[mapType].texture = texture;
+}
 
-    size.x = fabsf(box.max.x - box.min.x);
-    size.y = fabsf(box.max.y - box.min.y);
-    size.z = fabsf(box.max.z - box.min.z);
+// Set the material for a mesh
+void SetModelMeshMaterial(Model *model, int meshId, int materialId)
+{
+    if (meshId >= model->meshCount) TRACELOG(LOG_WARNING, "MESH: Id greater than mesh count");
+    else if (materialId >= model->materialCount) TRACELOG(LOG_WARNING, "MATERIAL: Id greater than material count");
+    else  model->meshMaterial[meshId] = materialId;
+}
 
-    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+// Load model animations from file
+ModelAnimation *LoadModelAnimations(const char *fileName, unsigned int *animCount)
+{
+    ModelAnimation *animations = NULL;
 
-    DrawCubeWires(center, size.x, size.y, size.z, color);
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) animations = LoadModelAnimationsIQM(fileName, animCount);
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) animations = LoadModelAnimationsRMDL(fileName, animCount);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    //if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationGLTF(fileName, animCount);
+#endif
+
+    return animations;
 }
 
-// Check collision between two spheres
-bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+// Update model animated vertex data (positions and normals) for a given frame
+// NOTE: Updated data is uploaded to GPU
+void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    bool collision = false;
+    RL_PROFILE_ZONE_BEGIN(zone, "UpdateModelAnimation");
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = center1.x - center2.x;      // X distance between centers
-    float dy = center1.y - center2.y;      // Y distance between centers
-    float dz = center1.z - center2.z;      // Z distance between centers
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && ((anim.framePoses != NULL) || (anim.tracks != NULL)))
+    {
+        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+        // Compute bones transformations once per frame, shared by all meshes
+        if (anim.framePoses != NULL)
+        {
+            if (SetSkinningBones(model, anim.framePoses[frame], NULL)) SkinModelMeshes(model);
+        }
+        else
+        {
+            Transform *transforms = (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform));
+            GetModelAnimationFramePose(anim, frame, transforms);
+
+            if (SetSkinningBones(model, transforms, NULL)) SkinModelMeshes(model);
+
+            RL_FREE(transforms);
+        }
+    }
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Update model animation bones matrices for GPU skinning
+// NOTE: Bones matrices are computed once per frame and shared by all model meshes,
+// vertices are transformed on the vertex shader, falls back to UpdateModelAnimation() if not available
+void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
+{
+#if defined(SUPPORT_GPU_SKINNING)
+    if ((anim.frameCount > 0) && (anim.bones != NULL) && ((anim.framePoses != NULL) || (anim.tracks != NULL)))
+    {
+        if (frame >= anim.frameCount) frame = frame%anim.frameCount;
+
+        Matrix *matrices = (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix));
+        Transform *transforms = NULL;
+
+        if (anim.framePoses != NULL) transforms = anim.framePoses[frame];
+        else
+        {
+            transforms = (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform));
+            GetModelAnimationFramePose(anim, frame, transforms);
+        }
+
+        for (int i = 0; i < model.boneCount; i++) matrices[i] = GetBoneSkinningMatrix(model.bindPose[i], transforms[i], NULL);
+
+        if (!SetModelBoneMatrices(model, matrices)) UpdateModelAnimation(model, anim, frame);
+
+        if (anim.framePoses == NULL) RL_FREE(transforms);
+        RL_FREE(matrices);
+    }
+#else
+    UpdateModelAnimation(model, anim, frame);
+#endif
+}
+
+// Load model pose buffer, initialized to model bind pose
+ModelPose LoadModelPose(Model model)
+{
+    ModelPose pose = { 0 };
+
+    pose.boneCount = model.boneCount;
+    pose.transforms = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+    pose.matrices = (Matrix *)RL_MALLOC(model.boneCount*sizeof(Matrix));
+
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        pose.transforms[i] = model.bindPose[i];
+        pose.matrices[i] = MatrixIdentity();
+    }
+
+    return pose;
+}
+
+// Unload model pose buffer
+void UnloadModelPose(ModelPose pose)
+{
+    RL_FREE(pose.transforms);
+    RL_FREE(pose.matrices);
+}
+
+// Sample model animation pose at fractional frame
+// NOTE: Frames are looped, pose between frames is interpolated (lerp translation/scale, slerp rotation)
+void SampleModelAnimation(ModelPose *pose, ModelAnimation anim, float frame)
+{
+    if ((anim.frameCount <= 0) || ((anim.framePoses == NULL) && (anim.tracks == NULL)) || (anim.boneCount != pose->boneCount)) return;
+
+    frame = fmodf(frame, (float)anim.frameCount);
+    if (frame < 0.0f) frame += (float)anim.frameCount;
+
+    int frameA = (int)frame;
+    int frameB = (frameA + 1)%anim.frameCount;
+    float amount = frame - (float)frameA;
+
+    // Compressed animations frames are decoded on demand
+    Transform *posesA = NULL;
+    Transform *posesB = NULL;
+
+    if (anim.framePoses != NULL)
+    {
+        posesA = anim.framePoses[frameA];
+        posesB = anim.framePoses[frameB];
+    }
+    else
+    {
+        posesA = (Transform *)RL_MALLOC(2*anim.boneCount*sizeof(Transform));
+        posesB = posesA + anim.boneCount;
+        GetModelAnimationFramePose(anim, frameA, posesA);
+        GetModelAnimationFramePose(anim, frameB, posesB);
+    }
+
+    for (int i = 0; i < pose->boneCount; i++)
+    {
+        Transform a = posesA[i];
+        Transform b = posesB[i];
+
+        pose->transforms[i].translation = Vector3Lerp(a.translation, b.translation, amount);
+        pose->transforms[i].rotation = QuaternionSlerp(a.rotation, b.rotation, amount);
+        pose->transforms[i].scale = Vector3Lerp(a.scale, b.scale, amount);
+    }
+
+    if (anim.framePoses == NULL) RL_FREE(posesA);
+}
+
+// Blend several model poses linearly by weight
+// NOTE: Weights are normalized, rotations are blended with normalized weighted sum (nlerp)
+void BlendModelPoses(ModelPose *pose, const ModelPose *poses, const float *weights, int count)
+{
+    float totalWeight = 0.0f;
+    for (int p = 0; p < count; p++) if (poses[p].boneCount == pose->boneCount) totalWeight += weights[p];
+
+    if (totalWeight <= 0.0f) return;
+
+    for (int i = 0; i < pose->boneCount; i++)
+    {
+        Vector3 translation = { 0 };
+        Quaternion rotation = { 0 };
+        Vector3 scale = { 0 };
+        Quaternion reference = { 0 };
+        bool referenceSet = false;
+
+        for (int p = 0; p < count; p++)
+        {
+            if (poses[p].boneCount != pose->boneCount) continue;
+
+            float weight = weights[p]/totalWeight;
+            Transform transform = poses[p].transforms[i];
+
+            // Keep all rotations on the same hemisphere than the first one
+            if (!referenceSet) { reference = transform.rotation; referenceSet = true; }
+            float dot = reference.x*transform.rotation.x + reference.y*transform.rotation.y + reference.z*transform.rotation.z + reference.w*transform.rotation.w;
+            float rotationWeight = (dot < 0.0f)? -weight : weight;
+
+            translation = Vector3Add(translation, Vector3Scale(transform.translation, weight));
+            scale = Vector3Add(scale, Vector3Scale(transform.scale, weight));
+            rotation.x += transform.rotation.x*rotationWeight;
+            rotation.y += transform.rotation.y*rotationWeight;
+            rotation.z += transform.rotation.z*rotationWeight;
+            rotation.w += transform.rotation.w*rotationWeight;
+        }
+
+        pose->transforms[i].translation = translation;
+        pose->transforms[i].rotation = QuaternionNormalize(rotation);
+        pose->transforms[i].scale = scale;
+    }
+}
+
+// Blend additive model pose, difference between additive and reference poses is added to pose by weight
+void BlendModelPoseAdditive(ModelPose *pose, ModelPose additive, ModelPose reference, float weight)
+{
+    if ((additive.boneCount != pose->boneCount) || (reference.boneCount != pose->boneCount)) return;
+
+    for (int i = 0; i < pose->boneCount; i++)
+    {
+        Transform add = additive.transforms[i];
+        Transform ref = reference.transforms[i];
+        Transform *out = &pose->transforms[i];
+
+        Vector3 deltaTranslation = Vector3Subtract(add.translation, ref.translation);
+        Quaternion deltaRotation = QuaternionMultiply(add.rotation, QuaternionInvert(ref.rotation));
+        Vector3 deltaScale = {
+            (ref.scale.x != 0.0f)? add.scale.x/ref.scale.x : 1.0f,
+            (ref.scale.y != 0.0f)? add.scale.y/ref.scale.y : 1.0f,
+            (ref.scale.z != 0.0f)? add.scale.z/ref.scale.z : 1.0f
+        };
+
+        out->translation = Vector3Add(out->translation, Vector3Scale(deltaTranslation, weight));
+        out->rotation = QuaternionNormalize(QuaternionMultiply(QuaternionSlerp(QuaternionIdentity(), deltaRotation, weight), out->rotation));
+        out->scale = Vector3Multiply(out->scale, Vector3Lerp((Vector3){ 1.0f, 1.0f, 1.0f }, deltaScale, weight));
+    }
+}
+
+// Update model with pose: bones matrices are computed and cached on pose, skinning runs once
+// NOTE: GPU skinning is used when available, CPU skinning otherwise
+void UpdateModelPose(Model model, ModelPose *pose)
+{
+    if ((pose->boneCount != model.boneCount) || (pose->transforms == NULL)) return;
+
+#if defined(SUPPORT_GPU_SKINNING)
+    for (int i = 0; i < model.boneCount; i++) pose->matrices[i] = GetBoneSkinningMatrix(model.bindPose[i], pose->transforms[i], NULL);
+
+    if (SetModelBoneMatrices(model, pose->matrices)) return;
+#endif
+
+    if (SetSkinningBones(model, pose->transforms, pose->matrices)) SkinModelMeshes(model);
+}
+
+// Unload animation array data
+void UnloadModelAnimations(ModelAnimation *animations, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++) UnloadModelAnimation(animations[i]);
+    RL_FREE(animations);
+}
+
+// Unload animation data
+void UnloadModelAnimation(ModelAnimation anim)
+{
+    if (anim.framePoses != NULL)
+    {
+        for (int i = 0; i < anim.frameCount; i++) RL_FREE(anim.framePoses[i]);
+    }
+
+    RL_FREE(anim.bones);
+    RL_FREE(anim.framePoses);
+    RL_FREE(anim.tracks);
+    RL_FREE(anim.keyFrames);
+    RL_FREE(anim.keyValues);
+}
+
+// Load morph targets weights animations from file
+// NOTE: Weights are stored for every model mesh, in meshes order of LoadModel()
+MorphAnimation *LoadMorphAnimations(const char *fileName, unsigned int *animCount)
+{
+    MorphAnimation *animations = NULL;
+    *animCount = 0;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf;.glb")) animations = LoadMorphAnimationsGLTF(fileName, animCount);
+#endif
+
+    return animations;
+}
+
+// Update model meshes morph targets weights for a given frame
+// NOTE: Meshes morphed on GPU only get their weights updated, no vertex data is uploaded
+void UpdateModelMorphAnimation(Model model, MorphAnimation anim, int frame)
+{
+    if ((anim.frameCount <= 0) || (anim.weights == NULL)) return;
+
+    frame = frame%anim.frameCount;
+    if (frame < 0) frame += anim.frameCount;
+
+    int meshCount = (model.meshCount < anim.meshCount)? model.meshCount : anim.meshCount;
+
+    for (int m = 0; m < meshCount; m++)
+    {
+        SetMeshMorphWeights(model.meshes[m], &anim.weights[(frame*anim.meshCount + m)*anim.targetCount], anim.targetCount);
+    }
+}
+
+// Unload morph animations array data
+void UnloadMorphAnimations(MorphAnimation *animations, unsigned int count)
+{
+    if (animations == NULL) return;
+
+    for (unsigned int i = 0; i < count; i++) RL_FREE(animations[i].weights);
+    RL_FREE(animations);
+}
+
+// Load animations bones matrices baked into texture, frames of all animations are stacked
+// NOTE: Every bone matrix takes 3 texels (matrix rows, last row is implicit), texel index is
+// 3*(frame*boneCount + bone), animations not matching model skeleton are skipped (no frames)
+AnimationTexture LoadAnimationTexture(Model model, const ModelAnimation *animations, int animCount)
+{
+    AnimationTexture texture = { 0 };
+
+    if ((animations == NULL) || (animCount <= 0) || (model.boneCount <= 0) || (model.bindPose == NULL))
+    {
+        TRACELOG(LOG_WARNING, "ANIMATION: Failed to load animation texture, invalid model or animations");
+        return texture;
+    }
+
+    texture.boneCount = model.boneCount;
+    texture.animCount = animCount;
+    texture.animFrames = (int *)RL_CALLOC(animCount*2, sizeof(int));
+
+    for (int a = 0; a < animCount; a++)
+    {
+        texture.animFrames[a*2] = texture.frameCount;
+
+        if (IsModelAnimationValid(model, animations[a]) && ((animations[a].framePoses != NULL) || (animations[a].tracks != NULL)))
+        {
+            texture.animFrames[a*2 + 1] = animations[a].frameCount;
+        }
+        else TRACELOG(LOG_WARNING, "ANIMATION: [%i] Animation skeleton does not match model, animation not baked", a);
+
+        texture.frameCount += texture.animFrames[a*2 + 1];
+    }
+
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+    int texelCount = 3*texture.frameCount*texture.boneCount;
+    int height = (texelCount + ANIMATION_TEXTURE_WIDTH - 1)/ANIMATION_TEXTURE_WIDTH;
+
+    if (texelCount == 0) return texture;
+
+    if (height > ANIMATION_TEXTURE_MAX_HEIGHT)
+    {
+        TRACELOG(LOG_WARNING, "ANIMATION: Animations bones matrices do not fit animation texture, instances drawn in bind pose");
+        return texture;
+    }
+
+    float *texels = (float *)RL_CALLOC(ANIMATION_TEXTURE_WIDTH*height*4, sizeof(float));
+    Transform *transforms = (Transform *)RL_MALLOC(texture.boneCount*sizeof(Transform));
+
+    for (int a = 0; a < animCount; a++)
+    {
+        for (int f = 0; f < texture.animFrames[a*2 + 1]; f++)
+        {
+            GetModelAnimationFramePose(animations[a], f, transforms);
+
+            for (int b = 0; b < texture.boneCount; b++)
+            {
+                Matrix m = GetBoneSkinningMatrix(model.bindPose[b], transforms[b], NULL);
+                float *texel = &texels[((texture.animFrames[a*2] + f)*texture.boneCount + b)*12];
+
+                texel[0] = m.m0; texel[1] = m.m4; texel[2] = m.m8; texel[3] = m.m12;
+                texel[4] = m.m1; texel[5] = m.m5; texel[6] = m.m9; texel[7] = m.m13;
+                texel[8] = m.m2; texel[9] = m.m6; texel[10] = m.m10; texel[11] = m.m14;
+            }
+        }
+    }
+
+    texture.id = rlLoadTexture(texels, ANIMATION_TEXTURE_WIDTH, height, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+
+    RL_FREE(transforms);
+    RL_FREE(texels);
+
+    if (texture.id > 0) TRACELOG(LOG_INFO, "ANIMATION: [ID %i] Animation texture loaded successfully (%i animations, %i frames, %i bones)", texture.id, animCount, texture.frameCount, texture.boneCount);
+    else TRACELOG(LOG_WARNING, "ANIMATION: Failed to load animation texture, instances drawn in bind pose");
+#else
+    TRACELOG(LOG_WARNING, "ANIMATION: Animation textures not supported, instances drawn in bind pose");
+#endif
+
+    return texture;
+}
+
+// Unload animation texture from CPU and GPU
+void UnloadAnimationTexture(AnimationTexture texture)
+{
+    if (texture.id > 0) rlUnloadTexture(texture.id);
+    RL_FREE(texture.animFrames);
+}
+
+// Get instance custom data to play animation from animation texture, to be set in instance buffer custom stream
+// NOTE: Frame offset is in frames (desync instances), frame rate in frames per second, animation loops
+Vector4 GetAnimationInstanceData(AnimationTexture texture, int animIndex, float frameOffset, float frameRate)
+{
+    Vector4 data = { 0.0f, 1.0f, 0.0f, 0.0f };
+
+    if ((texture.animFrames != NULL) && (animIndex >= 0) && (animIndex < texture.animCount) && (texture.animFrames[animIndex*2 + 1] > 0))
+    {
+        data = (Vector4){ (float)texture.animFrames[animIndex*2], (float)texture.animFrames[animIndex*2 + 1], frameOffset, frameRate };
+    }
+
+    return data;
+}
+
+// Load animation scheduler
+// NOTE: Projected size thresholds can be modified on scheduler.screenSizes
+AnimationScheduler LoadAnimationScheduler(void)
+{
+    AnimationScheduler scheduler = { 0 };
+
+    scheduler.screenSizes[0] = ANIMATION_SCHEDULER_SCREEN_SIZE;
+    scheduler.screenSizes[1] = ANIMATION_SCHEDULER_SCREEN_SIZE*0.5f;
+    scheduler.screenSizes[2] = ANIMATION_SCHEDULER_SCREEN_SIZE*0.25f;
+
+    return scheduler;
+}
+
+// Unload animation scheduler
+// NOTE: Registered animated models are not unloaded
+void UnloadAnimationScheduler(AnimationScheduler scheduler)
+{
+    RL_FREE(scheduler.models);
+}
+
+// Load animated model instance, pose is sampled on first scheduler update
+// NOTE: Model and animation are referenced, several animated models can share them
+AnimatedModel LoadAnimatedModel(Model model, ModelAnimation anim, float frameRate)
+{
+    AnimatedModel animModel = { 0 };
+
+    animModel.model = model;
+    animModel.anim = anim;
+    animModel.transform = MatrixIdentity();
+    animModel.frameRate = frameRate;
+    animModel.interval = 1;
+    animModel.visible = true;
+    animModel.root = GetAnimationRootTransform(anim, 0.0f);
+    animModel.pose = LoadModelPose(model);
+    animModel.keyMatrices = (Matrix *)RL_MALLOC(2*model.boneCount*sizeof(Matrix));
+    animModel.keyFrames[0] = -1;
+
+    BoundingBox bounds = GetModelBoundingBox(model);
+    animModel.boundsCenter = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    animModel.boundsRadius = 0.5f*Vector3Distance(bounds.min, bounds.max);
+
+    return animModel;
+}
+
+// Unload animated model instance
+// NOTE: Model and animation are not unloaded
+void UnloadAnimatedModel(AnimatedModel animModel)
+{
+    if (skinnedAnimatedPose == animModel.pose.transforms) skinnedAnimatedMeshes = NULL;
+
+    UnloadModelPose(animModel.pose);
+    RL_FREE(animModel.keyMatrices);
+}
+
+// Set animated model playing animation and frame
+// NOTE: Interpolation keys are reset, pose is sampled again on next scheduler update
+void SetAnimatedModelAnimation(AnimatedModel *animModel, ModelAnimation anim, float frame)
+{
+    animModel->anim = anim;
+    animModel->frame = frame;
+    animModel->root = GetAnimationRootTransform(anim, frame);
+    animModel->keyFrames[0] = -1;
+}
+
+// Register animated model on scheduler
+// NOTE: Animated model is referenced, it must be unregistered before being unloaded
+void RegisterAnimatedModel(AnimationScheduler *scheduler, AnimatedModel *animModel)
+{
+    for (int i = 0; i < scheduler->modelCount; i++) if (scheduler->models[i] == animModel) return;
+
+    if (scheduler->modelCount >= scheduler->modelCapacity)
+    {
+        int capacity = (scheduler->modelCapacity > 0)? 2*scheduler->modelCapacity : 32;
+        AnimatedModel **models = (AnimatedModel **)RL_REALLOC(scheduler->models, capacity*sizeof(AnimatedModel *));
+
+        if (models == NULL)
+        {
+            TRACELOG(LOG_WARNING, "ANIMATION: Failed to register animated model on scheduler");
+            return;
+        }
+
+        scheduler->models = models;
+        scheduler->modelCapacity = capacity;
+    }
+
+    animModel->keyFrames[0] = -1;
+    scheduler->models[scheduler->modelCount] = animModel;
+    scheduler->modelCount++;
+}
+
+// Unregister animated model from scheduler
+void UnregisterAnimatedModel(AnimationScheduler *scheduler, AnimatedModel *animModel)
+{
+    for (int i = 0; i < scheduler->modelCount; i++)
+    {
+        if (scheduler->models[i] == animModel)
+        {
+            scheduler->models[i] = scheduler->models[scheduler->modelCount - 1];
+            scheduler->modelCount--;
+            break;
+        }
+    }
+}
+
+// Advance registered models animations and update their bones
+// NOTE: Models projected under scheduler screen sizes sample their pose every 2nd, 4th or 8th frame, the next update
+// pose is sampled ahead and bones matrices are interpolated in between, models outside camera view only advance
+// their frame and root motion, update slots are staggered by registration order to spread sampling over frames
+void UpdateAnimationScheduler(AnimationScheduler *scheduler, Camera camera, float deltaTime)
+{
+    RL_PROFILE_ZONE_BEGIN(zone, "UpdateAnimationScheduler");
+
+    scheduler->sampledCount = 0;
+    scheduler->interpolatedCount = 0;
+    scheduler->rootOnlyCount = 0;
+
+#if defined(SUPPORT_ANIMATION_SCHEDULER)
+    float aspect = (GetScreenHeight() > 0)? (float)GetScreenWidth()/(float)GetScreenHeight() : 1.0f;
+    Frustum frustum = GetCameraFrustum(camera, aspect);
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    // NOTE: Only projection vertical scale and type are required by screen size
+    Matrix matProjection = { 0 };
+    if (camera.projection == CAMERA_PERSPECTIVE) matProjection.m5 = 1.0f/tanf(camera.fovy*0.5f*DEG2RAD);
+    else
+    {
+        matProjection.m5 = 2.0f/camera.fovy;
+        matProjection.m15 = 1.0f;
+    }
+#endif
+
+    for (int i = 0; i < scheduler->modelCount; i++)
+    {
+        AnimatedModel *animModel = scheduler->models[i];
+        ModelAnimation anim = animModel->anim;
+
+        if ((anim.frameCount <= 0) || (animModel->pose.boneCount != anim.boneCount)) continue;
+
+        animModel->frame = fmodf(animModel->frame + animModel->frameRate*deltaTime, (float)anim.frameCount);
+        if (animModel->frame < 0.0f) animModel->frame += (float)anim.frameCount;
+
+        animModel->root = GetAnimationRootTransform(anim, animModel->frame);
+
+        int interval = 1;
+
+#if defined(SUPPORT_ANIMATION_SCHEDULER)
+        Matrix transform = MatrixMultiply(animModel->model.transform, animModel->transform);
+        Matrix matModelView = MatrixMultiply(transform, matView);
+        Vector3 center = Vector3Transform(animModel->boundsCenter, transform);
+
+        // NOTE: Bind pose bounds are used, a margin covers limbs extending out of them
+        float scale = sqrtf(fmaxf(transform.m0*transform.m0 + transform.m1*transform.m1 + transform.m2*transform.m2,
+            fmaxf(transform.m4*transform.m4 + transform.m5*transform.m5 + transform.m6*transform.m6,
+            transform.m8*transform.m8 + transform.m9*transform.m9 + transform.m10*transform.m10)));
+
+        animModel->visible = CheckFrustumSphere(frustum, center, 1.5f*animModel->boundsRadius*scale);
+
+        if (!animModel->visible)
+        {
+            // Keys are not valid anymore, pose is sampled again when model gets visible
+            animModel->keyFrames[0] = -1;
+            scheduler->rootOnlyCount++;
+            continue;
+        }
+
+        float screenSize = GetSphereScreenSize(animModel->boundsCenter, animModel->boundsRadius, matModelView, matProjection);
+        for (int n = 0; n < 3; n++) if (screenSize < scheduler->screenSizes[n]) interval *= 2;
+#else
+        animModel->visible = true;
+#endif
+
+        if ((animModel->keyFrames[0] < 0) || (scheduler->frameCounter >= animModel->keyFrames[1]))
+        {
+            Matrix *prevMatrices = animModel->keyMatrices;
+            Matrix *nextMatrices = animModel->keyMatrices + anim.boneCount;
+
+            // Previous key is the pose sampled ahead on last update, unless keys are not valid
+            if (animModel->keyFrames[0] < 0) SampleAnimatedModelKey(animModel, animModel->frame, prevMatrices);
+            else memcpy(prevMatrices, nextMatrices, anim.boneCount*sizeof(Matrix));
+
+            int next = scheduler->frameCounter + interval - (scheduler->frameCounter + i)%interval;
+            SampleAnimatedModelKey(animModel, animModel->frame + (float)(next - scheduler->frameCounter)*animModel->frameRate*deltaTime, nextMatrices);
+
+            animModel->interval = interval;
+            animModel->keyFrames[0] = scheduler->frameCounter;
+            animModel->keyFrames[1] = next;
+
+            memcpy(animModel->pose.matrices, prevMatrices, anim.boneCount*sizeof(Matrix));
+            scheduler->sampledCount++;
+        }
+        else
+        {
+            const float *prev = (const float *)animModel->keyMatrices;
+            const float *next = (const float *)(animModel->keyMatrices + anim.boneCount);
+            float *matrices = (float *)animModel->pose.matrices;
+            float amount = (float)(scheduler->frameCounter - animModel->keyFrames[0])/(float)(animModel->keyFrames[1] - animModel->keyFrames[0]);
+
+            // NOTE: Matrices are lerped component-wise, rotation shrinking is negligible between close keys
+            for (int k = 0; k < 16*anim.boneCount; k++) matrices[k] = prev[k] + amount*(next[k] - prev[k]);
+
+            scheduler->interpolatedCount++;
+        }
+    }
+
+    scheduler->frameCounter++;
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Draw animated model with its own bones matrices
+// NOTE: Meshes draws reference animated model matrices, meshes shared by several animated models keep every
+// model pose (also on queued draws), CPU skinned meshes are only skinned again when pose or model changes
+void DrawAnimatedModel(AnimatedModel animModel, Color tint)
+{
+    Model model = animModel.model;
+    bool gpuSkinned = false;
+
+    if (animModel.pose.boneCount == model.boneCount)
+    {
+        if (SetModelBoneMatrices(model, animModel.pose.matrices)) gpuSkinned = true;
+        else if ((skinnedAnimatedMeshes != model.meshes) || (skinnedAnimatedPose != animModel.pose.transforms) || (skinnedAnimatedKey != animModel.keyFrames[1]))
+        {
+            if (SetSkinningBones(model, animModel.pose.transforms, NULL))
+            {
+                SkinModelMeshes(model);
+
+                skinnedAnimatedMeshes = model.meshes;
+                skinnedAnimatedPose = animModel.pose.transforms;
+                skinnedAnimatedKey = animModel.keyFrames[1];
+            }
+        }
+    }
+
+    Matrix transform = MatrixMultiply(model.transform, animModel.transform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+        if (gpuSkinned && (mesh.boneMatrices != NULL)) mesh.boneMatrices = animModel.pose.matrices;
+
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(mesh, model.materials[model.meshMaterial[i]], transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Check model animation skeleton match
+// NOTE: Only number of bones and parent connections are checked
+bool IsModelAnimationValid(Model model, ModelAnimation anim)
+{
+    int result = true;
+
+    if (model.boneCount != anim.boneCount) result = false;
+    else
+    {
+        for (int i = 0; i < model.boneCount; i++)
+        {
+            if (model.bones[i].parent != anim.bones[i].parent) { result = false; break; }
+        }
+    }
+
+    return result;
+}
+
+// Compress model animation, frame poses are replaced by reduced and quantized tracks keys (decoded on sampling)
+// NOTE: Every bone has 3 tracks (translation, rotation, scale), keys are removed while interpolation between kept
+// keys stays under tolerance (translation/scale units, rotation radians), tracks under tolerance are stored as
+// one constant key, translation/scale keys are quantized to 16 bit in track range, rotations to smallest-three 48 bit
+void CompressModelAnimation(ModelAnimation *anim, float tolerance)
+{
+    if ((anim->framePoses == NULL) || (anim->frameCount <= 0) || (anim->boneCount <= 0)) return;
+
+    if (anim->frameCount > 65535)
+    {
+        TRACELOG(LOG_WARNING, "ANIM: Animation frames count exceeds compression limit (65535), not compressed");
+        return;
+    }
+
+    int trackCount = anim->boneCount*3;
+    int keyCapacity = trackCount*4;
+    int keyCount = 0;
+
+    ModelAnimationTrack *tracks = (ModelAnimationTrack *)RL_CALLOC(trackCount, sizeof(ModelAnimationTrack));
+    unsigned short *keyFrames = (unsigned short *)RL_MALLOC(keyCapacity*sizeof(unsigned short));
+    unsigned short *keyValues = (unsigned short *)RL_MALLOC(keyCapacity*3*sizeof(unsigned short));
+    Quaternion *values = (Quaternion *)RL_MALLOC(anim->frameCount*sizeof(Quaternion));     // Track values by frame (xyz used for vectors)
+    int *frames = (int *)RL_MALLOC(anim->frameCount*sizeof(int));   // Track kept keys frames
+
+    for (int t = 0; t < trackCount; t++)
+    {
+        int bone = t/3;
+        int channel = t%3;      // 0: translation, 1: rotation, 2: scale
+
+        for (int f = 0; f < anim->frameCount; f++)
+        {
+            Transform transform = anim->framePoses[f][bone];
+
+            if (channel == 0) values[f] = (Quaternion){ transform.translation.x, transform.translation.y, transform.translation.z, 0.0f };
+            else if (channel == 1)
+            {
+                // Keep rotations on the same hemisphere than previous frame, interpolation takes the shortest path
+                values[f] = QuaternionNormalize(transform.rotation);
+                if ((f > 0) && ((values[f].x*values[f - 1].x + values[f].y*values[f - 1].y + values[f].z*values[f - 1].z + values[f].w*values[f - 1].w) < 0.0f))
+                {
+                    values[f] = (Quaternion){ -values[f].x, -values[f].y, -values[f].z, -values[f].w };
+                }
+            }
+            else values[f] = (Quaternion){ transform.scale.x, transform.scale.y, transform.scale.z, 0.0f };
+        }
+
+        // Constant track detection
+        bool constant = true;
+        for (int f = 1; (f < anim->frameCount) && constant; f++) constant = (GetAnimationTrackError(values[0], values[f], channel) <= tolerance);
+
+        // Keyframe reduction: extend every segment while interpolated frames stay under tolerance
+        int count = 0;
+        frames[count++] = 0;
+
+        if (!constant)
+        {
+            int start = 0;
+
+            while (start < anim->frameCount - 1)
+            {
+                int end = start + 1;
+
+                while (end < anim->frameCount - 1)
+                {
+                    bool valid = true;
+                    int candidate = end + 1;
+
+                    for (int f = start + 1; (f < candidate) && valid; f++)
+                    {
+                        Quaternion interpolated = GetAnimationTrackValue(values[start], values[candidate], (float)(f - start)/(float)(candidate - start), channel);
+                        valid = (GetAnimationTrackError(interpolated, values[f], channel) <= tolerance);
+                    }
+
+                    if (!valid) break;
+                    end = candidate;
+                }
+
+                frames[count++] = end;
+                start = end;
+            }
+        }
+
+        // Quantize track keys
+        ModelAnimationTrack *track = &tracks[t];
+        track->keyCount = count;
+        track->firstKey = keyCount;
+
+        if (channel != 1)
+        {
+            Vector3 min = { FLT_MAX, FLT_MAX, FLT_MAX };
+            Vector3 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+            for (int k = 0; k < count; k++)
+            {
+                Vector3 value = { values[frames[k]].x, values[frames[k]].y, values[frames[k]].z };
+                min = Vector3Min(min, value);
+                max = Vector3Max(max, value);
+            }
+
+            track->offset = min;
+            track->range = Vector3Scale(Vector3Subtract(max, min), 1.0f/65535.0f);
+        }
+
+        if ((keyCount + count) > keyCapacity)
+        {
+            while ((keyCount + count) > keyCapacity) keyCapacity *= 2;
+            keyFrames = (unsigned short *)RL_REALLOC(keyFrames, keyCapacity*sizeof(unsigned short));
+            keyValues = (unsigned short *)RL_REALLOC(keyValues, keyCapacity*3*sizeof(unsigned short));
+        }
+
+        for (int k = 0; k < count; k++, keyCount++)
+        {
+            Quaternion value = values[frames[k]];
+            unsigned short *key = &keyValues[keyCount*3];
+
+            keyFrames[keyCount] = (unsigned short)frames[k];
+
+            if (channel == 1) EncodeAnimationRotation(value, key);
+            else
+            {
+                const float *v = &value.x;
+                const float *offset = &track->offset.x;
+                const float *range = &track->range.x;
+
+                for (int c = 0; c < 3; c++) key[c] = (range[c] > 0.0f)? (unsigned short)Clamp(roundf((v[c] - offset[c])/range[c]), 0.0f, 65535.0f) : 0;
+            }
+        }
+    }
+
+    RL_FREE(values);
+    RL_FREE(frames);
+
+    int uncompressedSize = anim->frameCount*anim->boneCount*(int)sizeof(Transform);
+    int compressedSize = trackCount*(int)sizeof(ModelAnimationTrack) + keyCount*4*(int)sizeof(unsigned short);
+    TRACELOG(LOG_INFO, "ANIM: Animation compressed: %i keys, %i bytes (uncompressed: %i bytes)", keyCount, compressedSize, uncompressedSize);
+
+    for (int f = 0; f < anim->frameCount; f++) RL_FREE(anim->framePoses[f]);
+    RL_FREE(anim->framePoses);
+
+    anim->framePoses = NULL;
+    anim->tracks = tracks;
+    anim->keyFrames = (unsigned short *)RL_REALLOC(keyFrames, ((keyCount > 0)? keyCount : 1)*sizeof(unsigned short));
+    anim->keyValues = (unsigned short *)RL_REALLOC(keyValues, ((keyCount > 0)? keyCount : 1)*3*sizeof(unsigned short));
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate polygonal mesh
+Mesh GenMeshPoly(int sides, float radius)
+{
+    Mesh mesh = { 0 };
+
+    if (sides < 3) return mesh;
+
+    // NOTE: Polygon is generated as a disk with a single ring
+    MeshSurface surface = { SurfaceDisk, { radius, 0.0f, 1.0f }, 1, sides, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_FIRST };
+    mesh = GenMeshSurfaces(&surface, 1);
+
+    // Upload vertex data to GPU (static mesh)
+    // NOTE: mesh.vboId array is allocated inside UploadMesh()
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Generate plane mesh (with subdivisions)
+Mesh GenMeshPlane(float width, float length, int resX, int resZ)
+{
+    Mesh mesh = { 0 };
+
+    if ((resX >= 1) && (resZ >= 1))
+    {
+        MeshSurface surface = { SurfacePlane, { width, length }, resZ, resX, 0 };
+        mesh = GenMeshSurfaces(&surface, 1);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: plane");
+
+    return mesh;
+}
+
+// Generated cuboid mesh
+Mesh GenMeshCube(float width, float height, float length)
+{
+    Mesh mesh = { 0 };
+
+    float vertices[] = {
+        -width/2, -height/2, length/2,
+        width/2, -height/2, length/2,
+        width/2, height/2, length/2,
+        -width/2, height/2, length/2,
+        -width/2, -height/2, -length/2,
+        -width/2, height/2, -length/2,
+        width/2, height/2, -length/2,
+        width/2, -height/2, -length/2,
+        -width/2, height/2, -length/2,
+        -width/2, height/2, length/2,
+        width/2, height/2, length/2,
+        width/2, height/2, -length/2,
+        -width/2, -height/2, -length/2,
+        width/2, -height/2, -length/2,
+        width/2, -height/2, length/2,
+        -width/2, -height/2, length/2,
+        width/2, -height/2, -length/2,
+        width/2, height/2, -length/2,
+        width/2, height/2, length/2,
+        width/2, -height/2, length/2,
+        -width/2, -height/2, -length/2,
+        -width/2, -height/2, length/2,
+        -width/2, height/2, length/2,
+        -width/2, height/2, -length/2
+    };
+
+    float texcoords[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f,
+        0.0f, 0.0f,
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 1.0f
+    };
+
+    float normals[] = {
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 0.0f,-1.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        0.0f,-1.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f,
+        -1.0f, 0.0f, 0.0f
+    };
+
+    mesh.vertices = (float *)RL_MALLOC(24*3*sizeof(float));
+    memcpy(mesh.vertices, vertices, 24*3*sizeof(float));
+
+    mesh.texcoords = (float *)RL_MALLOC(24*2*sizeof(float));
+    memcpy(mesh.texcoords, texcoords, 24*2*sizeof(float));
+
+    mesh.normals = (float *)RL_MALLOC(24*3*sizeof(float));
+    memcpy(mesh.normals, normals, 24*3*sizeof(float));
+
+    mesh.indices = (unsigned short *)RL_MALLOC(36*sizeof(unsigned short));
+
+    int k = 0;
+
+    // Indices can be initialized right now
+    for (int i = 0; i < 36; i += 6)
+    {
+        mesh.indices[i] = 4*k;
+        mesh.indices[i + 1] = 4*k + 1;
+        mesh.indices[i + 2] = 4*k + 2;
+        mesh.indices[i + 3] = 4*k;
+        mesh.indices[i + 4] = 4*k + 2;
+        mesh.indices[i + 5] = 4*k + 3;
+
+        k++;
+    }
+
+    mesh.vertexCount = 24;
+    mesh.triangleCount = 12;
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Generate sphere mesh (standard sphere)
+Mesh GenMeshSphere(float radius, int rings, int slices)
+{
+    Mesh mesh = { 0 };
+
+    if ((rings >= 3) && (slices >= 3))
+    {
+        MeshSurface surface = { SurfaceSphere, { radius, 2.0f*PI }, rings, slices, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_FIRST | MESH_SURFACE_POLE_LAST };
+        mesh = GenMeshSurfaces(&surface, 1);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: sphere");
+
+    return mesh;
+}
+
+// Generate hemi-sphere mesh (half sphere, no bottom cap)
+Mesh GenMeshHemiSphere(float radius, int rings, int slices)
+{
+    Mesh mesh = { 0 };
+
+    if ((rings >= 3) && (slices >= 3))
+    {
+        if (radius < 0.0f) radius = 0.0f;
+
+        MeshSurface surface = { SurfaceSphere, { radius, PI }, rings, slices, MESH_SURFACE_POLE_FIRST | MESH_SURFACE_POLE_LAST };
+        mesh = GenMeshSurfaces(&surface, 1);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: hemisphere");
+
+    return mesh;
+}
+
+// Generate cylinder mesh
+Mesh GenMeshCylinder(float radius, float height, int slices)
+{
+    Mesh mesh = { 0 };
+
+    if (slices >= 3)
+    {
+        // NOTE: Side is straight along height, a single stack is required
+        MeshSurface surfaces[3] = {
+            { SurfaceCylinder, { radius, radius, height }, 1, slices, MESH_SURFACE_CLOSED_V },
+            { SurfaceDisk, { radius, height, 1.0f }, 1, slices, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_FIRST },  // Top cap
+            { SurfaceDisk, { radius, 0.0f, -1.0f }, 1, slices, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_FIRST }    // Bottom cap
+        };
+
+        mesh = GenMeshSurfaces(surfaces, 3);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cylinder");
+
+    return mesh;
+}
+
+// Generate cone/pyramid mesh
+Mesh GenMeshCone(float radius, float height, int slices)
+{
+    Mesh mesh = { 0 };
+
+    if (slices >= 3)
+    {
+        MeshSurface surfaces[2] = {
+            { SurfaceCylinder, { radius, 0.0f, height }, 1, slices, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_LAST },
+            { SurfaceDisk, { radius, 0.0f, -1.0f }, 1, slices, MESH_SURFACE_CLOSED_V | MESH_SURFACE_POLE_FIRST }    // Bottom cap
+        };
+
+        mesh = GenMeshSurfaces(surfaces, 2);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: cone");
+
+    return mesh;
+}
+
+// Generate torus mesh
+Mesh GenMeshTorus(float radius, float size, int radSeg, int sides)
+{
+    Mesh mesh = { 0 };
+
+    if ((sides >= 3) && (radSeg >= 3))
+    {
+        if (radius > 1.0f) radius = 1.0f;
+        else if (radius < 0.1f) radius = 0.1f;
+
+        // NOTE: Donut sits on the Z=0 plane, inner radius relative to outer radius
+        MeshSurface surface = { SurfaceTorus, { radius, size/2 }, sides, radSeg, MESH_SURFACE_CLOSED_U | MESH_SURFACE_CLOSED_V };
+        mesh = GenMeshSurfaces(&surface, 1);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: torus");
+
+    return mesh;
+}
+
+// Generate trefoil knot mesh
+Mesh GenMeshKnot(float radius, float size, int radSeg, int sides)
+{
+    Mesh mesh = { 0 };
+
+    if ((sides >= 3) && (radSeg >= 3))
+    {
+        if (radius > 3.0f) radius = 3.0f;
+        else if (radius < 0.5f) radius = 0.5f;
+
+        MeshSurface surface = { SurfaceKnot, { radius, size }, sides, radSeg, MESH_SURFACE_CLOSED_U | MESH_SURFACE_CLOSED_V };
+        mesh = GenMeshSurfaces(&surface, 1);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&mesh, false);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to generate mesh: knot");
+
+    return mesh;
+}
+
+// Generate a mesh from heightmap
+// NOTE: Vertex data is uploaded to GPU
+Mesh GenMeshHeightmap(Image heightmap, Vector3 size)
+{
+    #define GRAY_VALUE(c) ((c.r+c.g+c.b)/3)
+
+    Mesh mesh = { 0 };
+
+    int mapX = heightmap.width;
+    int mapZ = heightmap.height;
+
+    Color *pixels = LoadImageColors(heightmap);
+
+    // NOTE: One vertex per pixel
+    mesh.triangleCount = (mapX-1)*(mapZ-1)*2;    // One quad every four pixels
+
+    mesh.vertexCount = mesh.triangleCount*3;
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.colors = NULL;
+
+    int vCounter = 0;       // Used to count vertices float by float
+    int tcCounter = 0;      // Used to count texcoords float by float
+    int nCounter = 0;       // Used to count normals float by float
+
+    int trisCounter = 0;
+
+    Vector3 scaleFactor = { size.x/mapX, size.y/255.0f, size.z/mapZ };
+
+    Vector3 vA = { 0 };
+    Vector3 vB = { 0 };
+    Vector3 vC = { 0 };
+    Vector3 vN = { 0 };
+
+    for (int z = 0; z < mapZ-1; z++)
+    {
+        for (int x = 0; x < mapX-1; x++)
+        {
+            // Fill vertices array with data
+            //----------------------------------------------------------
+
+            // one triangle - 3 vertex
+            mesh.vertices[vCounter] = (float)x*scaleFactor.x;
+            mesh.vertices[vCounter + 1] = (float)GRAY_VALUE(pixels[x + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 2] = (float)z*scaleFactor.z;
+
+            mesh.vertices[vCounter + 3] = (float)x*scaleFactor.x;
+            mesh.vertices[vCounter + 4] = (float)GRAY_VALUE(pixels[x + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 5] = (float)(z + 1)*scaleFactor.z;
+
+            mesh.vertices[vCounter + 6] = (float)(x + 1)*scaleFactor.x;
+            mesh.vertices[vCounter + 7] = (float)GRAY_VALUE(pixels[(x + 1) + z*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 8] = (float)z*scaleFactor.z;
+
+            // another triangle - 3 vertex
+            mesh.vertices[vCounter + 9] = mesh.vertices[vCounter + 6];
+            mesh.vertices[vCounter + 10] = mesh.vertices[vCounter + 7];
+            mesh.vertices[vCounter + 11] = mesh.vertices[vCounter + 8];
+
+            mesh.vertices[vCounter + 12] = mesh.vertices[vCounter + 3];
+            mesh.vertices[vCounter + 13] = mesh.vertices[vCounter + 4];
+            mesh.vertices[vCounter + 14] = mesh.vertices[vCounter + 5];
+
+            mesh.vertices[vCounter + 15] = (float)(x + 1)*scaleFactor.x;
+            mesh.vertices[vCounter + 16] = (float)GRAY_VALUE(pixels[(x + 1) + (z + 1)*mapX])*scaleFactor.y;
+            mesh.vertices[vCounter + 17] = (float)(z + 1)*scaleFactor.z;
+            vCounter += 18;     // 6 vertex, 18 floats
+
+            // Fill texcoords array with data
+            //--------------------------------------------------------------
+            mesh.texcoords[tcCounter] = (float)x/(mapX - 1);
+            mesh.texcoords[tcCounter + 1] = (float)z/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 2] = (float)x/(mapX - 1);
+            mesh.texcoords[tcCounter + 3] = (float)(z + 1)/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 4] = (float)(x + 1)/(mapX - 1);
+            mesh.texcoords[tcCounter + 5] = (float)z/(mapZ - 1);
+
+            mesh.texcoords[tcCounter + 6] = mesh.texcoords[tcCounter + 4];
+            mesh.texcoords[tcCounter + 7] = mesh.texcoords[tcCounter + 5];
+
+            mesh.texcoords[tcCounter + 8] = mesh.texcoords[tcCounter + 2];
+            mesh.texcoords[tcCounter + 9] = mesh.texcoords[tcCounter + 3];
+
+            mesh.texcoords[tcCounter + 10] = (float)(x + 1)/(mapX - 1);
+            mesh.texcoords[tcCounter + 11] = (float)(z + 1)/(mapZ - 1);
+            tcCounter += 12;    // 6 texcoords, 12 floats
+
+            // Fill normals array with data
+            //--------------------------------------------------------------
+            for (int i = 0; i < 18; i += 9)
+            {
+                vA.x = mesh.vertices[nCounter + i];
+                vA.y = mesh.vertices[nCounter + i + 1];
+                vA.z = mesh.vertices[nCounter + i + 2];
+
+                vB.x = mesh.vertices[nCounter + i + 3];
+                vB.y = mesh.vertices[nCounter + i + 4];
+                vB.z = mesh.vertices[nCounter + i + 5];
+
+                vC.x = mesh.vertices[nCounter + i + 6];
+                vC.y = mesh.vertices[nCounter + i + 7];
+                vC.z = mesh.vertices[nCounter + i + 8];
+
+                vN = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vB, vA), Vector3Subtract(vC, vA)));
+
+                mesh.normals[nCounter + i] = vN.x;
+                mesh.normals[nCounter + i + 1] = vN.y;
+                mesh.normals[nCounter + i + 2] = vN.z;
+
+                mesh.normals[nCounter + i + 3] = vN.x;
+                mesh.normals[nCounter + i + 4] = vN.y;
+                mesh.normals[nCounter + i + 5] = vN.z;
+
+                mesh.normals[nCounter + i + 6] = vN.x;
+                mesh.normals[nCounter + i + 7] = vN.y;
+                mesh.normals[nCounter + i + 8] = vN.z;
+            }
+
+            nCounter += 18;     // 6 vertex, 18 floats
+            trisCounter += 2;
+        }
+    }
+
+    UnloadImageColors(pixels);  // Unload pixels color data
+
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+    // Heightmap triangles share vertices with neighbours, weld them
+    OptimizeMesh(&mesh, MESH_OPTIMIZE_ALL);
+#endif
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+
+// Generate a cubes mesh from pixel data
+// NOTE: Vertex data is uploaded to GPU
+Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
+{
+    #define COLOR_EQUAL(col1, col2) ((col1.r == col2.r)&&(col1.g == col2.g)&&(col1.b == col2.b)&&(col1.a == col2.a))
+
+    Mesh mesh = { 0 };
+
+    Color *pixels = LoadImageColors(cubicmap);
+
+    int mapWidth = cubicmap.width;
+    int mapHeight = cubicmap.height;
+
+    // NOTE: Max possible number of triangles numCubes*(12 triangles by cube)
+    int maxTriangles = cubicmap.width*cubicmap.height*12;
+
+    int vCounter = 0;       // Used to count vertices
+    int tcCounter = 0;      // Used to count texcoords
+    int nCounter = 0;       // Used to count normals
+
+    float w = cubeSize.x;
+    float h = cubeSize.z;
+    float h2 = cubeSize.y;
+
+    Vector3 *mapVertices = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
+    Vector2 *mapTexcoords = (Vector2 *)RL_MALLOC(maxTriangles*3*sizeof(Vector2));
+    Vector3 *mapNormals = (Vector3 *)RL_MALLOC(maxTriangles*3*sizeof(Vector3));
+
+    // Define the 6 normals of the cube, we will combine them accordingly later...
+    Vector3 n1 = { 1.0f, 0.0f, 0.0f };
+    Vector3 n2 = { -1.0f, 0.0f, 0.0f };
+    Vector3 n3 = { 0.0f, 1.0f, 0.0f };
+    Vector3 n4 = { 0.0f, -1.0f, 0.0f };
+    Vector3 n5 = { 0.0f, 0.0f, -1.0f };
+    Vector3 n6 = { 0.0f, 0.0f, 1.0f };
+
+    // NOTE: We use texture rectangles to define different textures for top-bottom-front-back-right-left (6)
+    typedef struct RectangleF {
+        float x;
+        float y;
+        float width;
+        float height;
+    } RectangleF;
+
+    RectangleF rightTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
+    RectangleF leftTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
+    RectangleF frontTexUV = { 0.0f, 0.0f, 0.5f, 0.5f };
+    RectangleF backTexUV = { 0.5f, 0.0f, 0.5f, 0.5f };
+    RectangleF topTexUV = { 0.0f, 0.5f, 0.5f, 0.5f };
+    RectangleF bottomTexUV = { 0.5f, 0.5f, 0.5f, 0.5f };
+
+    for (int z = 0; z < mapHeight; ++z)
+    {
+        for (int x = 0; x < mapWidth; ++x)
+        {
+            // Define the 8 vertex of the cube, we will combine them accordingly later...
+            Vector3 v1 = { w*(x - 0.5f), h2, h*(z - 0.5f) };
+            Vector3 v2 = { w*(x - 0.5f), h2, h*(z + 0.5f) };
+            Vector3 v3 = { w*(x + 0.5f), h2, h*(z + 0.5f) };
+            Vector3 v4 = { w*(x + 0.5f), h2, h*(z - 0.5f) };
+            Vector3 v5 = { w*(x + 0.5f), 0, h*(z - 0.5f) };
+            Vector3 v6 = { w*(x - 0.5f), 0, h*(z - 0.5f) };
+            Vector3 v7 = { w*(x - 0.5f), 0, h*(z + 0.5f) };
+            Vector3 v8 = { w*(x + 0.5f), 0, h*(z + 0.5f) };
+
+            // We check pixel color to be WHITE -> draw full cube
+            if (COLOR_EQUAL(pixels[z*cubicmap.width + x], WHITE))
+            {
+                // Define triangles and checking collateral cubes
+                //------------------------------------------------
+
+                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
+                // WARNING: Not required for a WHITE cubes, created to allow seeing the map from outside
+                mapVertices[vCounter] = v1;
+                mapVertices[vCounter + 1] = v2;
+                mapVertices[vCounter + 2] = v3;
+                mapVertices[vCounter + 3] = v1;
+                mapVertices[vCounter + 4] = v3;
+                mapVertices[vCounter + 5] = v4;
+                vCounter += 6;
+
+                mapNormals[nCounter] = n3;
+                mapNormals[nCounter + 1] = n3;
+                mapNormals[nCounter + 2] = n3;
+                mapNormals[nCounter + 3] = n3;
+                mapNormals[nCounter + 4] = n3;
+                mapNormals[nCounter + 5] = n3;
+                nCounter += 6;
+
+                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
+                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
+                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
+                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
+                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
+                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
+                tcCounter += 6;
+
+                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
+                mapVertices[vCounter] = v6;
+                mapVertices[vCounter + 1] = v8;
+                mapVertices[vCounter + 2] = v7;
+                mapVertices[vCounter + 3] = v6;
+                mapVertices[vCounter + 4] = v5;
+                mapVertices[vCounter + 5] = v8;
+                vCounter += 6;
+
+                mapNormals[nCounter] = n4;
+                mapNormals[nCounter + 1] = n4;
+                mapNormals[nCounter + 2] = n4;
+                mapNormals[nCounter + 3] = n4;
+                mapNormals[nCounter + 4] = n4;
+                mapNormals[nCounter + 5] = n4;
+                nCounter += 6;
+
+                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
+                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
+                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
+                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
+                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
+                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
+                tcCounter += 6;
+
+                // Checking cube on bottom of current cube
+                if (((z < cubicmap.height - 1) && COLOR_EQUAL(pixels[(z + 1)*cubicmap.width + x], BLACK)) || (z == cubicmap.height - 1))
+                {
+                    // Define front triangles (2 tris, 6 vertex) --> v2 v7 v3, v3 v7 v8
+                    // NOTE: Collateral occluded faces are not generated
+                    mapVertices[vCounter] = v2;
+                    mapVertices[vCounter + 1] = v7;
+                    mapVertices[vCounter + 2] = v3;
+                    mapVertices[vCounter + 3] = v3;
+                    mapVertices[vCounter + 4] = v7;
+                    mapVertices[vCounter + 5] = v8;
+                    vCounter += 6;
+
+                    mapNormals[nCounter] = n6;
+                    mapNormals[nCounter + 1] = n6;
+                    mapNormals[nCounter + 2] = n6;
+                    mapNormals[nCounter + 3] = n6;
+                    mapNormals[nCounter + 4] = n6;
+                    mapNormals[nCounter + 5] = n6;
+                    nCounter += 6;
+
+                    mapTexcoords[tcCounter] = (Vector2){ frontTexUV.x, frontTexUV.y };
+                    mapTexcoords[tcCounter + 1] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
+                    mapTexcoords[tcCounter + 2] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
+                    mapTexcoords[tcCounter + 3] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y };
+                    mapTexcoords[tcCounter + 4] = (Vector2){ frontTexUV.x, frontTexUV.y + frontTexUV.height };
+                    mapTexcoords[tcCounter + 5] = (Vector2){ frontTexUV.x + frontTexUV.width, frontTexUV.y + frontTexUV.height };
+                    tcCounter += 6;
+                }
+
+                // Checking cube on top of current cube
+                if (((z > 0) && COLOR_EQUAL(pixels[(z - 1)*cubicmap.width + x], BLACK)) || (z == 0))
+                {
+                    // Define back triangles (2 tris, 6 vertex) --> v1 v5 v6, v1 v4 v5
+                    // NOTE: Collateral occluded faces are not generated
+                    mapVertices[vCounter] = v1;
+                    mapVertices[vCounter + 1] = v5;
+                    mapVertices[vCounter + 2] = v6;
+                    mapVertices[vCounter + 3] = v1;
+                    mapVertices[vCounter + 4] = v4;
+                    mapVertices[vCounter + 5] = v5;
+                    vCounter += 6;
+
+                    mapNormals[nCounter] = n5;
+                    mapNormals[nCounter + 1] = n5;
+                    mapNormals[nCounter + 2] = n5;
+                    mapNormals[nCounter + 3] = n5;
+                    mapNormals[nCounter + 4] = n5;
+                    mapNormals[nCounter + 5] = n5;
+                    nCounter += 6;
+
+                    mapTexcoords[tcCounter] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
+                    mapTexcoords[tcCounter + 1] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
+                    mapTexcoords[tcCounter + 2] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y + backTexUV.height };
+                    mapTexcoords[tcCounter + 3] = (Vector2){ backTexUV.x + backTexUV.width, backTexUV.y };
+                    mapTexcoords[tcCounter + 4] = (Vector2){ backTexUV.x, backTexUV.y };
+                    mapTexcoords[tcCounter + 5] = (Vector2){ backTexUV.x, backTexUV.y + backTexUV.height };
+                    tcCounter += 6;
+                }
+
+                // Checking cube on right of current cube
+                if (((x < cubicmap.width - 1) && COLOR_EQUAL(pixels[z*cubicmap.width + (x + 1)], BLACK)) || (x == cubicmap.width - 1))
+                {
+                    // Define right triangles (2 tris, 6 vertex) --> v3 v8 v4, v4 v8 v5
+                    // NOTE: Collateral occluded faces are not generated
+                    mapVertices[vCounter] = v3;
+                    mapVertices[vCounter + 1] = v8;
+                    mapVertices[vCounter + 2] = v4;
+                    mapVertices[vCounter + 3] = v4;
+                    mapVertices[vCounter + 4] = v8;
+                    mapVertices[vCounter + 5] = v5;
+                    vCounter += 6;
+
+                    mapNormals[nCounter] = n1;
+                    mapNormals[nCounter + 1] = n1;
+                    mapNormals[nCounter + 2] = n1;
+                    mapNormals[nCounter + 3] = n1;
+                    mapNormals[nCounter + 4] = n1;
+                    mapNormals[nCounter + 5] = n1;
+                    nCounter += 6;
+
+                    mapTexcoords[tcCounter] = (Vector2){ rightTexUV.x, rightTexUV.y };
+                    mapTexcoords[tcCounter + 1] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
+                    mapTexcoords[tcCounter + 2] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
+                    mapTexcoords[tcCounter + 3] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y };
+                    mapTexcoords[tcCounter + 4] = (Vector2){ rightTexUV.x, rightTexUV.y + rightTexUV.height };
+                    mapTexcoords[tcCounter + 5] = (Vector2){ rightTexUV.x + rightTexUV.width, rightTexUV.y + rightTexUV.height };
+                    tcCounter += 6;
+                }
+
+                // Checking cube on left of current cube
+                if (((x > 0) && COLOR_EQUAL(pixels[z*cubicmap.width + (x - 1)], BLACK)) || (x == 0))
+                {
+                    // Define left triangles (2 tris, 6 vertex) --> v1 v7 v2, v1 v6 v7
+                    // NOTE: Collateral occluded faces are not generated
+                    mapVertices[vCounter] = v1;
+                    mapVertices[vCounter + 1] = v7;
+                    mapVertices[vCounter + 2] = v2;
+                    mapVertices[vCounter + 3] = v1;
+                    mapVertices[vCounter + 4] = v6;
+                    mapVertices[vCounter + 5] = v7;
+                    vCounter += 6;
+
+                    mapNormals[nCounter] = n2;
+                    mapNormals[nCounter + 1] = n2;
+                    mapNormals[nCounter + 2] = n2;
+                    mapNormals[nCounter + 3] = n2;
+                    mapNormals[nCounter + 4] = n2;
+                    mapNormals[nCounter + 5] = n2;
+                    nCounter += 6;
+
+                    mapTexcoords[tcCounter] = (Vector2){ leftTexUV.x, leftTexUV.y };
+                    mapTexcoords[tcCounter + 1] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
+                    mapTexcoords[tcCounter + 2] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y };
+                    mapTexcoords[tcCounter + 3] = (Vector2){ leftTexUV.x, leftTexUV.y };
+                    mapTexcoords[tcCounter + 4] = (Vector2){ leftTexUV.x, leftTexUV.y + leftTexUV.height };
+                    mapTexcoords[tcCounter + 5] = (Vector2){ leftTexUV.x + leftTexUV.width, leftTexUV.y + leftTexUV.height };
+                    tcCounter += 6;
+                }
+            }
+            // We check pixel color to be BLACK, we will only draw floor and roof
+            else if (COLOR_EQUAL(pixels[z*cubicmap.width + x], BLACK))
+            {
+                // Define top triangles (2 tris, 6 vertex --> v1-v2-v3, v1-v3-v4)
+                mapVertices[vCounter] = v1;
+                mapVertices[vCounter + 1] = v3;
+                mapVertices[vCounter + 2] = v2;
+                mapVertices[vCounter + 3] = v1;
+                mapVertices[vCounter + 4] = v4;
+                mapVertices[vCounter + 5] = v3;
+                vCounter += 6;
+
+                mapNormals[nCounter] = n4;
+                mapNormals[nCounter + 1] = n4;
+                mapNormals[nCounter + 2] = n4;
+                mapNormals[nCounter + 3] = n4;
+                mapNormals[nCounter + 4] = n4;
+                mapNormals[nCounter + 5] = n4;
+                nCounter += 6;
+
+                mapTexcoords[tcCounter] = (Vector2){ topTexUV.x, topTexUV.y };
+                mapTexcoords[tcCounter + 1] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
+                mapTexcoords[tcCounter + 2] = (Vector2){ topTexUV.x, topTexUV.y + topTexUV.height };
+                mapTexcoords[tcCounter + 3] = (Vector2){ topTexUV.x, topTexUV.y };
+                mapTexcoords[tcCounter + 4] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y };
+                mapTexcoords[tcCounter + 5] = (Vector2){ topTexUV.x + topTexUV.width, topTexUV.y + topTexUV.height };
+                tcCounter += 6;
+
+                // Define bottom triangles (2 tris, 6 vertex --> v6-v8-v7, v6-v5-v8)
+                mapVertices[vCounter] = v6;
+                mapVertices[vCounter + 1] = v7;
+                mapVertices[vCounter + 2] = v8;
+                mapVertices[vCounter + 3] = v6;
+                mapVertices[vCounter + 4] = v8;
+                mapVertices[vCounter + 5] = v5;
+                vCounter += 6;
+
+                mapNormals[nCounter] = n3;
+                mapNormals[nCounter + 1] = n3;
+                mapNormals[nCounter + 2] = n3;
+                mapNormals[nCounter + 3] = n3;
+                mapNormals[nCounter + 4] = n3;
+                mapNormals[nCounter + 5] = n3;
+                nCounter += 6;
+
+                mapTexcoords[tcCounter] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
+                mapTexcoords[tcCounter + 1] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y + bottomTexUV.height };
+                mapTexcoords[tcCounter + 2] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
+                mapTexcoords[tcCounter + 3] = (Vector2){ bottomTexUV.x + bottomTexUV.width, bottomTexUV.y };
+                mapTexcoords[tcCounter + 4] = (Vector2){ bottomTexUV.x, bottomTexUV.y + bottomTexUV.height };
+                mapTexcoords[tcCounter + 5] = (Vector2){ bottomTexUV.x, bottomTexUV.y };
+                tcCounter += 6;
+            }
+        }
+    }
+
+    // Move data from mapVertices temp arays to vertices float array
+    mesh.vertexCount = vCounter;
+    mesh.triangleCount = vCounter/3;
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.colors = NULL;
+
+    int fCounter = 0;
+
+    // Move vertices data
+    for (int i = 0; i < vCounter; i++)
+    {
+        mesh.vertices[fCounter] = mapVertices[i].x;
+        mesh.vertices[fCounter + 1] = mapVertices[i].y;
+        mesh.vertices[fCounter + 2] = mapVertices[i].z;
+        fCounter += 3;
+    }
+
+    fCounter = 0;
+
+    // Move normals data
+    for (int i = 0; i < nCounter; i++)
+    {
+        mesh.normals[fCounter] = mapNormals[i].x;
+        mesh.normals[fCounter + 1] = mapNormals[i].y;
+        mesh.normals[fCounter + 2] = mapNormals[i].z;
+        fCounter += 3;
+    }
+
+    fCounter = 0;
+
+    // Move texcoords data
+    for (int i = 0; i < tcCounter; i++)
+    {
+        mesh.texcoords[fCounter] = mapTexcoords[i].x;
+        mesh.texcoords[fCounter + 1] = mapTexcoords[i].y;
+        fCounter += 2;
+    }
+
+    RL_FREE(mapVertices);
+    RL_FREE(mapNormals);
+    RL_FREE(mapTexcoords);
+
+    UnloadImageColors(pixels);   // Unload pixels color data
+
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+    // Cubicmap faces are emitted as separate triangles, weld shared vertices
+    OptimizeMesh(&mesh, MESH_OPTIMIZE_ALL);
+#endif
+
+    // Upload vertex data to GPU (static mesh)
+    UploadMesh(&mesh, false);
+
+    return mesh;
+}
+#endif      // SUPPORT_MESH_GENERATION
+
+#if defined(SUPPORT_VOXEL_MESHING)
+// Load empty voxel map, all chunks are marked for rebuild
+// NOTE: Palette is initialized to WHITE and atlas is disabled, texcoords repeat every voxel
+VoxelMap LoadVoxelMap(int width, int height, int depth, Vector3 voxelSize)
+{
+    VoxelMap map = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (depth <= 0)) return map;
+
+    map.width = width;
+    map.height = height;
+    map.depth = depth;
+    map.voxelSize = voxelSize;
+
+    map.voxels = (unsigned char *)RL_CALLOC(width*height*depth, sizeof(unsigned char));
+    map.palette = (Color *)RL_MALLOC(256*sizeof(Color));
+    map.tiles = (unsigned char *)RL_CALLOC(256*6, sizeof(unsigned char));
+
+    for (int i = 0; i < 256; i++) map.palette[i] = WHITE;
+
+    map.chunksX = (width + VOXEL_CHUNK_SIZE - 1)/VOXEL_CHUNK_SIZE;
+    map.chunksY = (height + VOXEL_CHUNK_SIZE - 1)/VOXEL_CHUNK_SIZE;
+    map.chunksZ = (depth + VOXEL_CHUNK_SIZE - 1)/VOXEL_CHUNK_SIZE;
+
+    int chunkCount = map.chunksX*map.chunksY*map.chunksZ;
+    map.chunks = (Mesh *)RL_CALLOC(chunkCount, sizeof(Mesh));
+    map.chunksDirty = (bool *)RL_MALLOC(chunkCount*sizeof(bool));
+
+    for (int i = 0; i < chunkCount; i++) map.chunksDirty[i] = true;
+
+    return map;
+}
+
+// Load voxel map from cubicmap image, WHITE pixels are walls and BLACK pixels are floor and roof
+// NOTE: Map uses 3 layers (floor, walls, roof) placed as GenMeshCubicmap() mesh, with the same 2x2 atlas:
+// walls sides use upper tiles, walls top, roof and walls bottom, floor use lower tiles
+VoxelMap LoadVoxelMapFromCubicmap(Image cubicmap, Vector3 cubeSize)
+{
+    VoxelMap map = LoadVoxelMap(cubicmap.width, 3, cubicmap.height, cubeSize);
+
+    if (map.voxels == NULL) return map;
+
+    map.origin = (Vector3){ -cubeSize.x*0.5f, -cubeSize.y, -cubeSize.z*0.5f };
+    map.atlasColumns = 2;
+    map.atlasRows = 2;
+
+    // Voxels ids: 1 (wall), 2 (floor), 3 (roof), atlas tiles faces order: +X, -X, +Y, -Y, +Z, -Z
+    const unsigned char tiles[3][6] = {
+        { 0, 1, 2, 3, 0, 1 },
+        { 3, 3, 3, 3, 3, 3 },
+        { 2, 2, 2, 2, 2, 2 }
+    };
+
+    for (int id = 1; id <= 3; id++) memcpy(&map.tiles[id*6], tiles[id - 1], 6);
+
+    Color *pixels = LoadImageColors(cubicmap);
+
+    for (int z = 0; z < cubicmap.height; z++)
+    {
+        for (int x = 0; x < cubicmap.width; x++)
+        {
+            Color color = pixels[z*cubicmap.width + x];
+
+            if ((color.r == 255) && (color.g == 255) && (color.b == 255) && (color.a == 255)) map.voxels[x + z*map.width + 1*map.width*map.depth] = 1;
+            else if ((color.r == 0) && (color.g == 0) && (color.b == 0) && (color.a == 255))
+            {
+                map.voxels[x + z*map.width] = 2;
+                map.voxels[x + z*map.width + 2*map.width*map.depth] = 3;
+            }
+        }
+    }
+
+    UnloadImageColors(pixels);
+
+    return map;
+}
+
+// Unload voxel map data and chunks meshes
+void UnloadVoxelMap(VoxelMap map)
+{
+    int chunkCount = map.chunksX*map.chunksY*map.chunksZ;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (map.chunks[i].vertexCount > 0) UnloadMesh(map.chunks[i]);
+    }
+
+    RL_FREE(map.voxels);
+    RL_FREE(map.palette);
+    RL_FREE(map.tiles);
+    RL_FREE(map.chunks);
+    RL_FREE(map.chunksDirty);
+}
+
+// Set voxel id, voxel chunk and neighbour chunks sharing the voxel faces are marked for rebuild
+void SetVoxel(VoxelMap *map, int x, int y, int z, unsigned char id)
+{
+    if ((x < 0) || (y < 0) || (z < 0) || (x >= map->width) || (y >= map->height) || (z >= map->depth)) return;
+
+    unsigned char *voxel = &map->voxels[x + z*map->width + y*map->width*map->depth];
+    if (*voxel == id) return;
+
+    *voxel = id;
+
+    int cx = x/VOXEL_CHUNK_SIZE;
+    int cy = y/VOXEL_CHUNK_SIZE;
+    int cz = z/VOXEL_CHUNK_SIZE;
+
+    map->chunksDirty[cx + cz*map->chunksX + cy*map->chunksX*map->chunksZ] = true;
+
+    // Voxels on chunk borders hide or expose neighbour chunk faces
+    if (((x%VOXEL_CHUNK_SIZE) == 0) && (cx > 0)) map->chunksDirty[(cx - 1) + cz*map->chunksX + cy*map->chunksX*map->chunksZ] = true;
+    if (((x%VOXEL_CHUNK_SIZE) == VOXEL_CHUNK_SIZE - 1) && (cx < map->chunksX - 1)) map->chunksDirty[(cx + 1) + cz*map->chunksX + cy*map->chunksX*map->chunksZ] = true;
+    if (((y%VOXEL_CHUNK_SIZE) == 0) && (cy > 0)) map->chunksDirty[cx + cz*map->chunksX + (cy - 1)*map->chunksX*map->chunksZ] = true;
+    if (((y%VOXEL_CHUNK_SIZE) == VOXEL_CHUNK_SIZE - 1) && (cy < map->chunksY - 1)) map->chunksDirty[cx + cz*map->chunksX + (cy + 1)*map->chunksX*map->chunksZ] = true;
+    if (((z%VOXEL_CHUNK_SIZE) == 0) && (cz > 0)) map->chunksDirty[cx + (cz - 1)*map->chunksX + cy*map->chunksX*map->chunksZ] = true;
+    if (((z%VOXEL_CHUNK_SIZE) == VOXEL_CHUNK_SIZE - 1) && (cz < map->chunksZ - 1)) map->chunksDirty[cx + (cz + 1)*map->chunksX + cy*map->chunksX*map->chunksZ] = true;
+}
+
+// Get voxel id, 0 if empty or outside map
+unsigned char GetVoxel(VoxelMap map, int x, int y, int z)
+{
+    if ((x < 0) || (y < 0) || (z < 0) || (x >= map.width) || (y >= map.height) || (z >= map.depth)) return 0;
+
+    return map.voxels[x + z*map.width + y*map.width*map.depth];
+}
+
+// Rebuild and upload dirty chunks meshes, every chunk uses its own vertex buffers
+// NOTE: Palette or atlas tiles changes require marking all chunks as dirty
+void UpdateVoxelMap(VoxelMap *map)
+{
+    int chunkCount = map->chunksX*map->chunksY*map->chunksZ;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (!map->chunksDirty[i]) continue;
+
+        if (map->chunks[i].vertexCount > 0) UnloadMesh(map->chunks[i]);
+
+        map->chunks[i] = GenVoxelChunkMesh(*map, i);
+        map->chunksDirty[i] = false;
+
+        if (map->chunks[i].vertexCount > 0) UploadMesh(&map->chunks[i], false);
+    }
+}
+
+// Draw voxel map chunks
+void DrawVoxelMap(VoxelMap map, Material material, Vector3 position)
+{
+    Matrix transform = MatrixTranslate(position.x, position.y, position.z);
+    material.shader = GetVoxelMapShader(map, material);
+
+    int chunkCount = map.chunksX*map.chunksY*map.chunksZ;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (map.chunks[i].triangleCount > 0) DrawMesh(map.chunks[i], material, transform);
+    }
+}
+
+// Draw voxel map chunks, chunks outside frustum are skipped
+void DrawVoxelMapCulled(VoxelMap map, Material material, Frustum frustum, Vector3 position)
+{
+    Matrix transform = MatrixTranslate(position.x, position.y, position.z);
+    Matrix matWorld = MatrixMultiply(transform, rlGetMatrixTransform());
+    material.shader = GetVoxelMapShader(map, material);
+
+    int chunkCount = map.chunksX*map.chunksY*map.chunksZ;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if ((map.chunks[i].triangleCount > 0) && CheckFrustumMesh(frustum, map.chunks[i], matWorld)) DrawMesh(map.chunks[i], material, transform);
+    }
+}
+
+// Generate voxel map chunk mesh (CPU only, no upload), visible faces are merged into greedy quads
+// NOTE: Faces are merged when they share voxel id (same color and atlas tile), quads texcoords are given in voxels
+// units and the atlas tile origin in texcoords2, voxel atlas shader repeats the tile across the quad,
+// on OpenGL 1.1 (no shaders) atlas faces are not merged and texcoords point directly to the atlas
+static Mesh GenVoxelChunkMesh(VoxelMap map, int chunk)
+{
+    Mesh mesh = { 0 };
+
+    int chunk0[3] = {
+        (chunk%map.chunksX)*VOXEL_CHUNK_SIZE,
+        (chunk/(map.chunksX*map.chunksZ))*VOXEL_CHUNK_SIZE,
+        ((chunk/map.chunksX)%map.chunksZ)*VOXEL_CHUNK_SIZE
+    };
+    int mapSize[3] = { map.width, map.height, map.depth };
+    int size[3] = { 0 };
+    for (int a = 0; a < 3; a++) size[a] = ((mapSize[a] - chunk0[a]) < VOXEL_CHUNK_SIZE)? (mapSize[a] - chunk0[a]) : VOXEL_CHUNK_SIZE;
+
+    bool atlas = (map.atlasColumns > 0) && (map.atlasRows > 0);
+#if defined(GRAPHICS_API_OPENGL_11)
+    bool merge = !atlas;
+#else
+    bool merge = true;
+#endif
+
+    int capacity = 0;
+    unsigned char mask[VOXEL_CHUNK_SIZE*VOXEL_CHUNK_SIZE] = { 0 };
+
+    // Faces order: +X, -X, +Y, -Y, +Z, -Z
+    for (int face = 0; face < 6; face++)
+    {
+        int a = face/2;             // Face normal axis
+        int u = (a + 1)%3;          // Quad first axis
+        int v = (a + 2)%3;          // Quad second axis, (u x v) points to +a
+        int sign = (face%2 == 0)? 1 : -1;
+
+        for (int slice = 0; slice < size[a]; slice++)
+        {
+            // Get visible faces mask for the slice, faces are visible if neighbour voxel is empty
+            for (int j = 0; j < size[v]; j++)
+            {
+                for (int i = 0; i < size[u]; i++)
+                {
+                    int p[3] = { 0 };
+                    p[a] = chunk0[a] + slice;
+                    p[u] = chunk0[u] + i;
+                    p[v] = chunk0[v] + j;
+
+                    unsigned char id = map.voxels[p[0] + p[2]*map.width + p[1]*map.width*map.depth];
+                    p[a] += sign;
+
+                    mask[i + j*size[u]] = ((id != 0) && (GetVoxel(map, p[0], p[1], p[2]) == 0))? id : 0;
+                }
+            }
+
+            // Merge faces mask into quads: grow along u axis, then along v axis while rows match
+            for (int j = 0; j < size[v]; j++)
+            {
+                for (int i = 0; i < size[u]; i++)
+                {
+                    unsigned char id = mask[i + j*size[u]];
+                    if (id == 0) continue;
+
+                    int w = 1;
+                    int h = 1;
+
+                    if (merge)
+                    {
+                        while (((i + w) < size[u]) && (mask[i + w + j*size[u]] == id)) w++;
+
+                        for (bool rowMatch = true; rowMatch && ((j + h) < size[v]); )
+                        {
+                            for (int k = 0; k < w; k++)
+                            {
+                                if (mask[i + k + (j + h)*size[u]] != id) { rowMatch = false; break; }
+                            }
+
+                            if (rowMatch) h++;
+                        }
+                    }
+
+                    for (int l = 0; l < h; l++) memset(&mask[i + (j + l)*size[u]], 0, w);
+
+                    // NOTE: Chunk meshes use 16 bit indices, chunk faces exceeding the limit are skipped
+                    if ((mesh.vertexCount + 4) > 65536)
+                    {
+                        TRACELOG(LOG_WARNING, "MESH: Voxel chunk exceeds 16 bit indices limit, reduce VOXEL_CHUNK_SIZE");
+                        continue;
+                    }
+
+                    if ((mesh.vertexCount + 4) > capacity)
+                    {
+                        capacity = (capacity == 0)? 1024 : capacity*2;
+                        mesh.vertices = (float *)RL_REALLOC(mesh.vertices, capacity*3*sizeof(float));
+                        mesh.normals = (float *)RL_REALLOC(mesh.normals, capacity*3*sizeof(float));
+                        mesh.texcoords = (float *)RL_REALLOC(mesh.texcoords, capacity*2*sizeof(float));
+                        mesh.colors = (unsigned char *)RL_REALLOC(mesh.colors, capacity*4*sizeof(unsigned char));
+                        mesh.indices = (unsigned short *)RL_REALLOC(mesh.indices, (capacity/4)*6*sizeof(unsigned short));
+                        if (atlas && merge) mesh.texcoords2 = (float *)RL_REALLOC(mesh.texcoords2, capacity*2*sizeof(float));
+                    }
+
+                    // Quad corners (voxels units), counter-clockwise seen from the face normal
+                    int corners[4][3] = { 0 };
+                    int order[4] = { 0, 1, 2, 3 };
+                    if (sign < 0) { order[1] = 3; order[3] = 1; }
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        corners[c][a] = chunk0[a] + slice + ((sign > 0)? 1 : 0);
+                        corners[c][u] = chunk0[u] + i + (((order[c] == 1) || (order[c] == 2))? w : 0);
+                        corners[c][v] = chunk0[v] + j + ((order[c] >= 2)? h : 0);
+                    }
+
+                    int tile = map.tiles[id*6 + face];
+                    Vector2 tileOrigin = { 0 };
+                    Vector2 tileSize = { 1.0f, 1.0f };
+
+                    if (atlas)
+                    {
+                        tileSize = (Vector2){ 1.0f/map.atlasColumns, 1.0f/map.atlasRows };
+                        tileOrigin = (Vector2){ (tile%map.atlasColumns)*tileSize.x, ((tile/map.atlasColumns)%map.atlasRows)*tileSize.y };
+                    }
+
+                    int vertex = mesh.vertexCount;
+
+                    for (int c = 0; c < 4; c++, vertex++)
+                    {
+                        mesh.vertices[vertex*3 + 0] = map.origin.x + corners[c][0]*map.voxelSize.x;
+                        mesh.vertices[vertex*3 + 1] = map.origin.y + corners[c][1]*map.voxelSize.y;
+                        mesh.vertices[vertex*3 + 2] = map.origin.z + corners[c][2]*map.voxelSize.z;
+
+                        mesh.normals[vertex*3 + 0] = (a == 0)? (float)sign : 0.0f;
+                        mesh.normals[vertex*3 + 1] = (a == 1)? (float)sign : 0.0f;
+                        mesh.normals[vertex*3 + 2] = (a == 2)? (float)sign : 0.0f;
+
+                        // Texcoords in voxels units: top faces (x, z), sides (horizontal, -y) so textures stand upright
+                        float s = (float)((a == 0)? corners[c][2] : corners[c][0]);
+                        float t = (float)((a == 1)? corners[c][2] : -corners[c][1]);
+
+                        if (atlas && merge)
+                        {
+                            mesh.texcoords2[vertex*2 + 0] = tileOrigin.x;
+                            mesh.texcoords2[vertex*2 + 1] = tileOrigin.y;
+                        }
+                        else if (atlas)
+                        {
+                            // Single voxel face, texcoords mapped directly into the atlas tile
+                            float s0 = (float)((a == 0)? corners[0][2] : corners[0][0]);
+                            float t0 = (float)((a == 1)? corners[0][2] : -corners[0][1]);
+                            for (int k = 1; k < 4; k++)
+                            {
+                                s0 = fminf(s0, (float)((a == 0)? corners[k][2] : corners[k][0]));
+                                t0 = fminf(t0, (float)((a == 1)? corners[k][2] : -corners[k][1]));
+                            }
+
+                            s = tileOrigin.x + (s - s0)*tileSize.x;
+                            t = tileOrigin.y + (t - t0)*tileSize.y;
+                        }
+
+                        mesh.texcoords[vertex*2 + 0] = s;
+                        mesh.texcoords[vertex*2 + 1] = t;
+
+                        Color color = map.palette[id];
+                        mesh.colors[vertex*4 + 0] = color.r;
+                        mesh.colors[vertex*4 + 1] = color.g;
+                        mesh.colors[vertex*4 + 2] = color.b;
+                        mesh.colors[vertex*4 + 3] = color.a;
+                    }
+
+                    int index = mesh.triangleCount*3;
+                    mesh.indices[index + 0] = (unsigned short)(mesh.vertexCount + 0);
+                    mesh.indices[index + 1] = (unsigned short)(mesh.vertexCount + 1);
+                    mesh.indices[index + 2] = (unsigned short)(mesh.vertexCount + 2);
+                    mesh.indices[index + 3] = (unsigned short)(mesh.vertexCount + 0);
+                    mesh.indices[index + 4] = (unsigned short)(mesh.vertexCount + 2);
+                    mesh.indices[index + 5] = (unsigned short)(mesh.vertexCount + 3);
+
+                    mesh.vertexCount += 4;
+                    mesh.triangleCount += 2;
+                }
+            }
+        }
+    }
+
+    return mesh;
+}
+
+// Get shader used to draw voxel map chunks, atlas maps replace default shader with built-in voxel atlas shader
+// NOTE: Custom shaders drawing atlas maps must repeat the tile: uv = texCoord2 + fract(texCoord)*tileSize
+static Shader GetVoxelMapShader(VoxelMap map, Material material)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((map.atlasColumns > 0) && (map.atlasRows > 0) && (material.shader.id == rlGetShaderIdDefault()))
+    {
+        if (!voxelShaderLoaded) LoadShaderVoxel();
+
+        if (voxelShader.id > 0)
+        {
+            Vector2 tileSize = { 1.0f/map.atlasColumns, 1.0f/map.atlasRows };
+            SetShaderValue(voxelShader, voxelShaderTileSizeLoc, &tileSize, SHADER_UNIFORM_VEC2);
+
+            return voxelShader;
+        }
+    }
+#endif
+    return material.shader;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load built-in voxel atlas shader
+// NOTE: Mirrors rlgl default shader, atlas tile (texcoord2 origin) is repeated by fract(texcoord)
+static void LoadShaderVoxel(void)
+{
+    const char *voxelVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec2 vertexTexCoord2;           \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec2 fragTexCoord2;            \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragTexCoord2 = vertexTexCoord2; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *voxelFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec2 tileSize;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord2 + fract(fragTexCoord)*tileSize); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec2 fragTexCoord2;             \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec2 tileSize;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 uv = fragTexCoord2 + fract(fragTexCoord)*tileSize; \n"
+    "    vec4 texelColor = textureGrad(texture0, uv, dFdx(fragTexCoord)*tileSize, dFdy(fragTexCoord)*tileSize); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec2 tileSize;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord2 + fract(fragTexCoord)*tileSize); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    voxelShaderLoaded = true;
+    voxelShader = LoadShaderFromMemory(voxelVShaderCode, voxelFShaderCode);
+    voxelShaderTileSizeLoc = GetShaderLocation(voxelShader, "tileSize");
+
+    if ((voxelShader.id > 0) && (voxelShader.id != rlGetShaderIdDefault()) && (voxelShaderTileSizeLoc != -1)) TRACELOG(LOG_INFO, "SHADER: [ID %i] Voxel atlas shader loaded successfully", voxelShader.id);
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load voxel atlas shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (voxelShader.id != rlGetShaderIdDefault()) UnloadShader(voxelShader);
+        else RL_FREE(voxelShader.locs);
+
+        voxelShader = (Shader){ 0 };
+    }
+}
+#endif
+#endif      // SUPPORT_VOXEL_MESHING
+
+// Unload voxel map atlas shader (called by CloseWindow())
+extern void UnloadVoxelShader(void)
+{
+#if defined(SUPPORT_VOXEL_MESHING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (voxelShader.id > 0) UnloadShader(voxelShader);
+
+    voxelShader = (Shader){ 0 };
+    voxelShaderLoaded = false;
+#endif
+}
+
+// Load terrain from heightmap image, heightmap is split in chunks drawn with levels of detail (geomipmapping)
+// NOTE: Terrain placement and scale match GenMeshHeightmap(), chunks store full resolution vertices and
+// border skirts (hiding cracks between levels), levels of detail indices are shared by all chunks
+Terrain LoadTerrain(Image heightmap, Vector3 size)
+{
+    #define GRAY_VALUE(c) ((c.r+c.g+c.b)/3)
+
+    Terrain terrain = { 0 };
+
+    if ((heightmap.width < 2) || (heightmap.height < 2)) return terrain;
+
+    terrain.width = heightmap.width;
+    terrain.depth = heightmap.height;
+    terrain.size = size;
+    terrain.heights = (float *)RL_MALLOC(terrain.width*terrain.depth*sizeof(float));
+
+    Color *pixels = LoadImageColors(heightmap);
+    for (int i = 0; i < terrain.width*terrain.depth; i++) terrain.heights[i] = (float)GRAY_VALUE(pixels[i])*size.y/255.0f;
+    UnloadImageColors(pixels);
+
+    terrain.chunksX = (terrain.width - 1 + TERRAIN_CHUNK_SIZE - 1)/TERRAIN_CHUNK_SIZE;
+    terrain.chunksZ = (terrain.depth - 1 + TERRAIN_CHUNK_SIZE - 1)/TERRAIN_CHUNK_SIZE;
+
+    // Levels of detail, last level keeps one quad every TERRAIN_CHUNK_SIZE/2^n cells (at least one quad)
+    terrain.lodCount = 1;
+    while ((terrain.lodCount < TERRAIN_LOD_LEVELS) && ((TERRAIN_CHUNK_SIZE >> terrain.lodCount) > 0)) terrain.lodCount++;
+
+    // NOTE: Level 0 is used under one chunk width distance
+    terrain.lodDistance = TERRAIN_CHUNK_SIZE*fmaxf(size.x/terrain.width, size.z/terrain.depth);
+
+    int chunkCount = terrain.chunksX*terrain.chunksZ;
+    terrain.chunks = (Mesh *)RL_CALLOC(terrain.lodCount*chunkCount, sizeof(Mesh));
+
+    // Load levels of detail indices buffers, shared by all chunks
+    // NOTE: Level meshes keep their own vboId arrays, vertex buffers are shared with level 0 mesh
+    for (int lod = 0; lod < terrain.lodCount; lod++)
+    {
+        Mesh *mesh = &terrain.chunks[lod*chunkCount];
+        mesh->indices = GenTerrainLodIndices(lod, &mesh->triangleCount);
+        mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+        mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), false);
+    }
+
+    for (int chunk = 0; chunk < chunkCount; chunk++)
+    {
+        Mesh mesh = GenTerrainChunkMesh(terrain, chunk%terrain.chunksX, chunk/terrain.chunksX);
+
+        // NOTE: Chunk vertex arrays are uploaded without indices, level indices buffer is bound on draw
+        UploadMesh(&mesh, false);
+
+        for (int lod = 0; lod < terrain.lodCount; lod++)
+        {
+            Mesh *lodMesh = &terrain.chunks[lod*chunkCount + chunk];
+            unsigned int *vboId = (chunk == 0)? lodMesh->vboId : (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+            unsigned int indicesId = terrain.chunks[lod*chunkCount].vboId[6];
+
+            memcpy(vboId, mesh.vboId, MAX_MESH_VERTEX_BUFFERS*sizeof(unsigned int));
+            vboId[6] = indicesId;
+
+            Mesh shared = mesh;
+            shared.indices = terrain.chunks[lod*chunkCount].indices;
+            shared.triangleCount = terrain.chunks[lod*chunkCount].triangleCount;
+            shared.vboId = vboId;
+
+            *lodMesh = shared;
+        }
+
+        RL_FREE(mesh.vboId);
+    }
+
+    TRACELOG(LOG_INFO, "MODEL: Terrain loaded successfully (%i chunks, %i levels of detail)", chunkCount, terrain.lodCount);
+
+    return terrain;
+}
+
+// Unload terrain heights and chunks meshes (RAM and VRAM)
+// NOTE: Chunks vertex data is owned by level 0 meshes, indices by every level first chunk
+void UnloadTerrain(Terrain terrain)
+{
+    int chunkCount = terrain.chunksX*terrain.chunksZ;
+
+    for (int lod = 0; lod < terrain.lodCount; lod++)
+    {
+        for (int chunk = 0; chunk < chunkCount; chunk++)
+        {
+            Mesh *mesh = &terrain.chunks[lod*chunkCount + chunk];
+
+            if (lod == 0)
+            {
+                rlUnloadVertexArray(mesh->vaoId);
+                for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) if (i != 6) rlUnloadVertexBuffer(mesh->vboId[i]);
+
+                RL_FREE(mesh->vertices);
+                RL_FREE(mesh->texcoords);
+                RL_FREE(mesh->normals);
+            }
+
+            if (chunk == 0)
+            {
+                rlUnloadVertexBuffer(mesh->vboId[6]);
+                RL_FREE(mesh->indices);
+            }
+
+            RL_FREE(mesh->vboId);
+        }
+    }
+
+    RL_FREE(terrain.chunks);
+    RL_FREE(terrain.heights);
+}
+
+// Draw terrain chunks, chunks outside view frustum are skipped
+// NOTE: View position and frustum are taken from current view and projection (BeginMode3D()), every
+// chunk level is selected by view distance to chunk bounds: level n is used beyond lodDistance*2^(n - 1)
+void DrawTerrain(Terrain terrain, Material material, Vector3 position)
+{
+    Matrix transform = MatrixTranslate(position.x, position.y, position.z);
+    Matrix matWorld = MatrixMultiply(transform, rlGetMatrixTransform());
+    Matrix matView = rlGetMatrixModelview();
+    Frustum frustum = GetMatrixFrustum(MatrixMultiply(matView, rlGetMatrixProjection()));
+
+    // Get view position in terrain space
+    Matrix matViewInv = MatrixInvert(MatrixMultiply(matWorld, matView));
+    Vector3 viewPosition = { matViewInv.m12, matViewInv.m13, matViewInv.m14 };
+
+    int chunkCount = terrain.chunksX*terrain.chunksZ;
+
+    for (int chunk = 0; chunk < chunkCount; chunk++)
+    {
+        Mesh mesh = terrain.chunks[chunk];
+
+        if (!CheckFrustumMesh(frustum, mesh, matWorld)) continue;
+
+        Vector3 closest = Vector3Clamp(viewPosition, mesh.boundsMin, mesh.boundsMax);
+        float distance = Vector3Distance(viewPosition, closest);
+
+        int lod = 0;
+        for (float lodDistance = terrain.lodDistance; (lod < terrain.lodCount - 1) && (distance > lodDistance); lodDistance *= 2.0f) lod++;
+
+        DrawMesh(terrain.chunks[lod*chunkCount + chunk], material, transform);
+    }
+}
+
+// Get terrain surface height at world position (x, z), terrain placed at position
+// NOTE: Height is interpolated on cell triangles (full resolution level surface), not bilinear
+float GetTerrainHeight(Terrain terrain, Vector3 position, float x, float z)
+{
+    return position.y + GetTerrainSurface(terrain, x - position.x, z - position.z, NULL);
+}
+
+// Get terrain surface normal at world position (x, z), terrain placed at position
+// NOTE: Normal is the cell triangle normal, consistent with GetTerrainHeight() slope
+Vector3 GetTerrainNormal(Terrain terrain, Vector3 position, float x, float z)
+{
+    Vector3 normal = { 0.0f, 1.0f, 0.0f };
+
+    GetTerrainSurface(terrain, x - position.x, z - position.z, &normal);
+
+    return normal;
+}
+
+// Get terrain surface heights at many world positions, points are provided as (x, z)
+void GetTerrainHeights(Terrain terrain, Vector3 position, const Vector2 *points, float *heights, int count)
+{
+    if ((points == NULL) || (heights == NULL)) return;
+
+    for (int i = 0; i < count; i++) heights[i] = position.y + GetTerrainSurface(terrain, points[i].x - position.x, points[i].y - position.z, NULL);
+}
+
+// Get collision info between ray and terrain surface, terrain placed at position
+// NOTE: Ray is clipped to terrain bounds and heightmap cells are traversed in ray order (DDA),
+// only cells crossed by ray are tested (two triangles per cell), first hit is the closest one
+RayCollision GetRayCollisionTerrain(Ray ray, Terrain terrain, Vector3 position)
+{
+    RayCollision collision = { 0 };
+
+    if (terrain.heights == NULL) return collision;
+
+    float cellX = terrain.size.x/terrain.width;
+    float cellZ = terrain.size.z/terrain.depth;
+    Vector3 origin = Vector3Subtract(ray.position, position);
+    Vector3 direction = ray.direction;
+
+    // Clip ray to terrain bounds (slabs), heights are in range [0..size.y]
+    float boundsMin[3] = { 0.0f, fminf(0.0f, terrain.size.y), 0.0f };
+    float boundsMax[3] = { (terrain.width - 1)*cellX, fmaxf(0.0f, terrain.size.y), (terrain.depth - 1)*cellZ };
+    float rayOrigin[3] = { origin.x, origin.y, origin.z };
+    float rayDirection[3] = { direction.x, direction.y, direction.z };
+    float tEnter = 0.0f;
+    float tExit = FLT_MAX;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        if (fabsf(rayDirection[axis]) < EPSILON)
+        {
+            if ((rayOrigin[axis] < boundsMin[axis]) || (rayOrigin[axis] > boundsMax[axis])) return collision;
+        }
+        else
+        {
+            float t0 = (boundsMin[axis] - rayOrigin[axis])/rayDirection[axis];
+            float t1 = (boundsMax[axis] - rayOrigin[axis])/rayDirection[axis];
+            tEnter = fmaxf(tEnter, fminf(t0, t1));
+            tExit = fminf(tExit, fmaxf(t0, t1));
+        }
+    }
+
+    if (tEnter > tExit) return collision;
+
+    // Start cell, containing ray entry point
+    Vector3 start = Vector3Add(origin, Vector3Scale(direction, tEnter));
+    int cx = (int)(start.x/cellX);
+    int cz = (int)(start.z/cellZ);
+    cx = (cx < 0)? 0 : ((cx > terrain.width - 2)? terrain.width - 2 : cx);
+    cz = (cz < 0)? 0 : ((cz > terrain.depth - 2)? terrain.depth - 2 : cz);
+
+    int stepX = (direction.x > 0.0f)? 1 : -1;
+    int stepZ = (direction.z > 0.0f)? 1 : -1;
+    float tMaxX = (fabsf(direction.x) < EPSILON)? FLT_MAX : (((cx + ((stepX > 0)? 1 : 0))*cellX - origin.x)/direction.x);
+    float tMaxZ = (fabsf(direction.z) < EPSILON)? FLT_MAX : (((cz + ((stepZ > 0)? 1 : 0))*cellZ - origin.z)/direction.z);
+    float tDeltaX = (fabsf(direction.x) < EPSILON)? FLT_MAX : cellX/fabsf(direction.x);
+    float tDeltaZ = (fabsf(direction.z) < EPSILON)? FLT_MAX : cellZ/fabsf(direction.z);
+
+    Ray localRay = { origin, direction };
+
+    while ((cx >= 0) && (cx < terrain.width - 1) && (cz >= 0) && (cz < terrain.depth - 1))
+    {
+        // Cell triangles, same layout as terrain chunks meshes
+        Vector3 v00 = { cx*cellX, terrain.heights[cx + cz*terrain.width], cz*cellZ };
+        Vector3 v10 = { (cx + 1)*cellX, terrain.heights[(cx + 1) + cz*terrain.width], cz*cellZ };
+        Vector3 v01 = { cx*cellX, terrain.heights[cx + (cz + 1)*terrain.width], (cz + 1)*cellZ };
+        Vector3 v11 = { (cx + 1)*cellX, terrain.heights[(cx + 1) + (cz + 1)*terrain.width], (cz + 1)*cellZ };
+
+        RayCollision hit = GetRayCollisionTriangle(localRay, v00, v01, v10);
+        RayCollision other = GetRayCollisionTriangle(localRay, v10, v01, v11);
+        if (other.hit && (!hit.hit || (other.distance < hit.distance))) hit = other;
+
+        if (hit.hit)
+        {
+            collision = hit;
+            collision.point = Vector3Add(hit.point, position);
+            break;
+        }
+
+        // Move to next cell crossed by ray
+        if (tMaxX < tMaxZ)
+        {
+            if (tMaxX > tExit) break;
+            cx += stepX;
+            tMaxX += tDeltaX;
+        }
+        else
+        {
+            if (tMaxZ > tExit) break;
+            cz += stepZ;
+            tMaxZ += tDeltaZ;
+        }
+    }
+
+    return collision;
+}
+
+// Generate terrain chunk mesh (CPU only, no upload, no indices)
+// NOTE: Vertices grid is (TERRAIN_CHUNK_SIZE + 1)^2 heightmap samples (clamped to heightmap borders), followed by
+// 4 border skirts rows (-Z, +Z, -X, +X) lowered to chunk minimum height
+static Mesh GenTerrainChunkMesh(Terrain terrain, int chunkX, int chunkZ)
+{
+    Mesh mesh = { 0 };
+
+    const int rowSize = TERRAIN_CHUNK_SIZE + 1;
+    Vector3 scaleFactor = { terrain.size.x/terrain.width, 1.0f, terrain.size.z/terrain.depth };
+
+    mesh.vertexCount = rowSize*rowSize + 4*rowSize;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    float minHeight = FLT_MAX;
+    float maxHeight = -FLT_MAX;
+
+    for (int j = 0; j < rowSize; j++)
+    {
+        for (int i = 0; i < rowSize; i++)
+        {
+            int x = chunkX*TERRAIN_CHUNK_SIZE + i;
+            int z = chunkZ*TERRAIN_CHUNK_SIZE + j;
+            if (x > terrain.width - 1) x = terrain.width - 1;
+            if (z > terrain.depth - 1) z = terrain.depth - 1;
+
+            float height = terrain.heights[x + z*terrain.width];
+            minHeight = fminf(minHeight, height);
+            maxHeight = fmaxf(maxHeight, height);
+
+            // Normal from heightmap central differences
+            float left = terrain.heights[((x > 0)? x - 1 : x) + z*terrain.width];
+            float right = terrain.heights[((x < terrain.width - 1)? x + 1 : x) + z*terrain.width];
+            float back = terrain.heights[x + ((z > 0)? z - 1 : z)*terrain.width];
+            float front = terrain.heights[x + ((z < terrain.depth - 1)? z + 1 : z)*terrain.width];
+            Vector3 normal = Vector3Normalize((Vector3){ (left - right)*scaleFactor.z, 2.0f*scaleFactor.x*scaleFactor.z, (back - front)*scaleFactor.x });
+
+            int v = i + j*rowSize;
+            mesh.vertices[v*3 + 0] = (float)x*scaleFactor.x;
+            mesh.vertices[v*3 + 1] = height;
+            mesh.vertices[v*3 + 2] = (float)z*scaleFactor.z;
+            mesh.normals[v*3 + 0] = normal.x;
+            mesh.normals[v*3 + 1] = normal.y;
+            mesh.normals[v*3 + 2] = normal.z;
+            mesh.texcoords[v*2 + 0] = (float)x/(terrain.width - 1);
+            mesh.texcoords[v*2 + 1] = (float)z/(terrain.depth - 1);
+        }
+    }
+
+    // Skirts vertices: border vertices lowered below chunk minimum height
+    // NOTE: Neighbour chunks border heights never go under this chunk border samples minimum
+    float skirtHeight = minHeight - 0.01f*fmaxf(maxHeight - minHeight, 1.0f);
+
+    for (int edge = 0; edge < 4; edge++)
+    {
+        for (int k = 0; k < rowSize; k++)
+        {
+            int i = (edge < 2)? k : ((edge == 2)? 0 : TERRAIN_CHUNK_SIZE);
+            int j = (edge < 2)? ((edge == 0)? 0 : TERRAIN_CHUNK_SIZE) : k;
+            int src = i + j*rowSize;
+            int dst = rowSize*rowSize + edge*rowSize + k;
+
+            memcpy(&mesh.vertices[dst*3], &mesh.vertices[src*3], 3*sizeof(float));
+            memcpy(&mesh.normals[dst*3], &mesh.normals[src*3], 3*sizeof(float));
+            memcpy(&mesh.texcoords[dst*2], &mesh.texcoords[src*2], 2*sizeof(float));
+            mesh.vertices[dst*3 + 1] = skirtHeight;
+        }
+    }
+
+    return mesh;
+}
+
+// Get terrain surface height at terrain space position (x, z), normal is optional
+// NOTE: Cells are split in two triangles as chunks meshes, (x0, z0)-(x1, z0)-(x0, z1) and (x1, z0)-(x0, z1)-(x1, z1)
+static float GetTerrainSurface(Terrain terrain, float x, float z, Vector3 *normal)
+{
+    if (terrain.heights == NULL) return 0.0f;
+
+    float cellX = terrain.size.x/terrain.width;
+    float cellZ = terrain.size.z/terrain.depth;
+
+    // Cell coordinates, clamped to terrain borders
+    float gx = fminf(fmaxf(x/cellX, 0.0f), (float)(terrain.width - 1));
+    float gz = fminf(fmaxf(z/cellZ, 0.0f), (float)(terrain.depth - 1));
+    int cx = ((int)gx < terrain.width - 2)? (int)gx : terrain.width - 2;
+    int cz = ((int)gz < terrain.depth - 2)? (int)gz : terrain.depth - 2;
+    float fx = gx - cx;
+    float fz = gz - cz;
+
+    float h00 = terrain.heights[cx + cz*terrain.width];
+    float h10 = terrain.heights[(cx + 1) + cz*terrain.width];
+    float h01 = terrain.heights[cx + (cz + 1)*terrain.width];
+    float h11 = terrain.heights[(cx + 1) + (cz + 1)*terrain.width];
+
+    float height = 0.0f;
+    float slopeX = 0.0f;    // Height change along cell X
+    float slopeZ = 0.0f;    // Height change along cell Z
+
+    if ((fx + fz) <= 1.0f)
+    {
+        slopeX = h10 - h00;
+        slopeZ = h01 - h00;
+        height = h00 + fx*slopeX + fz*slopeZ;
+    }
+    else
+    {
+        slopeX = h11 - h01;
+        slopeZ = h11 - h10;
+        height = h11 - (1.0f - fx)*slopeX - (1.0f - fz)*slopeZ;
+    }
+
+    if (normal != NULL) *normal = Vector3Normalize((Vector3){ -slopeX*cellZ, cellX*cellZ, -slopeZ*cellX });
+
+    return height;
+}
+
+// Generate terrain level of detail indices, shared by all chunks (one vertex every 2^lod samples)
+static unsigned short *GenTerrainLodIndices(int lod, int *triangleCount)
+{
+    const int rowSize = TERRAIN_CHUNK_SIZE + 1;
+    int step = 1 << lod;
+    int cells = TERRAIN_CHUNK_SIZE/step;
+
+    *triangleCount = cells*cells*2 + 4*cells*2;
+    unsigned short *indices = (unsigned short *)RL_MALLOC(*triangleCount*3*sizeof(unsigned short));
+    int index = 0;
+
+    // Grid quads, same triangles layout as GenMeshHeightmap()
+    for (int j = 0; j < TERRAIN_CHUNK_SIZE; j += step)
+    {
+        for (int i = 0; i < TERRAIN_CHUNK_SIZE; i += step)
+        {
+            unsigned short v00 = (unsigned short)(i + j*rowSize);
+            unsigned short v10 = (unsigned short)(i + step + j*rowSize);
+            unsigned short v01 = (unsigned short)(i + (j + step)*rowSize);
+            unsigned short v11 = (unsigned short)(i + step + (j + step)*rowSize);
+
+            indices[index++] = v00; indices[index++] = v01; indices[index++] = v10;
+            indices[index++] = v10; indices[index++] = v01; indices[index++] = v11;
+        }
+    }
+
+    // Skirts quads, facing out of chunk: -Z, +Z, -X, +X edges
+    for (int edge = 0; edge < 4; edge++)
+    {
+        for (int k = 0; k < TERRAIN_CHUNK_SIZE; k += step)
+        {
+            int i0 = (edge < 2)? k : ((edge == 2)? 0 : TERRAIN_CHUNK_SIZE);
+            int j0 = (edge < 2)? ((edge == 0)? 0 : TERRAIN_CHUNK_SIZE) : k;
+            int i1 = (edge < 2)? k + step : i0;
+            int j1 = (edge < 2)? j0 : k + step;
+
+            unsigned short t0 = (unsigned short)(i0 + j0*rowSize);
+            unsigned short t1 = (unsigned short)(i1 + j1*rowSize);
+            unsigned short b0 = (unsigned short)(rowSize*rowSize + edge*rowSize + k);
+            unsigned short b1 = (unsigned short)(b0 + step);
+
+            if ((edge == 0) || (edge == 3))
+            {
+                indices[index++] = t0; indices[index++] = t1; indices[index++] = b0;
+                indices[index++] = t1; indices[index++] = b1; indices[index++] = b0;
+            }
+            else
+            {
+                indices[index++] = t0; indices[index++] = b0; indices[index++] = t1;
+                indices[index++] = t1; indices[index++] = b0; indices[index++] = b1;
+            }
+        }
+    }
+
+    return indices;
+}
+
+#if defined(SUPPORT_TILEMAP)
+// Load empty tilemap, all tiles are empty (-1) and no chunk mesh is generated until tiles are set
+// NOTE: Tiles are placed in pixels units (tile size), scale them with Camera2D zoom
+Tilemap LoadTilemap(Texture2D tileset, int tileWidth, int tileHeight, int width, int height, int layerCount)
+{
+    Tilemap map = { 0 };
+
+    if ((tileWidth <= 0) || (tileHeight <= 0) || (width <= 0) || (height <= 0) || (layerCount <= 0)) return map;
+
+    map.width = width;
+    map.height = height;
+    map.layerCount = layerCount;
+    map.tileWidth = tileWidth;
+    map.tileHeight = tileHeight;
+    map.tileset = tileset;
+
+    map.tiles = (short *)RL_MALLOC(width*height*layerCount*sizeof(short));
+    memset(map.tiles, 0xff, width*height*layerCount*sizeof(short));     // All tiles set to -1 (empty)
+    map.animations = (TileAnimation *)RL_CALLOC(TILEMAP_MAX_ANIMATIONS, sizeof(TileAnimation));
+
+    map.chunksX = (width + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+    map.chunksY = (height + TILEMAP_CHUNK_SIZE - 1)/TILEMAP_CHUNK_SIZE;
+
+    int chunkCount = map.chunksX*map.chunksY*layerCount;
+    map.chunks = (Mesh *)RL_CALLOC(chunkCount, sizeof(Mesh));
+    map.chunksDirty = (bool *)RL_CALLOC(chunkCount, sizeof(bool));
+
+    return map;
+}
+
+// Unload tilemap data and chunks meshes
+void UnloadTilemap(Tilemap map)
+{
+    int chunkCount = map.chunksX*map.chunksY*map.layerCount;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (map.chunks[i].vertexCount > 0) UnloadMesh(map.chunks[i]);
+    }
+
+    RL_FREE(map.tiles);
+    RL_FREE(map.animations);
+    RL_FREE(map.chunks);
+    RL_FREE(map.chunksDirty);
+}
+
+// Set tile id, tile chunk layer is marked for rebuild
+void SetTilemapTile(Tilemap *map, int layer, int x, int y, int tile)
+{
+    if ((layer < 0) || (x < 0) || (y < 0) || (layer >= map->layerCount) || (x >= map->width) || (y >= map->height)) return;
+
+    short *value = &map->tiles[x + y*map->width + layer*map->width*map->height];
+    if (tile < 0) tile = -1;
+    if (*value == tile) return;
+
+    *value = (short)tile;
+    map->chunksDirty[x/TILEMAP_CHUNK_SIZE + (y/TILEMAP_CHUNK_SIZE)*map->chunksX + layer*map->chunksX*map->chunksY] = true;
+}
+
+// Get tile id, -1 if empty or outside map
+int GetTilemapTile(Tilemap map, int layer, int x, int y)
+{
+    if ((layer < 0) || (x < 0) || (y < 0) || (layer >= map.layerCount) || (x >= map.width) || (y >= map.height)) return -1;
+
+    return map.tiles[x + y*map.width + layer*map.width*map.height];
+}
+
+// Set layer tiles ids, only chunks with changed tiles are marked for rebuild
+void SetTilemapLayer(Tilemap *map, int layer, const int *tiles)
+{
+    if ((layer < 0) || (layer >= map->layerCount) || (tiles == NULL)) return;
+
+    for (int y = 0; y < map->height; y++)
+    {
+        for (int x = 0; x < map->width; x++) SetTilemapTile(map, layer, x, y, tiles[x + y*map->width]);
+    }
+}
+
+// Set animated tile, tiles using the first frame id cycle through the following frameCount tileset tiles
+// NOTE: Frames are selected on tilemap shader from tiles offsets uniforms, chunks meshes are not rebuilt while
+// animating, animations changes mark all chunks for rebuild (animation index is stored in chunks vertex data)
+void SetTilemapAnimation(Tilemap *map, int tile, int frameCount, float frameTime)
+{
+    if ((tile < 0) || (map->animations == NULL)) return;
+
+    int index = 0;
+    while ((index < map->animationCount) && (map->animations[index].tile != tile)) index++;
+
+    if (frameCount < 2)
+    {
+        // Remove animation, keeping animations order
+        if (index == map->animationCount) return;
+
+        for (int i = index; i < map->animationCount - 1; i++) map->animations[i] = map->animations[i + 1];
+        map->animationCount--;
+    }
+    else if (index == map->animationCount)
+    {
+        if (map->animationCount >= TILEMAP_MAX_ANIMATIONS)
+        {
+            TRACELOG(LOG_WARNING, "TILEMAP: Maximum animated tiles reached (%i), tile %i not animated", TILEMAP_MAX_ANIMATIONS, tile);
+            return;
+        }
+
+        map->animations[index] = (TileAnimation){ tile, frameCount, frameTime };
+        map->animationCount++;
+    }
+    else
+    {
+        // Animation already stored on chunks vertex data, no rebuild required
+        map->animations[index].frameCount = frameCount;
+        map->animations[index].frameTime = frameTime;
+        return;
+    }
+
+    int chunkCount = map->chunksX*map->chunksY*map->layerCount;
+    for (int i = 0; i < chunkCount; i++) map->chunksDirty[i] = true;
+}
+
+// Rebuild and upload dirty chunks layers meshes, every chunk layer uses its own vertex buffers
+void UpdateTilemap(Tilemap *map)
+{
+    int chunkCount = map->chunksX*map->chunksY*map->layerCount;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (!map->chunksDirty[i]) continue;
+
+        if (map->chunks[i].vertexCount > 0) UnloadMesh(map->chunks[i]);
+
+        map->chunks[i] = GenTilemapChunkMesh(*map, i);
+        map->chunksDirty[i] = false;
+
+        if (map->chunks[i].vertexCount > 0) UploadMesh(&map->chunks[i], false);
+    }
+}
+
+// Draw tilemap layers in order
+void DrawTilemap(Tilemap map, Camera2D camera, Vector2 position, Color tint)
+{
+    for (int layer = 0; layer < map.layerCount; layer++) DrawTilemapLayer(map, layer, camera, position, tint);
+}
+
+// Draw tilemap layer, only chunks overlapping camera view are drawn
+// NOTE: Expected to be called inside BeginMode2D(camera), view is computed for current framebuffer size,
+// pending batched draws are drawn first to keep 2D drawing order
+void DrawTilemapLayer(Tilemap map, int layer, Camera2D camera, Vector2 position, Color tint)
+{
+    if ((layer < 0) || (layer >= map.layerCount)) return;
+
+    float screenWidth = (float)rlGetFramebufferWidth();
+    float screenHeight = (float)rlGetFramebufferHeight();
+
+    // Get camera view bounds in tilemap space (rotated camera view corners)
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0.0f, 0.0f }, camera),
+        GetScreenToWorld2D((Vector2){ screenWidth, 0.0f }, camera),
+        GetScreenToWorld2D((Vector2){ 0.0f, screenHeight }, camera),
+        GetScreenToWorld2D((Vector2){ screenWidth, screenHeight }, camera)
+    };
+
+    Vector2 viewMin = corners[0];
+    Vector2 viewMax = corners[0];
+
+    for (int i = 1; i < 4; i++)
+    {
+        viewMin.x = fminf(viewMin.x, corners[i].x);
+        viewMin.y = fminf(viewMin.y, corners[i].y);
+        viewMax.x = fmaxf(viewMax.x, corners[i].x);
+        viewMax.y = fmaxf(viewMax.y, corners[i].y);
+    }
+
+    float chunkWidth = (float)(TILEMAP_CHUNK_SIZE*map.tileWidth);
+    float chunkHeight = (float)(TILEMAP_CHUNK_SIZE*map.tileHeight);
+
+    int startX = (int)floorf((viewMin.x - position.x)/chunkWidth);
+    int startY = (int)floorf((viewMin.y - position.y)/chunkHeight);
+    int endX = (int)floorf((viewMax.x - position.x)/chunkWidth);
+    int endY = (int)floorf((viewMax.y - position.y)/chunkHeight);
+
+    if ((endX < 0) || (endY < 0) || (startX >= map.chunksX) || (startY >= map.chunksY)) return;
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX >= map.chunksX) endX = map.chunksX - 1;
+    if (endY >= map.chunksY) endY = map.chunksY - 1;
+
+    MaterialMap maps[MAX_MATERIAL_MAPS] = { 0 };
+    maps[MATERIAL_MAP_DIFFUSE].texture = map.tileset;
+    maps[MATERIAL_MAP_DIFFUSE].color = tint;
+
+    Material material = { 0 };
+    material.shader = GetTilemapShader(map);
+    material.maps = maps;
+
+    Matrix transform = MatrixTranslate(position.x, position.y, 0.0f);
+    const Mesh *chunks = &map.chunks[layer*map.chunksX*map.chunksY];
+
+    rlDrawRenderBatchActive();
+
+    for (int y = startY; y <= endY; y++)
+    {
+        for (int x = startX; x <= endX; x++)
+        {
+            if (chunks[x + y*map.chunksX].triangleCount > 0) DrawMesh(chunks[x + y*map.chunksX], material, transform);
+        }
+    }
+}
+
+// Generate tilemap chunk layer mesh (CPU only, no upload), one quad per non-empty tile
+// NOTE: Animated tiles store their animation index + 1 on texcoords2.x (0: static tile), texcoords2 is
+// only generated for tilemaps with animated tiles
+static Mesh GenTilemapChunkMesh(Tilemap map, int chunk)
+{
+    Mesh mesh = { 0 };
+
+    int layerChunks = map.chunksX*map.chunksY;
+    int layer = chunk/layerChunks;
+    int chunkX = (chunk%layerChunks)%map.chunksX;
+    int chunkY = (chunk%layerChunks)/map.chunksX;
+
+    int startX = chunkX*TILEMAP_CHUNK_SIZE;
+    int startY = chunkY*TILEMAP_CHUNK_SIZE;
+    int endX = (startX + TILEMAP_CHUNK_SIZE < map.width)? startX + TILEMAP_CHUNK_SIZE : map.width;
+    int endY = (startY + TILEMAP_CHUNK_SIZE < map.height)? startY + TILEMAP_CHUNK_SIZE : map.height;
+
+    const short *tiles = &map.tiles[layer*map.width*map.height];
+
+    int tileCount = 0;
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++) if (tiles[x + y*map.width] >= 0) tileCount++;
+    }
+
+    if (tileCount == 0) return mesh;
+
+    int columns = (map.tileset.width >= map.tileWidth)? map.tileset.width/map.tileWidth : 1;
+    float width = (map.tileset.width > 0)? (float)map.tileset.width : (float)map.tileWidth;
+    float height = (map.tileset.height > 0)? (float)map.tileset.height : (float)map.tileHeight;
+
+    mesh.vertexCount = tileCount*4;
+    mesh.triangleCount = tileCount*2;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    if (map.animationCount > 0) mesh.texcoords2 = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+    int vertex = 0;
+    int index = 0;
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            int tile = tiles[x + y*map.width];
+            if (tile < 0) continue;
+
+            float x0 = (float)(x*map.tileWidth);
+            float y0 = (float)(y*map.tileHeight);
+            float x1 = x0 + (float)map.tileWidth;
+            float y1 = y0 + (float)map.tileHeight;
+
+            float u0 = (float)((tile%columns)*map.tileWidth)/width;
+            float v0 = (float)((tile/columns)*map.tileHeight)/height;
+            float u1 = u0 + (float)map.tileWidth/width;
+            float v1 = v0 + (float)map.tileHeight/height;
+
+            // Quad vertex order matches rlgl batch quads: top-left, bottom-left, bottom-right, top-right
+            const float positions[8] = { x0, y0, x0, y1, x1, y1, x1, y0 };
+            const float texcoords[8] = { u0, v0, u0, v1, u1, v1, u1, v0 };
+
+            for (int k = 0; k < 4; k++)
+            {
+                mesh.vertices[(vertex + k)*3 + 0] = positions[k*2 + 0];
+                mesh.vertices[(vertex + k)*3 + 1] = positions[k*2 + 1];
+                mesh.vertices[(vertex + k)*3 + 2] = 0.0f;
+                mesh.texcoords[(vertex + k)*2 + 0] = texcoords[k*2 + 0];
+                mesh.texcoords[(vertex + k)*2 + 1] = texcoords[k*2 + 1];
+            }
+
+            if (mesh.texcoords2 != NULL)
+            {
+                int animation = 0;
+                while ((animation < map.animationCount) && (map.animations[animation].tile != tile)) animation++;
+
+                float value = (animation < map.animationCount)? (float)(animation + 1) : 0.0f;
+                for (int k = 0; k < 4; k++)
+                {
+                    mesh.texcoords2[(vertex + k)*2 + 0] = value;
+                    mesh.texcoords2[(vertex + k)*2 + 1] = 0.0f;
+                }
+            }
+
+            mesh.indices[index++] = (unsigned short)(vertex);
+            mesh.indices[index++] = (unsigned short)(vertex + 1);
+            mesh.indices[index++] = (unsigned short)(vertex + 2);
+            mesh.indices[index++] = (unsigned short)(vertex);
+            mesh.indices[index++] = (unsigned short)(vertex + 2);
+            mesh.indices[index++] = (unsigned short)(vertex + 3);
+
+            vertex += 4;
+        }
+    }
+
+    return mesh;
+}
+
+// Get shader used to draw tilemap chunks, tilemaps with animated tiles use built-in tilemap shader
+// NOTE: Animations current frames offsets (texcoords units) are computed from GetTime() and uploaded on every draw,
+// on OpenGL 1.1 (no shaders) animated tiles show their first frame
+static Shader GetTilemapShader(Tilemap map)
+{
+    Shader shader = { rlGetShaderIdDefault(), rlGetShaderLocsDefault() };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (map.animationCount > 0)
+    {
+        if (!tilemapShaderLoaded) LoadShaderTilemap();
+
+        if (tilemapShader.id > 0)
+        {
+            Vector2 offsets[TILEMAP_MAX_ANIMATIONS + 1] = { 0 };
+            int columns = (map.tileset.width >= map.tileWidth)? map.tileset.width/map.tileWidth : 1;
+            float width = (map.tileset.width > 0)? (float)map.tileset.width : (float)map.tileWidth;
+            float height = (map.tileset.height > 0)? (float)map.tileset.height : (float)map.tileHeight;
+            double time = GetTime();
+
+            for (int i = 0; i < map.animationCount; i++)
+            {
+                TileAnimation animation = map.animations[i];
+                int frame = (animation.frameTime > 0.0f)? (int)(time/animation.frameTime)%animation.frameCount : 0;
+                int tile = animation.tile + frame;
+
+                offsets[i + 1].x = (float)(((tile%columns) - (animation.tile%columns))*map.tileWidth)/width;
+                offsets[i + 1].y = (float)(((tile/columns) - (animation.tile/columns))*map.tileHeight)/height;
+            }
+
+            SetShaderValueV(tilemapShader, tilemapShaderOffsetsLoc, offsets, SHADER_UNIFORM_VEC2, map.animationCount + 1);
+
+            shader = tilemapShader;
+        }
+    }
+#endif
+
+    return shader;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#define TILEMAP_STRINGIFY_(x)   #x
+#define TILEMAP_STRINGIFY(x)    TILEMAP_STRINGIFY_(x)
+
+// Load built-in tilemap shader
+// NOTE: Mirrors rlgl default shader, texcoords are offset by animation frame offset (animation index on texcoord2.x)
+static void LoadShaderTilemap(void)
+{
+    const char *tilemapVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec2 vertexTexCoord2;           \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec2 tileOffsets[" TILEMAP_STRINGIFY(TILEMAP_MAX_ANIMATIONS) " + 1]; \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord + tileOffsets[int(vertexTexCoord2.x)]; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *tilemapFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    tilemapShaderLoaded = true;
+    tilemapShader = LoadShaderFromMemory(tilemapVShaderCode, tilemapFShaderCode);
+    tilemapShaderOffsetsLoc = GetShaderLocation(tilemapShader, "tileOffsets");
+
+    if ((tilemapShader.id > 0) && (tilemapShader.id != rlGetShaderIdDefault()) && (tilemapShaderOffsetsLoc != -1)) TRACELOG(LOG_INFO, "SHADER: [ID %i] Tilemap shader loaded successfully", tilemapShader.id);
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load tilemap shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (tilemapShader.id != rlGetShaderIdDefault()) UnloadShader(tilemapShader);
+        else RL_FREE(tilemapShader.locs);
+
+        tilemapShader = (Shader){ 0 };
+    }
+}
+#endif
+#endif      // SUPPORT_TILEMAP
+
+// Unload tilemap shader (called by CloseWindow())
+extern void UnloadTilemapShader(void)
+{
+#if defined(SUPPORT_TILEMAP) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (tilemapShader.id > 0) UnloadShader(tilemapShader);
+
+    tilemapShader = (Shader){ 0 };
+    tilemapShaderLoaded = false;
+#endif
+}
+
+#if defined(WORLD_STREAMING_SUPPORTED)
+// Load world manifest, only sectors grid is loaded, sectors content is streamed by UpdateWorld()
+// NOTE: World manifest is a text file with a "size <sectorSize>" line and one "sector <x> <z> <manifest> [priority]"
+// line per sector (manifest path relative to world file), lines starting with '#' are comments
+// NOTE: Sectors are loaded within one sector size distance and unloaded beyond 1.5 sector sizes by default
+World LoadWorld(const char *fileName)
+{
+    World world = { 0 };
+
+    char *text = LoadFileText(fileName);
+    if (text == NULL) return world;
+
+    char dirPath[512] = { 0 };
+    strncpy(dirPath, GetDirectoryPath(fileName), sizeof(dirPath) - 1);
+
+    int capacity = 0;
+    char *line = text;
+
+    while (line != NULL)
+    {
+        char *next = strchr(line, '\n');
+        if (next != NULL) *next++ = '\0';
+
+        char path[256] = { 0 };
+        int x = 0;
+        int z = 0;
+        int priority = 0;
+
+        if (strncmp(line, "size ", 5) == 0) sscanf(line + 5, "%f", &world.sectorSize);
+        else if ((strncmp(line, "sector ", 7) == 0) && (sscanf(line + 7, "%i %i %255s %i", &x, &z, path, &priority) >= 3))
+        {
+            if (world.sectorCount == capacity)
+            {
+                capacity = (capacity == 0)? 64 : capacity*2;
+                world.sectors = (WorldSector *)RL_REALLOC(world.sectors, capacity*sizeof(WorldSector));
+            }
+
+            WorldSector *sector = &world.sectors[world.sectorCount];
+            memset(sector, 0, sizeof(WorldSector));
+            sector->x = x;
+            sector->z = z;
+            sector->priority = priority;
+            sector->manifest = (char *)RL_MALLOC(strlen(dirPath) + strlen(path) + 2);
+            sprintf(sector->manifest, "%s/%s", dirPath, path);
+
+            world.sectorCount++;
+        }
+
+        line = next;
+    }
+
+    UnloadFileText(text);
+
+    if (world.sectorSize <= 0.0f)
+    {
+        TRACELOG(LOG_WARNING, "WORLD: [%s] Sectors size not defined, using 64.0", fileName);
+        world.sectorSize = 64.0f;
+    }
+
+    world.loadDistance = world.sectorSize;
+    world.unloadDistance = 1.5f*world.sectorSize;
+
+    TRACELOG(LOG_INFO, "WORLD: [%s] World loaded successfully (%i sectors)", fileName, world.sectorCount);
+
+    return world;
+}
+
+// Unload world and loaded sectors content
+void UnloadWorld(World world)
+{
+    for (int i = 0; i < world.sectorCount; i++)
+    {
+        UnloadWorldSector(&world, &world.sectors[i]);
+        RL_FREE(world.sectors[i].manifest);
+    }
+
+    RL_FREE(world.sectors);
+}
+
+// Stream world sectors around position
+// NOTE: Sectors within load distance are requested (highest priority first, then closest), loaded sectors beyond
+// unload distance are unloaded, and while over budget, loaded sectors out of load distance are evicted
+// (lowest priority first, then farthest); sectors in range are never evicted, new loads wait instead
+void UpdateWorld(World *world, Vector3 position)
+{
+    int loadingCount = 0;
+    int jobs = WORLD_MAX_LOAD_JOBS;
+
+    // Update sectors distances to position (XZ plane), async loads in flight are taken from available jobs
+    for (int i = 0; i < world->sectorCount; i++)
+    {
+        WorldSector *sector = &world->sectors[i];
+
+        float minX = sector->x*world->sectorSize;
+        float minZ = sector->z*world->sectorSize;
+        float dx = fmaxf(fmaxf(minX - position.x, position.x - (minX + world->sectorSize)), 0.0f);
+        float dz = fmaxf(fmaxf(minZ - position.z, position.z - (minZ + world->sectorSize)), 0.0f);
+
+        sector->distance = sqrtf(dx*dx + dz*dz);
+
+        if (sector->state == WORLD_SECTOR_LOADING)
+        {
+            loadingCount++;
+            jobs -= sector->load->pendingCount + ((sector->load->manifestHandle != 0)? 1 : 0);
+        }
+    }
+
+    // Advance loading sectors, sector is loaded once all its resources are retrieved
+    for (int i = 0; i < world->sectorCount; i++)
+    {
+        WorldSector *sector = &world->sectors[i];
+        if (sector->state != WORLD_SECTOR_LOADING) continue;
+
+        jobs -= UpdateWorldSectorLoad(sector, (jobs > 0)? jobs : 0);
+
+        rWorldSectorLoad *load = sector->load;
+
+        if ((load->manifestHandle == 0) && (load->pendingCount == 0) && (load->nextResource == (sector->modelCount + sector->textureCount)))
+        {
+            for (int m = 0; m < sector->modelCount; m++) GetWorldModelMemory(sector->models[m], sector->memory);
+            for (int t = 0; t < sector->textureCount; t++) sector->memory[WORLD_BUDGET_TEXTURES] += GetWorldTextureMemory(sector->textures[t]);
+
+            world->memory[WORLD_BUDGET_MESHES] += sector->memory[WORLD_BUDGET_MESHES];
+            world->memory[WORLD_BUDGET_TEXTURES] += sector->memory[WORLD_BUDGET_TEXTURES];
+
+            RL_FREE(load->files);
+            RL_FREE(load->handles);
+            RL_FREE(load);
+            sector->load = NULL;
+            sector->state = WORLD_SECTOR_LOADED;
+            loadingCount--;
+
+            TRACELOGD("WORLD: [%s] Sector loaded (%i models, %i textures, %i objects)", sector->manifest, sector->modelCount, sector->textureCount, sector->objectCount);
+        }
+    }
+
+    // Unload sectors out of range, sectors still loading are unloaded once loaded
+    for (int i = 0; i < world->sectorCount; i++)
+    {
+        if ((world->sectors[i].state == WORLD_SECTOR_LOADED) && (world->sectors[i].distance > world->unloadDistance)) UnloadWorldSector(world, &world->sectors[i]);
+    }
+
+    // Evict sectors kept by hysteresis while over budget
+    bool overBudget = IsWorldOverBudget(*world);
+
+    while (overBudget)
+    {
+        WorldSector *evict = NULL;
+
+        for (int i = 0; i < world->sectorCount; i++)
+        {
+            WorldSector *sector = &world->sectors[i];
+            if ((sector->state != WORLD_SECTOR_LOADED) || (sector->distance <= world->loadDistance)) continue;
+
+            if ((evict == NULL) || (sector->priority < evict->priority) ||
+                ((sector->priority == evict->priority) && (sector->distance > evict->distance))) evict = sector;
+        }
+
+        if (evict == NULL) break;
+
+        UnloadWorldSector(world, evict);
+        overBudget = IsWorldOverBudget(*world);
+    }
+
+    // Request sectors in range, their manifest is loaded first
+    while (!overBudget && (loadingCount < WORLD_MAX_SECTOR_LOADS) && (jobs > 0))
+    {
+        WorldSector *request = NULL;
+
+        for (int i = 0; i < world->sectorCount; i++)
+        {
+            WorldSector *sector = &world->sectors[i];
+            if ((sector->state != WORLD_SECTOR_UNLOADED) || (sector->distance > world->loadDistance)) continue;
+
+            if ((request == NULL) || (sector->priority > request->priority) ||
+                ((sector->priority == request->priority) && (sector->distance < request->distance))) request = sector;
+        }
+
+        if (request == NULL) break;
+
+        unsigned int handle = LoadFileDataAsync(request->manifest);
+        if (handle == 0) break;     // Async jobs slots not available, requested again on next update
+
+        request->load = (rWorldSectorLoad *)RL_CALLOC(1, sizeof(rWorldSectorLoad));
+        request->load->manifestHandle = handle;
+        request->state = WORLD_SECTOR_LOADING;
+
+        loadingCount++;
+        jobs--;
+    }
+}
+
+// Draw loaded sectors objects
+void DrawWorld(World world, Color tint)
+{
+    for (int i = 0; i < world.sectorCount; i++)
+    {
+        const WorldSector *sector = &world.sectors[i];
+        if (sector->state != WORLD_SECTOR_LOADED) continue;
+
+        for (int j = 0; j < sector->objectCount; j++)
+        {
+            Model model = sector->models[sector->objects[j].model];
+            model.transform = MatrixMultiply(model.transform, sector->objects[j].transform);
+
+            DrawModel(model, (Vector3){ 0.0f, 0.0f, 0.0f }, 1.0f, tint);
+        }
+    }
+}
+
+// Parse sector manifest, sector resources arrays and loading files paths are allocated
+// NOTE: Sector manifest lines: "model <file>", "texture <file>" and "object <model> <x> <y> <z> [<rx> <ry> <rz> [<scale>]]"
+// (model index in manifest models order, rotation in degrees), files paths are relative to sector manifest
+static void ParseWorldSectorManifest(WorldSector *sector, const char *text)
+{
+    char dirPath[512] = { 0 };
+    strncpy(dirPath, GetDirectoryPath(sector->manifest), sizeof(dirPath) - 1);
+
+    char path[256] = { 0 };
+    int objectCapacity = 0;
+
+    for (const char *line = text; line != NULL; line = strchr(line, '\n'))
+    {
+        if (*line == '\n') line++;
+
+        if ((strncmp(line, "model ", 6) == 0) && (sscanf(line + 6, "%255s", path) == 1)) sector->modelCount++;
+        else if ((strncmp(line, "texture ", 8) == 0) && (sscanf(line + 8, "%255s", path) == 1)) sector->textureCount++;
+        else if (strncmp(line, "object ", 7) == 0) objectCapacity++;
+    }
+
+    rWorldSectorLoad *load = sector->load;
+
+    sector->models = (Model *)RL_CALLOC(sector->modelCount + 1, sizeof(Model));
+    sector->textures = (Texture2D *)RL_CALLOC(sector->textureCount + 1, sizeof(Texture2D));
+    sector->objects = (WorldObject *)RL_CALLOC(objectCapacity + 1, sizeof(WorldObject));
+    load->files = (char (*)[512])RL_CALLOC(sector->modelCount + sector->textureCount + 1, 512);
+    load->handles = (unsigned int *)RL_CALLOC(sector->modelCount + sector->textureCount + 1, sizeof(unsigned int));
+
+    int modelCounter = 0;
+    int textureCounter = 0;
+
+    for (const char *line = text; line != NULL; line = strchr(line, '\n'))
+    {
+        if (*line == '\n') line++;
+
+        if ((strncmp(line, "model ", 6) == 0) && (sscanf(line + 6, "%255s", path) == 1))
+        {
+            snprintf(load->files[modelCounter], 512, "%s/%s", dirPath, path);
+            modelCounter++;
+        }
+        else if ((strncmp(line, "texture ", 8) == 0) && (sscanf(line + 8, "%255s", path) == 1))
+        {
+            snprintf(load->files[sector->modelCount + textureCounter], 512, "%s/%s", dirPath, path);
+            textureCounter++;
+        }
+        else if (strncmp(line, "object ", 7) == 0)
+        {
+            int model = -1;
+            Vector3 position = { 0 };
+            Vector3 rotation = { 0 };
+            float scale = 1.0f;
+
+            int count = sscanf(line + 7, "%i %f %f %f %f %f %f %f", &model, &position.x, &position.y, &position.z, &rotation.x, &rotation.y, &rotation.z, &scale);
+
+            if ((count < 4) || (model < 0) || (model >= sector->modelCount))
+            {
+                TRACELOG(LOG_WARNING, "WORLD: [%s] Invalid sector object, skipped", sector->manifest);
+                continue;
+            }
+
+            WorldObject *object = &sector->objects[sector->objectCount];
+            object->model = model;
+            object->transform = MatrixMultiply(MatrixMultiply(MatrixScale(scale, scale, scale), MatrixRotateXYZ(Vector3Scale(rotation, DEG2RAD))), MatrixTranslate(position.x, position.y, position.z));
+            sector->objectCount++;
+        }
+    }
+}
+
+// Retrieve finished sector resources loads and submit next ones, returns async loads submitted
+// NOTE: Cached resources (loaded by other sectors or Load*()) are shared, async loaded ones are cached
+static int UpdateWorldSectorLoad(WorldSector *sector, int jobs)
+{
+    rWorldSectorLoad *load = sector->load;
+    int submitted = 0;
+
+    if (load->manifestHandle != 0)
+    {
+        if (GetAsyncLoadState(load->manifestHandle) == ASYNC_LOAD_PENDING) return 0;
+
+        unsigned int dataSize = 0;
+        unsigned char *data = GetAsyncFileData(load->manifestHandle, &dataSize);
+        load->manifestHandle = 0;
+
+        if (data != NULL)
+        {
+            char *text = (char *)RL_MALLOC(dataSize + 1);
+            memcpy(text, data, dataSize);
+            text[dataSize] = '\0';
+
+            ParseWorldSectorManifest(sector, text);
+
+            RL_FREE(text);
+            UnloadFileData(data);
+        }
+        else TRACELOG(LOG_WARNING, "WORLD: [%s] Failed to load sector manifest", sector->manifest);
+    }
+
+    // Retrieve finished loads
+    for (int i = 0; i < load->nextResource; i++)
+    {
+        if (load->handles[i] == 0) continue;
+
+        int state = GetAsyncLoadState(load->handles[i]);
+        if (state == ASYNC_LOAD_PENDING) continue;
+
+        if (i < sector->modelCount)
+        {
+            Model *model = &sector->models[i];
+            *model = GetAsyncModel(load->handles[i]);
+#if defined(SUPPORT_RESOURCE_CACHE)
+            if ((state == ASYNC_LOAD_READY) && (model->meshes != NULL)) CacheResource(RESOURCE_MODEL, load->files[i], model, sizeof(Model), (unsigned long long)(size_t)model->meshes);
+#endif
+        }
+        else
+        {
+            Texture2D *texture = &sector->textures[i - sector->modelCount];
+            *texture = GetAsyncTexture(load->handles[i]);
+#if defined(SUPPORT_RESOURCE_CACHE)
+            if ((state == ASYNC_LOAD_READY) && (texture->id > 0)) CacheResource(RESOURCE_TEXTURE, load->files[i], texture, sizeof(Texture2D), texture->id);
+#endif
+        }
+
+        load->handles[i] = 0;
+        load->pendingCount--;
+    }
+
+    // Submit next loads
+    while ((load->nextResource < (sector->modelCount + sector->textureCount)) && (submitted < jobs))
+    {
+        int i = load->nextResource;
+
+        if (i < sector->modelCount)
+        {
+#if defined(SUPPORT_RESOURCE_CACHE)
+            if (!LoadCachedResource(RESOURCE_MODEL, load->files[i], &sector->models[i], sizeof(Model)))
+#endif
+            {
+                load->handles[i] = LoadModelAsync(load->files[i]);
+                if (load->handles[i] == 0) break;   // Async jobs slots not available, submitted again on next update
+            }
+        }
+        else
+        {
+#if defined(SUPPORT_RESOURCE_CACHE)
+            if (!LoadCachedResource(RESOURCE_TEXTURE, load->files[i], &sector->textures[i - sector->modelCount], sizeof(Texture2D)))
+#endif
+            {
+                load->handles[i] = LoadTextureAsync(load->files[i]);
+                if (load->handles[i] == 0) break;
+            }
+        }
+
+        if (load->handles[i] != 0)
+        {
+            load->pendingCount++;
+            submitted++;
+        }
+
+        load->nextResource++;
+    }
+
+    return submitted;
+}
+
+// Unload sector resources, sector memory is released from world memory
+// NOTE: Resources shared with other sectors are only released (cached resources references)
+static void UnloadWorldSector(World *world, WorldSector *sector)
+{
+    rWorldSectorLoad *load = sector->load;
+
+    if (load != NULL)
+    {
+        // Pending loads can not be cancelled, they are retrieved (waiting for them) and unloaded
+        if (load->manifestHandle != 0)
+        {
+            unsigned int dataSize = 0;
+            UnloadFileData(GetAsyncFileData(load->manifestHandle, &dataSize));
+        }
+
+        for (int i = 0; i < load->nextResource; i++)
+        {
+            if (load->handles[i] == 0) continue;
+
+            if (i < sector->modelCount) sector->models[i] = GetAsyncModel(load->handles[i]);
+            else sector->textures[i - sector->modelCount] = GetAsyncTexture(load->handles[i]);
+        }
+
+        RL_FREE(load->files);
+        RL_FREE(load->handles);
+        RL_FREE(load);
+        sector->load = NULL;
+    }
+
+    for (int i = 0; i < sector->modelCount; i++)
+    {
+        if (sector->models[i].meshes != NULL) UnloadModel(sector->models[i]);
+    }
+
+    for (int i = 0; i < sector->textureCount; i++)
+    {
+        if (sector->textures[i].id > 0) UnloadTexture(sector->textures[i]);
+    }
+
+    RL_FREE(sector->models);
+    RL_FREE(sector->textures);
+    RL_FREE(sector->objects);
+    sector->models = NULL;
+    sector->textures = NULL;
+    sector->objects = NULL;
+    sector->modelCount = 0;
+    sector->textureCount = 0;
+    sector->objectCount = 0;
+
+    world->memory[WORLD_BUDGET_MESHES] -= sector->memory[WORLD_BUDGET_MESHES];
+    world->memory[WORLD_BUDGET_TEXTURES] -= sector->memory[WORLD_BUDGET_TEXTURES];
+    sector->memory[WORLD_BUDGET_MESHES] = 0;
+    sector->memory[WORLD_BUDGET_TEXTURES] = 0;
+
+    sector->state = WORLD_SECTOR_UNLOADED;
+}
+
+// Check if loaded sectors memory exceeds any world budget (0: no budget)
+static bool IsWorldOverBudget(World world)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if ((world.budgets[i] > 0) && (world.memory[i] > world.budgets[i])) return true;
+    }
+
+    return false;
+}
+
+// Add model estimated memory: meshes vertex and index data (full float attributes) and materials textures
+// NOTE: Resources shared by sectors are accounted by every sector using them
+static void GetWorldModelMemory(Model model, long long *memory)
+{
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+        int vertexSize = 3*sizeof(float);
+
+        if (mesh.texcoords != NULL) vertexSize += 2*sizeof(float);
+        if (mesh.texcoords2 != NULL) vertexSize += 2*sizeof(float);
+        if (mesh.normals != NULL) vertexSize += 3*sizeof(float);
+        if (mesh.tangents != NULL) vertexSize += 4*sizeof(float);
+        if (mesh.colors != NULL) vertexSize += 4*sizeof(unsigned char);
+        if (mesh.boneIds != NULL) vertexSize += 4*sizeof(unsigned char) + 4*sizeof(float);
+
+        memory[WORLD_BUDGET_MESHES] += (long long)mesh.vertexCount*vertexSize;
+        if (mesh.indices != NULL) memory[WORLD_BUDGET_MESHES] += (long long)mesh.triangleCount*3*sizeof(unsigned short);
+    }
+
+    for (int i = 0; i < model.materialCount; i++)
+    {
+        if (model.materials[i].maps == NULL) continue;
+
+        for (int j = 0; j < MAX_MATERIAL_MAPS; j++)
+        {
+            Texture2D texture = model.materials[i].maps[j].texture;
+            if ((texture.id == 0) || (texture.id == rlGetTextureIdDefault())) continue;
+
+            // Texture used by several maps or materials is accounted once
+            bool accounted = false;
+
+            for (int k = 0; (k < i*MAX_MATERIAL_MAPS + j) && !accounted; k++)
+            {
+                const Material *material = &model.materials[k/MAX_MATERIAL_MAPS];
+                accounted = (material->maps != NULL) && (material->maps[k%MAX_MATERIAL_MAPS].texture.id == texture.id);
+            }
+
+            if (!accounted) memory[WORLD_BUDGET_TEXTURES] += GetWorldTextureMemory(texture);
+        }
+    }
+}
+
+// Get texture estimated memory, including mipmaps
+static long long GetWorldTextureMemory(Texture2D texture)
+{
+    long long size = 0;
+    int width = texture.width;
+    int height = texture.height;
+
+    for (int i = 0; i < texture.mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, texture.format);
+
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    return size;
+}
+#endif      // WORLD_STREAMING_SUPPORTED
+
+#if defined(SUPPORT_PARTICLES)
+// Load particle system, particles slots are allocated once and reused as a ring buffer
+// NOTE: With compute shaders support (OpenGL 4.3) particles state only lives on GPU memory (SSBO), simulated
+// and drawn from the same buffer, otherwise particles are simulated on CPU and streamed to GPU on draw
+ParticleSystem LoadParticleSystem(ParticleEmitter emitter, int maxParticles)
+{
+    ParticleSystem system = { 0 };
+
+    if (maxParticles <= 0)
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particle system, invalid particles count (%i)", maxParticles);
+        return system;
+    }
+
+    system.maxParticles = maxParticles;
+    system.emitter = emitter;
+    system.seed = 0x2545f491;
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (!particlesComputeLoaded) LoadShaderParticlesCompute();
+
+    // NOTE: Buffer is cleared to zero on load, all particles start dead (life = 0)
+    if (particlesComputeProgram > 0) system.bufferId = rlLoadShaderBuffer((unsigned long long)maxParticles*PARTICLE_STATE_FLOATS*sizeof(float), NULL, RL_DYNAMIC_COPY);
+#endif
+
+    if (system.bufferId == 0) system.particles = (float *)RL_CALLOC(maxParticles*PARTICLE_STATE_FLOATS, sizeof(float));
+
+    TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (%i particles, %s simulation)", maxParticles, (system.bufferId > 0)? "GPU" : "CPU");
+
+    return system;
+}
+
+// Unload particle system state (RAM and/or VRAM)
+void UnloadParticleSystem(ParticleSystem system)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (system.bufferId > 0) rlUnloadShaderBuffer(system.bufferId);
+#endif
+    RL_FREE(system.particles);
+}
+
+// Emit particles burst on next update
+void EmitParticles(ParticleSystem *system, int count)
+{
+    if (count > 0) system->emitPending += (float)count;
+}
+
+// Emit particles (emission rate and bursts) and simulate alive particles
+// NOTE: Emitted particles take the oldest slots of the ring buffer, if more than maxParticles
+// particles are alive, oldest ones are replaced
+void UpdateParticleSystem(ParticleSystem *system, float deltaTime)
+{
+    if (system->maxParticles <= 0) return;
+
+    if ((system->emitter.emissionRate > 0.0f) && (deltaTime > 0.0f)) system->emitPending += system->emitter.emissionRate*deltaTime;
+
+    int emitCount = (int)system->emitPending;
+    system->emitPending -= (float)emitCount;
+    if (emitCount > system->maxParticles) emitCount = system->maxParticles;
+
+    int emitStart = system->nextParticle;
+    system->nextParticle = (system->nextParticle + emitCount)%system->maxParticles;
+    system->seed = HashParticle(system->seed);
+
+    RL_PROFILE_ZONE_BEGIN(zone, "UpdateParticleSystem");
+
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (system->bufferId > 0)
+    {
+        // Particles are emitted and simulated by the same dispatch, one invocation per particle slot
+        ParticleEmitter emitter = system->emitter;
+        int range[3] = { emitStart, emitCount, system->maxParticles };
+        int seed = (int)system->seed;
+        float params[3] = { emitter.lifetime, emitter.lifetimeVariance, emitter.drag };
+
+        rlEnableShader(particlesComputeProgram);
+        rlSetUniform(particlesComputeLocs[0], range, SHADER_UNIFORM_IVEC3, 1);
+        rlSetUniform(particlesComputeLocs[1], &seed, SHADER_UNIFORM_INT, 1);
+        rlSetUniform(particlesComputeLocs[2], &deltaTime, SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(particlesComputeLocs[3], &emitter.position, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(particlesComputeLocs[4], &emitter.positionVariance, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(particlesComputeLocs[5], &emitter.velocity, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(particlesComputeLocs[6], &emitter.velocityVariance, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(particlesComputeLocs[7], &emitter.acceleration, SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(particlesComputeLocs[8], params, SHADER_UNIFORM_VEC3, 1);
+        rlBindShaderBuffer(system->bufferId, 0);
+        rlComputeShaderDispatch((system->maxParticles + PARTICLES_WORKGROUP_SIZE - 1)/PARTICLES_WORKGROUP_SIZE, 1, 1);
+        rlDisableShader();
+
+        // Simulated state is read by next dispatch and by draw vertex attributes
+        rlShaderBufferBarrier();
+    }
+#endif
+
+    if (system->particles != NULL)
+    {
+        // NOTE: Particles are emitted after simulation, just emitted particles are simulated from next update (same as GPU simulation)
+        SimulateParticles(system->particles, system->maxParticles, system->emitter, deltaTime);
+
+        for (int i = 0; i < emitCount; i++)
+        {
+            int index = (emitStart + i)%system->maxParticles;
+            SpawnParticle(system->particles + index*PARTICLE_STATE_FLOATS, system->emitter, ((unsigned int)index*0x9e3779b9u)^system->seed);
+        }
+    }
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Draw particles as camera-facing textured quads, size and color interpolated by particle age
+// NOTE: Quads are instanced from particles state buffer (one instance per particle slot, dead particles are collapsed),
+// particles are not sorted, use additive blending or disable depth writes for translucent textures
+void DrawParticleSystem(ParticleSystem system, Texture2D texture)
+{
+    if (system.maxParticles <= 0) return;
+
+    bool drawn = false;
+    unsigned int textureId = (texture.id > 0)? texture.id : rlGetTextureIdDefault();
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!particlesShaderLoaded) LoadShaderParticles();
+
+    if (particlesShader.id > 0)
+    {
+        rlDrawRenderBatchActive();      // Draw pending batch before instanced particles (keep drawing order)
+
+        // CPU simulated particles are streamed to rlgl instance stream ring buffer
+        int offset = 0;
+        unsigned int bufferId = system.bufferId;
+        if (system.particles != NULL) bufferId = rlUpdateInstanceStream(system.particles, system.maxParticles*PARTICLE_STATE_FLOATS*sizeof(float), &offset);
+
+        ParticleEmitter emitter = system.emitter;
+        float sizes[2] = { emitter.startSize, emitter.endSize };
+        Vector4 startColor = ColorNormalize(emitter.startColor);
+        Vector4 endColor = ColorNormalize(emitter.endColor);
+        int textureSlot = 0;
+
+        rlEnableShader(particlesShader.id);
+        rlSetUniformMatrix(particlesShaderLocs[0], MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()));
+        rlSetUniformMatrix(particlesShader.locs[SHADER_LOC_MATRIX_PROJECTION], rlGetMatrixProjection());
+        rlSetUniform(particlesShaderLocs[1], sizes, SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(particlesShaderLocs[2], &startColor, SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(particlesShaderLocs[3], &endColor, SHADER_UNIFORM_VEC4, 1);
+        rlSetUniform(particlesShader.locs[SHADER_LOC_MAP_DIFFUSE], &textureSlot, SHADER_UNIFORM_INT, 1);
+
+        // Soft particles: fade by distance to scene depth, drawn within BeginLowResEffects() with scene depth
+        unsigned int depthId = 0;
+        float softParams[4] = { 0 };
+        int depthSlot = 1;
+#if defined(SUPPORT_MODULE_RTEXTURES)
+        if ((particlesShaderLocs[6] != -1) && GetLowResEffectsSoftDepth(&depthId, softParams))
+        {
+            float depthRange[2] = { (float)RL_CULL_DISTANCE_NEAR, (float)RL_CULL_DISTANCE_FAR };
+            rlSetUniform(particlesShaderLocs[6], &depthSlot, SHADER_UNIFORM_INT, 1);
+            rlSetUniform(particlesShaderLocs[8], depthRange, SHADER_UNIFORM_VEC2, 1);
+            rlActiveTextureSlot(depthSlot);
+            rlEnableTexture(depthId);
+        }
+#endif
+        rlSetUniform(particlesShaderLocs[7], softParams, SHADER_UNIFORM_VEC4, 1);
+
+        rlActiveTextureSlot(0);
+        rlEnableTexture(textureId);
+
+        // NOTE: Attributes are set on every draw, instance data offset changes when streamed
+        // and vertex array objects could not be supported (OpenGL ES 2.0)
+        rlEnableVertexArray(particlesVaoId);
+        rlEnableVertexBuffer(particlesQuadVboId);
+        rlEnableVertexAttribute(particlesShader.locs[SHADER_LOC_VERTEX_POSITION]);
+        rlSetVertexAttribute(particlesShader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+
+        rlEnableVertexBuffer(bufferId);
+        for (int i = 0; i < 2; i++)
+        {
+            rlEnableVertexAttribute(particlesShaderLocs[4 + i]);
+            rlSetVertexAttribute(particlesShaderLocs[4 + i], 4, RL_FLOAT, 0, PARTICLE_STATE_FLOATS*sizeof(float), (void *)(size_t)(offset + i*4*sizeof(float)));
+            rlSetVertexAttributeDivisor(particlesShaderLocs[4 + i], 1);
+        }
+
+        rlDrawVertexArrayInstanced(0, 6, system.maxParticles);
+
+        for (int i = 0; i < 2; i++)
+        {
+            rlSetVertexAttributeDivisor(particlesShaderLocs[4 + i], 0);
+            rlDisableVertexAttribute(particlesShaderLocs[4 + i]);
+        }
+        rlDisableVertexAttribute(particlesShader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+        rlDisableVertexBuffer();
+        rlDisableVertexArray();
+        rlDisableTexture();
+        if (depthId > 0)
+        {
+            rlActiveTextureSlot(depthSlot);
+            rlDisableTexture();
+            rlActiveTextureSlot(0);
+        }
+        rlDisableShader();
+
+        drawn = true;
+    }
+#endif
+
+    // Billboards drawn through rlgl batch (OpenGL 1.1 or particles shader not available)
+    if (!drawn && (system.particles != NULL))
+    {
+        Matrix matView = rlGetMatrixModelview();
+        Vector3 right = { matView.m0, matView.m4, matView.m8 };
+        Vector3 up = { matView.m1, matView.m5, matView.m9 };
+        ParticleEmitter emitter = system.emitter;
+
+        rlSetTexture(textureId);
+
+        for (int i = 0; i < system.maxParticles; i++)
+        {
+            const float *particle = system.particles + i*PARTICLE_STATE_FLOATS;
+            if (particle[3] <= 0.0f) continue;
+
+            float age = (particle[7] > 0.0f)? 1.0f - particle[3]/particle[7] : 1.0f;
+            float half = 0.5f*Lerp(emitter.startSize, emitter.endSize, age);
+            Color color = {
+                (unsigned char)Lerp(emitter.startColor.r, emitter.endColor.r, age),
+                (unsigned char)Lerp(emitter.startColor.g, emitter.endColor.g, age),
+                (unsigned char)Lerp(emitter.startColor.b, emitter.endColor.b, age),
+                (unsigned char)Lerp(emitter.startColor.a, emitter.endColor.a, age)
+            };
+            Vector3 position = { particle[0], particle[1], particle[2] };
+            Vector3 topLeft = Vector3Add(position, Vector3Scale(Vector3Subtract(up, right), half));
+            Vector3 topRight = Vector3Add(position, Vector3Scale(Vector3Add(up, right), half));
+            Vector3 bottomRight = Vector3Subtract(position, Vector3Scale(Vector3Subtract(up, right), half));
+            Vector3 bottomLeft = Vector3Subtract(position, Vector3Scale(Vector3Add(up, right), half));
+
+            rlCheckRenderBatchLimit(4);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(color.r, color.g, color.b, color.a);
+
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex3f(topRight.x, topRight.y, topRight.z);
+            rlEnd();
+        }
+
+        rlSetTexture(0);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition: Particles
+//----------------------------------------------------------------------------------
+// Hash particle random state (integer hash, same on CPU and GPU simulation)
+static unsigned int HashParticle(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+
+    return x;
+}
+
+// Get particle random value in range [-1..1), state is advanced
+static float GetParticleRandom(unsigned int *state)
+{
+    *state = HashParticle(*state);
+
+    return (float)(*state >> 8)/8388608.0f - 1.0f;
+}
+
+// Spawn particle at emitter, random values taken in the same order as particles compute shader
+static void SpawnParticle(float *particle, ParticleEmitter emitter, unsigned int state)
+{
+    particle[0] = emitter.position.x + emitter.positionVariance.x*GetParticleRandom(&state);
+    particle[1] = emitter.position.y + emitter.positionVariance.y*GetParticleRandom(&state);
+    particle[2] = emitter.position.z + emitter.positionVariance.z*GetParticleRandom(&state);
+    particle[4] = emitter.velocity.x + emitter.velocityVariance.x*GetParticleRandom(&state);
+    particle[5] = emitter.velocity.y + emitter.velocityVariance.y*GetParticleRandom(&state);
+    particle[6] = emitter.velocity.z + emitter.velocityVariance.z*GetParticleRandom(&state);
+    particle[7] = emitter.lifetime + emitter.lifetimeVariance*GetParticleRandom(&state);
+    particle[3] = particle[7];
+}
+
+// Simulate alive particles on CPU (SIMD when available): velocity, then position and remaining life
+// NOTE: Particle state is two 4-float vectors (position + life, velocity + lifetime), lanes not
+// simulated are masked by the step vectors
+static void SimulateParticles(float *particles, int count, ParticleEmitter emitter, float deltaTime)
+{
+    float damping = 1.0f - emitter.drag*deltaTime;
+    if (damping < 0.0f) damping = 0.0f;
+
+#if defined(SKINNING_SIMD_SSE)
+    __m128 acceleration = _mm_set_ps(0.0f, emitter.acceleration.z*deltaTime, emitter.acceleration.y*deltaTime, emitter.acceleration.x*deltaTime);
+    __m128 drag = _mm_set_ps(1.0f, damping, damping, damping);
+    __m128 step = _mm_set_ps(0.0f, deltaTime, deltaTime, deltaTime);
+    __m128 age = _mm_set_ps(deltaTime, 0.0f, 0.0f, 0.0f);
+
+    for (int i = 0; i < count; i++)
+    {
+        float *particle = particles + i*PARTICLE_STATE_FLOATS;
+        if (particle[3] <= 0.0f) continue;
+
+        __m128 velocity = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(particle + 4), acceleration), drag);
+        __m128 position = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(particle), _mm_mul_ps(velocity, step)), age);
+
+        _mm_storeu_ps(particle, position);
+        _mm_storeu_ps(particle + 4, velocity);
+    }
+#elif defined(SKINNING_SIMD_NEON)
+    const float accelerationValues[4] = { emitter.acceleration.x*deltaTime, emitter.acceleration.y*deltaTime, emitter.acceleration.z*deltaTime, 0.0f };
+    const float dragValues[4] = { damping, damping, damping, 1.0f };
+    const float stepValues[4] = { deltaTime, deltaTime, deltaTime, 0.0f };
+    const float ageValues[4] = { 0.0f, 0.0f, 0.0f, deltaTime };
+    float32x4_t acceleration = vld1q_f32(accelerationValues);
+    float32x4_t drag = vld1q_f32(dragValues);
+    float32x4_t step = vld1q_f32(stepValues);
+    float32x4_t age = vld1q_f32(ageValues);
+
+    for (int i = 0; i < count; i++)
+    {
+        float *particle = particles + i*PARTICLE_STATE_FLOATS;
+        if (particle[3] <= 0.0f) continue;
+
+        float32x4_t velocity = vmulq_f32(vaddq_f32(vld1q_f32(particle + 4), acceleration), drag);
+        float32x4_t position = vsubq_f32(vaddq_f32(vld1q_f32(particle), vmulq_f32(velocity, step)), age);
+
+        vst1q_f32(particle, position);
+        vst1q_f32(particle + 4, velocity);
+    }
+#else
+    Vector3 acceleration = Vector3Scale(emitter.acceleration, deltaTime);
+
+    for (int i = 0; i < count; i++)
+    {
+        float *particle = particles + i*PARTICLE_STATE_FLOATS;
+        if (particle[3] <= 0.0f) continue;
+
+        particle[4] = (particle[4] + acceleration.x)*damping;
+        particle[5] = (particle[5] + acceleration.y)*damping;
+        particle[6] = (particle[6] + acceleration.z)*damping;
+        particle[0] += particle[4]*deltaTime;
+        particle[1] += particle[5]*deltaTime;
+        particle[2] += particle[6]*deltaTime;
+        particle[3] -= deltaTime;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load built-in particles shader and quad vertex buffer
+// NOTE: Quad corners are offset on view space from particle center (camera-facing), dead particles are collapsed
+static void LoadShaderParticles(void)
+{
+    const char *particlesVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 particlePositionLife;       \n"
+    "attribute vec4 particleVelocityLifetime;   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 particlePositionLife;      \n"
+    "in vec4 particleVelocityLifetime;  \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 particlePositionLife;       \n"
+    "attribute vec4 particleVelocityLifetime;   \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 matModelView;         \n"
+    "uniform mat4 matProjection;        \n"
+    "uniform vec2 particleSize;         \n"     // Particle start and end size
+    "uniform vec4 particleStartColor;   \n"
+    "uniform vec4 particleEndColor;     \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float life = particlePositionLife.w; \n"
+    "    float age = clamp(1.0 - life/max(particleVelocityLifetime.w, 0.0001), 0.0, 1.0); \n"
+    "    float size = (life > 0.0)? mix(particleSize.x, particleSize.y, age) : 0.0; \n"
+    "    vec4 center = matModelView*vec4(particlePositionLife.xyz, 1.0); \n"
+    "    fragTexCoord = vec2(vertexPosition.x + 0.5, 0.5 - vertexPosition.y); \n"
+    "    fragColor = mix(particleStartColor, particleEndColor, age); \n"
+    "    gl_Position = matProjection*(center + vec4(vertexPosition*size, 0.0, 0.0)); \n"
+    "}                                  \n";
+
+    const char *particlesFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D sceneDepth;      \n"
+    "uniform vec4 softParams;           \n"     // Soft particles: inverse target size, inverse fade distance (0.0: disabled)
+    "uniform vec2 depthRange;           \n"     // Near and far cull distances
+    "float LinearDepth(float depth) { return 2.0*depthRange.x*depthRange.y/(depthRange.y + depthRange.x - (2.0*depth - 1.0)*(depthRange.y - depthRange.x)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "    if (softParams.z > 0.0)        \n"
+    "    {                              \n"
+    "        float sceneZ = LinearDepth(texture(sceneDepth, gl_FragCoord.xy*softParams.xy).r); \n"
+    "        finalColor.a *= clamp((sceneZ - LinearDepth(gl_FragCoord.z))*softParams.z, 0.0, 1.0); \n"
+    "    }                              \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    particlesShaderLoaded = true;
+    particlesShader = LoadShaderFromMemory(particlesVShaderCode, particlesFShaderCode);
+    particlesShaderLocs[0] = GetShaderLocation(particlesShader, "matModelView");
+    particlesShaderLocs[1] = GetShaderLocation(particlesShader, "particleSize");
+    particlesShaderLocs[2] = GetShaderLocation(particlesShader, "particleStartColor");
+    particlesShaderLocs[3] = GetShaderLocation(particlesShader, "particleEndColor");
+    particlesShaderLocs[4] = GetShaderLocationAttrib(particlesShader, "particlePositionLife");
+    particlesShaderLocs[5] = GetShaderLocationAttrib(particlesShader, "particleVelocityLifetime");
+    particlesShaderLocs[6] = GetShaderLocation(particlesShader, "sceneDepth");
+    particlesShaderLocs[7] = GetShaderLocation(particlesShader, "softParams");
+    particlesShaderLocs[8] = GetShaderLocation(particlesShader, "depthRange");
+
+    if ((particlesShader.id > 0) && (particlesShader.id != rlGetShaderIdDefault()) && (particlesShaderLocs[4] != -1) && (particlesShaderLocs[5] != -1))
+    {
+        // Two triangles quad, corners in range [-0.5..0.5]
+        const float quad[12] = { -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f };
+
+        particlesVaoId = rlLoadVertexArray();
+        rlEnableVertexArray(particlesVaoId);
+        particlesQuadVboId = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlDisableVertexArray();
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Particles shader loaded successfully", particlesShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load particles shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (particlesShader.id != rlGetShaderIdDefault()) UnloadShader(particlesShader);
+        else RL_FREE(particlesShader.locs);
+
+        particlesShader = (Shader){ 0 };
+    }
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_43)
+#define PARTICLES_STRINGIFY_(x)     #x
+#define PARTICLES_STRINGIFY(x)      PARTICLES_STRINGIFY_(x)
+
+// Load built-in particles compute shader, emits particles in ring buffer range and simulates alive ones
+// NOTE: Random values and integration steps mirror CPU simulation: SpawnParticle() and SimulateParticles()
+static void LoadShaderParticlesCompute(void)
+{
+    const char *particlesCShaderCode =
+    "#version 430                       \n"
+    "layout(local_size_x = " PARTICLES_STRINGIFY(PARTICLES_WORKGROUP_SIZE) ") in; \n"
+    "struct Particle { vec4 positionLife; vec4 velocityLifetime; }; \n"
+    "layout(std430, binding = 0) buffer ParticlesBuffer { Particle particles[]; }; \n"
+    "uniform ivec3 emitRange;           \n"     // Emitted slots (first, count) and particles slots count
+    "uniform int seed;                  \n"
+    "uniform float deltaTime;           \n"
+    "uniform vec3 emitPosition;         \n"
+    "uniform vec3 emitPositionVariance; \n"
+    "uniform vec3 emitVelocity;         \n"
+    "uniform vec3 emitVelocityVariance; \n"
+    "uniform vec3 acceleration;         \n"
+    "uniform vec3 emitParams;           \n"     // Lifetime, lifetime variance and drag
+    "uint Hash(uint x)                  \n"
+    "{                                  \n"
+    "    x ^= x >> 16u; x *= 0x7feb352du; \n"
+    "    x ^= x >> 15u; x *= 0x846ca68bu; \n"
+    "    x ^= x >> 16u; return x;       \n"
+    "}                                  \n"
+    "float Random(inout uint state)     \n"
+    "{                                  \n"
+    "    state = Hash(state);           \n"
+    "    return float(state >> 8u)/8388608.0 - 1.0; \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    uint i = gl_GlobalInvocationID.x; \n"
+    "    uint count = uint(emitRange.z); \n"
+    "    if (i >= count) return;        \n"
+    "    Particle particle = particles[i]; \n"
+    "    if ((i + count - uint(emitRange.x))%count < uint(emitRange.y)) \n"
+    "    {                              \n"
+    "        uint state = (i*0x9e3779b9u)^uint(seed); \n"
+    "        particle.positionLife.x = emitPosition.x + emitPositionVariance.x*Random(state); \n"
+    "        particle.positionLife.y = emitPosition.y + emitPositionVariance.y*Random(state); \n"
+    "        particle.positionLife.z = emitPosition.z + emitPositionVariance.z*Random(state); \n"
+    "        particle.velocityLifetime.x = emitVelocity.x + emitVelocityVariance.x*Random(state); \n"
+    "        particle.velocityLifetime.y = emitVelocity.y + emitVelocityVariance.y*Random(state); \n"
+    "        particle.velocityLifetime.z = emitVelocity.z + emitVelocityVariance.z*Random(state); \n"
+    "        particle.velocityLifetime.w = emitParams.x + emitParams.y*Random(state); \n"
+    "        particle.positionLife.w = particle.velocityLifetime.w; \n"
+    "    }                              \n"
+    "    else if (particle.positionLife.w > 0.0) \n"
+    "    {                              \n"
+    "        float damping = max(1.0 - emitParams.z*deltaTime, 0.0); \n"
+    "        particle.velocityLifetime.xyz = (particle.velocityLifetime.xyz + acceleration*deltaTime)*damping; \n"
+    "        particle.positionLife.xyz += particle.velocityLifetime.xyz*deltaTime; \n"
+    "        particle.positionLife.w -= deltaTime; \n"
+    "    }                              \n"
+    "    particles[i] = particle;       \n"
+    "}                                  \n";
+
+    particlesComputeLoaded = true;
+
+    unsigned int shaderId = rlCompileShader(particlesCShaderCode, RL_COMPUTE_SHADER);
+    if (shaderId > 0) particlesComputeProgram = rlLoadComputeShaderProgram(shaderId);
+
+    if (particlesComputeProgram > 0)
+    {
+        const char *names[9] = { "emitRange", "seed", "deltaTime", "emitPosition", "emitPositionVariance", "emitVelocity", "emitVelocityVariance", "acceleration", "emitParams" };
+        for (int i = 0; i < 9; i++) particlesComputeLocs[i] = rlGetLocationUniform(particlesComputeProgram, names[i]);
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Particles compute shader loaded successfully", particlesComputeProgram);
+    }
+    else TRACELOG(LOG_WARNING, "SHADER: Failed to load particles compute shader, particles simulated on CPU");
+}
+#endif
+#endif      // SUPPORT_PARTICLES
+
+// Unload particles shaders and quad buffers (called by CloseWindow())
+extern void UnloadParticlesShaders(void)
+{
+#if defined(SUPPORT_PARTICLES) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (particlesShader.id > 0)
+    {
+        UnloadShader(particlesShader);
+        rlUnloadVertexArray(particlesVaoId);
+        rlUnloadVertexBuffer(particlesQuadVboId);
+    }
+
+    particlesShader = (Shader){ 0 };
+    particlesShaderLoaded = false;
+    particlesVaoId = 0;
+    particlesQuadVboId = 0;
+#endif
+#if defined(SUPPORT_PARTICLES) && defined(GRAPHICS_API_OPENGL_43)
+    if (particlesComputeProgram > 0) rlUnloadShaderProgram(particlesComputeProgram);
+
+    particlesComputeProgram = 0;
+    particlesComputeLoaded = false;
+#endif
+}
+
+#if defined(SUPPORT_DEBUG_DRAW)
+// Reserve debug lines space for count new lines
+static bool ReserveDebugLines(int count)
+{
+    if (debugDraw.lineCount + count > debugDraw.lineCapacity)
+    {
+        if (debugDraw.lineCount + count > MAX_DEBUG_LINES)
+        {
+            if (!debugDraw.overflow) TRACELOG(LOG_WARNING, "MODEL: Debug draw lines limit reached (%i), lines skipped", MAX_DEBUG_LINES);
+            debugDraw.overflow = true;
+            return false;
+        }
+
+        int capacity = (debugDraw.lineCapacity > 0)? 2*debugDraw.lineCapacity : 1024;
+        while (capacity < debugDraw.lineCount + count) capacity *= 2;
+        if (capacity > MAX_DEBUG_LINES) capacity = MAX_DEBUG_LINES;
+
+        DebugVertex *vertices = (DebugVertex *)RL_REALLOC(debugDraw.vertices, 2*capacity*sizeof(DebugVertex));
+        if (vertices != NULL) debugDraw.vertices = vertices;
+        float *times = (float *)RL_REALLOC(debugDraw.lineTimes, capacity*sizeof(float));
+        if (times != NULL) debugDraw.lineTimes = times;
+
+        if ((vertices == NULL) || (times == NULL)) return false;
+
+        debugDraw.lineCapacity = capacity;
+    }
+
+    return true;
+}
+
+// Add debug unit shape instance
+static void AddDebugShape(int type, Vector3 center, Vector3 scale, Color color, float duration)
+{
+    if (debugDraw.shapeCount[type] >= debugDraw.shapeCapacity[type])
+    {
+        if (debugDraw.shapeCount[type] >= MAX_DEBUG_SHAPES)
+        {
+            if (!debugDraw.overflow) TRACELOG(LOG_WARNING, "MODEL: Debug draw shapes limit reached (%i), shapes skipped", MAX_DEBUG_SHAPES);
+            debugDraw.overflow = true;
+            return;
+        }
+
+        int capacity = (debugDraw.shapeCapacity[type] > 0)? 2*debugDraw.shapeCapacity[type] : 256;
+        if (capacity > MAX_DEBUG_SHAPES) capacity = MAX_DEBUG_SHAPES;
+
+        DebugShape *shapes = (DebugShape *)RL_REALLOC(debugDraw.shapes[type], capacity*sizeof(DebugShape));
+        if (shapes != NULL) debugDraw.shapes[type] = shapes;
+        float *times = (float *)RL_REALLOC(debugDraw.shapeTimes[type], capacity*sizeof(float));
+        if (times != NULL) debugDraw.shapeTimes[type] = times;
+
+        if ((shapes == NULL) || (times == NULL)) return;
+
+        debugDraw.shapeCapacity[type] = capacity;
+    }
+
+    debugDraw.shapes[type][debugDraw.shapeCount[type]] = (DebugShape){ center, scale, color };
+    debugDraw.shapeTimes[type][debugDraw.shapeCount[type]] = duration;
+    debugDraw.shapeCount[type]++;
+}
+
+// Compute debug unit shapes lines vertices: unit box edges and unit sphere axis circles
+// NOTE: Sphere circles are computed once, shapes are only scaled and moved when drawn
+static void GenDebugUnitShapes(void)
+{
+    Vector3 *box = debugUnitShapes;
+    int k = 0;
+
+    // Box edges along every axis, four edges per axis
+    for (int axis = 0; axis < 3; axis++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            float a = (i & 1)? 0.5f : -0.5f;
+            float b = (i & 2)? 0.5f : -0.5f;
+
+            if (axis == 0) { box[k++] = (Vector3){ -0.5f, a, b }; box[k++] = (Vector3){ 0.5f, a, b }; }
+            else if (axis == 1) { box[k++] = (Vector3){ a, -0.5f, b }; box[k++] = (Vector3){ a, 0.5f, b }; }
+            else { box[k++] = (Vector3){ a, b, -0.5f }; box[k++] = (Vector3){ a, b, 0.5f }; }
+        }
+    }
+
+    // Sphere circles on XY, YZ and XZ planes
+    Vector3 *sphere = debugUnitShapes + DEBUG_BOX_VERTICES;
+    k = 0;
+
+    for (int circle = 0; circle < 3; circle++)
+    {
+        for (int i = 0; i < DEBUG_SPHERE_SEGMENTS; i++)
+        {
+            float angles[2] = { 2.0f*PI*i/DEBUG_SPHERE_SEGMENTS, 2.0f*PI*(i + 1)/DEBUG_SPHERE_SEGMENTS };
+
+            for (int j = 0; j < 2; j++)
+            {
+                float c = cosf(angles[j]);
+                float s = sinf(angles[j]);
+
+                if (circle == 0) sphere[k++] = (Vector3){ c, s, 0.0f };
+                else if (circle == 1) sphere[k++] = (Vector3){ 0.0f, c, s };
+                else sphere[k++] = (Vector3){ c, 0.0f, s };
+            }
+        }
+    }
+
+    debugUnitShapesReady = true;
+}
+
+// Draw debug shapes expanded from unit shapes into rlgl batch lines
+static void DrawDebugShapesBatch(int type)
+{
+    const Vector3 *unit = (type == DEBUG_SHAPE_BOX)? debugUnitShapes : debugUnitShapes + DEBUG_BOX_VERTICES;
+    int vertexCount = (type == DEBUG_SHAPE_BOX)? DEBUG_BOX_VERTICES : DEBUG_SPHERE_VERTICES;
+
+    for (int i = 0; i < debugDraw.shapeCount[type]; i++)
+    {
+        const DebugShape *shape = &debugDraw.shapes[type][i];
+
+        rlCheckRenderBatchLimit(vertexCount);
+
+        rlBegin(RL_LINES);
+            rlColor4ub(shape->color.r, shape->color.g, shape->color.b, shape->color.a);
+
+            for (int v = 0; v < vertexCount; v++)
+            {
+                rlVertex3f(shape->center.x + unit[v].x*shape->scale.x, shape->center.y + unit[v].y*shape->scale.y, shape->center.z + unit[v].z*shape->scale.z);
+            }
+        rlEnd();
+    }
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load built-in debug draw shader and unit shapes vertex buffer
+// NOTE: Same shader draws lines vertices (no instance attributes) and unit shapes instances (moved and scaled)
+static void LoadShaderDebugDraw(void)
+{
+    const char *debugVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec3 shapeCenter;        \n"
+    "attribute vec3 shapeScale;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec3 shapeCenter;               \n"
+    "in vec3 shapeScale;                \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec3 shapeCenter;        \n"
+    "attribute vec3 shapeScale;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(shapeCenter + vertexPosition*shapeScale, 1.0); \n"
+    "}                                  \n";
+
+    const char *debugFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec4 fragColor;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    debugShaderLoaded = true;
+    debugShader = LoadShaderFromMemory(debugVShaderCode, debugFShaderCode);
+    debugShaderLocs[0] = GetShaderLocationAttrib(debugShader, "shapeCenter");
+    debugShaderLocs[1] = GetShaderLocationAttrib(debugShader, "shapeScale");
+
+    bool attribsFound = (debugShaderLocs[0] != -1) && (debugShaderLocs[1] != -1) && (debugShader.locs != NULL) &&
+        (debugShader.locs[SHADER_LOC_VERTEX_POSITION] != -1) && (debugShader.locs[SHADER_LOC_VERTEX_COLOR] != -1);
+
+    if ((debugShader.id > 0) && (debugShader.id != rlGetShaderIdDefault()) && attribsFound)
+    {
+        debugVaoId = rlLoadVertexArray();
+        rlEnableVertexArray(debugVaoId);
+        debugShapesVboId = rlLoadVertexBuffer(debugUnitShapes, sizeof(debugUnitShapes), false);
+        rlDisableVertexArray();
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Debug draw shader loaded successfully", debugShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load debug draw shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (debugShader.id != rlGetShaderIdDefault()) UnloadShader(debugShader);
+        else RL_FREE(debugShader.locs);
+
+        debugShader = (Shader){ 0 };
+    }
+}
+#endif
+#endif
+
+// Unload debug draw shader, unit shapes buffer and primitives (called by CloseWindow())
+extern void UnloadDebugDraw(void)
+{
+#if defined(SUPPORT_DEBUG_DRAW)
+    RL_FREE(debugDraw.vertices);
+    RL_FREE(debugDraw.lineTimes);
+    for (int type = 0; type < DEBUG_SHAPE_COUNT; type++)
+    {
+        RL_FREE(debugDraw.shapes[type]);
+        RL_FREE(debugDraw.shapeTimes[type]);
+    }
+
+    memset(&debugDraw, 0, sizeof(debugDraw));
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (debugShader.id > 0)
+    {
+        UnloadShader(debugShader);
+        rlUnloadVertexArray(debugVaoId);
+        rlUnloadVertexBuffer(debugShapesVboId);
+    }
+
+    debugShader = (Shader){ 0 };
+    debugShaderLoaded = false;
+    debugVaoId = 0;
+    debugShapesVboId = 0;
+#endif
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load built-in billboards shader and quad vertex buffer
+// NOTE: Quad corners are expanded along camera right and billboards up vectors (uniforms, computed once per batch)
+static void LoadShaderBillboards(void)
+{
+    const char *billboardsVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 billboardCenter;    \n"     // Center position (xyz) and width
+    "attribute vec4 billboardSource;    \n"     // Texture coordinates rectangle
+    "attribute float billboardHeight;   \n"
+    "attribute vec4 billboardColor;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 billboardCenter;           \n"
+    "in vec4 billboardSource;           \n"
+    "in float billboardHeight;          \n"
+    "in vec4 billboardColor;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 billboardCenter;    \n"
+    "attribute vec4 billboardSource;    \n"
+    "attribute float billboardHeight;   \n"
+    "attribute vec4 billboardColor;     \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "uniform vec3 billboardRight;       \n"
+    "uniform vec3 billboardUp;          \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 position = billboardCenter.xyz + billboardRight*(vertexPosition.x*billboardCenter.w) + billboardUp*(vertexPosition.y*billboardHeight); \n"
+    "    fragTexCoord = mix(billboardSource.xy, billboardSource.zw, vec2(vertexPosition.x + 0.5, 0.5 - vertexPosition.y)); \n"
+    "    fragColor = billboardColor;    \n"
+    "    gl_Position = mvp*vec4(position, 1.0); \n"
+    "}                                  \n";
+
+    const char *billboardsFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    billboardsShaderLoaded = true;
+    billboardsShader = LoadShaderFromMemory(billboardsVShaderCode, billboardsFShaderCode);
+    billboardsShaderLocs[0] = GetShaderLocation(billboardsShader, "billboardRight");
+    billboardsShaderLocs[1] = GetShaderLocation(billboardsShader, "billboardUp");
+    billboardsShaderLocs[2] = GetShaderLocationAttrib(billboardsShader, "billboardCenter");
+    billboardsShaderLocs[3] = GetShaderLocationAttrib(billboardsShader, "billboardSource");
+    billboardsShaderLocs[4] = GetShaderLocationAttrib(billboardsShader, "billboardHeight");
+    billboardsShaderLocs[5] = GetShaderLocationAttrib(billboardsShader, "billboardColor");
+
+    bool attribsFound = true;
+    for (int i = 2; i < 6; i++) if (billboardsShaderLocs[i] == -1) attribsFound = false;
+
+    if ((billboardsShader.id > 0) && (billboardsShader.id != rlGetShaderIdDefault()) && attribsFound)
+    {
+        // Two triangles quad, corners in range [-0.5..0.5]
+        const float quad[12] = { -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f, 0.5f };
+
+        billboardsVaoId = rlLoadVertexArray();
+        rlEnableVertexArray(billboardsVaoId);
+        billboardsQuadVboId = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlDisableVertexArray();
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Billboards shader loaded successfully", billboardsShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load billboards shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (billboardsShader.id != rlGetShaderIdDefault()) UnloadShader(billboardsShader);
+        else RL_FREE(billboardsShader.locs);
+
+        billboardsShader = (Shader){ 0 };
+    }
+}
+#endif
+
+#if defined(RENDER_QUEUE_INSTANCING_SUPPORTED)
+// Load built-in render queue instancing shader
+// NOTE: Same as default shader, model transform and color are instance attributes
+static void LoadShaderInstancing(void)
+{
+    const char *instancingVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute mat4 instanceTransform;  \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in mat4 instanceTransform;         \n"
+    "in vec4 instanceColor;             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute mat4 instanceTransform;  \n"
+    "attribute vec4 instanceColor;      \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor*instanceColor; \n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *instancingFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "}                                  \n";
+#endif
+
+    instancingShaderLoaded = true;
+    instancingShader = LoadShaderFromMemory(instancingVShaderCode, instancingFShaderCode);
+
+    if ((instancingShader.id > 0) && (instancingShader.id != rlGetShaderIdDefault()) &&
+        (instancingShader.locs[SHADER_LOC_MATRIX_MODEL] != -1) && (instancingShader.locs[SHADER_LOC_INSTANCE_COLOR] != -1))
+    {
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Render queue instancing shader loaded successfully", instancingShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load render queue instancing shader, queued draws are not instanced");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (instancingShader.id != rlGetShaderIdDefault()) UnloadShader(instancingShader);
+        else RL_FREE(instancingShader.locs);
+
+        instancingShader = (Shader){ 0 };
+    }
+}
+#endif
+
+// Unload billboards shader and quad buffers (called by CloseWindow())
+extern void UnloadBillboardsShader(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (billboardsShader.id > 0)
+    {
+        UnloadShader(billboardsShader);
+        rlUnloadVertexArray(billboardsVaoId);
+        rlUnloadVertexBuffer(billboardsQuadVboId);
+    }
+
+    billboardsShader = (Shader){ 0 };
+    billboardsShaderLoaded = false;
+    billboardsVaoId = 0;
+    billboardsQuadVboId = 0;
+#endif
+}
+
+// Add point light, lights are shared by all meshes drawn with default material shader
+// NOTE: Light is attenuated to zero at radius, intensity scales light color
+int AddPointLight(Vector3 position, float radius, Color color, float intensity)
+{
+    int id = -1;
+
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    // Reuse removed light slot or use a new one
+    for (int i = 0; i < lighting.lightCount; i++)
+    {
+        if (lighting.lights[i].w <= 0.0f) { id = i; break; }
+    }
+
+    if (id == -1)
+    {
+        if (lighting.lightCount >= MAX_POINT_LIGHTS)
+        {
+            TRACELOG(LOG_WARNING, "LIGHTING: Maximum point lights reached (%i)", MAX_POINT_LIGHTS);
+            return -1;
+        }
+
+        id = lighting.lightCount++;
+    }
+
+    lighting.activeCount++;
+    UpdatePointLight(id, position, radius, color, intensity);
+#endif
+
+    return id;
+}
+
+// Update point light parameters
+void UpdatePointLight(int id, Vector3 position, float radius, Color color, float intensity)
+{
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    if ((id < 0) || (id >= lighting.lightCount)) return;
+
+    // NOTE: Removed lights are marked by zero radius, a tiny radius keeps the light active
+    lighting.lights[id] = (Vector4){ position.x, position.y, position.z, fmaxf(radius, 0.0001f) };
+    lighting.colors[id] = (Vector3){ color.r/255.0f*intensity, color.g/255.0f*intensity, color.b/255.0f*intensity };
+    lighting.dirty = true;
+#endif
+}
+
+// Remove point light, its id can be returned by next AddPointLight()
+void RemovePointLight(int id)
+{
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    if ((id < 0) || (id >= lighting.lightCount) || (lighting.lights[id].w <= 0.0f)) return;
+
+    SetPointLightShadows(id, false);
+
+    lighting.lights[id].w = 0.0f;
+    lighting.activeCount--;
+    lighting.dirty = true;
+
+    while ((lighting.lightCount > 0) && (lighting.lights[lighting.lightCount - 1].w <= 0.0f)) lighting.lightCount--;
+#endif
+}
+
+// Set directional light, direction is the one light travels (i.e. from sun to scene)
+void SetDirectionalLight(Vector3 direction, Color color)
+{
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    lighting.direction = Vector3Normalize(direction);
+    lighting.directionalColor = (Vector3){ color.r/255.0f, color.g/255.0f, color.b/255.0f };
+#endif
+}
+
+// Set ambient light color, added to lights contribution
+void SetAmbientLight(Color color)
+{
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    lighting.ambient = (Vector3){ color.r/255.0f, color.g/255.0f, color.b/255.0f };
+#endif
+}
+
+// Set directional light shadows, cascades are rendered by EndRenderQueue() from queued draws and static casters
+void SetDirectionalShadows(bool enabled)
+{
+#if defined(SUPPORT_SHADOW_MAPS)
+    shadows.directional = enabled;
+    if (!enabled) memset(shadows.splits, 0, sizeof(shadows.splits));
+#endif
+}
+
+// Set point light shadows, light cube faces are rendered into shadow atlas (up to MAX_SHADOWED_POINT_LIGHTS)
+void SetPointLightShadows(int id, bool enabled)
+{
+#if defined(SUPPORT_SHADOW_MAPS)
+    if ((id < 0) || (id >= lighting.lightCount) || (lighting.lights[id].w <= 0.0f)) return;
+
+    int slot = -1;
+    int freeSlot = -1;
+
+    for (int s = 0; s < SHADOW_POINT_SLOTS; s++)
+    {
+        if (shadows.pointLights[s] == id + 1) slot = s;
+        else if ((shadows.pointLights[s] == 0) && (freeSlot == -1)) freeSlot = s;
+    }
+
+    if (enabled && (slot == -1))
+    {
+        if (freeSlot == -1)
+        {
+            TRACELOG(LOG_WARNING, "LIGHTING: Maximum shadowed point lights reached (%i)", SHADOW_POINT_SLOTS);
+            return;
+        }
+
+        shadows.pointLights[freeSlot] = id + 1;
+    }
+    else if (!enabled && (slot != -1))
+    {
+        // Slot faces tiles are rendered again when used by another light
+        shadows.pointLights[slot] = 0;
+        memset(&shadows.tileVersions[4 + slot*6], 0, 6*sizeof(int));
+        memset(&shadows.tileDynamic[4 + slot*6], 0, 6*sizeof(bool));
+    }
+
+    // Lights shadow slots are uploaded with lights data
+    lighting.dirty = true;
+#endif
+}
+
+// Add static shadow caster, cached shadow atlas tiles are rendered again including it
+// NOTE: Mesh is referenced, it must be valid until caster is removed, returns caster id (-1 on failure)
+int AddShadowCaster(Mesh mesh, Matrix transform)
+{
+    int id = -1;
+
+#if defined(SUPPORT_SHADOW_MAPS)
+    // Reuse removed caster slot or use a new one
+    for (int i = 0; i < shadows.casterCount; i++)
+    {
+        if (!shadows.casters[i].active) { id = i; break; }
+    }
+
+    if (id == -1)
+    {
+        if (shadows.casterCount >= shadows.casterCapacity)
+        {
+            int capacity = (shadows.casterCapacity > 0)? 2*shadows.casterCapacity : 64;
+            ShadowCaster *casters = (ShadowCaster *)RL_REALLOC(shadows.casters, capacity*sizeof(ShadowCaster));
+
+            if (casters == NULL)
+            {
+                TRACELOG(LOG_WARNING, "LIGHTING: Failed to allocate shadow casters");
+                return -1;
+            }
+
+            shadows.casters = casters;
+            shadows.casterCapacity = capacity;
+        }
+
+        id = shadows.casterCount++;
+    }
+
+    shadows.casters[id] = (ShadowCaster){ mesh, transform, true };
+    shadows.version++;
+#endif
+
+    return id;
+}
+
+// Remove static shadow caster, its id can be returned by next AddShadowCaster()
+void RemoveShadowCaster(int id)
+{
+#if defined(SUPPORT_SHADOW_MAPS)
+    if ((id < 0) || (id >= shadows.casterCount) || !shadows.casters[id].active) return;
+
+    shadows.casters[id].active = false;
+    shadows.version++;
+
+    while ((shadows.casterCount > 0) && !shadows.casters[shadows.casterCount - 1].active) shadows.casterCount--;
+#endif
+}
+
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+#define LIGHTING_STRINGIFY_(x)  #x
+#define LIGHTING_STRINGIFY(x)   LIGHTING_STRINGIFY_(x)
+
+#if defined(SUPPORT_SHADOW_MAPS)
+// Shadow maps GLSL code, shadow atlas is sampled with 2x2 PCF (manual depth comparison)
+// NOTE: Cascades are selected by view distance, point lights faces by light to fragment world direction
+#define SHADOWS_SHADER_INCLUDE \
+    "uniform sampler2D shadowMap;        \n"     /* Shadow atlas: cascades (2x2 tiles) and point lights faces tiles */ \
+    "uniform mat4 shadowCascades[4];     \n"     /* Cascades view space to shadow atlas (uv and depth) */ \
+    "uniform vec4 shadowSplits;          \n"     /* Cascades far distance, 0 if not used */ \
+    "uniform vec4 shadowTexels;          \n"     /* Cascades texel world size */ \
+    "float GetShadowSample(vec2 uv, float depth, vec2 tileMin, vec2 tileMax) \n" \
+    "{                                   \n" \
+    "    vec2 texel = 1.0/vec2(textureSize(shadowMap, 0)); \n" \
+    "    float lit = 0.0;                \n" \
+    "    for (int i = 0; i < 4; i++) lit += step(depth, texture(shadowMap, clamp(uv + (vec2(i%2, i/2) - 0.5)*texel, tileMin + texel, tileMax - texel)).r); \n" \
+    "    return lit*0.25;                \n" \
+    "}                                   \n" \
+    "float GetShadowCascades(vec3 position, vec3 normal) \n" \
+    "{                                   \n" \
+    "    for (int i = 0; i < 4; i++)     \n" \
+    "    {                               \n" \
+    "        if (-position.z >= shadowSplits[i]) continue; \n" \
+    "        vec3 coord = (shadowCascades[i]*vec4(position + normal*shadowTexels[i]*1.5, 1.0)).xyz; \n" \
+    "        vec2 tileMin = vec2(float(i%2)*0.25, float(i/2)*0.5); \n" \
+    "        return (coord.z >= 1.0)? 1.0 : GetShadowSample(coord.xy, coord.z - 0.0005, tileMin, tileMin + vec2(0.25, 0.5)); \n" \
+    "    }                               \n" \
+    "    return 1.0;                     \n" \
+    "}                                   \n" \
+    "float GetShadowPoint(int slot, vec3 direction, float radius) \n" \
+    "{                                   \n" \
+    "    vec3 axis = abs(direction);     \n" \
+    "    int face = ((axis.x >= axis.y) && (axis.x >= axis.z))? ((direction.x > 0.0)? 0 : 1) : ((axis.y >= axis.z)? ((direction.y > 0.0)? 2 : 3) : ((direction.z > 0.0)? 4 : 5)); \n" \
+    "    vec3 forward = vec3(0.0);       \n" \
+    "    forward[face/2] = (face%2 == 0)? 1.0 : -1.0; \n" \
+    "    vec3 x = normalize(cross((face/2 == 1)? vec3(0.0, 0.0, 1.0) : vec3(0.0, 1.0, 0.0), -forward)); \n" \
+    "    vec3 y = cross(-forward, x);    \n" \
+    "    vec2 uv = vec2(dot(direction, x), dot(direction, y))/dot(direction, forward)*0.5 + 0.5; \n" \
+    "    int tile = slot*6 + face;       \n" \
+    "    vec2 tileSize = vec2(0.5, 1.0)/float(" LIGHTING_STRINGIFY(SHADOW_POINT_COLUMNS) "); \n" \
+    "    vec2 tileMin = vec2(0.5, 0.0) + vec2(tile%" LIGHTING_STRINGIFY(SHADOW_POINT_COLUMNS) ", tile/" LIGHTING_STRINGIFY(SHADOW_POINT_COLUMNS) ")*tileSize; \n" \
+    "    return GetShadowSample(tileMin + uv*tileSize, length(direction)/radius - 0.015, tileMin, tileMin + tileSize); \n" \
+    "}                                   \n"
+#else
+#define SHADOWS_SHADER_INCLUDE \
+    "float GetShadowCascades(vec3 position, vec3 normal) { return 1.0; } \n" \
+    "float GetShadowPoint(int slot, vec3 direction, float radius) { return 1.0; } \n"
+#endif
+
+// Clustered lighting GLSL code, lights of fragment cluster are accumulated (diffuse only)
+// NOTE: Positions and normals are in view space, clip position selects cluster tile
+#define LIGHTING_SHADER_INCLUDE \
+    "uniform sampler2D lightsData;       \n"     /* Lights: view position and radius, color and shadow slot (2 texels per light) */ \
+    "uniform sampler2D lightsClusters;   \n"     /* Clusters: lights offset and count */ \
+    "uniform sampler2D lightsIndices;    \n"     /* Clusters lights indices */ \
+    "uniform vec3 lightsAmbient;         \n" \
+    "uniform vec3 lightsDirection;       \n"     /* Directional light direction towards light (view space) */ \
+    "uniform vec3 lightsDirectionalColor; \n" \
+    "uniform vec2 lightsSlices;          \n"     /* Depth slice: log(distance)*x + y */ \
+    "uniform mat4 lightsViewToWorld;     \n"     /* Inverse view matrix (point lights shadows directions) */ \
+    SHADOWS_SHADER_INCLUDE \
+    "vec3 GetLighting(vec3 position, vec3 normal, vec4 clipPosition) \n" \
+    "{                                   \n" \
+    "    float directional = max(dot(normal, lightsDirection), 0.0); \n" \
+    "    vec3 result = lightsAmbient + lightsDirectionalColor*((directional > 0.0)? directional*GetShadowCascades(position, normal) : 0.0); \n" \
+    "    ivec3 grid = ivec3(" LIGHTING_STRINGIFY(LIGHT_CLUSTERS_X) ", " LIGHTING_STRINGIFY(LIGHT_CLUSTERS_Y) ", " LIGHTING_STRINGIFY(LIGHT_CLUSTERS_Z) "); \n" \
+    "    ivec2 tile = clamp(ivec2((clipPosition.xy/clipPosition.w*0.5 + 0.5)*vec2(grid.xy)), ivec2(0), grid.xy - 1); \n" \
+    "    int slice = clamp(int(log(max(-position.z, 0.0001))*lightsSlices.x + lightsSlices.y), 0, grid.z - 1); \n" \
+    "    vec2 cluster = texelFetch(lightsClusters, ivec2(tile.x + tile.y*grid.x, slice), 0).xy; \n" \
+    "    int offset = int(cluster.x);       \n" \
+    "    int count = int(cluster.y);        \n" \
+    "    for (int i = offset; i < offset + count; i++) \n" \
+    "    {                                   \n" \
+    "        int light = int(texelFetch(lightsIndices, ivec2(i%" LIGHTING_STRINGIFY(LIGHT_INDICES_WIDTH) ", i/" LIGHTING_STRINGIFY(LIGHT_INDICES_WIDTH) "), 0).x); \n" \
+    "        vec4 data = texelFetch(lightsData, ivec2(light*2, 0), 0); \n" \
+    "        vec4 color = texelFetch(lightsData, ivec2(light*2 + 1, 0), 0); \n" \
+    "        vec3 delta = data.xyz - position; \n" \
+    "        float distance = length(delta); \n" \
+    "        float attenuation = clamp(1.0 - distance/data.w, 0.0, 1.0); \n" \
+    "        float diffuse = attenuation*attenuation*max(dot(normal, delta/max(distance, 0.0001)), 0.0); \n" \
+    "        if ((diffuse > 0.0) && (color.w > 0.5)) diffuse *= GetShadowPoint(int(color.w) - 1, mat3(lightsViewToWorld)*(-delta), data.w); \n" \
+    "        result += color.rgb*diffuse;    \n" \
+    "    }                                   \n" \
+    "    return result;                      \n" \
+    "}                                       \n"
+#endif
+
+// Get clustered lighting GLSL code for custom shaders (GLSL 330)
+// NOTE: Code defines vec3 GetLighting(vec3 viewPosition, vec3 viewNormal, vec4 clipPosition), returns light color
+// to multiply diffuse color, shader lighting data must be set every frame with SetShaderLighting()
+const char *GetLightingShaderInclude(void)
+{
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    return LIGHTING_SHADER_INCLUDE;
+#else
+    return "";
+#endif
+}
+
+// Set clustered lighting data to custom shader, lights are binned for current camera (call inside BeginMode3D())
+// NOTE: Uniforms locations are requested on every call, lighting textures use texture units 12 to 15
+void SetShaderLighting(Shader shader)
+{
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+    if (!lightingShaderLoaded) LoadShaderLighting();
+    if (lighting.lightsTextureId == 0) return;
+
+    int locs[12] = {
+        GetShaderLocation(shader, "lightsData"),
+        GetShaderLocation(shader, "lightsClusters"),
+        GetShaderLocation(shader, "lightsIndices"),
+        GetShaderLocation(shader, "lightsAmbient"),
+        GetShaderLocation(shader, "lightsDirection"),
+        GetShaderLocation(shader, "lightsDirectionalColor"),
+        GetShaderLocation(shader, "lightsSlices"),
+        GetShaderLocation(shader, "lightsViewToWorld"),
+        GetShaderLocation(shader, "shadowMap"),
+        GetShaderLocation(shader, "shadowCascades"),
+        GetShaderLocation(shader, "shadowSplits"),
+        GetShaderLocation(shader, "shadowTexels")
+    };
+
+    rlEnableShader(shader.id);
+    SetLightingShaderState(shader, locs, rlGetMatrixModelview(), rlGetMatrixProjection());
+    rlDisableShader();
+#endif
+}
+
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+// Compute light clusters bounds (view space boxes) and depth slices for projection
+// NOTE: Depth is sliced exponentially between projection near and far planes, perspective and orthographic
+// projections are supported (tile edges are unprojected as lines)
+static void SetLightClustersBounds(Matrix matProjection)
+{
+    bool perspective = (matProjection.m11 != 0.0f);
+    float near = perspective? matProjection.m14/(matProjection.m10 - 1.0f) : (matProjection.m14 + 1.0f)/matProjection.m10;
+    float far = perspective? matProjection.m14/(matProjection.m10 + 1.0f) : (matProjection.m14 - 1.0f)/matProjection.m10;
+
+    near = fmaxf(near, 0.01f);
+    far = fmaxf(far, near*2.0f);
+
+    lighting.sliceScale = LIGHT_CLUSTERS_Z/logf(far/near);
+    lighting.sliceBias = -LIGHT_CLUSTERS_Z*logf(near)/logf(far/near);
+    lighting.matProjection = matProjection;
+
+    Matrix matInvProjection = MatrixInvert(matProjection);
+
+    for (int z = 0; z < LIGHT_CLUSTERS_Z; z++)
+    {
+        float depths[2] = { near*powf(far/near, (float)z/LIGHT_CLUSTERS_Z), near*powf(far/near, (float)(z + 1)/LIGHT_CLUSTERS_Z) };
+
+        for (int y = 0; y < LIGHT_CLUSTERS_Y; y++)
+        {
+            for (int x = 0; x < LIGHT_CLUSTERS_X; x++)
+            {
+                BoundingBox box = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+
+                for (int corner = 0; corner < 4; corner++)
+                {
+                    float ndcX = -1.0f + 2.0f*(float)(x + (corner & 1))/LIGHT_CLUSTERS_X;
+                    float ndcY = -1.0f + 2.0f*(float)(y + (corner >> 1))/LIGHT_CLUSTERS_Y;
+
+                    // Tile corner line, from near plane to far plane (view space)
+                    Quaternion a = QuaternionTransform((Quaternion){ ndcX, ndcY, -1.0f, 1.0f }, matInvProjection);
+                    Quaternion b = QuaternionTransform((Quaternion){ ndcX, ndcY, 1.0f, 1.0f }, matInvProjection);
+                    Vector3 start = { a.x/a.w, a.y/a.w, a.z/a.w };
+                    Vector3 end = { b.x/b.w, b.y/b.w, b.z/b.w };
+
+                    for (int d = 0; d < 2; d++)
+                    {
+                        // View space looks towards -Z
+                        float t = (-depths[d] - start.z)/(end.z - start.z);
+                        Vector3 point = Vector3Lerp(start, end, t);
+
+                        box.min = Vector3Min(box.min, point);
+                        box.max = Vector3Max(box.max, point);
+                    }
+                }
+
+                lighting.clusters[x + y*LIGHT_CLUSTERS_X + z*LIGHT_CLUSTERS_X*LIGHT_CLUSTERS_Y] = box;
+            }
+        }
+    }
+}
+
+// Bin lights into clusters for camera and upload lighting textures
+// NOTE: Lights are culled by their projected bounds and depth slices range, then tested against clusters boxes,
+// lights are counted per cluster on a first pass and indices written on a second pass (clusters are contiguous)
+static void UpdateLightClusters(Matrix matView, Matrix matProjection)
+{
+    bool projectionChanged = (memcmp(&lighting.matProjection, &matProjection, sizeof(Matrix)) != 0);
+
+    if (!lighting.dirty && !projectionChanged && (memcmp(&lighting.matView, &matView, sizeof(Matrix)) == 0)) return;
+
+    if (projectionChanged) SetLightClustersBounds(matProjection);
+
+    lighting.matView = matView;
+    lighting.dirty = false;
+
+    if (lighting.indices == NULL) lighting.indices = (float *)RL_CALLOC(MAX_LIGHT_CLUSTER_INDICES, sizeof(float));
+
+    // Visible lights view data (2 texels per light) and clusters range (tiles and slices)
+    float *lightsData = (float *)MemAllocScratch(lighting.activeCount*8*sizeof(float));
+    int *ranges = (int *)MemAllocScratch(lighting.activeCount*6*sizeof(int));
+    int visibleCount = 0;
+
+    for (int i = 0; (i < lighting.lightCount) && (lightsData != NULL) && (ranges != NULL); i++)
+    {
+        Vector4 light = lighting.lights[i];
+        if (light.w <= 0.0f) continue;
+
+        Vector3 center = Vector3Transform((Vector3){ light.x, light.y, light.z }, matView);
+        float radius = light.w;
+
+        int sliceMin = (int)(logf(fmaxf(-center.z - radius, 0.0001f))*lighting.sliceScale + lighting.sliceBias);
+        int sliceMax = (int)(logf(fmaxf(-center.z + radius, 0.0001f))*lighting.sliceScale + lighting.sliceBias);
+        if ((sliceMax < 0) || (sliceMin >= LIGHT_CLUSTERS_Z) || (-center.z + radius <= 0.0f)) continue;
+
+        // Light box projected bounds, full screen if box crosses camera plane
+        float ndcMin[2] = { 1.0f, 1.0f };
+        float ndcMax[2] = { -1.0f, -1.0f };
+        bool crossing = false;
+
+        for (int corner = 0; corner < 8; corner++)
+        {
+            Quaternion clip = QuaternionTransform((Quaternion){ center.x + ((corner & 1)? radius : -radius),
+                center.y + ((corner & 2)? radius : -radius), center.z + ((corner & 4)? radius : -radius), 1.0f }, matProjection);
+
+            if (clip.w <= 0.0001f) { crossing = true; break; }
+
+            ndcMin[0] = fminf(ndcMin[0], clip.x/clip.w);
+            ndcMin[1] = fminf(ndcMin[1], clip.y/clip.w);
+            ndcMax[0] = fmaxf(ndcMax[0], clip.x/clip.w);
+            ndcMax[1] = fmaxf(ndcMax[1], clip.y/clip.w);
+        }
+
+        if (crossing) { ndcMin[0] = -1.0f; ndcMin[1] = -1.0f; ndcMax[0] = 1.0f; ndcMax[1] = 1.0f; }
+        if ((ndcMin[0] > 1.0f) || (ndcMin[1] > 1.0f) || (ndcMax[0] < -1.0f) || (ndcMax[1] < -1.0f)) continue;
+
+        int *range = &ranges[visibleCount*6];
+        range[0] = (int)Clamp((ndcMin[0]*0.5f + 0.5f)*LIGHT_CLUSTERS_X, 0.0f, LIGHT_CLUSTERS_X - 1.0f);
+        range[1] = (int)Clamp((ndcMax[0]*0.5f + 0.5f)*LIGHT_CLUSTERS_X, 0.0f, LIGHT_CLUSTERS_X - 1.0f);
+        range[2] = (int)Clamp((ndcMin[1]*0.5f + 0.5f)*LIGHT_CLUSTERS_Y, 0.0f, LIGHT_CLUSTERS_Y - 1.0f);
+        range[3] = (int)Clamp((ndcMax[1]*0.5f + 0.5f)*LIGHT_CLUSTERS_Y, 0.0f, LIGHT_CLUSTERS_Y - 1.0f);
+        range[4] = (sliceMin < 0)? 0 : sliceMin;
+        range[5] = (sliceMax >= LIGHT_CLUSTERS_Z)? LIGHT_CLUSTERS_Z - 1 : sliceMax;
+
+        float *data = &lightsData[visibleCount*8];
+        data[0] = center.x; data[1] = center.y; data[2] = center.z; data[3] = radius;
+        data[4] = lighting.colors[i].x; data[5] = lighting.colors[i].y; data[6] = lighting.colors[i].z; data[7] = 0.0f;
+
+#if defined(SHADOW_MAPS_SUPPORTED)
+        // Shadow slot + 1, only once slot faces have been rendered
+        for (int s = 0; s < SHADOW_POINT_SLOTS; s++)
+        {
+            if ((shadows.pointLights[s] == i + 1) && (shadows.tileVersions[4 + s*6] != 0)) data[7] = (float)(s + 1);
+        }
+#endif
+
+        visibleCount++;
+    }
+
+    memset(lighting.clusterCounts, 0, sizeof(lighting.clusterCounts));
+    int total = 0;
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int i = 0; i < visibleCount; i++)
+        {
+            const int *range = &ranges[i*6];
+            Vector3 center = { lightsData[i*8], lightsData[i*8 + 1], lightsData[i*8 + 2] };
+            float radius = lightsData[i*8 + 3];
+
+            for (int z = range[4]; z <= range[5]; z++)
+            {
+                for (int y = range[2]; y <= range[3]; y++)
+                {
+                    for (int x = range[0]; x <= range[1]; x++)
+                    {
+                        int cluster = x + y*LIGHT_CLUSTERS_X + z*LIGHT_CLUSTERS_X*LIGHT_CLUSTERS_Y;
+                        if (!CheckCollisionBoxSphere(lighting.clusters[cluster], center, radius)) continue;
+
+                        if (pass == 0) lighting.clusterCounts[cluster]++;
+                        else if (lighting.clusterOffsets[cluster] < MAX_LIGHT_CLUSTER_INDICES)
+                        {
+                            // NOTE: Offsets are advanced while writing, restored after the pass
+                            lighting.indices[lighting.clusterOffsets[cluster]++] = (float)i;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            for (int c = 0; c < LIGHT_CLUSTERS_COUNT; c++)
+            {
+                if (total + lighting.clusterCounts[c] > MAX_LIGHT_CLUSTER_INDICES)
+                {
+                    TRACELOG(LOG_WARNING, "LIGHTING: Maximum clusters light indices reached (%i), lights skipped", MAX_LIGHT_CLUSTER_INDICES);
+                    lighting.clusterCounts[c] = MAX_LIGHT_CLUSTER_INDICES - total;
+                }
+
+                lighting.clusterOffsets[c] = total;
+                total += lighting.clusterCounts[c];
+            }
+        }
+    }
+
+    // Upload lighting textures: visible lights, clusters (offset, count) and indices rows used
+    float *clustersData = (float *)MemAllocScratch(LIGHT_CLUSTERS_COUNT*4*sizeof(float));
+
+    if (clustersData != NULL)
+    {
+        for (int c = 0; c < LIGHT_CLUSTERS_COUNT; c++)
+        {
+            clustersData[c*4] = (float)(lighting.clusterOffsets[c] - lighting.clusterCounts[c]);
+            clustersData[c*4 + 1] = (float)lighting.clusterCounts[c];
+            clustersData[c*4 + 2] = 0.0f;
+            clustersData[c*4 + 3] = 0.0f;
+        }
+
+        if (visibleCount > 0) rlUpdateTexture(lighting.lightsTextureId, 0, 0, visibleCount*2, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, lightsData);
+        rlUpdateTexture(lighting.clustersTextureId, 0, 0, LIGHT_CLUSTERS_X*LIGHT_CLUSTERS_Y, LIGHT_CLUSTERS_Z, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, clustersData);
+        if (total > 0) rlUpdateTexture(lighting.indicesTextureId, 0, 0, LIGHT_INDICES_WIDTH, (total + LIGHT_INDICES_WIDTH - 1)/LIGHT_INDICES_WIDTH, PIXELFORMAT_UNCOMPRESSED_R32, lighting.indices);
+    }
+
+    lighting.visibleCount = visibleCount;
+
+    MemFreeScratch(clustersData);
+    MemFreeScratch(ranges);
+    MemFreeScratch(lightsData);
+}
+
+// Bind lighting textures to texture units after material maps and upload lighting uniforms
+// NOTE: Lights are binned again only if lights or camera changed
+static void SetLightingShaderState(Shader shader, const int *locs, Matrix matView, Matrix matProjection)
+{
+    UpdateLightClusters(matView, matProjection);
+
+    unsigned int textures[3] = { lighting.lightsTextureId, lighting.clustersTextureId, lighting.indicesTextureId };
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (locs[i] == -1) continue;
+
+        int slot = LIGHTING_TEXTURE_SLOT + i;
+        rlActiveTextureSlot(slot);
+        rlEnableTexture(textures[i]);
+        rlSetUniform(locs[i], &slot, SHADER_UNIFORM_INT, 1);
+    }
+
+    rlActiveTextureSlot(0);
+
+    // Directional light direction towards light, in view space
+    Vector3 direction = {
+        -(matView.m0*lighting.direction.x + matView.m4*lighting.direction.y + matView.m8*lighting.direction.z),
+        -(matView.m1*lighting.direction.x + matView.m5*lighting.direction.y + matView.m9*lighting.direction.z),
+        -(matView.m2*lighting.direction.x + matView.m6*lighting.direction.y + matView.m10*lighting.direction.z)
+    };
+    float slices[2] = { lighting.sliceScale, lighting.sliceBias };
+
+    if (locs[3] != -1) rlSetUniform(locs[3], &lighting.ambient, SHADER_UNIFORM_VEC3, 1);
+    if (locs[4] != -1) rlSetUniform(locs[4], &direction, SHADER_UNIFORM_VEC3, 1);
+    if (locs[5] != -1) rlSetUniform(locs[5], &lighting.directionalColor, SHADER_UNIFORM_VEC3, 1);
+    if (locs[6] != -1) rlSetUniform(locs[6], slices, SHADER_UNIFORM_VEC2, 1);
+
+    Matrix matViewInverse = MatrixInvert(matView);
+    if (locs[7] != -1) rlSetUniformMatrix(locs[7], matViewInverse);
+
+#if defined(SHADOW_MAPS_SUPPORTED)
+    // Shadow atlas and cascades matrices from view space, cascades are disabled by zero splits
+    float splits[4] = { 0 };
+
+    if (shadows.atlasTextureId != 0)
+    {
+        if (locs[8] != -1)
+        {
+            int slot = SHADOW_TEXTURE_SLOT;
+            rlActiveTextureSlot(slot);
+            rlEnableTexture(shadows.atlasTextureId);
+            rlSetUniform(locs[8], &slot, SHADER_UNIFORM_INT, 1);
+            rlActiveTextureSlot(0);
+        }
+
+        memcpy(splits, shadows.splits, sizeof(splits));
+    }
+
+    if (locs[9] != -1)
+    {
+        Matrix cascades[4] = { 0 };
+        for (int i = 0; i < 4; i++) cascades[i] = MatrixMultiply(matViewInverse, shadows.cascades[i]);
+        rlSetUniformMatrices(locs[9], cascades, 4);
+    }
+
+    if (locs[10] != -1) rlSetUniform(locs[10], splits, SHADER_UNIFORM_VEC4, 1);
+    if (locs[11] != -1) rlSetUniform(locs[11], shadows.texels, SHADER_UNIFORM_VEC4, 1);
+#endif
+}
+
+// Load built-in clustered lighting shader and lighting textures (float textures, sampled with texelFetch())
+// NOTE: Mirrors rlgl default shader, diffuse color is multiplied by lights of fragment cluster
+static void LoadShaderLighting(void)
+{
+    const char *lightingVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec3 vertexNormal;              \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "out vec3 fragViewPosition;         \n"
+    "out vec3 fragViewNormal;           \n"
+    "out vec4 fragClipPosition;         \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 matModel;             \n"
+    "uniform mat4 matView;              \n"
+    "uniform mat4 matNormal;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    fragViewPosition = vec3(matView*matModel*vec4(vertexPosition, 1.0)); \n"
+    "    fragViewNormal = mat3(matView)*(mat3(matNormal)*vertexNormal); \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "    fragClipPosition = gl_Position; \n"
+    "}                                  \n";
+
+    const char *lightingFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in vec3 fragViewPosition;          \n"
+    "in vec3 fragViewNormal;            \n"
+    "in vec4 fragClipPosition;          \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    LIGHTING_SHADER_INCLUDE
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 color = texture(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "    finalColor = vec4(color.rgb*GetLighting(fragViewPosition, normalize(fragViewNormal), fragClipPosition), color.a); \n"
+    "}                                  \n";
+
+    lightingShaderLoaded = true;
+    lightingShader = LoadShaderFromMemory(lightingVShaderCode, lightingFShaderCode);
+    lightingShaderLocs[0] = GetShaderLocation(lightingShader, "lightsData");
+    lightingShaderLocs[1] = GetShaderLocation(lightingShader, "lightsClusters");
+    lightingShaderLocs[2] = GetShaderLocation(lightingShader, "lightsIndices");
+    lightingShaderLocs[3] = GetShaderLocation(lightingShader, "lightsAmbient");
+    lightingShaderLocs[4] = GetShaderLocation(lightingShader, "lightsDirection");
+    lightingShaderLocs[5] = GetShaderLocation(lightingShader, "lightsDirectionalColor");
+    lightingShaderLocs[6] = GetShaderLocation(lightingShader, "lightsSlices");
+    lightingShaderLocs[7] = GetShaderLocation(lightingShader, "lightsViewToWorld");
+    lightingShaderLocs[8] = GetShaderLocation(lightingShader, "shadowMap");
+    lightingShaderLocs[9] = GetShaderLocation(lightingShader, "shadowCascades");
+    lightingShaderLocs[10] = GetShaderLocation(lightingShader, "shadowSplits");
+    lightingShaderLocs[11] = GetShaderLocation(lightingShader, "shadowTexels");
+
+    if ((lightingShader.id > 0) && (lightingShader.id != rlGetShaderIdDefault()) && (lightingShaderLocs[0] != -1))
+    {
+        lighting.lightsTextureId = rlLoadTexture(NULL, MAX_POINT_LIGHTS*2, 1, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+        lighting.clustersTextureId = rlLoadTexture(NULL, LIGHT_CLUSTERS_X*LIGHT_CLUSTERS_Y, LIGHT_CLUSTERS_Z, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+        lighting.indicesTextureId = rlLoadTexture(NULL, LIGHT_INDICES_WIDTH, MAX_LIGHT_CLUSTER_INDICES/LIGHT_INDICES_WIDTH, PIXELFORMAT_UNCOMPRESSED_R32, 1);
+
+        // Lights are binned again on first lit draw
+        lighting.dirty = true;
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Clustered lighting shader loaded successfully", lightingShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load clustered lighting shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (lightingShader.id != rlGetShaderIdDefault()) UnloadShader(lightingShader);
+        else RL_FREE(lightingShader.locs);
+
+        lightingShader = (Shader){ 0 };
+    }
+}
+#endif
+
+#if defined(SHADOW_MAPS_SUPPORTED)
+// Load shadow atlases (shadow atlas and static casters cache) and built-in shadow shaders
+// NOTE: Atlases are depth-only framebuffers, static atlas tiles are copied into shadow atlas by a depth writing quad
+static void LoadShadowMaps(void)
+{
+    const char *casterVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "out vec3 fragPosition;             \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform mat4 matModel;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragPosition = vec3(matModel*vec4(vertexPosition, 1.0)); \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Point lights depth is distance to light normalized by radius (cube faces share it), directional light uses clip depth
+    const char *casterFShaderCode =
+    "#version 330                       \n"
+    "in vec3 fragPosition;              \n"
+    "uniform vec4 shadowLight;          \n"    // Point light position and radius, radius 0 for directional light
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragDepth = (shadowLight.w > 0.0)? length(fragPosition - shadowLight.xyz)/shadowLight.w : gl_FragCoord.z; \n"
+    "}                                  \n";
+
+    const char *copyVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *copyFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragDepth = texture(texture0, fragTexCoord).r; \n"
+    "}                                  \n";
+
+    shadowShadersLoaded = true;
+    shadowCasterShader = LoadShaderFromMemory(casterVShaderCode, casterFShaderCode);
+    shadowCasterLightLoc = GetShaderLocation(shadowCasterShader, "shadowLight");
+    shadowCopyShader = LoadShaderFromMemory(copyVShaderCode, copyFShaderCode);
+
+    bool loaded = (shadowCasterShader.id > 0) && (shadowCasterShader.id != rlGetShaderIdDefault()) && (shadowCasterLightLoc != -1) &&
+        (shadowCopyShader.id > 0) && (shadowCopyShader.id != rlGetShaderIdDefault());
+
+    if (loaded)
+    {
+        shadows.atlasTextureId = rlLoadTextureDepth(SHADOW_ATLAS_WIDTH, SHADOW_ATLAS_HEIGHT, false);
+        shadows.atlasFboId = rlLoadFramebuffer(SHADOW_ATLAS_WIDTH, SHADOW_ATLAS_HEIGHT);
+        rlFramebufferAttach(shadows.atlasFboId, shadows.atlasTextureId, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        shadows.staticTextureId = rlLoadTextureDepth(SHADOW_ATLAS_WIDTH, SHADOW_ATLAS_HEIGHT, false);
+        shadows.staticFboId = rlLoadFramebuffer(SHADOW_ATLAS_WIDTH, SHADOW_ATLAS_HEIGHT);
+        rlFramebufferAttach(shadows.staticFboId, shadows.staticTextureId, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        loaded = rlFramebufferComplete(shadows.atlasFboId) && rlFramebufferComplete(shadows.staticFboId);
+        rlDisableFramebuffer();
+    }
+
+    if (loaded) TRACELOG(LOG_INFO, "SHADER: [ID %i] Shadow maps shader loaded successfully (%ix%i atlas)", shadowCasterShader.id, SHADOW_ATLAS_WIDTH, SHADOW_ATLAS_HEIGHT);
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load shadow maps, shadows disabled");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (shadowCasterShader.id != rlGetShaderIdDefault()) UnloadShader(shadowCasterShader);
+        else RL_FREE(shadowCasterShader.locs);
+        if (shadowCopyShader.id != rlGetShaderIdDefault()) UnloadShader(shadowCopyShader);
+        else RL_FREE(shadowCopyShader.locs);
+
+        rlUnloadFramebuffer(shadows.atlasFboId);
+        rlUnloadFramebuffer(shadows.staticFboId);
+        rlUnloadTexture(shadows.atlasTextureId);
+        rlUnloadTexture(shadows.staticTextureId);
+
+        shadowCasterShader = (Shader){ 0 };
+        shadowCopyShader = (Shader){ 0 };
+        shadows.atlasTextureId = 0;
+        shadows.atlasFboId = 0;
+        shadows.staticTextureId = 0;
+        shadows.staticFboId = 0;
+    }
+}
+
+// Render shadow atlas tiles for camera: directional light cascades and shadowed point lights cube faces
+// NOTE: Cascades bounds are snapped to coarse texel-aligned steps, cascades matrices only change when camera
+// moves a step (no shimmering) and static casters tiles stay cached while camera moves inside it
+static void RenderShadowMaps(Matrix matView, Matrix matProjection)
+{
+    bool directional = shadows.directional && (Vector3LengthSqr(lighting.directionalColor) > 0.0f);
+    bool points = false;
+
+    for (int s = 0; s < SHADOW_POINT_SLOTS; s++)
+    {
+        if (shadows.pointLights[s] > 0) points = true;
+    }
+
+    memset(shadows.splits, 0, sizeof(shadows.splits));
+
+    if (!directional && !points) return;
+    if (!shadowShadersLoaded) LoadShadowMaps();
+    if (shadows.atlasFboId == 0) return;
+
+    RL_PROFILE_ZONE_BEGIN(zone, "RenderShadowMaps");
+
+    // Pending batch is drawn before framebuffer change, framebuffer and viewport are restored after tiles render
+    rlDrawRenderBatchActive();
+
+    unsigned int framebuffer = rlGetActiveFramebuffer();
+    int viewport[4] = { 0 };
+    rlGetViewport(&viewport[0], &viewport[1], &viewport[2], &viewport[3]);
+
+    // Static tiles copies are drawn by rlgl batch in clip space
+    rlSetMatrixModelview(MatrixIdentity());
+    rlSetMatrixProjection(MatrixIdentity());
+    rlEnableDepthTest();
+    rlEnableDepthMask();
+
+    if (directional)
+    {
+        // Cascades distances from camera projection near plane, up to SHADOW_DISTANCE
+        bool perspective = (matProjection.m11 != 0.0f);
+        float near = perspective? matProjection.m14/(matProjection.m10 - 1.0f) : (matProjection.m14 + 1.0f)/matProjection.m10;
+        float far = perspective? matProjection.m14/(matProjection.m10 + 1.0f) : (matProjection.m14 - 1.0f)/matProjection.m10;
+        near = fmaxf(near, 0.0001f);
+        far = Clamp(far, near + 0.0001f, SHADOW_DISTANCE);
+
+        Matrix matViewInverse = MatrixInvert(matView);
+        Vector3 up = (fabsf(lighting.direction.y) > 0.99f)? (Vector3){ 0.0f, 0.0f, 1.0f } : (Vector3){ 0.0f, 1.0f, 0.0f };
+        Matrix matLightRotation = MatrixLookAt(Vector3Zero(), lighting.direction, up);
+
+        for (int i = 0; i < SHADOW_CASCADES; i++)
+        {
+            // Practical split scheme: logarithmic and uniform splits blend
+            float t = (float)(i + 1)/SHADOW_CASCADES;
+            float start = (i == 0)? near : shadows.splits[i - 1];
+            float end = 0.75f*near*powf(far/near, t) + 0.25f*(near + (far - near)*t);
+
+            // Cascade bounding sphere centered on view axis, its radius only depends on splits (stable on camera rotation)
+            float center = 0.5f*(start + end);
+            float radius = 0.0f;
+
+            for (int d = 0; d < 2; d++)
+            {
+                float distance = (d == 0)? start : end;
+                float x = (perspective? distance : 1.0f)/matProjection.m0;
+                float y = (perspective? distance : 1.0f)/matProjection.m5;
+                radius = fmaxf(radius, sqrtf(x*x + y*y + (distance - center)*(distance - center)));
+            }
+
+            radius = ceilf(radius*16.0f)/16.0f;
+
+            // Cascade area half size includes snap step margin: step is 1/8 of cascade, sphere is 3/4 of area
+            float size = radius*4.0f/3.0f;
+            float step = 2.0f*size/SHADOW_CASCADE_SIZE*(float)(SHADOW_CASCADE_SIZE/8);
+            Vector3 origin = Vector3Transform(Vector3Transform((Vector3){ 0.0f, 0.0f, -center }, matViewInverse), matLightRotation);
+            origin.x = floorf(origin.x/step)*step;
+            origin.y = floorf(origin.y/step)*step;
+            origin.z = floorf(origin.z/step)*step;
+
+            // NOTE: Casters between light and cascade area are included up to SHADOW_DISTANCE
+            Matrix matLightView = MatrixMultiply(matLightRotation, MatrixTranslate(-origin.x, -origin.y, -origin.z));
+            Matrix matLightProjection = MatrixOrtho(-size, size, -size, size, -(size + step + SHADOW_DISTANCE), size + step);
+            Rectangle rect = { (float)((i%2)*SHADOW_CASCADE_SIZE), (float)((i/2)*SHADOW_CASCADE_SIZE), SHADOW_CASCADE_SIZE, SHADOW_CASCADE_SIZE };
+
+            RenderShadowTile(i, rect, matLightView, matLightProjection, (Vector4){ 0 });
+
+            // World to shadow atlas tile: clip space scaled and biased to tile uv and depth [0..1]
+            Matrix matBias = MatrixMultiply(MatrixScale(0.5f*rect.width/SHADOW_ATLAS_WIDTH, 0.5f*rect.height/SHADOW_ATLAS_HEIGHT, 0.5f),
+                MatrixTranslate((rect.x + 0.5f*rect.width)/SHADOW_ATLAS_WIDTH, (rect.y + 0.5f*rect.height)/SHADOW_ATLAS_HEIGHT, 0.5f));
+
+            shadows.cascades[i] = MatrixMultiply(MatrixMultiply(matLightView, matLightProjection), matBias);
+            shadows.splits[i] = end;
+            shadows.texels[i] = 2.0f*size/SHADOW_CASCADE_SIZE;
+        }
+    }
+
+    // Point lights cube faces: +X, -X, +Y, -Y, +Z, -Z (same faces orientation on lighting shader)
+    const Vector3 faces[6] = { { 1.0f, 0.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f } };
+
+    for (int s = 0; s < SHADOW_POINT_SLOTS; s++)
+    {
+        int id = shadows.pointLights[s] - 1;
+        if ((id < 0) || (lighting.lights[id].w <= 0.0f)) continue;
+
+        Vector4 light = lighting.lights[id];
+        Vector3 position = { light.x, light.y, light.z };
+        Matrix matLightProjection = MatrixPerspective(90.0*DEG2RAD, 1.0, fminf(0.05f, 0.01f*light.w), light.w);
+
+        for (int face = 0; face < 6; face++)
+        {
+            int tile = s*6 + face;
+            Rectangle rect = { (float)(2*SHADOW_CASCADE_SIZE + (tile%SHADOW_POINT_COLUMNS)*SHADOW_POINT_SIZE), (float)((tile/SHADOW_POINT_COLUMNS)*SHADOW_POINT_SIZE), SHADOW_POINT_SIZE, SHADOW_POINT_SIZE };
+            Vector3 up = ((face/2) == 1)? (Vector3){ 0.0f, 0.0f, 1.0f } : (Vector3){ 0.0f, 1.0f, 0.0f };
+
+            // Lights data holds shadow slot once its faces have been rendered
+            if (shadows.tileVersions[4 + tile] == 0) lighting.dirty = true;
+
+            RenderShadowTile(4 + tile, rect, MatrixLookAt(position, Vector3Add(position, faces[face]), up), matLightProjection, light);
+        }
+    }
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableShader();
+
+    rlEnableFramebuffer(framebuffer);
+    rlViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    rlSetMatrixModelview(matView);
+    rlSetMatrixProjection(matProjection);
+
+    RL_PROFILE_ZONE_END(zone);
+}
+
+// Render shadow atlas tile: static casters into static atlas (only if changed), static tile copy and dynamic casters
+// NOTE: Tile is skipped if static tile did not change and no dynamic casters are inside it (now or on last render)
+static void RenderShadowTile(int index, Rectangle rect, Matrix matLightView, Matrix matLightProjection, Vector4 light)
+{
+    Matrix matLightViewProjection = MatrixMultiply(matLightView, matLightProjection);
+    Frustum frustum = GetMatrixFrustum(matLightViewProjection);
+
+    bool staticChanged = (shadows.tileVersions[index] != shadows.version) || (memcmp(&shadows.tiles[index], &matLightViewProjection, sizeof(Matrix)) != 0);
+    bool dynamic = false;
+
+    for (int i = 0; (i < renderQueue.count) && !dynamic; i++)
+    {
+        QueuedDraw *draw = &renderQueue.draws[i];
+        dynamic = draw->castShadows && CheckFrustumMesh(frustum, draw->mesh, draw->matModel);
+    }
+
+    if (!staticChanged && !dynamic && !shadows.tileDynamic[index]) return;
+
+    Material material = { .shader = shadowCasterShader };
+
+    if (staticChanged)
+    {
+        ClearShadowTile(shadows.staticFboId, rect);
+        rlEnableShader(shadowCasterShader.id);
+        rlSetUniform(shadowCasterLightLoc, &light, SHADER_UNIFORM_VEC4, 1);
+
+        for (int i = 0; i < shadows.casterCount; i++)
+        {
+            ShadowCaster *caster = &shadows.casters[i];
+            if (caster->active && CheckFrustumMesh(frustum, caster->mesh, caster->transform)) DrawMeshGeometry(caster->mesh, material, caster->transform, caster->transform, matLightView, matLightProjection);
+        }
+
+        shadows.tiles[index] = matLightViewProjection;
+        shadows.tileVersions[index] = shadows.version;
+    }
+
+    // Static tile copy, drawn in clip space with tile texture coordinates
+    ClearShadowTile(shadows.atlasFboId, rect);
+
+    float u0 = rect.x/SHADOW_ATLAS_WIDTH;
+    float v0 = rect.y/SHADOW_ATLAS_HEIGHT;
+    float u1 = (rect.x + rect.width)/SHADOW_ATLAS_WIDTH;
+    float v1 = (rect.y + rect.height)/SHADOW_ATLAS_HEIGHT;
+
+    rlSetShader(shadowCopyShader.id, shadowCopyShader.locs);
+    rlSetTexture(shadows.staticTextureId);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlTexCoord2f(u0, v0); rlVertex2f(-1.0f, -1.0f);
+        rlTexCoord2f(u1, v0); rlVertex2f(1.0f, -1.0f);
+        rlTexCoord2f(u1, v1); rlVertex2f(1.0f, 1.0f);
+        rlTexCoord2f(u0, v1); rlVertex2f(-1.0f, 1.0f);
+    rlEnd();
+    rlSetTexture(0);
+    rlDrawRenderBatchActive();
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+
+    // Dynamic casters: render queue draws casting shadows
+    if (dynamic)
+    {
+        rlEnableShader(shadowCasterShader.id);
+        rlSetUniform(shadowCasterLightLoc, &light, SHADER_UNIFORM_VEC4, 1);
+
+        for (int i = 0; i < renderQueue.count; i++)
+        {
+            QueuedDraw *draw = &renderQueue.draws[i];
+            if (draw->castShadows && CheckFrustumMesh(frustum, draw->mesh, draw->matModel)) DrawMeshGeometry(draw->mesh, material, draw->matModel, draw->matModel, matLightView, matLightProjection);
+        }
+    }
+
+    shadows.tileDynamic[index] = dynamic;
+}
+
+// Bind shadow atlas framebuffer, set tile viewport and clear tile depth
+static void ClearShadowTile(unsigned int fboId, Rectangle rect)
+{
+    rlEnableFramebuffer(fboId);
+    rlViewport((int)rect.x, (int)rect.y, (int)rect.width, (int)rect.height);
+    rlEnableScissorTest();
+    rlScissor((int)rect.x, (int)rect.y, (int)rect.width, (int)rect.height);
+    rlClearScreenBuffers();
+    rlDisableScissorTest();
+}
+#endif
+
+// Unload lighting shader, textures and clusters buffers (called by CloseWindow())
+// NOTE: Lights are kept, they are drawn again if window is initialized again
+extern void UnloadLighting(void)
+{
+#if defined(LIGHTMAP_SHADERS_SUPPORTED)
+    if (lightmapShader.id > 0) UnloadShader(lightmapShader);
+
+    lightmapShader = (Shader){ 0 };
+    lightmapShaderLoaded = false;
+#endif
+#if defined(LIGHTING_SHADERS_SUPPORTED)
+    if (lightingShader.id > 0)
+    {
+        UnloadShader(lightingShader);
+        rlUnloadTexture(lighting.lightsTextureId);
+        rlUnloadTexture(lighting.clustersTextureId);
+        rlUnloadTexture(lighting.indicesTextureId);
+    }
+
+    lightingShader = (Shader){ 0 };
+    lightingShaderLoaded = false;
+#endif
+#if defined(SUPPORT_CLUSTERED_LIGHTING)
+    RL_FREE(lighting.indices);
+
+    lighting.indices = NULL;
+    lighting.lightsTextureId = 0;
+    lighting.clustersTextureId = 0;
+    lighting.indicesTextureId = 0;
+    lighting.matProjection = (Matrix){ 0 };
+    lighting.dirty = true;
+#endif
+#if defined(SHADOW_MAPS_SUPPORTED)
+    if (shadowCasterShader.id > 0)
+    {
+        UnloadShader(shadowCasterShader);
+        UnloadShader(shadowCopyShader);
+        rlUnloadFramebuffer(shadows.atlasFboId);
+        rlUnloadFramebuffer(shadows.staticFboId);
+        rlUnloadTexture(shadows.atlasTextureId);
+        rlUnloadTexture(shadows.staticTextureId);
+    }
+
+    shadowCasterShader = (Shader){ 0 };
+    shadowCopyShader = (Shader){ 0 };
+    shadowShadersLoaded = false;
+#endif
+#if defined(SUPPORT_SHADOW_MAPS)
+    // NOTE: Static casters reference meshes unloaded with window, shadowed lights are kept
+    RL_FREE(shadows.casters);
+
+    shadows.casters = NULL;
+    shadows.casterCount = 0;
+    shadows.casterCapacity = 0;
+    shadows.version++;
+    shadows.atlasTextureId = 0;
+    shadows.atlasFboId = 0;
+    shadows.staticTextureId = 0;
+    shadows.staticFboId = 0;
+    memset(shadows.tileVersions, 0, sizeof(shadows.tileVersions));
+    memset(shadows.tileDynamic, 0, sizeof(shadows.tileDynamic));
+    memset(shadows.splits, 0, sizeof(shadows.splits));
+#endif
+}
+
+// Generate model lightmap texture coordinates (texcoords2), every mesh is split into charts (connected faces
+// with similar normals) projected on their plane, all model charts are packed into one size x size atlas
+// NOTE: Vertices shared by several charts are split, uploaded meshes are uploaded again,
+// padding texels are kept around every chart so bilinear filtering does not bleed between charts
+void GenModelLightmapUVs(Model *model, int size, int padding)
+{
+#if defined(SUPPORT_LIGHTMAPS)
+    if ((model->meshCount <= 0) || (size <= 0)) return;
+    if (padding < 0) padding = 0;
+
+    LightmapChart *charts = NULL;
+    int chartCount = 0;
+    int chartCapacity = 0;
+    int **triangleCharts = (int **)RL_CALLOC(model->meshCount, sizeof(int *));
+
+    for (int m = 0; m < model->meshCount; m++)
+    {
+        Mesh *mesh = &model->meshes[m];
+
+        if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0) || ((mesh->indices == NULL) && (mesh->vertexCount < mesh->triangleCount*3)))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Mesh %i lightmap UVs not generated, vertex data not available in CPU memory", m);
+            continue;
+        }
+
+        if ((mesh->animVertices != NULL) || (mesh->boneIds != NULL) || (mesh->morphTargetCount > 0))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Mesh %i lightmap UVs not generated, animated meshes are not lightmapped", m);
+            continue;
+        }
+
+        // NOTE: Uploaded mesh is uploaded again from CPU vertex data, it must be complete
+        if ((mesh->vboId != NULL) && (((mesh->vboId[1] > 0) && (mesh->texcoords == NULL)) || ((mesh->vboId[2] > 0) && (mesh->normals == NULL)) ||
+            ((mesh->vboId[3] > 0) && (mesh->colors == NULL)) || ((mesh->vboId[4] > 0) && (mesh->tangents == NULL))))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Mesh %i lightmap UVs not generated, mesh CPU data has been unloaded", m);
+            continue;
+        }
+
+        triangleCharts[m] = (int *)RL_MALLOC(mesh->triangleCount*sizeof(int));
+        GenMeshLightmapCharts(*mesh, triangleCharts[m], &charts, &chartCount, &chartCapacity);
+    }
+
+    // Initial texels per unit fill most of the atlas, reduced until charts fit with their padding
+    float area = 0.0f;
+    for (int i = 0; i < chartCount; i++) area += charts[i].size.x*charts[i].size.y;
+
+    float scale = (area > 0.0f)? sqrtf(0.7f*size*size/area) : 1.0f;
+    bool packed = false;
+
+    for (int i = 0; (i < 64) && !packed && (chartCount > 0); i++)
+    {
+        packed = PackLightmapCharts(charts, chartCount, size, padding, scale);
+        if (!packed) scale *= 0.9f;
+    }
+
+    if (packed)
+    {
+        for (int m = 0; m < model->meshCount; m++)
+        {
+            Mesh *mesh = &model->meshes[m];
+
+            if ((triangleCharts[m] == NULL) || !SetMeshLightmapUVs(mesh, triangleCharts[m], charts, size, padding, scale)) continue;
+
+            // Vertices count could change, mesh is uploaded again
+            if (mesh->vboId != NULL)
+            {
+                rlUnloadVertexArray(mesh->vaoId);
+                for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+                RL_FREE(mesh->vboId);
+
+                mesh->vaoId = 0;
+                mesh->vboId = NULL;
+                UploadMesh(mesh, false);
+            }
+        }
+
+        TRACELOG(LOG_INFO, "MODEL: Lightmap UVs generated (%i charts, %ix%i atlas, %.2f texels per unit)", chartCount, size, size, scale);
+    }
+    else if (chartCount > 0) TRACELOG(LOG_WARNING, "MODEL: Lightmap UVs not generated, %i charts do not fit %ix%i atlas", chartCount, size, size);
+
+    for (int m = 0; m < model->meshCount; m++) RL_FREE(triangleCharts[m]);
+    RL_FREE(triangleCharts);
+    RL_FREE(charts);
+#endif
+}
+
+// Bake current lights into model lightmap (GenModelLightmapUVs() texture coordinates), lights are occluded by model meshes
+// NOTE: Texels get direct light (point and directional lights, same attenuation as clustered lighting) and, if samples > 0,
+// one bounce of indirect light gathered with samples rays, rays escaping the model get ambient light (ambient occlusion),
+// rows are baked in parallel on job system workers, light is stored divided by LIGHTMAP_RANGE
+Image BakeModelLightmap(Model model, int size, int samples)
+{
+    Image image = { 0 };
+
+#if defined(SUPPORT_LIGHTMAPS)
+    if ((model.meshCount <= 0) || (size <= 0)) return image;
+
+    LightmapTexel *texels = (LightmapTexel *)RL_CALLOC(size*size, sizeof(LightmapTexel));
+    Matrix matNormal = MatrixTranspose(MatrixInvert(model.transform));
+
+    // Rasterize meshes triangles in lightmap space, texels store world space surface position and normal
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+        if ((mesh.vertices == NULL) || (mesh.texcoords2 == NULL)) continue;
+
+        for (int t = 0; t < mesh.triangleCount; t++)
+        {
+            int v[3] = { 0 };
+            Vector3 positions[3] = { 0 };
+            Vector2 uvs[3] = { 0 };
+
+            for (int k = 0; k < 3; k++)
+            {
+                v[k] = (mesh.indices != NULL)? mesh.indices[t*3 + k] : t*3 + k;
+                positions[k] = ((Vector3 *)mesh.vertices)[v[k]];
+                uvs[k] = (Vector2){ mesh.texcoords2[v[k]*2]*size, mesh.texcoords2[v[k]*2 + 1]*size };
+            }
+
+            float area = (uvs[1].x - uvs[0].x)*(uvs[2].y - uvs[0].y) - (uvs[2].x - uvs[0].x)*(uvs[1].y - uvs[0].y);
+            if (fabsf(area) < 0.000001f) continue;
+
+            Vector3 faceNormal = Vector3CrossProduct(Vector3Subtract(positions[1], positions[0]), Vector3Subtract(positions[2], positions[0]));
+
+            int minX = (int)fmaxf(floorf(fminf(uvs[0].x, fminf(uvs[1].x, uvs[2].x))), 0.0f);
+            int minY = (int)fmaxf(floorf(fminf(uvs[0].y, fminf(uvs[1].y, uvs[2].y))), 0.0f);
+            int maxX = (int)fminf(ceilf(fmaxf(uvs[0].x, fmaxf(uvs[1].x, uvs[2].x))), (float)(size - 1));
+            int maxY = (int)fminf(ceilf(fmaxf(uvs[0].y, fmaxf(uvs[1].y, uvs[2].y))), (float)(size - 1));
+
+            for (int y = minY; y <= maxY; y++)
+            {
+                for (int x = minX; x <= maxX; x++)
+                {
+                    // Texel center barycentric coordinates, texels slightly outside triangle edges are covered
+                    // (clamped to triangle) so edge texels sampled by bilinear filtering are baked
+                    Vector2 p = { x + 0.5f, y + 0.5f };
+                    float w0 = ((uvs[1].x - p.x)*(uvs[2].y - p.y) - (uvs[2].x - p.x)*(uvs[1].y - p.y))/area;
+                    float w1 = ((uvs[2].x - p.x)*(uvs[0].y - p.y) - (uvs[0].x - p.x)*(uvs[2].y - p.y))/area;
+                    float w2 = 1.0f - w0 - w1;
+
+                    if ((w0 < -0.05f) || (w1 < -0.05f) || (w2 < -0.05f)) continue;
+
+                    LightmapTexel *texel = &texels[y*size + x];
+                    bool inside = (w0 >= 0.0f) && (w1 >= 0.0f) && (w2 >= 0.0f);
+                    if (texel->covered && !inside) continue;
+
+                    w0 = fmaxf(w0, 0.0f);
+                    w1 = fmaxf(w1, 0.0f);
+                    w2 = fmaxf(w2, 0.0f);
+                    float sum = w0 + w1 + w2;
+
+                    Vector3 position = Vector3Scale(Vector3Add(Vector3Add(Vector3Scale(positions[0], w0), Vector3Scale(positions[1], w1)), Vector3Scale(positions[2], w2)), 1.0f/sum);
+                    Vector3 normal = faceNormal;
+
+                    if (mesh.normals != NULL)
+                    {
+                        const Vector3 *normals = (const Vector3 *)mesh.normals;
+                        normal = Vector3Add(Vector3Add(Vector3Scale(normals[v[0]], w0), Vector3Scale(normals[v[1]], w1)), Vector3Scale(normals[v[2]], w2));
+                    }
+
+                    texel->position = Vector3Transform(position, model.transform);
+                    texel->normal = Vector3Normalize((Vector3){
+                        matNormal.m0*normal.x + matNormal.m4*normal.y + matNormal.m8*normal.z,
+                        matNormal.m1*normal.x + matNormal.m5*normal.y + matNormal.m9*normal.z,
+                        matNormal.m2*normal.x + matNormal.m6*normal.y + matNormal.m10*normal.z });
+                    texel->covered = true;
+                }
+            }
+        }
+    }
+
+    // Meshes BVH and diffuse colors, all model meshes occlude lights and bounce light
+    MeshBVH *bvhs = (MeshBVH *)RL_CALLOC(model.meshCount, sizeof(MeshBVH));
+    Vector3 *albedos = (Vector3 *)RL_MALLOC(model.meshCount*sizeof(Vector3));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        bvhs[m] = LoadMeshBVH(model.meshes[m]);
+        albedos[m] = (Vector3){ 1.0f, 1.0f, 1.0f };
+
+        if ((model.materials != NULL) && (model.meshMaterial != NULL) && (model.materials[model.meshMaterial[m]].maps != NULL))
+        {
+            Color color = model.materials[model.meshMaterial[m]].maps[MATERIAL_MAP_DIFFUSE].color;
+            albedos[m] = (Vector3){ color.r/255.0f, color.g/255.0f, color.b/255.0f };
+        }
+    }
+
+    BoundingBox bounds = GetModelBoundingBox(model);
+
+    LightmapBake bake = { 0 };
+    bake.texels = texels;
+    bake.light = (Vector3 *)RL_CALLOC(size*size, sizeof(Vector3));
+    bake.size = size;
+    bake.samples = (samples > 0)? samples : 0;
+    bake.bvhs = bvhs;
+    bake.albedos = albedos;
+    bake.meshCount = model.meshCount;
+    bake.transform = model.transform;
+    bake.invTransform = MatrixInvert(model.transform);
+    bake.bias = fmaxf(0.0005f*Vector3Distance(bounds.min, bounds.max), 0.0001f);
+
+    ParallelFor(BakeLightmapRows, &bake, size, 1);
+
+    // Dilate covered texels into empty neighbors (charts padding), bilinear filtering on charts borders
+    // fetches baked light instead of black texels
+    unsigned char *covered = (unsigned char *)RL_MALLOC(size*size);
+    unsigned char *dilated = (unsigned char *)RL_MALLOC(size*size);
+    for (int i = 0; i < size*size; i++) covered[i] = texels[i].covered;
+
+    for (int pass = 0; pass < 16; pass++)
+    {
+        bool changed = false;
+        memcpy(dilated, covered, size*size);
+
+        for (int y = 0; y < size; y++)
+        {
+            for (int x = 0; x < size; x++)
+            {
+                if (covered[y*size + x]) continue;
+
+                Vector3 sum = { 0 };
+                int count = 0;
+
+                for (int j = -1; j <= 1; j++)
+                {
+                    for (int i = -1; i <= 1; i++)
+                    {
+                        int nx = x + i, ny = y + j;
+                        if ((nx < 0) || (ny < 0) || (nx >= size) || (ny >= size) || !covered[ny*size + nx]) continue;
+
+                        sum = Vector3Add(sum, bake.light[ny*size + nx]);
+                        count++;
+                    }
+                }
+
+                if (count > 0)
+                {
+                    bake.light[y*size + x] = Vector3Scale(sum, 1.0f/count);
+                    dilated[y*size + x] = 1;
+                    changed = true;
+                }
+            }
+        }
+
+        memcpy(covered, dilated, size*size);
+        if (!changed) break;
+    }
+
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(size*size*4);
+
+    for (int i = 0; i < size*size; i++)
+    {
+        pixels[i*4] = (unsigned char)(Clamp(bake.light[i].x/(float)LIGHTMAP_RANGE, 0.0f, 1.0f)*255.0f + 0.5f);
+        pixels[i*4 + 1] = (unsigned char)(Clamp(bake.light[i].y/(float)LIGHTMAP_RANGE, 0.0f, 1.0f)*255.0f + 0.5f);
+        pixels[i*4 + 2] = (unsigned char)(Clamp(bake.light[i].z/(float)LIGHTMAP_RANGE, 0.0f, 1.0f)*255.0f + 0.5f);
+        pixels[i*4 + 3] = 255;
+    }
+
+    image.data = pixels;
+    image.width = size;
+    image.height = size;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    for (int m = 0; m < model.meshCount; m++) UnloadMeshBVH(bvhs[m]);
+    RL_FREE(bvhs);
+    RL_FREE(albedos);
+    RL_FREE(bake.light);
+    RL_FREE(texels);
+    RL_FREE(covered);
+    RL_FREE(dilated);
+
+    TRACELOG(LOG_INFO, "MODEL: Lightmap baked (%ix%i, %i lights, %i indirect samples)", size, size, lighting.activeCount, bake.samples);
+#endif
+
+    return image;
+}
+
+#if defined(SUPPORT_LIGHTMAPS)
+// Split mesh faces into lightmap charts, faces are connected through edges of welded vertices (same position)
+// and grown from a seed face while their normal is within LIGHTMAP_CHART_ANGLE of seed normal
+// NOTE: Triangles charts indices are global (charts array shared by all model meshes)
+static void GenMeshLightmapCharts(Mesh mesh, int *triangleCharts, LightmapChart **charts, int *chartCount, int *chartCapacity)
+{
+    const Vector3 *vertices = (const Vector3 *)mesh.vertices;
+    int triangleCount = mesh.triangleCount;
+
+    // Weld vertices by position, split vertices (normals or texcoords seams) still connect faces
+    SimplifyVertex *sorted = (SimplifyVertex *)RL_MALLOC(mesh.vertexCount*sizeof(SimplifyVertex));
+    int *welds = (int *)RL_MALLOC(mesh.vertexCount*sizeof(int));
+
+    for (int i = 0; i < mesh.vertexCount; i++) sorted[i] = (SimplifyVertex){ vertices[i].x, vertices[i].y, vertices[i].z, i };
+    qsort(sorted, mesh.vertexCount, sizeof(SimplifyVertex), CompareSimplifyVertices);
+
+    for (int i = 0, weld = -1; i < mesh.vertexCount; i++)
+    {
+        if ((i == 0) || (sorted[i].x != sorted[i - 1].x) || (sorted[i].y != sorted[i - 1].y) || (sorted[i].z != sorted[i - 1].z)) weld++;
+        welds[sorted[i].index] = weld;
+    }
+
+    // Faces normals and edges sorted by welded vertices, faces sharing an edge are neighbors
+    Vector3 *normals = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    LightmapPair *edges = (LightmapPair *)RL_MALLOC(triangleCount*3*sizeof(LightmapPair));
+    int *neighbors = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int v[3] = { 0 };
+        for (int k = 0; k < 3; k++) v[k] = (mesh.indices != NULL)? mesh.indices[t*3 + k] : t*3 + k;
+
+        normals[t] = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(vertices[v[1]], vertices[v[0]]), Vector3Subtract(vertices[v[2]], vertices[v[0]])));
+
+        for (int k = 0; k < 3; k++)
+        {
+            int a = welds[v[k]];
+            int b = welds[v[(k + 1)%3]];
+
+            edges[t*3 + k] = (LightmapPair){ (a < b)? a : b, (a < b)? b : a, t };
+            neighbors[t*3 + k] = -1;
+        }
+    }
+
+    qsort(edges, triangleCount*3, sizeof(LightmapPair), CompareLightmapPairs);
+
+    // NOTE: Non-manifold edges only link consecutive faces, a face keeps up to 3 neighbors
+    for (int i = 0; i < triangleCount*3 - 1; i++)
+    {
+        if ((edges[i].a != edges[i + 1].a) || (edges[i].b != edges[i + 1].b)) continue;
+
+        int t0 = edges[i].index;
+        int t1 = edges[i + 1].index;
+        if (t0 == t1) continue;
+
+        for (int k = 0; k < 3; k++) if (neighbors[t0*3 + k] == -1) { neighbors[t0*3 + k] = t1; break; }
+        for (int k = 0; k < 3; k++) if (neighbors[t1*3 + k] == -1) { neighbors[t1*3 + k] = t0; break; }
+    }
+
+    // Grow charts from unassigned faces (breadth first), queue keeps current chart faces
+    float minCos = cosf((float)LIGHTMAP_CHART_ANGLE*DEG2RAD);
+    int *queue = (int *)RL_MALLOC(triangleCount*sizeof(int));
+
+    for (int t = 0; t < triangleCount; t++) triangleCharts[t] = -1;
+
+    for (int seed = 0; seed < triangleCount; seed++)
+    {
+        if (triangleCharts[seed] != -1) continue;
+
+        if (*chartCount == *chartCapacity)
+        {
+            *chartCapacity = (*chartCapacity == 0)? 64 : *chartCapacity*2;
+            *charts = (LightmapChart *)RL_REALLOC(*charts, (*chartCapacity)*sizeof(LightmapChart));
+        }
+
+        int chart = (*chartCount)++;
+        Vector3 normal = normals[seed];
+        if (Vector3LengthSqr(normal) < 0.5f) normal = (Vector3){ 0.0f, 1.0f, 0.0f };    // Degenerate face
+
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = seed;
+        triangleCharts[seed] = chart;
+
+        while (head < tail)
+        {
+            int t = queue[head++];
+
+            for (int k = 0; k < 3; k++)
+            {
+                int neighbor = neighbors[t*3 + k];
+
+                if ((neighbor != -1) && (triangleCharts[neighbor] == -1) && (Vector3DotProduct(normals[neighbor], normal) >= minCos))
+                {
+                    triangleCharts[neighbor] = chart;
+                    queue[tail++] = neighbor;
+                }
+            }
+        }
+
+        // Chart plane axes and projected bounds
+        LightmapChart *current = &(*charts)[chart];
+        Vector3 up = (fabsf(normal.y) < 0.99f)? (Vector3){ 0.0f, 1.0f, 0.0f } : (Vector3){ 1.0f, 0.0f, 0.0f };
+        current->axisU = Vector3Normalize(Vector3CrossProduct(up, normal));
+        current->axisV = Vector3CrossProduct(normal, current->axisU);
+
+        Vector2 min = { FLT_MAX, FLT_MAX };
+        Vector2 max = { -FLT_MAX, -FLT_MAX };
+
+        for (int i = 0; i < tail; i++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                Vector3 position = vertices[(mesh.indices != NULL)? mesh.indices[queue[i]*3 + k] : queue[i]*3 + k];
+                Vector2 projected = { Vector3DotProduct(position, current->axisU), Vector3DotProduct(position, current->axisV) };
+
+                min = (Vector2){ fminf(min.x, projected.x), fminf(min.y, projected.y) };
+                max = (Vector2){ fmaxf(max.x, projected.x), fmaxf(max.y, projected.y) };
+            }
+        }
+
+        current->min = min;
+        current->size = Vector2Subtract(max, min);
+        current->x = 0;
+        current->y = 0;
+    }
+
+    RL_FREE(sorted);
+    RL_FREE(welds);
+    RL_FREE(normals);
+    RL_FREE(edges);
+    RL_FREE(neighbors);
+    RL_FREE(queue);
+}
+
+// Pack lightmap charts into atlas shelves (tallest charts first), false if charts do not fit
+// NOTE: Chart atlas rect includes padding texels on every side and one extra texel for partial texels coverage
+static bool PackLightmapCharts(LightmapChart *charts, int count, int size, int padding, float scale)
+{
+    LightmapPair *order = (LightmapPair *)RL_MALLOC(count*sizeof(LightmapPair));
+
+    for (int i = 0; i < count; i++)
+    {
+        int width = (int)ceilf(charts[i].size.x*scale) + 1 + 2*padding;
+        int height = (int)ceilf(charts[i].size.y*scale) + 1 + 2*padding;
+
+        order[i] = (LightmapPair){ -height, -width, i };
+    }
+
+    qsort(order, count, sizeof(LightmapPair), CompareLightmapPairs);
+
+    bool packed = true;
+    int x = 0, y = 0, shelfHeight = 0;
+
+    for (int i = 0; (i < count) && packed; i++)
+    {
+        int width = -order[i].b;
+        int height = -order[i].a;
+
+        if (x + width > size)
+        {
+            y += shelfHeight;
+            x = 0;
+            shelfHeight = 0;
+        }
+
+        if ((width > size) || (y + height > size)) packed = false;
+        else
+        {
+            charts[order[i].index].x = x;
+            charts[order[i].index].y = y;
+
+            x += width;
+            if (height > shelfHeight) shelfHeight = height;
+        }
+    }
+
+    RL_FREE(order);
+
+    return packed;
+}
+
+// Split mesh vertices on charts seams and set lightmap texture coordinates (texcoords2)
+// NOTE: Vertex used by several charts keeps first chart, copies are appended for other charts,
+// mesh is kept unchanged if copies do not fit 16 bit indices
+static bool SetMeshLightmapUVs(Mesh *mesh, const int *triangleCharts, const LightmapChart *charts, int size, int padding, float scale)
+{
+    int cornerCount = mesh->triangleCount*3;
+    LightmapPair *corners = (LightmapPair *)RL_MALLOC(cornerCount*sizeof(LightmapPair));
+    int *cornerVertices = (int *)RL_MALLOC(cornerCount*sizeof(int));
+    int *sources = (int *)RL_MALLOC(cornerCount*sizeof(int));
+
+    for (int c = 0; c < cornerCount; c++) corners[c] = (LightmapPair){ (mesh->indices != NULL)? mesh->indices[c] : c, triangleCharts[c/3], c };
+    qsort(corners, cornerCount, sizeof(LightmapPair), CompareLightmapPairs);
+
+    int copyCount = 0;
+
+    for (int i = 0, vertex = -1; i < cornerCount; i++)
+    {
+        if ((i == 0) || (corners[i].a != corners[i - 1].a)) vertex = corners[i].a;
+        else if (corners[i].b != corners[i - 1].b)
+        {
+            sources[copyCount] = corners[i].a;
+            vertex = mesh->vertexCount + copyCount;
+            copyCount++;
+        }
+
+        cornerVertices[corners[i].index] = vertex;
+    }
+
+    bool success = (mesh->vertexCount + copyCount <= 65536);
+
+    if (!success) TRACELOG(LOG_WARNING, "MESH: Lightmap UVs not generated, %i vertices do not fit 16 bit indices", mesh->vertexCount + copyCount);
+    else
+    {
+        if (copyCount > 0)
+        {
+            MeshAttributeStream streams[MAX_MESH_ATTRIBUTE_STREAMS] = { 0 };
+            int streamCount = GetMeshAttributeStreams(mesh, streams);
+
+            for (int s = 0; s < streamCount; s++)
+            {
+                int stride = streams[s].size;
+                unsigned char *data = (unsigned char *)RL_REALLOC(*streams[s].data, (mesh->vertexCount + copyCount)*stride);
+
+                for (int i = 0; i < copyCount; i++) memcpy(data + (mesh->vertexCount + i)*stride, data + sources[i]*stride, stride);
+
+                *streams[s].data = data;
+            }
+
+            mesh->vertexCount += copyCount;
+            for (int c = 0; c < cornerCount; c++) mesh->indices[c] = (unsigned short)cornerVertices[c];
+        }
+
+        if (mesh->texcoords2 == NULL) mesh->texcoords2 = (float *)RL_CALLOC(mesh->vertexCount*2, sizeof(float));
+
+        // Vertices are projected on their chart plane and placed inside chart atlas rect
+        for (int c = 0; c < cornerCount; c++)
+        {
+            const LightmapChart *chart = &charts[triangleCharts[c/3]];
+            Vector3 position = ((Vector3 *)mesh->vertices)[cornerVertices[c]];
+
+            mesh->texcoords2[cornerVertices[c]*2] = (chart->x + padding + 0.5f + (Vector3DotProduct(position, chart->axisU) - chart->min.x)*scale)/size;
+            mesh->texcoords2[cornerVertices[c]*2 + 1] = (chart->y + padding + 0.5f + (Vector3DotProduct(position, chart->axisV) - chart->min.y)*scale)/size;
+        }
+    }
+
+    RL_FREE(corners);
+    RL_FREE(cornerVertices);
+    RL_FREE(sources);
+
+    return success;
+}
+
+// Compare lightmap sorting pairs keys
+static int CompareLightmapPairs(const void *a, const void *b)
+{
+    const LightmapPair *pa = (const LightmapPair *)a;
+    const LightmapPair *pb = (const LightmapPair *)b;
+
+    if (pa->a != pb->a) return (pa->a < pb->a)? -1 : 1;
+    if (pa->b != pb->b) return (pa->b < pb->b)? -1 : 1;
+
+    return pa->index - pb->index;
+}
+
+// Check if any model mesh occludes a ray up to distance (shadow ray)
+static bool IsLightmapOccluded(const LightmapBake *bake, Vector3 position, Vector3 direction, float distance)
+{
+    Ray ray = { position, direction };
+
+    for (int m = 0; m < bake->meshCount; m++)
+    {
+        if (RayCastMeshBVH(ray, bake->bvhs[m], bake->transform, bake->invTransform, distance, true).hit) return true;
+    }
+
+    return false;
+}
+
+// Get direct light at surface point, lights occluded by model meshes
+// NOTE: Lights contribution matches clustered lighting shader (GetLighting()), ambient light is optional
+static Vector3 GetLightmapDirectLight(const LightmapBake *bake, Vector3 position, Vector3 normal, bool ambient)
+{
+    Vector3 light = ambient? lighting.ambient : (Vector3){ 0 };
+
+    if (Vector3LengthSqr(lighting.directionalColor) > 0.0f)
+    {
+        Vector3 direction = Vector3Negate(lighting.direction);
+        float diffuse = Vector3DotProduct(normal, direction);
+
+        if ((diffuse > 0.0f) && !IsLightmapOccluded(bake, position, direction, FLT_MAX)) light = Vector3Add(light, Vector3Scale(lighting.directionalColor, diffuse));
+    }
+
+    for (int i = 0; i < lighting.lightCount; i++)
+    {
+        Vector4 data = lighting.lights[i];
+        if (data.w <= 0.0f) continue;
+
+        Vector3 delta = { data.x - position.x, data.y - position.y, data.z - position.z };
+        float distance = Vector3Length(delta);
+        if ((distance >= data.w) || (distance < 0.0001f)) continue;
+
+        Vector3 direction = Vector3Scale(delta, 1.0f/distance);
+        float attenuation = 1.0f - distance/data.w;
+        float diffuse = attenuation*attenuation*Vector3DotProduct(normal, direction);
+
+        if ((diffuse > 0.0f) && !IsLightmapOccluded(bake, position, direction, distance)) light = Vector3Add(light, Vector3Scale(lighting.colors[i], diffuse));
+    }
+
+    return light;
+}
+
+// Bake lightmap texels rows range, indirect light is gathered with cosine weighted hemisphere rays
+// NOTE: Rays directions are Hammersley points rotated per texel (no shared random state between jobs)
+static void BakeLightmapRows(void *data, int start, int end)
+{
+    LightmapBake *bake = (LightmapBake *)data;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < bake->size; x++)
+        {
+            int index = y*bake->size + x;
+            const LightmapTexel *texel = &bake->texels[index];
+            if (!texel->covered) continue;
+
+            Vector3 normal = texel->normal;
+            Vector3 origin = Vector3Add(texel->position, Vector3Scale(normal, bake->bias));
+            Vector3 light = GetLightmapDirectLight(bake, origin, normal, (bake->samples == 0));
+
+            if (bake->samples > 0)
+            {
+                Vector3 up = (fabsf(normal.y) < 0.99f)? (Vector3){ 0.0f, 1.0f, 0.0f } : (Vector3){ 1.0f, 0.0f, 0.0f };
+                Vector3 tangent = Vector3Normalize(Vector3CrossProduct(up, normal));
+                Vector3 bitangent = Vector3CrossProduct(normal, tangent);
+
+                unsigned int hash = (unsigned int)index*2654435761u;
+                float offsetU = (float)(hash & 0xffff)/65536.0f;
+                float offsetV = (float)(hash >> 16)/65536.0f;
+                Vector3 indirect = { 0 };
+
+                for (int s = 0; s < bake->samples; s++)
+                {
+                    // Radical inverse base 2 (bits reversed)
+                    unsigned int bits = (unsigned int)s;
+                    bits = (bits << 16) | (bits >> 16);
+                    bits = ((bits & 0x55555555u) << 1) | ((bits & 0xaaaaaaaau) >> 1);
+                    bits = ((bits & 0x33333333u) << 2) | ((bits & 0xccccccccu) >> 2);
+                    bits = ((bits & 0x0f0f0f0fu) << 4) | ((bits & 0xf0f0f0f0u) >> 4);
+                    bits = ((bits & 0x00ff00ffu) << 8) | ((bits & 0xff00ff00u) >> 8);
+
+                    float u = fmodf((s + 0.5f)/bake->samples + offsetU, 1.0f);
+                    float v = fmodf((float)bits*2.3283064365386963e-10f + offsetV, 1.0f);
+                    float radius = sqrtf(u);
+                    float angle = 2.0f*PI*v;
+
+                    Vector3 direction = Vector3Add(Vector3Add(Vector3Scale(tangent, radius*cosf(angle)), Vector3Scale(bitangent, radius*sinf(angle))), Vector3Scale(normal, sqrtf(1.0f - u)));
+                    Ray ray = { origin, direction };
+
+                    RayCollision closest = { 0 };
+                    int hitMesh = -1;
+
+                    for (int m = 0; m < bake->meshCount; m++)
+                    {
+                        RayCollision hit = RayCastMeshBVH(ray, bake->bvhs[m], bake->transform, bake->invTransform, (hitMesh == -1)? FLT_MAX : closest.distance, false);
+                        if (hit.hit && ((hitMesh == -1) || (hit.distance < closest.distance))) { closest = hit; hitMesh = m; }
+                    }
+
+                    // Rays escaping the model get ambient light, front faces hit reflect their direct light
+                    if (hitMesh == -1) indirect = Vector3Add(indirect, lighting.ambient);
+                    else if (Vector3DotProduct(closest.normal, direction) < 0.0f)
+                    {
+                        Vector3 hitLight = GetLightmapDirectLight(bake, Vector3Add(closest.point, Vector3Scale(closest.normal, bake->bias)), closest.normal, true);
+                        indirect = Vector3Add(indirect, Vector3Multiply(hitLight, bake->albedos[hitMesh]));
+                    }
+                }
+
+                light = Vector3Add(light, Vector3Scale(indirect, 1.0f/bake->samples));
+            }
+
+            bake->light[index] = light;
+        }
+    }
+}
+#endif
+
+#if defined(LIGHTMAP_SHADERS_SUPPORTED)
+#define LIGHTMAP_STRINGIFY_(x)  #x
+#define LIGHTMAP_STRINGIFY(x)   LIGHTMAP_STRINGIFY_(x)
+
+// Load built-in lightmap shader, diffuse color is multiplied by lightmap light (sampled with texcoords2)
+// NOTE: Mirrors rlgl default shader, lightmap texels are scaled back by LIGHTMAP_RANGE
+static void LoadShaderLightmap(void)
+{
+    const char *lightmapVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec2 vertexTexCoord2;           \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec2 fragTexCoord2;            \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec2 vertexTexCoord2;    \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragTexCoord2 = vertexTexCoord2; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *lightmapFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D lightmap;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "    vec3 light = texture2D(lightmap, fragTexCoord2).rgb*float(" LIGHTMAP_STRINGIFY(LIGHTMAP_RANGE) "); \n"
+    "    gl_FragColor = vec4(texelColor.rgb*light, texelColor.a); \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec2 fragTexCoord2;             \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D lightmap;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "    vec3 light = texture(lightmap, fragTexCoord2).rgb*float(" LIGHTMAP_STRINGIFY(LIGHTMAP_RANGE) "); \n"
+    "    finalColor = vec4(texelColor.rgb*light, texelColor.a); \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec2 fragTexCoord2;        \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D lightmap;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "    vec3 light = texture2D(lightmap, fragTexCoord2).rgb*float(" LIGHTMAP_STRINGIFY(LIGHTMAP_RANGE) "); \n"
+    "    gl_FragColor = vec4(texelColor.rgb*light, texelColor.a); \n"
+    "}                                  \n";
+#endif
+
+    lightmapShaderLoaded = true;
+    lightmapShader = LoadShaderFromMemory(lightmapVShaderCode, lightmapFShaderCode);
+
+    if ((lightmapShader.id > 0) && (lightmapShader.id != rlGetShaderIdDefault()) && (lightmapShader.locs[SHADER_LOC_MAP_LIGHTMAP] != -1))
+    {
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Lightmap shader loaded successfully", lightmapShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load lightmap shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (lightmapShader.id != rlGetShaderIdDefault()) UnloadShader(lightmapShader);
+        else RL_FREE(lightmapShader.locs);
+
+        lightmapShader = (Shader){ 0 };
+    }
+}
+#endif
+
+// Load static batch: meshes are transformed to world space and merged into one mesh per material
+// NOTE: Merged meshes are split on 16 bit indices limit, materials are compared by shader and maps (textures, colors, values),
+// batch materials are copies sharing shaders and textures with source materials, source meshes are not modified
+StaticBatch LoadStaticBatch(const Mesh *meshes, const Material *materials, const Matrix *transforms, int count)
+{
+    StaticBatch batch = { 0 };
+
+    batch.model.transform = MatrixIdentity();
+    batch.model.materials = (Material *)RL_CALLOC((count > 0)? count : 1, sizeof(Material));
+    batch.objects = (StaticBatchObject *)RL_CALLOC((count > 0)? count : 1, sizeof(StaticBatchObject));
+
+    // Group objects by material, objects are merged in materials order
+    int *objectMaterials = (int *)RL_MALLOC(((count > 0)? count : 1)*sizeof(int));
+
+    for (int i = 0; i < count; i++)
+    {
+        int material = 0;
+        while ((material < batch.model.materialCount) && !IsStaticBatchMaterialEqual(batch.model.materials[material], materials[i])) material++;
+
+        if (material == batch.model.materialCount)
+        {
+            batch.model.materials[material] = materials[i];
+            batch.model.materials[material].maps = (MaterialMap *)RL_MALLOC(MAX_MATERIAL_MAPS*sizeof(MaterialMap));
+            memcpy(batch.model.materials[material].maps, materials[i].maps, MAX_MATERIAL_MAPS*sizeof(MaterialMap));
+            batch.model.materialCount++;
+        }
+
+        objectMaterials[i] = material;
+    }
+
+    for (int material = 0; material < batch.model.materialCount; material++)
+    {
+        int first = 0;      // First object of current merged mesh
+
+        while (first < count)
+        {
+            // Gather objects fitting in merged mesh 16 bit indices
+            int vertexCount = 0;
+            int triangleCount = 0;
+            int last = first;
+
+            for (; last < count; last++)
+            {
+                if (objectMaterials[last] != material) continue;
+
+                if (meshes[last].vertexCount > 65536)
+                {
+                    TRACELOG(LOG_WARNING, "MESH: Static batch mesh exceeds 16 bit indices limit, mesh skipped");
+                    objectMaterials[last] = -1;
+                    continue;
+                }
+
+                if ((vertexCount + meshes[last].vertexCount) > 65536) break;
+
+                vertexCount += meshes[last].vertexCount;
+                triangleCount += (meshes[last].indices != NULL)? meshes[last].triangleCount : meshes[last].vertexCount/3;
+            }
+
+            if (vertexCount > 0)
+            {
+                batch.model.meshes = (Mesh *)RL_REALLOC(batch.model.meshes, (batch.model.meshCount + 1)*sizeof(Mesh));
+                batch.model.meshMaterial = (int *)RL_REALLOC(batch.model.meshMaterial, (batch.model.meshCount + 1)*sizeof(int));
+                batch.model.meshes[batch.model.meshCount] = GenStaticBatchMesh(&batch, meshes, transforms, objectMaterials, material, first, last, vertexCount, triangleCount);
+                batch.model.meshMaterial[batch.model.meshCount] = material;
+                batch.model.meshCount++;
+            }
+
+            first = last;
+        }
+    }
+
+    RL_FREE(objectMaterials);
+
+    // Upload merged meshes, indices are updated on culled draws
+    int maxTriangles = 0;
+    for (int i = 0; i < batch.model.meshCount; i++)
+    {
+        UploadMesh(&batch.model.meshes[i], false);
+        if (batch.model.meshes[i].triangleCount > maxTriangles) maxTriangles = batch.model.meshes[i].triangleCount;
+    }
+
+    batch.visibleIndices = (unsigned short *)RL_MALLOC(((maxTriangles > 0)? maxTriangles : 1)*3*sizeof(unsigned short));
+    batch.visibleTriangles = (int *)RL_MALLOC(((batch.model.meshCount > 0)? batch.model.meshCount : 1)*sizeof(int));
+    for (int i = 0; i < batch.model.meshCount; i++) batch.visibleTriangles[i] = batch.model.meshes[i].triangleCount;
+
+    TRACELOG(LOG_INFO, "MODEL: Static batch loaded successfully (%i objects, %i meshes, %i materials)", batch.objectCount, batch.model.meshCount, batch.model.materialCount);
+
+    return batch;
+}
+
+// Unload static batch merged meshes and objects data
+// NOTE: Materials shaders and textures are shared with source materials, they are not unloaded
+void UnloadStaticBatch(StaticBatch batch)
+{
+    UnloadModel(batch.model);
+
+    RL_FREE(batch.objects);
+    RL_FREE(batch.visibleIndices);
+    RL_FREE(batch.visibleTriangles);
+}
+
+// Draw static batch, one draw per merged mesh
+void DrawStaticBatch(StaticBatch batch)
+{
+    for (int i = 0; i < batch.model.meshCount; i++)
+    {
+        Mesh mesh = batch.model.meshes[i];
+
+        // Restore all objects indices if previous draw was culled
+        if (batch.visibleTriangles[i] != mesh.triangleCount)
+        {
+            rlUpdateVertexBufferElements(mesh.vboId[6], mesh.indices, mesh.triangleCount*3*sizeof(unsigned short), 0);
+            batch.visibleTriangles[i] = mesh.triangleCount;
+        }
+
+        DrawMesh(mesh, batch.model.materials[batch.model.meshMaterial[i]], MatrixIdentity());
+    }
+}
+
+// Draw static batch, objects outside frustum are skipped
+// NOTE: Visible objects indices are packed into merged meshes indices buffers, still one draw per merged mesh,
+// indices are updated immediately, one culled draw per batch is expected between render queue flushes
+void DrawStaticBatchCulled(StaticBatch batch, Frustum frustum)
+{
+    int object = 0;
+
+    for (int i = 0; i < batch.model.meshCount; i++)
+    {
+        Mesh mesh = batch.model.meshes[i];
+        int visibleCount = 0;
+
+        // NOTE: Objects are stored in merged meshes order, ranges are contiguous
+        for (; (object < batch.objectCount) && (batch.objects[object].mesh == i); object++)
+        {
+            StaticBatchObject range = batch.objects[object];
+
+            if (CheckFrustumBox(frustum, range.bounds))
+            {
+                memcpy(&batch.visibleIndices[visibleCount*3], &mesh.indices[range.firstTriangle*3], range.triangleCount*3*sizeof(unsigned short));
+                visibleCount += range.triangleCount;
+            }
+        }
+
+        if (visibleCount == 0) continue;
+
+        if ((visibleCount != mesh.triangleCount) || (batch.visibleTriangles[i] != mesh.triangleCount))
+        {
+            rlUpdateVertexBufferElements(mesh.vboId[6], batch.visibleIndices, visibleCount*3*sizeof(unsigned short), 0);
+            batch.visibleTriangles[i] = visibleCount;
+        }
+
+        mesh.triangleCount = visibleCount;
+        mesh.indices = batch.visibleIndices;    // NOTE: Used by OpenGL 1.1 client arrays draw
+
+        DrawMesh(mesh, batch.model.materials[batch.model.meshMaterial[i]], MatrixIdentity());
+    }
+}
+
+// Generate static batch merged mesh from material objects range [first, last) (CPU only, no upload)
+// NOTE: Missing attributes are filled with defaults if any other merged mesh provides them
+static Mesh GenStaticBatchMesh(StaticBatch *batch, const Mesh *meshes, const Matrix *transforms, const int *objectMaterials, int material, int first, int last, int vertexCount, int triangleCount)
+{
+    Mesh merged = { 0 };
+
+    bool texcoords = false, texcoords2 = false, normals = false, tangents = false, colors = false;
+
+    for (int i = first; i < last; i++)
+    {
+        if (objectMaterials[i] != material) continue;
+
+        texcoords |= (meshes[i].texcoords != NULL);
+        texcoords2 |= (meshes[i].texcoords2 != NULL);
+        normals |= (meshes[i].normals != NULL);
+        tangents |= (meshes[i].tangents != NULL);
+        colors |= (meshes[i].colors != NULL);
+    }
+
+    merged.vertexCount = vertexCount;
+    merged.triangleCount = triangleCount;
+    merged.vertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+    merged.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+    if (texcoords) merged.texcoords = (float *)RL_CALLOC(vertexCount*2, sizeof(float));
+    if (texcoords2) merged.texcoords2 = (float *)RL_CALLOC(vertexCount*2, sizeof(float));
+    if (normals) merged.normals = (float *)RL_CALLOC(vertexCount*3, sizeof(float));
+    if (tangents) merged.tangents = (float *)RL_CALLOC(vertexCount*4, sizeof(float));
+    if (colors) merged.colors = (unsigned char *)RL_MALLOC(vertexCount*4*sizeof(unsigned char));
+    if (colors) memset(merged.colors, 255, vertexCount*4*sizeof(unsigned char));
+
+    int vertexOffset = 0;
+    int triangleOffset = 0;
+
+    for (int i = first; i < last; i++)
+    {
+        if (objectMaterials[i] != material) continue;
+
+        Mesh mesh = meshes[i];
+        Matrix transform = transforms[i];
+        Matrix normalMatrix = MatrixTranspose(MatrixInvert(transform));
+
+        StaticBatchObject *object = &batch->objects[batch->objectCount];
+        object->mesh = batch->model.meshCount;
+        object->firstTriangle = triangleOffset;
+        object->bounds.min = (Vector3){ FLT_MAX, FLT_MAX, FLT_MAX };
+        object->bounds.max = (Vector3){ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        // Positions and normals are transformed in batches
+        Vector3TransformArray((const Vector3 *)mesh.vertices, (Vector3 *)&merged.vertices[vertexOffset*3], mesh.vertexCount, transform);
+
+        if (mesh.normals != NULL)
+        {
+            Vector3TransformArray((const Vector3 *)mesh.normals, (Vector3 *)&merged.normals[vertexOffset*3], mesh.vertexCount, normalMatrix);
+            Vector3NormalizeArray((const Vector3 *)&merged.normals[vertexOffset*3], (Vector3 *)&merged.normals[vertexOffset*3], mesh.vertexCount);
+        }
+
+        for (int v = 0; v < mesh.vertexCount; v++)
+        {
+            int dst = vertexOffset + v;
+
+            Vector3 position = { merged.vertices[dst*3], merged.vertices[dst*3 + 1], merged.vertices[dst*3 + 2] };
+            object->bounds.min = Vector3Min(object->bounds.min, position);
+            object->bounds.max = Vector3Max(object->bounds.max, position);
+
+            if (mesh.texcoords != NULL) memcpy(&merged.texcoords[dst*2], &mesh.texcoords[v*2], 2*sizeof(float));
+            if (mesh.texcoords2 != NULL) memcpy(&merged.texcoords2[dst*2], &mesh.texcoords2[v*2], 2*sizeof(float));
+            if (mesh.colors != NULL) memcpy(&merged.colors[dst*4], &mesh.colors[v*4], 4*sizeof(unsigned char));
+
+            if (mesh.tangents != NULL)
+            {
+                // NOTE: Tangents are directions, translation is not applied
+                Vector3 tangent = { mesh.tangents[v*4], mesh.tangents[v*4 + 1], mesh.tangents[v*4 + 2] };
+                tangent = Vector3Normalize(Vector3Subtract(Vector3Transform(tangent, transform), Vector3Transform(Vector3Zero(), transform)));
+                merged.tangents[dst*4 + 0] = tangent.x;
+                merged.tangents[dst*4 + 1] = tangent.y;
+                merged.tangents[dst*4 + 2] = tangent.z;
+                merged.tangents[dst*4 + 3] = mesh.tangents[v*4 + 3];
+            }
+        }
+
+        int meshTriangles = (mesh.indices != NULL)? mesh.triangleCount : mesh.vertexCount/3;
+
+        for (int t = 0; t < meshTriangles*3; t++)
+        {
+            int index = (mesh.indices != NULL)? mesh.indices[t] : t;
+            merged.indices[triangleOffset*3 + t] = (unsigned short)(vertexOffset + index);
+        }
+
+        object->triangleCount = meshTriangles;
+        batch->objectCount++;
+
+        vertexOffset += mesh.vertexCount;
+        triangleOffset += meshTriangles;
+    }
+
+    return merged;
+}
+
+// Check if static batch materials are equal (same shader and maps)
+static bool IsStaticBatchMaterialEqual(Material a, Material b)
+{
+    if (a.shader.id != b.shader.id) return false;
+    if (memcmp(a.params, b.params, sizeof(a.params)) != 0) return false;
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        MaterialMap mapA = a.maps[i];
+        MaterialMap mapB = b.maps[i];
+
+        if ((mapA.texture.id != mapB.texture.id) || (mapA.value != mapB.value)) return false;
+        if ((mapA.color.r != mapB.color.r) || (mapA.color.g != mapB.color.g) || (mapA.color.b != mapB.color.b) || (mapA.color.a != mapB.color.a)) return false;
+    }
+
+    return true;
+}
+
+// Load scene transforms hierarchy, nodes arrays are allocated for capacity and grown as required
+Scene LoadScene(int capacity)
+{
+    Scene scene = { 0 };
+
+    scene.capacity = (capacity > 0)? capacity : 16;
+    scene.parents = (int *)RL_MALLOC(scene.capacity*sizeof(int));
+    scene.translations = (Vector3 *)RL_MALLOC(scene.capacity*sizeof(Vector3));
+    scene.rotations = (Quaternion *)RL_MALLOC(scene.capacity*sizeof(Quaternion));
+    scene.scales = (Vector3 *)RL_MALLOC(scene.capacity*sizeof(Vector3));
+    scene.worldMatrices = (Matrix *)RL_MALLOC(scene.capacity*sizeof(Matrix));
+    scene.dirty = (bool *)RL_MALLOC(scene.capacity*sizeof(bool));
+
+    return scene;
+}
+
+// Unload scene nodes arrays
+void UnloadScene(Scene scene)
+{
+    RL_FREE(scene.parents);
+    RL_FREE(scene.translations);
+    RL_FREE(scene.rotations);
+    RL_FREE(scene.scales);
+    RL_FREE(scene.worldMatrices);
+    RL_FREE(scene.dirty);
+}
+
+// Add scene node with local transform relative to parent (-1 for root nodes), returns node index
+// NOTE: Nodes are appended after their parent, arrays stay sorted parents first and are updated in one pass
+int AddSceneNode(Scene *scene, int parent, Transform transform)
+{
+    if ((parent < -1) || (parent >= scene->nodeCount))
+    {
+        TRACELOG(LOG_WARNING, "SCENE: Parent node [%i] not valid, node not added", parent);
+        return -1;
+    }
+
+    if (scene->nodeCount >= scene->capacity)
+    {
+        scene->capacity = (scene->capacity > 0)? scene->capacity*2 : 16;
+        scene->parents = (int *)RL_REALLOC(scene->parents, scene->capacity*sizeof(int));
+        scene->translations = (Vector3 *)RL_REALLOC(scene->translations, scene->capacity*sizeof(Vector3));
+        scene->rotations = (Quaternion *)RL_REALLOC(scene->rotations, scene->capacity*sizeof(Quaternion));
+        scene->scales = (Vector3 *)RL_REALLOC(scene->scales, scene->capacity*sizeof(Vector3));
+        scene->worldMatrices = (Matrix *)RL_REALLOC(scene->worldMatrices, scene->capacity*sizeof(Matrix));
+        scene->dirty = (bool *)RL_REALLOC(scene->dirty, scene->capacity*sizeof(bool));
+    }
+
+    int node = scene->nodeCount;
+
+    scene->parents[node] = parent;
+    scene->translations[node] = transform.translation;
+    scene->rotations[node] = transform.rotation;
+    scene->scales[node] = transform.scale;
+    scene->worldMatrices[node] = MatrixIdentity();
+    scene->dirty[node] = true;
+    scene->nodeCount++;
+
+    return node;
+}
+
+// Set scene node local transform, node subtree world matrices are recomputed on next UpdateScene()
+void SetSceneNodeTransform(Scene *scene, int node, Transform transform)
+{
+    if ((node < 0) || (node >= scene->nodeCount)) return;
+
+    scene->translations[node] = transform.translation;
+    scene->rotations[node] = transform.rotation;
+    scene->scales[node] = transform.scale;
+    scene->dirty[node] = true;
+}
+
+// Get scene node local transform
+Transform GetSceneNodeTransform(Scene scene, int node)
+{
+    Transform transform = { 0 };
+
+    if ((node >= 0) && (node < scene.nodeCount))
+    {
+        transform.translation = scene.translations[node];
+        transform.rotation = scene.rotations[node];
+        transform.scale = scene.scales[node];
+    }
+
+    return transform;
+}
+
+// Get scene node world matrix, as computed by last UpdateScene()
+Matrix GetSceneNodeMatrix(Scene scene, int node)
+{
+    if ((node < 0) || (node >= scene.nodeCount)) return MatrixIdentity();
+
+    return scene.worldMatrices[node];
+}
+
+// Update scene world matrices of changed nodes and their subtrees
+// NOTE: Parents are stored before children, dirty flags are propagated in the same pass matrices are computed
+void UpdateScene(Scene *scene)
+{
+    for (int i = 0; i < scene->nodeCount; i++)
+    {
+        int parent = scene->parents[i];
+
+        if ((parent >= 0) && scene->dirty[parent]) scene->dirty[i] = true;
+        if (!scene->dirty[i]) continue;
+
+        // Local transform matrix (scale -> rotation -> translation)
+        Vector3 t = scene->translations[i];
+        Quaternion q = scene->rotations[i];
+        Vector3 s = scene->scales[i];
+
+        float x2 = q.x*q.x, y2 = q.y*q.y, z2 = q.z*q.z;
+        float xy = q.x*q.y, xz = q.x*q.z, yz = q.y*q.z;
+        float wx = q.w*q.x, wy = q.w*q.y, wz = q.w*q.z;
+
+        Matrix local = {
+            (1.0f - 2.0f*(y2 + z2))*s.x, (2.0f*(xy - wz))*s.y, (2.0f*(xz + wy))*s.z, t.x,
+            (2.0f*(xy + wz))*s.x, (1.0f - 2.0f*(x2 + z2))*s.y, (2.0f*(yz - wx))*s.z, t.y,
+            (2.0f*(xz - wy))*s.x, (2.0f*(yz + wx))*s.y, (1.0f - 2.0f*(x2 + y2))*s.z, t.z,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+
+        if (parent < 0) scene->worldMatrices[i] = local;
+        else MultiplySceneMatrix(&local, &scene->worldMatrices[parent], &scene->worldMatrices[i]);
+    }
+
+    // Flags are cleared once all subtrees have been reached
+    memset(scene->dirty, 0, scene->nodeCount*sizeof(bool));
+}
+
+// Draw a model with scene node world transform (combined with model.transform)
+void DrawSceneModel(Scene scene, int node, Model model, Color tint)
+{
+    model.transform = MatrixMultiply(model.transform, GetSceneNodeMatrix(scene, node));
+
+    DrawModelEx(model, (Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, 0.0f, (Vector3){ 1.0f, 1.0f, 1.0f }, tint);
+}
+
+// Draw a model with scene node world transform, meshes outside frustum are skipped
+void DrawSceneModelCulled(Scene scene, int node, Model model, Frustum frustum, Color tint)
+{
+    model.transform = MatrixMultiply(model.transform, GetSceneNodeMatrix(scene, node));
+
+    DrawModelExCulled(model, frustum, (Vector3){ 0.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, 0.0f, (Vector3){ 1.0f, 1.0f, 1.0f }, tint);
+}
+
+// Load model nodes hierarchy into scene, a root node is added to parent (-1 for scene root) for all model nodes
+// NOTE: glTF nodes hierarchy and transforms are loaded, meshes referenced by several nodes are loaded once;
+// other formats are loaded as one mesh node placed at root node
+SceneModel LoadSceneModel(const char *fileName, Scene *scene, int parent)
+{
+    SceneModel sceneModel = { 0 };
+
+    sceneModel.rootNode = AddSceneNode(scene, parent, (Transform){ { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } });
+    if (sceneModel.rootNode < 0) return sceneModel;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb"))
+    {
+        BeginLoadingBoost();
+
+        sceneModel.model = LoadGLTF(fileName, NULL, scene, &sceneModel);
+
+    #if defined(SUPPORT_MESH_OPTIMIZATION)
+        for (int i = 0; i < sceneModel.model.meshCount; i++) OptimizeMesh(&sceneModel.model.meshes[i], MESH_OPTIMIZE_ALL);
+    #endif
+
+        UploadModel(&sceneModel.model, fileName);
+
+        EndLoadingBoost();
+    }
+    else
+#endif
+    {
+        sceneModel.model = LoadModel(fileName);
+    }
+
+    // Model without mesh nodes, all meshes placed at root node
+    if (sceneModel.nodeCount == 0)
+    {
+        RL_FREE(sceneModel.nodes);
+        sceneModel.nodes = (SceneModelNode *)RL_CALLOC(1, sizeof(SceneModelNode));
+        sceneModel.nodes[0].node = sceneModel.rootNode;
+        sceneModel.nodes[0].meshCount = sceneModel.model.meshCount;
+        sceneModel.nodeCount = 1;
+    }
+
+    return sceneModel;
+}
+
+// Unload scene model meshes, materials and nodes instances
+// NOTE: Scene nodes are not removed from scene
+void UnloadSceneModel(SceneModel sceneModel)
+{
+    for (int i = 0; i < sceneModel.nodeCount; i++)
+    {
+        if (sceneModel.nodes[i].instanceCount > 0) UnloadInstanceBuffer(sceneModel.nodes[i].instances);
+        RL_FREE(sceneModel.nodes[i].instanceTransforms);
+    }
+
+    RL_FREE(sceneModel.nodes);
+    UnloadModel(sceneModel.model);
+}
+
+// Draw scene model meshes with nodes world transforms (combined with model.transform)
+// NOTE: Instanced nodes meshes are drawn with one instanced draw, instances world transforms
+// are only updated and uploaded when node world matrix changes
+void DrawSceneModelNodes(Scene scene, SceneModel sceneModel, Color tint)
+{
+    Model model = sceneModel.model;
+
+    for (int n = 0; n < sceneModel.nodeCount; n++)
+    {
+        SceneModelNode *node = &sceneModel.nodes[n];
+        Matrix transform = MatrixMultiply(model.transform, GetSceneNodeMatrix(scene, node->node));
+
+        if ((node->instanceCount > 0) && ((node->instances.instanceCount == 0) || (memcmp(&transform, &node->instancesMatrix, sizeof(Matrix)) != 0)))
+        {
+            Matrix *transforms = (Matrix *)RL_MALLOC(node->instanceCount*sizeof(Matrix));
+
+            for (int i = 0; i < node->instanceCount; i++) transforms[i] = MatrixMultiply(node->instanceTransforms[i], transform);
+
+            UpdateInstanceBuffer(&node->instances, transforms, NULL, NULL, 0, node->instanceCount);
+            node->instancesMatrix = transform;
+
+            RL_FREE(transforms);
+        }
+
+        for (int i = node->firstMesh; (i < node->firstMesh + node->meshCount) && (i < model.meshCount); i++)
+        {
+            Material material = model.materials[model.meshMaterial[i]];
+            Color color = material.maps[MATERIAL_MAP_DIFFUSE].color;
+
+            material.maps[MATERIAL_MAP_DIFFUSE].color.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+            material.maps[MATERIAL_MAP_DIFFUSE].color.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+            material.maps[MATERIAL_MAP_DIFFUSE].color.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+            material.maps[MATERIAL_MAP_DIFFUSE].color.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+            if (node->instanceCount > 0)
+            {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+                DrawMeshInstancedBuffer(model.meshes[i], material, node->instances, 0, node->instanceCount);
+#else
+                for (int k = 0; k < node->instanceCount; k++) DrawMesh(model.meshes[i], material, node->instances.transforms[k]);
+#endif
+            }
+            else DrawMesh(model.meshes[i], material, transform);
+
+            material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+        }
+    }
+}
+
+// Multiply scene node local matrix by parent world matrix, same result as MatrixMultiply(local, parent)
+// NOTE: Matrix rows are stored contiguously (m0, m4, m8, m12), every result row is a combination of local rows
+static void MultiplySceneMatrix(const Matrix *local, const Matrix *parent, Matrix *result)
+{
+    const float *l = (const float *)local;
+    const float *p = (const float *)parent;
+    float *r = (float *)result;
+
+#if defined(SKINNING_SIMD_SSE)
+    __m128 row0 = _mm_loadu_ps(&l[0]);
+    __m128 row1 = _mm_loadu_ps(&l[4]);
+    __m128 row2 = _mm_loadu_ps(&l[8]);
+    __m128 row3 = _mm_loadu_ps(&l[12]);
+
+    for (int i = 0; i < 4; i++)
+    {
+        __m128 value = _mm_mul_ps(_mm_set1_ps(p[i*4 + 0]), row0);
+        value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(p[i*4 + 1]), row1));
+        value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(p[i*4 + 2]), row2));
+        value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(p[i*4 + 3]), row3));
+        _mm_storeu_ps(&r[i*4], value);
+    }
+#elif defined(SKINNING_SIMD_NEON)
+    float32x4_t row0 = vld1q_f32(&l[0]);
+    float32x4_t row1 = vld1q_f32(&l[4]);
+    float32x4_t row2 = vld1q_f32(&l[8]);
+    float32x4_t row3 = vld1q_f32(&l[12]);
+
+    for (int i = 0; i < 4; i++)
+    {
+        float32x4_t value = vmulq_n_f32(row0, p[i*4 + 0]);
+        value = vmlaq_n_f32(value, row1, p[i*4 + 1]);
+        value = vmlaq_n_f32(value, row2, p[i*4 + 2]);
+        value = vmlaq_n_f32(value, row3, p[i*4 + 3]);
+        vst1q_f32(&r[i*4], value);
+    }
+#else
+    *result = MatrixMultiply(*local, *parent);
+#endif
+}
+
+// Get mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix,
+// bounds cached by UploadMesh()/UpdateMeshBounds() are returned unless positions were updated with UpdateMeshBuffer() since,
+// vertices modified in place without any of those calls require UpdateMeshBounds() to refresh cached bounds
+BoundingBox GetMeshBoundingBox(Mesh mesh)
+{
+    // Use cached bounds if available and not stale
+    if (IsMeshBoundsCached(mesh)) return (BoundingBox){ mesh.boundsMin, mesh.boundsMax };
+
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+
+    // Create the bounding box
+    BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Compute and cache mesh bounds
+// NOTE: Required if mesh vertices are modified after UploadMesh()
+void UpdateMeshBounds(Mesh *mesh)
+{
+    ComputeMeshBounds(mesh);
+}
+
+// Generate simplified mesh by edge collapse (target triangles count)
+// NOTE: Vertex attributes are kept (no new vertices), animation data is not copied
+Mesh GenMeshSimplified(Mesh mesh, int triangleCount)
+{
+    Mesh simplified = SimplifyMesh(mesh, triangleCount);
+
+    // Upload vertex data to GPU (static mesh)
+    if (simplified.vertexCount > 0) UploadMesh(&simplified, false);
+
+    return simplified;
+}
+
+// Optimize mesh vertex data: weld identical vertices, reorder triangles for vertex cache and overdraw, reorder vertices for fetch
+// NOTE: Mesh must not be uploaded to GPU yet, non-indexed meshes get 16 bit indices (only if welded vertices fit)
+void OptimizeMesh(Mesh *mesh, int flags)
+{
+    if ((mesh->vertexCount <= 0) || (mesh->vertices == NULL)) return;
+
+    if (mesh->vaoId > 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to optimize mesh, vertex data already uploaded to GPU");
+        return;
+    }
+
+    int indexCount = mesh->triangleCount*3;
+    if ((mesh->indices == NULL) && (indexCount > mesh->vertexCount)) indexCount = mesh->vertexCount - mesh->vertexCount%3;
+    if (indexCount < 3) return;
+
+    unsigned int *remap = (unsigned int *)RL_MALLOC(mesh->vertexCount*sizeof(unsigned int));
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    if (mesh->indices != NULL) for (int i = 0; i < indexCount; i++) indices[i] = mesh->indices[i];
+    else for (int i = 0; i < indexCount; i++) indices[i] = i;
+
+    int vertexCount = mesh->vertexCount;
+
+    if (flags & MESH_OPTIMIZE_WELD)
+    {
+        int uniqueCount = WeldMeshVertices(mesh, remap);
+
+        // NOTE: Welded vertices must fit 16 bit indices, mesh is kept as provided otherwise
+        if ((uniqueCount < vertexCount) && (uniqueCount <= 65536))
+        {
+            for (int i = 0; i < indexCount; i++) indices[i] = remap[indices[i]];
+            RemapMeshVertices(mesh, remap, uniqueCount);
+            vertexCount = uniqueCount;
+        }
+    }
+
+    if (vertexCount > 65536)
+    {
+        TRACELOG(LOG_INFO, "MESH: Mesh not optimized, %i vertices do not fit 16 bit indices", vertexCount);
+        RL_FREE(remap);
+        RL_FREE(indices);
+        return;
+    }
+
+    if (flags & MESH_OPTIMIZE_VERTEX_CACHE) OptimizeMeshVertexCache(indices, indexCount, vertexCount);
+    if (flags & MESH_OPTIMIZE_OVERDRAW) OptimizeMeshOverdraw(indices, indexCount, mesh->vertices, vertexCount);
+
+    if (flags & MESH_OPTIMIZE_VERTEX_FETCH)
+    {
+        int usedCount = OptimizeMeshVertexFetch(indices, indexCount, remap, vertexCount);
+        RemapMeshVertices(mesh, remap, usedCount);
+        vertexCount = usedCount;
+    }
+
+    // Store optimized indices
+    if (mesh->indices == NULL) mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)indices[i];
+
+    mesh->triangleCount = indexCount/3;
+
+    TRACELOG(LOG_DEBUG, "MESH: Optimized mesh: %i vertices, %i triangles", mesh->vertexCount, mesh->triangleCount);
+
+    RL_FREE(remap);
+    RL_FREE(indices);
+}
+
+// Compute mesh tangents
+// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
+// Implementation base don: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
+void GenMeshTangents(Mesh *mesh)
+{
+    if ((mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to compute tangents, vertex data not available in CPU memory");
+        return;
+    }
+
+    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    else
+    {
+        RL_FREE(mesh->tangents);
+        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    }
+
+    Vector3 *tan1 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+    Vector3 *tan2 = (Vector3 *)RL_MALLOC(mesh->vertexCount*sizeof(Vector3));
+
+    for (int i = 0; i < mesh->vertexCount; i += 3)
+    {
+        // Get triangle vertices
+        Vector3 v1 = { mesh->vertices[(i + 0)*3 + 0], mesh->vertices[(i + 0)*3 + 1], mesh->vertices[(i + 0)*3 + 2] };
+        Vector3 v2 = { mesh->vertices[(i + 1)*3 + 0], mesh->vertices[(i + 1)*3 + 1], mesh->vertices[(i + 1)*3 + 2] };
+        Vector3 v3 = { mesh->vertices[(i + 2)*3 + 0], mesh->vertices[(i + 2)*3 + 1], mesh->vertices[(i + 2)*3 + 2] };
+
+        // Get triangle texcoords
+        Vector2 uv1 = { mesh->texcoords[(i + 0)*2 + 0], mesh->texcoords[(i + 0)*2 + 1] };
+        Vector2 uv2 = { mesh->texcoords[(i + 1)*2 + 0], mesh->texcoords[(i + 1)*2 + 1] };
+        Vector2 uv3 = { mesh->texcoords[(i + 2)*2 + 0], mesh->texcoords[(i + 2)*2 + 1] };
+
+        float x1 = v2.x - v1.x;
+        float y1 = v2.y - v1.y;
+        float z1 = v2.z - v1.z;
+        float x2 = v3.x - v1.x;
+        float y2 = v3.y - v1.y;
+        float z2 = v3.z - v1.z;
+
+        float s1 = uv2.x - uv1.x;
+        float t1 = uv2.y - uv1.y;
+        float s2 = uv3.x - uv1.x;
+        float t2 = uv3.y - uv1.y;
+
+        float div = s1*t2 - s2*t1;
+        float r = (div == 0.0f)? 0.0f : 1.0f/div;
+
+        Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
+        Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+
+        tan1[i + 0] = sdir;
+        tan1[i + 1] = sdir;
+        tan1[i + 2] = sdir;
+
+        tan2[i + 0] = tdir;
+        tan2[i + 1] = tdir;
+        tan2[i + 2] = tdir;
+    }
+
+    // Compute tangents considering normals
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        Vector3 tangent = tan1[i];
+
+        // TODO: Review, not sure if tangent computation is right, just used reference proposed maths...
+#if defined(COMPUTE_TANGENTS_METHOD_01)
+        Vector3 tmp = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
+        tmp = Vector3Normalize(tmp);
+        mesh->tangents[i*4 + 0] = tmp.x;
+        mesh->tangents[i*4 + 1] = tmp.y;
+        mesh->tangents[i*4 + 2] = tmp.z;
+        mesh->tangents[i*4 + 3] = 1.0f;
+#else
+        Vector3OrthoNormalize(&normal, &tangent);
+        mesh->tangents[i*4 + 0] = tangent.x;
+        mesh->tangents[i*4 + 1] = tangent.y;
+        mesh->tangents[i*4 + 2] = tangent.z;
+        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, tangent), tan2[i]) < 0.0f)? -1.0f : 1.0f;
+#endif
+    }
+
+    RL_FREE(tan1);
+    RL_FREE(tan2);
+
+    if (mesh->vboId != NULL)
+    {
+        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
+        {
+            // Upate existing vertex buffer
+            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
+        }
+        else
+        {
+            // Load a new tangent attributes buffer
+            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+        }
+
+        rlEnableVertexArray(mesh->vaoId);
+        rlSetVertexAttribute(4, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(4);
+        rlDisableVertexArray();
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+}
+
+// Compute mesh binormals (aka bitangent)
+void GenMeshBinormals(Mesh *mesh)
+{
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        //Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
+        //Vector3 tangent = { mesh->tangents[i*4 + 0], mesh->tangents[i*4 + 1], mesh->tangents[i*4 + 2] };
+        //Vector3 binormal = Vector3Scale(Vector3CrossProduct(normal, tangent), mesh->tangents[i*4 + 3]);
+
+        // TODO: Register computed binormal in mesh->binormal?
+    }
+}
+
+// Draw a model (with texture if set)
+void DrawModel(Model model, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    int lod = GetModelLod(model, model.transform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(GetModelLodMesh(model, i, lod), model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model, meshes outside frustum are skipped
+void DrawModelCulled(Model model, Frustum frustum, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelExCulled(model, frustum, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters, meshes outside frustum are skipped
+// NOTE: Meshes are tested using their cached bounding sphere, meshes without cached bounds are always drawn
+void DrawModelExCulled(Model model, Frustum frustum, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    // Mesh bounds are tested in world space, considering current rlgl transform (rlPushMatrix()/rlTranslatef()...)
+    Matrix matWorld = MatrixMultiply(model.transform, rlGetMatrixTransform());
+    int lod = GetModelLod(model, model.transform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (!CheckFrustumMesh(frustum, model.meshes[i], matWorld)) continue;
+
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(GetModelLodMesh(model, i, lod), model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model wires (with texture if set)
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+{
+    // NOTE: Wires are drawn immediately, wire mode is not recorded by render queue
+    bool recording = renderQueue.recording;
+    renderQueue.recording = false;
+
+    rlEnableWireMode();
+
+    DrawModel(model, position, scale, tint);
+
+    rlDisableWireMode();
+
+    renderQueue.recording = recording;
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // NOTE: Wires are drawn immediately, wire mode is not recorded by render queue
+    bool recording = renderQueue.recording;
+    renderQueue.recording = false;
+
+    rlEnableWireMode();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlDisableWireMode();
+
+    renderQueue.recording = recording;
+}
+
+// Draw a billboard
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+{
+    // NOTE: Billboard locked on axis-Y
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
+}
+
+void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+{
+    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
+    Vector2 sizeRatio = { size.y, size.x*(float)source.height/source.width };
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+
+    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
+    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+
+    Vector3 p1 = Vector3Add(rightScaled, upScaled);
+    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+
+    Vector3 topLeft = Vector3Scale(p2, -1);
+    Vector3 topRight = p1;
+    Vector3 bottomRight = p2;
+    Vector3 bottomLeft = Vector3Scale(p1, -1);
+
+    if (rotation != 0.0f)
+    {
+        float sinRotation = sinf(rotation*DEG2RAD);
+        float cosRotation = cosf(rotation*DEG2RAD);
+
+        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
+        float rotateAboutX = sizeRatio.x*origin.x/2;
+        float rotateAboutY = sizeRatio.y*origin.y/2;
+
+        float xtvalue, ytvalue;
+        float rotatedX, rotatedY;
+
+        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
+        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+
+        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+    }
+
+    // Translate points to the draw center (position)
+    topLeft = Vector3Add(topLeft, position);
+    topRight = Vector3Add(topRight, position);
+    bottomRight = Vector3Add(bottomRight, position);
+    bottomLeft = Vector3Add(bottomLeft, position);
+
+    rlCheckRenderBatchLimit(4);
+
+    rlSetTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        // Bottom-left corner for texture and quad
+        rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
+        rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+
+        // Top-left corner for texture and quad
+        rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
+        rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+
+        // Top-right corner for texture and quad
+        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
+        rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+
+        // Bottom-right corner for texture and quad
+        rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
+        rlVertex3f(topRight.x, topRight.y, topRight.z);
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Draw billboards batch sharing one texture, camera basis is computed once for all billboards
+// NOTE: Big batches are expanded on GPU (instanced quads, one instance per billboard), small ones (or OpenGL 1.1)
+// are expanded on CPU directly into rlgl batch, billboards are not sorted
+void DrawBillboards(Camera camera, Texture2D texture, const Billboard *billboards, int count, Vector3 up)
+{
+    if ((billboards == NULL) || (count <= 0)) return;
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    float width = (texture.width > 0)? (float)texture.width : 1.0f;
+    float height = (texture.height > 0)? (float)texture.height : 1.0f;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((count >= BILLBOARDS_INSTANCING_MIN_COUNT) && !rlIsCommandListRecording())
+    {
+        if (!billboardsShaderLoaded) LoadShaderBillboards();
+
+        if (billboardsShader.id > 0)
+        {
+            rlDrawRenderBatchActive();      // Draw pending batch before instanced billboards (keep drawing order)
+
+            BillboardInstance *instances = (BillboardInstance *)MemAllocScratch(count*sizeof(BillboardInstance));
+
+            for (int i = 0; i < count; i++)
+            {
+                const Billboard *billboard = &billboards[i];
+                BillboardInstance *instance = &instances[i];
+
+                instance->center[0] = billboard->position.x;
+                instance->center[1] = billboard->position.y;
+                instance->center[2] = billboard->position.z;
+                instance->center[3] = billboard->size.x;
+                instance->source[0] = billboard->source.x/width;
+                instance->source[1] = billboard->source.y/height;
+                instance->source[2] = (billboard->source.x + billboard->source.width)/width;
+                instance->source[3] = (billboard->source.y + billboard->source.height)/height;
+                instance->height = billboard->size.y;
+                instance->color[0] = billboard->tint.r;
+                instance->color[1] = billboard->tint.g;
+                instance->color[2] = billboard->tint.b;
+                instance->color[3] = billboard->tint.a;
+            }
+
+            int offset = 0;
+            unsigned int bufferId = rlUpdateInstanceStream(instances, count*sizeof(BillboardInstance), &offset);
+            MemFreeScratch(instances);
+
+            Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+            int textureSlot = 0;
+
+            rlEnableShader(billboardsShader.id);
+            rlSetUniformMatrix(billboardsShader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(matModelView, rlGetMatrixProjection()));
+            rlSetUniform(billboardsShaderLocs[0], &right, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(billboardsShaderLocs[1], &up, SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(billboardsShader.locs[SHADER_LOC_MAP_DIFFUSE], &textureSlot, SHADER_UNIFORM_INT, 1);
+
+            rlActiveTextureSlot(0);
+            rlEnableTexture((texture.id > 0)? texture.id : rlGetTextureIdDefault());
+
+            // NOTE: Attributes are set on every draw, instance data offset changes on every upload
+            // and vertex array objects could not be supported (OpenGL ES 2.0)
+            rlEnableVertexArray(billboardsVaoId);
+            rlEnableVertexBuffer(billboardsQuadVboId);
+            rlEnableVertexAttribute(billboardsShader.locs[SHADER_LOC_VERTEX_POSITION]);
+            rlSetVertexAttribute(billboardsShader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+
+            rlEnableVertexBuffer(bufferId);
+            rlSetVertexAttribute(billboardsShaderLocs[2], 4, RL_FLOAT, 0, sizeof(BillboardInstance), (void *)(size_t)offset);
+            rlSetVertexAttribute(billboardsShaderLocs[3], 4, RL_FLOAT, 0, sizeof(BillboardInstance), (void *)(size_t)(offset + 4*sizeof(float)));
+            rlSetVertexAttribute(billboardsShaderLocs[4], 1, RL_FLOAT, 0, sizeof(BillboardInstance), (void *)(size_t)(offset + 8*sizeof(float)));
+            rlSetVertexAttribute(billboardsShaderLocs[5], 4, RL_UNSIGNED_BYTE, 1, sizeof(BillboardInstance), (void *)(size_t)(offset + 9*sizeof(float)));
+            for (int i = 2; i < 6; i++)
+            {
+                rlEnableVertexAttribute(billboardsShaderLocs[i]);
+                rlSetVertexAttributeDivisor(billboardsShaderLocs[i], 1);
+            }
+
+            rlDrawVertexArrayInstanced(0, 6, count);
+
+            for (int i = 2; i < 6; i++)
+            {
+                rlSetVertexAttributeDivisor(billboardsShaderLocs[i], 0);
+                rlDisableVertexAttribute(billboardsShaderLocs[i]);
+            }
+            rlDisableVertexAttribute(billboardsShader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+            rlDisableVertexBuffer();
+            rlDisableVertexArray();
+            rlDisableTexture();
+            rlDisableShader();
+
+            return;
+        }
+    }
+#endif
+
+    rlSetTexture(texture.id);
+
+    for (int i = 0; i < count; i++)
+    {
+        const Billboard *billboard = &billboards[i];
+        Vector3 halfRight = Vector3Scale(right, billboard->size.x*0.5f);
+        Vector3 halfUp = Vector3Scale(up, billboard->size.y*0.5f);
+        Vector3 position = billboard->position;
+        float u0 = billboard->source.x/width;
+        float v0 = billboard->source.y/height;
+        float u1 = (billboard->source.x + billboard->source.width)/width;
+        float v1 = (billboard->source.y + billboard->source.height)/height;
+
+        rlCheckRenderBatchLimit(4);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(billboard->tint.r, billboard->tint.g, billboard->tint.b, billboard->tint.a);
+
+            rlTexCoord2f(u0, v0);
+            rlVertex3f(position.x - halfRight.x + halfUp.x, position.y - halfRight.y + halfUp.y, position.z - halfRight.z + halfUp.z);
+            rlTexCoord2f(u0, v1);
+            rlVertex3f(position.x - halfRight.x - halfUp.x, position.y - halfRight.y - halfUp.y, position.z - halfRight.z - halfUp.z);
+            rlTexCoord2f(u1, v1);
+            rlVertex3f(position.x + halfRight.x - halfUp.x, position.y + halfRight.y - halfUp.y, position.z + halfRight.z - halfUp.z);
+            rlTexCoord2f(u1, v0);
+            rlVertex3f(position.x + halfRight.x + halfUp.x, position.y + halfRight.y + halfUp.y, position.z + halfRight.z + halfUp.z);
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+}
+
+// Draw a bounding box with wires
+void DrawBoundingBox(BoundingBox box, Color color)
+{
+    Vector3 size = { 0 };
+
+    size.x = fabsf(box.max.x - box.min.x);
+    size.y = fabsf(box.max.y - box.min.y);
+    size.z = fabsf(box.max.z - box.min.z);
+
+    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Check collision between two spheres
+bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = center1.x - center2.x;      // X distance between centers
+    float dy = center1.y - center2.y;      // Y distance between centers
+    float dz = center1.z - center2.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radius1 + radius2)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get camera view frustum planes
+// NOTE: Projection is computed as BeginMode3D(), aspect should be current render width/height
+Frustum GetCameraFrustum(Camera camera, float aspect)
+{
+    Matrix matProjection = MatrixIdentity();
+
+    if (camera.projection == CAMERA_PERSPECTIVE)
+    {
+        double top = RL_CULL_DISTANCE_NEAR*tan(camera.fovy*0.5*DEG2RAD);
+        double right = top*aspect;
+
+        matProjection = MatrixFrustum(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    else if (camera.projection == CAMERA_ORTHOGRAPHIC)
+    {
+        double top = camera.fovy/2.0;
+        double right = top*aspect;
+
+        matProjection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    return GetMatrixFrustum(MatrixMultiply(matView, matProjection));
+}
+
+// Get frustum planes from combined view-projection matrix
+// NOTE: Planes extracted from clip space matrix rows (Gribb/Hartmann method)
+Frustum GetMatrixFrustum(Matrix matViewProjection)
+{
+    Frustum frustum = { 0 };
+    Matrix m = matViewProjection;
+
+    frustum.planes[0] = (Vector4){ m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12 };     // Left
+    frustum.planes[1] = (Vector4){ m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12 };     // Right
+    frustum.planes[2] = (Vector4){ m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13 };     // Bottom
+    frustum.planes[3] = (Vector4){ m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13 };     // Top
+    frustum.planes[4] = (Vector4){ m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14 };    // Near
+    frustum.planes[5] = (Vector4){ m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14 };    // Far
+
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+        float length = sqrtf(plane.x*plane.x + plane.y*plane.y + plane.z*plane.z);
+
+        if (length > 0.0f) frustum.planes[i] = (Vector4){ plane.x/length, plane.y/length, plane.z/length, plane.w/length };
+    }
+
+    return frustum;
+}
+
+// Check if sphere is (partially) inside frustum
+bool CheckFrustumSphere(Frustum frustum, Vector3 center, float radius)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+        if ((plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w) < -radius) return false;
+    }
+
+    return true;
+}
+
+// Check if bounding box is (partially) inside frustum
+// NOTE: Box corner farthest along each plane normal is tested, boxes close to frustum corners could be reported as inside
+bool CheckFrustumBox(Frustum frustum, BoundingBox box)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+
+        float x = (plane.x >= 0.0f)? box.max.x : box.min.x;
+        float y = (plane.y >= 0.0f)? box.max.y : box.min.y;
+        float z = (plane.z >= 0.0f)? box.max.z : box.min.z;
+
+        if ((plane.x*x + plane.y*y + plane.z*z + plane.w) < 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Get collision info between ray and sphere
+RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float distance = Vector3Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+{
+    RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result.
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
+    collision.distance = t[6];
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elemets of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Vector3Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+            Vector3* vertdata = (Vector3*)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside of the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
+
+    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+// Load mesh triangles bounding volume hierarchy, built with surface area heuristic (binned)
+// NOTE: Triangles vertices are copied in leaves order (object space), mesh can be unloaded after
+MeshBVH LoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0)) return bvh;
+
+    int triangleCount = mesh.triangleCount;
+    const Vector3 *vertdata = (const Vector3 *)mesh.vertices;
+
+    // Triangles bounds and centroids, used by build only
+    MeshBVHTriangle *triangles = (MeshBVHTriangle *)RL_MALLOC(triangleCount*sizeof(MeshBVHTriangle));
+    int *order = (int *)RL_MALLOC(triangleCount*sizeof(int));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        Vector3 a, b, c;
+
+        if (mesh.indices)
+        {
+            a = vertdata[mesh.indices[i*3 + 0]];
+            b = vertdata[mesh.indices[i*3 + 1]];
+            c = vertdata[mesh.indices[i*3 + 2]];
+        }
+        else
+        {
+            a = vertdata[i*3 + 0];
+            b = vertdata[i*3 + 1];
+            c = vertdata[i*3 + 2];
+        }
+
+        triangles[i].min = Vector3Min(Vector3Min(a, b), c);
+        triangles[i].max = Vector3Max(Vector3Max(a, b), c);
+        triangles[i].centroid = Vector3Scale(Vector3Add(triangles[i].min, triangles[i].max), 0.5f);
+        order[i] = i;
+    }
+
+    // NOTE: A binary tree with one triangle or more per leaf has up to 2*n - 1 nodes
+    bvh.nodes = (MeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBVHNode));
+    bvh.triangleCount = triangleCount;
+
+    BuildMeshBVHNode(&bvh, triangles, order, 0, triangleCount, 0);
+
+    bvh.nodes = (MeshBVHNode *)RL_REALLOC(bvh.nodes, bvh.nodeCount*sizeof(MeshBVHNode));
+
+    // Copy triangles vertices in leaves order, leaves triangles are contiguous in memory
+    bvh.vertices = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int index = order[i]*3 + k;
+            bvh.vertices[i*3 + k] = vertdata[(mesh.indices != NULL)? mesh.indices[index] : index];
+        }
+    }
+
+    RL_FREE(triangles);
+    RL_FREE(order);
+
+    TRACELOG(LOG_INFO, "MESH: BVH built successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Unload mesh bounding volume hierarchy
+void UnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.vertices);
+}
+
+// Get closest collision info between ray and mesh BVH triangles
+RayCollision GetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform)
+{
+    return RayCastMeshBVH(ray, bvh, transform, MatrixInvert(transform), FLT_MAX, false);
+}
+
+// Get closest collisions info between rays batch and mesh BVH triangles
+void GetRayCollisionsMeshBVH(const Ray *rays, RayCollision *collisions, int count, MeshBVH bvh, Matrix transform)
+{
+    Matrix invTransform = MatrixInvert(transform);
+
+    for (int i = 0; i < count; i++) collisions[i] = RayCastMeshBVH(rays[i], bvh, transform, invTransform, FLT_MAX, false);
+}
+
+// Get any collision info between ray and mesh BVH triangles, up to max distance (line of sight)
+// NOTE: First found hit is returned, not necessarily the closest one
+RayCollision GetRayCollisionMeshBVHAny(Ray ray, MeshBVH bvh, Matrix transform, float maxDistance)
+{
+    return RayCastMeshBVH(ray, bvh, transform, MatrixInvert(transform), maxDistance, true);
+}
+
+// Check collision between mesh BVH triangles and sphere
+bool CheckCollisionMeshBVHSphere(MeshBVH bvh, Matrix transform, Vector3 center, float radius)
+{
+    BoundingBox bounds = { Vector3SubtractValue(center, radius), Vector3AddValue(center, radius) };
+
+    return CheckCollisionMeshBVHShape(bvh, transform, bounds, &center, radius);
+}
+
+// Check collision between mesh BVH triangles and box
+bool CheckCollisionMeshBVHBox(MeshBVH bvh, Matrix transform, BoundingBox box)
+{
+    return CheckCollisionMeshBVHShape(bvh, transform, box, NULL, 0.0f);
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Build mesh BVH node for a triangles range, children are built recursively, returns node index
+// NOTE: Nodes are stored depth-first, first child right after its parent, second child index stored in node
+static int BuildMeshBVHNode(MeshBVH *bvh, const MeshBVHTriangle *triangles, int *order, int first, int count, int depth)
+{
+    int index = bvh->nodeCount++;
+    MeshBVHNode *node = &bvh->nodes[index];
+
+    Vector3 centroidMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+    Vector3 centroidMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    node->min = centroidMin;
+    node->max = centroidMax;
+
+    for (int i = first; i < (first + count); i++)
+    {
+        const MeshBVHTriangle *triangle = &triangles[order[i]];
+
+        node->min = Vector3Min(node->min, triangle->min);
+        node->max = Vector3Max(node->max, triangle->max);
+        centroidMin = Vector3Min(centroidMin, triangle->centroid);
+        centroidMax = Vector3Max(centroidMax, triangle->centroid);
+    }
+
+    node->offset = first;
+    node->count = count;
+
+    // NOTE: Depth is limited to keep traversal stack bounded, deepest leaves could keep more triangles
+    if ((count <= MESH_BVH_LEAF_TRIANGLES) || (depth >= MESH_BVH_MAX_DEPTH)) return index;
+
+    // Find best split plane between bins boundaries on every axis (surface area heuristic)
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = GetMeshBVHBoxArea(node->min, node->max)*count;     // Leaf cost
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float axisMin = ((float *)&centroidMin)[axis];
+        float axisExtent = ((float *)&centroidMax)[axis] - axisMin;
+
+        if (axisExtent <= 0.0f) continue;
+
+        Vector3 binsMin[MESH_BVH_SAH_BINS];
+        Vector3 binsMax[MESH_BVH_SAH_BINS];
+        int binsCount[MESH_BVH_SAH_BINS] = { 0 };
+
+        for (int b = 0; b < MESH_BVH_SAH_BINS; b++)
+        {
+            binsMin[b] = (Vector3){ FLT_MAX, FLT_MAX, FLT_MAX };
+            binsMax[b] = (Vector3){ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        }
+
+        for (int i = first; i < (first + count); i++)
+        {
+            const MeshBVHTriangle *triangle = &triangles[order[i]];
+            int b = (int)((((const float *)&triangle->centroid)[axis] - axisMin)*MESH_BVH_SAH_BINS/axisExtent);
+            if (b > (MESH_BVH_SAH_BINS - 1)) b = MESH_BVH_SAH_BINS - 1;
+
+            binsMin[b] = Vector3Min(binsMin[b], triangle->min);
+            binsMax[b] = Vector3Max(binsMax[b], triangle->max);
+            binsCount[b]++;
+        }
+
+        // Sweep bins from right side to accumulate right partitions areas
+        float rightArea[MESH_BVH_SAH_BINS] = { 0 };
+        int rightCount[MESH_BVH_SAH_BINS] = { 0 };
+        Vector3 sideMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+        Vector3 sideMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int sideCount = 0;
+
+        for (int b = MESH_BVH_SAH_BINS - 1; b > 0; b--)
+        {
+            sideMin = Vector3Min(sideMin, binsMin[b]);
+            sideMax = Vector3Max(sideMax, binsMax[b]);
+            sideCount += binsCount[b];
+            rightArea[b] = (sideCount > 0)? GetMeshBVHBoxArea(sideMin, sideMax) : 0.0f;
+            rightCount[b] = sideCount;
+        }
+
+        sideMin = (Vector3){ FLT_MAX, FLT_MAX, FLT_MAX };
+        sideMax = (Vector3){ -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        sideCount = 0;
+
+        for (int b = 0; b < (MESH_BVH_SAH_BINS - 1); b++)
+        {
+            sideMin = Vector3Min(sideMin, binsMin[b]);
+            sideMax = Vector3Max(sideMax, binsMax[b]);
+            sideCount += binsCount[b];
+
+            if ((sideCount == 0) || (rightCount[b + 1] == 0)) continue;
+
+            float cost = GetMeshBVHBoxArea(sideMin, sideMax)*sideCount + rightArea[b + 1]*rightCount[b + 1];
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = b + 1;
+            }
+        }
+    }
+
+    int middle = first;
+
+    if (bestAxis >= 0)
+    {
+        // Partition triangles by split bin
+        float axisMin = ((float *)&centroidMin)[bestAxis];
+        float axisExtent = ((float *)&centroidMax)[bestAxis] - axisMin;
+        int last = first + count - 1;
+
+        while (middle <= last)
+        {
+            int b = (int)((((const float *)&triangles[order[middle]].centroid)[bestAxis] - axisMin)*MESH_BVH_SAH_BINS/axisExtent);
+            if (b > (MESH_BVH_SAH_BINS - 1)) b = MESH_BVH_SAH_BINS - 1;
+
+            if (b < bestSplit) middle++;
+            else
+            {
+                int temp = order[middle];
+                order[middle] = order[last];
+                order[last] = temp;
+                last--;
+            }
+        }
+    }
+    else if (count > MESH_BVH_MAX_LEAF_TRIANGLES)
+    {
+        // Splitting is not cheaper than a leaf (or centroids overlap), big leaves are split in half anyway
+        middle = first + count/2;
+    }
+    else return index;
+
+    node->count = 0;
+
+    BuildMeshBVHNode(bvh, triangles, order, first, middle - first, depth + 1);
+    int second = BuildMeshBVHNode(bvh, triangles, order, middle, first + count - middle, depth + 1);
+
+    bvh->nodes[index].offset = second;     // NOTE: Nodes array not reallocated while building
+
+    return index;
+}
+
+// Get box half surface area, used as SAH cost
+static float GetMeshBVHBoxArea(Vector3 min, Vector3 max)
+{
+    Vector3 size = Vector3Subtract(max, min);
+
+    return (size.x*size.y + size.y*size.z + size.z*size.x);
+}
+
+// Get ray entry distance into mesh BVH node box, FLT_MAX if missed or farther than max distance
+static float GetMeshBVHNodeDistance(const MeshBVHNode *node, Vector3 origin, Vector3 invDirection, float maxDistance)
+{
+    float tx1 = (node->min.x - origin.x)*invDirection.x;
+    float tx2 = (node->max.x - origin.x)*invDirection.x;
+    float ty1 = (node->min.y - origin.y)*invDirection.y;
+    float ty2 = (node->max.y - origin.y)*invDirection.y;
+    float tz1 = (node->min.z - origin.z)*invDirection.z;
+    float tz2 = (node->max.z - origin.z)*invDirection.z;
+
+    float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fmaxf(fminf(tz1, tz2), 0.0f));
+    float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fminf(fmaxf(tz1, tz2), maxDistance));
+
+    return (tmin <= tmax)? tmin : FLT_MAX;
+}
+
+// Cast ray against mesh BVH triangles, closest hit or any hit up to max distance
+// NOTE: Ray is transformed to object space without normalization, so hit distances are measured in ray space
+static RayCollision RayCastMeshBVH(Ray ray, MeshBVH bvh, Matrix transform, Matrix invTransform, float maxDistance, bool anyHit)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+
+    if (bvh.nodeCount == 0) return collision;
+
+    Vector3 origin = Vector3Transform(ray.position, invTransform);
+    Vector3 direction = {
+        invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z,
+        invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z,
+        invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z
+    };
+    Vector3 invDirection = { 1.0f/direction.x, 1.0f/direction.y, 1.0f/direction.z };
+
+    float closest = maxDistance;
+    int hitTriangle = -1;
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackSize = 0;
+
+    if (GetMeshBVHNodeDistance(&bvh.nodes[0], origin, invDirection, closest) != FLT_MAX) stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        int index = stack[--stackSize];
+        const MeshBVHNode *node = &bvh.nodes[index];
+
+        if (node->count > 0)
+        {
+            // Test leaf triangles (Möller–Trumbore, same as GetRayCollisionTriangle())
+            for (int i = node->offset; i < (node->offset + node->count); i++)
+            {
+                const Vector3 *v = &bvh.vertices[i*3];
+                Vector3 edge1 = Vector3Subtract(v[1], v[0]);
+                Vector3 edge2 = Vector3Subtract(v[2], v[0]);
+                Vector3 p = Vector3CrossProduct(direction, edge2);
+                float det = Vector3DotProduct(edge1, p);
+
+                if ((det > -EPSILON) && (det < EPSILON)) continue;
+
+                float invDet = 1.0f/det;
+                Vector3 tv = Vector3Subtract(origin, v[0]);
+                float u = Vector3DotProduct(tv, p)*invDet;
+
+                if ((u < 0.0f) || (u > 1.0f)) continue;
+
+                Vector3 q = Vector3CrossProduct(tv, edge1);
+                float w = Vector3DotProduct(direction, q)*invDet;
+
+                if ((w < 0.0f) || ((u + w) > 1.0f)) continue;
+
+                float t = Vector3DotProduct(edge2, q)*invDet;
+
+                if ((t > EPSILON) && (t < closest))
+                {
+                    closest = t;
+                    hitTriangle = i;
+
+                    if (anyHit) break;
+                }
+            }
+
+            if (anyHit && (hitTriangle >= 0)) break;
+        }
+        else
+        {
+            // Visit nearest child first, children farther than closest hit are skipped
+            int near = index + 1;
+            int far = node->offset;
+            float nearDistance = GetMeshBVHNodeDistance(&bvh.nodes[near], origin, invDirection, closest);
+            float farDistance = GetMeshBVHNodeDistance(&bvh.nodes[far], origin, invDirection, closest);
+
+            if (nearDistance > farDistance)
+            {
+                int temp = near; near = far; far = temp;
+                float tempDistance = nearDistance; nearDistance = farDistance; farDistance = tempDistance;
+            }
+
+            if (farDistance != FLT_MAX) stack[stackSize++] = far;
+            if (nearDistance != FLT_MAX) stack[stackSize++] = near;
+        }
+    }
+
+    if (hitTriangle >= 0)
+    {
+        const Vector3 *v = &bvh.vertices[hitTriangle*3];
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(v[1], v[0]), Vector3Subtract(v[2], v[0]));
+
+        collision.hit = true;
+        collision.distance = closest;
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, closest));
+
+        // Normal transformed with inverse transpose matrix (supports non-uniform scale)
+        collision.normal.x = invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z;
+        collision.normal.y = invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z;
+        collision.normal.z = invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z;
+        collision.normal = Vector3Normalize(collision.normal);
+    }
+
+    return collision;
+}
+
+// Check collision between mesh BVH triangles and sphere (center not NULL) or box (bounds)
+// NOTE: Nodes are tested against bounds in object space, triangles are tested exactly in world space
+static bool CheckCollisionMeshBVHShape(MeshBVH bvh, Matrix transform, BoundingBox bounds, const Vector3 *center, float radius)
+{
+    if (bvh.nodeCount == 0) return false;
+
+    // Get query bounds in object space, transformed box corners bounds
+    Matrix invTransform = MatrixInvert(transform);
+    BoundingBox localBounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+
+    for (int i = 0; i < 8; i++)
+    {
+        Vector3 corner = { (i & 1)? bounds.max.x : bounds.min.x, (i & 2)? bounds.max.y : bounds.min.y, (i & 4)? bounds.max.z : bounds.min.z };
+        corner = Vector3Transform(corner, invTransform);
+
+        localBounds.min = Vector3Min(localBounds.min, corner);
+        localBounds.max = Vector3Max(localBounds.max, corner);
+    }
+
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackSize = 0;
+
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        int index = stack[--stackSize];
+        const MeshBVHNode *node = &bvh.nodes[index];
+
+        if (!CheckCollisionBoxes((BoundingBox){ node->min, node->max }, localBounds)) continue;
+
+        if (node->count > 0)
+        {
+            for (int i = node->offset; i < (node->offset + node->count); i++)
+            {
+                Vector3 a = Vector3Transform(bvh.vertices[i*3 + 0], transform);
+                Vector3 b = Vector3Transform(bvh.vertices[i*3 + 1], transform);
+                Vector3 c = Vector3Transform(bvh.vertices[i*3 + 2], transform);
+
+                if (center != NULL)
+                {
+                    Vector3 closest = GetTriangleClosestPoint(*center, a, b, c);
+                    if (Vector3DistanceSqr(closest, *center) <= radius*radius) return true;
+                }
+                else if (CheckCollisionTriangleBox(a, b, c, bounds)) return true;
+            }
+        }
+        else
+        {
+            stack[stackSize++] = node->offset;
+            stack[stackSize++] = index + 1;
+        }
+    }
+
+    return false;
+}
+
+// Get closest point on triangle to point
+// NOTE: Based on Real-Time Collision Detection (Christer Ericson), 5.1.5
+static Vector3 GetTriangleClosestPoint(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
+{
+    Vector3 ab = Vector3Subtract(b, a);
+    Vector3 ac = Vector3Subtract(c, a);
+    Vector3 ap = Vector3Subtract(p, a);
+
+    float d1 = Vector3DotProduct(ab, ap);
+    float d2 = Vector3DotProduct(ac, ap);
+    if ((d1 <= 0.0f) && (d2 <= 0.0f)) return a;
+
+    Vector3 bp = Vector3Subtract(p, b);
+    float d3 = Vector3DotProduct(ab, bp);
+    float d4 = Vector3DotProduct(ac, bp);
+    if ((d3 >= 0.0f) && (d4 <= d3)) return b;
+
+    float vc = d1*d4 - d3*d2;
+    if ((vc <= 0.0f) && (d1 >= 0.0f) && (d3 <= 0.0f)) return Vector3Add(a, Vector3Scale(ab, d1/(d1 - d3)));
+
+    Vector3 cp = Vector3Subtract(p, c);
+    float d5 = Vector3DotProduct(ab, cp);
+    float d6 = Vector3DotProduct(ac, cp);
+    if ((d6 >= 0.0f) && (d5 <= d6)) return c;
+
+    float vb = d5*d2 - d1*d6;
+    if ((vb <= 0.0f) && (d2 >= 0.0f) && (d6 <= 0.0f)) return Vector3Add(a, Vector3Scale(ac, d2/(d2 - d6)));
+
+    float va = d3*d6 - d5*d4;
+    if ((va <= 0.0f) && ((d4 - d3) >= 0.0f) && ((d5 - d6) >= 0.0f))
+    {
+        return Vector3Add(b, Vector3Scale(Vector3Subtract(c, b), (d4 - d3)/((d4 - d3) + (d5 - d6))));
+    }
+
+    float denom = 1.0f/(va + vb + vc);
+
+    return Vector3Add(a, Vector3Add(Vector3Scale(ab, vb*denom), Vector3Scale(ac, vc*denom)));
+}
+
+// Check collision between triangle and box, separating axis test (box axes, triangle normal and 9 edges cross products)
+// NOTE: Based on Fast 3D Triangle-Box Overlap Testing (Tomas Akenine-Möller)
+static bool CheckCollisionTriangleBox(Vector3 a, Vector3 b, Vector3 c, BoundingBox box)
+{
+    Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    Vector3 extents = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+
+    // Triangle vertices relative to box center
+    Vector3 v[3] = { Vector3Subtract(a, center), Vector3Subtract(b, center), Vector3Subtract(c, center) };
+    Vector3 edges[3] = { Vector3Subtract(v[1], v[0]), Vector3Subtract(v[2], v[1]), Vector3Subtract(v[0], v[2]) };
+    Vector3 axes[13] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, Vector3CrossProduct(edges[0], edges[1]) };
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++) axes[4 + i*3 + j] = Vector3CrossProduct(axes[j], edges[i]);
+    }
+
+    for (int i = 0; i < 13; i++)
+    {
+        float p0 = Vector3DotProduct(v[0], axes[i]);
+        float p1 = Vector3DotProduct(v[1], axes[i]);
+        float p2 = Vector3DotProduct(v[2], axes[i]);
+        float r = extents.x*fabsf(axes[i].x) + extents.y*fabsf(axes[i].y) + extents.z*fabsf(axes[i].z);
+
+        if ((fminf(p0, fminf(p1, p2)) > r) || (fmaxf(p0, fmaxf(p1, p2)) < -r)) return false;
+    }
+
+    return true;
+}
+
+
+// Compute mesh cached bounds (box and sphere) from vertices
+// NOTE: Sphere is centered on bounding box, radius considers farthest vertex
+static void ComputeMeshBounds(Mesh *mesh)
+{
+    mesh->boundsMin = (Vector3){ 0 };
+    mesh->boundsMax = (Vector3){ 0 };
+    mesh->boundsRadius = 0.0f;
+
+    if (mesh->vboId != NULL) SetMeshBoundsStale(mesh->vboId[0], false);
+
+    if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0)) return;
+
+    Vector3 minVertex = { mesh->vertices[0], mesh->vertices[1], mesh->vertices[2] };
+    Vector3 maxVertex = minVertex;
+
+    for (int i = 1; i < mesh->vertexCount; i++)
+    {
+        Vector3 vertex = { mesh->vertices[i*3], mesh->vertices[i*3 + 1], mesh->vertices[i*3 + 2] };
+        minVertex = Vector3Min(minVertex, vertex);
+        maxVertex = Vector3Max(maxVertex, vertex);
+    }
+
+    Vector3 center = Vector3Scale(Vector3Add(minVertex, maxVertex), 0.5f);
+    float radiusSqr = 0.0f;
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        Vector3 vertex = { mesh->vertices[i*3], mesh->vertices[i*3 + 1], mesh->vertices[i*3 + 2] };
+        float distanceSqr = Vector3LengthSqr(Vector3Subtract(vertex, center));
+        if (distanceSqr > radiusSqr) radiusSqr = distanceSqr;
+    }
+
+    mesh->boundsMin = minVertex;
+    mesh->boundsMax = maxVertex;
+
+    // NOTE: Small epsilon keeps single point meshes bounds flagged as computed
+    mesh->boundsRadius = sqrtf(radiusSqr) + EPSILON;
+}
+
+// Check if transformed mesh cached bounds are inside frustum
+// NOTE: Bounding sphere is scaled by transform largest axis scale, meshes without cached bounds are always inside
+static bool CheckFrustumMesh(Frustum frustum, Mesh mesh, Matrix transform)
+{
+    if (!IsMeshBoundsCached(mesh)) return true;
+
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(mesh.boundsMin, mesh.boundsMax), 0.5f), transform);
+
+    float scaleX = transform.m0*transform.m0 + transform.m1*transform.m1 + transform.m2*transform.m2;
+    float scaleY = transform.m4*transform.m4 + transform.m5*transform.m5 + transform.m6*transform.m6;
+    float scaleZ = transform.m8*transform.m8 + transform.m9*transform.m9 + transform.m10*transform.m10;
+    float scaleSqr = fmaxf(scaleX, fmaxf(scaleY, scaleZ));
+
+    return CheckFrustumSphere(frustum, center, mesh.boundsRadius*sqrtf(scaleSqr));
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate indexed mesh from parametric surfaces, vertices are shared inside each surface grid
+// NOTE: Meshes with more vertices than 16 bit indices support are generated unrolled (no indices)
+static Mesh GenMeshSurfaces(const MeshSurface *surfaces, int count)
+{
+    Mesh mesh = { 0 };
+
+#if defined(SUPPORT_MESH_GEN_WELDING)
+    bool weld = true;
+#else
+    bool weld = false;
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        int vertexCount = 0;
+        int triangleCount = 0;
+
+        GetMeshSurfaceSize(surfaces[i], weld, &vertexCount, &triangleCount);
+
+        mesh.vertexCount += vertexCount;
+        mesh.triangleCount += triangleCount;
+    }
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    unsigned int *indices = (unsigned int *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned int));
+
+    int vertexOffset = 0;
+    int indexOffset = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        MeshSurface surface = surfaces[i];
+        int vertexCount = 0;
+        int triangleCount = 0;
+
+        GetMeshSurfaceSize(surface, weld, &vertexCount, &triangleCount);
+
+        // Surface grid vertices, welded points are written once per grid point (same position)
+        for (int stack = 0; stack <= surface.stacks; stack++)
+        {
+            bool pole = (((stack == 0) && (surface.flags & MESH_SURFACE_POLE_FIRST)) ||
+                         ((stack == surface.stacks) && (surface.flags & MESH_SURFACE_POLE_LAST)));
+
+            for (int slice = 0; slice <= surface.slices; slice++)
+            {
+                int v = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack, slice);
+                Vector3 position = { 0 };
+                Vector3 normal = { 0 };
+                Vector2 texcoord = { 0 };
+
+                surface.func((float)stack/surface.stacks, (float)slice/surface.slices, surface.params, &position, &normal, &texcoord);
+
+                // NOTE: Welded pole normal is the average of the row normals (i.e. cone apex)
+                if (weld && pole && (slice > 0))
+                {
+                    if ((slice == surface.slices) && (surface.flags & MESH_SURFACE_CLOSED_V)) continue;
+
+                    normal.x += mesh.normals[v*3];
+                    normal.y += mesh.normals[v*3 + 1];
+                    normal.z += mesh.normals[v*3 + 2];
+                }
+
+                mesh.vertices[v*3] = position.x;
+                mesh.vertices[v*3 + 1] = position.y;
+                mesh.vertices[v*3 + 2] = position.z;
+                mesh.normals[v*3] = normal.x;
+                mesh.normals[v*3 + 1] = normal.y;
+                mesh.normals[v*3 + 2] = normal.z;
+                mesh.texcoords[v*2] = texcoord.x;
+                mesh.texcoords[v*2 + 1] = texcoord.y;
+            }
+
+            if (weld && pole)
+            {
+                int v = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack, 0);
+                Vector3 normal = Vector3Normalize((Vector3){ mesh.normals[v*3], mesh.normals[v*3 + 1], mesh.normals[v*3 + 2] });
+
+                mesh.normals[v*3] = normal.x;
+                mesh.normals[v*3 + 1] = normal.y;
+                mesh.normals[v*3 + 2] = normal.z;
+            }
+        }
+
+        // Surface grid triangles, two per quad, pole rows quads are a single triangle
+        for (int stack = 0; stack < surface.stacks; stack++)
+        {
+            for (int slice = 0; slice < surface.slices; slice++)
+            {
+                int v00 = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack, slice);
+                int v01 = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack, slice + 1);
+                int v10 = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack + 1, slice);
+                int v11 = vertexOffset + GetMeshSurfaceVertex(surface, weld, stack + 1, slice + 1);
+
+                if ((stack > 0) || !(surface.flags & MESH_SURFACE_POLE_FIRST))
+                {
+                    indices[indexOffset++] = v10;
+                    indices[indexOffset++] = v01;
+                    indices[indexOffset++] = v00;
+                }
+
+                if ((stack < (surface.stacks - 1)) || !(surface.flags & MESH_SURFACE_POLE_LAST))
+                {
+                    indices[indexOffset++] = v10;
+                    indices[indexOffset++] = v11;
+                    indices[indexOffset++] = v01;
+                }
+            }
+        }
+
+        vertexOffset += vertexCount;
+    }
+
+    if (mesh.vertexCount <= 65536)
+    {
+        mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+        for (int i = 0; i < mesh.triangleCount*3; i++) mesh.indices[i] = (unsigned short)indices[i];
+    }
+    else
+    {
+        // Vertices do not fit 16 bit indices, vertex data is unrolled
+        float *vertices = (float *)RL_MALLOC(mesh.triangleCount*3*3*sizeof(float));
+        float *normals = (float *)RL_MALLOC(mesh.triangleCount*3*3*sizeof(float));
+        float *texcoords = (float *)RL_MALLOC(mesh.triangleCount*3*2*sizeof(float));
+
+        for (int i = 0; i < mesh.triangleCount*3; i++)
+        {
+            memcpy(vertices + i*3, mesh.vertices + indices[i]*3, 3*sizeof(float));
+            memcpy(normals + i*3, mesh.normals + indices[i]*3, 3*sizeof(float));
+            memcpy(texcoords + i*2, mesh.texcoords + indices[i]*2, 2*sizeof(float));
+        }
+
+        RL_FREE(mesh.vertices);
+        RL_FREE(mesh.normals);
+        RL_FREE(mesh.texcoords);
+
+        mesh.vertices = vertices;
+        mesh.normals = normals;
+        mesh.texcoords = texcoords;
+        mesh.vertexCount = mesh.triangleCount*3;
+    }
+
+    RL_FREE(indices);
+
+    return mesh;
+}
+
+// Get parametric surface vertices and triangles count
+static void GetMeshSurfaceSize(MeshSurface surface, bool weld, int *vertexCount, int *triangleCount)
+{
+    *vertexCount = (surface.stacks + 1)*(surface.slices + 1);
+    *triangleCount = surface.stacks*surface.slices*2;
+
+    if (surface.flags & MESH_SURFACE_POLE_FIRST) *triangleCount -= surface.slices;
+    if (surface.flags & MESH_SURFACE_POLE_LAST) *triangleCount -= surface.slices;
+
+    if (weld)
+    {
+        int rows = surface.stacks + ((surface.flags & MESH_SURFACE_CLOSED_U)? 0 : 1);
+        int columns = surface.slices + ((surface.flags & MESH_SURFACE_CLOSED_V)? 0 : 1);
+
+        *vertexCount = rows*columns;
+        if (surface.flags & MESH_SURFACE_POLE_FIRST) *vertexCount -= (columns - 1);
+        if (surface.flags & MESH_SURFACE_POLE_LAST) *vertexCount -= (columns - 1);
+    }
+}
+
+// Get parametric surface grid point vertex index, welded grid points share vertices (closed surfaces seams, poles)
+static int GetMeshSurfaceVertex(MeshSurface surface, bool weld, int stack, int slice)
+{
+    if (!weld) return stack*(surface.slices + 1) + slice;
+
+    int columns = surface.slices + ((surface.flags & MESH_SURFACE_CLOSED_V)? 0 : 1);
+    int first = (surface.flags & MESH_SURFACE_POLE_FIRST)? 1 : columns;     // First row vertices
+
+    if ((stack == surface.stacks) && (surface.flags & MESH_SURFACE_CLOSED_U)) stack = 0;
+    if (slice == columns) slice = 0;
+
+    if (stack == 0) return (surface.flags & MESH_SURFACE_POLE_FIRST)? 0 : slice;
+    if ((stack == surface.stacks) && (surface.flags & MESH_SURFACE_POLE_LAST)) return first + (stack - 1)*columns;
+
+    return first + (stack - 1)*columns + slice;
+}
+
+// Sphere surface, pole along Z axis (params: radius, theta range)
+static void SurfaceSphere(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    float phi = u*PI;
+    float theta = v*params[1];
+
+    *normal = (Vector3){ cosf(theta)*sinf(phi), sinf(theta)*sinf(phi), cosf(phi) };
+    *position = Vector3Scale(*normal, params[0]);
+    *texcoord = (Vector2){ u, v };
+}
+
+// Cylinder/cone side surface, base on Y = 0 (params: bottom radius, top radius, height)
+static void SurfaceCylinder(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    float theta = v*2.0f*PI;
+    float radius = params[0] + (params[1] - params[0])*u;
+
+    *position = (Vector3){ cosf(theta)*radius, u*params[2], sinf(theta)*radius };
+    *normal = Vector3Normalize((Vector3){ cosf(theta)*params[2], params[0] - params[1], sinf(theta)*params[2] });
+    *texcoord = (Vector2){ u, v };
+}
+
+// Disk surface on XZ plane, planar texture coordinates (params: radius, height, facing: 1 up, -1 down)
+static void SurfaceDisk(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    float theta = v*2.0f*PI*params[2];
+
+    *position = (Vector3){ sinf(theta)*u*params[0], params[1], cosf(theta)*u*params[0] };
+    *normal = (Vector3){ 0.0f, params[2], 0.0f };
+    *texcoord = (Vector2){ 0.5f + sinf(theta)*u*0.5f, 0.5f + cosf(theta)*u*0.5f };
+}
+
+// Plane surface on XZ plane, centered (params: width, length)
+static void SurfacePlane(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    *position = (Vector3){ (v - 0.5f)*params[0], 0.0f, (u - 0.5f)*params[1] };
+    *normal = (Vector3){ 0.0f, 1.0f, 0.0f };
+    *texcoord = (Vector2){ v, u };
+}
+
+// Torus surface, centered on XY plane (params: tube radius, scale)
+static void SurfaceTorus(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    float theta = u*2.0f*PI;
+    float phi = v*2.0f*PI;
+    float beta = 1.0f + params[0]*cosf(phi);
+
+    *position = (Vector3){ cosf(theta)*beta*params[1], sinf(theta)*beta*params[1], sinf(phi)*params[0]*params[1] };
+    *normal = (Vector3){ cosf(theta)*cosf(phi), sinf(theta)*cosf(phi), sinf(phi) };
+    *texcoord = (Vector2){ u, v };
+}
+
+// Trefoil knot surface, tube around knot curve (params: tube radius, scale)
+static void SurfaceKnot(float u, float v, const float *params, Vector3 *position, Vector3 *normal, Vector2 *texcoord)
+{
+    const float a = 0.5f;
+    const float b = 0.3f;
+    const float c = 0.5f;
+    float t = (1.0f - u)*4.0f*PI;
+    float phi = v*2.0f*PI;
+    float r = a + b*cosf(1.5f*t);
+
+    // Knot curve point and tangent, tube frame is built from tangent
+    Vector3 point = { r*cosf(t), r*sinf(t), c*sinf(1.5f*t) };
+    Vector3 tangent = Vector3Normalize((Vector3){ -1.5f*b*sinf(1.5f*t)*cosf(t) - r*sinf(t), -1.5f*b*sinf(1.5f*t)*sinf(t) + r*cosf(t), 1.5f*c*cosf(1.5f*t) });
+    Vector3 side = Vector3Normalize((Vector3){ tangent.y, -tangent.x, 0.0f });
+    Vector3 up = Vector3CrossProduct(tangent, side);
+
+    *normal = Vector3Add(Vector3Scale(side, cosf(phi)), Vector3Scale(up, sinf(phi)));
+    *position = Vector3Scale(Vector3Add(point, Vector3Scale(*normal, params[0]*0.1f)), params[1]);
+    *texcoord = (Vector2){ u, v };
+}
+#endif  // SUPPORT_MESH_GENERATION
+
+// Simplify mesh by edge collapse (CPU only, no upload)
+// NOTE: Vertices sharing position are welded into nodes, edges are collapsed into one of their nodes
+// (half-edge collapse, no new vertices) ordered by quadric error, open borders are kept
+static Mesh SimplifyMesh(Mesh mesh, int triangleCount)
+{
+    Mesh simplified = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.vertexCount < 3) || (mesh.triangleCount <= 0)) return simplified;
+    if (triangleCount < 1) triangleCount = 1;
+
+    // Get triangles corners vertices (indexed or not)
+    int *corners = (int *)RL_MALLOC(mesh.triangleCount*3*sizeof(int));
+    for (int i = 0; i < mesh.triangleCount*3; i++) corners[i] = (mesh.indices != NULL)? mesh.indices[i] : i;
+
+    // Weld vertices by position, sorting them
+    SimplifyVertex *sorted = (SimplifyVertex *)RL_MALLOC(mesh.vertexCount*sizeof(SimplifyVertex));
+    for (int i = 0; i < mesh.vertexCount; i++) sorted[i] = (SimplifyVertex){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2], i };
+    qsort(sorted, mesh.vertexCount, sizeof(SimplifyVertex), CompareSimplifyVertices);
+
+    int *vertexNode = (int *)RL_MALLOC(mesh.vertexCount*sizeof(int));
+    SimplifyNode *nodes = (SimplifyNode *)RL_CALLOC(mesh.vertexCount, sizeof(SimplifyNode));
+    int nodeCount = 0;
+
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        if ((i == 0) || (sorted[i].x != sorted[i - 1].x) || (sorted[i].y != sorted[i - 1].y) || (sorted[i].z != sorted[i - 1].z))
+        {
+            nodes[nodeCount].vertex = sorted[i].index;
+            nodeCount++;
+        }
+
+        vertexNode[sorted[i].index] = nodeCount - 1;
+    }
+
+    RL_FREE(sorted);
+
+    // Accumulate triangles planes quadrics (area weighted) and nodes triangles lists
+    bool *removed = (bool *)RL_CALLOC(mesh.triangleCount, sizeof(bool));
+    int aliveCount = mesh.triangleCount;
+
+    for (int t = 0; t < mesh.triangleCount; t++)
+    {
+        int n0 = vertexNode[corners[t*3]];
+        int n1 = vertexNode[corners[t*3 + 1]];
+        int n2 = vertexNode[corners[t*3 + 2]];
+
+        if ((n0 == n1) || (n1 == n2) || (n0 == n2))
+        {
+            removed[t] = true;
+            aliveCount--;
+            continue;
+        }
+
+        Vector3 p0 = { mesh.vertices[corners[t*3]*3], mesh.vertices[corners[t*3]*3 + 1], mesh.vertices[corners[t*3]*3 + 2] };
+        Vector3 p1 = { mesh.vertices[corners[t*3 + 1]*3], mesh.vertices[corners[t*3 + 1]*3 + 1], mesh.vertices[corners[t*3 + 1]*3 + 2] };
+        Vector3 p2 = { mesh.vertices[corners[t*3 + 2]*3], mesh.vertices[corners[t*3 + 2]*3 + 1], mesh.vertices[corners[t*3 + 2]*3 + 2] };
+
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+        float length = Vector3Length(normal);
+
+        double plane[4] = { 0 };
+        if (length > 0.0f)
+        {
+            plane[0] = normal.x/length;
+            plane[1] = normal.y/length;
+            plane[2] = normal.z/length;
+            plane[3] = -(plane[0]*p0.x + plane[1]*p0.y + plane[2]*p0.z);
+        }
+
+        double area = 0.5*length;
+        int triangleNodes[3] = { n0, n1, n2 };
+
+        for (int k = 0; k < 3; k++)
+        {
+            SimplifyNode *node = &nodes[triangleNodes[k]];
+
+            for (int r = 0, q = 0; r < 4; r++)
+            {
+                for (int c = r; c < 4; c++, q++) node->quadric[q] += area*plane[r]*plane[c];
+            }
+
+            if (node->triangleCount == node->triangleCapacity)
+            {
+                node->triangleCapacity = (node->triangleCapacity == 0)? 8 : node->triangleCapacity*2;
+                node->triangles = (int *)RL_REALLOC(node->triangles, node->triangleCapacity*sizeof(int));
+            }
+
+            node->triangles[node->triangleCount++] = t;
+        }
+    }
+
+    // Flag border nodes: an edge used by a single triangle is an open border
+    for (int n = 0; n < nodeCount; n++)
+    {
+        SimplifyNode *node = &nodes[n];
+
+        for (int i = 0; (i < node->triangleCount) && !node->border; i++)
+        {
+            int t = node->triangles[i];
+
+            for (int k = 0; k < 3; k++)
+            {
+                int other = vertexNode[corners[t*3 + k]];
+                if (other == n) continue;
+
+                int shared = 0;
+                for (int j = 0; j < node->triangleCount; j++)
+                {
+                    int s = node->triangles[j];
+                    if ((vertexNode[corners[s*3]] == other) || (vertexNode[corners[s*3 + 1]] == other) || (vertexNode[corners[s*3 + 2]] == other)) shared++;
+                }
+
+                if (shared == 1) node->border = true;
+            }
+        }
+    }
+
+    // Collapse cheapest edges, pass by pass, until triangles target is reached
+    // NOTE: Nodes modified on a pass are not collapsed again until next pass (their errors are outdated)
+    SimplifyEdge *edges = (SimplifyEdge *)RL_MALLOC(mesh.triangleCount*3*sizeof(SimplifyEdge));
+
+    for (int pass = 1; aliveCount > triangleCount; pass++)
+    {
+        int edgeCount = 0;
+
+        for (int t = 0; t < mesh.triangleCount; t++)
+        {
+            if (removed[t]) continue;
+
+            for (int k = 0; k < 3; k++)
+            {
+                int a = vertexNode[corners[t*3 + k]];
+                int b = vertexNode[corners[t*3 + (k + 1)%3]];
+                if (a > b) continue;    // Both triangles sharing the edge add it, keep one
+
+                double error[2] = { DBL_MAX, DBL_MAX };
+                int ends[2] = { a, b };
+
+                for (int e = 0; e < 2; e++)
+                {
+                    SimplifyNode *from = &nodes[ends[e]];
+                    SimplifyNode *to = &nodes[ends[1 - e]];
+                    if (from->border) continue;
+
+                    double q[10] = { 0 };
+                    for (int i = 0; i < 10; i++) q[i] = from->quadric[i] + to->quadric[i];
+
+                    double x = mesh.vertices[to->vertex*3];
+                    double y = mesh.vertices[to->vertex*3 + 1];
+                    double z = mesh.vertices[to->vertex*3 + 2];
+
+                    error[e] = q[0]*x*x + 2*q[1]*x*y + 2*q[2]*x*z + 2*q[3]*x + q[4]*y*y + 2*q[5]*y*z + 2*q[6]*y + q[7]*z*z + 2*q[8]*z + q[9];
+                }
+
+                if ((error[0] == DBL_MAX) && (error[1] == DBL_MAX)) continue;
+
+                if (error[0] <= error[1]) edges[edgeCount] = (SimplifyEdge){ a, b, error[0] };
+                else edges[edgeCount] = (SimplifyEdge){ b, a, error[1] };
+                edgeCount++;
+            }
+        }
+
+        qsort(edges, edgeCount, sizeof(SimplifyEdge), CompareSimplifyEdges);
+
+        int collapsed = 0;
+
+        for (int e = 0; (e < edgeCount) && (aliveCount > triangleCount); e++)
+        {
+            SimplifyNode *from = &nodes[edges[e].from];
+            SimplifyNode *to = &nodes[edges[e].to];
+            if ((from->pass == pass) || (to->pass == pass)) continue;
+
+            Vector3 target = { mesh.vertices[to->vertex*3], mesh.vertices[to->vertex*3 + 1], mesh.vertices[to->vertex*3 + 2] };
+
+            // Reject collapse if some remaining triangle around removed node flips
+            bool flipped = false;
+
+            for (int i = 0; (i < from->triangleCount) && !flipped; i++)
+            {
+                int t = from->triangles[i];
+                if (removed[t]) continue;
+
+                Vector3 p[3] = { 0 };
+                Vector3 moved[3] = { 0 };
+                bool shared = false;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int v = corners[t*3 + k];
+                    p[k] = (Vector3){ mesh.vertices[v*3], mesh.vertices[v*3 + 1], mesh.vertices[v*3 + 2] };
+                    moved[k] = (vertexNode[v] == edges[e].from)? target : p[k];
+                    if (vertexNode[v] == edges[e].to) shared = true;
+                }
+
+                if (shared) continue;   // Triangle removed by the collapse
+
+                Vector3 before = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+                Vector3 after = Vector3CrossProduct(Vector3Subtract(moved[1], moved[0]), Vector3Subtract(moved[2], moved[0]));
+                if (Vector3DotProduct(before, after) <= 0.0f) flipped = true;
+            }
+
+            if (flipped) continue;
+
+            // Remove triangles sharing the edge, keeping their corners vertices pairs to preserve attributes seams
+            int pairs[8][2] = { 0 };
+            int pairCount = 0;
+
+            for (int i = 0; i < from->triangleCount; i++)
+            {
+                int t = from->triangles[i];
+                if (removed[t]) continue;
+
+                int fromVertex = -1;
+                int toVertex = -1;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int v = corners[t*3 + k];
+                    if (vertexNode[v] == edges[e].from) fromVertex = v;
+                    else if (vertexNode[v] == edges[e].to) toVertex = v;
+                }
+
+                if (toVertex == -1) continue;
+
+                removed[t] = true;
+                aliveCount--;
+
+                if (pairCount < 8)
+                {
+                    pairs[pairCount][0] = fromVertex;
+                    pairs[pairCount][1] = toVertex;
+                    pairCount++;
+                }
+            }
+
+            // Move remaining triangles to kept node
+            for (int i = 0; i < from->triangleCount; i++)
+            {
+                int t = from->triangles[i];
+                if (removed[t]) continue;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int v = corners[t*3 + k];
+
+                    if (vertexNode[v] == edges[e].from)
+                    {
+                        int replacement = (pairCount > 0)? pairs[0][1] : to->vertex;
+                        for (int j = 0; j < pairCount; j++) if (pairs[j][0] == v) replacement = pairs[j][1];
+
+                        corners[t*3 + k] = replacement;
+                    }
+                    else nodes[vertexNode[v]].pass = pass;
+                }
+
+                if (to->triangleCount == to->triangleCapacity)
+                {
+                    to->triangleCapacity = (to->triangleCapacity == 0)? 8 : to->triangleCapacity*2;
+                    to->triangles = (int *)RL_REALLOC(to->triangles, to->triangleCapacity*sizeof(int));
+                }
+
+                to->triangles[to->triangleCount++] = t;
+            }
+
+            // Compact kept node triangles list
+            int count = 0;
+            for (int i = 0; i < to->triangleCount; i++) if (!removed[to->triangles[i]]) to->triangles[count++] = to->triangles[i];
+            to->triangleCount = count;
+
+            for (int i = 0; i < 10; i++) to->quadric[i] += from->quadric[i];
+
+            from->triangleCount = 0;
+            from->pass = pass;
+            to->pass = pass;
+            collapsed++;
+        }
+
+        if (collapsed == 0) break;
+    }
+
+    // Compact used vertices, output is not indexed if it can not be addressed by 16bit indices
+    int *vertexRemap = (int *)RL_MALLOC(mesh.vertexCount*sizeof(int));
+    for (int i = 0; i < mesh.vertexCount; i++) vertexRemap[i] = -1;
+
+    int *order = (int *)RL_MALLOC(aliveCount*3*sizeof(int));
+    int usedCount = 0;
+
+    for (int t = 0; t < mesh.triangleCount; t++)
+    {
+        if (removed[t]) continue;
+        for (int k = 0; k < 3; k++) if (vertexRemap[corners[t*3 + k]] == -1) vertexRemap[corners[t*3 + k]] = usedCount++;
+    }
+
+    bool indexed = (usedCount <= 65535);
+
+    simplified.triangleCount = aliveCount;
+    simplified.vertexCount = indexed? usedCount : aliveCount*3;
+
+    if (indexed)
+    {
+        simplified.indices = (unsigned short *)RL_MALLOC(aliveCount*3*sizeof(unsigned short));
+        for (int i = 0; i < mesh.vertexCount; i++) if (vertexRemap[i] != -1) order[vertexRemap[i]] = i;
+    }
+
+    for (int t = 0, i = 0; t < mesh.triangleCount; t++)
+    {
+        if (removed[t]) continue;
+
+        for (int k = 0; k < 3; k++, i++)
+        {
+            if (indexed) simplified.indices[i] = (unsigned short)vertexRemap[corners[t*3 + k]];
+            else order[i] = corners[t*3 + k];
+        }
+    }
+
+    simplified.vertices = (float *)RL_MALLOC(simplified.vertexCount*3*sizeof(float));
+    if (mesh.texcoords != NULL) simplified.texcoords = (float *)RL_MALLOC(simplified.vertexCount*2*sizeof(float));
+    if (mesh.texcoords2 != NULL) simplified.texcoords2 = (float *)RL_MALLOC(simplified.vertexCount*2*sizeof(float));
+    if (mesh.normals != NULL) simplified.normals = (float *)RL_MALLOC(simplified.vertexCount*3*sizeof(float));
+    if (mesh.tangents != NULL) simplified.tangents = (float *)RL_MALLOC(simplified.vertexCount*4*sizeof(float));
+    if (mesh.colors != NULL) simplified.colors = (unsigned char *)RL_MALLOC(simplified.vertexCount*4*sizeof(unsigned char));
+
+    for (int i = 0; i < simplified.vertexCount; i++)
+    {
+        int v = order[i];
+
+        memcpy(simplified.vertices + i*3, mesh.vertices + v*3, 3*sizeof(float));
+        if (mesh.texcoords != NULL) memcpy(simplified.texcoords + i*2, mesh.texcoords + v*2, 2*sizeof(float));
+        if (mesh.texcoords2 != NULL) memcpy(simplified.texcoords2 + i*2, mesh.texcoords2 + v*2, 2*sizeof(float));
+        if (mesh.normals != NULL) memcpy(simplified.normals + i*3, mesh.normals + v*3, 3*sizeof(float));
+        if (mesh.tangents != NULL) memcpy(simplified.tangents + i*4, mesh.tangents + v*4, 4*sizeof(float));
+        if (mesh.colors != NULL) memcpy(simplified.colors + i*4, mesh.colors + v*4, 4*sizeof(unsigned char));
+    }
+
+    for (int i = 0; i < mesh.vertexCount; i++) RL_FREE(nodes[i].triangles);
+    RL_FREE(nodes);
+    RL_FREE(vertexNode);
+    RL_FREE(vertexRemap);
+    RL_FREE(order);
+    RL_FREE(edges);
+    RL_FREE(removed);
+    RL_FREE(corners);
+
+    return simplified;
+}
+
+// Compare simplification vertices positions
+static int CompareSimplifyVertices(const void *a, const void *b)
+{
+    const SimplifyVertex *va = (const SimplifyVertex *)a;
+    const SimplifyVertex *vb = (const SimplifyVertex *)b;
+
+    if (va->x != vb->x) return (va->x < vb->x)? -1 : 1;
+    if (va->y != vb->y) return (va->y < vb->y)? -1 : 1;
+    if (va->z != vb->z) return (va->z < vb->z)? -1 : 1;
+
+    return va->index - vb->index;
+}
+
+// Compare simplification edges collapse errors
+static int CompareSimplifyEdges(const void *a, const void *b)
+{
+    double ea = ((const SimplifyEdge *)a)->error;
+    double eb = ((const SimplifyEdge *)b)->error;
+
+    return (ea < eb)? -1 : ((ea > eb)? 1 : 0);
+}
+
+// Generate model levels of detail meshes (CPU only, no upload)
+// NOTE: Every level is simplified from previous one, a level not reducing triangles stops mesh chain
+// (drawn with closest generated level), switch screen sizes keep drawn triangles density
+static void SimplifyModelLods(Model *model, int levels, float reduction)
+{
+    UnloadModelLods(model);
+
+    if ((levels <= 0) || (reduction <= 0.0f) || (reduction >= 1.0f) || (model->meshCount == 0)) return;
+
+    model->lodMeshes = (Mesh *)RL_CALLOC(levels*model->meshCount, sizeof(Mesh));
+    model->lodScreenSizes = (float *)RL_CALLOC(levels, sizeof(float));
+
+    bool generated = false;
+
+    for (int i = 0; i < model->meshCount; i++)
+    {
+        Mesh source = model->meshes[i];
+        if ((source.triangleCount < MODEL_LOD_MIN_TRIANGLES) || (source.boneWeights != NULL) || (source.morphTargetCount > 0)) continue;
+
+        for (int n = 0; n < levels; n++)
+        {
+            Mesh lod = SimplifyMesh(source, (int)(source.triangleCount*reduction));
+
+            if ((lod.triangleCount == 0) || (lod.triangleCount > (int)(source.triangleCount*(1.0f + reduction)*0.5f)))
+            {
+                UnloadMesh(lod);
+                break;
+            }
+
+            model->lodMeshes[n*model->meshCount + i] = lod;
+            source = lod;
+            generated = true;
+        }
+    }
+
+    if (!generated)
+    {
+        UnloadModelLods(model);
+        return;
+    }
+
+    model->lodCount = levels;
+    for (int n = 0; n < levels; n++) model->lodScreenSizes[n] = MODEL_LOD_SCREEN_SIZE*powf(sqrtf(reduction), (float)n);
+
+    TRACELOG(LOG_INFO, "MODEL: Generated %i levels of detail", levels);
+}
+
+// Unload model levels of detail meshes and arrays
+static void UnloadModelLods(Model *model)
+{
+    if (model->lodMeshes != NULL)
+    {
+        for (int i = 0; i < model->lodCount*model->meshCount; i++)
+        {
+            if (model->lodMeshes[i].vertexCount > 0) UnloadMesh(model->lodMeshes[i]);
+        }
+    }
+
+    RL_FREE(model->lodMeshes);
+    RL_FREE(model->lodScreenSizes);
+
+    model->lodCount = 0;
+    model->lodMeshes = NULL;
+    model->lodScreenSizes = NULL;
+}
+
+// Get mesh per-vertex attributes arrays available, returns arrays count
+static int GetMeshAttributeStreams(Mesh *mesh, MeshAttributeStream *streams)
+{
+    MeshAttributeStream available[MAX_MESH_ATTRIBUTE_STREAMS] = {
+        { (unsigned char **)&mesh->vertices, 3*sizeof(float) },
+        { (unsigned char **)&mesh->texcoords, 2*sizeof(float) },
+        { (unsigned char **)&mesh->texcoords2, 2*sizeof(float) },
+        { (unsigned char **)&mesh->normals, 3*sizeof(float) },
+        { (unsigned char **)&mesh->tangents, 4*sizeof(float) },
+        { (unsigned char **)&mesh->colors, 4*sizeof(unsigned char) },
+        { (unsigned char **)&mesh->animVertices, 3*sizeof(float) },
+        { (unsigned char **)&mesh->animNormals, 3*sizeof(float) },
+        { (unsigned char **)&mesh->boneIds, 4*sizeof(unsigned char) },
+        { (unsigned char **)&mesh->boneWeights, 4*sizeof(float) },
+        { (unsigned char **)&mesh->morphVertices, mesh->morphTargetCount*3*sizeof(float) },
+        { (unsigned char **)&mesh->morphNormals, mesh->morphTargetCount*3*sizeof(float) }
+    };
+
+    int count = 0;
+
+    for (int i = 0; i < MAX_MESH_ATTRIBUTE_STREAMS; i++)
+    {
+        if (*available[i].data != NULL) streams[count++] = available[i];
+    }
+
+    return count;
+}
+
+// Weld identical vertices (all attributes compared), remap table is filled with unique vertex for every vertex
+// NOTE: Vertices are hashed (FNV-1a) into an open addressing table, unique vertices keep first use order
+static int WeldMeshVertices(Mesh *mesh, unsigned int *remap)
+{
+    MeshAttributeStream streams[MAX_MESH_ATTRIBUTE_STREAMS] = { 0 };
+    int streamCount = GetMeshAttributeStreams(mesh, streams);
+
+    int tableSize = 1;
+    while (tableSize < mesh->vertexCount*2) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    int uniqueCount = 0;
+
+    for (int v = 0; v < mesh->vertexCount; v++)
+    {
+        unsigned int hash = 2166136261u;
+
+        for (int s = 0; s < streamCount; s++)
+        {
+            const unsigned char *data = *streams[s].data + v*streams[s].size;
+            for (int b = 0; b < streams[s].size; b++) hash = (hash ^ data[b])*16777619u;
+        }
+
+        unsigned int slot = hash & (tableSize - 1);
+
+        while (table[slot] != -1)
+        {
+            bool equal = true;
+
+            for (int s = 0; (s < streamCount) && equal; s++)
+            {
+                equal = (memcmp(*streams[s].data + table[slot]*streams[s].size, *streams[s].data + v*streams[s].size, streams[s].size) == 0);
+            }
+
+            if (equal) break;
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (table[slot] == -1)
+        {
+            table[slot] = v;
+            remap[v] = uniqueCount++;
+        }
+        else remap[v] = remap[table[slot]];
+    }
+
+    RL_FREE(table);
+
+    return uniqueCount;
+}
+
+// Reorder mesh vertices attributes with remap table (new vertex index for every vertex, ~0 if not used)
+static void RemapMeshVertices(Mesh *mesh, const unsigned int *remap, int vertexCount)
+{
+    MeshAttributeStream streams[MAX_MESH_ATTRIBUTE_STREAMS] = { 0 };
+    int streamCount = GetMeshAttributeStreams(mesh, streams);
+
+    for (int s = 0; s < streamCount; s++)
+    {
+        int size = streams[s].size;
+        unsigned char *data = (unsigned char *)RL_MALLOC(vertexCount*size);
+
+        for (int v = 0; v < mesh->vertexCount; v++)
+        {
+            if (remap[v] != 0xffffffff) memcpy(data + remap[v]*size, *streams[s].data + v*size, size);
+        }
+
+        RL_FREE(*streams[s].data);
+        *streams[s].data = data;
+    }
+
+    mesh->vertexCount = vertexCount;
+}
+
+// Get vertex score for vertex cache triangles reordering
+// NOTE: Scoring based on Tom Forsyth "Linear-Speed Vertex Cache Optimisation"
+static float GetVertexCacheScore(int cachePosition, int valence)
+{
+    if (valence == 0) return -1.0f;     // No triangles left using vertex
+
+    float score = 0.0f;
+
+    if (cachePosition >= 0)
+    {
+        // Last triangle vertices get a fixed score, to avoid favoring them over next strip-like triangles
+        if (cachePosition < 3) score = 0.75f;
+        else score = powf(1.0f - (float)(cachePosition - 3)/(MESH_OPTIMIZE_CACHE_SIZE - 3), 1.5f);
+    }
+
+    // Boost vertices with few triangles left, lone vertices are finished early
+    score += 2.0f/sqrtf((float)valence);
+
+    return score;
+}
+
+// Reorder triangles for post-transform vertex cache efficiency
+// NOTE: Greedy selection of best scored triangle among cached vertices triangles (Forsyth)
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    int *valence = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *offsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *cachePosition = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScore = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    float *triangleScore = (float *)RL_MALLOC(triangleCount*sizeof(float));
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    // Build vertices triangles adjacency, live triangles are kept first on every vertex list
+    for (int i = 0; i < indexCount; i++) valence[indices[i]]++;
+
+    offsets[0] = 0;
+    for (int v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + valence[v];
+
+    for (int v = 0; v < vertexCount; v++) valence[v] = 0;
+    for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]] + valence[indices[i]]++] = i/3;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePosition[v] = -1;
+        vertexScore[v] = GetVertexCacheScore(-1, valence[v]);
+    }
+
+    for (int t = 0; t < triangleCount; t++) triangleScore[t] = vertexScore[indices[3*t]] + vertexScore[indices[3*t + 1]] + vertexScore[indices[3*t + 2]];
+
+    int cache[MESH_OPTIMIZE_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int best = 0;
+    int cursor = 0;
+
+    for (int n = 0; n < triangleCount; n++)
+    {
+        // No candidate on cache, continue with next triangle on input order
+        if (best < 0)
+        {
+            while (emitted[cursor]) cursor++;
+            best = cursor;
+        }
+
+        const unsigned int *triangle = indices + 3*best;
+        output[3*n] = triangle[0];
+        output[3*n + 1] = triangle[1];
+        output[3*n + 2] = triangle[2];
+        emitted[best] = true;
+
+        // Remove triangle from its vertices live triangles
+        for (int k = 0; k < 3; k++)
+        {
+            int *list = adjacency + offsets[triangle[k]];
+            int count = valence[triangle[k]];
+
+            for (int j = 0; j < count; j++)
+            {
+                if (list[j] == best)
+                {
+                    list[j] = list[count - 1];
+                    valence[triangle[k]]--;
+                    break;
+                }
+            }
+        }
+
+        // Move triangle vertices to cache front, vertices pushed out of cache size are evicted
+        int updated[MESH_OPTIMIZE_CACHE_SIZE + 3] = { 0 };
+        int updatedCount = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            bool found = false;
+            for (int j = 0; j < updatedCount; j++) if (updated[j] == (int)triangle[k]) found = true;
+            if (!found) updated[updatedCount++] = triangle[k];
+        }
+
+        for (int j = 0; j < cacheCount; j++)
+        {
+            if ((cache[j] != (int)triangle[0]) && (cache[j] != (int)triangle[1]) && (cache[j] != (int)triangle[2])) updated[updatedCount++] = cache[j];
+        }
+
+        for (int j = 0; j < updatedCount; j++)
+        {
+            cachePosition[updated[j]] = (j < MESH_OPTIMIZE_CACHE_SIZE)? j : -1;
+            vertexScore[updated[j]] = GetVertexCacheScore(cachePosition[updated[j]], valence[updated[j]]);
+        }
+
+        cacheCount = (updatedCount < MESH_OPTIMIZE_CACHE_SIZE)? updatedCount : MESH_OPTIMIZE_CACHE_SIZE;
+        memcpy(cache, updated, cacheCount*sizeof(int));
+
+        // Update scores of triangles using updated vertices, best one is next
+        float bestScore = -1.0f;
+        best = -1;
+
+        for (int j = 0; j < updatedCount; j++)
+        {
+            const int *list = adjacency + offsets[updated[j]];
+
+            for (int k = 0; k < valence[updated[j]]; k++)
+            {
+                int t = list[k];
+                triangleScore[t] = vertexScore[indices[3*t]] + vertexScore[indices[3*t + 1]] + vertexScore[indices[3*t + 2]];
+
+                if (triangleScore[t] > bestScore)
+                {
+                    bestScore = triangleScore[t];
+                    best = t;
+                }
+            }
+        }
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned int));
+
+    RL_FREE(valence);
+    RL_FREE(offsets);
+    RL_FREE(adjacency);
+    RL_FREE(cachePosition);
+    RL_FREE(vertexScore);
+    RL_FREE(triangleScore);
+    RL_FREE(emitted);
+    RL_FREE(output);
+}
+
+// Reorder triangles clusters to reduce overdraw, clusters facing outwards from mesh center are drawn first
+// NOTE: Clusters are split where simulated vertex cache restarts (triangle missing all vertices),
+// that way vertex cache order is mostly kept
+static void OptimizeMeshOverdraw(unsigned int *indices, int indexCount, const float *positions, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    OverdrawCluster *clusters = (OverdrawCluster *)RL_MALLOC(triangleCount*sizeof(OverdrawCluster));
+    unsigned int *timestamps = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = MESH_OPTIMIZE_CACHE_SIZE + 1;
+    int clusterCount = 0;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int misses = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = indices[3*t + k];
+            if ((time - timestamps[v]) > MESH_OPTIMIZE_CACHE_SIZE) { timestamps[v] = time++; misses++; }
+        }
+
+        if ((t == 0) || (misses == 3)) clusters[clusterCount++] = (OverdrawCluster){ 0.0f, t, 0 };
+        clusters[clusterCount - 1].count++;
+    }
+
+    RL_FREE(timestamps);
+
+    // Mesh center, average of triangles centers weighted by area
+    Vector3 meshCenter = { 0 };
+    float meshArea = 0.0f;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        Vector3 p0 = *(const Vector3 *)(positions + 3*indices[3*t]);
+        Vector3 p1 = *(const Vector3 *)(positions + 3*indices[3*t + 1]);
+        Vector3 p2 = *(const Vector3 *)(positions + 3*indices[3*t + 2]);
+        float area = Vector3Length(Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0)));
+
+        meshCenter = Vector3Add(meshCenter, Vector3Scale(Vector3Add(Vector3Add(p0, p1), p2), area/3.0f));
+        meshArea += area;
+    }
+
+    if (meshArea > 0.0f) meshCenter = Vector3Scale(meshCenter, 1.0f/meshArea);
+
+    // Cluster sort key: cluster center offset from mesh center projected on cluster average normal
+    for (int c = 0; c < clusterCount; c++)
+    {
+        Vector3 center = { 0 };
+        Vector3 normal = { 0 };
+        float area = 0.0f;
+
+        for (int t = clusters[c].start; t < clusters[c].start + clusters[c].count; t++)
+        {
+            Vector3 p0 = *(const Vector3 *)(positions + 3*indices[3*t]);
+            Vector3 p1 = *(const Vector3 *)(positions + 3*indices[3*t + 1]);
+            Vector3 p2 = *(const Vector3 *)(positions + 3*indices[3*t + 2]);
+            Vector3 cross = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+            float triangleArea = Vector3Length(cross);
+
+            center = Vector3Add(center, Vector3Scale(Vector3Add(Vector3Add(p0, p1), p2), triangleArea/3.0f));
+            normal = Vector3Add(normal, cross);
+            area += triangleArea;
+        }
+
+        if (area > 0.0f) center = Vector3Scale(center, 1.0f/area);
+
+        clusters[c].key = Vector3DotProduct(Vector3Subtract(center, meshCenter), Vector3Normalize(normal));
+    }
+
+    qsort(clusters, clusterCount, sizeof(OverdrawCluster), CompareOverdrawClusters);
+
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    int offset = 0;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        memcpy(output + offset, indices + 3*clusters[c].start, clusters[c].count*3*sizeof(unsigned int));
+        offset += clusters[c].count*3;
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned int));
+
+    RL_FREE(output);
+    RL_FREE(clusters);
+}
+
+// Compare overdraw clusters sort keys (descending, outwards facing clusters first)
+static int CompareOverdrawClusters(const void *a, const void *b)
+{
+    const OverdrawCluster *clusterA = (const OverdrawCluster *)a;
+    const OverdrawCluster *clusterB = (const OverdrawCluster *)b;
+
+    if (clusterA->key > clusterB->key) return -1;
+    if (clusterA->key < clusterB->key) return 1;
+
+    // NOTE: Same key clusters keep original order, qsort() is not stable
+    return clusterA->start - clusterB->start;
+}
+
+// Get vertices remap in first use order (vertex fetch locality), indices are remapped, returns used vertices count
+static int OptimizeMeshVertexFetch(unsigned int *indices, int indexCount, unsigned int *remap, int vertexCount)
+{
+    for (int v = 0; v < vertexCount; v++) remap[v] = 0xffffffff;
+
+    int usedCount = 0;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] == 0xffffffff) remap[indices[i]] = usedCount++;
+        indices[i] = remap[indices[i]];
+    }
+
+    return usedCount;
+}
+
+// Get bounding sphere projected size as screen height fraction (projected diameter over screen height)
+// NOTE: Sphere radius is scaled by modelview largest axis scale, camera inside sphere returns FLT_MAX
+static float GetSphereScreenSize(Vector3 center, float radius, Matrix matModelView, Matrix matProjection)
+{
+    center = Vector3Transform(center, matModelView);
+
+    float scaleX = matModelView.m0*matModelView.m0 + matModelView.m1*matModelView.m1 + matModelView.m2*matModelView.m2;
+    float scaleY = matModelView.m4*matModelView.m4 + matModelView.m5*matModelView.m5 + matModelView.m6*matModelView.m6;
+    float scaleZ = matModelView.m8*matModelView.m8 + matModelView.m9*matModelView.m9 + matModelView.m10*matModelView.m10;
+    radius *= sqrtf(fmaxf(scaleX, fmaxf(scaleY, scaleZ)));
+
+    // Projected radius over screen half height is screen height fraction
+    float screenSize = radius*matProjection.m5;
+
+    if (matProjection.m15 == 0.0f)
+    {
+        // Perspective projection
+        float depth = -center.z;
+        if (depth <= radius) return FLT_MAX;
+
+        screenSize /= depth;
+    }
+
+    return screenSize;
+}
+
+// Get model level of detail for current projection and transform
+// NOTE: Model bounding sphere height is projected using current rlgl modelview and projection matrices
+static int GetModelLod(Model model, Matrix transform)
+{
+    if (model.lodCount == 0) return 0;
+
+    BoundingBox bounds = GetModelBoundingBox(model);
+    Matrix matModelView = MatrixMultiply(MatrixMultiply(transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+
+    // NOTE: Camera inside bounds uses base level
+    float screenSize = GetSphereScreenSize(Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f),
+        0.5f*Vector3Distance(bounds.min, bounds.max), matModelView, rlGetMatrixProjection());
+
+    int lod = 0;
+    while ((lod < model.lodCount) && (screenSize < model.lodScreenSizes[lod])) lod++;
+
+    return lod;
+}
+
+#if defined(SUPPORT_TEXTURE_STREAMING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Set streamed material textures usage from mesh projected size
+// NOTE: Texture is expected to be mapped once over the mesh, meshes without cached bounds require full resolution
+static void SetMeshTexturesUsage(Mesh mesh, Material material, Matrix transform)
+{
+    if (material.maps == NULL) return;
+
+    bool streamed = false;
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) if (IsTextureStreamed(material.maps[i].texture)) { streamed = true; break; }
+
+    if (!streamed) return;
+
+    float screenSize = FLT_MAX;
+
+    if (mesh.boundsRadius > 0.0f)
+    {
+        Matrix matModelView = MatrixMultiply(MatrixMultiply(transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+
+        screenSize = GetSphereScreenSize(Vector3Scale(Vector3Add(mesh.boundsMin, mesh.boundsMax), 0.5f),
+            mesh.boundsRadius, matModelView, rlGetMatrixProjection())*GetScreenHeight();
+    }
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) SetTextureStreamingUsage(material.maps[i].texture, screenSize);
+}
+#endif
+
+// Get model mesh for a level of detail (closest generated level)
+static Mesh GetModelLodMesh(Model model, int mesh, int lod)
+{
+    for (int n = lod; n > 0; n--)
+    {
+        if (model.lodMeshes[(n - 1)*model.meshCount + mesh].vertexCount > 0) return model.lodMeshes[(n - 1)*model.meshCount + mesh];
+    }
+
+    return model.meshes[mesh];
+}
+// Upload model meshes to GPU, default mesh/material if not loaded
+static void UploadModel(Model *model, const char *fileName)
+{
+    // Make sure model transform is set to identity matrix!
+    model->transform = MatrixIdentity();
+
+    if (model->meshCount == 0)
+    {
+        model->meshCount = 1;
+        model->meshes = (Mesh *)RL_CALLOC(model->meshCount, sizeof(Mesh));
+#if defined(SUPPORT_MESH_GENERATION)
+        TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data, default to cube mesh", fileName);
+        model->meshes[0] = GenMeshCube(1.0f, 1.0f, 1.0f);
+#else
+        TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load mesh data", fileName);
+#endif
+    }
+    else
+    {
+        // Upload vertex data to GPU (static mesh)
+        for (int i = 0; i < model->meshCount; i++) UploadMesh(&model->meshes[i], false);
+    }
+
+#if defined(SUPPORT_MODEL_LOD)
+    // Generate levels of detail, async loaded models could have generated them on decode stage
+    if ((model->lodCount == 0) && (model->boneCount == 0)) SimplifyModelLods(model, MODEL_LOD_LEVELS, MODEL_LOD_REDUCTION);
+#endif
+    for (int i = 0; i < model->lodCount*model->meshCount; i++)
+    {
+        if ((model->lodMeshes[i].vertexCount > 0) && (model->lodMeshes[i].vaoId == 0)) UploadMesh(&model->lodMeshes[i], false);
+    }
+
+    if (model->materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load material data, default to white material", fileName);
+
+        model->materialCount = 1;
+        model->materials = (Material *)RL_CALLOC(model->materialCount, sizeof(Material));
+        model->materials[0] = LoadMaterialDefault();
+
+        if (model->meshMaterial == NULL) model->meshMaterial = (int *)RL_CALLOC(model->meshCount, sizeof(int));
+    }
+}
+
+// Load material map texture from image (or queue it for later upload), image is unloaded
+static void LoadModelTexture(Model *model, int material, int map, Image image, ModelTextureQueue *queue)
+{
+    if (image.data == NULL) return;
+
+    if (queue == NULL)
+    {
+        model->materials[material].maps[map].texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+    else
+    {
+        if (queue->count == queue->capacity)
+        {
+            queue->capacity = (queue->capacity == 0)? 8 : queue->capacity*2;
+            queue->uploads = (ModelTextureUpload *)RL_REALLOC(queue->uploads, queue->capacity*sizeof(ModelTextureUpload));
+        }
+
+        queue->uploads[queue->count].material = material;
+        queue->uploads[queue->count].map = map;
+        queue->uploads[queue->count].image = image;
+        queue->count++;
+    }
+}
+
+// Upload queued material textures and release queue
+static void UploadModelTextures(Model *model, ModelTextureQueue *queue)
+{
+    for (int i = 0; i < queue->count; i++)
+    {
+        ModelTextureUpload *upload = &queue->uploads[i];
+
+        if (upload->material < model->materialCount) model->materials[upload->material].maps[upload->map].texture = LoadTextureFromImage(upload->image);
+        UnloadImage(upload->image);
+    }
+
+    RL_FREE(queue->uploads);
+    queue->uploads = NULL;
+    queue->count = 0;
+    queue->capacity = 0;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Model async load decode stage: parse model file (worker thread)
+// NOTE: Never fails, as LoadModel(), default mesh/material are generated on upload stage
+static bool DecodeModelJob(void *data)
+{
+    ModelLoadJob *job = (ModelLoadJob *)data;
+
+    switch (job->format)
+    {
+#if defined(SUPPORT_FILEFORMAT_IQM)
+        case MODEL_ASYNC_IQM: job->model = LoadIQM(job->fileName); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+        case MODEL_ASYNC_GLTF: job->model = LoadGLTF(job->fileName, &job->textures, NULL, NULL); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+        case MODEL_ASYNC_VOX: job->model = LoadVOX(job->fileName); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+        case MODEL_ASYNC_RMDL: job->model = LoadRMDL(job->fileName, &job->textures); break;
+#endif
+        default: break;     // MODEL_ASYNC_OBJ: Model completely loaded on upload stage
+    }
+
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+    // NOTE: Cooked models meshes are stored already optimized
+    if (job->format != MODEL_ASYNC_RMDL) for (int i = 0; i < job->model.meshCount; i++) OptimizeMesh(&job->model.meshes[i], MESH_OPTIMIZE_ALL);
+#endif
+
+#if defined(SUPPORT_MODEL_LOD)
+    // Levels of detail simplification is CPU only, done here to keep it out of upload stage budget
+    if ((job->model.boneCount == 0) && (job->model.lodCount == 0)) SimplifyModelLods(&job->model, MODEL_LOD_LEVELS, MODEL_LOD_REDUCTION);
+#endif
+
+    return true;
+}
+
+// Model async load upload stage: meshes and textures (main thread)
+static bool UploadModelJob(void *data)
+{
+    ModelLoadJob *job = (ModelLoadJob *)data;
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (job->format == MODEL_ASYNC_OBJ)
+    {
+        job->model = LoadOBJ(job->fileName);
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+        for (int i = 0; i < job->model.meshCount; i++) OptimizeMesh(&job->model.meshes[i], MESH_OPTIMIZE_ALL);
+#endif
+    }
+#endif
+
+    UploadModelTextures(&job->model, &job->textures);
+    UploadModel(&job->model, job->fileName);
+
+    return true;
+}
+
+// Get model async load file format from file extension
+static int GetModelAsyncFormat(const char *fileName)
+{
+    int format = MODEL_ASYNC_NONE;
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (IsFileExtension(fileName, ".obj")) format = MODEL_ASYNC_OBJ;
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) format = MODEL_ASYNC_IQM;
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) format = MODEL_ASYNC_GLTF;
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+    if (IsFileExtension(fileName, ".vox")) format = MODEL_ASYNC_VOX;
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) format = MODEL_ASYNC_RMDL;
+#endif
+
+    return format;
+}
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Model reload decode stage: parse model file as LoadModelAsync() (worker thread)
+static bool DecodeModelReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+
+    ModelLoadJob *load = (ModelLoadJob *)RL_CALLOC(1, sizeof(ModelLoadJob));
+    strncpy(load->fileName, job->fileName[0], sizeof(load->fileName) - 1);
+    load->format = job->params[1];
+
+    // NOTE: GetDirectoryPath() uses a static buffer, directory is resolved here
+    strncpy(load->dirPath, job->fileName[0], sizeof(load->dirPath) - 1);
+    char *lastSlash = strrchr(load->dirPath, '/');
+    if (lastSlash == NULL) lastSlash = strrchr(load->dirPath, '\\');
+    if (lastSlash != NULL) *lastSlash = '\0';
+    else strcpy(load->dirPath, ".");
+    load->textures.dirPath = load->dirPath;
+
+    DecodeModelJob(load);
+
+    job->data = load;
+
+    return true;
+}
+
+// Model reload upload stage: meshes replaced in place in model meshes array (main thread)
+// NOTE: Meshes count and bones can not change, Model structs copies would keep previous values,
+// reloaded materials are released (materials textures are not reloaded with the model)
+static bool UploadModelReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+    ModelLoadJob *load = (ModelLoadJob *)job->data;
+    Model *model = &load->model;
+    bool success = false;
+
+    // NOTE: Upload stage also runs for cancelled reloads, decoded textures queue is released with it
+    UploadModelJob(load);
+
+    if (!job->cancelled)
+    {
+        if ((model->meshCount != job->params[0]) || (model->boneCount != job->params[3]))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Reloaded model meshes or bones changed, model must be loaded again", job->fileName[0]);
+        }
+        else
+        {
+            Mesh *meshes = (Mesh *)job->ptr[0];
+            Mesh *lodMeshes = (Mesh *)job->ptr[1];
+
+            for (int i = 0; i < model->meshCount; i++)
+            {
+                UnloadMesh(meshes[i]);
+                meshes[i] = model->meshes[i];
+            }
+
+            memset(model->meshes, 0, model->meshCount*sizeof(Mesh));
+
+            // Levels of detail are replaced if the same levels were generated, otherwise previous ones are kept
+            if ((lodMeshes != NULL) && (model->lodCount == job->params[2]))
+            {
+                for (int i = 0; i < model->lodCount*model->meshCount; i++)
+                {
+                    if (lodMeshes[i].vertexCount > 0) UnloadMesh(lodMeshes[i]);
+                    lodMeshes[i] = model->lodMeshes[i];
+                }
+
+                memset(model->lodMeshes, 0, model->lodCount*model->meshCount*sizeof(Mesh));
+            }
+
+            TRACELOG(LOG_INFO, "MODEL: [%s] Model reloaded successfully", job->fileName[0]);
+            success = true;
+        }
+    }
+
+    for (int i = 0; i < model->materialCount; i++) UnloadMaterial(model->materials[i]);
+    model->materialCount = 0;
+    UnloadModel(*model);
+    RL_FREE(load);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_GPU_SKINNING)
+#define SKINNING_STRINGIFY_(x)  #x
+#define SKINNING_STRINGIFY(x)   SKINNING_STRINGIFY_(x)
+
+// Load built-in skinning shader variant
+// NOTE: Default material shader template mirrors rlgl default shader, SKINNING feature transforms
+// vertex position by weighted bones matrices, MORPHING feature adds weighted morph targets deltas
+static void LoadShaderSkinning(void)
+{
+    const char *materialVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "#if defined(SKINNING)              \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "#endif                             \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "#if defined(SKINNING)              \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "#endif                             \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "#if defined(SKINNING)              \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "#endif                             \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "#if defined(SKINNING)              \n"
+    "uniform mat4 boneMatrices[" SKINNING_STRINGIFY(MAX_BONE_MATRICES) "]; \n"
+    "#endif                             \n"
+    "#if defined(MORPHING)              \n"     // NOTE: Requires GLSL 330 (gl_VertexID, texelFetch())
+    "uniform sampler2D morphTargets;    \n"
+    "uniform int morphTargetCount;      \n"
+    "uniform int morphIndices[" SKINNING_STRINGIFY(MAX_MORPH_WEIGHTS) "]; \n"
+    "uniform float morphWeights[" SKINNING_STRINGIFY(MAX_MORPH_WEIGHTS) "]; \n"
+    "#endif                             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 position = vertexPosition; \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "#if defined(MORPHING)              \n"
+    "    for (int i = 0; i < " SKINNING_STRINGIFY(MAX_MORPH_WEIGHTS) "; i++) \n"
+    "    {                              \n"
+    "        int texel = 2*(gl_VertexID*morphTargetCount + morphIndices[i]); \n"
+    "        position += morphWeights[i]*texelFetch(morphTargets, ivec2(texel%" SKINNING_STRINGIFY(MORPH_TEXTURE_WIDTH) ", texel/" SKINNING_STRINGIFY(MORPH_TEXTURE_WIDTH) "), 0).xyz; \n"
+    "    }                              \n"
+    "#endif                             \n"
+    "#if defined(SKINNING)              \n"
+    "    mat4 skinMatrix = vertexBoneWeights.x*boneMatrices[int(vertexBoneIds.x)] + \n"
+    "                      vertexBoneWeights.y*boneMatrices[int(vertexBoneIds.y)] + \n"
+    "                      vertexBoneWeights.z*boneMatrices[int(vertexBoneIds.z)] + \n"
+    "                      vertexBoneWeights.w*boneMatrices[int(vertexBoneIds.w)];  \n"
+    "    gl_Position = mvp*skinMatrix*vec4(position, 1.0); \n"
+    "#else                              \n"
+    "    gl_Position = mvp*vec4(position, 1.0); \n"
+    "#endif                             \n"
+    "}                                  \n";
+
+    const char *materialFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture(texture0, fragTexCoord);   \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = texture2D(texture0, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    const char *materialFeatures[MATERIAL_VARIANT_FEATURES] = { "SKINNING", "MORPHING" };
+
+    skinningShaderLoaded = true;
+    if (materialVariants == NULL) materialVariants = LoadShaderVariants(materialVShaderCode, materialFShaderCode, materialFeatures, MATERIAL_VARIANT_FEATURES);
+    skinningShader = GetShaderVariant(materialVariants, MATERIAL_VARIANT_SKINNING);
+
+    if ((skinningShader.id > 0) && (skinningShader.locs[SHADER_LOC_BONE_MATRICES] != -1)) TRACELOG(LOG_INFO, "SHADER: [ID %i] Skinning shader loaded successfully", skinningShader.id);
+    else
+    {
+        // NOTE: On failure, variant could be the default shader program, it is owned by variants anyway
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load skinning shader, using CPU skinning");
+        skinningShader = (Shader){ 0 };
+    }
+}
+
+#endif
+
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+// Load built-in animation textures shader
+// NOTE: Same as render queue instancing shader, vertices are skinned with bones matrices fetched from animation texture,
+// instance custom data selects animation frames range (x: first frame, y: frames count) and playback (z: offset, w: rate)
+static void LoadShaderAnimation(void)
+{
+    const char *animationVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "in mat4 instanceTransform;         \n"
+    "in vec4 instanceColor;             \n"
+    "in vec4 instanceCustom;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+    "uniform mat4 mvp;                  \n"
+    "uniform sampler2D animationBones;  \n"
+    "uniform vec2 animationParams;      \n"     // x: time (seconds), y: bones count
+    "vec4 GetBoneRow(int texel)         \n"
+    "{                                  \n"
+    "    return texelFetch(animationBones, ivec2(texel%" SKINNING_STRINGIFY(ANIMATION_TEXTURE_WIDTH) ", texel/" SKINNING_STRINGIFY(ANIMATION_TEXTURE_WIDTH) "), 0); \n"
+    "}                                  \n"
+    "mat4 GetBoneMatrix(int frame, int bone) \n"
+    "{                                  \n"
+    "    int texel = 3*(frame*int(animationParams.y) + bone); \n"
+    "    return transpose(mat4(GetBoneRow(texel), GetBoneRow(texel + 1), GetBoneRow(texel + 2), vec4(0.0, 0.0, 0.0, 1.0))); \n"
+    "}                                  \n"
+    "mat4 GetSkinMatrix(int frame)      \n"
+    "{                                  \n"
+    "    return vertexBoneWeights.x*GetBoneMatrix(frame, int(vertexBoneIds.x)) + \n"
+    "           vertexBoneWeights.y*GetBoneMatrix(frame, int(vertexBoneIds.y)) + \n"
+    "           vertexBoneWeights.z*GetBoneMatrix(frame, int(vertexBoneIds.z)) + \n"
+    "           vertexBoneWeights.w*GetBoneMatrix(frame, int(vertexBoneIds.w));  \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    int frameCount = max(int(instanceCustom.y), 1); \n"
+    "    float frame = mod(instanceCustom.z + animationParams.x*instanceCustom.w, float(frameCount)); \n"
+    "    int frame0 = min(int(frame), frameCount - 1); \n"
+    "    int frame1 = (frame0 + 1)%frameCount; \n"
+    "    int firstFrame = int(instanceCustom.x); \n"
+    "    vec4 position = vec4(vertexPosition, 1.0); \n"
+    "    position = mix(GetSkinMatrix(firstFrame + frame0)*position, GetSkinMatrix(firstFrame + frame1)*position, fract(frame)); \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor*instanceColor; \n"
+    "    gl_Position = mvp*instanceTransform*position; \n"
+    "}                                  \n";
+
+    const char *animationFShaderCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor; \n"
+    "}                                  \n";
+
+    animationShaderLoaded = true;
+    animationShader = LoadShaderFromMemory(animationVShaderCode, animationFShaderCode);
+    animationShaderLocs[0] = rlGetLocationUniform(animationShader.id, "animationBones");
+    animationShaderLocs[1] = rlGetLocationUniform(animationShader.id, "animationParams");
+
+    if ((animationShader.id > 0) && (animationShader.id != rlGetShaderIdDefault()) &&
+        (animationShaderLocs[0] != -1) && (animationShader.locs[SHADER_LOC_INSTANCE_CUSTOM] != -1))
+    {
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Animation textures shader loaded successfully", animationShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load animation textures shader, instances drawn in bind pose");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (animationShader.id != rlGetShaderIdDefault()) UnloadShader(animationShader);
+        else RL_FREE(animationShader.locs);
+
+        animationShader = (Shader){ 0 };
+    }
+}
+#endif
+
+#if defined(GPU_MORPHING_SUPPORTED)
+// Load mesh morph targets deltas texture, two texels by vertex and target: position and normal deltas
+// NOTE: Texels keep mesh deltas order (by vertex), quantized positions deltas are scaled to quantized space
+static unsigned int LoadMeshMorphTexture(const Mesh *mesh)
+{
+    int deltaCount = mesh->vertexCount*mesh->morphTargetCount;
+    int height = (2*deltaCount + MORPH_TEXTURE_WIDTH - 1)/MORPH_TEXTURE_WIDTH;
+
+    if (height > MORPH_TEXTURE_MAX_HEIGHT)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Morph targets deltas do not fit morph texture, morph targets not blended");
+        return 0;
+    }
+
+    float scale = 1.0f;
+    if ((mesh->quantization & MESH_QUANTIZE_POSITION) && (mesh->quantizeScale > 0.0f)) scale = 1.0f/mesh->quantizeScale;
+
+    float *texels = (float *)RL_CALLOC(MORPH_TEXTURE_WIDTH*height*4, sizeof(float));
+
+    for (int i = 0; i < deltaCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            texels[i*8 + k] = mesh->morphVertices[i*3 + k]*scale;
+            if (mesh->morphNormals != NULL) texels[i*8 + 4 + k] = mesh->morphNormals[i*3 + k];
+        }
+    }
+
+    unsigned int id = rlLoadTexture(texels, MORPH_TEXTURE_WIDTH, height, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+    RL_FREE(texels);
+
+    if (id == 0) TRACELOG(LOG_WARNING, "MESH: Failed to load morph targets texture, morph targets not blended");
+
+    return id;
+}
+
+// Bind mesh morph targets deltas texture and upload highest weights (MAX_MORPH_WEIGHTS)
+// NOTE: Unused weights slots are uploaded as 0, shader blends a fixed number of targets
+static void SetMeshMorphState(Mesh mesh, Shader shader)
+{
+    int indices[MAX_MORPH_WEIGHTS] = { 0 };
+    float weights[MAX_MORPH_WEIGHTS] = { 0 };
+    int count = 0;
+
+    // Keep highest absolute weights sorted, lowest weight is dropped when all slots are used
+    for (int t = 0; t < mesh.morphTargetCount; t++)
+    {
+        float weight = mesh.morphWeights[t];
+        if (weight == 0.0f) continue;
+
+        int k = (count < MAX_MORPH_WEIGHTS)? count++ : MAX_MORPH_WEIGHTS;
+
+        while ((k > 0) && (fabsf(weights[k - 1]) < fabsf(weight)))
+        {
+            if (k < MAX_MORPH_WEIGHTS)
+            {
+                weights[k] = weights[k - 1];
+                indices[k] = indices[k - 1];
+            }
+            k--;
+        }
+
+        if (k < MAX_MORPH_WEIGHTS)
+        {
+            weights[k] = weight;
+            indices[k] = t;
+        }
+    }
+
+    int slot = MORPH_TEXTURE_SLOT;
+    rlActiveTextureSlot(slot);
+    rlEnableTexture(mesh.morphTextureId);
+    rlSetUniform(shader.locs[SHADER_LOC_MAP_MORPH], &slot, SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(0);
+
+    rlSetUniform(shader.locs[SHADER_LOC_MORPH_TARGET_COUNT], &mesh.morphTargetCount, SHADER_UNIFORM_INT, 1);
+    rlSetUniform(shader.locs[SHADER_LOC_MORPH_INDICES], indices, SHADER_UNIFORM_INT, MAX_MORPH_WEIGHTS);
+    rlSetUniform(shader.locs[SHADER_LOC_MORPH_WEIGHTS], weights, SHADER_UNIFORM_FLOAT, MAX_MORPH_WEIGHTS);
+}
+#endif
+
+// Blend mesh morph targets on CPU into animated vertex data, uploaded to GPU if mesh is uploaded
+// NOTE: Only used if morph targets are not blended on GPU, mesh requires animated vertex data
+static void BlendMeshMorphTargets(Mesh mesh)
+{
+    if ((mesh.animVertices == NULL) || (mesh.vertices == NULL) || (mesh.morphVertices == NULL)) return;
+
+    bool normals = (mesh.animNormals != NULL) && (mesh.normals != NULL) && (mesh.morphNormals != NULL);
+
+    memcpy(mesh.animVertices, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+    if (normals) memcpy(mesh.animNormals, mesh.normals, mesh.vertexCount*3*sizeof(float));
+
+    for (int t = 0; t < mesh.morphTargetCount; t++)
+    {
+        float weight = mesh.morphWeights[t];
+        if (weight == 0.0f) continue;
+
+        for (int v = 0; v < mesh.vertexCount; v++)
+        {
+            const float *delta = &mesh.morphVertices[(v*mesh.morphTargetCount + t)*3];
+
+            mesh.animVertices[v*3 + 0] += weight*delta[0];
+            mesh.animVertices[v*3 + 1] += weight*delta[1];
+            mesh.animVertices[v*3 + 2] += weight*delta[2];
+
+            if (normals)
+            {
+                delta = &mesh.morphNormals[(v*mesh.morphTargetCount + t)*3];
+
+                mesh.animNormals[v*3 + 0] += weight*delta[0];
+                mesh.animNormals[v*3 + 1] += weight*delta[1];
+                mesh.animNormals[v*3 + 2] += weight*delta[2];
+            }
+        }
+    }
+
+    if (normals)
+    {
+        for (int v = 0; v < mesh.vertexCount; v++)
+        {
+            float *n = &mesh.animNormals[v*3];
+            float length = sqrtf(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+            if (length > 0.0f) { n[0] /= length; n[1] /= length; n[2] /= length; }
+        }
+    }
+
+    // NOTE: Animated meshes are uploaded as float attributes, one buffer per attribute
+    if ((mesh.vboId != NULL) && (mesh.vertexStride == 0))
+    {
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);
+        if (normals && (mesh.vboId[2] != 0)) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);
+    }
+}
+
+// Get bone skinning matrix, transformation from bind pose to pose
+// NOTE: Matrix applies the same transformation CPU skinning used to compose per vertex:
+// scale, bind pose translation removal, rotation relative to bind pose and pose translation,
+// rotation-only matrix is optionally returned for normals transformation
+static Matrix GetBoneSkinningMatrix(Transform bindPose, Transform pose, Matrix *rotation)
+{
+    Matrix boneRotation = QuaternionToMatrix(QuaternionMultiply(pose.rotation, QuaternionInvert(bindPose.rotation)));
+
+    Matrix transform = MatrixMultiply(MatrixScale(pose.scale.x, pose.scale.y, pose.scale.z), MatrixTranslate(-bindPose.translation.x, -bindPose.translation.y, -bindPose.translation.z));
+    transform = MatrixMultiply(transform, boneRotation);
+    transform = MatrixMultiply(transform, MatrixTranslate(pose.translation.x, pose.translation.y, pose.translation.z));
+
+    if (rotation != NULL) *rotation = boneRotation;
+
+    return transform;
+}
+
+// Compute CPU skinning bones transformations for a pose
+// NOTE: Bones matrices are optionally returned
+static bool SetSkinningBones(Model model, const Transform *pose, Matrix *matrices)
+{
+    if (skinningBonesCount < model.boneCount)
+    {
+        SkinningBone *bones = (SkinningBone *)RL_REALLOC(skinningBones, model.boneCount*sizeof(SkinningBone));
+        if (bones == NULL) return false;
+
+        skinningBones = bones;
+        skinningBonesCount = model.boneCount;
+    }
+
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        Matrix r = { 0 };
+        Matrix t = GetBoneSkinningMatrix(model.bindPose[i], pose[i], &r);
+        float *bt = skinningBones[i].transform;
+        float *br = skinningBones[i].rotation;
+
+        bt[0] = t.m0; bt[1] = t.m1; bt[2] = t.m2; bt[3] = 0.0f;
+        bt[4] = t.m4; bt[5] = t.m5; bt[6] = t.m6; bt[7] = 0.0f;
+        bt[8] = t.m8; bt[9] = t.m9; bt[10] = t.m10; bt[11] = 0.0f;
+        bt[12] = t.m12; bt[13] = t.m13; bt[14] = t.m14; bt[15] = 0.0f;
+
+        br[0] = r.m0; br[1] = r.m1; br[2] = r.m2; br[3] = 0.0f;
+        br[4] = r.m4; br[5] = r.m5; br[6] = r.m6; br[7] = 0.0f;
+        br[8] = r.m8; br[9] = r.m9; br[10] = r.m10; br[11] = 0.0f;
+
+        if (matrices != NULL) matrices[i] = t;
+    }
+
+    return true;
+}
+
+// Skin model meshes on CPU with current skinning bones
+static void SkinModelMeshes(Model model)
+{
+    skinnedAnimatedMeshes = NULL;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+        if (mesh.boneIds == NULL || mesh.boneWeights == NULL)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: UpdateModelAnimation Mesh %i has no connection to bones",m);
+            continue;
+        }
+
+        SkinningJob job = { 0 };
+        job.bones = skinningBones;
+        job.vertices = mesh.vertices;
+        job.normals = (mesh.animNormals != NULL)? mesh.normals : NULL;
+        job.boneIds = mesh.boneIds;
+        job.boneWeights = mesh.boneWeights;
+        job.animVertices = mesh.animVertices;
+        job.animNormals = (mesh.normals != NULL)? mesh.animNormals : NULL;
+
+        bool updated = false; // set to true when anim vertex information is updated
+
+#if defined(SUPPORT_THREADED_SKINNING)
+        // Split big meshes vertices between worker threads
+        int jobCount = mesh.vertexCount/SKINNING_MIN_THREAD_VERTICES;
+        if (jobCount > MAX_SKINNING_THREADS) jobCount = MAX_SKINNING_THREADS;
+
+        if (jobCount > 1)
+        {
+            SkinningJob jobs[MAX_SKINNING_THREADS] = { 0 };
+
+            for (int j = 0; j < jobCount; j++)
+            {
+                jobs[j] = job;
+                jobs[j].start = mesh.vertexCount*j/jobCount;
+                jobs[j].end = mesh.vertexCount*(j + 1)/jobCount;
+            }
+
+            RunSkinningJobs(jobs, jobCount);
+
+            for (int j = 0; j < jobCount; j++) updated |= jobs[j].updated;
+        }
+        else
+#endif
+        {
+            job.start = 0;
+            job.end = mesh.vertexCount;
+            updated = SkinVertices(&job);
+        }
+
+        // Upload new vertex data to GPU for model drawing
+        // Only update data when values changed.
+        if (updated){
+            // NOTE: Buffers are replaced (orphaned), GPU could be reading previous frame vertex data
+            rlResizeVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), true);    // Update vertex position
+            rlResizeVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), true);     // Update vertex normals
+        }
+    }
+}
+
+// Set model meshes bones matrices for GPU skinning
+// NOTE: Returns false if GPU skinning is not available, CPU skinning should be used instead
+static bool SetModelBoneMatrices(Model model, const Matrix *matrices)
+{
+#if defined(SUPPORT_GPU_SKINNING)
+    if (!skinningShaderLoaded) LoadShaderSkinning();
+
+    if ((skinningShader.id == 0) || (model.boneCount > MAX_BONE_MATRICES)) return false;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+
+        if ((mesh->vboId == NULL) || (mesh->vboId[7] == 0) || (mesh->vboId[8] == 0))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: GPU skinning Mesh %i has no connection to bones", m);
+            continue;
+        }
+
+        if (mesh->boneMatrices == NULL)
+        {
+            mesh->boneMatrices = (Matrix *)RL_CALLOC(model.boneCount, sizeof(Matrix));
+            mesh->boneCount = model.boneCount;
+
+            // Restore bind pose vertex data, it could have been modified by CPU skinning
+            rlUpdateVertexBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+            if ((mesh->normals != NULL) && (mesh->vboId[2] != 0)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
+        }
+
+        memcpy(mesh->boneMatrices, matrices, model.boneCount*sizeof(Matrix));
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Skinning 4-float vector operations
+#if defined(SKINNING_SIMD_SSE)
+    typedef __m128 SkinningVec4;
+    #define SkinningLoad(p)             _mm_loadu_ps(p)
+    #define SkinningZero()              _mm_setzero_ps()
+    #define SkinningMulAdd(acc, v, s)   _mm_add_ps(acc, _mm_mul_ps(v, _mm_set1_ps(s)))
+    #define SkinningStore(p, v)         _mm_storeu_ps(p, v)
+#elif defined(SKINNING_SIMD_NEON)
+    typedef float32x4_t SkinningVec4;
+    #define SkinningLoad(p)             vld1q_f32(p)
+    #define SkinningZero()              vdupq_n_f32(0.0f)
+    #define SkinningMulAdd(acc, v, s)   vmlaq_n_f32(acc, v, s)
+    #define SkinningStore(p, v)         vst1q_f32(p, v)
+#else
+    typedef struct { float x, y, z, w; } SkinningVec4;
+    static inline SkinningVec4 SkinningLoad(const float *p) { SkinningVec4 v = { p[0], p[1], p[2], p[3] }; return v; }
+    static inline SkinningVec4 SkinningZero(void) { SkinningVec4 v = { 0 }; return v; }
+    static inline SkinningVec4 SkinningMulAdd(SkinningVec4 acc, SkinningVec4 v, float s) { SkinningVec4 r = { acc.x + v.x*s, acc.y + v.y*s, acc.z + v.z*s, acc.w + v.w*s }; return r; }
+    static inline void SkinningStore(float *p, SkinningVec4 v) { p[0] = v.x; p[1] = v.y; p[2] = v.z; p[3] = v.w; }
+#endif
+
+// Skin a range of vertices with up to 4 bones influence by vertex
+// NOTE: Returns true if some vertex has been transformed
+static bool SkinVertices(SkinningJob *job)
+{
+    bool updated = false;
+    float result[4] = { 0 };
+
+    for (int v = job->start; v < job->end; v++)
+    {
+        const unsigned char *boneIds = &job->boneIds[v*4];
+        const float *boneWeights = &job->boneWeights[v*4];
+        const float *vertex = &job->vertices[v*3];
+
+        SkinningVec4 animVertex = SkinningZero();
+        SkinningVec4 animNormal = SkinningZero();
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            const float boneWeight = boneWeights[j];
+
+            // early stop when no transformation will be applied
+            if (boneWeight == 0.0f) continue;
+
+            const SkinningBone *bone = &job->bones[boneIds[j]];
+
+            SkinningVec4 position = SkinningLoad(&bone->transform[12]);
+            position = SkinningMulAdd(position, SkinningLoad(&bone->transform[0]), vertex[0]);
+            position = SkinningMulAdd(position, SkinningLoad(&bone->transform[4]), vertex[1]);
+            position = SkinningMulAdd(position, SkinningLoad(&bone->transform[8]), vertex[2]);
+            animVertex = SkinningMulAdd(animVertex, position, boneWeight);
+
+            if (job->normals != NULL)
+            {
+                const float *normal = &job->normals[v*3];
+
+                SkinningVec4 direction = SkinningZero();
+                direction = SkinningMulAdd(direction, SkinningLoad(&bone->rotation[0]), normal[0]);
+                direction = SkinningMulAdd(direction, SkinningLoad(&bone->rotation[4]), normal[1]);
+                direction = SkinningMulAdd(direction, SkinningLoad(&bone->rotation[8]), normal[2]);
+                animNormal = SkinningMulAdd(animNormal, direction, boneWeight);
+            }
+
+            updated = true;
+        }
+
+        SkinningStore(result, animVertex);
+        job->animVertices[v*3] = result[0];
+        job->animVertices[v*3 + 1] = result[1];
+        job->animVertices[v*3 + 2] = result[2];
+
+        if (job->animNormals != NULL)
+        {
+            SkinningStore(result, animNormal);
+            job->animNormals[v*3] = result[0];
+            job->animNormals[v*3 + 1] = result[1];
+            job->animNormals[v*3 + 2] = result[2];
+        }
+    }
+
+    job->updated = updated;
+
+    return updated;
+}
+
+#if defined(SUPPORT_THREADED_SKINNING)
+// Skinning worker thread loop, waits for new jobs generation and processes its own job
+static void *SkinningThread(void *arg)
+{
+    int index = (int)(intptr_t)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&skinningPool.mutex);
+
+    while (true)
+    {
+        while (skinningPool.running && (skinningPool.generation == generation)) pthread_cond_wait(&skinningPool.jobsReady, &skinningPool.mutex);
+        if (!skinningPool.running) break;
+
+        generation = skinningPool.generation;
+
+        if (index < skinningPool.jobCount)
+        {
+            pthread_mutex_unlock(&skinningPool.mutex);
+            SkinVertices(&skinningPool.jobs[index]);
+            pthread_mutex_lock(&skinningPool.mutex);
+
+            skinningPool.pending--;
+            if (skinningPool.pending == 0) pthread_cond_signal(&skinningPool.jobsDone);
+        }
+    }
+
+    pthread_mutex_unlock(&skinningPool.mutex);
+
+    return NULL;
+}
+
+// Run skinning jobs, first job is processed by calling thread
+// NOTE: Worker threads are created on first use, if creation fails jobs run on calling thread
+static void RunSkinningJobs(SkinningJob *jobs, int count)
+{
+    if (!skinningPool.running)
+    {
+        pthread_mutex_init(&skinningPool.mutex, NULL);
+        pthread_cond_init(&skinningPool.jobsReady, NULL);
+        pthread_cond_init(&skinningPool.jobsDone, NULL);
+
+        skinningPool.running = true;
+        skinningPool.threadCount = 1;
+
+        for (int i = 1; i < MAX_SKINNING_THREADS; i++)
+        {
+            if (pthread_create(&skinningPool.threadId[i], NULL, &SkinningThread, (void *)(intptr_t)i) != 0)
+            {
+                TRACELOG(LOG_WARNING, "MODEL: Failed to create skinning worker thread %i", i);
+                break;
+            }
+
+            skinningPool.threadCount++;
+        }
+
+        TRACELOG(LOG_INFO, "MODEL: Skinning workers initialized successfully (%i threads)", skinningPool.threadCount);
+    }
+
+    int workerCount = (count < skinningPool.threadCount)? count : skinningPool.threadCount;
+
+    for (int i = 0; i < count; i++) skinningPool.jobs[i] = jobs[i];
+
+    pthread_mutex_lock(&skinningPool.mutex);
+    skinningPool.jobCount = workerCount;
+    skinningPool.pending = workerCount - 1;
+    skinningPool.generation++;
+    pthread_cond_broadcast(&skinningPool.jobsReady);
+    pthread_mutex_unlock(&skinningPool.mutex);
+
+    // Jobs not attended by any worker (thread creation failed) run on calling thread
+    SkinVertices(&skinningPool.jobs[0]);
+    for (int i = workerCount; i < count; i++) SkinVertices(&skinningPool.jobs[i]);
+
+    pthread_mutex_lock(&skinningPool.mutex);
+    while (skinningPool.pending > 0) pthread_cond_wait(&skinningPool.jobsDone, &skinningPool.mutex);
+    pthread_mutex_unlock(&skinningPool.mutex);
+
+    for (int i = 0; i < count; i++) jobs[i].updated = skinningPool.jobs[i].updated;
+}
+#endif
+
+// Unload skinning data: built-in skinning shader, worker threads and bones buffer
+extern void UnloadSkinningData(void)
+{
+#if defined(SUPPORT_GPU_SKINNING)
+    UnloadShaderVariants(materialVariants);
+
+    materialVariants = NULL;
+    skinningShader = (Shader){ 0 };
+    skinningShaderLoaded = false;
+#endif
+
+#if defined(SKINNING_CACHE_SUPPORTED)
+    for (int i = 0; i < skinningCache.count; i++)
+    {
+        rlUnloadShaderBuffer(skinningCache.entries[i].bufferId);
+        RL_FREE(skinningCache.entries[i].bones);
+    }
+
+    RL_FREE(skinningCache.entries);
+    if (skinningCache.bonesId > 0) rlUnloadShaderBuffer(skinningCache.bonesId);
+    if (skinningCache.program > 0) rlUnloadShaderProgram(skinningCache.program);
+    memset(&skinningCache, 0, sizeof(skinningCache));
+#endif
+
+#if defined(ANIMATION_TEXTURES_SUPPORTED)
+    if (animationShader.id > 0) UnloadShader(animationShader);
+    animationShader = (Shader){ 0 };
+    animationShaderLoaded = false;
+#endif
+
+#if defined(SUPPORT_THREADED_SKINNING)
+    if (skinningPool.running)
+    {
+        pthread_mutex_lock(&skinningPool.mutex);
+        skinningPool.running = false;
+        pthread_cond_broadcast(&skinningPool.jobsReady);
+        pthread_mutex_unlock(&skinningPool.mutex);
+
+        for (int i = 1; i < skinningPool.threadCount; i++) pthread_join(skinningPool.threadId[i], NULL);
+
+        pthread_mutex_destroy(&skinningPool.mutex);
+        pthread_cond_destroy(&skinningPool.jobsReady);
+        pthread_cond_destroy(&skinningPool.jobsDone);
+        skinningPool.threadCount = 0;
+    }
+#endif
+
+    RL_FREE(skinningBones);
+    skinningBones = NULL;
+    skinningBonesCount = 0;
+}
+
+// Get model animation frame pose, compressed animations tracks are decoded into transforms
+static void GetModelAnimationFramePose(ModelAnimation anim, int frame, Transform *transforms)
+{
+    if (anim.framePoses != NULL)
+    {
+        memcpy(transforms, anim.framePoses[frame], anim.boneCount*sizeof(Transform));
+        return;
+    }
+
+    for (int i = 0; i < anim.boneCount; i++)
+    {
+        Quaternion translation = GetAnimationTrackFrame(anim, i*3 + 0, frame);
+        Quaternion rotation = GetAnimationTrackFrame(anim, i*3 + 1, frame);
+        Quaternion scale = GetAnimationTrackFrame(anim, i*3 + 2, frame);
+
+        transforms[i].translation = (Vector3){ translation.x, translation.y, translation.z };
+        transforms[i].rotation = rotation;
+        transforms[i].scale = (Vector3){ scale.x, scale.y, scale.z };
+    }
+}
+
+// Get compressed animation track value at frame, interpolated between surrounding keys
+static Quaternion GetAnimationTrackFrame(ModelAnimation anim, int track, int frame)
+{
+    ModelAnimationTrack info = anim.tracks[track];
+    const unsigned short *keyFrames = &anim.keyFrames[info.firstKey];
+    int channel = track%3;
+
+    // Binary search last key at or before frame
+    int low = 0;
+    int high = info.keyCount - 1;
+
+    while (low < high)
+    {
+        int mid = (low + high + 1)/2;
+        if (keyFrames[mid] <= frame) low = mid;
+        else high = mid - 1;
+    }
+
+    Quaternion a = DecodeAnimationTrackKey(info, &anim.keyValues[(info.firstKey + low)*3], channel);
+    if ((low == info.keyCount - 1) || (keyFrames[low] == frame)) return a;
+
+    Quaternion b = DecodeAnimationTrackKey(info, &anim.keyValues[(info.firstKey + low + 1)*3], channel);
+
+    return GetAnimationTrackValue(a, b, (float)(frame - keyFrames[low])/(float)(keyFrames[low + 1] - keyFrames[low]), channel);
+}
+
+// Decode compressed animation track key (translation/scale in xyz)
+static Quaternion DecodeAnimationTrackKey(ModelAnimationTrack track, const unsigned short *key, int channel)
+{
+    if (channel == 1) return DecodeAnimationRotation(key);
+
+    return (Quaternion){
+        track.offset.x + key[0]*track.range.x,
+        track.offset.y + key[1]*track.range.y,
+        track.offset.z + key[2]*track.range.z, 0.0f };
+}
+
+// Get animation track interpolated value (lerp translation/scale, slerp rotation)
+static Quaternion GetAnimationTrackValue(Quaternion a, Quaternion b, float amount, int channel)
+{
+    if (channel == 1) return QuaternionSlerp(a, b, amount);
+
+    return (Quaternion){ a.x + (b.x - a.x)*amount, a.y + (b.y - a.y)*amount, a.z + (b.z - a.z)*amount, 0.0f };
+}
+
+// Get animation track values error (distance for translation/scale, angle in radians for rotation)
+static float GetAnimationTrackError(Quaternion a, Quaternion b, int channel)
+{
+    if (channel == 1)
+    {
+        float dot = fabsf(a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w);
+        return 2.0f*acosf(fminf(dot, 1.0f));
+    }
+
+    return Vector3Distance((Vector3){ a.x, a.y, a.z }, (Vector3){ b.x, b.y, b.z });
+}
+
+// Encode rotation as smallest-three: 3 smallest components in 15 bits each, largest component index in high bits
+// NOTE: Largest component is made positive (same rotation) and rebuilt from unit length on decoding
+static void EncodeAnimationRotation(Quaternion q, unsigned short *key)
+{
+    float v[4] = { q.x, q.y, q.z, q.w };
+
+    int largest = 0;
+    for (int i = 1; i < 4; i++) if (fabsf(v[i]) > fabsf(v[largest])) largest = i;
+
+    float sign = (v[largest] < 0.0f)? -1.0f : 1.0f;
+
+    for (int i = 0, c = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        // Smallest components range: [-1/sqrt(2), 1/sqrt(2)]
+        float value = Clamp(v[i]*sign*0.70710678f + 0.5f, 0.0f, 1.0f);
+        key[c++] = (unsigned short)roundf(value*32767.0f);
+    }
+
+    key[0] |= (unsigned short)((largest & 2) << 14);
+    key[1] |= (unsigned short)((largest & 1) << 15);
+}
+
+// Decode smallest-three rotation
+static Quaternion DecodeAnimationRotation(const unsigned short *key)
+{
+    int largest = ((key[0] >> 14) & 2) | (key[1] >> 15);
+
+    float v[4] = { 0 };
+    float sum = 0.0f;
+
+    for (int i = 0, c = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+
+        v[i] = ((float)(key[c++] & 0x7fff)/32767.0f - 0.5f)*1.41421356f;
+        sum += v[i]*v[i];
+    }
+
+    v[largest] = sqrtf(fmaxf(0.0f, 1.0f - sum));
+
+    return (Quaternion){ v[0], v[1], v[2], v[3] };
+}
+
+// Get animation root bone transform at fractional frame (root motion)
+// NOTE: Root bone is the first bone without parent, compressed animations only decode root tracks
+static Transform GetAnimationRootTransform(ModelAnimation anim, float frame)
+{
+    Transform root = { 0 };
+    root.rotation = QuaternionIdentity();
+    root.scale = (Vector3){ 1.0f, 1.0f, 1.0f };
+
+    if ((anim.frameCount <= 0) || (anim.boneCount <= 0) || ((anim.framePoses == NULL) && (anim.tracks == NULL))) return root;
+
+    int bone = 0;
+    if (anim.bones != NULL)
+    {
+        for (int i = 0; i < anim.boneCount; i++) if (anim.bones[i].parent < 0) { bone = i; break; }
+    }
+
+    frame = fmodf(frame, (float)anim.frameCount);
+    if (frame < 0.0f) frame += (float)anim.frameCount;
+
+    int frameA = (int)frame;
+    int frameB = (frameA + 1)%anim.frameCount;
+    float amount = frame - (float)frameA;
+
+    Transform a = { 0 };
+    Transform b = { 0 };
+
+    if (anim.framePoses != NULL)
+    {
+        a = anim.framePoses[frameA][bone];
+        b = anim.framePoses[frameB][bone];
+    }
+    else
+    {
+        Transform *keys[2] = { &a, &b };
+        int frames[2] = { frameA, frameB };
+
+        for (int k = 0; k < 2; k++)
+        {
+            Quaternion translation = GetAnimationTrackFrame(anim, bone*3 + 0, frames[k]);
+            Quaternion scale = GetAnimationTrackFrame(anim, bone*3 + 2, frames[k]);
+
+            keys[k]->translation = (Vector3){ translation.x, translation.y, translation.z };
+            keys[k]->rotation = GetAnimationTrackFrame(anim, bone*3 + 1, frames[k]);
+            keys[k]->scale = (Vector3){ scale.x, scale.y, scale.z };
+        }
+    }
+
+    root.translation = Vector3Lerp(a.translation, b.translation, amount);
+    root.rotation = QuaternionSlerp(a.rotation, b.rotation, amount);
+    root.scale = Vector3Lerp(a.scale, b.scale, amount);
+
+    return root;
+}
+
+// Sample animated model pose at fractional frame and compute its bones skinning matrices
+static void SampleAnimatedModelKey(AnimatedModel *animModel, float frame, Matrix *matrices)
+{
+    SampleModelAnimation(&animModel->pose, animModel->anim, frame);
+
+    for (int i = 0; i < animModel->pose.boneCount; i++)
+    {
+        matrices[i] = GetBoneSkinningMatrix(animModel->model.bindPose[i], animModel->pose.transforms[i], NULL);
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+//
+// Keep the following information in mind when reading this
+//  - A mesh is created for every material present in the obj file
+//  - the model.meshCount is therefore the materialCount returned from tinyobj
+//  - the mesh is automatically triangulated by tinyobj
+static Model LoadOBJ(const char *fileName)
+{
+    Model model = { 0 };
+
+    tinyobj_attrib_t attrib = { 0 };
+    tinyobj_shape_t *meshes = NULL;
+    unsigned int meshCount = 0;
+
+    tinyobj_material_t *materials = NULL;
+    unsigned int materialCount = 0;
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText != NULL)
+    {
+        unsigned int dataSize = (unsigned int)strlen(fileText);
+        char currentDir[1024] = { 0 };
+        strcpy(currentDir, GetWorkingDirectory());
+        const char *workingDir = GetDirectoryPath(fileName);
+        if (CHDIR(workingDir) != 0)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+        }
+
+        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
+        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+
+        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
+        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
+
+        model.meshCount = materialCount;
+
+        // Init model materials array
+        if (materialCount > 0)
+        {
+            model.materialCount = materialCount;
+            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+            TraceLog(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
+        }
+        else
+        {
+            model.meshCount = 1;
+            TraceLog(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
+        }
+
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Count the faces for each material
+        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
+
+        // iff no materials are present use all faces on one mesh
+        if (materialCount > 0)
+        {
+            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
+            {
+                //tinyobj_vertex_index_t face = attrib.faces[fi];
+                int idx = attrib.material_ids[fi];
+                matFaces[idx]++;
+            }
+
+        }
+        else
+        {
+            matFaces[0] = attrib.num_faces;
+        }
+
+        //--------------------------------------
+        // Create the material meshes
+
+        // Running counts/indexes for each material mesh as we are
+        // building them at the same time
+        int *vCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *vtCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *vnCount = RL_CALLOC(model.meshCount, sizeof(int));
+        int *faceCount = RL_CALLOC(model.meshCount, sizeof(int));
+
+        // Allocate space for each of the material meshes
+        for (int mi = 0; mi < model.meshCount; mi++)
+        {
+            model.meshes[mi].vertexCount = matFaces[mi]*3;
+            model.meshes[mi].triangleCount = matFaces[mi];
+            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
+            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
+            model.meshMaterial[mi] = mi;
+        }
+
+        // Scan through the combined sub meshes and pick out each material mesh
+        for (unsigned int af = 0; af < attrib.num_faces; af++)
+        {
+            int mm = attrib.material_ids[af];   // mesh material for this face
+            if (mm == -1) { mm = 0; }           // no material object..
+
+            // Get indices for the face
+            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
+            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
+            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
+
+            // Fill vertices buffer (float) using vertex index of the face
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
+            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
+
+            if (attrib.num_texcoords > 0)
+            {
+                // Fill texcoords buffer (float) using vertex index of the face
+                // NOTE: Y-coordinate must be flipped upside-down to account for
+                // raylib's upside down textures...
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
+                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
+                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
+            }
+
+            if (attrib.num_normals > 0)
+            {
+                // Fill normals buffer (float) using vertex index of the face
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
+                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
+            }
+        }
+
+        // Init model materials
+        for (unsigned int m = 0; m < materialCount; m++)
+        {
+            // Init material to default
+            // NOTE: Uses default shader, which only supports MATERIAL_MAP_DIFFUSE
+            model.materials[m] = LoadMaterialDefault();
+
+            // Get default texture, in case no texture is defined
+            // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
+            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+            if (materials[m].diffuse_texname != NULL) model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+
+            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(materials[m].diffuse[0]*255.0f), (unsigned char)(materials[m].diffuse[1]*255.0f), (unsigned char)(materials[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
+            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
+
+            if (materials[m].specular_texname != NULL) model.materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
+            model.materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(materials[m].specular[0]*255.0f), (unsigned char)(materials[m].specular[1]*255.0f), (unsigned char)(materials[m].specular[2]*255.0f), 255 }; //float specular[3];
+            model.materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
+
+            if (materials[m].bump_texname != NULL) model.materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
+            model.materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
+            model.materials[m].maps[MATERIAL_MAP_NORMAL].value = materials[m].shininess;
+
+            model.materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(materials[m].emission[0]*255.0f), (unsigned char)(materials[m].emission[1]*255.0f), (unsigned char)(materials[m].emission[2]*255.0f), 255 }; //float emission[3];
+
+            if (materials[m].displacement_texname != NULL) model.materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
+        }
+
+        tinyobj_attrib_free(&attrib);
+        tinyobj_shapes_free(meshes, meshCount);
+        tinyobj_materials_free(materials, materialCount);
+
+        UnloadFileText(fileText);
+
+        RL_FREE(matFaces);
+        RL_FREE(vCount);
+        RL_FREE(vtCount);
+        RL_FREE(vnCount);
+        RL_FREE(faceCount);
+
+        if (CHDIR(currentDir) != 0)
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
+        }
+    }
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_IQM)
+// Load IQM mesh data
+static Model LoadIQM(const char *fileName)
+{
+    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
+    #define IQM_VERSION          2          // only IQM version 2 supported
+
+    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
+    #define MESH_NAME_LENGTH    32          // Mesh name string length
+    #define MATERIAL_NAME_LENGTH 32         // Material name string length
+
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+    const unsigned char *fileDataPtr = fileData;
+
+    // IQM file structs
+    //-----------------------------------------------------------------------------------
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
+
+    typedef struct IQMMesh {
+        unsigned int name;
+        unsigned int material;
+        unsigned int first_vertex, num_vertexes;
+        unsigned int first_triangle, num_triangles;
+    } IQMMesh;
+
+    typedef struct IQMTriangle {
+        unsigned int vertex[3];
+    } IQMTriangle;
+
+    typedef struct IQMJoint {
+        unsigned int name;
+        int parent;
+        float translate[3], rotate[4], scale[3];
+    } IQMJoint;
+
+    typedef struct IQMVertexArray {
+        unsigned int type;
+        unsigned int flags;
+        unsigned int format;
+        unsigned int size;
+        unsigned int offset;
+    } IQMVertexArray;
+
+    // NOTE: Below IQM structures are not used but listed for reference
+    /*
+    typedef struct IQMAdjacency {
+        unsigned int triangle[3];
+    } IQMAdjacency;
+
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
+
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
+
+    typedef struct IQMBounds {
+        float bbmin[3], bbmax[3];
+        float xyradius, radius;
+    } IQMBounds;
+    */
+    //-----------------------------------------------------------------------------------
+
+    // IQM vertex data types
+    enum {
+        IQM_POSITION     = 0,
+        IQM_TEXCOORD     = 1,
+        IQM_NORMAL       = 2,
+        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
+        IQM_BLENDINDEXES = 4,
+        IQM_BLENDWEIGHTS = 5,
+        IQM_COLOR        = 6,
+        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
+    };
+
+    Model model = { 0 };
+
+    IQMMesh *imesh = NULL;
+    IQMTriangle *tri = NULL;
+    IQMVertexArray *va = NULL;
+    IQMJoint *ijoint = NULL;
+
+    float *vertex = NULL;
+    float *normal = NULL;
+    float *text = NULL;
+    char *blendi = NULL;
+    unsigned char *blendw = NULL;
+    unsigned char *color = NULL;
+
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return model;
+
+    // Read IQM header
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
+
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileDataView(fileData);
+        return model;
+    }
+
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileDataView(fileData);
+        return model;
+    }
+
+    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+
+    // Meshes data processing
+    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
+    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
+    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
+    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+
+    model.meshCount = iqmHeader->num_meshes;
+    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+
+    model.materialCount = model.meshCount;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    char name[MESH_NAME_LENGTH] = { 0 };
+    char material[MATERIAL_NAME_LENGTH] = { 0 };
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
+        //fread(name, sizeof(char)*MESH_NAME_LENGTH, 1, iqmFile);
+        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+
+        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
+        //fread(material, sizeof(char)*MATERIAL_NAME_LENGTH, 1, iqmFile);
+        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+
+        model.materials[i] = LoadMaterialDefault();
+
+        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+
+        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+
+        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
+        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
+        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+
+        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
+        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+
+        model.meshes[i].triangleCount = imesh[i].num_triangles;
+        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+
+        // Animated verted data, what we actually process for rendering
+        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
+        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+    }
+
+    // Triangles data processing
+    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
+    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
+    //fread(tri, iqmHeader->num_triangles*sizeof(IQMTriangle), 1, iqmFile);
+    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        int tcounter = 0;
+
+        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        {
+            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
+            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
+            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
+            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
+            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
+            tcounter += 3;
+        }
+    }
+
+    // Vertex arrays data processing
+    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
+    //fread(va, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray), 1, iqmFile);
+    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+
+    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
+    {
+        switch (va[i].type)
+        {
+            case IQM_POSITION:
+            {
+                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].vertices[vCounter] = vertex[i];
+                        model.meshes[m].animVertices[vCounter] = vertex[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_NORMAL:
+            {
+                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
+                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
+                    {
+                        model.meshes[m].normals[vCounter] = normal[i];
+                        model.meshes[m].animNormals[vCounter] = normal[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_TEXCOORD:
+            {
+                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
+                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
+                    {
+                        model.meshes[m].texcoords[vCounter] = text[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDINDEXES:
+            {
+                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
+                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneIds[boneCounter] = blendi[i];
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_BLENDWEIGHTS:
+            {
+                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    int boneCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
+                        boneCounter++;
+                    }
+                }
+            } break;
+            case IQM_COLOR:
+            {
+                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
+                //fseek(iqmFile, va[i].offset, SEEK_SET);
+                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
+                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
+
+                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                {
+                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+
+                    int vCounter = 0;
+                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    {
+                        model.meshes[m].colors[vCounter] = color[i];
+                        vCounter++;
+                    }
+                }
+            } break;
+        }
+    }
+
+    // Bones (joints) data processing
+    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
+    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
+    //fread(ijoint, iqmHeader->num_joints*sizeof(IQMJoint), 1, iqmFile);
+    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+
+    model.boneCount = iqmHeader->num_joints;
+    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
+    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
+
+    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
+    {
+        // Bones
+        model.bones[i].parent = ijoint[i].parent;
+        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
+        //fread(model.bones[i].name, BONE_NAME_LENGTH*sizeof(char), 1, iqmFile);
+        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+
+        // Bind pose (base pose)
+        model.bindPose[i].translation.x = ijoint[i].translate[0];
+        model.bindPose[i].translation.y = ijoint[i].translate[1];
+        model.bindPose[i].translation.z = ijoint[i].translate[2];
+
+        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
+        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
+        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
+        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+
+        model.bindPose[i].scale.x = ijoint[i].scale[0];
+        model.bindPose[i].scale.y = ijoint[i].scale[1];
+        model.bindPose[i].scale.z = ijoint[i].scale[2];
+    }
+
+    // Build bind pose from parent joints
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        if (model.bones[i].parent >= 0)
+        {
+            model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
+            model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
+            model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
+            model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+        }
+    }
+
+    UnloadFileDataView(fileData);
+
+    RL_FREE(imesh);
+    RL_FREE(tri);
+    RL_FREE(va);
+    RL_FREE(vertex);
+    RL_FREE(normal);
+    RL_FREE(text);
+    RL_FREE(blendi);
+    RL_FREE(blendw);
+    RL_FREE(ijoint);
+
+    return model;
+}
+
+// Load IQM animation data
+static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
+{
+    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
+    #define IQM_VERSION     2                   // only IQM version 2 supported
+
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+    const unsigned char *fileDataPtr = fileData;
+
+    typedef struct IQMHeader {
+        char magic[16];
+        unsigned int version;
+        unsigned int filesize;
+        unsigned int flags;
+        unsigned int num_text, ofs_text;
+        unsigned int num_meshes, ofs_meshes;
+        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
+        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
+        unsigned int num_joints, ofs_joints;
+        unsigned int num_poses, ofs_poses;
+        unsigned int num_anims, ofs_anims;
+        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
+        unsigned int num_comment, ofs_comment;
+        unsigned int num_extensions, ofs_extensions;
+    } IQMHeader;
 
-    if (distance <= (radius1 + radius2)) collision = true;
-    */
+    typedef struct IQMPose {
+        int parent;
+        unsigned int mask;
+        float channeloffset[10];
+        float channelscale[10];
+    } IQMPose;
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+    typedef struct IQMAnim {
+        unsigned int name;
+        unsigned int first_frame, num_frames;
+        float framerate;
+        unsigned int flags;
+    } IQMAnim;
 
-    return collision;
-}
+    // In case file can not be read, return an empty model
+    if (fileDataPtr == NULL) return NULL;
 
-// Check collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
-{
-    bool collision = true;
+    // Read IQM header
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        UnloadFileDataView(fileData);
+        return NULL;
     }
-    else collision = false;
-
-    return collision;
-}
-
-// Check collision between box and sphere
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
-{
-    bool collision = false;
-
-    float dmin = 0;
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
-
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
-    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+    if (iqmHeader->version != IQM_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        UnloadFileDataView(fileData);
+        return NULL;
+    }
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+    // Get bones data
+    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
+    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
+    //fread(poses, iqmHeader->num_poses*sizeof(IQMPose), 1, iqmFile);
+    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
 
-    if (dmin <= (radius*radius)) collision = true;
+    // Get animations data
+    *animCount = iqmHeader->num_anims;
+    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
+    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
+    //fread(anim, iqmHeader->num_anims*sizeof(IQMAnim), 1, iqmFile);
+    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
 
-    return collision;
-}
+    ModelAnimation *animations = RL_CALLOC(iqmHeader->num_anims, sizeof(ModelAnimation));
 
-// Get collision info between ray and sphere
-RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
-{
-    RayCollision collision = { 0 };
+    // frameposes
+    unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
+    //fread(framedata, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short), 1, iqmFile);
+    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float distance = Vector3Length(raySpherePos);
-    float d = radius*radius - (distance*distance - vector*vector);
+    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    {
+        animations[a].frameCount = anim[a].num_frames;
+        animations[a].boneCount = iqmHeader->num_poses;
+        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
+        animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
+        // animations[a].framerate = anim.framerate;     // TODO: Use framerate?
 
-    collision.hit = d >= 0.0f;
+        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        {
+            strcpy(animations[a].bones[j].name, "ANIMJOINTNAME");
+            animations[a].bones[j].parent = poses[j].parent;
+        }
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    if (distance < radius)
-    {
-        collision.distance = vector + sqrtf(d);
+        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
 
-        // Calculate collision normal (pointing outwards)
-        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
-    }
-    else
-    {
-        collision.distance = vector - sqrtf(d);
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+            {
+                animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+                if (poses[i].mask & 0x01)
+                {
+                    animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
+                    dcounter++;
+                }
 
-        // Calculate collision normal (pointing inwards)
-        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
-    }
+                animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
 
-    return collision;
-}
+                if (poses[i].mask & 0x02)
+                {
+                    animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
+                    dcounter++;
+                }
 
-// Get collision info between ray and box
-RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
-{
-    RayCollision collision = { 0 };
+                animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
 
-    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
-    // Reversing ray.direction will give use the correct result.
-    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
-                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
-                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+                if (poses[i].mask & 0x04)
+                {
+                    animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
+                    dcounter++;
+                }
 
-    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+                animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
 
-    float t[11] = { 0 };
+                if (poses[i].mask & 0x08)
+                {
+                    animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
+                    dcounter++;
+                }
 
-    t[8] = 1.0f/ray.direction.x;
-    t[9] = 1.0f/ray.direction.y;
-    t[10] = 1.0f/ray.direction.z;
+                animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
 
-    t[0] = (box.min.x - ray.position.x)*t[8];
-    t[1] = (box.max.x - ray.position.x)*t[8];
-    t[2] = (box.min.y - ray.position.y)*t[9];
-    t[3] = (box.max.y - ray.position.y)*t[9];
-    t[4] = (box.min.z - ray.position.z)*t[10];
-    t[5] = (box.max.z - ray.position.z)*t[10];
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+                if (poses[i].mask & 0x10)
+                {
+                    animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
+                    dcounter++;
+                }
 
-    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
-    collision.distance = t[6];
-    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+                animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elemets of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+                if (poses[i].mask & 0x20)
+                {
+                    animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
+                    dcounter++;
+                }
 
-    collision.normal = Vector3Normalize(collision.normal);
+                animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
 
-    if (insideBox)
-    {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
-    }
+                if (poses[i].mask & 0x40)
+                {
+                    animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
+                    dcounter++;
+                }
 
-    return collision;
-}
+                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
 
-// Get collision info between ray and mesh
-RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
-{
-    RayCollision collision = { 0 };
+                if (poses[i].mask & 0x80)
+                {
+                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
+                    dcounter++;
+                }
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
-    {
-        int triangleCount = mesh.triangleCount;
+                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
-        {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+                if (poses[i].mask & 0x100)
+                {
+                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
+                    dcounter++;
+                }
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
-            {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+                if (poses[i].mask & 0x200)
+                {
+                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
+                    dcounter++;
+                }
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
+            }
+        }
 
-            if (triHitInfo.hit)
+        // Build frameposes
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (int i = 0; i < animations[a].boneCount; i++)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                if (animations[a].bones[i].parent >= 0)
+                {
+                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
+                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
+                }
             }
         }
     }
 
-    return collision;
-}
-
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
-{
-    #define EPSILON 0.000001f        // A small number
+    UnloadFileDataView(fileData);
 
-    RayCollision collision = { 0 };
-    Vector3 edge1 = { 0 };
-    Vector3 edge2 = { 0 };
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    RL_FREE(framedata);
+    RL_FREE(poses);
+    RL_FREE(anim);
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+    return animations;
+}
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+#endif
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// Load image from different glTF provided methods (uri, path, buffer_view)
+// Load glTF external file data (buffers), using LoadFileData()
+static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
+{
+    unsigned int fileSize = 0;
+    void *fileData = LoadFileData(path, &fileSize);
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+    if (fileData == NULL) return cgltf_result_io_error;
 
-    invDet = 1.0f/det;
+    *size = fileSize;
+    *data = fileData;
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+    return cgltf_result_success;
+}
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+// Release glTF external file data loaded by LoadFileGLTFCallback()
+static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data)
+{
+    RL_FREE(data);
+}
 
-    // The intersection lies outside of the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+{
+    Image image = { 0 };
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+    if (cgltfImage->uri != NULL)     // Check if image data is provided as a uri (base64 or path)
+    {
+        if ((strlen(cgltfImage->uri) > 5) &&
+            (cgltfImage->uri[0] == 'd') &&
+            (cgltfImage->uri[1] == 'a') &&
+            (cgltfImage->uri[2] == 't') &&
+            (cgltfImage->uri[3] == 'a') &&
+            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        {
+            // Data URI Format: data:<mediatype>;base64,<data>
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+            // Find the comma
+            int i = 0;
+            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
 
-    // The intersection lies outside of the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
+            else
+            {
+                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
+                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
+                void *data = NULL;
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+                cgltf_options options = { 0 };
+                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
 
-    if (t > EPSILON)
+                if (result == cgltf_result_success)
+                {
+                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    cgltf_free((cgltf_data*)data);
+                }
+            }
+        }
+        else     // Check if image is provided as image path
+        {
+            // NOTE: Path is composed locally, TextFormat() static buffers are not safe on async load worker threads
+            char imagePath[512] = { 0 };
+            snprintf(imagePath, sizeof(imagePath), "%s/%s", texPath, cgltfImage->uri);
+            image = LoadImage(imagePath);
+        }
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltf_buffer_view_data(cgltfImage->buffer_view) != NULL))    // Check if image is provided as data buffer
     {
-        // Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        // NOTE: Image file data is decoded directly from buffer, no copy required
+        unsigned char *data = (unsigned char *)cgltf_buffer_view_data(cgltfImage->buffer_view);
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
+            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
+                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
     }
 
-    return collision;
+    return image;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+#if defined(SUPPORT_ASYNC_LOADING)
+// glTF image async decode stage (worker thread)
+static bool DecodeGLTFImageJob(void *data)
 {
-    RayCollision collision = { 0 };
-
-    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
-
-    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+    GLTFImageLoadJob *job = (GLTFImageLoadJob *)data;
+    job->image = LoadImageFromCgltfImage(job->cgltfImage, job->texPath);
 
-    return collision;
+    return (job->image.data != NULL);
 }
+#endif
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-//
-// Keep the following information in mind when reading this
-//  - A mesh is created for every material present in the obj file
-//  - the model.meshCount is therefore the materialCount returned from tinyobj
-//  - the mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
+// Load glTF images used by materials textures, decoded in parallel on async load workers
+// NOTE: Returned array is indexed as data->images, images not used by any material (or already cached textures) are not loaded
+static Image *LoadGLTFImages(cgltf_data *data, const char *texPath, char (*keys)[512], int *uses, bool parallel)
 {
-    Model model = { 0 };
-
-    tinyobj_attrib_t attrib = { 0 };
-    tinyobj_shape_t *meshes = NULL;
-    unsigned int meshCount = 0;
-
-    tinyobj_material_t *materials = NULL;
-    unsigned int materialCount = 0;
-
-    char *fileText = LoadFileText(fileName);
+    Image *images = (Image *)RL_CALLOC(data->images_count, sizeof(Image));
 
-    if (fileText != NULL)
+    for (unsigned int i = 0; i < data->materials_count; i++)
     {
-        unsigned int dataSize = (unsigned int)strlen(fileText);
-        char currentDir[1024] = { 0 };
-        strcpy(currentDir, GetWorkingDirectory());
-        const char *workingDir = GetDirectoryPath(fileName);
-        if (CHDIR(workingDir) != 0)
+        const cgltf_material *material = &data->materials[i];
+        if (!material->has_pbr_metallic_roughness) continue;
+
+        const cgltf_texture *textures[5] = {
+            material->pbr_metallic_roughness.base_color_texture.texture,
+            material->pbr_metallic_roughness.metallic_roughness_texture.texture,
+            material->normal_texture.texture,
+            material->occlusion_texture.texture,
+            material->emissive_texture.texture
+        };
+
+        for (int t = 0; t < 5; t++)
         {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+            if ((textures[t] != NULL) && (textures[t]->image != NULL)) uses[textures[t]->image - data->images]++;
         }
+    }
 
-        unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+    bool *decode = (bool *)RL_CALLOC(data->images_count + 1, sizeof(bool));
 
-        if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
-        else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
+    for (unsigned int i = 0; i < data->images_count; i++)
+    {
+        decode[i] = (uses[i] > 0);
+#if defined(SUPPORT_RESOURCE_CACHE)
+        if (decode[i] && (keys != NULL)) decode[i] = !IsResourceCached(RESOURCE_TEXTURE, keys[i]);
+#endif
+    }
 
-        model.meshCount = materialCount;
+#if defined(SUPPORT_ASYNC_LOADING)
+    if (parallel)
+    {
+        unsigned int *handles = (unsigned int *)RL_CALLOC(data->images_count, sizeof(unsigned int));
 
-        // Init model materials array
-        if (materialCount > 0)
+        for (unsigned int i = 0; i < data->images_count; i++)
         {
-            model.materialCount = materialCount;
-            model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-            TraceLog(LOG_INFO, "MODEL: model has %i material meshes", materialCount);
+            if (!decode[i]) continue;
+
+            GLTFImageLoadJob *job = (GLTFImageLoadJob *)RL_CALLOC(1, sizeof(GLTFImageLoadJob));
+            job->cgltfImage = &data->images[i];
+            strncpy(job->texPath, texPath, sizeof(job->texPath) - 1);
+
+            handles[i] = SubmitAsyncJob(ASYNC_JOB_IMAGE, job, DecodeGLTFImageJob, NULL);
         }
-        else
+
+        for (unsigned int i = 0; i < data->images_count; i++)
         {
-            model.meshCount = 1;
-            TraceLog(LOG_INFO, "MODEL: No materials, putting all meshes in a default material");
-        }
+            if (handles[i] == 0) continue;
 
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+            GLTFImageLoadJob *job = (GLTFImageLoadJob *)GetAsyncJobData(handles[i], ASYNC_JOB_IMAGE);
+            if (job != NULL) images[i] = job->image;
 
-        // Count the faces for each material
-        int *matFaces = RL_CALLOC(model.meshCount, sizeof(int));
+            ReleaseAsyncJob(handles[i]);
+        }
 
-        // iff no materials are present use all faces on one mesh
-        if (materialCount > 0)
+        // Async jobs slots not available, remaining images are decoded on this thread
+        for (unsigned int i = 0; i < data->images_count; i++)
         {
-            for (unsigned int fi = 0; fi < attrib.num_faces; fi++)
-            {
-                //tinyobj_vertex_index_t face = attrib.faces[fi];
-                int idx = attrib.material_ids[fi];
-                matFaces[idx]++;
-            }
-
+            if (decode[i] && (handles[i] == 0)) images[i] = LoadImageFromCgltfImage(&data->images[i], texPath);
         }
-        else
+
+        RL_FREE(handles);
+    }
+    else
+#endif
+    {
+        for (unsigned int i = 0; i < data->images_count; i++)
         {
-            matFaces[0] = attrib.num_faces;
+            if (decode[i]) images[i] = LoadImageFromCgltfImage(&data->images[i], texPath);
         }
+    }
 
-        //--------------------------------------
-        // Create the material meshes
+    RL_FREE(decode);
 
-        // Running counts/indexes for each material mesh as we are
-        // building them at the same time
-        int *vCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *vtCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *vnCount = RL_CALLOC(model.meshCount, sizeof(int));
-        int *faceCount = RL_CALLOC(model.meshCount, sizeof(int));
+    return images;
+}
 
-        // Allocate space for each of the material meshes
-        for (int mi = 0; mi < model.meshCount; mi++)
-        {
-            model.meshes[mi].vertexCount = matFaces[mi]*3;
-            model.meshes[mi].triangleCount = matFaces[mi];
-            model.meshes[mi].vertices = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshes[mi].texcoords = (float *)RL_CALLOC(model.meshes[mi].vertexCount*2, sizeof(float));
-            model.meshes[mi].normals = (float *)RL_CALLOC(model.meshes[mi].vertexCount*3, sizeof(float));
-            model.meshMaterial[mi] = mi;
-        }
+// Get glTF material texture image, last texture using the image takes its ownership
+static Image GetGLTFTextureImage(cgltf_data *data, const cgltf_texture *texture, Image *images, int *uses)
+{
+    Image image = { 0 };
 
-        // Scan through the combined sub meshes and pick out each material mesh
-        for (unsigned int af = 0; af < attrib.num_faces; af++)
-        {
-            int mm = attrib.material_ids[af];   // mesh material for this face
-            if (mm == -1) { mm = 0; }           // no material object..
+    if (texture->image != NULL)
+    {
+        int index = (int)(texture->image - data->images);
 
-            // Get indices for the face
-            tinyobj_vertex_index_t idx0 = attrib.faces[3*af + 0];
-            tinyobj_vertex_index_t idx1 = attrib.faces[3*af + 1];
-            tinyobj_vertex_index_t idx2 = attrib.faces[3*af + 2];
+        uses[index]--;
+        image = (uses[index] > 0)? ImageCopy(images[index]) : images[index];
+    }
 
-            // Fill vertices buffer (float) using vertex index of the face
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx0.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx1.v_idx*3 + v]; } vCount[mm] +=3;
-            for (int v = 0; v < 3; v++) { model.meshes[mm].vertices[vCount[mm] + v] = attrib.vertices[idx2.v_idx*3 + v]; } vCount[mm] +=3;
+    return image;
+}
 
-            if (attrib.num_texcoords > 0)
-            {
-                // Fill texcoords buffer (float) using vertex index of the face
-                // NOTE: Y-coordinate must be flipped upside-down to account for
-                // raylib's upside down textures...
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx0.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx0.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx1.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx1.vt_idx*2 + 1]; vtCount[mm] += 2;
-                model.meshes[mm].texcoords[vtCount[mm] + 0] = attrib.texcoords[idx2.vt_idx*2 + 0];
-                model.meshes[mm].texcoords[vtCount[mm] + 1] = 1.0f - attrib.texcoords[idx2.vt_idx*2 + 1]; vtCount[mm] += 2;
-            }
+// Load glTF material map texture from its image (or queue it for later upload)
+// NOTE: If image cache keys are provided (not queued), cached textures are shared and image uploaded once
+static void LoadGLTFTexture(Model *model, int material, int map, cgltf_data *data, const cgltf_texture *texture, Image *images, char (*keys)[512], int *uses, ModelTextureQueue *queue)
+{
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if ((keys != NULL) && (queue == NULL) && (texture->image != NULL))
+    {
+        int index = (int)(texture->image - data->images);
+        Texture2D *mapTexture = &model->materials[material].maps[map].texture;
 
-            if (attrib.num_normals > 0)
-            {
-                // Fill normals buffer (float) using vertex index of the face
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx0.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx1.vn_idx*3 + v]; } vnCount[mm] +=3;
-                for (int v = 0; v < 3; v++) { model.meshes[mm].normals[vnCount[mm] + v] = attrib.normals[idx2.vn_idx*3 + v]; } vnCount[mm] +=3;
-            }
+        if (!LoadCachedResource(RESOURCE_TEXTURE, keys[index], mapTexture, sizeof(Texture2D)) && (images[index].data != NULL))
+        {
+            *mapTexture = LoadTextureFromImage(images[index]);
+            if (mapTexture->id > 0) CacheResource(RESOURCE_TEXTURE, keys[index], mapTexture, sizeof(Texture2D), mapTexture->id);
         }
 
-        // Init model materials
-        for (unsigned int m = 0; m < materialCount; m++)
-        {
-            // Init material to default
-            // NOTE: Uses default shader, which only supports MATERIAL_MAP_DIFFUSE
-            model.materials[m] = LoadMaterialDefault();
+        // Last texture using the image releases it
+        uses[index]--;
+        if (uses[index] == 0) UnloadImage(images[index]);
 
-            // Get default texture, in case no texture is defined
-            // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
-            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        return;
+    }
+#endif
 
-            if (materials[m].diffuse_texname != NULL) model.materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(materials[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+    Image image = GetGLTFTextureImage(data, texture, images, uses);
+    LoadModelTexture(model, material, map, image, queue);
+}
 
-            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(materials[m].diffuse[0]*255.0f), (unsigned char)(materials[m].diffuse[1]*255.0f), (unsigned char)(materials[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
-            model.materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
+// Check glTF accessor elements are inside its buffer view data (buffer view data available)
+static bool CheckGLTFAccessorData(const cgltf_accessor *accessor)
+{
+    if ((accessor->buffer_view == NULL) || (accessor->count == 0)) return false;
+    if (cgltf_buffer_view_data(accessor->buffer_view) == NULL) return false;
 
-            if (materials[m].specular_texname != NULL) model.materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(materials[m].specular_texname);  //char *specular_texname; // map_Ks
-            model.materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(materials[m].specular[0]*255.0f), (unsigned char)(materials[m].specular[1]*255.0f), (unsigned char)(materials[m].specular[2]*255.0f), 255 }; //float specular[3];
-            model.materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
+    cgltf_size elementSize = cgltf_calc_size(accessor->type, accessor->component_type);
 
-            if (materials[m].bump_texname != NULL) model.materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(materials[m].bump_texname);  //char *bump_texname; // map_bump, bump
-            model.materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
-            model.materials[m].maps[MATERIAL_MAP_NORMAL].value = materials[m].shininess;
+    return ((accessor->offset + accessor->stride*(accessor->count - 1) + elementSize) <= accessor->buffer_view->size);
+}
 
-            model.materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(materials[m].emission[0]*255.0f), (unsigned char)(materials[m].emission[1]*255.0f), (unsigned char)(materials[m].emission[2]*255.0f), 255 }; //float emission[3];
+// Load glTF node and its children into scene, mesh nodes reference model meshes range
+// NOTE: Nodes are added parents first (scene nodes order), node matrices are decomposed into translation, rotation and scale
+static void LoadGLTFSceneNode(const cgltf_data *data, const cgltf_node *gltfNode, int parent, const int *firstMesh, Scene *scene, SceneModel *sceneModel)
+{
+    Transform transform = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
 
-            if (materials[m].displacement_texname != NULL) model.materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(materials[m].displacement_texname);  //char *displacement_texname; // disp
-        }
+    if (gltfNode->has_matrix)
+    {
+        const float *m = gltfNode->matrix;     // Column-major
+        Vector3 scale = { sqrtf(m[0]*m[0] + m[1]*m[1] + m[2]*m[2]), sqrtf(m[4]*m[4] + m[5]*m[5] + m[6]*m[6]), sqrtf(m[8]*m[8] + m[9]*m[9] + m[10]*m[10]) };
+        Vector3 axisScale = { (scale.x > 0.0f)? 1.0f/scale.x : 0.0f, (scale.y > 0.0f)? 1.0f/scale.y : 0.0f, (scale.z > 0.0f)? 1.0f/scale.z : 0.0f };
+
+        Matrix rotation = {
+            m[0]*axisScale.x, m[4]*axisScale.y, m[8]*axisScale.z, 0.0f,
+            m[1]*axisScale.x, m[5]*axisScale.y, m[9]*axisScale.z, 0.0f,
+            m[2]*axisScale.x, m[6]*axisScale.y, m[10]*axisScale.z, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
 
-        tinyobj_attrib_free(&attrib);
-        tinyobj_shapes_free(meshes, meshCount);
-        tinyobj_materials_free(materials, materialCount);
+        transform.translation = (Vector3){ m[12], m[13], m[14] };
+        transform.rotation = QuaternionFromMatrix(rotation);
+        transform.scale = scale;
+    }
+    else
+    {
+        if (gltfNode->has_translation) transform.translation = (Vector3){ gltfNode->translation[0], gltfNode->translation[1], gltfNode->translation[2] };
+        if (gltfNode->has_rotation) transform.rotation = (Quaternion){ gltfNode->rotation[0], gltfNode->rotation[1], gltfNode->rotation[2], gltfNode->rotation[3] };
+        if (gltfNode->has_scale) transform.scale = (Vector3){ gltfNode->scale[0], gltfNode->scale[1], gltfNode->scale[2] };
+    }
 
-        UnloadFileText(fileText);
+    int node = AddSceneNode(scene, parent, transform);
+    if (node < 0) return;
 
-        RL_FREE(matFaces);
-        RL_FREE(vCount);
-        RL_FREE(vtCount);
-        RL_FREE(vnCount);
-        RL_FREE(faceCount);
+    if (gltfNode->mesh != NULL)
+    {
+        int mesh = (int)(gltfNode->mesh - data->meshes);
+        SceneModelNode *meshNode = &sceneModel->nodes[sceneModel->nodeCount];
 
-        if (CHDIR(currentDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
-        }
+        meshNode->node = node;
+        meshNode->firstMesh = firstMesh[mesh];
+        meshNode->meshCount = firstMesh[mesh + 1] - firstMesh[mesh];
+        meshNode->instanceCount = LoadGLTFNodeInstances(data, gltfNode, &meshNode->instanceTransforms);
+
+        if (meshNode->instanceCount > 0) meshNode->instances = LoadInstanceBuffer(meshNode->instanceCount);
+
+        sceneModel->nodeCount++;
     }
 
-    return model;
+    for (unsigned int c = 0; c < gltfNode->children_count; c++) LoadGLTFSceneNode(data, gltfNode->children[c], node, firstMesh, scene, sceneModel);
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_IQM)
-// Load IQM mesh data
-static Model LoadIQM(const char *fileName)
+// Load glTF node instances transforms from EXT_mesh_gpu_instancing attributes (TRANSLATION, ROTATION, SCALE accessors)
+// NOTE: Extension data is not parsed by cgltf, accessors indices are read from extension JSON
+static int LoadGLTFNodeInstances(const cgltf_data *data, const cgltf_node *gltfNode, Matrix **transforms)
 {
-    #define IQM_MAGIC     "INTERQUAKEMODEL" // IQM file magic number
-    #define IQM_VERSION          2          // only IQM version 2 supported
+    const char *json = NULL;
 
-    #define BONE_NAME_LENGTH    32          // BoneInfo name string length
-    #define MESH_NAME_LENGTH    32          // Mesh name string length
-    #define MATERIAL_NAME_LENGTH 32         // Material name string length
+    for (unsigned int e = 0; e < gltfNode->extensions_count; e++)
+    {
+        if ((gltfNode->extensions[e].name != NULL) && (strcmp(gltfNode->extensions[e].name, "EXT_mesh_gpu_instancing") == 0)) json = gltfNode->extensions[e].data;
+    }
 
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+    if (json == NULL) return 0;
 
-    // IQM file structs
-    //-----------------------------------------------------------------------------------
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+    const char *attributes[3] = { "\"TRANSLATION\"", "\"ROTATION\"", "\"SCALE\"" };
+    const int components[3] = { 3, 4, 3 };
+    float *values[3] = { NULL };
+    int count = -1;
+    bool valid = true;
 
-    typedef struct IQMMesh {
-        unsigned int name;
-        unsigned int material;
-        unsigned int first_vertex, num_vertexes;
-        unsigned int first_triangle, num_triangles;
-    } IQMMesh;
+    for (int a = 0; (a < 3) && valid; a++)
+    {
+        const char *attribute = strstr(json, attributes[a]);
+        if (attribute == NULL) continue;
 
-    typedef struct IQMTriangle {
-        unsigned int vertex[3];
-    } IQMTriangle;
+        attribute = strchr(attribute, ':');
+        int index = (attribute != NULL)? atoi(attribute + 1) : -1;
 
-    typedef struct IQMJoint {
-        unsigned int name;
-        int parent;
-        float translate[3], rotate[4], scale[3];
-    } IQMJoint;
+        if ((index < 0) || (index >= (int)data->accessors_count) || ((count != -1) && ((int)data->accessors[index].count != count)))
+        {
+            valid = false;
+            break;
+        }
 
-    typedef struct IQMVertexArray {
-        unsigned int type;
-        unsigned int flags;
-        unsigned int format;
-        unsigned int size;
-        unsigned int offset;
-    } IQMVertexArray;
+        count = (int)data->accessors[index].count;
+        values[a] = (float *)RL_MALLOC(count*components[a]*sizeof(float));
 
-    // NOTE: Below IQM structures are not used but listed for reference
-    /*
-    typedef struct IQMAdjacency {
-        unsigned int triangle[3];
-    } IQMAdjacency;
+        if (!LoadGLTFAccessorFloats(&data->accessors[index], values[a], components[a])) valid = false;
+    }
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+    if (valid && (count > 0))
+    {
+        *transforms = (Matrix *)RL_MALLOC(count*sizeof(Matrix));
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+        for (int i = 0; i < count; i++)
+        {
+            // Instance transform (scale -> rotation -> translation)
+            Matrix matScale = (values[2] != NULL)? MatrixScale(values[2][i*3], values[2][i*3 + 1], values[2][i*3 + 2]) : MatrixIdentity();
+            Matrix matRotation = (values[1] != NULL)? QuaternionToMatrix((Quaternion){ values[1][i*4], values[1][i*4 + 1], values[1][i*4 + 2], values[1][i*4 + 3] }) : MatrixIdentity();
+            Matrix matTranslation = (values[0] != NULL)? MatrixTranslate(values[0][i*3], values[0][i*3 + 1], values[0][i*3 + 2]) : MatrixIdentity();
 
-    typedef struct IQMBounds {
-        float bbmin[3], bbmax[3];
-        float xyradius, radius;
-    } IQMBounds;
-    */
-    //-----------------------------------------------------------------------------------
+            (*transforms)[i] = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+        }
+    }
+    else
+    {
+        if (!valid) TRACELOG(LOG_WARNING, "MODEL: Node instances (EXT_mesh_gpu_instancing) data not valid, node not instanced");
+        count = 0;
+    }
 
-    // IQM vertex data types
-    enum {
-        IQM_POSITION     = 0,
-        IQM_TEXCOORD     = 1,
-        IQM_NORMAL       = 2,
-        IQM_TANGENT      = 3,       // NOTE: Tangents unused by default
-        IQM_BLENDINDEXES = 4,
-        IQM_BLENDWEIGHTS = 5,
-        IQM_COLOR        = 6,
-        IQM_CUSTOM       = 0x10     // NOTE: Custom vertex values unused by default
-    };
+    for (int a = 0; a < 3; a++) RL_FREE(values[a]);
 
-    Model model = { 0 };
+    return count;
+}
 
-    IQMMesh *imesh = NULL;
-    IQMTriangle *tri = NULL;
-    IQMVertexArray *va = NULL;
-    IQMJoint *ijoint = NULL;
+// Apply glTF mesh node world transform to mesh vertices, normals and tangents
+// NOTE: Used for quantized meshes (KHR_mesh_quantization), dequantization scale and offset are stored as node transform
+static void TransformGLTFMesh(cgltf_data *data, const cgltf_mesh *gltfMesh, Mesh *mesh)
+{
+    const cgltf_node *node = NULL;
 
-    float *vertex = NULL;
-    float *normal = NULL;
-    float *text = NULL;
-    char *blendi = NULL;
-    unsigned char *blendw = NULL;
-    unsigned char *color = NULL;
+    for (unsigned int n = 0; n < data->nodes_count; n++)
+    {
+        if (data->nodes[n].mesh == gltfMesh)
+        {
+            node = &data->nodes[n];
+            break;
+        }
+    }
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return model;
+    if ((node == NULL) || (mesh->vertices == NULL)) return;
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    float m[16] = { 0 };    // Column-major
+    cgltf_node_transform_world(node, m);
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    for (int v = 0; v < mesh->vertexCount; v++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return model;
+        float *p = &mesh->vertices[v*3];
+        float x = p[0], y = p[1], z = p[2];
+
+        p[0] = m[0]*x + m[4]*y + m[8]*z + m[12];
+        p[1] = m[1]*x + m[5]*y + m[9]*z + m[13];
+        p[2] = m[2]*x + m[6]*y + m[10]*z + m[14];
+
+        // Normals are transformed by the cofactor matrix (inverse transpose scaled by determinant)
+        if (mesh->normals != NULL)
+        {
+            float *n = &mesh->normals[v*3];
+            x = n[0], y = n[1], z = n[2];
+
+            n[0] = (m[5]*m[10] - m[6]*m[9])*x + (m[9]*m[2] - m[10]*m[1])*y + (m[1]*m[6] - m[2]*m[5])*z;
+            n[1] = (m[6]*m[8] - m[4]*m[10])*x + (m[10]*m[0] - m[8]*m[2])*y + (m[2]*m[4] - m[0]*m[6])*z;
+            n[2] = (m[4]*m[9] - m[5]*m[8])*x + (m[8]*m[1] - m[9]*m[0])*y + (m[0]*m[5] - m[1]*m[4])*z;
+
+            float length = sqrtf(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+            if (length > 0.0f) { n[0] /= length; n[1] /= length; n[2] /= length; }
+        }
+
+        // Tangents are transformed as directions, handedness (w) is kept
+        if (mesh->tangents != NULL)
+        {
+            float *t = &mesh->tangents[v*4];
+            x = t[0], y = t[1], z = t[2];
+
+            t[0] = m[0]*x + m[4]*y + m[8]*z;
+            t[1] = m[1]*x + m[5]*y + m[9]*z;
+            t[2] = m[2]*x + m[6]*y + m[10]*z;
+
+            float length = sqrtf(t[0]*t[0] + t[1]*t[1] + t[2]*t[2]);
+            if (length > 0.0f) { t[0] /= length; t[1] /= length; t[2] /= length; }
+        }
     }
 
-    if (iqmHeader->version != IQM_VERSION)
+    // Morph targets positions deltas are transformed by linear part only, normals deltas are kept
+    if (mesh->morphVertices != NULL)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return model;
+        for (int d = 0; d < mesh->vertexCount*mesh->morphTargetCount; d++)
+        {
+            float *p = &mesh->morphVertices[d*3];
+            float x = p[0], y = p[1], z = p[2];
+
+            p[0] = m[0]*x + m[4]*y + m[8]*z;
+            p[1] = m[1]*x + m[5]*y + m[9]*z;
+            p[2] = m[2]*x + m[6]*y + m[10]*z;
+        }
     }
+}
 
-    //fileDataPtr += sizeof(IQMHeader);       // Move file data pointer
+// Load glTF accessor elements into a tightly packed array, elementSize must match accessor elements size
+// NOTE: Tightly packed accessors are copied with a single memcpy() from buffer (or decoded buffer view) data
+static bool LoadGLTFAccessorData(const cgltf_accessor *accessor, void *dst, int elementSize)
+{
+    if (accessor->is_sparse || !CheckGLTFAccessorData(accessor)) return false;
+    if (cgltf_calc_size(accessor->type, accessor->component_type) != (cgltf_size)elementSize) return false;
 
-    // Meshes data processing
-    imesh = RL_MALLOC(iqmHeader->num_meshes*sizeof(IQMMesh));
-    //fseek(iqmFile, iqmHeader->ofs_meshes, SEEK_SET);
-    //fread(imesh, sizeof(IQMMesh)*iqmHeader->num_meshes, 1, iqmFile);
-    memcpy(imesh, fileDataPtr + iqmHeader->ofs_meshes, iqmHeader->num_meshes*sizeof(IQMMesh));
+    const unsigned char *src = cgltf_buffer_view_data(accessor->buffer_view) + accessor->offset;
 
-    model.meshCount = iqmHeader->num_meshes;
-    model.meshes = RL_CALLOC(model.meshCount, sizeof(Mesh));
+    if (accessor->stride == (cgltf_size)elementSize) memcpy(dst, src, accessor->count*elementSize);
+    else
+    {
+        for (unsigned int k = 0; k < accessor->count; k++) memcpy((unsigned char *)dst + k*elementSize, src + k*accessor->stride, elementSize);
+    }
 
-    model.materialCount = model.meshCount;
-    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    return true;
+}
 
-    char name[MESH_NAME_LENGTH] = { 0 };
-    char material[MATERIAL_NAME_LENGTH] = { 0 };
+// Load glTF accessor elements into a tightly packed floats array, numComp must match accessor type
+// NOTE: Quantized accessors (KHR_mesh_quantization) and sparse accessors are converted per element
+static bool LoadGLTFAccessorFloats(const cgltf_accessor *accessor, float *dst, int numComp)
+{
+    if ((int)cgltf_num_components(accessor->type) != numComp) return false;
 
-    for (int i = 0; i < model.meshCount; i++)
-    {
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].name, SEEK_SET);
-        //fread(name, sizeof(char)*MESH_NAME_LENGTH, 1, iqmFile);
-        memcpy(name, fileDataPtr + iqmHeader->ofs_text + imesh[i].name, MESH_NAME_LENGTH*sizeof(char));
+    if ((accessor->component_type == cgltf_component_type_r_32f) && LoadGLTFAccessorData(accessor, dst, numComp*sizeof(float))) return true;
 
-        //fseek(iqmFile, iqmHeader->ofs_text + imesh[i].material, SEEK_SET);
-        //fread(material, sizeof(char)*MATERIAL_NAME_LENGTH, 1, iqmFile);
-        memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
+    // NOTE: cgltf reads accessors elements unchecked, sparse accessors values are not checked
+    if (!accessor->is_sparse && !CheckGLTFAccessorData(accessor)) return false;
 
-        model.materials[i] = LoadMaterialDefault();
+    return (cgltf_accessor_unpack_floats(accessor, dst, accessor->count*numComp) == accessor->count*numComp);
+}
 
-        TRACELOG(LOG_DEBUG, "MODEL: [%s] mesh name (%s), material (%s)", fileName, name, material);
+// Load glTF primitive morph targets positions and normals deltas, default weights from glTF mesh
+// NOTE: Deltas are stored by vertex (all targets of a vertex together), tangents deltas not supported
+static void LoadGLTFMorphTargets(const cgltf_mesh *gltfMesh, const cgltf_primitive *primitive, Mesh *mesh)
+{
+    int targetCount = (int)primitive->targets_count;
+    if ((targetCount == 0) || (mesh->vertices == NULL)) return;
 
-        model.meshes[i].vertexCount = imesh[i].num_vertexes;
+    mesh->morphTargetCount = targetCount;
+    mesh->morphVertices = (float *)RL_CALLOC(mesh->vertexCount*targetCount*3, sizeof(float));
+    if (mesh->normals != NULL) mesh->morphNormals = (float *)RL_CALLOC(mesh->vertexCount*targetCount*3, sizeof(float));
+    mesh->morphWeights = (float *)RL_CALLOC(targetCount, sizeof(float));
 
-        model.meshes[i].vertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));       // Default vertex positions
-        model.meshes[i].normals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));        // Default vertex normals
-        model.meshes[i].texcoords = RL_CALLOC(model.meshes[i].vertexCount*2, sizeof(float));      // Default vertex texcoords
+    float *deltas = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
 
-        model.meshes[i].boneIds = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(unsigned char));  // Up-to 4 bones supported!
-        model.meshes[i].boneWeights = RL_CALLOC(model.meshes[i].vertexCount*4, sizeof(float));      // Up-to 4 bones supported!
+    for (int t = 0; t < targetCount; t++)
+    {
+        for (unsigned int j = 0; j < primitive->targets[t].attributes_count; j++)
+        {
+            const cgltf_attribute *attribute = &primitive->targets[t].attributes[j];
+            float *dst = NULL;
 
-        model.meshes[i].triangleCount = imesh[i].num_triangles;
-        model.meshes[i].indices = RL_CALLOC(model.meshes[i].triangleCount*3, sizeof(unsigned short));
+            if (attribute->type == cgltf_attribute_type_position) dst = mesh->morphVertices;
+            else if (attribute->type == cgltf_attribute_type_normal) dst = mesh->morphNormals;
 
-        // Animated verted data, what we actually process for rendering
-        // NOTE: Animated vertex should be re-uploaded to GPU (if not using GPU skinning)
-        model.meshes[i].animVertices = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
-        model.meshes[i].animNormals = RL_CALLOC(model.meshes[i].vertexCount*3, sizeof(float));
+            if (dst == NULL) continue;
+
+            if ((attribute->data->count != (cgltf_size)mesh->vertexCount) || !LoadGLTFAccessorFloats(attribute->data, deltas, 3))
+            {
+                TRACELOG(LOG_WARNING, "MODEL: Morph target attribute data format not supported, use vec3");
+                continue;
+            }
+
+            for (int v = 0; v < mesh->vertexCount; v++) memcpy(&dst[(v*targetCount + t)*3], &deltas[v*3], 3*sizeof(float));
+        }
     }
 
-    // Triangles data processing
-    tri = RL_MALLOC(iqmHeader->num_triangles*sizeof(IQMTriangle));
-    //fseek(iqmFile, iqmHeader->ofs_triangles, SEEK_SET);
-    //fread(tri, iqmHeader->num_triangles*sizeof(IQMTriangle), 1, iqmFile);
-    memcpy(tri, fileDataPtr + iqmHeader->ofs_triangles, iqmHeader->num_triangles*sizeof(IQMTriangle));
+    RL_FREE(deltas);
+
+    for (int t = 0; (t < targetCount) && (t < (int)gltfMesh->weights_count); t++) mesh->morphWeights[t] = gltfMesh->weights[t];
+}
+
+// Load glTF morph targets weights animations, sampled at GLTF_ANIMATION_FRAMERATE
+// NOTE: Weights are stored for every model mesh (triangle primitives), cubic spline interpolation is sampled linearly
+static MorphAnimation *LoadMorphAnimationsGLTF(const char *fileName, unsigned int *animCount)
+{
+    MorphAnimation *animations = NULL;
 
-    for (int m = 0; m < model.meshCount; m++)
+    unsigned int dataSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &dataSize);
+
+    if (fileData == NULL) return animations;
+
+    cgltf_options options = { 0 };
+    options.file.read = LoadFileGLTFCallback;
+    options.file.release = ReleaseFileGLTFCallback;
+    cgltf_data *data = NULL;
+    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+
+    if (result == cgltf_result_success)
     {
-        int tcounter = 0;
+        result = cgltf_load_buffers(&options, data, fileName);
+        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
 
-        for (unsigned int i = imesh[m].first_triangle; i < (imesh[m].first_triangle + imesh[m].num_triangles); i++)
+        if (!DecodeGLTFMeshopt(data)) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to decode meshopt compressed buffers", fileName);
+
+        // Map glTF meshes to model meshes, every triangles primitive is loaded as a mesh (LoadGLTF())
+        int *firstMesh = (int *)RL_CALLOC(data->meshes_count + 1, sizeof(int));
+        int meshCount = 0;
+        int targetCount = 0;
+
+        for (unsigned int i = 0; i < data->meshes_count; i++)
         {
-            // IQM triangles indexes are stored in counter-clockwise, but raylib processes the index in linear order,
-            // expecting they point to the counter-clockwise vertex triangle, so we need to reverse triangle indexes
-            // NOTE: raylib renders vertex data in counter-clockwise order (standard convention) by default
-            model.meshes[m].indices[tcounter + 2] = tri[i].vertex[0] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter + 1] = tri[i].vertex[1] - imesh[m].first_vertex;
-            model.meshes[m].indices[tcounter] = tri[i].vertex[2] - imesh[m].first_vertex;
-            tcounter += 3;
+            firstMesh[i] = meshCount;
+
+            for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+            {
+                if (data->meshes[i].primitives[p].type != cgltf_primitive_type_triangles) continue;
+
+                if ((int)data->meshes[i].primitives[p].targets_count > targetCount) targetCount = (int)data->meshes[i].primitives[p].targets_count;
+                meshCount++;
+            }
         }
-    }
 
-    // Vertex arrays data processing
-    va = RL_MALLOC(iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
-    //fseek(iqmFile, iqmHeader->ofs_vertexarrays, SEEK_SET);
-    //fread(va, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray), 1, iqmFile);
-    memcpy(va, fileDataPtr + iqmHeader->ofs_vertexarrays, iqmHeader->num_vertexarrays*sizeof(IQMVertexArray));
+        firstMesh[data->meshes_count] = meshCount;
 
-    for (unsigned int i = 0; i < iqmHeader->num_vertexarrays; i++)
-    {
-        switch (va[i].type)
+        // Only animations with weights channels are loaded
+        int count = 0;
+
+        for (unsigned int a = 0; a < data->animations_count; a++)
         {
-            case IQM_POSITION:
+            for (unsigned int c = 0; c < data->animations[a].channels_count; c++)
             {
-                vertex = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(vertex, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(vertex, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+                const cgltf_animation_channel *channel = &data->animations[a].channels[c];
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                if ((channel->target_path == cgltf_animation_path_type_weights) && (channel->target_node != NULL) && (channel->target_node->mesh != NULL))
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].vertices[vCounter] = vertex[i];
-                        model.meshes[m].animVertices[vCounter] = vertex[i];
-                        vCounter++;
-                    }
+                    count++;
+                    break;
                 }
-            } break;
-            case IQM_NORMAL:
-            {
-                normal = RL_MALLOC(iqmHeader->num_vertexes*3*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(normal, iqmHeader->num_vertexes*3*sizeof(float), 1, iqmFile);
-                memcpy(normal, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*3*sizeof(float));
+            }
+        }
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*3; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*3; i++)
-                    {
-                        model.meshes[m].normals[vCounter] = normal[i];
-                        model.meshes[m].animNormals[vCounter] = normal[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-            case IQM_TEXCOORD:
+        if ((count > 0) && (meshCount > 0) && (targetCount > 0))
+        {
+            animations = (MorphAnimation *)RL_CALLOC(count, sizeof(MorphAnimation));
+
+            for (unsigned int a = 0, k = 0; (a < data->animations_count) && (k < (unsigned int)count); a++)
             {
-                text = RL_MALLOC(iqmHeader->num_vertexes*2*sizeof(float));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(text, iqmHeader->num_vertexes*2*sizeof(float), 1, iqmFile);
-                memcpy(text, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*2*sizeof(float));
+                const cgltf_animation *gltfAnim = &data->animations[a];
+                float duration = 0.0f;
+                bool weighted = false;
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                for (unsigned int c = 0; c < gltfAnim->channels_count; c++)
                 {
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*2; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*2; i++)
-                    {
-                        model.meshes[m].texcoords[vCounter] = text[i];
-                        vCounter++;
-                    }
+                    const cgltf_animation_channel *channel = &gltfAnim->channels[c];
+                    if ((channel->target_path != cgltf_animation_path_type_weights) || (channel->target_node == NULL) || (channel->target_node->mesh == NULL)) continue;
+
+                    const cgltf_accessor *input = channel->sampler->input;
+                    float time = 0.0f;
+
+                    if ((input->count > 0) && cgltf_accessor_read_float(input, input->count - 1, &time, 1) && (time > duration)) duration = time;
+                    weighted = true;
                 }
-            } break;
-            case IQM_BLENDINDEXES:
-            {
-                blendi = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendi, iqmHeader->num_vertexes*4*sizeof(char), 1, iqmFile);
-                memcpy(blendi, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                if (!weighted) continue;
+
+                MorphAnimation *anim = &animations[k++];
+                anim->meshCount = meshCount;
+                anim->targetCount = targetCount;
+                anim->frameCount = (int)(duration*GLTF_ANIMATION_FRAMERATE) + 1;
+                anim->weights = (float *)RL_CALLOC(anim->frameCount*meshCount*targetCount, sizeof(float));
+                if (gltfAnim->name != NULL) strncpy(anim->name, gltfAnim->name, sizeof(anim->name) - 1);
+
+                // Meshes not animated keep their default weights
+                for (int f = 0; f < anim->frameCount; f++)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    for (unsigned int i = 0; i < data->meshes_count; i++)
                     {
-                        model.meshes[m].boneIds[boneCounter] = blendi[i];
-                        boneCounter++;
+                        for (int m = firstMesh[i]; m < firstMesh[i + 1]; m++)
+                        {
+                            for (int t = 0; (t < targetCount) && (t < (int)data->meshes[i].weights_count); t++)
+                            {
+                                anim->weights[(f*meshCount + m)*targetCount + t] = data->meshes[i].weights[t];
+                            }
+                        }
                     }
                 }
-            } break;
-            case IQM_BLENDWEIGHTS:
-            {
-                blendw = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(blendw, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
+                for (unsigned int c = 0; c < gltfAnim->channels_count; c++)
                 {
-                    int boneCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    const cgltf_animation_channel *channel = &gltfAnim->channels[c];
+                    if ((channel->target_path != cgltf_animation_path_type_weights) || (channel->target_node == NULL) || (channel->target_node->mesh == NULL)) continue;
+
+                    const cgltf_accessor *input = channel->sampler->input;
+                    const cgltf_accessor *output = channel->sampler->output;
+                    int mesh = (int)(channel->target_node->mesh - data->meshes);
+                    int values = (channel->sampler->interpolation == cgltf_interpolation_type_cubic_spline)? 3 : 1;   // Cubic spline: in-tangent, value, out-tangent
+                    int keyCount = (int)input->count;
+                    int weightCount = (keyCount > 0)? (int)(output->count/(keyCount*values)) : 0;
+
+                    if ((weightCount == 0) || !CheckGLTFAccessorData(input) || !CheckGLTFAccessorData(output))
                     {
-                        model.meshes[m].boneWeights[boneCounter] = blendw[i]/255.0f;
-                        boneCounter++;
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Morph weights animation channel data not valid", fileName);
+                        continue;
                     }
-                }
-            } break;
-            case IQM_COLOR:
-            {
-                color = RL_MALLOC(iqmHeader->num_vertexes*4*sizeof(unsigned char));
-                //fseek(iqmFile, va[i].offset, SEEK_SET);
-                //fread(blendw, iqmHeader->num_vertexes*4*sizeof(unsigned char), 1, iqmFile);
-                memcpy(color, fileDataPtr + va[i].offset, iqmHeader->num_vertexes*4*sizeof(unsigned char));
 
-                for (unsigned int m = 0; m < iqmHeader->num_meshes; m++)
-                {
-                    model.meshes[m].colors = RL_CALLOC(model.meshes[m].vertexCount*4, sizeof(unsigned char));
+                    if (weightCount > targetCount) weightCount = targetCount;
 
-                    int vCounter = 0;
-                    for (unsigned int i = imesh[m].first_vertex*4; i < (imesh[m].first_vertex + imesh[m].num_vertexes)*4; i++)
+                    for (int f = 0, key = 0; f < anim->frameCount; f++)
                     {
-                        model.meshes[m].colors[vCounter] = color[i];
-                        vCounter++;
-                    }
-                }
-            } break;
-        }
-    }
+                        float time = (float)f/GLTF_ANIMATION_FRAMERATE;
+                        float keyTime = 0.0f;
+                        float nextTime = 0.0f;
 
-    // Bones (joints) data processing
-    ijoint = RL_MALLOC(iqmHeader->num_joints*sizeof(IQMJoint));
-    //fseek(iqmFile, iqmHeader->ofs_joints, SEEK_SET);
-    //fread(ijoint, iqmHeader->num_joints*sizeof(IQMJoint), 1, iqmFile);
-    memcpy(ijoint, fileDataPtr + iqmHeader->ofs_joints, iqmHeader->num_joints*sizeof(IQMJoint));
+                        // Frames time only increases, current key is advanced
+                        while ((key < keyCount - 1) && cgltf_accessor_read_float(input, key + 1, &nextTime, 1) && (nextTime <= time)) key++;
 
-    model.boneCount = iqmHeader->num_joints;
-    model.bones = RL_MALLOC(iqmHeader->num_joints*sizeof(BoneInfo));
-    model.bindPose = RL_MALLOC(iqmHeader->num_joints*sizeof(Transform));
+                        cgltf_accessor_read_float(input, key, &keyTime, 1);
 
-    for (unsigned int i = 0; i < iqmHeader->num_joints; i++)
-    {
-        // Bones
-        model.bones[i].parent = ijoint[i].parent;
-        //fseek(iqmFile, iqmHeader->ofs_text + ijoint[i].name, SEEK_SET);
-        //fread(model.bones[i].name, BONE_NAME_LENGTH*sizeof(char), 1, iqmFile);
-        memcpy(model.bones[i].name, fileDataPtr + iqmHeader->ofs_text + ijoint[i].name, BONE_NAME_LENGTH*sizeof(char));
+                        int next = (key < keyCount - 1)? key + 1 : key;
+                        float amount = 0.0f;
 
-        // Bind pose (base pose)
-        model.bindPose[i].translation.x = ijoint[i].translate[0];
-        model.bindPose[i].translation.y = ijoint[i].translate[1];
-        model.bindPose[i].translation.z = ijoint[i].translate[2];
+                        if ((next != key) && (channel->sampler->interpolation != cgltf_interpolation_type_step))
+                        {
+                            cgltf_accessor_read_float(input, next, &nextTime, 1);
+                            if (nextTime > keyTime) amount = Clamp((time - keyTime)/(nextTime - keyTime), 0.0f, 1.0f);
+                        }
 
-        model.bindPose[i].rotation.x = ijoint[i].rotate[0];
-        model.bindPose[i].rotation.y = ijoint[i].rotate[1];
-        model.bindPose[i].rotation.z = ijoint[i].rotate[2];
-        model.bindPose[i].rotation.w = ijoint[i].rotate[3];
+                        for (int t = 0; t < weightCount; t++)
+                        {
+                            float a = 0.0f;
+                            float b = 0.0f;
 
-        model.bindPose[i].scale.x = ijoint[i].scale[0];
-        model.bindPose[i].scale.y = ijoint[i].scale[1];
-        model.bindPose[i].scale.z = ijoint[i].scale[2];
-    }
+                            cgltf_accessor_read_float(output, (key*values + values/2)*weightCount + t, &a, 1);
+                            cgltf_accessor_read_float(output, (next*values + values/2)*weightCount + t, &b, 1);
 
-    // Build bind pose from parent joints
-    for (int i = 0; i < model.boneCount; i++)
-    {
-        if (model.bones[i].parent >= 0)
-        {
-            model.bindPose[i].rotation = QuaternionMultiply(model.bindPose[model.bones[i].parent].rotation, model.bindPose[i].rotation);
-            model.bindPose[i].translation = Vector3RotateByQuaternion(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].rotation);
-            model.bindPose[i].translation = Vector3Add(model.bindPose[i].translation, model.bindPose[model.bones[i].parent].translation);
-            model.bindPose[i].scale = Vector3Multiply(model.bindPose[i].scale, model.bindPose[model.bones[i].parent].scale);
+                            for (int m = firstMesh[mesh]; m < firstMesh[mesh + 1]; m++) anim->weights[(f*meshCount + m)*targetCount + t] = Lerp(a, b, amount);
+                        }
+                    }
+                }
+            }
+
+            *animCount = (unsigned int)count;
+            TRACELOG(LOG_INFO, "MODEL: [%s] Morph animations loaded successfully (%i)", fileName, count);
         }
-    }
 
-    RL_FREE(fileData);
+        RL_FREE(firstMesh);
+        cgltf_free(data);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
-    RL_FREE(imesh);
-    RL_FREE(tri);
-    RL_FREE(va);
-    RL_FREE(vertex);
-    RL_FREE(normal);
-    RL_FREE(text);
-    RL_FREE(blendi);
-    RL_FREE(blendw);
-    RL_FREE(ijoint);
+    UnloadFileDataView(fileData);
 
-    return model;
+    return animations;
 }
 
-// Load IQM animation data
-static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, unsigned int *animCount)
+// Decode glTF buffer views compressed with EXT_meshopt_compression, decoded data is freed by cgltf_free()
+static bool DecodeGLTFMeshopt(cgltf_data *data)
 {
-    #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
-    #define IQM_VERSION     2                   // only IQM version 2 supported
+    bool success = true;
 
-    unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
-    unsigned char *fileDataPtr = fileData;
+    for (unsigned int i = 0; i < data->buffer_views_count; i++)
+    {
+        cgltf_buffer_view *view = &data->buffer_views[i];
+        if (!view->has_meshopt_compression || (view->data != NULL)) continue;
 
-    typedef struct IQMHeader {
-        char magic[16];
-        unsigned int version;
-        unsigned int filesize;
-        unsigned int flags;
-        unsigned int num_text, ofs_text;
-        unsigned int num_meshes, ofs_meshes;
-        unsigned int num_vertexarrays, num_vertexes, ofs_vertexarrays;
-        unsigned int num_triangles, ofs_triangles, ofs_adjacency;
-        unsigned int num_joints, ofs_joints;
-        unsigned int num_poses, ofs_poses;
-        unsigned int num_anims, ofs_anims;
-        unsigned int num_frames, num_framechannels, ofs_frames, ofs_bounds;
-        unsigned int num_comment, ofs_comment;
-        unsigned int num_extensions, ofs_extensions;
-    } IQMHeader;
+        const cgltf_meshopt_compression *mc = &view->meshopt_compression;
 
-    typedef struct IQMPose {
-        int parent;
-        unsigned int mask;
-        float channeloffset[10];
-        float channelscale[10];
-    } IQMPose;
+        if (mc->buffer->data == NULL)
+        {
+            success = false;
+            continue;
+        }
 
-    typedef struct IQMAnim {
-        unsigned int name;
-        unsigned int first_frame, num_frames;
-        float framerate;
-        unsigned int flags;
-    } IQMAnim;
+        const unsigned char *src = (const unsigned char *)mc->buffer->data + mc->offset;
+        unsigned char *dst = (unsigned char *)RL_MALLOC(mc->count*mc->stride);
+        int result = -1;
 
-    // In case file can not be read, return an empty model
-    if (fileDataPtr == NULL) return NULL;
+        switch (mc->mode)
+        {
+            case cgltf_meshopt_compression_mode_attributes:
+            {
+                result = DecodeMeshoptVertexBuffer(dst, (int)mc->count, (int)mc->stride, src, (int)mc->size);
+                if (result == 0) DecodeMeshoptFilter(dst, (int)mc->count, (int)mc->stride, mc->filter);
+            } break;
+            case cgltf_meshopt_compression_mode_triangles: result = DecodeMeshoptIndexBuffer(dst, (int)mc->count, (int)mc->stride, src, (int)mc->size); break;
+            case cgltf_meshopt_compression_mode_indices: result = DecodeMeshoptIndexSequence(dst, (int)mc->count, (int)mc->stride, src, (int)mc->size); break;
+            default: break;
+        }
 
-    // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+        if (result == 0) view->data = dst;
+        else
+        {
+            RL_FREE(dst);
+            success = false;
+        }
+    }
 
-    if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
+    return success;
+}
+
+// Decode meshopt vertex bytes group (16 bytes), bits per byte: 0, 2, 4 or 8
+// NOTE: Values not fitting in the group bits are stored after the group packed bits
+static const unsigned char *DecodeMeshoptBytesGroup(const unsigned char *data, const unsigned char *dataEnd, unsigned char *dst, int bitsLog2)
+{
+    if (bitsLog2 == 0)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
-        return NULL;
+        memset(dst, 0, 16);
+        return data;
+    }
+
+    if (bitsLog2 == 3)
+    {
+        if ((dataEnd - data) < 16) return NULL;
+
+        memcpy(dst, data, 16);
+        return data + 16;
     }
 
-    if (iqmHeader->version != IQM_VERSION)
+    int bits = (bitsLog2 == 1)? 2 : 4;
+    int packedSize = 2*bits;                // 16 values packed in 4 or 8 bytes
+    unsigned char sentinel = (unsigned char)((1 << bits) - 1);
+    const unsigned char *extra = data + packedSize;
+
+    if ((dataEnd - data) < packedSize) return NULL;
+
+    for (int i = 0; i < 16; i++)
     {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
-        return NULL;
+        // Values are packed from the most significant bits of every byte
+        unsigned char value = (unsigned char)((data[(i*bits)/8] >> (8 - bits - (i*bits)%8)) & sentinel);
+
+        if (value == sentinel)
+        {
+            if (extra >= dataEnd) return NULL;
+            value = *extra++;
+        }
+
+        dst[i] = value;
     }
 
-    // Get bones data
-    IQMPose *poses = RL_MALLOC(iqmHeader->num_poses*sizeof(IQMPose));
-    //fseek(iqmFile, iqmHeader->ofs_poses, SEEK_SET);
-    //fread(poses, iqmHeader->num_poses*sizeof(IQMPose), 1, iqmFile);
-    memcpy(poses, fileDataPtr + iqmHeader->ofs_poses, iqmHeader->num_poses*sizeof(IQMPose));
+    return extra;
+}
 
-    // Get animations data
-    *animCount = iqmHeader->num_anims;
-    IQMAnim *anim = RL_MALLOC(iqmHeader->num_anims*sizeof(IQMAnim));
-    //fseek(iqmFile, iqmHeader->ofs_anims, SEEK_SET);
-    //fread(anim, iqmHeader->num_anims*sizeof(IQMAnim), 1, iqmFile);
-    memcpy(anim, fileDataPtr + iqmHeader->ofs_anims, iqmHeader->num_anims*sizeof(IQMAnim));
+// Decode meshopt vertex buffer (EXT_meshopt_compression attributes mode), returns 0 on success
+// NOTE: Every vertex byte is delta encoded (zigzag) to the same byte of previous vertex, in blocks of vertices
+static int DecodeMeshoptVertexBuffer(unsigned char *dst, int count, int size, const unsigned char *buffer, int bufferSize)
+{
+    if ((size <= 0) || (size > 256) || (size%4 != 0)) return -1;
+    if (bufferSize < 1 + size) return -2;
+    if ((buffer[0] & 0xf0) != 0xa0) return -1;      // Header: 0xa0 | version
+    if ((buffer[0] & 0x0f) > 0) return -1;          // Only version 0 supported
 
-    ModelAnimation *animations = RL_MALLOC(iqmHeader->num_anims*sizeof(ModelAnimation));
+    const unsigned char *data = buffer + 1;
+    const unsigned char *dataEnd = buffer + bufferSize;
 
-    // frameposes
-    unsigned short *framedata = RL_MALLOC(iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
-    //fseek(iqmFile, iqmHeader->ofs_frames, SEEK_SET);
-    //fread(framedata, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short), 1, iqmFile);
-    memcpy(framedata, fileDataPtr + iqmHeader->ofs_frames, iqmHeader->num_frames*iqmHeader->num_framechannels*sizeof(unsigned short));
+    // Last vertex bytes are initialized with the tail stored at the end of the buffer
+    unsigned char last[256] = { 0 };
+    memcpy(last, dataEnd - size, size);
 
-    for (unsigned int a = 0; a < iqmHeader->num_anims; a++)
+    int blockSize = (8192/size) & ~15;
+    if (blockSize > 256) blockSize = 256;
+
+    unsigned char deltas[256] = { 0 };
+
+    for (int offset = 0; offset < count; offset += blockSize)
     {
-        animations[a].frameCount = anim[a].num_frames;
-        animations[a].boneCount = iqmHeader->num_poses;
-        animations[a].bones = RL_MALLOC(iqmHeader->num_poses*sizeof(BoneInfo));
-        animations[a].framePoses = RL_MALLOC(anim[a].num_frames*sizeof(Transform *));
-        // animations[a].framerate = anim.framerate;     // TODO: Use framerate?
+        int blockCount = ((count - offset) < blockSize)? (count - offset) : blockSize;
+        int groupCount = (blockCount + 15)/16;
+        int headerSize = (groupCount + 3)/4;
 
-        for (unsigned int j = 0; j < iqmHeader->num_poses; j++)
+        for (int k = 0; k < size; k++)
         {
-            strcpy(animations[a].bones[j].name, "ANIMJOINTNAME");
-            animations[a].bones[j].parent = poses[j].parent;
-        }
+            if ((dataEnd - data) < headerSize) return -2;
 
-        for (unsigned int j = 0; j < anim[a].num_frames; j++) animations[a].framePoses[j] = RL_MALLOC(iqmHeader->num_poses*sizeof(Transform));
+            const unsigned char *header = data;
+            data += headerSize;
 
-        int dcounter = anim[a].first_frame*iqmHeader->num_framechannels;
+            for (int g = 0; (g < groupCount) && (data != NULL); g++)
+            {
+                int bitsLog2 = (header[g/4] >> ((g%4)*2)) & 3;
+                data = DecodeMeshoptBytesGroup(data, dataEnd, deltas + g*16, bitsLog2);
+            }
 
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (unsigned int i = 0; i < iqmHeader->num_poses; i++)
+            if (data == NULL) return -2;
+
+            unsigned char p = last[k];
+            unsigned char *vertex = dst + offset*size + k;
+
+            for (int i = 0; i < blockCount; i++, vertex += size)
             {
-                animations[a].framePoses[frame][i].translation.x = poses[i].channeloffset[0];
+                unsigned char delta = deltas[i];
+                p += (unsigned char)((-(delta & 1)) ^ (delta >> 1));
+                *vertex = p;
+            }
 
-                if (poses[i].mask & 0x01)
-                {
-                    animations[a].framePoses[frame][i].translation.x += framedata[dcounter]*poses[i].channelscale[0];
-                    dcounter++;
-                }
+            last[k] = p;
+        }
+    }
 
-                animations[a].framePoses[frame][i].translation.y = poses[i].channeloffset[1];
+    int tailSize = (size < 32)? 32 : size;
 
-                if (poses[i].mask & 0x02)
-                {
-                    animations[a].framePoses[frame][i].translation.y += framedata[dcounter]*poses[i].channelscale[1];
-                    dcounter++;
-                }
+    return ((dataEnd - data) == tailSize)? 0 : -3;
+}
 
-                animations[a].framePoses[frame][i].translation.z = poses[i].channeloffset[2];
+// Decode meshopt variable length integer (7 bits per byte)
+static unsigned int DecodeMeshoptVByte(const unsigned char **data)
+{
+    unsigned char lead = *(*data)++;
+    if (lead < 128) return lead;
 
-                if (poses[i].mask & 0x04)
-                {
-                    animations[a].framePoses[frame][i].translation.z += framedata[dcounter]*poses[i].channelscale[2];
-                    dcounter++;
-                }
+    unsigned int result = lead & 127;
+    unsigned int shift = 7;
 
-                animations[a].framePoses[frame][i].rotation.x = poses[i].channeloffset[3];
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned char group = *(*data)++;
+        result |= (unsigned int)(group & 127) << shift;
+        shift += 7;
 
-                if (poses[i].mask & 0x08)
-                {
-                    animations[a].framePoses[frame][i].rotation.x += framedata[dcounter]*poses[i].channelscale[3];
-                    dcounter++;
-                }
+        if (group < 128) break;
+    }
 
-                animations[a].framePoses[frame][i].rotation.y = poses[i].channeloffset[4];
+    return result;
+}
 
-                if (poses[i].mask & 0x10)
-                {
-                    animations[a].framePoses[frame][i].rotation.y += framedata[dcounter]*poses[i].channelscale[4];
-                    dcounter++;
-                }
+// Write meshopt decoded index (16 or 32 bit)
+static void WriteMeshoptIndex(unsigned char *dst, int index, int indexSize, unsigned int value)
+{
+    if (indexSize == 2) ((unsigned short *)dst)[index] = (unsigned short)value;
+    else ((unsigned int *)dst)[index] = value;
+}
 
-                animations[a].framePoses[frame][i].rotation.z = poses[i].channeloffset[5];
+// Decode meshopt triangles index buffer (EXT_meshopt_compression triangles mode), returns 0 on success
+// NOTE: Triangles are encoded referencing recently used edges and vertices FIFOs (16 entries)
+static int DecodeMeshoptIndexBuffer(unsigned char *dst, int count, int indexSize, const unsigned char *buffer, int bufferSize)
+{
+    if (((indexSize != 2) && (indexSize != 4)) || (count%3 != 0)) return -1;
+    if (bufferSize < 1 + count/3 + 16) return -2;
+    if ((buffer[0] & 0xf0) != 0xe0) return -1;      // Header: 0xe0 | version
 
-                if (poses[i].mask & 0x20)
-                {
-                    animations[a].framePoses[frame][i].rotation.z += framedata[dcounter]*poses[i].channelscale[5];
-                    dcounter++;
-                }
+    int version = buffer[0] & 0x0f;
+    if (version > 1) return -1;
 
-                animations[a].framePoses[frame][i].rotation.w = poses[i].channeloffset[6];
+    unsigned int edgeFifo[16][2];
+    unsigned int vertexFifo[16];
+    memset(edgeFifo, 0xff, sizeof(edgeFifo));
+    memset(vertexFifo, 0xff, sizeof(vertexFifo));
 
-                if (poses[i].mask & 0x40)
-                {
-                    animations[a].framePoses[frame][i].rotation.w += framedata[dcounter]*poses[i].channelscale[6];
-                    dcounter++;
-                }
+    unsigned int edgeOffset = 0;
+    unsigned int vertexOffset = 0;
+    unsigned int next = 0;
+    unsigned int last = 0;
+    int fecMax = (version >= 1)? 13 : 15;
 
-                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+    const unsigned char *code = buffer + 1;
+    const unsigned char *data = code + count/3;
+    const unsigned char *dataSafeEnd = buffer + bufferSize - 16;    // Last 16 bytes store auxiliary codes table (vertices B and C FIFO positions)
 
-                if (poses[i].mask & 0x80)
-                {
-                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-                    dcounter++;
-                }
+    #define PUSH_VERTEX_FIFO(v, cond) { vertexFifo[vertexOffset & 15] = (v); vertexOffset += (cond); }
+    #define PUSH_EDGE_FIFO(a, b) { edgeFifo[edgeOffset & 15][0] = (a); edgeFifo[edgeOffset & 15][1] = (b); edgeOffset++; }
 
-                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+    for (int i = 0; i < count; i += 3)
+    {
+        if (data > dataSafeEnd) return -2;
 
-                if (poses[i].mask & 0x100)
-                {
-                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-                    dcounter++;
-                }
+        unsigned char codeTri = *code++;
+        unsigned int a = 0, b = 0, c = 0;
 
-                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+        if (codeTri < 0xf0)
+        {
+            // Triangle shares an edge from edges FIFO
+            int fe = codeTri >> 4;
+            a = edgeFifo[(edgeOffset - 1 - fe) & 15][0];
+            b = edgeFifo[(edgeOffset - 1 - fe) & 15][1];
 
-                if (poses[i].mask & 0x200)
+            int fec = codeTri & 15;
+
+            if (fec < fecMax)
+            {
+                c = (fec == 0)? next : vertexFifo[(vertexOffset - 1 - fec) & 15];
+                next += (fec == 0);
+
+                PUSH_VERTEX_FIFO(c, (fec == 0));
+            }
+            else
+            {
+                // Free index, delta encoded to last free index (13/14: -1/+1 on version 1)
+                if (fec != 15) c = last + (fec - (fec ^ 3));
+                else
                 {
-                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-                    dcounter++;
+                    unsigned int v = DecodeMeshoptVByte(&data);
+                    c = last + ((v >> 1) ^ (0u - (v & 1)));
                 }
 
-                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
+                last = c;
+                PUSH_VERTEX_FIFO(c, 1);
             }
-        }
 
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+            PUSH_EDGE_FIFO(c, b);
+            PUSH_EDGE_FIFO(a, c);
+        }
+        else
         {
-            for (int i = 0; i < animations[a].boneCount; i++)
+            int fea = 0, feb = 0, fec = 0;
+
+            if (codeTri < 0xfe)
             {
-                if (animations[a].bones[i].parent >= 0)
-                {
-                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
-                }
+                // Triangle vertex A is next, B and C FIFO positions from auxiliary codes table
+                unsigned char codeAux = dataSafeEnd[codeTri & 15];
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+            }
+            else
+            {
+                // Triangle auxiliary code read from data stream, vertex A is next (0xfe) or free index (0xff)
+                unsigned char codeAux = *data++;
+                fea = (codeTri == 0xfe)? 0 : 15;
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+
+                if (codeAux == 0) next = 0;     // Reset code
             }
+
+            a = (fea == 0)? next++ : 0;
+            b = (feb == 0)? next++ : vertexFifo[(vertexOffset - feb) & 15];
+            c = (fec == 0)? next++ : vertexFifo[(vertexOffset - fec) & 15];
+
+            if (fea == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = a = last + ((v >> 1) ^ (0u - (v & 1))); }
+            if (feb == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = b = last + ((v >> 1) ^ (0u - (v & 1))); }
+            if (fec == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = c = last + ((v >> 1) ^ (0u - (v & 1))); }
+
+            PUSH_VERTEX_FIFO(a, 1);
+            PUSH_VERTEX_FIFO(b, (feb == 0) || (feb == 15));
+            PUSH_VERTEX_FIFO(c, (fec == 0) || (fec == 15));
+
+            PUSH_EDGE_FIFO(b, a);
+            PUSH_EDGE_FIFO(c, b);
+            PUSH_EDGE_FIFO(a, c);
         }
-    }
 
-    RL_FREE(fileData);
+        WriteMeshoptIndex(dst, i + 0, indexSize, a);
+        WriteMeshoptIndex(dst, i + 1, indexSize, b);
+        WriteMeshoptIndex(dst, i + 2, indexSize, c);
+    }
 
-    RL_FREE(framedata);
-    RL_FREE(poses);
-    RL_FREE(anim);
+    #undef PUSH_VERTEX_FIFO
+    #undef PUSH_EDGE_FIFO
 
-    return animations;
+    return (data == dataSafeEnd)? 0 : -3;
 }
 
-#endif
-
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-// Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+// Decode meshopt index sequence (EXT_meshopt_compression indices mode), returns 0 on success
+// NOTE: Every index is delta encoded to one of the two last decoded indices
+static int DecodeMeshoptIndexSequence(unsigned char *dst, int count, int indexSize, const unsigned char *buffer, int bufferSize)
 {
-    Image image = { 0 };
+    if ((indexSize != 2) && (indexSize != 4)) return -1;
+    if (bufferSize < 1 + count + 4) return -2;
+    if ((buffer[0] & 0xf0) != 0xd0) return -1;      // Header: 0xd0 | version
+    if ((buffer[0] & 0x0f) > 0) return -1;
 
-    if (cgltfImage->uri != NULL)     // Check if image data is provided as a uri (base64 or path)
+    const unsigned char *data = buffer + 1;
+    const unsigned char *dataSafeEnd = buffer + bufferSize - 4;
+    unsigned int last[2] = { 0 };
+
+    for (int i = 0; i < count; i++)
     {
-        if ((strlen(cgltfImage->uri) > 5) &&
-            (cgltfImage->uri[0] == 'd') &&
-            (cgltfImage->uri[1] == 'a') &&
-            (cgltfImage->uri[2] == 't') &&
-            (cgltfImage->uri[3] == 'a') &&
-            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        if (data >= dataSafeEnd) return -2;
+
+        unsigned int v = DecodeMeshoptVByte(&data);
+        unsigned int current = v & 1;
+        v >>= 1;
+
+        last[current] += (v >> 1) ^ (0u - (v & 1));
+        WriteMeshoptIndex(dst, i, indexSize, last[current]);
+    }
+
+    return (data == dataSafeEnd)? 0 : -3;
+}
+
+// Decode meshopt attributes filter in place: octahedral normals, quaternions or exponential floats
+static void DecodeMeshoptFilter(unsigned char *data, int count, int stride, int filter)
+{
+    if ((filter == cgltf_meshopt_compression_filter_octahedral) && ((stride == 4) || (stride == 8)))
+    {
+        float max = (stride == 4)? 127.0f : 32767.0f;
+
+        for (int i = 0; i < count; i++)
         {
-            // Data URI Format: data:<mediatype>;base64,<data>
+            signed char *c8 = (signed char *)(data + i*stride);
+            short *c16 = (short *)(data + i*stride);
 
-            // Find the comma
-            int i = 0;
-            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+            float x = (stride == 4)? (float)c8[0] : (float)c16[0];
+            float y = (stride == 4)? (float)c8[1] : (float)c16[1];
+            float z = ((stride == 4)? (float)c8[2] : (float)c16[2]) - fabsf(x) - fabsf(y);
 
-            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
-            else
-            {
-                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
-                int outSize = 3*(base64Size/4);         // TODO: Consider padding (-numberOfPaddingCharacters)
-                void *data = NULL;
+            // Fixup octahedral coordinates for z < 0
+            float t = (z >= 0.0f)? 0.0f : z;
+            x += (x >= 0.0f)? t : -t;
+            y += (y >= 0.0f)? t : -t;
 
-                cgltf_options options = { 0 };
-                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+            float s = max/sqrtf(x*x + y*y + z*z);
+            int xf = (int)(x*s + ((x >= 0.0f)? 0.5f : -0.5f));
+            int yf = (int)(y*s + ((y >= 0.0f)? 0.5f : -0.5f));
+            int zf = (int)(z*s + ((z >= 0.0f)? 0.5f : -0.5f));
 
-                if (result == cgltf_result_success)
-                {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
-                    cgltf_free((cgltf_data*)data);
-                }
-            }
+            if (stride == 4) { c8[0] = (signed char)xf; c8[1] = (signed char)yf; c8[2] = (signed char)zf; }
+            else { c16[0] = (short)xf; c16[1] = (short)yf; c16[2] = (short)zf; }
         }
-        else     // Check if image is provided as image path
+    }
+    else if ((filter == cgltf_meshopt_compression_filter_quaternion) && (stride == 8))
+    {
+        for (int i = 0; i < count; i++)
         {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+            short *q = (short *)(data + i*stride);
+
+            // Scale is stored on the high bits of the last component, low 2 bits store largest component index
+            float scale = (1.0f/sqrtf(2.0f))/(float)(q[3] | 3);
+            float x = (float)q[0]*scale;
+            float y = (float)q[1]*scale;
+            float z = (float)q[2]*scale;
+
+            float ww = 1.0f - x*x - y*y - z*z;
+            float w = sqrtf((ww >= 0.0f)? ww : 0.0f);
+
+            int qc = q[3] & 3;
+
+            q[(qc + 1) & 3] = (short)(x*32767.0f + ((x >= 0.0f)? 0.5f : -0.5f));
+            q[(qc + 2) & 3] = (short)(y*32767.0f + ((y >= 0.0f)? 0.5f : -0.5f));
+            q[(qc + 3) & 3] = (short)(z*32767.0f + ((z >= 0.0f)? 0.5f : -0.5f));
+            q[(qc + 0) & 3] = (short)(w*32767.0f + 0.5f);
         }
     }
-    else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
+    else if ((filter == cgltf_meshopt_compression_filter_exponential) && (stride%4 == 0))
     {
-        unsigned char *data = RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+        unsigned int *values = (unsigned int *)data;
 
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+        for (int i = 0; i < count*stride/4; i++)
         {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+            // 24 bit signed mantissa and 8 bit signed exponent: ldexp(mantissa, exponent)
+            int m = (int)(values[i] << 8) >> 8;
+            int e = (int)values[i] >> 24;
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) ||
-            (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
-                 (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+            union { float f; unsigned int u; } v;
+            v.u = (unsigned int)(e + 127) << 23;
+            v.f = v.f*(float)m;
 
-        RL_FREE(data);
+            values[i] = v.u;
+        }
     }
-
-    return image;
 }
 
 // Load glTF file into model struct, .gltf and .glb supported
-static Model LoadGLTF(const char *fileName)
+static Model LoadGLTF(const char *fileName, ModelTextureQueue *queue, Scene *scene, SceneModel *sceneModel)
 {
     /*********************************************************************************************
 
@@ -4578,44 +18247,39 @@ static Model LoadGLTF(const char *fileName)
           - Supports PBR metallic/roughness flow, loads material textures, values and colors
                      PBR specular/glossiness flow and extended texture flows not supported
           - Supports multiple meshes per model (every primitives is loaded as a separate mesh)
+          - Supports KHR_mesh_quantization and EXT_meshopt_compression extensions
+          - Supports morph targets (positions and normals), weights animations loaded with LoadMorphAnimations()
+          - Material images decoded in parallel on async load workers
+          - Supports nodes hierarchy loaded into a scene (LoadSceneModel()), meshes referenced by several nodes are loaded once,
+            nodes instances (EXT_mesh_gpu_instancing) loaded into instance buffers
 
         RESTRICTIONS:
           - Only triangle meshes supported
           - Vertex attibute types and formats supported:
-              > Vertices (position): vec3: float
-              > Normals: vec3: float
-              > Texcoords: vec2: float
-              > Colors: vec4: u8, u16, f32 (normalized)
-              > Indices: u16, u32 (truncated to u16)
-          - Node hierarchies or transforms not supported
+              > Vertices (position): vec3: float, s8, u8, s16, u16 (quantized)
+              > Normals: vec3: float, s8, s16 (normalized)
+              > Tangents: vec4: float, s8, s16 (normalized)
+              > Texcoords: vec2: float, s8, u8, s16, u16 (quantized)
+              > Colors: vec3/vec4: u8, u16, f32 (normalized)
+              > Indices: u8, u16, u32 (truncated to u16)
+          - Node hierarchies and transforms only loaded into a scene (LoadSceneModel()), LoadModel() only applies
+            quantized meshes dequantization transform
 
     ***********************************************************************************************/
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, dataType, dstPtr) \
-    { \
-        int n = 0; \
-        dataType *buffer = (dataType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(dataType) + accesor->offset/sizeof(dataType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(dataType));\
-        }\
-    }
-
     Model model = { 0 };
 
     // glTF file loading
     unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    const unsigned char *fileData = LoadFileDataView(fileName, &dataSize);
 
     if (fileData == NULL) return model;
 
     // glTF data loading
+    // NOTE: External buffers are loaded with LoadFileData(), file packs and custom loaders also apply
     cgltf_options options = { 0 };
+    options.file.read = LoadFileGLTFCallback;
+    options.file.release = ReleaseFileGLTFCallback;
     cgltf_data *data = NULL;
     cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
 
@@ -4636,6 +18300,9 @@ static Model LoadGLTF(const char *fileName)
         result = cgltf_load_buffers(&options, data, fileName);
         if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
 
+        // Decode buffer views compressed with EXT_meshopt_compression (fills buffer_view->data)
+        if (!DecodeGLTFMeshopt(data)) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to decode meshopt compressed buffers", fileName);
+
         int primitivesCount = 0;
         // NOTE: We will load every primitive in the glTF as a separate raylib mesh
         for (unsigned int i = 0; i < data->meshes_count; i++) primitivesCount += (int)data->meshes[i].primitives_count;
@@ -4652,12 +18319,39 @@ static Model LoadGLTF(const char *fileName)
         // Load mesh-material indices, by default all meshes are mapped to material index: 0
         model.meshMaterial = RL_CALLOC(model.meshCount, sizeof(int));
 
+        // Load materials images
+        // NOTE: Images are decoded in parallel on async load workers, unless model is already
+        // loading on a worker thread (textures queued), waiting for other jobs there could deadlock
+        //----------------------------------------------------------------------------------------------------
+        const char *texPath = (queue != NULL)? queue->dirPath : GetDirectoryPath(fileName);
+        int *imageUses = (int *)RL_CALLOC(data->images_count + 1, sizeof(int));
+        char (*imageKeys)[512] = NULL;
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+        // Materials textures are cached by image path (same key than LoadTexture()) or by model file and image index (embedded images),
+        // textures used by several materials or models are uploaded once
+        // NOTE: Textures queued for upload (model loading on a worker thread) are not cached
+        if (queue == NULL)
+        {
+            imageKeys = (char (*)[512])RL_CALLOC(data->images_count + 1, 512);
+
+            for (unsigned int i = 0; i < data->images_count; i++)
+            {
+                const char *uri = data->images[i].uri;
+
+                if ((uri != NULL) && (strncmp(uri, "data:", 5) != 0)) snprintf(imageKeys[i], 512, "%s/%s", texPath, uri);
+                else snprintf(imageKeys[i], 512, "%s#%u", fileName, i);
+            }
+        }
+#endif
+
+        Image *images = LoadGLTFImages(data, texPath, imageKeys, imageUses, (queue == NULL));
+
         // Load materials data
         //----------------------------------------------------------------------------------------------------
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -4666,12 +18360,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
-                    }
+                    LoadGLTFTexture(&model, j, MATERIAL_MAP_ALBEDO, data, data->materials[i].pbr_metallic_roughness.base_color_texture.texture, images, imageKeys, imageUses, queue);
                 }
                 // Load base color factor (tint)
                 model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
@@ -4682,12 +18371,7 @@ static Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
-                        UnloadImage(imMetallicRoughness);
-                    }
+                    LoadGLTFTexture(&model, j, MATERIAL_MAP_ROUGHNESS, data, data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture, images, imageKeys, imageUses, queue);
 
                     // Load metallic/roughness material properties
                     float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
@@ -4700,34 +18384,19 @@ static Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
-                    }
+                    LoadGLTFTexture(&model, j, MATERIAL_MAP_NORMAL, data, data->materials[i].normal_texture.texture, images, imageKeys, imageUses, queue);
                 }
 
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
-                    }
+                    LoadGLTFTexture(&model, j, MATERIAL_MAP_OCCLUSION, data, data->materials[i].occlusion_texture.texture, images, imageKeys, imageUses, queue);
                 }
 
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
-                    }
+                    LoadGLTFTexture(&model, j, MATERIAL_MAP_EMISSION, data, data->materials[i].emissive_texture.texture, images, imageKeys, imageUses, queue);
 
                     // Load emissive color factor
                     model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
@@ -4741,6 +18410,10 @@ static Model LoadGLTF(const char *fileName)
             // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
         }
 
+        RL_FREE(images);
+        RL_FREE(imageUses);
+        RL_FREE(imageKeys);
+
         // Load meshes data
         //----------------------------------------------------------------------------------------------------
         for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
@@ -4756,6 +18429,8 @@ static Model LoadGLTF(const char *fileName)
                 // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
                 // Only some formats for each attribute type are supported, read info at the top of this function!
 
+                bool quantized = false;     // Vertices positions quantized (KHR_mesh_quantization)
+
                 for (unsigned int j = 0; j < data->meshes[i].primitives[p].attributes_count; j++)
                 {
                     // Check the different attributes for every pimitive
@@ -4765,44 +18440,49 @@ static Model LoadGLTF(const char *fileName)
 
                         // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined.
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh vertices to copy glTF attribute data
-                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                            model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
+                        // Init raylib mesh vertices to copy glTF attribute data
+                        model.meshes[meshIndex].vertexCount = (int)attribute->count;
+                        model.meshes[meshIndex].vertices = RL_MALLOC(attribute->count*3*sizeof(float));
 
-                            // Load 3 components of float data type into mesh.vertices
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
+                        // Load 3 components of float data type into mesh.vertices (dequantized if required)
+                        if (!LoadGLTFAccessorFloats(attribute, model.meshes[meshIndex].vertices, 3))
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3", fileName);
+                            RL_FREE(model.meshes[meshIndex].vertices);
+                            model.meshes[meshIndex].vertices = NULL;
+                            model.meshes[meshIndex].vertexCount = 0;
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+                        else if (attribute->component_type != cgltf_component_type_r_32f) quantized = true;
                     }
                     else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL
                     {
                         cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec3))
-                        {
-                            // Init raylib mesh normals to copy glTF attribute data
-                            model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
+                        // Init raylib mesh normals to copy glTF attribute data
+                        model.meshes[meshIndex].normals = RL_MALLOC(attribute->count*3*sizeof(float));
 
-                            // Load 3 components of float data type into mesh.normals
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
+                        // Load 3 components of float data type into mesh.normals (dequantized if required)
+                        if (!LoadGLTFAccessorFloats(attribute, model.meshes[meshIndex].normals, 3))
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3", fileName);
+                            RL_FREE(model.meshes[meshIndex].normals);
+                            model.meshes[meshIndex].normals = NULL;
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
                     }
                     else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT
                     {
                         cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh tangent to copy glTF attribute data
-                            model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
+                        // Init raylib mesh tangent to copy glTF attribute data
+                        model.meshes[meshIndex].tangents = RL_MALLOC(attribute->count*4*sizeof(float));
 
-                            // Load 4 components of float data type into mesh.tangents
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
+                        // Load 4 components of float data type into mesh.tangents (dequantized if required)
+                        if (!LoadGLTFAccessorFloats(attribute, model.meshes[meshIndex].tangents, 4))
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4", fileName);
+                            RL_FREE(model.meshes[meshIndex].tangents);
+                            model.meshes[meshIndex].tangents = NULL;
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
                     }
                     else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_0
                     {
@@ -4810,15 +18490,17 @@ static Model LoadGLTF(const char *fileName)
 
                         cgltf_accessor *attribute = data->meshes[i].primitives[p].attributes[j].data;
 
-                        if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec2))
-                        {
-                            // Init raylib mesh texcoords to copy glTF attribute data
-                            model.meshes[meshIndex].texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
+                        // Init raylib mesh texcoords to copy glTF attribute data
+                        model.meshes[meshIndex].texcoords = RL_MALLOC(attribute->count*2*sizeof(float));
 
-                            // Load 3 components of float data type into mesh.texcoords
-                            LOAD_ATTRIBUTE(attribute, 2, float, model.meshes[meshIndex].texcoords)
+                        // Load 2 components of float data type into mesh.texcoords (dequantized if required)
+                        // NOTE: Quantized texcoords transform (KHR_texture_transform) is not applied
+                        if (!LoadGLTFAccessorFloats(attribute, model.meshes[meshIndex].texcoords, 2))
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2", fileName);
+                            RL_FREE(model.meshes[meshIndex].texcoords);
+                            model.meshes[meshIndex].texcoords = NULL;
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
                     }
                     else if (data->meshes[i].primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_0
                     {
@@ -4826,48 +18508,65 @@ static Model LoadGLTF(const char *fileName)
 
                         // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range.
 
-                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4))
-                        {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+                        // Init raylib mesh color to copy glTF attribute data
+                        model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-                            // Load 4 components of unsigned char data type into mesh.colors
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                        }
-                        else if ((attribute->component_type == cgltf_component_type_r_16u) && (attribute->type == cgltf_type_vec4))
+                        if ((attribute->component_type == cgltf_component_type_r_8u) && (attribute->type == cgltf_type_vec4) &&
+                            LoadGLTFAccessorData(attribute, model.meshes[meshIndex].colors, 4*sizeof(unsigned char)))
                         {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                            // Load data into a temp buffer to be converted to raylib data type
-                            unsigned short *temp = RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
-
-                            // Convert data to raylib color data type (4 bytes)
-                            for (int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
-
-                            RL_FREE(temp);
+                            // Loaded 4 components of unsigned char data type into mesh.colors
                         }
-                        else if ((attribute->component_type == cgltf_component_type_r_32f) && (attribute->type == cgltf_type_vec4))
+                        else if ((attribute->type == cgltf_type_vec4) || (attribute->type == cgltf_type_vec3))
                         {
-                            // Init raylib mesh color to copy glTF attribute data
-                            model.meshes[meshIndex].colors = RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
                             // Load data into a temp buffer to be converted to raylib data type
-                            float *temp = RL_MALLOC(attribute->count*4*sizeof(float));
-                            LOAD_ATTRIBUTE(attribute, 4, float, temp);
-
-                            // Convert data to raylib color data type (4 bytes), we expect the color data normalized
-                            for (int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
+                            int numComp = (attribute->type == cgltf_type_vec4)? 4 : 3;
+                            float *temp = RL_MALLOC(attribute->count*numComp*sizeof(float));
+
+                            if (LoadGLTFAccessorFloats(attribute, temp, numComp))
+                            {
+                                // Convert data to raylib color data type (4 bytes), data is normalized on loading
+                                for (int c = 0; c < attribute->count; c++)
+                                {
+                                    for (int k = 0; k < 4; k++) model.meshes[meshIndex].colors[c*4 + k] = (k < numComp)? (unsigned char)(temp[c*numComp + k]*255.0f) : 255;
+                                }
+                            }
+                            else
+                            {
+                                TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                                RL_FREE(model.meshes[meshIndex].colors);
+                                model.meshes[meshIndex].colors = NULL;
+                            }
 
                             RL_FREE(temp);
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                        else
+                        {
+                            TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+                            RL_FREE(model.meshes[meshIndex].colors);
+                            model.meshes[meshIndex].colors = NULL;
+                        }
                     }
 
                     // NOTE: Attributes related to animations are processed separately
                 }
 
+                // Load primitive morph targets deltas (vertex count must be already loaded)
+                LoadGLTFMorphTargets(&data->meshes[i], &data->meshes[i].primitives[p], &model.meshes[meshIndex]);
+
+                // KHR_mesh_quantization: dequantization transform (scale and offset) is stored as mesh node transform
+                // NOTE: Nodes loaded into a scene already apply it
+                if (quantized && (scene == NULL)) TransformGLTFMesh(data, &data->meshes[i], &model.meshes[meshIndex]);
+
+#if !defined(GPU_MORPHING_SUPPORTED)
+                // Morph targets are blended on CPU into animated vertex data, uploaded on weights changes
+                if (model.meshes[meshIndex].morphTargetCount > 0)
+                {
+                    model.meshes[meshIndex].animVertices = RL_MALLOC(model.meshes[meshIndex].vertexCount*3*sizeof(float));
+                    if (model.meshes[meshIndex].normals != NULL) model.meshes[meshIndex].animNormals = RL_MALLOC(model.meshes[meshIndex].vertexCount*3*sizeof(float));
+                    BlendMeshMorphTargets(model.meshes[meshIndex]);
+                }
+#endif
+
                 // Load primitive indices data (if provided)
                 if (data->meshes[i].primitives[p].indices != NULL)
                 {
@@ -4875,31 +18574,28 @@ static Model LoadGLTF(const char *fileName)
 
                     model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
 
-                    if (attribute->component_type == cgltf_component_type_r_16u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
+                    // Init raylib mesh indices to copy glTF attribute data
+                    model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
 
-                        // Load unsigned short data type into mesh.indices
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
+                    if ((attribute->component_type == cgltf_component_type_r_16u) &&
+                        LoadGLTFAccessorData(attribute, model.meshes[meshIndex].indices, sizeof(unsigned short)))
+                    {
+                        // Loaded unsigned short data type into mesh.indices
                     }
-                    else if (attribute->component_type == cgltf_component_type_r_32u)
+                    else if (((attribute->component_type == cgltf_component_type_r_8u) || (attribute->component_type == cgltf_component_type_r_32u)) &&
+                             !attribute->is_sparse && CheckGLTFAccessorData(attribute))
                     {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = RL_MALLOC(attribute->count*sizeof(unsigned short));
-
-                        // Load data into a temp buffer to be converted to raylib data type
-                        unsigned int *temp = RL_MALLOC(attribute->count*sizeof(unsigned int));
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned int, temp);
-
                         // Convert data to raylib indices data type (unsigned short)
-                        for (int d = 0; d < attribute->count; d++) model.meshes[meshIndex].indices[d] = (unsigned short)temp[d];
+                        for (int d = 0; d < attribute->count; d++) model.meshes[meshIndex].indices[d] = (unsigned short)cgltf_accessor_read_index(attribute, d);
 
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
-
-                        RL_FREE(temp);
+                        if (attribute->component_type == cgltf_component_type_r_32u) TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+                    }
+                    else
+                    {
+                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
+                        RL_FREE(model.meshes[meshIndex].indices);
+                        model.meshes[meshIndex].indices = NULL;
                     }
-                    else TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
                 }
                 else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
 
@@ -4922,6 +18618,47 @@ static Model LoadGLTF(const char *fileName)
             }
         }
 
+        // Load nodes hierarchy into scene, nodes reference shared meshes
+        //----------------------------------------------------------------------------------------------------
+        if ((scene != NULL) && (sceneModel != NULL))
+        {
+            // Map glTF meshes to model meshes, every triangles primitive is loaded as a mesh
+            int *firstMesh = (int *)RL_CALLOC(data->meshes_count + 1, sizeof(int));
+
+            for (unsigned int i = 0, meshIndex = 0; i < data->meshes_count; i++)
+            {
+                firstMesh[i] = meshIndex;
+
+                for (unsigned int p = 0; p < data->meshes[i].primitives_count; p++)
+                {
+                    if (data->meshes[i].primitives[p].type == cgltf_primitive_type_triangles) meshIndex++;
+                }
+
+                firstMesh[i + 1] = meshIndex;
+            }
+
+            sceneModel->nodes = (SceneModelNode *)RL_CALLOC(data->nodes_count, sizeof(SceneModelNode));
+
+            // Default scene root nodes, or all root nodes if no scene defined
+            const cgltf_scene *gltfScene = (data->scene != NULL)? data->scene : ((data->scenes_count > 0)? &data->scenes[0] : NULL);
+
+            if (gltfScene != NULL)
+            {
+                for (unsigned int n = 0; n < gltfScene->nodes_count; n++) LoadGLTFSceneNode(data, gltfScene->nodes[n], sceneModel->rootNode, firstMesh, scene, sceneModel);
+            }
+            else
+            {
+                for (unsigned int n = 0; n < data->nodes_count; n++)
+                {
+                    if (data->nodes[n].parent == NULL) LoadGLTFSceneNode(data, &data->nodes[n], sceneModel->rootNode, firstMesh, scene, sceneModel);
+                }
+            }
+
+            TRACELOG(LOG_INFO, "    > Scene nodes count: %i (%i mesh nodes)", scene->nodeCount - sceneModel->rootNode - 1, sceneModel->nodeCount);
+
+            RL_FREE(firstMesh);
+        }
+
 /*
         // TODO: Load glTF meshes animation data
         // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
@@ -4948,7 +18685,7 @@ static Model LoadGLTF(const char *fileName)
                             model.meshes[meshIndex].boneIds = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(unsigned char));
 
                             // Load 4 components of unsigned char data type into mesh.boneIds
-                            LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].boneIds)
+                            LoadGLTFAccessorData(attribute, model.meshes[meshIndex].boneIds, 4*sizeof(unsigned char));
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint attribute data format not supported, use vec4 u8", fileName);
                     }
@@ -4962,7 +18699,7 @@ static Model LoadGLTF(const char *fileName)
                             model.meshes[meshIndex].boneWeights = RL_CALLOC(model.meshes[meshIndex].vertexCount*4, sizeof(float));
 
                             // Load 4 components of float data type into mesh.boneWeights
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].boneWeights)
+                            LoadGLTFAccessorFloats(attribute, model.meshes[meshIndex].boneWeights, 4);
                         }
                         else TRACELOG(LOG_WARNING, "MODEL: [%s] Joint weight attribute data format not supported, use vec4 float", fileName);
                     }
@@ -4978,7 +18715,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileDataView(fileData);
 
     return model;
 }
@@ -4991,12 +18728,11 @@ static Model LoadVOX(const char *fileName)
     Model model = { 0 };
 
     int nbvertices = 0;
-    int meshescount = 0;
     unsigned int fileSize = 0;
-    unsigned char *fileData = NULL;
+    const unsigned char *fileData = NULL;
 
     // Read vox file into buffer
-    fileData = LoadFileData(fileName, &fileSize);
+    fileData = LoadFileDataView(fileName, &fileSize);
     if (fileData == 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX file", fileName);
@@ -5005,25 +18741,64 @@ static Model LoadVOX(const char *fileName)
 
     // Read and build voxarray description
     VoxArray3D voxarray = { 0 };
-    int ret = Vox_LoadFromMemory(fileData, fileSize, &voxarray);
+    int ret = Vox_LoadFromMemory((unsigned char *)fileData, fileSize, &voxarray);
 
     if (ret != VOX_SUCCESS)
     {
         // Error
-        UnloadFileData(fileData);
+        UnloadFileDataView(fileData);
 
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load VOX data", fileName);
         return model;
     }
-    else
+
+#if defined(SUPPORT_VOXEL_MESHING)
+    // Build voxel map from voxarray, every non-empty chunk mesh becomes a model mesh
+    // NOTE: Faces are merged by the greedy mesher, scale matches vox_loader meshes (0.25 units per voxel)
+    VoxelMap map = LoadVoxelMap(voxarray.sizeX, voxarray.sizeY, voxarray.sizeZ, (Vector3){ 0.25f, 0.25f, 0.25f });
+
+    for (int i = 0; i < 256; i++) map.palette[i] = (Color){ voxarray.palette[i].r, voxarray.palette[i].g, voxarray.palette[i].b, voxarray.palette[i].a };
+
+    for (int y = 0; y < map.height; y++)
+    {
+        for (int z = 0; z < map.depth; z++)
+        {
+            for (int x = 0; x < map.width; x++) map.voxels[x + z*map.width + y*map.width*map.depth] = Vox_GetVoxel(&voxarray, x, y, z);
+        }
+    }
+
+    int chunkCount = map.chunksX*map.chunksY*map.chunksZ;
+    model.meshes = (Mesh *)RL_CALLOC((chunkCount > 0)? chunkCount : 1, sizeof(Mesh));
+
+    for (int i = 0; i < chunkCount; i++)
     {
-        // Success: Compute meshes count
-        nbvertices = voxarray.vertices.used;
-        meshescount = 1 + (nbvertices/65536);
+        Mesh mesh = GenVoxelChunkMesh(map, i);
 
-        TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, nbvertices, meshescount);
+        if (mesh.vertexCount > 0)
+        {
+            model.meshes[model.meshCount] = mesh;
+            model.meshCount++;
+            nbvertices += mesh.vertexCount;
+        }
     }
 
+    UnloadVoxelMap(map);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, nbvertices, model.meshCount);
+
+    model.transform = MatrixIdentity();
+    model.meshMaterial = (int *)RL_CALLOC((model.meshCount > 0)? model.meshCount : 1, sizeof(int));
+
+    model.materialCount = 1;
+    model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+#else
+    // Success: Compute meshes count
+    int meshescount = 1 + (voxarray.vertices.used/65536);
+    nbvertices = voxarray.vertices.used;
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] VOX data loaded successfully : %i vertices/%i meshes", fileName, nbvertices, meshescount);
+
     // Build models from meshes
     model.transform = MatrixIdentity();
 
@@ -5080,13 +18855,489 @@ static Model LoadVOX(const char *fileName)
         pvertices += verticesMax;
         pcolors += verticesMax;
     }
+#endif
 
     // Free buffers
     Vox_FreeArrays(&voxarray);
-    UnloadFileData(fileData);
+    UnloadFileDataView(fileData);
+
+    return model;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// Get mesh arrays stored in RMDL files (file order) and their sizes, RMDL_MESH_ARRAYS entries
+static void GetRMDLMeshArrays(Mesh *mesh, void ***arrays, unsigned int *sizes)
+{
+    arrays[0] = (void **)&mesh->vertices;       sizes[0] = mesh->vertexCount*3*sizeof(float);
+    arrays[1] = (void **)&mesh->texcoords;      sizes[1] = mesh->vertexCount*2*sizeof(float);
+    arrays[2] = (void **)&mesh->texcoords2;     sizes[2] = mesh->vertexCount*2*sizeof(float);
+    arrays[3] = (void **)&mesh->normals;        sizes[3] = mesh->vertexCount*3*sizeof(float);
+    arrays[4] = (void **)&mesh->tangents;       sizes[4] = mesh->vertexCount*4*sizeof(float);
+    arrays[5] = (void **)&mesh->colors;         sizes[5] = mesh->vertexCount*4*sizeof(unsigned char);
+    arrays[6] = (void **)&mesh->indices;        sizes[6] = mesh->triangleCount*3*sizeof(unsigned short);
+    arrays[7] = (void **)&mesh->boneIds;        sizes[7] = mesh->vertexCount*4*sizeof(unsigned char);
+    arrays[8] = (void **)&mesh->boneWeights;    sizes[8] = mesh->vertexCount*4*sizeof(float);
+}
+
+// Write data block to RMDL file buffer, block is aligned to RMDL_ALIGNMENT
+static void WriteRMDLData(RMDLBuffer *buffer, const void *data, unsigned int size)
+{
+    unsigned int offset = (buffer->size + RMDL_ALIGNMENT - 1) & ~(RMDL_ALIGNMENT - 1);
+
+    if ((offset + size) > buffer->capacity)
+    {
+        buffer->capacity = ((offset + size) > buffer->capacity*2)? (offset + size) : buffer->capacity*2;
+        buffer->data = (unsigned char *)RL_REALLOC(buffer->data, buffer->capacity);
+    }
+
+    memset(buffer->data + buffer->size, 0, offset - buffer->size);     // Alignment padding
+    if (size > 0) memcpy(buffer->data + offset, data, size);
+
+    buffer->size = offset + size;
+}
+
+// Read data block from RMDL file data (aligned to RMDL_ALIGNMENT), NULL if out of file data
+static const void *ReadRMDLData(const unsigned char *fileData, unsigned int fileSize, unsigned int *offset, unsigned int size)
+{
+    unsigned int start = (*offset + RMDL_ALIGNMENT - 1) & ~(RMDL_ALIGNMENT - 1);
+
+    if ((start > fileSize) || (size > (fileSize - start))) return NULL;
+
+    *offset = start + size;
+
+    return fileData + start;
+}
+
+// Write mesh description and arrays to RMDL file buffer
+static void WriteRMDLMesh(RMDLBuffer *buffer, Mesh mesh)
+{
+    void **arrays[RMDL_MESH_ARRAYS] = { 0 };
+    unsigned int sizes[RMDL_MESH_ARRAYS] = { 0 };
+    GetRMDLMeshArrays(&mesh, arrays, sizes);
+
+    RMDLMesh rmdlMesh = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        rmdlMesh.vertexCount = mesh.vertexCount;
+        rmdlMesh.triangleCount = mesh.triangleCount;
+
+        for (int i = 0; i < RMDL_MESH_ARRAYS; i++) if (*arrays[i] != NULL) rmdlMesh.arrays |= (1 << i);
+    }
+
+    WriteRMDLData(buffer, &rmdlMesh, sizeof(RMDLMesh));
+
+    for (int i = 0; i < RMDL_MESH_ARRAYS; i++)
+    {
+        if (rmdlMesh.arrays & (1 << i)) WriteRMDLData(buffer, *arrays[i], sizes[i]);
+    }
+}
+
+// Read mesh description and arrays from RMDL file data, returns false if data is not valid
+// NOTE: Arrays are copied as stored, no per-vertex processing required
+static bool ReadRMDLMesh(const unsigned char *fileData, unsigned int fileSize, unsigned int *offset, Mesh *mesh)
+{
+    const RMDLMesh *rmdlMesh = (const RMDLMesh *)ReadRMDLData(fileData, fileSize, offset, sizeof(RMDLMesh));
+    if ((rmdlMesh == NULL) || (rmdlMesh->vertexCount < 0) || (rmdlMesh->triangleCount < 0) ||
+        ((unsigned int)rmdlMesh->vertexCount > fileSize) || ((unsigned int)rmdlMesh->triangleCount > fileSize)) return false;
+
+    mesh->vertexCount = rmdlMesh->vertexCount;
+    mesh->triangleCount = rmdlMesh->triangleCount;
+
+    void **arrays[RMDL_MESH_ARRAYS] = { 0 };
+    unsigned int sizes[RMDL_MESH_ARRAYS] = { 0 };
+    GetRMDLMeshArrays(mesh, arrays, sizes);
+
+    for (int i = 0; i < RMDL_MESH_ARRAYS; i++)
+    {
+        if (rmdlMesh->arrays & (1 << i))
+        {
+            const void *data = ReadRMDLData(fileData, fileSize, offset, sizes[i]);
+            if (data == NULL) return false;
+
+            *arrays[i] = RL_MALLOC(sizes[i]);
+            memcpy(*arrays[i], data, sizes[i]);
+        }
+    }
+
+    // Skinned meshes require animated vertex data, initialized to bind pose
+    if ((mesh->boneIds != NULL) && (mesh->vertices != NULL))
+    {
+        mesh->animVertices = (float *)RL_MALLOC(sizes[0]);
+        memcpy(mesh->animVertices, mesh->vertices, sizes[0]);
+
+        if (mesh->normals != NULL)
+        {
+            mesh->animNormals = (float *)RL_MALLOC(sizes[3]);
+            memcpy(mesh->animNormals, mesh->normals, sizes[3]);
+        }
+    }
+
+    return true;
+}
+
+// Get image data size including mipmaps
+static unsigned int GetRMDLImageSize(int width, int height, int mipmaps, int format)
+{
+    unsigned int size = 0;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        size += GetPixelDataSize(width, height, format);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return size;
+}
+
+// Load RMDL (cooked model) file data, material textures optionally queued for upload
+// NOTE: Data blocks are stored in UploadMesh() layout, loading just copies them
+static Model LoadRMDL(const char *fileName, ModelTextureQueue *queue)
+{
+    Model model = { 0 };
+
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+    if (fileData == NULL) return model;
+
+    const RMDLHeader *header = (const RMDLHeader *)fileData;
+
+    if ((fileSize < sizeof(RMDLHeader)) || (strncmp(header->id, "RMDL", 4) != 0) || (header->version != 100) ||
+        (header->meshCount < 0) || (header->lodCount < 0) || (header->materialCount < 0) ||
+        (header->textureCount < 0) || (header->boneCount < 0) || ((unsigned int)header->meshCount > fileSize) ||
+        ((unsigned int)header->lodCount > fileSize) || ((unsigned int)header->materialCount > fileSize) ||
+        ((unsigned int)header->textureCount > fileSize) || ((unsigned int)header->boneCount > fileSize))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file data not valid", fileName);
+        UnloadFileDataView(fileData);
+        return model;
+    }
+
+    unsigned int offset = sizeof(RMDLHeader);
+    bool valid = true;
+
+    const int *meshMaterial = (const int *)ReadRMDLData(fileData, fileSize, &offset, header->meshCount*sizeof(int));
+    const float *lodScreenSizes = (const float *)ReadRMDLData(fileData, fileSize, &offset, header->lodCount*sizeof(float));
+    valid = (meshMaterial != NULL) && (lodScreenSizes != NULL);
+
+    // Load meshes and levels of detail meshes
+    if (valid)
+    {
+        model.meshCount = header->meshCount;
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+        model.meshMaterial = (int *)RL_MALLOC(model.meshCount*sizeof(int));
+        memcpy(model.meshMaterial, meshMaterial, model.meshCount*sizeof(int));
+
+        if (header->lodCount > 0)
+        {
+            model.lodCount = header->lodCount;
+            model.lodMeshes = (Mesh *)RL_CALLOC(model.lodCount*model.meshCount, sizeof(Mesh));
+            model.lodScreenSizes = (float *)RL_MALLOC(model.lodCount*sizeof(float));
+            memcpy(model.lodScreenSizes, lodScreenSizes, model.lodCount*sizeof(float));
+        }
+
+        for (int i = 0; valid && (i < model.meshCount); i++) valid = ReadRMDLMesh(fileData, fileSize, &offset, &model.meshes[i]);
+        for (int i = 0; valid && (i < model.lodCount*model.meshCount); i++) valid = ReadRMDLMesh(fileData, fileSize, &offset, &model.lodMeshes[i]);
+    }
+
+    // Get embedded textures data, loaded once materials are valid
+    const RMDLTexture **textures = (const RMDLTexture **)RL_CALLOC(header->textureCount + 1, sizeof(RMDLTexture *));
+    const unsigned char **texturesData = (const unsigned char **)RL_CALLOC(header->textureCount + 1, sizeof(unsigned char *));
+
+    for (int i = 0; valid && (i < header->textureCount); i++)
+    {
+        textures[i] = (const RMDLTexture *)ReadRMDLData(fileData, fileSize, &offset, sizeof(RMDLTexture));
+        valid = (textures[i] != NULL) && (textures[i]->width > 0) && (textures[i]->height > 0) && (textures[i]->mipmaps > 0) &&
+                (textures[i]->format > 0) && (textures[i]->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+                (textures[i]->dataSize == GetRMDLImageSize(textures[i]->width, textures[i]->height, textures[i]->mipmaps, textures[i]->format));
+
+        if (valid) texturesData[i] = (const unsigned char *)ReadRMDLData(fileData, fileSize, &offset, textures[i]->dataSize);
+        valid = valid && (texturesData[i] != NULL);
+    }
+
+    // Get materials data
+    const float *materialsParams = NULL;
+    const RMDLMaterialMap *materialsMaps = NULL;
+
+    if (valid)
+    {
+        materialsParams = (const float *)ReadRMDLData(fileData, fileSize, &offset, header->materialCount*4*sizeof(float));
+        materialsMaps = (const RMDLMaterialMap *)ReadRMDLData(fileData, fileSize, &offset, header->materialCount*header->mapCount*sizeof(RMDLMaterialMap));
+        valid = (materialsParams != NULL) && (materialsMaps != NULL);
+    }
+
+    // Load skeleton
+    if (valid && (header->boneCount > 0))
+    {
+        const BoneInfo *bones = (const BoneInfo *)ReadRMDLData(fileData, fileSize, &offset, header->boneCount*sizeof(BoneInfo));
+        const Transform *bindPose = (const Transform *)ReadRMDLData(fileData, fileSize, &offset, header->boneCount*sizeof(Transform));
+
+        if ((bones != NULL) && (bindPose != NULL))
+        {
+            model.boneCount = header->boneCount;
+            model.bones = (BoneInfo *)RL_MALLOC(model.boneCount*sizeof(BoneInfo));
+            model.bindPose = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+            memcpy(model.bones, bones, model.boneCount*sizeof(BoneInfo));
+            memcpy(model.bindPose, bindPose, model.boneCount*sizeof(Transform));
+        }
+        else valid = false;
+    }
+
+    if (valid)
+    {
+        // Load materials, embedded textures are loaded once (or queued once per material map)
+        Texture2D *loaded = (Texture2D *)RL_CALLOC(header->textureCount + 1, sizeof(Texture2D));
+        int mapCount = (header->mapCount < MAX_MATERIAL_MAPS)? header->mapCount : MAX_MATERIAL_MAPS;
+
+        model.materialCount = header->materialCount;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            model.materials[i] = LoadMaterialDefault();
+            memcpy(model.materials[i].params, &materialsParams[i*4], 4*sizeof(float));
+
+            for (int m = 0; m < mapCount; m++)
+            {
+                const RMDLMaterialMap *map = &materialsMaps[i*header->mapCount + m];
+
+                model.materials[i].maps[m].color = map->color;
+                model.materials[i].maps[m].value = map->value;
+
+                if ((map->texture < 0) || (map->texture >= header->textureCount)) continue;
+
+                const RMDLTexture *texture = textures[map->texture];
+                Image image = { 0 };
+
+                if ((queue == NULL) && (loaded[map->texture].id != 0))
+                {
+                    model.materials[i].maps[m].texture = loaded[map->texture];
+                    continue;
+                }
+
+                image.data = RL_MALLOC(texture->dataSize);
+                memcpy(image.data, texturesData[map->texture], texture->dataSize);
+                image.width = texture->width;
+                image.height = texture->height;
+                image.mipmaps = texture->mipmaps;
+                image.format = texture->format;
+
+                LoadModelTexture(&model, i, m, image, queue);
+
+                if (queue == NULL) loaded[map->texture] = model.materials[i].maps[m].texture;
+            }
+        }
+
+        RL_FREE(loaded);
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] RMDL file loaded successfully (%i meshes, %i materials)", fileName, model.meshCount, model.materialCount);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file data not valid", fileName);
+        UnloadModel(model);
+        model = (Model){ 0 };
+    }
+
+    RL_FREE(textures);
+    RL_FREE(texturesData);
+    UnloadFileDataView(fileData);
 
     return model;
 }
+
+// Load RMDL file animations
+static ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, unsigned int *animCount)
+{
+    ModelAnimation *animations = NULL;
+    *animCount = 0;
+
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+    if (fileData == NULL) return animations;
+
+    const RMDLHeader *header = (const RMDLHeader *)fileData;
+
+    if ((fileSize < sizeof(RMDLHeader)) || (strncmp(header->id, "RMDL", 4) != 0) || (header->version != 100) || (header->animationsOffset == 0))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file does not contain animations", fileName);
+        UnloadFileDataView(fileData);
+        return animations;
+    }
+
+    // NOTE: Animations are stored at the end of file, offset stored in header to skip model data
+    unsigned int offset = header->animationsOffset;
+    const int *count = (const int *)ReadRMDLData(fileData, fileSize, &offset, sizeof(int));
+
+    if ((count != NULL) && (*count > 0) && ((unsigned int)*count <= fileSize))
+    {
+        animations = (ModelAnimation *)RL_CALLOC(*count, sizeof(ModelAnimation));
+
+        for (int a = 0; a < *count; a++)
+        {
+            const RMDLAnimation *animation = (const RMDLAnimation *)ReadRMDLData(fileData, fileSize, &offset, sizeof(RMDLAnimation));
+            if ((animation == NULL) || (animation->boneCount <= 0) || (animation->frameCount <= 0) ||
+                ((unsigned long long)animation->frameCount*animation->boneCount*sizeof(Transform) > fileSize)) break;
+
+            const BoneInfo *bones = (const BoneInfo *)ReadRMDLData(fileData, fileSize, &offset, animation->boneCount*sizeof(BoneInfo));
+            const Transform *poses = (const Transform *)ReadRMDLData(fileData, fileSize, &offset, animation->frameCount*animation->boneCount*sizeof(Transform));
+            if ((bones == NULL) || (poses == NULL)) break;
+
+            ModelAnimation *anim = &animations[a];
+            anim->boneCount = animation->boneCount;
+            anim->frameCount = animation->frameCount;
+            anim->bones = (BoneInfo *)RL_MALLOC(anim->boneCount*sizeof(BoneInfo));
+            memcpy(anim->bones, bones, anim->boneCount*sizeof(BoneInfo));
+
+            anim->framePoses = (Transform **)RL_MALLOC(anim->frameCount*sizeof(Transform *));
+
+            for (int f = 0; f < anim->frameCount; f++)
+            {
+                anim->framePoses[f] = (Transform *)RL_MALLOC(anim->boneCount*sizeof(Transform));
+                memcpy(anim->framePoses[f], &poses[f*anim->boneCount], anim->boneCount*sizeof(Transform));
+            }
+
+            (*animCount)++;
+        }
+
+        if (*animCount < (unsigned int)*count) TRACELOG(LOG_WARNING, "MODEL: [%s] RMDL file animations data not valid", fileName);
+    }
+
+    UnloadFileDataView(fileData);
+
+    return animations;
+}
+
+// Save model as RMDL file (cooked model), all data blocks aligned to RMDL_ALIGNMENT
+static bool SaveRMDL(Model model, const ModelAnimation *animations, int animCount, const char *fileName)
+{
+    RMDLBuffer buffer = { 0 };
+    RMDLHeader header = { 0 };
+
+    memcpy(header.id, "RMDL", 4);
+    header.version = 100;
+    header.mapCount = MAX_MATERIAL_MAPS;
+    header.meshCount = model.meshCount;
+    header.lodCount = model.lodCount;
+    header.materialCount = model.materialCount;
+    header.boneCount = ((model.bones != NULL) && (model.bindPose != NULL))? model.boneCount : 0;
+
+    // Collect material textures to embed, every texture is stored once
+    Image *images = (Image *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS + 1, sizeof(Image));
+    unsigned int *imageIds = (unsigned int *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS + 1, sizeof(unsigned int));
+    int *mapTextures = (int *)RL_MALLOC((model.materialCount*MAX_MATERIAL_MAPS + 1)*sizeof(int));
+
+    for (int i = 0; i < model.materialCount*MAX_MATERIAL_MAPS; i++)
+    {
+        Texture2D texture = (model.materials[i/MAX_MATERIAL_MAPS].maps != NULL)? model.materials[i/MAX_MATERIAL_MAPS].maps[i%MAX_MATERIAL_MAPS].texture : (Texture2D){ 0 };
+        mapTextures[i] = -1;
+
+        if ((texture.id == 0) || (texture.id == rlGetTextureIdDefault())) continue;
+
+        for (int t = 0; t < header.textureCount; t++) if (imageIds[t] == texture.id) { mapTextures[i] = t; break; }
+
+        if (mapTextures[i] == -1)
+        {
+            Image image = LoadImageFromTexture(texture);
+
+            if (image.data != NULL)
+            {
+                if (texture.mipmaps > 1) ImageMipmaps(&image);
+
+                images[header.textureCount] = image;
+                imageIds[header.textureCount] = texture.id;
+                mapTextures[i] = header.textureCount++;
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [ID %i] Material texture could not be embedded", texture.id);
+        }
+    }
+
+    WriteRMDLData(&buffer, &header, sizeof(RMDLHeader));
+    WriteRMDLData(&buffer, model.meshMaterial, model.meshCount*sizeof(int));
+    WriteRMDLData(&buffer, model.lodScreenSizes, model.lodCount*sizeof(float));
+
+    for (int i = 0; i < model.meshCount; i++) WriteRMDLMesh(&buffer, model.meshes[i]);
+    for (int i = 0; i < model.lodCount*model.meshCount; i++) WriteRMDLMesh(&buffer, model.lodMeshes[i]);
+
+    for (int i = 0; i < header.textureCount; i++)
+    {
+        RMDLTexture texture = { 0 };
+        texture.width = images[i].width;
+        texture.height = images[i].height;
+        texture.mipmaps = images[i].mipmaps;
+        texture.format = images[i].format;
+        texture.dataSize = GetRMDLImageSize(texture.width, texture.height, texture.mipmaps, texture.format);
+
+        WriteRMDLData(&buffer, &texture, sizeof(RMDLTexture));
+        WriteRMDLData(&buffer, images[i].data, texture.dataSize);
+
+        UnloadImage(images[i]);
+    }
+
+    // Materials parameters, then materials maps
+    float *params = (float *)RL_CALLOC(model.materialCount*4 + 1, sizeof(float));
+    RMDLMaterialMap *maps = (RMDLMaterialMap *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS + 1, sizeof(RMDLMaterialMap));
+
+    for (int i = 0; i < model.materialCount*MAX_MATERIAL_MAPS; i++)
+    {
+        Material material = model.materials[i/MAX_MATERIAL_MAPS];
+        if ((i%MAX_MATERIAL_MAPS) == 0) memcpy(&params[(i/MAX_MATERIAL_MAPS)*4], material.params, 4*sizeof(float));
+
+        if (material.maps != NULL)
+        {
+            maps[i].color = material.maps[i%MAX_MATERIAL_MAPS].color;
+            maps[i].value = material.maps[i%MAX_MATERIAL_MAPS].value;
+        }
+        maps[i].texture = mapTextures[i];
+    }
+
+    WriteRMDLData(&buffer, params, model.materialCount*4*sizeof(float));
+    WriteRMDLData(&buffer, maps, model.materialCount*MAX_MATERIAL_MAPS*sizeof(RMDLMaterialMap));
+
+    if (header.boneCount > 0)
+    {
+        WriteRMDLData(&buffer, model.bones, header.boneCount*sizeof(BoneInfo));
+        WriteRMDLData(&buffer, model.bindPose, header.boneCount*sizeof(Transform));
+    }
+
+    // Animations, frame poses stored contiguously
+    if ((animations != NULL) && (animCount > 0))
+    {
+        WriteRMDLData(&buffer, NULL, 0);
+        ((RMDLHeader *)buffer.data)->animationsOffset = buffer.size;
+        WriteRMDLData(&buffer, &animCount, sizeof(int));
+
+        for (int a = 0; a < animCount; a++)
+        {
+            RMDLAnimation animation = { animations[a].boneCount, animations[a].frameCount };
+            Transform *poses = (Transform *)RL_MALLOC(animation.frameCount*animation.boneCount*sizeof(Transform) + 1);
+
+            for (int f = 0; f < animation.frameCount; f++) GetModelAnimationFramePose(animations[a], f, &poses[f*animation.boneCount]);
+
+            WriteRMDLData(&buffer, &animation, sizeof(RMDLAnimation));
+            WriteRMDLData(&buffer, animations[a].bones, animation.boneCount*sizeof(BoneInfo));
+            WriteRMDLData(&buffer, poses, animation.frameCount*animation.boneCount*sizeof(Transform));
+
+            RL_FREE(poses);
+        }
+    }
+
+    bool success = SaveFileData(fileName, buffer.data, buffer.size);
+
+    RL_FREE(buffer.data);
+    RL_FREE(images);
+    RL_FREE(imageIds);
+    RL_FREE(mapTextures);
+    RL_FREE(params);
+    RL_FREE(maps);
+
+    return success;
+}
 #endif
 
 #endif      // SUPPORT_MODULE_RMODELS
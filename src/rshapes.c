@@ -7,6 +7,10 @@
 *     Some functions implement two drawing options: TRIANGLES and QUADS, by default TRIANGLES
 *     are used but QUADS implementation can be selected with SUPPORT_QUADS_DRAW_MODE define
 *
+*     If rlgl render batch builds triangle list indices (RLGL_ENABLE_BATCH_TRIANGLE_LIST), triangles,
+*     fans and polylines are drawn with TRIANGLES, TRIANGLE_FAN and TRIANGLE_STRIP primitives instead,
+*     they share render batch draw calls with QUADS
+*
 *     Some functions define texture coordinates (rlTexCoord2f()) for the shapes and use a
 *     user-provided texture with SetShapesTexture(), the pourpouse of this implementation
 *     is allowing to reduce draw calls when combined with a texture-atlas.
@@ -23,6 +27,10 @@
 *   #define SUPPORT_QUADS_DRAW_MODE
 *       Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*   #define SUPPORT_COLLISION_WORLD
+*       Collision world broadphase: bodies (rectangles, circles, boxes, spheres) stored on a uniform grid
+*       spatial hash, updated incrementally, overlapping pairs and region queries avoid checking all bodies
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -54,10 +62,13 @@
 
 #if defined(SUPPORT_MODULE_RSHAPES)
 
+#include "utils.h"      // Required for: RL_THREAD_LOCAL
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
-#include <float.h>      // Required for: FLT_EPSILON
+#include <stdlib.h>     // Required for: malloc(), free() [Used in collision world]
+#include <string.h>     // Required for: memcpy(), memcmp()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), floorf(), fmaxf()
+#include <float.h>      // Required for: FLT_EPSILON, FLT_MAX
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,12 +81,99 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef SHAPES_TRIG_TABLE_SIZE
+    #define SHAPES_TRIG_TABLE_SIZE     256      // Unit circle sin/cos table entries (power of two), max segments per full circle
+#endif
+#ifndef SHAPES_ARC_CACHE_SIZE
+    #define SHAPES_ARC_CACHE_SIZE        4      // Tessellated arcs cached per thread, reused by fill and lines variants
+#endif
+
+#ifndef SHAPES_LINE_MITER_LIMIT
+    #define SHAPES_LINE_MITER_LIMIT   4.0f      // Max miter join length (relative to half line thickness), longer joins are bevelled
+#endif
+#ifndef COLLISION_BODY_MAX_CELLS
+    #define COLLISION_BODY_MAX_CELLS    64      // Max grid cells covered by a collision body, bigger bodies are checked against all bodies
+#endif
+
+#define SHAPES_CIRCLE_MIN_SEGMENTS       8      // Min segments for adaptive full circles (power of two)
+#define SHAPES_CIRCLE_LEVELS            16      // Max adaptive tessellation levels (segments doubled per level)
 
+#define COLLISION_BODY_NONE              0      // Collision body not used
+#define COLLISION_BODY_BOX               1      // Collision body is a rectangle (2d) or a bounding box (3d)
+#define COLLISION_BODY_SPHERE            2      // Collision body is a circle (2d) or a sphere (3d)
+#define COLLISION_CELL_LIMIT       1048576      // Collision grid cells coordinates limit (clamped)
+
+#ifndef MIN
+    #define MIN(a, b) (((a) < (b))? (a) : (b))
+#endif
+#ifndef MAX
+    #define MAX(a, b) (((a) > (b))? (a) : (b))
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Tessellated unit arc, cached per thread
+// NOTE: Points follow shapes angles convention (x = sin(angle), y = cos(angle)), segments + 1 points
+typedef struct ShapeArc {
+    float startAngle;               // Arc start angle (degrees)
+    float endAngle;                 // Arc end angle (degrees)
+    int segments;                   // Arc segments, 0 for an empty cache entry
+    unsigned int lastUse;           // Cache usage stamp, least recently used entry gets replaced
+    Vector2 points[SHAPES_TRIG_TABLE_SIZE + 1];     // Arc unit points
+} ShapeArc;
+
+// Polyline strip, vertex pairs (one vertex on each side of the line) joined as a triangle strip
+// NOTE: Strip is drawn as TRIANGLE_STRIP if supported by render batch, as QUADS or TRIANGLES otherwise
+typedef struct ShapeStrip {
+    Vector2 a;                      // Last pair vertex on first side
+    Vector2 b;                      // Last pair vertex on second side
+    int count;                      // Pairs added
+} ShapeStrip;
+
+#if defined(SUPPORT_COLLISION_WORLD)
+// Collision world body, 2d bodies are stored with zero depth
+typedef struct CollisionBody {
+    int type;                       // Body shape type (COLLISION_BODY_*)
+    Vector3 min;                    // Bounds minimum
+    Vector3 max;                    // Bounds maximum
+    float radius;                   // Sphere radius, center is bounds center
+    int cellMin[3];                 // Grid cells range minimum
+    int cellMax[3];                 // Grid cells range maximum
+    int listIndex;                  // Index on world grid bodies or large bodies list
+    bool large;                     // Body covers more than COLLISION_BODY_MAX_CELLS, stored out of grid
+    unsigned int mark;              // Ray query stamp, body already visited
+} CollisionBody;
+
+// Collision world grid cell, only cells containing bodies are stored
+typedef struct CollisionCell {
+    int x, y, z;                    // Cell coordinates
+    int next;                       // Next cell on hash bucket, next free cell if unused (-1: none)
+    int count;                      // Bodies count
+    int capacity;                   // Bodies ids capacity
+    int *ids;                       // Bodies ids
+} CollisionCell;
+
+// Collision world, uniform grid spatial hash
+struct CollisionWorld {
+    float cellSize;                 // Grid cell size (world units)
+    float invCellSize;              // Grid cell size inverse
+    int capacity;                   // Bodies capacity, valid ids are [0..capacity - 1]
+    CollisionBody *bodies;          // Bodies, by id
+    int *gridBodies;                // Ids of bodies stored on grid cells
+    int gridCount;                  // Bodies stored on grid cells count
+    int *largeBodies;               // Ids of bodies stored out of grid
+    int largeCount;                 // Bodies stored out of grid count
+
+    int *buckets;                   // Cells hash buckets, first cell index (-1: empty)
+    int bucketMask;                 // Cells hash buckets count - 1 (power of two)
+    CollisionCell *cells;           // Cells storage
+    int cellCount;                  // Cells storage used (including free cells)
+    int cellCapacity;               // Cells storage capacity
+    int freeCell;                   // First free cell (-1: none)
+    unsigned int mark;              // Ray query stamp
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +181,41 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+// NOTE: Tables are filled once on InitWindow(), they are read-only afterwards
+static float shapesSinTable[SHAPES_TRIG_TABLE_SIZE + SHAPES_TRIG_TABLE_SIZE/4];     // sin() of table angles, cos() read a quarter turn ahead
+static float shapesCircleMaxRadius[SHAPES_CIRCLE_LEVELS] = { 0 };                  // Max on-screen radius drawn within error rate, per tessellation level
+static int shapesCircleLevels = 0;                                                  // Tessellation levels available (up to SHAPES_TRIG_TABLE_SIZE segments)
+static float bezierEaseTable[BEZIER_LINE_DIVISIONS + 1] = { 0 };                    // Cubic in-out easing, per line division
+static float bezierQuadBasis[BEZIER_LINE_DIVISIONS + 1][3] = { 0 };                 // Quadratic bezier basis, per line division
+static float bezierCubicBasis[BEZIER_LINE_DIVISIONS + 1][4] = { 0 };                // Cubic bezier basis, per line division
+
+static RL_THREAD_LOCAL ShapeArc shapesArcCache[SHAPES_ARC_CACHE_SIZE] = { 0 };     // Tessellated arcs cache (per thread, rlgl command lists can be recorded on workers)
+static RL_THREAD_LOCAL unsigned int shapesArcCounter = 0;                          // Tessellated arcs cache usage counter
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+extern void InitShapesTables(void);                                 // Init trig tables and tessellation thresholds (called by InitWindow())
+static float GetShapesDrawScale(void);                              // Get current transform scale for on-screen tessellation
+static int GetCircleSegments(float radius, float arcAngle, int segments, int minSegments);  // Get arc segments, adaptive if not enough provided
+static const Vector2 *GetShapeArc(float startAngle, float endAngle, int segments);         // Get unit arc points (cached)
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+static bool DrawShapeSdf(Vector2 center, float halfWidth, float halfHeight, float radius, float thickness, bool pixelLine, Color color); // Draw rounded box as one SDF quad
+#endif
+static void BeginShapeStrip(ShapeStrip *strip, Color color);        // Begin polyline strip drawing
+static void AddShapeStripPair(ShapeStrip *strip, Vector2 a, Vector2 b);     // Add polyline strip vertex pair
+static void EndShapeStrip(void);                                    // End polyline strip drawing
+#if defined(SUPPORT_COLLISION_WORLD)
+static void SetCollisionBody(CollisionWorld *world, int id, int type, Vector3 min, Vector3 max, float radius);  // Add or update collision body, grid cells updated if changed
+static void InsertCollisionBody(CollisionWorld *world, int id);     // Insert collision body into grid cells (or large bodies)
+static void EraseCollisionBody(CollisionWorld *world, int id);      // Erase collision body from grid cells (or large bodies)
+static int FindCollisionCell(const CollisionWorld *world, int x, int y, int z);  // Find grid cell index, -1 if not stored
+static void GetCollisionCellRange(const CollisionWorld *world, Vector3 min, Vector3 max, int *cellMin, int *cellMax);  // Get grid cells range covered by bounds
+static bool CheckCollisionBodies(const CollisionBody *body1, const CollisionBody *body2);  // Check collision between two collision bodies shapes
+static bool CheckCollisionBodyRay(const CollisionBody *body, Vector3 origin, Vector3 direction, float maxDistance);   // Check collision between collision body and ray (normalized direction)
+static int QueryCollisionBody(CollisionWorld *world, const CollisionBody *query, int *ids, int maxIds);  // Get bodies ids colliding with query body
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -101,6 +230,18 @@ void SetShapesTexture(Texture2D texture, Rectangle source)
     texShapesRec = source;
 }
 
+// Get texture that is used for shapes drawing
+Texture2D GetShapesTexture(void)
+{
+    return texShapes;
+}
+
+// Get texture source rectangle that is used for shapes drawing
+Rectangle GetShapesTextureRectangle(void)
+{
+    return texShapesRec;
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -165,72 +306,58 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 // Draw line using cubic-bezier curves in-out
 void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thick, Color color)
 {
-    Vector2 previous = startPos;
-    Vector2 current = { 0 };
+    Vector2 points[BEZIER_LINE_DIVISIONS + 1] = { 0 };
 
-    for (int i = 1; i <= BEZIER_LINE_DIVISIONS; i++)
+    for (int i = 0; i <= BEZIER_LINE_DIVISIONS; i++)
     {
         // Cubic easing in-out
         // NOTE: Easing is calculated only for y position value
-        current.y = EaseCubicInOut((float)i, startPos.y, endPos.y - startPos.y, (float)BEZIER_LINE_DIVISIONS);
-        current.x = previous.x + (endPos.x - startPos.x)/ (float)BEZIER_LINE_DIVISIONS;
-
-        DrawLineEx(previous, current, thick, color);
-
-        previous = current;
+        points[i].y = startPos.y + (endPos.y - startPos.y)*bezierEaseTable[i];
+        points[i].x = startPos.x + (endPos.x - startPos.x)*(float)i/(float)BEZIER_LINE_DIVISIONS;
     }
+
+    // NOTE: Line divisions are drawn as one polyline, joined without gaps between them
+    DrawLineStripEx(points, BEZIER_LINE_DIVISIONS + 1, thick, LINE_JOIN_MITER, LINE_CAP_BUTT, color);
 }
 
 // Draw line using quadratic bezier curves with a control point
 void DrawLineBezierQuad(Vector2 startPos, Vector2 endPos, Vector2 controlPos, float thick, Color color)
 {
-    const float step = 1.0f/BEZIER_LINE_DIVISIONS;
-
-    Vector2 previous = startPos;
-    Vector2 current = { 0 };
-    float t = 0.0f;
+    Vector2 points[BEZIER_LINE_DIVISIONS + 1] = { 0 };
 
     for (int i = 0; i <= BEZIER_LINE_DIVISIONS; i++)
     {
-        t = step*i;
-        float a = powf(1 - t, 2);
-        float b = 2*(1 - t)*t;
-        float c = powf(t, 2);
+        // NOTE: Basis weights are precomputed per line division
+        float a = bezierQuadBasis[i][0];
+        float b = bezierQuadBasis[i][1];
+        float c = bezierQuadBasis[i][2];
 
         // NOTE: The easing functions aren't suitable here because they don't take a control point
-        current.y = a*startPos.y + b*controlPos.y + c*endPos.y;
-        current.x = a*startPos.x + b*controlPos.x + c*endPos.x;
-
-        DrawLineEx(previous, current, thick, color);
-
-        previous = current;
+        points[i].y = a*startPos.y + b*controlPos.y + c*endPos.y;
+        points[i].x = a*startPos.x + b*controlPos.x + c*endPos.x;
     }
+
+    DrawLineStripEx(points, BEZIER_LINE_DIVISIONS + 1, thick, LINE_JOIN_MITER, LINE_CAP_BUTT, color);
 }
 
 // Draw line using cubic bezier curves with 2 control points
 void DrawLineBezierCubic(Vector2 startPos, Vector2 endPos, Vector2 startControlPos, Vector2 endControlPos, float thick, Color color)
 {
-    const float step = 1.0f/BEZIER_LINE_DIVISIONS;
-
-    Vector2 previous = startPos;
-    Vector2 current = { 0 };
-    float t = 0.0f;
+    Vector2 points[BEZIER_LINE_DIVISIONS + 1] = { 0 };
 
     for (int i = 0; i <= BEZIER_LINE_DIVISIONS; i++)
     {
-        t = step*i;
-        float a = powf(1 - t, 3);
-        float b = 3*powf(1 - t, 2)*t;
-        float c = 3*(1-t)*powf(t, 2);
-        float d = powf(t, 3);
-
-        current.y = a*startPos.y + b*startControlPos.y + c*endControlPos.y + d*endPos.y;
-        current.x = a*startPos.x + b*startControlPos.x + c*endControlPos.x + d*endPos.x;
-
-        DrawLineEx(previous, current, thick, color);
-
-        previous = current;
+        // NOTE: Basis weights are precomputed per line division
+        float a = bezierCubicBasis[i][0];
+        float b = bezierCubicBasis[i][1];
+        float c = bezierCubicBasis[i][2];
+        float d = bezierCubicBasis[i][3];
+
+        points[i].y = a*startPos.y + b*startControlPos.y + c*endControlPos.y + d*endPos.y;
+        points[i].x = a*startPos.x + b*startControlPos.x + c*endControlPos.x + d*endPos.x;
     }
+
+    DrawLineStripEx(points, BEZIER_LINE_DIVISIONS + 1, thick, LINE_JOIN_MITER, LINE_CAP_BUTT, color);
 }
 
 // Draw lines sequence
@@ -252,6 +379,142 @@ void DrawLineStrip(Vector2 *points, int pointCount, Color color)
     }
 }
 
+// Draw lines sequence defining thickness, joins and caps
+// NOTE: Lines are drawn as one strip of vertex pairs (one vertex on each side of the line),
+// consecutive duplicated points are skipped
+void DrawLineStripEx(Vector2 *points, int pointCount, float thick, int joinType, int capType, Color color)
+{
+    if ((pointCount < 2) || (thick <= 0.0f)) return;
+
+    float halfThick = thick/2.0f;
+
+    // Find first segment, points could be duplicated
+    int current = 0;
+    int next = 1;
+    while ((next < pointCount) && (points[next].x == points[current].x) && (points[next].y == points[current].y)) next++;
+    if (next == pointCount) return;
+
+    Vector2 delta = { points[next].x - points[current].x, points[next].y - points[current].y };
+    float length = sqrtf(delta.x*delta.x + delta.y*delta.y);
+    Vector2 direction = { delta.x/length, delta.y/length };
+    Vector2 normal = { -direction.y*halfThick, direction.x*halfThick };
+
+    // Round caps and joins segments, based on the error rate (usually 0.5f)
+    int capSteps = (GetCircleSegments(halfThick, 180.0f, 0, 2) + 1)/2;
+    float capStepSin = sinf(DEG2RAD*90.0f/(float)capSteps);
+    float capStepCos = cosf(DEG2RAD*90.0f/(float)capSteps);
+
+    ShapeStrip strip = { 0 };
+    BeginShapeStrip(&strip, color);
+
+    // Start cap
+    Vector2 start = points[current];
+    if (capType == LINE_CAP_SQUARE) start = (Vector2){ start.x - direction.x*halfThick, start.y - direction.y*halfThick };
+    else if (capType == LINE_CAP_ROUND)
+    {
+        // Half circle from line start back point, pairs are symmetric to line direction
+        float back = 1.0f;
+        float side = 0.0f;
+
+        for (int i = 0; i < capSteps; i++)
+        {
+            Vector2 center = { start.x - direction.x*halfThick*back, start.y - direction.y*halfThick*back };
+            AddShapeStripPair(&strip, (Vector2){ center.x - normal.x*side, center.y - normal.y*side }, (Vector2){ center.x + normal.x*side, center.y + normal.y*side });
+
+            float rotated = back*capStepCos - side*capStepSin;
+            side = side*capStepCos + back*capStepSin;
+            back = rotated;
+        }
+    }
+
+    AddShapeStripPair(&strip, (Vector2){ start.x - normal.x, start.y - normal.y }, (Vector2){ start.x + normal.x, start.y + normal.y });
+
+    // Joins
+    current = next;
+
+    for (next = current + 1; next < pointCount; next++)
+    {
+        if ((points[next].x == points[current].x) && (points[next].y == points[current].y)) continue;
+
+        Vector2 point = points[current];
+        Vector2 nextDelta = { points[next].x - point.x, points[next].y - point.y };
+        float nextLength = sqrtf(nextDelta.x*nextDelta.x + nextDelta.y*nextDelta.y);
+        Vector2 nextDirection = { nextDelta.x/nextLength, nextDelta.y/nextLength };
+        Vector2 nextNormal = { -nextDirection.y*halfThick, nextDirection.x*halfThick };
+
+        float cross = direction.x*nextDirection.y - direction.y*nextDirection.x;
+        float dot = direction.x*nextDirection.x + direction.y*nextDirection.y;
+
+        // Miter offset: sum of both normals scaled to reach both offset lines intersection
+        Vector2 miter = { normal.x + nextNormal.x, normal.y + nextNormal.y };
+        float miterLengthSqr = miter.x*miter.x + miter.y*miter.y;
+        float miterScale = (miterLengthSqr > (halfThick*halfThick*1e-6f))? 2.0f*halfThick*halfThick/miterLengthSqr : 0.0f;
+        float miterLength = sqrtf(miterLengthSqr)*miterScale;
+
+        if ((joinType == LINE_JOIN_MITER) && (miterScale > 0.0f) && (miterLength <= halfThick*SHAPES_LINE_MITER_LIMIT))
+        {
+            AddShapeStripPair(&strip, (Vector2){ point.x - miter.x*miterScale, point.y - miter.y*miterScale }, (Vector2){ point.x + miter.x*miterScale, point.y + miter.y*miterScale });
+        }
+        else
+        {
+            // Inner side point is limited to shorter segment length, outer side is bevelled or rounded
+            float innerLength = fminf(miterLength, sqrtf(halfThick*halfThick + fminf(length, nextLength)*fminf(length, nextLength)));
+            float innerScale = (miterLength > 0.0f)? miterScale*innerLength/miterLength : 0.0f;
+            float outerSide = (cross > 0.0f)? -1.0f : 1.0f;     // Turning to normal side, outer side is the opposite one
+            Vector2 inner = { point.x - outerSide*miter.x*innerScale, point.y - outerSide*miter.y*innerScale };
+
+            int steps = 1;
+            if (joinType == LINE_JOIN_ROUND) steps = GetCircleSegments(halfThick, RAD2DEG*atan2f(fabsf(cross), dot), 0, 1);
+
+            float stepAngle = atan2f(cross, dot)/(float)steps;
+            float stepSin = sinf(stepAngle);
+            float stepCos = cosf(stepAngle);
+            Vector2 offset = { outerSide*normal.x, outerSide*normal.y };
+
+            for (int i = 0; i <= steps; i++)
+            {
+                if (i == steps) offset = (Vector2){ outerSide*nextNormal.x, outerSide*nextNormal.y };
+
+                Vector2 outer = { point.x + offset.x, point.y + offset.y };
+                if (outerSide < 0.0f) AddShapeStripPair(&strip, outer, inner);
+                else AddShapeStripPair(&strip, inner, outer);
+
+                offset = (Vector2){ offset.x*stepCos - offset.y*stepSin, offset.x*stepSin + offset.y*stepCos };
+            }
+        }
+
+        direction = nextDirection;
+        normal = nextNormal;
+        length = nextLength;
+        current = next;
+    }
+
+    // End cap
+    Vector2 end = points[current];
+    if (capType == LINE_CAP_SQUARE) end = (Vector2){ end.x + direction.x*halfThick, end.y + direction.y*halfThick };
+
+    AddShapeStripPair(&strip, (Vector2){ end.x - normal.x, end.y - normal.y }, (Vector2){ end.x + normal.x, end.y + normal.y });
+
+    if (capType == LINE_CAP_ROUND)
+    {
+        // Half circle to line end front point
+        float front = 0.0f;
+        float side = 1.0f;
+
+        for (int i = 0; i < capSteps; i++)
+        {
+            float rotated = front*capStepCos + side*capStepSin;
+            side = side*capStepCos - front*capStepSin;
+            front = rotated;
+
+            Vector2 center = { end.x + direction.x*halfThick*front, end.y + direction.y*halfThick*front };
+            AddShapeStripPair(&strip, (Vector2){ center.x - normal.x*side, center.y - normal.y*side }, (Vector2){ center.x + normal.x*side, center.y + normal.y*side });
+        }
+    }
+
+    EndShapeStrip();
+}
+
 // Draw a color-filled circle
 void DrawCircle(int centerX, int centerY, float radius, Color color)
 {
@@ -274,19 +537,27 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+    // Calculate segments from on-screen radius if not enough provided, based on the error rate (usually 0.5f)
+    segments = GetCircleSegments(radius, endAngle - startAngle, segments, minSegments);
 
-        if (segments <= 0) segments = minSegments;
-    }
+    const Vector2 *arc = GetShapeArc(startAngle, endAngle, segments);
+    int index = 0;
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlCheckRenderBatchLimit(segments + 2);
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(texShapes.id);
+
+    rlBegin(RL_TRIANGLE_FAN);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+
+        rlVertex2f(center.x, center.y);
+        for (; index <= segments; index++) rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+    rlEnd();
+
+    rlSetTexture(0);
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*segments/2);
 
     rlSetTexture(texShapes.id);
@@ -301,15 +572,15 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
+            rlVertex2f(center.x + arc[index + 2].x*radius, center.y + arc[index + 2].y*radius);
 
-            angle += (stepLength*2);
+            index += 2;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -321,10 +592,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -341,10 +612,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -366,17 +637,11 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    // Calculate segments from on-screen radius if not enough provided, based on the error rate (usually 0.5f)
+    segments = GetCircleSegments(radius, endAngle - startAngle, segments, minSegments);
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *arc = GetShapeArc(startAngle, endAngle, segments);
+    int index = 0;
 
     // Hide the cap lines when the circle is full
     bool showCapLines = true;
@@ -390,24 +655,24 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+            rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
         }
     rlEnd();
 }
@@ -416,17 +681,20 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
-    rlCheckRenderBatchLimit(3*36);
+    int segments = GetCircleSegments(radius, 360.0f, 0, 4);
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, segments);
+
+    rlCheckRenderBatchLimit(3*segments);
 
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radius, (float)centerY + cosf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + arc[i].x*radius, (float)centerY + arc[i].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radius, (float)centerY + cosf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + arc[i + 1].x*radius, (float)centerY + arc[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -435,22 +703,32 @@ void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Co
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues
 void DrawCircleV(Vector2 center, float radius, Color color)
 {
-    DrawCircleSector(center, radius, 0, 360, 36, color);
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    if (DrawShapeSdf(center, radius, radius, radius, 0.0f, false, color)) return;
+#endif
+
+    DrawCircleSector(center, radius, 0, 360, 0, color);
 }
 
 // Draw circle outline
 void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 {
-    rlCheckRenderBatchLimit(2*36);
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    if (DrawShapeSdf((Vector2){ (float)centerX, (float)centerY }, radius, radius, radius, 0.0f, true, color)) return;
+#endif
+
+    int segments = GetCircleSegments(radius, 360.0f, 0, 4);
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, segments);
+
+    rlCheckRenderBatchLimit(2*segments);
 
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radius, centerY + cosf(DEG2RAD*i)*radius);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radius, centerY + cosf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(centerX + arc[i].x*radius, centerY + arc[i].y*radius);
+            rlVertex2f(centerX + arc[i + 1].x*radius, centerY + arc[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -458,15 +736,19 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
-    rlCheckRenderBatchLimit(3*36);
+    // NOTE: Segments are calculated for the larger radius, unit circle outline is shared with circles
+    int segments = GetCircleSegments(fmaxf(radiusH, radiusV), 360.0f, 0, 4);
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, segments);
+
+    rlCheckRenderBatchLimit(3*segments);
 
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radiusH, (float)centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radiusH, (float)centerY + cosf(DEG2RAD*(i + 10))*radiusV);
+            rlVertex2f((float)centerX + arc[i].x*radiusH, (float)centerY + arc[i].y*radiusV);
+            rlVertex2f((float)centerX + arc[i + 1].x*radiusH, (float)centerY + arc[i + 1].y*radiusV);
         }
     rlEnd();
 }
@@ -474,14 +756,17 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
-    rlCheckRenderBatchLimit(2*36);
+    int segments = GetCircleSegments(fmaxf(radiusH, radiusV), 360.0f, 0, 4);
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, segments);
+
+    rlCheckRenderBatchLimit(2*segments);
 
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radiusH, centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radiusH, centerY + cosf(DEG2RAD*(i + 10))*radiusV);
+            rlVertex2f(centerX + arc[i].x*radiusH, centerY + arc[i].y*radiusV);
+            rlVertex2f(centerX + arc[i + 1].x*radiusH, centerY + arc[i + 1].y*radiusV);
         }
     rlEnd();
 }
@@ -512,14 +797,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    // Calculate segments from on-screen radius if not enough provided, based on the error rate (usually 0.5f)
+    segments = GetCircleSegments(outerRadius, endAngle - startAngle, segments, minSegments);
 
     // Not a ring
     if (innerRadius <= 0.0f)
@@ -528,8 +807,14 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // Full ring is a circle band
+    if (((endAngle - startAngle) >= 360.0f) &&
+        DrawShapeSdf(center, outerRadius, outerRadius, outerRadius, outerRadius - innerRadius, false, color)) return;
+#endif
+
+    const Vector2 *arc = GetShapeArc(startAngle, endAngle, segments);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*segments);
@@ -542,18 +827,18 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 
@@ -566,15 +851,15 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -606,14 +891,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
-    if (segments < minSegments)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
-
-        if (segments <= 0) segments = minSegments;
-    }
+    // Calculate segments from on-screen radius if not enough provided, based on the error rate (usually 0.5f)
+    segments = GetCircleSegments(outerRadius, endAngle - startAngle, segments, minSegments);
 
     if (innerRadius <= 0.0f)
     {
@@ -621,8 +900,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    const Vector2 *arc = GetShapeArc(startAngle, endAngle, segments);
+    int index = 0;
 
     bool showCapLines = true;
     int limit = 4*(segments + 1);
@@ -634,28 +913,28 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+            rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+            rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
         }
     rlEnd();
 }
@@ -729,17 +1008,15 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
         rlNormal3f(0.0f, 0.0f, 1.0f);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+        float left = texShapesRec.x/texShapes.width;
+        float right = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+        float top = texShapesRec.y/texShapes.height;
+        float bottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
 
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
+        // Quad corners: top-left, bottom-left, bottom-right, top-right
+        const float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+        const float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+        rlTexCoordVertex2fv(texcoords, vertices, 4);
 
     rlEnd();
 
@@ -751,13 +1028,11 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
 
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rlVertex2f(topLeft.x, topLeft.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(topRight.x, topRight.y);
-
-        rlVertex2f(topRight.x, topRight.y);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-        rlVertex2f(bottomRight.x, bottomRight.y);
+        const float vertices[12] = {
+            topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, topRight.x, topRight.y,
+            topRight.x, topRight.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y
+        };
+        rlVertex2fv(vertices, 6);
 
     rlEnd();
 #endif
@@ -885,16 +1160,17 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
-    // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
-        if (segments <= 0) segments = 4;
-    }
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // NOTE: Capsules are rounded rectangles with roundness 1.0f
+    if (DrawShapeSdf((Vector2){ rec.x + rec.width/2, rec.y + rec.height/2 }, rec.width/2, rec.height/2, radius, 0.0f, false, color)) return;
+#endif
 
-    float stepLength = 90.0f/(float)segments;
+    // Calculate number of segments to use for the corners, based on the error rate (usually 0.5f)
+    // NOTE: The 4 corners are read from one full circle outline, shared with DrawRectangleRoundedLines()
+    segments = GetCircleSegments(radius, 90.0f, segments, 4);
+    if (segments > SHAPES_TRIG_TABLE_SIZE/4) segments = SHAPES_TRIG_TABLE_SIZE/4;
+
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, 4*segments);
 
     /*
     Quick sketch to make sense of all of this,
@@ -922,7 +1198,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     };
 
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
-    const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
+    const int corners[4] = { 2*segments, segments, 0, 3*segments };   // Corners first outline point: 180, 90, 0 and 270 degrees
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(16*segments/2 + 5*4);
@@ -933,7 +1209,7 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = corners[k];
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
@@ -943,12 +1219,12 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-                angle += (stepLength*2);
+                rlVertex2f(center.x + arc[index + 2].x*radius, center.y + arc[index + 2].y*radius);
+                index += 2;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -958,9 +1234,9 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
             }
@@ -1031,15 +1307,15 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            int index = corners[k];
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + arc[index].x*radius, center.y + arc[index].y*radius);
+                rlVertex2f(center.x + arc[index + 1].x*radius, center.y + arc[index + 1].y*radius);
+                index++;
             }
         }
 
@@ -1109,16 +1385,18 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
-    // Calculate number of segments to use for the corners
-    if (segments < 4)
-    {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
-        if (segments <= 0) segments = 4;
-    }
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+    // NOTE: Outline is drawn outside rec, thin lines (lineThick <= 1) are a one pixel line on the outer border
+    if (DrawShapeSdf((Vector2){ rec.x + rec.width/2, rec.y + rec.height/2 }, rec.width/2 + lineThick, rec.height/2 + lineThick,
+        radius + lineThick, lineThick, (lineThick <= 1), color)) return;
+#endif
 
-    float stepLength = 90.0f/(float)segments;
+    // Calculate number of segments to use for the corners, based on the error rate (usually 0.5f)
+    // NOTE: The 4 corners are read from one full circle outline, shared with DrawRectangleRounded()
+    segments = GetCircleSegments(radius + lineThick, 90.0f, segments, 4);
+    if (segments > SHAPES_TRIG_TABLE_SIZE/4) segments = SHAPES_TRIG_TABLE_SIZE/4;
+
+    const Vector2 *arc = GetShapeArc(0.0f, 360.0f, 4*segments);
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1152,7 +1430,7 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
         {(float)(rec.x + rec.width) - innerRadius, (float)(rec.y + rec.height) - innerRadius}, {(float)rec.x + innerRadius, (float)(rec.y + rec.height) - innerRadius} // P18, P19
     };
 
-    const float angles[4] = { 180.0f, 90.0f, 0.0f, 270.0f };
+    const int corners[4] = { 2*segments, segments, 0, 3*segments };   // Corners first outline point: 180, 90, 0 and 270 degrees
 
     if (lineThick > 1)
     {
@@ -1166,21 +1444,21 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = corners[k];
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1238,22 +1516,22 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = corners[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*innerRadius, center.y + arc[index].y*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*innerRadius, center.y + arc[index + 1].y*innerRadius);
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1305,15 +1583,15 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                int index = corners[k];
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + arc[index].x*outerRadius, center.y + arc[index].y*outerRadius);
+                    rlVertex2f(center.x + arc[index + 1].x*outerRadius, center.y + arc[index + 1].y*outerRadius);
+                    index++;
                 }
             }
 
@@ -1333,7 +1611,21 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlCheckRenderBatchLimit(3);
+
+    rlSetTexture(texShapes.id);
+
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        rlVertex2f(v1.x, v1.y);
+        rlVertex2f(v2.x, v2.y);
+        rlVertex2f(v3.x, v3.y);
+    rlEnd();
+
+    rlSetTexture(0);
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4);
 
     rlSetTexture(texShapes.id);
@@ -1393,6 +1685,18 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
 {
     if (pointCount >= 3)
     {
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        rlCheckRenderBatchLimit(pointCount);
+
+        rlSetTexture(texShapes.id);
+        rlBegin(RL_TRIANGLE_FAN);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+
+            for (int i = 0; i < pointCount; i++) rlVertex2f(points[i].x, points[i].y);
+        rlEnd();
+        rlSetTexture(0);
+#else
         rlCheckRenderBatchLimit((pointCount - 2)*4);
 
         rlSetTexture(texShapes.id);
@@ -1415,6 +1719,7 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
             }
         rlEnd();
         rlSetTexture(0);
+#endif
     }
 }
 
@@ -1424,6 +1729,18 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 {
     if (pointCount >= 3)
     {
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        rlCheckRenderBatchLimit(pointCount);
+
+        rlSetTexture(texShapes.id);
+        rlBegin(RL_TRIANGLE_STRIP);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+
+            for (int i = 0; i < pointCount; i++) rlVertex2f(points[i].x, points[i].y);
+        rlEnd();
+        rlSetTexture(0);
+#else
         rlCheckRenderBatchLimit(3*(pointCount - 2));
 
         rlBegin(RL_TRIANGLES);
@@ -1445,6 +1762,7 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
                 }
             }
         rlEnd();
+#endif
     }
 }
 
@@ -1454,7 +1772,9 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
     if (sides < 3) sides = 3;
     float centralAngle = 0.0f;
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlCheckRenderBatchLimit(sides + 2); // Center and sides + 1 points, one fan
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*sides); // Each side is a quad
 #else
     rlCheckRenderBatchLimit(3*sides);
@@ -1464,7 +1784,22 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
         rlTranslatef(center.x, center.y, 0.0f);
         rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+        rlSetTexture(texShapes.id);
+
+        rlBegin(RL_TRIANGLE_FAN);
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+
+            rlVertex2f(0, 0);
+            for (int i = 0; i <= sides; i++)
+            {
+                centralAngle = DEG2RAD*360.0f*(float)(i%sides)/(float)sides;
+                rlVertex2f(sinf(centralAngle)*radius, cosf(centralAngle)*radius);
+            }
+        rlEnd();
+        rlSetTexture(0);
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
         rlSetTexture(texShapes.id);
 
         rlBegin(RL_QUADS);
@@ -1532,11 +1867,12 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
 void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color)
 {
     if (sides < 3) sides = 3;
-    float centralAngle = 0.0f;
     float exteriorAngle = 360.0f/(float)sides;
     float innerRadius = radius - (lineThick*cosf(DEG2RAD*exteriorAngle/2.0f));
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlCheckRenderBatchLimit(2*(sides + 1));
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
     rlCheckRenderBatchLimit(4*sides);
 #else
     rlCheckRenderBatchLimit(6*sides);
@@ -1546,48 +1882,19 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, fl
         rlTranslatef(center.x, center.y, 0.0f);
         rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-        rlSetTexture(texShapes.id);
+        // NOTE: Sides are drawn as one closed strip, inner and outer vertex are shared by consecutive sides
+        ShapeStrip strip = { 0 };
+        BeginShapeStrip(&strip, color);
 
-        rlBegin(RL_QUADS);
-            for (int i = 0; i < sides; i++)
+            for (int i = 0; i <= sides; i++)
             {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-
-                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius, cosf(DEG2RAD*centralAngle)*innerRadius);
-
-                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
+                float centralAngle = DEG2RAD*exteriorAngle*(float)(i%sides);
+                Vector2 direction = { sinf(centralAngle), cosf(centralAngle) };
 
-                centralAngle += exteriorAngle;
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-
-                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius, cosf(DEG2RAD*centralAngle)*innerRadius);
+                AddShapeStripPair(&strip, (Vector2){ direction.x*innerRadius, direction.y*innerRadius }, (Vector2){ direction.x*radius, direction.y*radius });
             }
-        rlEnd();
-        rlSetTexture(0);
-#else
-        rlBegin(RL_TRIANGLES);
-            for (int i = 0; i < sides; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                float nextAngle = centralAngle + exteriorAngle;
-
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*radius, cosf(DEG2RAD*centralAngle)*radius);
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius, cosf(DEG2RAD*centralAngle)*innerRadius);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*radius, cosf(DEG2RAD*nextAngle)*radius);
-
-                rlVertex2f(sinf(DEG2RAD*centralAngle)*innerRadius, cosf(DEG2RAD*centralAngle)*innerRadius);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*radius, cosf(DEG2RAD*nextAngle)*radius);
-                rlVertex2f(sinf(DEG2RAD*nextAngle)*innerRadius, cosf(DEG2RAD*nextAngle)*innerRadius);
 
-                centralAngle = nextAngle;
-            }
-        rlEnd();
-#endif
+        EndShapeStrip();
     rlPopMatrix();
 }
 
@@ -1802,18 +2109,887 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
 }
 
 //----------------------------------------------------------------------------------
-// Module specific Functions Definition
+// Module Functions Definition - Collision World functions (broadphase)
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_COLLISION_WORLD)
+// Load collision world, bodies stored on uniform grid spatial hash with provided cell size
+// NOTE: Bodies ids are provided by user in range [0..capacity - 1], cell size should fit most bodies
+CollisionWorld *LoadCollisionWorld(float cellSize, int capacity)
+{
+    if ((cellSize <= 0.0f) || (capacity <= 0))
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: Collision world parameters not valid");
+        return NULL;
+    }
 
-// Cubic easing in-out
-// NOTE: Used by DrawLineBezier() only
-static float EaseCubicInOut(float t, float b, float c, float d)
+    CollisionWorld *world = (CollisionWorld *)RL_CALLOC(1, sizeof(CollisionWorld));
+
+    world->cellSize = cellSize;
+    world->invCellSize = 1.0f/cellSize;
+    world->capacity = capacity;
+    world->bodies = (CollisionBody *)RL_CALLOC(capacity, sizeof(CollisionBody));
+    world->gridBodies = (int *)RL_MALLOC(capacity*sizeof(int));
+    world->largeBodies = (int *)RL_MALLOC(capacity*sizeof(int));
+
+    // Hash buckets: power of two, two buckets per body
+    int buckets = 64;
+    while (buckets < 2*capacity) buckets *= 2;
+
+    world->buckets = (int *)RL_MALLOC(buckets*sizeof(int));
+    for (int i = 0; i < buckets; i++) world->buckets[i] = -1;
+    world->bucketMask = buckets - 1;
+    world->freeCell = -1;
+
+    TRACELOG(LOG_INFO, "SHAPES: Collision world loaded successfully (cell size: %.2f | %i bodies)", cellSize, capacity);
+
+    return world;
+}
+
+// Unload collision world
+void UnloadCollisionWorld(CollisionWorld *world)
 {
-    if ((t /= 0.5f*d) < 1) return 0.5f*c*t*t*t + b;
+    if (world == NULL) return;
 
-    t -= 2;
+    for (int i = 0; i < world->cellCount; i++) RL_FREE(world->cells[i].ids);
 
-    return 0.5f*c*(t*t*t + 2.0f) + b;
+    RL_FREE(world->cells);
+    RL_FREE(world->buckets);
+    RL_FREE(world->largeBodies);
+    RL_FREE(world->gridBodies);
+    RL_FREE(world->bodies);
+    RL_FREE(world);
+}
+
+// Add or move rectangle collision body (2d)
+void SetCollisionBodyRec(CollisionWorld *world, int id, Rectangle rec)
+{
+    SetCollisionBody(world, id, COLLISION_BODY_BOX, (Vector3){ rec.x, rec.y, 0.0f }, (Vector3){ rec.x + rec.width, rec.y + rec.height, 0.0f }, 0.0f);
+}
+
+// Add or move circle collision body (2d)
+void SetCollisionBodyCircle(CollisionWorld *world, int id, Vector2 center, float radius)
+{
+    SetCollisionBody(world, id, COLLISION_BODY_SPHERE, (Vector3){ center.x - radius, center.y - radius, 0.0f }, (Vector3){ center.x + radius, center.y + radius, 0.0f }, radius);
+}
+
+// Add or move bounding box collision body (3d)
+void SetCollisionBodyBox(CollisionWorld *world, int id, BoundingBox box)
+{
+    SetCollisionBody(world, id, COLLISION_BODY_BOX, box.min, box.max, 0.0f);
+}
+
+// Add or move sphere collision body (3d)
+void SetCollisionBodySphere(CollisionWorld *world, int id, Vector3 center, float radius)
+{
+    SetCollisionBody(world, id, COLLISION_BODY_SPHERE, (Vector3){ center.x - radius, center.y - radius, center.z - radius },
+        (Vector3){ center.x + radius, center.y + radius, center.z + radius }, radius);
+}
+
+// Remove collision body from world
+void RemoveCollisionBody(CollisionWorld *world, int id)
+{
+    if ((world == NULL) || (id < 0) || (id >= world->capacity) || (world->bodies[id].type == COLLISION_BODY_NONE)) return;
+
+    EraseCollisionBody(world, id);
+    world->bodies[id].type = COLLISION_BODY_NONE;
 }
 
+// Get colliding bodies pairs (idA < idB), returns pairs count (up to maxPairs)
+// NOTE: Every pair is reported once, on the first grid cell shared by both bodies
+int GetCollisionPairs(CollisionWorld *world, CollisionPair *pairs, int maxPairs)
+{
+    int count = 0;
+
+    if ((world == NULL) || (pairs == NULL)) return 0;
+
+    for (int i = 0; (i < world->gridCount) && (count < maxPairs); i++)
+    {
+        int idA = world->gridBodies[i];
+        const CollisionBody *bodyA = &world->bodies[idA];
+
+        for (int z = bodyA->cellMin[2]; z <= bodyA->cellMax[2]; z++)
+        {
+            for (int y = bodyA->cellMin[1]; y <= bodyA->cellMax[1]; y++)
+            {
+                for (int x = bodyA->cellMin[0]; x <= bodyA->cellMax[0]; x++)
+                {
+                    const CollisionCell *cell = &world->cells[FindCollisionCell(world, x, y, z)];
+
+                    for (int k = 0; (k < cell->count) && (count < maxPairs); k++)
+                    {
+                        int idB = cell->ids[k];
+                        if (idB <= idA) continue;
+
+                        const CollisionBody *bodyB = &world->bodies[idB];
+
+                        // Pair is reported on first shared cell only
+                        if ((x != MAX(bodyA->cellMin[0], bodyB->cellMin[0])) || (y != MAX(bodyA->cellMin[1], bodyB->cellMin[1])) ||
+                            (z != MAX(bodyA->cellMin[2], bodyB->cellMin[2]))) continue;
+
+                        if (CheckCollisionBodies(bodyA, bodyB)) pairs[count++] = (CollisionPair){ idA, idB };
+                    }
+                }
+            }
+        }
+    }
+
+    // Large bodies are checked against all bodies
+    for (int i = 0; (i < world->largeCount) && (count < maxPairs); i++)
+    {
+        int idA = world->largeBodies[i];
+
+        for (int k = 0; (k < world->gridCount + world->largeCount) && (count < maxPairs); k++)
+        {
+            if ((k >= world->gridCount) && ((k - world->gridCount) <= i)) continue;
+
+            int idB = (k < world->gridCount)? world->gridBodies[k] : world->largeBodies[k - world->gridCount];
+
+            if (CheckCollisionBodies(&world->bodies[idA], &world->bodies[idB])) pairs[count++] = (CollisionPair){ MIN(idA, idB), MAX(idA, idB) };
+        }
+    }
+
+    return count;
+}
+
+// Get bodies ids colliding with rectangle, returns ids count (up to maxIds)
+int QueryCollisionRec(CollisionWorld *world, Rectangle rec, int *ids, int maxIds)
+{
+    CollisionBody query = { COLLISION_BODY_BOX, { rec.x, rec.y, 0.0f }, { rec.x + rec.width, rec.y + rec.height, 0.0f }, 0.0f };
+
+    return QueryCollisionBody(world, &query, ids, maxIds);
+}
+
+// Get bodies ids colliding with circle, returns ids count (up to maxIds)
+int QueryCollisionCircle(CollisionWorld *world, Vector2 center, float radius, int *ids, int maxIds)
+{
+    CollisionBody query = { COLLISION_BODY_SPHERE, { center.x - radius, center.y - radius, 0.0f }, { center.x + radius, center.y + radius, 0.0f }, radius };
+
+    return QueryCollisionBody(world, &query, ids, maxIds);
+}
+
+// Get bodies ids colliding with bounding box, returns ids count (up to maxIds)
+int QueryCollisionBox(CollisionWorld *world, BoundingBox box, int *ids, int maxIds)
+{
+    CollisionBody query = { COLLISION_BODY_BOX, box.min, box.max, 0.0f };
+
+    return QueryCollisionBody(world, &query, ids, maxIds);
+}
+
+// Get bodies ids colliding with sphere, returns ids count (up to maxIds)
+int QueryCollisionSphere(CollisionWorld *world, Vector3 center, float radius, int *ids, int maxIds)
+{
+    CollisionBody query = { COLLISION_BODY_SPHERE, { center.x - radius, center.y - radius, center.z - radius }, { center.x + radius, center.y + radius, center.z + radius }, radius };
+
+    return QueryCollisionBody(world, &query, ids, maxIds);
+}
+
+// Get bodies ids hit by ray up to max distance, returns ids count (up to maxIds)
+// NOTE: Grid cells are traversed along the ray, ids are roughly sorted from nearest to farthest,
+// 2d bodies can be queried with rays on z = 0 plane
+int QueryCollisionRay(CollisionWorld *world, Ray ray, float maxDistance, int *ids, int maxIds)
+{
+    int count = 0;
+
+    if ((world == NULL) || (ids == NULL)) return 0;
+
+    float length = sqrtf(ray.direction.x*ray.direction.x + ray.direction.y*ray.direction.y + ray.direction.z*ray.direction.z);
+    if (length <= 0.0f) return 0;
+
+    float origin[3] = { ray.position.x, ray.position.y, ray.position.z };
+    float direction[3] = { ray.direction.x/length, ray.direction.y/length, ray.direction.z/length };
+    Vector3 rayDirection = { direction[0], direction[1], direction[2] };
+
+    // New query stamp, bodies visited on previous cells are skipped
+    world->mark++;
+    if (world->mark == 0)
+    {
+        for (int i = 0; i < world->capacity; i++) world->bodies[i].mark = 0;
+        world->mark = 1;
+    }
+
+    for (int i = 0; (i < world->largeCount) && (count < maxIds); i++)
+    {
+        if (CheckCollisionBodyRay(&world->bodies[world->largeBodies[i]], ray.position, rayDirection, maxDistance)) ids[count++] = world->largeBodies[i];
+    }
+
+    // Grid cells traversal (3d DDA)
+    int cell[3] = { 0 };
+    int step[3] = { 0 };
+    float tMax[3] = { 0 };
+    float tDelta[3] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        cell[i] = (int)fmaxf(fminf(floorf(origin[i]*world->invCellSize), COLLISION_CELL_LIMIT), -COLLISION_CELL_LIMIT);
+
+        if (direction[i] > 0.0f)
+        {
+            step[i] = 1;
+            tMax[i] = ((cell[i] + 1)*world->cellSize - origin[i])/direction[i];
+            tDelta[i] = world->cellSize/direction[i];
+        }
+        else if (direction[i] < 0.0f)
+        {
+            step[i] = -1;
+            tMax[i] = (cell[i]*world->cellSize - origin[i])/direction[i];
+            tDelta[i] = -world->cellSize/direction[i];
+        }
+        else
+        {
+            tMax[i] = FLT_MAX;
+            tDelta[i] = FLT_MAX;
+        }
+    }
+
+    float distance = 0.0f;
+
+    while ((distance <= maxDistance) && (count < maxIds))
+    {
+        int index = FindCollisionCell(world, cell[0], cell[1], cell[2]);
+
+        if (index >= 0)
+        {
+            const CollisionCell *gridCell = &world->cells[index];
+
+            for (int k = 0; (k < gridCell->count) && (count < maxIds); k++)
+            {
+                CollisionBody *body = &world->bodies[gridCell->ids[k]];
+                if (body->mark == world->mark) continue;
+
+                body->mark = world->mark;
+                if (CheckCollisionBodyRay(body, ray.position, rayDirection, maxDistance)) ids[count++] = gridCell->ids[k];
+            }
+        }
+
+        // Step to next cell on nearest boundary axis
+        int axis = (tMax[0] < tMax[1])? ((tMax[0] < tMax[2])? 0 : 2) : ((tMax[1] < tMax[2])? 1 : 2);
+        if (tMax[axis] == FLT_MAX) break;
+
+        distance = tMax[axis];
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+
+        if ((cell[axis] < -COLLISION_CELL_LIMIT) || (cell[axis] > COLLISION_CELL_LIMIT)) break;
+    }
+
+    return count;
+}
+#endif
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+
+// Cubic easing in-out
+// NOTE: Used to fill DrawLineBezier() easing table only
+static float EaseCubicInOut(float t, float b, float c, float d)
+{
+    if ((t /= 0.5f*d) < 1) return 0.5f*c*t*t*t + b;
+
+    t -= 2;
+
+    return 0.5f*c*(t*t*t + 2.0f) + b;
+}
+
+// Init trig tables and tessellation thresholds
+// NOTE: Called once by InitWindow(), before any shape can be recorded from worker threads
+void InitShapesTables(void)
+{
+    for (int i = 0; i < SHAPES_TRIG_TABLE_SIZE + SHAPES_TRIG_TABLE_SIZE/4; i++) shapesSinTable[i] = sinf(2.0f*PI*(float)i/SHAPES_TRIG_TABLE_SIZE);
+
+    // Largest on-screen radius every level can draw keeping chord error under SMOOTH_CIRCLE_ERROR_RATE
+    // NOTE: Chord max distance to the arc is radius*(1 - cos(PI/segments))
+    shapesCircleLevels = 0;
+    for (int segments = SHAPES_CIRCLE_MIN_SEGMENTS; (segments <= SHAPES_TRIG_TABLE_SIZE) && (shapesCircleLevels < SHAPES_CIRCLE_LEVELS); segments *= 2)
+    {
+        shapesCircleMaxRadius[shapesCircleLevels] = SMOOTH_CIRCLE_ERROR_RATE/(1.0f - cosf(PI/segments));
+        shapesCircleLevels++;
+    }
+
+    for (int i = 0; i <= BEZIER_LINE_DIVISIONS; i++)
+    {
+        float t = (float)i/BEZIER_LINE_DIVISIONS;
+
+        bezierEaseTable[i] = EaseCubicInOut((float)i, 0.0f, 1.0f, (float)BEZIER_LINE_DIVISIONS);
+
+        bezierQuadBasis[i][0] = (1 - t)*(1 - t);
+        bezierQuadBasis[i][1] = 2*(1 - t)*t;
+        bezierQuadBasis[i][2] = t*t;
+
+        bezierCubicBasis[i][0] = (1 - t)*(1 - t)*(1 - t);
+        bezierCubicBasis[i][1] = 3*(1 - t)*(1 - t)*t;
+        bezierCubicBasis[i][2] = 3*(1 - t)*t*t;
+        bezierCubicBasis[i][3] = t*t*t;
+    }
+}
+
+// Get current transform scale, used to tessellate curves from their on-screen size
+// NOTE: Largest axis scale of modelview (camera) and pushed transform matrices
+static float GetShapesDrawScale(void)
+{
+    float scale = 1.0f;
+
+#if !defined(GRAPHICS_API_OPENGL_11)
+    // NOTE: On OpenGL 1.1 matrices would be read back from driver, world units are used instead
+    Matrix modelview = rlGetMatrixModelview();
+    Matrix transform = rlGetMatrixTransform();
+
+    float modelviewScale = fmaxf(modelview.m0*modelview.m0 + modelview.m1*modelview.m1, modelview.m4*modelview.m4 + modelview.m5*modelview.m5);
+    float transformScale = fmaxf(transform.m0*transform.m0 + transform.m1*transform.m1, transform.m4*transform.m4 + transform.m5*transform.m5);
+
+    scale = sqrtf(modelviewScale*transformScale);
+#endif
+
+    return scale;
+}
+
+// Get arc segments, adaptive from on-screen radius if less than minSegments provided
+// NOTE: Adaptive full circles use power-of-two segments so arc points fall on trig table entries
+static int GetCircleSegments(float radius, float arcAngle, int segments, int minSegments)
+{
+    if (segments < minSegments)
+    {
+        float screenRadius = radius*GetShapesDrawScale();
+
+        int level = 0;
+        while ((level < shapesCircleLevels - 1) && (screenRadius > shapesCircleMaxRadius[level])) level++;
+
+        segments = (int)ceilf(arcAngle*(float)(SHAPES_CIRCLE_MIN_SEGMENTS << level)/360.0f);
+        if (segments < minSegments) segments = minSegments;
+    }
+
+    // NOTE: Arc points storage is limited, larger segment counts are clamped
+    if (segments > SHAPES_TRIG_TABLE_SIZE) segments = SHAPES_TRIG_TABLE_SIZE;
+    if (segments < 1) segments = 1;
+
+    return segments;
+}
+
+// Get unit arc points from startAngle to endAngle (degrees), segments + 1 points
+// NOTE: Points are cached per thread, so fill and lines variants (or ring inner and outer radius)
+// reuse the same outline, returned pointer is valid until SHAPES_ARC_CACHE_SIZE other arcs are requested
+static const Vector2 *GetShapeArc(float startAngle, float endAngle, int segments)
+{
+    ShapeArc *arc = &shapesArcCache[0];
+    shapesArcCounter++;
+
+    for (int i = 0; i < SHAPES_ARC_CACHE_SIZE; i++)
+    {
+        ShapeArc *entry = &shapesArcCache[i];
+
+        if ((entry->segments == segments) && (entry->startAngle == startAngle) && (entry->endAngle == endAngle))
+        {
+            entry->lastUse = shapesArcCounter;
+            return entry->points;
+        }
+
+        if ((shapesArcCounter - entry->lastUse) > (shapesArcCounter - arc->lastUse)) arc = entry;
+    }
+
+    arc->startAngle = startAngle;
+    arc->endAngle = endAngle;
+    arc->segments = segments;
+    arc->lastUse = shapesArcCounter;
+
+    float stepLength = (endAngle - startAngle)/(float)segments;
+    float startIndex = startAngle*SHAPES_TRIG_TABLE_SIZE/360.0f;
+    float stepIndex = stepLength*SHAPES_TRIG_TABLE_SIZE/360.0f;
+
+    if ((startIndex == floorf(startIndex)) && (stepIndex == floorf(stepIndex)) && (fabsf(startIndex) < 0x1000000))
+    {
+        // Arc points fall on table angles, no trig required
+        int index = (int)startIndex & (SHAPES_TRIG_TABLE_SIZE - 1);
+        int stride = (int)stepIndex;
+
+        for (int i = 0; i <= segments; i++)
+        {
+            arc->points[i].x = shapesSinTable[index];
+            arc->points[i].y = shapesSinTable[index + SHAPES_TRIG_TABLE_SIZE/4];
+            index = (index + stride) & (SHAPES_TRIG_TABLE_SIZE - 1);
+        }
+    }
+    else
+    {
+        // Rotate start point by step angle, end point is set exactly to avoid accumulated drift
+        float stepSin = sinf(DEG2RAD*stepLength);
+        float stepCos = cosf(DEG2RAD*stepLength);
+        Vector2 point = { sinf(DEG2RAD*startAngle), cosf(DEG2RAD*startAngle) };
+
+        for (int i = 0; i < segments; i++)
+        {
+            arc->points[i] = point;
+            point = (Vector2){ point.x*stepCos + point.y*stepSin, point.y*stepCos - point.x*stepSin };
+        }
+
+        arc->points[segments] = (Vector2){ sinf(DEG2RAD*endAngle), cosf(DEG2RAD*endAngle) };
+    }
+
+    return arc->points;
+}
+
+#if defined(RLGL_ENABLE_BATCH_SDF_SHAPES)
+// Draw rounded box (rounded rectangles, circles, rings) as one quad, coverage evaluated by default shader
+// NOTE: Shape is sent in on-screen pixels so edges are anti-aliased over one pixel without derivatives (GLSL ES 100),
+// thickness > 0 draws a band inside the border, pixelLine draws a one pixel line centered on the border,
+// returns false if shape can not be drawn this way (custom shader active or shape too small) to fallback to tessellation
+static bool DrawShapeSdf(Vector2 center, float halfWidth, float halfHeight, float radius, float thickness, bool pixelLine, Color color)
+{
+    if (!rlIsShapeSdfEnabled()) return false;
+
+    float scale = GetShapesDrawScale();
+    if ((halfWidth*scale < 1.0f) || (halfHeight*scale < 1.0f)) return false;
+
+    if (pixelLine)
+    {
+        halfWidth += 0.5f/scale;
+        halfHeight += 0.5f/scale;
+        radius += 0.5f/scale;
+        thickness = 1.0f/scale;
+    }
+
+    // Quad is expanded one pixel for the anti-aliased edge
+    float width = halfWidth + 1.0f/scale;
+    float height = halfHeight + 1.0f/scale;
+
+    rlCheckRenderBatchLimit(4);
+
+    rlSetTexture(texShapes.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlShape4f(halfWidth*scale, halfHeight*scale, radius*scale, thickness*scale);
+
+        rlTexCoord2f(-width*scale, -height*scale);
+        rlVertex2f(center.x - width, center.y - height);
+
+        rlTexCoord2f(-width*scale, height*scale);
+        rlVertex2f(center.x - width, center.y + height);
+
+        rlTexCoord2f(width*scale, height*scale);
+        rlVertex2f(center.x + width, center.y + height);
+
+        rlTexCoord2f(width*scale, -height*scale);
+        rlVertex2f(center.x + width, center.y - height);
+
+        rlShape4f(0.0f, 0.0f, 0.0f, 0.0f);
+    rlEnd();
+
+    rlSetTexture(0);
+
+    return true;
+}
+#endif
+
+// Begin polyline strip drawing, pairs are added with AddShapeStripPair()
+static void BeginShapeStrip(ShapeStrip *strip, Color color)
+{
+    *strip = (ShapeStrip){ 0 };
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    rlSetTexture(texShapes.id);
+    rlBegin(RL_TRIANGLE_STRIP);
+        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+#elif defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(texShapes.id);
+    rlBegin(RL_QUADS);
+#else
+    rlBegin(RL_TRIANGLES);
+#endif
+        rlColor4ub(color.r, color.g, color.b, color.a);
+}
+
+// Add polyline strip vertex pair, joined with previous pair
+// NOTE: Pairs must keep the same side order (a, b) so all strip triangles keep the same winding
+static void AddShapeStripPair(ShapeStrip *strip, Vector2 a, Vector2 b)
+{
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST)
+    // Strip continues on next batch if current one is full, previous pair is added again
+    if (rlCheckRenderBatchLimit(2) && (strip->count > 0))
+    {
+        rlVertex2f(strip->a.x, strip->a.y);
+        rlVertex2f(strip->b.x, strip->b.y);
+    }
+
+    rlVertex2f(a.x, a.y);
+    rlVertex2f(b.x, b.y);
+#else
+    if (strip->count > 0)
+    {
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+        rlCheckRenderBatchLimit(4);
+
+        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+        rlVertex2f(strip->a.x, strip->a.y);
+
+        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        rlVertex2f(strip->b.x, strip->b.y);
+
+        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+        rlVertex2f(b.x, b.y);
+
+        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+        rlVertex2f(a.x, a.y);
+#else
+        rlCheckRenderBatchLimit(6);
+
+        rlVertex2f(strip->a.x, strip->a.y);
+        rlVertex2f(strip->b.x, strip->b.y);
+        rlVertex2f(b.x, b.y);
+
+        rlVertex2f(strip->a.x, strip->a.y);
+        rlVertex2f(b.x, b.y);
+        rlVertex2f(a.x, a.y);
+#endif
+    }
+#endif
+
+    strip->a = a;
+    strip->b = b;
+    strip->count++;
+}
+
+// End polyline strip drawing
+static void EndShapeStrip(void)
+{
+    rlEnd();
+
+#if defined(RLGL_ENABLE_BATCH_TRIANGLE_LIST) || defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(0);
+#endif
+}
+
+#if defined(SUPPORT_COLLISION_WORLD)
+// Add or update collision body, grid cells only updated if body covered cells changed
+static void SetCollisionBody(CollisionWorld *world, int id, int type, Vector3 min, Vector3 max, float radius)
+{
+    if ((world == NULL) || (id < 0) || (id >= world->capacity))
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: Collision body id not valid (%i)", id);
+        return;
+    }
+
+    CollisionBody *body = &world->bodies[id];
+
+    int cellMin[3] = { 0 };
+    int cellMax[3] = { 0 };
+    GetCollisionCellRange(world, min, max, cellMin, cellMax);
+
+    float cells = (float)(cellMax[0] - cellMin[0] + 1)*(float)(cellMax[1] - cellMin[1] + 1)*(float)(cellMax[2] - cellMin[2] + 1);
+    bool large = (cells > COLLISION_BODY_MAX_CELLS);
+    bool moved = (body->type == COLLISION_BODY_NONE) || (body->large != large) ||
+        (memcmp(body->cellMin, cellMin, sizeof(cellMin)) != 0) || (memcmp(body->cellMax, cellMax, sizeof(cellMax)) != 0);
+
+    if (moved && (body->type != COLLISION_BODY_NONE)) EraseCollisionBody(world, id);
+
+    body->type = type;
+    body->min = min;
+    body->max = max;
+    body->radius = radius;
+
+    if (moved)
+    {
+        memcpy(body->cellMin, cellMin, sizeof(cellMin));
+        memcpy(body->cellMax, cellMax, sizeof(cellMax));
+        body->large = large;
+
+        InsertCollisionBody(world, id);
+    }
+}
+
+// Insert collision body into its grid cells, large bodies are stored out of grid
+static void InsertCollisionBody(CollisionWorld *world, int id)
+{
+    CollisionBody *body = &world->bodies[id];
+
+    if (body->large)
+    {
+        body->listIndex = world->largeCount;
+        world->largeBodies[world->largeCount++] = id;
+        return;
+    }
+
+    body->listIndex = world->gridCount;
+    world->gridBodies[world->gridCount++] = id;
+
+    for (int z = body->cellMin[2]; z <= body->cellMax[2]; z++)
+    {
+        for (int y = body->cellMin[1]; y <= body->cellMax[1]; y++)
+        {
+            for (int x = body->cellMin[0]; x <= body->cellMax[0]; x++)
+            {
+                int index = FindCollisionCell(world, x, y, z);
+
+                if (index < 0)
+                {
+                    // New cell, free cells are reused (ids buffer kept)
+                    if (world->freeCell >= 0)
+                    {
+                        index = world->freeCell;
+                        world->freeCell = world->cells[index].next;
+                    }
+                    else
+                    {
+                        if (world->cellCount == world->cellCapacity)
+                        {
+                            world->cellCapacity = (world->cellCapacity > 0)? world->cellCapacity*2 : 256;
+                            world->cells = (CollisionCell *)RL_REALLOC(world->cells, world->cellCapacity*sizeof(CollisionCell));
+                        }
+
+                        index = world->cellCount++;
+                        world->cells[index].ids = NULL;
+                        world->cells[index].capacity = 0;
+                    }
+
+                    unsigned int bucket = (((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u) ^ ((unsigned int)z*83492791u)) & world->bucketMask;
+
+                    CollisionCell *cell = &world->cells[index];
+                    cell->x = x;
+                    cell->y = y;
+                    cell->z = z;
+                    cell->count = 0;
+                    cell->next = world->buckets[bucket];
+                    world->buckets[bucket] = index;
+                }
+
+                CollisionCell *cell = &world->cells[index];
+
+                if (cell->count == cell->capacity)
+                {
+                    cell->capacity = (cell->capacity > 0)? cell->capacity*2 : 8;
+                    cell->ids = (int *)RL_REALLOC(cell->ids, cell->capacity*sizeof(int));
+                }
+
+                cell->ids[cell->count++] = id;
+            }
+        }
+    }
+}
+
+// Erase collision body from its grid cells (or large bodies), empty cells are freed
+static void EraseCollisionBody(CollisionWorld *world, int id)
+{
+    CollisionBody *body = &world->bodies[id];
+
+    // Bodies list swap removal
+    int *list = body->large? world->largeBodies : world->gridBodies;
+    int *listCount = body->large? &world->largeCount : &world->gridCount;
+    int last = list[*listCount - 1];
+
+    list[body->listIndex] = last;
+    world->bodies[last].listIndex = body->listIndex;
+    (*listCount)--;
+
+    if (body->large) return;
+
+    for (int z = body->cellMin[2]; z <= body->cellMax[2]; z++)
+    {
+        for (int y = body->cellMin[1]; y <= body->cellMax[1]; y++)
+        {
+            for (int x = body->cellMin[0]; x <= body->cellMax[0]; x++)
+            {
+                unsigned int bucket = (((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u) ^ ((unsigned int)z*83492791u)) & world->bucketMask;
+                int previous = -1;
+                int index = world->buckets[bucket];
+
+                while ((index >= 0) && ((world->cells[index].x != x) || (world->cells[index].y != y) || (world->cells[index].z != z)))
+                {
+                    previous = index;
+                    index = world->cells[index].next;
+                }
+
+                if (index < 0) continue;
+
+                CollisionCell *cell = &world->cells[index];
+
+                for (int k = 0; k < cell->count; k++)
+                {
+                    if (cell->ids[k] == id)
+                    {
+                        cell->ids[k] = cell->ids[--cell->count];
+                        break;
+                    }
+                }
+
+                if (cell->count == 0)
+                {
+                    // Unlink empty cell from bucket, moved to free cells
+                    if (previous >= 0) world->cells[previous].next = cell->next;
+                    else world->buckets[bucket] = cell->next;
+
+                    cell->next = world->freeCell;
+                    world->freeCell = index;
+                }
+            }
+        }
+    }
+}
+
+// Find grid cell index, -1 if not stored (no bodies)
+static int FindCollisionCell(const CollisionWorld *world, int x, int y, int z)
+{
+    unsigned int bucket = (((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u) ^ ((unsigned int)z*83492791u)) & world->bucketMask;
+    int index = world->buckets[bucket];
+
+    while ((index >= 0) && ((world->cells[index].x != x) || (world->cells[index].y != y) || (world->cells[index].z != z))) index = world->cells[index].next;
+
+    return index;
+}
+
+// Get grid cells range covered by bounds, coordinates clamped to COLLISION_CELL_LIMIT
+static void GetCollisionCellRange(const CollisionWorld *world, Vector3 min, Vector3 max, int *cellMin, int *cellMax)
+{
+    float boundsMin[3] = { min.x, min.y, min.z };
+    float boundsMax[3] = { max.x, max.y, max.z };
+
+    for (int i = 0; i < 3; i++)
+    {
+        cellMin[i] = (int)fmaxf(fminf(floorf(boundsMin[i]*world->invCellSize), COLLISION_CELL_LIMIT), -COLLISION_CELL_LIMIT);
+        cellMax[i] = (int)fmaxf(fminf(floorf(boundsMax[i]*world->invCellSize), COLLISION_CELL_LIMIT), -COLLISION_CELL_LIMIT);
+        if (cellMax[i] < cellMin[i]) cellMax[i] = cellMin[i];
+    }
+}
+
+// Check collision between two collision bodies shapes (boxes and spheres)
+static bool CheckCollisionBodies(const CollisionBody *body1, const CollisionBody *body2)
+{
+    // Bounds overlap, exact for boxes
+    if ((body1->max.x < body2->min.x) || (body1->min.x > body2->max.x) ||
+        (body1->max.y < body2->min.y) || (body1->min.y > body2->max.y) ||
+        (body1->max.z < body2->min.z) || (body1->min.z > body2->max.z)) return false;
+
+    if ((body1->type == COLLISION_BODY_BOX) && (body2->type == COLLISION_BODY_BOX)) return true;
+
+    if ((body1->type == COLLISION_BODY_SPHERE) && (body2->type == COLLISION_BODY_SPHERE))
+    {
+        float dx = 0.5f*(body1->min.x + body1->max.x - body2->min.x - body2->max.x);
+        float dy = 0.5f*(body1->min.y + body1->max.y - body2->min.y - body2->max.y);
+        float dz = 0.5f*(body1->min.z + body1->max.z - body2->min.z - body2->max.z);
+        float radius = body1->radius + body2->radius;
+
+        return ((dx*dx + dy*dy + dz*dz) <= radius*radius);
+    }
+
+    // Box and sphere: sphere center distance to closest box point
+    const CollisionBody *box = (body1->type == COLLISION_BODY_BOX)? body1 : body2;
+    const CollisionBody *sphere = (body1->type == COLLISION_BODY_BOX)? body2 : body1;
+
+    float center[3] = { 0.5f*(sphere->min.x + sphere->max.x), 0.5f*(sphere->min.y + sphere->max.y), 0.5f*(sphere->min.z + sphere->max.z) };
+    float boxMin[3] = { box->min.x, box->min.y, box->min.z };
+    float boxMax[3] = { box->max.x, box->max.y, box->max.z };
+    float distanceSqr = 0.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (center[i] < boxMin[i]) distanceSqr += (boxMin[i] - center[i])*(boxMin[i] - center[i]);
+        else if (center[i] > boxMax[i]) distanceSqr += (center[i] - boxMax[i])*(center[i] - boxMax[i]);
+    }
+
+    return (distanceSqr <= sphere->radius*sphere->radius);
+}
+
+// Check collision between collision body and ray up to max distance, ray direction must be normalized
+static bool CheckCollisionBodyRay(const CollisionBody *body, Vector3 origin, Vector3 direction, float maxDistance)
+{
+    if (body->type == COLLISION_BODY_SPHERE)
+    {
+        float mx = origin.x - 0.5f*(body->min.x + body->max.x);
+        float my = origin.y - 0.5f*(body->min.y + body->max.y);
+        float mz = origin.z - 0.5f*(body->min.z + body->max.z);
+        float b = mx*direction.x + my*direction.y + mz*direction.z;
+        float c = mx*mx + my*my + mz*mz - body->radius*body->radius;
+
+        if ((c > 0.0f) && (b > 0.0f)) return false;     // Ray origin outside sphere, pointing away
+
+        float discriminant = b*b - c;
+        if (discriminant < 0.0f) return false;
+
+        return ((-b - sqrtf(discriminant)) <= maxDistance);
+    }
+
+    // Box slabs test
+    float rayOrigin[3] = { origin.x, origin.y, origin.z };
+    float rayDirection[3] = { direction.x, direction.y, direction.z };
+    float boxMin[3] = { body->min.x, body->min.y, body->min.z };
+    float boxMax[3] = { body->max.x, body->max.y, body->max.z };
+    float tNear = 0.0f;
+    float tFar = maxDistance;
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (rayDirection[i] == 0.0f)
+        {
+            if ((rayOrigin[i] < boxMin[i]) || (rayOrigin[i] > boxMax[i])) return false;
+        }
+        else
+        {
+            float t1 = (boxMin[i] - rayOrigin[i])/rayDirection[i];
+            float t2 = (boxMax[i] - rayOrigin[i])/rayDirection[i];
+
+            tNear = fmaxf(tNear, fminf(t1, t2));
+            tFar = fminf(tFar, fmaxf(t1, t2));
+            if (tNear > tFar) return false;
+        }
+    }
+
+    return true;
+}
+
+// Get bodies ids colliding with query body, returns ids count (up to maxIds)
+// NOTE: Bodies are reported on first grid cell shared with query, no visited marks required
+static int QueryCollisionBody(CollisionWorld *world, const CollisionBody *query, int *ids, int maxIds)
+{
+    int count = 0;
+
+    if ((world == NULL) || (ids == NULL)) return 0;
+
+    for (int i = 0; (i < world->largeCount) && (count < maxIds); i++)
+    {
+        if (CheckCollisionBodies(query, &world->bodies[world->largeBodies[i]])) ids[count++] = world->largeBodies[i];
+    }
+
+    int cellMin[3] = { 0 };
+    int cellMax[3] = { 0 };
+    GetCollisionCellRange(world, query->min, query->max, cellMin, cellMax);
+
+    // Query covering more cells than grid bodies: grid bodies checked directly
+    float cells = (float)(cellMax[0] - cellMin[0] + 1)*(float)(cellMax[1] - cellMin[1] + 1)*(float)(cellMax[2] - cellMin[2] + 1);
+
+    if (cells > (float)world->gridCount)
+    {
+        for (int i = 0; (i < world->gridCount) && (count < maxIds); i++)
+        {
+            if (CheckCollisionBodies(query, &world->bodies[world->gridBodies[i]])) ids[count++] = world->gridBodies[i];
+        }
+
+        return count;
+    }
+
+    for (int z = cellMin[2]; z <= cellMax[2]; z++)
+    {
+        for (int y = cellMin[1]; y <= cellMax[1]; y++)
+        {
+            for (int x = cellMin[0]; (x <= cellMax[0]) && (count < maxIds); x++)
+            {
+                int index = FindCollisionCell(world, x, y, z);
+                if (index < 0) continue;
+
+                const CollisionCell *cell = &world->cells[index];
+
+                for (int k = 0; (k < cell->count) && (count < maxIds); k++)
+                {
+                    const CollisionBody *body = &world->bodies[cell->ids[k]];
+
+                    if ((x != MAX(cellMin[0], body->cellMin[0])) || (y != MAX(cellMin[1], body->cellMin[1])) ||
+                        (z != MAX(cellMin[2], body->cellMin[2]))) continue;
+
+                    if (CheckCollisionBodies(query, body)) ids[count++] = cell->ids[k];
+                }
+            }
+        }
+    }
+
+    return count;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RSHAPES
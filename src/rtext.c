@@ -9,13 +9,19 @@
 *
 *   #define SUPPORT_FILEFORMAT_FNT
 *   #define SUPPORT_FILEFORMAT_TTF
+*   #define SUPPORT_FILEFORMAT_RFNT
 *       Selected desired fileformats to be supported for loading. Some of those formats are
 *       supported by default, to remove support, just comment unrequired #define in this module
+*       NOTE: RFNT (raylib font) is a cooked binary format storing atlas image (optionally compressed),
+*       glyphs metrics and codepoints lookup table, use ExportFont() to cook fonts
 *
 *   #define SUPPORT_DEFAULT_FONT
 *       Load default raylib font on initialization to be used by DrawText() and MeasureText().
 *       If no default font loaded, DrawTextEx() and MeasureTextEx() are required.
 *
+*   #define SUPPORT_LAZY_DEFAULT_FONT
+*       Default font is loaded on first GetFontDefault() call (window required) instead of initialization.
+*
 *   #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *       TextSplit() function static buffer max size
 *
@@ -58,6 +64,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
+#define RL_MEMORY_TAG   MEMORY_TAG_TEXT     // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"          // Required for: LoadFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only DrawTextPro()
 
@@ -67,6 +74,14 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Requried for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TEXT_SIMD_SSE2
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in DecodeCodepoints()]
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define TEXT_SIMD_NEON
+    #include <arm_neon.h>       // Required for: NEON intrinsics [Used in DecodeCodepoints()]
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
     #include "external/stb_rect_pack.h"     // Required for: ttf font rectangles packaging
@@ -90,17 +105,115 @@
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
 
+#ifndef FONT_DYNAMIC_DEFAULT_ATLAS_SIZE
+    #define FONT_DYNAMIC_DEFAULT_ATLAS_SIZE     1024        // Dynamic font default atlas size (square)
+#endif
+#ifndef FONT_DYNAMIC_CHARS_PADDING
+    #define FONT_DYNAMIC_CHARS_PADDING             2        // Dynamic font glyph padding inside atlas cells
+#endif
+
+#ifndef FONT_GLYPHS_JOB_GRAIN_SIZE
+    #define FONT_GLYPHS_JOB_GRAIN_SIZE            32        // Glyphs rasterized per job: LoadFontData()
+#endif
+
+#define TEXT_LAYOUT_QUAD_FLOATS    10       // Floats per text layout glyph quad
+#define TEXT_DECODE_CHUNK         256       // Codepoints decoded at once by text functions (stack buffer)
+
+// Codepoint hash for font glyph map (multiplicative hashing)
+#define GLYPH_MAP_HASH(codepoint)   ((unsigned int)(codepoint)*2654435761u)
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Dynamic font glyphs cache
+// NOTE: Atlas is divided in fixed size cells (one glyph per cell), font glyphs and recs
+// arrays are indexed by cell, least recently used cell is reused when atlas is full
+struct rGlyphCache {
+    unsigned char *fileData;    // TTF font file data (kept resident)
+    stbtt_fontinfo fontInfo;    // TTF font info
+    float scaleFactor;          // Font scale factor for required size
+    int ascent;                 // Font ascent (scaled)
+
+    int cellSize;               // Atlas cell size (square, including padding)
+    int cellsPerRow;            // Atlas cells per row
+    int cellCount;              // Atlas cells count
+    int cellsUsed;              // Atlas cells used, unused cells are taken first
+
+    unsigned int *lastUse;      // Cell last use stamp (LRU)
+    unsigned int useCounter;    // Use stamp counter
+
+    int *map;                   // Codepoint to cell hash table: [0] capacity, then (codepoint, cell) pairs
+    int mapRemoved;             // Hash table removed entries (tombstones)
+
+    unsigned char *cellData;    // Cell pixel data scratch buffer (atlas texture format)
+    unsigned char *bitmap;      // Glyph bitmap scratch buffer (GRAYSCALE)
+};
+
+// Font glyphs rasterization job data, shared by all glyph ranges (LoadFontData())
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // TTF font info (read-only)
+    float scaleFactor;          // Font scale factor for required size
+    int ascent;                 // Font ascent (unscaled)
+    int fontSize;               // Font size
+    int type;                   // Font type (FontType)
+    const int *codepoints;      // Glyphs codepoints
+    GlyphInfo *glyphs;          // Glyphs output, one slot per codepoint
+} FontGlyphsJob;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// RFNT file header (48 bytes), followed by glyphs, codepoints lookup table and atlas image data
+typedef struct {
+    char id[4];                 // Signature: "RFNT"
+    unsigned short version;     // File version: 100
+    unsigned short compression; // Atlas image data compression: 0 - uncompressed, CompressionCodec + 1 otherwise
+    int baseSize;               // Base size (default chars height)
+    int glyphCount;             // Number of glyph characters
+    int glyphPadding;           // Padding around the glyph characters
+    int type;                   // Font glyphs type (FontType)
+    int mapCapacity;            // Codepoints lookup table capacity (LoadGlyphMap() layout), 0 if not stored
+    int width;                  // Atlas image width
+    int height;                 // Atlas image height
+    int format;                 // Atlas image format (PixelFormat)
+    unsigned int dataSize;      // Atlas image data size (uncompressed)
+    unsigned int storedSize;    // Atlas image data size stored in file
+} RFNTHeader;
+
+// RFNT glyph metrics
+typedef struct {
+    int value;                  // Character value (Unicode)
+    int offsetX;                // Character offset X when drawing
+    int offsetY;                // Character offset Y when drawing
+    int advanceX;               // Character advance position X
+    Rectangle rec;              // Character rectangle in atlas
+} RFNTGlyph;
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Font async load file formats, resolved on submission (main thread)
+typedef enum {
+    FONT_ASYNC_IMAGE = 0,       // Image font (XNA style): image decoded on worker thread
+    FONT_ASYNC_TTF,             // TTF/OTF font: glyphs and atlas image generated on worker thread
+    FONT_ASYNC_FNT,             // BMFont: loaded on main thread (uses path static buffers)
+    FONT_ASYNC_RFNT             // RFNT cooked font: glyphs and atlas image read on worker thread
+} FontAsyncFormat;
+
+// Font async load job data
+typedef struct FontLoadJob {
+    char fileName[512];         // Font file name
+    int format;                 // Font file format: FontAsyncFormat
+    Image image;                // Decoded font image or generated atlas (worker thread)
+    Font font;                  // Loaded font, texture uploaded on main thread
+} FontLoadJob;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_DEFAULT_FONT)
 // Default font provided by raylib
-// NOTE: Default font is loaded on InitWindow() and disposed on CloseWindow() [module: core]
+// NOTE: Default font is loaded on InitWindow() or first use (SUPPORT_LAZY_DEFAULT_FONT) and disposed on CloseWindow() [module: core]
 static Font defaultFont = { 0 };
 #endif
 
@@ -115,6 +228,32 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+static Font LoadRFNT(const char *fileName);       // Load a RFNT cooked font file
+static bool LoadRFNTData(const char *fileName, Font *font, Image *atlas);  // Load RFNT font glyphs and atlas image (no GPU upload)
+static bool SaveRFNT(Font font, const char *fileName);  // Save font as RFNT file
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeFontJob(void *data);           // Font async load decode stage: glyphs and atlas image (worker thread)
+static bool UploadFontJob(void *data);           // Font async load upload stage: atlas texture (main thread)
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD) && defined(SUPPORT_FILEFORMAT_TTF)
+static bool DecodeFontReloadJob(void *data);     // Font reload decode stage: glyphs and atlas image (worker thread)
+static bool UploadFontReloadJob(void *data);     // Font reload upload stage: replace atlas and glyphs in place (main thread)
+#endif
+static int DecodeCodepoints(const char *text, int size, int *codepoints, int maxCount, bool byteErrors, int *bytesProcessed);  // Decode UTF-8 text into codepoints (ASCII fast path)
+static int *LoadGlyphMap(const GlyphInfo *glyphs, int glyphCount);   // Load codepoint to glyph index hash table
+static float GetFontSdfSmoothing(float scaleFactor);    // Get SDF edge smoothing for a drawing scale
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphsRange(void *data, int start, int end);   // Rasterize font glyphs range, job system range callback (LoadFontData())
+static void TrimGlyphImage(GlyphInfo *glyph);     // Trim glyph image transparent borders (in place), glyph offsets adjusted
+static void FontImageToGrayAlpha(Image *image);   // Convert GRAYSCALE coverage image to GRAY_ALPHA (white color, coverage alpha)
+static Image GenFontAtlasImage(const GlyphInfo *chars, Rectangle **charRecs, int glyphCount, int fontSize, int padding, int packMethod);   // Generate GRAYSCALE coverage font atlas (font loaders)
+static Texture2D LoadFontAtlasTexture(Image atlas);   // Load font atlas texture, GRAYSCALE atlas sampled as alpha if supported
+static Font LoadFontDynamicData(unsigned char *fileData, int fontSize, int atlasSize);  // Load dynamic font, takes ownership of file data
+static int GetGlyphCacheIndex(Font font, int codepoint);   // Get dynamic font glyph index, rasterizing glyph if required
+static void UnloadGlyphCache(rGlyphCache *cache);          // Unload dynamic font glyphs cache
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -271,6 +410,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphMap = LoadGlyphMap(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -278,10 +418,15 @@ extern void LoadFontDefault(void)
 // Unload raylib default font
 extern void UnloadFontDefault(void)
 {
+    if (defaultFont.glyphs == NULL) return;     // Not loaded (SUPPORT_LAZY_DEFAULT_FONT)
+
     for (int i = 0; i < defaultFont.glyphCount; i++) UnloadImage(defaultFont.glyphs[i].image);
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphMap);
+
+    defaultFont = (Font){ 0 };
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -289,6 +434,27 @@ extern void UnloadFontDefault(void)
 Font GetFontDefault()
 {
 #if defined(SUPPORT_DEFAULT_FONT)
+#if defined(SUPPORT_LAZY_DEFAULT_FONT)
+    // Load default font on first use, graphics device is required for atlas upload
+    if ((defaultFont.glyphs == NULL) && IsWindowReady())
+    {
+        LoadFontDefault();
+
+        // Same default font setup done by InitWindow() when loaded on initialization
+        if (IsWindowState(FLAG_WINDOW_HIGHDPI)) SetTextureFilter(defaultFont.texture, TEXTURE_FILTER_BILINEAR);
+
+    #if defined(SUPPORT_MODULE_RSHAPES)
+        // Shapes switch to default font white char (text and shapes drawn with the same texture),
+        // unless a custom shapes texture has been set
+        if (GetShapesTexture().id == rlGetTextureIdDefault())
+        {
+            Rectangle rec = defaultFont.recs[95];
+            // NOTE: We setup a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
+            SetShapesTexture(defaultFont.texture, (Rectangle){ rec.x + 1, rec.y + 1, rec.width - 2, rec.height - 2 });
+        }
+    #endif
+    }
+#endif
     return defaultFont;
 #else
     Font font = { 0 };
@@ -315,6 +481,14 @@ Font LoadFont(const char *fileName)
 
     Font font = { 0 };
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Same key than LoadFontEx() with default parameters, TTF/OTF font is cached once
+    char key[560] = { 0 };
+    snprintf(key, sizeof(key), "%s|%i|%i", fileName, FONT_TTF_DEFAULT_SIZE, FONT_TTF_DEFAULT_NUMCHARS);
+
+    if (LoadCachedResource(RESOURCE_FONT, key, &font, sizeof(Font))) return font;
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     if (IsFileExtension(fileName, ".ttf") || IsFileExtension(fileName, ".otf")) font = LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
@@ -322,6 +496,10 @@ Font LoadFont(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_FNT)
     if (IsFileExtension(fileName, ".fnt")) font = LoadBMFont(fileName);
     else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt")) font = LoadRFNT(fileName);
+    else
 #endif
     {
         Image image = LoadImage(fileName);
@@ -336,8 +514,69 @@ Font LoadFont(const char *fileName)
     }
     else SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default we set point filter (best performance)
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if (font.glyphs != GetFontDefault().glyphs) CacheResource(RESOURCE_FONT, key, &font, sizeof(Font), (unsigned long long)(size_t)font.glyphs);
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD) && defined(SUPPORT_FILEFORMAT_TTF)
+    // NOTE: Only TTF/OTF fonts are reloaded, glyphs and atlas are generated again with same parameters
+    if ((font.glyphs != GetFontDefault().glyphs) && (IsFileExtension(fileName, ".ttf") || IsFileExtension(fileName, ".otf")))
+    {
+        AssetReloadJob asset = { 0 };
+        strncpy(asset.fileName[0], fileName, sizeof(asset.fileName[0]) - 1);
+        asset.id = font.texture.id;
+        asset.ptr[0] = font.glyphs;
+        asset.ptr[1] = font.recs;
+        asset.params[0] = font.glyphCount;
+        asset.params[1] = font.texture.width;
+        asset.params[2] = font.texture.height;
+        asset.params[3] = font.texture.format;
+
+        WatchAsset(ASSET_WATCH_FONT, &asset, DecodeFontReloadJob, UploadFontReloadJob);
+    }
+#endif
+
+    return font;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load font from file asynchronously, font data is generated on a worker thread and atlas uploaded on EndDrawing()
+// NOTE: Same default parameters than LoadFont(), font is retrieved with GetAsyncFont()
+unsigned int LoadFontAsync(const char *fileName)
+{
+    FontLoadJob *job = (FontLoadJob *)RL_CALLOC(1, sizeof(FontLoadJob));
+    strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+    // NOTE: File format is checked here, IsFileExtension() uses rtext static buffers, not safe on worker threads
+    job->format = FONT_ASYNC_IMAGE;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (IsFileExtension(fileName, ".ttf") || IsFileExtension(fileName, ".otf")) job->format = FONT_ASYNC_TTF;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FNT)
+    if (IsFileExtension(fileName, ".fnt")) job->format = FONT_ASYNC_FNT;
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt")) job->format = FONT_ASYNC_RFNT;
+#endif
+
+    return SubmitAsyncJob(ASYNC_JOB_FONT, job, DecodeFontJob, UploadFontJob);
+}
+
+// Get font loaded asynchronously, waits for the load to finish and releases the load handle
+// NOTE: Default font is returned if font could not be loaded
+Font GetAsyncFont(unsigned int handle)
+{
+    Font font = GetFontDefault();
+
+    FontLoadJob *job = (FontLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_FONT);
+    if (job != NULL) font = job->font;
+    else TRACELOG(LOG_WARNING, "FONT: Failed to load font asynchronously -> Using default font");
+
+    ReleaseAsyncJob(handle);
+
     return font;
 }
+#endif
 
 // Load Font from TTF font file with generation parameters
 // NOTE: You can pass an array with desired characters, those characters should be available in the font
@@ -346,19 +585,34 @@ Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int glyphCou
 {
     Font font = { 0 };
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    // NOTE: Fonts with custom codepoints are not cached
+    char key[560] = { 0 };
+    if (fontChars == NULL) snprintf(key, sizeof(key), "%s|%i|%i", fileName, fontSize, glyphCount);
+
+    if ((fontChars == NULL) && LoadCachedResource(RESOURCE_FONT, key, &font, sizeof(Font))) return font;
+#endif
+
     // Loading file to memory
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
 
     if (fileData != NULL)
     {
         // Loading font from memory data
         font = LoadFontFromMemory(GetFileExtension(fileName), fileData, fileSize, fontSize, fontChars, glyphCount);
 
-        RL_FREE(fileData);
+        UnloadFileDataView(fileData);
     }
     else font = GetFontDefault();
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if ((fontChars == NULL) && (font.glyphs != NULL) && (font.glyphs != GetFontDefault().glyphs))
+    {
+        CacheResource(RESOURCE_FONT, key, &font, sizeof(Font), (unsigned long long)(size_t)font.glyphs);
+    }
+#endif
+
     return font;
 }
 
@@ -483,6 +737,7 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
     UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphMap = LoadGlyphMap(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -508,17 +763,14 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
         {
             font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
-            Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
-            font.texture = LoadTextureFromImage(atlas);
+            Image atlas = GenFontAtlasImage(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+            font.texture = LoadFontAtlasTexture(atlas);
+            UnloadImage(atlas);
 
             // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
-            for (int i = 0; i < font.glyphCount; i++)
-            {
-                UnloadImage(font.glyphs[i].image);
-                font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
-            }
+            for (int i = 0; i < font.glyphCount; i++) FontImageToGrayAlpha(&font.glyphs[i].image);
 
-            UnloadImage(atlas);
+            font.glyphMap = LoadGlyphMap(font.glyphs, font.glyphCount);
 
             // TRACELOG(LOG_INFO, "FONT: Font loaded successfully (%i glyphs)", font.glyphCount);
         }
@@ -531,6 +783,109 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load SDF font from TTF file, glyphs atlas stores distance fields
+// NOTE: SDF fonts are drawn by DrawTextEx() with built-in SDF shader, same atlas is valid for any drawing size
+Font LoadFontSDF(const char *fileName, int fontSize, int *fontChars, int glyphCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+
+    if (fileData != NULL)
+    {
+        font.baseSize = fontSize;
+        font.glyphCount = (glyphCount > 0)? glyphCount : 95;
+        font.glyphPadding = 0;
+        font.glyphs = LoadFontData(fileData, fileSize, font.baseSize, fontChars, font.glyphCount, FONT_SDF);
+
+        if (font.glyphs != NULL)
+        {
+            // NOTE: Glyphs SDF images already include distance field padding
+            Image atlas = GenFontAtlasImage(font.glyphs, &font.recs, font.glyphCount, font.baseSize, 0, 1);
+            font.texture = LoadFontAtlasTexture(atlas);
+            UnloadImage(atlas);
+
+            // Distance field requires bilinear sampling
+            SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
+            font.glyphMap = LoadGlyphMap(font.glyphs, font.glyphCount);
+            font.type = FONT_SDF;
+
+            TRACELOG(LOG_INFO, "FONT: [%s] SDF font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+        }
+
+        UnloadFileDataView(fileData);
+    }
+
+    if (font.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load SDF font -> Using default font", fileName);
+        font = GetFontDefault();
+    }
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load dynamic font from TTF file, glyphs are rasterized on demand
+// NOTE: Only atlas texture is allocated on loading, glyphs are added on first use by DrawTextEx()/MeasureTextEx()
+// and least recently used ones are evicted when atlas is full, use 0 for atlasSize to use default size
+Font LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (IsFileExtension(fileName, ".ttf") || IsFileExtension(fileName, ".otf"))
+    {
+        unsigned int fileSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+        // NOTE: File data is kept resident by font, freed on UnloadFont()
+        if (fileData != NULL) font = LoadFontDynamicData(fileData, fontSize, atlasSize);
+    }
+
+    if (font.cache == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load dynamic font -> Using default font", fileName);
+        font = GetFontDefault();
+    }
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
+// Load dynamic font from memory buffer, fileType refers to extension: i.e. ".ttf"
+// NOTE: Font data is copied, it's kept resident until UnloadFont()
+Font LoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strcpy(fileExtLower, TextToLower(fileType));
+
+    if ((fileData != NULL) && (dataSize > 0) && (TextIsEqual(fileExtLower, ".ttf") || TextIsEqual(fileExtLower, ".otf")))
+    {
+        unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(data, fileData, dataSize);
+
+        font = LoadFontDynamicData(data, fontSize, atlasSize);
+    }
+
+    if (font.cache == NULL) font = GetFontDefault();
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
 // Load font data for further use
 // NOTE: Requires TTF font memory data and can generate SDF data
 GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int glyphCount, int type)
@@ -585,67 +940,10 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
             chars = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < glyphCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = calloc(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
-                        .mipmaps = 1
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            // Glyphs are rasterized in parallel (job system), font info is only read
+            // NOTE: Every glyph gets its own bitmap, atlas packing (GenFontAtlasImage()) is a later serial step
+            FontGlyphsJob job = { &fontInfo, scaleFactor, ascent, fontSize, type, fontChars, chars };
+            ParallelFor(LoadFontGlyphsRange, &job, glyphCount, FONT_GLYPHS_JOB_GRAIN_SIZE);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -660,6 +958,18 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 // NOTE: Packing method: 0-Default, 1-Skyline
 #if defined(SUPPORT_FILEFORMAT_TTF)
 Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphCount, int fontSize, int padding, int packMethod)
+{
+    Image atlas = GenFontAtlasImage(chars, charRecs, glyphCount, fontSize, padding, packMethod);
+
+    // Convert image data from GRAYSCALE to GRAY_ALPHA
+    FontImageToGrayAlpha(&atlas);
+
+    return atlas;
+}
+
+// Generate font atlas image using chars info
+// NOTE: Atlas is a GRAYSCALE coverage image (one byte per pixel), font loaders sample it as alpha (LoadFontAtlasTexture())
+static Image GenFontAtlasImage(const GlyphInfo *chars, Rectangle **charRecs, int glyphCount, int fontSize, int padding, int packMethod)
 {
     Image atlas = { 0 };
 
@@ -792,19 +1102,6 @@ Image GenImageFontAtlas(const GlyphInfo *chars, Rectangle **charRecs, int glyphC
         RL_FREE(context);
     }
 
-    // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
-    {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
-
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
-
     *charRecs = recs;
 
     return atlas;
@@ -822,17 +1119,55 @@ void UnloadFontData(GlyphInfo *glyphs, int glyphCount)
 // Unload Font from GPU memory (VRAM)
 void UnloadFont(Font font)
 {
-    // NOTE: Make sure font is not default font (fallback)
-    if (font.texture.id != GetFontDefault().texture.id)
+    // NOTE: Make sure font is not default font (fallback), checked by glyphs (texture id is 0 for fonts loaded without window)
+#if defined(SUPPORT_DEFAULT_FONT)
+    if (font.glyphs != defaultFont.glyphs)
+#else
+    if (font.glyphs != NULL)
+#endif
     {
+#if defined(SUPPORT_RESOURCE_CACHE)
+        // NOTE: Cached font is unloaded with its last reference
+        if (ReleaseCachedResource(RESOURCE_FONT, (unsigned long long)(size_t)font.glyphs) > 0) return;
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD) && defined(SUPPORT_FILEFORMAT_TTF)
+        UnwatchAsset(ASSET_WATCH_FONT, font.texture.id, font.glyphs);
+#endif
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphMap);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        UnloadGlyphCache(font.cache);
+#endif
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
+// Export font as cooked binary file, returns true on success
+// NOTE: Atlas image is read back from GPU, dynamic fonts (glyphs rasterized on demand) can not be exported
+bool ExportFont(Font font, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (IsFileExtension(fileName, ".rfnt"))
+    {
+        if ((font.glyphs == NULL) || (font.recs == NULL) || (font.texture.id == 0)) TRACELOG(LOG_WARNING, "FONT: Font data not valid, font could not be exported");
+        else if (font.cache != NULL) TRACELOG(LOG_WARNING, "FONT: Dynamic fonts can not be exported");
+        else success = SaveRFNT(font, fileName);
+    }
+    else
+#endif
+    TRACELOG(LOG_WARNING, "FONT: [%s] Font file format not supported for export", fileName);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export font", fileName);
+
+    return success;
+}
+
 // Export font as code file, returns true on success
 bool ExportFontAsCode(Font font, const char *fileName)
 {
@@ -875,6 +1210,7 @@ bool ExportFontAsCode(Font font, const char *fileName)
     // Support font export and initialization
     // NOTE: This mechanism is highly coupled to raylib
     Image image = LoadImageFromTexture(font.texture);
+    FontImageToGrayAlpha(&image);       // Single channel atlas exported as GRAY_ALPHA, loaded by exported code as is
     if (image.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) TRACELOG(LOG_WARNING, "Font export as code: Font image format is not GRAY+ALPHA!");
     int imageDataSize = GetPixelDataSize(image.width, image.height, image.format);
 
@@ -1001,6 +1337,53 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", GetFPS()), posX, posY, 20, color);
 }
 
+// Draw last frame render stats
+// NOTE: Stats are from the previous frame, this overlay drawing is counted on the current one
+void DrawFrameStats(int posX, int posY)
+{
+    rlFrameStats stats = rlGetFrameStats();
+    double frameTime = stats.cpuEndTime - stats.cpuBeginTime;
+
+    DrawText(TextFormat("CPU: %.2f ms (swap: %.2f ms)", frameTime*1000.0, stats.cpuSwapTime*1000.0), posX, posY, 10, LIME);
+    if (stats.gpuTime >= 0.0) DrawText(TextFormat("GPU: %.2f ms", stats.gpuTime*1000.0), posX, posY + 12, 10, LIME);
+    else DrawText("GPU: not available", posX, posY + 12, 10, GRAY);
+    DrawText(TextFormat("DRAW CALLS: %i", stats.drawCalls), posX, posY + 24, 10, LIME);
+    DrawText(TextFormat("BATCH FLUSHES: %i (overflows: %i)", stats.batchFlushes, stats.batchOverflows), posX, posY + 36, 10, (stats.batchOverflows > 0)? ORANGE : LIME);
+    DrawText(TextFormat("VERTEX: %i (batch peak: %i vertex, %i draws, growths: %i)", stats.vertexCount, stats.batchVertexPeak,
+        stats.batchDrawsPeak, stats.batchGrowths), posX, posY + 48, 10, LIME);
+    DrawText(TextFormat("TEXTURE BINDS: %i (changes: %i)", stats.textureBinds, stats.textureChanges), posX, posY + 60, 10, LIME);
+    DrawText(TextFormat("STATE CHANGES SKIPPED: %i", stats.stateChangesSkipped), posX, posY + 72, 10, LIME);
+
+    MemoryStats textures = GetMemoryStats(MEMORY_TAG_VIDEO_TEXTURES);
+    MemoryStats buffers = GetMemoryStats(MEMORY_TAG_VIDEO_BUFFERS);
+    DrawText(TextFormat("VRAM: %.2f MB (textures: %.2f MB, buffers: %.2f MB)", (textures.usedBytes + buffers.usedBytes)/1048576.0,
+        textures.usedBytes/1048576.0, buffers.usedBytes/1048576.0), posX, posY + 84, 10, LIME);
+
+    int statsPosY = posY + 96;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (IsAudioDeviceReady())
+    {
+        AudioMixerStats audio = GetAudioMixerStats();
+        DrawText(TextFormat("AUDIO DSP: %.1f%% (avg: %.1f%%, peak: %.1f%%) VOICES: %u (virtual: %u, culled: %u)", audio.load*100.0f,
+            audio.loadAverage*100.0f, audio.loadPeak*100.0f, audio.activeVoices, audio.virtualVoices, audio.culledVoices),
+            posX, statsPosY, 10, (audio.loadPeak > 0.75f)? ORANGE : LIME);
+        statsPosY += 12;
+    }
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    MemoryStats memory = GetMemoryStats(MEMORY_TAG_ALL);
+    DrawText(TextFormat("MEMORY: %.2f MB (peak: %.2f MB, allocs: %i, frees: %i)", memory.usedBytes/1048576.0, memory.peakBytes/1048576.0,
+        memory.frameAllocations, memory.frameFrees), posX, statsPosY, 10, LIME);
+    DrawText(TextFormat("CORE %.1f | TEX %.1f | TEXT %.1f | MODELS %.1f | AUDIO %.1f | FILES %.1f | USER %.1f",
+        GetMemoryStats(MEMORY_TAG_CORE).usedBytes/1048576.0, GetMemoryStats(MEMORY_TAG_TEXTURES).usedBytes/1048576.0,
+        GetMemoryStats(MEMORY_TAG_TEXT).usedBytes/1048576.0, GetMemoryStats(MEMORY_TAG_MODELS).usedBytes/1048576.0,
+        GetMemoryStats(MEMORY_TAG_AUDIO).usedBytes/1048576.0, GetMemoryStats(MEMORY_TAG_FILES).usedBytes/1048576.0,
+        GetMemoryStats(MEMORY_TAG_USER).usedBytes/1048576.0), posX, statsPosY + 12, 10, LIME);
+#endif
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -1032,37 +1415,44 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool sdf = (font.type == FONT_SDF) && rlEnableShaderSdf(GetFontSdfSmoothing(scaleFactor));
+
+    int codepoints[TEXT_DECODE_CHUNK] = { 0 };
+
     for (int i = 0; i < size;)
     {
-        // Get next codepoint from byte string and glyph index in font
-        int codepointByteCount = 0;
-        int codepoint = GetCodepoint(&text[i], &codepointByteCount);
-        int index = GetGlyphIndex(font, codepoint);
-
-        // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all of the bad bytes using the '?' symbol moving one byte
-        if (codepoint == 0x3f) codepointByteCount = 1;
+        // Decode next text codepoints chunk
+        // NOTE: Bad bytes are decoded one by one, all of them are drawn using the '?' symbol
+        int bytesProcessed = 0;
+        int count = DecodeCodepoints(&text[i], size - i, codepoints, TEXT_DECODE_CHUNK, true, &bytesProcessed);
+        i += bytesProcessed;   // Move text bytes counter to next chunk
 
-        if (codepoint == '\n')
-        {
-            // NOTE: Fixed line spacing of 1.5 line-height
-            // TODO: Support custom line spacing defined by user
-            textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
-            textOffsetX = 0.0f;
-        }
-        else
+        for (int c = 0; c < count; c++)
         {
-            if ((codepoint != ' ') && (codepoint != '\t'))
+            int codepoint = codepoints[c];
+            int index = GetGlyphIndex(font, codepoint);
+
+            if (codepoint == '\n')
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                // NOTE: Fixed line spacing of 1.5 line-height
+                // TODO: Support custom line spacing defined by user
+                textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+                textOffsetX = 0.0f;
             }
+            else
+            {
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                }
 
-            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
-            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+            }
         }
-
-        i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    if (sdf) rlDisableShaderSdf();
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1111,6 +1501,8 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    bool sdf = (font.type == FONT_SDF) && rlEnableShaderSdf(GetFontSdfSmoothing(scaleFactor));
+
     for (int i = 0; i < count; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1133,69 +1525,210 @@ void DrawTextCodepoints(Font font, const int *codepoints, int count, Vector2 pos
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    if (sdf) rlDisableShaderSdf();
 }
 
-// Measure string width for default font
-int MeasureText(const char *text, int fontSize)
+// Load text layout, decodes text and precomputes glyphs quads once
+// NOTE: Layout references font atlas, quads get invalid if font is unloaded (or dynamic font glyphs are evicted)
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
 {
-    Vector2 vec = { 0.0f, 0.0f };
+    TextLayout layout = { 0 };
 
-    // Check if default font has been loaded
-    if (GetFontDefault().texture.id != 0)
-    {
-        int defaultFontSize = 10;   // Default Font chars height in pixel
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        int spacing = fontSize/defaultFontSize;
-
-        vec = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
-    }
+    if (font.texture.id == 0) font = GetFontDefault();  // Security check in case of not valid font
 
-    return (int)vec.x;
-}
+    int size = TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
-// Measure string size for Font
-Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
-{
-    int size = TextLength(text);    // Get size in bytes of text
-    int tempByteCounter = 0;        // Used to count longer text line num chars
-    int byteCounter = 0;
+    // Glyphs and lines count are bounded by text size
+    layout.texture = font.texture;
+    layout.quads = (float *)RL_MALLOC(size*TEXT_LAYOUT_QUAD_FLOATS*sizeof(float));
+    layout.lines = (int *)RL_MALLOC((size + 1)*sizeof(int));
+    layout.lines[0] = 0;
+    layout.lineCount = 1;
 
-    float textWidth = 0.0f;
-    float tempTextWidth = 0.0f;     // Used to count longer text line width
+    int textOffsetY = 0;            // Offset between lines (on line break '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    float textWidth = 0.0f;         // Widest line width
 
-    float textHeight = (float)font.baseSize;
-    float scaleFactor = fontSize/(float)font.baseSize;
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
-    int letter = 0;                 // Current character
-    int index = 0;                  // Index position in sprite font
+    int codepoints[TEXT_DECODE_CHUNK] = { 0 };
 
-    for (int i = 0; i < size; i++)
+    for (int i = 0; i < size;)
     {
-        byteCounter++;
+        // Decode next text codepoints chunk, bad bytes are decoded one by one as '?' (same as DrawTextEx())
+        int bytesProcessed = 0;
+        int count = DecodeCodepoints(&text[i], size - i, codepoints, TEXT_DECODE_CHUNK, true, &bytesProcessed);
+        i += bytesProcessed;   // Move text bytes counter to next chunk
 
-        int next = 0;
-        letter = GetCodepoint(&text[i], &next);
-        index = GetGlyphIndex(font, letter);
+        for (int c = 0; c < count; c++)
+        {
+            int codepoint = codepoints[c];
+            int index = GetGlyphIndex(font, codepoint);
 
-        // NOTE: normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-        // but we need to draw all of the bad bytes using the '?' symbol so to not skip any we set next = 1
-        if (letter == 0x3f) next = 1;
-        i += next - 1;
+            if (codepoint == '\n')
+            {
+                // NOTE: Fixed line spacing of 1.5 line-height, same as DrawTextEx()
+                textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+                textOffsetX = 0.0f;
 
-        if (letter != '\n')
-        {
-            if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
-            else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
-        }
-        else
-        {
-            if (tempTextWidth < textWidth) tempTextWidth = textWidth;
-            byteCounter = 0;
-            textWidth = 0;
-            textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
+                layout.lines[layout.lineCount] = layout.glyphCount;
+                layout.lineCount++;
+            }
+            else
+            {
+                if ((codepoint != ' ') && (codepoint != '\t'))
+                {
+                    // NOTE: Quad is computed as DrawTextCodepoint(), considering glyphPadding
+                    Rectangle rec = font.recs[index];
+                    float padding = (float)font.glyphPadding;
+                    float *quad = &layout.quads[layout.glyphCount*TEXT_LAYOUT_QUAD_FLOATS];
+
+                    quad[0] = textOffsetX;
+                    quad[1] = (float)textOffsetY;
+                    quad[2] = font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+                    quad[3] = font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+                    quad[4] = (rec.width + 2.0f*padding)*scaleFactor;
+                    quad[5] = (rec.height + 2.0f*padding)*scaleFactor;
+                    quad[6] = (rec.x - padding)/font.texture.width;
+                    quad[7] = (rec.y - padding)/font.texture.height;
+                    quad[8] = (rec.x + rec.width + padding)/font.texture.width;
+                    quad[9] = (rec.y + rec.height + padding)/font.texture.height;
+
+                    layout.glyphCount++;
+                }
+
+                if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+                else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+                if (textWidth < textOffsetX) textWidth = textOffsetX;
+            }
         }
+    }
+
+    layout.bounds = (Rectangle){ 0.0f, 0.0f, textWidth, (float)textOffsetY + fontSize };
+
+    return layout;
+}
+
+// Unload text layout data
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.quads);
+    RL_FREE(layout.lines);
+}
+
+// Draw text layout, precomputed glyphs quads are emitted with a single texture and draw mode
+// NOTE: Glyphs are pixel aligned as DrawTextEx() does, position origin is rounded per glyph
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    // Batch buffer limit is checked by chunks, text could not fit in a single batch
+    #define TEXT_LAYOUT_DRAW_CHUNK    256
+
+    for (int start = 0; start < layout.glyphCount; start += TEXT_LAYOUT_DRAW_CHUNK)
+    {
+        int end = start + TEXT_LAYOUT_DRAW_CHUNK;
+        if (end > layout.glyphCount) end = layout.glyphCount;
+
+        rlCheckRenderBatchLimit((end - start)*4);     // Make sure there is enough free space on the batch buffer
+
+        rlSetTexture(layout.texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            for (int i = start; i < end; i++)
+            {
+                const float *quad = &layout.quads[i*TEXT_LAYOUT_QUAD_FLOATS];
+                float x = (float)((int)(position.x + quad[0])) + quad[2];
+                float y = (float)((int)(position.y + quad[1])) + quad[3];
+
+                // Top-left corner for texture and quad
+                rlTexCoord2f(quad[6], quad[7]);
+                rlVertex2f(x, y);
 
-        if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+                // Bottom-left corner for texture and quad
+                rlTexCoord2f(quad[6], quad[9]);
+                rlVertex2f(x, y + quad[5]);
+
+                // Bottom-right corner for texture and quad
+                rlTexCoord2f(quad[8], quad[9]);
+                rlVertex2f(x + quad[4], y + quad[5]);
+
+                // Top-right corner for texture and quad
+                rlTexCoord2f(quad[8], quad[7]);
+                rlVertex2f(x + quad[4], y);
+            }
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+// Measure string width for default font
+int MeasureText(const char *text, int fontSize)
+{
+    Vector2 vec = { 0.0f, 0.0f };
+
+    // Check if default font has been loaded
+    if (GetFontDefault().texture.id != 0)
+    {
+        int defaultFontSize = 10;   // Default Font chars height in pixel
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        int spacing = fontSize/defaultFontSize;
+
+        vec = MeasureTextEx(GetFontDefault(), text, (float)fontSize, (float)spacing);
+    }
+
+    return (int)vec.x;
+}
+
+// Measure string size for Font
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing)
+{
+    int size = TextLength(text);    // Get size in bytes of text
+    int tempByteCounter = 0;        // Used to count longer text line num chars
+    int byteCounter = 0;
+
+    float textWidth = 0.0f;
+    float tempTextWidth = 0.0f;     // Used to count longer text line width
+
+    float textHeight = (float)font.baseSize;
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    int codepoints[TEXT_DECODE_CHUNK] = { 0 };
+
+    for (int i = 0; i < size;)
+    {
+        // Decode next text codepoints chunk
+        // NOTE: Bad bytes are decoded one by one as '?', so all of them are measured
+        int bytesProcessed = 0;
+        int count = DecodeCodepoints(&text[i], size - i, codepoints, TEXT_DECODE_CHUNK, true, &bytesProcessed);
+        i += bytesProcessed;
+
+        for (int c = 0; c < count; c++)
+        {
+            byteCounter++;
+
+            int letter = codepoints[c];
+            int index = GetGlyphIndex(font, letter);
+
+            if (letter != '\n')
+            {
+                if (font.glyphs[index].advanceX != 0) textWidth += font.glyphs[index].advanceX;
+                else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+            }
+            else
+            {
+                if (tempTextWidth < textWidth) tempTextWidth = textWidth;
+                byteCounter = 0;
+                textWidth = 0;
+                textHeight += ((float)font.baseSize*1.5f); // NOTE: Fixed line spacing of 1.5 lines
+            }
+
+            if (tempByteCounter < byteCounter) tempByteCounter = byteCounter;
+        }
     }
 
     if (tempTextWidth < textWidth) tempTextWidth = textWidth;
@@ -1217,9 +1750,33 @@ int GetGlyphIndex(Font font, int codepoint)
 
 // Support charsets with any characters order
 #define SUPPORT_UNORDERED_CHARSET
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts glyphs are looked up (and rasterized if required) on glyphs cache
+    if (font.cache != NULL) return GetGlyphCacheIndex(font, codepoint);
+#endif
+
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int index = GLYPH_NOTFOUND_CHAR_FALLBACK;
 
+    // Use codepoint to glyph index hash table if available
+    if (font.glyphMap != NULL)
+    {
+        unsigned int mask = (unsigned int)font.glyphMap[0] - 1;
+        unsigned int slot = GLYPH_MAP_HASH(codepoint) & mask;
+
+        for (unsigned int i = 0; i <= mask; i++)
+        {
+            const int *entry = &font.glyphMap[1 + 2*slot];
+
+            if (entry[1] == -1) break;      // Empty slot, codepoint not found
+            if (entry[0] == codepoint) return entry[1];
+
+            slot = (slot + 1) & mask;       // Linear probing
+        }
+
+        return index;
+    }
+
     for (int i = 0; i < font.glyphCount; i++)
     {
         if (font.glyphs[i].value == codepoint)
@@ -1282,8 +1839,9 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    // NOTE: Buffers are thread-local, formatting is safe and allocation-free on worker threads
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
@@ -1685,16 +2243,11 @@ int *LoadCodepoints(const char *text, int *count)
     int textLength = TextLength(text);
 
     int bytesProcessed = 0;
-    int codepointCount = 0;
 
     // Allocate a big enough buffer to store as many codepoints as text bytes
     int *codepoints = RL_CALLOC(textLength, sizeof(int));
 
-    for (int i = 0; i < textLength; codepointCount++)
-    {
-        codepoints[codepointCount] = GetCodepoint(text + i, &bytesProcessed);
-        i += bytesProcessed;
-    }
+    int codepointCount = DecodeCodepoints(text, textLength, codepoints, textLength, false, &bytesProcessed);
 
     // Re-allocate buffer to the actual number of codepoints loaded
     void *temp = RL_REALLOC(codepoints, codepointCount*sizeof(int));
@@ -1716,17 +2269,14 @@ void UnloadCodepoints(int *codepoints)
 int GetCodepointCount(const char *text)
 {
     unsigned int length = 0;
-    char *ptr = (char *)&text[0];
+    int size = TextLength(text);
+    int codepoints[TEXT_DECODE_CHUNK] = { 0 };
 
-    while (*ptr != '\0')
+    for (int i = 0; i < size;)
     {
-        int next = 0;
-        int letter = GetCodepoint(ptr, &next);
-
-        if (letter == 0x3f) ptr += 1;
-        else ptr += next;
-
-        length++;
+        int bytesProcessed = 0;
+        length += DecodeCodepoints(&text[i], size - i, codepoints, TEXT_DECODE_CHUNK, true, &bytesProcessed);
+        i += bytesProcessed;
     }
 
     return length;
@@ -1844,6 +2394,650 @@ int GetCodepoint(const char *text, int *bytesProcessed)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+// Decode UTF-8 text bytes into codepoints (up to maxCount), text bytes decoded returned by parameter
+// NOTE: ASCII runs are widened 16 bytes at once (SIMD when available), other sequences are validated by GetCodepoint(),
+// invalid sequences are decoded as '?', skipping one byte at a time if byteErrors (drawing) or the whole bad sequence
+static int DecodeCodepoints(const char *text, int size, int *codepoints, int maxCount, bool byteErrors, int *bytesProcessed)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    int count = 0;
+    int i = 0;
+
+    while ((i < size) && (count < maxCount))
+    {
+#if defined(TEXT_SIMD_SSE2)
+        while (((size - i) >= 16) && ((maxCount - count) >= 16))
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)(bytes + i));
+            if (_mm_movemask_epi8(chunk) != 0) break;   // Some byte is not ASCII
+
+            __m128i zero = _mm_setzero_si128();
+            __m128i lo = _mm_unpacklo_epi8(chunk, zero);
+            __m128i hi = _mm_unpackhi_epi8(chunk, zero);
+
+            _mm_storeu_si128((__m128i *)(codepoints + count), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16(hi, zero));
+
+            i += 16;
+            count += 16;
+        }
+#elif defined(TEXT_SIMD_NEON)
+        while (((size - i) >= 16) && ((maxCount - count) >= 16))
+        {
+            uint8x16_t chunk = vld1q_u8(bytes + i);
+            uint64x2_t high = vreinterpretq_u64_u8(vshrq_n_u8(chunk, 7));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0) break;   // Some byte is not ASCII
+
+            uint16x8_t lo = vmovl_u8(vget_low_u8(chunk));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(chunk));
+
+            vst1q_s32(codepoints + count, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo))));
+            vst1q_s32(codepoints + count + 4, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo))));
+            vst1q_s32(codepoints + count + 8, vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi))));
+            vst1q_s32(codepoints + count + 12, vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi))));
+
+            i += 16;
+            count += 16;
+        }
+#endif
+        if ((i >= size) || (count >= maxCount)) break;
+
+        if (bytes[i] < 0x80) codepoints[count++] = bytes[i++];
+        else
+        {
+            int next = 0;
+            int codepoint = GetCodepoint(text + i, &next);
+
+            if (byteErrors && (codepoint == 0x3f)) next = 1;
+
+            codepoints[count++] = codepoint;
+            i += next;
+        }
+    }
+
+    *bytesProcessed = (i < size)? i : size;
+
+    return count;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Font async load decode stage: glyphs and atlas image (worker thread)
+// NOTE: Mirrors LoadFont() without GPU calls, atlas texture is created on upload stage
+static bool DecodeFontJob(void *data)
+{
+    FontLoadJob *job = (FontLoadJob *)data;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (job->format == FONT_ASYNC_TTF)
+    {
+        unsigned int fileSize = 0;
+        const unsigned char *fileData = LoadFileDataView(job->fileName, &fileSize);
+
+        if (fileData != NULL)
+        {
+            job->font.baseSize = FONT_TTF_DEFAULT_SIZE;
+            job->font.glyphCount = FONT_TTF_DEFAULT_NUMCHARS;
+            job->font.glyphs = LoadFontData(fileData, fileSize, job->font.baseSize, NULL, job->font.glyphCount, FONT_DEFAULT);
+
+            if (job->font.glyphs != NULL)
+            {
+                job->font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+                job->image = GenFontAtlasImage(job->font.glyphs, &job->font.recs, job->font.glyphCount, job->font.baseSize, job->font.glyphPadding, 0);
+
+                // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
+                for (int i = 0; i < job->font.glyphCount; i++) FontImageToGrayAlpha(&job->font.glyphs[i].image);
+
+                job->font.glyphMap = LoadGlyphMap(job->font.glyphs, job->font.glyphCount);
+            }
+
+            UnloadFileDataView(fileData);
+        }
+
+        return (job->font.glyphs != NULL);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (job->format == FONT_ASYNC_RFNT) return LoadRFNTData(job->fileName, &job->font, &job->image);
+#endif
+    if (job->format == FONT_ASYNC_IMAGE)
+    {
+        job->image = LoadImage(job->fileName);
+
+        return (job->image.data != NULL);
+    }
+
+    return true;    // FONT_ASYNC_FNT: Font completely loaded on upload stage
+}
+
+// Font async load upload stage: atlas texture (main thread)
+static bool UploadFontJob(void *data)
+{
+    FontLoadJob *job = (FontLoadJob *)data;
+
+    switch (job->format)
+    {
+        case FONT_ASYNC_TTF:
+        case FONT_ASYNC_RFNT: job->font.texture = LoadFontAtlasTexture(job->image); break;
+        case FONT_ASYNC_IMAGE: job->font = LoadFontFromImage(job->image, MAGENTA, FONT_TTF_DEFAULT_FIRST_CHAR); break;
+#if defined(SUPPORT_FILEFORMAT_FNT)
+        case FONT_ASYNC_FNT: job->font = LoadBMFont(job->fileName); break;
+#endif
+        default: break;
+    }
+
+    UnloadImage(job->image);
+
+    if ((job->font.texture.id == 0) || (job->font.texture.id == GetFontDefault().texture.id))
+    {
+        if ((job->format == FONT_ASYNC_TTF) || (job->format == FONT_ASYNC_RFNT)) UnloadFont(job->font);
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture", job->fileName);
+        return false;
+    }
+
+    SetTextureFilter(job->font.texture, TEXTURE_FILTER_POINT);    // By default we set point filter (best performance)
+
+    return true;
+}
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD) && defined(SUPPORT_FILEFORMAT_TTF)
+// Font reload decode stage: glyphs and atlas image, same parameters as LoadFont() (worker thread)
+static bool DecodeFontReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+
+    FontLoadJob *load = (FontLoadJob *)RL_CALLOC(1, sizeof(FontLoadJob));
+    strncpy(load->fileName, job->fileName[0], sizeof(load->fileName) - 1);
+    load->format = FONT_ASYNC_TTF;
+
+    if (!DecodeFontJob(load))
+    {
+        RL_FREE(load);
+        return false;
+    }
+
+    job->data = load;
+
+    return true;
+}
+
+// Font reload upload stage: replace atlas texture data and glyphs in place, same texture id (main thread)
+// NOTE: Atlas size and glyphs count can not change, Font structs copies would keep previous values
+static bool UploadFontReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+    FontLoadJob *load = (FontLoadJob *)job->data;
+    bool success = false;
+
+    if (!job->cancelled)
+    {
+        if ((load->font.glyphCount != job->params[0]) || (load->image.width != job->params[1]) || (load->image.height != job->params[2]))
+        {
+            TRACELOG(LOG_WARNING, "FONT: [%s] Reloaded font atlas size changed, font must be loaded again", job->fileName[0]);
+        }
+        else
+        {
+            GlyphInfo *glyphs = (GlyphInfo *)job->ptr[0];
+            Rectangle *recs = (Rectangle *)job->ptr[1];
+
+            // NOTE: Atlas data matches texture format, GRAY_ALPHA if single channel atlas is not supported
+            if (job->params[3] == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) FontImageToGrayAlpha(&load->image);
+            rlUpdateTexture(job->id, 0, 0, load->image.width, load->image.height, load->image.format, load->image.data);
+
+            // Glyphs images are moved to font glyphs, codepoints map does not change (same charset)
+            for (int i = 0; i < load->font.glyphCount; i++)
+            {
+                UnloadImage(glyphs[i].image);
+                glyphs[i] = load->font.glyphs[i];
+                recs[i] = load->font.recs[i];
+            }
+
+            RL_FREE(load->font.glyphs);
+            load->font.glyphs = NULL;
+
+            TRACELOG(LOG_INFO, "FONT: [%s] Font reloaded successfully", job->fileName[0]);
+            success = true;
+        }
+    }
+
+    if (load->font.glyphs != NULL) UnloadFontData(load->font.glyphs, load->font.glyphCount);
+    RL_FREE(load->font.recs);
+    RL_FREE(load->font.glyphMap);
+    UnloadImage(load->image);
+    RL_FREE(load);
+
+    return success;
+}
+#endif
+
+
+// Get SDF edge smoothing for a drawing scale, about one screen pixel of distance field
+// NOTE: Only used when SDF shader has no derivatives support (OpenGL ES 2.0)
+static float GetFontSdfSmoothing(float scaleFactor)
+{
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
+#endif
+    float smoothing = 0.5f*(FONT_SDF_PIXEL_DIST_SCALE/255.0f)/((scaleFactor > 0.0f)? scaleFactor : 1.0f);
+
+    // Quantized to avoid batch breaks on tiny scale differences
+    smoothing = (float)((int)(smoothing*256.0f + 0.5f))/256.0f;
+
+    if (smoothing < 0.004f) smoothing = 0.004f;
+    else if (smoothing > 0.5f) smoothing = 0.5f;
+
+    return smoothing;
+}
+
+// Load codepoint to glyph index hash table (open addressing, linear probing)
+// NOTE: Table layout: [0] capacity (power of two), then capacity pairs of (codepoint, glyph index),
+// empty slots use glyph index -1, on repeated codepoints first glyph is kept (same as linear search)
+static int *LoadGlyphMap(const GlyphInfo *glyphs, int glyphCount)
+{
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
+
+    // Keep table load factor under 0.5
+    unsigned int capacity = 16;
+    while (capacity < (unsigned int)glyphCount*2) capacity *= 2;
+
+    int *map = (int *)RL_MALLOC((1 + capacity*2)*sizeof(int));
+    if (map == NULL) return NULL;
+
+    map[0] = (int)capacity;
+    for (unsigned int i = 0; i < capacity; i++)
+    {
+        map[1 + 2*i] = 0;
+        map[1 + 2*i + 1] = -1;
+    }
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        unsigned int slot = GLYPH_MAP_HASH(glyphs[i].value) & (capacity - 1);
+
+        while ((map[1 + 2*slot + 1] != -1) && (map[1 + 2*slot] != glyphs[i].value)) slot = (slot + 1) & (capacity - 1);
+
+        if (map[1 + 2*slot + 1] == -1)
+        {
+            map[1 + 2*slot] = glyphs[i].value;
+            map[1 + 2*slot + 1] = i;
+        }
+    }
+
+    return map;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize font glyphs range [start, end), job system range callback (LoadFontData())
+// NOTE: Font info is shared read-only between jobs, every glyph writes its own slot and bitmap
+static void LoadFontGlyphsRange(void *data, int start, int end)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
+    GlyphInfo *glyphs = job->glyphs;
+
+    for (int i = start; i < end; i++)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = job->codepoints[i];  // Character value to get info for
+        glyphs[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (job->type != FONT_SDF) glyphs[i].image.data = stbtt_GetCodepointBitmap(job->fontInfo, job->scaleFactor, job->scaleFactor, ch, &chw, &chh, &glyphs[i].offsetX, &glyphs[i].offsetY);
+        else if (ch != 32) glyphs[i].image.data = stbtt_GetCodepointSDF(job->fontInfo, job->scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyphs[i].offsetX, &glyphs[i].offsetY);
+        else glyphs[i].image.data = NULL;
+
+        stbtt_GetCodepointHMetrics(job->fontInfo, ch, &glyphs[i].advanceX, NULL);
+        glyphs[i].advanceX = (int)((float)glyphs[i].advanceX*job->scaleFactor);
+
+        // Load characters images
+        glyphs[i].image.width = chw;
+        glyphs[i].image.height = chh;
+        glyphs[i].image.mipmaps = 1;
+        glyphs[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        glyphs[i].offsetY += (int)((float)job->ascent*job->scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = calloc(glyphs[i].advanceX*job->fontSize, 2),
+                .width = glyphs[i].advanceX,
+                .height = job->fontSize,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+                .mipmaps = 1
+            };
+
+            glyphs[i].image = imSpace;
+        }
+
+        if (job->type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)glyphs[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyphs[i].image.data)[p] = 0;
+                else ((unsigned char *)glyphs[i].image.data)[p] = 255;
+            }
+        }
+
+        // Trim transparent borders (i.e. SDF padding out of distance range), atlas only packs visible pixels
+        if (ch != 32) TrimGlyphImage(&glyphs[i]);
+
+        // Get bounding box for character (may be offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(job->fontInfo, ch, job->scaleFactor, job->scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)job->ascent*job->scaleFactor) + chY1);
+        */
+    }
+}
+
+// Trim glyph image transparent borders in place (GRAYSCALE), glyph offsets adjusted to keep drawing position
+// NOTE: Rows are moved down in the same buffer, empty glyphs are not changed
+static void TrimGlyphImage(GlyphInfo *glyph)
+{
+    unsigned char *pixels = (unsigned char *)glyph->image.data;
+    int width = glyph->image.width;
+    int height = glyph->image.height;
+
+    if ((pixels == NULL) || (glyph->image.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)) return;
+
+    int left = width, right = -1, top = height, bottom = -1;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (pixels[y*width + x] == 0) continue;
+
+            if (x < left) left = x;
+            if (x > right) right = x;
+            if (y < top) top = y;
+            bottom = y;
+        }
+    }
+
+    if ((right < 0) || ((left == 0) && (top == 0) && (right == width - 1) && (bottom == height - 1))) return;
+
+    int trimWidth = right - left + 1;
+    int trimHeight = bottom - top + 1;
+
+    for (int y = 0; y < trimHeight; y++) memmove(pixels + y*trimWidth, pixels + (y + top)*width + left, trimWidth);
+
+    glyph->image.width = trimWidth;
+    glyph->image.height = trimHeight;
+    glyph->offsetX += left;
+    glyph->offsetY += top;
+}
+
+// Convert GRAYSCALE coverage image to GRAY_ALPHA: white color, coverage as alpha
+// NOTE: Required by glyphs images drawn on images (ImageDrawText()) and GPUs without texture swizzle
+static void FontImageToGrayAlpha(Image *image)
+{
+    if ((image->data == NULL) || (image->format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)) return;
+
+    int pixelCount = image->width*image->height;
+    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(pixelCount*2); // Two channels
+
+    for (int i = 0, k = 0; i < pixelCount; i++, k += 2)
+    {
+        dataGrayAlpha[k] = 255;
+        dataGrayAlpha[k + 1] = ((unsigned char *)image->data)[i];
+    }
+
+    RL_FREE(image->data);
+    image->data = dataGrayAlpha;
+    image->format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    image->mipmaps = 1;
+}
+
+// Load font atlas texture, GRAYSCALE coverage atlas is stored single channel and sampled as alpha (half GRAY_ALPHA memory),
+// uploaded as GRAY_ALPHA if texture swizzle is not supported, other formats are uploaded as is
+static Texture2D LoadFontAtlasTexture(Image atlas)
+{
+    Texture2D texture = { 0 };
+
+    if ((atlas.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && !rlTextureSwizzleAlpha(0))
+    {
+        Image atlasAlpha = ImageCopy(atlas);
+        FontImageToGrayAlpha(&atlasAlpha);
+        texture = LoadTextureFromImage(atlasAlpha);
+        UnloadImage(atlasAlpha);
+    }
+    else
+    {
+        texture = LoadTextureFromImage(atlas);
+        if ((texture.id > 0) && (atlas.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)) rlTextureSwizzleAlpha(texture.id);
+    }
+
+    return texture;
+}
+
+// Load dynamic font from TTF data, takes ownership of file data
+static Font LoadFontDynamicData(unsigned char *fileData, int fontSize, int atlasSize)
+{
+    Font font = { 0 };
+    rGlyphCache *cache = (rGlyphCache *)RL_CALLOC(1, sizeof(rGlyphCache));
+
+    if ((fontSize <= 0) || !stbtt_InitFont(&cache->fontInfo, fileData, 0))
+    {
+        RL_FREE(fileData);
+        RL_FREE(cache);
+        return font;
+    }
+
+    if (atlasSize <= 0) atlasSize = FONT_DYNAMIC_DEFAULT_ATLAS_SIZE;
+
+    cache->fileData = fileData;
+    cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+    cache->ascent = (int)((float)ascent*cache->scaleFactor);
+
+    // Cell size fits font bounding box, bigger glyphs get clipped
+    int x0, y0, x1, y1;
+    stbtt_GetFontBoundingBox(&cache->fontInfo, &x0, &y0, &x1, &y1);
+    int glyphSize = (int)((float)(((x1 - x0) > (y1 - y0))? (x1 - x0) : (y1 - y0))*cache->scaleFactor) + 1;
+    if (glyphSize < fontSize) glyphSize = fontSize;
+
+    cache->cellSize = glyphSize + 2*FONT_DYNAMIC_CHARS_PADDING;
+    if (cache->cellSize > atlasSize) cache->cellSize = atlasSize;
+    cache->cellsPerRow = atlasSize/cache->cellSize;
+    cache->cellCount = cache->cellsPerRow*cache->cellsPerRow;
+
+    cache->lastUse = (unsigned int *)RL_CALLOC(cache->cellCount, sizeof(unsigned int));
+    cache->cellData = (unsigned char *)RL_MALLOC(cache->cellSize*cache->cellSize*2);
+    cache->bitmap = (unsigned char *)RL_MALLOC(cache->cellSize*cache->cellSize);
+
+    // Codepoint to cell hash table, load factor kept under 0.5
+    unsigned int capacity = 16;
+    while (capacity < (unsigned int)cache->cellCount*2) capacity *= 2;
+    cache->map = (int *)RL_MALLOC((1 + capacity*2)*sizeof(int));
+    cache->map[0] = (int)capacity;
+    for (unsigned int i = 0; i < capacity; i++) { cache->map[1 + 2*i] = 0; cache->map[1 + 2*i + 1] = -1; }
+
+    // Empty atlas texture, cells are updated on glyphs rasterization
+    // NOTE: Single channel atlas (sampled as alpha) if supported, GRAY_ALPHA otherwise
+    bool singleChannel = rlTextureSwizzleAlpha(0);
+    Image atlas = {
+        .data = RL_CALLOC(atlasSize*atlasSize, singleChannel? 1 : 2),
+        .width = atlasSize,
+        .height = atlasSize,
+        .format = singleChannel? PIXELFORMAT_UNCOMPRESSED_GRAYSCALE : PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,
+        .mipmaps = 1
+    };
+
+    font.texture = LoadFontAtlasTexture(atlas);
+    UnloadImage(atlas);
+
+    font.baseSize = fontSize;
+    font.glyphCount = cache->cellCount;
+    font.glyphPadding = FONT_DYNAMIC_CHARS_PADDING;
+    font.glyphs = (GlyphInfo *)RL_CALLOC(cache->cellCount, sizeof(GlyphInfo));
+    font.recs = (Rectangle *)RL_CALLOC(cache->cellCount, sizeof(Rectangle));
+    font.cache = cache;
+
+    TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i glyph cells, %ix%i atlas)", cache->cellCount, atlasSize, atlasSize);
+
+    return font;
+}
+
+// Get dynamic font glyph index, rasterizing the glyph into atlas if not cached
+// NOTE: If atlas is full, least recently used glyph is evicted
+static int GetGlyphCacheIndex(Font font, int codepoint)
+{
+    rGlyphCache *cache = font.cache;
+    unsigned int mask = (unsigned int)cache->map[0] - 1;
+    unsigned int slot = GLYPH_MAP_HASH(codepoint) & mask;
+    int freeSlot = -1;
+
+    // Look for codepoint in cache, remembering first reusable slot
+    for (unsigned int i = 0; i <= mask; i++)
+    {
+        int *entry = &cache->map[1 + 2*slot];
+
+        if (entry[1] == -1) { if (freeSlot == -1) freeSlot = (int)slot; break; }
+        if (entry[1] == -2) { if (freeSlot == -1) freeSlot = (int)slot; }
+        else if (entry[0] == codepoint)
+        {
+            cache->lastUse[entry[1]] = ++cache->useCounter;
+            return entry[1];
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    // Codepoint not available on font, fallback to '?'
+    if ((codepoint != 32) && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0))
+    {
+        if (codepoint != GLYPH_NOTFOUND_CHAR_FALLBACK) return GetGlyphCacheIndex(font, GLYPH_NOTFOUND_CHAR_FALLBACK);
+    }
+
+    // Select atlas cell: unused cells first, least recently used otherwise
+    int cell = 0;
+
+    if (cache->cellsUsed < cache->cellCount) cell = cache->cellsUsed++;
+    else
+    {
+        for (int i = 1; i < cache->cellCount; i++) if (cache->lastUse[i] < cache->lastUse[cell]) cell = i;
+
+        // Evicted glyph could be referenced by batched quads, draw them before updating atlas
+        rlDrawRenderBatchActive();
+
+        // Mark evicted codepoint hash table entry as removed
+        unsigned int evicted = GLYPH_MAP_HASH(font.glyphs[cell].value) & mask;
+        for (unsigned int i = 0; i <= mask; i++)
+        {
+            int *entry = &cache->map[1 + 2*evicted];
+            if (entry[1] == -1) break;
+            if ((entry[1] == cell) && (entry[0] == font.glyphs[cell].value)) { entry[1] = -2; cache->mapRemoved++; break; }
+            evicted = (evicted + 1) & mask;
+        }
+
+        // Rebuild hash table when too many removed entries accumulate
+        if (cache->mapRemoved > (int)(mask + 1)/4)
+        {
+            for (unsigned int i = 0; i <= mask; i++) cache->map[1 + 2*i + 1] = -1;
+
+            for (int c = 0; c < cache->cellCount; c++)
+            {
+                if (c == cell) continue;
+
+                unsigned int s = GLYPH_MAP_HASH(font.glyphs[c].value) & mask;
+                while (cache->map[1 + 2*s + 1] != -1) s = (s + 1) & mask;
+                cache->map[1 + 2*s] = font.glyphs[c].value;
+                cache->map[1 + 2*s + 1] = c;
+            }
+
+            cache->mapRemoved = 0;
+            freeSlot = -1;
+        }
+    }
+
+    // Rasterize glyph into cache cell
+    int padding = FONT_DYNAMIC_CHARS_PADDING;
+    int maxSize = cache->cellSize - 2*padding;
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetCodepointBitmapBox(&cache->fontInfo, codepoint, cache->scaleFactor, cache->scaleFactor, &x0, &y0, &x1, &y1);
+
+    int width = x1 - x0;
+    int height = y1 - y0;
+    if (width > maxSize) width = maxSize;
+    if (height > maxSize) height = maxSize;
+
+    int advanceX = 0;
+    stbtt_GetCodepointHMetrics(&cache->fontInfo, codepoint, &advanceX, NULL);
+
+    bool singleChannel = (font.texture.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    memset(cache->cellData, 0, cache->cellSize*cache->cellSize*(singleChannel? 1 : 2));
+
+    if ((codepoint != 32) && (width > 0) && (height > 0))
+    {
+        stbtt_MakeCodepointBitmap(&cache->fontInfo, cache->bitmap, width, height, width, cache->scaleFactor, cache->scaleFactor, codepoint);
+
+        // Place glyph data inside cell padding, converted from GRAYSCALE to GRAY_ALPHA if required
+        for (int y = 0; y < height; y++)
+        {
+            if (singleChannel) { memcpy(cache->cellData + (y + padding)*cache->cellSize + padding, cache->bitmap + y*width, width); continue; }
+
+            for (int x = 0; x < width; x++)
+            {
+                int k = ((y + padding)*cache->cellSize + (x + padding))*2;
+                cache->cellData[k] = 255;
+                cache->cellData[k + 1] = cache->bitmap[y*width + x];
+            }
+        }
+    }
+    else { width = 0; height = 0; }
+
+    int cellX = (cell%cache->cellsPerRow)*cache->cellSize;
+    int cellY = (cell/cache->cellsPerRow)*cache->cellSize;
+    rlUpdateTexture(font.texture.id, cellX, cellY, cache->cellSize, cache->cellSize, font.texture.format, cache->cellData);
+
+    font.glyphs[cell].value = codepoint;
+    font.glyphs[cell].offsetX = x0;
+    font.glyphs[cell].offsetY = y0 + cache->ascent;
+    font.glyphs[cell].advanceX = (int)((float)advanceX*cache->scaleFactor);
+    font.recs[cell] = (Rectangle){ (float)(cellX + padding), (float)(cellY + padding), (float)width, (float)height };
+
+    // Register codepoint on hash table
+    if (freeSlot == -1)
+    {
+        freeSlot = (int)(GLYPH_MAP_HASH(codepoint) & mask);
+        while (cache->map[1 + 2*freeSlot + 1] >= 0) freeSlot = (int)((freeSlot + 1) & mask);
+    }
+    if (cache->map[1 + 2*freeSlot + 1] == -2) cache->mapRemoved--;
+    cache->map[1 + 2*freeSlot] = codepoint;
+    cache->map[1 + 2*freeSlot + 1] = cell;
+
+    cache->lastUse[cell] = ++cache->useCounter;
+
+    return cell;
+}
+
+// Unload dynamic font glyphs cache
+static void UnloadGlyphCache(rGlyphCache *cache)
+{
+    if (cache == NULL) return;
+
+    RL_FREE(cache->fileData);
+    RL_FREE(cache->lastUse);
+    RL_FREE(cache->map);
+    RL_FREE(cache->cellData);
+    RL_FREE(cache->bitmap);
+    RL_FREE(cache);
+}
+#endif
 #if defined(SUPPORT_FILEFORMAT_FNT)
 
 // Read a line from memory
@@ -1988,6 +3182,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     UnloadFileText(fileText);
 
+    font.glyphMap = LoadGlyphMap(font.glyphs, font.glyphCount);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -2000,4 +3196,186 @@ static Font LoadBMFont(const char *fileName)
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+// Load a RFNT cooked font file, atlas is uploaded as is (no glyphs rasterization or packing)
+static Font LoadRFNT(const char *fileName)
+{
+    Font font = { 0 };
+    Image atlas = { 0 };
+
+    if (LoadRFNTData(fileName, &font, &atlas))
+    {
+        font.texture = LoadFontAtlasTexture(atlas);
+
+        if (font.texture.id == 0)
+        {
+            UnloadFont(font);
+            font = (Font){ 0 };
+        }
+        else TRACELOG(LOG_INFO, "FONT: [%s] Font loaded successfully (%i glyphs)", fileName, font.glyphCount);
+    }
+
+    UnloadImage(atlas);
+
+    return font;
+}
+
+// Load RFNT font glyphs, codepoints lookup table and atlas image, no GPU calls (used by async load workers)
+// NOTE: Glyphs images are copied from atlas image, required by ImageDrawText()
+static bool LoadRFNTData(const char *fileName, Font *font, Image *atlas)
+{
+    unsigned int fileSize = 0;
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+    if (fileData == NULL) return false;
+
+    RFNTHeader header = { 0 };
+    if (fileSize >= sizeof(RFNTHeader)) memcpy(&header, fileData, sizeof(RFNTHeader));
+
+    unsigned int glyphsSize = (unsigned int)header.glyphCount*sizeof(RFNTGlyph);
+    unsigned int mapSize = (header.mapCapacity > 0)? (1 + 2*(unsigned int)header.mapCapacity)*sizeof(int) : 0;
+    unsigned int offset = sizeof(RFNTHeader);
+
+    if ((fileSize < sizeof(RFNTHeader)) || (strncmp(header.id, "RFNT", 4) != 0) || (header.version != 100) ||
+        (header.glyphCount <= 0) || ((unsigned int)header.glyphCount > fileSize/sizeof(RFNTGlyph)) ||
+        (header.mapCapacity < 0) || ((unsigned int)header.mapCapacity > fileSize/(2*sizeof(int))) || ((header.mapCapacity & (header.mapCapacity - 1)) != 0) ||
+        (header.width <= 0) || (header.height <= 0) || (header.dataSize != (unsigned int)GetPixelDataSize(header.width, header.height, header.format)) ||
+        ((fileSize - offset) < glyphsSize) || ((fileSize - offset - glyphsSize) < mapSize) ||
+        ((fileSize - offset - glyphsSize - mapSize) < header.storedSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] RFNT file data not valid", fileName);
+        UnloadFileDataView(fileData);
+        return false;
+    }
+
+    // Atlas image data, decompressed if required
+    const unsigned char *stored = fileData + offset + glyphsSize + mapSize;
+    unsigned char *data = (unsigned char *)RL_MALLOC(header.dataSize);
+    bool valid = true;
+
+    if (header.compression == 0)
+    {
+        valid = (header.storedSize == header.dataSize);
+        if (valid) memcpy(data, stored, header.dataSize);
+    }
+#if defined(SUPPORT_COMPRESSION_API)
+    else valid = (DecompressDataToBuffer(stored, header.storedSize, data, header.dataSize, header.compression - 1) == (int)header.dataSize);
+#else
+    else valid = false;
+#endif
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to read RFNT atlas image data", fileName);
+        RL_FREE(data);
+        UnloadFileDataView(fileData);
+        return false;
+    }
+
+    *atlas = (Image){ data, header.width, header.height, 1, header.format };
+
+    font->baseSize = header.baseSize;
+    font->glyphCount = header.glyphCount;
+    font->glyphPadding = header.glyphPadding;
+    font->type = header.type;
+    font->glyphs = (GlyphInfo *)RL_CALLOC(header.glyphCount, sizeof(GlyphInfo));
+    font->recs = (Rectangle *)RL_MALLOC(header.glyphCount*sizeof(Rectangle));
+
+    for (int i = 0; i < header.glyphCount; i++)
+    {
+        RFNTGlyph glyph = { 0 };
+        memcpy(&glyph, fileData + offset + i*sizeof(RFNTGlyph), sizeof(RFNTGlyph));
+
+        font->glyphs[i].value = glyph.value;
+        font->glyphs[i].offsetX = glyph.offsetX;
+        font->glyphs[i].offsetY = glyph.offsetY;
+        font->glyphs[i].advanceX = glyph.advanceX;
+        font->recs[i] = glyph.rec;
+        font->glyphs[i].image = ImageFromImage(*atlas, glyph.rec);
+        FontImageToGrayAlpha(&font->glyphs[i].image);
+    }
+
+    // Codepoints lookup table is used as stored, rebuilt if not stored or not valid
+    if (mapSize > 0)
+    {
+        font->glyphMap = (int *)RL_MALLOC(mapSize);
+        memcpy(font->glyphMap, fileData + offset + glyphsSize, mapSize);
+
+        valid = (font->glyphMap[0] == header.mapCapacity);
+        for (int i = 0; valid && (i < header.mapCapacity); i++) valid = (font->glyphMap[1 + 2*i + 1] >= -1) && (font->glyphMap[1 + 2*i + 1] < header.glyphCount);
+
+        if (!valid)
+        {
+            RL_FREE(font->glyphMap);
+            font->glyphMap = NULL;
+        }
+    }
+
+    if (font->glyphMap == NULL) font->glyphMap = LoadGlyphMap(font->glyphs, font->glyphCount);
+
+    UnloadFileDataView(fileData);
+
+    return true;
+}
+
+// Save font as RFNT file: header, glyphs metrics, codepoints lookup table and atlas image data
+// NOTE: Atlas image data is compressed (LZ4, fast decompression) if it saves enough space
+static bool SaveRFNT(Font font, const char *fileName)
+{
+    Image atlas = LoadImageFromTexture(font.texture);
+    if (atlas.data == NULL) return false;
+
+    RFNTHeader header = { 0 };
+    memcpy(header.id, "RFNT", 4);
+    header.version = 100;
+    header.baseSize = font.baseSize;
+    header.glyphCount = font.glyphCount;
+    header.glyphPadding = font.glyphPadding;
+    header.type = font.type;
+    header.mapCapacity = (font.glyphMap != NULL)? font.glyphMap[0] : 0;
+    header.width = atlas.width;
+    header.height = atlas.height;
+    header.format = atlas.format;
+    header.dataSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+    header.storedSize = header.dataSize;
+
+    const unsigned char *stored = (const unsigned char *)atlas.data;
+    unsigned char *compData = NULL;
+#if defined(SUPPORT_COMPRESSION_API)
+    int compSize = 0;
+    compData = CompressDataEx((const unsigned char *)atlas.data, header.dataSize, &compSize, COMPRESSION_LZ4);
+
+    if ((compData != NULL) && (compSize > 0) && ((unsigned int)compSize < header.dataSize - header.dataSize/8))
+    {
+        stored = compData;
+        header.storedSize = compSize;
+        header.compression = COMPRESSION_LZ4 + 1;
+    }
+#endif
+
+    unsigned int glyphsSize = font.glyphCount*sizeof(RFNTGlyph);
+    unsigned int mapSize = (header.mapCapacity > 0)? (1 + 2*header.mapCapacity)*sizeof(int) : 0;
+    unsigned int dataSize = sizeof(RFNTHeader) + glyphsSize + mapSize + header.storedSize;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(dataSize);
+
+    memcpy(fileData, &header, sizeof(RFNTHeader));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        RFNTGlyph glyph = { font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX, font.recs[i] };
+        memcpy(fileData + sizeof(RFNTHeader) + i*sizeof(RFNTGlyph), &glyph, sizeof(RFNTGlyph));
+    }
+
+    if (mapSize > 0) memcpy(fileData + sizeof(RFNTHeader) + glyphsSize, font.glyphMap, mapSize);
+    memcpy(fileData + sizeof(RFNTHeader) + glyphsSize + mapSize, stored, header.storedSize);
+
+    bool success = SaveFileData(fileName, fileData, dataSize);
+
+    RL_FREE(fileData);
+    RL_FREE(compData);
+    UnloadImage(atlas);
+
+    return success;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RTEXT
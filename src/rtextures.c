@@ -21,18 +21,33 @@
 *   #define SUPPORT_FILEFORMAT_KTX
 *   #define SUPPORT_FILEFORMAT_PVR
 *   #define SUPPORT_FILEFORMAT_ASTC
+*   #define SUPPORT_FILEFORMAT_UTEX
 *       Select desired fileformats to be supported for image data loading. Some of those formats are
 *       supported by default, to remove support, just comment unrequired #define in this module
 *
 *   #define SUPPORT_IMAGE_EXPORT
 *       Support image export in multiple file formats
 *
+*   #define SUPPORT_TEXTURE_ANIM
+*       Support animated textures playback (GIF), frames are decoded on playback into a small frames ring,
+*       no full frames sequence is kept in memory (as LoadImageAnim() does)
+*
+*   #define SUPPORT_VIDEO_PLAYBACK
+*       Support video playback to textures, built-in Y4M (YUV 4:2:0) decoder, any other format or hardware
+*       decoding through custom VideoDecoder callbacks, audio is played through an AudioStream (raudio module)
+*
+*   NOTE: UTEX (universal texture) is a DXT1/DXT5 block compressed container, DEFLATE supercompressed
+*   if compression API is available. Block data is transcoded on loading to the best format supported
+*   by GPU (DXT, ETC2, ETC1 or uncompressed), use ExportImage() with .utex extension to cook textures
+*
 *   #define SUPPORT_IMAGE_MANIPULATION
 *       Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 *       If not defined only three image editing functions supported: ImageFormat(), ImageAlphaMask(), ImageToPOT()
 *
 *   #define SUPPORT_IMAGE_GENERATION
 *       Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
+*       NOTE: GenTexture*() patterns are rendered on GPU by built-in shaders (OpenGL 2.1, 3.3, ES2),
+*       generated on CPU and uploaded otherwise
 *
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
@@ -70,6 +85,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
+#define RL_MEMORY_TAG   MEMORY_TAG_TEXTURES // Module allocations memory tag (SUPPORT_MEMORY_TRACKING)
 #include "utils.h"              // Required for: TRACELOG() and fopen() Android mapping
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
 
@@ -77,6 +93,30 @@
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
 #include <math.h>               // Required for: fabsf()
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in image block codecs]
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define IMAGE_SIMD_SSE2
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in PackPixelsRGBA8()]
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define IMAGE_SIMD_NEON
+    #include <arm_neon.h>       // Required for: NEON intrinsics [Used in PackPixelsRGBA8()]
+#endif
+
+#if defined(SUPPORT_IMAGE_THREADED_KERNELS) && !defined(_MSC_VER) && !defined(PLATFORM_WEB)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join() [Used in RunImageKernel()]
+    #define IMAGE_KERNELS_THREADED
+#endif
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE) && defined(SUPPORT_ASYNC_LOADING) && !defined(_MSC_VER) && !defined(PLATFORM_WEB)
+    #include <pthread.h>        // Required for: pthread_mutex_lock() [Used in WriteTextureUploadSlot()]
+    #define TEXTURE_UPLOAD_LOCK()       pthread_mutex_lock(&textureUpload.mutex)
+    #define TEXTURE_UPLOAD_UNLOCK()     pthread_mutex_unlock(&textureUpload.mutex)
+    #define TEXTURE_UPLOAD_THREADED
+#else
+    #define TEXTURE_UPLOAD_LOCK()       (void)0
+    #define TEXTURE_UPLOAD_UNLOCK()     (void)0
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -155,6 +195,17 @@
     #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_UTEX) && defined(SUPPORT_COMPRESSION_API)
+    #include "external/sinfl.h"             // Required for: sinflate() [LoadUTEX()], implementation in rcore
+#endif
+
+#if defined(SUPPORT_SPRITE_ATLAS)
+    #if !defined(SUPPORT_MODULE_RTEXT) || !defined(SUPPORT_FILEFORMAT_TTF)
+        #define STB_RECT_PACK_IMPLEMENTATION    // Implementation compiled in rtext otherwise (font atlas), packer is shared
+    #endif
+    #include "external/stb_rect_pack.h"     // Required for: stbrp_pack_rects() [GenImageSpriteAtlas()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -162,15 +213,392 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef IMAGE_KERNEL_THREADS
+    #define IMAGE_KERNEL_THREADS                       4    // Maximum threads processing an image kernel (including calling thread)
+#endif
+#ifndef IMAGE_KERNEL_BAND_PIXELS
+    #define IMAGE_KERNEL_BAND_PIXELS               65536    // Minimum pixels processed per image kernel thread
+#endif
+#ifndef LOAD_IMAGES_PARALLEL_JOBS
+    #define LOAD_IMAGES_PARALLEL_JOBS                 16    // Maximum images decoding at once on LoadImagesParallel()
+#endif
+#ifndef SPRITE_ATLAS_PAGE_SIZE
+    #define SPRITE_ATLAS_PAGE_SIZE                  2048    // Default sprite atlas page maximum size (in pixels)
+#endif
+#ifndef SPRITE_ATLAS_ALIGNMENT
+    #define SPRITE_ATLAS_ALIGNMENT                     4    // Sprite atlas rectangles alignment (in pixels), keeps sprites separated on first mipmaps
+#endif
+#ifndef TEXTURE_ANIM_FRAMES
+    #define TEXTURE_ANIM_FRAMES                        4    // Animated texture decoded frames ring size (frames decoded ahead of playback)
+#endif
+
+#ifndef VIDEO_STREAM_FRAMES
+    #define VIDEO_STREAM_FRAMES                        4    // Video stream decoded frames ring size (frames decoded ahead of playback)
+#endif
+#ifndef VIDEO_STREAM_AUDIO_BUFFER
+    #define VIDEO_STREAM_AUDIO_BUFFER               4096    // Video stream audio buffer size (in frames), audio is pushed to AudioStream in this size
+#endif
+
+// Video frames YUV planes are converted to RGB on drawing, frames are converted on decoding otherwise (OpenGL 1.1)
+#if defined(SUPPORT_VIDEO_PLAYBACK) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define VIDEO_SHADER_SUPPORTED
+#endif
+
+// Animated textures frames are decoded with stb_image GIF decoder (one frame at a time)
+#if defined(SUPPORT_TEXTURE_ANIM) && defined(SUPPORT_FILEFORMAT_GIF)
+    #define TEXTURE_ANIM_SUPPORTED
+#endif
+#ifndef TEXTURE_TILED_SHADER_MIN_TILES
+    #define TEXTURE_TILED_SHADER_MIN_TILES            16    // Minimum tiles drawn by DrawTextureTiled() to use one quad wrapped by shader (breaks batching)
+#endif
+#ifndef SPRITE_INSTANCING_MIN_COUNT
+    #define SPRITE_INSTANCING_MIN_COUNT              128    // Minimum sprites count drawn as instanced quads (DrawSpriteInstances()), smaller batches use rlgl batch
+#endif
+#ifndef MAX_TEXTURE_WRAP_OVERRIDES
+    #define MAX_TEXTURE_WRAP_OVERRIDES                64    // Maximum textures tracked with non-repeat wrap mode (DrawTextureTiled() single quad)
+#endif
+#ifndef MAX_POST_EFFECTS
+    #define MAX_POST_EFFECTS                          16    // Maximum effects per post-processing chain
+#endif
+#ifndef LOWRES_EFFECTS_SOFT_DISTANCE
+    #define LOWRES_EFFECTS_SOFT_DISTANCE            0.5f    // Depth distance (world units) particles fade over in front of scene geometry, see BeginLowResEffects()
+#endif
+#ifndef IBL_IRRADIANCE_SAMPLES
+    #define IBL_IRRADIANCE_SAMPLES                   512    // Samples per texel on irradiance cubemap generation (cosine-weighted)
+#endif
+#ifndef IBL_PREFILTER_SAMPLES
+    #define IBL_PREFILTER_SAMPLES                    256    // Samples per texel on prefiltered specular cubemap generation (GGX importance sampled)
+#endif
+#ifndef IBL_BRDF_SAMPLES
+    #define IBL_BRDF_SAMPLES                         512    // Samples per texel on BRDF lookup texture generation (GGX importance sampled)
+#endif
+#ifndef IBL_PREFILTER_MAX_MIPMAPS
+    #define IBL_PREFILTER_MAX_MIPMAPS                  6    // Prefiltered specular cubemap maximum mipmaps, roughness 0.0 to 1.0 mapped to levels
+#endif
+#ifndef QUANTIZE_MAX_BINS
+    #define QUANTIZE_MAX_BINS                      32768    // Colors quantization histogram maximum bins, channels precision reduced if exceeded
+#endif
+
+// Image-based lighting maps generation requires GLSL 330 (textureLod() on cubemaps, integer ops)
+#if defined(SUPPORT_IBL_GENERATION) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define IBL_SHADERS_SUPPORTED
+#endif
+
+// Reduced resolution effects require GLSL 330 (texelFetch(), gl_FragDepth), drawn at full resolution otherwise
+#if defined(SUPPORT_POST_PROCESSING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    #define LOWRES_EFFECTS_SUPPORTED
+#endif
+
+// Procedural patterns are rendered by built-in shaders (GenTexture*())
+#if defined(SUPPORT_IMAGE_GENERATION) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    #define PATTERN_SHADERS_SUPPORTED
+#endif
+
+// Built-in procedural pattern shaders
+#define PATTERN_SHADER_GRADIENT_RADIAL  0   // Radial gradient between two colors
+#define PATTERN_SHADER_CHECKED          1   // Checked pattern of two colors
+#define PATTERN_SHADER_WHITE_NOISE      2   // White noise, black and white pixels
+#define PATTERN_SHADER_CELLULAR         3   // Cellular noise, distance to nearest tile seed
+#define PATTERN_SHADER_PERLIN_NOISE     4   // Perlin gradient noise, fractal sum of 6 octaves
+#define PATTERN_SHADERS                 5   // Built-in procedural pattern shaders count
+
+// Built-in image-based lighting shaders
+#define IBL_SHADER_PANORAMA         0       // Equirectangular panorama to cubemap faces
+#define IBL_SHADER_IRRADIANCE       1       // Diffuse irradiance convolution
+#define IBL_SHADER_PREFILTER        2       // Specular GGX prefiltering, roughness per mipmap level
+#define IBL_SHADER_BRDF             3       // Split-sum BRDF integration lookup
+
+#define LINEAR_TO_SRGB_TABLE_SIZE   4096    // Linear to sRGB lookup table size, used on mipmaps generation
+
+#define UTEX_FLAG_ALPHA         0x01    // UTEX block data uses alpha (DXT5 blocks, DXT1 otherwise)
+#define UTEX_FLAG_DEFLATE       0x02    // UTEX block data supercompressed with DEFLATE
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    #ifndef TEXTURE_STREAMING_BUDGET
+        #define TEXTURE_STREAMING_BUDGET        64*1024*1024    // Default VRAM budget for streamed textures mipmaps (in bytes)
+    #endif
+    #ifndef TEXTURE_STREAMING_RESIDENT_SIZE
+        #define TEXTURE_STREAMING_RESIDENT_SIZE           64    // Mipmaps up to this size (in pixels) are always resident
+    #endif
+    #ifndef TEXTURE_STREAMING_MAX_REQUESTS
+        #define TEXTURE_STREAMING_MAX_REQUESTS             4    // Maximum mipmap levels requested per frame
+    #endif
+    #ifndef MAX_STREAMED_TEXTURES
+        #define MAX_STREAMED_TEXTURES                    256    // Maximum number of streamed textures
+    #endif
+
+    #define TEXTURE_STREAMING_MAX_LEVELS                  16    // Maximum mipmap levels of streamed textures
+#endif
+
+#ifndef MAX_RENDER_TEXTURE_POOL
+    #define MAX_RENDER_TEXTURE_POOL                   32    // Maximum number of pooled transient render textures
+#endif
+#ifndef RENDER_TEXTURE_POOL_IDLE_FRAMES
+    #define RENDER_TEXTURE_POOL_IDLE_FRAMES            8    // Frames a pooled render texture is kept unused before unloading
+#endif
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+    #ifndef TEXTURE_UPLOAD_BUFFER_SIZE
+        #define TEXTURE_UPLOAD_BUFFER_SIZE      16*1024*1024    // Texture upload buffer size (in bytes), split in TEXTURE_UPLOAD_SLOTS
+    #endif
+    #ifndef TEXTURE_UPLOAD_SLOTS
+        #define TEXTURE_UPLOAD_SLOTS                       4    // Texture upload buffer slots, bigger textures are loaded from client memory
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_ASYNC_LOADING)
+// Texture async load job data
+typedef struct TextureLoadJob {
+    char fileName[512];         // Texture file name
+    Image image;                // Decoded image (worker thread)
+    Texture2D texture;          // Uploaded texture (main thread)
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+    int uploadSlot;             // Upload buffer slot holding image data (image.data not used), -1 if not used
+    int uploadSize;             // Upload buffer slot image data size (in bytes)
+    void *uploadFence;          // Upload transfer fence, texture is not ready until signaled
+#endif
+} TextureLoadJob;
+
+// Image parallel load job data
+typedef struct ImageLoadJob {
+    char fileName[512];         // Image file name
+    Image image;                // Decoded image (worker thread)
+} ImageLoadJob;
+#endif
+
+// Image kernel data, kernels process R8G8B8A8 pixels rows (unless converting formats)
+typedef struct ImageKernelData {
+    unsigned char *src;         // Source pixels (processed in place if no destination)
+    unsigned char *dst;         // Destination pixels
+    int width;                  // Source image width
+    int height;                 // Source image height
+    int srcFormat;              // Source pixels format (format conversion)
+    int dstFormat;              // Destination pixels format (format conversion)
+    Color color;                // Kernel color (tint)
+    unsigned char table[256];   // Kernel color channels lookup table (contrast, brightness)
+    int srcWidth;               // Source level width (mipmaps generation)
+    int srcHeight;              // Source level height (mipmaps generation)
+    bool srgb;                  // Color channels averaged in linear space (mipmaps generation)
+} ImageKernelData;
+
+// Color histogram bin, pixels with same color key are accumulated (colors quantization)
+typedef struct ColorBin {
+    unsigned int key;           // Color key, packed RGBA (R on lowest byte) with channels precision mask applied
+    unsigned int count;         // Pixels count, 0 for an empty hash table slot
+    unsigned long long sum[4];  // Pixels channels sum (RGBA), accumulated with full precision
+    int index;                  // Palette index (quantization)
+} ColorBin;
+
+// Image kernel, processes source image rows [startRow, endRow)
+typedef void (*ImageKernel)(const ImageKernelData *data, int startRow, int endRow);
+
+// Pooled transient render texture
+typedef struct PooledRenderTexture {
+    RenderTexture2D target;     // Render texture (id 0 if slot is free)
+    int format;                 // Requested color format (PixelFormat type)
+    bool useDepth;              // Render texture uses depth renderbuffer
+    bool inUse;                 // Render texture handed out for current frame
+    unsigned int lastUsedFrame; // Last frame the render texture was handed out
+} PooledRenderTexture;
+
+#if defined(TEXTURE_ANIM_SUPPORTED)
+// Animated texture frames stream, GIF frames are decoded in order into a frames ring
+// NOTE: Frames [playSequence, decodedCount) are decoded, ring slot is sequence%TEXTURE_ANIM_FRAMES,
+// decoder state and ring are only accessed by main thread while no decode job is pending
+typedef struct rTextureAnimStream {
+    const unsigned char *fileData;  // GIF file data (view), kept while playing
+    unsigned int fileSize;          // GIF file data size
+    stbi__context context;          // GIF decoder data context
+    stbi__gif gif;                  // GIF decoder state (current composed frame, disposal history)
+    unsigned char *previous[2];     // Last decoded frame and frame decoded before it (GIF disposal to previous)
+    int loopDecodedCount;           // Frames decoded since first frame (decoder restarts on end)
+    bool failed;                    // Decoding failed, no more frames are decoded
+    int width;                      // Frames width
+    int height;                     // Frames height
+    unsigned char *frames;          // Decoded frames ring (R8G8B8A8)
+    int frameDelay[TEXTURE_ANIM_FRAMES];    // Decoded frames delay (in milliseconds)
+    int decodedCount;               // Frames decoded sequence (not wrapped to frames count)
+    int playSequence;               // Frame playing sequence (not wrapped to frames count)
+    int uploadedSequence;           // Frame sequence uploaded to texture
+    float frameTime;                // Time playing current frame (in seconds)
+    JobCounter decodeJob;           // Frames decode job counter
+} rTextureAnimStream;
+#endif
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+// Video stream, frames (and frames audio) are decoded in order into a frames ring
+// NOTE: Frames [playSequence, decodedCount) are decoded, ring slot is sequence%VIDEO_STREAM_FRAMES,
+// decoder and ring are only accessed by main thread while no decode job is pending
+typedef struct rVideoStream {
+    VideoDecoder decoder;           // Frames decoder
+    int chromaWidth;                // U and V planes width
+    int chromaHeight;               // U and V planes height
+    int frameSize;                  // Decoded frame data size (I420)
+    int slotSize;                   // Frames ring slot size (I420 or R8G8B8A8 frame)
+    unsigned char *frames;          // Decoded frames ring
+    unsigned char *convert;         // Decoded frame, converted to R8G8B8A8 into frames ring (shaders not supported)
+    int frameIndex[VIDEO_STREAM_FRAMES];    // Decoded frames index in video
+    int maxAudioFrames;             // Audio frames per video frame (maximum)
+    float *audioSamples;            // Decoded frames audio ring (maxAudioFrames per slot)
+    int audioCount[VIDEO_STREAM_FRAMES];    // Decoded frames audio frames count
+    float *audioQueue;              // Audio frames queued for audio stream
+    int audioQueued;                // Audio frames queued count
+    int audioCapacity;              // Audio frames queue capacity
+    int loopDecodedCount;           // Frames decoded since first frame
+    int decodedCount;               // Frames decoded sequence (not wrapped to frames count)
+    int playSequence;               // Frame playing sequence
+    int uploadedSequence;           // Frame sequence uploaded to textures
+    double time;                    // Playback time since first frame sequence (in seconds)
+    bool looping;                   // Decoder restarts on end (copied from VideoStream on decode job submit)
+    bool ended;                     // Decoder reached end (or failed), no more frames are decoded
+    bool playing;                   // Video is playing
+    JobCounter decodeJob;           // Frames decode job counter
+} rVideoStream;
+
+// Y4M file decoder data (built-in video decoder)
+typedef struct Y4MDecoderData {
+#if defined(SUPPORT_NATIVE_FILEIO)
+    FileStream *stream;             // Y4M file stream, frames are read ahead sequentially
+#endif
+    char fileName[512];             // Y4M file name, frames are read on demand
+    unsigned int fileSize;          // Y4M file size
+    unsigned int dataOffset;        // First frame offset in file
+    unsigned int offset;            // Next frame offset in file
+    int frameSize;                  // Frame data size (I420)
+} Y4MDecoderData;
+#endif
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Streamed texture, mipmap levels from residentLevel to last level are loaded in GPU
+typedef struct StreamedTexture {
+    unsigned int id;            // OpenGL texture id (0 if slot is free)
+    char fileName[512];         // Texture file name, mipmaps data is read on demand
+    int width;                  // Texture base width
+    int height;                 // Texture base height
+    int format;                 // Texture compressed data format (PixelFormat type)
+    int mipmaps;                // Texture mipmap levels
+    unsigned int levelOffsets[TEXTURE_STREAMING_MAX_LEVELS];    // Mipmap levels data offsets in file
+    int tailLevel;              // First level always resident (size <= TEXTURE_STREAMING_RESIDENT_SIZE)
+    int streamLevel;            // First level available for streaming (levels failing to load are skipped)
+    int residentLevel;          // First level resident in GPU (texture base level)
+    int requestedLevel;         // First level required by last frame usage
+    unsigned int lastUsedFrame; // Last frame the texture was used
+    unsigned int pendingJob;    // Mipmap level async load handle (0 if none)
+    unsigned int pendingSerial; // Mipmap level async load serial, validates the load on upload
+    int pendingSize;            // Mipmap level async load data size (reserved in budget)
+} StreamedTexture;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Streamed texture mipmap async load job data
+typedef struct TextureMipmapJob {
+    char fileName[512];         // Texture file name
+    unsigned int id;            // Texture id
+    unsigned int serial;        // Mipmap load serial
+    int level;                  // Mipmap level
+    unsigned int offset;        // Mipmap level data offset in file
+    unsigned int size;          // Mipmap level data size
+    unsigned char *data;        // Mipmap level data (allocated with job data)
+} TextureMipmapJob;
+#endif
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_UTEX)
+// UTEX file Header (24 bytes)
+typedef struct {
+    char id[4];                 // Signature: "UTEX"
+    unsigned short version;     // File version: 100
+    unsigned short flags;       // File flags: UTEX_FLAG_ALPHA, UTEX_FLAG_DEFLATE
+    unsigned int width;         // Image width in pixels
+    unsigned int height;        // Image height in pixels
+    unsigned int mipmaps;       // Mipmap levels, 1 by default
+    unsigned int dataSize;      // Block data size (before supercompression)
+} UTEXHeader;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static PooledRenderTexture renderTexturePool[MAX_RENDER_TEXTURE_POOL] = { 0 };  // Transient render textures pool
+static unsigned int renderTexturePoolFrame = 0;                 // Render textures pool frame counter
+
+static unsigned int textureWrapOverrides[MAX_TEXTURE_WRAP_OVERRIDES] = { 0 };   // Textures set to non-repeat wrap mode by SetTextureWrap()
+static int textureWrapOverridesCount = 0;                       // Textures set to non-repeat wrap mode count (MAX_TEXTURE_WRAP_OVERRIDES + 1 if overflowed)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static Shader tiledShader = { 0 };                              // Built-in tiled texture shader, wraps texcoords inside source rectangle
+static bool tiledShaderLoaded = false;                          // Built-in tiled texture shader load has been tried
+static int tiledShaderRectLoc = -1;                             // Built-in tiled texture shader source rectangle uniform location
+static int tiledShaderTexelLoc = -1;                            // Built-in tiled texture shader half texel uniform location
+static Shader spritesShader = { 0 };                            // Built-in sprites shader, instanced quads expanded from SpriteInstance data
+static bool spritesShaderLoaded = false;                        // Built-in sprites shader load has been tried
+static int spritesShaderLocs[5] = { 0 };                        // Built-in sprites shader locations: texelSize, instance attributes (rect, rotation, source, color)
+static unsigned int spritesVaoId = 0;                           // Built-in sprites quad vertex array
+static unsigned int spritesQuadVboId = 0;                       // Built-in sprites quad vertex buffer (two triangles)
+#endif
+#if defined(VIDEO_SHADER_SUPPORTED)
+static Shader videoShader = { 0 };                              // Built-in video YUV to RGB conversion shader
+static bool videoShaderLoaded = false;                          // Built-in video shader load has been tried
+static int videoShaderLocs[2] = { 0 };                          // Built-in video shader locations: textureU, textureV
+#endif
+#if defined(PATTERN_SHADERS_SUPPORTED)
+static Shader patternShaders[PATTERN_SHADERS] = { 0 };          // Built-in procedural pattern shaders (PATTERN_SHADER_*)
+static bool patternShadersLoaded = false;                       // Built-in procedural pattern shaders load has been tried
+static int patternShaderLocs[PATTERN_SHADERS][3] = { 0 };       // Built-in procedural pattern shaders locations: colorA, colorB, params
+#endif
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+static Shader lowResShaders[2] = { 0 };                         // Built-in reduced resolution effects shaders: depth downsample, bilateral composite
+static bool lowResShadersLoaded = false;                        // Built-in reduced resolution effects shaders load has been tried
+static int lowResShaderLocs[2] = { 0 };                         // Built-in reduced resolution effects shaders locations: params (downsample, composite)
+
+// Reduced resolution effects state, between BeginLowResEffects() and EndLowResEffects()
+static struct {
+    bool active;                            // Effects are being drawn to reduced resolution target
+    int downscale;                          // Resolution divisor: 2 or 4
+    int width;                              // Composite render target width
+    int height;                             // Composite render target height
+    unsigned int framebuffer;               // Composite render target framebuffer (0 for default framebuffer)
+    Texture2D sceneDepth;                   // Scene depth texture (full resolution), id 0 if not depth tested
+    RenderTexture2D target;                 // Reduced resolution render texture (transient)
+} lowResEffects = { 0 };
+#endif
+#if defined(IBL_SHADERS_SUPPORTED)
+static Shader iblShaders[4] = { 0 };                            // Built-in image-based lighting shaders (IBL_SHADER_*)
+static bool iblShadersLoaded = false;                           // Built-in image-based lighting shaders load has been tried
+static int iblShaderLocs[4][4] = { 0 };                         // Built-in image-based lighting shaders locations: face, environmentMap, roughness, sampleCount
+#endif
+
+static float srgbToLinear[256] = { 0 };                         // sRGB to linear lookup table, used on mipmaps generation
+static unsigned char linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE] = { 0 };  // Linear to sRGB lookup table, used on mipmaps generation
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE) && defined(SUPPORT_ASYNC_LOADING)
+// Async textures upload buffer (PBO), slots are written by async load workers
+// NOTE: Slots are claimed by workers and released by main thread once transfer fence is signaled
+static struct {
+    unsigned int id;                        // Upload buffer id, 0 if not supported
+    unsigned char *data;                    // Upload buffer persistently mapped data
+    bool loaded;                            // Upload buffer load has been tried
+    bool slotsUsed[TEXTURE_UPLOAD_SLOTS];   // Upload buffer slots in use
+#if defined(TEXTURE_UPLOAD_THREADED)
+    pthread_mutex_t mutex;                  // Upload buffer slots access mutex
+#endif
+} textureUpload = {
+    .id = 0,
+#if defined(TEXTURE_UPLOAD_THREADED)
+    .mutex = PTHREAD_MUTEX_INITIALIZER
+#endif
+};
+#endif
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+static StreamedTexture streamedTextures[MAX_STREAMED_TEXTURES] = { 0 };    // Streamed textures
+static int streamedTexturesCount = 0;                           // Streamed textures count
+static int textureStreamingBudget = TEXTURE_STREAMING_BUDGET;   // VRAM budget for streamed textures mipmaps (in bytes)
+static int textureStreamingMemory = 0;                          // VRAM used by streamed textures mipmaps, including pending loads (in bytes)
+static unsigned int textureStreamingFrame = 1;                  // Streaming frame counter, used to find least recently used textures
+static unsigned int textureStreamingSerial = 0;                 // Mipmap async loads serial counter
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -180,6 +608,84 @@
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeTextureJob(void *data);       // Texture async load decode stage: load image (worker thread)
+static bool UploadTextureJob(void *data);       // Texture async load upload stage: load texture from image (main thread)
+static bool DecodeImageJob(void *data);         // Image parallel load decode stage: load image (worker thread)
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+static bool DecodeTextureReloadJob(void *data); // Texture reload decode stage: load image in texture format (worker thread)
+static bool UploadTextureReloadJob(void *data); // Texture reload upload stage: replace texture data in place (main thread)
+#endif
+extern void UpdateRenderTexturePool(void);      // Recycle transient render textures, unload idle ones (called by EndDrawing())
+extern void UnloadRenderTexturePool(void);      // Unload all pooled render textures (called by CloseWindow())
+extern void UnloadTextureTiledShader(void);     // Unload tiled texture shader (called by CloseWindow())
+extern void UnloadSpriteInstancesShader(void);  // Unload instanced sprites shader and quad buffers (called by CloseWindow())
+extern void UnloadTextureIBLShaders(void);      // Unload image-based lighting generation shaders (called by CloseWindow())
+extern void UnloadTexturePatternShaders(void);  // Unload procedural pattern shaders (called by CloseWindow())
+extern void UnloadVideoStreamShader(void);      // Unload video YUV to RGB conversion shader (called by CloseWindow())
+extern void UnloadLowResEffectsShaders(void);   // Unload reduced resolution effects shaders (called by CloseWindow())
+extern bool GetLowResEffectsSoftDepth(unsigned int *depthId, float *params);  // Get soft depth test parameters for particles drawn to reduced resolution effects (called by DrawParticleSystem())
+extern void UnloadTextureUploadBuffer(void);    // Unload async textures upload buffer (called by CloseWindow(), after async load workers stop)
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE) && defined(SUPPORT_ASYNC_LOADING)
+static int WriteTextureUploadSlot(Image image, int *size);  // Write image data into a free upload buffer slot (worker thread), -1 if not available
+static void ReleaseTextureUploadSlot(int slot);             // Release upload buffer slot, its transfer must be finished
+#endif
+static void SetTextureWrapOverride(unsigned int id, bool repeat);  // Track texture wrap mode set by SetTextureWrap()
+static bool IsTextureWrapRepeat(Texture2D texture);             // Check if texture is known to use repeat wrap mode
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static bool DrawTextureTiledShader(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float scale, Color tint);  // Draw tiled texture as one quad wrapped by shader
+static void LoadShaderTiled(void);              // Load built-in tiled texture shader (lazily, on first shader tiled draw)
+static void LoadShaderSprites(void);            // Load built-in sprites shader (lazily, on first instanced sprites draw)
+#endif
+#if defined(PATTERN_SHADERS_SUPPORTED)
+static void LoadShadersPattern(void);           // Load built-in procedural pattern shaders (lazily, on first generation)
+static Texture2D RenderTexturePattern(int type, int width, int height, Color colorA, Color colorB, Vector4 params);  // Render procedural pattern shader into a new texture
+#endif
+#if defined(IBL_SHADERS_SUPPORTED)
+static void LoadShadersIBL(void);               // Load built-in image-based lighting shaders (lazily, on first generation)
+static bool RenderTextureIBL(int type, unsigned int id, int size, int mipmapCount, Texture source);  // Render IBL shader into every face and mipmap level of texture
+#endif
+#if defined(SUPPORT_POST_PROCESSING)
+static void LoadPostEffectsShaders(PostProcess *postProcess);  // Generate fused shaders for post-processing color effects runs
+#endif
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+static void LoadShadersLowResEffects(void);     // Load built-in reduced resolution effects shaders (lazily, on first effects scope)
+static void DrawLowResEffectsQuad(Shader shader, unsigned int textureId, unsigned int depthId);  // Draw clip space quad with shader, scene depth bound to 'texture1'
+#endif
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+static void DecodeVideoStreamJob(void *data);                   // Decode video frames until frames ring is full (job)
+static void QueueVideoStreamAudio(rVideoStream *stream, int sequence);  // Queue decoded frame audio for audio stream
+static void UnloadVideoStreamData(rVideoStream *stream);        // Unload video stream data and close decoder
+static bool LoadY4MDecoder(const char *fileName, VideoDecoder *decoder);  // Load Y4M file decoder (YUV 4:2:0 only)
+static bool DecodeY4MFrame(void *userData, unsigned char *data);    // Y4M decoder: read next frame
+static void RewindY4M(void *userData);                          // Y4M decoder: restart from first frame
+static void CloseY4M(void *userData);                           // Y4M decoder: release decoder data
+#endif
+#if defined(VIDEO_SHADER_SUPPORTED)
+static void LoadVideoStreamShader(void);        // Load built-in video YUV to RGB conversion shader (lazily, on first drawing)
+#endif
+#if defined(TEXTURE_ANIM_SUPPORTED)
+static int GetGIFFrameCount(const unsigned char *fileData, unsigned int fileSize);  // Get GIF frames count scanning file blocks (no decoding)
+static void ResetTextureAnimDecoder(rTextureAnimStream *stream);    // Reset animated texture decoder to first frame
+static unsigned char *DecodeTextureAnimFrame(rTextureAnimStream *stream, int *delay);  // Decode animated texture next frame, restarts on end
+static void DecodeTextureAnimJob(void *data);                   // Decode animated texture frames until frames ring is full (job)
+#endif
+#if defined(SUPPORT_TEXTURE_STREAMING)
+static StreamedTexture *FindStreamedTexture(unsigned int id);   // Find streamed texture by id, NULL if not streamed       // Update streamed textures mipmaps for frame usage (called by EndDrawing())
+extern void UnloadTextureStreaming(void);       // Unload textures streaming data (called by CloseWindow())
+static StreamedTexture *FindStreamedTexture(unsigned int id);   // Find streamed texture by id, NULL if not streamed
+static void RemoveStreamedTexture(unsigned int id);             // Remove texture from streaming, pending load is released
+static int GetStreamedMipmapSize(const StreamedTexture *stream, int level);  // Get streamed texture mipmap level data size
+static bool FitTextureStreamingBudget(int size);                // Evict least recently used mipmaps until size fits the budget
+static bool LoadStreamedMipmap(StreamedTexture *stream, int level);  // Load streamed texture mipmap level (async if supported)
+static void SetStreamedMipmap(StreamedTexture *stream, int level, const unsigned char *data);   // Upload streamed texture mipmap level as base level
+static void EvictStreamedMipmap(StreamedTexture *stream);      // Release streamed texture base mipmap level
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeTextureMipmapJob(void *data);     // Mipmap async load decode stage: read level data (worker thread)
+static bool UploadTextureMipmapJob(void *data);     // Mipmap async load upload stage: upload level data (main thread)
+#endif
+#endif
 #if defined(SUPPORT_FILEFORMAT_DDS)
 static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize);   // Load DDS file data
 #endif
@@ -189,6 +695,8 @@ static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize);   //
 #if defined(SUPPORT_FILEFORMAT_KTX)
 static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize);   // Load KTX file data
 static int SaveKTX(Image image, const char *fileName);  // Save image data as KTX file
+static TextureCubemap LoadKTXCubemap(const unsigned char *fileData, unsigned int fileSize);  // Load KTX cubemap file data (with mipmaps)
+static int SaveKTXCubemap(const void *data, int size, int format, int mipmapCount, const char *fileName);  // Save cubemap data as KTX file
 #endif
 #if defined(SUPPORT_FILEFORMAT_PVR)
 static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize);   // Load PVR file data
@@ -196,8 +704,51 @@ static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize);   //
 #if defined(SUPPORT_FILEFORMAT_ASTC)
 static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize);  // Load ASTC file data
 #endif
+#if defined(SUPPORT_FILEFORMAT_UTEX)
+static Image LoadUTEX(const unsigned char *fileData, unsigned int fileSize);  // Load UTEX file data (transcoded to GPU supported format)
+static int SaveUTEX(Image image, const char *fileName); // Save image data as UTEX file
+#endif
+
+static bool IsBlockFormatEncodable(int format);             // Check if pixel format can be encoded by image block codecs
+static bool IsBlockFormatDecodable(int format);             // Check if pixel format can be decoded by image block codecs
+static void *ConvertImageBlocks(Image image, int newFormat);    // Convert image data between R8G8B8A8 and block compressed formats
+static void EncodeBlock(const unsigned char *rgba, int format, unsigned char *block);    // Encode 4x4 pixels block into compressed block
+static void DecodeBlock(const unsigned char *block, int format, unsigned char *rgba);    // Decode compressed block into 4x4 pixels block
+static void UnpackColorR5G6B5(unsigned short color, unsigned char *rgba);               // Unpack R5G6B5 color into R8G8B8A8
+static void EncodeBlockColorDXT(const unsigned char *rgba, unsigned char *block, bool punchAlpha);  // Encode DXT color block
+static void EncodeBlockAlphaDXT5(const unsigned char *rgba, unsigned char *block);      // Encode DXT5 alpha block
+static void EncodeBlockColorETC1(const unsigned char *rgba, unsigned char *block);      // Encode ETC1 color block (valid ETC2 RGB)
+static void EncodeBlockAlphaEAC(const unsigned char *rgba, unsigned char *block);       // Encode ETC2 EAC alpha block
 
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void *ConvertImagePixels(Image image, int newFormat);   // Convert image pixels between 8 bit per channel formats (integer kernels)
+static Color *LoadImageColorsScratch(Image image);          // Load image pixels as temporary Color array (scratch memory), released with MemFreeScratch()
+static void StoreImageColors(Image *image, Color *pixels);  // Store temporary Color array back into image data (image format kept), pixels released
+static void UnpackPixelsRGBA8(const void *src, int format, unsigned char *rgba, int count);  // Unpack pixels (up to 8 bit per channel) into R8G8B8A8
+static void PackPixelsRGBA8(const unsigned char *rgba, int format, void *dst, int count);    // Pack R8G8B8A8 pixels into format (up to 8 bit per channel)
+static void RunImageKernel(ImageKernel kernel, const ImageKernelData *data);  // Run image kernel, large images split in row bands on worker threads
+static void ConvertPixelsKernel(const ImageKernelData *data, int startRow, int endRow);     // Image kernel: convert pixels format
+static void TintPixelsKernel(const ImageKernelData *data, int startRow, int endRow);        // Image kernel: multiply pixels by color
+static void TablePixelsKernel(const ImageKernelData *data, int startRow, int endRow);       // Image kernel: map pixels color channels through lookup table
+static void PremultiplyPixelsKernel(const ImageKernelData *data, int startRow, int endRow); // Image kernel: premultiply pixels alpha
+static void FlipPixelsKernel(const ImageKernelData *data, int startRow, int endRow);        // Image kernel: flip pixels rows horizontally
+static void RotatePixelsKernel(const ImageKernelData *data, int startRow, int endRow);      // Image kernel: rotate pixels clockwise into destination
+static void MipmapPixelsKernel(const ImageKernelData *data, int startRow, int endRow);      // Image kernel: downsample pixels to next mipmap level
+static int GetMipmapFilterTaps(int x, int srcSize, int dstSize, int *start, float *weights);  // Get source pixels and weights covered by mipmap pixel
+static void GenImageMipmapsData(unsigned char *data, int width, int height, int format, int mipCount);  // Generate mipmaps chain after base level data
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void BlendPixelsSpan(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint);  // Blend tinted source pixels span into destination (R8G8B8A8/GRAY_ALPHA)
+#endif
+static void DrawImageViewPixels(Image *dst, ImageView src, int posX, int posY, Color tint);  // Draw image view pixels into destination image (view already clipped)
+static unsigned int GetColorKey(Color color, unsigned int mask);  // Get color key, packed RGBA with channels mask, transparent colors share key 0
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static ColorBin *GetColorBin(ColorBin *bins, unsigned int capacity, unsigned int key);  // Get color histogram bin for key (empty slot if not found)
+static int LoadColorHistogram(const Color *pixels, int count, ColorBin *bins, unsigned int capacity, int maxBins, unsigned int *mask);  // Load pixels into color histogram, returns bins count
+#endif
+static unsigned int PackR11G11B10F(Vector3 color);          // Pack color into R11G11B10F (unsigned floats, negative values clamped to 0)
+static Vector3 UnpackR11G11B10F(unsigned int value);        // Unpack R11G11B10F color into floats
+static unsigned int FloatToUnsignedFloat(float value, int mantissaBits);    // Convert float to unsigned float with 5 bit exponent (no sign bit)
+static float UnsignedFloatToFloat(unsigned int value, int mantissaBits);    // Convert unsigned float with 5 bit exponent (no sign bit) to float
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -220,14 +771,14 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Loading file to memory (borrowed view from file packs when possible)
     unsigned int fileSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+    const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
 
     // Loading image from memory data
     if (fileData != NULL) image = LoadImageFromMemory(GetFileExtension(fileName), fileData, fileSize);
 
-    RL_FREE(fileData);
+    UnloadFileDataView(fileData);
 
     return image;
 }
@@ -238,11 +789,11 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
     Image image = { 0 };
 
     unsigned int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    const unsigned char *fileData = LoadFileDataView(fileName, &dataSize);
 
     if (fileData != NULL)
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = fileData;
         unsigned int size = GetPixelDataSize(width, height, format);
 
         if (headerSize > 0) dataPtr += headerSize;
@@ -254,7 +805,7 @@ Image LoadImageRaw(const char *fileName, int width, int height, int format, int
         image.mipmaps = 1;
         image.format = format;
 
-        RL_FREE(fileData);
+        UnloadFileDataView(fileData);
     }
 
     return image;
@@ -274,7 +825,7 @@ Image LoadImageAnim(const char *fileName, int *frames)
     if (IsFileExtension(fileName, ".gif"))
     {
         unsigned int dataSize = 0;
-        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+        const unsigned char *fileData = LoadFileDataView(fileName, &dataSize);
 
         if (fileData != NULL)
         {
@@ -285,7 +836,7 @@ Image LoadImageAnim(const char *fileName, int *frames)
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            RL_FREE(fileData);
+            UnloadFileDataView(fileData);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
     }
@@ -398,6 +949,9 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
 #endif
 #if defined(SUPPORT_FILEFORMAT_ASTC)
     else if (strcmp(fileType, ".astc") == 0) image = LoadASTC(fileData, dataSize);
+#endif
+#if defined(SUPPORT_FILEFORMAT_UTEX)
+    else if (strcmp(fileType, ".utex") == 0) image = LoadUTEX(fileData, dataSize);
 #endif
     else TRACELOG(LOG_WARNING, "IMAGE: Data format not supported");
 
@@ -459,6 +1013,65 @@ void UnloadImage(Image image)
     RL_FREE(image.data);
 }
 
+// Load multiple images from files, decoded in parallel on async load workers
+// NOTE: Images are returned in fileNames order, failed loads return empty images
+Image *LoadImagesParallel(const char **fileNames, int count)
+{
+    if ((fileNames == NULL) || (count <= 0)) return NULL;
+
+    Image *images = (Image *)RL_CALLOC(count, sizeof(Image));
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    unsigned int *handles = (unsigned int *)RL_CALLOC(count, sizeof(unsigned int));
+    int collected = 0;      // Images retrieved from jobs, in submission order
+
+    for (int i = 0; i < count; i++)
+    {
+        // Limit jobs in flight, oldest job is retrieved before submitting a new one
+        if ((i - collected) >= LOAD_IMAGES_PARALLEL_JOBS)
+        {
+            ImageLoadJob *job = (ImageLoadJob *)GetAsyncJobData(handles[collected], ASYNC_JOB_IMAGE);
+            if (job != NULL) images[collected] = job->image;
+
+            ReleaseAsyncJob(handles[collected]);
+            collected++;
+        }
+
+        ImageLoadJob *job = (ImageLoadJob *)RL_CALLOC(1, sizeof(ImageLoadJob));
+        strncpy(job->fileName, fileNames[i], sizeof(job->fileName) - 1);
+
+        handles[i] = SubmitAsyncJob(ASYNC_JOB_IMAGE, job, DecodeImageJob, NULL);
+
+        // Async jobs slots not available, image is loaded on this thread
+        if (handles[i] == 0) images[i] = LoadImage(fileNames[i]);
+    }
+
+    for (; collected < count; collected++)
+    {
+        ImageLoadJob *job = (ImageLoadJob *)GetAsyncJobData(handles[collected], ASYNC_JOB_IMAGE);
+        if (job != NULL) images[collected] = job->image;
+
+        ReleaseAsyncJob(handles[collected]);
+    }
+
+    RL_FREE(handles);
+#else
+    for (int i = 0; i < count; i++) images[i] = LoadImage(fileNames[i]);
+#endif
+
+    return images;
+}
+
+// Unload images array loaded with LoadImagesParallel()
+void UnloadImages(Image *images, int count)
+{
+    if (images == NULL) return;
+
+    for (int i = 0; i < count; i++) UnloadImage(images[i]);
+
+    RL_FREE(images);
+}
+
 // Export image data to file
 // NOTE: File format depends on fileName extension
 bool ExportImage(Image image, const char *fileName)
@@ -524,6 +1137,9 @@ bool ExportImage(Image image, const char *fileName)
 #endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx")) success = SaveKTX(image, fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_UTEX)
+    else if (IsFileExtension(fileName, ".utex")) success = SaveUTEX(image, fileName);
 #endif
     else if (IsFileExtension(fileName, ".raw"))
     {
@@ -541,6 +1157,43 @@ bool ExportImage(Image image, const char *fileName)
     return success;
 }
 
+// Export image view pixels to file
+// NOTE: PNG rows are encoded in place (8 bit formats), other file formats export a copy of view pixels
+bool ExportImageView(ImageView view, const char *fileName)
+{
+    bool success = false;
+
+    if ((view.data == NULL) || (view.width <= 0) || (view.height <= 0)) return success;
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+    int channels = 0;
+
+    if (view.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+    else if (view.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+    else if (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+    else if (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+
+    if ((channels > 0) && IsFileExtension(fileName, ".png"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)view.data, view.stride, view.width, view.height, channels, &dataSize);
+        success = SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Image exported successfully", fileName);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export image", fileName);
+
+        return success;
+    }
+#endif
+
+    Image image = ImageFromView(view);
+    success = ExportImage(image, fileName);
+    UnloadImage(image);
+
+    return success;
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool ExportImageAsCode(Image image, const char *fileName)
 {
@@ -743,9 +1396,13 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
+    // NOTE: Calling thread random generator (GetRandomValue() sequence), one value per pixel
+    RandomGenerator *generator = GetRandomGenerator();
+    int threshold = (int)(factor*100.0f);
+
     for (int i = 0; i < width*height; i++)
     {
-        if (GetRandomValue(0, 99) < (int)(factor*100.0f)) pixels[i] = WHITE;
+        if (GetRandomValueEx(generator, 0, 99) < threshold) pixels[i] = WHITE;
         else pixels[i] = BLACK;
     }
 
@@ -867,6 +1524,7 @@ Image ImageCopy(Image image)
 }
 
 // Create an image from another image piece
+// NOTE: Piece pixels are copied, use GetImageView() to reference them
 Image ImageFromImage(Image image, Rectangle rec)
 {
     Image result = { 0 };
@@ -887,6 +1545,62 @@ Image ImageFromImage(Image image, Rectangle rec)
     return result;
 }
 
+// Get image piece view, pixels are referenced without copy
+// NOTE: Rectangle is clamped to image, compressed formats and mipmaps are not supported (empty view)
+ImageView GetImageView(Image image, Rectangle rec)
+{
+    ImageView view = { 0 };
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return view;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Image views not supported for compressed formats");
+        return view;
+    }
+
+    int x = (rec.x < 0)? 0 : (int)rec.x;
+    int y = (rec.y < 0)? 0 : (int)rec.y;
+    int right = ((int)(rec.x + rec.width) > image.width)? image.width : (int)(rec.x + rec.width);
+    int bottom = ((int)(rec.y + rec.height) > image.height)? image.height : (int)(rec.y + rec.height);
+
+    if ((right <= x) || (bottom <= y)) return view;
+
+    int bytesPerPixel = GetPixelDataSize(1, 1, image.format);
+
+    view.stride = image.width*bytesPerPixel;
+    view.data = (const unsigned char *)image.data + y*view.stride + x*bytesPerPixel;
+    view.width = right - x;
+    view.height = bottom - y;
+    view.format = image.format;
+
+    return view;
+}
+
+// Create an image from image view pixels (copied)
+Image ImageFromView(ImageView view)
+{
+    Image image = { 0 };
+
+    if ((view.data == NULL) || (view.width == 0) || (view.height == 0)) return image;
+
+    int rowSize = GetPixelDataSize(view.width, 1, view.format);
+
+    image.data = RL_MALLOC(rowSize*view.height);
+
+    if (image.data != NULL)
+    {
+        for (int y = 0; y < view.height; y++) memcpy((unsigned char *)image.data + y*rowSize, (const unsigned char *)view.data + y*view.stride, rowSize);
+
+        image.width = view.width;
+        image.height = view.height;
+        image.mipmaps = 1;
+        image.format = view.format;
+    }
+
+    return image;
+}
+
 // Crop an image to area defined by a rectangle
 // NOTE: Security checks are performed in case rectangle goes out of bounds
 void ImageCrop(Image *image, Rectangle crop)
@@ -911,12 +1625,12 @@ void ImageCrop(Image *image, Rectangle crop)
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
 
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
+        unsigned char *croppedData = (unsigned char *)image->data;
 
-        // OPTION 1: Move cropped data line-by-line
+        // OPTION 1: Move cropped data line-by-line, in place (cropped rows never move forward)
         for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
         {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
+            memmove(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
             offsetSize += ((int)crop.width*bytesPerPixel);
         }
 
@@ -932,8 +1646,9 @@ void ImageCrop(Image *image, Rectangle crop)
         }
         */
 
-        RL_FREE(image->data);
-        image->data = croppedData;
+        // Shrink image data to cropped size, previous data is kept if reallocation fails
+        croppedData = (unsigned char *)RL_REALLOC(image->data, (int)(crop.width*crop.height)*bytesPerPixel);
+        if (croppedData != NULL) image->data = croppedData;
         image->width = (int)crop.width;
         image->height = (int)crop.height;
     }
@@ -949,157 +1664,178 @@ void ImageFormat(Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // Formats up to 8 bit per channel are converted with integer kernels, float normalization only required for HDR formats
+            void *data = ConvertImagePixels(*image, newFormat);
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
+            if (data != NULL)
+            {
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = data;
+                image->format = newFormat;
+            }
+            else
+            {
+                Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
-            int k = 0;
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
 
-            switch (image->format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                int k = 0;
+
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+                        for (int i = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height*2; i += 2, k++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    {
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: Image is converted to GRAYSCALE eqeuivalent 32bit
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: Image is converted to GRAYSCALE eqeuivalent 32bit
-
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
+                        image->data = (unsigned int *)RL_MALLOC(image->width*image->height*sizeof(unsigned int));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                default: break;
-            }
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned int *)image->data)[i] = PackR11G11B10F((Vector3){ pixels[i].x, pixels[i].y, pixels[i].z });
+                        }
+                    } break;
+                    default: break;
+                }
 
-            RL_FREE(pixels);
-            pixels = NULL;
+                RL_FREE(pixels);
+                pixels = NULL;
+            }
 
             // In case original image had mipmaps, generate mipmaps for formated image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
@@ -1111,6 +1847,26 @@ void ImageFormat(Image *image, int newFormat)
             #endif
             }
         }
+        else if (((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) || IsBlockFormatDecodable(image->format)) && IsBlockFormatEncodable(newFormat))
+        {
+            // Encode (or transcode) to block compressed format, mipmaps are kept
+            if (image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            void *data = ConvertImageBlocks(*image, newFormat);
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = newFormat;
+        }
+        else if (IsBlockFormatDecodable(image->format) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            // Decode block compressed format, mipmaps are kept
+            void *data = ConvertImageBlocks(*image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            RL_FREE(image->data);
+            image->data = data;
+            image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+            if (newFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ImageFormat(image, newFormat);
+        }
         else TRACELOG(LOG_WARNING, "IMAGE: Data format is compressed, can not be converted");
     }
 }
@@ -1376,6 +2132,18 @@ void ImageAlphaPremultiply(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // R8G8B8A8 pixels are processed in place
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+
+        RunImageKernel(PremultiplyPixelsKernel, &data);
+        return;
+    }
+
     float alpha = 0.0f;
     Color *pixels = LoadImageColors(*image);
 
@@ -1439,7 +2207,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
     else
     {
         // Get data as Color pixels array to work with it
-        Color *pixels = LoadImageColors(*image);
+        Color *pixels = LoadImageColorsScratch(*image);
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
@@ -1447,7 +2215,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         int format = image->format;
 
-        UnloadImageColors(pixels);
+        MemFreeScratch(pixels);
         RL_FREE(image->data);
 
         image->data = output;
@@ -1465,7 +2233,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageColorsScratch(*image);
     Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
     // EDIT: added +1 to account for an early rounding problem
@@ -1495,7 +2263,7 @@ void ImageResizeNN(Image *image,int newWidth,int newHeight)
 
     ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
 
-    UnloadImageColors(pixels);
+    MemFreeScratch(pixels);
 }
 
 // Resize canvas and fill with color
@@ -1586,7 +2354,21 @@ void ImageMipmaps(Image *image)
         void *temp = RL_REALLOC(image->data, mipSize);
 
         if (temp != NULL) image->data = temp;      // Assign new pointer (new size) to store mipmaps data
-        else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+
+        if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+            (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            // Every mipmap level is box filtered from previous level, directly into image data
+            GenImageMipmapsData((unsigned char *)image->data, image->width, image->height, image->format, mipCount);
+            image->mipmaps = mipCount;
+
+            return;
+        }
 
         // Pointer to allocated memory point where store next mipmap level data
         unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
@@ -1624,6 +2406,7 @@ void ImageMipmaps(Image *image)
 // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 // NOTE: In case selected bpp do not represent an known 16bit format,
 // dithered data is stored in the LSB part of the unsigned short
+// NOTE: Error is diffused with integer arithmetic on two error rows, R8G8B8A8 pixels are read in place
 void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
 {
     // Security check to avoid program crash
@@ -1641,9 +2424,9 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
     }
     else
     {
-        Color *pixels = LoadImageColors(*image);
-
-        RL_FREE(image->data);      // free old image data
+        // NOTE: R8G8B8A8 base level is read directly, no pixels copy required
+        bool inPlace = ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image->mipmaps <= 1));
+        Color *pixels = inPlace? (Color *)image->data : LoadImageColorsScratch(*image);
 
         if ((image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (image->format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
         {
@@ -1661,76 +2444,274 @@ void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         }
 
         // NOTE: We will store the dithered data as unsigned short (16bpp)
-        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-        Color oldPixel = WHITE;
-        Color newPixel = WHITE;
+        unsigned short *output = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        int rError, gError, bError;
-        unsigned short rPixel, gPixel, bPixel, aPixel;   // Used for 16bit pixel composition
-
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+        // Accumulated error (x16) for current and next row (RGB), one pixel padding on each side
+        int rowSize = (image->width + 2)*3;
+        int *errors = (int *)RL_CALLOC(rowSize*2, sizeof(int));
+        int *rowError = errors;
+        int *nextError = errors + rowSize;
 
         for (int y = 0; y < image->height; y++)
         {
             for (int x = 0; x < image->width; x++)
             {
-                oldPixel = pixels[y*image->width + x];
+                Color oldPixel = pixels[y*image->width + x];
+                int *error = rowError + (x + 1)*3;
+                int *next = nextError + (x + 1)*3;
 
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+                // Old pixel with diffused error, only saturated on top (error is never negative)
+                int value[3] = { oldPixel.r + error[0]/16, oldPixel.g + error[1]/16, oldPixel.b + error[2]/16 };
+                const int bpp[3] = { rBpp, gBpp, bBpp };
+                unsigned short channel[3] = { 0 };
 
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+                for (int c = 0; c < 3; c++)
+                {
+                    if (value[c] > 0xff) value[c] = 0xff;
 
-                pixels[y*image->width + x] = newPixel;
+                    // NOTE: New pixel obtained by bits truncate, error computed with same number of bits
+                    channel[c] = (unsigned short)(value[c] >> (8 - bpp[c]));
+                    int channelError = value[c] - (channel[c] << (8 - bpp[c]));
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+                    // NOTE: Error out of the image is ignored by padding/last row reset
+                    error[c + 3] += channelError*7;
+                    next[c - 3] += channelError*3;
+                    next[c] += channelError*5;
+                    next[c + 3] += channelError;
                 }
 
-                if ((x > 0) && (y < (image->height - 1)))
+                unsigned short aPixel = (unsigned short)(oldPixel.a >> (8 - aBpp));   // A bits (not used on dithering)
+
+                output[y*image->width + x] = (channel[0] << (gBpp + bBpp + aBpp)) | (channel[1] << (bBpp + aBpp)) | (channel[2] << aBpp) | aPixel;
+            }
+
+            // Next row becomes current row, previous current row is cleared to accumulate next row
+            int *temp = rowError;
+            rowError = nextError;
+            nextError = temp;
+            memset(nextError, 0, rowSize*sizeof(int));
+        }
+
+        RL_FREE(errors);
+
+        if (!inPlace) MemFreeScratch(pixels);
+
+        RL_FREE(image->data);      // free old image data
+        image->data = output;
+        image->mipmaps = 1;
+    }
+}
+
+// Quantize image colors to an indexed image (median cut), palette is returned and image data replaced by indices
+// NOTE: Indexed image is stored as PIXELFORMAT_UNCOMPRESSED_GRAYSCALE (one palette index per pixel, up to 256 colors),
+// colors are expanded again with LoadImageFromIndexed(), palette must be freed with UnloadImagePalette()
+Color *ImageQuantize(Image *image, int maxPaletteSize, bool dither, int *colorCount)
+{
+    *colorCount = 0;
+
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (maxPaletteSize <= 0)) return NULL;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be quantized");
+        return NULL;
+    }
+
+    if (maxPaletteSize > 256) maxPaletteSize = 256;
+
+    int pixelCount = image->width*image->height;
+    Color *pixels = LoadImageColorsScratch(*image);
+    if (pixels == NULL) return NULL;
+
+    // Load colors histogram, channels precision is reduced until colors fit in bins limit
+    unsigned int capacity = 256;
+    while ((capacity < QUANTIZE_MAX_BINS*2) && (capacity < (unsigned int)pixelCount*2)) capacity *= 2;
+
+    ColorBin *bins = (ColorBin *)RL_MALLOC(capacity*sizeof(ColorBin));
+    unsigned int mask = 0xffffffff;
+    int binCount = LoadColorHistogram(pixels, pixelCount, bins, capacity, QUANTIZE_MAX_BINS, &mask);
+
+    // Gather used bins for median cut, boxes are bins ranges [boxes[i], boxes[i + 1])
+    ColorBin *boxBins = (ColorBin *)RL_MALLOC(binCount*sizeof(ColorBin));
+    ColorBin *sortBins = (ColorBin *)RL_MALLOC(binCount*sizeof(ColorBin));
+    int *boxes = (int *)RL_MALLOC((maxPaletteSize + 1)*sizeof(int));
+
+    for (unsigned int i = 0, k = 0; i < capacity; i++) if (bins[i].count > 0) boxBins[k++] = bins[i];
+
+    int boxCount = 1;
+    boxes[0] = 0;
+    boxes[1] = binCount;
+
+    while (boxCount < maxPaletteSize)
+    {
+        // Split the box with the biggest channel range
+        int splitBox = -1;
+        int splitChannel = 0;
+        int maxRange = 0;
+
+        for (int b = 0; b < boxCount; b++)
+        {
+            if ((boxes[b + 1] - boxes[b]) < 2) continue;
+
+            for (int c = 0; c < 4; c++)
+            {
+                int minValue = 255, maxValue = 0;
+
+                for (int i = boxes[b]; i < boxes[b + 1]; i++)
                 {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                    int value = (boxBins[i].key >> (c*8)) & 0xff;
+                    if (value < minValue) minValue = value;
+                    if (value > maxValue) maxValue = value;
                 }
 
-                if (y < (image->height - 1))
+                if ((maxValue - minValue) > maxRange)
                 {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                    maxRange = maxValue - minValue;
+                    splitBox = b;
+                    splitChannel = c;
                 }
+            }
+        }
+
+        if (splitBox < 0) break;    // All boxes contain a single color
+
+        // Sort box bins by split channel (counting sort)
+        int start = boxes[splitBox];
+        int end = boxes[splitBox + 1];
+        int offsets[256] = { 0 };
+        unsigned int boxPixels = 0;
+
+        for (int i = start; i < end; i++)
+        {
+            offsets[(boxBins[i].key >> (splitChannel*8)) & 0xff]++;
+            boxPixels += boxBins[i].count;
+        }
+        for (int v = 0, sum = start; v < 256; v++) { int count = offsets[v]; offsets[v] = sum; sum += count; }
+        for (int i = start; i < end; i++) sortBins[offsets[(boxBins[i].key >> (splitChannel*8)) & 0xff]++] = boxBins[i];
+        memcpy(boxBins + start, sortBins + start, (end - start)*sizeof(ColorBin));
+
+        // Split at pixels median, both boxes keep at least one bin
+        int split = start + 1;
+        unsigned int accum = boxBins[start].count;
+        while ((split < (end - 1)) && (accum < boxPixels/2)) accum += boxBins[split++].count;
+
+        for (int b = boxCount; b > splitBox; b--) boxes[b + 1] = boxes[b];
+        boxes[splitBox + 1] = split;
+        boxCount++;
+    }
+
+    // Palette colors are boxes pixels average, bins palette index stored back into histogram
+    Color *palette = (Color *)RL_MALLOC(maxPaletteSize*sizeof(Color));
+    for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;
+
+    for (int b = 0; b < boxCount; b++)
+    {
+        unsigned long long sum[4] = { 0 };
+        unsigned long long count = 0;
+
+        for (int i = boxes[b]; i < boxes[b + 1]; i++)
+        {
+            for (int c = 0; c < 4; c++) sum[c] += boxBins[i].sum[c];
+            count += boxBins[i].count;
+
+            GetColorBin(bins, capacity, boxBins[i].key)->index = b;
+        }
+
+        palette[b] = (Color){ (unsigned char)((sum[0] + count/2)/count), (unsigned char)((sum[1] + count/2)/count),
+                              (unsigned char)((sum[2] + count/2)/count), (unsigned char)((sum[3] + count/2)/count) };
+    }
+
+    RL_FREE(boxes);
+    RL_FREE(sortBins);
+    RL_FREE(boxBins);
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
+    unsigned char *indices = (unsigned char *)RL_MALLOC(pixelCount);
+
+    if (!dither)
+    {
+        for (int i = 0; i < pixelCount; i++) indices[i] = (unsigned char)GetColorBin(bins, capacity, GetColorKey(pixels[i], mask))->index;
+    }
+    else
+    {
+        // Integer Floyd-Steinberg error diffusion (RGBA), diffused colors mapped to nearest palette color,
+        // nearest colors are cached by color cell (RGB 5 bit, A 3 bit)
+        unsigned char *nearest = (unsigned char *)RL_MALLOC(1 << 18);
+        unsigned char *nearestValid = (unsigned char *)RL_CALLOC(1 << 18, 1);
+
+        int rowSize = (image->width + 2)*4;
+        int *errors = (int *)RL_CALLOC(rowSize*2, sizeof(int));
+        int *rowError = errors;
+        int *nextError = errors + rowSize;
+
+        for (int y = 0; y < image->height; y++)
+        {
+            for (int x = 0; x < image->width; x++)
+            {
+                Color pixel = pixels[y*image->width + x];
+                int *error = rowError + (x + 1)*4;
+                int *next = nextError + (x + 1)*4;
+
+                int value[4] = { pixel.r + error[0]/16, pixel.g + error[1]/16, pixel.b + error[2]/16, pixel.a + error[3]/16 };
+                for (int c = 0; c < 4; c++) value[c] = (value[c] < 0)? 0 : ((value[c] > 255)? 255 : value[c]);
+
+                int cell = ((value[0] >> 3) << 13) | ((value[1] >> 3) << 8) | ((value[2] >> 3) << 3) | (value[3] >> 5);
+
+                if (!nearestValid[cell])
                 {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                    int minDistance = 0x7fffffff;
+
+                    for (int i = 0; i < boxCount; i++)
+                    {
+                        int dr = value[0] - palette[i].r, dg = value[1] - palette[i].g, db = value[2] - palette[i].b, da = value[3] - palette[i].a;
+                        int distance = dr*dr + dg*dg + db*db + da*da;
+
+                        if (distance < minDistance)
+                        {
+                            minDistance = distance;
+                            nearest[cell] = (unsigned char)i;
+                        }
+                    }
+
+                    nearestValid[cell] = 1;
                 }
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+                int index = nearest[cell];
+                indices[y*image->width + x] = (unsigned char)index;
+
+                int channelError[4] = { value[0] - palette[index].r, value[1] - palette[index].g, value[2] - palette[index].b, value[3] - palette[index].a };
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+                for (int c = 0; c < 4; c++)
+                {
+                    error[c + 4] += channelError[c]*7;
+                    next[c - 4] += channelError[c]*3;
+                    next[c] += channelError[c]*5;
+                    next[c + 4] += channelError[c];
+                }
             }
+
+            int *temp = rowError;
+            rowError = nextError;
+            nextError = temp;
+            memset(nextError, 0, rowSize*sizeof(int));
         }
 
-        UnloadImageColors(pixels);
+        RL_FREE(errors);
+        RL_FREE(nearestValid);
+        RL_FREE(nearest);
     }
+
+    RL_FREE(bins);
+    MemFreeScratch(pixels);
+
+    RL_FREE(image->data);
+    image->data = indices;
+    image->format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    image->mipmaps = 1;
+
+    *colorCount = boxCount;
+
+    return palette;
 }
 
 // Flip image vertically
@@ -1765,6 +2746,16 @@ void ImageFlipHorizontal(Image *image)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // R8G8B8A8 pixels are flipped in place
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+
+        RunImageKernel(FlipPixelsKernel, &data);
+    }
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
@@ -1810,6 +2801,21 @@ void ImageRotateCW(Image *image)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "Image manipulation not supported for compressed formats");
+    else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.dst = (unsigned char *)RL_MALLOC(image->width*image->height*4);
+        data.width = image->width;
+        data.height = image->height;
+
+        RunImageKernel(RotatePixelsKernel, &data);
+
+        RL_FREE(image->data);
+        image->data = data.dst;
+        image->width = data.height;
+        image->height = data.width;
+    }
     else
     {
         int bytesPerPixel = GetPixelDataSize(1, 1, image->format);
@@ -1872,7 +2878,20 @@ void ImageColorTint(Image *image, Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // R8G8B8A8 pixels are processed in place
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+        data.color = color;
+
+        RunImageKernel(TintPixelsKernel, &data);
+        return;
+    }
+
+    Color *pixels = LoadImageColorsScratch(*image);
 
     float cR = (float)color.r/255;
     float cG = (float)color.g/255;
@@ -1896,13 +2915,7 @@ void ImageColorTint(Image *image, Color color)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    StoreImageColors(image, pixels);
 }
 
 // Modify image color: invert
@@ -1911,7 +2924,7 @@ void ImageColorInvert(Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageColorsScratch(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -1923,13 +2936,7 @@ void ImageColorInvert(Image *image)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    StoreImageColors(image, pixels);
 }
 
 // Modify image color: grayscale
@@ -1951,7 +2958,28 @@ void ImageColorContrast(Image *image, float contrast)
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
-    Color *pixels = LoadImageColors(*image);
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // R8G8B8A8 pixels are processed in place, channels mapped through lookup table
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+
+        for (int i = 0; i < 256; i++)
+        {
+            float value = (((float)i/255.0f - 0.5f)*contrast + 0.5f)*255;
+            if (value < 0) value = 0;
+            if (value > 255) value = 255;
+
+            data.table[i] = (unsigned char)value;
+        }
+
+        RunImageKernel(TablePixelsKernel, &data);
+        return;
+    }
+
+    Color *pixels = LoadImageColorsScratch(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -1987,13 +3015,7 @@ void ImageColorContrast(Image *image, float contrast)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    StoreImageColors(image, pixels);
 }
 
 // Modify image color: brightness
@@ -2006,7 +3028,28 @@ void ImageColorBrightness(Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
-    Color *pixels = LoadImageColors(*image);
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        // R8G8B8A8 pixels are processed in place, channels mapped through lookup table
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+
+        for (int i = 0; i < 256; i++)
+        {
+            int value = i + brightness;
+            if (value < 0) value = 1;
+            if (value > 255) value = 255;
+
+            data.table[i] = (unsigned char)value;
+        }
+
+        RunImageKernel(TablePixelsKernel, &data);
+        return;
+    }
+
+    Color *pixels = LoadImageColorsScratch(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2031,13 +3074,7 @@ void ImageColorBrightness(Image *image, int brightness)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    StoreImageColors(image, pixels);
 }
 
 // Modify image color: replace color
@@ -2046,7 +3083,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    Color *pixels = LoadImageColors(*image);
+    Color *pixels = LoadImageColorsScratch(*image);
 
     for (int y = 0; y < image->height; y++)
     {
@@ -2065,13 +3102,7 @@ void ImageColorReplace(Image *image, Color color, Color replace)
         }
     }
 
-    int format = image->format;
-    RL_FREE(image->data);
-
-    image->data = pixels;
-    image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-
-    ImageFormat(image, format);
+    StoreImageColors(image, pixels);
 }
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
@@ -2088,7 +3119,8 @@ Color *LoadImageColors(Image image)
     {
         if ((image.format == PIXELFORMAT_UNCOMPRESSED_R32) ||
             (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32) ||
-            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from 32bit to 8bit per channel");
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R32G32B32A32) ||
+            (image.format == PIXELFORMAT_UNCOMPRESSED_R11G11B10F)) TRACELOG(LOG_WARNING, "IMAGE: Pixel format converted from float to 8bit per channel");
 
         for (int i = 0, k = 0; i < image.width*image.height; i++)
         {
@@ -2185,6 +3217,16 @@ Color *LoadImageColors(Image image)
 
                     k += 4;
                 } break;
+                case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
+                {
+                    Vector3 coln = UnpackR11G11B10F(((unsigned int *)image.data)[i]);
+
+                    pixels[i].r = (unsigned char)(fminf(coln.x, 1.0f)*255.0f);
+                    pixels[i].g = (unsigned char)(fminf(coln.y, 1.0f)*255.0f);
+                    pixels[i].b = (unsigned char)(fminf(coln.z, 1.0f)*255.0f);
+                    pixels[i].a = 255;
+
+                } break;
                 default: break;
             }
         }
@@ -2201,7 +3243,7 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
     int palCount = 0;
     Color *palette = NULL;
-    Color *pixels = LoadImageColors(image);
+    Color *pixels = LoadImageColorsScratch(image);
 
     if (pixels != NULL)
     {
@@ -2209,25 +3251,30 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
 
         for (int i = 0; i < maxPaletteSize; i++) palette[i] = BLANK;   // Set all colors to BLANK
 
+        // Palette colors hash set (open addressing), packed colors keys
+        // NOTE: Only colors with alpha > 0 are stored, so key 0 (BLANK) marks an empty slot
+        unsigned int capacity = 16;
+        while (capacity < (unsigned int)maxPaletteSize*2) capacity *= 2;
+        unsigned int *keys = (unsigned int *)RL_CALLOC(capacity, sizeof(unsigned int));
+        Color prevColor = BLANK;
+
         for (int i = 0; i < image.width*image.height; i++)
         {
-            if (pixels[i].a > 0)
+            // NOTE: Runs of same color are common, previous pixel check skips the hash lookup
+            if ((pixels[i].a > 0) && ((i == 0) || !COLOR_EQUAL(pixels[i], prevColor)))
             {
-                bool colorInPalette = false;
+                prevColor = pixels[i];
 
                 // Check if the color is already on palette
-                for (int j = 0; j < maxPaletteSize; j++)
-                {
-                    if (COLOR_EQUAL(pixels[i], palette[j]))
-                    {
-                        colorInPalette = true;
-                        break;
-                    }
-                }
+                unsigned int key = GetColorKey(pixels[i], 0xffffffff);
+                unsigned int slot = (key*2654435761u) & (capacity - 1);
+
+                while ((keys[slot] != 0) && (keys[slot] != key)) slot = (slot + 1) & (capacity - 1);
 
                 // Store color if not on the palette
-                if (!colorInPalette)
+                if (keys[slot] == 0)
                 {
+                    keys[slot] = key;
                     palette[palCount] = pixels[i];      // Add pixels[i] to palette
                     palCount++;
 
@@ -2241,7 +3288,8 @@ Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorCount)
             }
         }
 
-        UnloadImageColors(pixels);
+        RL_FREE(keys);
+        MemFreeScratch(pixels);
     }
 
     *colorCount = palCount;
@@ -2261,13 +3309,39 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
+// Load image from indexed image (palette indices, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) and palette
+// NOTE: Indices out of palette are loaded as BLANK, image is loaded as PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+Image LoadImageFromIndexed(Image indexed, const Color *palette, int colorCount)
+{
+    Image image = { 0 };
+
+    if ((indexed.data == NULL) || (palette == NULL) || (indexed.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Indexed image data not valid (GRAYSCALE indices required)");
+        return image;
+    }
+
+    Color *pixels = (Color *)RL_MALLOC(indexed.width*indexed.height*sizeof(Color));
+    const unsigned char *indices = (const unsigned char *)indexed.data;
+
+    for (int i = 0; i < indexed.width*indexed.height; i++) pixels[i] = (indices[i] < colorCount)? palette[indices[i]] : BLANK;
+
+    image.data = pixels;
+    image.width = indexed.width;
+    image.height = indexed.height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    return image;
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentatge: 0.0f -> 1.0f
 Rectangle GetImageAlphaBorder(Image image, float threshold)
 {
     Rectangle crop = { 0 };
 
-    Color *pixels = LoadImageColors(image);
+    Color *pixels = LoadImageColorsScratch(image);
 
     if (pixels != NULL)
     {
@@ -2296,7 +3370,7 @@ Rectangle GetImageAlphaBorder(Image image, float threshold)
             crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
         }
 
-        UnloadImageColors(pixels);
+        MemFreeScratch(pixels);
     }
 
     return crop;
@@ -2396,6 +3470,16 @@ Color GetImageColor(Image image, int x, int y)
                 color.b = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
                 color.a = (unsigned char)(((float *)image.data)[(y*image.width + x)*4]*255.0f);
 
+            } break;
+            case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
+            {
+                Vector3 coln = UnpackR11G11B10F(((unsigned int *)image.data)[y*image.width + x]);
+
+                color.r = (unsigned char)(fminf(coln.x, 1.0f)*255.0f);
+                color.g = (unsigned char)(fminf(coln.y, 1.0f)*255.0f);
+                color.b = (unsigned char)(fminf(coln.z, 1.0f)*255.0f);
+                color.a = 255;
+
             } break;
             default: TRACELOG(LOG_WARNING, "Compressed image format does not support color reading"); break;
         }
@@ -2535,6 +3619,14 @@ void ImageDrawPixel(Image *dst, int x, int y, Color color)
             ((float *)dst->data)[(y*dst->width + x)*4 + 2] = coln.z;
             ((float *)dst->data)[(y*dst->width + x)*4 + 3] = coln.w;
 
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
+        {
+            // NOTE: Calculate R11G11B10F equivalent color (normalized to float)
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            ((unsigned int *)dst->data)[y*dst->width + x] = PackR11G11B10F(coln);
+
         } break;
         default: break;
     }
@@ -2780,79 +3872,57 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
         if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
 
-        // This blitting method is quite fast! The process followed is:
-        // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
-        // Some optimization ideas:
-        //    [x] Avoid creating source copy if not required (no resize required)
-        //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
-        //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
-        //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
-        //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
-        //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
-        //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
-        //    [ ] Support f32bit channels drawing
+        // Source rectangle is drawn as an image view, pixels read in place
+        ImageView view = { 0 };
+        view.stride = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
+        view.data = (const unsigned char *)srcPtr->data + (int)srcRec.y*view.stride + (int)srcRec.x*GetPixelDataSize(1, 1, srcPtr->format);
+        view.width = (int)srcRec.width;
+        view.height = (int)srcRec.height;
+        view.format = srcPtr->format;
 
-        // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
+        if ((view.width > 0) && (view.height > 0)) DrawImageViewPixels(dst, view, (int)dstRec.x, (int)dstRec.y, tint);
 
-        Color colSrc, colDst, blend;
-        bool blendRequired = true;
+        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+    }
+}
 
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
+// Draw a source image view within a destination image (no scaling)
+// NOTE: View pixels are read in place, color tint is applied to source
+void ImageDrawView(Image *dst, ImageView src, Vector2 position, Color tint)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width <= 0) || (src.height <= 0)) return;
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+    if (dst->mipmaps > 1) TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
+    if ((dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || (src.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)) TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+    else
+    {
+        int posX = (int)position.x;
+        int posY = (int)position.y;
+        int bytesPerPixel = GetPixelDataSize(1, 1, src.format);
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+        // Clip view to destination image
+        if (posX < 0) { src.data = (const unsigned char *)src.data - posX*bytesPerPixel; src.width += posX; posX = 0; }
+        if (posY < 0) { src.data = (const unsigned char *)src.data - posY*src.stride; src.height += posY; posY = 0; }
+        if ((posX + src.width) > dst->width) src.width = dst->width - posX;
+        if ((posY + src.height) > dst->height) src.height = dst->height - posY;
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+        if ((src.width > 0) && (src.height > 0)) DrawImageViewPixels(dst, src, posX, posY, tint);
+    }
+}
 
-        for (int y = 0; y < (int)srcRec.height; y++)
-        {
-            unsigned char *pSrc = pSrcBase;
-            unsigned char *pDst = pDstBase;
-
-            // Fast path: Avoid moving pixel by pixel if no blend required and same format
-            if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = GetPixelColor(pSrc, srcPtr->format);
-                    colDst = GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
-
-                    SetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
-
-            pSrcBase += strideSrc;
-            pDstBase += strideDst;
-        }
-
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
-    }
-}
-
-// Draw text (default font) within an image (destination)
-void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
-{
-#if defined(SUPPORT_MODULE_RTEXT)
-    Vector2 position = { (float)posX, (float)posY };
-    // NOTE: For default font, spacing is set to desired font size / default font size (10)
-    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);   // WARNING: Module required: rtext
-#else
-    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
-#endif
-}
+// Draw text (default font) within an image (destination)
+void ImageDrawText(Image *dst, const char *text, int posX, int posY, int fontSize, Color color)
+{
+#if defined(SUPPORT_MODULE_RTEXT)
+    Vector2 position = { (float)posX, (float)posY };
+    // NOTE: For default font, spacing is set to desired font size / default font size (10)
+    ImageDrawTextEx(dst, GetFontDefault(), text, position, (float)fontSize, (float)fontSize/10, color);   // WARNING: Module required: rtext
+#else
+    TRACELOG(LOG_WARNING, "IMAGE: ImageDrawText() requires module: rtext");
+#endif
+}
 
 // Draw text (custom sprite font) within an image (destination)
 void ImageDrawTextEx(Image *dst, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
@@ -2875,6 +3945,12 @@ Texture2D LoadTexture(const char *fileName)
 {
     Texture2D texture = { 0 };
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if (LoadCachedResource(RESOURCE_TEXTURE, fileName, &texture, sizeof(Texture2D))) return texture;
+#endif
+
+    BeginLoadingBoost();
+
     Image image = LoadImage(fileName);
 
     if (image.data != NULL)
@@ -2883,8 +3959,65 @@ Texture2D LoadTexture(const char *fileName)
         UnloadImage(image);
     }
 
+#if defined(SUPPORT_RESOURCE_CACHE)
+    if (texture.id > 0) CacheResource(RESOURCE_TEXTURE, fileName, &texture, sizeof(Texture2D), texture.id);
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+    if (texture.id > 0)
+    {
+        AssetReloadJob asset = { 0 };
+        strncpy(asset.fileName[0], fileName, sizeof(asset.fileName[0]) - 1);
+        asset.id = texture.id;
+        asset.params[0] = texture.width;
+        asset.params[1] = texture.height;
+        asset.params[2] = texture.mipmaps;
+        asset.params[3] = texture.format;
+
+        WatchAsset(ASSET_WATCH_TEXTURE, &asset, DecodeTextureReloadJob, UploadTextureReloadJob);
+    }
+#endif
+
+    EndLoadingBoost();
+
+    return texture;
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Load texture from file asynchronously, image is decoded on a worker thread and uploaded on EndDrawing()
+// NOTE: Texture is retrieved with GetAsyncTexture(), load state can be polled with GetAsyncLoadState()
+unsigned int LoadTextureAsync(const char *fileName)
+{
+    TextureLoadJob *job = (TextureLoadJob *)RL_CALLOC(1, sizeof(TextureLoadJob));
+    strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+    job->uploadSlot = -1;
+
+    // Upload buffer is loaded on first async texture load (GL context thread)
+    if (!textureUpload.loaded && IsWindowReady())
+    {
+        textureUpload.data = (unsigned char *)rlLoadUploadBuffer(&textureUpload.id, TEXTURE_UPLOAD_BUFFER_SIZE);
+        textureUpload.loaded = true;
+    }
+#endif
+
+    return SubmitAsyncJob(ASYNC_JOB_TEXTURE, job, DecodeTextureJob, UploadTextureJob);
+}
+
+// Get texture loaded asynchronously, waits for the load to finish and releases the load handle
+Texture2D GetAsyncTexture(unsigned int handle)
+{
+    Texture2D texture = { 0 };
+
+    TextureLoadJob *job = (TextureLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_TEXTURE);
+    if (job != NULL) texture = job->texture;
+
+    ReleaseAsyncJob(handle);
+
     return texture;
 }
+#endif
 
 // Load a texture from image data
 // NOTE: image is not unloaded, it must be done manually
@@ -2894,7 +4027,9 @@ Texture2D LoadTextureFromImage(Image image)
 
     if ((image.width != 0) && (image.height != 0))
     {
-        texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        // NOTE: Without window there is no GPU context, texture is not uploaded (id = 0), CPU data loading still works
+        if (IsWindowReady()) texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
+        else TRACELOG(LOG_WARNING, "IMAGE: Window not initialized, texture not uploaded to GPU");
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
 
@@ -2906,6 +4041,163 @@ Texture2D LoadTextureFromImage(Image image)
     return texture;
 }
 
+// Load a texture from image view pixels
+// NOTE: View rows are uploaded in place (GL_UNPACK_ROW_LENGTH), atlas pieces are not copied
+Texture2D LoadTextureFromView(ImageView view)
+{
+    Texture2D texture = { 0 };
+
+    if ((view.data != NULL) && (view.width > 0) && (view.height > 0))
+    {
+        if (IsWindowReady())
+        {
+            texture.id = rlLoadTexture(NULL, view.width, view.height, view.format, 1);
+            if (texture.id > 0) rlUpdateTextureStride(texture.id, 0, 0, view.width, view.height, view.format, view.data, view.stride);
+        }
+        else TRACELOG(LOG_WARNING, "IMAGE: Window not initialized, texture not uploaded to GPU");
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    texture.width = view.width;
+    texture.height = view.height;
+    texture.mipmaps = 1;
+    texture.format = view.format;
+
+    return texture;
+}
+
+// Load texture array from images, one layer per image
+// NOTE: All images must have the same size, layers are converted to first image format if required
+Texture2DArray LoadTextureArray(const Image *images, int count)
+{
+    Texture2DArray texture = { 0 };
+
+    if ((images == NULL) || (count <= 0) || (images[0].data == NULL) || (images[0].width == 0) || (images[0].height == 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture array");
+        return texture;
+    }
+
+    for (int i = 1; i < count; i++)
+    {
+        if ((images[i].data == NULL) || (images[i].width != images[0].width) || (images[i].height != images[0].height))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Texture array layer %i size does not match first layer", i);
+            return texture;
+        }
+    }
+
+    if (!IsWindowReady())
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Window not initialized, texture array not uploaded to GPU");
+        return texture;
+    }
+
+    texture.id = rlLoadTextureArray(NULL, images[0].width, images[0].height, count, images[0].format, 1);
+
+    if (texture.id > 0)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (images[i].format == images[0].format) rlUpdateTextureLayer(texture.id, i, 0, 0, images[i].width, images[i].height, images[i].format, images[i].data);
+            else
+            {
+                Image layer = ImageCopy(images[i]);
+                ImageFormat(&layer, images[0].format);
+                rlUpdateTextureLayer(texture.id, i, 0, 0, layer.width, layer.height, layer.format, layer.data);
+                UnloadImage(layer);
+            }
+        }
+    }
+
+    texture.width = images[0].width;
+    texture.height = images[0].height;
+    texture.layers = count;
+    texture.mipmaps = 1;
+    texture.format = images[0].format;
+
+    return texture;
+}
+
+// Load texture array from image grid, one layer per cell, row by row
+// NOTE: A single column image is already contiguous and uploaded directly, otherwise cells
+// are copied one by one (through image views) into a reused layer buffer
+Texture2DArray LoadTextureArrayFromImage(Image image, int columns, int rows)
+{
+    Texture2DArray texture = { 0 };
+
+    if ((image.data == NULL) || (columns <= 0) || (rows <= 0) || (image.width < columns) || (image.height < rows) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture array");
+        return texture;
+    }
+
+    if (!IsWindowReady())
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Window not initialized, texture array not uploaded to GPU");
+        return texture;
+    }
+
+    int cellWidth = image.width/columns;
+    int cellHeight = image.height/rows;
+    int layers = columns*rows;
+
+    if ((columns == 1) && (cellHeight*rows == image.height)) texture.id = rlLoadTextureArray(image.data, cellWidth, cellHeight, layers, image.format, 1);
+    else
+    {
+        texture.id = rlLoadTextureArray(NULL, cellWidth, cellHeight, layers, image.format, 1);
+
+        if (texture.id > 0)
+        {
+            int rowSize = GetPixelDataSize(cellWidth, 1, image.format);
+            unsigned char *layerData = (unsigned char *)RL_MALLOC(rowSize*cellHeight);
+
+            for (int i = 0; i < layers; i++)
+            {
+                ImageView view = GetImageView(image, (Rectangle){ (float)((i%columns)*cellWidth), (float)((i/columns)*cellHeight), (float)cellWidth, (float)cellHeight });
+
+                for (int y = 0; y < cellHeight; y++) memcpy(layerData + y*rowSize, (const unsigned char *)view.data + y*view.stride, rowSize);
+
+                rlUpdateTextureLayer(texture.id, i, 0, 0, cellWidth, cellHeight, image.format, layerData);
+            }
+
+            RL_FREE(layerData);
+        }
+    }
+
+    texture.width = cellWidth;
+    texture.height = cellHeight;
+    texture.layers = layers;
+    texture.mipmaps = 1;
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load 3D texture from image, slices stacked vertically (image.height = slice height*depth)
+// NOTE: Stacked slices data is contiguous, uploaded directly
+Texture3D LoadTexture3D(Image image, int depth)
+{
+    Texture3D texture = { 0 };
+
+    if ((image.data == NULL) || (depth <= 0) || (image.height%depth != 0) || (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load 3D texture");
+        return texture;
+    }
+
+    if (IsWindowReady()) texture.id = rlLoadTexture3D(image.data, image.width, image.height/depth, depth, image.format);
+    else TRACELOG(LOG_WARNING, "IMAGE: Window not initialized, 3D texture not uploaded to GPU");
+
+    texture.width = image.width;
+    texture.height = image.height/depth;
+    texture.layers = depth;
+    texture.mipmaps = 1;
+    texture.format = image.format;
+
+    return texture;
+}
+
 // Load cubemap from image, multiple image cubemap layouts supported
 TextureCubemap LoadTextureCubemap(Image image, int layout)
 {
@@ -2940,12 +4232,18 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
 
         if (layout == CUBEMAP_LAYOUT_LINE_VERTICAL)
         {
-            faces = ImageCopy(image);       // Image data already follows expected convention
+            faces = image;                  // Image data already follows expected convention, no copy
         }
         else if (layout == CUBEMAP_LAYOUT_PANORAMA)
         {
-            // TODO: Convert panorama image to square faces...
-            // Ref: https://github.com/denivip/panorama/blob/master/panorama.cpp
+            // Panorama is projected to cubemap faces on GPU, mipmaps are generated
+            if (size == 0) size = image.width/4;
+
+            Texture2D panorama = LoadTextureFromImage(image);
+            cubemap = GenTextureCubemapFromPanorama(panorama, size, image.format);
+            UnloadTexture(panorama);
+
+            return cubemap;
         }
         else
         {
@@ -2970,564 +4268,2346 @@ TextureCubemap LoadTextureCubemap(Image image, int layout)
             }
 
             // Convert image data to 6 faces in a vertical column, that's the optimum layout for loading
-            faces = GenImageColor(size, size*6, MAGENTA);
-            ImageFormat(&faces, image.format);
+            // NOTE: Faces views rows are copied once, no intermediate image conversion or blending
+            faces = (Image){ RL_MALLOC(GetPixelDataSize(size, size*6, image.format)), size, size*6, 1, image.format };
+            int rowSize = GetPixelDataSize(size, 1, image.format);
 
-            // NOTE: Image formating does not work with compressed textures
+            for (int i = 0; i < 6; i++)
+            {
+                ImageView face = GetImageView(image, faceRecs[i]);
 
-            for (int i = 0; i < 6; i++) ImageDraw(&faces, image, faceRecs[i], (Rectangle){ 0, (float)size*i, (float)size, (float)size }, WHITE);
+                if ((face.width != size) || (face.height != size)) memset((unsigned char *)faces.data + i*size*rowSize, 0, size*rowSize);
+                else for (int y = 0; y < size; y++) memcpy((unsigned char *)faces.data + (i*size + y)*rowSize, (const unsigned char *)face.data + y*face.stride, rowSize);
+            }
         }
 
         // NOTE: Cubemap data is expected to be provided as 6 images in a single data array,
         // one after the other (that's a vertical image), following convention: +X, -X, +Y, -Y, +Z, -Z
         cubemap.id = rlLoadTextureCubemap(faces.data, size, faces.format);
         if (cubemap.id == 0) TRACELOG(LOG_WARNING, "IMAGE: Failed to load cubemap image");
+        else
+        {
+            cubemap.width = size;
+            cubemap.height = size;
+            cubemap.mipmaps = 1;
+            cubemap.format = faces.format;
+        }
 
-        UnloadImage(faces);
+        if (faces.data != image.data) UnloadImage(faces);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Failed to detect cubemap image layout");
 
     return cubemap;
 }
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-RenderTexture2D LoadRenderTexture(int width, int height)
+// Load cubemap with mipmaps from file, cubemaps exported with ExportTextureCubemap() (KTX)
+TextureCubemap LoadTextureCubemapFromFile(const char *fileName)
 {
-    RenderTexture2D target = { 0 };
-
-    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+    TextureCubemap cubemap = { 0 };
 
-    if (target.id > 0)
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    if (IsFileExtension(fileName, ".ktx"))
     {
-        rlEnableFramebuffer(target.id);
+        unsigned int fileSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &fileSize);
 
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
+        if (fileData != NULL)
+        {
+            cubemap = LoadKTXCubemap(fileData, fileSize);
+            UnloadFileData(fileData);
+        }
+    }
+#endif
 
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
+    if (cubemap.id == 0) TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load cubemap file", fileName);
 
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+    return cubemap;
+}
 
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+// Export cubemap with all its mipmaps to file (KTX), generated maps can be cached and loaded with LoadTextureCubemapFromFile()
+// NOTE: Cubemap data is read back from GPU, not supported on OpenGL ES 2.0
+bool ExportTextureCubemap(TextureCubemap cubemap, const char *fileName)
+{
+    int success = 0;
 
-        rlDisableFramebuffer();
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    if (IsFileExtension(fileName, ".ktx"))
+    {
+        int mipmaps = (cubemap.mipmaps > 1)? cubemap.mipmaps : 1;
+        void *data = rlReadTextureCubemapPixels(cubemap.id, cubemap.width, cubemap.format, mipmaps);
+
+        if (data != NULL)
+        {
+            success = SaveKTXCubemap(data, cubemap.width, cubemap.format, mipmaps, fileName);
+            RL_FREE(data);
+        }
     }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+#endif
 
-    return target;
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Cubemap exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export cubemap", fileName);
+
+    return success;
 }
 
-// Unload texture from GPU memory (VRAM)
-void UnloadTexture(Texture2D texture)
+// Generate cubemap from equirectangular panorama texture, size per face
+// NOTE: Faces are rendered on GPU, all mipmaps are generated (filtered sampling of generated maps),
+// float formats (PIXELFORMAT_UNCOMPRESSED_R11G11B10F) are recommended for HDR panoramas
+TextureCubemap GenTextureCubemapFromPanorama(Texture2D panorama, int size, int format)
 {
-    if (texture.id > 0)
+    TextureCubemap cubemap = { 0 };
+
+#if defined(IBL_SHADERS_SUPPORTED)
+    if (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;   // Compressed formats can not be rendered
+
+    int mipmaps = 1;
+    while ((size >> mipmaps) > 0) mipmaps++;
+
+    cubemap.id = rlLoadTextureCubemapMipmaps(NULL, size, format, mipmaps);
+
+    if (cubemap.id > 0)
     {
-        rlUnloadTexture(texture.id);
+        cubemap.width = size;
+        cubemap.height = size;
+        cubemap.mipmaps = mipmaps;
+        cubemap.format = format;
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+        if (RenderTextureIBL(IBL_SHADER_PANORAMA, cubemap.id, size, 1, panorama)) rlGenTextureCubemapMipmaps(cubemap.id);
+        else
+        {
+            rlUnloadTexture(cubemap.id);
+            cubemap = (TextureCubemap){ 0 };
+        }
     }
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Cubemap generation from panorama requires OpenGL 3.3");
+#endif
+
+    return cubemap;
 }
 
-// Unload render texture from GPU memory (VRAM)
-void UnloadRenderTexture(RenderTexture2D target)
+// Generate irradiance cubemap from environment cubemap, diffuse lighting convolution (cosine-weighted)
+// NOTE: Samples use source cubemap mipmaps (filtered importance sampling), missing mipmaps are generated
+TextureCubemap GenTextureIrradiance(TextureCubemap cubemap, int size)
 {
-    if (target.id > 0)
+    TextureCubemap irradiance = { 0 };
+
+#if defined(IBL_SHADERS_SUPPORTED)
+    int format = ((cubemap.format > 0) && (cubemap.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))? cubemap.format : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    if (cubemap.mipmaps <= 1) rlGenTextureCubemapMipmaps(cubemap.id);
+
+    irradiance.id = rlLoadTextureCubemapMipmaps(NULL, size, format, 1);
+
+    if (irradiance.id > 0)
     {
-        // Color texture attached to FBO is deleted
-        rlUnloadTexture(target.texture.id);
+        irradiance.width = size;
+        irradiance.height = size;
+        irradiance.mipmaps = 1;
+        irradiance.format = format;
 
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
+        if (!RenderTextureIBL(IBL_SHADER_IRRADIANCE, irradiance.id, size, 1, cubemap))
+        {
+            rlUnloadTexture(irradiance.id);
+            irradiance = (TextureCubemap){ 0 };
+        }
     }
-}
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Irradiance cubemap generation requires OpenGL 3.3");
+#endif
 
-// Update GPU texture with new data
-// NOTE: pixels data must match texture.format
-void UpdateTexture(Texture2D texture, const void *pixels)
-{
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    return irradiance;
 }
 
-// Update GPU texture rectangle with new data
-// NOTE: pixels data must match texture.format
-void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+// Generate prefiltered specular cubemap from environment cubemap (GGX), roughness per mipmap level
+// NOTE: Level roughness is level/(mipmaps - 1), sample it with textureLod(prefilter, reflection, roughness*(mipmaps - 1))
+TextureCubemap GenTexturePrefilter(TextureCubemap cubemap, int size)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
-}
+    TextureCubemap prefilter = { 0 };
 
-//------------------------------------------------------------------------------------
-// Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void GenTextureMipmaps(Texture2D *texture)
-{
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+#if defined(IBL_SHADERS_SUPPORTED)
+    int format = ((cubemap.format > 0) && (cubemap.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))? cubemap.format : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    int mipmaps = 1;
+    while (((size >> mipmaps) > 0) && (mipmaps < IBL_PREFILTER_MAX_MIPMAPS)) mipmaps++;
+
+    if (cubemap.mipmaps <= 1) rlGenTextureCubemapMipmaps(cubemap.id);
+
+    prefilter.id = rlLoadTextureCubemapMipmaps(NULL, size, format, mipmaps);
+
+    if (prefilter.id > 0)
+    {
+        prefilter.width = size;
+        prefilter.height = size;
+        prefilter.mipmaps = mipmaps;
+        prefilter.format = format;
+
+        if (!RenderTextureIBL(IBL_SHADER_PREFILTER, prefilter.id, size, mipmaps, cubemap))
+        {
+            rlUnloadTexture(prefilter.id);
+            prefilter = (TextureCubemap){ 0 };
+        }
+    }
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Prefiltered cubemap generation requires OpenGL 3.3");
+#endif
+
+    return prefilter;
 }
 
-// Set texture scaling filter mode
-void SetTextureFilter(Texture2D texture, int filter)
+// Generate BRDF integration lookup texture (split-sum approximation), scale and bias to F0 stored in RG
+// NOTE: Texture is sampled with (NdotV, roughness), it does not depend on environment, generate it once
+Texture2D GenTextureBRDF(int size)
 {
-    switch (filter)
+    Texture2D brdf = { 0 };
+
+#if defined(IBL_SHADERS_SUPPORTED)
+    brdf.id = rlLoadTexture(NULL, size, size, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+
+    if (brdf.id > 0)
     {
-        case TEXTURE_FILTER_POINT:
+        brdf.width = size;
+        brdf.height = size;
+        brdf.mipmaps = 1;
+        brdf.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+        if (RenderTextureIBL(IBL_SHADER_BRDF, brdf.id, size, 1, (Texture){ 0 })) SetTextureWrap(brdf, TEXTURE_WRAP_CLAMP);
+        else
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
-
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+            rlUnloadTexture(brdf.id);
+            brdf = (Texture2D){ 0 };
+        }
+    }
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: BRDF lookup texture generation requires OpenGL 3.3");
+#endif
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+    return brdf;
+}
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate texture: radial gradient (GPU), same pattern than GenImageGradientRadial()
+// NOTE: Generated textures can be read back with LoadImageFromTexture() if required
+Texture2D GenTextureGradientRadial(int width, int height, float density, Color inner, Color outer)
+{
+    Texture2D texture = { 0 };
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    float radius = (width < height)? (float)width/2.0f : (float)height/2.0f;
+    texture = RenderTexturePattern(PATTERN_SHADER_GRADIENT_RADIAL, width, height, inner, outer, (Vector4){ density, (float)width/2.0f, (float)height/2.0f, radius });
+#endif
+    // Pattern generated on CPU if shaders are not available
+    if (texture.id == 0)
+    {
+        Image image = GenImageGradientRadial(width, height, density, inner, outer);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
     }
+
+    return texture;
 }
 
-// Set texture wrapping mode
-void SetTextureWrap(Texture2D texture, int wrap)
+// Generate texture: checked (GPU), same pattern than GenImageChecked()
+Texture2D GenTextureChecked(int width, int height, int checksX, int checksY, Color col1, Color col2)
 {
-    switch (wrap)
+    Texture2D texture = { 0 };
+
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    texture = RenderTexturePattern(PATTERN_SHADER_CHECKED, width, height, col1, col2, (Vector4){ (float)checksX, (float)checksY, 0.0f, 0.0f });
+#endif
+    if (texture.id == 0)
     {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
-        {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+        Image image = GenImageChecked(width, height, checksX, checksY, col1, col2);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
     }
-}
 
-//------------------------------------------------------------------------------------
-// Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a Texture2D
-void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
-{
-    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+    return texture;
 }
 
-// Draw a Texture2D with position defined as Vector2
-void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+// Generate texture: white noise (GPU), pattern seeded by GetRandomValue()
+Texture2D GenTextureWhiteNoise(int width, int height, float factor)
 {
-    DrawTextureEx(texture, position, 0, 1.0f, tint);
+    Texture2D texture = { 0 };
+
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    texture = RenderTexturePattern(PATTERN_SHADER_WHITE_NOISE, width, height, WHITE, BLACK, (Vector4){ factor, (float)GetRandomValue(0, 4095), 0.0f, 0.0f });
+#endif
+    if (texture.id == 0)
+    {
+        Image image = GenImageWhiteNoise(width, height, factor);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    return texture;
 }
 
-// Draw a Texture2D with extended parameters
-void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+// Generate texture: cellular algorithm (GPU), bigger tileSize means bigger cells
+// NOTE: Tiles seeds are hashed on shader (seeded by GetRandomValue()), no seeds buffer is uploaded
+Texture2D GenTextureCellular(int width, int height, int tileSize)
 {
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    Vector2 origin = { 0.0f, 0.0f };
+    Texture2D texture = { 0 };
 
-    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    texture = RenderTexturePattern(PATTERN_SHADER_CELLULAR, width, height, WHITE, BLACK, (Vector4){ (float)tileSize, (float)(width/tileSize), (float)(height/tileSize), (float)GetRandomValue(0, 4095) });
+#endif
+    if (texture.id == 0)
+    {
+        Image image = GenImageCellular(width, height, tileSize);
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+
+    return texture;
 }
 
-// Draw a part of a texture (defined by a rectangle)
-void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+// Generate texture: perlin noise (GPU), fractal sum of 6 octaves, grayscale
+// NOTE: Noise is sampled at ((x + offsetX)*scale/width, (y + offsetY)*scale/height), no CPU fallback
+Texture2D GenTexturePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
-    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    Vector2 origin = { 0.0f, 0.0f };
+    Texture2D texture = { 0 };
 
-    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    texture = RenderTexturePattern(PATTERN_SHADER_PERLIN_NOISE, width, height, WHITE, BLACK, (Vector4){ (float)offsetX, (float)offsetY, scale/(float)width, scale/(float)height });
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Perlin noise texture generation requires OpenGL 2.1, 3.3 or ES2");
+#endif
+
+    return texture;
 }
+#endif      // SUPPORT_IMAGE_GENERATION
 
-// Draw texture quad with tiling and offset parameters
-// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
-// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
-void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+RenderTexture2D LoadRenderTexture(int width, int height)
 {
-    // WARNING: This solution only works if TEXTURE_WRAP_REPEAT is supported,
-    // NPOT textures supported is required and OpenGL ES 2.0 could not support it
-    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
-    Vector2 origin = { 0.0f, 0.0f };
-
-    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
+    return LoadRenderTextureEx(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, true);
 }
 
-// Draw part of a texture (defined by a rectangle) with rotation and scale tiled into dest.
-// NOTE: For tilling a whole texture DrawTextureQuad() is better
-void DrawTextureTiled(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, float scale, Color tint)
+// Load texture for rendering (framebuffer) with color format and optional depth RenderBuffer
+// NOTE: Smaller color formats (R5G6B5, R11G11B10F) save bandwidth, compressed or not supported formats default to RGBA
+RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool useDepth)
 {
-    if ((texture.id <= 0) || (scale <= 0.0f)) return;  // Wanna see a infinite loop?!...just delete this line!
-    if ((source.width == 0) || (source.height == 0)) return;
+    RenderTexture2D target = { 0 };
 
-    int tileWidth = (int)(source.width*scale), tileHeight = (int)(source.height*scale);
-    if ((dest.width < tileWidth) && (dest.height < tileHeight))
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) || !rlIsPixelFormatSupported(format))
     {
-        // Can fit only one tile
-        DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
-                    (Rectangle){dest.x, dest.y, dest.width, dest.height}, origin, rotation, tint);
+        TRACELOG(LOG_WARNING, "FBO: Render texture format not supported (%i), using RGBA", format);
+        format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     }
-    else if (dest.width <= tileWidth)
+
+    target.id = rlLoadFramebuffer(width, height);   // Load an empty framebuffer
+
+    if (target.id > 0)
     {
-        // Tiled vertically (one column)
-        int dy = 0;
-        for (;dy+tileHeight < dest.height; dy += tileHeight)
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+
+        // Attach color texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        if (useDepth)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, source.height}, (Rectangle){dest.x, dest.y + dy, dest.width, (float)tileHeight}, origin, rotation, tint);
+            // Create depth renderbuffer/texture
+            target.depth.id = rlLoadTextureDepth(width, height, true);
+            target.depth.width = width;
+            target.depth.height = height;
+            target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+            target.depth.mipmaps = 1;
+
+            // Attach depth renderbuffer/texture to FBO
+            rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
         }
 
-        // Fit last tile
-        if (dy < dest.height)
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Load texture for rendering (framebuffer) with depth texture attachment
+// NOTE: Depth texture can be sampled by shaders (i.e. BeginLowResEffects()), it falls back to
+// depth RenderBuffer if depth textures are not supported (OpenGL ES 2.0 without extension)
+RenderTexture2D LoadRenderTextureDepthTex(int width, int height, int format)
+{
+    RenderTexture2D target = LoadRenderTextureEx(width, height, format, false);
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        target.depth.id = rlLoadTextureDepth(width, height, false);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+        target.depth.mipmaps = 1;
+
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Depth texture attached successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+
+    return target;
+}
+
+// Get transient render texture from pool, recycled on EndDrawing()
+// NOTE: Pooled render textures with same size, format and depth usage are reused between frames (contents
+// are not preserved), render textures not requested for RENDER_TEXTURE_POOL_IDLE_FRAMES frames are unloaded
+// WARNING: Returned render texture must not be unloaded with UnloadRenderTexture()
+RenderTexture2D GetRenderTextureTransient(int width, int height, int format, bool useDepth)
+{
+    PooledRenderTexture *pooled = NULL;
+
+    // Reuse an available render texture with same parameters
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        PooledRenderTexture *candidate = &renderTexturePool[i];
+
+        if ((candidate->target.id > 0) && !candidate->inUse && (candidate->target.texture.width == width) &&
+            (candidate->target.texture.height == height) && (candidate->format == format) && (candidate->useDepth == useDepth))
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                        (Rectangle){dest.x, dest.y + dy, dest.width, dest.height - dy}, origin, rotation, tint);
+            pooled = candidate;
+            break;
         }
     }
-    else if (dest.height <= tileHeight)
+
+    if (pooled == NULL)
     {
-        // Tiled horizontally (one row)
-        int dx = 0;
-        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        // Use a free slot, or unload the least recently used available render texture
+        for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)dest.height/tileHeight)*source.height}, (Rectangle){dest.x + dx, dest.y, (float)tileWidth, dest.height}, origin, rotation, tint);
+            PooledRenderTexture *candidate = &renderTexturePool[i];
+
+            if (candidate->target.id == 0) { pooled = candidate; break; }
+            if (!candidate->inUse && ((pooled == NULL) || (candidate->lastUsedFrame < pooled->lastUsedFrame))) pooled = candidate;
         }
 
-        // Fit last tile
-        if (dx < dest.width)
+        if (pooled == NULL)
         {
-            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
-                        (Rectangle){dest.x + dx, dest.y, dest.width - dx, dest.height}, origin, rotation, tint);
+            TRACELOG(LOG_WARNING, "FBO: Maximum number of transient render textures reached (%i)", MAX_RENDER_TEXTURE_POOL);
+            return (RenderTexture2D){ 0 };
         }
+
+        if (pooled->target.id > 0) UnloadRenderTexture(pooled->target);
+
+        pooled->target = LoadRenderTextureEx(width, height, format, useDepth);
+        pooled->format = format;
+        pooled->useDepth = useDepth;
     }
-    else
+
+    pooled->inUse = (pooled->target.id > 0);
+    pooled->lastUsedFrame = renderTexturePoolFrame;
+
+    return pooled->target;
+}
+
+// Release transient render texture to pool before EndDrawing(), it can be reused in current frame
+void ReleaseRenderTextureTransient(RenderTexture2D target)
+{
+    if (target.id == 0) return;
+
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
     {
-        // Tiled both horizontally and vertically (rows and columns)
-        int dx = 0;
-        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        if (renderTexturePool[i].target.id == target.id)
         {
-            int dy = 0;
-            for (;dy+tileHeight < dest.height; dy += tileHeight)
-            {
-                DrawTexturePro(texture, source, (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, (float)tileHeight}, origin, rotation, tint);
-            }
-
-            if (dy < dest.height)
-            {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                    (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, dest.height - dy}, origin, rotation, tint);
-            }
+            renderTexturePool[i].inUse = false;
+            break;
         }
+    }
+}
 
-        // Fit last column of tiles
-        if (dx < dest.width)
-        {
-            int dy = 0;
-            for (;dy+tileHeight < dest.height; dy += tileHeight)
-            {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, source.height},
-                        (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, (float)tileHeight}, origin, rotation, tint);
-            }
+// Recycle transient render textures, unload idle ones (called by EndDrawing())
+void UpdateRenderTexturePool(void)
+{
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        PooledRenderTexture *pooled = &renderTexturePool[i];
+        if (pooled->target.id == 0) continue;
 
-            // Draw final tile in the bottom right corner
-            if (dy < dest.height)
-            {
-                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
-                    (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, dest.height - dy}, origin, rotation, tint);
-            }
+        pooled->inUse = false;
+
+        if ((renderTexturePoolFrame - pooled->lastUsedFrame) >= RENDER_TEXTURE_POOL_IDLE_FRAMES)
+        {
+            UnloadRenderTexture(pooled->target);
+            memset(pooled, 0, sizeof(PooledRenderTexture));
         }
     }
+
+    renderTexturePoolFrame++;
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Unload all pooled render textures (called by CloseWindow())
+void UnloadRenderTexturePool(void)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        if (renderTexturePool[i].target.id > 0) UnloadRenderTexture(renderTexturePool[i].target);
+    }
 
-        bool flipX = false;
+    memset(renderTexturePool, 0, sizeof(renderTexturePool));
+    renderTexturePoolFrame = 0;
+}
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+// Unload tiled texture shader and reset tracked wrap modes (called by CloseWindow())
+void UnloadTextureTiledShader(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (tiledShader.id > 0) UnloadShader(tiledShader);
 
-        Vector2 topLeft = { 0 };
-        Vector2 topRight = { 0 };
-        Vector2 bottomLeft = { 0 };
-        Vector2 bottomRight = { 0 };
+    tiledShader = (Shader){ 0 };
+    tiledShaderLoaded = false;
+#endif
+    textureWrapOverridesCount = 0;
+}
 
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
-        {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (Vector2){ x, y };
-            topRight = (Vector2){ x + dest.width, y };
-            bottomLeft = (Vector2){ x, y + dest.height };
-            bottomRight = (Vector2){ x + dest.width, y + dest.height };
-        }
-        else
-        {
-            float sinRotation = sinf(rotation*DEG2RAD);
-            float cosRotation = cosf(rotation*DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
+// Unload instanced sprites shader and quad buffers (called by CloseWindow())
+void UnloadSpriteInstancesShader(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (spritesShader.id > 0)
+    {
+        UnloadShader(spritesShader);
+        rlUnloadVertexArray(spritesVaoId);
+        rlUnloadVertexBuffer(spritesQuadVboId);
+    }
 
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+    spritesShader = (Shader){ 0 };
+    spritesShaderLoaded = false;
+    spritesVaoId = 0;
+    spritesQuadVboId = 0;
+#endif
+}
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+// Unload image-based lighting generation shaders (called by CloseWindow())
+void UnloadTextureUploadBuffer(void)
+{
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE) && defined(SUPPORT_ASYNC_LOADING)
+    if (textureUpload.id > 0) rlUnloadUploadBuffer(textureUpload.id);
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+    textureUpload.id = 0;
+    textureUpload.data = NULL;
+    textureUpload.loaded = false;
+    memset(textureUpload.slotsUsed, 0, sizeof(textureUpload.slotsUsed));
+#endif
+}
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
-        }
+void UnloadTextureIBLShaders(void)
+{
+#if defined(IBL_SHADERS_SUPPORTED)
+    for (int i = 0; i < 4; i++)
+    {
+        if (iblShaders[i].id > 0) UnloadShader(iblShaders[i]);
+    }
 
-        rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
+    memset(iblShaders, 0, sizeof(iblShaders));
+    iblShadersLoaded = false;
+#endif
+}
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+// Unload video YUV to RGB conversion shader (called by CloseWindow())
+void UnloadVideoStreamShader(void)
+{
+#if defined(VIDEO_SHADER_SUPPORTED)
+    if (videoShader.id > 0) UnloadShader(videoShader);
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    videoShader = (Shader){ 0 };
+    videoShaderLoaded = false;
+#endif
+}
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+// Unload reduced resolution effects shaders (called by CloseWindow())
+void UnloadLowResEffectsShaders(void)
+{
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+    for (int i = 0; i < 2; i++)
+    {
+        if (lowResShaders[i].id > 0) UnloadShader(lowResShaders[i]);
+    }
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+    memset(lowResShaders, 0, sizeof(lowResShaders));
+    lowResShadersLoaded = false;
+#endif
+}
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+// Unload procedural pattern shaders (called by CloseWindow())
+void UnloadTexturePatternShaders(void)
+{
+#if defined(PATTERN_SHADERS_SUPPORTED)
+    for (int i = 0; i < PATTERN_SHADERS; i++)
+    {
+        if (patternShaders[i].id > 0) UnloadShader(patternShaders[i]);
+    }
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    memset(patternShaders, 0, sizeof(patternShaders));
+    patternShadersLoaded = false;
+#endif
+}
 
-        rlEnd();
-        rlSetTexture(0);
+// Load post-processing chain, scene is drawn at width x height
+// NOTE: Render textures are requested from transient pool every frame, no GPU memory is owned by the chain
+PostProcess LoadPostProcess(int width, int height)
+{
+    PostProcess postProcess = { 0 };
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than just calculating
-        // the vertex positions manually, like done above.
-        // I leave here the old implementation for educational pourposes,
-        // just in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+#if defined(SUPPORT_POST_PROCESSING)
+    postProcess.width = width;
+    postProcess.height = height;
+    postProcess.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    postProcess.effects = (PostEffect *)RL_CALLOC(MAX_POST_EFFECTS, sizeof(PostEffect));
+#endif
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    return postProcess;
+}
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+// Unload post-processing chain
+// NOTE: Fused color effects shaders are unloaded, shader passes are owned by user
+void UnloadPostProcess(PostProcess *postProcess)
+{
+    if (postProcess->effects == NULL) return;
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+    for (int i = 0; i < postProcess->effectCount; i++)
+    {
+        PostEffect *effect = &postProcess->effects[i];
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+        if (effect->code != NULL)
+        {
+            if (effect->shader.id > 0) UnloadShader(effect->shader);
+            RL_FREE(effect->code);
+        }
+    }
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+    RL_FREE(postProcess->effects);
+    *postProcess = (PostProcess){ 0 };
+}
+
+// Add shader pass to post-processing chain, drawn at resolution scale (i.e. 0.5f for bloom or blur)
+// NOTE: Previous pass result is available as 'texture0' and scene as 'texture1' (if used by shader)
+int AddPostEffect(PostProcess *postProcess, Shader shader, float scale)
+{
+    if ((postProcess->effects == NULL) || (postProcess->effectCount >= MAX_POST_EFFECTS))
+    {
+        TRACELOG(LOG_WARNING, "POSTFX: Failed to add effect, maximum effects reached (%i)", MAX_POST_EFFECTS);
+        return -1;
     }
+
+    PostEffect *effect = &postProcess->effects[postProcess->effectCount];
+    *effect = (PostEffect){ 0 };
+    effect->shader = shader;
+    effect->paramsLoc = -1;
+    effect->scale = (scale > 0.0f)? scale : 1.0f;
+
+    return postProcess->effectCount++;
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+// Add per-pixel color effect to post-processing chain
+// NOTE: GLSL code modifies 'vec4 color', it can read 'vec2 uv' and 'vec4 params', adjacent color effects
+// are fused into one generated shader, drawn at previous pass resolution
+int AddPostColorEffect(PostProcess *postProcess, const char *code, Vector4 params)
 {
-    if (texture.id > 0)
+    if ((postProcess->effects == NULL) || (postProcess->effectCount >= MAX_POST_EFFECTS) || (code == NULL))
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        TRACELOG(LOG_WARNING, "POSTFX: Failed to add color effect");
+        return -1;
+    }
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+    PostEffect *effect = &postProcess->effects[postProcess->effectCount];
+    *effect = (PostEffect){ 0 };
+    effect->code = (char *)RL_MALLOC(strlen(code) + 1);
+    strcpy(effect->code, code);
+    effect->params = params;
+    effect->paramsLoc = -1;
+    effect->scale = 0.0f;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+    postProcess->dirty = true;
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+    return postProcess->effectCount++;
+}
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+// Set post-processing color effect parameters
+void SetPostEffectParams(PostProcess *postProcess, int index, Vector4 params)
+{
+    if ((index >= 0) && (index < postProcess->effectCount)) postProcess->effects[index].params = params;
+}
+
+// Begin drawing scene to post-processing chain
+// WARNING: Can not be nested with BeginTextureMode(), chain is drawn to screen
+void BeginPostProcess(PostProcess *postProcess)
+{
+    postProcess->target.id = 0;
+
+#if defined(SUPPORT_POST_PROCESSING)
+    if (postProcess->effects == NULL) return;
+
+    // NOTE: On failure, scene is drawn directly to screen
+    postProcess->target = GetRenderTextureTransient(postProcess->width, postProcess->height, postProcess->format, true);
+    if (postProcess->target.id == 0) return;
+
+    BeginTextureMode(postProcess->target);
+#endif
+}
+
+// End drawing scene and draw post-processing chain to screen
+// NOTE: Every pass is drawn to a pooled render texture (ping-pong), its input is released back to pool and
+// invalidated (contents not stored back to memory on tiled GPUs), last pass is drawn to screen
+void EndPostProcess(PostProcess *postProcess)
+{
+#if defined(SUPPORT_POST_PROCESSING)
+    if (postProcess->target.id == 0) return;
+
+    EndTextureMode();
+
+    // Scene depth is not read again
+    rlInvalidateFramebuffer(postProcess->target.id, false, true);
+
+    if (postProcess->dirty) LoadPostEffectsShaders(postProcess);
+
+    RenderTexture2D scene = postProcess->target;
+    RenderTexture2D input = scene;
+    int index = 0;
+
+    // Passes replace render textures content (no blending)
+    rlDisableColorBlend();
+
+    while (true)
+    {
+        PostEffect *effect = (index < postProcess->effectCount)? &postProcess->effects[index] : NULL;
+        int next = index + 1;
+        int width = input.texture.width;
+        int height = input.texture.height;
+
+        if (effect != NULL)
         {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            if (effect->code != NULL) { while ((next < postProcess->effectCount) && (postProcess->effects[next].code != NULL)) next++; }
+            else
+            {
+                width = (int)(postProcess->width*effect->scale);
+                height = (int)(postProcess->height*effect->scale);
+                if (width < 1) width = 1;
+                if (height < 1) height = 1;
+            }
         }
 
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        RenderTexture2D output = { 0 };
+        bool last = (next >= postProcess->effectCount);
+
+        if (!last)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            output = GetRenderTextureTransient(width, height, postProcess->format, false);
+
+            // NOTE: On failure, current pass is drawn to screen and remaining passes are skipped
+            if (output.id > 0)
+            {
+                SetTextureFilter(output.texture, TEXTURE_FILTER_BILINEAR);
+                BeginTextureMode(output);
+            }
+            else last = true;
         }
 
-        Vector2 vertA, vertB, vertC, vertD;
-        vertA.x = 0.0f;                             // outer left
-        vertA.y = 0.0f;                             // outer top
-        vertB.x = leftBorder;                       // inner left
-        vertB.y = topBorder;                        // inner top
-        vertC.x = patchWidth  - rightBorder;        // inner right
-        vertC.y = patchHeight - bottomBorder;       // inner bottom
-        vertD.x = patchWidth;                       // outer right
-        vertD.y = patchHeight;                      // outer bottom
+        Rectangle dest = { 0.0f, 0.0f, (float)width, (float)height };
+        if (last) dest = (Rectangle){ 0.0f, 0.0f, (float)GetRenderWidth(), (float)GetRenderHeight() };
 
-        Vector2 coordA, coordB, coordC, coordD;
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+        // NOTE: Color effects which failed to load are drawn with default shader (skipped)
+        bool useShader = (effect != NULL) && (effect->shader.id > 0);
 
-        rlCheckRenderBatchLimit(9 * 3 * 2);         // Maxium number of verts that could happen
+        if (useShader)
+        {
+            BeginShaderMode(effect->shader);
 
-        rlSetTexture(texture.id);
+            if (effect->code != NULL)
+            {
+                Vector4 params[MAX_POST_EFFECTS] = { 0 };
+                for (int i = index; i < next; i++) params[i - index] = postProcess->effects[i].params;
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+                SetShaderValueV(effect->shader, effect->paramsLoc, params, SHADER_UNIFORM_VEC4, next - index);
+            }
+            else if (effect->shader.locs[SHADER_LOC_MAP_SPECULAR] != -1) SetShaderValueTexture(effect->shader, effect->shader.locs[SHADER_LOC_MAP_SPECULAR], scene.texture);
+        }
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+        DrawTexturePro(input.texture, (Rectangle){ 0, 0, (float)input.texture.width, (float)-input.texture.height }, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
-                    {
+        if (useShader) EndShaderMode();
+        else rlDrawRenderBatchActive();
+
+        if (output.id > 0) EndTextureMode();
+
+        // Intermediate pass result is not read again, render texture can be reused by next pass
+        if (input.id != scene.id)
+        {
+            rlInvalidateFramebuffer(input.id, true, false);
+            ReleaseRenderTextureTransient(input);
+        }
+
+        if (last) break;
+
+        input = output;
+        index = next;
+    }
+
+    rlEnableColorBlend();
+
+    rlInvalidateFramebuffer(scene.id, true, false);
+    ReleaseRenderTextureTransient(scene);
+    postProcess->target.id = 0;
+#endif
+}
+
+// Begin drawing blended effects at reduced resolution, downscale 2 (half) or 4 (quarter resolution)
+// NOTE: Current matrices are kept (i.e. inside BeginMode3D()), effects are drawn with alpha blending and without depth
+// writes; scene depth texture must match current render target size, it is downsampled to effects target depth
+// buffer for depth testing and used by particles to fade over LOWRES_EFFECTS_SOFT_DISTANCE (soft particles)
+// WARNING: Can not be nested, effects are drawn directly to current render target if not supported (OpenGL 3.3 required)
+void BeginLowResEffects(int downscale, Texture2D sceneDepth)
+{
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+    if (lowResEffects.active)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Reduced resolution effects already active");
+        return;
+    }
+
+    if (!lowResShadersLoaded) LoadShadersLowResEffects();
+    if ((lowResShaders[0].id == 0) || (lowResShaders[1].id == 0)) return;
+
+    int width = rlGetFramebufferWidth();
+    int height = rlGetFramebufferHeight();
+
+    if ((sceneDepth.id > 0) && ((sceneDepth.width != width) || (sceneDepth.height != height)))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Scene depth size (%ix%i) does not match render target size (%ix%i), effects not depth tested", sceneDepth.width, sceneDepth.height, width, height);
+        sceneDepth.id = 0;
+    }
+
+    downscale = (downscale >= 4)? 4 : 2;
+    int targetWidth = (width + downscale - 1)/downscale;
+    int targetHeight = (height + downscale - 1)/downscale;
+
+    rlDrawRenderBatchActive();
+
+    // NOTE: On failure, effects are drawn directly to current render target
+    RenderTexture2D target = GetRenderTextureTransient(targetWidth, targetHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, (sceneDepth.id > 0));
+    if (target.id == 0) return;
+
+    lowResEffects.downscale = downscale;
+    lowResEffects.width = width;
+    lowResEffects.height = height;
+    lowResEffects.framebuffer = rlGetActiveFramebuffer();
+    lowResEffects.sceneDepth = sceneDepth;
+    lowResEffects.target = target;
+    lowResEffects.active = true;
+
+    rlEnableFramebuffer(target.id);
+    rlViewport(0, 0, targetWidth, targetHeight);
+    rlSetFramebufferWidth(targetWidth);
+    rlSetFramebufferHeight(targetHeight);
+
+    rlClearColor(0, 0, 0, 0);
+    rlClearScreenBuffers();
+
+    if (sceneDepth.id > 0)
+    {
+        // Downsample scene depth: one scene depth sample per target pixel, same sample used by composite upsample
+        // NOTE: Depth buffer is only written with depth test enabled, effects are depth tested after
+        rlEnableDepthTest();
+        rlEnableDepthMask();
+        SetShaderValue(lowResShaders[0], lowResShaderLocs[0], &downscale, SHADER_UNIFORM_INT);
+        DrawLowResEffectsQuad(lowResShaders[0], sceneDepth.id, 0);
+    }
+
+    // Effects color is accumulated premultiplied, alpha accumulated as coverage
+    rlDisableDepthMask();
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    rlSetBlendMode(RL_BLEND_CUSTOM_SEPARATE);
+#endif
+}
+
+// End drawing blended effects and composite them to current render target
+// NOTE: Every render target pixel blends the 4 nearest effects pixels, weighted by distance and by depth similarity
+// with scene depth (bilateral upsample), avoids effects bleeding over foreground edges
+void EndLowResEffects(void)
+{
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+    if (!lowResEffects.active) return;
+
+    rlDrawRenderBatchActive();
+    rlSetBlendMode(RL_BLEND_ALPHA_PREMUL);
+
+    // Effects depth is not read again
+    if (lowResEffects.sceneDepth.id > 0) rlInvalidateFramebuffer(lowResEffects.target.id, false, true);
+
+    if (lowResEffects.framebuffer > 0) rlEnableFramebuffer(lowResEffects.framebuffer);
+    else rlDisableFramebuffer();
+    rlViewport(0, 0, lowResEffects.width, lowResEffects.height);
+    rlSetFramebufferWidth(lowResEffects.width);
+    rlSetFramebufferHeight(lowResEffects.height);
+
+    float params[4] = { (float)lowResEffects.downscale, (float)RL_CULL_DISTANCE_NEAR, (float)RL_CULL_DISTANCE_FAR, (lowResEffects.sceneDepth.id > 0)? 1.0f : 0.0f };
+    SetShaderValue(lowResShaders[1], lowResShaderLocs[1], params, SHADER_UNIFORM_VEC4);
+    DrawLowResEffectsQuad(lowResShaders[1], lowResEffects.target.texture.id, lowResEffects.sceneDepth.id);
+
+    rlSetBlendMode(RL_BLEND_ALPHA);
+    rlEnableDepthMask();
+
+    rlInvalidateFramebuffer(lowResEffects.target.id, true, false);
+    ReleaseRenderTextureTransient(lowResEffects.target);
+    lowResEffects.active = false;
+#endif
+}
+
+// Get soft depth test parameters for particles drawn to reduced resolution effects (called by DrawParticleSystem())
+// NOTE: Parameters: inverse effects target size (x, y), inverse soft distance (z), returns false if not depth tested
+bool GetLowResEffectsSoftDepth(unsigned int *depthId, float *params)
+{
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+    if (lowResEffects.active && (lowResEffects.sceneDepth.id > 0))
+    {
+        *depthId = lowResEffects.sceneDepth.id;
+        params[0] = 1.0f/(float)lowResEffects.target.texture.width;
+        params[1] = 1.0f/(float)lowResEffects.target.texture.height;
+        params[2] = 1.0f/LOWRES_EFFECTS_SOFT_DISTANCE;
+        params[3] = 0.0f;
+
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Unload texture from GPU memory (VRAM)
+void UnloadTexture(Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+#if defined(SUPPORT_RESOURCE_CACHE)
+        // NOTE: Cached texture is unloaded with its last reference
+        if (ReleaseCachedResource(RESOURCE_TEXTURE, texture.id) > 0) return;
+#endif
+#if defined(SUPPORT_TEXTURE_STREAMING)
+        RemoveStreamedTexture(texture.id);
+#endif
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+        UnwatchAsset(ASSET_WATCH_TEXTURE, texture.id, NULL);
+#endif
+        SetTextureWrapOverride(texture.id, true);   // Texture id could be reused
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Unload texture array or 3D texture from GPU memory (VRAM)
+void UnloadTextureArray(TextureArray texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture array data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Unload render texture from GPU memory (VRAM)
+void UnloadRenderTexture(RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        // Color texture attached to FBO is deleted
+        rlUnloadTexture(target.texture.id);
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture with new data
+// NOTE: pixels data must match texture.format
+void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE: pixels data must match texture.format
+void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle at position with image view pixels
+// NOTE: View format must match texture.format, view rows are uploaded in place
+void UpdateTextureFromView(Texture2D texture, Vector2 position, ImageView view)
+{
+    if (view.format != texture.format)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update from view, pixel formats do not match", texture.id);
+        return;
+    }
+
+    rlUpdateTextureStride(texture.id, (int)position.x, (int)position.y, view.width, view.height, view.format, view.data, view.stride);
+}
+
+// Update texture array layer (or 3D texture slice) with image data
+// NOTE: Image is converted to texture format if required, size must match
+void UpdateTextureArrayLayer(TextureArray texture, int layer, Image image)
+{
+    if ((image.data == NULL) || (image.width != texture.width) || (image.height != texture.height))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update layer %i, image size does not match", texture.id, layer);
+        return;
+    }
+
+    if (image.format == texture.format) rlUpdateTextureLayer(texture.id, layer, 0, 0, image.width, image.height, image.format, image.data);
+    else
+    {
+        Image copy = ImageCopy(image);
+        ImageFormat(&copy, texture.format);
+        rlUpdateTextureLayer(texture.id, layer, 0, 0, copy.width, copy.height, copy.format, copy.data);
+        UnloadImage(copy);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void GenTextureMipmaps(Texture2D *texture)
+{
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Generate GPU mipmaps for a texture array (every layer) or 3D texture
+void GenTextureArrayMipmaps(TextureArray *texture)
+{
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+}
+
+// Set texture scaling filter mode
+void SetTextureFilter(Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void SetTextureWrap(Texture2D texture, int wrap)
+{
+    SetTextureWrapOverride(texture.id, (wrap == TEXTURE_WRAP_REPEAT));
+
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Texture streaming functions
+//------------------------------------------------------------------------------------
+// Load texture for mipmaps streaming, only smallest mipmaps are loaded in GPU
+// NOTE: Requires DDS/KTX compressed data with mipmaps and OpenGL 3.3 (mipmap levels range),
+// any other texture is loaded with all its mipmaps, as LoadTexture()
+Texture2D LoadTextureStreamed(const char *fileName)
+{
+    Texture2D texture = { 0 };
+
+#if defined(SUPPORT_TEXTURE_STREAMING) && defined(GRAPHICS_API_OPENGL_33)
+    Image image = { 0 };
+    unsigned int dataOffset = 0;    // First mipmap level data offset in file
+    bool levelPrefix = false;       // Mipmap levels data prefixed by its size (KTX)
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    if (IsFileExtension(fileName, ".dds"))
+    {
+        unsigned int fileSize = 0;
+        const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+
+        if (fileData != NULL) image = LoadDDS(fileData, fileSize);
+        dataOffset = 4 + 124;       // DDS identifier and header size
+
+        UnloadFileDataView(fileData);
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_KTX)
+    if (IsFileExtension(fileName, ".ktx"))
+    {
+        unsigned int fileSize = 0;
+        const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+
+        if (fileData != NULL) image = LoadKTX(fileData, fileSize);
+        if (image.data != NULL) dataOffset = 64 + ((unsigned int *)fileData)[15];  // KTX header size and key-value data size
+        levelPrefix = true;
+
+        UnloadFileDataView(fileData);
+    }
+#endif
+
+    StreamedTexture *stream = NULL;
+    for (int i = 0; i < MAX_STREAMED_TEXTURES; i++) if (streamedTextures[i].id == 0) { stream = &streamedTextures[i]; break; }
+
+    if ((image.data == NULL) || (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) || (image.mipmaps <= 1) ||
+        (image.mipmaps > TEXTURE_STREAMING_MAX_LEVELS) || (stream == NULL))
+    {
+        // Texture can not be streamed, all mipmaps are loaded
+        if (image.data != NULL) texture = LoadTextureFromImage(image);
+        else texture = LoadTexture(fileName);
+
+        UnloadImage(image);
+
+        return texture;
+    }
+
+    memset(stream, 0, sizeof(StreamedTexture));
+    strncpy(stream->fileName, fileName, sizeof(stream->fileName) - 1);
+    stream->width = image.width;
+    stream->height = image.height;
+    stream->format = image.format;
+    stream->mipmaps = image.mipmaps;
+    stream->tailLevel = -1;
+
+    // Get mipmap levels data offsets, image data contains the same levels without prefixes
+    unsigned int levelDataOffsets[TEXTURE_STREAMING_MAX_LEVELS] = { 0 };
+    unsigned int fileOffset = dataOffset;
+    unsigned int imageOffset = 0;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        int size = GetStreamedMipmapSize(stream, i);
+        int maxSize = ((image.width > image.height)? image.width : image.height) >> i;
+
+        if (levelPrefix) fileOffset += sizeof(unsigned int);
+
+        stream->levelOffsets[i] = fileOffset;
+        levelDataOffsets[i] = imageOffset;
+
+        fileOffset += levelPrefix? ((size + 3) & ~3) : size;
+        imageOffset += size;
+
+        if ((stream->tailLevel == -1) && (maxSize <= TEXTURE_STREAMING_RESIDENT_SIZE)) stream->tailLevel = i;
+    }
+
+    if (stream->tailLevel == -1) stream->tailLevel = image.mipmaps - 1;
+
+    // Texture storage is allocated by levels, only smallest mipmaps are uploaded
+    texture.id = rlLoadTexture(NULL, image.width, image.height, image.format, 0);
+
+    if (texture.id != 0)
+    {
+        for (int i = image.mipmaps - 1; i >= stream->tailLevel; i--)
+        {
+            int width = (image.width >> i) > 0? (image.width >> i) : 1;
+            int height = (image.height >> i) > 0? (image.height >> i) : 1;
+
+            rlUpdateTextureMipmap(texture.id, i, width, height, image.format, (unsigned char *)image.data + levelDataOffsets[i]);
+            textureStreamingMemory += GetStreamedMipmapSize(stream, i);
+        }
+
+        rlTextureParameters(texture.id, RL_TEXTURE_MAX_LEVEL, image.mipmaps - 1);
+        rlTextureParameters(texture.id, RL_TEXTURE_BASE_LEVEL, stream->tailLevel);
+        rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+        rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+        stream->id = texture.id;
+        stream->residentLevel = stream->tailLevel;
+        stream->requestedLevel = stream->tailLevel;
+        streamedTexturesCount++;
+
+        texture.width = image.width;
+        texture.height = image.height;
+        texture.mipmaps = image.mipmaps;
+        texture.format = image.format;
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture streamed successfully (%ix%i | %i mipmaps | %i resident)", texture.id, texture.width, texture.height, texture.mipmaps, texture.mipmaps - stream->tailLevel);
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to load streamed texture", fileName);
+
+    UnloadImage(image);
+#else
+    texture = LoadTexture(fileName);
+#endif
+
+    return texture;
+}
+
+// Check if a texture mipmaps are streamed
+bool IsTextureStreamed(Texture2D texture)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    return (FindStreamedTexture(texture.id) != NULL);
+#else
+    return false;
+#endif
+}
+
+// Set streamed texture usage for current frame, size on screen in pixels (largest dimension)
+// NOTE: Required mipmap level is the smallest level still bigger than its size on screen,
+// texture is kept with the highest resolution required by all its usages in the frame
+void SetTextureStreamingUsage(Texture2D texture, float screenSize)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    StreamedTexture *stream = FindStreamedTexture(texture.id);
+    if (stream == NULL) return;
+
+    int level = 0;
+    float size = (float)((stream->width > stream->height)? stream->width : stream->height);
+
+    while ((level < stream->tailLevel) && ((size*0.5f) >= screenSize))
+    {
+        size *= 0.5f;
+        level++;
+    }
+
+    if ((stream->lastUsedFrame != textureStreamingFrame) || (level < stream->requestedLevel)) stream->requestedLevel = level;
+    stream->lastUsedFrame = textureStreamingFrame;
+#endif
+}
+
+// Set VRAM budget for streamed textures mipmaps (in bytes)
+// NOTE: Always resident mipmaps are not evicted, budget could be exceeded by them
+void SetTextureStreamingBudget(int bytes)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    textureStreamingBudget = bytes;
+#endif
+}
+
+// Get VRAM used by streamed textures mipmaps (in bytes)
+int GetTextureStreamingMemory(void)
+{
+#if defined(SUPPORT_TEXTURE_STREAMING)
+    return textureStreamingMemory;
+#else
+    return 0;
+#endif
+}
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Update streamed textures mipmaps for frame usage (called by EndDrawing())
+// NOTE: Next mipmap level is requested for textures used this frame (furthest from required level first),
+// mipmaps of least recently used textures are evicted to fit the VRAM budget
+void UpdateTextureStreaming(void)
+{
+    if (streamedTexturesCount == 0) return;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    // Release finished mipmap loads, failed loads return their reserved budget
+    for (int i = 0; i < MAX_STREAMED_TEXTURES; i++)
+    {
+        StreamedTexture *stream = &streamedTextures[i];
+        if ((stream->id == 0) || (stream->pendingJob == 0)) continue;
+
+        int state = GetAsyncLoadState(stream->pendingJob);
+        if (state == ASYNC_LOAD_PENDING) continue;
+
+        if (state != ASYNC_LOAD_READY)
+        {
+            textureStreamingMemory -= stream->pendingSize;
+            stream->streamLevel = stream->residentLevel;
+        }
+
+        ReleaseAsyncJob(stream->pendingJob);
+        stream->pendingJob = 0;
+        stream->pendingSize = 0;
+    }
+#endif
+
+    FitTextureStreamingBudget(0);
+
+    for (int r = 0; r < TEXTURE_STREAMING_MAX_REQUESTS; r++)
+    {
+        StreamedTexture *request = NULL;
+
+        for (int i = 0; i < MAX_STREAMED_TEXTURES; i++)
+        {
+            StreamedTexture *stream = &streamedTextures[i];
+
+            if ((stream->id == 0) || (stream->pendingJob != 0) || (stream->lastUsedFrame != textureStreamingFrame) ||
+                (stream->requestedLevel >= stream->residentLevel) || (stream->residentLevel <= stream->streamLevel)) continue;
+
+            if ((request == NULL) || ((stream->residentLevel - stream->requestedLevel) > (request->residentLevel - request->requestedLevel))) request = stream;
+        }
+
+        if (request == NULL) break;
+
+        int level = request->residentLevel - 1;
+
+        if (!FitTextureStreamingBudget(GetStreamedMipmapSize(request, level))) break;
+        if (!LoadStreamedMipmap(request, level)) break;
+    }
+
+    textureStreamingFrame++;
+}
+
+// Unload textures streaming data (called by CloseWindow())
+// NOTE: Async loads are already released by CloseAsyncJobs()
+void UnloadTextureStreaming(void)
+{
+    memset(streamedTextures, 0, sizeof(streamedTextures));
+    streamedTexturesCount = 0;
+    textureStreamingMemory = 0;
+}
+#endif
+
+//------------------------------------------------------------------------------------
+// Animated texture functions
+//------------------------------------------------------------------------------------
+// Load animated texture, first frame is decoded and uploaded, next frames are decoded on playback
+// NOTE: Only GIF files are animated, any other image is loaded as a single frame texture
+TextureAnim LoadTextureAnim(const char *fileName)
+{
+    TextureAnim anim = { 0 };
+
+#if defined(TEXTURE_ANIM_SUPPORTED)
+    if (IsFileExtension(fileName, ".gif"))
+    {
+        unsigned int fileSize = 0;
+        const unsigned char *fileData = LoadFileDataView(fileName, &fileSize);
+        int frameCount = (fileData != NULL)? GetGIFFrameCount(fileData, fileSize) : 0;
+
+        if (frameCount > 1)
+        {
+            rTextureAnimStream *stream = (rTextureAnimStream *)RL_CALLOC(1, sizeof(rTextureAnimStream));
+            stream->fileData = fileData;
+            stream->fileSize = fileSize;
+            ResetTextureAnimDecoder(stream);
+
+            int delay = 0;
+            unsigned char *frame = DecodeTextureAnimFrame(stream, &delay);
+
+            if (frame != NULL)
+            {
+                stream->width = stream->gif.w;
+                stream->height = stream->gif.h;
+                stream->frames = (unsigned char *)RL_MALLOC(TEXTURE_ANIM_FRAMES*stream->width*stream->height*4);
+                memcpy(stream->frames, frame, stream->width*stream->height*4);
+                stream->frameDelay[0] = delay;
+                stream->decodedCount = 1;
+
+                anim.texture.id = rlLoadTexture(frame, stream->width, stream->height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+                anim.texture.width = stream->width;
+                anim.texture.height = stream->height;
+                anim.texture.mipmaps = 1;
+                anim.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+
+            if (anim.texture.id != 0)
+            {
+                anim.frameCount = frameCount;
+                anim.stream = stream;
+
+                // Next frames are decoded ahead of playback
+                SubmitJob(DecodeTextureAnimJob, stream, NULL, &stream->decodeJob);
+
+                TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Animated texture loaded successfully (%ix%i | %i frames)", anim.texture.id, anim.texture.width, anim.texture.height, frameCount);
+
+                return anim;
+            }
+
+            // Animation could not be decoded, loaded as a single frame texture
+            STBI_FREE(stream->gif.out);
+            STBI_FREE(stream->gif.history);
+            STBI_FREE(stream->gif.background);
+            RL_FREE(stream->previous[0]);
+            RL_FREE(stream->previous[1]);
+            RL_FREE(stream->frames);
+            RL_FREE(stream);
+        }
+
+        UnloadFileDataView(fileData);
+    }
+#endif
+
+    anim.texture = LoadTexture(fileName);
+    anim.frameCount = (anim.texture.id != 0)? 1 : 0;
+
+    return anim;
+}
+
+// Unload animated texture, pending frames decoding is finished first
+void UnloadTextureAnim(TextureAnim anim)
+{
+#if defined(TEXTURE_ANIM_SUPPORTED)
+    rTextureAnimStream *stream = anim.stream;
+
+    if (stream != NULL)
+    {
+        WaitJobCounter(&stream->decodeJob);
+
+        STBI_FREE(stream->gif.out);
+        STBI_FREE(stream->gif.history);
+        STBI_FREE(stream->gif.background);
+        RL_FREE(stream->previous[0]);
+        RL_FREE(stream->previous[1]);
+        RL_FREE(stream->frames);
+        UnloadFileDataView(stream->fileData);
+        RL_FREE(stream);
+    }
+#endif
+
+    UnloadTexture(anim.texture);
+}
+
+// Update animated texture playback by time (in seconds), only a new current frame is uploaded to texture
+// NOTE: Playback waits (current frame is kept) while next frame decoding is pending, it never blocks
+void UpdateTextureAnim(TextureAnim *anim, float deltaTime)
+{
+#if defined(TEXTURE_ANIM_SUPPORTED)
+    rTextureAnimStream *stream = anim->stream;
+    if (stream == NULL) return;
+
+    stream->frameTime += deltaTime;
+
+    if (!IsJobCounterDone(&stream->decodeJob)) return;
+
+    // Advance playback over decoded frames, frames skipped by time are not uploaded
+    while ((stream->playSequence < stream->decodedCount) &&
+           (stream->frameTime >= (float)stream->frameDelay[stream->playSequence%TEXTURE_ANIM_FRAMES]/1000.0f))
+    {
+        if ((stream->playSequence + 1) >= stream->decodedCount)
+        {
+            // Next frame not decoded yet, current frame time is kept until it is
+            stream->frameTime = (float)stream->frameDelay[stream->playSequence%TEXTURE_ANIM_FRAMES]/1000.0f;
+            break;
+        }
+
+        stream->frameTime -= (float)stream->frameDelay[stream->playSequence%TEXTURE_ANIM_FRAMES]/1000.0f;
+        stream->playSequence++;
+    }
+
+    if (stream->uploadedSequence != stream->playSequence)
+    {
+        unsigned char *frame = stream->frames + (stream->playSequence%TEXTURE_ANIM_FRAMES)*stream->width*stream->height*4;
+
+        rlUpdateTexture(anim->texture.id, 0, 0, stream->width, stream->height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, frame);
+        stream->uploadedSequence = stream->playSequence;
+    }
+
+    anim->currentFrame = stream->playSequence%anim->frameCount;
+
+    // Frames consumed by playback are decoded again ahead
+    if (!stream->failed && ((stream->decodedCount - stream->playSequence) < TEXTURE_ANIM_FRAMES))
+    {
+        SubmitJob(DecodeTextureAnimJob, stream, NULL, &stream->decodeJob);
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------------
+// Video playback functions
+//------------------------------------------------------------------------------------
+// Load video stream from file, first frames are decoded and first one uploaded
+// NOTE: Only Y4M (YUV4MPEG2, 4:2:0) files are decoded, no audio, use LoadVideoStreamFromDecoder() for other formats
+VideoStream LoadVideoStream(const char *fileName)
+{
+    VideoStream video = { 0 };
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    VideoDecoder decoder = { 0 };
+
+    if (IsFileExtension(fileName, ".y4m") && LoadY4MDecoder(fileName, &decoder))
+    {
+        video = LoadVideoStreamFromDecoder(decoder);
+    }
+    else TRACELOG(LOG_WARNING, "VIDEO: [%s] File format not supported", fileName);
+#endif
+
+    return video;
+}
+
+// Load video stream from custom decoder, first frames are decoded and first one uploaded
+// NOTE: Decoder is closed on unload (or on load failure)
+VideoStream LoadVideoStreamFromDecoder(VideoDecoder decoder)
+{
+    VideoStream video = { 0 };
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    if ((decoder.decodeFrame == NULL) || (decoder.width <= 0) || (decoder.height <= 0) || (decoder.frameRate <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: Video decoder not valid");
+        if (decoder.close != NULL) decoder.close(decoder.userData);
+
+        return video;
+    }
+
+    rVideoStream *stream = (rVideoStream *)RL_CALLOC(1, sizeof(rVideoStream));
+    stream->decoder = decoder;
+    stream->chromaWidth = (decoder.width + 1)/2;
+    stream->chromaHeight = (decoder.height + 1)/2;
+    stream->frameSize = decoder.width*decoder.height + 2*stream->chromaWidth*stream->chromaHeight;
+#if defined(VIDEO_SHADER_SUPPORTED)
+    stream->slotSize = stream->frameSize;
+#else
+    stream->slotSize = decoder.width*decoder.height*4;
+    stream->convert = (unsigned char *)RL_MALLOC(stream->frameSize);
+#endif
+    stream->frames = (unsigned char *)RL_MALLOC(VIDEO_STREAM_FRAMES*stream->slotSize);
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if ((decoder.decodeAudio != NULL) && (decoder.sampleRate > 0) && (decoder.channels > 0))
+    {
+        stream->maxAudioFrames = (int)((float)decoder.sampleRate/decoder.frameRate) + 2;
+        stream->audioSamples = (float *)RL_MALLOC(VIDEO_STREAM_FRAMES*stream->maxAudioFrames*decoder.channels*sizeof(float));
+        stream->audioCapacity = VIDEO_STREAM_AUDIO_BUFFER*2 + (VIDEO_STREAM_FRAMES + 1)*stream->maxAudioFrames;
+        stream->audioQueue = (float *)RL_MALLOC(stream->audioCapacity*decoder.channels*sizeof(float));
+
+        // NOTE: Audio is pushed in VIDEO_STREAM_AUDIO_BUFFER frames, stream buffers must have that size
+        SetAudioStreamBufferSizeDefault(VIDEO_STREAM_AUDIO_BUFFER);
+        video.audio = LoadAudioStream(decoder.sampleRate, 32, decoder.channels);
+        SetAudioStreamBufferSizeDefault(0);
+    }
+#endif
+
+    // Frames ring is filled on loading, first frame is uploaded
+    DecodeVideoStreamJob(stream);
+
+    if (stream->decodedCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: Failed to decode first video frame");
+#if defined(SUPPORT_MODULE_RAUDIO)
+        UnloadAudioStream(video.audio);
+#endif
+        UnloadVideoStreamData(stream);
+
+        return (VideoStream){ 0 };
+    }
+
+#if defined(VIDEO_SHADER_SUPPORTED)
+    int planeWidth[3] = { decoder.width, stream->chromaWidth, stream->chromaWidth };
+    int planeHeight[3] = { decoder.height, stream->chromaHeight, stream->chromaHeight };
+    unsigned char *plane = stream->frames;
+
+    for (int i = 0; i < 3; i++)
+    {
+        video.planes[i].id = rlLoadTexture(plane, planeWidth[i], planeHeight[i], PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, 1);
+        video.planes[i].width = planeWidth[i];
+        video.planes[i].height = planeHeight[i];
+        video.planes[i].mipmaps = 1;
+        video.planes[i].format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+        plane += planeWidth[i]*planeHeight[i];
+
+        // NOTE: Chroma planes are upsampled by bilinear filtering
+        if (i > 0)
+        {
+            rlTextureParameters(video.planes[i].id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            rlTextureParameters(video.planes[i].id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+        }
+    }
+#else
+    video.planes[0].id = rlLoadTexture(stream->frames, decoder.width, decoder.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    video.planes[0].width = decoder.width;
+    video.planes[0].height = decoder.height;
+    video.planes[0].mipmaps = 1;
+    video.planes[0].format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+#endif
+
+    QueueVideoStreamAudio(stream, 0);
+
+    video.frameRate = decoder.frameRate;
+    video.frameCount = decoder.frameCount;
+    video.stream = stream;
+
+    TRACELOG(LOG_INFO, "VIDEO: Video stream loaded successfully (%ix%i | %.2f fps | %s)", decoder.width, decoder.height, decoder.frameRate, (video.audio.buffer != NULL)? "audio" : "no audio");
+#endif
+
+    return video;
+}
+
+// Unload video stream, textures, audio stream and decoder, pending frames decoding is finished first
+void UnloadVideoStream(VideoStream video)
+{
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    if (video.stream != NULL)
+    {
+        WaitJobCounter(&video.stream->decodeJob);
+        UnloadVideoStreamData(video.stream);
+    }
+
+    for (int i = 0; i < 3; i++) if (video.planes[i].id > 0) rlUnloadTexture(video.planes[i].id);
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (video.audio.buffer != NULL) UnloadAudioStream(video.audio);
+#endif
+#endif
+}
+
+// Start video playback
+void PlayVideoStream(VideoStream video)
+{
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    if (video.stream == NULL) return;
+
+    video.stream->playing = true;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (video.audio.buffer != NULL)
+    {
+        if (IsAudioStreamPlaying(video.audio)) ResumeAudioStream(video.audio);
+        else PlayAudioStream(video.audio);
+    }
+#endif
+#endif
+}
+
+// Pause video playback
+void PauseVideoStream(VideoStream video)
+{
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    if (video.stream == NULL) return;
+
+    video.stream->playing = false;
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (video.audio.buffer != NULL) PauseAudioStream(video.audio);
+#endif
+#endif
+}
+
+// Check if video is playing, false once last frame has been played (if not looping)
+bool IsVideoStreamPlaying(VideoStream video)
+{
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    return ((video.stream != NULL) && video.stream->playing);
+#else
+    return false;
+#endif
+}
+
+// Update video playback by time (in seconds), new current frame is uploaded and its audio pushed to audio stream
+// NOTE: Playback waits (current frame is kept) while next frame decoding is pending, it never blocks
+void UpdateVideoStream(VideoStream *video, float deltaTime)
+{
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+    rVideoStream *stream = video->stream;
+    if ((stream == NULL) || !stream->playing) return;
+
+    stream->time += deltaTime;
+
+    if (IsJobCounterDone(&stream->decodeJob))
+    {
+        // Advance playback over decoded frames, frames skipped by time are not uploaded (audio is queued)
+        while (((stream->playSequence + 1) < stream->decodedCount) && (stream->time >= (double)(stream->playSequence + 1)/stream->decoder.frameRate))
+        {
+            stream->playSequence++;
+            QueueVideoStreamAudio(stream, stream->playSequence);
+        }
+
+        double nextTime = (double)(stream->playSequence + 1)/stream->decoder.frameRate;
+
+        if (stream->time >= nextTime)
+        {
+            if (stream->ended && ((stream->playSequence + 1) >= stream->decodedCount)) stream->playing = false;    // Last frame played
+            else stream->time = nextTime;   // Next frame not decoded yet, playback waits for it
+        }
+
+        if (stream->uploadedSequence != stream->playSequence)
+        {
+            unsigned char *frame = stream->frames + (stream->playSequence%VIDEO_STREAM_FRAMES)*stream->slotSize;
+
+#if defined(VIDEO_SHADER_SUPPORTED)
+            for (int i = 0; i < 3; i++)
+            {
+                rlUpdateTexture(video->planes[i].id, 0, 0, video->planes[i].width, video->planes[i].height, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, frame);
+                frame += video->planes[i].width*video->planes[i].height;
+            }
+#else
+            rlUpdateTexture(video->planes[0].id, 0, 0, video->planes[0].width, video->planes[0].height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, frame);
+#endif
+            stream->uploadedSequence = stream->playSequence;
+        }
+
+        video->currentFrame = stream->frameIndex[stream->playSequence%VIDEO_STREAM_FRAMES];
+
+        // Frames consumed by playback are decoded again ahead
+        if (!stream->ended && ((stream->decodedCount - stream->playSequence) < VIDEO_STREAM_FRAMES))
+        {
+            stream->looping = video->looping;
+            SubmitJob(DecodeVideoStreamJob, stream, NULL, &stream->decodeJob);
+        }
+    }
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    // Queued audio is pushed to audio stream buffers as they are processed
+    int channels = (int)stream->decoder.channels;
+
+    while ((stream->audioQueued >= VIDEO_STREAM_AUDIO_BUFFER) && IsAudioStreamProcessed(video->audio))
+    {
+        UpdateAudioStream(video->audio, stream->audioQueue, VIDEO_STREAM_AUDIO_BUFFER);
+
+        stream->audioQueued -= VIDEO_STREAM_AUDIO_BUFFER;
+        memmove(stream->audioQueue, stream->audioQueue + VIDEO_STREAM_AUDIO_BUFFER*channels, stream->audioQueued*channels*sizeof(float));
+    }
+#endif
+#endif
+}
+
+// Draw video current frame in destination rectangle
+// NOTE: YUV planes are converted to RGB (BT.601 limited range) by built-in shader, batch is flushed
+void DrawVideoStream(VideoStream video, Rectangle dest, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)video.planes[0].width, (float)video.planes[0].height };
+
+#if defined(VIDEO_SHADER_SUPPORTED)
+    if (!videoShaderLoaded) LoadVideoStreamShader();
+
+    if (videoShader.id > 0)
+    {
+        BeginShaderMode(videoShader);
+            SetShaderValueTexture(videoShader, videoShaderLocs[0], video.planes[1]);
+            SetShaderValueTexture(videoShader, videoShaderLocs[1], video.planes[2]);
+            DrawTexturePro(video.planes[0], source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+        EndShaderMode();
+
+        return;
+    }
+#endif
+
+    DrawTexturePro(video.planes[0], source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+}
+
+//------------------------------------------------------------------------------------
+// Sprite atlas functions
+//------------------------------------------------------------------------------------
+// Generate sprite atlas pages images, sprites are packed with skyline algorithm (same as GenImageFontAtlas())
+// NOTE: Sprites are surrounded by padding filled with replicated border pixels (no bleeding on filtering) and
+// packed rectangles are aligned to SPRITE_ATLAS_ALIGNMENT, sprites not fitting in current page go to a new page,
+// pages are R8G8B8A8 images shrunk to the smallest power-of-two size containing their sprites
+Image *GenImageSpriteAtlas(const Image *images, int count, int pageSize, int padding, Rectangle *recs, int *pages, int *pageCount)
+{
+    Image *atlas = NULL;
+    *pageCount = 0;
+
+#if defined(SUPPORT_SPRITE_ATLAS)
+    if ((images == NULL) || (count <= 0)) return atlas;
+
+    if (pageSize <= 0) pageSize = SPRITE_ATLAS_PAGE_SIZE;
+    if (padding < 0) padding = 0;
+
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(count*sizeof(stbrp_rect));
+    stbrp_node *nodes = (stbrp_node *)RL_MALLOC(pageSize*sizeof(stbrp_node));
+    int pendingCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        recs[i] = (Rectangle){ 0 };
+        pages[i] = -1;
+
+        if ((images[i].data == NULL) || (images[i].width <= 0) || (images[i].height <= 0)) continue;
+
+        if (images[i].format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Sprite atlas does not support compressed images, sprite %i not packed", i);
+            continue;
+        }
+
+        int width = (images[i].width + 2*padding + SPRITE_ATLAS_ALIGNMENT - 1)/SPRITE_ATLAS_ALIGNMENT*SPRITE_ATLAS_ALIGNMENT;
+        int height = (images[i].height + 2*padding + SPRITE_ATLAS_ALIGNMENT - 1)/SPRITE_ATLAS_ALIGNMENT*SPRITE_ATLAS_ALIGNMENT;
+
+        if ((width > pageSize) || (height > pageSize))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Sprite %i (%i x %i) does not fit in atlas page (%i x %i)", i, images[i].width, images[i].height, pageSize, pageSize);
+            continue;
+        }
+
+        rects[pendingCount] = (stbrp_rect){ 0 };
+        rects[pendingCount].id = i;
+        rects[pendingCount].w = width;
+        rects[pendingCount].h = height;
+        pendingCount++;
+    }
+
+    while (pendingCount > 0)
+    {
+        stbrp_context context = { 0 };
+        stbrp_init_target(&context, pageSize, pageSize, nodes, pageSize);
+        stbrp_pack_rects(&context, rects, pendingCount);
+
+        int page = *pageCount;
+        int usedWidth = 0;
+        int usedHeight = 0;
+        int remainingCount = 0;
+
+        // Store packed sprites, not packed rectangles are kept for next page
+        for (int k = 0; k < pendingCount; k++)
+        {
+            stbrp_rect rect = rects[k];
+
+            if (rect.was_packed)
+            {
+                pages[rect.id] = page;
+                recs[rect.id] = (Rectangle){ (float)(rect.x + padding), (float)(rect.y + padding), (float)images[rect.id].width, (float)images[rect.id].height };
+
+                if (rect.x + rect.w > usedWidth) usedWidth = rect.x + rect.w;
+                if (rect.y + rect.h > usedHeight) usedHeight = rect.y + rect.h;
+            }
+            else rects[remainingCount++] = rect;
+        }
+
+        if (remainingCount == pendingCount) break;      // No progress, should not happen (sizes already checked)
+
+        Image image = { 0 };
+        image.width = 1;
+        image.height = 1;
+        while (image.width < usedWidth) image.width *= 2;
+        while (image.height < usedHeight) image.height *= 2;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image.data = RL_CALLOC(image.width*image.height, sizeof(Color));
+
+        // Copy sprites pixels, padding is filled by clamping to sprite borders
+        for (int i = 0; i < count; i++)
+        {
+            if (pages[i] != page) continue;
+
+            Color *pixels = LoadImageColors(images[i]);
+            Color *data = (Color *)image.data;
+            int width = images[i].width;
+            int height = images[i].height;
+            int offsetX = (int)recs[i].x;
+            int offsetY = (int)recs[i].y;
+
+            for (int y = -padding; y < height + padding; y++)
+            {
+                int sy = (y < 0)? 0 : ((y >= height)? height - 1 : y);
+
+                for (int x = -padding; x < width + padding; x++)
+                {
+                    int sx = (x < 0)? 0 : ((x >= width)? width - 1 : x);
+                    data[(offsetY + y)*image.width + offsetX + x] = pixels[sy*width + sx];
+                }
+            }
+
+            UnloadImageColors(pixels);
+        }
+
+        atlas = (Image *)RL_REALLOC(atlas, (page + 1)*sizeof(Image));
+        atlas[page] = image;
+        (*pageCount)++;
+
+        pendingCount = remainingCount;
+    }
+
+    RL_FREE(nodes);
+    RL_FREE(rects);
+#endif
+
+    return atlas;
+}
+
+// Load sprite atlas from images, pages are uploaded to GPU
+// NOTE: Source images are not modified, they can be unloaded once the atlas is loaded
+SpriteAtlas LoadSpriteAtlas(const Image *images, int count, int pageSize, int padding)
+{
+    SpriteAtlas atlas = { 0 };
+
+    if ((images == NULL) || (count <= 0)) return atlas;
+
+    Rectangle *recs = (Rectangle *)RL_MALLOC(count*sizeof(Rectangle));
+    int *pages = (int *)RL_MALLOC(count*sizeof(int));
+    Image *pageImages = GenImageSpriteAtlas(images, count, pageSize, padding, recs, pages, &atlas.pageCount);
+
+    atlas.pages = (Texture2D *)RL_CALLOC((atlas.pageCount > 0)? atlas.pageCount : 1, sizeof(Texture2D));
+    for (int i = 0; i < atlas.pageCount; i++) atlas.pages[i] = LoadTextureFromImage(pageImages[i]);
+
+    atlas.spriteCount = count;
+    atlas.sprites = (SpriteRef *)RL_CALLOC(count, sizeof(SpriteRef));
+
+    for (int i = 0; i < count; i++)
+    {
+        if (pages[i] >= 0) atlas.sprites[i] = (SpriteRef){ atlas.pages[pages[i]], recs[i] };
+    }
+
+    TRACELOG(LOG_INFO, "IMAGE: Sprite atlas loaded successfully (%i sprites, %i pages)", count, atlas.pageCount);
+
+    UnloadImages(pageImages, atlas.pageCount);
+    RL_FREE(pages);
+    RL_FREE(recs);
+
+    return atlas;
+}
+
+// Load sprite atlas from image files, images are decoded in parallel
+// NOTE: Files failing to load keep an empty sprite reference
+SpriteAtlas LoadSpriteAtlasFromFiles(const char **fileNames, int count, int pageSize, int padding)
+{
+    SpriteAtlas atlas = { 0 };
+
+    Image *images = LoadImagesParallel(fileNames, count);
+
+    if (images != NULL)
+    {
+        atlas = LoadSpriteAtlas(images, count, pageSize, padding);
+        UnloadImages(images, count);
+    }
+
+    return atlas;
+}
+
+// Unload sprite atlas pages (VRAM) and sprites references
+void UnloadSpriteAtlas(SpriteAtlas atlas)
+{
+    for (int i = 0; i < atlas.pageCount; i++) UnloadTexture(atlas.pages[i]);
+
+    RL_FREE(atlas.pages);
+    RL_FREE(atlas.sprites);
+}
+
+//------------------------------------------------------------------------------------
+// Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a Texture2D
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    DrawTextureEx(texture, (Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a Texture2D with position defined as Vector2
+void DrawTextureV(Texture2D texture, Vector2 position, Color tint)
+{
+    DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a Texture2D with extended parameters
+void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint)
+{
+    Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw texture quad with tiling and offset parameters
+// NOTE: Tiling and offset should be provided considering normalized texture values [0..1]
+// i.e tiling = { 1.0f, 1.0f } refers to all texture, offset = { 0.5f, 0.5f } moves texture origin to center
+void DrawTextureQuad(Texture2D texture, Vector2 tiling, Vector2 offset, Rectangle quad, Color tint)
+{
+    // WARNING: This solution only works if TEXTURE_WRAP_REPEAT is supported,
+    // NPOT textures supported is required and OpenGL ES 2.0 could not support it
+    Rectangle source = { offset.x*texture.width, offset.y*texture.height, tiling.x*texture.width, tiling.y*texture.height };
+    Vector2 origin = { 0.0f, 0.0f };
+
+    DrawTexturePro(texture, source, quad, origin, 0.0f, tint);
+}
+
+// Draw part of a texture (defined by a rectangle) with rotation and scale tiled into dest.
+// NOTE: Not rotated tiles are drawn as one quad: whole textures known to use TEXTURE_WRAP_REPEAT are wrapped by
+// sampler (keeps batching), big tiled areas of texture parts are wrapped by a built-in shader (OpenGL 3.3 and ES2),
+// rotated or flipped tiles are drawn one quad per tile
+void DrawTextureTiled(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, float scale, Color tint)
+{
+    if ((texture.id <= 0) || (scale <= 0.0f)) return;  // Wanna see a infinite loop?!...just delete this line!
+    if ((source.width == 0) || (source.height == 0)) return;
+
+    if ((rotation == 0.0f) && (source.width > 0) && (source.height > 0))
+    {
+        // Whole texture with repeat wrap mode: one quad, texcoords scaled to tiles count
+        if ((source.x == 0.0f) && (source.y == 0.0f) && (source.width == (float)texture.width) && (source.height == (float)texture.height) && IsTextureWrapRepeat(texture))
+        {
+            DrawTexturePro(texture, (Rectangle){ 0.0f, 0.0f, dest.width/scale, dest.height/scale }, dest, origin, 0.0f, tint);
+            return;
+        }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        // Texture part: one quad wrapped inside source rectangle by shader, only worth it for many tiles (batch is flushed)
+        float tiles = ceilf(dest.width/(source.width*scale))*ceilf(dest.height/(source.height*scale));
+        if ((tiles >= TEXTURE_TILED_SHADER_MIN_TILES) && DrawTextureTiledShader(texture, source, dest, origin, scale, tint)) return;
+#endif
+    }
+
+    int tileWidth = (int)(source.width*scale), tileHeight = (int)(source.height*scale);
+    if ((dest.width < tileWidth) && (dest.height < tileHeight))
+    {
+        // Can fit only one tile
+        DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
+                    (Rectangle){dest.x, dest.y, dest.width, dest.height}, origin, rotation, tint);
+    }
+    else if (dest.width <= tileWidth)
+    {
+        // Tiled vertically (one column)
+        int dy = 0;
+        for (;dy+tileHeight < dest.height; dy += tileHeight)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, source.height}, (Rectangle){dest.x, dest.y + dy, dest.width, (float)tileHeight}, origin, rotation, tint);
+        }
+
+        // Fit last tile
+        if (dy < dest.height)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)dest.width/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                        (Rectangle){dest.x, dest.y + dy, dest.width, dest.height - dy}, origin, rotation, tint);
+        }
+    }
+    else if (dest.height <= tileHeight)
+    {
+        // Tiled horizontally (one row)
+        int dx = 0;
+        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)dest.height/tileHeight)*source.height}, (Rectangle){dest.x + dx, dest.y, (float)tileWidth, dest.height}, origin, rotation, tint);
+        }
+
+        // Fit last tile
+        if (dx < dest.width)
+        {
+            DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)dest.height/tileHeight)*source.height},
+                        (Rectangle){dest.x + dx, dest.y, dest.width - dx, dest.height}, origin, rotation, tint);
+        }
+    }
+    else
+    {
+        // Tiled both horizontally and vertically (rows and columns)
+        int dx = 0;
+        for (;dx+tileWidth < dest.width; dx += tileWidth)
+        {
+            int dy = 0;
+            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            {
+                DrawTexturePro(texture, source, (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, (float)tileHeight}, origin, rotation, tint);
+            }
+
+            if (dy < dest.height)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                    (Rectangle){dest.x + dx, dest.y + dy, (float)tileWidth, dest.height - dy}, origin, rotation, tint);
+            }
+        }
+
+        // Fit last column of tiles
+        if (dx < dest.width)
+        {
+            int dy = 0;
+            for (;dy+tileHeight < dest.height; dy += tileHeight)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, source.height},
+                        (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, (float)tileHeight}, origin, rotation, tint);
+            }
+
+            // Draw final tile in the bottom right corner
+            if (dy < dest.height)
+            {
+                DrawTexturePro(texture, (Rectangle){source.x, source.y, ((float)(dest.width - dx)/tileWidth)*source.width, ((float)(dest.height - dy)/tileHeight)*source.height},
+                    (Rectangle){dest.x + dx, dest.y + dy, dest.width - dx, dest.height - dy}, origin, rotation, tint);
+            }
+        }
+    }
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+        if (streamedTexturesCount > 0) SetTextureStreamingUsage(texture, fmaxf(width*fabsf(dest.width/source.width), height*fabsf(dest.height/source.height)));
+#endif
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        Vector2 topLeft = { 0 };
+        Vector2 topRight = { 0 };
+        Vector2 bottomLeft = { 0 };
+        Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (Vector2){ x, y };
+            topRight = (Vector2){ x + dest.width, y };
+            bottomLeft = (Vector2){ x, y + dest.height };
+            bottomRight = (Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*DEG2RAD);
+            float cosRotation = cosf(rotation*DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlCheckRenderBatchLimit(4);     // Make sure there is enough free space on the batch buffer
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            float left = (flipX? (source.x + source.width) : source.x)/width;
+            float right = (flipX? source.x : (source.x + source.width))/width;
+            float top = source.y/height;
+            float bottom = (source.y + source.height)/height;
+
+            // Quad corners for texture and quad: top-left, bottom-left, bottom-right, top-right
+            const float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+            const float vertices[8] = { topLeft.x, topLeft.y, bottomLeft.x, bottomLeft.y, bottomRight.x, bottomRight.y, topRight.x, topRight.y };
+            rlTexCoordVertex2fv(texcoords, vertices, 4);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than just calculating
+        // the vertex positions manually, like done above.
+        // I leave here the old implementation for educational pourposes,
+        // just in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        Vector2 vertA, vertB, vertC, vertD;
+        vertA.x = 0.0f;                             // outer left
+        vertA.y = 0.0f;                             // outer top
+        vertB.x = leftBorder;                       // inner left
+        vertB.y = topBorder;                        // inner top
+        vertC.x = patchWidth  - rightBorder;        // inner right
+        vertC.y = patchHeight - bottomBorder;       // inner bottom
+        vertD.x = patchWidth;                       // outer right
+        vertD.y = patchHeight;                      // outer bottom
+
+        Vector2 coordA, coordB, coordC, coordD;
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlCheckRenderBatchLimit(9 * 3 * 2);         // Maxium number of verts that could happen
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
                         // ------------------------------------------------------------
                         // MIDDLE-LEFT QUAD
                         rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
@@ -3536,1320 +6616,5230 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
                         rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
                         if (drawCenter)
                         {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlSetTexture(0);
+    }
+}
+
+// Draw textured polygon, defined by vertex and texturecoordinates
+// NOTE: Polygon center must have straight line path to all points
+// without crossing perimeter, points must be in anticlockwise order
+void DrawTexturePoly(Texture2D texture, Vector2 center, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint)
+{
+    rlCheckRenderBatchLimit((pointCount - 1)*4);
+
+    rlSetTexture(texture.id);
+
+    // Texturing is only supported on QUADs
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        for (int i = 0; i < pointCount - 1; i++)
+        {
+            rlTexCoord2f(0.5f, 0.5f);
+            rlVertex2f(center.x, center.y);
+
+            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
+            rlVertex2f(points[i].x + center.x, points[i].y + center.y);
+
+            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
+            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+
+            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
+            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+        }
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Draw a sprite (atlas page part)
+void DrawSprite(SpriteRef sprite, Vector2 position, Color tint)
+{
+    DrawTextureRec(sprite.texture, sprite.source, position, tint);
+}
+
+// Draw a sprite with extended parameters
+void DrawSpriteEx(SpriteRef sprite, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle dest = { position.x, position.y, sprite.source.width*scale, sprite.source.height*scale };
+
+    DrawTexturePro(sprite.texture, sprite.source, dest, (Vector2){ 0.0f, 0.0f }, rotation, tint);
+}
+
+// Draw a sprite with 'pro' parameters
+void DrawSpritePro(SpriteRef sprite, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    DrawTexturePro(sprite.texture, sprite.source, dest, origin, rotation, tint);
+}
+
+// Draw sprites sharing one texture
+// NOTE: Big batches are uploaded as is (32 bytes per sprite) and expanded on GPU (instanced quads, rotation
+// and texcoords computed by shader), small ones (or OpenGL 1.1) are expanded on CPU directly into rlgl batch
+void DrawSpriteInstances(Texture2D texture, const SpriteInstance *sprites, int count)
+{
+    if ((sprites == NULL) || (count <= 0)) return;
+
+    float width = (texture.width > 0)? (float)texture.width : 1.0f;
+    float height = (texture.height > 0)? (float)texture.height : 1.0f;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((count >= SPRITE_INSTANCING_MIN_COUNT) && rlIsInstancingSupported() && !rlIsCommandListRecording())
+    {
+        if (!spritesShaderLoaded) LoadShaderSprites();
+
+        if (spritesShader.id > 0)
+        {
+            rlDrawRenderBatchActive();      // Draw pending batch before instanced sprites (keep drawing order)
+
+            int offset = 0;
+            unsigned int bufferId = rlUpdateInstanceStream(sprites, count*sizeof(SpriteInstance), &offset);
+
+            Vector2 texelSize = { 1.0f/width, 1.0f/height };
+            int textureSlot = 0;
+
+            rlEnableShader(spritesShader.id);
+            rlSetUniformMatrix(spritesShader.locs[SHADER_LOC_MATRIX_MODEL], rlGetMatrixTransform());
+            rlSetUniformMatrix(spritesShader.locs[SHADER_LOC_MATRIX_VIEW], rlGetMatrixModelview());
+            rlSetUniformMatrix(spritesShader.locs[SHADER_LOC_MATRIX_PROJECTION], rlGetMatrixProjection());
+            rlSetUniform(spritesShaderLocs[0], &texelSize, SHADER_UNIFORM_VEC2, 1);
+            rlSetUniform(spritesShader.locs[SHADER_LOC_MAP_DIFFUSE], &textureSlot, SHADER_UNIFORM_INT, 1);
+
+            rlActiveTextureSlot(0);
+            rlEnableTexture((texture.id > 0)? texture.id : rlGetTextureIdDefault());
+
+            // NOTE: Attributes are set on every draw, instance data offset changes on every upload
+            // and vertex array objects could not be supported (OpenGL ES 2.0)
+            rlEnableVertexArray(spritesVaoId);
+            rlEnableVertexBuffer(spritesQuadVboId);
+            rlEnableVertexAttribute(spritesShader.locs[SHADER_LOC_VERTEX_POSITION]);
+            rlSetVertexAttribute(spritesShader.locs[SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, 0, 0, 0);
+
+            rlEnableVertexBuffer(bufferId);
+            rlSetVertexAttribute(spritesShaderLocs[1], 4, RL_FLOAT, 0, sizeof(SpriteInstance), (void *)(size_t)offset);
+            rlSetVertexAttribute(spritesShaderLocs[2], 1, RL_FLOAT, 0, sizeof(SpriteInstance), (void *)(size_t)(offset + 4*sizeof(float)));
+            rlSetVertexAttribute(spritesShaderLocs[3], 4, RL_UNSIGNED_SHORT, 0, sizeof(SpriteInstance), (void *)(size_t)(offset + 5*sizeof(float)));
+            rlSetVertexAttribute(spritesShaderLocs[4], 4, RL_UNSIGNED_BYTE, 1, sizeof(SpriteInstance), (void *)(size_t)(offset + 5*sizeof(float) + 4*sizeof(unsigned short)));
+            for (int i = 1; i < 5; i++)
+            {
+                rlEnableVertexAttribute(spritesShaderLocs[i]);
+                rlSetVertexAttributeDivisor(spritesShaderLocs[i], 1);
+            }
+
+            rlDrawVertexArrayInstanced(0, 6, count);
+
+            for (int i = 1; i < 5; i++)
+            {
+                rlSetVertexAttributeDivisor(spritesShaderLocs[i], 0);
+                rlDisableVertexAttribute(spritesShaderLocs[i]);
+            }
+            rlDisableVertexAttribute(spritesShader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+            rlDisableVertexBuffer();
+            rlDisableVertexArray();
+            rlDisableTexture();
+            rlDisableShader();
+
+            return;
+        }
+    }
+#endif
+
+    rlSetTexture(texture.id);
+
+    for (int i = 0; i < count; i++)
+    {
+        const SpriteInstance *sprite = &sprites[i];
+        float angle = sprite->rotation*DEG2RAD;
+        float cosRotation = cosf(angle);
+        float sinRotation = sinf(angle);
+        float halfWidth = fabsf(sprite->size.x)*0.5f;
+        float halfHeight = fabsf(sprite->size.y)*0.5f;
+
+        // Quad half axes, rotated around sprite center
+        float rx = cosRotation*halfWidth, ry = sinRotation*halfWidth;
+        float ux = -sinRotation*halfHeight, uy = cosRotation*halfHeight;
+        float x = sprite->position.x, y = sprite->position.y;
+
+        float u0 = sprite->source[0]/width;
+        float v0 = sprite->source[1]/height;
+        float u1 = (sprite->source[0] + sprite->source[2])/width;
+        float v1 = (sprite->source[1] + sprite->source[3])/height;
+
+        if (sprite->size.x < 0.0f) { float u = u0; u0 = u1; u1 = u; }
+        if (sprite->size.y < 0.0f) { float v = v0; v0 = v1; v1 = v; }
+
+        rlCheckRenderBatchLimit(4);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(sprite->tint.r, sprite->tint.g, sprite->tint.b, sprite->tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            rlTexCoord2f(u0, v0);
+            rlVertex2f(x - rx - ux, y - ry - uy);
+            rlTexCoord2f(u0, v1);
+            rlVertex2f(x - rx + ux, y - ry + uy);
+            rlTexCoord2f(u1, v1);
+            rlVertex2f(x + rx + ux, y + ry + uy);
+            rlTexCoord2f(u1, v0);
+            rlVertex2f(x + rx - ux, y + ry - uy);
+        rlEnd();
+    }
+
+    rlSetTexture(0);
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color Fade(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Get hexadecimal value for a Color
+int ColorToInt(Color color)
+{
+    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+}
+
+// Get color normalized as float [0..1]
+Vector4 ColorNormalize(Color color)
+{
+    Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+Color ColorFromNormalized(Vector4 normalized)
+{
+    Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a Color
+// NOTE: Hue is returned as degrees [0..360]
+Vector3 ColorToHSV(Color color)
+{
+    Vector3 hsv = { 0 };
+    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min, max, delta;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Get a Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+Color ColorFromHSV(float hue, float saturation, float value)
+{
+    Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+Color ColorAlpha(Color color, float alpha)
+{
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+}
+
+// Get src alpha-blended into dst color with tint
+Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        Vector4 fdst = ColorNormalize(dst);
+        Vector4 fsrc = ColorNormalize(src);
+        Vector4 ftint = ColorNormalize(tint);
+        Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get a Color struct from hexadecimal value
+Color GetColor(unsigned int hexValue)
+{
+    Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
+    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
+    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
+    color.a = (unsigned char)hexValue & 0xFF;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+Color GetPixelColor(void *srcPtr, int format)
+{
+    Color color = { 0 };
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
+            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
+            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
+            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
+            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
+            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = 255;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: Pixel normalized float value is converted to [0..255]
+            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
+            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
+            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
+            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
+        {
+            // NOTE: Pixel float value is clamped and converted to [0..255]
+            Vector3 coln = UnpackR11G11B10F(((unsigned int *)srcPtr)[0]);
+
+            color.r = (unsigned char)(fminf(coln.x, 1.0f)*255.0f);
+            color.g = (unsigned char)(fminf(coln.y, 1.0f)*255.0f);
+            color.b = (unsigned char)(fminf(coln.z, 1.0f)*255.0f);
+            color.a = 255;
+
+        } break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void SetPixelColor(void *dstPtr, Color color, int format)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            // NOTE: Calculate grayscale equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+
+            ((unsigned char *)dstPtr)[0] = gray;
+            ((unsigned char *)dstPtr)[1] = color.a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            // NOTE: Calculate R5G6B5 equivalent color
+            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*63.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*31.0f));
+            unsigned char g = (unsigned char)(round(coln.y*31.0f));
+            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Calculate R5G5B5A1 equivalent color
+            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+            unsigned char r = (unsigned char)(round(coln.x*15.0f));
+            unsigned char g = (unsigned char)(round(coln.y*15.0f));
+            unsigned char b = (unsigned char)(round(coln.z*15.0f));
+            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+        {
+            ((unsigned char *)dstPtr)[0] = color.r;
+            ((unsigned char *)dstPtr)[1] = color.g;
+            ((unsigned char *)dstPtr)[2] = color.b;
+            ((unsigned char *)dstPtr)[3] = color.a;
+
+        } break;
+        default: break;
+    }
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for Image or Texture data
+int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R11G11B10F: bpp = 32; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    dataSize = width*height*bpp/8;  // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks, partial blocks
+    // at the borders (and textures smaller than a block) take a full block
+    if (((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) ||
+        (format == PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+    else if (format == PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) dataSize = ((width + 7)/8)*((height + 7)/8)*16;
+    else if ((width < 4) && (height < 4) && (format >= PIXELFORMAT_COMPRESSED_PVRT_RGB)) dataSize = 16;
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+// Texture async load decode stage: load image (worker thread)
+static bool DecodeTextureJob(void *data)
+{
+    TextureLoadJob *job = (TextureLoadJob *)data;
+
+    job->image = LoadImage(job->fileName);
+
+    if (job->image.data == NULL) return false;
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+    // Image data is moved to upload buffer if it fits in a free slot
+    job->uploadSlot = WriteTextureUploadSlot(job->image, &job->uploadSize);
+
+    if (job->uploadSlot != -1)
+    {
+        RL_FREE(job->image.data);
+        job->image.data = NULL;
+    }
+#endif
+
+    return true;
+}
+
+// Texture async load upload stage: load texture from image (main thread)
+// NOTE: Upload buffer transfers run within frame transfers budget, stage runs again until transfer is finished
+static bool UploadTextureJob(void *data)
+{
+    TextureLoadJob *job = (TextureLoadJob *)data;
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+    if (job->uploadSlot != -1)
+    {
+        if (job->texture.id == 0)
+        {
+            if (!RequestAsyncTransfer(job->uploadSize))
+            {
+                DeferAsyncJobUpload();
+                return true;
+            }
+
+            // Texture data is read from upload buffer slot, data pointer is the slot offset
+            Image image = job->image;
+            image.data = (void *)((size_t)job->uploadSlot*(TEXTURE_UPLOAD_BUFFER_SIZE/TEXTURE_UPLOAD_SLOTS));
+
+            rlBindUploadBuffer(textureUpload.id);
+            job->texture = LoadTextureFromImage(image);
+            rlBindUploadBuffer(0);
+
+            job->uploadFence = rlInsertFence();
+
+            if (job->texture.id == 0)
+            {
+                rlUnloadFence(job->uploadFence);
+                ReleaseTextureUploadSlot(job->uploadSlot);
+                job->uploadSlot = -1;
+                return false;
+            }
+        }
+
+        // Texture is not used until GPU finished reading the slot
+        if (!rlIsFenceSignaled(job->uploadFence))
+        {
+            DeferAsyncJobUpload();
+            return true;
+        }
+
+        rlUnloadFence(job->uploadFence);
+        job->uploadFence = NULL;
+        ReleaseTextureUploadSlot(job->uploadSlot);
+        job->uploadSlot = -1;
+
+        return true;
+    }
+#endif
+
+    job->texture = LoadTextureFromImage(job->image);
+    UnloadImage(job->image);
+
+    return (job->texture.id != 0);
+}
+
+// Image parallel load decode stage: load image (worker thread)
+static bool DecodeImageJob(void *data)
+{
+    ImageLoadJob *job = (ImageLoadJob *)data;
+
+    job->image = LoadImage(job->fileName);
+
+    return (job->image.data != NULL);
+}
+
+#if defined(SUPPORT_TEXTURE_UPLOAD_QUEUE)
+// Write image data (including mipmaps) into a free upload buffer slot (worker thread)
+// NOTE: Returns -1 if upload buffer is not supported, slots are full or image does not fit a slot
+static int WriteTextureUploadSlot(Image image, int *size)
+{
+    int slot = -1;
+    int dataSize = 0;
+    int mipWidth = image.width;
+    int mipHeight = image.height;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(mipWidth, mipHeight, image.format);
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+    }
+
+    if ((textureUpload.data == NULL) || (dataSize > (TEXTURE_UPLOAD_BUFFER_SIZE/TEXTURE_UPLOAD_SLOTS))) return -1;
+
+    TEXTURE_UPLOAD_LOCK();
+
+    for (int i = 0; i < TEXTURE_UPLOAD_SLOTS; i++)
+    {
+        if (!textureUpload.slotsUsed[i])
+        {
+            textureUpload.slotsUsed[i] = true;
+            slot = i;
+            break;
+        }
+    }
+
+    TEXTURE_UPLOAD_UNLOCK();
+
+    // Slot is owned by this job, data is written unlocked
+    if (slot != -1)
+    {
+        memcpy(textureUpload.data + (size_t)slot*(TEXTURE_UPLOAD_BUFFER_SIZE/TEXTURE_UPLOAD_SLOTS), image.data, dataSize);
+        *size = dataSize;
+    }
+
+    return slot;
+}
+
+// Release upload buffer slot, its transfer must be finished (fence signaled)
+static void ReleaseTextureUploadSlot(int slot)
+{
+    TEXTURE_UPLOAD_LOCK();
+    textureUpload.slotsUsed[slot] = false;
+    TEXTURE_UPLOAD_UNLOCK();
+}
+#endif
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Texture reload decode stage: load image, converted to texture format if required (worker thread)
+static bool DecodeTextureReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+
+    Image image = LoadImage(job->fileName[0]);
+
+    if (image.data == NULL) return false;
+
+    // NOTE: Compressed formats can not be converted, format change is checked on upload stage
+    if ((image.format != job->params[3]) && (image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&
+        (job->params[3] < PIXELFORMAT_COMPRESSED_DXT1_RGB)) ImageFormat(&image, job->params[3]);
+
+    job->data = RL_MALLOC(sizeof(Image));
+    *(Image *)job->data = image;
+
+    return true;
+}
+
+// Texture reload upload stage: replace texture mipmaps data in place, same texture id (main thread)
+// NOTE: Texture size can not change, Texture2D structs copies would keep previous size
+static bool UploadTextureReloadJob(void *data)
+{
+    AssetReloadJob *job = (AssetReloadJob *)data;
+    Image *image = (Image *)job->data;
+    bool success = false;
+
+    if (!job->cancelled)
+    {
+        if ((image->width != job->params[0]) || (image->height != job->params[1]) || (image->format != job->params[3]))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Reloaded image size or format changed, texture must be loaded again", job->id);
+        }
+        else
+        {
+            int mipWidth = image->width;
+            int mipHeight = image->height;
+            unsigned char *mipData = (unsigned char *)image->data;
+
+            for (int level = 0; level < image->mipmaps; level++)
+            {
+                rlUpdateTextureMipmap(job->id, level, mipWidth, mipHeight, image->format, mipData);
+
+                mipData += GetPixelDataSize(mipWidth, mipHeight, image->format);
+                mipWidth = (mipWidth > 1)? mipWidth/2 : 1;
+                mipHeight = (mipHeight > 1)? mipHeight/2 : 1;
+            }
+
+            // Texture mipmaps not provided by image are generated again
+            if ((job->params[2] > 1) && (image->mipmaps == 1))
+            {
+                int mipmaps = 0;
+                rlGenTextureMipmaps(job->id, image->width, image->height, image->format, &mipmaps);
+            }
+
+            TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture reloaded successfully", job->id);
+            success = true;
+        }
+    }
+
+    UnloadImage(*image);
+    RL_FREE(image);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_VIDEO_PLAYBACK)
+// Decode video frames until frames ring is full (job)
+// NOTE: Decoder is restarted on end if looping, frames audio is decoded for the frame duration
+static void DecodeVideoStreamJob(void *data)
+{
+    rVideoStream *stream = (rVideoStream *)data;
+    VideoDecoder *decoder = &stream->decoder;
+
+    while (!stream->ended && ((stream->decodedCount - stream->playSequence) < VIDEO_STREAM_FRAMES))
+    {
+        int slot = stream->decodedCount%VIDEO_STREAM_FRAMES;
+        unsigned char *frame = (stream->convert != NULL)? stream->convert : stream->frames + slot*stream->slotSize;
+
+        bool decoded = decoder->decodeFrame(decoder->userData, frame);
+
+        if (!decoded && stream->looping && (stream->loopDecodedCount > 0) && (decoder->rewind != NULL))
+        {
+            decoder->rewind(decoder->userData);
+            stream->loopDecodedCount = 0;
+
+            decoded = decoder->decodeFrame(decoder->userData, frame);
+        }
+
+        if (!decoded)
+        {
+            stream->ended = true;
+            break;
+        }
+
+        if (stream->audioSamples != NULL)
+        {
+            // NOTE: Audio frames count is computed from video frames position, no rounding drift over time
+            int audioStart = (int)((double)stream->loopDecodedCount*decoder->sampleRate/decoder->frameRate);
+            int audioEnd = (int)((double)(stream->loopDecodedCount + 1)*decoder->sampleRate/decoder->frameRate);
+            int count = ((audioEnd - audioStart) < stream->maxAudioFrames)? (audioEnd - audioStart) : stream->maxAudioFrames;
+
+            count = decoder->decodeAudio(decoder->userData, stream->audioSamples + slot*stream->maxAudioFrames*decoder->channels, count);
+            stream->audioCount[slot] = (count > 0)? count : 0;
+        }
+
+        if (stream->convert != NULL)
+        {
+            // YUV to RGB conversion (BT.601 limited range), fixed point 8 bit fraction
+            unsigned char *rgba = stream->frames + slot*stream->slotSize;
+            const unsigned char *planeU = stream->convert + decoder->width*decoder->height;
+            const unsigned char *planeV = planeU + stream->chromaWidth*stream->chromaHeight;
+
+            for (int y = 0; y < decoder->height; y++)
+            {
+                for (int x = 0; x < decoder->width; x++)
+                {
+                    int c = 298*((int)stream->convert[y*decoder->width + x] - 16);
+                    int d = (int)planeU[(y/2)*stream->chromaWidth + x/2] - 128;
+                    int e = (int)planeV[(y/2)*stream->chromaWidth + x/2] - 128;
+                    int rgb[3] = { (c + 409*e + 128) >> 8, (c - 100*d - 208*e + 128) >> 8, (c + 516*d + 128) >> 8 };
+
+                    for (int i = 0; i < 3; i++) rgba[i] = (unsigned char)((rgb[i] < 0)? 0 : ((rgb[i] > 255)? 255 : rgb[i]));
+                    rgba[3] = 255;
+                    rgba += 4;
+                }
+            }
+        }
+
+        stream->frameIndex[slot] = stream->loopDecodedCount;
+        stream->loopDecodedCount++;
+        stream->decodedCount++;
+    }
+}
+
+// Queue decoded frame audio for audio stream, oldest audio is dropped if queue is full
+static void QueueVideoStreamAudio(rVideoStream *stream, int sequence)
+{
+    if (stream->audioSamples == NULL) return;
+
+    int channels = (int)stream->decoder.channels;
+    int slot = sequence%VIDEO_STREAM_FRAMES;
+    int count = stream->audioCount[slot];
+
+    if ((stream->audioQueued + count) > stream->audioCapacity)
+    {
+        int drop = stream->audioQueued + count - stream->audioCapacity;
+
+        stream->audioQueued -= drop;
+        memmove(stream->audioQueue, stream->audioQueue + drop*channels, stream->audioQueued*channels*sizeof(float));
+    }
+
+    memcpy(stream->audioQueue + stream->audioQueued*channels, stream->audioSamples + slot*stream->maxAudioFrames*channels, count*channels*sizeof(float));
+    stream->audioQueued += count;
+}
+
+// Unload video stream data and close decoder
+static void UnloadVideoStreamData(rVideoStream *stream)
+{
+    if (stream->decoder.close != NULL) stream->decoder.close(stream->decoder.userData);
+
+    RL_FREE(stream->frames);
+    RL_FREE(stream->convert);
+    RL_FREE(stream->audioSamples);
+    RL_FREE(stream->audioQueue);
+    RL_FREE(stream);
+}
+
+// Load Y4M file decoder, header is parsed and frames are read on demand
+// NOTE: Only 4:2:0 chroma subsampling (C420*) is supported, frame parameters are ignored
+static bool LoadY4MDecoder(const char *fileName, VideoDecoder *decoder)
+{
+    unsigned char header[256] = { 0 };
+    int fileSize = GetFileLength(fileName);
+    unsigned int headerSize = (fileSize < (int)sizeof(header))? (unsigned int)fileSize : sizeof(header);
+
+    if ((headerSize < 10) || !LoadFileDataRange(fileName, 0, headerSize, header) || (memcmp(header, "YUV4MPEG2 ", 10) != 0))
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Y4M file header not valid", fileName);
+        return false;
+    }
+
+    int width = 0;
+    int height = 0;
+    int rateNum = 0;
+    int rateDen = 0;
+    bool supported = true;
+    unsigned int offset = 9;
+
+    // Header parameters are space separated, first character identifies the parameter
+    while ((offset < headerSize) && (header[offset] == ' '))
+    {
+        offset++;
+        const char *param = (const char *)header + offset;
+
+        if (param[0] == 'W') width = atoi(param + 1);
+        else if (param[0] == 'H') height = atoi(param + 1);
+        else if (param[0] == 'F') sscanf(param + 1, "%i:%i", &rateNum, &rateDen);
+        else if ((param[0] == 'C') && (strncmp(param + 1, "420", 3) != 0)) supported = false;
+
+        while ((offset < headerSize) && (header[offset] != ' ') && (header[offset] != '\n')) offset++;
+    }
+
+    if ((offset >= headerSize) || (header[offset] != '\n') || (width <= 0) || (height <= 0) || (rateNum <= 0) || (rateDen <= 0) || !supported)
+    {
+        TRACELOG(LOG_WARNING, "VIDEO: [%s] Y4M file parameters not supported (YUV 4:2:0 required)", fileName);
+        return false;
+    }
+
+    Y4MDecoderData *y4m = (Y4MDecoderData *)RL_CALLOC(1, sizeof(Y4MDecoderData));
+    strncpy(y4m->fileName, fileName, sizeof(y4m->fileName) - 1);
+    y4m->fileSize = (unsigned int)fileSize;
+    y4m->dataOffset = offset + 1;
+    y4m->offset = y4m->dataOffset;
+    y4m->frameSize = width*height + 2*((width + 1)/2)*((height + 1)/2);
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+    y4m->stream = OpenFileStream(fileName);
+
+    if ((y4m->stream == NULL) || !SeekFileStream(y4m->stream, (int)y4m->dataOffset, SEEK_SET))
+    {
+        CloseFileStream(y4m->stream);
+        RL_FREE(y4m);
+        return false;
+    }
+#endif
+
+    decoder->userData = y4m;
+    decoder->width = width;
+    decoder->height = height;
+    decoder->frameRate = (float)rateNum/(float)rateDen;
+    decoder->decodeFrame = DecodeY4MFrame;
+    decoder->rewind = RewindY4M;
+    decoder->close = CloseY4M;
+
+    // NOTE: Frames count is only known if frames have no parameters (usual case)
+    unsigned int framesDataSize = y4m->fileSize - y4m->dataOffset;
+    unsigned int frameDataSize = 6 + y4m->frameSize;
+    decoder->frameCount = ((framesDataSize%frameDataSize) == 0)? (int)(framesDataSize/frameDataSize) : 0;
+
+    return true;
+}
+
+// Y4M decoder: read next frame, frame header is skipped
+static bool DecodeY4MFrame(void *userData, unsigned char *data)
+{
+    Y4MDecoderData *y4m = (Y4MDecoderData *)userData;
+    unsigned char header[128] = { 0 };
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+    // Frame header is read up to its line end, frame data follows (read ahead by file stream)
+    unsigned int headerSize = 0;
+
+    while ((headerSize < sizeof(header)) && (ReadFileStream(y4m->stream, header + headerSize, 1) == 1))
+    {
+        if (header[headerSize] == '\n') break;
+        headerSize++;
+    }
+
+    if ((headerSize < 5) || (headerSize >= sizeof(header)) || (header[headerSize] != '\n') || (memcmp(header, "FRAME", 5) != 0)) return false;
+    if (ReadFileStream(y4m->stream, data, (unsigned int)y4m->frameSize) != (unsigned int)y4m->frameSize) return false;
+
+    y4m->offset += headerSize + 1 + y4m->frameSize;
+
+    return true;
+#else
+    unsigned int size = ((y4m->fileSize - y4m->offset) < sizeof(header))? (y4m->fileSize - y4m->offset) : sizeof(header);
+
+    if ((y4m->offset >= y4m->fileSize) || (size < 6) || !LoadFileDataRange(y4m->fileName, y4m->offset, size, header) || (memcmp(header, "FRAME", 5) != 0)) return false;
+
+    unsigned int headerSize = 5;
+    while ((headerSize < size) && (header[headerSize] != '\n')) headerSize++;
+
+    if ((headerSize == size) || !LoadFileDataRange(y4m->fileName, y4m->offset + headerSize + 1, y4m->frameSize, data)) return false;
+
+    y4m->offset += headerSize + 1 + y4m->frameSize;
+
+    return true;
+#endif
+}
+
+// Y4M decoder: restart from first frame
+static void RewindY4M(void *userData)
+{
+    Y4MDecoderData *y4m = (Y4MDecoderData *)userData;
+    y4m->offset = y4m->dataOffset;
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+    SeekFileStream(y4m->stream, (int)y4m->dataOffset, SEEK_SET);
+#endif
+}
+
+// Y4M decoder: release decoder data
+static void CloseY4M(void *userData)
+{
+#if defined(SUPPORT_NATIVE_FILEIO)
+    CloseFileStream(((Y4MDecoderData *)userData)->stream);
+#endif
+
+    RL_FREE(userData);
+}
+#endif
+
+#if defined(VIDEO_SHADER_SUPPORTED)
+// Load built-in video YUV to RGB conversion shader (BT.601 limited range)
+// NOTE: Y plane is drawn as texture0, U and V planes are bound as additional samplers, rlgl default vertex shader is used
+static void LoadVideoStreamShader(void)
+{
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *header = "#version 120\n#define VARYING varying\n#define TEXTURE texture2D\n#define FRAG_COLOR gl_FragColor\n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *header = "#version 330\n#define VARYING in\n#define TEXTURE texture\nout vec4 finalColor;\n#define FRAG_COLOR finalColor\n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const char *header = "#version 100\nprecision mediump float;\n#define VARYING varying\n#define TEXTURE texture2D\n#define FRAG_COLOR gl_FragColor\n";
+#endif
+
+    const char *videoCode =
+    "VARYING vec2 fragTexCoord;         \n"
+    "VARYING vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform sampler2D textureU;        \n"
+    "uniform sampler2D textureV;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float y = 1.164383*(TEXTURE(texture0, fragTexCoord).r - 0.0625); \n"
+    "    float u = TEXTURE(textureU, fragTexCoord).r - 0.5; \n"
+    "    float v = TEXTURE(textureV, fragTexCoord).r - 0.5; \n"
+    "    vec3 rgb = vec3(y + 1.596027*v, y - 0.391762*u - 0.812968*v, y + 2.017232*u); \n"
+    "    FRAG_COLOR = vec4(clamp(rgb, 0.0, 1.0), 1.0)*fragColor*colDiffuse; \n"
+    "}                                  \n";
+
+    char *code = (char *)RL_MALLOC(strlen(header) + strlen(videoCode) + 1);
+    strcpy(code, header);
+    strcat(code, videoCode);
+
+    videoShaderLoaded = true;
+
+    // NOTE: Default vertex shader is used
+    videoShader = LoadShaderFromMemory(NULL, code);
+    RL_FREE(code);
+
+    if ((videoShader.id > 0) && (videoShader.id != rlGetShaderIdDefault()))
+    {
+        videoShaderLocs[0] = GetShaderLocation(videoShader, "textureU");
+        videoShaderLocs[1] = GetShaderLocation(videoShader, "textureV");
+
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Video YUV shader loaded successfully", videoShader.id);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load video YUV shader");
+
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (videoShader.id != rlGetShaderIdDefault()) UnloadShader(videoShader);
+        else RL_FREE(videoShader.locs);
+
+        videoShader = (Shader){ 0 };
+    }
+}
+#endif
+
+#if defined(TEXTURE_ANIM_SUPPORTED)
+// Get GIF frames count scanning file blocks (no decoding), 0 if file data is not valid
+static int GetGIFFrameCount(const unsigned char *fileData, unsigned int fileSize)
+{
+    if ((fileSize < 13) || (memcmp(fileData, "GIF", 3) != 0)) return 0;
+
+    int frameCount = 0;
+    unsigned int offset = 13;       // Header and logical screen descriptor
+
+    if (fileData[10] & 0x80) offset += 3*(1 << ((fileData[10] & 0x07) + 1));    // Global color table
+
+    while (offset < fileSize)
+    {
+        unsigned char block = fileData[offset++];
+
+        if (block == 0x21) offset++;    // Extension: label, followed by data sub-blocks
+        else if (block == 0x2c)         // Image descriptor: local color table and LZW code size, followed by data sub-blocks
+        {
+            if ((offset + 9) > fileSize) break;
+
+            unsigned char flags = fileData[offset + 8];
+            offset += 9;
+
+            if (flags & 0x80) offset += 3*(1 << ((flags & 0x07) + 1));
+            offset++;
+
+            frameCount++;
+        }
+        else break;                     // Trailer (0x3b) or not valid block
+
+        // Skip data sub-blocks, up to block terminator
+        while ((offset < fileSize) && (fileData[offset] != 0)) offset += fileData[offset] + 1;
+        offset++;
+    }
+
+    return frameCount;
+}
+
+// Reset animated texture decoder to first frame, decoder buffers are released
+static void ResetTextureAnimDecoder(rTextureAnimStream *stream)
+{
+    STBI_FREE(stream->gif.out);
+    STBI_FREE(stream->gif.history);
+    STBI_FREE(stream->gif.background);
+    memset(&stream->gif, 0, sizeof(stbi__gif));
+
+    stbi__start_mem(&stream->context, stream->fileData, (int)stream->fileSize);
+    stream->loopDecodedCount = 0;
+}
+
+// Decode animated texture next frame, decoding restarts from first frame after last one
+// NOTE: Returned frame is decoder composed frame (R8G8B8A8), valid until next decode, NULL on failure
+static unsigned char *DecodeTextureAnimFrame(rTextureAnimStream *stream, int *delay)
+{
+    int comp = 0;
+    unsigned char *twoBack = (stream->loopDecodedCount >= 2)? stream->previous[1] : NULL;
+    unsigned char *frame = stbi__gif_load_next(&stream->context, &stream->gif, &comp, 4, twoBack);
+
+    if (((frame == NULL) || (frame == (unsigned char *)&stream->context)) && (stream->loopDecodedCount > 0))
+    {
+        // End of animation marker (or truncated data after last frame), decoding restarts from first frame
+        ResetTextureAnimDecoder(stream);
+        frame = stbi__gif_load_next(&stream->context, &stream->gif, &comp, 4, NULL);
+    }
+
+    if ((frame == NULL) || (frame == (unsigned char *)&stream->context))
+    {
+        stream->failed = true;
+        return NULL;
+    }
+
+    int frameSize = stream->gif.w*stream->gif.h*4;
+
+    // Keep last two frames: frame decoded before last one is required by disposal to previous frame
+    if (stream->previous[0] == NULL)
+    {
+        stream->previous[0] = (unsigned char *)RL_MALLOC(frameSize);
+        stream->previous[1] = (unsigned char *)RL_MALLOC(frameSize);
+    }
+
+    unsigned char *last = stream->previous[1];
+    stream->previous[1] = stream->previous[0];
+    stream->previous[0] = last;
+    memcpy(stream->previous[0], frame, frameSize);
+
+    stream->loopDecodedCount++;
+
+    // NOTE: Delays up to 10ms are played at 100ms (as web browsers do)
+    *delay = (stream->gif.delay > 10)? stream->gif.delay : 100;
+
+    return frame;
+}
+
+// Decode animated texture frames until frames ring is full (job)
+static void DecodeTextureAnimJob(void *data)
+{
+    rTextureAnimStream *stream = (rTextureAnimStream *)data;
+    int frameSize = stream->width*stream->height*4;
+
+    while (!stream->failed && ((stream->decodedCount - stream->playSequence) < TEXTURE_ANIM_FRAMES))
+    {
+        int slot = stream->decodedCount%TEXTURE_ANIM_FRAMES;
+        unsigned char *frame = DecodeTextureAnimFrame(stream, &stream->frameDelay[slot]);
+
+        if (frame == NULL) break;
+
+        memcpy(stream->frames + slot*frameSize, frame, frameSize);
+        stream->decodedCount++;
+    }
+}
+#endif
+
+#if defined(SUPPORT_TEXTURE_STREAMING)
+// Find streamed texture by id, NULL if not streamed
+static StreamedTexture *FindStreamedTexture(unsigned int id)
+{
+    if ((id == 0) || (streamedTexturesCount == 0)) return NULL;
+
+    for (int i = 0; i < MAX_STREAMED_TEXTURES; i++) if (streamedTextures[i].id == id) return &streamedTextures[i];
+
+    return NULL;
+}
+
+// Remove texture from streaming, its resident mipmaps and pending load are released from budget
+static void RemoveStreamedTexture(unsigned int id)
+{
+    StreamedTexture *stream = FindStreamedTexture(id);
+    if (stream == NULL) return;
+
+    for (int i = stream->residentLevel; i < stream->mipmaps; i++) textureStreamingMemory -= GetStreamedMipmapSize(stream, i);
+    textureStreamingMemory -= stream->pendingSize;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    unsigned int pendingJob = stream->pendingJob;
+#endif
+
+    memset(stream, 0, sizeof(StreamedTexture));
+    streamedTexturesCount--;
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    // NOTE: Release waits for the load to finish, upload stage does not find the texture
+    if (pendingJob != 0) ReleaseAsyncJob(pendingJob);
+#endif
+}
+
+// Get streamed texture mipmap level data size
+static int GetStreamedMipmapSize(const StreamedTexture *stream, int level)
+{
+    int width = (stream->width >> level) > 0? (stream->width >> level) : 1;
+    int height = (stream->height >> level) > 0? (stream->height >> level) : 1;
+
+    return GetPixelDataSize(width, height, stream->format);
+}
+
+// Evict least recently used mipmaps until size fits the budget, returns false if it does not fit
+// NOTE: Textures used this frame only release mipmaps over their required level, textures loading are skipped
+static bool FitTextureStreamingBudget(int size)
+{
+    while ((textureStreamingMemory + size) > textureStreamingBudget)
+    {
+        StreamedTexture *evict = NULL;
+
+        for (int i = 0; i < MAX_STREAMED_TEXTURES; i++)
+        {
+            StreamedTexture *stream = &streamedTextures[i];
+
+            if ((stream->id == 0) || (stream->pendingJob != 0) || (stream->residentLevel >= stream->tailLevel)) continue;
+            if ((stream->lastUsedFrame == textureStreamingFrame) && (stream->residentLevel >= stream->requestedLevel)) continue;
+
+            if ((evict == NULL) || (stream->lastUsedFrame < evict->lastUsedFrame)) evict = stream;
+        }
+
+        if (evict == NULL) return false;
+
+        EvictStreamedMipmap(evict);
+    }
+
+    return true;
+}
+
+// Load streamed texture mipmap level, returns false if load could not be started
+// NOTE: Level data size is added to memory on request, async loads upload the level on a later frame
+static bool LoadStreamedMipmap(StreamedTexture *stream, int level)
+{
+    int size = GetStreamedMipmapSize(stream, level);
+
+#if defined(SUPPORT_ASYNC_LOADING)
+    TextureMipmapJob *job = (TextureMipmapJob *)RL_CALLOC(1, sizeof(TextureMipmapJob) + size);
+    snprintf(job->fileName, sizeof(job->fileName), "%s", stream->fileName);
+    job->id = stream->id;
+    job->serial = ++textureStreamingSerial;
+    job->level = level;
+    job->offset = stream->levelOffsets[level];
+    job->size = size;
+    job->data = (unsigned char *)(job + 1);
+
+    stream->pendingSerial = job->serial;
+    stream->pendingJob = SubmitAsyncJob(ASYNC_JOB_TEXTURE_MIPMAP, job, DecodeTextureMipmapJob, UploadTextureMipmapJob);
+
+    if (stream->pendingJob == 0) return false;      // Job data already freed
+
+    stream->pendingSize = size;
+    textureStreamingMemory += size;
+
+    return true;
+#else
+    unsigned char *data = (unsigned char *)RL_MALLOC(size);
+    bool result = LoadFileDataRange(stream->fileName, stream->levelOffsets[level], size, data);
+
+    if (result)
+    {
+        SetStreamedMipmap(stream, level, data);
+        textureStreamingMemory += size;
+    }
+    else stream->streamLevel = level + 1;
+
+    RL_FREE(data);
+
+    return result;
+#endif
+}
+
+// Upload streamed texture mipmap level and set it as texture base level
+static void SetStreamedMipmap(StreamedTexture *stream, int level, const unsigned char *data)
+{
+    int width = (stream->width >> level) > 0? (stream->width >> level) : 1;
+    int height = (stream->height >> level) > 0? (stream->height >> level) : 1;
+
+    rlUpdateTextureMipmap(stream->id, level, width, height, stream->format, data);
+    rlTextureParameters(stream->id, RL_TEXTURE_BASE_LEVEL, level);
+
+    stream->residentLevel = level;
+}
+
+// Release streamed texture base mipmap level, next level is set as base level
+static void EvictStreamedMipmap(StreamedTexture *stream)
+{
+    int level = stream->residentLevel;
+
+    rlTextureParameters(stream->id, RL_TEXTURE_BASE_LEVEL, level + 1);
+    rlUpdateTextureMipmap(stream->id, level, 0, 0, stream->format, NULL);
+
+    stream->residentLevel = level + 1;
+    textureStreamingMemory -= GetStreamedMipmapSize(stream, level);
+}
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Mipmap async load decode stage: read level data range from file (worker thread)
+static bool DecodeTextureMipmapJob(void *data)
+{
+    TextureMipmapJob *job = (TextureMipmapJob *)data;
+
+    return LoadFileDataRange(job->fileName, job->offset, job->size, job->data);
+}
+
+// Mipmap async load upload stage: upload level data (main thread)
+// NOTE: Texture could have been unloaded (and its id reused) while loading, serial must match
+static bool UploadTextureMipmapJob(void *data)
+{
+    TextureMipmapJob *job = (TextureMipmapJob *)data;
+
+    StreamedTexture *stream = FindStreamedTexture(job->id);
+    if ((stream == NULL) || (stream->pendingSerial != job->serial)) return false;
+
+    SetStreamedMipmap(stream, job->level, job->data);
+
+    return true;
+}
+#endif
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_DDS)
+// Loading DDS image data (compressed or uncompressed)
+static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    // Required extension:
+    // GL_EXT_texture_compression_s3tc
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
+    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
+    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
+    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+
+    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
+    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
+    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourCC;
+        unsigned int rgbBitCount;
+        unsigned int rBitMask;
+        unsigned int gBitMask;
+        unsigned int bBitMask;
+        unsigned int aBitMask;
+    } DDSPixelFormat;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitchOrLinearSize;
+        unsigned int depth;
+        unsigned int mipmapCount;
+        unsigned int reserved1[11];
+        DDSPixelFormat ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } DDSHeader;
+
+    Image image = { 0 };
+
+    if (fileDataPtr != NULL)
+    {
+        // Verify the type of file
+        unsigned char *ddsHeaderId = fileDataPtr;
+        fileDataPtr += 4;
+
+        if ((ddsHeaderId[0] != 'D') || (ddsHeaderId[1] != 'D') || (ddsHeaderId[2] != 'S') || (ddsHeaderId[3] != ' '))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: DDS file data not valid");
+        }
+        else
+        {
+            DDSHeader *ddsHeader = (DDSHeader *)fileDataPtr;
+
+            TRACELOGD("IMAGE: DDS file data info:");
+            TRACELOGD("    > Header size:        %i", sizeof(DDSHeader));
+            TRACELOGD("    > Pixel format size:  %i", ddsHeader->ddspf.size);
+            TRACELOGD("    > Pixel format flags: 0x%x", ddsHeader->ddspf.flags);
+            TRACELOGD("    > File format:        0x%x", ddsHeader->ddspf.fourCC);
+            TRACELOGD("    > File bit count:     0x%x", ddsHeader->ddspf.rgbBitCount);
+
+            fileDataPtr += sizeof(DDSHeader);   // Skip header
+
+            image.width = ddsHeader->width;
+            image.height = ddsHeader->height;
+
+            if (ddsHeader->mipmapCount == 0) image.mipmaps = 1;      // Parameter not used
+            else image.mipmaps = ddsHeader->mipmapCount;
+
+            if (ddsHeader->ddspf.rgbBitCount == 16)     // 16bit mode, no compressed
+            {
+                if (ddsHeader->ddspf.flags == 0x40)         // no alpha channel
+                {
+                    int dataSize = image.width*image.height*sizeof(unsigned short);
+                    image.data = (unsigned short *)RL_MALLOC(dataSize);
+
+                    memcpy(image.data, fileDataPtr, dataSize);
+
+                    image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                }
+                else if (ddsHeader->ddspf.flags == 0x41)        // with alpha channel
+                {
+                    if (ddsHeader->ddspf.aBitMask == 0x8000)    // 1bit alpha
+                    {
+                        int dataSize = image.width*image.height*sizeof(unsigned short);
+                        image.data = (unsigned short *)RL_MALLOC(dataSize);
+
+                        memcpy(image.data, fileDataPtr, dataSize);
+
+                        unsigned char alpha = 0;
+
+                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
+                        for (int i = 0; i < image.width*image.height; i++)
+                        {
+                            alpha = ((unsigned short *)image.data)[i] >> 15;
+                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 1;
+                            ((unsigned short *)image.data)[i] += alpha;
+                        }
+
+                        image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                    }
+                    else if (ddsHeader->ddspf.aBitMask == 0xf000)   // 4bit alpha
+                    {
+                        int dataSize = image.width*image.height*sizeof(unsigned short);
+                        image.data = (unsigned short *)RL_MALLOC(dataSize);
+
+                        memcpy(image.data, fileDataPtr, dataSize);
+
+                        unsigned char alpha = 0;
+
+                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
+                        for (int i = 0; i < image.width*image.height; i++)
+                        {
+                            alpha = ((unsigned short *)image.data)[i] >> 12;
+                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 4;
+                            ((unsigned short *)image.data)[i] += alpha;
+                        }
+
+                        image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                    }
+                }
+            }
+            else if (ddsHeader->ddspf.flags == 0x40 && ddsHeader->ddspf.rgbBitCount == 24)   // DDS_RGB, no compressed
+            {
+                int dataSize = image.width*image.height*3*sizeof(unsigned char);
+                image.data = (unsigned short *)RL_MALLOC(dataSize);
+
+                memcpy(image.data, fileDataPtr, dataSize);
+
+                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+            }
+            else if (ddsHeader->ddspf.flags == 0x41 && ddsHeader->ddspf.rgbBitCount == 32) // DDS_RGBA, no compressed
+            {
+                int dataSize = image.width*image.height*4*sizeof(unsigned char);
+                image.data = (unsigned short *)RL_MALLOC(dataSize);
+
+                memcpy(image.data, fileDataPtr, dataSize);
+
+                unsigned char blue = 0;
+
+                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
+                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
+                // So, we must realign B8G8R8A8 to R8G8B8A8
+                for (int i = 0; i < image.width*image.height*4; i += 4)
+                {
+                    blue = ((unsigned char *)image.data)[i];
+                    ((unsigned char *)image.data)[i] = ((unsigned char *)image.data)[i + 2];
+                    ((unsigned char *)image.data)[i + 2] = blue;
+                }
+
+                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+            else if (((ddsHeader->ddspf.flags == 0x04) || (ddsHeader->ddspf.flags == 0x05)) && (ddsHeader->ddspf.fourCC > 0)) // Compressed
+            {
+                switch (ddsHeader->ddspf.fourCC)
+                {
+                    case FOURCC_DXT1:
+                    {
+                        if (ddsHeader->ddspf.flags == 0x04) image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+                        else image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+                    } break;
+                    case FOURCC_DXT3: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+                    case FOURCC_DXT5: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                    default: break;
+                }
+
+                // Calculate data size, including all mipmaps
+                int dataSize = 0;
+                for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+                {
+                    dataSize += GetPixelDataSize(width, height, image.format);
+                    if (width > 1) width /= 2;
+                    if (height > 1) height /= 2;
+                }
+
+                if ((image.format == 0) || (dataSize > (int)(fileSize - (fileDataPtr - fileData))))
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: DDS file data size not valid");
+                    image.mipmaps = 0;
+                }
+                else
+                {
+                    image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                    memcpy(image.data, fileDataPtr, dataSize);
+                }
+            }
+        }
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PKM)
+// Loading PKM image data (ETC1/ETC2 compression)
+// NOTE: KTX is the standard Khronos Group compression format (ETC1/ETC2, mipmaps)
+// PKM is a much simpler file format used mainly to contain a single ETC1/ETC2 compressed image (no mipmaps)
+static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    // Required extensions:
+    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1) (OpenGL ES 2.0)
+    // GL_ARB_ES3_compatibility  (ETC2/EAC) (OpenGL ES 3.0)
+
+    // Supported tokens (defined by extensions)
+    // GL_ETC1_RGB8_OES                 0x8D64
+    // GL_COMPRESSED_RGB8_ETC2          0x9274
+    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+
+    // PKM file (ETC1) Header (16 bytes)
+    typedef struct {
+        char id[4];                 // "PKM "
+        char version[2];            // "10" or "20"
+        unsigned short format;      // Data format (big-endian) (Check list below)
+        unsigned short width;       // Texture width (big-endian) (origWidth rounded to multiple of 4)
+        unsigned short height;      // Texture height (big-endian) (origHeight rounded to multiple of 4)
+        unsigned short origWidth;   // Original width (big-endian)
+        unsigned short origHeight;  // Original height (big-endian)
+    } PKMHeader;
+
+    // Formats list
+    // version 10: format: 0=ETC1_RGB, [1=ETC1_RGBA, 2=ETC1_RGB_MIP, 3=ETC1_RGBA_MIP] (not used)
+    // version 20: format: 0=ETC1_RGB, 1=ETC2_RGB, 2=ETC2_RGBA_OLD, 3=ETC2_RGBA, 4=ETC2_RGBA1, 5=ETC2_R, 6=ETC2_RG, 7=ETC2_SIGNED_R, 8=ETC2_SIGNED_R
+
+    // NOTE: The extended width and height are the widths rounded up to a multiple of 4.
+    // NOTE: ETC is always 4bit per pixel (64 bit for each 4x4 block of pixels)
+
+    Image image = { 0 };
+
+    if (fileDataPtr != NULL)
+    {
+        PKMHeader *pkmHeader = (PKMHeader *)fileDataPtr;
+
+        if ((pkmHeader->id[0] != 'P') || (pkmHeader->id[1] != 'K') || (pkmHeader->id[2] != 'M') || (pkmHeader->id[3] != ' '))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: PKM file data not valid");
+        }
+        else
+        {
+            fileDataPtr += sizeof(PKMHeader);   // Skip header
+
+            // NOTE: format, width and height come as big-endian, data must be swapped to little-endian
+            pkmHeader->format = ((pkmHeader->format & 0x00FF) << 8) | ((pkmHeader->format & 0xFF00) >> 8);
+            pkmHeader->width = ((pkmHeader->width & 0x00FF) << 8) | ((pkmHeader->width & 0xFF00) >> 8);
+            pkmHeader->height = ((pkmHeader->height & 0x00FF) << 8) | ((pkmHeader->height & 0xFF00) >> 8);
+
+            TRACELOGD("IMAGE: PKM file data info:");
+            TRACELOGD("    > Image width:  %i", pkmHeader->width);
+            TRACELOGD("    > Image height: %i", pkmHeader->height);
+            TRACELOGD("    > Image format: %i", pkmHeader->format);
+
+            image.width = pkmHeader->width;
+            image.height = pkmHeader->height;
+            image.mipmaps = 1;
+
+            int bpp = 4;
+            if (pkmHeader->format == 3) bpp = 8;
+
+            int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
+
+            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+            memcpy(image.data, fileDataPtr, dataSize);
+
+            if (pkmHeader->format == 0) image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+            else if (pkmHeader->format == 1) image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+            else if (pkmHeader->format == 3) image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+        }
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_KTX)
+// Load KTX compressed image data (ETC1/ETC2 compression)
+// TODO: Review KTX loading, many things changed!
+static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    // Required extensions:
+    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
+    // GL_ARB_ES3_compatibility  (ETC2/EAC)
+
+    // Supported tokens (defined by extensions)
+    // GL_ETC1_RGB8_OES                 0x8D64
+    // GL_COMPRESSED_RGB8_ETC2          0x9274
+    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    // v2.0 - http://github.khronos.org/KTX-Specification/
+
+    // TODO: Support KTX 2.2 specs!
+
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
+    } KTXHeader;
+
+    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+
+    Image image = { 0 };
+
+    if (fileDataPtr != NULL)
+    {
+        KTXHeader *ktxHeader = (KTXHeader *)fileDataPtr;
+
+        if ((ktxHeader->id[1] != 'K') || (ktxHeader->id[2] != 'T') || (ktxHeader->id[3] != 'X') ||
+            (ktxHeader->id[4] != ' ') || (ktxHeader->id[5] != '1') || (ktxHeader->id[6] != '1'))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: KTX file data not valid");
+        }
+        else
+        {
+            fileDataPtr += sizeof(KTXHeader);           // Move file data pointer
+
+            image.width = ktxHeader->width;
+            image.height = ktxHeader->height;
+            image.mipmaps = ktxHeader->mipmapLevels;
+
+            TRACELOGD("IMAGE: KTX file data info:");
+            TRACELOGD("    > Image width:  %i", ktxHeader->width);
+            TRACELOGD("    > Image height: %i", ktxHeader->height);
+            TRACELOGD("    > Image format: 0x%x", ktxHeader->glInternalFormat);
+
+            fileDataPtr += ktxHeader->keyValueDataSize; // Skip value data size
+
+            // Calculate data size, including all mipmaps (every level is prefixed by its size)
+            int dataSize = 0;
+            unsigned char *levelDataPtr = fileDataPtr;
+            for (int i = 0; i < image.mipmaps; i++)
+            {
+                if ((levelDataPtr + sizeof(int)) > (fileData + fileSize)) { image.mipmaps = i; break; }
+
+                int levelSize = ((int *)levelDataPtr)[0];
+                if ((levelSize < 0) || ((levelDataPtr + sizeof(int) + levelSize) > (fileData + fileSize))) { image.mipmaps = i; break; }
+
+                dataSize += levelSize;
+                levelDataPtr += sizeof(int) + ((levelSize + 3) & ~3);     // NOTE: Level data is padded to 4 bytes
+            }
+
+            if (image.mipmaps == 0) TRACELOG(LOG_WARNING, "IMAGE: KTX file data size not valid");
+            else
+            {
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                for (int i = 0, offset = 0; i < image.mipmaps; i++)
+                {
+                    int levelSize = ((int *)fileDataPtr)[0];
+                    fileDataPtr += sizeof(int);
+
+                    memcpy((unsigned char *)image.data + offset, fileDataPtr, levelSize);
+
+                    offset += levelSize;
+                    fileDataPtr += ((levelSize + 3) & ~3);
+                }
+            }
+
+            if (ktxHeader->glInternalFormat == 0x8D64) image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+            else if (ktxHeader->glInternalFormat == 0x9274) image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+            else if (ktxHeader->glInternalFormat == 0x9278) image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+
+            // TODO: Support uncompressed data formats? Right now it returns format = 0!
+        }
+    }
+
+    return image;
+}
+
+// Save image data as KTX file
+// NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
+// TODO: Review KTX saving, many things changed!
+static int SaveKTX(Image image, const char *fileName)
+{
+    // KTX file Header (64 bytes)
+    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+    // v2.0 - http://github.khronos.org/KTX-Specification/ - Final specs by 2021-04-18
+    typedef struct {
+        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"             // KTX 2.0: "«KTX 22»\r\n\x1A\n"
+        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+        unsigned int glType;                // For compressed textures, glType must equal 0
+        unsigned int glTypeSize;            // For compressed texture data, usually 1
+        unsigned int glFormat;              // For compressed textures is 0
+        unsigned int glInternalFormat;      // Compressed internal format
+        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)       // KTX 2.0: UInt32 vkFormat
+        unsigned int width;                 // Texture image width in pixels
+        unsigned int height;                // Texture image height in pixels
+        unsigned int depth;                 // For 2D textures is 0
+        unsigned int elements;              // Number of array elements, usually 0
+        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...         // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
+                                                                                            // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
+        // KTX 2.0 defines additional header elements...
+    } KTXHeader;
+
+    // Calculate file dataSize required
+    int dataSize = sizeof(KTXHeader);
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        dataSize += sizeof(unsigned int) + GetPixelDataSize(width, height, image.format);    // Every level is prefixed by its size
+        width /= 2; height /= 2;
+    }
+
+    unsigned char *fileData = RL_CALLOC(dataSize, 1);
+    unsigned char *fileDataPtr = fileData;
+
+    KTXHeader ktxHeader = { 0 };
+
+    // KTX identifier (v1.1)
+    //unsigned char id[12] = { '«', 'K', 'T', 'X', ' ', '1', '1', '»', '\r', '\n', '\x1A', '\n' };
+    //unsigned char id[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    // Get the image header
+    memcpy(ktxHeader.id, ktxIdentifier, 12);  // KTX 1.1 signature
+    ktxHeader.endianness = 0;
+    ktxHeader.glType = 0;                     // Obtained from image.format
+    ktxHeader.glTypeSize = 1;
+    ktxHeader.glFormat = 0;                   // Obtained from image.format
+    ktxHeader.glInternalFormat = 0;           // Obtained from image.format
+    ktxHeader.glBaseInternalFormat = 0;
+    ktxHeader.width = image.width;
+    ktxHeader.height = image.height;
+    ktxHeader.depth = 0;
+    ktxHeader.elements = 0;
+    ktxHeader.faces = 1;
+    ktxHeader.mipmapLevels = image.mipmaps;   // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
+    ktxHeader.keyValueDataSize = 0;           // No extra data after the header
+
+    rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
+    ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
+
+    // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
+
+    if (ktxHeader.glFormat == -1) TRACELOG(LOG_WARNING, "IMAGE: GL format not supported for KTX export (%i)", ktxHeader.glFormat);
+    else
+    {
+        memcpy(fileDataPtr, &ktxHeader, sizeof(KTXHeader));
+        fileDataPtr += sizeof(KTXHeader);
+
+        int width = image.width;
+        int height = image.height;
+        int dataOffset = 0;
+
+        // Save all mipmaps data
+        for (int i = 0; i < image.mipmaps; i++)
+        {
+            unsigned int dataSize = GetPixelDataSize(width, height, image.format);
+
+            memcpy(fileDataPtr, &dataSize, sizeof(unsigned int));
+            memcpy(fileDataPtr + 4, (unsigned char *)image.data + dataOffset, dataSize);
+
+            width /= 2;
+            height /= 2;
+            dataOffset += dataSize;
+            fileDataPtr += (4 + dataSize);
+        }
+    }
+
+    int success = SaveFileData(fileName, fileData, dataSize);
+
+    RL_FREE(fileData);    // Free file data buffer
+
+    // If all data has been written correctly to file, success = 1
+    return success;
+}
+
+// KTX 1.1 file header (64 bytes), used by cubemaps load/save
+typedef struct {
+    char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
+    unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
+    unsigned int glType;                // For compressed textures, glType must equal 0
+    unsigned int glTypeSize;            // For compressed texture data, usually 1
+    unsigned int glFormat;              // For compressed textures is 0
+    unsigned int glInternalFormat;      // Compressed internal format
+    unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
+    unsigned int width;                 // Texture image width in pixels
+    unsigned int height;                // Texture image height in pixels
+    unsigned int depth;                 // For 2D textures is 0
+    unsigned int elements;              // Number of array elements, usually 0
+    unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
+    unsigned int mipmapLevels;          // Non-mipmapped textures = 1
+    unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
+} KTXCubemapHeader;
+
+// Load KTX cubemap file data, all mipmaps loaded
+// NOTE: Every level is prefixed by one face data size, faces data padded to 4 bytes
+static TextureCubemap LoadKTXCubemap(const unsigned char *fileData, unsigned int fileSize)
+{
+    TextureCubemap cubemap = { 0 };
+
+    if ((fileData == NULL) || (fileSize < sizeof(KTXCubemapHeader))) return cubemap;
+
+    const KTXCubemapHeader *ktxHeader = (const KTXCubemapHeader *)fileData;
+
+    if ((ktxHeader->id[1] != 'K') || (ktxHeader->id[2] != 'T') || (ktxHeader->id[3] != 'X') ||
+        (ktxHeader->id[4] != ' ') || (ktxHeader->id[5] != '1') || (ktxHeader->id[6] != '1'))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: KTX file data not valid");
+        return cubemap;
+    }
+
+    if ((ktxHeader->faces != 6) || (ktxHeader->width != ktxHeader->height) || (ktxHeader->width == 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: KTX file data is not a cubemap");
+        return cubemap;
+    }
+
+    // Pixel format matched from OpenGL formats
+    int format = 0;
+    for (int i = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; i <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; i++)
+    {
+        int glInternalFormat = 0, glFormat = 0, glType = 0;
+        rlGetGlTextureFormats(i, &glInternalFormat, &glFormat, &glType);
+
+        if (((unsigned int)glInternalFormat == ktxHeader->glInternalFormat) && ((unsigned int)glType == ktxHeader->glType) &&
+            ((ktxHeader->glFormat == 0) || ((unsigned int)glFormat == ktxHeader->glFormat))) { format = i; break; }
+    }
+
+    if (format == 0)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: KTX cubemap format not supported (0x%x)", ktxHeader->glInternalFormat);
+        return cubemap;
+    }
+
+    int size = ktxHeader->width;
+    int mipmaps = (ktxHeader->mipmapLevels > 0)? ktxHeader->mipmapLevels : 1;
+
+    // Validate levels data size, compact data without size prefixes and padding
+    const unsigned char *fileDataPtr = fileData + sizeof(KTXCubemapHeader) + ktxHeader->keyValueDataSize;
+    int dataSize = 0;
+
+    for (int i = 0, levelSize = size; i < mipmaps; i++, levelSize = (levelSize > 1)? levelSize/2 : 1) dataSize += 6*GetPixelDataSize(levelSize, levelSize, format);
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    unsigned char *dataPtr = data;
+
+    for (int i = 0, levelSize = size; i < mipmaps; i++, levelSize = (levelSize > 1)? levelSize/2 : 1)
+    {
+        unsigned int faceSize = GetPixelDataSize(levelSize, levelSize, format);
+
+        if ((fileDataPtr + sizeof(unsigned int) + 6*((faceSize + 3) & ~3)) > (fileData + fileSize)) { mipmaps = i; break; }
+        if (((const unsigned int *)fileDataPtr)[0] != faceSize) { mipmaps = i; break; }
+        fileDataPtr += sizeof(unsigned int);
+
+        for (int face = 0; face < 6; face++)
+        {
+            memcpy(dataPtr, fileDataPtr, faceSize);
+            dataPtr += faceSize;
+            fileDataPtr += ((faceSize + 3) & ~3);    // NOTE: Face data is padded to 4 bytes
+        }
+    }
+
+    if (mipmaps > 0) cubemap.id = rlLoadTextureCubemapMipmaps(data, size, format, mipmaps);
+    else TRACELOG(LOG_WARNING, "TEXTURE: KTX file data size not valid");
+
+    RL_FREE(data);
+
+    if (cubemap.id > 0)
+    {
+        cubemap.width = size;
+        cubemap.height = size;
+        cubemap.mipmaps = mipmaps;
+        cubemap.format = format;
+    }
+
+    return cubemap;
+}
+
+// Save cubemap data as KTX file, levels one after the other, every level with its 6 faces (+X, -X, +Y, -Y, +Z, -Z)
+static int SaveKTXCubemap(const void *data, int size, int format, int mipmapCount, const char *fileName)
+{
+    KTXCubemapHeader ktxHeader = { 0 };
+    const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    int glInternalFormat = 0, glFormat = 0, glType = 0;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);   // rlgl module function
+
+    if (glInternalFormat == -1)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: GL format not supported for KTX export (%i)", format);
+        return 0;
+    }
+
+    memcpy(ktxHeader.id, ktxIdentifier, 12);  // KTX 1.1 signature
+    ktxHeader.endianness = 0x04030201;
+    ktxHeader.glType = glType;
+    ktxHeader.glTypeSize = 1;
+    ktxHeader.glFormat = (format < PIXELFORMAT_COMPRESSED_DXT1_RGB)? glFormat : 0;
+    ktxHeader.glInternalFormat = glInternalFormat;
+    ktxHeader.glBaseInternalFormat = glFormat;
+    ktxHeader.width = size;
+    ktxHeader.height = size;
+    ktxHeader.faces = 6;
+    ktxHeader.mipmapLevels = mipmapCount;
+
+    // Calculate file dataSize required, faces data padded to 4 bytes
+    int dataSize = sizeof(KTXCubemapHeader);
+    for (int i = 0, levelSize = size; i < mipmapCount; i++, levelSize = (levelSize > 1)? levelSize/2 : 1) dataSize += sizeof(unsigned int) + 6*((GetPixelDataSize(levelSize, levelSize, format) + 3) & ~3);
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(dataSize, 1);
+    unsigned char *fileDataPtr = fileData;
+    const unsigned char *dataPtr = (const unsigned char *)data;
+
+    memcpy(fileDataPtr, &ktxHeader, sizeof(KTXCubemapHeader));
+    fileDataPtr += sizeof(KTXCubemapHeader);
+
+    for (int i = 0, levelSize = size; i < mipmapCount; i++, levelSize = (levelSize > 1)? levelSize/2 : 1)
+    {
+        unsigned int faceSize = GetPixelDataSize(levelSize, levelSize, format);
+
+        memcpy(fileDataPtr, &faceSize, sizeof(unsigned int));
+        fileDataPtr += sizeof(unsigned int);
+
+        for (int face = 0; face < 6; face++)
+        {
+            memcpy(fileDataPtr, dataPtr, faceSize);
+            dataPtr += faceSize;
+            fileDataPtr += ((faceSize + 3) & ~3);
+        }
+    }
+
+    int success = SaveFileData(fileName, fileData, dataSize);
+
+    RL_FREE(fileData);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_PVR)
+// Loading PVR image data (uncompressed or PVRT compression)
+// NOTE: PVR v2 not supported, use PVR v3 instead
+static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    // Required extension:
+    // GL_IMG_texture_compression_pvrtc
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG       0x8C00
+    // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG      0x8C02
+
+#if 0   // Not used...
+    // PVR file v2 Header (52 bytes)
+    typedef struct {
+        unsigned int headerLength;
+        unsigned int height;
+        unsigned int width;
+        unsigned int numMipmaps;
+        unsigned int flags;
+        unsigned int dataLength;
+        unsigned int bpp;
+        unsigned int bitmaskRed;
+        unsigned int bitmaskGreen;
+        unsigned int bitmaskBlue;
+        unsigned int bitmaskAlpha;
+        unsigned int pvrTag;
+        unsigned int numSurfs;
+    } PVRHeaderV2;
+#endif
+
+    // PVR file v3 Header (52 bytes)
+    // NOTE: After it could be metadata (15 bytes?)
+    typedef struct {
+        char id[4];
+        unsigned int flags;
+        unsigned char channels[4];      // pixelFormat high part
+        unsigned char channelDepth[4];  // pixelFormat low part
+        unsigned int colourSpace;
+        unsigned int channelType;
+        unsigned int height;
+        unsigned int width;
+        unsigned int depth;
+        unsigned int numSurfaces;
+        unsigned int numFaces;
+        unsigned int numMipmaps;
+        unsigned int metaDataSize;
+    } PVRHeaderV3;
+
+#if 0   // Not used...
+    // Metadata (usually 15 bytes)
+    typedef struct {
+        unsigned int devFOURCC;
+        unsigned int key;
+        unsigned int dataSize;      // Not used?
+        unsigned char *data;        // Not used?
+    } PVRMetadata;
+#endif
+
+    Image image = { 0 };
+
+    if (fileDataPtr != NULL)
+    {
+        // Check PVR image version
+        unsigned char pvrVersion = fileDataPtr[0];
+
+        // Load different PVR data formats
+        if (pvrVersion == 0x50)
+        {
+            PVRHeaderV3 *pvrHeader = (PVRHeaderV3 *)fileDataPtr;
+
+            if ((pvrHeader->id[0] != 'P') || (pvrHeader->id[1] != 'V') || (pvrHeader->id[2] != 'R') || (pvrHeader->id[3] != 3))
+            {
+                TRACELOG(LOG_WARNING, "IMAGE: PVR file data not valid");
+            }
+            else
+            {
+                fileDataPtr += sizeof(PVRHeaderV3);   // Skip header
+
+                image.width = pvrHeader->width;
+                image.height = pvrHeader->height;
+                image.mipmaps = pvrHeader->numMipmaps;
+
+                // Check data format
+                if (((pvrHeader->channels[0] == 'l') && (pvrHeader->channels[1] == 0)) && (pvrHeader->channelDepth[0] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                else if (((pvrHeader->channels[0] == 'l') && (pvrHeader->channels[1] == 'a')) && ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8))) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+                else if ((pvrHeader->channels[0] == 'r') && (pvrHeader->channels[1] == 'g') && (pvrHeader->channels[2] == 'b'))
+                {
+                    if (pvrHeader->channels[3] == 'a')
+                    {
+                        if ((pvrHeader->channelDepth[0] == 5) && (pvrHeader->channelDepth[1] == 5) && (pvrHeader->channelDepth[2] == 5) && (pvrHeader->channelDepth[3] == 1)) image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
+                        else if ((pvrHeader->channelDepth[0] == 4) && (pvrHeader->channelDepth[1] == 4) && (pvrHeader->channelDepth[2] == 4) && (pvrHeader->channelDepth[3] == 4)) image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
+                        else if ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8) && (pvrHeader->channelDepth[2] == 8) && (pvrHeader->channelDepth[3] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                    }
+                    else if (pvrHeader->channels[3] == 0)
+                    {
+                        if ((pvrHeader->channelDepth[0] == 5) && (pvrHeader->channelDepth[1] == 6) && (pvrHeader->channelDepth[2] == 5)) image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                        else if ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8) && (pvrHeader->channelDepth[2] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
+                    }
+                }
+                else if (pvrHeader->channels[0] == 2) image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB;
+                else if (pvrHeader->channels[0] == 3) image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA;
+
+                fileDataPtr += pvrHeader->metaDataSize;    // Skip meta data header
+
+                // Calculate data size (depends on format)
+                int bpp = 0;
+                switch (image.format)
+                {
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+                    case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+                    case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+                    default: break;
+                }
+
+                int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                memcpy(image.data, fileDataPtr, dataSize);
+            }
+        }
+        else if (pvrVersion == 52) TRACELOG(LOG_INFO, "IMAGE: PVRv2 format not supported, update your files to PVRv3");
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_ASTC)
+// Load ASTC compressed image data (ASTC compression)
+static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize)
+{
+    unsigned char *fileDataPtr = (unsigned char *)fileData;
+
+    // Required extensions:
+    // GL_KHR_texture_compression_astc_hdr
+    // GL_KHR_texture_compression_astc_ldr
+
+    // Supported tokens (defined by extensions)
+    // GL_COMPRESSED_RGBA_ASTC_4x4_KHR      0x93b0
+    // GL_COMPRESSED_RGBA_ASTC_8x8_KHR      0x93b7
+
+    // ASTC file Header (16 bytes)
+    typedef struct {
+        unsigned char id[4];        // Signature: 0x13 0xAB 0xA1 0x5C
+        unsigned char blockX;       // Block X dimensions
+        unsigned char blockY;       // Block Y dimensions
+        unsigned char blockZ;       // Block Z dimensions (1 for 2D images)
+        unsigned char width[3];     // Image width in pixels (24bit value)
+        unsigned char height[3];    // Image height in pixels (24bit value)
+        unsigned char length[3];    // Image Z-size (1 for 2D images)
+    } ASTCHeader;
+
+    Image image = { 0 };
+
+    if (fileDataPtr != NULL)
+    {
+        ASTCHeader *astcHeader = (ASTCHeader *)fileDataPtr;
+
+        if ((astcHeader->id[3] != 0x5c) || (astcHeader->id[2] != 0xa1) || (astcHeader->id[1] != 0xab) || (astcHeader->id[0] != 0x13))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: ASTC file data not valid");
+        }
+        else
+        {
+            fileDataPtr += sizeof(ASTCHeader);   // Skip header
+
+            // NOTE: Assuming Little Endian (could it be wrong?)
+            image.width = 0x00000000 | ((int)astcHeader->width[2] << 16) | ((int)astcHeader->width[1] << 8) | ((int)astcHeader->width[0]);
+            image.height = 0x00000000 | ((int)astcHeader->height[2] << 16) | ((int)astcHeader->height[1] << 8) | ((int)astcHeader->height[0]);
+
+            TRACELOGD("IMAGE: ASTC file data info:");
+            TRACELOGD("    > Image width:  %i", image.width);
+            TRACELOGD("    > Image height: %i", image.height);
+            TRACELOGD("    > Image blocks: %ix%i", astcHeader->blockX, astcHeader->blockY);
+
+            image.mipmaps = 1;      // NOTE: ASTC format only contains one mipmap level
+
+            // NOTE: Each block is always stored in 128bit so we can calculate the bpp
+            int bpp = 128/(astcHeader->blockX*astcHeader->blockY);
+
+            // NOTE: Currently we only support 2 blocks configurations: 4x4 and 8x8
+            if ((bpp == 8) || (bpp == 2))
+            {
+                int dataSize = image.width*image.height*bpp/8;  // Data size in bytes
+
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                memcpy(image.data, fileDataPtr, dataSize);
+
+                if (bpp == 8) image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA;
+                else if (bpp == 2) image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
+            }
+            else TRACELOG(LOG_WARNING, "IMAGE: ASTC block size configuration not supported");
+        }
+    }
+
+    return image;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_UTEX)
+// Load UTEX file data, block data transcoded to best GPU supported format
+// NOTE: Transcoding priority: DXT (no transcoding) > ETC2 > ETC1 (no alpha) > uncompressed (R5G6B5 or R8G8B8A8)
+static Image LoadUTEX(const unsigned char *fileData, unsigned int fileSize)
+{
+    Image image = { 0 };
+
+    if ((fileData != NULL) && (fileSize >= sizeof(UTEXHeader)))
+    {
+        UTEXHeader *utexHeader = (UTEXHeader *)fileData;
+
+        if ((strncmp(utexHeader->id, "UTEX", 4) != 0) || (utexHeader->version != 100))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: UTEX file data not valid");
+        }
+        else
+        {
+            image.width = utexHeader->width;
+            image.height = utexHeader->height;
+            image.mipmaps = utexHeader->mipmaps;
+            image.format = (utexHeader->flags & UTEX_FLAG_ALPHA)? PIXELFORMAT_COMPRESSED_DXT5_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB;
+
+            TRACELOGD("IMAGE: UTEX file data info:");
+            TRACELOGD("    > Image width:  %i", image.width);
+            TRACELOGD("    > Image height: %i", image.height);
+            TRACELOGD("    > Image mipmaps: %i", image.mipmaps);
+            TRACELOGD("    > Image alpha: %s", (utexHeader->flags & UTEX_FLAG_ALPHA)? "yes" : "no");
+
+            // Check block data size matches image description
+            unsigned int dataSize = 0;
+            for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+            {
+                dataSize += GetPixelDataSize(width, height, image.format);
+
+                width /= 2;
+                height /= 2;
+                if (width < 1) width = 1;
+                if (height < 1) height = 1;
+            }
+
+            const unsigned char *blockData = fileData + sizeof(UTEXHeader);
+            unsigned int blockDataSize = fileSize - sizeof(UTEXHeader);
+
+            if ((dataSize == 0) || (dataSize != utexHeader->dataSize)) TRACELOG(LOG_WARNING, "IMAGE: UTEX file data size not valid");
+            else if (utexHeader->flags & UTEX_FLAG_DEFLATE)
+            {
+#if defined(SUPPORT_COMPRESSION_API)
+                image.data = RL_MALLOC(dataSize);
+
+                if (sinflate(image.data, dataSize, blockData, blockDataSize) != (int)dataSize)
+                {
+                    TRACELOG(LOG_WARNING, "IMAGE: UTEX file data could not be decompressed");
+                    RL_FREE(image.data);
+                    image.data = NULL;
+                }
+#else
+                TRACELOG(LOG_WARNING, "IMAGE: UTEX supercompressed data requires compression API");
+#endif
+            }
+            else if (blockDataSize >= dataSize)
+            {
+                image.data = RL_MALLOC(dataSize);
+                memcpy(image.data, blockData, dataSize);
+            }
+            else TRACELOG(LOG_WARNING, "IMAGE: UTEX file data size not valid");
+
+            if (image.data != NULL)
+            {
+                // Transcode to best GPU supported format
+                int format = image.format;
+
+                if (utexHeader->flags & UTEX_FLAG_ALPHA)
+                {
+                    if (rlIsPixelFormatSupported(PIXELFORMAT_COMPRESSED_DXT5_RGBA)) format = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+                    else if (rlIsPixelFormatSupported(PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)) format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+                    else format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+                }
+                else
+                {
+                    if (rlIsPixelFormatSupported(PIXELFORMAT_COMPRESSED_DXT1_RGB)) format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
+                    else if (rlIsPixelFormatSupported(PIXELFORMAT_COMPRESSED_ETC2_RGB)) format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
+                    else if (rlIsPixelFormatSupported(PIXELFORMAT_COMPRESSED_ETC1_RGB)) format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
+                    else format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                }
+
+                if (format != image.format)
+                {
+                    TRACELOGD("IMAGE: UTEX data transcoded: %s -> %s", rlGetPixelFormatName(image.format), rlGetPixelFormatName(format));
+                    ImageFormat(&image, format);
+                }
+            }
+        }
+    }
+
+    return image;
+}
+
+// Save image data as UTEX file
+// NOTE: Image encoded as DXT1 (no alpha) or DXT5 blocks, supercompressed with DEFLATE if available
+static int SaveUTEX(Image image, const char *fileName)
+{
+    int success = 0;
+    Image blocks = ImageCopy(image);
+
+    if ((blocks.format != PIXELFORMAT_COMPRESSED_DXT1_RGB) && (blocks.format != PIXELFORMAT_COMPRESSED_DXT5_RGBA))
+    {
+        if (IsBlockFormatDecodable(blocks.format) || (blocks.format < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            ImageFormat(&blocks, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            // Check alpha usage to select block format
+            bool alpha = false;
+            for (int i = 0; i < blocks.width*blocks.height; i++)
+            {
+                if (((unsigned char *)blocks.data)[i*4 + 3] < 255) { alpha = true; break; }
+            }
+
+            ImageFormat(&blocks, alpha? PIXELFORMAT_COMPRESSED_DXT5_RGBA : PIXELFORMAT_COMPRESSED_DXT1_RGB);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Pixel format not supported for UTEX export (%s)", rlGetPixelFormatName(image.format));
+            UnloadImage(blocks);
+            return success;
+        }
+    }
+
+    UTEXHeader utexHeader = { 0 };
+    memcpy(utexHeader.id, "UTEX", 4);
+    utexHeader.version = 100;
+    utexHeader.flags = (blocks.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)? UTEX_FLAG_ALPHA : 0;
+    utexHeader.width = blocks.width;
+    utexHeader.height = blocks.height;
+    utexHeader.mipmaps = blocks.mipmaps;
+
+    for (int i = 0, width = blocks.width, height = blocks.height; i < blocks.mipmaps; i++)
+    {
+        utexHeader.dataSize += GetPixelDataSize(width, height, blocks.format);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    unsigned char *blockData = (unsigned char *)blocks.data;
+    int blockDataSize = utexHeader.dataSize;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    int compDataSize = 0;
+    unsigned char *compData = CompressData(blockData, blockDataSize, &compDataSize);
+
+    if ((compData != NULL) && (compDataSize > 0) && (compDataSize < blockDataSize))
+    {
+        utexHeader.flags |= UTEX_FLAG_DEFLATE;
+        blockData = compData;
+        blockDataSize = compDataSize;
+    }
+#endif
+
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(sizeof(UTEXHeader) + blockDataSize);
+    memcpy(fileData, &utexHeader, sizeof(UTEXHeader));
+    memcpy(fileData + sizeof(UTEXHeader), blockData, blockDataSize);
+
+    success = SaveFileData(fileName, fileData, sizeof(UTEXHeader) + blockDataSize);
+
+    RL_FREE(fileData);
+#if defined(SUPPORT_COMPRESSION_API)
+    RL_FREE(compData);
+#endif
+    UnloadImage(blocks);
+
+    return success;
+}
+#endif
+
+// Check if pixel format can be encoded by image block codecs (ImageFormat())
+static bool IsBlockFormatEncodable(int format)
+{
+    return ((format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+            (format == PIXELFORMAT_COMPRESSED_DXT3_RGBA) || (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) ||
+            (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) || (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) ||
+            (format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA));
+}
+
+// Check if pixel format can be decoded by image block codecs (ImageFormat())
+static bool IsBlockFormatDecodable(int format)
+{
+    return ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format <= PIXELFORMAT_COMPRESSED_DXT5_RGBA));
+}
+
+// Convert image data between R8G8B8A8 and block compressed formats, all mipmap levels
+// NOTE: Used to encode (R8G8B8A8 -> blocks), decode (blocks -> R8G8B8A8) and transcode (blocks -> blocks)
+static void *ConvertImageBlocks(Image image, int newFormat)
+{
+    int srcBlockSize = (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 0 : GetPixelDataSize(4, 4, image.format);
+    int dstBlockSize = (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 0 : GetPixelDataSize(4, 4, newFormat);
+
+    int dataSize = 0;
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, newFormat);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+    const unsigned char *srcLevel = (const unsigned char *)image.data;
+    unsigned char *dstLevel = data;
+    int width = image.width;
+    int height = image.height;
+
+    for (int i = 0; i < image.mipmaps; i++)
+    {
+        int blocksX = (width + 3)/4;
+        int blocksY = (height + 3)/4;
+
+        for (int by = 0; by < blocksY; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                unsigned char rgba[64] = { 0 };     // Block pixels, row by row
+
+                if (srcBlockSize == 0)
+                {
+                    // NOTE: Pixels outside the image (partial blocks) replicate the border pixels
+                    for (int y = 0; y < 4; y++)
+                    {
+                        for (int x = 0; x < 4; x++)
+                        {
+                            int px = ((bx*4 + x) < width)? (bx*4 + x) : (width - 1);
+                            int py = ((by*4 + y) < height)? (by*4 + y) : (height - 1);
+                            memcpy(rgba + (y*4 + x)*4, srcLevel + (py*width + px)*4, 4);
+                        }
+                    }
+                }
+                else DecodeBlock(srcLevel + (by*blocksX + bx)*srcBlockSize, image.format, rgba);
+
+                if (dstBlockSize == 0)
+                {
+                    for (int y = 0; (y < 4) && ((by*4 + y) < height); y++)
+                    {
+                        for (int x = 0; (x < 4) && ((bx*4 + x) < width); x++)
+                        {
+                            memcpy(dstLevel + ((by*4 + y)*width + bx*4 + x)*4, rgba + (y*4 + x)*4, 4);
                         }
+                    }
+                }
+                else EncodeBlock(rgba, newFormat, dstLevel + (by*blocksX + bx)*dstBlockSize);
+            }
+        }
+
+        srcLevel += GetPixelDataSize(width, height, image.format);
+        dstLevel += GetPixelDataSize(width, height, newFormat);
+
+        width /= 2;
+        height /= 2;
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    return data;
+}
+
+// Encode 4x4 pixels block (R8G8B8A8, row by row) into compressed block
+static void EncodeBlock(const unsigned char *rgba, int format, unsigned char *block)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB: EncodeBlockColorDXT(rgba, block, false); break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA: EncodeBlockColorDXT(rgba, block, true); break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        {
+            // Explicit 4 bit alpha per pixel
+            for (int i = 0; i < 8; i++) block[i] = ((rgba[(i*2)*4 + 3] + 8)/17) | (((rgba[(i*2 + 1)*4 + 3] + 8)/17) << 4);
+            EncodeBlockColorDXT(rgba, block + 8, false);
+        } break;
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        {
+            EncodeBlockAlphaDXT5(rgba, block);
+            EncodeBlockColorDXT(rgba, block + 8, false);
+        } break;
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB: EncodeBlockColorETC1(rgba, block); break;
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        {
+            EncodeBlockAlphaEAC(rgba, block);
+            EncodeBlockColorETC1(rgba, block + 8);
+        } break;
+        default: break;
+    }
+}
+
+// Decode compressed block into 4x4 pixels block (R8G8B8A8, row by row)
+// NOTE: Only DXT formats supported
+static void DecodeBlock(const unsigned char *block, int format, unsigned char *rgba)
+{
+    const unsigned char *colorBlock = (format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA)? block + 8 : block;
+
+    unsigned short c0 = colorBlock[0] | (colorBlock[1] << 8);
+    unsigned short c1 = colorBlock[2] | (colorBlock[3] << 8);
+    unsigned int indices = colorBlock[4] | (colorBlock[5] << 8) | (colorBlock[6] << 16) | ((unsigned int)colorBlock[7] << 24);
+
+    unsigned char palette[4][4] = { 0 };
+    UnpackColorR5G6B5(c0, palette[0]);
+    UnpackColorR5G6B5(c1, palette[1]);
+
+    // NOTE: DXT3 and DXT5 color blocks always use 4 colors mode
+    if ((c0 > c1) || (format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA))
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    }
+    else
+    {
+        for (int c = 0; c < 3; c++) palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        palette[2][3] = 255;
+        palette[3][3] = (format == PIXELFORMAT_COMPRESSED_DXT1_RGB)? 255 : 0;   // Black or transparent
+    }
+
+    for (int i = 0; i < 16; i++) memcpy(rgba + i*4, palette[(indices >> (i*2)) & 0x03], 4);
+
+    if (format == PIXELFORMAT_COMPRESSED_DXT3_RGBA)
+    {
+        for (int i = 0; i < 16; i++) rgba[i*4 + 3] = ((block[i/2] >> ((i%2)*4)) & 0x0f)*17;
+    }
+    else if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)
+    {
+        unsigned char alphas[8] = { block[0], block[1], 0 };
+
+        if (alphas[0] > alphas[1]) for (int i = 2; i < 8; i++) alphas[i] = ((8 - i)*alphas[0] + (i - 1)*alphas[1])/7;
+        else
+        {
+            for (int i = 2; i < 6; i++) alphas[i] = ((6 - i)*alphas[0] + (i - 1)*alphas[1])/5;
+            alphas[6] = 0;
+            alphas[7] = 255;
+        }
+
+        unsigned long long alphaIndices = 0;
+        for (int i = 0; i < 6; i++) alphaIndices |= (unsigned long long)block[2 + i] << (i*8);
+
+        for (int i = 0; i < 16; i++) rgba[i*4 + 3] = alphas[(alphaIndices >> (i*3)) & 0x07];
+    }
+}
+
+// Unpack R5G6B5 color into R8G8B8A8
+static void UnpackColorR5G6B5(unsigned short color, unsigned char *rgba)
+{
+    unsigned char r = (color >> 11) & 0x1f;
+    unsigned char g = (color >> 5) & 0x3f;
+    unsigned char b = color & 0x1f;
+
+    rgba[0] = (r << 3) | (r >> 2);
+    rgba[1] = (g << 2) | (g >> 4);
+    rgba[2] = (b << 3) | (b >> 2);
+    rgba[3] = 255;
+}
+
+// Encode DXT color block (8 bytes): two R5G6B5 endpoints and 2 bit indices
+// NOTE: Endpoints fitted along colors principal axis, punch-through alpha uses 3 colors mode (DXT1 RGBA)
+static void EncodeBlockColorDXT(const unsigned char *rgba, unsigned char *block, bool punchAlpha)
+{
+    float mean[3] = { 0 };
+    int count = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (punchAlpha && (rgba[i*4 + 3] < 128)) continue;
+
+        for (int c = 0; c < 3; c++) mean[c] += rgba[i*4 + c];
+        count++;
+    }
+
+    if (count == 0)
+    {
+        // All pixels transparent: 3 colors mode, all indices transparent
+        memset(block, 0, 4);
+        memset(block + 4, 0xff, 4);
+        return;
+    }
+
+    for (int c = 0; c < 3; c++) mean[c] /= (float)count;
+
+    // Colors covariance matrix (symmetric, upper triangle)
+    float cov[6] = { 0 };
+    for (int i = 0; i < 16; i++)
+    {
+        if (punchAlpha && (rgba[i*4 + 3] < 128)) continue;
+
+        float r = rgba[i*4] - mean[0];
+        float g = rgba[i*4 + 1] - mean[1];
+        float b = rgba[i*4 + 2] - mean[2];
+
+        cov[0] += r*r; cov[1] += r*g; cov[2] += r*b;
+        cov[3] += g*g; cov[4] += g*b; cov[5] += b*b;
+    }
+
+    // Principal axis by power iteration
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (int k = 0; k < 4; k++)
+    {
+        float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+        float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+        float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+        float length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
+
+        if (length < 1e-6f) break;
+
+        axis[0] = x/length;
+        axis[1] = y/length;
+        axis[2] = z/length;
+    }
+
+    // Endpoints: extreme colors along axis, inset to reduce quantization error
+    float minProj = 1e9f, maxProj = -1e9f;
+    int minIndex = 0, maxIndex = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        if (punchAlpha && (rgba[i*4 + 3] < 128)) continue;
+
+        float proj = (rgba[i*4] - mean[0])*axis[0] + (rgba[i*4 + 1] - mean[1])*axis[1] + (rgba[i*4 + 2] - mean[2])*axis[2];
+
+        if (proj < minProj) { minProj = proj; minIndex = i; }
+        if (proj > maxProj) { maxProj = proj; maxIndex = i; }
+    }
+
+    unsigned short endpoints[2] = { 0 };
+    for (int e = 0; e < 2; e++)
+    {
+        const unsigned char *color = rgba + ((e == 0)? maxIndex : minIndex)*4;
+        const unsigned char *other = rgba + ((e == 0)? minIndex : maxIndex)*4;
+        int value[3] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            value[c] = color[c] - (color[c] - other[c])/16;
+            if (value[c] < 0) value[c] = 0;
+            else if (value[c] > 255) value[c] = 255;
+        }
+
+        endpoints[e] = (unsigned short)((((value[0]*31 + 127)/255) << 11) | (((value[1]*63 + 127)/255) << 5) | ((value[2]*31 + 127)/255));
+    }
+
+    // Check transparent pixels, 3 colors mode required (c0 <= c1), 4 colors mode otherwise (c0 > c1)
+    bool transparent = false;
+    for (int i = 0; punchAlpha && (i < 16); i++) if (rgba[i*4 + 3] < 128) transparent = true;
+
+    if ((transparent && (endpoints[0] > endpoints[1])) || (!transparent && (endpoints[0] < endpoints[1])))
+    {
+        unsigned short temp = endpoints[0];
+        endpoints[0] = endpoints[1];
+        endpoints[1] = temp;
+    }
+
+    unsigned char palette[4][4] = { 0 };
+    UnpackColorR5G6B5(endpoints[0], palette[0]);
+    UnpackColorR5G6B5(endpoints[1], palette[1]);
+
+    int paletteCount = 4;
+    if (endpoints[0] > endpoints[1])
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+    }
+    else
+    {
+        for (int c = 0; c < 3; c++) palette[2][c] = (palette[0][c] + palette[1][c])/2;
+        paletteCount = 3;
+    }
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+    unsigned int indices = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 0;
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+        if (transparent && (rgba[i*4 + 3] < 128)) best = 3;
+        else
+        {
+            int bestError = INT_MAX;
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+            for (int p = 0; p < paletteCount; p++)
+            {
+                int dr = rgba[i*4] - palette[p][0];
+                int dg = rgba[i*4 + 1] - palette[p][1];
+                int db = rgba[i*4 + 2] - palette[p][2];
+                int error = dr*dr + dg*dg + db*db;
+
+                if (error < bestError) { bestError = error; best = p; }
+            }
+        }
+
+        indices |= (unsigned int)best << (i*2);
+    }
+
+    block[0] = endpoints[0] & 0xff;
+    block[1] = endpoints[0] >> 8;
+    block[2] = endpoints[1] & 0xff;
+    block[3] = endpoints[1] >> 8;
+    for (int i = 0; i < 4; i++) block[4 + i] = (indices >> (i*8)) & 0xff;
+}
+
+// Encode DXT5 alpha block (8 bytes): two alpha endpoints and 3 bit indices
+static void EncodeBlockAlphaDXT5(const unsigned char *rgba, unsigned char *block)
+{
+    unsigned char minAlpha = 255;
+    unsigned char maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (rgba[i*4 + 3] < minAlpha) minAlpha = rgba[i*4 + 3];
+        if (rgba[i*4 + 3] > maxAlpha) maxAlpha = rgba[i*4 + 3];
+    }
+
+    memset(block, 0, 8);
+    block[0] = maxAlpha;
+    block[1] = minAlpha;
+
+    if (maxAlpha == minAlpha) return;   // All indices select first endpoint
+
+    // 8 alpha values mode (a0 > a1)
+    unsigned char alphas[8] = { maxAlpha, minAlpha, 0 };
+    for (int i = 2; i < 8; i++) alphas[i] = ((8 - i)*alphas[0] + (i - 1)*alphas[1])/7;
+
+    unsigned long long indices = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 0;
+        int bestError = INT_MAX;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int error = abs(rgba[i*4 + 3] - alphas[k]);
+            if (error < bestError) { bestError = error; best = k; }
+        }
+
+        indices |= (unsigned long long)best << (i*3);
+    }
+
+    for (int i = 0; i < 6; i++) block[2 + i] = (indices >> (i*8)) & 0xff;
+}
+
+// Encode ETC1 color block (8 bytes), also valid as ETC2 RGB block
+// NOTE: Sub-blocks split (flip) and base colors mode (differential or individual) selected by error
+static void EncodeBlockColorETC1(const unsigned char *rgba, unsigned char *block)
+{
+    static const int modifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    unsigned int bestHigh = 0;
+    unsigned int bestLow = 0;
+    int bestError = INT_MAX;
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        // Sub-blocks average colors
+        // NOTE: flip = 0: two 2x4 sub-blocks side by side, flip = 1: two 4x2 sub-blocks on top of each other
+        float average[2][3] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            int sub = flip? ((i/4) >= 2) : ((i%4) >= 2);
+            for (int c = 0; c < 3; c++) average[sub][c] += rgba[i*4 + c]/8.0f;
+        }
+
+        // Base colors, differential mode (5 bit and 3 bit delta) if possible, individual mode (4 bit) otherwise
+        int base5[2][3] = { 0 };
+        bool differential = true;
+        for (int s = 0; s < 2; s++) for (int c = 0; c < 3; c++) base5[s][c] = (int)(average[s][c]*31.0f/255.0f + 0.5f);
+        for (int c = 0; c < 3; c++) if (((base5[1][c] - base5[0][c]) < -4) || ((base5[1][c] - base5[0][c]) > 3)) differential = false;
+
+        int base[2][3] = { 0 };
+        unsigned int high = 0;
+
+        if (differential)
+        {
+            for (int s = 0; s < 2; s++) for (int c = 0; c < 3; c++) base[s][c] = (base5[s][c] << 3) | (base5[s][c] >> 2);
+
+            for (int c = 0; c < 3; c++) high |= ((unsigned int)base5[0][c] << (27 - c*8)) | ((unsigned int)((base5[1][c] - base5[0][c]) & 0x07) << (24 - c*8));
+            high |= 0x02;
+        }
+        else
+        {
+            for (int s = 0; s < 2; s++)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    int base4 = (int)(average[s][c]*15.0f/255.0f + 0.5f);
+                    base[s][c] = base4*17;
+                    high |= (unsigned int)base4 << (28 - s*4 - c*8);
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+            }
+        }
+
+        high |= flip;
+
+        // Intensity modifiers table per sub-block, modifier per pixel
+        unsigned int low = 0;
+        int error = 0;
+
+        for (int s = 0; s < 2; s++)
+        {
+            int subBestError = INT_MAX;
+            int subBestTable = 0;
+            unsigned int subBestLow = 0;
+
+            for (int t = 0; t < 8; t++)
+            {
+                int subError = 0;
+                unsigned int subLow = 0;
+
+                for (int i = 0; i < 16; i++)
                 {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    int x = i%4;
+                    int y = i/4;
+                    if ((flip? (y >= 2) : (x >= 2)) != s) continue;
+
+                    int pixelBestError = INT_MAX;
+                    int pixelBest = 0;
+
+                    // NOTE: Modifier index: 0: +a, 1: +b, 2: -a, 3: -b
+                    for (int m = 0; m < 4; m++)
                     {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        int modifier = (m < 2)? modifiers[t][m] : -modifiers[t][m - 2];
+                        int pixelError = 0;
+
+                        for (int c = 0; c < 3; c++)
+                        {
+                            int value = base[s][c] + modifier;
+                            if (value < 0) value = 0;
+                            else if (value > 255) value = 255;
+
+                            pixelError += (value - rgba[i*4 + c])*(value - rgba[i*4 + c]);
+                        }
+
+                        if (pixelError < pixelBestError) { pixelBestError = pixelError; pixelBest = m; }
                     }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+
+                    // NOTE: Pixels indexed by columns, index LSB on bits 0-15, MSB on bits 16-31
+                    subError += pixelBestError;
+                    subLow |= ((unsigned int)(pixelBest & 0x01) << (x*4 + y)) | ((unsigned int)(pixelBest >> 1) << (x*4 + y + 16));
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+
+                if (subError < subBestError)
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
-                    }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    subBestError = subError;
+                    subBestTable = t;
+                    subBestLow = subLow;
                 }
-            rlEnd();
-        rlPopMatrix();
+            }
 
-        rlSetTexture(0);
+            error += subBestError;
+            low |= subBestLow;
+            high |= (unsigned int)subBestTable << (5 - s*3);
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            bestHigh = high;
+            bestLow = low;
+        }
+    }
+
+    // NOTE: ETC blocks are stored big endian
+    for (int i = 0; i < 4; i++)
+    {
+        block[i] = (bestHigh >> (24 - i*8)) & 0xff;
+        block[4 + i] = (bestLow >> (24 - i*8)) & 0xff;
     }
 }
 
-// Draw textured polygon, defined by vertex and texturecoordinates
-// NOTE: Polygon center must have straight line path to all points
-// without crossing perimeter, points must be in anticlockwise order
-void DrawTexturePoly(Texture2D texture, Vector2 center, Vector2 *points, Vector2 *texcoords, int pointCount, Color tint)
+// Encode ETC2 EAC alpha block (8 bytes): base value, multiplier, modifiers table and 3 bit indices
+static void EncodeBlockAlphaEAC(const unsigned char *rgba, unsigned char *block)
 {
-    rlCheckRenderBatchLimit((pointCount - 1)*4);
+    static const int modifiers[16][8] = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
 
-    rlSetTexture(texture.id);
+    int minAlpha = 255;
+    int maxAlpha = 0;
 
-    // Texturing is only supported on QUADs
-    rlBegin(RL_QUADS);
+    for (int i = 0; i < 16; i++)
+    {
+        if (rgba[i*4 + 3] < minAlpha) minAlpha = rgba[i*4 + 3];
+        if (rgba[i*4 + 3] > maxAlpha) maxAlpha = rgba[i*4 + 3];
+    }
+
+    unsigned long long bestBits = 0;
+    int bestError = INT_MAX;
+
+    for (int t = 0; (t < 16) && (bestError > 0); t++)
+    {
+        // Multiplier scales table range to block alpha range, base centers it
+        int span = modifiers[t][7] - modifiers[t][3];
+        int multiplier = (maxAlpha - minAlpha + span/2)/span;
+        if (multiplier < 1) multiplier = 1;
+        else if (multiplier > 15) multiplier = 15;
+
+        int base = (minAlpha + maxAlpha - (modifiers[t][3] + modifiers[t][7])*multiplier + 1)/2;
+        if (base < 0) base = 0;
+        else if (base > 255) base = 255;
+
+        unsigned long long bits = ((unsigned long long)base << 56) | ((unsigned long long)multiplier << 52) | ((unsigned long long)t << 48);
+        int error = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int pixelBestError = INT_MAX;
+            int pixelBest = 0;
+
+            for (int m = 0; m < 8; m++)
+            {
+                int value = base + modifiers[t][m]*multiplier;
+                if (value < 0) value = 0;
+                else if (value > 255) value = 255;
+
+                int pixelError = abs(value - rgba[i*4 + 3]);
+                if (pixelError < pixelBestError) { pixelBestError = pixelError; pixelBest = m; }
+            }
+
+            // NOTE: Pixels indexed by columns, first pixel on most significant bits
+            error += pixelBestError*pixelBestError;
+            bits |= (unsigned long long)pixelBest << (45 - ((i%4)*4 + i/4)*3);
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            bestBits = bits;
+        }
+    }
+
+    // NOTE: ETC blocks are stored big endian
+    for (int i = 0; i < 8; i++) block[i] = (bestBits >> (56 - i*8)) & 0xff;
+}
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
 
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
 
-        for (int i = 0; i < pointCount - 1; i++)
-        {
-            rlTexCoord2f(0.5f, 0.5f);
-            rlVertex2f(center.x, center.y);
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
 
-            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
-            rlVertex2f(points[i].x + center.x, points[i].y + center.y);
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R11G11B10F:
+                {
+                    Vector3 coln = UnpackR11G11B10F(((unsigned int *)image.data)[i]);
 
-            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
-            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+                    pixels[i].x = coln.x;
+                    pixels[i].y = coln.y;
+                    pixels[i].z = coln.z;
+                    pixels[i].w = 1.0f;
 
-            rlTexCoord2f(texcoords[i + 1].x, texcoords[i + 1].y);
-            rlVertex2f(points[i + 1].x + center.x, points[i + 1].y + center.y);
+                } break;
+                default: break;
+            }
         }
-    rlEnd();
+    }
 
-    rlSetTexture(0);
+    return pixels;
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color Fade(Color color, float alpha)
+// Convert image pixels between uncompressed formats up to 8 bit per channel with integer kernels
+// NOTE: Returns NULL if formats are not supported (float/HDR formats), pixels are converted in chunks through R8G8B8A8
+static void *ConvertImagePixels(Image image, int newFormat)
 {
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    if ((image.format > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (newFormat > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return NULL;
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
-}
+    ImageKernelData data = { 0 };
+    data.src = (unsigned char *)image.data;
+    data.dst = (unsigned char *)RL_MALLOC(GetPixelDataSize(image.width, image.height, newFormat));
+    data.width = image.width;
+    data.height = image.height;
+    data.srcFormat = image.format;
+    data.dstFormat = newFormat;
 
-// Get hexadecimal value for a Color
-int ColorToInt(Color color)
-{
-    return (((int)color.r << 24) | ((int)color.g << 16) | ((int)color.b << 8) | (int)color.a);
+    RunImageKernel(ConvertPixelsKernel, &data);
+
+    return data.dst;
 }
 
-// Get color normalized as float [0..1]
-Vector4 ColorNormalize(Color color)
+// Load image pixels as temporary Color array (scratch memory), released with MemFreeScratch()
+// NOTE: Formats not supported by integer kernels and mipmapped images use LoadImageColors() (heap)
+static Color *LoadImageColorsScratch(Image image)
 {
-    Vector4 result;
-
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+    if ((image.width == 0) || (image.height == 0)) return NULL;
 
-    return result;
-}
+    if ((image.format > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (image.mipmaps > 1)) return LoadImageColors(image);
 
-// Get color from normalized values [0..1]
-Color ColorFromNormalized(Vector4 normalized)
-{
-    Color result;
+    ImageKernelData data = { 0 };
+    data.src = (unsigned char *)image.data;
+    data.dst = (unsigned char *)MemAllocScratch(image.width*image.height*sizeof(Color));
+    data.width = image.width;
+    data.height = image.height;
+    data.srcFormat = image.format;
+    data.dstFormat = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    RunImageKernel(ConvertPixelsKernel, &data);
 
-    return result;
+    return (Color *)data.dst;
 }
 
-// Get HSV values for a Color
-// NOTE: Hue is returned as degrees [0..360]
-Vector3 ColorToHSV(Color color)
+// Get color key, packed RGBA with channels mask, transparent colors share key 0
+static unsigned int GetColorKey(Color color, unsigned int mask)
 {
-    Vector3 hsv = { 0 };
-    Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min, max, delta;
+    if (color.a == 0) return 0;
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
+    return ((unsigned int)color.r | ((unsigned int)color.g << 8) | ((unsigned int)color.b << 16) | ((unsigned int)color.a << 24)) & mask;
+}
 
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Get color histogram bin for key (open addressing, linear probing), empty slot returned if not found
+// NOTE: Hash table capacity must be a power of two, with at least one empty slot
+static ColorBin *GetColorBin(ColorBin *bins, unsigned int capacity, unsigned int key)
+{
+    unsigned int slot = (key*2654435761u) & (capacity - 1);
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    while ((bins[slot].count > 0) && (bins[slot].key != key)) slot = (slot + 1) & (capacity - 1);
 
-    if (delta < 0.00001f)
-    {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
-    }
+    return &bins[slot];
+}
 
-    if (max > 0.0f)
-    {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
-    }
-    else
-    {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
-    }
+// Load pixels into color histogram, returns bins count
+// NOTE: In case of more colors than maxBins (maxBins <= capacity/2), lowest bit of every channel is masked and histogram reloaded
+static int LoadColorHistogram(const Color *pixels, int count, ColorBin *bins, unsigned int capacity, int maxBins, unsigned int *mask)
+{
+    int binCount = 0;
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
+    while (true)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
-    }
-
-    hsv.x *= 60.0f;     // Convert to degrees
+        bool fits = true;
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+        memset(bins, 0, capacity*sizeof(ColorBin));
+        binCount = 0;
 
-    return hsv;
-}
+        for (int i = 0; i < count; i++)
+        {
+            ColorBin *bin = GetColorBin(bins, capacity, GetColorKey(pixels[i], *mask));
 
-// Get a Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: Color->HSV->Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-Color ColorFromHSV(float hue, float saturation, float value)
-{
-    Color color = { 0, 0, 0, 255 };
+            if (bin->count == 0)
+            {
+                if (binCount >= maxBins)
+                {
+                    fits = false;
+                    break;
+                }
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+                bin->key = GetColorKey(pixels[i], *mask);
+                binCount++;
+            }
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+            bin->count++;
+            bin->sum[0] += pixels[i].r;
+            bin->sum[1] += pixels[i].g;
+            bin->sum[2] += pixels[i].b;
+            bin->sum[3] += pixels[i].a;
+        }
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+        if (fits) break;
 
-    return color;
-}
+        *mask = (*mask << 1) & 0xfefefefe;
+    }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-Color ColorAlpha(Color color, float alpha)
-{
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+    if (*mask != 0xffffffff) TRACELOG(LOG_DEBUG, "IMAGE: Quantization colors precision reduced (mask: 0x%08x)", *mask);
 
-    return (Color){color.r, color.g, color.b, (unsigned char)(255.0f*alpha)};
+    return binCount;
 }
+#endif
 
-// Get src alpha-blended into dst color with tint
-Color ColorAlphaBlend(Color dst, Color src, Color tint)
+// Store Color array loaded with LoadImageColorsScratch() back into image data, image format is kept
+// NOTE: Pixels are converted in place into image data, pixels loaded from the heap become image data (mipmaps regenerated)
+static void StoreImageColors(Image *image, Color *pixels)
 {
-    Color out = WHITE;
-
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
-
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+    if ((image->format > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (image->mipmaps > 1))
     {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        int format = image->format;
+        RL_FREE(image->data);
 
-        if (out.a > 0)
-        {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-        }
+        image->data = pixels;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+        ImageFormat(image, format);
     }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
     else
     {
-        Vector4 fdst = ColorNormalize(dst);
-        Vector4 fsrc = ColorNormalize(src);
-        Vector4 ftint = ColorNormalize(tint);
-        Vector4 fout = { 0 };
-
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+        ImageKernelData data = { 0 };
+        data.src = (unsigned char *)pixels;
+        data.dst = (unsigned char *)image->data;
+        data.width = image->width;
+        data.height = image->height;
+        data.srcFormat = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        data.dstFormat = image->format;
 
-        if (fout.w > 0.0f)
-        {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
-        }
+        RunImageKernel(ConvertPixelsKernel, &data);
 
-        out = (Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+        MemFreeScratch(pixels);
     }
-#endif
-
-    return out;
-}
-
-// Get a Color struct from hexadecimal value
-Color GetColor(unsigned int hexValue)
-{
-    Color color;
-
-    color.r = (unsigned char)(hexValue >> 24) & 0xFF;
-    color.g = (unsigned char)(hexValue >> 16) & 0xFF;
-    color.b = (unsigned char)(hexValue >> 8) & 0xFF;
-    color.a = (unsigned char)hexValue & 0xFF;
-
-    return color;
 }
 
-// Get color from a pixel from certain format
-Color GetPixelColor(void *srcPtr, int format)
+// Unpack pixels (up to 8 bit per channel) into R8G8B8A8
+// NOTE: Channels with less than 8 bit are expanded with rounding
+static void UnpackPixelsRGBA8(const void *src, int format, unsigned char *rgba, int count)
 {
-    Color color = { 0 };
+    const unsigned char *bytes = (const unsigned char *)src;
+    const unsigned short *shorts = (const unsigned short *)src;
 
     switch (format)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
-
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                rgba[0] = bytes[i];
+                rgba[1] = bytes[i];
+                rgba[2] = bytes[i];
+                rgba[3] = 255;
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
-
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                rgba[0] = bytes[i*2];
+                rgba[1] = bytes[i*2];
+                rgba[2] = bytes[i*2];
+                rgba[3] = bytes[i*2 + 1];
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                unsigned short pixel = shorts[i];
 
+                rgba[0] = (unsigned char)((((pixel >> 11) & 0x1f)*255 + 15)/31);
+                rgba[1] = (unsigned char)((((pixel >> 5) & 0x3f)*255 + 31)/63);
+                rgba[2] = (unsigned char)(((pixel & 0x1f)*255 + 15)/31);
+                rgba[3] = 255;
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                rgba[0] = bytes[i*3];
+                rgba[1] = bytes[i*3 + 1];
+                rgba[2] = bytes[i*3 + 2];
+                rgba[3] = 255;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                unsigned short pixel = shorts[i];
 
+                rgba[0] = (unsigned char)((((pixel >> 11) & 0x1f)*255 + 15)/31);
+                rgba[1] = (unsigned char)((((pixel >> 6) & 0x1f)*255 + 15)/31);
+                rgba[2] = (unsigned char)((((pixel >> 1) & 0x1f)*255 + 15)/31);
+                rgba[3] = (pixel & 0x1)? 255 : 0;
+            }
         } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+            for (int i = 0; i < count; i++, rgba += 4)
+            {
+                unsigned short pixel = shorts[i];
 
+                rgba[0] = (unsigned char)(((pixel >> 12) & 0xf)*17);
+                rgba[1] = (unsigned char)(((pixel >> 8) & 0xf)*17);
+                rgba[2] = (unsigned char)(((pixel >> 4) & 0xf)*17);
+                rgba[3] = (unsigned char)((pixel & 0xf)*17);
+            }
         } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(rgba, src, count*4); break;
         default: break;
     }
-
-    return color;
 }
 
-// Set pixel color formatted into destination pointer
-void SetPixelColor(void *dstPtr, Color color, int format)
+// Pack R8G8B8A8 pixels into format (up to 8 bit per channel)
+// NOTE: Channels with less than 8 bit are quantized with rounding, 16 bit formats use SSE2/NEON if available
+static void PackPixelsRGBA8(const unsigned char *rgba, int format, void *dst, int count)
 {
+    unsigned char *bytes = (unsigned char *)dst;
+    unsigned short *shorts = (unsigned short *)dst;
+
+    // Quantize 8 bit value to bits precision: round(value*max/255), exact division by 255 for values up to 65535
+    #define QUANTIZE_CHANNEL(value, max)  ((((value)*(max) + 127) + ((((value)*(max) + 127)) >> 8) + 1) >> 8)
+
+    int i = 0;
+
     switch (format)
     {
         case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-
+            // NOTE: Luminance weights (0.299, 0.587, 0.114) in 16 bit fixed point
+            for (; i < count; i++, rgba += 4) bytes[i] = (unsigned char)((rgba[0]*19595 + rgba[1]*38470 + rgba[2]*7471) >> 16);
         } break;
         case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
         {
-            // NOTE: Calculate grayscale equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
-
+            for (; i < count; i++, rgba += 4)
+            {
+                bytes[i*2] = (unsigned char)((rgba[0]*19595 + rgba[1]*38470 + rgba[2]*7471) >> 16);
+                bytes[i*2 + 1] = rgba[3];
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            for (; i < count; i++, rgba += 4)
+            {
+                bytes[i*3] = rgba[0];
+                bytes[i*3 + 1] = rgba[1];
+                bytes[i*3 + 2] = rgba[2];
+            }
         } break;
         case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
         {
-            // NOTE: Calculate R5G6B5 equivalent color
-            Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            // Channels bits precision and position, alpha is thresholded for R5G5B5A1
+            int rMax = 31, gMax = 63, bMax = 31, aMax = 0;
+            int rShift = 11, gShift = 5, bShift = 0, aShift = 0;
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) { gMax = 31; gShift = 6; bShift = 1; }
+            else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4)
+            {
+                rMax = 15; gMax = 15; bMax = 15; aMax = 15;
+                rShift = 12; gShift = 8; bShift = 4;
+            }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+#if defined(IMAGE_SIMD_SSE2)
+            const __m128i mask = _mm_set1_epi32(0xff);
+            const __m128i bias = _mm_set1_epi32(127);
+            const __m128i one = _mm_set1_epi32(1);
+            const __m128i threshold = _mm_set1_epi32(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            for (; i + 8 <= count; i += 8, rgba += 32)
+            {
+                __m128i packed[2] = { 0 };
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                for (int k = 0; k < 2; k++)
+                {
+                    __m128i pixels = _mm_loadu_si128((const __m128i *)(rgba + k*16));
+                    __m128i channels[4] = {
+                        _mm_and_si128(pixels, mask),
+                        _mm_and_si128(_mm_srli_epi32(pixels, 8), mask),
+                        _mm_and_si128(_mm_srli_epi32(pixels, 16), mask),
+                        _mm_srli_epi32(pixels, 24)
+                    };
+                    int max[4] = { rMax, gMax, bMax, aMax };
+                    int shift[4] = { rShift, gShift, bShift, aShift };
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        if (max[c] == 0) continue;
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        // NOTE: Products fit in 16 bit, so 16 bit multiplication is enough
+                        __m128i value = _mm_add_epi32(_mm_mullo_epi16(channels[c], _mm_set1_epi32(max[c])), bias);
+                        value = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(value, _mm_srli_epi32(value, 8)), one), 8);
+                        packed[k] = _mm_or_si128(packed[k], _mm_slli_epi32(value, shift[c]));
+                    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+                    if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) packed[k] = _mm_or_si128(packed[k], _mm_and_si128(_mm_cmpgt_epi32(channels[3], threshold), one));
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+                    // Sign extend 16 bit values, so signed saturation keeps them unchanged
+                    packed[k] = _mm_srai_epi32(_mm_slli_epi32(packed[k], 16), 16);
+                }
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                _mm_storeu_si128((__m128i *)(shorts + i), _mm_packs_epi32(packed[0], packed[1]));
+            }
+#elif defined(IMAGE_SIMD_NEON)
+            for (; i + 8 <= count; i += 8, rgba += 32)
+            {
+                uint8x8x4_t pixels = vld4_u8(rgba);
+                uint16x8_t packed = vdupq_n_u16(0);
+                int max[4] = { rMax, gMax, bMax, aMax };
+                int shift[4] = { rShift, gShift, bShift, aShift };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+                for (int c = 0; c < 4; c++)
+                {
+                    if (max[c] == 0) continue;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+                    uint16x8_t value = vmlal_u8(vdupq_n_u16(127), pixels.val[c], vdup_n_u8((uint8_t)max[c]));
+                    value = vshrq_n_u16(vaddq_u16(vaddq_u16(value, vshrq_n_u16(value, 8)), vdupq_n_u16(1)), 8);
+                    packed = vorrq_u16(packed, vshlq_u16(value, vdupq_n_s16((int16_t)shift[c])));
+                }
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    uint8x8_t alpha = vcgt_u8(pixels.val[3], vdup_n_u8(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD));
+                    packed = vorrq_u16(packed, vmovl_u8(vand_u8(alpha, vdup_n_u8(1))));
+                }
+
+                vst1q_u16(shorts + i, packed);
+            }
+#endif
+            for (; i < count; i++, rgba += 4)
+            {
+                unsigned short pixel = (unsigned short)((QUANTIZE_CHANNEL(rgba[0], rMax) << rShift) | (QUANTIZE_CHANNEL(rgba[1], gMax) << gShift) | (QUANTIZE_CHANNEL(rgba[2], bMax) << bShift));
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) pixel |= (rgba[3] > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0;
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4) pixel |= (unsigned short)(QUANTIZE_CHANNEL(rgba[3], aMax) << aShift);
 
+                shorts[i] = pixel;
+            }
         } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, rgba, count*4); break;
         default: break;
     }
 }
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for Image or Texture data
-int GetPixelDataSize(int width, int height, int format)
+#if defined(IMAGE_KERNELS_THREADED)
+// Image kernel thread band
+typedef struct ImageKernelBand {
+    ImageKernel kernel;
+    const ImageKernelData *data;
+    int startRow;
+    int endRow;
+} ImageKernelBand;
+
+// Image kernel thread entry point
+static void *ImageKernelThread(void *arg)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    ImageKernelBand *band = (ImageKernelBand *)arg;
+    band->kernel(band->data, band->startRow, band->endRow);
 
-    switch (format)
+    return NULL;
+}
+#endif
+
+// Run image kernel, large images are split in row bands processed on worker threads
+// NOTE: Bands are multiple of 4 rows (rotation kernel tiles), calling thread processes first band
+static void RunImageKernel(ImageKernel kernel, const ImageKernelData *data)
+{
+    int threadCount = 1;
+
+#if defined(IMAGE_KERNELS_THREADED)
+    threadCount = (data->width*data->height)/IMAGE_KERNEL_BAND_PIXELS;
+    if (threadCount > IMAGE_KERNEL_THREADS) threadCount = IMAGE_KERNEL_THREADS;
+    if (threadCount > data->height/4) threadCount = data->height/4;
+#endif
+
+    if (threadCount <= 1)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
+        kernel(data, 0, data->height);
+        return;
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+#if defined(IMAGE_KERNELS_THREADED)
+    int bandRows = (((data->height + threadCount - 1)/threadCount) + 3) & ~3;
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
+    ImageKernelBand bands[IMAGE_KERNEL_THREADS] = { 0 };
+    pthread_t threadId[IMAGE_KERNEL_THREADS] = { 0 };
+    bool threadCreated[IMAGE_KERNEL_THREADS] = { 0 };
+
+    for (int i = 0; i < threadCount; i++)
     {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+        bands[i].kernel = kernel;
+        bands[i].data = data;
+        bands[i].startRow = (i*bandRows < data->height)? i*bandRows : data->height;
+        bands[i].endRow = ((i + 1)*bandRows < data->height)? (i + 1)*bandRows : data->height;
     }
 
-    return dataSize;
+    // Bands failing to get a thread are processed by calling thread
+    for (int i = 1; i < threadCount; i++) threadCreated[i] = (pthread_create(&threadId[i], NULL, ImageKernelThread, &bands[i]) == 0);
+
+    kernel(data, bands[0].startRow, bands[0].endRow);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (threadCreated[i]) pthread_join(threadId[i], NULL);
+        else kernel(data, bands[i].startRow, bands[i].endRow);
+    }
+#endif
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_DDS)
-// Loading DDS image data (compressed or uncompressed)
-static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
+// Image kernel: convert pixels format, through R8G8B8A8 chunks if required
+static void ConvertPixelsKernel(const ImageKernelData *data, int startRow, int endRow)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    int srcBytes = GetPixelDataSize(1, 1, data->srcFormat);
+    int dstBytes = GetPixelDataSize(1, 1, data->dstFormat);
+    int offset = startRow*data->width;
+    int count = (endRow - startRow)*data->width;
 
-    // Required extension:
-    // GL_EXT_texture_compression_s3tc
+    unsigned char *src = data->src + offset*srcBytes;
+    unsigned char *dst = data->dst + offset*dstBytes;
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGB_S3TC_DXT1_EXT      0x83F0
-    // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT     0x83F1
-    // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT     0x83F2
-    // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT     0x83F3
+    if (data->srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) PackPixelsRGBA8(src, data->dstFormat, dst, count);
+    else if (data->dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) UnpackPixelsRGBA8(src, data->srcFormat, dst, count);
+    else
+    {
+        #define CONVERT_PIXELS_CHUNK    256
 
-    #define FOURCC_DXT1 0x31545844  // Equivalent to "DXT1" in ASCII
-    #define FOURCC_DXT3 0x33545844  // Equivalent to "DXT3" in ASCII
-    #define FOURCC_DXT5 0x35545844  // Equivalent to "DXT5" in ASCII
+        unsigned char rgba[CONVERT_PIXELS_CHUNK*4] = { 0 };
 
-    // DDS Pixel Format
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int fourCC;
-        unsigned int rgbBitCount;
-        unsigned int rBitMask;
-        unsigned int gBitMask;
-        unsigned int bBitMask;
-        unsigned int aBitMask;
-    } DDSPixelFormat;
+        for (int i = 0; i < count; i += CONVERT_PIXELS_CHUNK)
+        {
+            int chunk = ((count - i) < CONVERT_PIXELS_CHUNK)? (count - i) : CONVERT_PIXELS_CHUNK;
+
+            UnpackPixelsRGBA8(src + i*srcBytes, data->srcFormat, rgba, chunk);
+            PackPixelsRGBA8(rgba, data->dstFormat, dst + i*dstBytes, chunk);
+        }
+    }
+}
+
+// Image kernel: multiply pixels by color, value*color/255 (truncated)
+// NOTE: Division by 255 is exact for 16 bit products: (x + (x >> 8) + 1) >> 8
+static void TintPixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    unsigned char *pixels = data->src + startRow*data->width*4;
+    int count = (endRow - startRow)*data->width*4;
+    unsigned char color[4] = { data->color.r, data->color.g, data->color.b, data->color.a };
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i tint = _mm_setr_epi16(color[0], color[1], color[2], color[3], color[0], color[1], color[2], color[3]);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i value = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(value, zero), tint);
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(value, zero), tint);
+
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), one), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), one), 8);
+
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(IMAGE_SIMD_NEON)
+    const uint8x8_t tint = vld1_u8((const uint8_t[8]){ color[0], color[1], color[2], color[3], color[0], color[1], color[2], color[3] });
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16_t value = vld1q_u8(pixels + i);
+        uint16x8_t lo = vmull_u8(vget_low_u8(value), tint);
+        uint16x8_t hi = vmull_u8(vget_high_u8(value), tint);
+
+        lo = vaddq_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), vdupq_n_u16(1));
+        hi = vaddq_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), vdupq_n_u16(1));
+
+        vst1q_u8(pixels + i, vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        int value = pixels[i]*color[i%4];
+        pixels[i] = (unsigned char)((value + (value >> 8) + 1) >> 8);
+    }
+}
+
+// Image kernel: map pixels color channels through lookup table, alpha is kept
+static void TablePixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    unsigned char *pixels = data->src + startRow*data->width*4;
+    int count = (endRow - startRow)*data->width;
+
+    for (int i = 0; i < count; i++, pixels += 4)
+    {
+        pixels[0] = data->table[pixels[0]];
+        pixels[1] = data->table[pixels[1]];
+        pixels[2] = data->table[pixels[2]];
+    }
+}
+
+// Image kernel: premultiply pixels alpha, color*alpha/255 (truncated)
+static void PremultiplyPixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    unsigned char *pixels = data->src + startRow*data->width*4;
+    int count = (endRow - startRow)*data->width;
+    int i = 0;
+
+#if defined(IMAGE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i alphaMask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+    const __m128i alphaScale = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i value = _mm_loadu_si128((const __m128i *)(pixels + i*4));
+        __m128i half[2] = { _mm_unpacklo_epi8(value, zero), _mm_unpackhi_epi8(value, zero) };
+
+        for (int k = 0; k < 2; k++)
+        {
+            // Alpha broadcasted to color channels, alpha multiplied by 255 to be kept
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(half[k], _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            alpha = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha), alphaScale);
+
+            __m128i product = _mm_mullo_epi16(half[k], alpha);
+            half[k] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), one), 8);
+        }
+
+        _mm_storeu_si128((__m128i *)(pixels + i*4), _mm_packus_epi16(half[0], half[1]));
+    }
+#elif defined(IMAGE_SIMD_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t value = vld4_u8(pixels + i*4);
+
+        for (int c = 0; c < 3; c++)
+        {
+            uint16x8_t product = vmull_u8(value.val[c], value.val[3]);
+            product = vaddq_u16(vaddq_u16(product, vshrq_n_u16(product, 8)), vdupq_n_u16(1));
+            value.val[c] = vshrn_n_u16(product, 8);
+        }
+
+        vst4_u8(pixels + i*4, value);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned char *pixel = pixels + i*4;
+
+        for (int c = 0; c < 3; c++)
+        {
+            int value = pixel[c]*pixel[3];
+            pixel[c] = (unsigned char)((value + (value >> 8) + 1) >> 8);
+        }
+    }
+}
+
+// Image kernel: flip pixels rows horizontally (in place)
+static void FlipPixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    for (int y = startRow; y < endRow; y++)
+    {
+        unsigned int *left = (unsigned int *)data->src + y*data->width;
+        unsigned int *right = left + data->width;
+
+#if defined(IMAGE_SIMD_SSE2)
+        for (; (right - left) >= 8; left += 4, right -= 4)
+        {
+            __m128i a = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)left), _MM_SHUFFLE(0, 1, 2, 3));
+            __m128i b = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(right - 4)), _MM_SHUFFLE(0, 1, 2, 3));
 
-    // DDS Header (124 bytes)
-    typedef struct {
-        unsigned int size;
-        unsigned int flags;
-        unsigned int height;
-        unsigned int width;
-        unsigned int pitchOrLinearSize;
-        unsigned int depth;
-        unsigned int mipmapCount;
-        unsigned int reserved1[11];
-        DDSPixelFormat ddspf;
-        unsigned int caps;
-        unsigned int caps2;
-        unsigned int caps3;
-        unsigned int caps4;
-        unsigned int reserved2;
-    } DDSHeader;
+            _mm_storeu_si128((__m128i *)left, b);
+            _mm_storeu_si128((__m128i *)(right - 4), a);
+        }
+#elif defined(IMAGE_SIMD_NEON)
+        for (; (right - left) >= 8; left += 4, right -= 4)
+        {
+            uint32x4_t a = vld1q_u32(left);
+            uint32x4_t b = vld1q_u32(right - 4);
 
-    Image image = { 0 };
+            a = vrev64q_u32(a);
+            b = vrev64q_u32(b);
 
-    if (fileDataPtr != NULL)
+            vst1q_u32(left, vextq_u32(b, b, 2));
+            vst1q_u32(right - 4, vextq_u32(a, a, 2));
+        }
+#endif
+        for (right--; left < right; left++, right--)
+        {
+            unsigned int pixel = *left;
+            *left = *right;
+            *right = pixel;
+        }
+    }
+}
+
+// Image kernel: rotate pixels clockwise into destination, source pixel (x, y) moves to (height - 1 - y, x)
+// NOTE: Pixels are transposed in 4x4 tiles, source rows are loaded bottom-up so tile columns are destination rows
+static void RotatePixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    const unsigned int *src = (const unsigned int *)data->src;
+    unsigned int *dst = (unsigned int *)data->dst;
+    int width = data->width;
+    int height = data->height;
+    int y = startRow;
+
+#if defined(IMAGE_SIMD_SSE2) || defined(IMAGE_SIMD_NEON)
+    for (; y + 4 <= endRow; y += 4)
     {
-        // Verify the type of file
-        unsigned char *ddsHeaderId = fileDataPtr;
-        fileDataPtr += 4;
+        int x = 0;
 
-        if ((ddsHeaderId[0] != 'D') || (ddsHeaderId[1] != 'D') || (ddsHeaderId[2] != 'S') || (ddsHeaderId[3] != ' '))
+        for (; x + 4 <= width; x += 4)
         {
-            TRACELOG(LOG_WARNING, "IMAGE: DDS file data not valid");
+            unsigned int *tile = dst + x*height + (height - 4 - y);
+
+        #if defined(IMAGE_SIMD_SSE2)
+            __m128i r0 = _mm_loadu_si128((const __m128i *)(src + (y + 3)*width + x));
+            __m128i r1 = _mm_loadu_si128((const __m128i *)(src + (y + 2)*width + x));
+            __m128i r2 = _mm_loadu_si128((const __m128i *)(src + (y + 1)*width + x));
+            __m128i r3 = _mm_loadu_si128((const __m128i *)(src + y*width + x));
+
+            __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+            __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+            __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+            __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+            _mm_storeu_si128((__m128i *)tile, _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128((__m128i *)(tile + height), _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128((__m128i *)(tile + 2*height), _mm_unpacklo_epi64(t2, t3));
+            _mm_storeu_si128((__m128i *)(tile + 3*height), _mm_unpackhi_epi64(t2, t3));
+        #else
+            uint32x4x2_t t01 = vtrnq_u32(vld1q_u32(src + (y + 3)*width + x), vld1q_u32(src + (y + 2)*width + x));
+            uint32x4x2_t t23 = vtrnq_u32(vld1q_u32(src + (y + 1)*width + x), vld1q_u32(src + y*width + x));
+
+            vst1q_u32(tile, vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+            vst1q_u32(tile + height, vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+            vst1q_u32(tile + 2*height, vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+            vst1q_u32(tile + 3*height, vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
+        #endif
         }
-        else
+
+        for (int k = y; k < y + 4; k++)
         {
-            DDSHeader *ddsHeader = (DDSHeader *)fileDataPtr;
+            for (int i = x; i < width; i++) dst[i*height + (height - 1 - k)] = src[k*width + i];
+        }
+    }
+#endif
 
-            TRACELOGD("IMAGE: DDS file data info:");
-            TRACELOGD("    > Header size:        %i", sizeof(DDSHeader));
-            TRACELOGD("    > Pixel format size:  %i", ddsHeader->ddspf.size);
-            TRACELOGD("    > Pixel format flags: 0x%x", ddsHeader->ddspf.flags);
-            TRACELOGD("    > File format:        0x%x", ddsHeader->ddspf.fourCC);
-            TRACELOGD("    > File bit count:     0x%x", ddsHeader->ddspf.rgbBitCount);
+    for (; y < endRow; y++)
+    {
+        for (int x = 0; x < width; x++) dst[x*height + (height - 1 - y)] = src[y*width + x];
+    }
+}
 
-            fileDataPtr += sizeof(DDSHeader);   // Skip header
+// Image kernel: downsample pixels to next mipmap level (box filter), 8 bit per channel formats
+// NOTE: Mipmap pixels average the source area they cover, 2x2 pixels (SIMD) or up to 3x3 pixels for odd sizes
+static void MipmapPixelsKernel(const ImageKernelData *data, int startRow, int endRow)
+{
+    int channels = GetPixelDataSize(1, 1, data->srcFormat);
+    int alphaChannel = ((data->srcFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) || (data->srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))? channels - 1 : -1;
+    int srcStride = data->srcWidth*channels;
+    bool halfSize = (data->srcWidth == 2*data->width) && (data->srcHeight == 2*data->height);
 
-            image.width = ddsHeader->width;
-            image.height = ddsHeader->height;
+    for (int y = startRow; y < endRow; y++)
+    {
+        unsigned char *dst = data->dst + y*data->width*channels;
+        int x = 0;
 
-            if (ddsHeader->mipmapCount == 0) image.mipmaps = 1;      // Parameter not used
-            else image.mipmaps = ddsHeader->mipmapCount;
+        if (halfSize && !data->srgb)
+        {
+            const unsigned char *row0 = data->src + 2*y*srcStride;
+            const unsigned char *row1 = row0 + srcStride;
 
-            if (ddsHeader->ddspf.rgbBitCount == 16)     // 16bit mode, no compressed
+#if defined(IMAGE_SIMD_SSE2)
+            if (channels == 4)
             {
-                if (ddsHeader->ddspf.flags == 0x40)         // no alpha channel
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i two = _mm_set1_epi16(2);
+
+                for (; x + 2 <= data->width; x += 2)
                 {
-                    int dataSize = image.width*image.height*sizeof(unsigned short);
-                    image.data = (unsigned short *)RL_MALLOC(dataSize);
+                    __m128i a = _mm_loadu_si128((const __m128i *)(row0 + x*8));
+                    __m128i b = _mm_loadu_si128((const __m128i *)(row1 + x*8));
 
-                    memcpy(image.data, fileDataPtr, dataSize);
+                    // Vertical sums of 4 source pixels, then horizontal sums of pixels pairs
+                    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+                    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+                    lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+                    hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
 
-                    image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
+                    __m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+                    _mm_storel_epi64((__m128i *)(dst + x*4), _mm_packus_epi16(sum, sum));
                 }
-                else if (ddsHeader->ddspf.flags == 0x41)        // with alpha channel
+            }
+#elif defined(IMAGE_SIMD_NEON)
+            if (channels == 4)
+            {
+                for (; x + 4 <= data->width; x += 4)
                 {
-                    if (ddsHeader->ddspf.aBitMask == 0x8000)    // 1bit alpha
-                    {
-                        int dataSize = image.width*image.height*sizeof(unsigned short);
-                        image.data = (unsigned short *)RL_MALLOC(dataSize);
+                    // Source pixels split in even/odd pixels
+                    uint32x4x2_t a = vld2q_u32((const uint32_t *)(row0 + x*8));
+                    uint32x4x2_t b = vld2q_u32((const uint32_t *)(row1 + x*8));
 
-                        memcpy(image.data, fileDataPtr, dataSize);
+                    uint8x16_t a0 = vreinterpretq_u8_u32(a.val[0]), a1 = vreinterpretq_u8_u32(a.val[1]);
+                    uint8x16_t b0 = vreinterpretq_u8_u32(b.val[0]), b1 = vreinterpretq_u8_u32(b.val[1]);
 
-                        unsigned char alpha = 0;
+                    uint16x8_t lo = vaddq_u16(vaddl_u8(vget_low_u8(a0), vget_low_u8(a1)), vaddl_u8(vget_low_u8(b0), vget_low_u8(b1)));
+                    uint16x8_t hi = vaddq_u16(vaddl_u8(vget_high_u8(a0), vget_high_u8(a1)), vaddl_u8(vget_high_u8(b0), vget_high_u8(b1)));
 
-                        // NOTE: Data comes as A1R5G5B5, it must be reordered to R5G5B5A1
-                        for (int i = 0; i < image.width*image.height; i++)
-                        {
-                            alpha = ((unsigned short *)image.data)[i] >> 15;
-                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 1;
-                            ((unsigned short *)image.data)[i] += alpha;
-                        }
+                    vst1q_u8(dst + x*4, vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2)));
+                }
+            }
+#endif
+            for (; x < data->width; x++)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    int i = 2*x*channels + c;
+                    dst[x*channels + c] = (unsigned char)((row0[i] + row0[i + channels] + row1[i] + row1[i + channels] + 2) >> 2);
+                }
+            }
+        }
+        else
+        {
+            float weightsY[3] = { 0 };
+            int startY = 0;
+            int countY = GetMipmapFilterTaps(y, data->srcHeight, data->height, &startY, weightsY);
 
-                        image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-                    }
-                    else if (ddsHeader->ddspf.aBitMask == 0xf000)   // 4bit alpha
-                    {
-                        int dataSize = image.width*image.height*sizeof(unsigned short);
-                        image.data = (unsigned short *)RL_MALLOC(dataSize);
+            for (; x < data->width; x++)
+            {
+                float weightsX[3] = { 0 };
+                int startX = 0;
+                int countX = GetMipmapFilterTaps(x, data->srcWidth, data->width, &startX, weightsX);
 
-                        memcpy(image.data, fileDataPtr, dataSize);
+                for (int c = 0; c < channels; c++)
+                {
+                    bool linear = data->srgb && (c != alphaChannel);
+                    float sum = 0.0f;
 
-                        unsigned char alpha = 0;
+                    for (int j = 0; j < countY; j++)
+                    {
+                        const unsigned char *src = data->src + (startY + j)*srcStride + startX*channels + c;
 
-                        // NOTE: Data comes as A4R4G4B4, it must be reordered R4G4B4A4
-                        for (int i = 0; i < image.width*image.height; i++)
+                        for (int i = 0; i < countX; i++)
                         {
-                            alpha = ((unsigned short *)image.data)[i] >> 12;
-                            ((unsigned short *)image.data)[i] = ((unsigned short *)image.data)[i] << 4;
-                            ((unsigned short *)image.data)[i] += alpha;
+                            float value = linear? srgbToLinear[src[i*channels]] : (float)src[i*channels];
+                            sum += weightsY[j]*weightsX[i]*value;
                         }
-
-                        image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
                     }
+
+                    if (linear) dst[x*channels + c] = linearToSrgb[(int)(sum*(LINEAR_TO_SRGB_TABLE_SIZE - 1) + 0.5f)];
+                    else dst[x*channels + c] = (unsigned char)(sum + 0.5f);
                 }
             }
-            else if (ddsHeader->ddspf.flags == 0x40 && ddsHeader->ddspf.rgbBitCount == 24)   // DDS_RGB, no compressed
-            {
-                int dataSize = image.width*image.height*3*sizeof(unsigned char);
-                image.data = (unsigned short *)RL_MALLOC(dataSize);
-
-                memcpy(image.data, fileDataPtr, dataSize);
+        }
+    }
+}
 
-                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
-            }
-            else if (ddsHeader->ddspf.flags == 0x41 && ddsHeader->ddspf.rgbBitCount == 32) // DDS_RGBA, no compressed
-            {
-                int dataSize = image.width*image.height*4*sizeof(unsigned char);
-                image.data = (unsigned short *)RL_MALLOC(dataSize);
+// Get source pixels covered by mipmap pixel and their coverage weights, returns pixels count (up to 3)
+// NOTE: Mipmap size is half source size (rounded down), so mipmap pixel covers between 2 and 3 source pixels
+static int GetMipmapFilterTaps(int x, int srcSize, int dstSize, int *start, float *weights)
+{
+    float scale = (float)srcSize/dstSize;
+    float x0 = x*scale;
+    float x1 = (x + 1)*scale;
 
-                memcpy(image.data, fileDataPtr, dataSize);
+    int first = (int)x0;
+    int last = (int)ceilf(x1) - 1;
+    if (last > (srcSize - 1)) last = srcSize - 1;
+    if (last > (first + 2)) last = first + 2;
 
-                unsigned char blue = 0;
+    for (int i = first; i <= last; i++)
+    {
+        float coverage = (((i + 1) < x1)? (i + 1) : x1) - ((i > x0)? i : x0);
+        weights[i - first] = coverage/scale;
+    }
 
-                // NOTE: Data comes as A8R8G8B8, it must be reordered R8G8B8A8 (view next comment)
-                // DirecX understand ARGB as a 32bit DWORD but the actual memory byte alignment is BGRA
-                // So, we must realign B8G8R8A8 to R8G8B8A8
-                for (int i = 0; i < image.width*image.height*4; i += 4)
-                {
-                    blue = ((unsigned char *)image.data)[i];
-                    ((unsigned char *)image.data)[i] = ((unsigned char *)image.data)[i + 2];
-                    ((unsigned char *)image.data)[i + 2] = blue;
-                }
+    *start = first;
 
-                image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-            }
-            else if (((ddsHeader->ddspf.flags == 0x04) || (ddsHeader->ddspf.flags == 0x05)) && (ddsHeader->ddspf.fourCC > 0)) // Compressed
-            {
-                int dataSize = 0;
+    return (last - first + 1);
+}
 
-                // Calculate data size, including all mipmaps
-                if (ddsHeader->mipmapCount > 1) dataSize = ddsHeader->pitchOrLinearSize*2;
-                else dataSize = ddsHeader->pitchOrLinearSize;
+// Generate mipmaps chain after base level data, every level is generated from previous one (data must fit all levels)
+// NOTE: Supported formats: GRAYSCALE, GRAY_ALPHA, R8G8B8, R8G8B8A8
+static void GenImageMipmapsData(unsigned char *data, int width, int height, int format, int mipCount)
+{
+    ImageKernelData kernel = { 0 };
+    kernel.srcFormat = format;
 
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+#if defined(SUPPORT_IMAGE_MIPMAPS_SRGB)
+    kernel.srgb = true;
 
-                memcpy(image.data, fileDataPtr, dataSize);
+    // Tables are initialized before running kernels threads
+    if (linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE - 1] == 0)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            float value = (float)i/255.0f;
+            srgbToLinear[i] = ((value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f));
+        }
 
-                switch (ddsHeader->ddspf.fourCC)
-                {
-                    case FOURCC_DXT1:
-                    {
-                        if (ddsHeader->ddspf.flags == 0x04) image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB;
-                        else image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
-                    } break;
-                    case FOURCC_DXT3: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-                    case FOURCC_DXT5: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-                    default: break;
-                }
-            }
+        for (int i = 0; i < LINEAR_TO_SRGB_TABLE_SIZE; i++)
+        {
+            float value = (float)i/(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+            value = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+            linearToSrgb[i] = (unsigned char)(value*255.0f + 0.5f);
         }
     }
+#endif
 
-    return image;
+    unsigned char *level = data;
+
+    for (int i = 1; i < mipCount; i++)
+    {
+        kernel.src = level;
+        kernel.dst = level + GetPixelDataSize(width, height, format);
+        kernel.srcWidth = width;
+        kernel.srcHeight = height;
+        kernel.width = (width > 1)? width/2 : 1;
+        kernel.height = (height > 1)? height/2 : 1;
+
+        RunImageKernel(MipmapPixelsKernel, &kernel);
+
+        level = kernel.dst;
+        width = kernel.width;
+        height = kernel.height;
+    }
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_PKM)
-// Loading PKM image data (ETC1/ETC2 compression)
-// NOTE: KTX is the standard Khronos Group compression format (ETC1/ETC2, mipmaps)
-// PKM is a much simpler file format used mainly to contain a single ETC1/ETC2 compressed image (no mipmaps)
-static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize)
+// Draw image view pixels into destination image at position
+// NOTE: View must be inside destination image (already clipped), source pixels are read in place
+static void DrawImageViewPixels(Image *dst, ImageView src, int posX, int posY, Color tint)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    // This blitting method is quite fast! The process followed is:
+    // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
+    // Some optimization ideas:
+    //    [x] Avoid creating source copy if not required (no resize required)
+    //    [x] Optimize ImageResize() for pixel format (alternative: ImageResizeNN())
+    //    [x] Optimize ColorAlphaBlend() to avoid processing (alpha = 0) and (alpha = 1)
+    //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
+    //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
+    //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+    //    [-] GetPixelColor(): Get Vector4 instead of Color, easier for ColorAlphaBlend()
+    //    [ ] Support f32bit channels drawing
 
-    // Required extensions:
-    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1) (OpenGL ES 2.0)
-    // GL_ARB_ES3_compatibility  (ETC2/EAC) (OpenGL ES 3.0)
+    // TODO: Support PIXELFORMAT_UNCOMPRESSED_R32, PIXELFORMAT_UNCOMPRESSED_R32G32B32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32
 
-    // Supported tokens (defined by extensions)
-    // GL_ETC1_RGB8_OES                 0x8D64
-    // GL_COMPRESSED_RGB8_ETC2          0x9274
-    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+    Color colSrc, colDst, blend;
+    bool blendRequired = true;
 
-    // PKM file (ETC1) Header (16 bytes)
-    typedef struct {
-        char id[4];                 // "PKM "
-        char version[2];            // "10" or "20"
-        unsigned short format;      // Data format (big-endian) (Check list below)
-        unsigned short width;       // Texture width (big-endian) (origWidth rounded to multiple of 4)
-        unsigned short height;      // Texture height (big-endian) (origHeight rounded to multiple of 4)
-        unsigned short origWidth;   // Original width (big-endian)
-        unsigned short origHeight;  // Original height (big-endian)
-    } PKMHeader;
+    // Fast path: Avoid blend if source has no alpha to blend
+    if ((tint.a == 255) && ((src.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (src.format == PIXELFORMAT_UNCOMPRESSED_R5G6B5))) blendRequired = false;
 
-    // Formats list
-    // version 10: format: 0=ETC1_RGB, [1=ETC1_RGBA, 2=ETC1_RGB_MIP, 3=ETC1_RGBA_MIP] (not used)
-    // version 20: format: 0=ETC1_RGB, 1=ETC2_RGB, 2=ETC2_RGBA_OLD, 3=ETC2_RGBA, 4=ETC2_RGBA1, 5=ETC2_R, 6=ETC2_RG, 7=ETC2_SIGNED_R, 8=ETC2_SIGNED_R
+    // Fast path: Blend full lines with format specialized blitter (R8G8B8A8 and GRAY_ALPHA)
+    bool blendSpans = blendRequired &&
+        ((src.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (src.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)) &&
+        ((dst->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (dst->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA));
 
-    // NOTE: The extended width and height are the widths rounded up to a multiple of 4.
-    // NOTE: ETC is always 4bit per pixel (64 bit for each 4x4 block of pixels)
+    int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
+    int bytesPerPixelDst = strideDst/(dst->width);
 
-    Image image = { 0 };
+    int strideSrc = src.stride;
+    int bytesPerPixelSrc = GetPixelDataSize(1, 1, src.format);
 
-    if (fileDataPtr != NULL)
+    const unsigned char *pSrcBase = (const unsigned char *)src.data;
+    unsigned char *pDstBase = (unsigned char *)dst->data + (posY*dst->width + posX)*bytesPerPixelDst;
+
+    for (int y = 0; y < src.height; y++)
     {
-        PKMHeader *pkmHeader = (PKMHeader *)fileDataPtr;
+        const unsigned char *pSrc = pSrcBase;
+        unsigned char *pDst = pDstBase;
 
-        if ((pkmHeader->id[0] != 'P') || (pkmHeader->id[1] != 'K') || (pkmHeader->id[2] != 'M') || (pkmHeader->id[3] != ' '))
-        {
-            TRACELOG(LOG_WARNING, "IMAGE: PKM file data not valid");
-        }
+        // Fast path: Avoid moving pixel by pixel if no blend required and same format
+        if (!blendRequired && (src.format == dst->format)) memcpy(pDst, pSrc, src.width*bytesPerPixelSrc);
+        else if (blendSpans) BlendPixelsSpan(pDst, dst->format, pSrc, src.format, src.width, tint);
         else
         {
-            fileDataPtr += sizeof(PKMHeader);   // Skip header
+            for (int x = 0; x < src.width; x++)
+            {
+                colSrc = GetPixelColor((void *)pSrc, src.format);
+                colDst = GetPixelColor(pDst, dst->format);
 
-            // NOTE: format, width and height come as big-endian, data must be swapped to little-endian
-            pkmHeader->format = ((pkmHeader->format & 0x00FF) << 8) | ((pkmHeader->format & 0xFF00) >> 8);
-            pkmHeader->width = ((pkmHeader->width & 0x00FF) << 8) | ((pkmHeader->width & 0xFF00) >> 8);
-            pkmHeader->height = ((pkmHeader->height & 0x00FF) << 8) | ((pkmHeader->height & 0xFF00) >> 8);
+                // Fast path: Avoid blend if source has no alpha to blend
+                if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
+                else blend = colSrc;
 
-            TRACELOGD("IMAGE: PKM file data info:");
-            TRACELOGD("    > Image width:  %i", pkmHeader->width);
-            TRACELOGD("    > Image height: %i", pkmHeader->height);
-            TRACELOGD("    > Image format: %i", pkmHeader->format);
+                SetPixelColor(pDst, blend, dst->format);
 
-            image.width = pkmHeader->width;
-            image.height = pkmHeader->height;
-            image.mipmaps = 1;
+                pDst += bytesPerPixelDst;
+                pSrc += bytesPerPixelSrc;
+            }
+        }
 
-            int bpp = 4;
-            if (pkmHeader->format == 3) bpp = 8;
+        pSrcBase += strideSrc;
+        pDstBase += strideDst;
+    }
+}
 
-            int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Blend tinted source pixels span into destination pixels span, same results as ColorAlphaBlend() per pixel
+// NOTE: Specialized for R8G8B8A8 and GRAY_ALPHA formats, transparent source pixels (after tint) are skipped
+static void BlendPixelsSpan(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int count, Color tint)
+{
+    // Source channels offsets, GRAY_ALPHA gray value is used for all color channels
+    int srcStep = (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 2;
+    int srcG = (srcStep == 4)? 1 : 0;
+    int srcB = (srcStep == 4)? 2 : 0;
+    int srcA = srcStep - 1;
 
-            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+    if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        for (int i = 0; i < count; i++, src += srcStep, dst += 4)
+        {
+            if ((((unsigned int)src[srcA]*tint.a) >> 8) == 0) continue;
 
-            memcpy(image.data, fileDataPtr, dataSize);
+            Color color = ColorAlphaBlend((Color){ dst[0], dst[1], dst[2], dst[3] }, (Color){ src[0], src[srcG], src[srcB], src[srcA] }, tint);
 
-            if (pkmHeader->format == 0) image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (pkmHeader->format == 1) image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (pkmHeader->format == 3) image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            dst[0] = color.r;
+            dst[1] = color.g;
+            dst[2] = color.b;
+            dst[3] = color.a;
         }
     }
+    else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+        for (int i = 0; i < count; i++, src += srcStep, dst += 2)
+        {
+            if ((((unsigned int)src[srcA]*tint.a) >> 8) == 0) continue;
 
-    return image;
+            Color color = ColorAlphaBlend((Color){ dst[0], dst[0], dst[0], dst[1] }, (Color){ src[0], src[srcG], src[srcB], src[srcA] }, tint);
+
+            // NOTE: Grayscale equivalent color calculated as SetPixelColor()
+            dst[0] = (unsigned char)((((float)color.r/255.0f)*0.299f + ((float)color.g/255.0f)*0.587f + ((float)color.b/255.0f)*0.114f)*255.0f);
+            dst[1] = color.a;
+        }
+    }
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_KTX)
-// Load KTX compressed image data (ETC1/ETC2 compression)
-// TODO: Review KTX loading, many things changed!
-static Image LoadKTX(const unsigned char *fileData, unsigned int fileSize)
+// Convert float to unsigned float with 5 bit exponent (no sign bit)
+// NOTE: Negative and NaN values are stored as 0, values over range as maximum finite value
+static unsigned int FloatToUnsignedFloat(float value, int mantissaBits)
+{
+    if (!(value > 0.0f)) return 0;
+
+    unsigned int bits = 0;
+    memcpy(&bits, &value, sizeof(float));
+
+    int exponent = (int)((bits >> 23) & 0xff) - 127 + 15;
+    unsigned int mantissa = bits & 0x7fffff;
+
+    if (exponent >= 31) return (30 << mantissaBits) | ((1 << mantissaBits) - 1);
+    if (exponent <= 0)
+    {
+        // Denormalized value
+        if (exponent < -mantissaBits) return 0;
+
+        return ((mantissa | 0x800000) >> (1 - exponent)) >> (23 - mantissaBits);
+    }
+
+    return ((unsigned int)exponent << mantissaBits) | (mantissa >> (23 - mantissaBits));
+}
+
+// Convert unsigned float with 5 bit exponent (no sign bit) to float
+static float UnsignedFloatToFloat(unsigned int value, int mantissaBits)
+{
+    int exponent = (int)(value >> mantissaBits);
+    float mantissa = (float)(value & ((1 << mantissaBits) - 1))/(float)(1 << mantissaBits);
+
+    if (exponent == 0) return ldexpf(mantissa, -14);
+    else if (exponent == 31) return 65024.0f;   // Infinity and NaN values stored as maximum finite value
+
+    return ldexpf(1.0f + mantissa, exponent - 15);
+}
+
+// Pack color into R11G11B10F (unsigned floats, negative values clamped to 0)
+// NOTE: Red is stored in lowest bits, as GL_UNSIGNED_INT_10F_11F_11F_REV
+static unsigned int PackR11G11B10F(Vector3 color)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    return FloatToUnsignedFloat(color.x, 6) | (FloatToUnsignedFloat(color.y, 6) << 11) | (FloatToUnsignedFloat(color.z, 5) << 22);
+}
 
-    // Required extensions:
-    // GL_OES_compressed_ETC1_RGB8_texture  (ETC1)
-    // GL_ARB_ES3_compatibility  (ETC2/EAC)
+// Unpack R11G11B10F color into floats
+static Vector3 UnpackR11G11B10F(unsigned int value)
+{
+    Vector3 color = { 0 };
 
-    // Supported tokens (defined by extensions)
-    // GL_ETC1_RGB8_OES                 0x8D64
-    // GL_COMPRESSED_RGB8_ETC2          0x9274
-    // GL_COMPRESSED_RGBA8_ETC2_EAC     0x9278
+    color.x = UnsignedFloatToFloat(value & 0x7ff, 6);
+    color.y = UnsignedFloatToFloat((value >> 11) & 0x7ff, 6);
+    color.z = UnsignedFloatToFloat(value >> 22, 5);
 
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/
+    return color;
+}
 
-    // TODO: Support KTX 2.2 specs!
+// Track texture wrap mode set by SetTextureWrap(), only non-repeat textures are stored
+// NOTE: On tracked textures overflow, all textures wrap mode is considered unknown
+static void SetTextureWrapOverride(unsigned int id, bool repeat)
+{
+    if (textureWrapOverridesCount > MAX_TEXTURE_WRAP_OVERRIDES) return;
 
-    typedef struct {
-        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"
-        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int glType;                // For compressed textures, glType must equal 0
-        unsigned int glTypeSize;            // For compressed texture data, usually 1
-        unsigned int glFormat;              // For compressed textures is 0
-        unsigned int glInternalFormat;      // Compressed internal format
-        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)
-        unsigned int width;                 // Texture image width in pixels
-        unsigned int height;                // Texture image height in pixels
-        unsigned int depth;                 // For 2D textures is 0
-        unsigned int elements;              // Number of array elements, usually 0
-        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
-        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...
-    } KTXHeader;
+    int index = 0;
+    while ((index < textureWrapOverridesCount) && (textureWrapOverrides[index] != id)) index++;
 
-    // NOTE: Before start of every mipmap data block, we have: unsigned int dataSize
+    if (repeat)
+    {
+        if (index < textureWrapOverridesCount) textureWrapOverrides[index] = textureWrapOverrides[--textureWrapOverridesCount];
+    }
+    else if (index == textureWrapOverridesCount)
+    {
+        if (textureWrapOverridesCount < MAX_TEXTURE_WRAP_OVERRIDES) textureWrapOverrides[textureWrapOverridesCount++] = id;
+        else textureWrapOverridesCount = MAX_TEXTURE_WRAP_OVERRIDES + 1;
+    }
+}
 
-    Image image = { 0 };
+// Check if texture is known to use repeat wrap mode (rlgl textures default)
+// NOTE: Wrap mode changed directly with rlTextureParameters() is not tracked
+static bool IsTextureWrapRepeat(Texture2D texture)
+{
+    if (textureWrapOverridesCount > MAX_TEXTURE_WRAP_OVERRIDES) return false;
 
-    if (fileDataPtr != NULL)
+    for (int i = 0; i < textureWrapOverridesCount; i++)
     {
-        KTXHeader *ktxHeader = (KTXHeader *)fileDataPtr;
+        if (textureWrapOverrides[i] == texture.id) return false;
+    }
 
-        if ((ktxHeader->id[1] != 'K') || (ktxHeader->id[2] != 'T') || (ktxHeader->id[3] != 'X') ||
-            (ktxHeader->id[4] != ' ') || (ktxHeader->id[5] != '1') || (ktxHeader->id[6] != '1'))
-        {
-            TRACELOG(LOG_WARNING, "IMAGE: KTX file data not valid");
-        }
-        else
-        {
-            fileDataPtr += sizeof(KTXHeader);           // Move file data pointer
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // OpenGL ES 2.0 NPOT textures are loaded with clamp wrap mode if NPOT textures are not fully supported
+    if (((texture.width & (texture.width - 1)) != 0) || ((texture.height & (texture.height - 1)) != 0)) return false;
+#endif
 
-            image.width = ktxHeader->width;
-            image.height = ktxHeader->height;
-            image.mipmaps = ktxHeader->mipmapLevels;
+    return true;
+}
 
-            TRACELOGD("IMAGE: KTX file data info:");
-            TRACELOGD("    > Image width:  %i", ktxHeader->width);
-            TRACELOGD("    > Image height: %i", ktxHeader->height);
-            TRACELOGD("    > Image format: 0x%x", ktxHeader->glInternalFormat);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw tiled texture as one quad, texcoords are given in tiles and wrapped inside source rectangle by built-in shader
+// NOTE: Current batch is drawn before and after the quad (shader change), returns false if shader is not available
+static bool DrawTextureTiledShader(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float scale, Color tint)
+{
+    if (!tiledShaderLoaded) LoadShaderTiled();
+    if (tiledShader.id == 0) return false;
 
-            fileDataPtr += ktxHeader->keyValueDataSize; // Skip value data size
+    float width = (float)texture.width;
+    float height = (float)texture.height;
 
-            int dataSize = ((int *)fileDataPtr)[0];
-            fileDataPtr += sizeof(int);
+    Vector4 rect = { source.x/width, source.y/height, source.width/width, source.height/height };
+    Vector2 texel = { 0.5f/width, 0.5f/height };
+    Vector2 tiles = { dest.width/(source.width*scale), dest.height/(source.height*scale) };
 
-            image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+    float x = dest.x - origin.x;
+    float y = dest.y - origin.y;
 
-            memcpy(image.data, fileDataPtr, dataSize);
+    BeginShaderMode(tiledShader);
+        SetShaderValue(tiledShader, tiledShaderRectLoc, &rect, SHADER_UNIFORM_VEC4);
+        SetShaderValue(tiledShader, tiledShaderTexelLoc, &texel, SHADER_UNIFORM_VEC2);
 
-            if (ktxHeader->glInternalFormat == 0x8D64) image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (ktxHeader->glInternalFormat == 0x9274) image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (ktxHeader->glInternalFormat == 0x9278) image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
 
-            // TODO: Support uncompressed data formats? Right now it returns format = 0!
-        }
-    }
+            rlTexCoord2f(0.0f, 0.0f);
+            rlVertex2f(x, y);
 
-    return image;
+            rlTexCoord2f(0.0f, tiles.y);
+            rlVertex2f(x, y + dest.height);
+
+            rlTexCoord2f(tiles.x, tiles.y);
+            rlVertex2f(x + dest.width, y + dest.height);
+
+            rlTexCoord2f(tiles.x, 0.0f);
+            rlVertex2f(x + dest.width, y);
+        rlEnd();
+        rlSetTexture(0);
+    EndShaderMode();
+
+    return true;
 }
 
-// Save image data as KTX file
-// NOTE: By default KTX 1.1 spec is used, 2.0 is still on draft (01Oct2018)
-// TODO: Review KTX saving, many things changed!
-static int SaveKTX(Image image, const char *fileName)
+// Load built-in tiled texture shader
+// NOTE: Mirrors rlgl default shader, texcoords (in tiles) are wrapped inside source rectangle, half texel
+// clamped to avoid filtering neighbour texels (texture atlas)
+static void LoadShaderTiled(void)
 {
-    // KTX file Header (64 bytes)
-    // v1.1 - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
-    // v2.0 - http://github.khronos.org/KTX-Specification/ - Final specs by 2021-04-18
-    typedef struct {
-        char id[12];                        // Identifier: "«KTX 11»\r\n\x1A\n"             // KTX 2.0: "«KTX 22»\r\n\x1A\n"
-        unsigned int endianness;            // Little endian: 0x01 0x02 0x03 0x04
-        unsigned int glType;                // For compressed textures, glType must equal 0
-        unsigned int glTypeSize;            // For compressed texture data, usually 1
-        unsigned int glFormat;              // For compressed textures is 0
-        unsigned int glInternalFormat;      // Compressed internal format
-        unsigned int glBaseInternalFormat;  // Same as glFormat (RGB, RGBA, ALPHA...)       // KTX 2.0: UInt32 vkFormat
-        unsigned int width;                 // Texture image width in pixels
-        unsigned int height;                // Texture image height in pixels
-        unsigned int depth;                 // For 2D textures is 0
-        unsigned int elements;              // Number of array elements, usually 0
-        unsigned int faces;                 // Cubemap faces, for no-cubemap = 1
-        unsigned int mipmapLevels;          // Non-mipmapped textures = 1
-        unsigned int keyValueDataSize;      // Used to encode any arbitrary data...         // KTX 2.0: UInt32 levelOrder - ordering of the mipmap levels, usually 0
-                                                                                            // KTX 2.0: UInt32 supercompressionScheme - 0 (None), 1 (Crunch CRN), 2 (Zlib DEFLATE)...
-        // KTX 2.0 defines additional header elements...
-    } KTXHeader;
+    const char *tiledVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    const char *tiledFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec4 tileRect;             \n"
+    "uniform vec2 tileTexel;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 uv = tileRect.xy + clamp(fract(fragTexCoord)*tileRect.zw, tileTexel, tileRect.zw - tileTexel); \n"
+    "    vec4 texelColor = texture2D(texture0, uv);           \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec4 tileRect;             \n"
+    "uniform vec2 tileTexel;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 uv = tileRect.xy + clamp(fract(fragTexCoord)*tileRect.zw, tileTexel, tileRect.zw - tileTexel); \n"
+    "    vec4 texelColor = textureGrad(texture0, uv, dFdx(fragTexCoord)*tileRect.zw, dFdy(fragTexCoord)*tileRect.zw); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "uniform vec4 tileRect;             \n"
+    "uniform vec2 tileTexel;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 uv = tileRect.xy + clamp(fract(fragTexCoord)*tileRect.zw, tileTexel, tileRect.zw - tileTexel); \n"
+    "    vec4 texelColor = texture2D(texture0, uv);           \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
 
-    // Calculate file dataSize required
-    int dataSize = sizeof(KTXHeader);
+    tiledShaderLoaded = true;
+    tiledShader = LoadShaderFromMemory(tiledVShaderCode, tiledFShaderCode);
+    tiledShaderRectLoc = GetShaderLocation(tiledShader, "tileRect");
+    tiledShaderTexelLoc = GetShaderLocation(tiledShader, "tileTexel");
 
-    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    if ((tiledShader.id > 0) && (tiledShader.id != rlGetShaderIdDefault()) && (tiledShaderRectLoc != -1)) TRACELOG(LOG_INFO, "SHADER: [ID %i] Tiled texture shader loaded successfully", tiledShader.id);
+    else
     {
-        dataSize += GetPixelDataSize(width, height, image.format);
-        width /= 2; height /= 2;
-    }
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load tiled texture shader");
 
-    unsigned char *fileData = RL_CALLOC(dataSize, 1);
-    unsigned char *fileDataPtr = fileData;
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (tiledShader.id != rlGetShaderIdDefault()) UnloadShader(tiledShader);
+        else RL_FREE(tiledShader.locs);
 
-    KTXHeader ktxHeader = { 0 };
+        tiledShader = (Shader){ 0 };
+    }
+}
 
-    // KTX identifier (v1.1)
-    //unsigned char id[12] = { '«', 'K', 'T', 'X', ' ', '1', '1', '»', '\r', '\n', '\x1A', '\n' };
-    //unsigned char id[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+// Load built-in sprites shader and quad vertex buffer
+// NOTE: Quad corners are scaled, rotated (around sprite center) and translated per instance, texcoords
+// are computed from source rectangle (pixels) and flipped by size sign
+static void LoadShaderSprites(void)
+{
+    const char *spritesVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 spriteRect;         \n"     // Center position (xy) and size (zw)
+    "attribute float spriteRotation;    \n"     // Rotation (degrees)
+    "attribute vec4 spriteSource;       \n"     // Texture source rectangle (pixels)
+    "attribute vec4 spriteColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 vertexPosition;            \n"
+    "in vec4 spriteRect;                \n"
+    "in float spriteRotation;           \n"
+    "in vec4 spriteSource;              \n"
+    "in vec4 spriteColor;               \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "attribute vec2 vertexPosition;     \n"
+    "attribute vec4 spriteRect;         \n"
+    "attribute float spriteRotation;    \n"
+    "attribute vec4 spriteSource;       \n"
+    "attribute vec4 spriteColor;        \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 matModel;             \n"
+    "uniform mat4 matView;              \n"
+    "uniform mat4 matProjection;        \n"
+    "uniform vec2 texelSize;            \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float angle = radians(spriteRotation); \n"
+    "    vec2 corner = vertexPosition*abs(spriteRect.zw); \n"
+    "    vec2 position = spriteRect.xy + vec2(cos(angle)*corner.x - sin(angle)*corner.y, sin(angle)*corner.x + cos(angle)*corner.y); \n"
+    "    vec2 uv = vertexPosition*sign(spriteRect.zw) + 0.5; \n"
+    "    fragTexCoord = (spriteSource.xy + uv*spriteSource.zw)*texelSize; \n"
+    "    fragColor = spriteColor;       \n"
+    "    gl_Position = matProjection*matView*matModel*vec4(position, 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *spritesFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor; \n"
+    "}                                  \n";
+#endif
 
-    const char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+    spritesShaderLoaded = true;
+    spritesShader = LoadShaderFromMemory(spritesVShaderCode, spritesFShaderCode);
+    spritesShaderLocs[0] = GetShaderLocation(spritesShader, "texelSize");
+    spritesShaderLocs[1] = GetShaderLocationAttrib(spritesShader, "spriteRect");
+    spritesShaderLocs[2] = GetShaderLocationAttrib(spritesShader, "spriteRotation");
+    spritesShaderLocs[3] = GetShaderLocationAttrib(spritesShader, "spriteSource");
+    spritesShaderLocs[4] = GetShaderLocationAttrib(spritesShader, "spriteColor");
 
-    // Get the image header
-    memcpy(ktxHeader.id, ktxIdentifier, 12);  // KTX 1.1 signature
-    ktxHeader.endianness = 0;
-    ktxHeader.glType = 0;                     // Obtained from image.format
-    ktxHeader.glTypeSize = 1;
-    ktxHeader.glFormat = 0;                   // Obtained from image.format
-    ktxHeader.glInternalFormat = 0;           // Obtained from image.format
-    ktxHeader.glBaseInternalFormat = 0;
-    ktxHeader.width = image.width;
-    ktxHeader.height = image.height;
-    ktxHeader.depth = 0;
-    ktxHeader.elements = 0;
-    ktxHeader.faces = 1;
-    ktxHeader.mipmapLevels = image.mipmaps;   // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
-    ktxHeader.keyValueDataSize = 0;           // No extra data after the header
+    bool attribsFound = true;
+    for (int i = 1; i < 5; i++) if (spritesShaderLocs[i] == -1) attribsFound = false;
 
-    rlGetGlTextureFormats(image.format, &ktxHeader.glInternalFormat, &ktxHeader.glFormat, &ktxHeader.glType);   // rlgl module function
-    ktxHeader.glBaseInternalFormat = ktxHeader.glFormat;    // KTX 1.1 only
+    if ((spritesShader.id > 0) && (spritesShader.id != rlGetShaderIdDefault()) && attribsFound)
+    {
+        // Two triangles quad, corners in range [-0.5..0.5], counter-clockwise on screen (y axis down)
+        const float quad[12] = { -0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f, -0.5f };
 
-    // NOTE: We can save into a .ktx all PixelFormats supported by raylib, including compressed formats like DXT, ETC or ASTC
+        spritesVaoId = rlLoadVertexArray();
+        rlEnableVertexArray(spritesVaoId);
+        spritesQuadVboId = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlDisableVertexArray();
 
-    if (ktxHeader.glFormat == -1) TRACELOG(LOG_WARNING, "IMAGE: GL format not supported for KTX export (%i)", ktxHeader.glFormat);
+        TRACELOG(LOG_INFO, "SHADER: [ID %i] Sprites shader loaded successfully", spritesShader.id);
+    }
     else
     {
-        memcpy(fileDataPtr, &ktxHeader, sizeof(KTXHeader));
-        fileDataPtr += sizeof(KTXHeader);
+        TRACELOG(LOG_WARNING, "SHADER: Failed to load sprites shader");
 
-        int width = image.width;
-        int height = image.height;
-        int dataOffset = 0;
+        // NOTE: On failure, rlgl could have returned the default shader program
+        if (spritesShader.id != rlGetShaderIdDefault()) UnloadShader(spritesShader);
+        else RL_FREE(spritesShader.locs);
 
-        // Save all mipmaps data
-        for (int i = 0; i < image.mipmaps; i++)
-        {
-            unsigned int dataSize = GetPixelDataSize(width, height, image.format);
+        spritesShader = (Shader){ 0 };
+    }
+}
+#endif
 
-            memcpy(fileDataPtr, &dataSize, sizeof(unsigned int));
-            memcpy(fileDataPtr + 4, (unsigned char *)image.data + dataOffset, dataSize);
+#if defined(SUPPORT_POST_PROCESSING)
+// Generate fused shaders for post-processing color effects runs, one shader per run of adjacent color effects
+// NOTE: Every effect code is wrapped in its own scope with its parameters, shader is owned by run first effect
+static void LoadPostEffectsShaders(PostProcess *postProcess)
+{
+    postProcess->dirty = false;
 
-            width /= 2;
-            height /= 2;
-            dataOffset += dataSize;
-            fileDataPtr += (4 + dataSize);
+    for (int i = 0; i < postProcess->effectCount; i++)
+    {
+        PostEffect *effect = &postProcess->effects[i];
+        if (effect->code == NULL) continue;
+
+        if (effect->shader.id > 0) UnloadShader(effect->shader);
+        effect->shader = (Shader){ 0 };
+        effect->paramsLoc = -1;
+
+        // Run first effect, previous one is not a color effect
+        if ((i > 0) && (postProcess->effects[i - 1].code != NULL)) continue;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        int count = 0;
+        int size = 512;
+        while (((i + count) < postProcess->effectCount) && (postProcess->effects[i + count].code != NULL))
+        {
+            size += (int)strlen(postProcess->effects[i + count].code) + 64;
+            count++;
         }
-    }
 
-    int success = SaveFileData(fileName, fileData, dataSize);
+    #if defined(GRAPHICS_API_OPENGL_21)
+        const char *header = "#version 120\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\n";
+        const char *sample = "texture2D";
+        const char *output = "gl_FragColor";
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        const char *header = "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nout vec4 finalColor;\n";
+        const char *sample = "texture";
+        const char *output = "finalColor";
+    #endif
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        const char *header = "#version 100\nprecision mediump float;\nvarying vec2 fragTexCoord;\nvarying vec4 fragColor;\n";
+        const char *sample = "texture2D";
+        const char *output = "gl_FragColor";
+    #endif
+
+        char *code = (char *)RL_CALLOC(size, 1);
+        int length = sprintf(code, "%suniform sampler2D texture0;\nuniform vec4 effectParams[%i];\nvoid main()\n{\n"
+            "    vec2 uv = fragTexCoord;\n    vec4 color = %s(texture0, uv);\n", header, count, sample);
+
+        for (int k = 0; k < count; k++) length += sprintf(code + length, "    { vec4 params = effectParams[%i];\n%s\n    }\n", k, postProcess->effects[i + k].code);
+
+        sprintf(code + length, "    %s = color;\n}\n", output);
+
+        // NOTE: Default vertex shader is used
+        Shader shader = LoadShaderFromMemory(NULL, code);
+        int paramsLoc = GetShaderLocation(shader, "effectParams");
+        RL_FREE(code);
+
+        if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault()))
+        {
+            TRACELOG(LOG_INFO, "POSTFX: [ID %i] Fused %i color effects into one shader", shader.id, count);
 
-    RL_FREE(fileData);    // Free file data buffer
+            effect->shader = shader;
+            effect->paramsLoc = paramsLoc;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "POSTFX: Failed to load fused color effects shader");
 
-    // If all data has been written correctly to file, success = 1
-    return success;
+            // NOTE: On failure, rlgl could have returned the default shader program
+            if (shader.id != rlGetShaderIdDefault()) UnloadShader(shader);
+            else RL_FREE(shader.locs);
+        }
+#endif
+    }
 }
 #endif
 
-#if defined(SUPPORT_FILEFORMAT_PVR)
-// Loading PVR image data (uncompressed or PVRT compression)
-// NOTE: PVR v2 not supported, use PVR v3 instead
-static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize)
+#if defined(LOWRES_EFFECTS_SUPPORTED)
+// Load built-in reduced resolution effects shaders
+// NOTE: Shaders read textures at pixel coordinates (gl_FragCoord), effects target pixel (x, y) uses scene depth
+// sample (x, y)*downscale + downscale/2, both in downsample and composite
+static void LoadShadersLowResEffects(void)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    const char *downsampleFShaderCode =
+    "#version 330                       \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"     // Scene depth
+    "uniform int downscale;             \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    ivec2 texel = min(ivec2(gl_FragCoord.xy)*downscale + downscale/2, textureSize(texture0, 0) - 1); \n"
+    "    gl_FragDepth = texelFetch(texture0, texel, 0).r; \n"
+    "    finalColor = vec4(0.0);        \n"
+    "}                                  \n";
+
+    const char *compositeFShaderCode =
+    "#version 330                       \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"     // Effects color (premultiplied)
+    "uniform sampler2D texture1;        \n"     // Scene depth
+    "uniform vec4 params;               \n"     // Downscale, near and far cull distances, scene depth used
+    "float LinearDepth(float depth) { return 2.0*params.y*params.z/(params.z + params.y - (2.0*depth - 1.0)*(params.z - params.y)); } \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    ivec2 size = textureSize(texture0, 0); \n"
+    "    ivec2 sceneSize = textureSize(texture1, 0); \n"
+    "    int downscale = int(params.x); \n"
+    "    vec2 position = gl_FragCoord.xy/params.x - 0.5; \n"
+    "    ivec2 base = ivec2(floor(position)); \n"
+    "    vec2 f = position - vec2(base); \n"
+    "    float depth = (params.w > 0.0)? LinearDepth(texelFetch(texture1, min(ivec2(gl_FragCoord.xy), sceneSize - 1), 0).r) : 0.0; \n"
+    "    vec4 color = vec4(0.0);        \n"
+    "    float weights = 0.0;           \n"
+    "    for (int i = 0; i < 4; i++)    \n"
+    "    {                              \n"
+    "        ivec2 offset = ivec2(i & 1, i >> 1); \n"
+    "        ivec2 texel = clamp(base + offset, ivec2(0), size - 1); \n"
+    "        vec2 bilinear = mix(1.0 - f, f, vec2(offset)); \n"
+    "        float weight = bilinear.x*bilinear.y + 0.0001; \n"
+    "        if (params.w > 0.0)        \n"
+    "        {                          \n"
+    "            float texelDepth = LinearDepth(texelFetch(texture1, min(texel*downscale + downscale/2, sceneSize - 1), 0).r); \n"
+    "            weight /= 0.01 + abs(texelDepth - depth)/depth; \n"
+    "        }                          \n"
+    "        color += texelFetch(texture0, texel, 0)*weight; \n"
+    "        weights += weight;         \n"
+    "    }                              \n"
+    "    finalColor = color/weights;    \n"
+    "}                                  \n";
+
+    const char *codes[2] = { downsampleFShaderCode, compositeFShaderCode };
+    const char *params[2] = { "downscale", "params" };
+
+    lowResShadersLoaded = true;
+
+    for (int i = 0; i < 2; i++)
+    {
+        // NOTE: Default vertex shader is used
+        lowResShaders[i] = LoadShaderFromMemory(NULL, codes[i]);
+        lowResShaderLocs[i] = GetShaderLocation(lowResShaders[i], params[i]);
 
-    // Required extension:
-    // GL_IMG_texture_compression_pvrtc
+        if ((lowResShaders[i].id == 0) || (lowResShaders[i].id == rlGetShaderIdDefault()) || (lowResShaderLocs[i] == -1))
+        {
+            TRACELOG(LOG_WARNING, "SHADER: Failed to load reduced resolution effects shaders");
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG       0x8C00
-    // GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG      0x8C02
+            // NOTE: On failure, rlgl could have returned the default shader program
+            if (lowResShaders[i].id != rlGetShaderIdDefault()) UnloadShader(lowResShaders[i]);
+            else RL_FREE(lowResShaders[i].locs);
 
-#if 0   // Not used...
-    // PVR file v2 Header (52 bytes)
-    typedef struct {
-        unsigned int headerLength;
-        unsigned int height;
-        unsigned int width;
-        unsigned int numMipmaps;
-        unsigned int flags;
-        unsigned int dataLength;
-        unsigned int bpp;
-        unsigned int bitmaskRed;
-        unsigned int bitmaskGreen;
-        unsigned int bitmaskBlue;
-        unsigned int bitmaskAlpha;
-        unsigned int pvrTag;
-        unsigned int numSurfs;
-    } PVRHeaderV2;
-#endif
+            lowResShaders[i] = (Shader){ 0 };
+        }
+    }
 
-    // PVR file v3 Header (52 bytes)
-    // NOTE: After it could be metadata (15 bytes?)
-    typedef struct {
-        char id[4];
-        unsigned int flags;
-        unsigned char channels[4];      // pixelFormat high part
-        unsigned char channelDepth[4];  // pixelFormat low part
-        unsigned int colourSpace;
-        unsigned int channelType;
-        unsigned int height;
-        unsigned int width;
-        unsigned int depth;
-        unsigned int numSurfaces;
-        unsigned int numFaces;
-        unsigned int numMipmaps;
-        unsigned int metaDataSize;
-    } PVRHeaderV3;
+    if ((lowResShaders[0].id > 0) && (lowResShaders[1].id > 0)) TRACELOG(LOG_INFO, "SHADER: [ID %i] Reduced resolution effects shaders loaded successfully", lowResShaders[1].id);
+}
 
-#if 0   // Not used...
-    // Metadata (usually 15 bytes)
-    typedef struct {
-        unsigned int devFOURCC;
-        unsigned int key;
-        unsigned int dataSize;      // Not used?
-        unsigned char *data;        // Not used?
-    } PVRMetadata;
-#endif
+// Draw clip space quad with shader, texture bound to 'texture0' and scene depth (if any) bound to 'texture1'
+// NOTE: Current matrices are replaced while drawing (effects are drawn within BeginMode3D())
+static void DrawLowResEffectsQuad(Shader shader, unsigned int textureId, unsigned int depthId)
+{
+    Matrix matProjection = rlGetMatrixProjection();
+    Matrix matModelview = rlGetMatrixModelview();
+    Matrix matIdentity = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    int depthSlot = 1;
 
-    Image image = { 0 };
+    rlSetMatrixProjection(matIdentity);
+    rlSetMatrixModelview(matIdentity);
 
-    if (fileDataPtr != NULL)
+    if (depthId > 0)
     {
-        // Check PVR image version
-        unsigned char pvrVersion = fileDataPtr[0];
+        SetShaderValue(shader, shader.locs[SHADER_LOC_MAP_SPECULAR], &depthSlot, SHADER_UNIFORM_INT);
+        rlActiveTextureSlot(depthSlot);
+        rlEnableTexture(depthId);
+        rlActiveTextureSlot(0);
+    }
 
-        // Load different PVR data formats
-        if (pvrVersion == 0x50)
-        {
-            PVRHeaderV3 *pvrHeader = (PVRHeaderV3 *)fileDataPtr;
+    rlSetShader(shader.id, shader.locs);
+    rlSetTexture(textureId);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlTexCoord2f(0.0f, 0.0f);
+        rlVertex2f(-1.0f, -1.0f);
 
-            if ((pvrHeader->id[0] != 'P') || (pvrHeader->id[1] != 'V') || (pvrHeader->id[2] != 'R') || (pvrHeader->id[3] != 3))
-            {
-                TRACELOG(LOG_WARNING, "IMAGE: PVR file data not valid");
-            }
-            else
-            {
-                fileDataPtr += sizeof(PVRHeaderV3);   // Skip header
+        rlTexCoord2f(1.0f, 0.0f);
+        rlVertex2f(1.0f, -1.0f);
 
-                image.width = pvrHeader->width;
-                image.height = pvrHeader->height;
-                image.mipmaps = pvrHeader->numMipmaps;
+        rlTexCoord2f(1.0f, 1.0f);
+        rlVertex2f(1.0f, 1.0f);
 
-                // Check data format
-                if (((pvrHeader->channels[0] == 'l') && (pvrHeader->channels[1] == 0)) && (pvrHeader->channelDepth[0] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-                else if (((pvrHeader->channels[0] == 'l') && (pvrHeader->channels[1] == 'a')) && ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8))) image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
-                else if ((pvrHeader->channels[0] == 'r') && (pvrHeader->channels[1] == 'g') && (pvrHeader->channels[2] == 'b'))
-                {
-                    if (pvrHeader->channels[3] == 'a')
-                    {
-                        if ((pvrHeader->channelDepth[0] == 5) && (pvrHeader->channelDepth[1] == 5) && (pvrHeader->channelDepth[2] == 5) && (pvrHeader->channelDepth[3] == 1)) image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;
-                        else if ((pvrHeader->channelDepth[0] == 4) && (pvrHeader->channelDepth[1] == 4) && (pvrHeader->channelDepth[2] == 4) && (pvrHeader->channelDepth[3] == 4)) image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;
-                        else if ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8) && (pvrHeader->channelDepth[2] == 8) && (pvrHeader->channelDepth[3] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-                    }
-                    else if (pvrHeader->channels[3] == 0)
-                    {
-                        if ((pvrHeader->channelDepth[0] == 5) && (pvrHeader->channelDepth[1] == 6) && (pvrHeader->channelDepth[2] == 5)) image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5;
-                        else if ((pvrHeader->channelDepth[0] == 8) && (pvrHeader->channelDepth[1] == 8) && (pvrHeader->channelDepth[2] == 8)) image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8;
-                    }
-                }
-                else if (pvrHeader->channels[0] == 2) image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB;
-                else if (pvrHeader->channels[0] == 3) image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA;
+        rlTexCoord2f(0.0f, 1.0f);
+        rlVertex2f(-1.0f, 1.0f);
+    rlEnd();
+    rlSetTexture(0);
 
-                fileDataPtr += pvrHeader->metaDataSize;    // Skip meta data header
+    rlDrawRenderBatchActive();
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
 
-                // Calculate data size (depends on format)
-                int bpp = 0;
-                switch (image.format)
-                {
-                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-                    case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-                    case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-                    default: break;
-                }
+    if (depthId > 0)
+    {
+        rlActiveTextureSlot(depthSlot);
+        rlDisableTexture();
+        rlActiveTextureSlot(0);
+    }
 
-                int dataSize = image.width*image.height*bpp/8;  // Total data size in bytes
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+    rlSetMatrixProjection(matProjection);
+    rlSetMatrixModelview(matModelview);
+}
+#endif
 
-                memcpy(image.data, fileDataPtr, dataSize);
-            }
+#if defined(IBL_SHADERS_SUPPORTED)
+// Load built-in image-based lighting shaders
+// NOTE: Fullscreen quad texcoords are mapped to cubemap face direction, one face rendered per draw
+static void LoadShadersIBL(void)
+{
+    const char *iblVShaderCode =
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "out vec2 fragTexCoord;             \n"
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // Shared functions: face direction from texcoords (OpenGL cubemap convention), Hammersley sequence, GGX sampling
+    const char *iblCommonCode =
+    "#version 330                       \n"
+    "in vec2 fragTexCoord;              \n"
+    "out vec4 finalColor;               \n"
+    "uniform int face;                  \n"
+    "uniform float roughness;           \n"
+    "uniform int sampleCount;           \n"
+    "const float PI = 3.14159265359;    \n"
+    "vec3 GetFaceDirection(vec2 uv)     \n"
+    "{                                  \n"
+    "    vec2 st = uv*2.0 - 1.0;        \n"
+    "    vec3 direction = vec3(st.x, -st.y, 1.0);  \n"
+    "    if (face == 0) direction = vec3(1.0, -st.y, -st.x);       \n"
+    "    else if (face == 1) direction = vec3(-1.0, -st.y, st.x);  \n"
+    "    else if (face == 2) direction = vec3(st.x, 1.0, st.y);    \n"
+    "    else if (face == 3) direction = vec3(st.x, -1.0, -st.y);  \n"
+    "    else if (face == 5) direction = vec3(-st.x, -st.y, -1.0); \n"
+    "    return normalize(direction);   \n"
+    "}                                  \n"
+    "vec2 Hammersley(uint i, uint n)    \n"
+    "{                                  \n"
+    "    uint bits = (i << 16u) | (i >> 16u);  \n"
+    "    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);  \n"
+    "    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);  \n"
+    "    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);  \n"
+    "    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);  \n"
+    "    return vec2(float(i)/float(n), float(bits)*2.3283064365386963e-10); \n"
+    "}                                  \n"
+    "mat3 GetTangentBasis(vec3 n)       \n"
+    "{                                  \n"
+    "    vec3 up = (abs(n.y) < 0.999)? vec3(0.0, 1.0, 0.0) : vec3(0.0, 0.0, 1.0); \n"
+    "    vec3 t = normalize(cross(up, n));  \n"
+    "    return mat3(t, cross(n, t), n);    \n"
+    "}                                  \n"
+    "vec3 SampleGGX(vec2 xi, float a)   \n"
+    "{                                  \n"
+    "    float phi = 2.0*PI*xi.x;       \n"
+    "    float cosTheta = sqrt((1.0 - xi.y)/(1.0 + (a*a - 1.0)*xi.y)); \n"
+    "    float sinTheta = sqrt(1.0 - cosTheta*cosTheta);  \n"
+    "    return vec3(cos(phi)*sinTheta, sin(phi)*sinTheta, cosTheta); \n"
+    "}                                  \n";
+
+    // Equirectangular panorama projection, latitude from top (v = 0) to bottom
+    const char *panoramaCode =
+    "uniform sampler2D texture0;        \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 dir = GetFaceDirection(fragTexCoord); \n"
+    "    vec2 uv = vec2(atan(dir.z, dir.x)/(2.0*PI) + 0.5, 0.5 - asin(clamp(dir.y, -1.0, 1.0))/PI); \n"
+    "    finalColor = vec4(textureLod(texture0, uv, 0.0).rgb, 1.0); \n"
+    "}                                  \n";
+
+    // Cosine-weighted hemisphere sampling, sample mipmap level from sample solid angle (filtered importance sampling)
+    const char *irradianceCode =
+    "uniform samplerCube environmentMap;  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 n = GetFaceDirection(fragTexCoord); \n"
+    "    mat3 tbn = GetTangentBasis(n);   \n"
+    "    float sourceSize = float(textureSize(environmentMap, 0).x); \n"
+    "    float texelSolidAngle = 4.0*PI/(6.0*sourceSize*sourceSize); \n"
+    "    vec3 irradiance = vec3(0.0);     \n"
+    "    for (int i = 0; i < sampleCount; i++) \n"
+    "    {                                \n"
+    "        vec2 xi = Hammersley(uint(i), uint(sampleCount)); \n"
+    "        float phi = 2.0*PI*xi.x;     \n"
+    "        float cosTheta = sqrt(1.0 - xi.y); \n"
+    "        float sinTheta = sqrt(xi.y); \n"
+    "        vec3 l = tbn*vec3(cos(phi)*sinTheta, sin(phi)*sinTheta, cosTheta); \n"
+    "        float sampleSolidAngle = PI/(float(sampleCount)*max(cosTheta, 0.0001)); \n"
+    "        float lod = max(0.5*log2(sampleSolidAngle/texelSolidAngle) + 1.0, 0.0); \n"
+    "        irradiance += textureLod(environmentMap, l, lod).rgb; \n"
+    "    }                                \n"
+    "    finalColor = vec4(irradiance/float(sampleCount), 1.0); \n"
+    "}                                  \n";
+
+    // GGX importance sampling with view = normal = reflection, samples weighted by NdotL
+    const char *prefilterCode =
+    "uniform samplerCube environmentMap;  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec3 n = GetFaceDirection(fragTexCoord); \n"
+    "    if (roughness == 0.0) { finalColor = vec4(textureLod(environmentMap, n, 0.0).rgb, 1.0); return; } \n"
+    "    mat3 tbn = GetTangentBasis(n);   \n"
+    "    float a = roughness*roughness;   \n"
+    "    float sourceSize = float(textureSize(environmentMap, 0).x); \n"
+    "    float texelSolidAngle = 4.0*PI/(6.0*sourceSize*sourceSize); \n"
+    "    vec3 color = vec3(0.0);          \n"
+    "    float weight = 0.0;              \n"
+    "    for (int i = 0; i < sampleCount; i++) \n"
+    "    {                                \n"
+    "        vec3 h = tbn*SampleGGX(Hammersley(uint(i), uint(sampleCount)), a); \n"
+    "        vec3 l = normalize(2.0*dot(n, h)*h - n); \n"
+    "        float NdotL = dot(n, l);     \n"
+    "        if (NdotL > 0.0)             \n"
+    "        {                            \n"
+    "            float NdotH = max(dot(n, h), 0.0); \n"
+    "            float d = NdotH*NdotH*(a*a - 1.0) + 1.0; \n"
+    "            float pdf = a*a/(PI*d*d)*0.25 + 0.0001; \n"
+    "            float sampleSolidAngle = 1.0/(float(sampleCount)*pdf); \n"
+    "            float lod = max(0.5*log2(sampleSolidAngle/texelSolidAngle) + 1.0, 0.0); \n"
+    "            color += textureLod(environmentMap, l, lod).rgb*NdotL; \n"
+    "            weight += NdotL;         \n"
+    "        }                            \n"
+    "    }                                \n"
+    "    finalColor = vec4(color/max(weight, 0.0001), 1.0); \n"
+    "}                                  \n";
+
+    // Split-sum BRDF integration: x = NdotV, y = roughness, result is F0 scale (r) and bias (g)
+    const char *brdfCode =
+    "void main()                        \n"
+    "{                                  \n"
+    "    float NdotV = max(fragTexCoord.x, 0.0001); \n"
+    "    float a = fragTexCoord.y*fragTexCoord.y; \n"
+    "    float k = a*0.5;                 \n"
+    "    vec3 v = vec3(sqrt(1.0 - NdotV*NdotV), 0.0, NdotV); \n"
+    "    vec2 result = vec2(0.0);         \n"
+    "    for (int i = 0; i < sampleCount; i++) \n"
+    "    {                                \n"
+    "        vec3 h = SampleGGX(Hammersley(uint(i), uint(sampleCount)), a); \n"
+    "        vec3 l = normalize(2.0*dot(v, h)*h - v); \n"
+    "        float NdotL = max(l.z, 0.0); \n"
+    "        if (NdotL > 0.0)             \n"
+    "        {                            \n"
+    "            float NdotH = max(h.z, 0.0001); \n"
+    "            float VdotH = max(dot(v, h), 0.0); \n"
+    "            float g = (NdotV/(NdotV*(1.0 - k) + k))*(NdotL/(NdotL*(1.0 - k) + k)); \n"
+    "            float visibility = g*VdotH/(NdotH*NdotV); \n"
+    "            float fresnel = pow(1.0 - VdotH, 5.0); \n"
+    "            result += vec2((1.0 - fresnel)*visibility, fresnel*visibility); \n"
+    "        }                            \n"
+    "    }                                \n"
+    "    finalColor = vec4(result/float(sampleCount), 0.0, 1.0); \n"
+    "}                                  \n";
+
+    const char *iblShadersCode[4] = { panoramaCode, irradianceCode, prefilterCode, brdfCode };
+    const char *iblShadersNames[4] = { "panorama", "irradiance", "prefilter", "BRDF" };
+
+    iblShadersLoaded = true;
+
+    for (int i = 0; i < 4; i++)
+    {
+        char *code = (char *)RL_MALLOC(strlen(iblCommonCode) + strlen(iblShadersCode[i]) + 1);
+        strcpy(code, iblCommonCode);
+        strcat(code, iblShadersCode[i]);
+
+        iblShaders[i] = LoadShaderFromMemory(iblVShaderCode, code);
+        iblShaderLocs[i][0] = GetShaderLocation(iblShaders[i], "face");
+        iblShaderLocs[i][1] = GetShaderLocation(iblShaders[i], "environmentMap");
+        iblShaderLocs[i][2] = GetShaderLocation(iblShaders[i], "roughness");
+        iblShaderLocs[i][3] = GetShaderLocation(iblShaders[i], "sampleCount");
+        RL_FREE(code);
+
+        if ((iblShaders[i].id > 0) && (iblShaders[i].id != rlGetShaderIdDefault())) TRACELOG(LOG_INFO, "SHADER: [ID %i] IBL %s shader loaded successfully", iblShaders[i].id, iblShadersNames[i]);
+        else
+        {
+            TRACELOG(LOG_WARNING, "SHADER: Failed to load IBL %s shader", iblShadersNames[i]);
+
+            // NOTE: On failure, rlgl could have returned the default shader program
+            if (iblShaders[i].id != rlGetShaderIdDefault()) UnloadShader(iblShaders[i]);
+            else RL_FREE(iblShaders[i].locs);
+
+            iblShaders[i] = (Shader){ 0 };
         }
-        else if (pvrVersion == 52) TRACELOG(LOG_INFO, "IMAGE: PVRv2 format not supported, update your files to PVRv3");
     }
-
-    return image;
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_ASTC)
-// Load ASTC compressed image data (ASTC compression)
-static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize)
+// Render image-based lighting shader into every face and mipmap level of texture (cubemap or 2d texture for BRDF)
+// NOTE: Source is a panorama texture (texture0) or an environment cubemap (texture unit 1),
+// framebuffer, viewport and matrices are restored, pending batch is drawn before
+static bool RenderTextureIBL(int type, unsigned int id, int size, int mipmapCount, Texture source)
 {
-    unsigned char *fileDataPtr = (unsigned char *)fileData;
+    if (!iblShadersLoaded) LoadShadersIBL();
 
-    // Required extensions:
-    // GL_KHR_texture_compression_astc_hdr
-    // GL_KHR_texture_compression_astc_ldr
+    Shader shader = iblShaders[type];
+    if (shader.id == 0) return false;
 
-    // Supported tokens (defined by extensions)
-    // GL_COMPRESSED_RGBA_ASTC_4x4_KHR      0x93b0
-    // GL_COMPRESSED_RGBA_ASTC_8x8_KHR      0x93b7
+    unsigned int fboId = rlLoadFramebuffer(size, size);
+    if (fboId == 0) return false;
 
-    // ASTC file Header (16 bytes)
-    typedef struct {
-        unsigned char id[4];        // Signature: 0x13 0xAB 0xA1 0x5C
-        unsigned char blockX;       // Block X dimensions
-        unsigned char blockY;       // Block Y dimensions
-        unsigned char blockZ;       // Block Z dimensions (1 for 2D images)
-        unsigned char width[3];     // Image width in pixels (24bit value)
-        unsigned char height[3];    // Image height in pixels (24bit value)
-        unsigned char length[3];    // Image Z-size (1 for 2D images)
-    } ASTCHeader;
+    int faces = (type == IBL_SHADER_BRDF)? 1 : 6;
+    int samples[4] = { 1, IBL_IRRADIANCE_SAMPLES, IBL_PREFILTER_SAMPLES, IBL_BRDF_SAMPLES };
+    int sourceSlot = 1;
+    bool success = true;
 
-    Image image = { 0 };
+    rlDrawRenderBatchActive();
 
-    if (fileDataPtr != NULL)
-    {
-        ASTCHeader *astcHeader = (ASTCHeader *)fileDataPtr;
+    unsigned int framebuffer = rlGetActiveFramebuffer();
+    int viewport[4] = { 0 };
+    rlGetViewport(&viewport[0], &viewport[1], &viewport[2], &viewport[3]);
 
-        if ((astcHeader->id[3] != 0x5c) || (astcHeader->id[2] != 0xa1) || (astcHeader->id[1] != 0xab) || (astcHeader->id[0] != 0x13))
-        {
-            TRACELOG(LOG_WARNING, "IMAGE: ASTC file data not valid");
-        }
-        else
-        {
-            fileDataPtr += sizeof(ASTCHeader);   // Skip header
+    // Faces are drawn by rlgl batch in clip space
+    rlMatrixMode(RL_PROJECTION);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlMatrixMode(RL_MODELVIEW);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlDisableColorBlend();
 
-            // NOTE: Assuming Little Endian (could it be wrong?)
-            image.width = 0x00000000 | ((int)astcHeader->width[2] << 16) | ((int)astcHeader->width[1] << 8) | ((int)astcHeader->width[0]);
-            image.height = 0x00000000 | ((int)astcHeader->height[2] << 16) | ((int)astcHeader->height[1] << 8) | ((int)astcHeader->height[0]);
+    SetShaderValue(shader, iblShaderLocs[type][3], &samples[type], SHADER_UNIFORM_INT);
 
-            TRACELOGD("IMAGE: ASTC file data info:");
-            TRACELOGD("    > Image width:  %i", image.width);
-            TRACELOGD("    > Image height: %i", image.height);
-            TRACELOGD("    > Image blocks: %ix%i", astcHeader->blockX, astcHeader->blockY);
+    if ((type == IBL_SHADER_IRRADIANCE) || (type == IBL_SHADER_PREFILTER))
+    {
+        SetShaderValue(shader, iblShaderLocs[type][1], &sourceSlot, SHADER_UNIFORM_INT);
+        rlActiveTextureSlot(sourceSlot);
+        rlEnableTextureCubemap(source.id);
+        rlActiveTextureSlot(0);
+    }
 
-            image.mipmaps = 1;      // NOTE: ASTC format only contains one mipmap level
+    for (int level = 0, levelSize = size; (level < mipmapCount) && success; level++, levelSize = (levelSize > 1)? levelSize/2 : 1)
+    {
+        float roughness = (mipmapCount > 1)? (float)level/(float)(mipmapCount - 1) : 0.0f;
+        SetShaderValue(shader, iblShaderLocs[type][2], &roughness, SHADER_UNIFORM_FLOAT);
 
-            // NOTE: Each block is always stored in 128bit so we can calculate the bpp
-            int bpp = 128/(astcHeader->blockX*astcHeader->blockY);
+        for (int face = 0; face < faces; face++)
+        {
+            rlFramebufferAttach(fboId, id, RL_ATTACHMENT_COLOR_CHANNEL0, (faces == 6)? RL_ATTACHMENT_CUBEMAP_POSITIVE_X + face : RL_ATTACHMENT_TEXTURE2D, level);
 
-            // NOTE: Currently we only support 2 blocks configurations: 4x4 and 8x8
-            if ((bpp == 8) || (bpp == 2))
+            if (!rlFramebufferComplete(fboId))
             {
-                int dataSize = image.width*image.height*bpp/8;  // Data size in bytes
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Format can not be used as IBL render target", id);
+                success = false;
+                break;
+            }
 
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+            rlEnableFramebuffer(fboId);
+            rlViewport(0, 0, levelSize, levelSize);
+            SetShaderValue(shader, iblShaderLocs[type][0], &face, SHADER_UNIFORM_INT);
 
-                memcpy(image.data, fileDataPtr, dataSize);
+            rlSetShader(shader.id, shader.locs);
+            rlSetTexture((type == IBL_SHADER_PANORAMA)? source.id : 0);
+            rlBegin(RL_QUADS);
+                rlColor4ub(255, 255, 255, 255);
+                rlTexCoord2f(0.0f, 0.0f);
+                rlVertex2f(-1.0f, -1.0f);
 
-                if (bpp == 8) image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA;
-                else if (bpp == 2) image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
-            }
-            else TRACELOG(LOG_WARNING, "IMAGE: ASTC block size configuration not supported");
+                rlTexCoord2f(1.0f, 0.0f);
+                rlVertex2f(1.0f, -1.0f);
+
+                rlTexCoord2f(1.0f, 1.0f);
+                rlVertex2f(1.0f, 1.0f);
+
+                rlTexCoord2f(0.0f, 1.0f);
+                rlVertex2f(-1.0f, 1.0f);
+            rlEnd();
+            rlSetTexture(0);
+
+            rlDrawRenderBatchActive();
         }
     }
 
-    return image;
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+
+    if ((type == IBL_SHADER_IRRADIANCE) || (type == IBL_SHADER_PREFILTER))
+    {
+        rlActiveTextureSlot(sourceSlot);
+        rlDisableTextureCubemap();
+        rlActiveTextureSlot(0);
+    }
+
+    rlEnableColorBlend();
+    rlMatrixMode(RL_MODELVIEW);
+    rlPopMatrix();
+    rlMatrixMode(RL_PROJECTION);
+    rlPopMatrix();
+    rlMatrixMode(RL_MODELVIEW);
+
+    rlUnloadFramebuffer(fboId);
+    rlEnableFramebuffer(framebuffer);
+    rlViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    if (success) TRACELOG(LOG_INFO, "TEXTURE: [ID %i] IBL %s map generated successfully (%ix%i | %i mipmaps)", id, (type == IBL_SHADER_BRDF)? "BRDF" : "cubemap", size, size, mipmapCount);
+
+    return success;
 }
 #endif
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
+#if defined(PATTERN_SHADERS_SUPPORTED)
+// Load built-in procedural pattern shaders
+// NOTE: Patterns are computed in pixel coordinates (gl_FragCoord), rlgl default vertex shader is used,
+// random values come from an arithmetic hash (no integer ops or sin(), valid on GLSL 100)
+static void LoadShadersPattern(void)
 {
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *header = "#version 120\n#define FRAG_COLOR gl_FragColor\n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *header = "#version 330\nout vec4 finalColor;\n#define FRAG_COLOR finalColor\n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    const char *header = "#version 100\n#ifdef GL_FRAGMENT_PRECISION_HIGH\nprecision highp float;\n#else\nprecision mediump float;\n#endif\n#define FRAG_COLOR gl_FragColor\n";
+#endif
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    const char *patternCommonCode =
+    "uniform vec4 colorA;               \n"
+    "uniform vec4 colorB;               \n"
+    "uniform vec4 params;               \n"
+    "float Hash(vec2 p)                 \n"
+    "{                                  \n"
+    "    vec3 p3 = fract(vec3(p.xyx)*0.1031); \n"
+    "    p3 += dot(p3, p3.yzx + 33.33); \n"
+    "    return fract((p3.x + p3.y)*p3.z); \n"
+    "}                                  \n";
+
+    // Radial gradient, params: density, center (x, y), radius
+    const char *gradientRadialCode =
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 p = gl_FragCoord.xy - 0.5; \n"
+    "    float factor = clamp((distance(p, params.yz) - params.w*params.x)/(params.w*(1.0 - params.x)), 0.0, 1.0); \n"
+    "    FRAG_COLOR = mix(colorA, colorB, factor); \n"
+    "}                                  \n";
+
+    // Checked, params: checks size (x, y)
+    const char *checkedCode =
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 check = floor((gl_FragCoord.xy - 0.5)/params.xy); \n"
+    "    FRAG_COLOR = (mod(check.x + check.y, 2.0) < 0.5)? colorA : colorB; \n"
+    "}                                  \n";
+
+    // White noise, params: white factor, seed
+    const char *whiteNoiseCode =
+    "void main()                        \n"
+    "{                                  \n"
+    "    FRAG_COLOR = (Hash(gl_FragCoord.xy - 0.5 + params.y) < params.x)? colorA : colorB; \n"
+    "}                                  \n";
+
+    // Cellular, params: tile size, tiles per row, tiles per column, seed
+    const char *cellularCode =
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 p = gl_FragCoord.xy - 0.5; \n"
+    "    vec2 tile = floor(p/params.x); \n"
+    "    float minDistance = 65536.0;   \n"
+    "    for (int j = -1; j <= 1; j++)  \n"
+    "    {                              \n"
+    "        for (int i = -1; i <= 1; i++) \n"
+    "        {                          \n"
+    "            vec2 t = tile + vec2(float(i), float(j)); \n"
+    "            if ((t.x < 0.0) || (t.y < 0.0) || (t.x >= params.y) || (t.y >= params.z)) continue; \n"
+    "            vec2 seed = t*params.x + floor(vec2(Hash(t + params.w), Hash(t.yx + params.w + 17.0))*params.x); \n"
+    "            minDistance = min(minDistance, distance(p, seed)); \n"
+    "        }                          \n"
+    "    }                              \n"
+    "    float intensity = min(floor(minDistance*256.0/params.x), 255.0)/255.0; \n"
+    "    FRAG_COLOR = vec4(vec3(intensity), 1.0); \n"
+    "}                                  \n";
+
+    // Perlin noise, params: offset (x, y), scale (x, y)
+    const char *perlinNoiseCode =
+    "float Noise(vec2 q)                \n"
+    "{                                  \n"
+    "    vec2 i = floor(q);             \n"
+    "    vec2 f = fract(q);             \n"
+    "    vec2 u = f*f*f*(f*(f*6.0 - 15.0) + 10.0); \n"
+    "    float a = dot(cos(Hash(i)*6.2831853 + vec2(0.0, -1.5707963)), f); \n"
+    "    float b = dot(cos(Hash(i + vec2(1.0, 0.0))*6.2831853 + vec2(0.0, -1.5707963)), f - vec2(1.0, 0.0)); \n"
+    "    float c = dot(cos(Hash(i + vec2(0.0, 1.0))*6.2831853 + vec2(0.0, -1.5707963)), f - vec2(0.0, 1.0)); \n"
+    "    float d = dot(cos(Hash(i + vec2(1.0, 1.0))*6.2831853 + vec2(0.0, -1.5707963)), f - vec2(1.0, 1.0)); \n"
+    "    return mix(mix(a, b, u.x), mix(c, d, u.x), u.y); \n"
+    "}                                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 q = (gl_FragCoord.xy - 0.5 + params.xy)*params.zw; \n"
+    "    float sum = 0.0;               \n"
+    "    float amplitude = 1.0;         \n"
+    "    for (int i = 0; i < 6; i++)    \n"
+    "    {                              \n"
+    "        sum += amplitude*Noise(q); \n"
+    "        q *= 2.0;                  \n"
+    "        amplitude *= 0.5;          \n"
+    "    }                              \n"
+    "    float intensity = clamp((sum + 1.0)*0.5, 0.0, 1.0); \n"
+    "    FRAG_COLOR = vec4(vec3(intensity), 1.0); \n"
+    "}                                  \n";
+
+    const char *patternShadersCode[PATTERN_SHADERS] = { gradientRadialCode, checkedCode, whiteNoiseCode, cellularCode, perlinNoiseCode };
+    const char *patternShadersNames[PATTERN_SHADERS] = { "radial gradient", "checked", "white noise", "cellular", "perlin noise" };
+
+    patternShadersLoaded = true;
+
+    for (int i = 0; i < PATTERN_SHADERS; i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        char *code = (char *)RL_MALLOC(strlen(header) + strlen(patternCommonCode) + strlen(patternShadersCode[i]) + 1);
+        strcpy(code, header);
+        strcat(code, patternCommonCode);
+        strcat(code, patternShadersCode[i]);
+
+        // NOTE: Default vertex shader is used
+        patternShaders[i] = LoadShaderFromMemory(NULL, code);
+        patternShaderLocs[i][0] = GetShaderLocation(patternShaders[i], "colorA");
+        patternShaderLocs[i][1] = GetShaderLocation(patternShaders[i], "colorB");
+        patternShaderLocs[i][2] = GetShaderLocation(patternShaders[i], "params");
+        RL_FREE(code);
+
+        if ((patternShaders[i].id > 0) && (patternShaders[i].id != rlGetShaderIdDefault())) TRACELOG(LOG_INFO, "SHADER: [ID %i] Pattern %s shader loaded successfully", patternShaders[i].id, patternShadersNames[i]);
+        else
         {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+            TRACELOG(LOG_WARNING, "SHADER: Failed to load pattern %s shader", patternShadersNames[i]);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+            // NOTE: On failure, rlgl could have returned the default shader program
+            if (patternShaders[i].id != rlGetShaderIdDefault()) UnloadShader(patternShaders[i]);
+            else RL_FREE(patternShaders[i].locs);
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+            patternShaders[i] = (Shader){ 0 };
+        }
+    }
+}
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+// Render procedural pattern shader into a new texture (RGBA, 1 mipmap), empty texture if shader is not available
+// NOTE: Texture rows match GenImage*() rows (first row at y = 0), framebuffer, viewport and matrices are restored
+static Texture2D RenderTexturePattern(int type, int width, int height, Color colorA, Color colorB, Vector4 params)
+{
+    Texture2D texture = { 0 };
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    if (!patternShadersLoaded) LoadShadersPattern();
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+    Shader shader = patternShaders[type];
+    if ((shader.id == 0) || (width <= 0) || (height <= 0)) return texture;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    unsigned int fboId = rlLoadFramebuffer(width, height);
+    if (fboId == 0) return texture;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    texture.width = width;
+    texture.height = height;
+    texture.mipmaps = 1;
+    texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+    rlFramebufferAttach(fboId, texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+    if ((texture.id == 0) || !rlFramebufferComplete(fboId))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to setup pattern render target");
+        rlUnloadFramebuffer(fboId);
+        if (texture.id > 0) rlUnloadTexture(texture.id);
+        return (Texture2D){ 0 };
+    }
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+    rlDrawRenderBatchActive();
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    unsigned int framebuffer = rlGetActiveFramebuffer();
+    int viewport[4] = { 0 };
+    rlGetViewport(&viewport[0], &viewport[1], &viewport[2], &viewport[3]);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    // Pattern quad is drawn by rlgl batch in clip space
+    rlMatrixMode(RL_PROJECTION);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlMatrixMode(RL_MODELVIEW);
+    rlPushMatrix();
+    rlLoadIdentity();
+    rlDisableColorBlend();
 
-                    k += 4;
-                }
-                default: break;
-            }
-        }
-    }
+    Vector4 colors[2] = { ColorNormalize(colorA), ColorNormalize(colorB) };
+    SetShaderValue(shader, patternShaderLocs[type][0], &colors[0], SHADER_UNIFORM_VEC4);
+    SetShaderValue(shader, patternShaderLocs[type][1], &colors[1], SHADER_UNIFORM_VEC4);
+    SetShaderValue(shader, patternShaderLocs[type][2], &params, SHADER_UNIFORM_VEC4);
 
-    return pixels;
+    rlEnableFramebuffer(fboId);
+    rlViewport(0, 0, width, height);
+
+    rlSetShader(shader.id, shader.locs);
+    rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlVertex2f(-1.0f, -1.0f);
+        rlVertex2f(1.0f, -1.0f);
+        rlVertex2f(1.0f, 1.0f);
+        rlVertex2f(-1.0f, 1.0f);
+    rlEnd();
+    rlDrawRenderBatchActive();
+
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+
+    rlEnableColorBlend();
+    rlMatrixMode(RL_MODELVIEW);
+    rlPopMatrix();
+    rlMatrixMode(RL_PROJECTION);
+    rlPopMatrix();
+    rlMatrixMode(RL_MODELVIEW);
+
+    rlUnloadFramebuffer(fboId);
+    rlEnableFramebuffer(framebuffer);
+    rlViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Pattern texture generated successfully (%ix%i)", texture.id, width, height);
+
+    return texture;
 }
+#endif
 
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -8,6 +8,35 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_TRACELOG_ASYNC
+*       TraceLog() messages formatted into a lock-free ring (TRACELOG_ASYNC_RING_SIZE) and printed by a background
+*       thread, full ring drops messages (dropped count is reported), LOG_WARNING or higher messages are printed
+*       on call (after queued ones), uses POSIX threads
+*
+*   #define SUPPORT_ASYNC_LOADING
+*       Async assets loading jobs: file read and decode run on worker threads (ASYNC_LOAD_THREADS),
+*       GPU upload runs on the main thread at EndDrawing() within a time budget, uses POSIX threads
+*
+*   #define SUPPORT_FILE_PACKS
+*       Pack archives mounted as a virtual file system, checked first by LoadFileData() and LoadFileText(),
+*       entries are memory-mapped when supported (zero-copy data views) or read directly from pack file
+*
+*   #define SUPPORT_NATIVE_FILEIO
+*       Files read with large unbuffered reads (libnx fs service on NX fsdev mounts, romfs devoptab without stdio buffering),
+*       file streams read blocks ahead of read position with jobs (music, video sequential reads)
+*
+*   #define SUPPORT_RESOURCE_CACHE
+*       Resources loaded from files (textures, shaders, fonts, models, sounds) are cached by path and load parameters,
+*       duplicate loads return the cached resource with a reference added, unload releases one reference
+*
+*   #define SUPPORT_MEMORY_TRACKING
+*       Modules allocations (RL_MALLOC, RL_CALLOC, RL_REALLOC, RL_FREE) tracked by subsystem memory tag,
+*       live/peak bytes and allocations per frame are available with GetMemoryStats()
+*
+*   #define SUPPORT_CUSTOM_ALLOCATORS
+*       Modules allocations routed to custom allocators by memory tag (SetAllocator()),
+*       allocations are registered (SUPPORT_MEMORY_TRACKING) to be released with their allocator
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -37,7 +66,20 @@
     #include "config.h"                 // Defines module configuration flags
 #endif
 
+#if defined(SUPPORT_MEMORY_TRACKING) || defined(SUPPORT_CUSTOM_ALLOCATORS)
+    #include <stdlib.h>                 // Required for: malloc(), calloc(), realloc(), free()
+
+// Tracked allocations use the raw allocator, defined before utils.h replaces RL_* allocators
+static void *MemAllocUntracked(size_t size) { return RL_MALLOC(size); }
+static void *MemCallocUntracked(size_t count, size_t size) { return RL_CALLOC(count, size); }
+static void *MemReallocUntracked(void *ptr, size_t size) { return RL_REALLOC(ptr, size); }
+static void MemFreeUntracked(void *ptr) { RL_FREE(ptr); }
+
+    #define RL_MEMORY_TAG   MEMORY_TAG_FILES    // Module allocations memory tag
+#endif
+
 #include "utils.h"
+#include "rlgl.h"                       // Required for: rlGetVideoMemoryStats()
 
 #if defined(PLATFORM_ANDROID)
     #include <errno.h>                  // Required for: Android error types
@@ -50,24 +92,425 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_ASYNC_LOADING) && !defined(_MSC_VER) && !defined(PLATFORM_WEB)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_cond_wait() [Used in SubmitAsyncJob()]
+    #define ASYNC_JOBS_THREADED         // Async load jobs decoded on worker threads, otherwise decoded on submit
+#endif
+
+#if (defined(SUPPORT_MEMORY_TRACKING) || defined(SUPPORT_CUSTOM_ALLOCATORS)) && !defined(_MSC_VER) && !defined(PLATFORM_WEB)
+    #include <pthread.h>                // Required for: pthread_mutex_lock() [Used in MemAllocTracked()]
+    #define MEMORY_TRACKING_THREADED    // Allocations tracked from any thread, tracker access locked
+#endif
+
+#if defined(SUPPORT_TRACELOG) && defined(SUPPORT_TRACELOG_ASYNC) && !defined(_MSC_VER) && !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_3DS)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_once() [Used in TraceLog()]
+    #include <time.h>                   // Required for: nanosleep() [Used in TraceLogThread()]
+    #define TRACELOG_ASYNC_THREADED     // Trace-log messages printed by background thread, otherwise printed on call
+
+    #define TRACELOG_ATOMIC_LOAD(ptr)           __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define TRACELOG_ATOMIC_STORE(ptr, value)   __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define TRACELOG_ATOMIC_EXCHANGE(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+    #define TRACELOG_ATOMIC_ADD(ptr, value)     __atomic_fetch_add((ptr), (value), __ATOMIC_ACQ_REL)
+    #define TRACELOG_ATOMIC_CAS(ptr, expected, value) __atomic_compare_exchange_n((ptr), (expected), (value), true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    #if !defined(_MSC_VER)
+        #define PROFILE_ATOMIC_LOAD(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+        #define PROFILE_ATOMIC_STORE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+        #define PROFILE_ATOMIC_ADD(ptr, value)  __atomic_fetch_add((ptr), (value), __ATOMIC_ACQ_REL)
+    #else
+        #define PROFILE_ATOMIC_LOAD(ptr)        (*(ptr))
+        #define PROFILE_ATOMIC_STORE(ptr, value) (*(ptr) = (value))
+        #define PROFILE_ATOMIC_ADD(ptr, value)  ((*(ptr) += (value)) - (value))
+    #endif
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+    #if (defined(__linux__) || defined(__APPLE__)) && !defined(PLATFORM_ANDROID) && !defined(PLATFORM_WEB)
+        #include <sys/mman.h>           // Required for: mmap(), munmap()
+        #include <fcntl.h>              // Required for: open()
+        #include <unistd.h>             // Required for: close()
+        #define FILE_PACKS_MMAP         // File packs memory-mapped, otherwise entries read from pack file
+    #endif
+#endif
+#if defined(SUPPORT_NATIVE_FILEIO) && defined(PLATFORM_NX)
+    #include <switch.h>                 // Required for: fsdevTranslatePath(), fsFsOpenFile(), fsFileRead()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: read(), lseek(), close()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     128     // Max length of one trace-log message
 #endif
+#ifndef TRACELOG_ASYNC_RING_SIZE
+    #define TRACELOG_ASYNC_RING_SIZE    256     // Async trace-log ring messages (power of two)
+#endif
+#ifndef TRACELOG_ASYNC_MSG_LENGTH
+    #define TRACELOG_ASYNC_MSG_LENGTH   256     // Async trace-log formatted message max length
+#endif
+#ifndef TRACELOG_ASYNC_FLUSH_INTERVAL
+    #define TRACELOG_ASYNC_FLUSH_INTERVAL 4     // Async trace-log background thread flush interval (in milliseconds)
+#endif
+#ifndef MAX_ASYNC_LOAD_JOBS
+    #define MAX_ASYNC_LOAD_JOBS          64     // Maximum async load jobs not yet retrieved
+#endif
+#ifndef ASYNC_LOAD_THREADS
+    #define ASYNC_LOAD_THREADS            2     // Async load worker threads (file read and decode)
+#endif
+#ifndef ASYNC_LOAD_FRAME_BUDGET
+    #define ASYNC_LOAD_FRAME_BUDGET    2.0f     // Async load upload stage time budget per frame (in milliseconds)
+#endif
+#ifndef ASYNC_LOAD_FRAME_TRANSFER
+    #define ASYNC_LOAD_FRAME_TRANSFER  8388608  // Async load GPU transfers bytes budget per frame (pixel buffers uploads)
+#endif
+#ifndef MAX_FILE_PACKS
+    #define MAX_FILE_PACKS                8     // Maximum file packs mounted at the same time
+#endif
+#ifndef FILE_PACK_ALIGNMENT
+    #define FILE_PACK_ALIGNMENT          16     // File pack entries data alignment on export (in bytes)
+#endif
+#ifndef FILE_PACK_COMPRESSION_CODEC
+    #define FILE_PACK_COMPRESSION_CODEC   0     // File pack entries compression codec on export: 0-DEFLATE, 1-LZ4
+#endif
+
+#ifndef FILE_IO_READ_CHUNK
+    #define FILE_IO_READ_CHUNK      1048576     // Native file io reads size (aligned offsets), larger reads are split
+#endif
+#ifndef FILE_STREAM_BLOCK_SIZE
+    #define FILE_STREAM_BLOCK_SIZE   262144     // File streams read-ahead block size (in bytes)
+#endif
+#ifndef FILE_STREAM_BLOCKS
+    #define FILE_STREAM_BLOCKS            4     // File streams read-ahead blocks, blocks ahead of read position are read by jobs
+#endif
+#ifndef SCRATCH_MEMORY_SIZE
+    #define SCRATCH_MEMORY_SIZE     1048576     // Scratch memory arena size per thread (in bytes), larger temporaries use the heap
+#endif
+
+#ifndef PROFILE_CAPTURE_DEFAULT_EVENTS
+    #define PROFILE_CAPTURE_DEFAULT_EVENTS  262144  // Profiling capture events buffer size, if not provided to StartProfileCapture()
+#endif
+
+#ifndef ASSET_HOT_RELOAD_INTERVAL
+    #define ASSET_HOT_RELOAD_INTERVAL  0.5f     // Assets hot-reload watched files check interval (in seconds)
+#endif
+
+#ifndef MAX_MEMORY_ALLOCATORS
+    #define MAX_MEMORY_ALLOCATORS        16     // Maximum custom allocators set (SetAllocator()), kept while allocations could use them
+#endif
+
+#define SCRATCH_MEMORY_ALIGNMENT         16     // Scratch memory allocations alignment (in bytes)
+#define MEMORY_TRACKING_MIN_CAPACITY   1024     // Tracked allocations table initial capacity (power of two)
+
+#define FILE_PACK_VERSION                 1     // File pack format version
+#define FILE_IO_ALIGNMENT              4096     // File streams blocks memory alignment (in bytes)
+#define MAX_FILE_PACK_PATH_LENGTH       512     // Maximum file pack entry path length (normalized)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Scratch memory arena, linear allocator for functions temporaries
+typedef struct ScratchArena {
+    unsigned char *data;        // Arena memory (SCRATCH_MEMORY_SIZE), allocated on first use
+    unsigned int offset;        // Arena memory used (in bytes)
+    int live;                   // Allocations not freed yet, arena is rewound once all are freed
+} ScratchArena;
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Tracked allocation, allocations table entry
+typedef struct MemoryAllocation {
+    void *ptr;                  // Allocation address, NULL if table entry is free
+    size_t size;                // Allocation size (in bytes)
+    int tag;                    // Allocation memory tag (MemoryTag)
+    int allocator;              // Allocator used, 0 for default allocator (RL_MALLOC)
+} MemoryAllocation;
+
+// Custom allocator callbacks (SetAllocator())
+typedef struct MemoryAllocator {
+    MemAllocCallback alloc;     // Allocation function
+    MemReallocCallback realloc; // Reallocation function, optional (allocation, copy and free)
+    MemFreeCallback free;       // Free function
+    void *userData;             // Callbacks user data
+} MemoryAllocator;
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+// Async load job state
+typedef enum {
+    ASYNC_JOB_FREE = 0,         // Job slot not used
+    ASYNC_JOB_QUEUED,           // Waiting for a worker thread
+    ASYNC_JOB_DECODING,         // Decode stage running (worker thread)
+    ASYNC_JOB_DECODED,          // Waiting for upload stage (main thread)
+    ASYNC_JOB_UPLOADING,        // Upload stage running (main thread)
+    ASYNC_JOB_DEFERRED,         // Upload stage waiting for GPU (i.e. transfer fence), runs again next frame
+    ASYNC_JOB_DONE,             // Job data ready to be retrieved
+    ASYNC_JOB_FAILED            // Job failed, no data to retrieve
+} AsyncJobState;
+
+// Async load job
+typedef struct AsyncJob {
+    unsigned int handle;        // Job handle, 0 if slot is free
+    int type;                   // Job data type: AsyncJobType
+    int state;                  // Job state: AsyncJobState
+    void *data;                 // Job data, owned by the job while not released
+    AsyncJobCallback decode;    // File read and decode stage (worker thread)
+    AsyncJobCallback upload;    // GPU upload stage (main thread), optional
+} AsyncJob;
+
+// File data async load job
+typedef struct FileLoadJob {
+    char fileName[512];         // File name to load
+    unsigned char *data;        // File data loaded, ownership transferred on retrieval
+    unsigned int size;          // File data size (in bytes)
+} FileLoadJob;
+#endif
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+// Native file, unbuffered reads at explicit offsets
+typedef struct NativeFile {
+#if defined(PLATFORM_NX)
+    FsFile fsFile;              // fs service file (fsdev mounts), used if fd is -1
+    int fd;                     // Devoptab file descriptor (romfs), reads bypass stdio buffering
+#else
+    FILE *file;                 // Unbuffered stdio file
+#endif
+    unsigned int size;          // File size (in bytes)
+} NativeFile;
+
+// File stream read-ahead block
+typedef struct FileStreamBlock {
+    unsigned char *data;        // Block data (FILE_STREAM_BLOCK_SIZE)
+    unsigned int index;         // Block index in file (offset/FILE_STREAM_BLOCK_SIZE)
+    unsigned int size;          // Block bytes read, valid once read job is done
+    bool loaded;                // Block assigned to index, read or being read
+    bool reading;               // Block queued to pending read job
+} FileStreamBlock;
+
+// File stream, sequential reads served from read-ahead blocks
+// NOTE: Blocks are only assigned by the reading thread, one read job is pending at most (file reads are not concurrent)
+struct FileStream {
+    NativeFile file;            // Native file, read by read jobs
+    const unsigned char *view;  // File data view (file packs, custom file loader), no read-ahead required
+    unsigned int size;          // File size (in bytes)
+    unsigned int position;      // Read position
+    unsigned char *memory;      // Blocks memory, blocks data is aligned to FILE_IO_ALIGNMENT
+    FileStreamBlock blocks[FILE_STREAM_BLOCKS]; // Read-ahead blocks, block index i uses block i%FILE_STREAM_BLOCKS
+    unsigned int readIndex;     // First block index queued to read job
+    JobCounter readJob;         // Blocks read job counter
+};
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+// File pack entry compression
+typedef enum {
+    FILE_PACK_UNCOMPRESSED = 0, // Entry data stored as is (zero-copy views when memory-mapped)
+    FILE_PACK_DEFLATE,          // Entry data compressed with DEFLATE
+    FILE_PACK_LZ4               // Entry data compressed with LZ4 (faster decompression)
+} FilePackCompression;
+
+// File pack header, at file start
+// NOTE: All values are stored in little-endian, entries data follows header
+typedef struct FilePackHeader {
+    char id[4];                 // File pack identifier: "rPAK"
+    unsigned int version;       // File pack format version
+    unsigned int entryCount;    // Table of contents entries count
+    unsigned int tocOffset;     // Table of contents offset (after entries data)
+    unsigned int namesOffset;   // Entries names offset (after table of contents)
+    unsigned int namesSize;     // Entries names size, '\0' terminated strings (in bytes)
+    unsigned int alignment;     // Entries data alignment (in bytes)
+    unsigned int reserved;      // Reserved for future use
+} FilePackHeader;
+
+// File pack table of contents entry
+// NOTE: Entries are sorted by name hash, looked up with binary search
+typedef struct FilePackEntry {
+    unsigned int hash;          // Entry name hash (FNV-1a of normalized path)
+    unsigned int nameOffset;    // Entry name offset into names
+    unsigned int offset;        // Entry data offset in pack file (aligned)
+    unsigned int size;          // Entry data size stored (compressed size)
+    unsigned int dataSize;      // Entry data size (uncompressed)
+    unsigned int compression;   // Entry data compression: FilePackCompression
+} FilePackEntry;
+
+// Mounted file pack
+typedef struct FilePack {
+    bool mounted;               // File pack slot in use
+    char mountPath[MAX_FILE_PACK_PATH_LENGTH];  // Path prefix entries are mounted at (normalized)
+    unsigned int fileSize;      // Pack file size (in bytes)
+    FILE *file;                 // Pack file, entries read directly (not memory-mapped)
+    unsigned char *mapped;      // Pack file memory-mapped data, NULL if not mapped
+    FilePackEntry *entries;     // Table of contents
+    unsigned int entryCount;    // Table of contents entries count
+    char *names;                // Entries names
+    unsigned int namesSize;     // Entries names size (in bytes)
+} FilePack;
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Watched asset
+typedef struct AssetWatch {
+    int type;                   // Asset type: AssetWatchType
+    AssetReloadJob asset;       // Asset reload job data, copied on reload
+    long modTime[2];            // Watched files modification time
+    AsyncJobCallback decode;    // Asset reload decode stage (worker thread)
+    AsyncJobCallback upload;    // Asset reload upload stage, replaces asset data (main thread)
+    unsigned int handle;        // Reload job pending, 0 if none
+    AssetReloadJob *job;        // Reload job data pending, cancelled if asset is unloaded
+} AssetWatch;
+#endif
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+// Cached resource
+typedef struct CachedResource {
+    int type;                   // Resource type: ResourceType
+    unsigned int hash;          // Resource key hash
+    char *key;                  // Resource key: file path and load parameters
+    unsigned long long id;      // Resource identity (GPU object id or data pointer)
+    void *resource;             // Resource struct copy, returned on duplicate loads
+    int size;                   // Resource struct size (in bytes)
+    int refs;                   // Resource references, resource unloaded when last reference is released
+} CachedResource;
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Profiling capture event
+typedef struct ProfileEvent {
+    const char *name;           // Zone name (static string), NULL for zone end
+    unsigned long long ticks;   // Event time (GetTimeTicks())
+    unsigned int thread;        // Event thread id (capture local)
+    char phase;                 // Event phase: 'B'-zone begin, 'E'-zone end, 'i'-frame mark
+} ProfileEvent;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static int logTypeLevel = LOG_INFO;                 // Minimum log type level
 
+#if defined(TRACELOG_ASYNC_THREADED)
+// Async trace-log messages ring, bounded multiple producers (any thread) and single consumer (background thread)
+// NOTE: Slot sequence tells the slot state: equal to write position when free, position + 1 when message is ready
+static struct {
+    struct {
+        unsigned int sequence;                      // Slot sequence (atomic)
+        char text[TRACELOG_ASYNC_MSG_LENGTH];       // Formatted message, log type prefix included
+    } messages[TRACELOG_ASYNC_RING_SIZE];           // Messages ring
+    unsigned int head;                              // Next write position (atomic, producers)
+    unsigned int tail;                              // Next read position (consumer, mutex locked)
+    int dropped;                                    // Messages dropped since last flush, ring was full (atomic)
+    int running;                                    // Background thread running, messages queued (atomic)
+    pthread_t threadId;                             // Background thread id
+    pthread_mutex_t consumerMutex;                  // Ring consumer access mutex (background thread, exit and fatal flush)
+} traceLogRing = { 0 };
+static pthread_once_t traceLogRingOnce = PTHREAD_ONCE_INIT;
+#endif
+
 static TraceLogCallback traceLog = NULL;            // TraceLog callback function pointer
 static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback funtion pointer
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback funtion pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback funtion pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback funtion pointer
 
+// Scratch memory arena, one per thread (async load workers, job system workers)
+// NOTE: Main thread arena is also rewound on EndDrawing(), temporaries are valid for current frame
+static RL_THREAD_LOCAL ScratchArena scratchArena = { 0 };
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Tracked allocations, open addressing table by address (linear probing)
+// NOTE: Frees of addresses not tracked (allocated by external libraries) are just released
+static struct {
+    MemoryAllocation *entries;                      // Allocations table
+    unsigned int capacity;                          // Allocations table size (power of two)
+    unsigned int count;                             // Allocations tracked
+    MemoryStats stats[MEMORY_TAG_VIDEO_TEXTURES];   // Memory stats by tag, MEMORY_TAG_ALL for all tags
+    int allocations[MEMORY_TAG_VIDEO_TEXTURES];     // Allocations on current frame by tag
+    int frees[MEMORY_TAG_VIDEO_TEXTURES];           // Frees on current frame by tag
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    MemoryAllocator allocators[MAX_MEMORY_ALLOCATORS];  // Custom allocators set, 0 is the default allocator (not used)
+    int allocatorCount;                             // Custom allocators set (default allocator included)
+    int tagAllocators[MEMORY_TAG_VIDEO_TEXTURES];   // Allocator used by tag
+#endif
+} memoryTracker = { 0 };
+#if defined(MEMORY_TRACKING_THREADED)
+static pthread_mutex_t memoryTrackerMutex = PTHREAD_MUTEX_INITIALIZER;  // Allocations table access mutex
+#endif
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+static float asyncLoadBudget = ASYNC_LOAD_FRAME_BUDGET;   // Async load upload stage time budget per frame (in milliseconds)
+static int asyncTransferBudget = ASYNC_LOAD_FRAME_TRANSFER; // Async load GPU transfers bytes budget per frame
+static int asyncTransferBytes = 0;                          // Async load GPU transfers bytes issued current frame
+static bool asyncUploadDeferred = false;                    // Running upload stage requested to run again next frame
+static bool asyncUploadWaiting = false;                     // Upload stage runs from WaitAsyncLoad(), transfers budget ignored
+
+// Async load jobs
+// NOTE: Jobs slots are only accessed with the mutex locked, stages callbacks run unlocked
+static struct {
+    AsyncJob jobs[MAX_ASYNC_LOAD_JOBS];     // Jobs slots
+    unsigned int handleCounter;             // Last job handle generated
+    int threadCount;                        // Worker threads running, jobs decoded on submit if 0
+#if defined(ASYNC_JOBS_THREADED)
+    pthread_t threadId[ASYNC_LOAD_THREADS]; // Worker threads ids
+    pthread_mutex_t mutex;                  // Jobs slots access mutex
+    pthread_cond_t jobsQueued;              // Signaled when jobs are queued or workers must quit
+    pthread_cond_t jobsDecoded;             // Signaled when a job decode stage is finished
+    bool running;                           // Worker threads have been initialized and are running
+#endif
+} asyncJobs = { 0 };
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Watched assets, checked on EndDrawing() every ASSET_HOT_RELOAD_INTERVAL
+// NOTE: Assets are watched and unwatched on main thread (loading with GPU context)
+static struct {
+    AssetWatch *watches;        // Watched assets
+    int count;                  // Watched assets count
+    int capacity;               // Watched assets array size
+    double checkTime;           // Last watched files check time
+} assetWatch = { 0 };
+#endif
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+// Cached resources, registered by modules load functions
+// NOTE: Resources are cached and released on main thread (loading with GPU context), async loads are not cached
+static struct {
+    CachedResource *resources;  // Cached resources
+    int count;                  // Cached resources count
+    int capacity;               // Cached resources array size
+} resourceCache = { 0 };
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Profiling zones sink and capture
+// NOTE: Events are recorded lock-free from any thread, events exceeding the buffer are dropped (history captures
+// wrap around instead), buffer is kept between captures so zones still running on other threads never write released memory
+static struct {
+    ProfileZoneBeginCallback begin;         // Custom sink zone begin callback, NULL to capture
+    ProfileZoneEndCallback end;             // Custom sink zone end callback, NULL to capture
+    ProfileEvent *events;                   // Captured events buffer
+    int capacity;                           // Captured events buffer size
+    unsigned int count;                     // Captured events, could exceed capacity (atomic)
+    int capturing;                          // Capture running (atomic)
+    bool history;                           // Capture is a rolling history (events buffer used as a ring)
+    unsigned long long startTicks;          // Capture start time (GetTimeTicks())
+    unsigned int threadCounter;             // Last thread id generated (atomic)
+} profiler = { 0 };
+
+static RL_THREAD_LOCAL unsigned int profileThread = 0;     // Current thread id on captures, 0 if not generated
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+// Mounted file packs, last mounted packs are checked first (patch packs override entries)
+// NOTE: Packs must be mounted/unmounted on main thread while no other thread is loading files
+static FilePack filePacks[MAX_FILE_PACKS] = { 0 };
+#if defined(ASYNC_JOBS_THREADED)
+static pthread_mutex_t filePacksMutex = PTHREAD_MUTEX_INITIALIZER;  // Pack files direct reads mutex (async load workers)
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -96,6 +539,62 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_MEMORY_TRACKING)
+static void LockMemoryTracker(void);                    // Lock tracked allocations access (any thread)
+static void UnlockMemoryTracker(void);                  // Unlock tracked allocations access
+static unsigned int GetMemoryAllocationSlot(const void *ptr, unsigned int capacity);   // Get allocations table home slot for an address
+static MemoryAllocation *FindMemoryAllocation(const void *ptr);         // Find tracked allocation, NULL if not tracked
+static void TrackMemoryAllocation(void *ptr, size_t size, int tag, int allocator);  // Register allocation and update stats, tracker must be locked
+static void UntrackMemoryAllocation(void *ptr);                         // Unregister allocation and update stats, tracker must be locked
+static void *AllocMemory(size_t size, bool zeroed, int allocator);      // Allocate memory with allocator (0: default allocator)
+static void *ReallocMemory(void *ptr, size_t size, size_t oldSize, int allocator);  // Reallocate memory with allocator, tracker must be locked
+static void FreeMemory(void *ptr, int allocator);                       // Free memory with allocator
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+static AsyncJob *FindAsyncJob(unsigned int handle);     // Find async load job by handle, NULL if not found
+static AsyncJob *NextAsyncJob(int state);               // Get oldest async load job in a state, NULL if none
+static void RunAsyncJobUpload(AsyncJob *job);           // Run async load job upload stage, mutex must be locked
+#if defined(ASYNC_JOBS_THREADED)
+static void *AsyncJobsThread(void *arg);                // Async load worker thread, runs decode stages
+#endif
+#endif
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+static unsigned int GetResourceKeyHash(const char *key);                // Get resource key hash (FNV-1a)
+static CachedResource *FindCachedResource(int type, const char *key);  // Find cached resource by key, NULL if not cached
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+static unsigned int GetFilePackPath(const char *fileName, char *path);  // Get normalized file pack path and its hash
+static const FilePackEntry *FindFilePackEntry(const char *fileName, FilePack **pack);   // Find file in mounted packs, NULL if not found
+static unsigned char *LoadFilePackEntry(FilePack *pack, const FilePackEntry *entry, unsigned int *bytesRead, bool *borrowed);  // Load file pack entry data
+static int CompareFilePackEntries(const void *a, const void *b);       // Compare file pack entries by hash (qsort)
+#endif
+static bool IsFileProvided(const char *fileName);                       // Check if file is provided by mounted file packs or custom file loader
+#if defined(SUPPORT_NATIVE_FILEIO)
+static bool OpenNativeFile(const char *fileName, NativeFile *file);     // Open native file for unbuffered reads
+static unsigned int ReadNativeFile(NativeFile *file, unsigned int offset, void *buffer, unsigned int size);   // Read native file at offset, returns bytes read
+static void CloseNativeFile(NativeFile *file);                          // Close native file
+static void QueueFileStreamBlocks(FileStream *stream);                  // Queue blocks ahead of read position to a read job, if none is pending
+static void ReadFileStreamJob(void *data);                              // Read file stream queued blocks (job)
+#endif
+#if defined(SUPPORT_ASYNC_LOADING)
+static bool DecodeFileDataJob(void *data);                              // File data async load decode stage: read file (worker thread)
+#endif
+#if defined(SUPPORT_PROFILING_ZONES)
+static void RecordProfileEvent(const char *name, char phase);   // Record profiling event on capture, if running
+static bool ReserveProfileEvents(int maxEvents);                // Grow profiling capture events buffer (never shrinks)
+static bool ExportProfileEvents(const char *fileName, unsigned int first, unsigned int last, unsigned long long startTicks);  // Export captured events range as Chrome trace JSON
+#endif
+#if defined(TRACELOG_ASYNC_THREADED)
+static void InitTraceLogRing(void);                                     // Init async trace-log ring and background thread (once)
+static void CloseTraceLogRing(void);                                    // Stop background thread and print queued messages (at exit)
+static bool QueueTraceLogMessage(const char *prefix, const char *text, va_list args);  // Format message into ring, returns false if not queued
+static void FlushTraceLogRing(void);                                    // Print ring queued messages and dropped count
+static void *TraceLogThread(void *arg);                                 // Background thread, flushes ring periodically
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -103,6 +602,9 @@ static int android_close(void *cookie);
 // Set the current threshold (minimum) log level
 void SetTraceLogLevel(int logType) { logTypeLevel = logType; }
 
+// Check if log type is shown with current threshold (minimum) log level
+bool IsTraceLogEnabled(int logType) { return (logType >= logTypeLevel); }
+
 // Show trace log messages (LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DEBUG)
 void TraceLog(int logType, const char *text, ...)
 {
@@ -145,6 +647,24 @@ void TraceLog(int logType, const char *text, ...)
         default: break;
     }
 
+#if defined(TRACELOG_ASYNC_THREADED)
+    // Message formatted into ring and printed by background thread (stdout writes are slow on consoles),
+    // warning, error and fatal messages are printed on call after queued ones (never dropped or delayed)
+    pthread_once(&traceLogRingOnce, InitTraceLogRing);
+
+    if (TRACELOG_ATOMIC_LOAD(&traceLogRing.running))
+    {
+        if (logType < LOG_WARNING)
+        {
+            QueueTraceLogMessage(buffer, text, args);
+            va_end(args);
+            return;
+        }
+
+        FlushTraceLogRing();
+    }
+#endif
+
     strcat(buffer, text);
     strcat(buffer, "\n");
     vprintf(buffer, args);
@@ -162,14 +682,22 @@ void TraceLog(int logType, const char *text, ...)
 // NOTE: Initializes to zero by default
 void *MemAlloc(int size)
 {
+#if defined(SUPPORT_MEMORY_TRACKING)
+    void *ptr = MemCallocTracked(size, 1, MEMORY_TAG_USER);
+#else
     void *ptr = RL_CALLOC(size, 1);
+#endif
     return ptr;
 }
 
 // Internal memory reallocator
 void *MemRealloc(void *ptr, int size)
 {
+#if defined(SUPPORT_MEMORY_TRACKING)
+    void *ret = MemReallocTracked(ptr, size, MEMORY_TAG_USER);
+#else
     void *ret = RL_REALLOC(ptr, size);
+#endif
     return ret;
 }
 
@@ -179,151 +707,600 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
-// Load data from file into a buffer
-unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
+// Allocate temporary memory from current thread scratch arena
+// NOTE: Heap is used if arena is full, memory must be released with MemFreeScratch()
+void *MemAllocScratch(unsigned int size)
 {
-    unsigned char *data = NULL;
-    *bytesRead = 0;
+    unsigned int alignedSize = (size + SCRATCH_MEMORY_ALIGNMENT - 1) & ~(SCRATCH_MEMORY_ALIGNMENT - 1);
 
-    if (fileName != NULL)
-    {
-        if (loadFileData)
-        {
-            data = loadFileData(fileName, bytesRead);
-            return data;
-        }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rb");
+    if (scratchArena.data == NULL) scratchArena.data = (unsigned char *)RL_MALLOC(SCRATCH_MEMORY_SIZE);
 
-        if (file != NULL)
-        {
-            // WARNING: On binary streams SEEK_END could not be found,
-            // using fseek() and ftell() could not work in some (rare) cases
-            fseek(file, 0, SEEK_END);
-            int size = ftell(file);
-            fseek(file, 0, SEEK_SET);
+    if ((scratchArena.data != NULL) && (alignedSize <= (SCRATCH_MEMORY_SIZE - scratchArena.offset)))
+    {
+        void *ptr = scratchArena.data + scratchArena.offset;
+        scratchArena.offset += alignedSize;
+        scratchArena.live++;
 
-            if (size > 0)
-            {
-                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+        return ptr;
+    }
 
-                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
-                unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
-                *bytesRead = count;
+    return RL_MALLOC(size);
+}
 
-                if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
-                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
-            }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+// Free temporary memory allocated with MemAllocScratch()
+// NOTE: Arena memory is not reused until all arena allocations are freed (or arena is reset)
+void MemFreeScratch(void *ptr)
+{
+    if (ptr == NULL) return;
 
-            fclose(file);
-        }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
+    if ((scratchArena.data != NULL) && ((unsigned char *)ptr >= scratchArena.data) && ((unsigned char *)ptr < (scratchArena.data + SCRATCH_MEMORY_SIZE)))
+    {
+        if (scratchArena.live > 0) scratchArena.live--;
+        if (scratchArena.live == 0) scratchArena.offset = 0;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+    else RL_FREE(ptr);
+}
 
-    return data;
+// Rewind current thread scratch arena, temporaries not freed expire
+void ResetScratchMemory(void)
+{
+    scratchArena.offset = 0;
+    scratchArena.live = 0;
 }
 
-// Unload file data allocated by LoadFileData()
-void UnloadFileData(unsigned char *data)
+// Unload current thread scratch arena
+void UnloadScratchMemory(void)
 {
-    RL_FREE(data);
+    RL_FREE(scratchArena.data);
+    scratchArena.data = NULL;
+    scratchArena.offset = 0;
+    scratchArena.live = 0;
 }
 
-// Save data to file from buffer
-bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
+// Get memory stats by tag (MemoryTag), only video memory tags without SUPPORT_MEMORY_TRACKING
+// NOTE: Video memory is estimated from rlgl objects loaded sizes, drivers padding not included
+MemoryStats GetMemoryStats(int tag)
 {
-    bool success = false;
+    MemoryStats stats = { 0 };
 
-    if (fileName != NULL)
+    if ((tag == MEMORY_TAG_VIDEO_TEXTURES) || (tag == MEMORY_TAG_VIDEO_BUFFERS))
     {
-        if (saveFileData)
+        rlMemoryStats video = rlGetVideoMemoryStats((tag == MEMORY_TAG_VIDEO_TEXTURES)? RL_MEMORY_TEXTURES : RL_MEMORY_BUFFERS);
+
+        stats.usedBytes = video.usedBytes;
+        stats.peakBytes = video.peakBytes;
+        stats.allocationCount = video.objectCount;
+        stats.frameAllocations = video.frameLoads;
+        stats.frameFrees = video.frameUnloads;
+    }
+#if defined(SUPPORT_MEMORY_TRACKING)
+    else if ((tag >= 0) && (tag < MEMORY_TAG_VIDEO_TEXTURES))
+    {
+        LockMemoryTracker();
+        stats = memoryTracker.stats[tag];
+        UnlockMemoryTracker();
+    }
+#endif
+
+    return stats;
+}
+
+// Set custom allocator for memory tag (MemoryTag), MEMORY_TAG_ALL sets all tags
+// NOTE: NULL alloc or free callbacks restore the default allocator, memory allocated before is released with its allocator
+// WARNING: Callbacks must be thread-safe and must not use raylib memory functions, realloc callback runs with allocations registry locked
+void SetAllocator(int tag, MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback, void *userData)
+{
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    if ((tag < MEMORY_TAG_ALL) || (tag >= MEMORY_TAG_VIDEO_TEXTURES))
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: Custom allocator not supported for memory tag: %i", tag);
+        return;
+    }
+
+    LockMemoryTracker();
+
+    int allocator = 0;
+
+    if ((allocCallback != NULL) && (freeCallback != NULL))
+    {
+        if (memoryTracker.allocatorCount == 0) memoryTracker.allocatorCount = 1;
+
+        // Allocators are kept while memory allocated with them could be alive, same callbacks are reused
+        for (int i = 1; i < memoryTracker.allocatorCount; i++)
         {
-            return saveFileData(fileName, data, bytesToWrite);
+            MemoryAllocator *callbacks = &memoryTracker.allocators[i];
+
+            if ((callbacks->alloc == allocCallback) && (callbacks->realloc == reallocCallback) &&
+                (callbacks->free == freeCallback) && (callbacks->userData == userData)) allocator = i;
         }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "wb");
 
-        if (file != NULL)
+        if (allocator == 0)
         {
-            unsigned int count = (unsigned int)fwrite(data, sizeof(unsigned char), bytesToWrite, file);
-
-            if (count == 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write file", fileName);
-            else if (count != bytesToWrite) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially written", fileName);
-            else TRACELOG(LOG_INFO, "FILEIO: [%s] File saved successfully", fileName);
+            if (memoryTracker.allocatorCount >= MAX_MEMORY_ALLOCATORS)
+            {
+                UnlockMemoryTracker();
+                TRACELOG(LOG_WARNING, "MEMORY: Maximum custom allocators reached (%i)", MAX_MEMORY_ALLOCATORS);
+                return;
+            }
 
-            int result = fclose(file);
-            if (result == 0) success = true;
+            allocator = memoryTracker.allocatorCount;
+            memoryTracker.allocators[allocator] = (MemoryAllocator){ allocCallback, reallocCallback, freeCallback, userData };
+            memoryTracker.allocatorCount++;
         }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
-    return success;
+    if (tag == MEMORY_TAG_ALL)
+    {
+        for (int i = MEMORY_TAG_ALL + 1; i < MEMORY_TAG_VIDEO_TEXTURES; i++) memoryTracker.tagAllocators[i] = allocator;
+    }
+    else memoryTracker.tagAllocators[tag] = allocator;
+
+    UnlockMemoryTracker();
+#else
+    (void)tag;
+    (void)allocCallback;
+    (void)reallocCallback;
+    (void)freeCallback;
+    (void)userData;
+
+    TRACELOG(LOG_WARNING, "MEMORY: Custom allocators not supported (SUPPORT_CUSTOM_ALLOCATORS)");
+#endif
 }
 
-// Export data to code (.h), returns true on success
-bool ExportDataAsCode(const char *data, unsigned int size, const char *fileName)
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Tracked memory allocator, RL_MALLOC() on modules defining RL_MEMORY_TAG
+void *MemAllocTracked(size_t size, int tag)
 {
-    bool success = false;
+    if ((tag <= MEMORY_TAG_ALL) || (tag >= MEMORY_TAG_VIDEO_TEXTURES)) tag = MEMORY_TAG_USER;
 
-#ifndef TEXT_BYTES_PER_LINE
-    #define TEXT_BYTES_PER_LINE     20
+    LockMemoryTracker();
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    int allocator = memoryTracker.tagAllocators[tag];
+#else
+    int allocator = 0;
 #endif
+    UnlockMemoryTracker();
 
-    // NOTE: Text data buffer size is estimated considering raw data size in bytes
-    // and requiring 6 char bytes for every byte: "0x00, "
-    char *txtData = (char *)RL_CALLOC(size*6 + 2000, sizeof(char));
+    void *ptr = AllocMemory(size, false, allocator);
 
-    int byteCount = 0;
-    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// DataAsCode exporter v1.0 - Raw data exported as an array of bytes                  //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
-    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2022 Ramon Santamaria (@raysan5)                                     //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
+    if (ptr != NULL)
+    {
+        LockMemoryTracker();
+        TrackMemoryAllocation(ptr, size, tag, allocator);
+        UnlockMemoryTracker();
+    }
 
-    // Get file name from path and convert variable name to uppercase
-    char varFileName[256] = { 0 };
-    strcpy(varFileName, GetFileNameWithoutExt(fileName));
-    for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
+    return ptr;
+}
 
-    byteCount += sprintf(txtData + byteCount, "static unsigned char %s_DATA[%i] = { ", varFileName, size);
-    for (int i = 0; i < size - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), data[i]);
-    byteCount += sprintf(txtData + byteCount, "0x%x };\n", data[size - 1]);
+// Tracked memory allocator (zero-initialized), RL_CALLOC() on modules defining RL_MEMORY_TAG
+void *MemCallocTracked(size_t count, size_t size, int tag)
+{
+    if ((tag <= MEMORY_TAG_ALL) || (tag >= MEMORY_TAG_VIDEO_TEXTURES)) tag = MEMORY_TAG_USER;
 
-    // NOTE: Text data size exported is determined by '\0' (NULL) character
-    success = SaveFileText(fileName, txtData);
+    LockMemoryTracker();
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    int allocator = memoryTracker.tagAllocators[tag];
+#else
+    int allocator = 0;
+#endif
+    UnlockMemoryTracker();
 
-    RL_FREE(txtData);
+    void *ptr = AllocMemory(count*size, true, allocator);
 
-    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Data as code exported successfully", fileName);
-    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export data as code", fileName);
+    if (ptr != NULL)
+    {
+        LockMemoryTracker();
+        TrackMemoryAllocation(ptr, count*size, tag, allocator);
+        UnlockMemoryTracker();
+    }
 
-    return success; 
+    return ptr;
 }
 
-// Load text data from file, returns a '\0' terminated string
-// NOTE: text chars array should be freed manually
-char *LoadFileText(const char *fileName)
+// Tracked memory reallocator, RL_REALLOC() on modules defining RL_MEMORY_TAG
+// NOTE: Reallocated memory keeps its original tag and allocator, counted as one free and one allocation
+void *MemReallocTracked(void *ptr, size_t size, int tag)
 {
-    char *text = NULL;
+    if ((tag <= MEMORY_TAG_ALL) || (tag >= MEMORY_TAG_VIDEO_TEXTURES)) tag = MEMORY_TAG_USER;
 
-    if (fileName != NULL)
+    // NOTE: Tracker is locked while reallocating, previous address can not be reused meanwhile
+    LockMemoryTracker();
+
+    MemoryAllocation *allocation = (ptr != NULL)? FindMemoryAllocation(ptr) : NULL;
+    size_t oldSize = 0;
+    int allocator = 0;
+
+    if (allocation != NULL)
     {
-        if (loadFileText)
-        {
+        tag = allocation->tag;
+        oldSize = allocation->size;
+        allocator = allocation->allocator;
+    }
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    else if (ptr == NULL) allocator = memoryTracker.tagAllocators[tag];
+#endif
+
+    void *result = ReallocMemory(ptr, size, oldSize, allocator);
+
+    if ((result != NULL) || (size == 0))
+    {
+        if (allocation != NULL) UntrackMemoryAllocation(ptr);
+        if (result != NULL) TrackMemoryAllocation(result, size, tag, allocator);
+    }
+
+    UnlockMemoryTracker();
+
+    return result;
+}
+
+// Tracked memory free, RL_FREE() on modules defining RL_MEMORY_TAG
+// NOTE: Memory is released with the allocator used, addresses not tracked use the default allocator
+void MemFreeTracked(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    // NOTE: Allocation is unregistered before release, address can be reused once released
+    LockMemoryTracker();
+    MemoryAllocation *allocation = FindMemoryAllocation(ptr);
+    int allocator = (allocation != NULL)? allocation->allocator : 0;
+    UntrackMemoryAllocation(ptr);
+    UnlockMemoryTracker();
+
+    FreeMemory(ptr, allocator);
+}
+
+// Update memory stats frame counters, called once per frame on EndDrawing()
+void UpdateMemoryStats(void)
+{
+    LockMemoryTracker();
+
+    for (int i = 0; i < MEMORY_TAG_VIDEO_TEXTURES; i++)
+    {
+        memoryTracker.stats[i].frameAllocations = memoryTracker.allocations[i];
+        memoryTracker.stats[i].frameFrees = memoryTracker.frees[i];
+        memoryTracker.allocations[i] = 0;
+        memoryTracker.frees[i] = 0;
+    }
+
+    UnlockMemoryTracker();
+}
+#endif  // SUPPORT_MEMORY_TRACKING
+
+// Begin profiling zone, value returned must be provided to EndProfileZone()
+// NOTE: Zones are sent to custom sink if set, otherwise recorded on capture (if running)
+unsigned long long BeginProfileZone(const char *name)
+{
+    unsigned long long zone = 0;
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    if (profiler.begin != NULL) zone = profiler.begin(name);
+    else RecordProfileEvent(name, 'B');
+#else
+    (void)name;
+#endif
+
+    return zone;
+}
+
+// End profiling zone
+void EndProfileZone(unsigned long long zone)
+{
+#if defined(SUPPORT_PROFILING_ZONES)
+    if (profiler.end != NULL) profiler.end(zone);
+    else RecordProfileEvent(NULL, 'E');
+#else
+    (void)zone;
+#endif
+}
+
+// Set custom profiling zones sink, NULL callbacks restore capture
+// WARNING: Callbacks are called from any thread zones are used, sink must not change while zones are running
+void SetProfileZoneCallbacks(ProfileZoneBeginCallback begin, ProfileZoneEndCallback end)
+{
+#if defined(SUPPORT_PROFILING_ZONES)
+    if ((begin == NULL) || (end == NULL)) begin = NULL, end = NULL;
+
+    profiler.begin = begin;
+    profiler.end = end;
+#else
+    (void)begin;
+    (void)end;
+    TRACELOG(LOG_WARNING, "PROFILE: Profiling zones not supported, enable SUPPORT_PROFILING_ZONES");
+#endif
+}
+
+// Start profiling zones capture (0: default events buffer size)
+void StartProfileCapture(int maxEvents)
+{
+#if defined(SUPPORT_PROFILING_ZONES)
+    // NOTE: Rolling history capture (frame hitches traces) is replaced, it is restarted once this capture stops
+    if (PROFILE_ATOMIC_LOAD(&profiler.capturing)) PROFILE_ATOMIC_STORE(&profiler.capturing, 0);
+    if (maxEvents <= 0) maxEvents = PROFILE_CAPTURE_DEFAULT_EVENTS;
+
+    if (!ReserveProfileEvents(maxEvents)) return;
+
+    profiler.history = false;
+    profiler.startTicks = GetTimeTicks();
+    PROFILE_ATOMIC_STORE(&profiler.count, 0);
+    PROFILE_ATOMIC_STORE(&profiler.capturing, 1);
+
+    TRACELOG(LOG_INFO, "PROFILE: Capture started (%i events buffer)", profiler.capacity);
+#else
+    (void)maxEvents;
+    TRACELOG(LOG_WARNING, "PROFILE: Profiling zones not supported, enable SUPPORT_PROFILING_ZONES");
+#endif
+}
+
+// Stop profiling zones capture and export it as Chrome trace JSON (NULL fileName discards capture)
+// NOTE: Trace can be opened with chrome://tracing or Perfetto UI, timestamps in microseconds from capture start
+bool StopProfileCapture(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILING_ZONES)
+    if (!PROFILE_ATOMIC_LOAD(&profiler.capturing) || profiler.history) return false;
+
+    PROFILE_ATOMIC_STORE(&profiler.capturing, 0);
+
+    unsigned int count = PROFILE_ATOMIC_LOAD(&profiler.count);
+    if (count > (unsigned int)profiler.capacity)
+    {
+        TRACELOG(LOG_WARNING, "PROFILE: Capture events buffer full, %u events dropped", count - profiler.capacity);
+        count = profiler.capacity;
+    }
+
+    if (fileName == NULL) return false;
+
+    success = ExportProfileEvents(fileName, 0, count, profiler.startTicks);
+#else
+    (void)fileName;
+    TRACELOG(LOG_WARNING, "PROFILE: Profiling zones not supported, enable SUPPORT_PROFILING_ZONES");
+#endif
+
+    return success;
+}
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Register frame end on profiling capture
+// NOTE: Custom sinks are not notified, frames are delimited by swap zones
+void ProfileFrameMark(void)
+{
+    if (profiler.begin == NULL) RecordProfileEvent(NULL, 'i');
+}
+
+// Start rolling profiling history capture, last events are kept (events buffer used as a ring)
+// NOTE: History is not started while a capture is running (StartProfileCapture()), true if history is running
+bool StartProfileHistory(int maxEvents)
+{
+    if (PROFILE_ATOMIC_LOAD(&profiler.capturing)) return profiler.history;
+    if (maxEvents <= 0) maxEvents = PROFILE_CAPTURE_DEFAULT_EVENTS;
+
+    if (!ReserveProfileEvents(maxEvents)) return false;
+
+    profiler.history = true;
+    profiler.startTicks = GetTimeTicks();
+    PROFILE_ATOMIC_STORE(&profiler.count, 0);
+    PROFILE_ATOMIC_STORE(&profiler.capturing, 1);
+
+    return true;
+}
+
+// Stop rolling profiling history capture
+void StopProfileHistory(void)
+{
+    if (PROFILE_ATOMIC_LOAD(&profiler.capturing) && profiler.history) PROFILE_ATOMIC_STORE(&profiler.capturing, 0);
+}
+
+// Export last frames of rolling profiling history as Chrome trace JSON, capture keeps running
+// NOTE: Frames are delimited by frame marks, last event recorded is expected to be last frame mark (EndDrawing()),
+// oldest events exported could be overwritten meanwhile by zones running on other threads
+bool ExportProfileHistory(const char *fileName, int frames)
+{
+    if (!PROFILE_ATOMIC_LOAD(&profiler.capturing) || !profiler.history || (frames <= 0)) return false;
+
+    unsigned int last = PROFILE_ATOMIC_LOAD(&profiler.count);
+    unsigned int oldest = (last > (unsigned int)profiler.capacity)? last - profiler.capacity : 0;
+    unsigned int first = oldest;
+    int marks = 0;
+
+    // Search backwards the frame mark ending the frame previous to the exported ones
+    for (unsigned int i = last; i > oldest; i--)
+    {
+        if ((profiler.events[(i - 1)%profiler.capacity].phase == 'i') && (++marks > frames))
+        {
+            first = i - 1;
+            break;
+        }
+    }
+
+    if (first == last) return false;
+
+    return ExportProfileEvents(fileName, first, last, profiler.events[first%profiler.capacity].ticks);
+}
+#endif
+
+// Load data from file into a buffer
+unsigned char *LoadFileData(const char *fileName, unsigned int *bytesRead)
+{
+    unsigned char *data = NULL;
+    *bytesRead = 0;
+
+    if (fileName != NULL)
+    {
+#if defined(SUPPORT_FILE_PACKS)
+        // Files provided by mounted file packs are loaded first
+        FilePack *pack = NULL;
+        const FilePackEntry *entry = FindFilePackEntry(fileName, &pack);
+        if (entry != NULL) return LoadFilePackEntry(pack, entry, bytesRead, NULL);
+#endif
+        if (loadFileData)
+        {
+            data = loadFileData(fileName, bytesRead);
+            return data;
+        }
+#if defined(SUPPORT_STANDARD_FILEIO)
+    #if defined(SUPPORT_NATIVE_FILEIO)
+        NativeFile file = { 0 };
+
+        if (OpenNativeFile(fileName, &file))
+        {
+            if (file.size > 0)
+            {
+                data = (unsigned char *)RL_MALLOC(file.size*sizeof(unsigned char));
+                *bytesRead = ReadNativeFile(&file, 0, data, file.size);
+
+                if (*bytesRead != file.size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
+                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+            CloseNativeFile(&file);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    #else
+        FILE *file = fopen(fileName, "rb");
+
+        if (file != NULL)
+        {
+            // WARNING: On binary streams SEEK_END could not be found,
+            // using fseek() and ftell() could not work in some (rare) cases
+            fseek(file, 0, SEEK_END);
+            int size = ftell(file);
+            fseek(file, 0, SEEK_SET);
+
+            if (size > 0)
+            {
+                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
+                unsigned int count = (unsigned int)fread(data, sizeof(unsigned char), size, file);
+                *bytesRead = count;
+
+                if (count != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded", fileName);
+                else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+            fclose(file);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    #endif
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+
+    return data;
+}
+
+// Unload file data allocated by LoadFileData()
+void UnloadFileData(unsigned char *data)
+{
+    RL_FREE(data);
+}
+
+// Save data to file from buffer
+bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWrite)
+{
+    bool success = false;
+
+    if (fileName != NULL)
+    {
+        if (saveFileData)
+        {
+            return saveFileData(fileName, data, bytesToWrite);
+        }
+#if defined(SUPPORT_STANDARD_FILEIO)
+        FILE *file = fopen(fileName, "wb");
+
+        if (file != NULL)
+        {
+            unsigned int count = (unsigned int)fwrite(data, sizeof(unsigned char), bytesToWrite, file);
+
+            if (count == 0) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write file", fileName);
+            else if (count != bytesToWrite) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially written", fileName);
+            else TRACELOG(LOG_INFO, "FILEIO: [%s] File saved successfully", fileName);
+
+            int result = fclose(file);
+            if (result == 0) success = true;
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+
+    return success;
+}
+
+// Export data to code (.h), returns true on success
+bool ExportDataAsCode(const char *data, unsigned int size, const char *fileName)
+{
+    bool success = false;
+
+#ifndef TEXT_BYTES_PER_LINE
+    #define TEXT_BYTES_PER_LINE     20
+#endif
+
+    // NOTE: Text data buffer size is estimated considering raw data size in bytes
+    // and requiring 6 char bytes for every byte: "0x00, "
+    char *txtData = (char *)RL_CALLOC(size*6 + 2000, sizeof(char));
+
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// DataAsCode exporter v1.0 - Raw data exported as an array of bytes                  //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
+    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2022 Ramon Santamaria (@raysan5)                                     //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    // Get file name from path and convert variable name to uppercase
+    char varFileName[256] = { 0 };
+    strcpy(varFileName, GetFileNameWithoutExt(fileName));
+    for (int i = 0; varFileName[i] != '\0'; i++) if ((varFileName[i] >= 'a') && (varFileName[i] <= 'z')) { varFileName[i] = varFileName[i] - 32; }
+
+    byteCount += sprintf(txtData + byteCount, "static unsigned char %s_DATA[%i] = { ", varFileName, size);
+    for (int i = 0; i < size - 1; i++) byteCount += sprintf(txtData + byteCount, ((i%TEXT_BYTES_PER_LINE == 0)? "0x%x,\n" : "0x%x, "), data[i]);
+    byteCount += sprintf(txtData + byteCount, "0x%x };\n", data[size - 1]);
+
+    // NOTE: Text data size exported is determined by '\0' (NULL) character
+    success = SaveFileText(fileName, txtData);
+
+    RL_FREE(txtData);
+
+    if (success != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Data as code exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export data as code", fileName);
+
+    return success; 
+}
+
+// Load text data from file, returns a '\0' terminated string
+// NOTE: text chars array should be freed manually
+char *LoadFileText(const char *fileName)
+{
+    char *text = NULL;
+
+    if (fileName != NULL)
+    {
+#if defined(SUPPORT_FILE_PACKS)
+        // NOTE: File pack entries data is always '\0' terminated, no line endings translation
+        FilePack *pack = NULL;
+        const FilePackEntry *entry = FindFilePackEntry(fileName, &pack);
+        if (entry != NULL)
+        {
+            unsigned int size = 0;
+            return (char *)LoadFilePackEntry(pack, entry, &size, NULL);
+        }
+#endif
+        if (loadFileText)
+        {
             text = loadFileText(fileName);
             return text;
         }
@@ -407,12 +1384,505 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager, const char *dataPath)
+// Load file data as a read-only view, data is borrowed from memory-mapped file packs when possible
+// NOTE: Views must be released with UnloadFileDataView(), borrowed data is valid while its pack is mounted
+const unsigned char *LoadFileDataView(const char *fileName, unsigned int *bytesRead)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
+#if defined(SUPPORT_FILE_PACKS)
+    FilePack *pack = NULL;
+    const FilePackEntry *entry = (fileName != NULL)? FindFilePackEntry(fileName, &pack) : NULL;
+
+    if (entry != NULL)
+    {
+        bool borrowed = false;
+        return LoadFilePackEntry(pack, entry, bytesRead, &borrowed);
+    }
+#endif
+
+    return LoadFileData(fileName, bytesRead);
+}
+
+// Unload file data view loaded by LoadFileDataView(), borrowed data is not freed
+void UnloadFileDataView(const unsigned char *data)
+{
+    if (data == NULL) return;
+
+#if defined(FILE_PACKS_MMAP)
+    for (int i = 0; i < MAX_FILE_PACKS; i++)
+    {
+        if ((filePacks[i].mapped != NULL) && (data >= filePacks[i].mapped) && (data < filePacks[i].mapped + filePacks[i].fileSize)) return;
+    }
+#endif
+
+    RL_FREE((void *)data);
+}
+
+// Load file data range into provided buffer, returns false if range could not be fully read
+// NOTE: Only the requested range is read from disk, file packs entries are copied from their data view
+bool LoadFileDataRange(const char *fileName, unsigned int offset, unsigned int size, unsigned char *buffer)
+{
+    bool result = false;
+
+    if ((fileName == NULL) || (buffer == NULL)) return result;
+
+    // Files provided by mounted file packs or custom callback are copied from the full data
+    if (IsFileProvided(fileName))
+    {
+        unsigned int dataSize = 0;
+        const unsigned char *data = LoadFileDataView(fileName, &dataSize);
+
+        if ((data != NULL) && (offset <= dataSize) && (size <= (dataSize - offset)))
+        {
+            memcpy(buffer, data + offset, size);
+            result = true;
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file range (offset: %u, size: %u)", fileName, offset, size);
+
+        UnloadFileDataView(data);
+
+        return result;
+    }
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    #if defined(SUPPORT_NATIVE_FILEIO)
+    NativeFile file = { 0 };
+
+    if (OpenNativeFile(fileName, &file))
+    {
+        result = (ReadNativeFile(&file, offset, buffer, size) == size);
+
+        if (!result) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file range (offset: %u, size: %u)", fileName, offset, size);
+
+        CloseNativeFile(&file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    #else
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        if (fseek(file, (long)offset, SEEK_SET) == 0) result = (fread(buffer, sizeof(unsigned char), size, file) == size);
+
+        if (!result) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file range (offset: %u, size: %u)", fileName, offset, size);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    #endif
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+
+    return result;
+}
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+// Open file stream for sequential reads, blocks ahead of read position are read by jobs (read-ahead)
+// NOTE: Files provided by mounted file packs or custom callback are read from their data view
+FileStream *OpenFileStream(const char *fileName)
+{
+    if (fileName == NULL) return NULL;
+
+    FileStream *stream = (FileStream *)RL_CALLOC(1, sizeof(FileStream));
+
+    if (IsFileProvided(fileName))
+    {
+        stream->view = LoadFileDataView(fileName, &stream->size);
+
+        if (stream->view == NULL)
+        {
+            RL_FREE(stream);
+            return NULL;
+        }
+    }
+    else if (OpenNativeFile(fileName, &stream->file))
+    {
+        stream->size = stream->file.size;
+        stream->memory = (unsigned char *)RL_MALLOC(FILE_STREAM_BLOCKS*FILE_STREAM_BLOCK_SIZE + FILE_IO_ALIGNMENT);
+
+        unsigned char *data = (unsigned char *)(((size_t)stream->memory + FILE_IO_ALIGNMENT - 1) & ~((size_t)FILE_IO_ALIGNMENT - 1));
+        for (int i = 0; i < FILE_STREAM_BLOCKS; i++) stream->blocks[i].data = data + i*FILE_STREAM_BLOCK_SIZE;
+
+        // First blocks are read ahead right away
+        QueueFileStreamBlocks(stream);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file stream", fileName);
+        RL_FREE(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+// Read file stream data from read position, returns bytes read (less than requested at file end or on read error)
+// NOTE: Calling thread waits for blocks not read yet, running queued jobs meanwhile
+unsigned int ReadFileStream(FileStream *stream, void *buffer, unsigned int size)
+{
+    unsigned int bytesRead = 0;
+
+    if ((stream == NULL) || (buffer == NULL)) return 0;
+
+    if (size > (stream->size - stream->position)) size = stream->size - stream->position;
+
+    if (stream->view != NULL)
+    {
+        memcpy(buffer, stream->view + stream->position, size);
+        stream->position += size;
+        return size;
+    }
+
+    while (bytesRead < size)
+    {
+        QueueFileStreamBlocks(stream);
+
+        unsigned int index = stream->position/FILE_STREAM_BLOCK_SIZE;
+        FileStreamBlock *block = &stream->blocks[index%FILE_STREAM_BLOCKS];
+
+        // Block not queued yet (pending read job was reading other blocks), it is queued once the job is done
+        if (!block->loaded || (block->index != index))
+        {
+            WaitJobCounter(&stream->readJob);
+            continue;
+        }
+
+        if (block->reading) WaitJobCounter(&stream->readJob);
+
+        unsigned int blockOffset = stream->position - index*FILE_STREAM_BLOCK_SIZE;
+        if (blockOffset >= block->size) break;      // Block read failed
+
+        unsigned int count = ((block->size - blockOffset) < (size - bytesRead))? (block->size - blockOffset) : (size - bytesRead);
+        memcpy((unsigned char *)buffer + bytesRead, block->data + blockOffset, count);
+
+        bytesRead += count;
+        stream->position += count;
+    }
+
+    if (bytesRead < size) TRACELOG(LOG_WARNING, "FILEIO: File stream read failed (offset: %u, size: %u)", stream->position, size);
+
+    // Blocks behind read position are reused to read ahead
+    QueueFileStreamBlocks(stream);
+
+    return bytesRead;
+}
+
+// Set file stream read position, origin: SEEK_SET, SEEK_CUR or SEEK_END, returns false if position is not valid
+// NOTE: Blocks already read are kept, read-ahead continues from new position
+bool SeekFileStream(FileStream *stream, int offset, int origin)
+{
+    if (stream == NULL) return false;
+
+    long long position = offset;
+    if (origin == SEEK_CUR) position += stream->position;
+    else if (origin == SEEK_END) position += stream->size;
+
+    if ((position < 0) || (position > stream->size)) return false;
+
+    stream->position = (unsigned int)position;
+
+    return true;
+}
+
+// Get file stream read position
+unsigned int GetFileStreamPosition(FileStream *stream)
+{
+    return (stream != NULL)? stream->position : 0;
+}
+
+// Get file stream size (in bytes)
+unsigned int GetFileStreamSize(FileStream *stream)
+{
+    return (stream != NULL)? stream->size : 0;
+}
+
+// Close file stream, waits for pending read job
+void CloseFileStream(FileStream *stream)
+{
+    if (stream == NULL) return;
+
+    if (stream->view != NULL) UnloadFileDataView(stream->view);
+    else
+    {
+        WaitJobCounter(&stream->readJob);
+        CloseNativeFile(&stream->file);
+        RL_FREE(stream->memory);
+    }
+
+    RL_FREE(stream);
+}
+#endif
+
+// Mount file pack at a path prefix (NULL for root path), returns pack id or -1 on failure
+// NOTE: Pack entries are found by LoadFileData() as "mountPath/entryPath", last mounted packs are checked first
+int MountFilePack(const char *fileName, const char *mountPath)
+{
+    int id = -1;
+
+#if defined(SUPPORT_FILE_PACKS)
+    for (int i = 0; i < MAX_FILE_PACKS; i++) if (!filePacks[i].mounted) { id = i; break; }
+
+    if (id == -1)
+    {
+        TRACELOG(LOG_WARNING, "FILEPACK: [%s] Maximum number of file packs mounted reached (%i)", fileName, MAX_FILE_PACKS);
+        return -1;
+    }
+
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEPACK: [%s] Failed to open file pack", fileName);
+        return -1;
+    }
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+    setvbuf(file, NULL, _IONBF, 0);     // Entries are read at once, stdio buffering only adds a copy
+#endif
+
+    FilePack pack = { 0 };
+    FilePackHeader header = { 0 };
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    bool valid = (fileSize > (long)sizeof(FilePackHeader)) && (fileSize <= 0xffffffffL) && (fread(&header, sizeof(FilePackHeader), 1, file) == 1) &&
+                 (memcmp(header.id, "rPAK", 4) == 0) && (header.version == FILE_PACK_VERSION);
+
+    // Check table of contents and names are inside the file (64 bit math to avoid overflows)
+    valid = valid && ((unsigned long long)header.tocOffset + (unsigned long long)header.entryCount*sizeof(FilePackEntry) <= (unsigned long long)fileSize) &&
+                     ((unsigned long long)header.namesOffset + header.namesSize <= (unsigned long long)fileSize) && (header.namesSize > 0);
+
+    if (valid)
+    {
+        pack.fileSize = (unsigned int)fileSize;
+        pack.entryCount = header.entryCount;
+        pack.namesSize = header.namesSize;
+        pack.entries = (FilePackEntry *)RL_MALLOC(header.entryCount*sizeof(FilePackEntry) + 1);
+        pack.names = (char *)RL_MALLOC(header.namesSize);
+
+        fseek(file, header.tocOffset, SEEK_SET);
+        valid = (fread(pack.entries, sizeof(FilePackEntry), header.entryCount, file) == header.entryCount);
+        fseek(file, header.namesOffset, SEEK_SET);
+        valid = valid && (fread(pack.names, 1, header.namesSize, file) == header.namesSize) && (pack.names[header.namesSize - 1] == '\0');
+
+        for (unsigned int i = 0; valid && (i < pack.entryCount); i++)
+        {
+            const FilePackEntry *entry = &pack.entries[i];
+
+            valid = (entry->nameOffset < pack.namesSize) && ((unsigned long long)entry->offset + entry->size <= pack.fileSize) &&
+                    (entry->compression <= FILE_PACK_LZ4) && ((entry->compression != FILE_PACK_UNCOMPRESSED) || (entry->size == entry->dataSize)) &&
+                    ((i == 0) || (pack.entries[i - 1].hash <= entry->hash));
+        }
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEPACK: [%s] File pack not valid", fileName);
+        RL_FREE(pack.entries);
+        RL_FREE(pack.names);
+        fclose(file);
+        return -1;
+    }
+
+#if defined(FILE_PACKS_MMAP)
+    // Map the whole pack, uncompressed entries are provided as views without any copy
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd != -1)
+    {
+        void *mapped = mmap(NULL, pack.fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) pack.mapped = (unsigned char *)mapped;
+        close(fd);
+    }
+#endif
+
+    if (pack.mapped != NULL) fclose(file);
+    else pack.file = file;
+
+    pack.mounted = true;
+    GetFilePackPath((mountPath != NULL)? mountPath : "", pack.mountPath);
+
+    int mountLength = (int)strlen(pack.mountPath);
+    if ((mountLength > 0) && (pack.mountPath[mountLength - 1] != '/') && (mountLength < MAX_FILE_PACK_PATH_LENGTH - 1)) strcat(pack.mountPath, "/");
+
+    filePacks[id] = pack;
+
+    TRACELOG(LOG_INFO, "FILEPACK: [%s] File pack mounted successfully (%i entries, %s)", fileName, pack.entryCount, (pack.mapped != NULL)? "memory-mapped" : "direct reads");
+#else
+    TRACELOG(LOG_WARNING, "FILEPACK: [%s] File packs support not enabled", fileName);
+#endif
+
+    return id;
+}
+
+// Unmount file pack, data views borrowed from the pack are not valid anymore
+void UnmountFilePack(int id)
+{
+#if defined(SUPPORT_FILE_PACKS)
+    if ((id < 0) || (id >= MAX_FILE_PACKS) || !filePacks[id].mounted) return;
+
+    FilePack *pack = &filePacks[id];
+
+#if defined(FILE_PACKS_MMAP)
+    if (pack->mapped != NULL) munmap(pack->mapped, pack->fileSize);
+#endif
+    if (pack->file != NULL) fclose(pack->file);
+
+    RL_FREE(pack->entries);
+    RL_FREE(pack->names);
+
+    memset(pack, 0, sizeof(FilePack));
+
+    TRACELOG(LOG_INFO, "FILEPACK: [ID %i] File pack unmounted successfully", id);
+#endif
+}
+
+// Check if file is provided by a mounted file pack
+bool IsFilePacked(const char *fileName)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILE_PACKS)
+    FilePack *pack = NULL;
+    result = (fileName != NULL) && (FindFilePackEntry(fileName, &pack) != NULL);
+#endif
+
+    return result;
+}
+
+// Export files into a file pack, entries are named by the provided paths (normalized)
+// NOTE: When compress is requested, entries are compressed only if it saves at least 1/8 of their size
+bool ExportFilePack(const char *fileName, const char **files, int fileCount, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILE_PACKS)
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEPACK: [%s] Failed to open file pack for writing", fileName);
+        return false;
+    }
+
+    FilePackHeader header = { 0 };
+    memcpy(header.id, "rPAK", 4);
+    header.version = FILE_PACK_VERSION;
+    header.alignment = FILE_PACK_ALIGNMENT;
+    fwrite(&header, sizeof(FilePackHeader), 1, file);
+
+    FilePackEntry *entries = (FilePackEntry *)RL_CALLOC(fileCount + 1, sizeof(FilePackEntry));
+    char *names = (char *)RL_MALLOC((size_t)fileCount*MAX_FILE_PACK_PATH_LENGTH + 1);
+    unsigned int namesSize = 0;
+    unsigned int offset = sizeof(FilePackHeader);
+    int entryCount = 0;
+    success = true;
+
+    for (int i = 0; (i < fileCount) && success; i++)
+    {
+        char path[MAX_FILE_PACK_PATH_LENGTH] = { 0 };
+        unsigned int hash = GetFilePackPath(files[i], path);
+
+        bool duplicated = false;
+        for (int j = 0; j < entryCount; j++) if ((entries[j].hash == hash) && (strcmp(names + entries[j].nameOffset, path) == 0)) duplicated = true;
+
+        if (duplicated)
+        {
+            TRACELOG(LOG_WARNING, "FILEPACK: [%s] File already exported, skipped", files[i]);
+            continue;
+        }
+
+        unsigned int dataSize = 0;
+        unsigned char *data = LoadFileData(files[i], &dataSize);
+
+        if (data == NULL)
+        {
+            success = false;
+            break;
+        }
+
+        FilePackEntry *entry = &entries[entryCount];
+        entry->hash = hash;
+        entry->nameOffset = namesSize;
+        entry->dataSize = dataSize;
+        entry->size = dataSize;
+        entry->compression = FILE_PACK_UNCOMPRESSED;
+
+        unsigned char *stored = data;
+#if defined(SUPPORT_COMPRESSION_API)
+        int compSize = 0;
+        unsigned char *compData = (compress && (dataSize > 0))? CompressDataEx(data, dataSize, &compSize, FILE_PACK_COMPRESSION_CODEC) : NULL;
+
+        if ((compData != NULL) && (compSize > 0) && ((unsigned int)compSize < dataSize - dataSize/8))
+        {
+            stored = compData;
+            entry->size = compSize;
+            entry->compression = (FILE_PACK_COMPRESSION_CODEC == COMPRESSION_LZ4)? FILE_PACK_LZ4 : FILE_PACK_DEFLATE;
+        }
+#endif
+        // Pad entry data to required alignment
+        unsigned int padding = (FILE_PACK_ALIGNMENT - offset%FILE_PACK_ALIGNMENT)%FILE_PACK_ALIGNMENT;
+        for (unsigned int p = 0; p < padding; p++) fputc(0, file);
+        offset += padding;
+
+        entry->offset = offset;
+        success = (fwrite(stored, 1, entry->size, file) == entry->size) && ((unsigned long long)offset + entry->size < 0xffffffffULL);
+        offset += entry->size;
+
+#if defined(SUPPORT_COMPRESSION_API)
+        RL_FREE(compData);
+#endif
+        RL_FREE(data);
+
+        strcpy(names + namesSize, path);
+        namesSize += (unsigned int)strlen(path) + 1;
+        entryCount++;
+    }
+
+    if (success)
+    {
+        // Table of contents and names are written after entries data, header is updated at the end
+        unsigned int padding = (4 - offset%4)%4;
+        for (unsigned int p = 0; p < padding; p++) fputc(0, file);
+        offset += padding;
+
+        if (namesSize == 0) names[namesSize++] = '\0';
+
+        qsort(entries, entryCount, sizeof(FilePackEntry), CompareFilePackEntries);
+
+        header.entryCount = entryCount;
+        header.tocOffset = offset;
+        header.namesOffset = offset + entryCount*sizeof(FilePackEntry);
+        header.namesSize = namesSize;
+
+        success = (fwrite(entries, sizeof(FilePackEntry), entryCount, file) == (size_t)entryCount) &&
+                  (fwrite(names, 1, namesSize, file) == namesSize);
+
+        fseek(file, 0, SEEK_SET);
+        success = success && (fwrite(&header, sizeof(FilePackHeader), 1, file) == 1);
+    }
+
+    fclose(file);
+    RL_FREE(entries);
+    RL_FREE(names);
+
+    if (success) TRACELOG(LOG_INFO, "FILEPACK: [%s] File pack exported successfully (%i entries)", fileName, entryCount);
+    else TRACELOG(LOG_WARNING, "FILEPACK: [%s] Failed to export file pack", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEPACK: [%s] File packs support not enabled", fileName);
+#endif
+
+    return success;
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
 }
 
 // Replacement for fopen()
@@ -450,9 +1920,1350 @@ FILE *android_fopen(const char *fileName, const char *mode)
 }
 #endif  // PLATFORM_ANDROID
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+#if defined(ASYNC_JOBS_THREADED)
+    #define ASYNC_JOBS_LOCK()     pthread_mutex_lock(&asyncJobs.mutex)
+    #define ASYNC_JOBS_UNLOCK()   pthread_mutex_unlock(&asyncJobs.mutex)
+#else
+    #define ASYNC_JOBS_LOCK()     (void)0
+    #define ASYNC_JOBS_UNLOCK()   (void)0
+#endif
+
+// Set async load upload stage time budget per frame (in milliseconds)
+// NOTE: At least one job upload stage runs per frame, even if it takes longer than the budget
+void SetAsyncLoadBudget(float milliseconds) { asyncLoadBudget = milliseconds; }
+
+// Set async load GPU transfers bytes budget per frame (pixel buffers uploads)
+// NOTE: At least one transfer is issued per frame, even if it is bigger than the budget
+void SetAsyncLoadTransferBudget(int bytes) { asyncTransferBudget = bytes; }
+
+// Request GPU transfer bytes from current frame budget, returns false if transfer must wait for next frame
+// NOTE: Called by upload stages (main thread), always succeeds when waiting for the job
+bool RequestAsyncTransfer(int bytes)
+{
+    if (!asyncUploadWaiting && (asyncTransferBytes > 0) && ((asyncTransferBytes + bytes) > asyncTransferBudget)) return false;
+
+    asyncTransferBytes += bytes;
+
+    return true;
+}
+
+// Request running upload stage to run again next frame, job stays pending (i.e. waiting for a transfer fence)
+// NOTE: Called by upload stages (main thread), stage runs again immediately when waiting for the job
+void DeferAsyncJobUpload(void) { asyncUploadDeferred = true; }
+
+// Submit async load job, decode stage runs on a worker thread and upload stage (optional) on main thread
+// NOTE: Job data ownership is transferred, it is freed with RL_FREE() on ReleaseAsyncJob()
+unsigned int SubmitAsyncJob(int type, void *data, AsyncJobCallback decode, AsyncJobCallback upload)
+{
+#if defined(ASYNC_JOBS_THREADED)
+    // Worker threads are initialized on first job
+    if (!asyncJobs.running)
+    {
+        pthread_mutex_init(&asyncJobs.mutex, NULL);
+        pthread_cond_init(&asyncJobs.jobsQueued, NULL);
+        pthread_cond_init(&asyncJobs.jobsDecoded, NULL);
+        asyncJobs.running = true;
+
+        for (int i = 0; i < ASYNC_LOAD_THREADS; i++)
+        {
+            if (pthread_create(&asyncJobs.threadId[asyncJobs.threadCount], NULL, AsyncJobsThread, NULL) == 0) asyncJobs.threadCount++;
+        }
+
+        if (asyncJobs.threadCount == 0) TRACELOG(LOG_WARNING, "ASYNC: Failed to create worker threads, jobs decoded on submit");
+        else TRACELOG(LOG_INFO, "ASYNC: Worker threads initialized successfully (%i threads)", asyncJobs.threadCount);
+    }
+#endif
+
+    ASYNC_JOBS_LOCK();
+
+    AsyncJob *job = NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_JOBS; i++)
+    {
+        if (asyncJobs.jobs[i].state == ASYNC_JOB_FREE)
+        {
+            job = &asyncJobs.jobs[i];
+            break;
+        }
+    }
+
+    if (job == NULL)
+    {
+        ASYNC_JOBS_UNLOCK();
+
+        TRACELOG(LOG_WARNING, "ASYNC: Maximum number of async load jobs reached (%i)", MAX_ASYNC_LOAD_JOBS);
+        RL_FREE(data);
+        return 0;
+    }
+
+    asyncJobs.handleCounter++;
+    if (asyncJobs.handleCounter == 0) asyncJobs.handleCounter++;    // Handle 0 is invalid
+
+    job->handle = asyncJobs.handleCounter;
+    job->type = type;
+    job->state = ASYNC_JOB_QUEUED;
+    job->data = data;
+    job->decode = decode;
+    job->upload = upload;
+
+    unsigned int handle = job->handle;
+
+    if (asyncJobs.threadCount == 0)
+    {
+        // No worker threads available, decode stage runs on this thread
+        job->state = ASYNC_JOB_DECODING;
+        bool success = job->decode(job->data);
+        job->state = !success? ASYNC_JOB_FAILED : ((job->upload != NULL)? ASYNC_JOB_DECODED : ASYNC_JOB_DONE);
+    }
+#if defined(ASYNC_JOBS_THREADED)
+    else pthread_cond_signal(&asyncJobs.jobsQueued);
+#endif
+
+    ASYNC_JOBS_UNLOCK();
+
+    return handle;
+}
+
+// Load file data asynchronously, file is read on a worker thread (file packs supported)
+// NOTE: Data is retrieved with GetAsyncFileData(), load state can be polled with GetAsyncLoadState()
+unsigned int LoadFileDataAsync(const char *fileName)
+{
+    if (fileName == NULL) return 0;
+
+    FileLoadJob *job = (FileLoadJob *)RL_CALLOC(1, sizeof(FileLoadJob));
+    strncpy(job->fileName, fileName, sizeof(job->fileName) - 1);
+
+    return SubmitAsyncJob(ASYNC_JOB_FILE, job, DecodeFileDataJob, NULL);
+}
+
+// Get file data loaded asynchronously, waits for the load to finish and releases the load handle
+// NOTE: Data must be unloaded with UnloadFileData()
+unsigned char *GetAsyncFileData(unsigned int handle, unsigned int *bytesRead)
+{
+    unsigned char *data = NULL;
+    *bytesRead = 0;
+
+    FileLoadJob *job = (FileLoadJob *)GetAsyncJobData(handle, ASYNC_JOB_FILE);
+
+    if (job != NULL)
+    {
+        data = job->data;
+        *bytesRead = job->size;
+    }
+
+    ReleaseAsyncJob(handle);
+
+    return data;
+}
+
+// Get async load job state
+int GetAsyncLoadState(unsigned int handle)
+{
+    int state = ASYNC_LOAD_NONE;
+
+    ASYNC_JOBS_LOCK();
+
+    AsyncJob *job = FindAsyncJob(handle);
+
+    if (job != NULL)
+    {
+        if (job->state == ASYNC_JOB_DONE) state = ASYNC_LOAD_READY;
+        else if (job->state == ASYNC_JOB_FAILED) state = ASYNC_LOAD_FAILED;
+        else state = ASYNC_LOAD_PENDING;
+    }
+
+    ASYNC_JOBS_UNLOCK();
+
+    return state;
+}
+
+// Wait for async load job to finish, its upload stage runs now if required
+void WaitAsyncLoad(unsigned int handle)
+{
+    ASYNC_JOBS_LOCK();
+
+    AsyncJob *job = FindAsyncJob(handle);
+
+    while ((job != NULL) && (job->state != ASYNC_JOB_DONE) && (job->state != ASYNC_JOB_FAILED))
+    {
+        if ((job->state == ASYNC_JOB_DECODED) || (job->state == ASYNC_JOB_DEFERRED))
+        {
+            asyncUploadWaiting = true;
+            RunAsyncJobUpload(job);
+            asyncUploadWaiting = false;
+        }
+#if defined(ASYNC_JOBS_THREADED)
+        else pthread_cond_wait(&asyncJobs.jobsDecoded, &asyncJobs.mutex);
+#else
+        else break;
+#endif
+    }
+
+    ASYNC_JOBS_UNLOCK();
+}
+
+// Get async load job data, waits for job to finish
+// NOTE: Returns NULL if job failed or data type does not match
+void *GetAsyncJobData(unsigned int handle, int type)
+{
+    void *data = NULL;
+
+    WaitAsyncLoad(handle);
+
+    ASYNC_JOBS_LOCK();
+
+    AsyncJob *job = FindAsyncJob(handle);
+    if ((job != NULL) && (job->type == type) && (job->state == ASYNC_JOB_DONE)) data = job->data;
+
+    ASYNC_JOBS_UNLOCK();
+
+    return data;
+}
+
+// Release async load job handle and data, waits for job to finish
+void ReleaseAsyncJob(unsigned int handle)
+{
+    WaitAsyncLoad(handle);
+
+    ASYNC_JOBS_LOCK();
+
+    AsyncJob *job = FindAsyncJob(handle);
+
+    if (job != NULL)
+    {
+        RL_FREE(job->data);
+        memset(job, 0, sizeof(AsyncJob));
+    }
+
+    ASYNC_JOBS_UNLOCK();
+}
+
+// Run async load jobs upload stage, oldest jobs first, until frame budget is spent
+// NOTE: Called by EndDrawing(), upload stages require the GL context thread
+void ProcessAsyncJobs(void)
+{
+    double startTime = GetTime();
+
+    asyncTransferBytes = 0;
+
+    ASYNC_JOBS_LOCK();
+
+    // Deferred upload stages run again first, they only check pending GPU work
+    for (int i = 0; i < MAX_ASYNC_LOAD_JOBS; i++)
+    {
+        if (asyncJobs.jobs[i].state == ASYNC_JOB_DEFERRED) asyncJobs.jobs[i].state = ASYNC_JOB_DECODED;
+    }
+
+    for (AsyncJob *job = NextAsyncJob(ASYNC_JOB_DECODED); job != NULL; job = NextAsyncJob(ASYNC_JOB_DECODED))
+    {
+        RunAsyncJobUpload(job);
+
+        if ((GetTime() - startTime)*1000.0 >= asyncLoadBudget) break;
+    }
+
+    ASYNC_JOBS_UNLOCK();
+}
+
+// Stop async load worker threads and release pending jobs
+// WARNING: Resources of jobs not retrieved are not unloaded, only jobs data is freed
+void CloseAsyncJobs(void)
+{
+#if defined(ASYNC_JOBS_THREADED)
+    if (asyncJobs.running)
+    {
+        pthread_mutex_lock(&asyncJobs.mutex);
+        asyncJobs.running = false;
+        pthread_cond_broadcast(&asyncJobs.jobsQueued);
+        pthread_mutex_unlock(&asyncJobs.mutex);
+
+        for (int i = 0; i < asyncJobs.threadCount; i++) pthread_join(asyncJobs.threadId[i], NULL);
+
+        pthread_cond_destroy(&asyncJobs.jobsDecoded);
+        pthread_cond_destroy(&asyncJobs.jobsQueued);
+        pthread_mutex_destroy(&asyncJobs.mutex);
+        asyncJobs.threadCount = 0;
+    }
+#endif
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_JOBS; i++)
+    {
+        if (asyncJobs.jobs[i].state != ASYNC_JOB_FREE)
+        {
+            TRACELOG(LOG_WARNING, "ASYNC: [%u] Async load job not retrieved", asyncJobs.jobs[i].handle);
+            RL_FREE(asyncJobs.jobs[i].data);
+        }
+    }
+
+    memset(asyncJobs.jobs, 0, sizeof(asyncJobs.jobs));
+}
+#endif  // SUPPORT_ASYNC_LOADING
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Watch asset files, changed files are reloaded on a worker thread and asset replaced in place on upload stage
+// NOTE: Asset is identified by type, id and first data pointer, it must be unwatched when unloaded
+void WatchAsset(int type, const AssetReloadJob *asset, AsyncJobCallback decode, AsyncJobCallback upload)
+{
+    if (assetWatch.count == assetWatch.capacity)
+    {
+        int capacity = (assetWatch.capacity == 0)? 32 : assetWatch.capacity*2;
+        AssetWatch *watches = (AssetWatch *)RL_REALLOC(assetWatch.watches, capacity*sizeof(AssetWatch));
+
+        if (watches == NULL) return;
+
+        assetWatch.watches = watches;
+        assetWatch.capacity = capacity;
+    }
+
+    AssetWatch *watch = &assetWatch.watches[assetWatch.count];
+    memset(watch, 0, sizeof(AssetWatch));
+
+    watch->type = type;
+    watch->asset = *asset;
+    watch->asset.data = NULL;
+    watch->asset.cancelled = false;
+    watch->decode = decode;
+    watch->upload = upload;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (watch->asset.fileName[i][0] != '\0') watch->modTime[i] = GetFileModTime(watch->asset.fileName[i]);
+    }
+
+    assetWatch.count++;
+}
+
+// Stop watching asset files, pending reload is cancelled
+// NOTE: Waits for pending reload decode stage to finish, upload stage only releases decoded data
+void UnwatchAsset(int type, unsigned int id, const void *ptr)
+{
+    for (int i = 0; i < assetWatch.count; i++)
+    {
+        AssetWatch *watch = &assetWatch.watches[i];
+
+        if ((watch->type == type) && (watch->asset.id == id) && (watch->asset.ptr[0] == ptr))
+        {
+            if (watch->handle != 0)
+            {
+                watch->job->cancelled = true;
+                ReleaseAsyncJob(watch->handle);
+            }
+
+            assetWatch.watches[i] = assetWatch.watches[assetWatch.count - 1];
+            assetWatch.count--;
+            break;
+        }
+    }
+}
+
+// Check watched files and submit reload jobs, finished reload jobs are released
+// NOTE: Files are checked every ASSET_HOT_RELOAD_INTERVAL, one reload pending per asset
+void UpdateAssetWatch(void)
+{
+    for (int i = 0; i < assetWatch.count; i++)
+    {
+        AssetWatch *watch = &assetWatch.watches[i];
+        int state = (watch->handle != 0)? GetAsyncLoadState(watch->handle) : ASYNC_LOAD_NONE;
+
+        if ((state == ASYNC_LOAD_READY) || (state == ASYNC_LOAD_FAILED))
+        {
+            if (state == ASYNC_LOAD_FAILED) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to reload asset", watch->asset.fileName[0]);
+
+            ReleaseAsyncJob(watch->handle);
+            watch->handle = 0;
+            watch->job = NULL;
+        }
+    }
+
+    double time = GetTime();
+    if ((time - assetWatch.checkTime) < ASSET_HOT_RELOAD_INTERVAL) return;
+    assetWatch.checkTime = time;
+
+    for (int i = 0; i < assetWatch.count; i++)
+    {
+        AssetWatch *watch = &assetWatch.watches[i];
+        bool changed = false;
+
+        if (watch->handle != 0) continue;
+
+        for (int f = 0; f < 2; f++)
+        {
+            if (watch->asset.fileName[f][0] == '\0') continue;
+
+            // NOTE: Files missing (i.e. replaced by editors on save) are checked again later
+            long modTime = GetFileModTime(watch->asset.fileName[f]);
+
+            if ((modTime != 0) && (modTime != watch->modTime[f]))
+            {
+                watch->modTime[f] = modTime;
+                changed = true;
+            }
+        }
+
+        if (changed)
+        {
+            AssetReloadJob *job = (AssetReloadJob *)RL_MALLOC(sizeof(AssetReloadJob));
+            *job = watch->asset;
+
+            watch->handle = SubmitAsyncJob(ASYNC_JOB_ASSET_RELOAD, job, watch->decode, watch->upload);
+            watch->job = (watch->handle != 0)? job : NULL;
+
+            if (watch->handle != 0) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset file changed, reloading", watch->asset.fileName[0]);
+        }
+    }
+}
+
+// Stop watching all assets, pending reloads are cancelled
+void CloseAssetWatch(void)
+{
+    for (int i = 0; i < assetWatch.count; i++)
+    {
+        if (assetWatch.watches[i].handle != 0)
+        {
+            assetWatch.watches[i].job->cancelled = true;
+            ReleaseAsyncJob(assetWatch.watches[i].handle);
+        }
+    }
+
+    RL_FREE(assetWatch.watches);
+    memset(&assetWatch, 0, sizeof(assetWatch));
+}
+#endif  // SUPPORT_ASSET_HOT_RELOAD
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+// Get cached resource copy and add a reference, false if not cached
+// NOTE: Returned resource shares GPU objects and data with other references, each reference must be unloaded
+bool LoadCachedResource(int type, const char *key, void *resource, int size)
+{
+    CachedResource *cached = FindCachedResource(type, key);
+
+    if ((cached == NULL) || (cached->size != size)) return false;
+
+    memcpy(resource, cached->resource, size);
+    cached->refs++;
+
+    TRACELOGD("FILEIO: [%s] Resource loaded from cache (%i references)", key, cached->refs);
+
+    return true;
+}
+
+// Check if resource is cached, no reference added
+bool IsResourceCached(int type, const char *key)
+{
+    return (FindCachedResource(type, key) != NULL);
+}
+
+// Cache loaded resource with one reference
+// NOTE: Resource is not cached again if its identity is already cached (nested loads, i.e. LoadFont() -> LoadFontEx())
+void CacheResource(int type, const char *key, const void *resource, int size, unsigned long long id)
+{
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        if ((resourceCache.resources[i].type == type) && (resourceCache.resources[i].id == id)) return;
+    }
+
+    if (resourceCache.count == resourceCache.capacity)
+    {
+        int capacity = (resourceCache.capacity == 0)? 32 : resourceCache.capacity*2;
+        CachedResource *resources = (CachedResource *)RL_REALLOC(resourceCache.resources, capacity*sizeof(CachedResource));
+
+        if (resources == NULL) return;
+
+        resourceCache.resources = resources;
+        resourceCache.capacity = capacity;
+    }
+
+    int keyLength = (int)strlen(key);
+    CachedResource cached = { 0 };
+
+    cached.type = type;
+    cached.key = (char *)RL_MALLOC(keyLength + 1);
+    cached.resource = RL_MALLOC(size);
+
+    if ((cached.key == NULL) || (cached.resource == NULL))
+    {
+        RL_FREE(cached.key);
+        RL_FREE(cached.resource);
+        return;
+    }
+
+    memcpy(cached.key, key, keyLength + 1);
+    memcpy(cached.resource, resource, size);
+    cached.hash = GetResourceKeyHash(key);
+    cached.id = id;
+    cached.size = size;
+    cached.refs = 1;
+
+    resourceCache.resources[resourceCache.count] = cached;
+    resourceCache.count++;
+}
+
+// Release cached resource reference, returns references left (resource must be unloaded if 0), -1 if not cached
+int ReleaseCachedResource(int type, unsigned long long id)
+{
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        CachedResource *cached = &resourceCache.resources[i];
+
+        if ((cached->type == type) && (cached->id == id))
+        {
+            cached->refs--;
+            int refs = cached->refs;
+
+            if (refs == 0)
+            {
+                RL_FREE(cached->key);
+                RL_FREE(cached->resource);
+
+                resourceCache.resources[i] = resourceCache.resources[resourceCache.count - 1];
+                resourceCache.count--;
+            }
+
+            return refs;
+        }
+    }
+
+    return -1;
+}
+
+// Release all cached resources entries, resources are not unloaded
+void CloseResourceCache(void)
+{
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        RL_FREE(resourceCache.resources[i].key);
+        RL_FREE(resourceCache.resources[i].resource);
+    }
+
+    RL_FREE(resourceCache.resources);
+    memset(&resourceCache, 0, sizeof(resourceCache));
+}
+#endif  // SUPPORT_RESOURCE_CACHE
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_ASYNC_LOADING)
+// Find async load job by handle
+static AsyncJob *FindAsyncJob(unsigned int handle)
+{
+    if (handle == 0) return NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_JOBS; i++)
+    {
+        if (asyncJobs.jobs[i].handle == handle) return &asyncJobs.jobs[i];
+    }
+
+    return NULL;
+}
+
+// Get oldest async load job in a state (lower handle)
+static AsyncJob *NextAsyncJob(int state)
+{
+    AsyncJob *next = NULL;
+
+    for (int i = 0; i < MAX_ASYNC_LOAD_JOBS; i++)
+    {
+        AsyncJob *job = &asyncJobs.jobs[i];
+        if ((job->state == state) && ((next == NULL) || ((int)(job->handle - next->handle) < 0))) next = job;
+    }
+
+    return next;
+}
+
+// Run async load job upload stage, mutex is unlocked while the stage runs
+// NOTE: Only the main thread runs upload stages, job slot can not be released meanwhile
+static void RunAsyncJobUpload(AsyncJob *job)
+{
+    job->state = ASYNC_JOB_UPLOADING;
+    asyncUploadDeferred = false;
+
+    ASYNC_JOBS_UNLOCK();
+    bool success = job->upload(job->data);
+    ASYNC_JOBS_LOCK();
+
+    // NOTE: Deferred stage waited by WaitAsyncLoad() runs again immediately
+    if (success && asyncUploadDeferred) job->state = asyncUploadWaiting? ASYNC_JOB_DECODED : ASYNC_JOB_DEFERRED;
+    else job->state = success? ASYNC_JOB_DONE : ASYNC_JOB_FAILED;
+
+#if defined(ASYNC_JOBS_THREADED)
+    pthread_cond_broadcast(&asyncJobs.jobsDecoded);
+#endif
+}
+
+// File data async load decode stage: read file (worker thread)
+static bool DecodeFileDataJob(void *data)
+{
+    FileLoadJob *job = (FileLoadJob *)data;
+
+    job->data = LoadFileData(job->fileName, &job->size);
+
+    return (job->data != NULL);
+}
+
+#if defined(ASYNC_JOBS_THREADED)
+// Async load worker thread, runs queued jobs decode stages
+static void *AsyncJobsThread(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&asyncJobs.mutex);
+
+    while (asyncJobs.running)
+    {
+        AsyncJob *job = NextAsyncJob(ASYNC_JOB_QUEUED);
+
+        if (job == NULL)
+        {
+            pthread_cond_wait(&asyncJobs.jobsQueued, &asyncJobs.mutex);
+            continue;
+        }
+
+        job->state = ASYNC_JOB_DECODING;
+
+        pthread_mutex_unlock(&asyncJobs.mutex);
+        bool success = job->decode(job->data);
+        pthread_mutex_lock(&asyncJobs.mutex);
+
+        job->state = !success? ASYNC_JOB_FAILED : ((job->upload != NULL)? ASYNC_JOB_DECODED : ASYNC_JOB_DONE);
+        pthread_cond_broadcast(&asyncJobs.jobsDecoded);
+    }
+
+    pthread_mutex_unlock(&asyncJobs.mutex);
+
+    UnloadScratchMemory();
+
+    return NULL;
+}
+#endif
+#endif  // SUPPORT_ASYNC_LOADING
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+// Get resource key hash (FNV-1a)
+static unsigned int GetResourceKeyHash(const char *key)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; key[i] != '\0'; i++) hash = (hash ^ (unsigned char)key[i])*16777619u;
+
+    return hash;
+}
+
+// Find cached resource by key, NULL if not cached
+static CachedResource *FindCachedResource(int type, const char *key)
+{
+    unsigned int hash = GetResourceKeyHash(key);
+
+    for (int i = 0; i < resourceCache.count; i++)
+    {
+        CachedResource *cached = &resourceCache.resources[i];
+
+        if ((cached->type == type) && (cached->hash == hash) && (strcmp(cached->key, key) == 0)) return cached;
+    }
+
+    return NULL;
+}
+#endif
+
+#if defined(SUPPORT_FILE_PACKS)
+// Get normalized file pack path and its hash (FNV-1a)
+// NOTE: Path separators converted to '/', leading "./" removed, path must fit MAX_FILE_PACK_PATH_LENGTH
+static unsigned int GetFilePackPath(const char *fileName, char *path)
+{
+    unsigned int hash = 2166136261u;
+    int length = 0;
+
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    for (int i = 0; (fileName[i] != '\0') && (length < MAX_FILE_PACK_PATH_LENGTH - 1); i++)
+    {
+        char c = (fileName[i] == '\\')? '/' : fileName[i];
+
+        path[length++] = c;
+        hash = (hash ^ (unsigned char)c)*16777619u;
+    }
+
+    path[length] = '\0';
+
+    return hash;
+}
+
+// Find file in mounted packs, NULL if not found
+static const FilePackEntry *FindFilePackEntry(const char *fileName, FilePack **pack)
+{
+    char path[MAX_FILE_PACK_PATH_LENGTH] = { 0 };
+    bool normalized = false;
+
+    for (int i = MAX_FILE_PACKS - 1; i >= 0; i--)
+    {
+        if (!filePacks[i].mounted) continue;
+
+        if (!normalized)
+        {
+            GetFilePackPath(fileName, path);
+            normalized = true;
+        }
+
+        // Check path is inside pack mount path
+        int mountLength = (int)strlen(filePacks[i].mountPath);
+        if (strncmp(path, filePacks[i].mountPath, mountLength) != 0) continue;
+
+        char entryPath[MAX_FILE_PACK_PATH_LENGTH] = { 0 };
+        unsigned int hash = GetFilePackPath(path + mountLength, entryPath);
+
+        // Binary search first entry with same hash, then check names (hash collisions)
+        unsigned int first = 0;
+        unsigned int last = filePacks[i].entryCount;
+
+        while (first < last)
+        {
+            unsigned int middle = first + (last - first)/2;
+
+            if (filePacks[i].entries[middle].hash < hash) first = middle + 1;
+            else last = middle;
+        }
+
+        for (unsigned int k = first; (k < filePacks[i].entryCount) && (filePacks[i].entries[k].hash == hash); k++)
+        {
+            if (strcmp(filePacks[i].names + filePacks[i].entries[k].nameOffset, entryPath) == 0)
+            {
+                *pack = &filePacks[i];
+                return &filePacks[i].entries[k];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Load file pack entry data, returns data allocated with RL_MALLOC() and '\0' terminated
+// NOTE: If borrowed is provided, uncompressed memory-mapped entries are returned without copy
+static unsigned char *LoadFilePackEntry(FilePack *pack, const FilePackEntry *entry, unsigned int *bytesRead, bool *borrowed)
+{
+    unsigned char *data = NULL;
+    *bytesRead = 0;
+
+    if ((borrowed != NULL) && (pack->mapped != NULL) && (entry->compression == FILE_PACK_UNCOMPRESSED))
+    {
+        *borrowed = true;
+        *bytesRead = entry->dataSize;
+        return pack->mapped + entry->offset;
+    }
+
+    // Entry stored data: memory-mapped or read directly from pack file
+    unsigned char *stored = NULL;
+    bool storedRead = false;
+
+    if (entry->compression == FILE_PACK_UNCOMPRESSED)
+    {
+        data = (unsigned char *)RL_MALLOC(entry->dataSize + 1);
+
+        if (pack->mapped != NULL) memcpy(data, pack->mapped + entry->offset, entry->size);
+        else stored = data;
+    }
+    else
+    {
+        // NOTE: Decompressor reads up to 16 bytes ahead, memory-mapped entries are always followed by the table of contents
+        if (pack->mapped != NULL) stored = pack->mapped + entry->offset;
+        else
+        {
+            stored = (unsigned char *)RL_CALLOC(entry->size + 16, 1);
+            storedRead = true;
+        }
+    }
+
+    if (pack->file != NULL)
+    {
+#if defined(ASYNC_JOBS_THREADED)
+        pthread_mutex_lock(&filePacksMutex);
+#endif
+        fseek(pack->file, entry->offset, SEEK_SET);
+        bool read = (fread(stored, 1, entry->size, pack->file) == entry->size);
+#if defined(ASYNC_JOBS_THREADED)
+        pthread_mutex_unlock(&filePacksMutex);
+#endif
+        if (!read)
+        {
+            TRACELOG(LOG_WARNING, "FILEPACK: [%s] Failed to read file pack entry", pack->names + entry->nameOffset);
+            if (storedRead) RL_FREE(stored);
+            else RL_FREE(data);
+            return NULL;
+        }
+    }
+
+    if (entry->compression != FILE_PACK_UNCOMPRESSED)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        data = (unsigned char *)RL_MALLOC(entry->dataSize + 1);
+        int codec = (entry->compression == FILE_PACK_LZ4)? COMPRESSION_LZ4 : COMPRESSION_DEFLATE;
+
+        if (DecompressDataToBuffer(stored, entry->size, data, entry->dataSize, codec) != (int)entry->dataSize)
+        {
+            TRACELOG(LOG_WARNING, "FILEPACK: [%s] Failed to decompress file pack entry", pack->names + entry->nameOffset);
+            RL_FREE(data);
+            data = NULL;
+        }
+#else
+        TRACELOG(LOG_WARNING, "FILEPACK: [%s] Compressed file pack entry requires compression API", pack->names + entry->nameOffset);
+#endif
+        if (storedRead) RL_FREE(stored);
+    }
+
+    if (data != NULL)
+    {
+        data[entry->dataSize] = '\0';
+        *bytesRead = entry->dataSize;
+        TRACELOGD("FILEPACK: [%s] File pack entry loaded successfully", pack->names + entry->nameOffset);
+    }
+
+    return data;
+}
+
+// Compare file pack entries by hash (qsort)
+static int CompareFilePackEntries(const void *a, const void *b)
+{
+    unsigned int hashA = ((const FilePackEntry *)a)->hash;
+    unsigned int hashB = ((const FilePackEntry *)b)->hash;
+
+    return (hashA > hashB) - (hashA < hashB);
+}
+#endif  // SUPPORT_FILE_PACKS
+
+// Check if file is provided by mounted file packs or custom file loader, read from its full data
+static bool IsFileProvided(const char *fileName)
+{
+    if (loadFileData != NULL) return true;
+
+#if defined(SUPPORT_FILE_PACKS)
+    FilePack *pack = NULL;
+    if (FindFilePackEntry(fileName, &pack) != NULL) return true;
+#endif
+
+    return false;
+}
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+// Open native file for unbuffered reads, file size is retrieved
+// NOTE: On NX, fsdev mounts (sdmc) are read with fs service calls, other devices (romfs) with their devoptab
+static bool OpenNativeFile(const char *fileName, NativeFile *file)
+{
+    memset(file, 0, sizeof(NativeFile));
+
+#if defined(PLATFORM_NX)
+    FsFileSystem *fs = NULL;
+    char path[FS_MAX_PATH] = { 0 };
+    s64 size = 0;
+
+    file->fd = -1;
+
+    if ((fsdevTranslatePath(fileName, &fs, path) != -1) && R_SUCCEEDED(fsFsOpenFile(fs, path, FsOpenMode_Read, &file->fsFile)))
+    {
+        if (R_FAILED(fsFileGetSize(&file->fsFile, &size)))
+        {
+            fsFileClose(&file->fsFile);
+            return false;
+        }
+    }
+    else
+    {
+        file->fd = open(fileName, O_RDONLY);
+        if (file->fd < 0) return false;
+
+        size = (s64)lseek(file->fd, 0, SEEK_END);
+    }
+
+    file->size = ((size > 0) && (size <= 0xffffffffLL))? (unsigned int)size : 0;
+#else
+    file->file = fopen(fileName, "rb");
+    if (file->file == NULL) return false;
+
+    // NOTE: Reads are large, stdio buffering only adds a copy
+    setvbuf(file->file, NULL, _IONBF, 0);
+
+    fseek(file->file, 0, SEEK_END);
+    long size = ftell(file->file);
+
+    file->size = (size > 0)? (unsigned int)size : 0;
+#endif
+
+    return true;
+}
+
+// Read native file at offset, reads are split in FILE_IO_READ_CHUNK, returns bytes read
+static unsigned int ReadNativeFile(NativeFile *file, unsigned int offset, void *buffer, unsigned int size)
+{
+    unsigned int bytesRead = 0;
+
+    if (offset >= file->size) return 0;
+    if (size > (file->size - offset)) size = file->size - offset;
+
+#if defined(PLATFORM_NX)
+    if ((file->fd >= 0) && (lseek(file->fd, (off_t)offset, SEEK_SET) < 0)) return 0;
+#else
+    if (fseek(file->file, (long)offset, SEEK_SET) != 0) return 0;
+#endif
+
+    while (bytesRead < size)
+    {
+        unsigned int chunkSize = ((size - bytesRead) < FILE_IO_READ_CHUNK)? (size - bytesRead) : FILE_IO_READ_CHUNK;
+        unsigned int count = 0;
+
+#if defined(PLATFORM_NX)
+        if (file->fd < 0)
+        {
+            u64 fsCount = 0;
+            if (R_SUCCEEDED(fsFileRead(&file->fsFile, (s64)offset + bytesRead, (unsigned char *)buffer + bytesRead, chunkSize, FsReadOption_None, &fsCount))) count = (unsigned int)fsCount;
+        }
+        else
+        {
+            ssize_t result = read(file->fd, (unsigned char *)buffer + bytesRead, chunkSize);
+            if (result > 0) count = (unsigned int)result;
+        }
+#else
+        count = (unsigned int)fread((unsigned char *)buffer + bytesRead, sizeof(unsigned char), chunkSize, file->file);
+#endif
+        if (count == 0) break;
+
+        bytesRead += count;
+    }
+
+    return bytesRead;
+}
+
+// Close native file
+static void CloseNativeFile(NativeFile *file)
+{
+#if defined(PLATFORM_NX)
+    if (file->fd >= 0) close(file->fd);
+    else fsFileClose(&file->fsFile);
+#else
+    if (file->file != NULL) fclose(file->file);
+#endif
+
+    memset(file, 0, sizeof(NativeFile));
+}
+
+// Queue file stream blocks ahead of read position to a read job, if no read job is pending
+// NOTE: Blocks behind read position are reused, blocks already holding their index are kept (i.e. after seeking back)
+static void QueueFileStreamBlocks(FileStream *stream)
+{
+    if (!IsJobCounterDone(&stream->readJob)) return;
+
+    unsigned int first = stream->position/FILE_STREAM_BLOCK_SIZE;
+    bool queued = false;
+
+    for (unsigned int i = 0; i < FILE_STREAM_BLOCKS; i++)
+    {
+        FileStreamBlock *block = &stream->blocks[(first + i)%FILE_STREAM_BLOCKS];
+        block->reading = false;
+
+        if ((unsigned long long)(first + i)*FILE_STREAM_BLOCK_SIZE >= stream->size) continue;
+        if (block->loaded && (block->index == (first + i))) continue;
+
+        block->index = first + i;
+        block->size = 0;
+        block->loaded = true;
+        block->reading = true;
+        queued = true;
+    }
+
+    if (queued)
+    {
+        stream->readIndex = first;
+        SubmitJob(ReadFileStreamJob, stream, NULL, &stream->readJob);
+    }
+}
+
+// Read file stream queued blocks in file order (job)
+static void ReadFileStreamJob(void *data)
+{
+    FileStream *stream = (FileStream *)data;
+
+    for (unsigned int i = 0; i < FILE_STREAM_BLOCKS; i++)
+    {
+        FileStreamBlock *block = &stream->blocks[(stream->readIndex + i)%FILE_STREAM_BLOCKS];
+
+        if (block->reading) block->size = ReadNativeFile(&stream->file, block->index*FILE_STREAM_BLOCK_SIZE, block->data, FILE_STREAM_BLOCK_SIZE);
+    }
+}
+#endif  // SUPPORT_NATIVE_FILEIO
+
+#if defined(TRACELOG_ASYNC_THREADED)
+// Init async trace-log ring and background thread, messages are printed on call if thread fails to start
+static void InitTraceLogRing(void)
+{
+    for (unsigned int i = 0; i < TRACELOG_ASYNC_RING_SIZE; i++) traceLogRing.messages[i].sequence = i;
+
+    pthread_mutex_init(&traceLogRing.consumerMutex, NULL);
+
+    TRACELOG_ATOMIC_STORE(&traceLogRing.running, 1);
+
+    if (pthread_create(&traceLogRing.threadId, NULL, TraceLogThread, NULL) == 0) atexit(CloseTraceLogRing);
+    else TRACELOG_ATOMIC_STORE(&traceLogRing.running, 0);
+}
+
+// Stop async trace-log background thread and print queued messages, registered to run at exit
+static void CloseTraceLogRing(void)
+{
+    TRACELOG_ATOMIC_STORE(&traceLogRing.running, 0);
+    pthread_join(traceLogRing.threadId, NULL);
+
+    FlushTraceLogRing();    // Messages queued while thread was stopping
+}
+
+// Format message into ring (lock-free), returns false if ring is full and message is dropped
+// NOTE: Position is claimed with compare-exchange, message is published when slot sequence is updated
+static bool QueueTraceLogMessage(const char *prefix, const char *text, va_list args)
+{
+    unsigned int position = TRACELOG_ATOMIC_LOAD(&traceLogRing.head);
+    unsigned int slot = 0;
+
+    while (true)
+    {
+        slot = position & (TRACELOG_ASYNC_RING_SIZE - 1);
+        int distance = (int)(TRACELOG_ATOMIC_LOAD(&traceLogRing.messages[slot].sequence) - position);
+
+        if (distance == 0)
+        {
+            // NOTE: Failed compare-exchange loads current head into position
+            if (TRACELOG_ATOMIC_CAS(&traceLogRing.head, &position, position + 1)) break;
+        }
+        else if (distance < 0)
+        {
+            TRACELOG_ATOMIC_ADD(&traceLogRing.dropped, 1);      // Ring full, slot not yet printed
+            return false;
+        }
+        else position = TRACELOG_ATOMIC_LOAD(&traceLogRing.head);
+    }
+
+    char *message = traceLogRing.messages[slot].text;
+    int length = snprintf(message, TRACELOG_ASYNC_MSG_LENGTH, "%s", prefix);
+    vsnprintf(message + length, TRACELOG_ASYNC_MSG_LENGTH - length, text, args);
+
+    TRACELOG_ATOMIC_STORE(&traceLogRing.messages[slot].sequence, position + 1);
+
+    return true;
+}
+
+// Print ring queued messages (in order) and dropped messages count, stdout flushed once
+static void FlushTraceLogRing(void)
+{
+    pthread_mutex_lock(&traceLogRing.consumerMutex);
+
+    int printed = 0;
+
+    while (true)
+    {
+        unsigned int slot = traceLogRing.tail & (TRACELOG_ASYNC_RING_SIZE - 1);
+
+        if (TRACELOG_ATOMIC_LOAD(&traceLogRing.messages[slot].sequence) != (traceLogRing.tail + 1)) break;
+
+        fputs(traceLogRing.messages[slot].text, stdout);
+        fputc('\n', stdout);
+
+        // Slot released for position one ring lap ahead
+        TRACELOG_ATOMIC_STORE(&traceLogRing.messages[slot].sequence, traceLogRing.tail + TRACELOG_ASYNC_RING_SIZE);
+        traceLogRing.tail++;
+        printed++;
+    }
+
+    int dropped = TRACELOG_ATOMIC_EXCHANGE(&traceLogRing.dropped, 0);
+    if (dropped > 0) { printf("WARNING: TRACELOG: %i messages dropped, async ring full\n", dropped); printed++; }
+
+    if (printed > 0) fflush(stdout);
+
+    pthread_mutex_unlock(&traceLogRing.consumerMutex);
+}
+
+// Async trace-log background thread, ring flushed every TRACELOG_ASYNC_FLUSH_INTERVAL milliseconds
+static void *TraceLogThread(void *arg)
+{
+    (void)arg;
+
+    struct timespec interval = { 0, TRACELOG_ASYNC_FLUSH_INTERVAL*1000000L };
+
+    while (TRACELOG_ATOMIC_LOAD(&traceLogRing.running))
+    {
+        FlushTraceLogRing();
+        nanosleep(&interval, NULL);
+    }
+
+    return NULL;
+}
+#endif  // TRACELOG_ASYNC_THREADED
+
+#if defined(SUPPORT_PROFILING_ZONES)
+// Record profiling event on capture, if running
+static void RecordProfileEvent(const char *name, char phase)
+{
+    if (!PROFILE_ATOMIC_LOAD(&profiler.capturing)) return;
+
+    unsigned int index = PROFILE_ATOMIC_ADD(&profiler.count, 1);
+
+    if (profiler.history) index %= profiler.capacity;
+
+    if (index < (unsigned int)profiler.capacity)
+    {
+        if (profileThread == 0) profileThread = PROFILE_ATOMIC_ADD(&profiler.threadCounter, 1) + 1;
+
+        ProfileEvent *event = &profiler.events[index];
+        event->name = name;
+        event->ticks = GetTimeTicks();
+        event->thread = profileThread;
+        event->phase = phase;
+    }
+}
+
+// Grow profiling capture events buffer (never shrinks)
+// NOTE: Events buffer only grows, zones on other threads could still be writing to it
+static bool ReserveProfileEvents(int maxEvents)
+{
+    if (maxEvents > profiler.capacity)
+    {
+        ProfileEvent *events = (ProfileEvent *)RL_REALLOC(profiler.events, maxEvents*sizeof(ProfileEvent));
+
+        if (events == NULL)
+        {
+            TRACELOG(LOG_WARNING, "PROFILE: Failed to allocate capture events buffer (%i events)", maxEvents);
+            return false;
+        }
+
+        profiler.events = events;
+        profiler.capacity = maxEvents;
+    }
+
+    return true;
+}
+
+// Export captured events range [first, last) as Chrome trace JSON, events indices wrap around events buffer
+static bool ExportProfileEvents(const char *fileName, unsigned int first, unsigned int last, unsigned long long startTicks)
+{
+    bool success = false;
+    FILE *file = fopen(fileName, "wt");
+
+    if (file != NULL)
+    {
+        double frequency = (double)GetTicksFrequency();
+
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+        for (unsigned int i = first; i < last; i++)
+        {
+            const ProfileEvent *event = &profiler.events[i%profiler.capacity];
+            double ts = 0.0;
+
+            // NOTE: Events recorded by other threads could be timed before capture start
+            if (event->ticks > startTicks) ts = (double)(event->ticks - startTicks)*1000000.0/frequency;
+
+            fprintf(file, "{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%.3f", event->phase, event->thread, ts);
+
+            if (event->phase == 'B') fprintf(file, ",\"name\":\"%s\"", event->name);
+            else if (event->phase == 'i') fprintf(file, ",\"name\":\"Frame\",\"s\":\"g\"");
+
+            fprintf(file, "}%s\n", (i < (last - 1))? "," : "");
+        }
+
+        fprintf(file, "]}\n");
+
+        success = (fclose(file) == 0);
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Profile capture exported successfully (%u events)", fileName, last - first);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write profile capture", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+
+    return success;
+}
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+// Lock tracked allocations access, allocations can be done from any thread
+static void LockMemoryTracker(void)
+{
+#if defined(MEMORY_TRACKING_THREADED)
+    pthread_mutex_lock(&memoryTrackerMutex);
+#endif
+}
+
+// Unlock tracked allocations access
+static void UnlockMemoryTracker(void)
+{
+#if defined(MEMORY_TRACKING_THREADED)
+    pthread_mutex_unlock(&memoryTrackerMutex);
+#endif
+}
+
+// Get allocations table home slot for an address (Fibonacci hashing)
+static unsigned int GetMemoryAllocationSlot(const void *ptr, unsigned int capacity)
+{
+    unsigned long long hash = ((unsigned long long)(size_t)ptr >> 4)*11400714819323198485ull;
+
+    return (unsigned int)(hash >> 32) & (capacity - 1);
+}
+
+// Find tracked allocation by address, NULL if not tracked
+static MemoryAllocation *FindMemoryAllocation(const void *ptr)
+{
+    if (memoryTracker.count == 0) return NULL;
+
+    unsigned int mask = memoryTracker.capacity - 1;
+
+    for (unsigned int i = GetMemoryAllocationSlot(ptr, memoryTracker.capacity); memoryTracker.entries[i].ptr != NULL; i = (i + 1) & mask)
+    {
+        if (memoryTracker.entries[i].ptr == ptr) return &memoryTracker.entries[i];
+    }
+
+    return NULL;
+}
+
+// Register allocation and update stats, tracker must be locked
+// NOTE: Allocations not registered if the table can not grow, stats just miss them
+static void TrackMemoryAllocation(void *ptr, size_t size, int tag, int allocator)
+{
+    // Address still tracked, previous allocation was released by external code (not RL_FREE)
+    UntrackMemoryAllocation(ptr);
+
+    if ((memoryTracker.count + 1)*2 > memoryTracker.capacity)
+    {
+        unsigned int capacity = (memoryTracker.capacity == 0)? MEMORY_TRACKING_MIN_CAPACITY : memoryTracker.capacity*2;
+        MemoryAllocation *entries = (MemoryAllocation *)MemCallocUntracked(capacity, sizeof(MemoryAllocation));
+
+        if (entries == NULL) return;
+
+        for (unsigned int i = 0; i < memoryTracker.capacity; i++)
+        {
+            if (memoryTracker.entries[i].ptr == NULL) continue;
+
+            unsigned int slot = GetMemoryAllocationSlot(memoryTracker.entries[i].ptr, capacity);
+            while (entries[slot].ptr != NULL) slot = (slot + 1) & (capacity - 1);
+            entries[slot] = memoryTracker.entries[i];
+        }
+
+        MemFreeUntracked(memoryTracker.entries);
+        memoryTracker.entries = entries;
+        memoryTracker.capacity = capacity;
+    }
+
+    unsigned int slot = GetMemoryAllocationSlot(ptr, memoryTracker.capacity);
+    while (memoryTracker.entries[slot].ptr != NULL) slot = (slot + 1) & (memoryTracker.capacity - 1);
+
+    memoryTracker.entries[slot].ptr = ptr;
+    memoryTracker.entries[slot].size = size;
+    memoryTracker.entries[slot].tag = tag;
+    memoryTracker.entries[slot].allocator = allocator;
+    memoryTracker.count++;
+
+    int tags[2] = { MEMORY_TAG_ALL, tag };
+
+    for (int i = 0; i < 2; i++)
+    {
+        MemoryStats *stats = &memoryTracker.stats[tags[i]];
+
+        stats->usedBytes += size;
+        stats->allocationCount++;
+        if (stats->usedBytes > stats->peakBytes) stats->peakBytes = stats->usedBytes;
+        memoryTracker.allocations[tags[i]]++;
+    }
+}
+
+// Unregister allocation and update stats, tracker must be locked
+// NOTE: Entries following on the probe sequence are shifted back, no deleted markers required
+static void UntrackMemoryAllocation(void *ptr)
+{
+    MemoryAllocation *allocation = FindMemoryAllocation(ptr);
+
+    if (allocation == NULL) return;
+
+    int tags[2] = { MEMORY_TAG_ALL, allocation->tag };
+
+    for (int i = 0; i < 2; i++)
+    {
+        memoryTracker.stats[tags[i]].usedBytes -= allocation->size;
+        memoryTracker.stats[tags[i]].allocationCount--;
+        memoryTracker.frees[tags[i]]++;
+    }
+
+    unsigned int mask = memoryTracker.capacity - 1;
+    unsigned int i = (unsigned int)(allocation - memoryTracker.entries);
+
+    for (unsigned int j = (i + 1) & mask; memoryTracker.entries[j].ptr != NULL; j = (j + 1) & mask)
+    {
+        unsigned int slot = GetMemoryAllocationSlot(memoryTracker.entries[j].ptr, memoryTracker.capacity);
+
+        // Entry kept in place if its home slot is cyclically in (i, j]
+        if ((i <= j)? ((i < slot) && (slot <= j)) : ((i < slot) || (slot <= j))) continue;
+
+        memoryTracker.entries[i] = memoryTracker.entries[j];
+        i = j;
+    }
+
+    memoryTracker.entries[i].ptr = NULL;
+    memoryTracker.count--;
+}
+
+// Allocate memory with allocator (0: default allocator)
+static void *AllocMemory(size_t size, bool zeroed, int allocator)
+{
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    if (allocator != 0)
+    {
+        MemoryAllocator *callbacks = &memoryTracker.allocators[allocator];
+        void *ptr = callbacks->alloc((unsigned int)size, callbacks->userData);
+
+        if ((ptr != NULL) && zeroed) memset(ptr, 0, size);
+
+        return ptr;
+    }
+#endif
+
+    return zeroed? MemCallocUntracked(1, size) : MemAllocUntracked(size);
+}
+
+// Reallocate memory with allocator (0: default allocator), tracker must be locked
+// NOTE: Allocators without realloc function allocate new memory, copy data and free previous memory
+static void *ReallocMemory(void *ptr, size_t size, size_t oldSize, int allocator)
+{
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    if (allocator != 0)
+    {
+        MemoryAllocator *callbacks = &memoryTracker.allocators[allocator];
+
+        if (callbacks->realloc != NULL) return callbacks->realloc(ptr, (unsigned int)size, callbacks->userData);
+
+        void *result = (size > 0)? callbacks->alloc((unsigned int)size, callbacks->userData) : NULL;
+
+        if ((ptr != NULL) && ((result != NULL) || (size == 0)))
+        {
+            if (result != NULL) memcpy(result, ptr, (oldSize < size)? oldSize : size);
+            callbacks->free(ptr, callbacks->userData);
+        }
+
+        return result;
+    }
+#else
+    (void)oldSize;
+#endif
+
+    return MemReallocUntracked(ptr, size);
+}
+
+// Free memory with allocator (0: default allocator)
+static void FreeMemory(void *ptr, int allocator)
+{
+#if defined(SUPPORT_CUSTOM_ALLOCATORS)
+    if (allocator != 0)
+    {
+        // NOTE: Allocators are never removed, callbacks can be read unlocked
+        MemoryAllocator *callbacks = &memoryTracker.allocators[allocator];
+        callbacks->free(ptr, callbacks->userData);
+        return;
+    }
+#endif
+
+    MemFreeUntracked(ptr);
+}
+#endif  // SUPPORT_MEMORY_TRACKING
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *buf, int size)
 {
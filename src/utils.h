@@ -32,11 +32,26 @@
     #include <android/asset_manager.h>      // Required for: AAssetManager
 #endif
 
+// Custom allocators release memory with the allocator used, it requires allocations registry
+#if defined(SUPPORT_CUSTOM_ALLOCATORS) && !defined(SUPPORT_MEMORY_TRACKING)
+    #define SUPPORT_MEMORY_TRACKING
+#endif
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #include <stddef.h>                     // Required for: size_t
+#endif
+
+// Assets hot-reload jobs run on async load workers
+#if defined(SUPPORT_ASSET_HOT_RELOAD) && !defined(SUPPORT_ASYNC_LOADING)
+    #undef SUPPORT_ASSET_HOT_RELOAD
+#endif
+
+// NOTE: Log level is checked on call site, arguments are not evaluated (nor formatted) for messages not shown
 #if defined(SUPPORT_TRACELOG)
-    #define TRACELOG(level, ...) TraceLog(level, __VA_ARGS__)
+    #define TRACELOG(level, ...) do { if (IsTraceLogEnabled(level)) TraceLog(level, __VA_ARGS__); } while (0)
 
     #if defined(SUPPORT_TRACELOG_DEBUG)
-        #define TRACELOGD(...) TraceLog(LOG_DEBUG, __VA_ARGS__)
+        #define TRACELOGD(...) do { if (IsTraceLogEnabled(LOG_DEBUG)) TraceLog(LOG_DEBUG, __VA_ARGS__); } while (0)
     #else
         #define TRACELOGD(...) (void)0
     #endif
@@ -52,10 +67,104 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// Thread-local storage, used by per-thread scratch memory and static text buffers
+#ifndef RL_THREAD_LOCAL
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #else
+        #define RL_THREAD_LOCAL _Thread_local
+    #endif
+#endif
+
+// Profiling zones, compiled out if SUPPORT_PROFILING_ZONES is not defined
+// NOTE: Zone variable is declared by RL_PROFILE_ZONE_BEGIN(), zone must be ended on the same scope, name must be a static string
+#if defined(SUPPORT_PROFILING_ZONES) && defined(SUPPORT_TRACY_PROFILER)
+    #include "tracy/TracyC.h"
+    #define RL_PROFILE_ZONE_BEGIN(zone, name)   TracyCZoneN(zone, name, 1)
+    #define RL_PROFILE_ZONE_END(zone)           TracyCZoneEnd(zone)
+    #define RL_PROFILE_FRAME_MARK()             TracyCFrameMark
+#elif defined(SUPPORT_PROFILING_ZONES)
+    #define RL_PROFILE_ZONE_BEGIN(zone, name)   unsigned long long zone = BeginProfileZone(name)
+    #define RL_PROFILE_ZONE_END(zone)           EndProfileZone(zone)
+    #define RL_PROFILE_FRAME_MARK()             ProfileFrameMark()
+#else
+    #define RL_PROFILE_ZONE_BEGIN(zone, name)   (void)0
+    #define RL_PROFILE_ZONE_END(zone)           (void)0
+    #define RL_PROFILE_FRAME_MARK()             (void)0
+#endif
+
+// Modules allocations tracked with the module memory tag, RL_MEMORY_TAG must be defined before including utils.h
+#if defined(SUPPORT_MEMORY_TRACKING) && defined(RL_MEMORY_TAG)
+    #undef RL_MALLOC
+    #undef RL_CALLOC
+    #undef RL_REALLOC
+    #undef RL_FREE
+
+    #define RL_MALLOC(sz)       MemAllocTracked(sz, RL_MEMORY_TAG)
+    #define RL_CALLOC(n,sz)     MemCallocTracked(n, sz, RL_MEMORY_TAG)
+    #define RL_REALLOC(ptr,sz)  MemReallocTracked(ptr, sz, RL_MEMORY_TAG)
+    #define RL_FREE(ptr)        MemFreeTracked(ptr)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_ASYNC_LOADING)
+// Async load job types, used to check the job data type on results retrieval
+typedef enum {
+    ASYNC_JOB_TEXTURE = 1,
+    ASYNC_JOB_MODEL,
+    ASYNC_JOB_FONT,
+    ASYNC_JOB_SOUND,
+    ASYNC_JOB_TEXTURE_MIPMAP,
+    ASYNC_JOB_SCREEN_CAPTURE,
+    ASYNC_JOB_IMAGE,
+    ASYNC_JOB_ASSET_RELOAD,
+    ASYNC_JOB_SHADER,
+    ASYNC_JOB_FILE
+} AsyncJobType;
+
+// Async load job stage callback, returns false on failure
+// NOTE: Stage callbacks must release any partial data on failure
+typedef bool (*AsyncJobCallback)(void *data);
+#endif
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+// File stream, sequential reads served from blocks read ahead by jobs (opaque)
+typedef struct FileStream FileStream;
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+// Watched asset types
+typedef enum {
+    ASSET_WATCH_TEXTURE = 0,
+    ASSET_WATCH_SHADER,
+    ASSET_WATCH_MODEL,
+    ASSET_WATCH_FONT
+} AssetWatchType;
+
+// Asset reload job data, decode stage loads the watched files, upload stage replaces asset data in place
+// NOTE: Upload stage always releases decoded data, asset is not updated if it was unloaded while reloading (cancelled)
+typedef struct AssetReloadJob {
+    char fileName[2][512];      // Watched files, second file is optional (i.e. shader fragment code)
+    unsigned int id;            // Asset GPU object id (texture, shader program)
+    void *ptr[2];               // Asset data replaced in place (i.e. shader locations, model meshes, font glyphs)
+    int params[4];              // Asset parameters on load (i.e. texture size and format)
+    void *data;                 // Decoded data (module specific)
+    bool cancelled;             // Asset unloaded while reloading
+} AssetReloadJob;
+#endif
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+// Cached resource types
+typedef enum {
+    RESOURCE_TEXTURE = 0,
+    RESOURCE_SHADER,
+    RESOURCE_FONT,
+    RESOURCE_MODEL,
+    RESOURCE_SOUND
+} ResourceType;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +183,62 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+bool LoadFileDataRange(const char *fileName, unsigned int offset, unsigned int size, unsigned char *buffer);  // Load file data range into buffer (file packs supported)
+
+#if defined(SUPPORT_NATIVE_FILEIO)
+FileStream *OpenFileStream(const char *fileName);                   // Open file stream for sequential reads, blocks ahead of read position are read by jobs
+unsigned int ReadFileStream(FileStream *stream, void *buffer, unsigned int size);  // Read file stream data from read position, returns bytes read
+bool SeekFileStream(FileStream *stream, int offset, int origin);    // Set file stream read position (SEEK_SET, SEEK_CUR, SEEK_END)
+unsigned int GetFileStreamPosition(FileStream *stream);             // Get file stream read position
+unsigned int GetFileStreamSize(FileStream *stream);                 // Get file stream size (in bytes)
+void CloseFileStream(FileStream *stream);                           // Close file stream, waits for pending read job
+#endif
+
+void *MemAllocScratch(unsigned int size);                           // Allocate temporary memory from current thread scratch arena (heap if full)
+void MemFreeScratch(void *ptr);                                     // Free temporary memory, scratch arena rewound once all are freed
+void ResetScratchMemory(void);                                      // Rewind current thread scratch arena, temporaries expire (EndDrawing())
+void UnloadScratchMemory(void);                                     // Unload current thread scratch arena (thread exit)
+
+#if defined(SUPPORT_MEMORY_TRACKING)
+void *MemAllocTracked(size_t size, int tag);                        // Tracked memory allocator (MemoryTag)
+void *MemCallocTracked(size_t count, size_t size, int tag);         // Tracked memory allocator, zero-initialized (MemoryTag)
+void *MemReallocTracked(void *ptr, size_t size, int tag);           // Tracked memory reallocator, original tag is kept
+void MemFreeTracked(void *ptr);                                     // Tracked memory free, addresses not tracked are just released
+void UpdateMemoryStats(void);                                       // Update memory stats frame counters (EndDrawing())
+#endif
+
+#if defined(SUPPORT_PROFILING_ZONES)
+void ProfileFrameMark(void);                                        // Register frame end on profiling capture (EndDrawing())
+bool StartProfileHistory(int maxEvents);                            // Start rolling profiling history capture (frame hitches), not started while a capture is running
+void StopProfileHistory(void);                                      // Stop rolling profiling history capture
+bool ExportProfileHistory(const char *fileName, int frames);        // Export last frames of rolling profiling history as Chrome trace JSON
+#endif
+
+#if defined(SUPPORT_ASYNC_LOADING)
+unsigned int SubmitAsyncJob(int type, void *data, AsyncJobCallback decode, AsyncJobCallback upload);   // Submit async load job, data is freed on release
+void *GetAsyncJobData(unsigned int handle, int type);   // Get async load job data, waits for job to finish, NULL if failed
+void ReleaseAsyncJob(unsigned int handle);              // Release async load job handle and data
+void ProcessAsyncJobs(void);                            // Run async load jobs upload stage within frame budget (main thread)
+bool RequestAsyncTransfer(int bytes);                   // Request GPU transfer bytes from frame budget (upload stages), false if it must wait
+void DeferAsyncJobUpload(void);                         // Request running upload stage to run again next frame (job stays pending)
+void CloseAsyncJobs(void);                              // Stop async load worker threads and release pending jobs
+#endif
+
+#if defined(SUPPORT_ASSET_HOT_RELOAD)
+void WatchAsset(int type, const AssetReloadJob *asset, AsyncJobCallback decode, AsyncJobCallback upload);   // Watch asset files, asset reloaded in place when changed
+void UnwatchAsset(int type, unsigned int id, const void *ptr);  // Stop watching asset files (asset unloaded), pending reload is cancelled
+void UpdateAssetWatch(void);                            // Check watched files and submit reload jobs (EndDrawing())
+void CloseAssetWatch(void);                             // Stop watching all assets, pending reloads are cancelled
+#endif
+
+#if defined(SUPPORT_RESOURCE_CACHE)
+bool LoadCachedResource(int type, const char *key, void *resource, int size);   // Get cached resource copy and add a reference, false if not cached
+bool IsResourceCached(int type, const char *key);      // Check if resource is cached, no reference added
+void CacheResource(int type, const char *key, const void *resource, int size, unsigned long long id);  // Cache loaded resource with one reference (identity: GPU object id or data pointer)
+int ReleaseCachedResource(int type, unsigned long long id);     // Release cached resource reference, returns references left, -1 if not cached
+void CloseResourceCache(void);                          // Release all cached resources entries, resources are not unloaded
+#endif
+
 #ifdef __cplusplus
 }
 #endif